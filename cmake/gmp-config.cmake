@@ -0,0 +1,4 @@
+# Copyright(c) 2024 Lkimuk Distributed under the MIT License
+
+include("${CMAKE_CURRENT_LIST_DIR}/gmp-targets.cmake")
+include("${CMAKE_CURRENT_LIST_DIR}/gmp_instantiate.cmake")
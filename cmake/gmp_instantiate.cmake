@@ -0,0 +1,67 @@
+# Copyright(c) 2024 Lkimuk Distributed under the MIT License
+
+# ---------------------------------------------------------------------------------------
+# gmp_shard_instantiations(<target>
+#     HEADER <header>     header declaring the template and DECL
+#     DECL <macro>        macro naming the specialization for a type, e.g. KERNEL_DECL
+#     TYPES <type>...     the template arguments to instantiate
+#     SHARDS <k>)         number of translation units to generate
+#
+# Generates <k> translation units, each defining the explicit instantiations
+# of one index range of TYPES with GMP_INSTANTIATE_TEMPLATES, and adds them to
+# <target>. The header is expected to declare them all with
+# GMP_EXTERN_TEMPLATES, so that no other translation unit instantiates them.
+# <target> must link gmp::gmp.
+#
+# The types of a shard are joined with commas into the arguments of the
+# macro, so a type that contains a comma, such as std::map<int, int>, must
+# be given in parentheses, "(std::map<int, int>)", with a DECL that removes
+# them. Any other entry with a comma is rejected.
+# ---------------------------------------------------------------------------------------
+function(gmp_shard_instantiations target)
+    cmake_parse_arguments(GMP_SHARD "" "HEADER;DECL;SHARDS" "TYPES" ${ARGN})
+
+    foreach(arg HEADER DECL TYPES)
+        if(NOT DEFINED GMP_SHARD_${arg})
+            message(FATAL_ERROR "gmp_shard_instantiations: ${arg} is required")
+        endif()
+    endforeach()
+
+    foreach(type IN LISTS GMP_SHARD_TYPES)
+        if(type MATCHES "," AND NOT type MATCHES "^\\(.*\\)$")
+            message(FATAL_ERROR "gmp_shard_instantiations: the type '${type}' "
+                "contains a comma; pass it in parentheses and unpack it in DECL")
+        endif()
+    endforeach()
+
+    list(LENGTH GMP_SHARD_TYPES count)
+    if(NOT DEFINED GMP_SHARD_SHARDS)
+        set(GMP_SHARD_SHARDS 1)
+    endif()
+    if(GMP_SHARD_SHARDS GREATER count)
+        set(GMP_SHARD_SHARDS ${count})
+    endif()
+
+    get_filename_component(header "${GMP_SHARD_HEADER}" ABSOLUTE)
+    set(shard_dir "${CMAKE_CURRENT_BINARY_DIR}/gmp_shards/${target}")
+
+    math(EXPR last_shard "${GMP_SHARD_SHARDS} - 1")
+    foreach(shard RANGE ${last_shard})
+        math(EXPR begin "${shard} * ${count} / ${GMP_SHARD_SHARDS}")
+        math(EXPR length "(${shard} + 1) * ${count} / ${GMP_SHARD_SHARDS} - ${begin}")
+        list(SUBLIST GMP_SHARD_TYPES ${begin} ${length} types)
+        list(JOIN types ", " types)
+
+        set(shard_file "${shard_dir}/${GMP_SHARD_DECL}_${shard}.cpp")
+        file(WRITE "${shard_file}.in" "\
+// Generated by gmp_shard_instantiations(), do not edit.
+#include \"${header}\"
+#include <gmp/macro/instantiate.hpp>
+
+GMP_INSTANTIATE_TEMPLATES(${GMP_SHARD_DECL}, ${types})
+")
+        # Only touch the shard when its content changes, to avoid rebuilding it.
+        configure_file("${shard_file}.in" "${shard_file}" COPYONLY)
+        target_sources(${target} PRIVATE "${shard_file}")
+    endforeach()
+endfunction()
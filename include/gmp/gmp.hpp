@@ -2,5 +2,6 @@
 #define GMP_HPP_
 
 #include <gmp/macro/macro.hpp>
+#include <gmp/meta/type_list.hpp>
 
-#endif // GMP_HPP_
\ No newline at end of file
+#endif // GMP_HPP_
@@ -0,0 +1,176 @@
+/**
+ * \file arith.hpp
+ * \brief Arithmetic, logic and comparisons on values in [0, GMP_MAX_INDEX].
+ */
+#ifndef GMP_MACRO_ARITH_HPP_
+#define GMP_MACRO_ARITH_HPP_
+
+#include <gmp/macro/varargs.hpp>
+#include _GMP_LIMIT_ARITH_TABLES
+
+
+/**
+ * \def GMP_INC(value)
+ * \brief Increment a value by 1.
+ * 
+ * This macro uses overload invocation to increment a value by 1.
+ * It relies on specific macro definitions for each value.
+ * 
+ * \param value The value to increment.
+ * \return The incremented value.
+ */
+#define GMP_INC(value) GMP_OVERLOAD_INVOKE1(_GMP_INC, value)()
+
+
+/**
+ * \def GMP_DEC(value)
+ * \brief Decrement a value by 1.
+ * 
+ * This macro uses overload invocation to decrement a value by 1.
+ * It relies on specific macro definitions for each value.
+ * 
+ * \param value The value to decrement.
+ * \return The decremented value.
+ */
+#define GMP_DEC(value) GMP_OVERLOAD_INVOKE1(_GMP_DEC, value)()
+
+/**
+ * \def GMP_NOT(value)
+ * \brief Macro to perform logical NOT operation on a value.
+ * 
+ * This macro uses overload invocation to perform a logical NOT operation.
+ * It relies on specific macro definitions for each value.
+ * 
+ * \param value The value to perform logical NOT on.
+ * \return 1 if the value is 0, 0 otherwise.
+ */
+#define GMP_NOT(value) GMP_OVERLOAD_INVOKE1(_GMP_NOT, value)
+#define _GMP_NOT_0 1
+#define _GMP_NOT_1 0
+
+/**
+ * \brief Macro to perform logical AND operation between two values.
+ * 
+ * This macro uses overload invocation to perform a logical AND operation.
+ * It relies on specific macro definitions for each combination of values.
+ * 
+ * \param a The first operand (0 or 1).
+ * \param b The second operand (0 or 1).
+ * \return 1 if both operands are 1, 0 otherwise.
+ */
+#define GMP_AND(a, b) GMP_OVERLOAD_INVOKE2(_GMP_AND, a, b)
+#define _GMP_AND_0_0 0
+#define _GMP_AND_0_1 0
+#define _GMP_AND_1_0 0
+#define _GMP_AND_1_1 1
+
+/**
+ * \brief Macro to perform logical OR operation between two values.
+ * 
+ * \param a The first operand (0 or 1).
+ * \param b The second operand (0 or 1).
+ * \return 1 if either operand is 1, 0 otherwise.
+ */
+#define GMP_OR(a, b) GMP_OVERLOAD_INVOKE2(_GMP_OR, a, b)
+#define _GMP_OR_0_0 0
+#define _GMP_OR_0_1 1
+#define _GMP_OR_1_0 1
+#define _GMP_OR_1_1 1
+
+/**
+ * \brief Macro to perform logical XOR operation between two values.
+ * 
+ * \param a The first operand (0 or 1).
+ * \param b The second operand (0 or 1).
+ * \return 1 if exactly one operand is 1, 0 otherwise.
+ */
+#define GMP_XOR(a, b) GMP_OVERLOAD_INVOKE2(_GMP_XOR, a, b)
+#define _GMP_XOR_0_0 0
+#define _GMP_XOR_0_1 1
+#define _GMP_XOR_1_0 1
+#define _GMP_XOR_1_1 0
+
+/**
+ * \brief Macro to convert a value to a boolean representation.
+ * 
+ * This macro uses overload invocation to convert a value to its boolean representation.
+ * It relies on specific macro definitions for each value.
+ * 
+ * \param value The value to convert (0 or non-zero).
+ * \return 0 if the value is 0, 1 otherwise.
+ */
+#define GMP_BOOL(value) GMP_OVERLOAD_INVOKE1(_GMP_BOOL, value)
+
+/**
+ * \def GMP_IIF(bit, t, f)
+ * \brief Select one of two token sequences by a bit.
+ *
+ * \param bit The condition (0 or 1).
+ * \param t The result if \a bit is 1.
+ * \param f The result if \a bit is 0.
+ *
+ * \par Example
+ * \code
+ * GMP_IIF(1, int, long)  // int
+ * GMP_IF(7, int, long)   // int
+ * GMP_IF(0, int, long)   // long
+ * \endcode
+ */
+#define GMP_IIF(bit, t, f) GMP_OVERLOAD_INVOKE1(_GMP_IIF, bit)(t, f)
+#define _GMP_IIF_0(t, f) f
+#define _GMP_IIF_1(t, f) t
+
+/**
+ * \def GMP_IF(cond, t, f)
+ * \brief Select one of two token sequences by a value in [0, GMP_MAX_INDEX].
+ *
+ * \see GMP_IIF
+ */
+#define GMP_IF(cond, t, f) GMP_IIF(GMP_BOOL(cond), t, f)
+
+/**
+ * \brief Macro to check if an index is within a specified range.
+ * 
+ * This macro checks if the given index is within a specified range defined by \ref GMP_MAX_INDEX.
+ * If the index exceeds \ref GMP_MAX_INDEX, an error is generated; otherwise, it performs no action.
+ * 
+ * \param index The index to check.
+ */
+#define GMP_CHECK_INDEX(index) GMP_OVERLOAD_INVOKE1(_GMP_CHECK_INDEX_R, GMP_HAS_COMMA(GMP_OVERLOAD_INVOKE1(_GMP_CHECK_INDEX, index)))(index)
+#define _GMP_CHECK_INDEX_R_1(index)
+#define _GMP_CHECK_INDEX_ERROR_MSG_IMPL(index, maximum) Error_Index_##index##_Exceeds_Maximum_Macro_Index_##maximum;
+#define _GMP_CHECK_INDEX_ERROR_MSG(index, maximum) _GMP_CHECK_INDEX_ERROR_MSG_IMPL(index, maximum)
+#define _GMP_CHECK_INDEX_R_0(index) _GMP_CHECK_INDEX_ERROR_MSG(index, GMP_MAX_INDEX)
+
+/**
+  * \brief Macro to check if an index is within a specified range.
+  *
+  * This macro checks if the given index is within a specified range defined by \ref GMP_MAX_INDEX.
+  * If the index exceeds \ref GMP_MAX_INDEX, an error is generated; otherwise, it performs no action.
+  *
+  * \param index The index to check.
+  * \return 1 if the given index is valid, 0 otherwise.
+  */
+#define GMP_CHECK_INDEX_BOOL(index) GMP_OVERLOAD_INVOKE1(_GMP_CHECK_INDEX_BOOL_R, GMP_HAS_COMMA(GMP_OVERLOAD_INVOKE1(_GMP_CHECK_INDEX, index)))
+#define _GMP_CHECK_INDEX_BOOL_R_1 1
+#define _GMP_CHECK_INDEX_BOOL_R_0 0
+
+/**
+ * \brief Macro to compare two integer values for equality.
+ *
+ * This macro compares two integer values, \a i and \a j, and returns 1 if they are equal,
+ * and 0 if they are not. The maximum values for \a i and \a j should not exceed \ref GMP_MAX_INDEX.
+ *
+ * \param i The first integer value to compare.
+ * \param j The second integer value to compare.
+ * \return 1 if \a i and \a j are equal, 0 otherwise.
+ *
+ * \note Both \a i and \a j should be less than or equal to \ref GMP_MAX_INDEX.
+ */
+#define GMP_EQUAL_INT(i, j) GMP_CHECK_INDEX(i) GMP_CHECK_INDEX(j) GMP_OVERLOAD_INVOKE1(_GMP_EQUAL_INT_RESULT, \
+    GMP_HAS_COMMA(GMP_OVERLOAD_INVOKE2(_GMP_EQUAL_INT, i, j)))
+#define _GMP_EQUAL_INT_RESULT_0 0
+#define _GMP_EQUAL_INT_RESULT_1 1
+
+
+#endif // GMP_MACRO_ARITH_HPP_
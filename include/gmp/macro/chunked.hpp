@@ -0,0 +1,56 @@
+/**
+ * \file chunked.hpp
+ * \brief \ref GMP_LOOP split into functions of bounded size.
+ */
+#ifndef GMP_MACRO_CHUNKED_HPP_
+#define GMP_MACRO_CHUNKED_HPP_
+
+#include <gmp/meta/unroll.hpp>
+
+
+/**
+ * \def GMP_LOOP_CHUNKED(call, count, chunk, ...)
+ * \brief Repeat a call like \ref GMP_LOOP, \a chunk calls per function.
+ *
+ * A body written by \ref GMP_LOOP over a few hundred iterations is a single
+ * function, whose optimization time grows faster than its size. This macro
+ * expands `call(...)` once, in a lambda, and lets \ref gmp::unroll_chunked
+ * unroll it \a count times into functions of at most \a chunk calls, called
+ * one after the other. As with the default of \ref gmp::unroll_chunked, these
+ * functions are marked \ref GMP_NOINLINE, so the optimizer cannot merge them
+ * back into the caller; \ref GMP_LOOP_CHUNKED_INLINE leaves that to it.
+ *
+ * The calls must form statements. Since the unrolling is done by templates,
+ * \a count is not limited to \ref GMP_MAX_INDEX and may be any constant
+ * expression.
+ *
+ * \note The macro expands to the call of a lambda capturing by reference, not
+ * to the calls themselves, so it is only valid at block scope, as a statement
+ * inside a function.
+ *
+ * \param call The function or macro to be called in each iteration.
+ * \param count The number of times the function call should be executed.
+ * \param chunk The largest number of calls emitted in one function.
+ * \param ... Additional arguments passed to each invocation of \a call.
+ *
+ * \par Example
+ * \code
+ * #define STEP(state) state = mix(state);
+ * GMP_LOOP_CHUNKED(STEP, 512, 64, s); // 8 functions of 64 steps
+ * \endcode
+ */
+#define GMP_LOOP_CHUNKED(call, count, chunk, ...) \
+    ::gmp::unroll_chunked<(count), (chunk), true>([&](::std::size_t) { call(__VA_ARGS__) })
+
+/**
+ * \def GMP_LOOP_CHUNKED_INLINE(call, count, chunk, ...)
+ * \brief \ref GMP_LOOP_CHUNKED with chunks the compiler may inline.
+ *
+ * \note Like \ref GMP_LOOP_CHUNKED, it expands to a lambda capturing by
+ * reference and is only valid at block scope.
+ */
+#define GMP_LOOP_CHUNKED_INLINE(call, count, chunk, ...) \
+    ::gmp::unroll_chunked<(count), (chunk), false>([&](::std::size_t) { call(__VA_ARGS__) })
+
+
+#endif // GMP_MACRO_CHUNKED_HPP_
@@ -0,0 +1,108 @@
+/**
+ * \file core.hpp
+ * \brief Token pasting, forced expansion and deferred evaluation.
+ *
+ * These macros need no tables and are the base of every other header in
+ * gmp/macro.
+ */
+#ifndef GMP_MACRO_CORE_HPP_
+#define GMP_MACRO_CORE_HPP_
+
+
+/**
+ * \def GMP_EXPAND(x)
+ * \brief Force the expansion of a macro.
+ * 
+ * This macro forces the expansion of its argument \a x.
+ * It is often used as an intermediary step to ensure that
+ * macro arguments are fully expanded before being passed
+ * to other macros.
+ *
+ * \param x The macro to be expanded.
+ * \return The expanded result of \a x.
+ *
+ * \par Example
+ * \code
+ * #define FOO 42
+ * #define BAR FOO
+ * #define BAZ(x) GMP_EXPAND(x)
+ *
+ * int value = BAZ(BAR); // value will be 42
+ * \endcode
+ */
+#define GMP_EXPAND(x) x
+
+/**
+ * \def GMP_CONCAT_HELPER(lhs, rhs)
+ * \brief Helper macro to concatenate two tokens.
+ *
+ * This macro performs the actual concatenation of two tokens.
+ * It is used internally by the \ref GMP_CONCAT macro to ensure
+ * proper expansion of the tokens before concatenation.
+ *
+ * \param lhs First token.
+ * \param rhs Second token.
+ * \return The concatenation of \a lhs and \a rhs.
+ */
+#define GMP_CONCAT_HELPER(lhs, rhs) lhs ## rhs
+
+/**
+ * \def GMP_CONCAT(lhs, rhs)
+ * \brief  Concatenates two tokens after expanding them.
+ * 
+ * This macro concatenates two tokens \a lhs and \a rhs after
+ * expanding them. It uses \ref GMP_CONCAT_HELPER to perform the
+ * actual concatenation. 
+ * 
+ * \param lhs First token.
+ * \param rhs Second token.
+ * \return The concatenation of the expanded \a lhs and \a rhs.
+ * 
+ * \par Example
+ * \code
+ * #define FOO 1
+ * #define BAR 2
+ * GMP_CONCAT(FOO, BAR) // Results in 12
+ * \endcode
+ */
+#define GMP_CONCAT(lhs, rhs) GMP_CONCAT_HELPER(lhs, rhs)
+
+/**
+ * \brief Macro that expands to nothing.
+ *
+ * This macro expands to nothing and is used to assist other macros in achieving specific
+ * functionalities, such as delayed expansion or conditional compilation.
+ *
+ * \return This macro does not return any value or generate any output.
+ */
+#define GMP_EMPTY()
+
+/**
+ * \brief Macro to defer the expansion of another macro.
+ *
+ * This macro is used to defer the expansion of the given macro \a id by inserting 
+ * an additional layer of indirection. This can be useful in certain macro programming 
+ * scenarios where immediate expansion of a macro needs to be prevented.
+ *
+ * \param id The macro to be deferred.
+ * \return This macro does not return any value. It simply defers the expansion of \a id.
+ * 
+ * \par Example
+ * \code
+ * #define Bar() 1
+ * Bar() // Expands to: 1
+ * GMP_DEFER(Bar)() // Expands to: Bar()
+ * \endcode
+ */
+#define GMP_DEFER(id) id GMP_EMPTY()
+
+
+#define GMP_EVAL(...) GMP_EVAL_1(GMP_EVAL_1(GMP_EVAL_1(__VA_ARGS__)))
+#define GMP_EVAL_1(...) GMP_EVAL_2(GMP_EVAL_2(GMP_EVAL_2(__VA_ARGS__)))
+#define GMP_EVAL_2(...) GMP_EVAL_3(GMP_EVAL_3(GMP_EVAL_3(__VA_ARGS__)))
+#define GMP_EVAL_3(...) GMP_EVAL_4(GMP_EVAL_4(GMP_EVAL_4(__VA_ARGS__)))
+#define GMP_EVAL_4(...) GMP_EVAL_5(GMP_EVAL_5(GMP_EVAL_5(__VA_ARGS__)))
+#define GMP_EVAL_5(...) __VA_ARGS__
+
+
+#endif // GMP_MACRO_CORE_HPP_
@@ -0,0 +1,29 @@
+/**
+ * \file fold.hpp
+ * \brief Left fold of an argument list.
+ */
+#ifndef GMP_MACRO_FOLD_HPP_
+#define GMP_MACRO_FOLD_HPP_
+
+#include <gmp/macro/varargs.hpp>
+#include _GMP_LIMIT_FOLD_TABLES
+
+
+/**
+ * \def GMP_FOLD_LEFT(op, init, ...)
+ * \brief Left fold of the arguments provided.
+ *
+ * Expands to `op(op(op(init, a), b), c)`. Each call is expanded before it is
+ * passed to the next one, so the state stays as short as \a op makes it.
+ *
+ * \par Example
+ * \code
+ * #define ADD_FLAG(flags, f) flags | f
+ * GMP_FOLD_LEFT(ADD_FLAG, 0, read, write) // 0 | read | write
+ * \endcode
+ */
+#define GMP_FOLD_LEFT(op, init, ...) \
+    GMP_EXPAND( GMP_OVERLOAD_INVOKE1(_GMP_FOLD_LEFT, GMP_SIZE_OF_VAARGS(__VA_ARGS__))(op, init, __VA_ARGS__) )
+
+
+#endif // GMP_MACRO_FOLD_HPP_
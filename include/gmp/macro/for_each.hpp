@@ -0,0 +1,101 @@
+/**
+ * \file for_each.hpp
+ * \brief Apply a macro to every argument of a list.
+ */
+#ifndef GMP_MACRO_FOR_EACH_HPP_
+#define GMP_MACRO_FOR_EACH_HPP_
+
+#include <gmp/macro/arith.hpp>
+#include <gmp/macro/varargs.hpp>
+#include _GMP_LIMIT_FOR_EACH_TABLES
+
+
+/**
+ * \def GMP_FOR_EACH(call, ...)
+ * \brief Call a macro for each argument provided.
+ *
+ * This macro allows for the invocation of a given macro on each argument
+ * in a list of arguments. It expands to a series of calls to the provided
+ * macro, one for each argument.
+ *
+ * Example usage:
+ * \code
+ * #define DECLARE_VARIABLES(num) int variable_ ## num;
+ * GMP_FOR_EACH(DECLARE_VARIABLES, 1, 2) // Expands to: int variable_1; int variable_2;
+ * \endcode
+ *
+ * \param call The macro to be called for each argument.
+ * \param ... The list of arguments to be passed to the macro.
+ */
+#define GMP_FOR_EACH(call, ...) \
+    GMP_EXPAND( GMP_OVERLOAD_INVOKE1(_GMP_FOR_EACH, GMP_SIZE_OF_VAARGS(__VA_ARGS__))(call, __VA_ARGS__) )
+
+/**
+ * \def GMP_FOR_EACH_I(call, data, ...)
+ * \brief Call a macro with a shared value and the index of each argument.
+ *
+ * Expands to `call(data, i, x)` for every argument \a x at position \a i.
+ * Like \ref GMP_FOR_EACH, it takes one step per argument, without the
+ * \ref GMP_EVAL rescans that a \ref GMP_LOOP over the indices would need.
+ *
+ * \param call The macro to be called for each argument.
+ * \param data A value passed unchanged to every call, e.g. a prefix.
+ * \param ... The list of arguments to be passed to the macro.
+ *
+ * \par Example
+ * \code
+ * #define FIELD(type, i, name) type name = i;
+ * GMP_FOR_EACH_I(FIELD, int, x, y) // Expands to: int x = 0; int y = 1;
+ * \endcode
+ */
+#define GMP_FOR_EACH_I(call, data, ...) _GMP_FOR_EACH_I_IMPL(call, data, GMP_EMPTY, __VA_ARGS__)
+
+/**
+ * \def GMP_FOR_EACH_I_COMMA(call, data, ...)
+ * \brief \ref GMP_FOR_EACH_I with a comma between the calls.
+ *
+ * \par Example
+ * \code
+ * #define ENUMERATOR(prefix, i, name) prefix##name = i
+ * enum color { GMP_FOR_EACH_I_COMMA(ENUMERATOR, color_, red, green) };
+ * // Expands to: enum color { color_red = 0, color_green = 1 };
+ * \endcode
+ */
+#define GMP_FOR_EACH_I_COMMA(call, data, ...) _GMP_FOR_EACH_I_IMPL(call, data, GMP_COMMA, __VA_ARGS__)
+
+/**
+ * \def GMP_FOR_EACH_I_SEMICOLON(call, data, ...)
+ * \brief \ref GMP_FOR_EACH_I with a semicolon between the calls.
+ */
+#define GMP_FOR_EACH_I_SEMICOLON(call, data, ...) _GMP_FOR_EACH_I_IMPL(call, data, GMP_SEMICOLON, __VA_ARGS__)
+
+#define _GMP_FOR_EACH_I_IMPL(call, data, sep, ...) \
+    GMP_EXPAND( GMP_OVERLOAD_INVOKE1(_GMP_FOR_EACH_I, GMP_SIZE_OF_VAARGS(__VA_ARGS__))(call, data, sep, 0, __VA_ARGS__) )
+
+/**
+ * \def GMP_MAP(f, sep, ...)
+ * \brief Call a macro for each argument provided, with a separator in between.
+ *
+ * Expands to `f(a) sep() f(b) sep() f(c)`.
+ *
+ * \param f The macro to be called for each argument.
+ * \param sep A macro taking no arguments, e.g. \ref GMP_COMMA or GMP_EMPTY.
+ * \param ... The list of arguments to be passed to the macro.
+ *
+ * \par Example
+ * \code
+ * #define SIZE_OF(T) sizeof(T)
+ * #define PLUS() +
+ * GMP_MAP(SIZE_OF, PLUS, int, long) // sizeof(int) + sizeof(long)
+ * \endcode
+ */
+#define GMP_MAP(f, sep, ...) _GMP_FOR_EACH_I_IMPL(_GMP_MAP_CALL, f, sep, __VA_ARGS__)
+#define _GMP_MAP_CALL(f, i, x) f(x)
+
+/// \def GMP_COMMA() A separator for \ref GMP_MAP.
+#define GMP_COMMA() ,
+/// \def GMP_SEMICOLON() A separator for \ref GMP_MAP.
+#define GMP_SEMICOLON() ;
+
+
+#endif // GMP_MACRO_FOR_EACH_HPP_
@@ -0,0 +1,89 @@
+/**
+ * \file instantiate.hpp
+ * \brief Explicit instantiation declarations and definitions for a list of
+ *        template arguments.
+ *
+ * The header of a template declares its specializations with
+ * \ref GMP_EXTERN_TEMPLATES, and one or more translation units define them
+ * with \ref GMP_INSTANTIATE_TEMPLATES or \ref GMP_INSTANTIATE_TEMPLATE_RANGE.
+ * Every other translation unit then uses the specializations without
+ * instantiating them again.
+ */
+#ifndef GMP_MACRO_INSTANTIATE_HPP_
+#define GMP_MACRO_INSTANTIATE_HPP_
+
+#include <gmp/macro/for_each.hpp>
+#include <gmp/macro/loop.hpp>
+
+/**
+ * \def GMP_EXTERN_TEMPLATES(decl, ...)
+ * \brief Declare an explicit instantiation for each argument provided.
+ *
+ * This macro expands to `extern template decl(x);` for every argument \a x,
+ * so that translation units including it do not instantiate the template
+ * themselves. It is meant to be placed in the header that defines the template,
+ * with the definitions provided by \ref GMP_INSTANTIATE_TEMPLATES or
+ * \ref GMP_INSTANTIATE_TEMPLATE_RANGE.
+ *
+ * \param decl A macro that names the specialization for a given argument.
+ * \param ... The list of template arguments.
+ *
+ * \par Example
+ * \code
+ * #define KERNEL_DECL(T) struct kernel<T>
+ * #define KERNEL_TYPES float, double, int
+ * GMP_EXTERN_TEMPLATES(KERNEL_DECL, KERNEL_TYPES)
+ * // Expands to: extern template struct kernel<float>; extern template struct kernel<double>; ...
+ * \endcode
+ */
+#define GMP_EXTERN_TEMPLATES(decl, ...) GMP_FOR_EACH_I(_GMP_TEMPLATE_DECLARE, decl, __VA_ARGS__)
+
+/**
+ * \def GMP_INSTANTIATE_TEMPLATES(decl, ...)
+ * \brief Define an explicit instantiation for each argument provided.
+ *
+ * \param decl A macro that names the specialization for a given argument.
+ * \param ... The list of template arguments.
+ */
+#define GMP_INSTANTIATE_TEMPLATES(decl, ...) GMP_FOR_EACH_I(_GMP_TEMPLATE_DEFINE, decl, __VA_ARGS__)
+
+/**
+ * \def GMP_INSTANTIATE_TEMPLATE_RANGE(decl, begin, end, ...)
+ * \brief Define the explicit instantiations for the arguments in [begin, end).
+ *
+ * Splitting a list into index ranges lets the explicit instantiations of a
+ * template be compiled by several translation units in parallel. The
+ * gmp_shard_instantiations() CMake function generates such translation units
+ * from a CMake list of the arguments.
+ *
+ * \param decl A macro that names the specialization for a given argument.
+ * \param begin The index of the first argument to instantiate.
+ * \param end One past the index of the last argument to instantiate.
+ * \param ... The list of template arguments.
+ *
+ * \note The \a end value should not be greater than the number of arguments.
+ *       A \a begin or \a end past \ref GMP_MAX_INDEX expands to the error of
+ *       \ref GMP_CHECK_INDEX.
+ *
+ * \par Example
+ * \code
+ * GMP_INSTANTIATE_TEMPLATE_RANGE(KERNEL_DECL, 1, 3, KERNEL_TYPES)
+ * // Expands to: template struct kernel<double>; template struct kernel<int>;
+ * \endcode
+ */
+#define GMP_INSTANTIATE_TEMPLATE_RANGE(decl, begin, end, ...) GMP_OVERLOAD_INVOKE2(_GMP_TEMPLATE_RANGE_PRECHECK, \
+    GMP_CHECK_INDEX_BOOL(begin), GMP_CHECK_INDEX_BOOL(end))(decl, begin, end, __VA_ARGS__)
+#define _GMP_TEMPLATE_RANGE_PRECHECK_1_1(decl, begin, end, ...) \
+    _GMP_TEMPLATE_RANGE_IMPL(decl, GMP_SIZE_OF_VAARGS(GMP_RANGE(begin, end)), GMP_CONCAT(_GMP_DROP_, begin)(__VA_ARGS__))
+#define _GMP_TEMPLATE_RANGE_PRECHECK_0_1(decl, begin, end, ...) GMP_CHECK_INDEX(begin)
+#define _GMP_TEMPLATE_RANGE_PRECHECK_1_0(decl, begin, end, ...) GMP_CHECK_INDEX(end)
+#define _GMP_TEMPLATE_RANGE_PRECHECK_0_0(decl, begin, end, ...) GMP_CHECK_INDEX(begin)
+
+// The arguments before begin are dropped and the GMP_FOR_EACH_I ladder is
+// entered at end - begin, so that it stops before the arguments after end.
+#define _GMP_TEMPLATE_RANGE_IMPL(decl, count, ...) \
+    GMP_EXPAND( GMP_CONCAT(_GMP_FOR_EACH_I_, count)(_GMP_TEMPLATE_DEFINE, decl, GMP_EMPTY, 0, __VA_ARGS__) )
+#define _GMP_TEMPLATE_DECLARE(decl, i, x) extern template decl(x);
+#define _GMP_TEMPLATE_DEFINE(decl, i, x) template decl(x);
+
+#endif // GMP_MACRO_INSTANTIATE_HPP_
@@ -0,0 +1,5143 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_ARITH_1024_HPP_
+#define GMP_MACRO_LIMITS_ARITH_1024_HPP_
+
+// GMP_INC
+#define _GMP_INC_0() 1
+#define _GMP_INC_1() 2
+#define _GMP_INC_2() 3
+#define _GMP_INC_3() 4
+#define _GMP_INC_4() 5
+#define _GMP_INC_5() 6
+#define _GMP_INC_6() 7
+#define _GMP_INC_7() 8
+#define _GMP_INC_8() 9
+#define _GMP_INC_9() 10
+#define _GMP_INC_10() 11
+#define _GMP_INC_11() 12
+#define _GMP_INC_12() 13
+#define _GMP_INC_13() 14
+#define _GMP_INC_14() 15
+#define _GMP_INC_15() 16
+#define _GMP_INC_16() 17
+#define _GMP_INC_17() 18
+#define _GMP_INC_18() 19
+#define _GMP_INC_19() 20
+#define _GMP_INC_20() 21
+#define _GMP_INC_21() 22
+#define _GMP_INC_22() 23
+#define _GMP_INC_23() 24
+#define _GMP_INC_24() 25
+#define _GMP_INC_25() 26
+#define _GMP_INC_26() 27
+#define _GMP_INC_27() 28
+#define _GMP_INC_28() 29
+#define _GMP_INC_29() 30
+#define _GMP_INC_30() 31
+#define _GMP_INC_31() 32
+#define _GMP_INC_32() 33
+#define _GMP_INC_33() 34
+#define _GMP_INC_34() 35
+#define _GMP_INC_35() 36
+#define _GMP_INC_36() 37
+#define _GMP_INC_37() 38
+#define _GMP_INC_38() 39
+#define _GMP_INC_39() 40
+#define _GMP_INC_40() 41
+#define _GMP_INC_41() 42
+#define _GMP_INC_42() 43
+#define _GMP_INC_43() 44
+#define _GMP_INC_44() 45
+#define _GMP_INC_45() 46
+#define _GMP_INC_46() 47
+#define _GMP_INC_47() 48
+#define _GMP_INC_48() 49
+#define _GMP_INC_49() 50
+#define _GMP_INC_50() 51
+#define _GMP_INC_51() 52
+#define _GMP_INC_52() 53
+#define _GMP_INC_53() 54
+#define _GMP_INC_54() 55
+#define _GMP_INC_55() 56
+#define _GMP_INC_56() 57
+#define _GMP_INC_57() 58
+#define _GMP_INC_58() 59
+#define _GMP_INC_59() 60
+#define _GMP_INC_60() 61
+#define _GMP_INC_61() 62
+#define _GMP_INC_62() 63
+#define _GMP_INC_63() 64
+#define _GMP_INC_64() 65
+#define _GMP_INC_65() 66
+#define _GMP_INC_66() 67
+#define _GMP_INC_67() 68
+#define _GMP_INC_68() 69
+#define _GMP_INC_69() 70
+#define _GMP_INC_70() 71
+#define _GMP_INC_71() 72
+#define _GMP_INC_72() 73
+#define _GMP_INC_73() 74
+#define _GMP_INC_74() 75
+#define _GMP_INC_75() 76
+#define _GMP_INC_76() 77
+#define _GMP_INC_77() 78
+#define _GMP_INC_78() 79
+#define _GMP_INC_79() 80
+#define _GMP_INC_80() 81
+#define _GMP_INC_81() 82
+#define _GMP_INC_82() 83
+#define _GMP_INC_83() 84
+#define _GMP_INC_84() 85
+#define _GMP_INC_85() 86
+#define _GMP_INC_86() 87
+#define _GMP_INC_87() 88
+#define _GMP_INC_88() 89
+#define _GMP_INC_89() 90
+#define _GMP_INC_90() 91
+#define _GMP_INC_91() 92
+#define _GMP_INC_92() 93
+#define _GMP_INC_93() 94
+#define _GMP_INC_94() 95
+#define _GMP_INC_95() 96
+#define _GMP_INC_96() 97
+#define _GMP_INC_97() 98
+#define _GMP_INC_98() 99
+#define _GMP_INC_99() 100
+#define _GMP_INC_100() 101
+#define _GMP_INC_101() 102
+#define _GMP_INC_102() 103
+#define _GMP_INC_103() 104
+#define _GMP_INC_104() 105
+#define _GMP_INC_105() 106
+#define _GMP_INC_106() 107
+#define _GMP_INC_107() 108
+#define _GMP_INC_108() 109
+#define _GMP_INC_109() 110
+#define _GMP_INC_110() 111
+#define _GMP_INC_111() 112
+#define _GMP_INC_112() 113
+#define _GMP_INC_113() 114
+#define _GMP_INC_114() 115
+#define _GMP_INC_115() 116
+#define _GMP_INC_116() 117
+#define _GMP_INC_117() 118
+#define _GMP_INC_118() 119
+#define _GMP_INC_119() 120
+#define _GMP_INC_120() 121
+#define _GMP_INC_121() 122
+#define _GMP_INC_122() 123
+#define _GMP_INC_123() 124
+#define _GMP_INC_124() 125
+#define _GMP_INC_125() 126
+#define _GMP_INC_126() 127
+#define _GMP_INC_127() 128
+#define _GMP_INC_128() 129
+#define _GMP_INC_129() 130
+#define _GMP_INC_130() 131
+#define _GMP_INC_131() 132
+#define _GMP_INC_132() 133
+#define _GMP_INC_133() 134
+#define _GMP_INC_134() 135
+#define _GMP_INC_135() 136
+#define _GMP_INC_136() 137
+#define _GMP_INC_137() 138
+#define _GMP_INC_138() 139
+#define _GMP_INC_139() 140
+#define _GMP_INC_140() 141
+#define _GMP_INC_141() 142
+#define _GMP_INC_142() 143
+#define _GMP_INC_143() 144
+#define _GMP_INC_144() 145
+#define _GMP_INC_145() 146
+#define _GMP_INC_146() 147
+#define _GMP_INC_147() 148
+#define _GMP_INC_148() 149
+#define _GMP_INC_149() 150
+#define _GMP_INC_150() 151
+#define _GMP_INC_151() 152
+#define _GMP_INC_152() 153
+#define _GMP_INC_153() 154
+#define _GMP_INC_154() 155
+#define _GMP_INC_155() 156
+#define _GMP_INC_156() 157
+#define _GMP_INC_157() 158
+#define _GMP_INC_158() 159
+#define _GMP_INC_159() 160
+#define _GMP_INC_160() 161
+#define _GMP_INC_161() 162
+#define _GMP_INC_162() 163
+#define _GMP_INC_163() 164
+#define _GMP_INC_164() 165
+#define _GMP_INC_165() 166
+#define _GMP_INC_166() 167
+#define _GMP_INC_167() 168
+#define _GMP_INC_168() 169
+#define _GMP_INC_169() 170
+#define _GMP_INC_170() 171
+#define _GMP_INC_171() 172
+#define _GMP_INC_172() 173
+#define _GMP_INC_173() 174
+#define _GMP_INC_174() 175
+#define _GMP_INC_175() 176
+#define _GMP_INC_176() 177
+#define _GMP_INC_177() 178
+#define _GMP_INC_178() 179
+#define _GMP_INC_179() 180
+#define _GMP_INC_180() 181
+#define _GMP_INC_181() 182
+#define _GMP_INC_182() 183
+#define _GMP_INC_183() 184
+#define _GMP_INC_184() 185
+#define _GMP_INC_185() 186
+#define _GMP_INC_186() 187
+#define _GMP_INC_187() 188
+#define _GMP_INC_188() 189
+#define _GMP_INC_189() 190
+#define _GMP_INC_190() 191
+#define _GMP_INC_191() 192
+#define _GMP_INC_192() 193
+#define _GMP_INC_193() 194
+#define _GMP_INC_194() 195
+#define _GMP_INC_195() 196
+#define _GMP_INC_196() 197
+#define _GMP_INC_197() 198
+#define _GMP_INC_198() 199
+#define _GMP_INC_199() 200
+#define _GMP_INC_200() 201
+#define _GMP_INC_201() 202
+#define _GMP_INC_202() 203
+#define _GMP_INC_203() 204
+#define _GMP_INC_204() 205
+#define _GMP_INC_205() 206
+#define _GMP_INC_206() 207
+#define _GMP_INC_207() 208
+#define _GMP_INC_208() 209
+#define _GMP_INC_209() 210
+#define _GMP_INC_210() 211
+#define _GMP_INC_211() 212
+#define _GMP_INC_212() 213
+#define _GMP_INC_213() 214
+#define _GMP_INC_214() 215
+#define _GMP_INC_215() 216
+#define _GMP_INC_216() 217
+#define _GMP_INC_217() 218
+#define _GMP_INC_218() 219
+#define _GMP_INC_219() 220
+#define _GMP_INC_220() 221
+#define _GMP_INC_221() 222
+#define _GMP_INC_222() 223
+#define _GMP_INC_223() 224
+#define _GMP_INC_224() 225
+#define _GMP_INC_225() 226
+#define _GMP_INC_226() 227
+#define _GMP_INC_227() 228
+#define _GMP_INC_228() 229
+#define _GMP_INC_229() 230
+#define _GMP_INC_230() 231
+#define _GMP_INC_231() 232
+#define _GMP_INC_232() 233
+#define _GMP_INC_233() 234
+#define _GMP_INC_234() 235
+#define _GMP_INC_235() 236
+#define _GMP_INC_236() 237
+#define _GMP_INC_237() 238
+#define _GMP_INC_238() 239
+#define _GMP_INC_239() 240
+#define _GMP_INC_240() 241
+#define _GMP_INC_241() 242
+#define _GMP_INC_242() 243
+#define _GMP_INC_243() 244
+#define _GMP_INC_244() 245
+#define _GMP_INC_245() 246
+#define _GMP_INC_246() 247
+#define _GMP_INC_247() 248
+#define _GMP_INC_248() 249
+#define _GMP_INC_249() 250
+#define _GMP_INC_250() 251
+#define _GMP_INC_251() 252
+#define _GMP_INC_252() 253
+#define _GMP_INC_253() 254
+#define _GMP_INC_254() 255
+#define _GMP_INC_255() 256
+#define _GMP_INC_256() 257
+#define _GMP_INC_257() 258
+#define _GMP_INC_258() 259
+#define _GMP_INC_259() 260
+#define _GMP_INC_260() 261
+#define _GMP_INC_261() 262
+#define _GMP_INC_262() 263
+#define _GMP_INC_263() 264
+#define _GMP_INC_264() 265
+#define _GMP_INC_265() 266
+#define _GMP_INC_266() 267
+#define _GMP_INC_267() 268
+#define _GMP_INC_268() 269
+#define _GMP_INC_269() 270
+#define _GMP_INC_270() 271
+#define _GMP_INC_271() 272
+#define _GMP_INC_272() 273
+#define _GMP_INC_273() 274
+#define _GMP_INC_274() 275
+#define _GMP_INC_275() 276
+#define _GMP_INC_276() 277
+#define _GMP_INC_277() 278
+#define _GMP_INC_278() 279
+#define _GMP_INC_279() 280
+#define _GMP_INC_280() 281
+#define _GMP_INC_281() 282
+#define _GMP_INC_282() 283
+#define _GMP_INC_283() 284
+#define _GMP_INC_284() 285
+#define _GMP_INC_285() 286
+#define _GMP_INC_286() 287
+#define _GMP_INC_287() 288
+#define _GMP_INC_288() 289
+#define _GMP_INC_289() 290
+#define _GMP_INC_290() 291
+#define _GMP_INC_291() 292
+#define _GMP_INC_292() 293
+#define _GMP_INC_293() 294
+#define _GMP_INC_294() 295
+#define _GMP_INC_295() 296
+#define _GMP_INC_296() 297
+#define _GMP_INC_297() 298
+#define _GMP_INC_298() 299
+#define _GMP_INC_299() 300
+#define _GMP_INC_300() 301
+#define _GMP_INC_301() 302
+#define _GMP_INC_302() 303
+#define _GMP_INC_303() 304
+#define _GMP_INC_304() 305
+#define _GMP_INC_305() 306
+#define _GMP_INC_306() 307
+#define _GMP_INC_307() 308
+#define _GMP_INC_308() 309
+#define _GMP_INC_309() 310
+#define _GMP_INC_310() 311
+#define _GMP_INC_311() 312
+#define _GMP_INC_312() 313
+#define _GMP_INC_313() 314
+#define _GMP_INC_314() 315
+#define _GMP_INC_315() 316
+#define _GMP_INC_316() 317
+#define _GMP_INC_317() 318
+#define _GMP_INC_318() 319
+#define _GMP_INC_319() 320
+#define _GMP_INC_320() 321
+#define _GMP_INC_321() 322
+#define _GMP_INC_322() 323
+#define _GMP_INC_323() 324
+#define _GMP_INC_324() 325
+#define _GMP_INC_325() 326
+#define _GMP_INC_326() 327
+#define _GMP_INC_327() 328
+#define _GMP_INC_328() 329
+#define _GMP_INC_329() 330
+#define _GMP_INC_330() 331
+#define _GMP_INC_331() 332
+#define _GMP_INC_332() 333
+#define _GMP_INC_333() 334
+#define _GMP_INC_334() 335
+#define _GMP_INC_335() 336
+#define _GMP_INC_336() 337
+#define _GMP_INC_337() 338
+#define _GMP_INC_338() 339
+#define _GMP_INC_339() 340
+#define _GMP_INC_340() 341
+#define _GMP_INC_341() 342
+#define _GMP_INC_342() 343
+#define _GMP_INC_343() 344
+#define _GMP_INC_344() 345
+#define _GMP_INC_345() 346
+#define _GMP_INC_346() 347
+#define _GMP_INC_347() 348
+#define _GMP_INC_348() 349
+#define _GMP_INC_349() 350
+#define _GMP_INC_350() 351
+#define _GMP_INC_351() 352
+#define _GMP_INC_352() 353
+#define _GMP_INC_353() 354
+#define _GMP_INC_354() 355
+#define _GMP_INC_355() 356
+#define _GMP_INC_356() 357
+#define _GMP_INC_357() 358
+#define _GMP_INC_358() 359
+#define _GMP_INC_359() 360
+#define _GMP_INC_360() 361
+#define _GMP_INC_361() 362
+#define _GMP_INC_362() 363
+#define _GMP_INC_363() 364
+#define _GMP_INC_364() 365
+#define _GMP_INC_365() 366
+#define _GMP_INC_366() 367
+#define _GMP_INC_367() 368
+#define _GMP_INC_368() 369
+#define _GMP_INC_369() 370
+#define _GMP_INC_370() 371
+#define _GMP_INC_371() 372
+#define _GMP_INC_372() 373
+#define _GMP_INC_373() 374
+#define _GMP_INC_374() 375
+#define _GMP_INC_375() 376
+#define _GMP_INC_376() 377
+#define _GMP_INC_377() 378
+#define _GMP_INC_378() 379
+#define _GMP_INC_379() 380
+#define _GMP_INC_380() 381
+#define _GMP_INC_381() 382
+#define _GMP_INC_382() 383
+#define _GMP_INC_383() 384
+#define _GMP_INC_384() 385
+#define _GMP_INC_385() 386
+#define _GMP_INC_386() 387
+#define _GMP_INC_387() 388
+#define _GMP_INC_388() 389
+#define _GMP_INC_389() 390
+#define _GMP_INC_390() 391
+#define _GMP_INC_391() 392
+#define _GMP_INC_392() 393
+#define _GMP_INC_393() 394
+#define _GMP_INC_394() 395
+#define _GMP_INC_395() 396
+#define _GMP_INC_396() 397
+#define _GMP_INC_397() 398
+#define _GMP_INC_398() 399
+#define _GMP_INC_399() 400
+#define _GMP_INC_400() 401
+#define _GMP_INC_401() 402
+#define _GMP_INC_402() 403
+#define _GMP_INC_403() 404
+#define _GMP_INC_404() 405
+#define _GMP_INC_405() 406
+#define _GMP_INC_406() 407
+#define _GMP_INC_407() 408
+#define _GMP_INC_408() 409
+#define _GMP_INC_409() 410
+#define _GMP_INC_410() 411
+#define _GMP_INC_411() 412
+#define _GMP_INC_412() 413
+#define _GMP_INC_413() 414
+#define _GMP_INC_414() 415
+#define _GMP_INC_415() 416
+#define _GMP_INC_416() 417
+#define _GMP_INC_417() 418
+#define _GMP_INC_418() 419
+#define _GMP_INC_419() 420
+#define _GMP_INC_420() 421
+#define _GMP_INC_421() 422
+#define _GMP_INC_422() 423
+#define _GMP_INC_423() 424
+#define _GMP_INC_424() 425
+#define _GMP_INC_425() 426
+#define _GMP_INC_426() 427
+#define _GMP_INC_427() 428
+#define _GMP_INC_428() 429
+#define _GMP_INC_429() 430
+#define _GMP_INC_430() 431
+#define _GMP_INC_431() 432
+#define _GMP_INC_432() 433
+#define _GMP_INC_433() 434
+#define _GMP_INC_434() 435
+#define _GMP_INC_435() 436
+#define _GMP_INC_436() 437
+#define _GMP_INC_437() 438
+#define _GMP_INC_438() 439
+#define _GMP_INC_439() 440
+#define _GMP_INC_440() 441
+#define _GMP_INC_441() 442
+#define _GMP_INC_442() 443
+#define _GMP_INC_443() 444
+#define _GMP_INC_444() 445
+#define _GMP_INC_445() 446
+#define _GMP_INC_446() 447
+#define _GMP_INC_447() 448
+#define _GMP_INC_448() 449
+#define _GMP_INC_449() 450
+#define _GMP_INC_450() 451
+#define _GMP_INC_451() 452
+#define _GMP_INC_452() 453
+#define _GMP_INC_453() 454
+#define _GMP_INC_454() 455
+#define _GMP_INC_455() 456
+#define _GMP_INC_456() 457
+#define _GMP_INC_457() 458
+#define _GMP_INC_458() 459
+#define _GMP_INC_459() 460
+#define _GMP_INC_460() 461
+#define _GMP_INC_461() 462
+#define _GMP_INC_462() 463
+#define _GMP_INC_463() 464
+#define _GMP_INC_464() 465
+#define _GMP_INC_465() 466
+#define _GMP_INC_466() 467
+#define _GMP_INC_467() 468
+#define _GMP_INC_468() 469
+#define _GMP_INC_469() 470
+#define _GMP_INC_470() 471
+#define _GMP_INC_471() 472
+#define _GMP_INC_472() 473
+#define _GMP_INC_473() 474
+#define _GMP_INC_474() 475
+#define _GMP_INC_475() 476
+#define _GMP_INC_476() 477
+#define _GMP_INC_477() 478
+#define _GMP_INC_478() 479
+#define _GMP_INC_479() 480
+#define _GMP_INC_480() 481
+#define _GMP_INC_481() 482
+#define _GMP_INC_482() 483
+#define _GMP_INC_483() 484
+#define _GMP_INC_484() 485
+#define _GMP_INC_485() 486
+#define _GMP_INC_486() 487
+#define _GMP_INC_487() 488
+#define _GMP_INC_488() 489
+#define _GMP_INC_489() 490
+#define _GMP_INC_490() 491
+#define _GMP_INC_491() 492
+#define _GMP_INC_492() 493
+#define _GMP_INC_493() 494
+#define _GMP_INC_494() 495
+#define _GMP_INC_495() 496
+#define _GMP_INC_496() 497
+#define _GMP_INC_497() 498
+#define _GMP_INC_498() 499
+#define _GMP_INC_499() 500
+#define _GMP_INC_500() 501
+#define _GMP_INC_501() 502
+#define _GMP_INC_502() 503
+#define _GMP_INC_503() 504
+#define _GMP_INC_504() 505
+#define _GMP_INC_505() 506
+#define _GMP_INC_506() 507
+#define _GMP_INC_507() 508
+#define _GMP_INC_508() 509
+#define _GMP_INC_509() 510
+#define _GMP_INC_510() 511
+#define _GMP_INC_511() 512
+#define _GMP_INC_512() 513
+#define _GMP_INC_513() 514
+#define _GMP_INC_514() 515
+#define _GMP_INC_515() 516
+#define _GMP_INC_516() 517
+#define _GMP_INC_517() 518
+#define _GMP_INC_518() 519
+#define _GMP_INC_519() 520
+#define _GMP_INC_520() 521
+#define _GMP_INC_521() 522
+#define _GMP_INC_522() 523
+#define _GMP_INC_523() 524
+#define _GMP_INC_524() 525
+#define _GMP_INC_525() 526
+#define _GMP_INC_526() 527
+#define _GMP_INC_527() 528
+#define _GMP_INC_528() 529
+#define _GMP_INC_529() 530
+#define _GMP_INC_530() 531
+#define _GMP_INC_531() 532
+#define _GMP_INC_532() 533
+#define _GMP_INC_533() 534
+#define _GMP_INC_534() 535
+#define _GMP_INC_535() 536
+#define _GMP_INC_536() 537
+#define _GMP_INC_537() 538
+#define _GMP_INC_538() 539
+#define _GMP_INC_539() 540
+#define _GMP_INC_540() 541
+#define _GMP_INC_541() 542
+#define _GMP_INC_542() 543
+#define _GMP_INC_543() 544
+#define _GMP_INC_544() 545
+#define _GMP_INC_545() 546
+#define _GMP_INC_546() 547
+#define _GMP_INC_547() 548
+#define _GMP_INC_548() 549
+#define _GMP_INC_549() 550
+#define _GMP_INC_550() 551
+#define _GMP_INC_551() 552
+#define _GMP_INC_552() 553
+#define _GMP_INC_553() 554
+#define _GMP_INC_554() 555
+#define _GMP_INC_555() 556
+#define _GMP_INC_556() 557
+#define _GMP_INC_557() 558
+#define _GMP_INC_558() 559
+#define _GMP_INC_559() 560
+#define _GMP_INC_560() 561
+#define _GMP_INC_561() 562
+#define _GMP_INC_562() 563
+#define _GMP_INC_563() 564
+#define _GMP_INC_564() 565
+#define _GMP_INC_565() 566
+#define _GMP_INC_566() 567
+#define _GMP_INC_567() 568
+#define _GMP_INC_568() 569
+#define _GMP_INC_569() 570
+#define _GMP_INC_570() 571
+#define _GMP_INC_571() 572
+#define _GMP_INC_572() 573
+#define _GMP_INC_573() 574
+#define _GMP_INC_574() 575
+#define _GMP_INC_575() 576
+#define _GMP_INC_576() 577
+#define _GMP_INC_577() 578
+#define _GMP_INC_578() 579
+#define _GMP_INC_579() 580
+#define _GMP_INC_580() 581
+#define _GMP_INC_581() 582
+#define _GMP_INC_582() 583
+#define _GMP_INC_583() 584
+#define _GMP_INC_584() 585
+#define _GMP_INC_585() 586
+#define _GMP_INC_586() 587
+#define _GMP_INC_587() 588
+#define _GMP_INC_588() 589
+#define _GMP_INC_589() 590
+#define _GMP_INC_590() 591
+#define _GMP_INC_591() 592
+#define _GMP_INC_592() 593
+#define _GMP_INC_593() 594
+#define _GMP_INC_594() 595
+#define _GMP_INC_595() 596
+#define _GMP_INC_596() 597
+#define _GMP_INC_597() 598
+#define _GMP_INC_598() 599
+#define _GMP_INC_599() 600
+#define _GMP_INC_600() 601
+#define _GMP_INC_601() 602
+#define _GMP_INC_602() 603
+#define _GMP_INC_603() 604
+#define _GMP_INC_604() 605
+#define _GMP_INC_605() 606
+#define _GMP_INC_606() 607
+#define _GMP_INC_607() 608
+#define _GMP_INC_608() 609
+#define _GMP_INC_609() 610
+#define _GMP_INC_610() 611
+#define _GMP_INC_611() 612
+#define _GMP_INC_612() 613
+#define _GMP_INC_613() 614
+#define _GMP_INC_614() 615
+#define _GMP_INC_615() 616
+#define _GMP_INC_616() 617
+#define _GMP_INC_617() 618
+#define _GMP_INC_618() 619
+#define _GMP_INC_619() 620
+#define _GMP_INC_620() 621
+#define _GMP_INC_621() 622
+#define _GMP_INC_622() 623
+#define _GMP_INC_623() 624
+#define _GMP_INC_624() 625
+#define _GMP_INC_625() 626
+#define _GMP_INC_626() 627
+#define _GMP_INC_627() 628
+#define _GMP_INC_628() 629
+#define _GMP_INC_629() 630
+#define _GMP_INC_630() 631
+#define _GMP_INC_631() 632
+#define _GMP_INC_632() 633
+#define _GMP_INC_633() 634
+#define _GMP_INC_634() 635
+#define _GMP_INC_635() 636
+#define _GMP_INC_636() 637
+#define _GMP_INC_637() 638
+#define _GMP_INC_638() 639
+#define _GMP_INC_639() 640
+#define _GMP_INC_640() 641
+#define _GMP_INC_641() 642
+#define _GMP_INC_642() 643
+#define _GMP_INC_643() 644
+#define _GMP_INC_644() 645
+#define _GMP_INC_645() 646
+#define _GMP_INC_646() 647
+#define _GMP_INC_647() 648
+#define _GMP_INC_648() 649
+#define _GMP_INC_649() 650
+#define _GMP_INC_650() 651
+#define _GMP_INC_651() 652
+#define _GMP_INC_652() 653
+#define _GMP_INC_653() 654
+#define _GMP_INC_654() 655
+#define _GMP_INC_655() 656
+#define _GMP_INC_656() 657
+#define _GMP_INC_657() 658
+#define _GMP_INC_658() 659
+#define _GMP_INC_659() 660
+#define _GMP_INC_660() 661
+#define _GMP_INC_661() 662
+#define _GMP_INC_662() 663
+#define _GMP_INC_663() 664
+#define _GMP_INC_664() 665
+#define _GMP_INC_665() 666
+#define _GMP_INC_666() 667
+#define _GMP_INC_667() 668
+#define _GMP_INC_668() 669
+#define _GMP_INC_669() 670
+#define _GMP_INC_670() 671
+#define _GMP_INC_671() 672
+#define _GMP_INC_672() 673
+#define _GMP_INC_673() 674
+#define _GMP_INC_674() 675
+#define _GMP_INC_675() 676
+#define _GMP_INC_676() 677
+#define _GMP_INC_677() 678
+#define _GMP_INC_678() 679
+#define _GMP_INC_679() 680
+#define _GMP_INC_680() 681
+#define _GMP_INC_681() 682
+#define _GMP_INC_682() 683
+#define _GMP_INC_683() 684
+#define _GMP_INC_684() 685
+#define _GMP_INC_685() 686
+#define _GMP_INC_686() 687
+#define _GMP_INC_687() 688
+#define _GMP_INC_688() 689
+#define _GMP_INC_689() 690
+#define _GMP_INC_690() 691
+#define _GMP_INC_691() 692
+#define _GMP_INC_692() 693
+#define _GMP_INC_693() 694
+#define _GMP_INC_694() 695
+#define _GMP_INC_695() 696
+#define _GMP_INC_696() 697
+#define _GMP_INC_697() 698
+#define _GMP_INC_698() 699
+#define _GMP_INC_699() 700
+#define _GMP_INC_700() 701
+#define _GMP_INC_701() 702
+#define _GMP_INC_702() 703
+#define _GMP_INC_703() 704
+#define _GMP_INC_704() 705
+#define _GMP_INC_705() 706
+#define _GMP_INC_706() 707
+#define _GMP_INC_707() 708
+#define _GMP_INC_708() 709
+#define _GMP_INC_709() 710
+#define _GMP_INC_710() 711
+#define _GMP_INC_711() 712
+#define _GMP_INC_712() 713
+#define _GMP_INC_713() 714
+#define _GMP_INC_714() 715
+#define _GMP_INC_715() 716
+#define _GMP_INC_716() 717
+#define _GMP_INC_717() 718
+#define _GMP_INC_718() 719
+#define _GMP_INC_719() 720
+#define _GMP_INC_720() 721
+#define _GMP_INC_721() 722
+#define _GMP_INC_722() 723
+#define _GMP_INC_723() 724
+#define _GMP_INC_724() 725
+#define _GMP_INC_725() 726
+#define _GMP_INC_726() 727
+#define _GMP_INC_727() 728
+#define _GMP_INC_728() 729
+#define _GMP_INC_729() 730
+#define _GMP_INC_730() 731
+#define _GMP_INC_731() 732
+#define _GMP_INC_732() 733
+#define _GMP_INC_733() 734
+#define _GMP_INC_734() 735
+#define _GMP_INC_735() 736
+#define _GMP_INC_736() 737
+#define _GMP_INC_737() 738
+#define _GMP_INC_738() 739
+#define _GMP_INC_739() 740
+#define _GMP_INC_740() 741
+#define _GMP_INC_741() 742
+#define _GMP_INC_742() 743
+#define _GMP_INC_743() 744
+#define _GMP_INC_744() 745
+#define _GMP_INC_745() 746
+#define _GMP_INC_746() 747
+#define _GMP_INC_747() 748
+#define _GMP_INC_748() 749
+#define _GMP_INC_749() 750
+#define _GMP_INC_750() 751
+#define _GMP_INC_751() 752
+#define _GMP_INC_752() 753
+#define _GMP_INC_753() 754
+#define _GMP_INC_754() 755
+#define _GMP_INC_755() 756
+#define _GMP_INC_756() 757
+#define _GMP_INC_757() 758
+#define _GMP_INC_758() 759
+#define _GMP_INC_759() 760
+#define _GMP_INC_760() 761
+#define _GMP_INC_761() 762
+#define _GMP_INC_762() 763
+#define _GMP_INC_763() 764
+#define _GMP_INC_764() 765
+#define _GMP_INC_765() 766
+#define _GMP_INC_766() 767
+#define _GMP_INC_767() 768
+#define _GMP_INC_768() 769
+#define _GMP_INC_769() 770
+#define _GMP_INC_770() 771
+#define _GMP_INC_771() 772
+#define _GMP_INC_772() 773
+#define _GMP_INC_773() 774
+#define _GMP_INC_774() 775
+#define _GMP_INC_775() 776
+#define _GMP_INC_776() 777
+#define _GMP_INC_777() 778
+#define _GMP_INC_778() 779
+#define _GMP_INC_779() 780
+#define _GMP_INC_780() 781
+#define _GMP_INC_781() 782
+#define _GMP_INC_782() 783
+#define _GMP_INC_783() 784
+#define _GMP_INC_784() 785
+#define _GMP_INC_785() 786
+#define _GMP_INC_786() 787
+#define _GMP_INC_787() 788
+#define _GMP_INC_788() 789
+#define _GMP_INC_789() 790
+#define _GMP_INC_790() 791
+#define _GMP_INC_791() 792
+#define _GMP_INC_792() 793
+#define _GMP_INC_793() 794
+#define _GMP_INC_794() 795
+#define _GMP_INC_795() 796
+#define _GMP_INC_796() 797
+#define _GMP_INC_797() 798
+#define _GMP_INC_798() 799
+#define _GMP_INC_799() 800
+#define _GMP_INC_800() 801
+#define _GMP_INC_801() 802
+#define _GMP_INC_802() 803
+#define _GMP_INC_803() 804
+#define _GMP_INC_804() 805
+#define _GMP_INC_805() 806
+#define _GMP_INC_806() 807
+#define _GMP_INC_807() 808
+#define _GMP_INC_808() 809
+#define _GMP_INC_809() 810
+#define _GMP_INC_810() 811
+#define _GMP_INC_811() 812
+#define _GMP_INC_812() 813
+#define _GMP_INC_813() 814
+#define _GMP_INC_814() 815
+#define _GMP_INC_815() 816
+#define _GMP_INC_816() 817
+#define _GMP_INC_817() 818
+#define _GMP_INC_818() 819
+#define _GMP_INC_819() 820
+#define _GMP_INC_820() 821
+#define _GMP_INC_821() 822
+#define _GMP_INC_822() 823
+#define _GMP_INC_823() 824
+#define _GMP_INC_824() 825
+#define _GMP_INC_825() 826
+#define _GMP_INC_826() 827
+#define _GMP_INC_827() 828
+#define _GMP_INC_828() 829
+#define _GMP_INC_829() 830
+#define _GMP_INC_830() 831
+#define _GMP_INC_831() 832
+#define _GMP_INC_832() 833
+#define _GMP_INC_833() 834
+#define _GMP_INC_834() 835
+#define _GMP_INC_835() 836
+#define _GMP_INC_836() 837
+#define _GMP_INC_837() 838
+#define _GMP_INC_838() 839
+#define _GMP_INC_839() 840
+#define _GMP_INC_840() 841
+#define _GMP_INC_841() 842
+#define _GMP_INC_842() 843
+#define _GMP_INC_843() 844
+#define _GMP_INC_844() 845
+#define _GMP_INC_845() 846
+#define _GMP_INC_846() 847
+#define _GMP_INC_847() 848
+#define _GMP_INC_848() 849
+#define _GMP_INC_849() 850
+#define _GMP_INC_850() 851
+#define _GMP_INC_851() 852
+#define _GMP_INC_852() 853
+#define _GMP_INC_853() 854
+#define _GMP_INC_854() 855
+#define _GMP_INC_855() 856
+#define _GMP_INC_856() 857
+#define _GMP_INC_857() 858
+#define _GMP_INC_858() 859
+#define _GMP_INC_859() 860
+#define _GMP_INC_860() 861
+#define _GMP_INC_861() 862
+#define _GMP_INC_862() 863
+#define _GMP_INC_863() 864
+#define _GMP_INC_864() 865
+#define _GMP_INC_865() 866
+#define _GMP_INC_866() 867
+#define _GMP_INC_867() 868
+#define _GMP_INC_868() 869
+#define _GMP_INC_869() 870
+#define _GMP_INC_870() 871
+#define _GMP_INC_871() 872
+#define _GMP_INC_872() 873
+#define _GMP_INC_873() 874
+#define _GMP_INC_874() 875
+#define _GMP_INC_875() 876
+#define _GMP_INC_876() 877
+#define _GMP_INC_877() 878
+#define _GMP_INC_878() 879
+#define _GMP_INC_879() 880
+#define _GMP_INC_880() 881
+#define _GMP_INC_881() 882
+#define _GMP_INC_882() 883
+#define _GMP_INC_883() 884
+#define _GMP_INC_884() 885
+#define _GMP_INC_885() 886
+#define _GMP_INC_886() 887
+#define _GMP_INC_887() 888
+#define _GMP_INC_888() 889
+#define _GMP_INC_889() 890
+#define _GMP_INC_890() 891
+#define _GMP_INC_891() 892
+#define _GMP_INC_892() 893
+#define _GMP_INC_893() 894
+#define _GMP_INC_894() 895
+#define _GMP_INC_895() 896
+#define _GMP_INC_896() 897
+#define _GMP_INC_897() 898
+#define _GMP_INC_898() 899
+#define _GMP_INC_899() 900
+#define _GMP_INC_900() 901
+#define _GMP_INC_901() 902
+#define _GMP_INC_902() 903
+#define _GMP_INC_903() 904
+#define _GMP_INC_904() 905
+#define _GMP_INC_905() 906
+#define _GMP_INC_906() 907
+#define _GMP_INC_907() 908
+#define _GMP_INC_908() 909
+#define _GMP_INC_909() 910
+#define _GMP_INC_910() 911
+#define _GMP_INC_911() 912
+#define _GMP_INC_912() 913
+#define _GMP_INC_913() 914
+#define _GMP_INC_914() 915
+#define _GMP_INC_915() 916
+#define _GMP_INC_916() 917
+#define _GMP_INC_917() 918
+#define _GMP_INC_918() 919
+#define _GMP_INC_919() 920
+#define _GMP_INC_920() 921
+#define _GMP_INC_921() 922
+#define _GMP_INC_922() 923
+#define _GMP_INC_923() 924
+#define _GMP_INC_924() 925
+#define _GMP_INC_925() 926
+#define _GMP_INC_926() 927
+#define _GMP_INC_927() 928
+#define _GMP_INC_928() 929
+#define _GMP_INC_929() 930
+#define _GMP_INC_930() 931
+#define _GMP_INC_931() 932
+#define _GMP_INC_932() 933
+#define _GMP_INC_933() 934
+#define _GMP_INC_934() 935
+#define _GMP_INC_935() 936
+#define _GMP_INC_936() 937
+#define _GMP_INC_937() 938
+#define _GMP_INC_938() 939
+#define _GMP_INC_939() 940
+#define _GMP_INC_940() 941
+#define _GMP_INC_941() 942
+#define _GMP_INC_942() 943
+#define _GMP_INC_943() 944
+#define _GMP_INC_944() 945
+#define _GMP_INC_945() 946
+#define _GMP_INC_946() 947
+#define _GMP_INC_947() 948
+#define _GMP_INC_948() 949
+#define _GMP_INC_949() 950
+#define _GMP_INC_950() 951
+#define _GMP_INC_951() 952
+#define _GMP_INC_952() 953
+#define _GMP_INC_953() 954
+#define _GMP_INC_954() 955
+#define _GMP_INC_955() 956
+#define _GMP_INC_956() 957
+#define _GMP_INC_957() 958
+#define _GMP_INC_958() 959
+#define _GMP_INC_959() 960
+#define _GMP_INC_960() 961
+#define _GMP_INC_961() 962
+#define _GMP_INC_962() 963
+#define _GMP_INC_963() 964
+#define _GMP_INC_964() 965
+#define _GMP_INC_965() 966
+#define _GMP_INC_966() 967
+#define _GMP_INC_967() 968
+#define _GMP_INC_968() 969
+#define _GMP_INC_969() 970
+#define _GMP_INC_970() 971
+#define _GMP_INC_971() 972
+#define _GMP_INC_972() 973
+#define _GMP_INC_973() 974
+#define _GMP_INC_974() 975
+#define _GMP_INC_975() 976
+#define _GMP_INC_976() 977
+#define _GMP_INC_977() 978
+#define _GMP_INC_978() 979
+#define _GMP_INC_979() 980
+#define _GMP_INC_980() 981
+#define _GMP_INC_981() 982
+#define _GMP_INC_982() 983
+#define _GMP_INC_983() 984
+#define _GMP_INC_984() 985
+#define _GMP_INC_985() 986
+#define _GMP_INC_986() 987
+#define _GMP_INC_987() 988
+#define _GMP_INC_988() 989
+#define _GMP_INC_989() 990
+#define _GMP_INC_990() 991
+#define _GMP_INC_991() 992
+#define _GMP_INC_992() 993
+#define _GMP_INC_993() 994
+#define _GMP_INC_994() 995
+#define _GMP_INC_995() 996
+#define _GMP_INC_996() 997
+#define _GMP_INC_997() 998
+#define _GMP_INC_998() 999
+#define _GMP_INC_999() 1000
+#define _GMP_INC_1000() 1001
+#define _GMP_INC_1001() 1002
+#define _GMP_INC_1002() 1003
+#define _GMP_INC_1003() 1004
+#define _GMP_INC_1004() 1005
+#define _GMP_INC_1005() 1006
+#define _GMP_INC_1006() 1007
+#define _GMP_INC_1007() 1008
+#define _GMP_INC_1008() 1009
+#define _GMP_INC_1009() 1010
+#define _GMP_INC_1010() 1011
+#define _GMP_INC_1011() 1012
+#define _GMP_INC_1012() 1013
+#define _GMP_INC_1013() 1014
+#define _GMP_INC_1014() 1015
+#define _GMP_INC_1015() 1016
+#define _GMP_INC_1016() 1017
+#define _GMP_INC_1017() 1018
+#define _GMP_INC_1018() 1019
+#define _GMP_INC_1019() 1020
+#define _GMP_INC_1020() 1021
+#define _GMP_INC_1021() 1022
+#define _GMP_INC_1022() 1023
+#define _GMP_INC_1023() 1024
+#define _GMP_INC_1024() 1025
+#define _GMP_INC_1025() 1026
+
+// GMP_DEC
+#define _GMP_DEC_1() 0
+#define _GMP_DEC_2() 1
+#define _GMP_DEC_3() 2
+#define _GMP_DEC_4() 3
+#define _GMP_DEC_5() 4
+#define _GMP_DEC_6() 5
+#define _GMP_DEC_7() 6
+#define _GMP_DEC_8() 7
+#define _GMP_DEC_9() 8
+#define _GMP_DEC_10() 9
+#define _GMP_DEC_11() 10
+#define _GMP_DEC_12() 11
+#define _GMP_DEC_13() 12
+#define _GMP_DEC_14() 13
+#define _GMP_DEC_15() 14
+#define _GMP_DEC_16() 15
+#define _GMP_DEC_17() 16
+#define _GMP_DEC_18() 17
+#define _GMP_DEC_19() 18
+#define _GMP_DEC_20() 19
+#define _GMP_DEC_21() 20
+#define _GMP_DEC_22() 21
+#define _GMP_DEC_23() 22
+#define _GMP_DEC_24() 23
+#define _GMP_DEC_25() 24
+#define _GMP_DEC_26() 25
+#define _GMP_DEC_27() 26
+#define _GMP_DEC_28() 27
+#define _GMP_DEC_29() 28
+#define _GMP_DEC_30() 29
+#define _GMP_DEC_31() 30
+#define _GMP_DEC_32() 31
+#define _GMP_DEC_33() 32
+#define _GMP_DEC_34() 33
+#define _GMP_DEC_35() 34
+#define _GMP_DEC_36() 35
+#define _GMP_DEC_37() 36
+#define _GMP_DEC_38() 37
+#define _GMP_DEC_39() 38
+#define _GMP_DEC_40() 39
+#define _GMP_DEC_41() 40
+#define _GMP_DEC_42() 41
+#define _GMP_DEC_43() 42
+#define _GMP_DEC_44() 43
+#define _GMP_DEC_45() 44
+#define _GMP_DEC_46() 45
+#define _GMP_DEC_47() 46
+#define _GMP_DEC_48() 47
+#define _GMP_DEC_49() 48
+#define _GMP_DEC_50() 49
+#define _GMP_DEC_51() 50
+#define _GMP_DEC_52() 51
+#define _GMP_DEC_53() 52
+#define _GMP_DEC_54() 53
+#define _GMP_DEC_55() 54
+#define _GMP_DEC_56() 55
+#define _GMP_DEC_57() 56
+#define _GMP_DEC_58() 57
+#define _GMP_DEC_59() 58
+#define _GMP_DEC_60() 59
+#define _GMP_DEC_61() 60
+#define _GMP_DEC_62() 61
+#define _GMP_DEC_63() 62
+#define _GMP_DEC_64() 63
+#define _GMP_DEC_65() 64
+#define _GMP_DEC_66() 65
+#define _GMP_DEC_67() 66
+#define _GMP_DEC_68() 67
+#define _GMP_DEC_69() 68
+#define _GMP_DEC_70() 69
+#define _GMP_DEC_71() 70
+#define _GMP_DEC_72() 71
+#define _GMP_DEC_73() 72
+#define _GMP_DEC_74() 73
+#define _GMP_DEC_75() 74
+#define _GMP_DEC_76() 75
+#define _GMP_DEC_77() 76
+#define _GMP_DEC_78() 77
+#define _GMP_DEC_79() 78
+#define _GMP_DEC_80() 79
+#define _GMP_DEC_81() 80
+#define _GMP_DEC_82() 81
+#define _GMP_DEC_83() 82
+#define _GMP_DEC_84() 83
+#define _GMP_DEC_85() 84
+#define _GMP_DEC_86() 85
+#define _GMP_DEC_87() 86
+#define _GMP_DEC_88() 87
+#define _GMP_DEC_89() 88
+#define _GMP_DEC_90() 89
+#define _GMP_DEC_91() 90
+#define _GMP_DEC_92() 91
+#define _GMP_DEC_93() 92
+#define _GMP_DEC_94() 93
+#define _GMP_DEC_95() 94
+#define _GMP_DEC_96() 95
+#define _GMP_DEC_97() 96
+#define _GMP_DEC_98() 97
+#define _GMP_DEC_99() 98
+#define _GMP_DEC_100() 99
+#define _GMP_DEC_101() 100
+#define _GMP_DEC_102() 101
+#define _GMP_DEC_103() 102
+#define _GMP_DEC_104() 103
+#define _GMP_DEC_105() 104
+#define _GMP_DEC_106() 105
+#define _GMP_DEC_107() 106
+#define _GMP_DEC_108() 107
+#define _GMP_DEC_109() 108
+#define _GMP_DEC_110() 109
+#define _GMP_DEC_111() 110
+#define _GMP_DEC_112() 111
+#define _GMP_DEC_113() 112
+#define _GMP_DEC_114() 113
+#define _GMP_DEC_115() 114
+#define _GMP_DEC_116() 115
+#define _GMP_DEC_117() 116
+#define _GMP_DEC_118() 117
+#define _GMP_DEC_119() 118
+#define _GMP_DEC_120() 119
+#define _GMP_DEC_121() 120
+#define _GMP_DEC_122() 121
+#define _GMP_DEC_123() 122
+#define _GMP_DEC_124() 123
+#define _GMP_DEC_125() 124
+#define _GMP_DEC_126() 125
+#define _GMP_DEC_127() 126
+#define _GMP_DEC_128() 127
+#define _GMP_DEC_129() 128
+#define _GMP_DEC_130() 129
+#define _GMP_DEC_131() 130
+#define _GMP_DEC_132() 131
+#define _GMP_DEC_133() 132
+#define _GMP_DEC_134() 133
+#define _GMP_DEC_135() 134
+#define _GMP_DEC_136() 135
+#define _GMP_DEC_137() 136
+#define _GMP_DEC_138() 137
+#define _GMP_DEC_139() 138
+#define _GMP_DEC_140() 139
+#define _GMP_DEC_141() 140
+#define _GMP_DEC_142() 141
+#define _GMP_DEC_143() 142
+#define _GMP_DEC_144() 143
+#define _GMP_DEC_145() 144
+#define _GMP_DEC_146() 145
+#define _GMP_DEC_147() 146
+#define _GMP_DEC_148() 147
+#define _GMP_DEC_149() 148
+#define _GMP_DEC_150() 149
+#define _GMP_DEC_151() 150
+#define _GMP_DEC_152() 151
+#define _GMP_DEC_153() 152
+#define _GMP_DEC_154() 153
+#define _GMP_DEC_155() 154
+#define _GMP_DEC_156() 155
+#define _GMP_DEC_157() 156
+#define _GMP_DEC_158() 157
+#define _GMP_DEC_159() 158
+#define _GMP_DEC_160() 159
+#define _GMP_DEC_161() 160
+#define _GMP_DEC_162() 161
+#define _GMP_DEC_163() 162
+#define _GMP_DEC_164() 163
+#define _GMP_DEC_165() 164
+#define _GMP_DEC_166() 165
+#define _GMP_DEC_167() 166
+#define _GMP_DEC_168() 167
+#define _GMP_DEC_169() 168
+#define _GMP_DEC_170() 169
+#define _GMP_DEC_171() 170
+#define _GMP_DEC_172() 171
+#define _GMP_DEC_173() 172
+#define _GMP_DEC_174() 173
+#define _GMP_DEC_175() 174
+#define _GMP_DEC_176() 175
+#define _GMP_DEC_177() 176
+#define _GMP_DEC_178() 177
+#define _GMP_DEC_179() 178
+#define _GMP_DEC_180() 179
+#define _GMP_DEC_181() 180
+#define _GMP_DEC_182() 181
+#define _GMP_DEC_183() 182
+#define _GMP_DEC_184() 183
+#define _GMP_DEC_185() 184
+#define _GMP_DEC_186() 185
+#define _GMP_DEC_187() 186
+#define _GMP_DEC_188() 187
+#define _GMP_DEC_189() 188
+#define _GMP_DEC_190() 189
+#define _GMP_DEC_191() 190
+#define _GMP_DEC_192() 191
+#define _GMP_DEC_193() 192
+#define _GMP_DEC_194() 193
+#define _GMP_DEC_195() 194
+#define _GMP_DEC_196() 195
+#define _GMP_DEC_197() 196
+#define _GMP_DEC_198() 197
+#define _GMP_DEC_199() 198
+#define _GMP_DEC_200() 199
+#define _GMP_DEC_201() 200
+#define _GMP_DEC_202() 201
+#define _GMP_DEC_203() 202
+#define _GMP_DEC_204() 203
+#define _GMP_DEC_205() 204
+#define _GMP_DEC_206() 205
+#define _GMP_DEC_207() 206
+#define _GMP_DEC_208() 207
+#define _GMP_DEC_209() 208
+#define _GMP_DEC_210() 209
+#define _GMP_DEC_211() 210
+#define _GMP_DEC_212() 211
+#define _GMP_DEC_213() 212
+#define _GMP_DEC_214() 213
+#define _GMP_DEC_215() 214
+#define _GMP_DEC_216() 215
+#define _GMP_DEC_217() 216
+#define _GMP_DEC_218() 217
+#define _GMP_DEC_219() 218
+#define _GMP_DEC_220() 219
+#define _GMP_DEC_221() 220
+#define _GMP_DEC_222() 221
+#define _GMP_DEC_223() 222
+#define _GMP_DEC_224() 223
+#define _GMP_DEC_225() 224
+#define _GMP_DEC_226() 225
+#define _GMP_DEC_227() 226
+#define _GMP_DEC_228() 227
+#define _GMP_DEC_229() 228
+#define _GMP_DEC_230() 229
+#define _GMP_DEC_231() 230
+#define _GMP_DEC_232() 231
+#define _GMP_DEC_233() 232
+#define _GMP_DEC_234() 233
+#define _GMP_DEC_235() 234
+#define _GMP_DEC_236() 235
+#define _GMP_DEC_237() 236
+#define _GMP_DEC_238() 237
+#define _GMP_DEC_239() 238
+#define _GMP_DEC_240() 239
+#define _GMP_DEC_241() 240
+#define _GMP_DEC_242() 241
+#define _GMP_DEC_243() 242
+#define _GMP_DEC_244() 243
+#define _GMP_DEC_245() 244
+#define _GMP_DEC_246() 245
+#define _GMP_DEC_247() 246
+#define _GMP_DEC_248() 247
+#define _GMP_DEC_249() 248
+#define _GMP_DEC_250() 249
+#define _GMP_DEC_251() 250
+#define _GMP_DEC_252() 251
+#define _GMP_DEC_253() 252
+#define _GMP_DEC_254() 253
+#define _GMP_DEC_255() 254
+#define _GMP_DEC_256() 255
+#define _GMP_DEC_257() 256
+#define _GMP_DEC_258() 257
+#define _GMP_DEC_259() 258
+#define _GMP_DEC_260() 259
+#define _GMP_DEC_261() 260
+#define _GMP_DEC_262() 261
+#define _GMP_DEC_263() 262
+#define _GMP_DEC_264() 263
+#define _GMP_DEC_265() 264
+#define _GMP_DEC_266() 265
+#define _GMP_DEC_267() 266
+#define _GMP_DEC_268() 267
+#define _GMP_DEC_269() 268
+#define _GMP_DEC_270() 269
+#define _GMP_DEC_271() 270
+#define _GMP_DEC_272() 271
+#define _GMP_DEC_273() 272
+#define _GMP_DEC_274() 273
+#define _GMP_DEC_275() 274
+#define _GMP_DEC_276() 275
+#define _GMP_DEC_277() 276
+#define _GMP_DEC_278() 277
+#define _GMP_DEC_279() 278
+#define _GMP_DEC_280() 279
+#define _GMP_DEC_281() 280
+#define _GMP_DEC_282() 281
+#define _GMP_DEC_283() 282
+#define _GMP_DEC_284() 283
+#define _GMP_DEC_285() 284
+#define _GMP_DEC_286() 285
+#define _GMP_DEC_287() 286
+#define _GMP_DEC_288() 287
+#define _GMP_DEC_289() 288
+#define _GMP_DEC_290() 289
+#define _GMP_DEC_291() 290
+#define _GMP_DEC_292() 291
+#define _GMP_DEC_293() 292
+#define _GMP_DEC_294() 293
+#define _GMP_DEC_295() 294
+#define _GMP_DEC_296() 295
+#define _GMP_DEC_297() 296
+#define _GMP_DEC_298() 297
+#define _GMP_DEC_299() 298
+#define _GMP_DEC_300() 299
+#define _GMP_DEC_301() 300
+#define _GMP_DEC_302() 301
+#define _GMP_DEC_303() 302
+#define _GMP_DEC_304() 303
+#define _GMP_DEC_305() 304
+#define _GMP_DEC_306() 305
+#define _GMP_DEC_307() 306
+#define _GMP_DEC_308() 307
+#define _GMP_DEC_309() 308
+#define _GMP_DEC_310() 309
+#define _GMP_DEC_311() 310
+#define _GMP_DEC_312() 311
+#define _GMP_DEC_313() 312
+#define _GMP_DEC_314() 313
+#define _GMP_DEC_315() 314
+#define _GMP_DEC_316() 315
+#define _GMP_DEC_317() 316
+#define _GMP_DEC_318() 317
+#define _GMP_DEC_319() 318
+#define _GMP_DEC_320() 319
+#define _GMP_DEC_321() 320
+#define _GMP_DEC_322() 321
+#define _GMP_DEC_323() 322
+#define _GMP_DEC_324() 323
+#define _GMP_DEC_325() 324
+#define _GMP_DEC_326() 325
+#define _GMP_DEC_327() 326
+#define _GMP_DEC_328() 327
+#define _GMP_DEC_329() 328
+#define _GMP_DEC_330() 329
+#define _GMP_DEC_331() 330
+#define _GMP_DEC_332() 331
+#define _GMP_DEC_333() 332
+#define _GMP_DEC_334() 333
+#define _GMP_DEC_335() 334
+#define _GMP_DEC_336() 335
+#define _GMP_DEC_337() 336
+#define _GMP_DEC_338() 337
+#define _GMP_DEC_339() 338
+#define _GMP_DEC_340() 339
+#define _GMP_DEC_341() 340
+#define _GMP_DEC_342() 341
+#define _GMP_DEC_343() 342
+#define _GMP_DEC_344() 343
+#define _GMP_DEC_345() 344
+#define _GMP_DEC_346() 345
+#define _GMP_DEC_347() 346
+#define _GMP_DEC_348() 347
+#define _GMP_DEC_349() 348
+#define _GMP_DEC_350() 349
+#define _GMP_DEC_351() 350
+#define _GMP_DEC_352() 351
+#define _GMP_DEC_353() 352
+#define _GMP_DEC_354() 353
+#define _GMP_DEC_355() 354
+#define _GMP_DEC_356() 355
+#define _GMP_DEC_357() 356
+#define _GMP_DEC_358() 357
+#define _GMP_DEC_359() 358
+#define _GMP_DEC_360() 359
+#define _GMP_DEC_361() 360
+#define _GMP_DEC_362() 361
+#define _GMP_DEC_363() 362
+#define _GMP_DEC_364() 363
+#define _GMP_DEC_365() 364
+#define _GMP_DEC_366() 365
+#define _GMP_DEC_367() 366
+#define _GMP_DEC_368() 367
+#define _GMP_DEC_369() 368
+#define _GMP_DEC_370() 369
+#define _GMP_DEC_371() 370
+#define _GMP_DEC_372() 371
+#define _GMP_DEC_373() 372
+#define _GMP_DEC_374() 373
+#define _GMP_DEC_375() 374
+#define _GMP_DEC_376() 375
+#define _GMP_DEC_377() 376
+#define _GMP_DEC_378() 377
+#define _GMP_DEC_379() 378
+#define _GMP_DEC_380() 379
+#define _GMP_DEC_381() 380
+#define _GMP_DEC_382() 381
+#define _GMP_DEC_383() 382
+#define _GMP_DEC_384() 383
+#define _GMP_DEC_385() 384
+#define _GMP_DEC_386() 385
+#define _GMP_DEC_387() 386
+#define _GMP_DEC_388() 387
+#define _GMP_DEC_389() 388
+#define _GMP_DEC_390() 389
+#define _GMP_DEC_391() 390
+#define _GMP_DEC_392() 391
+#define _GMP_DEC_393() 392
+#define _GMP_DEC_394() 393
+#define _GMP_DEC_395() 394
+#define _GMP_DEC_396() 395
+#define _GMP_DEC_397() 396
+#define _GMP_DEC_398() 397
+#define _GMP_DEC_399() 398
+#define _GMP_DEC_400() 399
+#define _GMP_DEC_401() 400
+#define _GMP_DEC_402() 401
+#define _GMP_DEC_403() 402
+#define _GMP_DEC_404() 403
+#define _GMP_DEC_405() 404
+#define _GMP_DEC_406() 405
+#define _GMP_DEC_407() 406
+#define _GMP_DEC_408() 407
+#define _GMP_DEC_409() 408
+#define _GMP_DEC_410() 409
+#define _GMP_DEC_411() 410
+#define _GMP_DEC_412() 411
+#define _GMP_DEC_413() 412
+#define _GMP_DEC_414() 413
+#define _GMP_DEC_415() 414
+#define _GMP_DEC_416() 415
+#define _GMP_DEC_417() 416
+#define _GMP_DEC_418() 417
+#define _GMP_DEC_419() 418
+#define _GMP_DEC_420() 419
+#define _GMP_DEC_421() 420
+#define _GMP_DEC_422() 421
+#define _GMP_DEC_423() 422
+#define _GMP_DEC_424() 423
+#define _GMP_DEC_425() 424
+#define _GMP_DEC_426() 425
+#define _GMP_DEC_427() 426
+#define _GMP_DEC_428() 427
+#define _GMP_DEC_429() 428
+#define _GMP_DEC_430() 429
+#define _GMP_DEC_431() 430
+#define _GMP_DEC_432() 431
+#define _GMP_DEC_433() 432
+#define _GMP_DEC_434() 433
+#define _GMP_DEC_435() 434
+#define _GMP_DEC_436() 435
+#define _GMP_DEC_437() 436
+#define _GMP_DEC_438() 437
+#define _GMP_DEC_439() 438
+#define _GMP_DEC_440() 439
+#define _GMP_DEC_441() 440
+#define _GMP_DEC_442() 441
+#define _GMP_DEC_443() 442
+#define _GMP_DEC_444() 443
+#define _GMP_DEC_445() 444
+#define _GMP_DEC_446() 445
+#define _GMP_DEC_447() 446
+#define _GMP_DEC_448() 447
+#define _GMP_DEC_449() 448
+#define _GMP_DEC_450() 449
+#define _GMP_DEC_451() 450
+#define _GMP_DEC_452() 451
+#define _GMP_DEC_453() 452
+#define _GMP_DEC_454() 453
+#define _GMP_DEC_455() 454
+#define _GMP_DEC_456() 455
+#define _GMP_DEC_457() 456
+#define _GMP_DEC_458() 457
+#define _GMP_DEC_459() 458
+#define _GMP_DEC_460() 459
+#define _GMP_DEC_461() 460
+#define _GMP_DEC_462() 461
+#define _GMP_DEC_463() 462
+#define _GMP_DEC_464() 463
+#define _GMP_DEC_465() 464
+#define _GMP_DEC_466() 465
+#define _GMP_DEC_467() 466
+#define _GMP_DEC_468() 467
+#define _GMP_DEC_469() 468
+#define _GMP_DEC_470() 469
+#define _GMP_DEC_471() 470
+#define _GMP_DEC_472() 471
+#define _GMP_DEC_473() 472
+#define _GMP_DEC_474() 473
+#define _GMP_DEC_475() 474
+#define _GMP_DEC_476() 475
+#define _GMP_DEC_477() 476
+#define _GMP_DEC_478() 477
+#define _GMP_DEC_479() 478
+#define _GMP_DEC_480() 479
+#define _GMP_DEC_481() 480
+#define _GMP_DEC_482() 481
+#define _GMP_DEC_483() 482
+#define _GMP_DEC_484() 483
+#define _GMP_DEC_485() 484
+#define _GMP_DEC_486() 485
+#define _GMP_DEC_487() 486
+#define _GMP_DEC_488() 487
+#define _GMP_DEC_489() 488
+#define _GMP_DEC_490() 489
+#define _GMP_DEC_491() 490
+#define _GMP_DEC_492() 491
+#define _GMP_DEC_493() 492
+#define _GMP_DEC_494() 493
+#define _GMP_DEC_495() 494
+#define _GMP_DEC_496() 495
+#define _GMP_DEC_497() 496
+#define _GMP_DEC_498() 497
+#define _GMP_DEC_499() 498
+#define _GMP_DEC_500() 499
+#define _GMP_DEC_501() 500
+#define _GMP_DEC_502() 501
+#define _GMP_DEC_503() 502
+#define _GMP_DEC_504() 503
+#define _GMP_DEC_505() 504
+#define _GMP_DEC_506() 505
+#define _GMP_DEC_507() 506
+#define _GMP_DEC_508() 507
+#define _GMP_DEC_509() 508
+#define _GMP_DEC_510() 509
+#define _GMP_DEC_511() 510
+#define _GMP_DEC_512() 511
+#define _GMP_DEC_513() 512
+#define _GMP_DEC_514() 513
+#define _GMP_DEC_515() 514
+#define _GMP_DEC_516() 515
+#define _GMP_DEC_517() 516
+#define _GMP_DEC_518() 517
+#define _GMP_DEC_519() 518
+#define _GMP_DEC_520() 519
+#define _GMP_DEC_521() 520
+#define _GMP_DEC_522() 521
+#define _GMP_DEC_523() 522
+#define _GMP_DEC_524() 523
+#define _GMP_DEC_525() 524
+#define _GMP_DEC_526() 525
+#define _GMP_DEC_527() 526
+#define _GMP_DEC_528() 527
+#define _GMP_DEC_529() 528
+#define _GMP_DEC_530() 529
+#define _GMP_DEC_531() 530
+#define _GMP_DEC_532() 531
+#define _GMP_DEC_533() 532
+#define _GMP_DEC_534() 533
+#define _GMP_DEC_535() 534
+#define _GMP_DEC_536() 535
+#define _GMP_DEC_537() 536
+#define _GMP_DEC_538() 537
+#define _GMP_DEC_539() 538
+#define _GMP_DEC_540() 539
+#define _GMP_DEC_541() 540
+#define _GMP_DEC_542() 541
+#define _GMP_DEC_543() 542
+#define _GMP_DEC_544() 543
+#define _GMP_DEC_545() 544
+#define _GMP_DEC_546() 545
+#define _GMP_DEC_547() 546
+#define _GMP_DEC_548() 547
+#define _GMP_DEC_549() 548
+#define _GMP_DEC_550() 549
+#define _GMP_DEC_551() 550
+#define _GMP_DEC_552() 551
+#define _GMP_DEC_553() 552
+#define _GMP_DEC_554() 553
+#define _GMP_DEC_555() 554
+#define _GMP_DEC_556() 555
+#define _GMP_DEC_557() 556
+#define _GMP_DEC_558() 557
+#define _GMP_DEC_559() 558
+#define _GMP_DEC_560() 559
+#define _GMP_DEC_561() 560
+#define _GMP_DEC_562() 561
+#define _GMP_DEC_563() 562
+#define _GMP_DEC_564() 563
+#define _GMP_DEC_565() 564
+#define _GMP_DEC_566() 565
+#define _GMP_DEC_567() 566
+#define _GMP_DEC_568() 567
+#define _GMP_DEC_569() 568
+#define _GMP_DEC_570() 569
+#define _GMP_DEC_571() 570
+#define _GMP_DEC_572() 571
+#define _GMP_DEC_573() 572
+#define _GMP_DEC_574() 573
+#define _GMP_DEC_575() 574
+#define _GMP_DEC_576() 575
+#define _GMP_DEC_577() 576
+#define _GMP_DEC_578() 577
+#define _GMP_DEC_579() 578
+#define _GMP_DEC_580() 579
+#define _GMP_DEC_581() 580
+#define _GMP_DEC_582() 581
+#define _GMP_DEC_583() 582
+#define _GMP_DEC_584() 583
+#define _GMP_DEC_585() 584
+#define _GMP_DEC_586() 585
+#define _GMP_DEC_587() 586
+#define _GMP_DEC_588() 587
+#define _GMP_DEC_589() 588
+#define _GMP_DEC_590() 589
+#define _GMP_DEC_591() 590
+#define _GMP_DEC_592() 591
+#define _GMP_DEC_593() 592
+#define _GMP_DEC_594() 593
+#define _GMP_DEC_595() 594
+#define _GMP_DEC_596() 595
+#define _GMP_DEC_597() 596
+#define _GMP_DEC_598() 597
+#define _GMP_DEC_599() 598
+#define _GMP_DEC_600() 599
+#define _GMP_DEC_601() 600
+#define _GMP_DEC_602() 601
+#define _GMP_DEC_603() 602
+#define _GMP_DEC_604() 603
+#define _GMP_DEC_605() 604
+#define _GMP_DEC_606() 605
+#define _GMP_DEC_607() 606
+#define _GMP_DEC_608() 607
+#define _GMP_DEC_609() 608
+#define _GMP_DEC_610() 609
+#define _GMP_DEC_611() 610
+#define _GMP_DEC_612() 611
+#define _GMP_DEC_613() 612
+#define _GMP_DEC_614() 613
+#define _GMP_DEC_615() 614
+#define _GMP_DEC_616() 615
+#define _GMP_DEC_617() 616
+#define _GMP_DEC_618() 617
+#define _GMP_DEC_619() 618
+#define _GMP_DEC_620() 619
+#define _GMP_DEC_621() 620
+#define _GMP_DEC_622() 621
+#define _GMP_DEC_623() 622
+#define _GMP_DEC_624() 623
+#define _GMP_DEC_625() 624
+#define _GMP_DEC_626() 625
+#define _GMP_DEC_627() 626
+#define _GMP_DEC_628() 627
+#define _GMP_DEC_629() 628
+#define _GMP_DEC_630() 629
+#define _GMP_DEC_631() 630
+#define _GMP_DEC_632() 631
+#define _GMP_DEC_633() 632
+#define _GMP_DEC_634() 633
+#define _GMP_DEC_635() 634
+#define _GMP_DEC_636() 635
+#define _GMP_DEC_637() 636
+#define _GMP_DEC_638() 637
+#define _GMP_DEC_639() 638
+#define _GMP_DEC_640() 639
+#define _GMP_DEC_641() 640
+#define _GMP_DEC_642() 641
+#define _GMP_DEC_643() 642
+#define _GMP_DEC_644() 643
+#define _GMP_DEC_645() 644
+#define _GMP_DEC_646() 645
+#define _GMP_DEC_647() 646
+#define _GMP_DEC_648() 647
+#define _GMP_DEC_649() 648
+#define _GMP_DEC_650() 649
+#define _GMP_DEC_651() 650
+#define _GMP_DEC_652() 651
+#define _GMP_DEC_653() 652
+#define _GMP_DEC_654() 653
+#define _GMP_DEC_655() 654
+#define _GMP_DEC_656() 655
+#define _GMP_DEC_657() 656
+#define _GMP_DEC_658() 657
+#define _GMP_DEC_659() 658
+#define _GMP_DEC_660() 659
+#define _GMP_DEC_661() 660
+#define _GMP_DEC_662() 661
+#define _GMP_DEC_663() 662
+#define _GMP_DEC_664() 663
+#define _GMP_DEC_665() 664
+#define _GMP_DEC_666() 665
+#define _GMP_DEC_667() 666
+#define _GMP_DEC_668() 667
+#define _GMP_DEC_669() 668
+#define _GMP_DEC_670() 669
+#define _GMP_DEC_671() 670
+#define _GMP_DEC_672() 671
+#define _GMP_DEC_673() 672
+#define _GMP_DEC_674() 673
+#define _GMP_DEC_675() 674
+#define _GMP_DEC_676() 675
+#define _GMP_DEC_677() 676
+#define _GMP_DEC_678() 677
+#define _GMP_DEC_679() 678
+#define _GMP_DEC_680() 679
+#define _GMP_DEC_681() 680
+#define _GMP_DEC_682() 681
+#define _GMP_DEC_683() 682
+#define _GMP_DEC_684() 683
+#define _GMP_DEC_685() 684
+#define _GMP_DEC_686() 685
+#define _GMP_DEC_687() 686
+#define _GMP_DEC_688() 687
+#define _GMP_DEC_689() 688
+#define _GMP_DEC_690() 689
+#define _GMP_DEC_691() 690
+#define _GMP_DEC_692() 691
+#define _GMP_DEC_693() 692
+#define _GMP_DEC_694() 693
+#define _GMP_DEC_695() 694
+#define _GMP_DEC_696() 695
+#define _GMP_DEC_697() 696
+#define _GMP_DEC_698() 697
+#define _GMP_DEC_699() 698
+#define _GMP_DEC_700() 699
+#define _GMP_DEC_701() 700
+#define _GMP_DEC_702() 701
+#define _GMP_DEC_703() 702
+#define _GMP_DEC_704() 703
+#define _GMP_DEC_705() 704
+#define _GMP_DEC_706() 705
+#define _GMP_DEC_707() 706
+#define _GMP_DEC_708() 707
+#define _GMP_DEC_709() 708
+#define _GMP_DEC_710() 709
+#define _GMP_DEC_711() 710
+#define _GMP_DEC_712() 711
+#define _GMP_DEC_713() 712
+#define _GMP_DEC_714() 713
+#define _GMP_DEC_715() 714
+#define _GMP_DEC_716() 715
+#define _GMP_DEC_717() 716
+#define _GMP_DEC_718() 717
+#define _GMP_DEC_719() 718
+#define _GMP_DEC_720() 719
+#define _GMP_DEC_721() 720
+#define _GMP_DEC_722() 721
+#define _GMP_DEC_723() 722
+#define _GMP_DEC_724() 723
+#define _GMP_DEC_725() 724
+#define _GMP_DEC_726() 725
+#define _GMP_DEC_727() 726
+#define _GMP_DEC_728() 727
+#define _GMP_DEC_729() 728
+#define _GMP_DEC_730() 729
+#define _GMP_DEC_731() 730
+#define _GMP_DEC_732() 731
+#define _GMP_DEC_733() 732
+#define _GMP_DEC_734() 733
+#define _GMP_DEC_735() 734
+#define _GMP_DEC_736() 735
+#define _GMP_DEC_737() 736
+#define _GMP_DEC_738() 737
+#define _GMP_DEC_739() 738
+#define _GMP_DEC_740() 739
+#define _GMP_DEC_741() 740
+#define _GMP_DEC_742() 741
+#define _GMP_DEC_743() 742
+#define _GMP_DEC_744() 743
+#define _GMP_DEC_745() 744
+#define _GMP_DEC_746() 745
+#define _GMP_DEC_747() 746
+#define _GMP_DEC_748() 747
+#define _GMP_DEC_749() 748
+#define _GMP_DEC_750() 749
+#define _GMP_DEC_751() 750
+#define _GMP_DEC_752() 751
+#define _GMP_DEC_753() 752
+#define _GMP_DEC_754() 753
+#define _GMP_DEC_755() 754
+#define _GMP_DEC_756() 755
+#define _GMP_DEC_757() 756
+#define _GMP_DEC_758() 757
+#define _GMP_DEC_759() 758
+#define _GMP_DEC_760() 759
+#define _GMP_DEC_761() 760
+#define _GMP_DEC_762() 761
+#define _GMP_DEC_763() 762
+#define _GMP_DEC_764() 763
+#define _GMP_DEC_765() 764
+#define _GMP_DEC_766() 765
+#define _GMP_DEC_767() 766
+#define _GMP_DEC_768() 767
+#define _GMP_DEC_769() 768
+#define _GMP_DEC_770() 769
+#define _GMP_DEC_771() 770
+#define _GMP_DEC_772() 771
+#define _GMP_DEC_773() 772
+#define _GMP_DEC_774() 773
+#define _GMP_DEC_775() 774
+#define _GMP_DEC_776() 775
+#define _GMP_DEC_777() 776
+#define _GMP_DEC_778() 777
+#define _GMP_DEC_779() 778
+#define _GMP_DEC_780() 779
+#define _GMP_DEC_781() 780
+#define _GMP_DEC_782() 781
+#define _GMP_DEC_783() 782
+#define _GMP_DEC_784() 783
+#define _GMP_DEC_785() 784
+#define _GMP_DEC_786() 785
+#define _GMP_DEC_787() 786
+#define _GMP_DEC_788() 787
+#define _GMP_DEC_789() 788
+#define _GMP_DEC_790() 789
+#define _GMP_DEC_791() 790
+#define _GMP_DEC_792() 791
+#define _GMP_DEC_793() 792
+#define _GMP_DEC_794() 793
+#define _GMP_DEC_795() 794
+#define _GMP_DEC_796() 795
+#define _GMP_DEC_797() 796
+#define _GMP_DEC_798() 797
+#define _GMP_DEC_799() 798
+#define _GMP_DEC_800() 799
+#define _GMP_DEC_801() 800
+#define _GMP_DEC_802() 801
+#define _GMP_DEC_803() 802
+#define _GMP_DEC_804() 803
+#define _GMP_DEC_805() 804
+#define _GMP_DEC_806() 805
+#define _GMP_DEC_807() 806
+#define _GMP_DEC_808() 807
+#define _GMP_DEC_809() 808
+#define _GMP_DEC_810() 809
+#define _GMP_DEC_811() 810
+#define _GMP_DEC_812() 811
+#define _GMP_DEC_813() 812
+#define _GMP_DEC_814() 813
+#define _GMP_DEC_815() 814
+#define _GMP_DEC_816() 815
+#define _GMP_DEC_817() 816
+#define _GMP_DEC_818() 817
+#define _GMP_DEC_819() 818
+#define _GMP_DEC_820() 819
+#define _GMP_DEC_821() 820
+#define _GMP_DEC_822() 821
+#define _GMP_DEC_823() 822
+#define _GMP_DEC_824() 823
+#define _GMP_DEC_825() 824
+#define _GMP_DEC_826() 825
+#define _GMP_DEC_827() 826
+#define _GMP_DEC_828() 827
+#define _GMP_DEC_829() 828
+#define _GMP_DEC_830() 829
+#define _GMP_DEC_831() 830
+#define _GMP_DEC_832() 831
+#define _GMP_DEC_833() 832
+#define _GMP_DEC_834() 833
+#define _GMP_DEC_835() 834
+#define _GMP_DEC_836() 835
+#define _GMP_DEC_837() 836
+#define _GMP_DEC_838() 837
+#define _GMP_DEC_839() 838
+#define _GMP_DEC_840() 839
+#define _GMP_DEC_841() 840
+#define _GMP_DEC_842() 841
+#define _GMP_DEC_843() 842
+#define _GMP_DEC_844() 843
+#define _GMP_DEC_845() 844
+#define _GMP_DEC_846() 845
+#define _GMP_DEC_847() 846
+#define _GMP_DEC_848() 847
+#define _GMP_DEC_849() 848
+#define _GMP_DEC_850() 849
+#define _GMP_DEC_851() 850
+#define _GMP_DEC_852() 851
+#define _GMP_DEC_853() 852
+#define _GMP_DEC_854() 853
+#define _GMP_DEC_855() 854
+#define _GMP_DEC_856() 855
+#define _GMP_DEC_857() 856
+#define _GMP_DEC_858() 857
+#define _GMP_DEC_859() 858
+#define _GMP_DEC_860() 859
+#define _GMP_DEC_861() 860
+#define _GMP_DEC_862() 861
+#define _GMP_DEC_863() 862
+#define _GMP_DEC_864() 863
+#define _GMP_DEC_865() 864
+#define _GMP_DEC_866() 865
+#define _GMP_DEC_867() 866
+#define _GMP_DEC_868() 867
+#define _GMP_DEC_869() 868
+#define _GMP_DEC_870() 869
+#define _GMP_DEC_871() 870
+#define _GMP_DEC_872() 871
+#define _GMP_DEC_873() 872
+#define _GMP_DEC_874() 873
+#define _GMP_DEC_875() 874
+#define _GMP_DEC_876() 875
+#define _GMP_DEC_877() 876
+#define _GMP_DEC_878() 877
+#define _GMP_DEC_879() 878
+#define _GMP_DEC_880() 879
+#define _GMP_DEC_881() 880
+#define _GMP_DEC_882() 881
+#define _GMP_DEC_883() 882
+#define _GMP_DEC_884() 883
+#define _GMP_DEC_885() 884
+#define _GMP_DEC_886() 885
+#define _GMP_DEC_887() 886
+#define _GMP_DEC_888() 887
+#define _GMP_DEC_889() 888
+#define _GMP_DEC_890() 889
+#define _GMP_DEC_891() 890
+#define _GMP_DEC_892() 891
+#define _GMP_DEC_893() 892
+#define _GMP_DEC_894() 893
+#define _GMP_DEC_895() 894
+#define _GMP_DEC_896() 895
+#define _GMP_DEC_897() 896
+#define _GMP_DEC_898() 897
+#define _GMP_DEC_899() 898
+#define _GMP_DEC_900() 899
+#define _GMP_DEC_901() 900
+#define _GMP_DEC_902() 901
+#define _GMP_DEC_903() 902
+#define _GMP_DEC_904() 903
+#define _GMP_DEC_905() 904
+#define _GMP_DEC_906() 905
+#define _GMP_DEC_907() 906
+#define _GMP_DEC_908() 907
+#define _GMP_DEC_909() 908
+#define _GMP_DEC_910() 909
+#define _GMP_DEC_911() 910
+#define _GMP_DEC_912() 911
+#define _GMP_DEC_913() 912
+#define _GMP_DEC_914() 913
+#define _GMP_DEC_915() 914
+#define _GMP_DEC_916() 915
+#define _GMP_DEC_917() 916
+#define _GMP_DEC_918() 917
+#define _GMP_DEC_919() 918
+#define _GMP_DEC_920() 919
+#define _GMP_DEC_921() 920
+#define _GMP_DEC_922() 921
+#define _GMP_DEC_923() 922
+#define _GMP_DEC_924() 923
+#define _GMP_DEC_925() 924
+#define _GMP_DEC_926() 925
+#define _GMP_DEC_927() 926
+#define _GMP_DEC_928() 927
+#define _GMP_DEC_929() 928
+#define _GMP_DEC_930() 929
+#define _GMP_DEC_931() 930
+#define _GMP_DEC_932() 931
+#define _GMP_DEC_933() 932
+#define _GMP_DEC_934() 933
+#define _GMP_DEC_935() 934
+#define _GMP_DEC_936() 935
+#define _GMP_DEC_937() 936
+#define _GMP_DEC_938() 937
+#define _GMP_DEC_939() 938
+#define _GMP_DEC_940() 939
+#define _GMP_DEC_941() 940
+#define _GMP_DEC_942() 941
+#define _GMP_DEC_943() 942
+#define _GMP_DEC_944() 943
+#define _GMP_DEC_945() 944
+#define _GMP_DEC_946() 945
+#define _GMP_DEC_947() 946
+#define _GMP_DEC_948() 947
+#define _GMP_DEC_949() 948
+#define _GMP_DEC_950() 949
+#define _GMP_DEC_951() 950
+#define _GMP_DEC_952() 951
+#define _GMP_DEC_953() 952
+#define _GMP_DEC_954() 953
+#define _GMP_DEC_955() 954
+#define _GMP_DEC_956() 955
+#define _GMP_DEC_957() 956
+#define _GMP_DEC_958() 957
+#define _GMP_DEC_959() 958
+#define _GMP_DEC_960() 959
+#define _GMP_DEC_961() 960
+#define _GMP_DEC_962() 961
+#define _GMP_DEC_963() 962
+#define _GMP_DEC_964() 963
+#define _GMP_DEC_965() 964
+#define _GMP_DEC_966() 965
+#define _GMP_DEC_967() 966
+#define _GMP_DEC_968() 967
+#define _GMP_DEC_969() 968
+#define _GMP_DEC_970() 969
+#define _GMP_DEC_971() 970
+#define _GMP_DEC_972() 971
+#define _GMP_DEC_973() 972
+#define _GMP_DEC_974() 973
+#define _GMP_DEC_975() 974
+#define _GMP_DEC_976() 975
+#define _GMP_DEC_977() 976
+#define _GMP_DEC_978() 977
+#define _GMP_DEC_979() 978
+#define _GMP_DEC_980() 979
+#define _GMP_DEC_981() 980
+#define _GMP_DEC_982() 981
+#define _GMP_DEC_983() 982
+#define _GMP_DEC_984() 983
+#define _GMP_DEC_985() 984
+#define _GMP_DEC_986() 985
+#define _GMP_DEC_987() 986
+#define _GMP_DEC_988() 987
+#define _GMP_DEC_989() 988
+#define _GMP_DEC_990() 989
+#define _GMP_DEC_991() 990
+#define _GMP_DEC_992() 991
+#define _GMP_DEC_993() 992
+#define _GMP_DEC_994() 993
+#define _GMP_DEC_995() 994
+#define _GMP_DEC_996() 995
+#define _GMP_DEC_997() 996
+#define _GMP_DEC_998() 997
+#define _GMP_DEC_999() 998
+#define _GMP_DEC_1000() 999
+#define _GMP_DEC_1001() 1000
+#define _GMP_DEC_1002() 1001
+#define _GMP_DEC_1003() 1002
+#define _GMP_DEC_1004() 1003
+#define _GMP_DEC_1005() 1004
+#define _GMP_DEC_1006() 1005
+#define _GMP_DEC_1007() 1006
+#define _GMP_DEC_1008() 1007
+#define _GMP_DEC_1009() 1008
+#define _GMP_DEC_1010() 1009
+#define _GMP_DEC_1011() 1010
+#define _GMP_DEC_1012() 1011
+#define _GMP_DEC_1013() 1012
+#define _GMP_DEC_1014() 1013
+#define _GMP_DEC_1015() 1014
+#define _GMP_DEC_1016() 1015
+#define _GMP_DEC_1017() 1016
+#define _GMP_DEC_1018() 1017
+#define _GMP_DEC_1019() 1018
+#define _GMP_DEC_1020() 1019
+#define _GMP_DEC_1021() 1020
+#define _GMP_DEC_1022() 1021
+#define _GMP_DEC_1023() 1022
+#define _GMP_DEC_1024() 1023
+#define _GMP_DEC_1025() 1024
+
+// GMP_BOOL
+#define _GMP_BOOL_0 0
+#define _GMP_BOOL_1 1
+#define _GMP_BOOL_2 1
+#define _GMP_BOOL_3 1
+#define _GMP_BOOL_4 1
+#define _GMP_BOOL_5 1
+#define _GMP_BOOL_6 1
+#define _GMP_BOOL_7 1
+#define _GMP_BOOL_8 1
+#define _GMP_BOOL_9 1
+#define _GMP_BOOL_10 1
+#define _GMP_BOOL_11 1
+#define _GMP_BOOL_12 1
+#define _GMP_BOOL_13 1
+#define _GMP_BOOL_14 1
+#define _GMP_BOOL_15 1
+#define _GMP_BOOL_16 1
+#define _GMP_BOOL_17 1
+#define _GMP_BOOL_18 1
+#define _GMP_BOOL_19 1
+#define _GMP_BOOL_20 1
+#define _GMP_BOOL_21 1
+#define _GMP_BOOL_22 1
+#define _GMP_BOOL_23 1
+#define _GMP_BOOL_24 1
+#define _GMP_BOOL_25 1
+#define _GMP_BOOL_26 1
+#define _GMP_BOOL_27 1
+#define _GMP_BOOL_28 1
+#define _GMP_BOOL_29 1
+#define _GMP_BOOL_30 1
+#define _GMP_BOOL_31 1
+#define _GMP_BOOL_32 1
+#define _GMP_BOOL_33 1
+#define _GMP_BOOL_34 1
+#define _GMP_BOOL_35 1
+#define _GMP_BOOL_36 1
+#define _GMP_BOOL_37 1
+#define _GMP_BOOL_38 1
+#define _GMP_BOOL_39 1
+#define _GMP_BOOL_40 1
+#define _GMP_BOOL_41 1
+#define _GMP_BOOL_42 1
+#define _GMP_BOOL_43 1
+#define _GMP_BOOL_44 1
+#define _GMP_BOOL_45 1
+#define _GMP_BOOL_46 1
+#define _GMP_BOOL_47 1
+#define _GMP_BOOL_48 1
+#define _GMP_BOOL_49 1
+#define _GMP_BOOL_50 1
+#define _GMP_BOOL_51 1
+#define _GMP_BOOL_52 1
+#define _GMP_BOOL_53 1
+#define _GMP_BOOL_54 1
+#define _GMP_BOOL_55 1
+#define _GMP_BOOL_56 1
+#define _GMP_BOOL_57 1
+#define _GMP_BOOL_58 1
+#define _GMP_BOOL_59 1
+#define _GMP_BOOL_60 1
+#define _GMP_BOOL_61 1
+#define _GMP_BOOL_62 1
+#define _GMP_BOOL_63 1
+#define _GMP_BOOL_64 1
+#define _GMP_BOOL_65 1
+#define _GMP_BOOL_66 1
+#define _GMP_BOOL_67 1
+#define _GMP_BOOL_68 1
+#define _GMP_BOOL_69 1
+#define _GMP_BOOL_70 1
+#define _GMP_BOOL_71 1
+#define _GMP_BOOL_72 1
+#define _GMP_BOOL_73 1
+#define _GMP_BOOL_74 1
+#define _GMP_BOOL_75 1
+#define _GMP_BOOL_76 1
+#define _GMP_BOOL_77 1
+#define _GMP_BOOL_78 1
+#define _GMP_BOOL_79 1
+#define _GMP_BOOL_80 1
+#define _GMP_BOOL_81 1
+#define _GMP_BOOL_82 1
+#define _GMP_BOOL_83 1
+#define _GMP_BOOL_84 1
+#define _GMP_BOOL_85 1
+#define _GMP_BOOL_86 1
+#define _GMP_BOOL_87 1
+#define _GMP_BOOL_88 1
+#define _GMP_BOOL_89 1
+#define _GMP_BOOL_90 1
+#define _GMP_BOOL_91 1
+#define _GMP_BOOL_92 1
+#define _GMP_BOOL_93 1
+#define _GMP_BOOL_94 1
+#define _GMP_BOOL_95 1
+#define _GMP_BOOL_96 1
+#define _GMP_BOOL_97 1
+#define _GMP_BOOL_98 1
+#define _GMP_BOOL_99 1
+#define _GMP_BOOL_100 1
+#define _GMP_BOOL_101 1
+#define _GMP_BOOL_102 1
+#define _GMP_BOOL_103 1
+#define _GMP_BOOL_104 1
+#define _GMP_BOOL_105 1
+#define _GMP_BOOL_106 1
+#define _GMP_BOOL_107 1
+#define _GMP_BOOL_108 1
+#define _GMP_BOOL_109 1
+#define _GMP_BOOL_110 1
+#define _GMP_BOOL_111 1
+#define _GMP_BOOL_112 1
+#define _GMP_BOOL_113 1
+#define _GMP_BOOL_114 1
+#define _GMP_BOOL_115 1
+#define _GMP_BOOL_116 1
+#define _GMP_BOOL_117 1
+#define _GMP_BOOL_118 1
+#define _GMP_BOOL_119 1
+#define _GMP_BOOL_120 1
+#define _GMP_BOOL_121 1
+#define _GMP_BOOL_122 1
+#define _GMP_BOOL_123 1
+#define _GMP_BOOL_124 1
+#define _GMP_BOOL_125 1
+#define _GMP_BOOL_126 1
+#define _GMP_BOOL_127 1
+#define _GMP_BOOL_128 1
+#define _GMP_BOOL_129 1
+#define _GMP_BOOL_130 1
+#define _GMP_BOOL_131 1
+#define _GMP_BOOL_132 1
+#define _GMP_BOOL_133 1
+#define _GMP_BOOL_134 1
+#define _GMP_BOOL_135 1
+#define _GMP_BOOL_136 1
+#define _GMP_BOOL_137 1
+#define _GMP_BOOL_138 1
+#define _GMP_BOOL_139 1
+#define _GMP_BOOL_140 1
+#define _GMP_BOOL_141 1
+#define _GMP_BOOL_142 1
+#define _GMP_BOOL_143 1
+#define _GMP_BOOL_144 1
+#define _GMP_BOOL_145 1
+#define _GMP_BOOL_146 1
+#define _GMP_BOOL_147 1
+#define _GMP_BOOL_148 1
+#define _GMP_BOOL_149 1
+#define _GMP_BOOL_150 1
+#define _GMP_BOOL_151 1
+#define _GMP_BOOL_152 1
+#define _GMP_BOOL_153 1
+#define _GMP_BOOL_154 1
+#define _GMP_BOOL_155 1
+#define _GMP_BOOL_156 1
+#define _GMP_BOOL_157 1
+#define _GMP_BOOL_158 1
+#define _GMP_BOOL_159 1
+#define _GMP_BOOL_160 1
+#define _GMP_BOOL_161 1
+#define _GMP_BOOL_162 1
+#define _GMP_BOOL_163 1
+#define _GMP_BOOL_164 1
+#define _GMP_BOOL_165 1
+#define _GMP_BOOL_166 1
+#define _GMP_BOOL_167 1
+#define _GMP_BOOL_168 1
+#define _GMP_BOOL_169 1
+#define _GMP_BOOL_170 1
+#define _GMP_BOOL_171 1
+#define _GMP_BOOL_172 1
+#define _GMP_BOOL_173 1
+#define _GMP_BOOL_174 1
+#define _GMP_BOOL_175 1
+#define _GMP_BOOL_176 1
+#define _GMP_BOOL_177 1
+#define _GMP_BOOL_178 1
+#define _GMP_BOOL_179 1
+#define _GMP_BOOL_180 1
+#define _GMP_BOOL_181 1
+#define _GMP_BOOL_182 1
+#define _GMP_BOOL_183 1
+#define _GMP_BOOL_184 1
+#define _GMP_BOOL_185 1
+#define _GMP_BOOL_186 1
+#define _GMP_BOOL_187 1
+#define _GMP_BOOL_188 1
+#define _GMP_BOOL_189 1
+#define _GMP_BOOL_190 1
+#define _GMP_BOOL_191 1
+#define _GMP_BOOL_192 1
+#define _GMP_BOOL_193 1
+#define _GMP_BOOL_194 1
+#define _GMP_BOOL_195 1
+#define _GMP_BOOL_196 1
+#define _GMP_BOOL_197 1
+#define _GMP_BOOL_198 1
+#define _GMP_BOOL_199 1
+#define _GMP_BOOL_200 1
+#define _GMP_BOOL_201 1
+#define _GMP_BOOL_202 1
+#define _GMP_BOOL_203 1
+#define _GMP_BOOL_204 1
+#define _GMP_BOOL_205 1
+#define _GMP_BOOL_206 1
+#define _GMP_BOOL_207 1
+#define _GMP_BOOL_208 1
+#define _GMP_BOOL_209 1
+#define _GMP_BOOL_210 1
+#define _GMP_BOOL_211 1
+#define _GMP_BOOL_212 1
+#define _GMP_BOOL_213 1
+#define _GMP_BOOL_214 1
+#define _GMP_BOOL_215 1
+#define _GMP_BOOL_216 1
+#define _GMP_BOOL_217 1
+#define _GMP_BOOL_218 1
+#define _GMP_BOOL_219 1
+#define _GMP_BOOL_220 1
+#define _GMP_BOOL_221 1
+#define _GMP_BOOL_222 1
+#define _GMP_BOOL_223 1
+#define _GMP_BOOL_224 1
+#define _GMP_BOOL_225 1
+#define _GMP_BOOL_226 1
+#define _GMP_BOOL_227 1
+#define _GMP_BOOL_228 1
+#define _GMP_BOOL_229 1
+#define _GMP_BOOL_230 1
+#define _GMP_BOOL_231 1
+#define _GMP_BOOL_232 1
+#define _GMP_BOOL_233 1
+#define _GMP_BOOL_234 1
+#define _GMP_BOOL_235 1
+#define _GMP_BOOL_236 1
+#define _GMP_BOOL_237 1
+#define _GMP_BOOL_238 1
+#define _GMP_BOOL_239 1
+#define _GMP_BOOL_240 1
+#define _GMP_BOOL_241 1
+#define _GMP_BOOL_242 1
+#define _GMP_BOOL_243 1
+#define _GMP_BOOL_244 1
+#define _GMP_BOOL_245 1
+#define _GMP_BOOL_246 1
+#define _GMP_BOOL_247 1
+#define _GMP_BOOL_248 1
+#define _GMP_BOOL_249 1
+#define _GMP_BOOL_250 1
+#define _GMP_BOOL_251 1
+#define _GMP_BOOL_252 1
+#define _GMP_BOOL_253 1
+#define _GMP_BOOL_254 1
+#define _GMP_BOOL_255 1
+#define _GMP_BOOL_256 1
+#define _GMP_BOOL_257 1
+#define _GMP_BOOL_258 1
+#define _GMP_BOOL_259 1
+#define _GMP_BOOL_260 1
+#define _GMP_BOOL_261 1
+#define _GMP_BOOL_262 1
+#define _GMP_BOOL_263 1
+#define _GMP_BOOL_264 1
+#define _GMP_BOOL_265 1
+#define _GMP_BOOL_266 1
+#define _GMP_BOOL_267 1
+#define _GMP_BOOL_268 1
+#define _GMP_BOOL_269 1
+#define _GMP_BOOL_270 1
+#define _GMP_BOOL_271 1
+#define _GMP_BOOL_272 1
+#define _GMP_BOOL_273 1
+#define _GMP_BOOL_274 1
+#define _GMP_BOOL_275 1
+#define _GMP_BOOL_276 1
+#define _GMP_BOOL_277 1
+#define _GMP_BOOL_278 1
+#define _GMP_BOOL_279 1
+#define _GMP_BOOL_280 1
+#define _GMP_BOOL_281 1
+#define _GMP_BOOL_282 1
+#define _GMP_BOOL_283 1
+#define _GMP_BOOL_284 1
+#define _GMP_BOOL_285 1
+#define _GMP_BOOL_286 1
+#define _GMP_BOOL_287 1
+#define _GMP_BOOL_288 1
+#define _GMP_BOOL_289 1
+#define _GMP_BOOL_290 1
+#define _GMP_BOOL_291 1
+#define _GMP_BOOL_292 1
+#define _GMP_BOOL_293 1
+#define _GMP_BOOL_294 1
+#define _GMP_BOOL_295 1
+#define _GMP_BOOL_296 1
+#define _GMP_BOOL_297 1
+#define _GMP_BOOL_298 1
+#define _GMP_BOOL_299 1
+#define _GMP_BOOL_300 1
+#define _GMP_BOOL_301 1
+#define _GMP_BOOL_302 1
+#define _GMP_BOOL_303 1
+#define _GMP_BOOL_304 1
+#define _GMP_BOOL_305 1
+#define _GMP_BOOL_306 1
+#define _GMP_BOOL_307 1
+#define _GMP_BOOL_308 1
+#define _GMP_BOOL_309 1
+#define _GMP_BOOL_310 1
+#define _GMP_BOOL_311 1
+#define _GMP_BOOL_312 1
+#define _GMP_BOOL_313 1
+#define _GMP_BOOL_314 1
+#define _GMP_BOOL_315 1
+#define _GMP_BOOL_316 1
+#define _GMP_BOOL_317 1
+#define _GMP_BOOL_318 1
+#define _GMP_BOOL_319 1
+#define _GMP_BOOL_320 1
+#define _GMP_BOOL_321 1
+#define _GMP_BOOL_322 1
+#define _GMP_BOOL_323 1
+#define _GMP_BOOL_324 1
+#define _GMP_BOOL_325 1
+#define _GMP_BOOL_326 1
+#define _GMP_BOOL_327 1
+#define _GMP_BOOL_328 1
+#define _GMP_BOOL_329 1
+#define _GMP_BOOL_330 1
+#define _GMP_BOOL_331 1
+#define _GMP_BOOL_332 1
+#define _GMP_BOOL_333 1
+#define _GMP_BOOL_334 1
+#define _GMP_BOOL_335 1
+#define _GMP_BOOL_336 1
+#define _GMP_BOOL_337 1
+#define _GMP_BOOL_338 1
+#define _GMP_BOOL_339 1
+#define _GMP_BOOL_340 1
+#define _GMP_BOOL_341 1
+#define _GMP_BOOL_342 1
+#define _GMP_BOOL_343 1
+#define _GMP_BOOL_344 1
+#define _GMP_BOOL_345 1
+#define _GMP_BOOL_346 1
+#define _GMP_BOOL_347 1
+#define _GMP_BOOL_348 1
+#define _GMP_BOOL_349 1
+#define _GMP_BOOL_350 1
+#define _GMP_BOOL_351 1
+#define _GMP_BOOL_352 1
+#define _GMP_BOOL_353 1
+#define _GMP_BOOL_354 1
+#define _GMP_BOOL_355 1
+#define _GMP_BOOL_356 1
+#define _GMP_BOOL_357 1
+#define _GMP_BOOL_358 1
+#define _GMP_BOOL_359 1
+#define _GMP_BOOL_360 1
+#define _GMP_BOOL_361 1
+#define _GMP_BOOL_362 1
+#define _GMP_BOOL_363 1
+#define _GMP_BOOL_364 1
+#define _GMP_BOOL_365 1
+#define _GMP_BOOL_366 1
+#define _GMP_BOOL_367 1
+#define _GMP_BOOL_368 1
+#define _GMP_BOOL_369 1
+#define _GMP_BOOL_370 1
+#define _GMP_BOOL_371 1
+#define _GMP_BOOL_372 1
+#define _GMP_BOOL_373 1
+#define _GMP_BOOL_374 1
+#define _GMP_BOOL_375 1
+#define _GMP_BOOL_376 1
+#define _GMP_BOOL_377 1
+#define _GMP_BOOL_378 1
+#define _GMP_BOOL_379 1
+#define _GMP_BOOL_380 1
+#define _GMP_BOOL_381 1
+#define _GMP_BOOL_382 1
+#define _GMP_BOOL_383 1
+#define _GMP_BOOL_384 1
+#define _GMP_BOOL_385 1
+#define _GMP_BOOL_386 1
+#define _GMP_BOOL_387 1
+#define _GMP_BOOL_388 1
+#define _GMP_BOOL_389 1
+#define _GMP_BOOL_390 1
+#define _GMP_BOOL_391 1
+#define _GMP_BOOL_392 1
+#define _GMP_BOOL_393 1
+#define _GMP_BOOL_394 1
+#define _GMP_BOOL_395 1
+#define _GMP_BOOL_396 1
+#define _GMP_BOOL_397 1
+#define _GMP_BOOL_398 1
+#define _GMP_BOOL_399 1
+#define _GMP_BOOL_400 1
+#define _GMP_BOOL_401 1
+#define _GMP_BOOL_402 1
+#define _GMP_BOOL_403 1
+#define _GMP_BOOL_404 1
+#define _GMP_BOOL_405 1
+#define _GMP_BOOL_406 1
+#define _GMP_BOOL_407 1
+#define _GMP_BOOL_408 1
+#define _GMP_BOOL_409 1
+#define _GMP_BOOL_410 1
+#define _GMP_BOOL_411 1
+#define _GMP_BOOL_412 1
+#define _GMP_BOOL_413 1
+#define _GMP_BOOL_414 1
+#define _GMP_BOOL_415 1
+#define _GMP_BOOL_416 1
+#define _GMP_BOOL_417 1
+#define _GMP_BOOL_418 1
+#define _GMP_BOOL_419 1
+#define _GMP_BOOL_420 1
+#define _GMP_BOOL_421 1
+#define _GMP_BOOL_422 1
+#define _GMP_BOOL_423 1
+#define _GMP_BOOL_424 1
+#define _GMP_BOOL_425 1
+#define _GMP_BOOL_426 1
+#define _GMP_BOOL_427 1
+#define _GMP_BOOL_428 1
+#define _GMP_BOOL_429 1
+#define _GMP_BOOL_430 1
+#define _GMP_BOOL_431 1
+#define _GMP_BOOL_432 1
+#define _GMP_BOOL_433 1
+#define _GMP_BOOL_434 1
+#define _GMP_BOOL_435 1
+#define _GMP_BOOL_436 1
+#define _GMP_BOOL_437 1
+#define _GMP_BOOL_438 1
+#define _GMP_BOOL_439 1
+#define _GMP_BOOL_440 1
+#define _GMP_BOOL_441 1
+#define _GMP_BOOL_442 1
+#define _GMP_BOOL_443 1
+#define _GMP_BOOL_444 1
+#define _GMP_BOOL_445 1
+#define _GMP_BOOL_446 1
+#define _GMP_BOOL_447 1
+#define _GMP_BOOL_448 1
+#define _GMP_BOOL_449 1
+#define _GMP_BOOL_450 1
+#define _GMP_BOOL_451 1
+#define _GMP_BOOL_452 1
+#define _GMP_BOOL_453 1
+#define _GMP_BOOL_454 1
+#define _GMP_BOOL_455 1
+#define _GMP_BOOL_456 1
+#define _GMP_BOOL_457 1
+#define _GMP_BOOL_458 1
+#define _GMP_BOOL_459 1
+#define _GMP_BOOL_460 1
+#define _GMP_BOOL_461 1
+#define _GMP_BOOL_462 1
+#define _GMP_BOOL_463 1
+#define _GMP_BOOL_464 1
+#define _GMP_BOOL_465 1
+#define _GMP_BOOL_466 1
+#define _GMP_BOOL_467 1
+#define _GMP_BOOL_468 1
+#define _GMP_BOOL_469 1
+#define _GMP_BOOL_470 1
+#define _GMP_BOOL_471 1
+#define _GMP_BOOL_472 1
+#define _GMP_BOOL_473 1
+#define _GMP_BOOL_474 1
+#define _GMP_BOOL_475 1
+#define _GMP_BOOL_476 1
+#define _GMP_BOOL_477 1
+#define _GMP_BOOL_478 1
+#define _GMP_BOOL_479 1
+#define _GMP_BOOL_480 1
+#define _GMP_BOOL_481 1
+#define _GMP_BOOL_482 1
+#define _GMP_BOOL_483 1
+#define _GMP_BOOL_484 1
+#define _GMP_BOOL_485 1
+#define _GMP_BOOL_486 1
+#define _GMP_BOOL_487 1
+#define _GMP_BOOL_488 1
+#define _GMP_BOOL_489 1
+#define _GMP_BOOL_490 1
+#define _GMP_BOOL_491 1
+#define _GMP_BOOL_492 1
+#define _GMP_BOOL_493 1
+#define _GMP_BOOL_494 1
+#define _GMP_BOOL_495 1
+#define _GMP_BOOL_496 1
+#define _GMP_BOOL_497 1
+#define _GMP_BOOL_498 1
+#define _GMP_BOOL_499 1
+#define _GMP_BOOL_500 1
+#define _GMP_BOOL_501 1
+#define _GMP_BOOL_502 1
+#define _GMP_BOOL_503 1
+#define _GMP_BOOL_504 1
+#define _GMP_BOOL_505 1
+#define _GMP_BOOL_506 1
+#define _GMP_BOOL_507 1
+#define _GMP_BOOL_508 1
+#define _GMP_BOOL_509 1
+#define _GMP_BOOL_510 1
+#define _GMP_BOOL_511 1
+#define _GMP_BOOL_512 1
+#define _GMP_BOOL_513 1
+#define _GMP_BOOL_514 1
+#define _GMP_BOOL_515 1
+#define _GMP_BOOL_516 1
+#define _GMP_BOOL_517 1
+#define _GMP_BOOL_518 1
+#define _GMP_BOOL_519 1
+#define _GMP_BOOL_520 1
+#define _GMP_BOOL_521 1
+#define _GMP_BOOL_522 1
+#define _GMP_BOOL_523 1
+#define _GMP_BOOL_524 1
+#define _GMP_BOOL_525 1
+#define _GMP_BOOL_526 1
+#define _GMP_BOOL_527 1
+#define _GMP_BOOL_528 1
+#define _GMP_BOOL_529 1
+#define _GMP_BOOL_530 1
+#define _GMP_BOOL_531 1
+#define _GMP_BOOL_532 1
+#define _GMP_BOOL_533 1
+#define _GMP_BOOL_534 1
+#define _GMP_BOOL_535 1
+#define _GMP_BOOL_536 1
+#define _GMP_BOOL_537 1
+#define _GMP_BOOL_538 1
+#define _GMP_BOOL_539 1
+#define _GMP_BOOL_540 1
+#define _GMP_BOOL_541 1
+#define _GMP_BOOL_542 1
+#define _GMP_BOOL_543 1
+#define _GMP_BOOL_544 1
+#define _GMP_BOOL_545 1
+#define _GMP_BOOL_546 1
+#define _GMP_BOOL_547 1
+#define _GMP_BOOL_548 1
+#define _GMP_BOOL_549 1
+#define _GMP_BOOL_550 1
+#define _GMP_BOOL_551 1
+#define _GMP_BOOL_552 1
+#define _GMP_BOOL_553 1
+#define _GMP_BOOL_554 1
+#define _GMP_BOOL_555 1
+#define _GMP_BOOL_556 1
+#define _GMP_BOOL_557 1
+#define _GMP_BOOL_558 1
+#define _GMP_BOOL_559 1
+#define _GMP_BOOL_560 1
+#define _GMP_BOOL_561 1
+#define _GMP_BOOL_562 1
+#define _GMP_BOOL_563 1
+#define _GMP_BOOL_564 1
+#define _GMP_BOOL_565 1
+#define _GMP_BOOL_566 1
+#define _GMP_BOOL_567 1
+#define _GMP_BOOL_568 1
+#define _GMP_BOOL_569 1
+#define _GMP_BOOL_570 1
+#define _GMP_BOOL_571 1
+#define _GMP_BOOL_572 1
+#define _GMP_BOOL_573 1
+#define _GMP_BOOL_574 1
+#define _GMP_BOOL_575 1
+#define _GMP_BOOL_576 1
+#define _GMP_BOOL_577 1
+#define _GMP_BOOL_578 1
+#define _GMP_BOOL_579 1
+#define _GMP_BOOL_580 1
+#define _GMP_BOOL_581 1
+#define _GMP_BOOL_582 1
+#define _GMP_BOOL_583 1
+#define _GMP_BOOL_584 1
+#define _GMP_BOOL_585 1
+#define _GMP_BOOL_586 1
+#define _GMP_BOOL_587 1
+#define _GMP_BOOL_588 1
+#define _GMP_BOOL_589 1
+#define _GMP_BOOL_590 1
+#define _GMP_BOOL_591 1
+#define _GMP_BOOL_592 1
+#define _GMP_BOOL_593 1
+#define _GMP_BOOL_594 1
+#define _GMP_BOOL_595 1
+#define _GMP_BOOL_596 1
+#define _GMP_BOOL_597 1
+#define _GMP_BOOL_598 1
+#define _GMP_BOOL_599 1
+#define _GMP_BOOL_600 1
+#define _GMP_BOOL_601 1
+#define _GMP_BOOL_602 1
+#define _GMP_BOOL_603 1
+#define _GMP_BOOL_604 1
+#define _GMP_BOOL_605 1
+#define _GMP_BOOL_606 1
+#define _GMP_BOOL_607 1
+#define _GMP_BOOL_608 1
+#define _GMP_BOOL_609 1
+#define _GMP_BOOL_610 1
+#define _GMP_BOOL_611 1
+#define _GMP_BOOL_612 1
+#define _GMP_BOOL_613 1
+#define _GMP_BOOL_614 1
+#define _GMP_BOOL_615 1
+#define _GMP_BOOL_616 1
+#define _GMP_BOOL_617 1
+#define _GMP_BOOL_618 1
+#define _GMP_BOOL_619 1
+#define _GMP_BOOL_620 1
+#define _GMP_BOOL_621 1
+#define _GMP_BOOL_622 1
+#define _GMP_BOOL_623 1
+#define _GMP_BOOL_624 1
+#define _GMP_BOOL_625 1
+#define _GMP_BOOL_626 1
+#define _GMP_BOOL_627 1
+#define _GMP_BOOL_628 1
+#define _GMP_BOOL_629 1
+#define _GMP_BOOL_630 1
+#define _GMP_BOOL_631 1
+#define _GMP_BOOL_632 1
+#define _GMP_BOOL_633 1
+#define _GMP_BOOL_634 1
+#define _GMP_BOOL_635 1
+#define _GMP_BOOL_636 1
+#define _GMP_BOOL_637 1
+#define _GMP_BOOL_638 1
+#define _GMP_BOOL_639 1
+#define _GMP_BOOL_640 1
+#define _GMP_BOOL_641 1
+#define _GMP_BOOL_642 1
+#define _GMP_BOOL_643 1
+#define _GMP_BOOL_644 1
+#define _GMP_BOOL_645 1
+#define _GMP_BOOL_646 1
+#define _GMP_BOOL_647 1
+#define _GMP_BOOL_648 1
+#define _GMP_BOOL_649 1
+#define _GMP_BOOL_650 1
+#define _GMP_BOOL_651 1
+#define _GMP_BOOL_652 1
+#define _GMP_BOOL_653 1
+#define _GMP_BOOL_654 1
+#define _GMP_BOOL_655 1
+#define _GMP_BOOL_656 1
+#define _GMP_BOOL_657 1
+#define _GMP_BOOL_658 1
+#define _GMP_BOOL_659 1
+#define _GMP_BOOL_660 1
+#define _GMP_BOOL_661 1
+#define _GMP_BOOL_662 1
+#define _GMP_BOOL_663 1
+#define _GMP_BOOL_664 1
+#define _GMP_BOOL_665 1
+#define _GMP_BOOL_666 1
+#define _GMP_BOOL_667 1
+#define _GMP_BOOL_668 1
+#define _GMP_BOOL_669 1
+#define _GMP_BOOL_670 1
+#define _GMP_BOOL_671 1
+#define _GMP_BOOL_672 1
+#define _GMP_BOOL_673 1
+#define _GMP_BOOL_674 1
+#define _GMP_BOOL_675 1
+#define _GMP_BOOL_676 1
+#define _GMP_BOOL_677 1
+#define _GMP_BOOL_678 1
+#define _GMP_BOOL_679 1
+#define _GMP_BOOL_680 1
+#define _GMP_BOOL_681 1
+#define _GMP_BOOL_682 1
+#define _GMP_BOOL_683 1
+#define _GMP_BOOL_684 1
+#define _GMP_BOOL_685 1
+#define _GMP_BOOL_686 1
+#define _GMP_BOOL_687 1
+#define _GMP_BOOL_688 1
+#define _GMP_BOOL_689 1
+#define _GMP_BOOL_690 1
+#define _GMP_BOOL_691 1
+#define _GMP_BOOL_692 1
+#define _GMP_BOOL_693 1
+#define _GMP_BOOL_694 1
+#define _GMP_BOOL_695 1
+#define _GMP_BOOL_696 1
+#define _GMP_BOOL_697 1
+#define _GMP_BOOL_698 1
+#define _GMP_BOOL_699 1
+#define _GMP_BOOL_700 1
+#define _GMP_BOOL_701 1
+#define _GMP_BOOL_702 1
+#define _GMP_BOOL_703 1
+#define _GMP_BOOL_704 1
+#define _GMP_BOOL_705 1
+#define _GMP_BOOL_706 1
+#define _GMP_BOOL_707 1
+#define _GMP_BOOL_708 1
+#define _GMP_BOOL_709 1
+#define _GMP_BOOL_710 1
+#define _GMP_BOOL_711 1
+#define _GMP_BOOL_712 1
+#define _GMP_BOOL_713 1
+#define _GMP_BOOL_714 1
+#define _GMP_BOOL_715 1
+#define _GMP_BOOL_716 1
+#define _GMP_BOOL_717 1
+#define _GMP_BOOL_718 1
+#define _GMP_BOOL_719 1
+#define _GMP_BOOL_720 1
+#define _GMP_BOOL_721 1
+#define _GMP_BOOL_722 1
+#define _GMP_BOOL_723 1
+#define _GMP_BOOL_724 1
+#define _GMP_BOOL_725 1
+#define _GMP_BOOL_726 1
+#define _GMP_BOOL_727 1
+#define _GMP_BOOL_728 1
+#define _GMP_BOOL_729 1
+#define _GMP_BOOL_730 1
+#define _GMP_BOOL_731 1
+#define _GMP_BOOL_732 1
+#define _GMP_BOOL_733 1
+#define _GMP_BOOL_734 1
+#define _GMP_BOOL_735 1
+#define _GMP_BOOL_736 1
+#define _GMP_BOOL_737 1
+#define _GMP_BOOL_738 1
+#define _GMP_BOOL_739 1
+#define _GMP_BOOL_740 1
+#define _GMP_BOOL_741 1
+#define _GMP_BOOL_742 1
+#define _GMP_BOOL_743 1
+#define _GMP_BOOL_744 1
+#define _GMP_BOOL_745 1
+#define _GMP_BOOL_746 1
+#define _GMP_BOOL_747 1
+#define _GMP_BOOL_748 1
+#define _GMP_BOOL_749 1
+#define _GMP_BOOL_750 1
+#define _GMP_BOOL_751 1
+#define _GMP_BOOL_752 1
+#define _GMP_BOOL_753 1
+#define _GMP_BOOL_754 1
+#define _GMP_BOOL_755 1
+#define _GMP_BOOL_756 1
+#define _GMP_BOOL_757 1
+#define _GMP_BOOL_758 1
+#define _GMP_BOOL_759 1
+#define _GMP_BOOL_760 1
+#define _GMP_BOOL_761 1
+#define _GMP_BOOL_762 1
+#define _GMP_BOOL_763 1
+#define _GMP_BOOL_764 1
+#define _GMP_BOOL_765 1
+#define _GMP_BOOL_766 1
+#define _GMP_BOOL_767 1
+#define _GMP_BOOL_768 1
+#define _GMP_BOOL_769 1
+#define _GMP_BOOL_770 1
+#define _GMP_BOOL_771 1
+#define _GMP_BOOL_772 1
+#define _GMP_BOOL_773 1
+#define _GMP_BOOL_774 1
+#define _GMP_BOOL_775 1
+#define _GMP_BOOL_776 1
+#define _GMP_BOOL_777 1
+#define _GMP_BOOL_778 1
+#define _GMP_BOOL_779 1
+#define _GMP_BOOL_780 1
+#define _GMP_BOOL_781 1
+#define _GMP_BOOL_782 1
+#define _GMP_BOOL_783 1
+#define _GMP_BOOL_784 1
+#define _GMP_BOOL_785 1
+#define _GMP_BOOL_786 1
+#define _GMP_BOOL_787 1
+#define _GMP_BOOL_788 1
+#define _GMP_BOOL_789 1
+#define _GMP_BOOL_790 1
+#define _GMP_BOOL_791 1
+#define _GMP_BOOL_792 1
+#define _GMP_BOOL_793 1
+#define _GMP_BOOL_794 1
+#define _GMP_BOOL_795 1
+#define _GMP_BOOL_796 1
+#define _GMP_BOOL_797 1
+#define _GMP_BOOL_798 1
+#define _GMP_BOOL_799 1
+#define _GMP_BOOL_800 1
+#define _GMP_BOOL_801 1
+#define _GMP_BOOL_802 1
+#define _GMP_BOOL_803 1
+#define _GMP_BOOL_804 1
+#define _GMP_BOOL_805 1
+#define _GMP_BOOL_806 1
+#define _GMP_BOOL_807 1
+#define _GMP_BOOL_808 1
+#define _GMP_BOOL_809 1
+#define _GMP_BOOL_810 1
+#define _GMP_BOOL_811 1
+#define _GMP_BOOL_812 1
+#define _GMP_BOOL_813 1
+#define _GMP_BOOL_814 1
+#define _GMP_BOOL_815 1
+#define _GMP_BOOL_816 1
+#define _GMP_BOOL_817 1
+#define _GMP_BOOL_818 1
+#define _GMP_BOOL_819 1
+#define _GMP_BOOL_820 1
+#define _GMP_BOOL_821 1
+#define _GMP_BOOL_822 1
+#define _GMP_BOOL_823 1
+#define _GMP_BOOL_824 1
+#define _GMP_BOOL_825 1
+#define _GMP_BOOL_826 1
+#define _GMP_BOOL_827 1
+#define _GMP_BOOL_828 1
+#define _GMP_BOOL_829 1
+#define _GMP_BOOL_830 1
+#define _GMP_BOOL_831 1
+#define _GMP_BOOL_832 1
+#define _GMP_BOOL_833 1
+#define _GMP_BOOL_834 1
+#define _GMP_BOOL_835 1
+#define _GMP_BOOL_836 1
+#define _GMP_BOOL_837 1
+#define _GMP_BOOL_838 1
+#define _GMP_BOOL_839 1
+#define _GMP_BOOL_840 1
+#define _GMP_BOOL_841 1
+#define _GMP_BOOL_842 1
+#define _GMP_BOOL_843 1
+#define _GMP_BOOL_844 1
+#define _GMP_BOOL_845 1
+#define _GMP_BOOL_846 1
+#define _GMP_BOOL_847 1
+#define _GMP_BOOL_848 1
+#define _GMP_BOOL_849 1
+#define _GMP_BOOL_850 1
+#define _GMP_BOOL_851 1
+#define _GMP_BOOL_852 1
+#define _GMP_BOOL_853 1
+#define _GMP_BOOL_854 1
+#define _GMP_BOOL_855 1
+#define _GMP_BOOL_856 1
+#define _GMP_BOOL_857 1
+#define _GMP_BOOL_858 1
+#define _GMP_BOOL_859 1
+#define _GMP_BOOL_860 1
+#define _GMP_BOOL_861 1
+#define _GMP_BOOL_862 1
+#define _GMP_BOOL_863 1
+#define _GMP_BOOL_864 1
+#define _GMP_BOOL_865 1
+#define _GMP_BOOL_866 1
+#define _GMP_BOOL_867 1
+#define _GMP_BOOL_868 1
+#define _GMP_BOOL_869 1
+#define _GMP_BOOL_870 1
+#define _GMP_BOOL_871 1
+#define _GMP_BOOL_872 1
+#define _GMP_BOOL_873 1
+#define _GMP_BOOL_874 1
+#define _GMP_BOOL_875 1
+#define _GMP_BOOL_876 1
+#define _GMP_BOOL_877 1
+#define _GMP_BOOL_878 1
+#define _GMP_BOOL_879 1
+#define _GMP_BOOL_880 1
+#define _GMP_BOOL_881 1
+#define _GMP_BOOL_882 1
+#define _GMP_BOOL_883 1
+#define _GMP_BOOL_884 1
+#define _GMP_BOOL_885 1
+#define _GMP_BOOL_886 1
+#define _GMP_BOOL_887 1
+#define _GMP_BOOL_888 1
+#define _GMP_BOOL_889 1
+#define _GMP_BOOL_890 1
+#define _GMP_BOOL_891 1
+#define _GMP_BOOL_892 1
+#define _GMP_BOOL_893 1
+#define _GMP_BOOL_894 1
+#define _GMP_BOOL_895 1
+#define _GMP_BOOL_896 1
+#define _GMP_BOOL_897 1
+#define _GMP_BOOL_898 1
+#define _GMP_BOOL_899 1
+#define _GMP_BOOL_900 1
+#define _GMP_BOOL_901 1
+#define _GMP_BOOL_902 1
+#define _GMP_BOOL_903 1
+#define _GMP_BOOL_904 1
+#define _GMP_BOOL_905 1
+#define _GMP_BOOL_906 1
+#define _GMP_BOOL_907 1
+#define _GMP_BOOL_908 1
+#define _GMP_BOOL_909 1
+#define _GMP_BOOL_910 1
+#define _GMP_BOOL_911 1
+#define _GMP_BOOL_912 1
+#define _GMP_BOOL_913 1
+#define _GMP_BOOL_914 1
+#define _GMP_BOOL_915 1
+#define _GMP_BOOL_916 1
+#define _GMP_BOOL_917 1
+#define _GMP_BOOL_918 1
+#define _GMP_BOOL_919 1
+#define _GMP_BOOL_920 1
+#define _GMP_BOOL_921 1
+#define _GMP_BOOL_922 1
+#define _GMP_BOOL_923 1
+#define _GMP_BOOL_924 1
+#define _GMP_BOOL_925 1
+#define _GMP_BOOL_926 1
+#define _GMP_BOOL_927 1
+#define _GMP_BOOL_928 1
+#define _GMP_BOOL_929 1
+#define _GMP_BOOL_930 1
+#define _GMP_BOOL_931 1
+#define _GMP_BOOL_932 1
+#define _GMP_BOOL_933 1
+#define _GMP_BOOL_934 1
+#define _GMP_BOOL_935 1
+#define _GMP_BOOL_936 1
+#define _GMP_BOOL_937 1
+#define _GMP_BOOL_938 1
+#define _GMP_BOOL_939 1
+#define _GMP_BOOL_940 1
+#define _GMP_BOOL_941 1
+#define _GMP_BOOL_942 1
+#define _GMP_BOOL_943 1
+#define _GMP_BOOL_944 1
+#define _GMP_BOOL_945 1
+#define _GMP_BOOL_946 1
+#define _GMP_BOOL_947 1
+#define _GMP_BOOL_948 1
+#define _GMP_BOOL_949 1
+#define _GMP_BOOL_950 1
+#define _GMP_BOOL_951 1
+#define _GMP_BOOL_952 1
+#define _GMP_BOOL_953 1
+#define _GMP_BOOL_954 1
+#define _GMP_BOOL_955 1
+#define _GMP_BOOL_956 1
+#define _GMP_BOOL_957 1
+#define _GMP_BOOL_958 1
+#define _GMP_BOOL_959 1
+#define _GMP_BOOL_960 1
+#define _GMP_BOOL_961 1
+#define _GMP_BOOL_962 1
+#define _GMP_BOOL_963 1
+#define _GMP_BOOL_964 1
+#define _GMP_BOOL_965 1
+#define _GMP_BOOL_966 1
+#define _GMP_BOOL_967 1
+#define _GMP_BOOL_968 1
+#define _GMP_BOOL_969 1
+#define _GMP_BOOL_970 1
+#define _GMP_BOOL_971 1
+#define _GMP_BOOL_972 1
+#define _GMP_BOOL_973 1
+#define _GMP_BOOL_974 1
+#define _GMP_BOOL_975 1
+#define _GMP_BOOL_976 1
+#define _GMP_BOOL_977 1
+#define _GMP_BOOL_978 1
+#define _GMP_BOOL_979 1
+#define _GMP_BOOL_980 1
+#define _GMP_BOOL_981 1
+#define _GMP_BOOL_982 1
+#define _GMP_BOOL_983 1
+#define _GMP_BOOL_984 1
+#define _GMP_BOOL_985 1
+#define _GMP_BOOL_986 1
+#define _GMP_BOOL_987 1
+#define _GMP_BOOL_988 1
+#define _GMP_BOOL_989 1
+#define _GMP_BOOL_990 1
+#define _GMP_BOOL_991 1
+#define _GMP_BOOL_992 1
+#define _GMP_BOOL_993 1
+#define _GMP_BOOL_994 1
+#define _GMP_BOOL_995 1
+#define _GMP_BOOL_996 1
+#define _GMP_BOOL_997 1
+#define _GMP_BOOL_998 1
+#define _GMP_BOOL_999 1
+#define _GMP_BOOL_1000 1
+#define _GMP_BOOL_1001 1
+#define _GMP_BOOL_1002 1
+#define _GMP_BOOL_1003 1
+#define _GMP_BOOL_1004 1
+#define _GMP_BOOL_1005 1
+#define _GMP_BOOL_1006 1
+#define _GMP_BOOL_1007 1
+#define _GMP_BOOL_1008 1
+#define _GMP_BOOL_1009 1
+#define _GMP_BOOL_1010 1
+#define _GMP_BOOL_1011 1
+#define _GMP_BOOL_1012 1
+#define _GMP_BOOL_1013 1
+#define _GMP_BOOL_1014 1
+#define _GMP_BOOL_1015 1
+#define _GMP_BOOL_1016 1
+#define _GMP_BOOL_1017 1
+#define _GMP_BOOL_1018 1
+#define _GMP_BOOL_1019 1
+#define _GMP_BOOL_1020 1
+#define _GMP_BOOL_1021 1
+#define _GMP_BOOL_1022 1
+#define _GMP_BOOL_1023 1
+#define _GMP_BOOL_1024 1
+#define _GMP_BOOL_1025 1
+
+// GMP_CHECK_INDEX
+#define _GMP_CHECK_INDEX_0 ,
+#define _GMP_CHECK_INDEX_1 ,
+#define _GMP_CHECK_INDEX_2 ,
+#define _GMP_CHECK_INDEX_3 ,
+#define _GMP_CHECK_INDEX_4 ,
+#define _GMP_CHECK_INDEX_5 ,
+#define _GMP_CHECK_INDEX_6 ,
+#define _GMP_CHECK_INDEX_7 ,
+#define _GMP_CHECK_INDEX_8 ,
+#define _GMP_CHECK_INDEX_9 ,
+#define _GMP_CHECK_INDEX_10 ,
+#define _GMP_CHECK_INDEX_11 ,
+#define _GMP_CHECK_INDEX_12 ,
+#define _GMP_CHECK_INDEX_13 ,
+#define _GMP_CHECK_INDEX_14 ,
+#define _GMP_CHECK_INDEX_15 ,
+#define _GMP_CHECK_INDEX_16 ,
+#define _GMP_CHECK_INDEX_17 ,
+#define _GMP_CHECK_INDEX_18 ,
+#define _GMP_CHECK_INDEX_19 ,
+#define _GMP_CHECK_INDEX_20 ,
+#define _GMP_CHECK_INDEX_21 ,
+#define _GMP_CHECK_INDEX_22 ,
+#define _GMP_CHECK_INDEX_23 ,
+#define _GMP_CHECK_INDEX_24 ,
+#define _GMP_CHECK_INDEX_25 ,
+#define _GMP_CHECK_INDEX_26 ,
+#define _GMP_CHECK_INDEX_27 ,
+#define _GMP_CHECK_INDEX_28 ,
+#define _GMP_CHECK_INDEX_29 ,
+#define _GMP_CHECK_INDEX_30 ,
+#define _GMP_CHECK_INDEX_31 ,
+#define _GMP_CHECK_INDEX_32 ,
+#define _GMP_CHECK_INDEX_33 ,
+#define _GMP_CHECK_INDEX_34 ,
+#define _GMP_CHECK_INDEX_35 ,
+#define _GMP_CHECK_INDEX_36 ,
+#define _GMP_CHECK_INDEX_37 ,
+#define _GMP_CHECK_INDEX_38 ,
+#define _GMP_CHECK_INDEX_39 ,
+#define _GMP_CHECK_INDEX_40 ,
+#define _GMP_CHECK_INDEX_41 ,
+#define _GMP_CHECK_INDEX_42 ,
+#define _GMP_CHECK_INDEX_43 ,
+#define _GMP_CHECK_INDEX_44 ,
+#define _GMP_CHECK_INDEX_45 ,
+#define _GMP_CHECK_INDEX_46 ,
+#define _GMP_CHECK_INDEX_47 ,
+#define _GMP_CHECK_INDEX_48 ,
+#define _GMP_CHECK_INDEX_49 ,
+#define _GMP_CHECK_INDEX_50 ,
+#define _GMP_CHECK_INDEX_51 ,
+#define _GMP_CHECK_INDEX_52 ,
+#define _GMP_CHECK_INDEX_53 ,
+#define _GMP_CHECK_INDEX_54 ,
+#define _GMP_CHECK_INDEX_55 ,
+#define _GMP_CHECK_INDEX_56 ,
+#define _GMP_CHECK_INDEX_57 ,
+#define _GMP_CHECK_INDEX_58 ,
+#define _GMP_CHECK_INDEX_59 ,
+#define _GMP_CHECK_INDEX_60 ,
+#define _GMP_CHECK_INDEX_61 ,
+#define _GMP_CHECK_INDEX_62 ,
+#define _GMP_CHECK_INDEX_63 ,
+#define _GMP_CHECK_INDEX_64 ,
+#define _GMP_CHECK_INDEX_65 ,
+#define _GMP_CHECK_INDEX_66 ,
+#define _GMP_CHECK_INDEX_67 ,
+#define _GMP_CHECK_INDEX_68 ,
+#define _GMP_CHECK_INDEX_69 ,
+#define _GMP_CHECK_INDEX_70 ,
+#define _GMP_CHECK_INDEX_71 ,
+#define _GMP_CHECK_INDEX_72 ,
+#define _GMP_CHECK_INDEX_73 ,
+#define _GMP_CHECK_INDEX_74 ,
+#define _GMP_CHECK_INDEX_75 ,
+#define _GMP_CHECK_INDEX_76 ,
+#define _GMP_CHECK_INDEX_77 ,
+#define _GMP_CHECK_INDEX_78 ,
+#define _GMP_CHECK_INDEX_79 ,
+#define _GMP_CHECK_INDEX_80 ,
+#define _GMP_CHECK_INDEX_81 ,
+#define _GMP_CHECK_INDEX_82 ,
+#define _GMP_CHECK_INDEX_83 ,
+#define _GMP_CHECK_INDEX_84 ,
+#define _GMP_CHECK_INDEX_85 ,
+#define _GMP_CHECK_INDEX_86 ,
+#define _GMP_CHECK_INDEX_87 ,
+#define _GMP_CHECK_INDEX_88 ,
+#define _GMP_CHECK_INDEX_89 ,
+#define _GMP_CHECK_INDEX_90 ,
+#define _GMP_CHECK_INDEX_91 ,
+#define _GMP_CHECK_INDEX_92 ,
+#define _GMP_CHECK_INDEX_93 ,
+#define _GMP_CHECK_INDEX_94 ,
+#define _GMP_CHECK_INDEX_95 ,
+#define _GMP_CHECK_INDEX_96 ,
+#define _GMP_CHECK_INDEX_97 ,
+#define _GMP_CHECK_INDEX_98 ,
+#define _GMP_CHECK_INDEX_99 ,
+#define _GMP_CHECK_INDEX_100 ,
+#define _GMP_CHECK_INDEX_101 ,
+#define _GMP_CHECK_INDEX_102 ,
+#define _GMP_CHECK_INDEX_103 ,
+#define _GMP_CHECK_INDEX_104 ,
+#define _GMP_CHECK_INDEX_105 ,
+#define _GMP_CHECK_INDEX_106 ,
+#define _GMP_CHECK_INDEX_107 ,
+#define _GMP_CHECK_INDEX_108 ,
+#define _GMP_CHECK_INDEX_109 ,
+#define _GMP_CHECK_INDEX_110 ,
+#define _GMP_CHECK_INDEX_111 ,
+#define _GMP_CHECK_INDEX_112 ,
+#define _GMP_CHECK_INDEX_113 ,
+#define _GMP_CHECK_INDEX_114 ,
+#define _GMP_CHECK_INDEX_115 ,
+#define _GMP_CHECK_INDEX_116 ,
+#define _GMP_CHECK_INDEX_117 ,
+#define _GMP_CHECK_INDEX_118 ,
+#define _GMP_CHECK_INDEX_119 ,
+#define _GMP_CHECK_INDEX_120 ,
+#define _GMP_CHECK_INDEX_121 ,
+#define _GMP_CHECK_INDEX_122 ,
+#define _GMP_CHECK_INDEX_123 ,
+#define _GMP_CHECK_INDEX_124 ,
+#define _GMP_CHECK_INDEX_125 ,
+#define _GMP_CHECK_INDEX_126 ,
+#define _GMP_CHECK_INDEX_127 ,
+#define _GMP_CHECK_INDEX_128 ,
+#define _GMP_CHECK_INDEX_129 ,
+#define _GMP_CHECK_INDEX_130 ,
+#define _GMP_CHECK_INDEX_131 ,
+#define _GMP_CHECK_INDEX_132 ,
+#define _GMP_CHECK_INDEX_133 ,
+#define _GMP_CHECK_INDEX_134 ,
+#define _GMP_CHECK_INDEX_135 ,
+#define _GMP_CHECK_INDEX_136 ,
+#define _GMP_CHECK_INDEX_137 ,
+#define _GMP_CHECK_INDEX_138 ,
+#define _GMP_CHECK_INDEX_139 ,
+#define _GMP_CHECK_INDEX_140 ,
+#define _GMP_CHECK_INDEX_141 ,
+#define _GMP_CHECK_INDEX_142 ,
+#define _GMP_CHECK_INDEX_143 ,
+#define _GMP_CHECK_INDEX_144 ,
+#define _GMP_CHECK_INDEX_145 ,
+#define _GMP_CHECK_INDEX_146 ,
+#define _GMP_CHECK_INDEX_147 ,
+#define _GMP_CHECK_INDEX_148 ,
+#define _GMP_CHECK_INDEX_149 ,
+#define _GMP_CHECK_INDEX_150 ,
+#define _GMP_CHECK_INDEX_151 ,
+#define _GMP_CHECK_INDEX_152 ,
+#define _GMP_CHECK_INDEX_153 ,
+#define _GMP_CHECK_INDEX_154 ,
+#define _GMP_CHECK_INDEX_155 ,
+#define _GMP_CHECK_INDEX_156 ,
+#define _GMP_CHECK_INDEX_157 ,
+#define _GMP_CHECK_INDEX_158 ,
+#define _GMP_CHECK_INDEX_159 ,
+#define _GMP_CHECK_INDEX_160 ,
+#define _GMP_CHECK_INDEX_161 ,
+#define _GMP_CHECK_INDEX_162 ,
+#define _GMP_CHECK_INDEX_163 ,
+#define _GMP_CHECK_INDEX_164 ,
+#define _GMP_CHECK_INDEX_165 ,
+#define _GMP_CHECK_INDEX_166 ,
+#define _GMP_CHECK_INDEX_167 ,
+#define _GMP_CHECK_INDEX_168 ,
+#define _GMP_CHECK_INDEX_169 ,
+#define _GMP_CHECK_INDEX_170 ,
+#define _GMP_CHECK_INDEX_171 ,
+#define _GMP_CHECK_INDEX_172 ,
+#define _GMP_CHECK_INDEX_173 ,
+#define _GMP_CHECK_INDEX_174 ,
+#define _GMP_CHECK_INDEX_175 ,
+#define _GMP_CHECK_INDEX_176 ,
+#define _GMP_CHECK_INDEX_177 ,
+#define _GMP_CHECK_INDEX_178 ,
+#define _GMP_CHECK_INDEX_179 ,
+#define _GMP_CHECK_INDEX_180 ,
+#define _GMP_CHECK_INDEX_181 ,
+#define _GMP_CHECK_INDEX_182 ,
+#define _GMP_CHECK_INDEX_183 ,
+#define _GMP_CHECK_INDEX_184 ,
+#define _GMP_CHECK_INDEX_185 ,
+#define _GMP_CHECK_INDEX_186 ,
+#define _GMP_CHECK_INDEX_187 ,
+#define _GMP_CHECK_INDEX_188 ,
+#define _GMP_CHECK_INDEX_189 ,
+#define _GMP_CHECK_INDEX_190 ,
+#define _GMP_CHECK_INDEX_191 ,
+#define _GMP_CHECK_INDEX_192 ,
+#define _GMP_CHECK_INDEX_193 ,
+#define _GMP_CHECK_INDEX_194 ,
+#define _GMP_CHECK_INDEX_195 ,
+#define _GMP_CHECK_INDEX_196 ,
+#define _GMP_CHECK_INDEX_197 ,
+#define _GMP_CHECK_INDEX_198 ,
+#define _GMP_CHECK_INDEX_199 ,
+#define _GMP_CHECK_INDEX_200 ,
+#define _GMP_CHECK_INDEX_201 ,
+#define _GMP_CHECK_INDEX_202 ,
+#define _GMP_CHECK_INDEX_203 ,
+#define _GMP_CHECK_INDEX_204 ,
+#define _GMP_CHECK_INDEX_205 ,
+#define _GMP_CHECK_INDEX_206 ,
+#define _GMP_CHECK_INDEX_207 ,
+#define _GMP_CHECK_INDEX_208 ,
+#define _GMP_CHECK_INDEX_209 ,
+#define _GMP_CHECK_INDEX_210 ,
+#define _GMP_CHECK_INDEX_211 ,
+#define _GMP_CHECK_INDEX_212 ,
+#define _GMP_CHECK_INDEX_213 ,
+#define _GMP_CHECK_INDEX_214 ,
+#define _GMP_CHECK_INDEX_215 ,
+#define _GMP_CHECK_INDEX_216 ,
+#define _GMP_CHECK_INDEX_217 ,
+#define _GMP_CHECK_INDEX_218 ,
+#define _GMP_CHECK_INDEX_219 ,
+#define _GMP_CHECK_INDEX_220 ,
+#define _GMP_CHECK_INDEX_221 ,
+#define _GMP_CHECK_INDEX_222 ,
+#define _GMP_CHECK_INDEX_223 ,
+#define _GMP_CHECK_INDEX_224 ,
+#define _GMP_CHECK_INDEX_225 ,
+#define _GMP_CHECK_INDEX_226 ,
+#define _GMP_CHECK_INDEX_227 ,
+#define _GMP_CHECK_INDEX_228 ,
+#define _GMP_CHECK_INDEX_229 ,
+#define _GMP_CHECK_INDEX_230 ,
+#define _GMP_CHECK_INDEX_231 ,
+#define _GMP_CHECK_INDEX_232 ,
+#define _GMP_CHECK_INDEX_233 ,
+#define _GMP_CHECK_INDEX_234 ,
+#define _GMP_CHECK_INDEX_235 ,
+#define _GMP_CHECK_INDEX_236 ,
+#define _GMP_CHECK_INDEX_237 ,
+#define _GMP_CHECK_INDEX_238 ,
+#define _GMP_CHECK_INDEX_239 ,
+#define _GMP_CHECK_INDEX_240 ,
+#define _GMP_CHECK_INDEX_241 ,
+#define _GMP_CHECK_INDEX_242 ,
+#define _GMP_CHECK_INDEX_243 ,
+#define _GMP_CHECK_INDEX_244 ,
+#define _GMP_CHECK_INDEX_245 ,
+#define _GMP_CHECK_INDEX_246 ,
+#define _GMP_CHECK_INDEX_247 ,
+#define _GMP_CHECK_INDEX_248 ,
+#define _GMP_CHECK_INDEX_249 ,
+#define _GMP_CHECK_INDEX_250 ,
+#define _GMP_CHECK_INDEX_251 ,
+#define _GMP_CHECK_INDEX_252 ,
+#define _GMP_CHECK_INDEX_253 ,
+#define _GMP_CHECK_INDEX_254 ,
+#define _GMP_CHECK_INDEX_255 ,
+#define _GMP_CHECK_INDEX_256 ,
+#define _GMP_CHECK_INDEX_257 ,
+#define _GMP_CHECK_INDEX_258 ,
+#define _GMP_CHECK_INDEX_259 ,
+#define _GMP_CHECK_INDEX_260 ,
+#define _GMP_CHECK_INDEX_261 ,
+#define _GMP_CHECK_INDEX_262 ,
+#define _GMP_CHECK_INDEX_263 ,
+#define _GMP_CHECK_INDEX_264 ,
+#define _GMP_CHECK_INDEX_265 ,
+#define _GMP_CHECK_INDEX_266 ,
+#define _GMP_CHECK_INDEX_267 ,
+#define _GMP_CHECK_INDEX_268 ,
+#define _GMP_CHECK_INDEX_269 ,
+#define _GMP_CHECK_INDEX_270 ,
+#define _GMP_CHECK_INDEX_271 ,
+#define _GMP_CHECK_INDEX_272 ,
+#define _GMP_CHECK_INDEX_273 ,
+#define _GMP_CHECK_INDEX_274 ,
+#define _GMP_CHECK_INDEX_275 ,
+#define _GMP_CHECK_INDEX_276 ,
+#define _GMP_CHECK_INDEX_277 ,
+#define _GMP_CHECK_INDEX_278 ,
+#define _GMP_CHECK_INDEX_279 ,
+#define _GMP_CHECK_INDEX_280 ,
+#define _GMP_CHECK_INDEX_281 ,
+#define _GMP_CHECK_INDEX_282 ,
+#define _GMP_CHECK_INDEX_283 ,
+#define _GMP_CHECK_INDEX_284 ,
+#define _GMP_CHECK_INDEX_285 ,
+#define _GMP_CHECK_INDEX_286 ,
+#define _GMP_CHECK_INDEX_287 ,
+#define _GMP_CHECK_INDEX_288 ,
+#define _GMP_CHECK_INDEX_289 ,
+#define _GMP_CHECK_INDEX_290 ,
+#define _GMP_CHECK_INDEX_291 ,
+#define _GMP_CHECK_INDEX_292 ,
+#define _GMP_CHECK_INDEX_293 ,
+#define _GMP_CHECK_INDEX_294 ,
+#define _GMP_CHECK_INDEX_295 ,
+#define _GMP_CHECK_INDEX_296 ,
+#define _GMP_CHECK_INDEX_297 ,
+#define _GMP_CHECK_INDEX_298 ,
+#define _GMP_CHECK_INDEX_299 ,
+#define _GMP_CHECK_INDEX_300 ,
+#define _GMP_CHECK_INDEX_301 ,
+#define _GMP_CHECK_INDEX_302 ,
+#define _GMP_CHECK_INDEX_303 ,
+#define _GMP_CHECK_INDEX_304 ,
+#define _GMP_CHECK_INDEX_305 ,
+#define _GMP_CHECK_INDEX_306 ,
+#define _GMP_CHECK_INDEX_307 ,
+#define _GMP_CHECK_INDEX_308 ,
+#define _GMP_CHECK_INDEX_309 ,
+#define _GMP_CHECK_INDEX_310 ,
+#define _GMP_CHECK_INDEX_311 ,
+#define _GMP_CHECK_INDEX_312 ,
+#define _GMP_CHECK_INDEX_313 ,
+#define _GMP_CHECK_INDEX_314 ,
+#define _GMP_CHECK_INDEX_315 ,
+#define _GMP_CHECK_INDEX_316 ,
+#define _GMP_CHECK_INDEX_317 ,
+#define _GMP_CHECK_INDEX_318 ,
+#define _GMP_CHECK_INDEX_319 ,
+#define _GMP_CHECK_INDEX_320 ,
+#define _GMP_CHECK_INDEX_321 ,
+#define _GMP_CHECK_INDEX_322 ,
+#define _GMP_CHECK_INDEX_323 ,
+#define _GMP_CHECK_INDEX_324 ,
+#define _GMP_CHECK_INDEX_325 ,
+#define _GMP_CHECK_INDEX_326 ,
+#define _GMP_CHECK_INDEX_327 ,
+#define _GMP_CHECK_INDEX_328 ,
+#define _GMP_CHECK_INDEX_329 ,
+#define _GMP_CHECK_INDEX_330 ,
+#define _GMP_CHECK_INDEX_331 ,
+#define _GMP_CHECK_INDEX_332 ,
+#define _GMP_CHECK_INDEX_333 ,
+#define _GMP_CHECK_INDEX_334 ,
+#define _GMP_CHECK_INDEX_335 ,
+#define _GMP_CHECK_INDEX_336 ,
+#define _GMP_CHECK_INDEX_337 ,
+#define _GMP_CHECK_INDEX_338 ,
+#define _GMP_CHECK_INDEX_339 ,
+#define _GMP_CHECK_INDEX_340 ,
+#define _GMP_CHECK_INDEX_341 ,
+#define _GMP_CHECK_INDEX_342 ,
+#define _GMP_CHECK_INDEX_343 ,
+#define _GMP_CHECK_INDEX_344 ,
+#define _GMP_CHECK_INDEX_345 ,
+#define _GMP_CHECK_INDEX_346 ,
+#define _GMP_CHECK_INDEX_347 ,
+#define _GMP_CHECK_INDEX_348 ,
+#define _GMP_CHECK_INDEX_349 ,
+#define _GMP_CHECK_INDEX_350 ,
+#define _GMP_CHECK_INDEX_351 ,
+#define _GMP_CHECK_INDEX_352 ,
+#define _GMP_CHECK_INDEX_353 ,
+#define _GMP_CHECK_INDEX_354 ,
+#define _GMP_CHECK_INDEX_355 ,
+#define _GMP_CHECK_INDEX_356 ,
+#define _GMP_CHECK_INDEX_357 ,
+#define _GMP_CHECK_INDEX_358 ,
+#define _GMP_CHECK_INDEX_359 ,
+#define _GMP_CHECK_INDEX_360 ,
+#define _GMP_CHECK_INDEX_361 ,
+#define _GMP_CHECK_INDEX_362 ,
+#define _GMP_CHECK_INDEX_363 ,
+#define _GMP_CHECK_INDEX_364 ,
+#define _GMP_CHECK_INDEX_365 ,
+#define _GMP_CHECK_INDEX_366 ,
+#define _GMP_CHECK_INDEX_367 ,
+#define _GMP_CHECK_INDEX_368 ,
+#define _GMP_CHECK_INDEX_369 ,
+#define _GMP_CHECK_INDEX_370 ,
+#define _GMP_CHECK_INDEX_371 ,
+#define _GMP_CHECK_INDEX_372 ,
+#define _GMP_CHECK_INDEX_373 ,
+#define _GMP_CHECK_INDEX_374 ,
+#define _GMP_CHECK_INDEX_375 ,
+#define _GMP_CHECK_INDEX_376 ,
+#define _GMP_CHECK_INDEX_377 ,
+#define _GMP_CHECK_INDEX_378 ,
+#define _GMP_CHECK_INDEX_379 ,
+#define _GMP_CHECK_INDEX_380 ,
+#define _GMP_CHECK_INDEX_381 ,
+#define _GMP_CHECK_INDEX_382 ,
+#define _GMP_CHECK_INDEX_383 ,
+#define _GMP_CHECK_INDEX_384 ,
+#define _GMP_CHECK_INDEX_385 ,
+#define _GMP_CHECK_INDEX_386 ,
+#define _GMP_CHECK_INDEX_387 ,
+#define _GMP_CHECK_INDEX_388 ,
+#define _GMP_CHECK_INDEX_389 ,
+#define _GMP_CHECK_INDEX_390 ,
+#define _GMP_CHECK_INDEX_391 ,
+#define _GMP_CHECK_INDEX_392 ,
+#define _GMP_CHECK_INDEX_393 ,
+#define _GMP_CHECK_INDEX_394 ,
+#define _GMP_CHECK_INDEX_395 ,
+#define _GMP_CHECK_INDEX_396 ,
+#define _GMP_CHECK_INDEX_397 ,
+#define _GMP_CHECK_INDEX_398 ,
+#define _GMP_CHECK_INDEX_399 ,
+#define _GMP_CHECK_INDEX_400 ,
+#define _GMP_CHECK_INDEX_401 ,
+#define _GMP_CHECK_INDEX_402 ,
+#define _GMP_CHECK_INDEX_403 ,
+#define _GMP_CHECK_INDEX_404 ,
+#define _GMP_CHECK_INDEX_405 ,
+#define _GMP_CHECK_INDEX_406 ,
+#define _GMP_CHECK_INDEX_407 ,
+#define _GMP_CHECK_INDEX_408 ,
+#define _GMP_CHECK_INDEX_409 ,
+#define _GMP_CHECK_INDEX_410 ,
+#define _GMP_CHECK_INDEX_411 ,
+#define _GMP_CHECK_INDEX_412 ,
+#define _GMP_CHECK_INDEX_413 ,
+#define _GMP_CHECK_INDEX_414 ,
+#define _GMP_CHECK_INDEX_415 ,
+#define _GMP_CHECK_INDEX_416 ,
+#define _GMP_CHECK_INDEX_417 ,
+#define _GMP_CHECK_INDEX_418 ,
+#define _GMP_CHECK_INDEX_419 ,
+#define _GMP_CHECK_INDEX_420 ,
+#define _GMP_CHECK_INDEX_421 ,
+#define _GMP_CHECK_INDEX_422 ,
+#define _GMP_CHECK_INDEX_423 ,
+#define _GMP_CHECK_INDEX_424 ,
+#define _GMP_CHECK_INDEX_425 ,
+#define _GMP_CHECK_INDEX_426 ,
+#define _GMP_CHECK_INDEX_427 ,
+#define _GMP_CHECK_INDEX_428 ,
+#define _GMP_CHECK_INDEX_429 ,
+#define _GMP_CHECK_INDEX_430 ,
+#define _GMP_CHECK_INDEX_431 ,
+#define _GMP_CHECK_INDEX_432 ,
+#define _GMP_CHECK_INDEX_433 ,
+#define _GMP_CHECK_INDEX_434 ,
+#define _GMP_CHECK_INDEX_435 ,
+#define _GMP_CHECK_INDEX_436 ,
+#define _GMP_CHECK_INDEX_437 ,
+#define _GMP_CHECK_INDEX_438 ,
+#define _GMP_CHECK_INDEX_439 ,
+#define _GMP_CHECK_INDEX_440 ,
+#define _GMP_CHECK_INDEX_441 ,
+#define _GMP_CHECK_INDEX_442 ,
+#define _GMP_CHECK_INDEX_443 ,
+#define _GMP_CHECK_INDEX_444 ,
+#define _GMP_CHECK_INDEX_445 ,
+#define _GMP_CHECK_INDEX_446 ,
+#define _GMP_CHECK_INDEX_447 ,
+#define _GMP_CHECK_INDEX_448 ,
+#define _GMP_CHECK_INDEX_449 ,
+#define _GMP_CHECK_INDEX_450 ,
+#define _GMP_CHECK_INDEX_451 ,
+#define _GMP_CHECK_INDEX_452 ,
+#define _GMP_CHECK_INDEX_453 ,
+#define _GMP_CHECK_INDEX_454 ,
+#define _GMP_CHECK_INDEX_455 ,
+#define _GMP_CHECK_INDEX_456 ,
+#define _GMP_CHECK_INDEX_457 ,
+#define _GMP_CHECK_INDEX_458 ,
+#define _GMP_CHECK_INDEX_459 ,
+#define _GMP_CHECK_INDEX_460 ,
+#define _GMP_CHECK_INDEX_461 ,
+#define _GMP_CHECK_INDEX_462 ,
+#define _GMP_CHECK_INDEX_463 ,
+#define _GMP_CHECK_INDEX_464 ,
+#define _GMP_CHECK_INDEX_465 ,
+#define _GMP_CHECK_INDEX_466 ,
+#define _GMP_CHECK_INDEX_467 ,
+#define _GMP_CHECK_INDEX_468 ,
+#define _GMP_CHECK_INDEX_469 ,
+#define _GMP_CHECK_INDEX_470 ,
+#define _GMP_CHECK_INDEX_471 ,
+#define _GMP_CHECK_INDEX_472 ,
+#define _GMP_CHECK_INDEX_473 ,
+#define _GMP_CHECK_INDEX_474 ,
+#define _GMP_CHECK_INDEX_475 ,
+#define _GMP_CHECK_INDEX_476 ,
+#define _GMP_CHECK_INDEX_477 ,
+#define _GMP_CHECK_INDEX_478 ,
+#define _GMP_CHECK_INDEX_479 ,
+#define _GMP_CHECK_INDEX_480 ,
+#define _GMP_CHECK_INDEX_481 ,
+#define _GMP_CHECK_INDEX_482 ,
+#define _GMP_CHECK_INDEX_483 ,
+#define _GMP_CHECK_INDEX_484 ,
+#define _GMP_CHECK_INDEX_485 ,
+#define _GMP_CHECK_INDEX_486 ,
+#define _GMP_CHECK_INDEX_487 ,
+#define _GMP_CHECK_INDEX_488 ,
+#define _GMP_CHECK_INDEX_489 ,
+#define _GMP_CHECK_INDEX_490 ,
+#define _GMP_CHECK_INDEX_491 ,
+#define _GMP_CHECK_INDEX_492 ,
+#define _GMP_CHECK_INDEX_493 ,
+#define _GMP_CHECK_INDEX_494 ,
+#define _GMP_CHECK_INDEX_495 ,
+#define _GMP_CHECK_INDEX_496 ,
+#define _GMP_CHECK_INDEX_497 ,
+#define _GMP_CHECK_INDEX_498 ,
+#define _GMP_CHECK_INDEX_499 ,
+#define _GMP_CHECK_INDEX_500 ,
+#define _GMP_CHECK_INDEX_501 ,
+#define _GMP_CHECK_INDEX_502 ,
+#define _GMP_CHECK_INDEX_503 ,
+#define _GMP_CHECK_INDEX_504 ,
+#define _GMP_CHECK_INDEX_505 ,
+#define _GMP_CHECK_INDEX_506 ,
+#define _GMP_CHECK_INDEX_507 ,
+#define _GMP_CHECK_INDEX_508 ,
+#define _GMP_CHECK_INDEX_509 ,
+#define _GMP_CHECK_INDEX_510 ,
+#define _GMP_CHECK_INDEX_511 ,
+#define _GMP_CHECK_INDEX_512 ,
+#define _GMP_CHECK_INDEX_513 ,
+#define _GMP_CHECK_INDEX_514 ,
+#define _GMP_CHECK_INDEX_515 ,
+#define _GMP_CHECK_INDEX_516 ,
+#define _GMP_CHECK_INDEX_517 ,
+#define _GMP_CHECK_INDEX_518 ,
+#define _GMP_CHECK_INDEX_519 ,
+#define _GMP_CHECK_INDEX_520 ,
+#define _GMP_CHECK_INDEX_521 ,
+#define _GMP_CHECK_INDEX_522 ,
+#define _GMP_CHECK_INDEX_523 ,
+#define _GMP_CHECK_INDEX_524 ,
+#define _GMP_CHECK_INDEX_525 ,
+#define _GMP_CHECK_INDEX_526 ,
+#define _GMP_CHECK_INDEX_527 ,
+#define _GMP_CHECK_INDEX_528 ,
+#define _GMP_CHECK_INDEX_529 ,
+#define _GMP_CHECK_INDEX_530 ,
+#define _GMP_CHECK_INDEX_531 ,
+#define _GMP_CHECK_INDEX_532 ,
+#define _GMP_CHECK_INDEX_533 ,
+#define _GMP_CHECK_INDEX_534 ,
+#define _GMP_CHECK_INDEX_535 ,
+#define _GMP_CHECK_INDEX_536 ,
+#define _GMP_CHECK_INDEX_537 ,
+#define _GMP_CHECK_INDEX_538 ,
+#define _GMP_CHECK_INDEX_539 ,
+#define _GMP_CHECK_INDEX_540 ,
+#define _GMP_CHECK_INDEX_541 ,
+#define _GMP_CHECK_INDEX_542 ,
+#define _GMP_CHECK_INDEX_543 ,
+#define _GMP_CHECK_INDEX_544 ,
+#define _GMP_CHECK_INDEX_545 ,
+#define _GMP_CHECK_INDEX_546 ,
+#define _GMP_CHECK_INDEX_547 ,
+#define _GMP_CHECK_INDEX_548 ,
+#define _GMP_CHECK_INDEX_549 ,
+#define _GMP_CHECK_INDEX_550 ,
+#define _GMP_CHECK_INDEX_551 ,
+#define _GMP_CHECK_INDEX_552 ,
+#define _GMP_CHECK_INDEX_553 ,
+#define _GMP_CHECK_INDEX_554 ,
+#define _GMP_CHECK_INDEX_555 ,
+#define _GMP_CHECK_INDEX_556 ,
+#define _GMP_CHECK_INDEX_557 ,
+#define _GMP_CHECK_INDEX_558 ,
+#define _GMP_CHECK_INDEX_559 ,
+#define _GMP_CHECK_INDEX_560 ,
+#define _GMP_CHECK_INDEX_561 ,
+#define _GMP_CHECK_INDEX_562 ,
+#define _GMP_CHECK_INDEX_563 ,
+#define _GMP_CHECK_INDEX_564 ,
+#define _GMP_CHECK_INDEX_565 ,
+#define _GMP_CHECK_INDEX_566 ,
+#define _GMP_CHECK_INDEX_567 ,
+#define _GMP_CHECK_INDEX_568 ,
+#define _GMP_CHECK_INDEX_569 ,
+#define _GMP_CHECK_INDEX_570 ,
+#define _GMP_CHECK_INDEX_571 ,
+#define _GMP_CHECK_INDEX_572 ,
+#define _GMP_CHECK_INDEX_573 ,
+#define _GMP_CHECK_INDEX_574 ,
+#define _GMP_CHECK_INDEX_575 ,
+#define _GMP_CHECK_INDEX_576 ,
+#define _GMP_CHECK_INDEX_577 ,
+#define _GMP_CHECK_INDEX_578 ,
+#define _GMP_CHECK_INDEX_579 ,
+#define _GMP_CHECK_INDEX_580 ,
+#define _GMP_CHECK_INDEX_581 ,
+#define _GMP_CHECK_INDEX_582 ,
+#define _GMP_CHECK_INDEX_583 ,
+#define _GMP_CHECK_INDEX_584 ,
+#define _GMP_CHECK_INDEX_585 ,
+#define _GMP_CHECK_INDEX_586 ,
+#define _GMP_CHECK_INDEX_587 ,
+#define _GMP_CHECK_INDEX_588 ,
+#define _GMP_CHECK_INDEX_589 ,
+#define _GMP_CHECK_INDEX_590 ,
+#define _GMP_CHECK_INDEX_591 ,
+#define _GMP_CHECK_INDEX_592 ,
+#define _GMP_CHECK_INDEX_593 ,
+#define _GMP_CHECK_INDEX_594 ,
+#define _GMP_CHECK_INDEX_595 ,
+#define _GMP_CHECK_INDEX_596 ,
+#define _GMP_CHECK_INDEX_597 ,
+#define _GMP_CHECK_INDEX_598 ,
+#define _GMP_CHECK_INDEX_599 ,
+#define _GMP_CHECK_INDEX_600 ,
+#define _GMP_CHECK_INDEX_601 ,
+#define _GMP_CHECK_INDEX_602 ,
+#define _GMP_CHECK_INDEX_603 ,
+#define _GMP_CHECK_INDEX_604 ,
+#define _GMP_CHECK_INDEX_605 ,
+#define _GMP_CHECK_INDEX_606 ,
+#define _GMP_CHECK_INDEX_607 ,
+#define _GMP_CHECK_INDEX_608 ,
+#define _GMP_CHECK_INDEX_609 ,
+#define _GMP_CHECK_INDEX_610 ,
+#define _GMP_CHECK_INDEX_611 ,
+#define _GMP_CHECK_INDEX_612 ,
+#define _GMP_CHECK_INDEX_613 ,
+#define _GMP_CHECK_INDEX_614 ,
+#define _GMP_CHECK_INDEX_615 ,
+#define _GMP_CHECK_INDEX_616 ,
+#define _GMP_CHECK_INDEX_617 ,
+#define _GMP_CHECK_INDEX_618 ,
+#define _GMP_CHECK_INDEX_619 ,
+#define _GMP_CHECK_INDEX_620 ,
+#define _GMP_CHECK_INDEX_621 ,
+#define _GMP_CHECK_INDEX_622 ,
+#define _GMP_CHECK_INDEX_623 ,
+#define _GMP_CHECK_INDEX_624 ,
+#define _GMP_CHECK_INDEX_625 ,
+#define _GMP_CHECK_INDEX_626 ,
+#define _GMP_CHECK_INDEX_627 ,
+#define _GMP_CHECK_INDEX_628 ,
+#define _GMP_CHECK_INDEX_629 ,
+#define _GMP_CHECK_INDEX_630 ,
+#define _GMP_CHECK_INDEX_631 ,
+#define _GMP_CHECK_INDEX_632 ,
+#define _GMP_CHECK_INDEX_633 ,
+#define _GMP_CHECK_INDEX_634 ,
+#define _GMP_CHECK_INDEX_635 ,
+#define _GMP_CHECK_INDEX_636 ,
+#define _GMP_CHECK_INDEX_637 ,
+#define _GMP_CHECK_INDEX_638 ,
+#define _GMP_CHECK_INDEX_639 ,
+#define _GMP_CHECK_INDEX_640 ,
+#define _GMP_CHECK_INDEX_641 ,
+#define _GMP_CHECK_INDEX_642 ,
+#define _GMP_CHECK_INDEX_643 ,
+#define _GMP_CHECK_INDEX_644 ,
+#define _GMP_CHECK_INDEX_645 ,
+#define _GMP_CHECK_INDEX_646 ,
+#define _GMP_CHECK_INDEX_647 ,
+#define _GMP_CHECK_INDEX_648 ,
+#define _GMP_CHECK_INDEX_649 ,
+#define _GMP_CHECK_INDEX_650 ,
+#define _GMP_CHECK_INDEX_651 ,
+#define _GMP_CHECK_INDEX_652 ,
+#define _GMP_CHECK_INDEX_653 ,
+#define _GMP_CHECK_INDEX_654 ,
+#define _GMP_CHECK_INDEX_655 ,
+#define _GMP_CHECK_INDEX_656 ,
+#define _GMP_CHECK_INDEX_657 ,
+#define _GMP_CHECK_INDEX_658 ,
+#define _GMP_CHECK_INDEX_659 ,
+#define _GMP_CHECK_INDEX_660 ,
+#define _GMP_CHECK_INDEX_661 ,
+#define _GMP_CHECK_INDEX_662 ,
+#define _GMP_CHECK_INDEX_663 ,
+#define _GMP_CHECK_INDEX_664 ,
+#define _GMP_CHECK_INDEX_665 ,
+#define _GMP_CHECK_INDEX_666 ,
+#define _GMP_CHECK_INDEX_667 ,
+#define _GMP_CHECK_INDEX_668 ,
+#define _GMP_CHECK_INDEX_669 ,
+#define _GMP_CHECK_INDEX_670 ,
+#define _GMP_CHECK_INDEX_671 ,
+#define _GMP_CHECK_INDEX_672 ,
+#define _GMP_CHECK_INDEX_673 ,
+#define _GMP_CHECK_INDEX_674 ,
+#define _GMP_CHECK_INDEX_675 ,
+#define _GMP_CHECK_INDEX_676 ,
+#define _GMP_CHECK_INDEX_677 ,
+#define _GMP_CHECK_INDEX_678 ,
+#define _GMP_CHECK_INDEX_679 ,
+#define _GMP_CHECK_INDEX_680 ,
+#define _GMP_CHECK_INDEX_681 ,
+#define _GMP_CHECK_INDEX_682 ,
+#define _GMP_CHECK_INDEX_683 ,
+#define _GMP_CHECK_INDEX_684 ,
+#define _GMP_CHECK_INDEX_685 ,
+#define _GMP_CHECK_INDEX_686 ,
+#define _GMP_CHECK_INDEX_687 ,
+#define _GMP_CHECK_INDEX_688 ,
+#define _GMP_CHECK_INDEX_689 ,
+#define _GMP_CHECK_INDEX_690 ,
+#define _GMP_CHECK_INDEX_691 ,
+#define _GMP_CHECK_INDEX_692 ,
+#define _GMP_CHECK_INDEX_693 ,
+#define _GMP_CHECK_INDEX_694 ,
+#define _GMP_CHECK_INDEX_695 ,
+#define _GMP_CHECK_INDEX_696 ,
+#define _GMP_CHECK_INDEX_697 ,
+#define _GMP_CHECK_INDEX_698 ,
+#define _GMP_CHECK_INDEX_699 ,
+#define _GMP_CHECK_INDEX_700 ,
+#define _GMP_CHECK_INDEX_701 ,
+#define _GMP_CHECK_INDEX_702 ,
+#define _GMP_CHECK_INDEX_703 ,
+#define _GMP_CHECK_INDEX_704 ,
+#define _GMP_CHECK_INDEX_705 ,
+#define _GMP_CHECK_INDEX_706 ,
+#define _GMP_CHECK_INDEX_707 ,
+#define _GMP_CHECK_INDEX_708 ,
+#define _GMP_CHECK_INDEX_709 ,
+#define _GMP_CHECK_INDEX_710 ,
+#define _GMP_CHECK_INDEX_711 ,
+#define _GMP_CHECK_INDEX_712 ,
+#define _GMP_CHECK_INDEX_713 ,
+#define _GMP_CHECK_INDEX_714 ,
+#define _GMP_CHECK_INDEX_715 ,
+#define _GMP_CHECK_INDEX_716 ,
+#define _GMP_CHECK_INDEX_717 ,
+#define _GMP_CHECK_INDEX_718 ,
+#define _GMP_CHECK_INDEX_719 ,
+#define _GMP_CHECK_INDEX_720 ,
+#define _GMP_CHECK_INDEX_721 ,
+#define _GMP_CHECK_INDEX_722 ,
+#define _GMP_CHECK_INDEX_723 ,
+#define _GMP_CHECK_INDEX_724 ,
+#define _GMP_CHECK_INDEX_725 ,
+#define _GMP_CHECK_INDEX_726 ,
+#define _GMP_CHECK_INDEX_727 ,
+#define _GMP_CHECK_INDEX_728 ,
+#define _GMP_CHECK_INDEX_729 ,
+#define _GMP_CHECK_INDEX_730 ,
+#define _GMP_CHECK_INDEX_731 ,
+#define _GMP_CHECK_INDEX_732 ,
+#define _GMP_CHECK_INDEX_733 ,
+#define _GMP_CHECK_INDEX_734 ,
+#define _GMP_CHECK_INDEX_735 ,
+#define _GMP_CHECK_INDEX_736 ,
+#define _GMP_CHECK_INDEX_737 ,
+#define _GMP_CHECK_INDEX_738 ,
+#define _GMP_CHECK_INDEX_739 ,
+#define _GMP_CHECK_INDEX_740 ,
+#define _GMP_CHECK_INDEX_741 ,
+#define _GMP_CHECK_INDEX_742 ,
+#define _GMP_CHECK_INDEX_743 ,
+#define _GMP_CHECK_INDEX_744 ,
+#define _GMP_CHECK_INDEX_745 ,
+#define _GMP_CHECK_INDEX_746 ,
+#define _GMP_CHECK_INDEX_747 ,
+#define _GMP_CHECK_INDEX_748 ,
+#define _GMP_CHECK_INDEX_749 ,
+#define _GMP_CHECK_INDEX_750 ,
+#define _GMP_CHECK_INDEX_751 ,
+#define _GMP_CHECK_INDEX_752 ,
+#define _GMP_CHECK_INDEX_753 ,
+#define _GMP_CHECK_INDEX_754 ,
+#define _GMP_CHECK_INDEX_755 ,
+#define _GMP_CHECK_INDEX_756 ,
+#define _GMP_CHECK_INDEX_757 ,
+#define _GMP_CHECK_INDEX_758 ,
+#define _GMP_CHECK_INDEX_759 ,
+#define _GMP_CHECK_INDEX_760 ,
+#define _GMP_CHECK_INDEX_761 ,
+#define _GMP_CHECK_INDEX_762 ,
+#define _GMP_CHECK_INDEX_763 ,
+#define _GMP_CHECK_INDEX_764 ,
+#define _GMP_CHECK_INDEX_765 ,
+#define _GMP_CHECK_INDEX_766 ,
+#define _GMP_CHECK_INDEX_767 ,
+#define _GMP_CHECK_INDEX_768 ,
+#define _GMP_CHECK_INDEX_769 ,
+#define _GMP_CHECK_INDEX_770 ,
+#define _GMP_CHECK_INDEX_771 ,
+#define _GMP_CHECK_INDEX_772 ,
+#define _GMP_CHECK_INDEX_773 ,
+#define _GMP_CHECK_INDEX_774 ,
+#define _GMP_CHECK_INDEX_775 ,
+#define _GMP_CHECK_INDEX_776 ,
+#define _GMP_CHECK_INDEX_777 ,
+#define _GMP_CHECK_INDEX_778 ,
+#define _GMP_CHECK_INDEX_779 ,
+#define _GMP_CHECK_INDEX_780 ,
+#define _GMP_CHECK_INDEX_781 ,
+#define _GMP_CHECK_INDEX_782 ,
+#define _GMP_CHECK_INDEX_783 ,
+#define _GMP_CHECK_INDEX_784 ,
+#define _GMP_CHECK_INDEX_785 ,
+#define _GMP_CHECK_INDEX_786 ,
+#define _GMP_CHECK_INDEX_787 ,
+#define _GMP_CHECK_INDEX_788 ,
+#define _GMP_CHECK_INDEX_789 ,
+#define _GMP_CHECK_INDEX_790 ,
+#define _GMP_CHECK_INDEX_791 ,
+#define _GMP_CHECK_INDEX_792 ,
+#define _GMP_CHECK_INDEX_793 ,
+#define _GMP_CHECK_INDEX_794 ,
+#define _GMP_CHECK_INDEX_795 ,
+#define _GMP_CHECK_INDEX_796 ,
+#define _GMP_CHECK_INDEX_797 ,
+#define _GMP_CHECK_INDEX_798 ,
+#define _GMP_CHECK_INDEX_799 ,
+#define _GMP_CHECK_INDEX_800 ,
+#define _GMP_CHECK_INDEX_801 ,
+#define _GMP_CHECK_INDEX_802 ,
+#define _GMP_CHECK_INDEX_803 ,
+#define _GMP_CHECK_INDEX_804 ,
+#define _GMP_CHECK_INDEX_805 ,
+#define _GMP_CHECK_INDEX_806 ,
+#define _GMP_CHECK_INDEX_807 ,
+#define _GMP_CHECK_INDEX_808 ,
+#define _GMP_CHECK_INDEX_809 ,
+#define _GMP_CHECK_INDEX_810 ,
+#define _GMP_CHECK_INDEX_811 ,
+#define _GMP_CHECK_INDEX_812 ,
+#define _GMP_CHECK_INDEX_813 ,
+#define _GMP_CHECK_INDEX_814 ,
+#define _GMP_CHECK_INDEX_815 ,
+#define _GMP_CHECK_INDEX_816 ,
+#define _GMP_CHECK_INDEX_817 ,
+#define _GMP_CHECK_INDEX_818 ,
+#define _GMP_CHECK_INDEX_819 ,
+#define _GMP_CHECK_INDEX_820 ,
+#define _GMP_CHECK_INDEX_821 ,
+#define _GMP_CHECK_INDEX_822 ,
+#define _GMP_CHECK_INDEX_823 ,
+#define _GMP_CHECK_INDEX_824 ,
+#define _GMP_CHECK_INDEX_825 ,
+#define _GMP_CHECK_INDEX_826 ,
+#define _GMP_CHECK_INDEX_827 ,
+#define _GMP_CHECK_INDEX_828 ,
+#define _GMP_CHECK_INDEX_829 ,
+#define _GMP_CHECK_INDEX_830 ,
+#define _GMP_CHECK_INDEX_831 ,
+#define _GMP_CHECK_INDEX_832 ,
+#define _GMP_CHECK_INDEX_833 ,
+#define _GMP_CHECK_INDEX_834 ,
+#define _GMP_CHECK_INDEX_835 ,
+#define _GMP_CHECK_INDEX_836 ,
+#define _GMP_CHECK_INDEX_837 ,
+#define _GMP_CHECK_INDEX_838 ,
+#define _GMP_CHECK_INDEX_839 ,
+#define _GMP_CHECK_INDEX_840 ,
+#define _GMP_CHECK_INDEX_841 ,
+#define _GMP_CHECK_INDEX_842 ,
+#define _GMP_CHECK_INDEX_843 ,
+#define _GMP_CHECK_INDEX_844 ,
+#define _GMP_CHECK_INDEX_845 ,
+#define _GMP_CHECK_INDEX_846 ,
+#define _GMP_CHECK_INDEX_847 ,
+#define _GMP_CHECK_INDEX_848 ,
+#define _GMP_CHECK_INDEX_849 ,
+#define _GMP_CHECK_INDEX_850 ,
+#define _GMP_CHECK_INDEX_851 ,
+#define _GMP_CHECK_INDEX_852 ,
+#define _GMP_CHECK_INDEX_853 ,
+#define _GMP_CHECK_INDEX_854 ,
+#define _GMP_CHECK_INDEX_855 ,
+#define _GMP_CHECK_INDEX_856 ,
+#define _GMP_CHECK_INDEX_857 ,
+#define _GMP_CHECK_INDEX_858 ,
+#define _GMP_CHECK_INDEX_859 ,
+#define _GMP_CHECK_INDEX_860 ,
+#define _GMP_CHECK_INDEX_861 ,
+#define _GMP_CHECK_INDEX_862 ,
+#define _GMP_CHECK_INDEX_863 ,
+#define _GMP_CHECK_INDEX_864 ,
+#define _GMP_CHECK_INDEX_865 ,
+#define _GMP_CHECK_INDEX_866 ,
+#define _GMP_CHECK_INDEX_867 ,
+#define _GMP_CHECK_INDEX_868 ,
+#define _GMP_CHECK_INDEX_869 ,
+#define _GMP_CHECK_INDEX_870 ,
+#define _GMP_CHECK_INDEX_871 ,
+#define _GMP_CHECK_INDEX_872 ,
+#define _GMP_CHECK_INDEX_873 ,
+#define _GMP_CHECK_INDEX_874 ,
+#define _GMP_CHECK_INDEX_875 ,
+#define _GMP_CHECK_INDEX_876 ,
+#define _GMP_CHECK_INDEX_877 ,
+#define _GMP_CHECK_INDEX_878 ,
+#define _GMP_CHECK_INDEX_879 ,
+#define _GMP_CHECK_INDEX_880 ,
+#define _GMP_CHECK_INDEX_881 ,
+#define _GMP_CHECK_INDEX_882 ,
+#define _GMP_CHECK_INDEX_883 ,
+#define _GMP_CHECK_INDEX_884 ,
+#define _GMP_CHECK_INDEX_885 ,
+#define _GMP_CHECK_INDEX_886 ,
+#define _GMP_CHECK_INDEX_887 ,
+#define _GMP_CHECK_INDEX_888 ,
+#define _GMP_CHECK_INDEX_889 ,
+#define _GMP_CHECK_INDEX_890 ,
+#define _GMP_CHECK_INDEX_891 ,
+#define _GMP_CHECK_INDEX_892 ,
+#define _GMP_CHECK_INDEX_893 ,
+#define _GMP_CHECK_INDEX_894 ,
+#define _GMP_CHECK_INDEX_895 ,
+#define _GMP_CHECK_INDEX_896 ,
+#define _GMP_CHECK_INDEX_897 ,
+#define _GMP_CHECK_INDEX_898 ,
+#define _GMP_CHECK_INDEX_899 ,
+#define _GMP_CHECK_INDEX_900 ,
+#define _GMP_CHECK_INDEX_901 ,
+#define _GMP_CHECK_INDEX_902 ,
+#define _GMP_CHECK_INDEX_903 ,
+#define _GMP_CHECK_INDEX_904 ,
+#define _GMP_CHECK_INDEX_905 ,
+#define _GMP_CHECK_INDEX_906 ,
+#define _GMP_CHECK_INDEX_907 ,
+#define _GMP_CHECK_INDEX_908 ,
+#define _GMP_CHECK_INDEX_909 ,
+#define _GMP_CHECK_INDEX_910 ,
+#define _GMP_CHECK_INDEX_911 ,
+#define _GMP_CHECK_INDEX_912 ,
+#define _GMP_CHECK_INDEX_913 ,
+#define _GMP_CHECK_INDEX_914 ,
+#define _GMP_CHECK_INDEX_915 ,
+#define _GMP_CHECK_INDEX_916 ,
+#define _GMP_CHECK_INDEX_917 ,
+#define _GMP_CHECK_INDEX_918 ,
+#define _GMP_CHECK_INDEX_919 ,
+#define _GMP_CHECK_INDEX_920 ,
+#define _GMP_CHECK_INDEX_921 ,
+#define _GMP_CHECK_INDEX_922 ,
+#define _GMP_CHECK_INDEX_923 ,
+#define _GMP_CHECK_INDEX_924 ,
+#define _GMP_CHECK_INDEX_925 ,
+#define _GMP_CHECK_INDEX_926 ,
+#define _GMP_CHECK_INDEX_927 ,
+#define _GMP_CHECK_INDEX_928 ,
+#define _GMP_CHECK_INDEX_929 ,
+#define _GMP_CHECK_INDEX_930 ,
+#define _GMP_CHECK_INDEX_931 ,
+#define _GMP_CHECK_INDEX_932 ,
+#define _GMP_CHECK_INDEX_933 ,
+#define _GMP_CHECK_INDEX_934 ,
+#define _GMP_CHECK_INDEX_935 ,
+#define _GMP_CHECK_INDEX_936 ,
+#define _GMP_CHECK_INDEX_937 ,
+#define _GMP_CHECK_INDEX_938 ,
+#define _GMP_CHECK_INDEX_939 ,
+#define _GMP_CHECK_INDEX_940 ,
+#define _GMP_CHECK_INDEX_941 ,
+#define _GMP_CHECK_INDEX_942 ,
+#define _GMP_CHECK_INDEX_943 ,
+#define _GMP_CHECK_INDEX_944 ,
+#define _GMP_CHECK_INDEX_945 ,
+#define _GMP_CHECK_INDEX_946 ,
+#define _GMP_CHECK_INDEX_947 ,
+#define _GMP_CHECK_INDEX_948 ,
+#define _GMP_CHECK_INDEX_949 ,
+#define _GMP_CHECK_INDEX_950 ,
+#define _GMP_CHECK_INDEX_951 ,
+#define _GMP_CHECK_INDEX_952 ,
+#define _GMP_CHECK_INDEX_953 ,
+#define _GMP_CHECK_INDEX_954 ,
+#define _GMP_CHECK_INDEX_955 ,
+#define _GMP_CHECK_INDEX_956 ,
+#define _GMP_CHECK_INDEX_957 ,
+#define _GMP_CHECK_INDEX_958 ,
+#define _GMP_CHECK_INDEX_959 ,
+#define _GMP_CHECK_INDEX_960 ,
+#define _GMP_CHECK_INDEX_961 ,
+#define _GMP_CHECK_INDEX_962 ,
+#define _GMP_CHECK_INDEX_963 ,
+#define _GMP_CHECK_INDEX_964 ,
+#define _GMP_CHECK_INDEX_965 ,
+#define _GMP_CHECK_INDEX_966 ,
+#define _GMP_CHECK_INDEX_967 ,
+#define _GMP_CHECK_INDEX_968 ,
+#define _GMP_CHECK_INDEX_969 ,
+#define _GMP_CHECK_INDEX_970 ,
+#define _GMP_CHECK_INDEX_971 ,
+#define _GMP_CHECK_INDEX_972 ,
+#define _GMP_CHECK_INDEX_973 ,
+#define _GMP_CHECK_INDEX_974 ,
+#define _GMP_CHECK_INDEX_975 ,
+#define _GMP_CHECK_INDEX_976 ,
+#define _GMP_CHECK_INDEX_977 ,
+#define _GMP_CHECK_INDEX_978 ,
+#define _GMP_CHECK_INDEX_979 ,
+#define _GMP_CHECK_INDEX_980 ,
+#define _GMP_CHECK_INDEX_981 ,
+#define _GMP_CHECK_INDEX_982 ,
+#define _GMP_CHECK_INDEX_983 ,
+#define _GMP_CHECK_INDEX_984 ,
+#define _GMP_CHECK_INDEX_985 ,
+#define _GMP_CHECK_INDEX_986 ,
+#define _GMP_CHECK_INDEX_987 ,
+#define _GMP_CHECK_INDEX_988 ,
+#define _GMP_CHECK_INDEX_989 ,
+#define _GMP_CHECK_INDEX_990 ,
+#define _GMP_CHECK_INDEX_991 ,
+#define _GMP_CHECK_INDEX_992 ,
+#define _GMP_CHECK_INDEX_993 ,
+#define _GMP_CHECK_INDEX_994 ,
+#define _GMP_CHECK_INDEX_995 ,
+#define _GMP_CHECK_INDEX_996 ,
+#define _GMP_CHECK_INDEX_997 ,
+#define _GMP_CHECK_INDEX_998 ,
+#define _GMP_CHECK_INDEX_999 ,
+#define _GMP_CHECK_INDEX_1000 ,
+#define _GMP_CHECK_INDEX_1001 ,
+#define _GMP_CHECK_INDEX_1002 ,
+#define _GMP_CHECK_INDEX_1003 ,
+#define _GMP_CHECK_INDEX_1004 ,
+#define _GMP_CHECK_INDEX_1005 ,
+#define _GMP_CHECK_INDEX_1006 ,
+#define _GMP_CHECK_INDEX_1007 ,
+#define _GMP_CHECK_INDEX_1008 ,
+#define _GMP_CHECK_INDEX_1009 ,
+#define _GMP_CHECK_INDEX_1010 ,
+#define _GMP_CHECK_INDEX_1011 ,
+#define _GMP_CHECK_INDEX_1012 ,
+#define _GMP_CHECK_INDEX_1013 ,
+#define _GMP_CHECK_INDEX_1014 ,
+#define _GMP_CHECK_INDEX_1015 ,
+#define _GMP_CHECK_INDEX_1016 ,
+#define _GMP_CHECK_INDEX_1017 ,
+#define _GMP_CHECK_INDEX_1018 ,
+#define _GMP_CHECK_INDEX_1019 ,
+#define _GMP_CHECK_INDEX_1020 ,
+#define _GMP_CHECK_INDEX_1021 ,
+#define _GMP_CHECK_INDEX_1022 ,
+#define _GMP_CHECK_INDEX_1023 ,
+#define _GMP_CHECK_INDEX_1024 ,
+
+// GMP_EQUAL_INT
+#define _GMP_EQUAL_INT_0_0 ,
+#define _GMP_EQUAL_INT_1_1 ,
+#define _GMP_EQUAL_INT_2_2 ,
+#define _GMP_EQUAL_INT_3_3 ,
+#define _GMP_EQUAL_INT_4_4 ,
+#define _GMP_EQUAL_INT_5_5 ,
+#define _GMP_EQUAL_INT_6_6 ,
+#define _GMP_EQUAL_INT_7_7 ,
+#define _GMP_EQUAL_INT_8_8 ,
+#define _GMP_EQUAL_INT_9_9 ,
+#define _GMP_EQUAL_INT_10_10 ,
+#define _GMP_EQUAL_INT_11_11 ,
+#define _GMP_EQUAL_INT_12_12 ,
+#define _GMP_EQUAL_INT_13_13 ,
+#define _GMP_EQUAL_INT_14_14 ,
+#define _GMP_EQUAL_INT_15_15 ,
+#define _GMP_EQUAL_INT_16_16 ,
+#define _GMP_EQUAL_INT_17_17 ,
+#define _GMP_EQUAL_INT_18_18 ,
+#define _GMP_EQUAL_INT_19_19 ,
+#define _GMP_EQUAL_INT_20_20 ,
+#define _GMP_EQUAL_INT_21_21 ,
+#define _GMP_EQUAL_INT_22_22 ,
+#define _GMP_EQUAL_INT_23_23 ,
+#define _GMP_EQUAL_INT_24_24 ,
+#define _GMP_EQUAL_INT_25_25 ,
+#define _GMP_EQUAL_INT_26_26 ,
+#define _GMP_EQUAL_INT_27_27 ,
+#define _GMP_EQUAL_INT_28_28 ,
+#define _GMP_EQUAL_INT_29_29 ,
+#define _GMP_EQUAL_INT_30_30 ,
+#define _GMP_EQUAL_INT_31_31 ,
+#define _GMP_EQUAL_INT_32_32 ,
+#define _GMP_EQUAL_INT_33_33 ,
+#define _GMP_EQUAL_INT_34_34 ,
+#define _GMP_EQUAL_INT_35_35 ,
+#define _GMP_EQUAL_INT_36_36 ,
+#define _GMP_EQUAL_INT_37_37 ,
+#define _GMP_EQUAL_INT_38_38 ,
+#define _GMP_EQUAL_INT_39_39 ,
+#define _GMP_EQUAL_INT_40_40 ,
+#define _GMP_EQUAL_INT_41_41 ,
+#define _GMP_EQUAL_INT_42_42 ,
+#define _GMP_EQUAL_INT_43_43 ,
+#define _GMP_EQUAL_INT_44_44 ,
+#define _GMP_EQUAL_INT_45_45 ,
+#define _GMP_EQUAL_INT_46_46 ,
+#define _GMP_EQUAL_INT_47_47 ,
+#define _GMP_EQUAL_INT_48_48 ,
+#define _GMP_EQUAL_INT_49_49 ,
+#define _GMP_EQUAL_INT_50_50 ,
+#define _GMP_EQUAL_INT_51_51 ,
+#define _GMP_EQUAL_INT_52_52 ,
+#define _GMP_EQUAL_INT_53_53 ,
+#define _GMP_EQUAL_INT_54_54 ,
+#define _GMP_EQUAL_INT_55_55 ,
+#define _GMP_EQUAL_INT_56_56 ,
+#define _GMP_EQUAL_INT_57_57 ,
+#define _GMP_EQUAL_INT_58_58 ,
+#define _GMP_EQUAL_INT_59_59 ,
+#define _GMP_EQUAL_INT_60_60 ,
+#define _GMP_EQUAL_INT_61_61 ,
+#define _GMP_EQUAL_INT_62_62 ,
+#define _GMP_EQUAL_INT_63_63 ,
+#define _GMP_EQUAL_INT_64_64 ,
+#define _GMP_EQUAL_INT_65_65 ,
+#define _GMP_EQUAL_INT_66_66 ,
+#define _GMP_EQUAL_INT_67_67 ,
+#define _GMP_EQUAL_INT_68_68 ,
+#define _GMP_EQUAL_INT_69_69 ,
+#define _GMP_EQUAL_INT_70_70 ,
+#define _GMP_EQUAL_INT_71_71 ,
+#define _GMP_EQUAL_INT_72_72 ,
+#define _GMP_EQUAL_INT_73_73 ,
+#define _GMP_EQUAL_INT_74_74 ,
+#define _GMP_EQUAL_INT_75_75 ,
+#define _GMP_EQUAL_INT_76_76 ,
+#define _GMP_EQUAL_INT_77_77 ,
+#define _GMP_EQUAL_INT_78_78 ,
+#define _GMP_EQUAL_INT_79_79 ,
+#define _GMP_EQUAL_INT_80_80 ,
+#define _GMP_EQUAL_INT_81_81 ,
+#define _GMP_EQUAL_INT_82_82 ,
+#define _GMP_EQUAL_INT_83_83 ,
+#define _GMP_EQUAL_INT_84_84 ,
+#define _GMP_EQUAL_INT_85_85 ,
+#define _GMP_EQUAL_INT_86_86 ,
+#define _GMP_EQUAL_INT_87_87 ,
+#define _GMP_EQUAL_INT_88_88 ,
+#define _GMP_EQUAL_INT_89_89 ,
+#define _GMP_EQUAL_INT_90_90 ,
+#define _GMP_EQUAL_INT_91_91 ,
+#define _GMP_EQUAL_INT_92_92 ,
+#define _GMP_EQUAL_INT_93_93 ,
+#define _GMP_EQUAL_INT_94_94 ,
+#define _GMP_EQUAL_INT_95_95 ,
+#define _GMP_EQUAL_INT_96_96 ,
+#define _GMP_EQUAL_INT_97_97 ,
+#define _GMP_EQUAL_INT_98_98 ,
+#define _GMP_EQUAL_INT_99_99 ,
+#define _GMP_EQUAL_INT_100_100 ,
+#define _GMP_EQUAL_INT_101_101 ,
+#define _GMP_EQUAL_INT_102_102 ,
+#define _GMP_EQUAL_INT_103_103 ,
+#define _GMP_EQUAL_INT_104_104 ,
+#define _GMP_EQUAL_INT_105_105 ,
+#define _GMP_EQUAL_INT_106_106 ,
+#define _GMP_EQUAL_INT_107_107 ,
+#define _GMP_EQUAL_INT_108_108 ,
+#define _GMP_EQUAL_INT_109_109 ,
+#define _GMP_EQUAL_INT_110_110 ,
+#define _GMP_EQUAL_INT_111_111 ,
+#define _GMP_EQUAL_INT_112_112 ,
+#define _GMP_EQUAL_INT_113_113 ,
+#define _GMP_EQUAL_INT_114_114 ,
+#define _GMP_EQUAL_INT_115_115 ,
+#define _GMP_EQUAL_INT_116_116 ,
+#define _GMP_EQUAL_INT_117_117 ,
+#define _GMP_EQUAL_INT_118_118 ,
+#define _GMP_EQUAL_INT_119_119 ,
+#define _GMP_EQUAL_INT_120_120 ,
+#define _GMP_EQUAL_INT_121_121 ,
+#define _GMP_EQUAL_INT_122_122 ,
+#define _GMP_EQUAL_INT_123_123 ,
+#define _GMP_EQUAL_INT_124_124 ,
+#define _GMP_EQUAL_INT_125_125 ,
+#define _GMP_EQUAL_INT_126_126 ,
+#define _GMP_EQUAL_INT_127_127 ,
+#define _GMP_EQUAL_INT_128_128 ,
+#define _GMP_EQUAL_INT_129_129 ,
+#define _GMP_EQUAL_INT_130_130 ,
+#define _GMP_EQUAL_INT_131_131 ,
+#define _GMP_EQUAL_INT_132_132 ,
+#define _GMP_EQUAL_INT_133_133 ,
+#define _GMP_EQUAL_INT_134_134 ,
+#define _GMP_EQUAL_INT_135_135 ,
+#define _GMP_EQUAL_INT_136_136 ,
+#define _GMP_EQUAL_INT_137_137 ,
+#define _GMP_EQUAL_INT_138_138 ,
+#define _GMP_EQUAL_INT_139_139 ,
+#define _GMP_EQUAL_INT_140_140 ,
+#define _GMP_EQUAL_INT_141_141 ,
+#define _GMP_EQUAL_INT_142_142 ,
+#define _GMP_EQUAL_INT_143_143 ,
+#define _GMP_EQUAL_INT_144_144 ,
+#define _GMP_EQUAL_INT_145_145 ,
+#define _GMP_EQUAL_INT_146_146 ,
+#define _GMP_EQUAL_INT_147_147 ,
+#define _GMP_EQUAL_INT_148_148 ,
+#define _GMP_EQUAL_INT_149_149 ,
+#define _GMP_EQUAL_INT_150_150 ,
+#define _GMP_EQUAL_INT_151_151 ,
+#define _GMP_EQUAL_INT_152_152 ,
+#define _GMP_EQUAL_INT_153_153 ,
+#define _GMP_EQUAL_INT_154_154 ,
+#define _GMP_EQUAL_INT_155_155 ,
+#define _GMP_EQUAL_INT_156_156 ,
+#define _GMP_EQUAL_INT_157_157 ,
+#define _GMP_EQUAL_INT_158_158 ,
+#define _GMP_EQUAL_INT_159_159 ,
+#define _GMP_EQUAL_INT_160_160 ,
+#define _GMP_EQUAL_INT_161_161 ,
+#define _GMP_EQUAL_INT_162_162 ,
+#define _GMP_EQUAL_INT_163_163 ,
+#define _GMP_EQUAL_INT_164_164 ,
+#define _GMP_EQUAL_INT_165_165 ,
+#define _GMP_EQUAL_INT_166_166 ,
+#define _GMP_EQUAL_INT_167_167 ,
+#define _GMP_EQUAL_INT_168_168 ,
+#define _GMP_EQUAL_INT_169_169 ,
+#define _GMP_EQUAL_INT_170_170 ,
+#define _GMP_EQUAL_INT_171_171 ,
+#define _GMP_EQUAL_INT_172_172 ,
+#define _GMP_EQUAL_INT_173_173 ,
+#define _GMP_EQUAL_INT_174_174 ,
+#define _GMP_EQUAL_INT_175_175 ,
+#define _GMP_EQUAL_INT_176_176 ,
+#define _GMP_EQUAL_INT_177_177 ,
+#define _GMP_EQUAL_INT_178_178 ,
+#define _GMP_EQUAL_INT_179_179 ,
+#define _GMP_EQUAL_INT_180_180 ,
+#define _GMP_EQUAL_INT_181_181 ,
+#define _GMP_EQUAL_INT_182_182 ,
+#define _GMP_EQUAL_INT_183_183 ,
+#define _GMP_EQUAL_INT_184_184 ,
+#define _GMP_EQUAL_INT_185_185 ,
+#define _GMP_EQUAL_INT_186_186 ,
+#define _GMP_EQUAL_INT_187_187 ,
+#define _GMP_EQUAL_INT_188_188 ,
+#define _GMP_EQUAL_INT_189_189 ,
+#define _GMP_EQUAL_INT_190_190 ,
+#define _GMP_EQUAL_INT_191_191 ,
+#define _GMP_EQUAL_INT_192_192 ,
+#define _GMP_EQUAL_INT_193_193 ,
+#define _GMP_EQUAL_INT_194_194 ,
+#define _GMP_EQUAL_INT_195_195 ,
+#define _GMP_EQUAL_INT_196_196 ,
+#define _GMP_EQUAL_INT_197_197 ,
+#define _GMP_EQUAL_INT_198_198 ,
+#define _GMP_EQUAL_INT_199_199 ,
+#define _GMP_EQUAL_INT_200_200 ,
+#define _GMP_EQUAL_INT_201_201 ,
+#define _GMP_EQUAL_INT_202_202 ,
+#define _GMP_EQUAL_INT_203_203 ,
+#define _GMP_EQUAL_INT_204_204 ,
+#define _GMP_EQUAL_INT_205_205 ,
+#define _GMP_EQUAL_INT_206_206 ,
+#define _GMP_EQUAL_INT_207_207 ,
+#define _GMP_EQUAL_INT_208_208 ,
+#define _GMP_EQUAL_INT_209_209 ,
+#define _GMP_EQUAL_INT_210_210 ,
+#define _GMP_EQUAL_INT_211_211 ,
+#define _GMP_EQUAL_INT_212_212 ,
+#define _GMP_EQUAL_INT_213_213 ,
+#define _GMP_EQUAL_INT_214_214 ,
+#define _GMP_EQUAL_INT_215_215 ,
+#define _GMP_EQUAL_INT_216_216 ,
+#define _GMP_EQUAL_INT_217_217 ,
+#define _GMP_EQUAL_INT_218_218 ,
+#define _GMP_EQUAL_INT_219_219 ,
+#define _GMP_EQUAL_INT_220_220 ,
+#define _GMP_EQUAL_INT_221_221 ,
+#define _GMP_EQUAL_INT_222_222 ,
+#define _GMP_EQUAL_INT_223_223 ,
+#define _GMP_EQUAL_INT_224_224 ,
+#define _GMP_EQUAL_INT_225_225 ,
+#define _GMP_EQUAL_INT_226_226 ,
+#define _GMP_EQUAL_INT_227_227 ,
+#define _GMP_EQUAL_INT_228_228 ,
+#define _GMP_EQUAL_INT_229_229 ,
+#define _GMP_EQUAL_INT_230_230 ,
+#define _GMP_EQUAL_INT_231_231 ,
+#define _GMP_EQUAL_INT_232_232 ,
+#define _GMP_EQUAL_INT_233_233 ,
+#define _GMP_EQUAL_INT_234_234 ,
+#define _GMP_EQUAL_INT_235_235 ,
+#define _GMP_EQUAL_INT_236_236 ,
+#define _GMP_EQUAL_INT_237_237 ,
+#define _GMP_EQUAL_INT_238_238 ,
+#define _GMP_EQUAL_INT_239_239 ,
+#define _GMP_EQUAL_INT_240_240 ,
+#define _GMP_EQUAL_INT_241_241 ,
+#define _GMP_EQUAL_INT_242_242 ,
+#define _GMP_EQUAL_INT_243_243 ,
+#define _GMP_EQUAL_INT_244_244 ,
+#define _GMP_EQUAL_INT_245_245 ,
+#define _GMP_EQUAL_INT_246_246 ,
+#define _GMP_EQUAL_INT_247_247 ,
+#define _GMP_EQUAL_INT_248_248 ,
+#define _GMP_EQUAL_INT_249_249 ,
+#define _GMP_EQUAL_INT_250_250 ,
+#define _GMP_EQUAL_INT_251_251 ,
+#define _GMP_EQUAL_INT_252_252 ,
+#define _GMP_EQUAL_INT_253_253 ,
+#define _GMP_EQUAL_INT_254_254 ,
+#define _GMP_EQUAL_INT_255_255 ,
+#define _GMP_EQUAL_INT_256_256 ,
+#define _GMP_EQUAL_INT_257_257 ,
+#define _GMP_EQUAL_INT_258_258 ,
+#define _GMP_EQUAL_INT_259_259 ,
+#define _GMP_EQUAL_INT_260_260 ,
+#define _GMP_EQUAL_INT_261_261 ,
+#define _GMP_EQUAL_INT_262_262 ,
+#define _GMP_EQUAL_INT_263_263 ,
+#define _GMP_EQUAL_INT_264_264 ,
+#define _GMP_EQUAL_INT_265_265 ,
+#define _GMP_EQUAL_INT_266_266 ,
+#define _GMP_EQUAL_INT_267_267 ,
+#define _GMP_EQUAL_INT_268_268 ,
+#define _GMP_EQUAL_INT_269_269 ,
+#define _GMP_EQUAL_INT_270_270 ,
+#define _GMP_EQUAL_INT_271_271 ,
+#define _GMP_EQUAL_INT_272_272 ,
+#define _GMP_EQUAL_INT_273_273 ,
+#define _GMP_EQUAL_INT_274_274 ,
+#define _GMP_EQUAL_INT_275_275 ,
+#define _GMP_EQUAL_INT_276_276 ,
+#define _GMP_EQUAL_INT_277_277 ,
+#define _GMP_EQUAL_INT_278_278 ,
+#define _GMP_EQUAL_INT_279_279 ,
+#define _GMP_EQUAL_INT_280_280 ,
+#define _GMP_EQUAL_INT_281_281 ,
+#define _GMP_EQUAL_INT_282_282 ,
+#define _GMP_EQUAL_INT_283_283 ,
+#define _GMP_EQUAL_INT_284_284 ,
+#define _GMP_EQUAL_INT_285_285 ,
+#define _GMP_EQUAL_INT_286_286 ,
+#define _GMP_EQUAL_INT_287_287 ,
+#define _GMP_EQUAL_INT_288_288 ,
+#define _GMP_EQUAL_INT_289_289 ,
+#define _GMP_EQUAL_INT_290_290 ,
+#define _GMP_EQUAL_INT_291_291 ,
+#define _GMP_EQUAL_INT_292_292 ,
+#define _GMP_EQUAL_INT_293_293 ,
+#define _GMP_EQUAL_INT_294_294 ,
+#define _GMP_EQUAL_INT_295_295 ,
+#define _GMP_EQUAL_INT_296_296 ,
+#define _GMP_EQUAL_INT_297_297 ,
+#define _GMP_EQUAL_INT_298_298 ,
+#define _GMP_EQUAL_INT_299_299 ,
+#define _GMP_EQUAL_INT_300_300 ,
+#define _GMP_EQUAL_INT_301_301 ,
+#define _GMP_EQUAL_INT_302_302 ,
+#define _GMP_EQUAL_INT_303_303 ,
+#define _GMP_EQUAL_INT_304_304 ,
+#define _GMP_EQUAL_INT_305_305 ,
+#define _GMP_EQUAL_INT_306_306 ,
+#define _GMP_EQUAL_INT_307_307 ,
+#define _GMP_EQUAL_INT_308_308 ,
+#define _GMP_EQUAL_INT_309_309 ,
+#define _GMP_EQUAL_INT_310_310 ,
+#define _GMP_EQUAL_INT_311_311 ,
+#define _GMP_EQUAL_INT_312_312 ,
+#define _GMP_EQUAL_INT_313_313 ,
+#define _GMP_EQUAL_INT_314_314 ,
+#define _GMP_EQUAL_INT_315_315 ,
+#define _GMP_EQUAL_INT_316_316 ,
+#define _GMP_EQUAL_INT_317_317 ,
+#define _GMP_EQUAL_INT_318_318 ,
+#define _GMP_EQUAL_INT_319_319 ,
+#define _GMP_EQUAL_INT_320_320 ,
+#define _GMP_EQUAL_INT_321_321 ,
+#define _GMP_EQUAL_INT_322_322 ,
+#define _GMP_EQUAL_INT_323_323 ,
+#define _GMP_EQUAL_INT_324_324 ,
+#define _GMP_EQUAL_INT_325_325 ,
+#define _GMP_EQUAL_INT_326_326 ,
+#define _GMP_EQUAL_INT_327_327 ,
+#define _GMP_EQUAL_INT_328_328 ,
+#define _GMP_EQUAL_INT_329_329 ,
+#define _GMP_EQUAL_INT_330_330 ,
+#define _GMP_EQUAL_INT_331_331 ,
+#define _GMP_EQUAL_INT_332_332 ,
+#define _GMP_EQUAL_INT_333_333 ,
+#define _GMP_EQUAL_INT_334_334 ,
+#define _GMP_EQUAL_INT_335_335 ,
+#define _GMP_EQUAL_INT_336_336 ,
+#define _GMP_EQUAL_INT_337_337 ,
+#define _GMP_EQUAL_INT_338_338 ,
+#define _GMP_EQUAL_INT_339_339 ,
+#define _GMP_EQUAL_INT_340_340 ,
+#define _GMP_EQUAL_INT_341_341 ,
+#define _GMP_EQUAL_INT_342_342 ,
+#define _GMP_EQUAL_INT_343_343 ,
+#define _GMP_EQUAL_INT_344_344 ,
+#define _GMP_EQUAL_INT_345_345 ,
+#define _GMP_EQUAL_INT_346_346 ,
+#define _GMP_EQUAL_INT_347_347 ,
+#define _GMP_EQUAL_INT_348_348 ,
+#define _GMP_EQUAL_INT_349_349 ,
+#define _GMP_EQUAL_INT_350_350 ,
+#define _GMP_EQUAL_INT_351_351 ,
+#define _GMP_EQUAL_INT_352_352 ,
+#define _GMP_EQUAL_INT_353_353 ,
+#define _GMP_EQUAL_INT_354_354 ,
+#define _GMP_EQUAL_INT_355_355 ,
+#define _GMP_EQUAL_INT_356_356 ,
+#define _GMP_EQUAL_INT_357_357 ,
+#define _GMP_EQUAL_INT_358_358 ,
+#define _GMP_EQUAL_INT_359_359 ,
+#define _GMP_EQUAL_INT_360_360 ,
+#define _GMP_EQUAL_INT_361_361 ,
+#define _GMP_EQUAL_INT_362_362 ,
+#define _GMP_EQUAL_INT_363_363 ,
+#define _GMP_EQUAL_INT_364_364 ,
+#define _GMP_EQUAL_INT_365_365 ,
+#define _GMP_EQUAL_INT_366_366 ,
+#define _GMP_EQUAL_INT_367_367 ,
+#define _GMP_EQUAL_INT_368_368 ,
+#define _GMP_EQUAL_INT_369_369 ,
+#define _GMP_EQUAL_INT_370_370 ,
+#define _GMP_EQUAL_INT_371_371 ,
+#define _GMP_EQUAL_INT_372_372 ,
+#define _GMP_EQUAL_INT_373_373 ,
+#define _GMP_EQUAL_INT_374_374 ,
+#define _GMP_EQUAL_INT_375_375 ,
+#define _GMP_EQUAL_INT_376_376 ,
+#define _GMP_EQUAL_INT_377_377 ,
+#define _GMP_EQUAL_INT_378_378 ,
+#define _GMP_EQUAL_INT_379_379 ,
+#define _GMP_EQUAL_INT_380_380 ,
+#define _GMP_EQUAL_INT_381_381 ,
+#define _GMP_EQUAL_INT_382_382 ,
+#define _GMP_EQUAL_INT_383_383 ,
+#define _GMP_EQUAL_INT_384_384 ,
+#define _GMP_EQUAL_INT_385_385 ,
+#define _GMP_EQUAL_INT_386_386 ,
+#define _GMP_EQUAL_INT_387_387 ,
+#define _GMP_EQUAL_INT_388_388 ,
+#define _GMP_EQUAL_INT_389_389 ,
+#define _GMP_EQUAL_INT_390_390 ,
+#define _GMP_EQUAL_INT_391_391 ,
+#define _GMP_EQUAL_INT_392_392 ,
+#define _GMP_EQUAL_INT_393_393 ,
+#define _GMP_EQUAL_INT_394_394 ,
+#define _GMP_EQUAL_INT_395_395 ,
+#define _GMP_EQUAL_INT_396_396 ,
+#define _GMP_EQUAL_INT_397_397 ,
+#define _GMP_EQUAL_INT_398_398 ,
+#define _GMP_EQUAL_INT_399_399 ,
+#define _GMP_EQUAL_INT_400_400 ,
+#define _GMP_EQUAL_INT_401_401 ,
+#define _GMP_EQUAL_INT_402_402 ,
+#define _GMP_EQUAL_INT_403_403 ,
+#define _GMP_EQUAL_INT_404_404 ,
+#define _GMP_EQUAL_INT_405_405 ,
+#define _GMP_EQUAL_INT_406_406 ,
+#define _GMP_EQUAL_INT_407_407 ,
+#define _GMP_EQUAL_INT_408_408 ,
+#define _GMP_EQUAL_INT_409_409 ,
+#define _GMP_EQUAL_INT_410_410 ,
+#define _GMP_EQUAL_INT_411_411 ,
+#define _GMP_EQUAL_INT_412_412 ,
+#define _GMP_EQUAL_INT_413_413 ,
+#define _GMP_EQUAL_INT_414_414 ,
+#define _GMP_EQUAL_INT_415_415 ,
+#define _GMP_EQUAL_INT_416_416 ,
+#define _GMP_EQUAL_INT_417_417 ,
+#define _GMP_EQUAL_INT_418_418 ,
+#define _GMP_EQUAL_INT_419_419 ,
+#define _GMP_EQUAL_INT_420_420 ,
+#define _GMP_EQUAL_INT_421_421 ,
+#define _GMP_EQUAL_INT_422_422 ,
+#define _GMP_EQUAL_INT_423_423 ,
+#define _GMP_EQUAL_INT_424_424 ,
+#define _GMP_EQUAL_INT_425_425 ,
+#define _GMP_EQUAL_INT_426_426 ,
+#define _GMP_EQUAL_INT_427_427 ,
+#define _GMP_EQUAL_INT_428_428 ,
+#define _GMP_EQUAL_INT_429_429 ,
+#define _GMP_EQUAL_INT_430_430 ,
+#define _GMP_EQUAL_INT_431_431 ,
+#define _GMP_EQUAL_INT_432_432 ,
+#define _GMP_EQUAL_INT_433_433 ,
+#define _GMP_EQUAL_INT_434_434 ,
+#define _GMP_EQUAL_INT_435_435 ,
+#define _GMP_EQUAL_INT_436_436 ,
+#define _GMP_EQUAL_INT_437_437 ,
+#define _GMP_EQUAL_INT_438_438 ,
+#define _GMP_EQUAL_INT_439_439 ,
+#define _GMP_EQUAL_INT_440_440 ,
+#define _GMP_EQUAL_INT_441_441 ,
+#define _GMP_EQUAL_INT_442_442 ,
+#define _GMP_EQUAL_INT_443_443 ,
+#define _GMP_EQUAL_INT_444_444 ,
+#define _GMP_EQUAL_INT_445_445 ,
+#define _GMP_EQUAL_INT_446_446 ,
+#define _GMP_EQUAL_INT_447_447 ,
+#define _GMP_EQUAL_INT_448_448 ,
+#define _GMP_EQUAL_INT_449_449 ,
+#define _GMP_EQUAL_INT_450_450 ,
+#define _GMP_EQUAL_INT_451_451 ,
+#define _GMP_EQUAL_INT_452_452 ,
+#define _GMP_EQUAL_INT_453_453 ,
+#define _GMP_EQUAL_INT_454_454 ,
+#define _GMP_EQUAL_INT_455_455 ,
+#define _GMP_EQUAL_INT_456_456 ,
+#define _GMP_EQUAL_INT_457_457 ,
+#define _GMP_EQUAL_INT_458_458 ,
+#define _GMP_EQUAL_INT_459_459 ,
+#define _GMP_EQUAL_INT_460_460 ,
+#define _GMP_EQUAL_INT_461_461 ,
+#define _GMP_EQUAL_INT_462_462 ,
+#define _GMP_EQUAL_INT_463_463 ,
+#define _GMP_EQUAL_INT_464_464 ,
+#define _GMP_EQUAL_INT_465_465 ,
+#define _GMP_EQUAL_INT_466_466 ,
+#define _GMP_EQUAL_INT_467_467 ,
+#define _GMP_EQUAL_INT_468_468 ,
+#define _GMP_EQUAL_INT_469_469 ,
+#define _GMP_EQUAL_INT_470_470 ,
+#define _GMP_EQUAL_INT_471_471 ,
+#define _GMP_EQUAL_INT_472_472 ,
+#define _GMP_EQUAL_INT_473_473 ,
+#define _GMP_EQUAL_INT_474_474 ,
+#define _GMP_EQUAL_INT_475_475 ,
+#define _GMP_EQUAL_INT_476_476 ,
+#define _GMP_EQUAL_INT_477_477 ,
+#define _GMP_EQUAL_INT_478_478 ,
+#define _GMP_EQUAL_INT_479_479 ,
+#define _GMP_EQUAL_INT_480_480 ,
+#define _GMP_EQUAL_INT_481_481 ,
+#define _GMP_EQUAL_INT_482_482 ,
+#define _GMP_EQUAL_INT_483_483 ,
+#define _GMP_EQUAL_INT_484_484 ,
+#define _GMP_EQUAL_INT_485_485 ,
+#define _GMP_EQUAL_INT_486_486 ,
+#define _GMP_EQUAL_INT_487_487 ,
+#define _GMP_EQUAL_INT_488_488 ,
+#define _GMP_EQUAL_INT_489_489 ,
+#define _GMP_EQUAL_INT_490_490 ,
+#define _GMP_EQUAL_INT_491_491 ,
+#define _GMP_EQUAL_INT_492_492 ,
+#define _GMP_EQUAL_INT_493_493 ,
+#define _GMP_EQUAL_INT_494_494 ,
+#define _GMP_EQUAL_INT_495_495 ,
+#define _GMP_EQUAL_INT_496_496 ,
+#define _GMP_EQUAL_INT_497_497 ,
+#define _GMP_EQUAL_INT_498_498 ,
+#define _GMP_EQUAL_INT_499_499 ,
+#define _GMP_EQUAL_INT_500_500 ,
+#define _GMP_EQUAL_INT_501_501 ,
+#define _GMP_EQUAL_INT_502_502 ,
+#define _GMP_EQUAL_INT_503_503 ,
+#define _GMP_EQUAL_INT_504_504 ,
+#define _GMP_EQUAL_INT_505_505 ,
+#define _GMP_EQUAL_INT_506_506 ,
+#define _GMP_EQUAL_INT_507_507 ,
+#define _GMP_EQUAL_INT_508_508 ,
+#define _GMP_EQUAL_INT_509_509 ,
+#define _GMP_EQUAL_INT_510_510 ,
+#define _GMP_EQUAL_INT_511_511 ,
+#define _GMP_EQUAL_INT_512_512 ,
+#define _GMP_EQUAL_INT_513_513 ,
+#define _GMP_EQUAL_INT_514_514 ,
+#define _GMP_EQUAL_INT_515_515 ,
+#define _GMP_EQUAL_INT_516_516 ,
+#define _GMP_EQUAL_INT_517_517 ,
+#define _GMP_EQUAL_INT_518_518 ,
+#define _GMP_EQUAL_INT_519_519 ,
+#define _GMP_EQUAL_INT_520_520 ,
+#define _GMP_EQUAL_INT_521_521 ,
+#define _GMP_EQUAL_INT_522_522 ,
+#define _GMP_EQUAL_INT_523_523 ,
+#define _GMP_EQUAL_INT_524_524 ,
+#define _GMP_EQUAL_INT_525_525 ,
+#define _GMP_EQUAL_INT_526_526 ,
+#define _GMP_EQUAL_INT_527_527 ,
+#define _GMP_EQUAL_INT_528_528 ,
+#define _GMP_EQUAL_INT_529_529 ,
+#define _GMP_EQUAL_INT_530_530 ,
+#define _GMP_EQUAL_INT_531_531 ,
+#define _GMP_EQUAL_INT_532_532 ,
+#define _GMP_EQUAL_INT_533_533 ,
+#define _GMP_EQUAL_INT_534_534 ,
+#define _GMP_EQUAL_INT_535_535 ,
+#define _GMP_EQUAL_INT_536_536 ,
+#define _GMP_EQUAL_INT_537_537 ,
+#define _GMP_EQUAL_INT_538_538 ,
+#define _GMP_EQUAL_INT_539_539 ,
+#define _GMP_EQUAL_INT_540_540 ,
+#define _GMP_EQUAL_INT_541_541 ,
+#define _GMP_EQUAL_INT_542_542 ,
+#define _GMP_EQUAL_INT_543_543 ,
+#define _GMP_EQUAL_INT_544_544 ,
+#define _GMP_EQUAL_INT_545_545 ,
+#define _GMP_EQUAL_INT_546_546 ,
+#define _GMP_EQUAL_INT_547_547 ,
+#define _GMP_EQUAL_INT_548_548 ,
+#define _GMP_EQUAL_INT_549_549 ,
+#define _GMP_EQUAL_INT_550_550 ,
+#define _GMP_EQUAL_INT_551_551 ,
+#define _GMP_EQUAL_INT_552_552 ,
+#define _GMP_EQUAL_INT_553_553 ,
+#define _GMP_EQUAL_INT_554_554 ,
+#define _GMP_EQUAL_INT_555_555 ,
+#define _GMP_EQUAL_INT_556_556 ,
+#define _GMP_EQUAL_INT_557_557 ,
+#define _GMP_EQUAL_INT_558_558 ,
+#define _GMP_EQUAL_INT_559_559 ,
+#define _GMP_EQUAL_INT_560_560 ,
+#define _GMP_EQUAL_INT_561_561 ,
+#define _GMP_EQUAL_INT_562_562 ,
+#define _GMP_EQUAL_INT_563_563 ,
+#define _GMP_EQUAL_INT_564_564 ,
+#define _GMP_EQUAL_INT_565_565 ,
+#define _GMP_EQUAL_INT_566_566 ,
+#define _GMP_EQUAL_INT_567_567 ,
+#define _GMP_EQUAL_INT_568_568 ,
+#define _GMP_EQUAL_INT_569_569 ,
+#define _GMP_EQUAL_INT_570_570 ,
+#define _GMP_EQUAL_INT_571_571 ,
+#define _GMP_EQUAL_INT_572_572 ,
+#define _GMP_EQUAL_INT_573_573 ,
+#define _GMP_EQUAL_INT_574_574 ,
+#define _GMP_EQUAL_INT_575_575 ,
+#define _GMP_EQUAL_INT_576_576 ,
+#define _GMP_EQUAL_INT_577_577 ,
+#define _GMP_EQUAL_INT_578_578 ,
+#define _GMP_EQUAL_INT_579_579 ,
+#define _GMP_EQUAL_INT_580_580 ,
+#define _GMP_EQUAL_INT_581_581 ,
+#define _GMP_EQUAL_INT_582_582 ,
+#define _GMP_EQUAL_INT_583_583 ,
+#define _GMP_EQUAL_INT_584_584 ,
+#define _GMP_EQUAL_INT_585_585 ,
+#define _GMP_EQUAL_INT_586_586 ,
+#define _GMP_EQUAL_INT_587_587 ,
+#define _GMP_EQUAL_INT_588_588 ,
+#define _GMP_EQUAL_INT_589_589 ,
+#define _GMP_EQUAL_INT_590_590 ,
+#define _GMP_EQUAL_INT_591_591 ,
+#define _GMP_EQUAL_INT_592_592 ,
+#define _GMP_EQUAL_INT_593_593 ,
+#define _GMP_EQUAL_INT_594_594 ,
+#define _GMP_EQUAL_INT_595_595 ,
+#define _GMP_EQUAL_INT_596_596 ,
+#define _GMP_EQUAL_INT_597_597 ,
+#define _GMP_EQUAL_INT_598_598 ,
+#define _GMP_EQUAL_INT_599_599 ,
+#define _GMP_EQUAL_INT_600_600 ,
+#define _GMP_EQUAL_INT_601_601 ,
+#define _GMP_EQUAL_INT_602_602 ,
+#define _GMP_EQUAL_INT_603_603 ,
+#define _GMP_EQUAL_INT_604_604 ,
+#define _GMP_EQUAL_INT_605_605 ,
+#define _GMP_EQUAL_INT_606_606 ,
+#define _GMP_EQUAL_INT_607_607 ,
+#define _GMP_EQUAL_INT_608_608 ,
+#define _GMP_EQUAL_INT_609_609 ,
+#define _GMP_EQUAL_INT_610_610 ,
+#define _GMP_EQUAL_INT_611_611 ,
+#define _GMP_EQUAL_INT_612_612 ,
+#define _GMP_EQUAL_INT_613_613 ,
+#define _GMP_EQUAL_INT_614_614 ,
+#define _GMP_EQUAL_INT_615_615 ,
+#define _GMP_EQUAL_INT_616_616 ,
+#define _GMP_EQUAL_INT_617_617 ,
+#define _GMP_EQUAL_INT_618_618 ,
+#define _GMP_EQUAL_INT_619_619 ,
+#define _GMP_EQUAL_INT_620_620 ,
+#define _GMP_EQUAL_INT_621_621 ,
+#define _GMP_EQUAL_INT_622_622 ,
+#define _GMP_EQUAL_INT_623_623 ,
+#define _GMP_EQUAL_INT_624_624 ,
+#define _GMP_EQUAL_INT_625_625 ,
+#define _GMP_EQUAL_INT_626_626 ,
+#define _GMP_EQUAL_INT_627_627 ,
+#define _GMP_EQUAL_INT_628_628 ,
+#define _GMP_EQUAL_INT_629_629 ,
+#define _GMP_EQUAL_INT_630_630 ,
+#define _GMP_EQUAL_INT_631_631 ,
+#define _GMP_EQUAL_INT_632_632 ,
+#define _GMP_EQUAL_INT_633_633 ,
+#define _GMP_EQUAL_INT_634_634 ,
+#define _GMP_EQUAL_INT_635_635 ,
+#define _GMP_EQUAL_INT_636_636 ,
+#define _GMP_EQUAL_INT_637_637 ,
+#define _GMP_EQUAL_INT_638_638 ,
+#define _GMP_EQUAL_INT_639_639 ,
+#define _GMP_EQUAL_INT_640_640 ,
+#define _GMP_EQUAL_INT_641_641 ,
+#define _GMP_EQUAL_INT_642_642 ,
+#define _GMP_EQUAL_INT_643_643 ,
+#define _GMP_EQUAL_INT_644_644 ,
+#define _GMP_EQUAL_INT_645_645 ,
+#define _GMP_EQUAL_INT_646_646 ,
+#define _GMP_EQUAL_INT_647_647 ,
+#define _GMP_EQUAL_INT_648_648 ,
+#define _GMP_EQUAL_INT_649_649 ,
+#define _GMP_EQUAL_INT_650_650 ,
+#define _GMP_EQUAL_INT_651_651 ,
+#define _GMP_EQUAL_INT_652_652 ,
+#define _GMP_EQUAL_INT_653_653 ,
+#define _GMP_EQUAL_INT_654_654 ,
+#define _GMP_EQUAL_INT_655_655 ,
+#define _GMP_EQUAL_INT_656_656 ,
+#define _GMP_EQUAL_INT_657_657 ,
+#define _GMP_EQUAL_INT_658_658 ,
+#define _GMP_EQUAL_INT_659_659 ,
+#define _GMP_EQUAL_INT_660_660 ,
+#define _GMP_EQUAL_INT_661_661 ,
+#define _GMP_EQUAL_INT_662_662 ,
+#define _GMP_EQUAL_INT_663_663 ,
+#define _GMP_EQUAL_INT_664_664 ,
+#define _GMP_EQUAL_INT_665_665 ,
+#define _GMP_EQUAL_INT_666_666 ,
+#define _GMP_EQUAL_INT_667_667 ,
+#define _GMP_EQUAL_INT_668_668 ,
+#define _GMP_EQUAL_INT_669_669 ,
+#define _GMP_EQUAL_INT_670_670 ,
+#define _GMP_EQUAL_INT_671_671 ,
+#define _GMP_EQUAL_INT_672_672 ,
+#define _GMP_EQUAL_INT_673_673 ,
+#define _GMP_EQUAL_INT_674_674 ,
+#define _GMP_EQUAL_INT_675_675 ,
+#define _GMP_EQUAL_INT_676_676 ,
+#define _GMP_EQUAL_INT_677_677 ,
+#define _GMP_EQUAL_INT_678_678 ,
+#define _GMP_EQUAL_INT_679_679 ,
+#define _GMP_EQUAL_INT_680_680 ,
+#define _GMP_EQUAL_INT_681_681 ,
+#define _GMP_EQUAL_INT_682_682 ,
+#define _GMP_EQUAL_INT_683_683 ,
+#define _GMP_EQUAL_INT_684_684 ,
+#define _GMP_EQUAL_INT_685_685 ,
+#define _GMP_EQUAL_INT_686_686 ,
+#define _GMP_EQUAL_INT_687_687 ,
+#define _GMP_EQUAL_INT_688_688 ,
+#define _GMP_EQUAL_INT_689_689 ,
+#define _GMP_EQUAL_INT_690_690 ,
+#define _GMP_EQUAL_INT_691_691 ,
+#define _GMP_EQUAL_INT_692_692 ,
+#define _GMP_EQUAL_INT_693_693 ,
+#define _GMP_EQUAL_INT_694_694 ,
+#define _GMP_EQUAL_INT_695_695 ,
+#define _GMP_EQUAL_INT_696_696 ,
+#define _GMP_EQUAL_INT_697_697 ,
+#define _GMP_EQUAL_INT_698_698 ,
+#define _GMP_EQUAL_INT_699_699 ,
+#define _GMP_EQUAL_INT_700_700 ,
+#define _GMP_EQUAL_INT_701_701 ,
+#define _GMP_EQUAL_INT_702_702 ,
+#define _GMP_EQUAL_INT_703_703 ,
+#define _GMP_EQUAL_INT_704_704 ,
+#define _GMP_EQUAL_INT_705_705 ,
+#define _GMP_EQUAL_INT_706_706 ,
+#define _GMP_EQUAL_INT_707_707 ,
+#define _GMP_EQUAL_INT_708_708 ,
+#define _GMP_EQUAL_INT_709_709 ,
+#define _GMP_EQUAL_INT_710_710 ,
+#define _GMP_EQUAL_INT_711_711 ,
+#define _GMP_EQUAL_INT_712_712 ,
+#define _GMP_EQUAL_INT_713_713 ,
+#define _GMP_EQUAL_INT_714_714 ,
+#define _GMP_EQUAL_INT_715_715 ,
+#define _GMP_EQUAL_INT_716_716 ,
+#define _GMP_EQUAL_INT_717_717 ,
+#define _GMP_EQUAL_INT_718_718 ,
+#define _GMP_EQUAL_INT_719_719 ,
+#define _GMP_EQUAL_INT_720_720 ,
+#define _GMP_EQUAL_INT_721_721 ,
+#define _GMP_EQUAL_INT_722_722 ,
+#define _GMP_EQUAL_INT_723_723 ,
+#define _GMP_EQUAL_INT_724_724 ,
+#define _GMP_EQUAL_INT_725_725 ,
+#define _GMP_EQUAL_INT_726_726 ,
+#define _GMP_EQUAL_INT_727_727 ,
+#define _GMP_EQUAL_INT_728_728 ,
+#define _GMP_EQUAL_INT_729_729 ,
+#define _GMP_EQUAL_INT_730_730 ,
+#define _GMP_EQUAL_INT_731_731 ,
+#define _GMP_EQUAL_INT_732_732 ,
+#define _GMP_EQUAL_INT_733_733 ,
+#define _GMP_EQUAL_INT_734_734 ,
+#define _GMP_EQUAL_INT_735_735 ,
+#define _GMP_EQUAL_INT_736_736 ,
+#define _GMP_EQUAL_INT_737_737 ,
+#define _GMP_EQUAL_INT_738_738 ,
+#define _GMP_EQUAL_INT_739_739 ,
+#define _GMP_EQUAL_INT_740_740 ,
+#define _GMP_EQUAL_INT_741_741 ,
+#define _GMP_EQUAL_INT_742_742 ,
+#define _GMP_EQUAL_INT_743_743 ,
+#define _GMP_EQUAL_INT_744_744 ,
+#define _GMP_EQUAL_INT_745_745 ,
+#define _GMP_EQUAL_INT_746_746 ,
+#define _GMP_EQUAL_INT_747_747 ,
+#define _GMP_EQUAL_INT_748_748 ,
+#define _GMP_EQUAL_INT_749_749 ,
+#define _GMP_EQUAL_INT_750_750 ,
+#define _GMP_EQUAL_INT_751_751 ,
+#define _GMP_EQUAL_INT_752_752 ,
+#define _GMP_EQUAL_INT_753_753 ,
+#define _GMP_EQUAL_INT_754_754 ,
+#define _GMP_EQUAL_INT_755_755 ,
+#define _GMP_EQUAL_INT_756_756 ,
+#define _GMP_EQUAL_INT_757_757 ,
+#define _GMP_EQUAL_INT_758_758 ,
+#define _GMP_EQUAL_INT_759_759 ,
+#define _GMP_EQUAL_INT_760_760 ,
+#define _GMP_EQUAL_INT_761_761 ,
+#define _GMP_EQUAL_INT_762_762 ,
+#define _GMP_EQUAL_INT_763_763 ,
+#define _GMP_EQUAL_INT_764_764 ,
+#define _GMP_EQUAL_INT_765_765 ,
+#define _GMP_EQUAL_INT_766_766 ,
+#define _GMP_EQUAL_INT_767_767 ,
+#define _GMP_EQUAL_INT_768_768 ,
+#define _GMP_EQUAL_INT_769_769 ,
+#define _GMP_EQUAL_INT_770_770 ,
+#define _GMP_EQUAL_INT_771_771 ,
+#define _GMP_EQUAL_INT_772_772 ,
+#define _GMP_EQUAL_INT_773_773 ,
+#define _GMP_EQUAL_INT_774_774 ,
+#define _GMP_EQUAL_INT_775_775 ,
+#define _GMP_EQUAL_INT_776_776 ,
+#define _GMP_EQUAL_INT_777_777 ,
+#define _GMP_EQUAL_INT_778_778 ,
+#define _GMP_EQUAL_INT_779_779 ,
+#define _GMP_EQUAL_INT_780_780 ,
+#define _GMP_EQUAL_INT_781_781 ,
+#define _GMP_EQUAL_INT_782_782 ,
+#define _GMP_EQUAL_INT_783_783 ,
+#define _GMP_EQUAL_INT_784_784 ,
+#define _GMP_EQUAL_INT_785_785 ,
+#define _GMP_EQUAL_INT_786_786 ,
+#define _GMP_EQUAL_INT_787_787 ,
+#define _GMP_EQUAL_INT_788_788 ,
+#define _GMP_EQUAL_INT_789_789 ,
+#define _GMP_EQUAL_INT_790_790 ,
+#define _GMP_EQUAL_INT_791_791 ,
+#define _GMP_EQUAL_INT_792_792 ,
+#define _GMP_EQUAL_INT_793_793 ,
+#define _GMP_EQUAL_INT_794_794 ,
+#define _GMP_EQUAL_INT_795_795 ,
+#define _GMP_EQUAL_INT_796_796 ,
+#define _GMP_EQUAL_INT_797_797 ,
+#define _GMP_EQUAL_INT_798_798 ,
+#define _GMP_EQUAL_INT_799_799 ,
+#define _GMP_EQUAL_INT_800_800 ,
+#define _GMP_EQUAL_INT_801_801 ,
+#define _GMP_EQUAL_INT_802_802 ,
+#define _GMP_EQUAL_INT_803_803 ,
+#define _GMP_EQUAL_INT_804_804 ,
+#define _GMP_EQUAL_INT_805_805 ,
+#define _GMP_EQUAL_INT_806_806 ,
+#define _GMP_EQUAL_INT_807_807 ,
+#define _GMP_EQUAL_INT_808_808 ,
+#define _GMP_EQUAL_INT_809_809 ,
+#define _GMP_EQUAL_INT_810_810 ,
+#define _GMP_EQUAL_INT_811_811 ,
+#define _GMP_EQUAL_INT_812_812 ,
+#define _GMP_EQUAL_INT_813_813 ,
+#define _GMP_EQUAL_INT_814_814 ,
+#define _GMP_EQUAL_INT_815_815 ,
+#define _GMP_EQUAL_INT_816_816 ,
+#define _GMP_EQUAL_INT_817_817 ,
+#define _GMP_EQUAL_INT_818_818 ,
+#define _GMP_EQUAL_INT_819_819 ,
+#define _GMP_EQUAL_INT_820_820 ,
+#define _GMP_EQUAL_INT_821_821 ,
+#define _GMP_EQUAL_INT_822_822 ,
+#define _GMP_EQUAL_INT_823_823 ,
+#define _GMP_EQUAL_INT_824_824 ,
+#define _GMP_EQUAL_INT_825_825 ,
+#define _GMP_EQUAL_INT_826_826 ,
+#define _GMP_EQUAL_INT_827_827 ,
+#define _GMP_EQUAL_INT_828_828 ,
+#define _GMP_EQUAL_INT_829_829 ,
+#define _GMP_EQUAL_INT_830_830 ,
+#define _GMP_EQUAL_INT_831_831 ,
+#define _GMP_EQUAL_INT_832_832 ,
+#define _GMP_EQUAL_INT_833_833 ,
+#define _GMP_EQUAL_INT_834_834 ,
+#define _GMP_EQUAL_INT_835_835 ,
+#define _GMP_EQUAL_INT_836_836 ,
+#define _GMP_EQUAL_INT_837_837 ,
+#define _GMP_EQUAL_INT_838_838 ,
+#define _GMP_EQUAL_INT_839_839 ,
+#define _GMP_EQUAL_INT_840_840 ,
+#define _GMP_EQUAL_INT_841_841 ,
+#define _GMP_EQUAL_INT_842_842 ,
+#define _GMP_EQUAL_INT_843_843 ,
+#define _GMP_EQUAL_INT_844_844 ,
+#define _GMP_EQUAL_INT_845_845 ,
+#define _GMP_EQUAL_INT_846_846 ,
+#define _GMP_EQUAL_INT_847_847 ,
+#define _GMP_EQUAL_INT_848_848 ,
+#define _GMP_EQUAL_INT_849_849 ,
+#define _GMP_EQUAL_INT_850_850 ,
+#define _GMP_EQUAL_INT_851_851 ,
+#define _GMP_EQUAL_INT_852_852 ,
+#define _GMP_EQUAL_INT_853_853 ,
+#define _GMP_EQUAL_INT_854_854 ,
+#define _GMP_EQUAL_INT_855_855 ,
+#define _GMP_EQUAL_INT_856_856 ,
+#define _GMP_EQUAL_INT_857_857 ,
+#define _GMP_EQUAL_INT_858_858 ,
+#define _GMP_EQUAL_INT_859_859 ,
+#define _GMP_EQUAL_INT_860_860 ,
+#define _GMP_EQUAL_INT_861_861 ,
+#define _GMP_EQUAL_INT_862_862 ,
+#define _GMP_EQUAL_INT_863_863 ,
+#define _GMP_EQUAL_INT_864_864 ,
+#define _GMP_EQUAL_INT_865_865 ,
+#define _GMP_EQUAL_INT_866_866 ,
+#define _GMP_EQUAL_INT_867_867 ,
+#define _GMP_EQUAL_INT_868_868 ,
+#define _GMP_EQUAL_INT_869_869 ,
+#define _GMP_EQUAL_INT_870_870 ,
+#define _GMP_EQUAL_INT_871_871 ,
+#define _GMP_EQUAL_INT_872_872 ,
+#define _GMP_EQUAL_INT_873_873 ,
+#define _GMP_EQUAL_INT_874_874 ,
+#define _GMP_EQUAL_INT_875_875 ,
+#define _GMP_EQUAL_INT_876_876 ,
+#define _GMP_EQUAL_INT_877_877 ,
+#define _GMP_EQUAL_INT_878_878 ,
+#define _GMP_EQUAL_INT_879_879 ,
+#define _GMP_EQUAL_INT_880_880 ,
+#define _GMP_EQUAL_INT_881_881 ,
+#define _GMP_EQUAL_INT_882_882 ,
+#define _GMP_EQUAL_INT_883_883 ,
+#define _GMP_EQUAL_INT_884_884 ,
+#define _GMP_EQUAL_INT_885_885 ,
+#define _GMP_EQUAL_INT_886_886 ,
+#define _GMP_EQUAL_INT_887_887 ,
+#define _GMP_EQUAL_INT_888_888 ,
+#define _GMP_EQUAL_INT_889_889 ,
+#define _GMP_EQUAL_INT_890_890 ,
+#define _GMP_EQUAL_INT_891_891 ,
+#define _GMP_EQUAL_INT_892_892 ,
+#define _GMP_EQUAL_INT_893_893 ,
+#define _GMP_EQUAL_INT_894_894 ,
+#define _GMP_EQUAL_INT_895_895 ,
+#define _GMP_EQUAL_INT_896_896 ,
+#define _GMP_EQUAL_INT_897_897 ,
+#define _GMP_EQUAL_INT_898_898 ,
+#define _GMP_EQUAL_INT_899_899 ,
+#define _GMP_EQUAL_INT_900_900 ,
+#define _GMP_EQUAL_INT_901_901 ,
+#define _GMP_EQUAL_INT_902_902 ,
+#define _GMP_EQUAL_INT_903_903 ,
+#define _GMP_EQUAL_INT_904_904 ,
+#define _GMP_EQUAL_INT_905_905 ,
+#define _GMP_EQUAL_INT_906_906 ,
+#define _GMP_EQUAL_INT_907_907 ,
+#define _GMP_EQUAL_INT_908_908 ,
+#define _GMP_EQUAL_INT_909_909 ,
+#define _GMP_EQUAL_INT_910_910 ,
+#define _GMP_EQUAL_INT_911_911 ,
+#define _GMP_EQUAL_INT_912_912 ,
+#define _GMP_EQUAL_INT_913_913 ,
+#define _GMP_EQUAL_INT_914_914 ,
+#define _GMP_EQUAL_INT_915_915 ,
+#define _GMP_EQUAL_INT_916_916 ,
+#define _GMP_EQUAL_INT_917_917 ,
+#define _GMP_EQUAL_INT_918_918 ,
+#define _GMP_EQUAL_INT_919_919 ,
+#define _GMP_EQUAL_INT_920_920 ,
+#define _GMP_EQUAL_INT_921_921 ,
+#define _GMP_EQUAL_INT_922_922 ,
+#define _GMP_EQUAL_INT_923_923 ,
+#define _GMP_EQUAL_INT_924_924 ,
+#define _GMP_EQUAL_INT_925_925 ,
+#define _GMP_EQUAL_INT_926_926 ,
+#define _GMP_EQUAL_INT_927_927 ,
+#define _GMP_EQUAL_INT_928_928 ,
+#define _GMP_EQUAL_INT_929_929 ,
+#define _GMP_EQUAL_INT_930_930 ,
+#define _GMP_EQUAL_INT_931_931 ,
+#define _GMP_EQUAL_INT_932_932 ,
+#define _GMP_EQUAL_INT_933_933 ,
+#define _GMP_EQUAL_INT_934_934 ,
+#define _GMP_EQUAL_INT_935_935 ,
+#define _GMP_EQUAL_INT_936_936 ,
+#define _GMP_EQUAL_INT_937_937 ,
+#define _GMP_EQUAL_INT_938_938 ,
+#define _GMP_EQUAL_INT_939_939 ,
+#define _GMP_EQUAL_INT_940_940 ,
+#define _GMP_EQUAL_INT_941_941 ,
+#define _GMP_EQUAL_INT_942_942 ,
+#define _GMP_EQUAL_INT_943_943 ,
+#define _GMP_EQUAL_INT_944_944 ,
+#define _GMP_EQUAL_INT_945_945 ,
+#define _GMP_EQUAL_INT_946_946 ,
+#define _GMP_EQUAL_INT_947_947 ,
+#define _GMP_EQUAL_INT_948_948 ,
+#define _GMP_EQUAL_INT_949_949 ,
+#define _GMP_EQUAL_INT_950_950 ,
+#define _GMP_EQUAL_INT_951_951 ,
+#define _GMP_EQUAL_INT_952_952 ,
+#define _GMP_EQUAL_INT_953_953 ,
+#define _GMP_EQUAL_INT_954_954 ,
+#define _GMP_EQUAL_INT_955_955 ,
+#define _GMP_EQUAL_INT_956_956 ,
+#define _GMP_EQUAL_INT_957_957 ,
+#define _GMP_EQUAL_INT_958_958 ,
+#define _GMP_EQUAL_INT_959_959 ,
+#define _GMP_EQUAL_INT_960_960 ,
+#define _GMP_EQUAL_INT_961_961 ,
+#define _GMP_EQUAL_INT_962_962 ,
+#define _GMP_EQUAL_INT_963_963 ,
+#define _GMP_EQUAL_INT_964_964 ,
+#define _GMP_EQUAL_INT_965_965 ,
+#define _GMP_EQUAL_INT_966_966 ,
+#define _GMP_EQUAL_INT_967_967 ,
+#define _GMP_EQUAL_INT_968_968 ,
+#define _GMP_EQUAL_INT_969_969 ,
+#define _GMP_EQUAL_INT_970_970 ,
+#define _GMP_EQUAL_INT_971_971 ,
+#define _GMP_EQUAL_INT_972_972 ,
+#define _GMP_EQUAL_INT_973_973 ,
+#define _GMP_EQUAL_INT_974_974 ,
+#define _GMP_EQUAL_INT_975_975 ,
+#define _GMP_EQUAL_INT_976_976 ,
+#define _GMP_EQUAL_INT_977_977 ,
+#define _GMP_EQUAL_INT_978_978 ,
+#define _GMP_EQUAL_INT_979_979 ,
+#define _GMP_EQUAL_INT_980_980 ,
+#define _GMP_EQUAL_INT_981_981 ,
+#define _GMP_EQUAL_INT_982_982 ,
+#define _GMP_EQUAL_INT_983_983 ,
+#define _GMP_EQUAL_INT_984_984 ,
+#define _GMP_EQUAL_INT_985_985 ,
+#define _GMP_EQUAL_INT_986_986 ,
+#define _GMP_EQUAL_INT_987_987 ,
+#define _GMP_EQUAL_INT_988_988 ,
+#define _GMP_EQUAL_INT_989_989 ,
+#define _GMP_EQUAL_INT_990_990 ,
+#define _GMP_EQUAL_INT_991_991 ,
+#define _GMP_EQUAL_INT_992_992 ,
+#define _GMP_EQUAL_INT_993_993 ,
+#define _GMP_EQUAL_INT_994_994 ,
+#define _GMP_EQUAL_INT_995_995 ,
+#define _GMP_EQUAL_INT_996_996 ,
+#define _GMP_EQUAL_INT_997_997 ,
+#define _GMP_EQUAL_INT_998_998 ,
+#define _GMP_EQUAL_INT_999_999 ,
+#define _GMP_EQUAL_INT_1000_1000 ,
+#define _GMP_EQUAL_INT_1001_1001 ,
+#define _GMP_EQUAL_INT_1002_1002 ,
+#define _GMP_EQUAL_INT_1003_1003 ,
+#define _GMP_EQUAL_INT_1004_1004 ,
+#define _GMP_EQUAL_INT_1005_1005 ,
+#define _GMP_EQUAL_INT_1006_1006 ,
+#define _GMP_EQUAL_INT_1007_1007 ,
+#define _GMP_EQUAL_INT_1008_1008 ,
+#define _GMP_EQUAL_INT_1009_1009 ,
+#define _GMP_EQUAL_INT_1010_1010 ,
+#define _GMP_EQUAL_INT_1011_1011 ,
+#define _GMP_EQUAL_INT_1012_1012 ,
+#define _GMP_EQUAL_INT_1013_1013 ,
+#define _GMP_EQUAL_INT_1014_1014 ,
+#define _GMP_EQUAL_INT_1015_1015 ,
+#define _GMP_EQUAL_INT_1016_1016 ,
+#define _GMP_EQUAL_INT_1017_1017 ,
+#define _GMP_EQUAL_INT_1018_1018 ,
+#define _GMP_EQUAL_INT_1019_1019 ,
+#define _GMP_EQUAL_INT_1020_1020 ,
+#define _GMP_EQUAL_INT_1021_1021 ,
+#define _GMP_EQUAL_INT_1022_1022 ,
+#define _GMP_EQUAL_INT_1023_1023 ,
+#define _GMP_EQUAL_INT_1024_1024 ,
+
+#endif // GMP_MACRO_LIMITS_ARITH_1024_HPP_
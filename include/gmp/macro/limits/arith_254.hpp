@@ -0,0 +1,1293 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_ARITH_254_HPP_
+#define GMP_MACRO_LIMITS_ARITH_254_HPP_
+
+// GMP_INC
+#define _GMP_INC_0() 1
+#define _GMP_INC_1() 2
+#define _GMP_INC_2() 3
+#define _GMP_INC_3() 4
+#define _GMP_INC_4() 5
+#define _GMP_INC_5() 6
+#define _GMP_INC_6() 7
+#define _GMP_INC_7() 8
+#define _GMP_INC_8() 9
+#define _GMP_INC_9() 10
+#define _GMP_INC_10() 11
+#define _GMP_INC_11() 12
+#define _GMP_INC_12() 13
+#define _GMP_INC_13() 14
+#define _GMP_INC_14() 15
+#define _GMP_INC_15() 16
+#define _GMP_INC_16() 17
+#define _GMP_INC_17() 18
+#define _GMP_INC_18() 19
+#define _GMP_INC_19() 20
+#define _GMP_INC_20() 21
+#define _GMP_INC_21() 22
+#define _GMP_INC_22() 23
+#define _GMP_INC_23() 24
+#define _GMP_INC_24() 25
+#define _GMP_INC_25() 26
+#define _GMP_INC_26() 27
+#define _GMP_INC_27() 28
+#define _GMP_INC_28() 29
+#define _GMP_INC_29() 30
+#define _GMP_INC_30() 31
+#define _GMP_INC_31() 32
+#define _GMP_INC_32() 33
+#define _GMP_INC_33() 34
+#define _GMP_INC_34() 35
+#define _GMP_INC_35() 36
+#define _GMP_INC_36() 37
+#define _GMP_INC_37() 38
+#define _GMP_INC_38() 39
+#define _GMP_INC_39() 40
+#define _GMP_INC_40() 41
+#define _GMP_INC_41() 42
+#define _GMP_INC_42() 43
+#define _GMP_INC_43() 44
+#define _GMP_INC_44() 45
+#define _GMP_INC_45() 46
+#define _GMP_INC_46() 47
+#define _GMP_INC_47() 48
+#define _GMP_INC_48() 49
+#define _GMP_INC_49() 50
+#define _GMP_INC_50() 51
+#define _GMP_INC_51() 52
+#define _GMP_INC_52() 53
+#define _GMP_INC_53() 54
+#define _GMP_INC_54() 55
+#define _GMP_INC_55() 56
+#define _GMP_INC_56() 57
+#define _GMP_INC_57() 58
+#define _GMP_INC_58() 59
+#define _GMP_INC_59() 60
+#define _GMP_INC_60() 61
+#define _GMP_INC_61() 62
+#define _GMP_INC_62() 63
+#define _GMP_INC_63() 64
+#define _GMP_INC_64() 65
+#define _GMP_INC_65() 66
+#define _GMP_INC_66() 67
+#define _GMP_INC_67() 68
+#define _GMP_INC_68() 69
+#define _GMP_INC_69() 70
+#define _GMP_INC_70() 71
+#define _GMP_INC_71() 72
+#define _GMP_INC_72() 73
+#define _GMP_INC_73() 74
+#define _GMP_INC_74() 75
+#define _GMP_INC_75() 76
+#define _GMP_INC_76() 77
+#define _GMP_INC_77() 78
+#define _GMP_INC_78() 79
+#define _GMP_INC_79() 80
+#define _GMP_INC_80() 81
+#define _GMP_INC_81() 82
+#define _GMP_INC_82() 83
+#define _GMP_INC_83() 84
+#define _GMP_INC_84() 85
+#define _GMP_INC_85() 86
+#define _GMP_INC_86() 87
+#define _GMP_INC_87() 88
+#define _GMP_INC_88() 89
+#define _GMP_INC_89() 90
+#define _GMP_INC_90() 91
+#define _GMP_INC_91() 92
+#define _GMP_INC_92() 93
+#define _GMP_INC_93() 94
+#define _GMP_INC_94() 95
+#define _GMP_INC_95() 96
+#define _GMP_INC_96() 97
+#define _GMP_INC_97() 98
+#define _GMP_INC_98() 99
+#define _GMP_INC_99() 100
+#define _GMP_INC_100() 101
+#define _GMP_INC_101() 102
+#define _GMP_INC_102() 103
+#define _GMP_INC_103() 104
+#define _GMP_INC_104() 105
+#define _GMP_INC_105() 106
+#define _GMP_INC_106() 107
+#define _GMP_INC_107() 108
+#define _GMP_INC_108() 109
+#define _GMP_INC_109() 110
+#define _GMP_INC_110() 111
+#define _GMP_INC_111() 112
+#define _GMP_INC_112() 113
+#define _GMP_INC_113() 114
+#define _GMP_INC_114() 115
+#define _GMP_INC_115() 116
+#define _GMP_INC_116() 117
+#define _GMP_INC_117() 118
+#define _GMP_INC_118() 119
+#define _GMP_INC_119() 120
+#define _GMP_INC_120() 121
+#define _GMP_INC_121() 122
+#define _GMP_INC_122() 123
+#define _GMP_INC_123() 124
+#define _GMP_INC_124() 125
+#define _GMP_INC_125() 126
+#define _GMP_INC_126() 127
+#define _GMP_INC_127() 128
+#define _GMP_INC_128() 129
+#define _GMP_INC_129() 130
+#define _GMP_INC_130() 131
+#define _GMP_INC_131() 132
+#define _GMP_INC_132() 133
+#define _GMP_INC_133() 134
+#define _GMP_INC_134() 135
+#define _GMP_INC_135() 136
+#define _GMP_INC_136() 137
+#define _GMP_INC_137() 138
+#define _GMP_INC_138() 139
+#define _GMP_INC_139() 140
+#define _GMP_INC_140() 141
+#define _GMP_INC_141() 142
+#define _GMP_INC_142() 143
+#define _GMP_INC_143() 144
+#define _GMP_INC_144() 145
+#define _GMP_INC_145() 146
+#define _GMP_INC_146() 147
+#define _GMP_INC_147() 148
+#define _GMP_INC_148() 149
+#define _GMP_INC_149() 150
+#define _GMP_INC_150() 151
+#define _GMP_INC_151() 152
+#define _GMP_INC_152() 153
+#define _GMP_INC_153() 154
+#define _GMP_INC_154() 155
+#define _GMP_INC_155() 156
+#define _GMP_INC_156() 157
+#define _GMP_INC_157() 158
+#define _GMP_INC_158() 159
+#define _GMP_INC_159() 160
+#define _GMP_INC_160() 161
+#define _GMP_INC_161() 162
+#define _GMP_INC_162() 163
+#define _GMP_INC_163() 164
+#define _GMP_INC_164() 165
+#define _GMP_INC_165() 166
+#define _GMP_INC_166() 167
+#define _GMP_INC_167() 168
+#define _GMP_INC_168() 169
+#define _GMP_INC_169() 170
+#define _GMP_INC_170() 171
+#define _GMP_INC_171() 172
+#define _GMP_INC_172() 173
+#define _GMP_INC_173() 174
+#define _GMP_INC_174() 175
+#define _GMP_INC_175() 176
+#define _GMP_INC_176() 177
+#define _GMP_INC_177() 178
+#define _GMP_INC_178() 179
+#define _GMP_INC_179() 180
+#define _GMP_INC_180() 181
+#define _GMP_INC_181() 182
+#define _GMP_INC_182() 183
+#define _GMP_INC_183() 184
+#define _GMP_INC_184() 185
+#define _GMP_INC_185() 186
+#define _GMP_INC_186() 187
+#define _GMP_INC_187() 188
+#define _GMP_INC_188() 189
+#define _GMP_INC_189() 190
+#define _GMP_INC_190() 191
+#define _GMP_INC_191() 192
+#define _GMP_INC_192() 193
+#define _GMP_INC_193() 194
+#define _GMP_INC_194() 195
+#define _GMP_INC_195() 196
+#define _GMP_INC_196() 197
+#define _GMP_INC_197() 198
+#define _GMP_INC_198() 199
+#define _GMP_INC_199() 200
+#define _GMP_INC_200() 201
+#define _GMP_INC_201() 202
+#define _GMP_INC_202() 203
+#define _GMP_INC_203() 204
+#define _GMP_INC_204() 205
+#define _GMP_INC_205() 206
+#define _GMP_INC_206() 207
+#define _GMP_INC_207() 208
+#define _GMP_INC_208() 209
+#define _GMP_INC_209() 210
+#define _GMP_INC_210() 211
+#define _GMP_INC_211() 212
+#define _GMP_INC_212() 213
+#define _GMP_INC_213() 214
+#define _GMP_INC_214() 215
+#define _GMP_INC_215() 216
+#define _GMP_INC_216() 217
+#define _GMP_INC_217() 218
+#define _GMP_INC_218() 219
+#define _GMP_INC_219() 220
+#define _GMP_INC_220() 221
+#define _GMP_INC_221() 222
+#define _GMP_INC_222() 223
+#define _GMP_INC_223() 224
+#define _GMP_INC_224() 225
+#define _GMP_INC_225() 226
+#define _GMP_INC_226() 227
+#define _GMP_INC_227() 228
+#define _GMP_INC_228() 229
+#define _GMP_INC_229() 230
+#define _GMP_INC_230() 231
+#define _GMP_INC_231() 232
+#define _GMP_INC_232() 233
+#define _GMP_INC_233() 234
+#define _GMP_INC_234() 235
+#define _GMP_INC_235() 236
+#define _GMP_INC_236() 237
+#define _GMP_INC_237() 238
+#define _GMP_INC_238() 239
+#define _GMP_INC_239() 240
+#define _GMP_INC_240() 241
+#define _GMP_INC_241() 242
+#define _GMP_INC_242() 243
+#define _GMP_INC_243() 244
+#define _GMP_INC_244() 245
+#define _GMP_INC_245() 246
+#define _GMP_INC_246() 247
+#define _GMP_INC_247() 248
+#define _GMP_INC_248() 249
+#define _GMP_INC_249() 250
+#define _GMP_INC_250() 251
+#define _GMP_INC_251() 252
+#define _GMP_INC_252() 253
+#define _GMP_INC_253() 254
+#define _GMP_INC_254() 255
+#define _GMP_INC_255() 256
+
+// GMP_DEC
+#define _GMP_DEC_1() 0
+#define _GMP_DEC_2() 1
+#define _GMP_DEC_3() 2
+#define _GMP_DEC_4() 3
+#define _GMP_DEC_5() 4
+#define _GMP_DEC_6() 5
+#define _GMP_DEC_7() 6
+#define _GMP_DEC_8() 7
+#define _GMP_DEC_9() 8
+#define _GMP_DEC_10() 9
+#define _GMP_DEC_11() 10
+#define _GMP_DEC_12() 11
+#define _GMP_DEC_13() 12
+#define _GMP_DEC_14() 13
+#define _GMP_DEC_15() 14
+#define _GMP_DEC_16() 15
+#define _GMP_DEC_17() 16
+#define _GMP_DEC_18() 17
+#define _GMP_DEC_19() 18
+#define _GMP_DEC_20() 19
+#define _GMP_DEC_21() 20
+#define _GMP_DEC_22() 21
+#define _GMP_DEC_23() 22
+#define _GMP_DEC_24() 23
+#define _GMP_DEC_25() 24
+#define _GMP_DEC_26() 25
+#define _GMP_DEC_27() 26
+#define _GMP_DEC_28() 27
+#define _GMP_DEC_29() 28
+#define _GMP_DEC_30() 29
+#define _GMP_DEC_31() 30
+#define _GMP_DEC_32() 31
+#define _GMP_DEC_33() 32
+#define _GMP_DEC_34() 33
+#define _GMP_DEC_35() 34
+#define _GMP_DEC_36() 35
+#define _GMP_DEC_37() 36
+#define _GMP_DEC_38() 37
+#define _GMP_DEC_39() 38
+#define _GMP_DEC_40() 39
+#define _GMP_DEC_41() 40
+#define _GMP_DEC_42() 41
+#define _GMP_DEC_43() 42
+#define _GMP_DEC_44() 43
+#define _GMP_DEC_45() 44
+#define _GMP_DEC_46() 45
+#define _GMP_DEC_47() 46
+#define _GMP_DEC_48() 47
+#define _GMP_DEC_49() 48
+#define _GMP_DEC_50() 49
+#define _GMP_DEC_51() 50
+#define _GMP_DEC_52() 51
+#define _GMP_DEC_53() 52
+#define _GMP_DEC_54() 53
+#define _GMP_DEC_55() 54
+#define _GMP_DEC_56() 55
+#define _GMP_DEC_57() 56
+#define _GMP_DEC_58() 57
+#define _GMP_DEC_59() 58
+#define _GMP_DEC_60() 59
+#define _GMP_DEC_61() 60
+#define _GMP_DEC_62() 61
+#define _GMP_DEC_63() 62
+#define _GMP_DEC_64() 63
+#define _GMP_DEC_65() 64
+#define _GMP_DEC_66() 65
+#define _GMP_DEC_67() 66
+#define _GMP_DEC_68() 67
+#define _GMP_DEC_69() 68
+#define _GMP_DEC_70() 69
+#define _GMP_DEC_71() 70
+#define _GMP_DEC_72() 71
+#define _GMP_DEC_73() 72
+#define _GMP_DEC_74() 73
+#define _GMP_DEC_75() 74
+#define _GMP_DEC_76() 75
+#define _GMP_DEC_77() 76
+#define _GMP_DEC_78() 77
+#define _GMP_DEC_79() 78
+#define _GMP_DEC_80() 79
+#define _GMP_DEC_81() 80
+#define _GMP_DEC_82() 81
+#define _GMP_DEC_83() 82
+#define _GMP_DEC_84() 83
+#define _GMP_DEC_85() 84
+#define _GMP_DEC_86() 85
+#define _GMP_DEC_87() 86
+#define _GMP_DEC_88() 87
+#define _GMP_DEC_89() 88
+#define _GMP_DEC_90() 89
+#define _GMP_DEC_91() 90
+#define _GMP_DEC_92() 91
+#define _GMP_DEC_93() 92
+#define _GMP_DEC_94() 93
+#define _GMP_DEC_95() 94
+#define _GMP_DEC_96() 95
+#define _GMP_DEC_97() 96
+#define _GMP_DEC_98() 97
+#define _GMP_DEC_99() 98
+#define _GMP_DEC_100() 99
+#define _GMP_DEC_101() 100
+#define _GMP_DEC_102() 101
+#define _GMP_DEC_103() 102
+#define _GMP_DEC_104() 103
+#define _GMP_DEC_105() 104
+#define _GMP_DEC_106() 105
+#define _GMP_DEC_107() 106
+#define _GMP_DEC_108() 107
+#define _GMP_DEC_109() 108
+#define _GMP_DEC_110() 109
+#define _GMP_DEC_111() 110
+#define _GMP_DEC_112() 111
+#define _GMP_DEC_113() 112
+#define _GMP_DEC_114() 113
+#define _GMP_DEC_115() 114
+#define _GMP_DEC_116() 115
+#define _GMP_DEC_117() 116
+#define _GMP_DEC_118() 117
+#define _GMP_DEC_119() 118
+#define _GMP_DEC_120() 119
+#define _GMP_DEC_121() 120
+#define _GMP_DEC_122() 121
+#define _GMP_DEC_123() 122
+#define _GMP_DEC_124() 123
+#define _GMP_DEC_125() 124
+#define _GMP_DEC_126() 125
+#define _GMP_DEC_127() 126
+#define _GMP_DEC_128() 127
+#define _GMP_DEC_129() 128
+#define _GMP_DEC_130() 129
+#define _GMP_DEC_131() 130
+#define _GMP_DEC_132() 131
+#define _GMP_DEC_133() 132
+#define _GMP_DEC_134() 133
+#define _GMP_DEC_135() 134
+#define _GMP_DEC_136() 135
+#define _GMP_DEC_137() 136
+#define _GMP_DEC_138() 137
+#define _GMP_DEC_139() 138
+#define _GMP_DEC_140() 139
+#define _GMP_DEC_141() 140
+#define _GMP_DEC_142() 141
+#define _GMP_DEC_143() 142
+#define _GMP_DEC_144() 143
+#define _GMP_DEC_145() 144
+#define _GMP_DEC_146() 145
+#define _GMP_DEC_147() 146
+#define _GMP_DEC_148() 147
+#define _GMP_DEC_149() 148
+#define _GMP_DEC_150() 149
+#define _GMP_DEC_151() 150
+#define _GMP_DEC_152() 151
+#define _GMP_DEC_153() 152
+#define _GMP_DEC_154() 153
+#define _GMP_DEC_155() 154
+#define _GMP_DEC_156() 155
+#define _GMP_DEC_157() 156
+#define _GMP_DEC_158() 157
+#define _GMP_DEC_159() 158
+#define _GMP_DEC_160() 159
+#define _GMP_DEC_161() 160
+#define _GMP_DEC_162() 161
+#define _GMP_DEC_163() 162
+#define _GMP_DEC_164() 163
+#define _GMP_DEC_165() 164
+#define _GMP_DEC_166() 165
+#define _GMP_DEC_167() 166
+#define _GMP_DEC_168() 167
+#define _GMP_DEC_169() 168
+#define _GMP_DEC_170() 169
+#define _GMP_DEC_171() 170
+#define _GMP_DEC_172() 171
+#define _GMP_DEC_173() 172
+#define _GMP_DEC_174() 173
+#define _GMP_DEC_175() 174
+#define _GMP_DEC_176() 175
+#define _GMP_DEC_177() 176
+#define _GMP_DEC_178() 177
+#define _GMP_DEC_179() 178
+#define _GMP_DEC_180() 179
+#define _GMP_DEC_181() 180
+#define _GMP_DEC_182() 181
+#define _GMP_DEC_183() 182
+#define _GMP_DEC_184() 183
+#define _GMP_DEC_185() 184
+#define _GMP_DEC_186() 185
+#define _GMP_DEC_187() 186
+#define _GMP_DEC_188() 187
+#define _GMP_DEC_189() 188
+#define _GMP_DEC_190() 189
+#define _GMP_DEC_191() 190
+#define _GMP_DEC_192() 191
+#define _GMP_DEC_193() 192
+#define _GMP_DEC_194() 193
+#define _GMP_DEC_195() 194
+#define _GMP_DEC_196() 195
+#define _GMP_DEC_197() 196
+#define _GMP_DEC_198() 197
+#define _GMP_DEC_199() 198
+#define _GMP_DEC_200() 199
+#define _GMP_DEC_201() 200
+#define _GMP_DEC_202() 201
+#define _GMP_DEC_203() 202
+#define _GMP_DEC_204() 203
+#define _GMP_DEC_205() 204
+#define _GMP_DEC_206() 205
+#define _GMP_DEC_207() 206
+#define _GMP_DEC_208() 207
+#define _GMP_DEC_209() 208
+#define _GMP_DEC_210() 209
+#define _GMP_DEC_211() 210
+#define _GMP_DEC_212() 211
+#define _GMP_DEC_213() 212
+#define _GMP_DEC_214() 213
+#define _GMP_DEC_215() 214
+#define _GMP_DEC_216() 215
+#define _GMP_DEC_217() 216
+#define _GMP_DEC_218() 217
+#define _GMP_DEC_219() 218
+#define _GMP_DEC_220() 219
+#define _GMP_DEC_221() 220
+#define _GMP_DEC_222() 221
+#define _GMP_DEC_223() 222
+#define _GMP_DEC_224() 223
+#define _GMP_DEC_225() 224
+#define _GMP_DEC_226() 225
+#define _GMP_DEC_227() 226
+#define _GMP_DEC_228() 227
+#define _GMP_DEC_229() 228
+#define _GMP_DEC_230() 229
+#define _GMP_DEC_231() 230
+#define _GMP_DEC_232() 231
+#define _GMP_DEC_233() 232
+#define _GMP_DEC_234() 233
+#define _GMP_DEC_235() 234
+#define _GMP_DEC_236() 235
+#define _GMP_DEC_237() 236
+#define _GMP_DEC_238() 237
+#define _GMP_DEC_239() 238
+#define _GMP_DEC_240() 239
+#define _GMP_DEC_241() 240
+#define _GMP_DEC_242() 241
+#define _GMP_DEC_243() 242
+#define _GMP_DEC_244() 243
+#define _GMP_DEC_245() 244
+#define _GMP_DEC_246() 245
+#define _GMP_DEC_247() 246
+#define _GMP_DEC_248() 247
+#define _GMP_DEC_249() 248
+#define _GMP_DEC_250() 249
+#define _GMP_DEC_251() 250
+#define _GMP_DEC_252() 251
+#define _GMP_DEC_253() 252
+#define _GMP_DEC_254() 253
+#define _GMP_DEC_255() 254
+
+// GMP_BOOL
+#define _GMP_BOOL_0 0
+#define _GMP_BOOL_1 1
+#define _GMP_BOOL_2 1
+#define _GMP_BOOL_3 1
+#define _GMP_BOOL_4 1
+#define _GMP_BOOL_5 1
+#define _GMP_BOOL_6 1
+#define _GMP_BOOL_7 1
+#define _GMP_BOOL_8 1
+#define _GMP_BOOL_9 1
+#define _GMP_BOOL_10 1
+#define _GMP_BOOL_11 1
+#define _GMP_BOOL_12 1
+#define _GMP_BOOL_13 1
+#define _GMP_BOOL_14 1
+#define _GMP_BOOL_15 1
+#define _GMP_BOOL_16 1
+#define _GMP_BOOL_17 1
+#define _GMP_BOOL_18 1
+#define _GMP_BOOL_19 1
+#define _GMP_BOOL_20 1
+#define _GMP_BOOL_21 1
+#define _GMP_BOOL_22 1
+#define _GMP_BOOL_23 1
+#define _GMP_BOOL_24 1
+#define _GMP_BOOL_25 1
+#define _GMP_BOOL_26 1
+#define _GMP_BOOL_27 1
+#define _GMP_BOOL_28 1
+#define _GMP_BOOL_29 1
+#define _GMP_BOOL_30 1
+#define _GMP_BOOL_31 1
+#define _GMP_BOOL_32 1
+#define _GMP_BOOL_33 1
+#define _GMP_BOOL_34 1
+#define _GMP_BOOL_35 1
+#define _GMP_BOOL_36 1
+#define _GMP_BOOL_37 1
+#define _GMP_BOOL_38 1
+#define _GMP_BOOL_39 1
+#define _GMP_BOOL_40 1
+#define _GMP_BOOL_41 1
+#define _GMP_BOOL_42 1
+#define _GMP_BOOL_43 1
+#define _GMP_BOOL_44 1
+#define _GMP_BOOL_45 1
+#define _GMP_BOOL_46 1
+#define _GMP_BOOL_47 1
+#define _GMP_BOOL_48 1
+#define _GMP_BOOL_49 1
+#define _GMP_BOOL_50 1
+#define _GMP_BOOL_51 1
+#define _GMP_BOOL_52 1
+#define _GMP_BOOL_53 1
+#define _GMP_BOOL_54 1
+#define _GMP_BOOL_55 1
+#define _GMP_BOOL_56 1
+#define _GMP_BOOL_57 1
+#define _GMP_BOOL_58 1
+#define _GMP_BOOL_59 1
+#define _GMP_BOOL_60 1
+#define _GMP_BOOL_61 1
+#define _GMP_BOOL_62 1
+#define _GMP_BOOL_63 1
+#define _GMP_BOOL_64 1
+#define _GMP_BOOL_65 1
+#define _GMP_BOOL_66 1
+#define _GMP_BOOL_67 1
+#define _GMP_BOOL_68 1
+#define _GMP_BOOL_69 1
+#define _GMP_BOOL_70 1
+#define _GMP_BOOL_71 1
+#define _GMP_BOOL_72 1
+#define _GMP_BOOL_73 1
+#define _GMP_BOOL_74 1
+#define _GMP_BOOL_75 1
+#define _GMP_BOOL_76 1
+#define _GMP_BOOL_77 1
+#define _GMP_BOOL_78 1
+#define _GMP_BOOL_79 1
+#define _GMP_BOOL_80 1
+#define _GMP_BOOL_81 1
+#define _GMP_BOOL_82 1
+#define _GMP_BOOL_83 1
+#define _GMP_BOOL_84 1
+#define _GMP_BOOL_85 1
+#define _GMP_BOOL_86 1
+#define _GMP_BOOL_87 1
+#define _GMP_BOOL_88 1
+#define _GMP_BOOL_89 1
+#define _GMP_BOOL_90 1
+#define _GMP_BOOL_91 1
+#define _GMP_BOOL_92 1
+#define _GMP_BOOL_93 1
+#define _GMP_BOOL_94 1
+#define _GMP_BOOL_95 1
+#define _GMP_BOOL_96 1
+#define _GMP_BOOL_97 1
+#define _GMP_BOOL_98 1
+#define _GMP_BOOL_99 1
+#define _GMP_BOOL_100 1
+#define _GMP_BOOL_101 1
+#define _GMP_BOOL_102 1
+#define _GMP_BOOL_103 1
+#define _GMP_BOOL_104 1
+#define _GMP_BOOL_105 1
+#define _GMP_BOOL_106 1
+#define _GMP_BOOL_107 1
+#define _GMP_BOOL_108 1
+#define _GMP_BOOL_109 1
+#define _GMP_BOOL_110 1
+#define _GMP_BOOL_111 1
+#define _GMP_BOOL_112 1
+#define _GMP_BOOL_113 1
+#define _GMP_BOOL_114 1
+#define _GMP_BOOL_115 1
+#define _GMP_BOOL_116 1
+#define _GMP_BOOL_117 1
+#define _GMP_BOOL_118 1
+#define _GMP_BOOL_119 1
+#define _GMP_BOOL_120 1
+#define _GMP_BOOL_121 1
+#define _GMP_BOOL_122 1
+#define _GMP_BOOL_123 1
+#define _GMP_BOOL_124 1
+#define _GMP_BOOL_125 1
+#define _GMP_BOOL_126 1
+#define _GMP_BOOL_127 1
+#define _GMP_BOOL_128 1
+#define _GMP_BOOL_129 1
+#define _GMP_BOOL_130 1
+#define _GMP_BOOL_131 1
+#define _GMP_BOOL_132 1
+#define _GMP_BOOL_133 1
+#define _GMP_BOOL_134 1
+#define _GMP_BOOL_135 1
+#define _GMP_BOOL_136 1
+#define _GMP_BOOL_137 1
+#define _GMP_BOOL_138 1
+#define _GMP_BOOL_139 1
+#define _GMP_BOOL_140 1
+#define _GMP_BOOL_141 1
+#define _GMP_BOOL_142 1
+#define _GMP_BOOL_143 1
+#define _GMP_BOOL_144 1
+#define _GMP_BOOL_145 1
+#define _GMP_BOOL_146 1
+#define _GMP_BOOL_147 1
+#define _GMP_BOOL_148 1
+#define _GMP_BOOL_149 1
+#define _GMP_BOOL_150 1
+#define _GMP_BOOL_151 1
+#define _GMP_BOOL_152 1
+#define _GMP_BOOL_153 1
+#define _GMP_BOOL_154 1
+#define _GMP_BOOL_155 1
+#define _GMP_BOOL_156 1
+#define _GMP_BOOL_157 1
+#define _GMP_BOOL_158 1
+#define _GMP_BOOL_159 1
+#define _GMP_BOOL_160 1
+#define _GMP_BOOL_161 1
+#define _GMP_BOOL_162 1
+#define _GMP_BOOL_163 1
+#define _GMP_BOOL_164 1
+#define _GMP_BOOL_165 1
+#define _GMP_BOOL_166 1
+#define _GMP_BOOL_167 1
+#define _GMP_BOOL_168 1
+#define _GMP_BOOL_169 1
+#define _GMP_BOOL_170 1
+#define _GMP_BOOL_171 1
+#define _GMP_BOOL_172 1
+#define _GMP_BOOL_173 1
+#define _GMP_BOOL_174 1
+#define _GMP_BOOL_175 1
+#define _GMP_BOOL_176 1
+#define _GMP_BOOL_177 1
+#define _GMP_BOOL_178 1
+#define _GMP_BOOL_179 1
+#define _GMP_BOOL_180 1
+#define _GMP_BOOL_181 1
+#define _GMP_BOOL_182 1
+#define _GMP_BOOL_183 1
+#define _GMP_BOOL_184 1
+#define _GMP_BOOL_185 1
+#define _GMP_BOOL_186 1
+#define _GMP_BOOL_187 1
+#define _GMP_BOOL_188 1
+#define _GMP_BOOL_189 1
+#define _GMP_BOOL_190 1
+#define _GMP_BOOL_191 1
+#define _GMP_BOOL_192 1
+#define _GMP_BOOL_193 1
+#define _GMP_BOOL_194 1
+#define _GMP_BOOL_195 1
+#define _GMP_BOOL_196 1
+#define _GMP_BOOL_197 1
+#define _GMP_BOOL_198 1
+#define _GMP_BOOL_199 1
+#define _GMP_BOOL_200 1
+#define _GMP_BOOL_201 1
+#define _GMP_BOOL_202 1
+#define _GMP_BOOL_203 1
+#define _GMP_BOOL_204 1
+#define _GMP_BOOL_205 1
+#define _GMP_BOOL_206 1
+#define _GMP_BOOL_207 1
+#define _GMP_BOOL_208 1
+#define _GMP_BOOL_209 1
+#define _GMP_BOOL_210 1
+#define _GMP_BOOL_211 1
+#define _GMP_BOOL_212 1
+#define _GMP_BOOL_213 1
+#define _GMP_BOOL_214 1
+#define _GMP_BOOL_215 1
+#define _GMP_BOOL_216 1
+#define _GMP_BOOL_217 1
+#define _GMP_BOOL_218 1
+#define _GMP_BOOL_219 1
+#define _GMP_BOOL_220 1
+#define _GMP_BOOL_221 1
+#define _GMP_BOOL_222 1
+#define _GMP_BOOL_223 1
+#define _GMP_BOOL_224 1
+#define _GMP_BOOL_225 1
+#define _GMP_BOOL_226 1
+#define _GMP_BOOL_227 1
+#define _GMP_BOOL_228 1
+#define _GMP_BOOL_229 1
+#define _GMP_BOOL_230 1
+#define _GMP_BOOL_231 1
+#define _GMP_BOOL_232 1
+#define _GMP_BOOL_233 1
+#define _GMP_BOOL_234 1
+#define _GMP_BOOL_235 1
+#define _GMP_BOOL_236 1
+#define _GMP_BOOL_237 1
+#define _GMP_BOOL_238 1
+#define _GMP_BOOL_239 1
+#define _GMP_BOOL_240 1
+#define _GMP_BOOL_241 1
+#define _GMP_BOOL_242 1
+#define _GMP_BOOL_243 1
+#define _GMP_BOOL_244 1
+#define _GMP_BOOL_245 1
+#define _GMP_BOOL_246 1
+#define _GMP_BOOL_247 1
+#define _GMP_BOOL_248 1
+#define _GMP_BOOL_249 1
+#define _GMP_BOOL_250 1
+#define _GMP_BOOL_251 1
+#define _GMP_BOOL_252 1
+#define _GMP_BOOL_253 1
+#define _GMP_BOOL_254 1
+#define _GMP_BOOL_255 1
+
+// GMP_CHECK_INDEX
+#define _GMP_CHECK_INDEX_0 ,
+#define _GMP_CHECK_INDEX_1 ,
+#define _GMP_CHECK_INDEX_2 ,
+#define _GMP_CHECK_INDEX_3 ,
+#define _GMP_CHECK_INDEX_4 ,
+#define _GMP_CHECK_INDEX_5 ,
+#define _GMP_CHECK_INDEX_6 ,
+#define _GMP_CHECK_INDEX_7 ,
+#define _GMP_CHECK_INDEX_8 ,
+#define _GMP_CHECK_INDEX_9 ,
+#define _GMP_CHECK_INDEX_10 ,
+#define _GMP_CHECK_INDEX_11 ,
+#define _GMP_CHECK_INDEX_12 ,
+#define _GMP_CHECK_INDEX_13 ,
+#define _GMP_CHECK_INDEX_14 ,
+#define _GMP_CHECK_INDEX_15 ,
+#define _GMP_CHECK_INDEX_16 ,
+#define _GMP_CHECK_INDEX_17 ,
+#define _GMP_CHECK_INDEX_18 ,
+#define _GMP_CHECK_INDEX_19 ,
+#define _GMP_CHECK_INDEX_20 ,
+#define _GMP_CHECK_INDEX_21 ,
+#define _GMP_CHECK_INDEX_22 ,
+#define _GMP_CHECK_INDEX_23 ,
+#define _GMP_CHECK_INDEX_24 ,
+#define _GMP_CHECK_INDEX_25 ,
+#define _GMP_CHECK_INDEX_26 ,
+#define _GMP_CHECK_INDEX_27 ,
+#define _GMP_CHECK_INDEX_28 ,
+#define _GMP_CHECK_INDEX_29 ,
+#define _GMP_CHECK_INDEX_30 ,
+#define _GMP_CHECK_INDEX_31 ,
+#define _GMP_CHECK_INDEX_32 ,
+#define _GMP_CHECK_INDEX_33 ,
+#define _GMP_CHECK_INDEX_34 ,
+#define _GMP_CHECK_INDEX_35 ,
+#define _GMP_CHECK_INDEX_36 ,
+#define _GMP_CHECK_INDEX_37 ,
+#define _GMP_CHECK_INDEX_38 ,
+#define _GMP_CHECK_INDEX_39 ,
+#define _GMP_CHECK_INDEX_40 ,
+#define _GMP_CHECK_INDEX_41 ,
+#define _GMP_CHECK_INDEX_42 ,
+#define _GMP_CHECK_INDEX_43 ,
+#define _GMP_CHECK_INDEX_44 ,
+#define _GMP_CHECK_INDEX_45 ,
+#define _GMP_CHECK_INDEX_46 ,
+#define _GMP_CHECK_INDEX_47 ,
+#define _GMP_CHECK_INDEX_48 ,
+#define _GMP_CHECK_INDEX_49 ,
+#define _GMP_CHECK_INDEX_50 ,
+#define _GMP_CHECK_INDEX_51 ,
+#define _GMP_CHECK_INDEX_52 ,
+#define _GMP_CHECK_INDEX_53 ,
+#define _GMP_CHECK_INDEX_54 ,
+#define _GMP_CHECK_INDEX_55 ,
+#define _GMP_CHECK_INDEX_56 ,
+#define _GMP_CHECK_INDEX_57 ,
+#define _GMP_CHECK_INDEX_58 ,
+#define _GMP_CHECK_INDEX_59 ,
+#define _GMP_CHECK_INDEX_60 ,
+#define _GMP_CHECK_INDEX_61 ,
+#define _GMP_CHECK_INDEX_62 ,
+#define _GMP_CHECK_INDEX_63 ,
+#define _GMP_CHECK_INDEX_64 ,
+#define _GMP_CHECK_INDEX_65 ,
+#define _GMP_CHECK_INDEX_66 ,
+#define _GMP_CHECK_INDEX_67 ,
+#define _GMP_CHECK_INDEX_68 ,
+#define _GMP_CHECK_INDEX_69 ,
+#define _GMP_CHECK_INDEX_70 ,
+#define _GMP_CHECK_INDEX_71 ,
+#define _GMP_CHECK_INDEX_72 ,
+#define _GMP_CHECK_INDEX_73 ,
+#define _GMP_CHECK_INDEX_74 ,
+#define _GMP_CHECK_INDEX_75 ,
+#define _GMP_CHECK_INDEX_76 ,
+#define _GMP_CHECK_INDEX_77 ,
+#define _GMP_CHECK_INDEX_78 ,
+#define _GMP_CHECK_INDEX_79 ,
+#define _GMP_CHECK_INDEX_80 ,
+#define _GMP_CHECK_INDEX_81 ,
+#define _GMP_CHECK_INDEX_82 ,
+#define _GMP_CHECK_INDEX_83 ,
+#define _GMP_CHECK_INDEX_84 ,
+#define _GMP_CHECK_INDEX_85 ,
+#define _GMP_CHECK_INDEX_86 ,
+#define _GMP_CHECK_INDEX_87 ,
+#define _GMP_CHECK_INDEX_88 ,
+#define _GMP_CHECK_INDEX_89 ,
+#define _GMP_CHECK_INDEX_90 ,
+#define _GMP_CHECK_INDEX_91 ,
+#define _GMP_CHECK_INDEX_92 ,
+#define _GMP_CHECK_INDEX_93 ,
+#define _GMP_CHECK_INDEX_94 ,
+#define _GMP_CHECK_INDEX_95 ,
+#define _GMP_CHECK_INDEX_96 ,
+#define _GMP_CHECK_INDEX_97 ,
+#define _GMP_CHECK_INDEX_98 ,
+#define _GMP_CHECK_INDEX_99 ,
+#define _GMP_CHECK_INDEX_100 ,
+#define _GMP_CHECK_INDEX_101 ,
+#define _GMP_CHECK_INDEX_102 ,
+#define _GMP_CHECK_INDEX_103 ,
+#define _GMP_CHECK_INDEX_104 ,
+#define _GMP_CHECK_INDEX_105 ,
+#define _GMP_CHECK_INDEX_106 ,
+#define _GMP_CHECK_INDEX_107 ,
+#define _GMP_CHECK_INDEX_108 ,
+#define _GMP_CHECK_INDEX_109 ,
+#define _GMP_CHECK_INDEX_110 ,
+#define _GMP_CHECK_INDEX_111 ,
+#define _GMP_CHECK_INDEX_112 ,
+#define _GMP_CHECK_INDEX_113 ,
+#define _GMP_CHECK_INDEX_114 ,
+#define _GMP_CHECK_INDEX_115 ,
+#define _GMP_CHECK_INDEX_116 ,
+#define _GMP_CHECK_INDEX_117 ,
+#define _GMP_CHECK_INDEX_118 ,
+#define _GMP_CHECK_INDEX_119 ,
+#define _GMP_CHECK_INDEX_120 ,
+#define _GMP_CHECK_INDEX_121 ,
+#define _GMP_CHECK_INDEX_122 ,
+#define _GMP_CHECK_INDEX_123 ,
+#define _GMP_CHECK_INDEX_124 ,
+#define _GMP_CHECK_INDEX_125 ,
+#define _GMP_CHECK_INDEX_126 ,
+#define _GMP_CHECK_INDEX_127 ,
+#define _GMP_CHECK_INDEX_128 ,
+#define _GMP_CHECK_INDEX_129 ,
+#define _GMP_CHECK_INDEX_130 ,
+#define _GMP_CHECK_INDEX_131 ,
+#define _GMP_CHECK_INDEX_132 ,
+#define _GMP_CHECK_INDEX_133 ,
+#define _GMP_CHECK_INDEX_134 ,
+#define _GMP_CHECK_INDEX_135 ,
+#define _GMP_CHECK_INDEX_136 ,
+#define _GMP_CHECK_INDEX_137 ,
+#define _GMP_CHECK_INDEX_138 ,
+#define _GMP_CHECK_INDEX_139 ,
+#define _GMP_CHECK_INDEX_140 ,
+#define _GMP_CHECK_INDEX_141 ,
+#define _GMP_CHECK_INDEX_142 ,
+#define _GMP_CHECK_INDEX_143 ,
+#define _GMP_CHECK_INDEX_144 ,
+#define _GMP_CHECK_INDEX_145 ,
+#define _GMP_CHECK_INDEX_146 ,
+#define _GMP_CHECK_INDEX_147 ,
+#define _GMP_CHECK_INDEX_148 ,
+#define _GMP_CHECK_INDEX_149 ,
+#define _GMP_CHECK_INDEX_150 ,
+#define _GMP_CHECK_INDEX_151 ,
+#define _GMP_CHECK_INDEX_152 ,
+#define _GMP_CHECK_INDEX_153 ,
+#define _GMP_CHECK_INDEX_154 ,
+#define _GMP_CHECK_INDEX_155 ,
+#define _GMP_CHECK_INDEX_156 ,
+#define _GMP_CHECK_INDEX_157 ,
+#define _GMP_CHECK_INDEX_158 ,
+#define _GMP_CHECK_INDEX_159 ,
+#define _GMP_CHECK_INDEX_160 ,
+#define _GMP_CHECK_INDEX_161 ,
+#define _GMP_CHECK_INDEX_162 ,
+#define _GMP_CHECK_INDEX_163 ,
+#define _GMP_CHECK_INDEX_164 ,
+#define _GMP_CHECK_INDEX_165 ,
+#define _GMP_CHECK_INDEX_166 ,
+#define _GMP_CHECK_INDEX_167 ,
+#define _GMP_CHECK_INDEX_168 ,
+#define _GMP_CHECK_INDEX_169 ,
+#define _GMP_CHECK_INDEX_170 ,
+#define _GMP_CHECK_INDEX_171 ,
+#define _GMP_CHECK_INDEX_172 ,
+#define _GMP_CHECK_INDEX_173 ,
+#define _GMP_CHECK_INDEX_174 ,
+#define _GMP_CHECK_INDEX_175 ,
+#define _GMP_CHECK_INDEX_176 ,
+#define _GMP_CHECK_INDEX_177 ,
+#define _GMP_CHECK_INDEX_178 ,
+#define _GMP_CHECK_INDEX_179 ,
+#define _GMP_CHECK_INDEX_180 ,
+#define _GMP_CHECK_INDEX_181 ,
+#define _GMP_CHECK_INDEX_182 ,
+#define _GMP_CHECK_INDEX_183 ,
+#define _GMP_CHECK_INDEX_184 ,
+#define _GMP_CHECK_INDEX_185 ,
+#define _GMP_CHECK_INDEX_186 ,
+#define _GMP_CHECK_INDEX_187 ,
+#define _GMP_CHECK_INDEX_188 ,
+#define _GMP_CHECK_INDEX_189 ,
+#define _GMP_CHECK_INDEX_190 ,
+#define _GMP_CHECK_INDEX_191 ,
+#define _GMP_CHECK_INDEX_192 ,
+#define _GMP_CHECK_INDEX_193 ,
+#define _GMP_CHECK_INDEX_194 ,
+#define _GMP_CHECK_INDEX_195 ,
+#define _GMP_CHECK_INDEX_196 ,
+#define _GMP_CHECK_INDEX_197 ,
+#define _GMP_CHECK_INDEX_198 ,
+#define _GMP_CHECK_INDEX_199 ,
+#define _GMP_CHECK_INDEX_200 ,
+#define _GMP_CHECK_INDEX_201 ,
+#define _GMP_CHECK_INDEX_202 ,
+#define _GMP_CHECK_INDEX_203 ,
+#define _GMP_CHECK_INDEX_204 ,
+#define _GMP_CHECK_INDEX_205 ,
+#define _GMP_CHECK_INDEX_206 ,
+#define _GMP_CHECK_INDEX_207 ,
+#define _GMP_CHECK_INDEX_208 ,
+#define _GMP_CHECK_INDEX_209 ,
+#define _GMP_CHECK_INDEX_210 ,
+#define _GMP_CHECK_INDEX_211 ,
+#define _GMP_CHECK_INDEX_212 ,
+#define _GMP_CHECK_INDEX_213 ,
+#define _GMP_CHECK_INDEX_214 ,
+#define _GMP_CHECK_INDEX_215 ,
+#define _GMP_CHECK_INDEX_216 ,
+#define _GMP_CHECK_INDEX_217 ,
+#define _GMP_CHECK_INDEX_218 ,
+#define _GMP_CHECK_INDEX_219 ,
+#define _GMP_CHECK_INDEX_220 ,
+#define _GMP_CHECK_INDEX_221 ,
+#define _GMP_CHECK_INDEX_222 ,
+#define _GMP_CHECK_INDEX_223 ,
+#define _GMP_CHECK_INDEX_224 ,
+#define _GMP_CHECK_INDEX_225 ,
+#define _GMP_CHECK_INDEX_226 ,
+#define _GMP_CHECK_INDEX_227 ,
+#define _GMP_CHECK_INDEX_228 ,
+#define _GMP_CHECK_INDEX_229 ,
+#define _GMP_CHECK_INDEX_230 ,
+#define _GMP_CHECK_INDEX_231 ,
+#define _GMP_CHECK_INDEX_232 ,
+#define _GMP_CHECK_INDEX_233 ,
+#define _GMP_CHECK_INDEX_234 ,
+#define _GMP_CHECK_INDEX_235 ,
+#define _GMP_CHECK_INDEX_236 ,
+#define _GMP_CHECK_INDEX_237 ,
+#define _GMP_CHECK_INDEX_238 ,
+#define _GMP_CHECK_INDEX_239 ,
+#define _GMP_CHECK_INDEX_240 ,
+#define _GMP_CHECK_INDEX_241 ,
+#define _GMP_CHECK_INDEX_242 ,
+#define _GMP_CHECK_INDEX_243 ,
+#define _GMP_CHECK_INDEX_244 ,
+#define _GMP_CHECK_INDEX_245 ,
+#define _GMP_CHECK_INDEX_246 ,
+#define _GMP_CHECK_INDEX_247 ,
+#define _GMP_CHECK_INDEX_248 ,
+#define _GMP_CHECK_INDEX_249 ,
+#define _GMP_CHECK_INDEX_250 ,
+#define _GMP_CHECK_INDEX_251 ,
+#define _GMP_CHECK_INDEX_252 ,
+#define _GMP_CHECK_INDEX_253 ,
+#define _GMP_CHECK_INDEX_254 ,
+
+// GMP_EQUAL_INT
+#define _GMP_EQUAL_INT_0_0 ,
+#define _GMP_EQUAL_INT_1_1 ,
+#define _GMP_EQUAL_INT_2_2 ,
+#define _GMP_EQUAL_INT_3_3 ,
+#define _GMP_EQUAL_INT_4_4 ,
+#define _GMP_EQUAL_INT_5_5 ,
+#define _GMP_EQUAL_INT_6_6 ,
+#define _GMP_EQUAL_INT_7_7 ,
+#define _GMP_EQUAL_INT_8_8 ,
+#define _GMP_EQUAL_INT_9_9 ,
+#define _GMP_EQUAL_INT_10_10 ,
+#define _GMP_EQUAL_INT_11_11 ,
+#define _GMP_EQUAL_INT_12_12 ,
+#define _GMP_EQUAL_INT_13_13 ,
+#define _GMP_EQUAL_INT_14_14 ,
+#define _GMP_EQUAL_INT_15_15 ,
+#define _GMP_EQUAL_INT_16_16 ,
+#define _GMP_EQUAL_INT_17_17 ,
+#define _GMP_EQUAL_INT_18_18 ,
+#define _GMP_EQUAL_INT_19_19 ,
+#define _GMP_EQUAL_INT_20_20 ,
+#define _GMP_EQUAL_INT_21_21 ,
+#define _GMP_EQUAL_INT_22_22 ,
+#define _GMP_EQUAL_INT_23_23 ,
+#define _GMP_EQUAL_INT_24_24 ,
+#define _GMP_EQUAL_INT_25_25 ,
+#define _GMP_EQUAL_INT_26_26 ,
+#define _GMP_EQUAL_INT_27_27 ,
+#define _GMP_EQUAL_INT_28_28 ,
+#define _GMP_EQUAL_INT_29_29 ,
+#define _GMP_EQUAL_INT_30_30 ,
+#define _GMP_EQUAL_INT_31_31 ,
+#define _GMP_EQUAL_INT_32_32 ,
+#define _GMP_EQUAL_INT_33_33 ,
+#define _GMP_EQUAL_INT_34_34 ,
+#define _GMP_EQUAL_INT_35_35 ,
+#define _GMP_EQUAL_INT_36_36 ,
+#define _GMP_EQUAL_INT_37_37 ,
+#define _GMP_EQUAL_INT_38_38 ,
+#define _GMP_EQUAL_INT_39_39 ,
+#define _GMP_EQUAL_INT_40_40 ,
+#define _GMP_EQUAL_INT_41_41 ,
+#define _GMP_EQUAL_INT_42_42 ,
+#define _GMP_EQUAL_INT_43_43 ,
+#define _GMP_EQUAL_INT_44_44 ,
+#define _GMP_EQUAL_INT_45_45 ,
+#define _GMP_EQUAL_INT_46_46 ,
+#define _GMP_EQUAL_INT_47_47 ,
+#define _GMP_EQUAL_INT_48_48 ,
+#define _GMP_EQUAL_INT_49_49 ,
+#define _GMP_EQUAL_INT_50_50 ,
+#define _GMP_EQUAL_INT_51_51 ,
+#define _GMP_EQUAL_INT_52_52 ,
+#define _GMP_EQUAL_INT_53_53 ,
+#define _GMP_EQUAL_INT_54_54 ,
+#define _GMP_EQUAL_INT_55_55 ,
+#define _GMP_EQUAL_INT_56_56 ,
+#define _GMP_EQUAL_INT_57_57 ,
+#define _GMP_EQUAL_INT_58_58 ,
+#define _GMP_EQUAL_INT_59_59 ,
+#define _GMP_EQUAL_INT_60_60 ,
+#define _GMP_EQUAL_INT_61_61 ,
+#define _GMP_EQUAL_INT_62_62 ,
+#define _GMP_EQUAL_INT_63_63 ,
+#define _GMP_EQUAL_INT_64_64 ,
+#define _GMP_EQUAL_INT_65_65 ,
+#define _GMP_EQUAL_INT_66_66 ,
+#define _GMP_EQUAL_INT_67_67 ,
+#define _GMP_EQUAL_INT_68_68 ,
+#define _GMP_EQUAL_INT_69_69 ,
+#define _GMP_EQUAL_INT_70_70 ,
+#define _GMP_EQUAL_INT_71_71 ,
+#define _GMP_EQUAL_INT_72_72 ,
+#define _GMP_EQUAL_INT_73_73 ,
+#define _GMP_EQUAL_INT_74_74 ,
+#define _GMP_EQUAL_INT_75_75 ,
+#define _GMP_EQUAL_INT_76_76 ,
+#define _GMP_EQUAL_INT_77_77 ,
+#define _GMP_EQUAL_INT_78_78 ,
+#define _GMP_EQUAL_INT_79_79 ,
+#define _GMP_EQUAL_INT_80_80 ,
+#define _GMP_EQUAL_INT_81_81 ,
+#define _GMP_EQUAL_INT_82_82 ,
+#define _GMP_EQUAL_INT_83_83 ,
+#define _GMP_EQUAL_INT_84_84 ,
+#define _GMP_EQUAL_INT_85_85 ,
+#define _GMP_EQUAL_INT_86_86 ,
+#define _GMP_EQUAL_INT_87_87 ,
+#define _GMP_EQUAL_INT_88_88 ,
+#define _GMP_EQUAL_INT_89_89 ,
+#define _GMP_EQUAL_INT_90_90 ,
+#define _GMP_EQUAL_INT_91_91 ,
+#define _GMP_EQUAL_INT_92_92 ,
+#define _GMP_EQUAL_INT_93_93 ,
+#define _GMP_EQUAL_INT_94_94 ,
+#define _GMP_EQUAL_INT_95_95 ,
+#define _GMP_EQUAL_INT_96_96 ,
+#define _GMP_EQUAL_INT_97_97 ,
+#define _GMP_EQUAL_INT_98_98 ,
+#define _GMP_EQUAL_INT_99_99 ,
+#define _GMP_EQUAL_INT_100_100 ,
+#define _GMP_EQUAL_INT_101_101 ,
+#define _GMP_EQUAL_INT_102_102 ,
+#define _GMP_EQUAL_INT_103_103 ,
+#define _GMP_EQUAL_INT_104_104 ,
+#define _GMP_EQUAL_INT_105_105 ,
+#define _GMP_EQUAL_INT_106_106 ,
+#define _GMP_EQUAL_INT_107_107 ,
+#define _GMP_EQUAL_INT_108_108 ,
+#define _GMP_EQUAL_INT_109_109 ,
+#define _GMP_EQUAL_INT_110_110 ,
+#define _GMP_EQUAL_INT_111_111 ,
+#define _GMP_EQUAL_INT_112_112 ,
+#define _GMP_EQUAL_INT_113_113 ,
+#define _GMP_EQUAL_INT_114_114 ,
+#define _GMP_EQUAL_INT_115_115 ,
+#define _GMP_EQUAL_INT_116_116 ,
+#define _GMP_EQUAL_INT_117_117 ,
+#define _GMP_EQUAL_INT_118_118 ,
+#define _GMP_EQUAL_INT_119_119 ,
+#define _GMP_EQUAL_INT_120_120 ,
+#define _GMP_EQUAL_INT_121_121 ,
+#define _GMP_EQUAL_INT_122_122 ,
+#define _GMP_EQUAL_INT_123_123 ,
+#define _GMP_EQUAL_INT_124_124 ,
+#define _GMP_EQUAL_INT_125_125 ,
+#define _GMP_EQUAL_INT_126_126 ,
+#define _GMP_EQUAL_INT_127_127 ,
+#define _GMP_EQUAL_INT_128_128 ,
+#define _GMP_EQUAL_INT_129_129 ,
+#define _GMP_EQUAL_INT_130_130 ,
+#define _GMP_EQUAL_INT_131_131 ,
+#define _GMP_EQUAL_INT_132_132 ,
+#define _GMP_EQUAL_INT_133_133 ,
+#define _GMP_EQUAL_INT_134_134 ,
+#define _GMP_EQUAL_INT_135_135 ,
+#define _GMP_EQUAL_INT_136_136 ,
+#define _GMP_EQUAL_INT_137_137 ,
+#define _GMP_EQUAL_INT_138_138 ,
+#define _GMP_EQUAL_INT_139_139 ,
+#define _GMP_EQUAL_INT_140_140 ,
+#define _GMP_EQUAL_INT_141_141 ,
+#define _GMP_EQUAL_INT_142_142 ,
+#define _GMP_EQUAL_INT_143_143 ,
+#define _GMP_EQUAL_INT_144_144 ,
+#define _GMP_EQUAL_INT_145_145 ,
+#define _GMP_EQUAL_INT_146_146 ,
+#define _GMP_EQUAL_INT_147_147 ,
+#define _GMP_EQUAL_INT_148_148 ,
+#define _GMP_EQUAL_INT_149_149 ,
+#define _GMP_EQUAL_INT_150_150 ,
+#define _GMP_EQUAL_INT_151_151 ,
+#define _GMP_EQUAL_INT_152_152 ,
+#define _GMP_EQUAL_INT_153_153 ,
+#define _GMP_EQUAL_INT_154_154 ,
+#define _GMP_EQUAL_INT_155_155 ,
+#define _GMP_EQUAL_INT_156_156 ,
+#define _GMP_EQUAL_INT_157_157 ,
+#define _GMP_EQUAL_INT_158_158 ,
+#define _GMP_EQUAL_INT_159_159 ,
+#define _GMP_EQUAL_INT_160_160 ,
+#define _GMP_EQUAL_INT_161_161 ,
+#define _GMP_EQUAL_INT_162_162 ,
+#define _GMP_EQUAL_INT_163_163 ,
+#define _GMP_EQUAL_INT_164_164 ,
+#define _GMP_EQUAL_INT_165_165 ,
+#define _GMP_EQUAL_INT_166_166 ,
+#define _GMP_EQUAL_INT_167_167 ,
+#define _GMP_EQUAL_INT_168_168 ,
+#define _GMP_EQUAL_INT_169_169 ,
+#define _GMP_EQUAL_INT_170_170 ,
+#define _GMP_EQUAL_INT_171_171 ,
+#define _GMP_EQUAL_INT_172_172 ,
+#define _GMP_EQUAL_INT_173_173 ,
+#define _GMP_EQUAL_INT_174_174 ,
+#define _GMP_EQUAL_INT_175_175 ,
+#define _GMP_EQUAL_INT_176_176 ,
+#define _GMP_EQUAL_INT_177_177 ,
+#define _GMP_EQUAL_INT_178_178 ,
+#define _GMP_EQUAL_INT_179_179 ,
+#define _GMP_EQUAL_INT_180_180 ,
+#define _GMP_EQUAL_INT_181_181 ,
+#define _GMP_EQUAL_INT_182_182 ,
+#define _GMP_EQUAL_INT_183_183 ,
+#define _GMP_EQUAL_INT_184_184 ,
+#define _GMP_EQUAL_INT_185_185 ,
+#define _GMP_EQUAL_INT_186_186 ,
+#define _GMP_EQUAL_INT_187_187 ,
+#define _GMP_EQUAL_INT_188_188 ,
+#define _GMP_EQUAL_INT_189_189 ,
+#define _GMP_EQUAL_INT_190_190 ,
+#define _GMP_EQUAL_INT_191_191 ,
+#define _GMP_EQUAL_INT_192_192 ,
+#define _GMP_EQUAL_INT_193_193 ,
+#define _GMP_EQUAL_INT_194_194 ,
+#define _GMP_EQUAL_INT_195_195 ,
+#define _GMP_EQUAL_INT_196_196 ,
+#define _GMP_EQUAL_INT_197_197 ,
+#define _GMP_EQUAL_INT_198_198 ,
+#define _GMP_EQUAL_INT_199_199 ,
+#define _GMP_EQUAL_INT_200_200 ,
+#define _GMP_EQUAL_INT_201_201 ,
+#define _GMP_EQUAL_INT_202_202 ,
+#define _GMP_EQUAL_INT_203_203 ,
+#define _GMP_EQUAL_INT_204_204 ,
+#define _GMP_EQUAL_INT_205_205 ,
+#define _GMP_EQUAL_INT_206_206 ,
+#define _GMP_EQUAL_INT_207_207 ,
+#define _GMP_EQUAL_INT_208_208 ,
+#define _GMP_EQUAL_INT_209_209 ,
+#define _GMP_EQUAL_INT_210_210 ,
+#define _GMP_EQUAL_INT_211_211 ,
+#define _GMP_EQUAL_INT_212_212 ,
+#define _GMP_EQUAL_INT_213_213 ,
+#define _GMP_EQUAL_INT_214_214 ,
+#define _GMP_EQUAL_INT_215_215 ,
+#define _GMP_EQUAL_INT_216_216 ,
+#define _GMP_EQUAL_INT_217_217 ,
+#define _GMP_EQUAL_INT_218_218 ,
+#define _GMP_EQUAL_INT_219_219 ,
+#define _GMP_EQUAL_INT_220_220 ,
+#define _GMP_EQUAL_INT_221_221 ,
+#define _GMP_EQUAL_INT_222_222 ,
+#define _GMP_EQUAL_INT_223_223 ,
+#define _GMP_EQUAL_INT_224_224 ,
+#define _GMP_EQUAL_INT_225_225 ,
+#define _GMP_EQUAL_INT_226_226 ,
+#define _GMP_EQUAL_INT_227_227 ,
+#define _GMP_EQUAL_INT_228_228 ,
+#define _GMP_EQUAL_INT_229_229 ,
+#define _GMP_EQUAL_INT_230_230 ,
+#define _GMP_EQUAL_INT_231_231 ,
+#define _GMP_EQUAL_INT_232_232 ,
+#define _GMP_EQUAL_INT_233_233 ,
+#define _GMP_EQUAL_INT_234_234 ,
+#define _GMP_EQUAL_INT_235_235 ,
+#define _GMP_EQUAL_INT_236_236 ,
+#define _GMP_EQUAL_INT_237_237 ,
+#define _GMP_EQUAL_INT_238_238 ,
+#define _GMP_EQUAL_INT_239_239 ,
+#define _GMP_EQUAL_INT_240_240 ,
+#define _GMP_EQUAL_INT_241_241 ,
+#define _GMP_EQUAL_INT_242_242 ,
+#define _GMP_EQUAL_INT_243_243 ,
+#define _GMP_EQUAL_INT_244_244 ,
+#define _GMP_EQUAL_INT_245_245 ,
+#define _GMP_EQUAL_INT_246_246 ,
+#define _GMP_EQUAL_INT_247_247 ,
+#define _GMP_EQUAL_INT_248_248 ,
+#define _GMP_EQUAL_INT_249_249 ,
+#define _GMP_EQUAL_INT_250_250 ,
+#define _GMP_EQUAL_INT_251_251 ,
+#define _GMP_EQUAL_INT_252_252 ,
+#define _GMP_EQUAL_INT_253_253 ,
+#define _GMP_EQUAL_INT_254_254 ,
+
+#endif // GMP_MACRO_LIMITS_ARITH_254_HPP_
@@ -0,0 +1,343 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_ARITH_64_HPP_
+#define GMP_MACRO_LIMITS_ARITH_64_HPP_
+
+// GMP_INC
+#define _GMP_INC_0() 1
+#define _GMP_INC_1() 2
+#define _GMP_INC_2() 3
+#define _GMP_INC_3() 4
+#define _GMP_INC_4() 5
+#define _GMP_INC_5() 6
+#define _GMP_INC_6() 7
+#define _GMP_INC_7() 8
+#define _GMP_INC_8() 9
+#define _GMP_INC_9() 10
+#define _GMP_INC_10() 11
+#define _GMP_INC_11() 12
+#define _GMP_INC_12() 13
+#define _GMP_INC_13() 14
+#define _GMP_INC_14() 15
+#define _GMP_INC_15() 16
+#define _GMP_INC_16() 17
+#define _GMP_INC_17() 18
+#define _GMP_INC_18() 19
+#define _GMP_INC_19() 20
+#define _GMP_INC_20() 21
+#define _GMP_INC_21() 22
+#define _GMP_INC_22() 23
+#define _GMP_INC_23() 24
+#define _GMP_INC_24() 25
+#define _GMP_INC_25() 26
+#define _GMP_INC_26() 27
+#define _GMP_INC_27() 28
+#define _GMP_INC_28() 29
+#define _GMP_INC_29() 30
+#define _GMP_INC_30() 31
+#define _GMP_INC_31() 32
+#define _GMP_INC_32() 33
+#define _GMP_INC_33() 34
+#define _GMP_INC_34() 35
+#define _GMP_INC_35() 36
+#define _GMP_INC_36() 37
+#define _GMP_INC_37() 38
+#define _GMP_INC_38() 39
+#define _GMP_INC_39() 40
+#define _GMP_INC_40() 41
+#define _GMP_INC_41() 42
+#define _GMP_INC_42() 43
+#define _GMP_INC_43() 44
+#define _GMP_INC_44() 45
+#define _GMP_INC_45() 46
+#define _GMP_INC_46() 47
+#define _GMP_INC_47() 48
+#define _GMP_INC_48() 49
+#define _GMP_INC_49() 50
+#define _GMP_INC_50() 51
+#define _GMP_INC_51() 52
+#define _GMP_INC_52() 53
+#define _GMP_INC_53() 54
+#define _GMP_INC_54() 55
+#define _GMP_INC_55() 56
+#define _GMP_INC_56() 57
+#define _GMP_INC_57() 58
+#define _GMP_INC_58() 59
+#define _GMP_INC_59() 60
+#define _GMP_INC_60() 61
+#define _GMP_INC_61() 62
+#define _GMP_INC_62() 63
+#define _GMP_INC_63() 64
+#define _GMP_INC_64() 65
+#define _GMP_INC_65() 66
+
+// GMP_DEC
+#define _GMP_DEC_1() 0
+#define _GMP_DEC_2() 1
+#define _GMP_DEC_3() 2
+#define _GMP_DEC_4() 3
+#define _GMP_DEC_5() 4
+#define _GMP_DEC_6() 5
+#define _GMP_DEC_7() 6
+#define _GMP_DEC_8() 7
+#define _GMP_DEC_9() 8
+#define _GMP_DEC_10() 9
+#define _GMP_DEC_11() 10
+#define _GMP_DEC_12() 11
+#define _GMP_DEC_13() 12
+#define _GMP_DEC_14() 13
+#define _GMP_DEC_15() 14
+#define _GMP_DEC_16() 15
+#define _GMP_DEC_17() 16
+#define _GMP_DEC_18() 17
+#define _GMP_DEC_19() 18
+#define _GMP_DEC_20() 19
+#define _GMP_DEC_21() 20
+#define _GMP_DEC_22() 21
+#define _GMP_DEC_23() 22
+#define _GMP_DEC_24() 23
+#define _GMP_DEC_25() 24
+#define _GMP_DEC_26() 25
+#define _GMP_DEC_27() 26
+#define _GMP_DEC_28() 27
+#define _GMP_DEC_29() 28
+#define _GMP_DEC_30() 29
+#define _GMP_DEC_31() 30
+#define _GMP_DEC_32() 31
+#define _GMP_DEC_33() 32
+#define _GMP_DEC_34() 33
+#define _GMP_DEC_35() 34
+#define _GMP_DEC_36() 35
+#define _GMP_DEC_37() 36
+#define _GMP_DEC_38() 37
+#define _GMP_DEC_39() 38
+#define _GMP_DEC_40() 39
+#define _GMP_DEC_41() 40
+#define _GMP_DEC_42() 41
+#define _GMP_DEC_43() 42
+#define _GMP_DEC_44() 43
+#define _GMP_DEC_45() 44
+#define _GMP_DEC_46() 45
+#define _GMP_DEC_47() 46
+#define _GMP_DEC_48() 47
+#define _GMP_DEC_49() 48
+#define _GMP_DEC_50() 49
+#define _GMP_DEC_51() 50
+#define _GMP_DEC_52() 51
+#define _GMP_DEC_53() 52
+#define _GMP_DEC_54() 53
+#define _GMP_DEC_55() 54
+#define _GMP_DEC_56() 55
+#define _GMP_DEC_57() 56
+#define _GMP_DEC_58() 57
+#define _GMP_DEC_59() 58
+#define _GMP_DEC_60() 59
+#define _GMP_DEC_61() 60
+#define _GMP_DEC_62() 61
+#define _GMP_DEC_63() 62
+#define _GMP_DEC_64() 63
+#define _GMP_DEC_65() 64
+
+// GMP_BOOL
+#define _GMP_BOOL_0 0
+#define _GMP_BOOL_1 1
+#define _GMP_BOOL_2 1
+#define _GMP_BOOL_3 1
+#define _GMP_BOOL_4 1
+#define _GMP_BOOL_5 1
+#define _GMP_BOOL_6 1
+#define _GMP_BOOL_7 1
+#define _GMP_BOOL_8 1
+#define _GMP_BOOL_9 1
+#define _GMP_BOOL_10 1
+#define _GMP_BOOL_11 1
+#define _GMP_BOOL_12 1
+#define _GMP_BOOL_13 1
+#define _GMP_BOOL_14 1
+#define _GMP_BOOL_15 1
+#define _GMP_BOOL_16 1
+#define _GMP_BOOL_17 1
+#define _GMP_BOOL_18 1
+#define _GMP_BOOL_19 1
+#define _GMP_BOOL_20 1
+#define _GMP_BOOL_21 1
+#define _GMP_BOOL_22 1
+#define _GMP_BOOL_23 1
+#define _GMP_BOOL_24 1
+#define _GMP_BOOL_25 1
+#define _GMP_BOOL_26 1
+#define _GMP_BOOL_27 1
+#define _GMP_BOOL_28 1
+#define _GMP_BOOL_29 1
+#define _GMP_BOOL_30 1
+#define _GMP_BOOL_31 1
+#define _GMP_BOOL_32 1
+#define _GMP_BOOL_33 1
+#define _GMP_BOOL_34 1
+#define _GMP_BOOL_35 1
+#define _GMP_BOOL_36 1
+#define _GMP_BOOL_37 1
+#define _GMP_BOOL_38 1
+#define _GMP_BOOL_39 1
+#define _GMP_BOOL_40 1
+#define _GMP_BOOL_41 1
+#define _GMP_BOOL_42 1
+#define _GMP_BOOL_43 1
+#define _GMP_BOOL_44 1
+#define _GMP_BOOL_45 1
+#define _GMP_BOOL_46 1
+#define _GMP_BOOL_47 1
+#define _GMP_BOOL_48 1
+#define _GMP_BOOL_49 1
+#define _GMP_BOOL_50 1
+#define _GMP_BOOL_51 1
+#define _GMP_BOOL_52 1
+#define _GMP_BOOL_53 1
+#define _GMP_BOOL_54 1
+#define _GMP_BOOL_55 1
+#define _GMP_BOOL_56 1
+#define _GMP_BOOL_57 1
+#define _GMP_BOOL_58 1
+#define _GMP_BOOL_59 1
+#define _GMP_BOOL_60 1
+#define _GMP_BOOL_61 1
+#define _GMP_BOOL_62 1
+#define _GMP_BOOL_63 1
+#define _GMP_BOOL_64 1
+#define _GMP_BOOL_65 1
+
+// GMP_CHECK_INDEX
+#define _GMP_CHECK_INDEX_0 ,
+#define _GMP_CHECK_INDEX_1 ,
+#define _GMP_CHECK_INDEX_2 ,
+#define _GMP_CHECK_INDEX_3 ,
+#define _GMP_CHECK_INDEX_4 ,
+#define _GMP_CHECK_INDEX_5 ,
+#define _GMP_CHECK_INDEX_6 ,
+#define _GMP_CHECK_INDEX_7 ,
+#define _GMP_CHECK_INDEX_8 ,
+#define _GMP_CHECK_INDEX_9 ,
+#define _GMP_CHECK_INDEX_10 ,
+#define _GMP_CHECK_INDEX_11 ,
+#define _GMP_CHECK_INDEX_12 ,
+#define _GMP_CHECK_INDEX_13 ,
+#define _GMP_CHECK_INDEX_14 ,
+#define _GMP_CHECK_INDEX_15 ,
+#define _GMP_CHECK_INDEX_16 ,
+#define _GMP_CHECK_INDEX_17 ,
+#define _GMP_CHECK_INDEX_18 ,
+#define _GMP_CHECK_INDEX_19 ,
+#define _GMP_CHECK_INDEX_20 ,
+#define _GMP_CHECK_INDEX_21 ,
+#define _GMP_CHECK_INDEX_22 ,
+#define _GMP_CHECK_INDEX_23 ,
+#define _GMP_CHECK_INDEX_24 ,
+#define _GMP_CHECK_INDEX_25 ,
+#define _GMP_CHECK_INDEX_26 ,
+#define _GMP_CHECK_INDEX_27 ,
+#define _GMP_CHECK_INDEX_28 ,
+#define _GMP_CHECK_INDEX_29 ,
+#define _GMP_CHECK_INDEX_30 ,
+#define _GMP_CHECK_INDEX_31 ,
+#define _GMP_CHECK_INDEX_32 ,
+#define _GMP_CHECK_INDEX_33 ,
+#define _GMP_CHECK_INDEX_34 ,
+#define _GMP_CHECK_INDEX_35 ,
+#define _GMP_CHECK_INDEX_36 ,
+#define _GMP_CHECK_INDEX_37 ,
+#define _GMP_CHECK_INDEX_38 ,
+#define _GMP_CHECK_INDEX_39 ,
+#define _GMP_CHECK_INDEX_40 ,
+#define _GMP_CHECK_INDEX_41 ,
+#define _GMP_CHECK_INDEX_42 ,
+#define _GMP_CHECK_INDEX_43 ,
+#define _GMP_CHECK_INDEX_44 ,
+#define _GMP_CHECK_INDEX_45 ,
+#define _GMP_CHECK_INDEX_46 ,
+#define _GMP_CHECK_INDEX_47 ,
+#define _GMP_CHECK_INDEX_48 ,
+#define _GMP_CHECK_INDEX_49 ,
+#define _GMP_CHECK_INDEX_50 ,
+#define _GMP_CHECK_INDEX_51 ,
+#define _GMP_CHECK_INDEX_52 ,
+#define _GMP_CHECK_INDEX_53 ,
+#define _GMP_CHECK_INDEX_54 ,
+#define _GMP_CHECK_INDEX_55 ,
+#define _GMP_CHECK_INDEX_56 ,
+#define _GMP_CHECK_INDEX_57 ,
+#define _GMP_CHECK_INDEX_58 ,
+#define _GMP_CHECK_INDEX_59 ,
+#define _GMP_CHECK_INDEX_60 ,
+#define _GMP_CHECK_INDEX_61 ,
+#define _GMP_CHECK_INDEX_62 ,
+#define _GMP_CHECK_INDEX_63 ,
+#define _GMP_CHECK_INDEX_64 ,
+
+// GMP_EQUAL_INT
+#define _GMP_EQUAL_INT_0_0 ,
+#define _GMP_EQUAL_INT_1_1 ,
+#define _GMP_EQUAL_INT_2_2 ,
+#define _GMP_EQUAL_INT_3_3 ,
+#define _GMP_EQUAL_INT_4_4 ,
+#define _GMP_EQUAL_INT_5_5 ,
+#define _GMP_EQUAL_INT_6_6 ,
+#define _GMP_EQUAL_INT_7_7 ,
+#define _GMP_EQUAL_INT_8_8 ,
+#define _GMP_EQUAL_INT_9_9 ,
+#define _GMP_EQUAL_INT_10_10 ,
+#define _GMP_EQUAL_INT_11_11 ,
+#define _GMP_EQUAL_INT_12_12 ,
+#define _GMP_EQUAL_INT_13_13 ,
+#define _GMP_EQUAL_INT_14_14 ,
+#define _GMP_EQUAL_INT_15_15 ,
+#define _GMP_EQUAL_INT_16_16 ,
+#define _GMP_EQUAL_INT_17_17 ,
+#define _GMP_EQUAL_INT_18_18 ,
+#define _GMP_EQUAL_INT_19_19 ,
+#define _GMP_EQUAL_INT_20_20 ,
+#define _GMP_EQUAL_INT_21_21 ,
+#define _GMP_EQUAL_INT_22_22 ,
+#define _GMP_EQUAL_INT_23_23 ,
+#define _GMP_EQUAL_INT_24_24 ,
+#define _GMP_EQUAL_INT_25_25 ,
+#define _GMP_EQUAL_INT_26_26 ,
+#define _GMP_EQUAL_INT_27_27 ,
+#define _GMP_EQUAL_INT_28_28 ,
+#define _GMP_EQUAL_INT_29_29 ,
+#define _GMP_EQUAL_INT_30_30 ,
+#define _GMP_EQUAL_INT_31_31 ,
+#define _GMP_EQUAL_INT_32_32 ,
+#define _GMP_EQUAL_INT_33_33 ,
+#define _GMP_EQUAL_INT_34_34 ,
+#define _GMP_EQUAL_INT_35_35 ,
+#define _GMP_EQUAL_INT_36_36 ,
+#define _GMP_EQUAL_INT_37_37 ,
+#define _GMP_EQUAL_INT_38_38 ,
+#define _GMP_EQUAL_INT_39_39 ,
+#define _GMP_EQUAL_INT_40_40 ,
+#define _GMP_EQUAL_INT_41_41 ,
+#define _GMP_EQUAL_INT_42_42 ,
+#define _GMP_EQUAL_INT_43_43 ,
+#define _GMP_EQUAL_INT_44_44 ,
+#define _GMP_EQUAL_INT_45_45 ,
+#define _GMP_EQUAL_INT_46_46 ,
+#define _GMP_EQUAL_INT_47_47 ,
+#define _GMP_EQUAL_INT_48_48 ,
+#define _GMP_EQUAL_INT_49_49 ,
+#define _GMP_EQUAL_INT_50_50 ,
+#define _GMP_EQUAL_INT_51_51 ,
+#define _GMP_EQUAL_INT_52_52 ,
+#define _GMP_EQUAL_INT_53_53 ,
+#define _GMP_EQUAL_INT_54_54 ,
+#define _GMP_EQUAL_INT_55_55 ,
+#define _GMP_EQUAL_INT_56_56 ,
+#define _GMP_EQUAL_INT_57_57 ,
+#define _GMP_EQUAL_INT_58_58 ,
+#define _GMP_EQUAL_INT_59_59 ,
+#define _GMP_EQUAL_INT_60_60 ,
+#define _GMP_EQUAL_INT_61_61 ,
+#define _GMP_EQUAL_INT_62_62 ,
+#define _GMP_EQUAL_INT_63_63 ,
+#define _GMP_EQUAL_INT_64_64 ,
+
+#endif // GMP_MACRO_LIMITS_ARITH_64_HPP_
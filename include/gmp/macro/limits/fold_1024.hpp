@@ -0,0 +1,1034 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_FOLD_1024_HPP_
+#define GMP_MACRO_LIMITS_FOLD_1024_HPP_
+
+// GMP_FOLD_LEFT
+#define _GMP_FOLD_LEFT_0(op, state, ...) state
+#define _GMP_FOLD_LEFT_1(op, state, x) op(state, x)
+#define _GMP_FOLD_LEFT_2(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_3(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_2(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_4(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_3(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_5(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_4(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_6(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_5(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_7(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_6(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_8(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_7(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_9(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_8(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_10(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_9(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_11(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_10(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_12(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_11(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_13(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_12(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_14(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_13(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_15(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_14(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_16(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_15(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_17(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_16(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_18(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_17(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_19(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_18(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_20(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_19(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_21(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_20(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_22(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_21(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_23(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_22(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_24(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_23(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_25(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_24(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_26(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_25(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_27(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_26(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_28(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_27(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_29(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_28(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_30(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_29(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_31(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_30(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_32(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_31(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_33(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_32(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_34(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_33(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_35(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_34(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_36(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_35(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_37(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_36(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_38(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_37(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_39(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_38(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_40(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_39(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_41(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_40(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_42(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_41(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_43(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_42(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_44(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_43(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_45(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_44(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_46(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_45(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_47(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_46(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_48(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_47(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_49(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_48(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_50(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_49(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_51(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_50(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_52(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_51(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_53(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_52(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_54(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_53(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_55(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_54(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_56(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_55(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_57(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_56(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_58(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_57(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_59(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_58(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_60(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_59(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_61(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_60(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_62(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_61(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_63(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_62(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_64(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_63(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_65(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_64(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_66(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_65(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_67(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_66(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_68(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_67(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_69(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_68(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_70(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_69(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_71(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_70(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_72(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_71(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_73(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_72(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_74(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_73(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_75(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_74(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_76(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_75(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_77(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_76(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_78(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_77(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_79(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_78(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_80(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_79(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_81(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_80(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_82(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_81(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_83(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_82(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_84(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_83(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_85(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_84(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_86(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_85(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_87(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_86(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_88(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_87(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_89(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_88(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_90(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_89(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_91(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_90(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_92(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_91(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_93(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_92(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_94(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_93(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_95(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_94(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_96(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_95(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_97(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_96(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_98(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_97(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_99(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_98(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_100(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_99(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_101(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_100(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_102(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_101(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_103(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_102(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_104(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_103(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_105(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_104(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_106(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_105(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_107(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_106(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_108(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_107(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_109(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_108(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_110(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_109(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_111(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_110(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_112(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_111(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_113(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_112(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_114(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_113(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_115(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_114(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_116(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_115(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_117(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_116(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_118(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_117(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_119(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_118(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_120(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_119(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_121(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_120(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_122(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_121(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_123(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_122(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_124(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_123(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_125(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_124(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_126(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_125(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_127(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_126(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_128(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_127(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_129(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_128(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_130(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_129(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_131(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_130(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_132(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_131(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_133(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_132(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_134(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_133(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_135(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_134(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_136(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_135(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_137(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_136(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_138(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_137(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_139(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_138(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_140(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_139(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_141(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_140(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_142(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_141(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_143(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_142(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_144(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_143(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_145(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_144(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_146(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_145(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_147(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_146(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_148(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_147(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_149(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_148(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_150(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_149(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_151(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_150(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_152(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_151(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_153(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_152(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_154(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_153(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_155(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_154(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_156(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_155(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_157(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_156(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_158(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_157(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_159(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_158(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_160(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_159(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_161(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_160(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_162(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_161(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_163(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_162(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_164(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_163(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_165(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_164(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_166(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_165(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_167(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_166(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_168(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_167(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_169(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_168(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_170(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_169(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_171(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_170(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_172(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_171(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_173(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_172(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_174(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_173(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_175(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_174(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_176(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_175(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_177(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_176(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_178(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_177(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_179(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_178(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_180(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_179(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_181(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_180(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_182(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_181(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_183(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_182(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_184(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_183(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_185(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_184(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_186(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_185(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_187(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_186(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_188(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_187(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_189(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_188(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_190(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_189(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_191(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_190(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_192(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_191(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_193(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_192(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_194(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_193(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_195(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_194(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_196(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_195(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_197(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_196(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_198(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_197(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_199(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_198(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_200(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_199(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_201(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_200(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_202(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_201(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_203(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_202(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_204(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_203(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_205(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_204(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_206(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_205(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_207(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_206(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_208(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_207(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_209(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_208(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_210(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_209(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_211(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_210(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_212(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_211(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_213(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_212(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_214(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_213(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_215(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_214(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_216(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_215(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_217(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_216(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_218(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_217(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_219(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_218(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_220(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_219(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_221(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_220(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_222(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_221(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_223(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_222(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_224(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_223(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_225(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_224(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_226(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_225(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_227(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_226(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_228(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_227(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_229(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_228(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_230(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_229(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_231(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_230(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_232(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_231(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_233(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_232(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_234(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_233(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_235(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_234(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_236(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_235(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_237(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_236(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_238(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_237(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_239(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_238(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_240(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_239(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_241(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_240(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_242(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_241(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_243(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_242(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_244(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_243(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_245(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_244(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_246(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_245(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_247(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_246(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_248(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_247(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_249(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_248(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_250(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_249(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_251(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_250(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_252(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_251(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_253(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_252(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_254(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_253(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_255(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_254(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_256(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_255(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_257(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_256(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_258(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_257(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_259(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_258(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_260(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_259(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_261(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_260(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_262(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_261(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_263(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_262(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_264(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_263(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_265(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_264(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_266(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_265(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_267(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_266(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_268(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_267(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_269(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_268(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_270(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_269(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_271(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_270(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_272(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_271(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_273(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_272(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_274(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_273(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_275(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_274(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_276(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_275(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_277(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_276(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_278(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_277(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_279(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_278(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_280(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_279(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_281(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_280(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_282(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_281(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_283(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_282(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_284(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_283(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_285(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_284(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_286(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_285(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_287(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_286(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_288(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_287(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_289(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_288(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_290(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_289(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_291(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_290(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_292(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_291(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_293(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_292(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_294(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_293(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_295(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_294(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_296(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_295(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_297(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_296(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_298(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_297(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_299(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_298(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_300(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_299(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_301(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_300(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_302(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_301(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_303(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_302(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_304(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_303(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_305(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_304(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_306(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_305(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_307(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_306(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_308(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_307(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_309(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_308(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_310(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_309(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_311(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_310(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_312(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_311(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_313(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_312(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_314(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_313(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_315(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_314(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_316(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_315(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_317(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_316(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_318(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_317(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_319(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_318(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_320(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_319(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_321(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_320(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_322(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_321(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_323(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_322(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_324(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_323(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_325(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_324(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_326(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_325(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_327(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_326(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_328(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_327(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_329(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_328(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_330(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_329(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_331(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_330(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_332(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_331(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_333(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_332(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_334(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_333(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_335(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_334(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_336(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_335(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_337(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_336(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_338(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_337(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_339(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_338(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_340(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_339(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_341(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_340(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_342(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_341(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_343(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_342(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_344(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_343(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_345(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_344(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_346(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_345(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_347(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_346(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_348(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_347(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_349(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_348(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_350(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_349(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_351(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_350(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_352(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_351(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_353(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_352(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_354(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_353(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_355(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_354(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_356(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_355(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_357(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_356(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_358(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_357(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_359(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_358(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_360(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_359(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_361(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_360(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_362(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_361(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_363(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_362(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_364(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_363(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_365(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_364(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_366(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_365(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_367(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_366(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_368(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_367(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_369(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_368(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_370(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_369(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_371(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_370(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_372(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_371(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_373(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_372(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_374(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_373(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_375(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_374(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_376(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_375(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_377(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_376(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_378(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_377(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_379(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_378(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_380(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_379(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_381(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_380(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_382(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_381(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_383(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_382(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_384(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_383(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_385(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_384(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_386(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_385(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_387(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_386(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_388(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_387(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_389(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_388(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_390(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_389(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_391(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_390(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_392(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_391(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_393(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_392(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_394(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_393(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_395(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_394(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_396(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_395(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_397(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_396(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_398(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_397(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_399(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_398(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_400(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_399(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_401(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_400(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_402(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_401(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_403(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_402(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_404(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_403(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_405(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_404(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_406(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_405(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_407(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_406(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_408(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_407(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_409(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_408(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_410(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_409(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_411(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_410(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_412(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_411(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_413(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_412(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_414(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_413(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_415(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_414(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_416(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_415(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_417(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_416(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_418(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_417(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_419(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_418(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_420(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_419(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_421(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_420(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_422(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_421(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_423(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_422(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_424(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_423(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_425(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_424(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_426(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_425(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_427(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_426(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_428(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_427(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_429(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_428(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_430(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_429(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_431(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_430(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_432(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_431(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_433(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_432(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_434(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_433(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_435(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_434(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_436(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_435(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_437(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_436(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_438(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_437(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_439(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_438(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_440(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_439(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_441(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_440(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_442(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_441(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_443(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_442(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_444(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_443(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_445(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_444(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_446(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_445(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_447(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_446(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_448(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_447(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_449(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_448(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_450(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_449(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_451(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_450(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_452(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_451(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_453(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_452(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_454(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_453(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_455(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_454(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_456(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_455(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_457(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_456(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_458(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_457(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_459(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_458(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_460(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_459(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_461(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_460(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_462(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_461(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_463(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_462(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_464(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_463(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_465(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_464(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_466(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_465(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_467(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_466(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_468(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_467(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_469(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_468(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_470(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_469(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_471(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_470(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_472(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_471(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_473(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_472(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_474(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_473(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_475(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_474(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_476(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_475(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_477(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_476(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_478(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_477(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_479(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_478(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_480(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_479(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_481(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_480(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_482(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_481(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_483(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_482(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_484(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_483(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_485(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_484(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_486(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_485(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_487(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_486(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_488(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_487(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_489(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_488(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_490(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_489(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_491(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_490(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_492(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_491(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_493(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_492(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_494(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_493(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_495(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_494(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_496(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_495(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_497(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_496(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_498(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_497(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_499(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_498(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_500(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_499(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_501(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_500(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_502(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_501(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_503(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_502(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_504(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_503(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_505(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_504(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_506(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_505(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_507(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_506(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_508(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_507(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_509(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_508(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_510(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_509(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_511(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_510(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_512(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_511(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_513(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_512(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_514(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_513(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_515(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_514(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_516(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_515(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_517(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_516(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_518(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_517(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_519(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_518(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_520(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_519(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_521(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_520(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_522(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_521(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_523(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_522(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_524(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_523(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_525(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_524(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_526(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_525(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_527(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_526(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_528(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_527(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_529(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_528(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_530(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_529(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_531(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_530(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_532(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_531(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_533(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_532(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_534(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_533(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_535(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_534(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_536(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_535(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_537(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_536(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_538(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_537(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_539(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_538(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_540(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_539(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_541(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_540(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_542(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_541(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_543(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_542(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_544(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_543(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_545(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_544(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_546(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_545(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_547(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_546(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_548(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_547(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_549(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_548(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_550(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_549(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_551(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_550(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_552(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_551(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_553(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_552(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_554(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_553(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_555(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_554(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_556(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_555(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_557(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_556(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_558(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_557(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_559(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_558(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_560(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_559(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_561(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_560(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_562(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_561(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_563(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_562(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_564(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_563(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_565(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_564(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_566(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_565(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_567(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_566(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_568(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_567(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_569(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_568(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_570(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_569(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_571(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_570(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_572(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_571(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_573(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_572(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_574(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_573(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_575(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_574(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_576(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_575(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_577(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_576(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_578(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_577(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_579(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_578(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_580(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_579(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_581(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_580(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_582(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_581(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_583(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_582(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_584(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_583(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_585(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_584(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_586(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_585(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_587(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_586(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_588(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_587(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_589(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_588(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_590(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_589(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_591(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_590(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_592(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_591(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_593(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_592(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_594(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_593(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_595(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_594(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_596(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_595(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_597(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_596(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_598(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_597(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_599(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_598(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_600(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_599(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_601(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_600(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_602(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_601(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_603(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_602(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_604(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_603(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_605(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_604(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_606(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_605(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_607(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_606(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_608(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_607(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_609(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_608(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_610(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_609(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_611(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_610(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_612(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_611(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_613(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_612(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_614(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_613(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_615(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_614(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_616(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_615(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_617(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_616(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_618(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_617(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_619(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_618(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_620(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_619(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_621(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_620(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_622(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_621(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_623(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_622(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_624(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_623(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_625(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_624(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_626(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_625(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_627(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_626(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_628(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_627(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_629(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_628(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_630(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_629(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_631(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_630(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_632(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_631(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_633(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_632(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_634(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_633(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_635(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_634(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_636(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_635(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_637(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_636(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_638(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_637(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_639(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_638(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_640(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_639(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_641(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_640(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_642(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_641(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_643(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_642(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_644(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_643(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_645(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_644(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_646(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_645(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_647(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_646(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_648(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_647(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_649(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_648(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_650(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_649(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_651(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_650(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_652(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_651(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_653(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_652(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_654(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_653(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_655(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_654(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_656(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_655(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_657(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_656(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_658(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_657(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_659(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_658(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_660(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_659(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_661(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_660(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_662(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_661(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_663(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_662(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_664(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_663(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_665(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_664(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_666(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_665(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_667(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_666(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_668(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_667(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_669(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_668(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_670(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_669(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_671(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_670(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_672(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_671(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_673(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_672(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_674(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_673(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_675(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_674(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_676(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_675(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_677(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_676(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_678(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_677(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_679(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_678(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_680(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_679(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_681(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_680(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_682(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_681(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_683(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_682(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_684(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_683(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_685(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_684(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_686(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_685(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_687(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_686(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_688(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_687(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_689(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_688(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_690(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_689(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_691(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_690(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_692(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_691(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_693(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_692(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_694(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_693(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_695(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_694(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_696(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_695(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_697(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_696(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_698(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_697(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_699(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_698(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_700(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_699(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_701(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_700(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_702(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_701(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_703(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_702(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_704(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_703(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_705(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_704(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_706(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_705(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_707(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_706(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_708(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_707(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_709(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_708(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_710(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_709(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_711(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_710(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_712(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_711(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_713(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_712(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_714(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_713(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_715(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_714(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_716(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_715(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_717(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_716(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_718(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_717(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_719(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_718(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_720(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_719(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_721(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_720(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_722(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_721(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_723(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_722(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_724(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_723(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_725(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_724(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_726(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_725(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_727(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_726(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_728(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_727(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_729(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_728(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_730(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_729(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_731(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_730(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_732(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_731(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_733(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_732(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_734(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_733(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_735(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_734(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_736(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_735(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_737(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_736(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_738(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_737(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_739(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_738(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_740(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_739(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_741(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_740(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_742(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_741(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_743(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_742(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_744(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_743(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_745(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_744(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_746(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_745(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_747(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_746(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_748(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_747(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_749(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_748(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_750(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_749(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_751(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_750(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_752(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_751(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_753(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_752(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_754(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_753(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_755(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_754(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_756(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_755(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_757(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_756(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_758(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_757(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_759(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_758(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_760(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_759(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_761(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_760(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_762(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_761(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_763(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_762(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_764(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_763(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_765(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_764(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_766(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_765(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_767(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_766(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_768(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_767(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_769(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_768(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_770(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_769(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_771(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_770(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_772(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_771(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_773(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_772(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_774(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_773(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_775(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_774(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_776(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_775(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_777(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_776(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_778(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_777(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_779(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_778(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_780(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_779(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_781(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_780(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_782(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_781(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_783(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_782(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_784(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_783(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_785(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_784(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_786(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_785(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_787(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_786(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_788(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_787(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_789(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_788(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_790(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_789(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_791(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_790(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_792(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_791(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_793(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_792(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_794(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_793(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_795(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_794(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_796(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_795(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_797(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_796(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_798(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_797(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_799(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_798(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_800(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_799(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_801(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_800(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_802(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_801(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_803(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_802(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_804(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_803(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_805(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_804(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_806(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_805(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_807(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_806(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_808(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_807(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_809(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_808(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_810(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_809(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_811(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_810(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_812(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_811(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_813(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_812(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_814(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_813(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_815(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_814(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_816(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_815(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_817(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_816(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_818(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_817(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_819(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_818(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_820(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_819(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_821(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_820(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_822(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_821(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_823(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_822(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_824(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_823(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_825(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_824(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_826(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_825(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_827(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_826(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_828(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_827(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_829(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_828(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_830(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_829(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_831(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_830(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_832(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_831(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_833(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_832(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_834(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_833(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_835(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_834(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_836(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_835(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_837(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_836(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_838(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_837(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_839(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_838(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_840(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_839(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_841(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_840(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_842(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_841(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_843(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_842(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_844(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_843(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_845(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_844(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_846(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_845(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_847(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_846(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_848(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_847(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_849(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_848(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_850(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_849(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_851(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_850(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_852(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_851(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_853(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_852(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_854(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_853(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_855(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_854(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_856(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_855(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_857(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_856(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_858(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_857(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_859(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_858(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_860(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_859(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_861(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_860(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_862(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_861(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_863(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_862(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_864(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_863(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_865(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_864(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_866(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_865(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_867(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_866(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_868(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_867(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_869(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_868(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_870(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_869(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_871(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_870(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_872(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_871(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_873(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_872(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_874(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_873(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_875(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_874(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_876(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_875(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_877(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_876(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_878(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_877(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_879(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_878(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_880(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_879(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_881(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_880(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_882(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_881(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_883(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_882(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_884(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_883(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_885(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_884(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_886(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_885(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_887(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_886(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_888(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_887(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_889(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_888(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_890(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_889(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_891(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_890(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_892(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_891(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_893(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_892(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_894(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_893(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_895(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_894(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_896(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_895(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_897(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_896(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_898(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_897(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_899(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_898(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_900(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_899(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_901(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_900(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_902(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_901(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_903(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_902(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_904(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_903(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_905(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_904(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_906(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_905(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_907(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_906(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_908(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_907(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_909(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_908(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_910(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_909(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_911(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_910(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_912(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_911(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_913(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_912(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_914(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_913(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_915(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_914(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_916(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_915(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_917(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_916(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_918(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_917(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_919(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_918(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_920(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_919(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_921(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_920(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_922(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_921(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_923(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_922(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_924(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_923(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_925(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_924(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_926(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_925(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_927(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_926(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_928(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_927(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_929(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_928(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_930(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_929(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_931(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_930(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_932(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_931(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_933(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_932(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_934(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_933(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_935(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_934(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_936(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_935(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_937(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_936(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_938(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_937(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_939(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_938(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_940(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_939(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_941(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_940(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_942(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_941(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_943(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_942(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_944(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_943(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_945(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_944(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_946(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_945(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_947(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_946(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_948(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_947(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_949(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_948(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_950(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_949(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_951(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_950(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_952(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_951(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_953(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_952(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_954(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_953(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_955(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_954(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_956(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_955(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_957(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_956(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_958(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_957(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_959(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_958(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_960(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_959(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_961(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_960(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_962(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_961(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_963(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_962(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_964(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_963(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_965(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_964(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_966(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_965(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_967(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_966(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_968(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_967(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_969(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_968(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_970(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_969(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_971(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_970(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_972(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_971(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_973(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_972(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_974(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_973(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_975(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_974(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_976(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_975(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_977(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_976(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_978(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_977(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_979(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_978(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_980(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_979(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_981(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_980(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_982(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_981(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_983(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_982(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_984(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_983(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_985(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_984(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_986(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_985(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_987(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_986(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_988(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_987(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_989(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_988(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_990(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_989(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_991(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_990(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_992(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_991(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_993(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_992(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_994(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_993(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_995(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_994(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_996(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_995(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_997(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_996(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_998(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_997(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_999(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_998(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1000(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_999(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1001(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1000(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1002(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1001(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1003(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1002(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1004(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1003(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1005(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1004(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1006(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1005(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1007(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1006(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1008(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1007(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1009(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1008(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1010(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1009(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1011(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1010(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1012(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1011(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1013(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1012(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1014(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1013(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1015(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1014(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1016(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1015(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1017(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1016(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1018(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1017(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1019(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1018(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1020(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1019(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1021(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1020(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1022(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1021(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1023(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1022(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1024(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1023(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_1025(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1024(op, op(state, x), __VA_ARGS__) )
+
+#endif // GMP_MACRO_LIMITS_FOLD_1024_HPP_
@@ -0,0 +1,264 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_FOLD_254_HPP_
+#define GMP_MACRO_LIMITS_FOLD_254_HPP_
+
+// GMP_FOLD_LEFT
+#define _GMP_FOLD_LEFT_0(op, state, ...) state
+#define _GMP_FOLD_LEFT_1(op, state, x) op(state, x)
+#define _GMP_FOLD_LEFT_2(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_3(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_2(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_4(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_3(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_5(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_4(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_6(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_5(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_7(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_6(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_8(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_7(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_9(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_8(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_10(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_9(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_11(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_10(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_12(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_11(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_13(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_12(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_14(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_13(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_15(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_14(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_16(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_15(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_17(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_16(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_18(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_17(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_19(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_18(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_20(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_19(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_21(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_20(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_22(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_21(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_23(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_22(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_24(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_23(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_25(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_24(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_26(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_25(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_27(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_26(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_28(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_27(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_29(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_28(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_30(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_29(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_31(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_30(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_32(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_31(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_33(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_32(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_34(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_33(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_35(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_34(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_36(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_35(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_37(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_36(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_38(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_37(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_39(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_38(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_40(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_39(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_41(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_40(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_42(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_41(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_43(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_42(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_44(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_43(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_45(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_44(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_46(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_45(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_47(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_46(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_48(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_47(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_49(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_48(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_50(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_49(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_51(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_50(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_52(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_51(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_53(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_52(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_54(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_53(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_55(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_54(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_56(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_55(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_57(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_56(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_58(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_57(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_59(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_58(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_60(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_59(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_61(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_60(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_62(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_61(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_63(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_62(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_64(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_63(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_65(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_64(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_66(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_65(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_67(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_66(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_68(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_67(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_69(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_68(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_70(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_69(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_71(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_70(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_72(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_71(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_73(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_72(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_74(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_73(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_75(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_74(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_76(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_75(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_77(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_76(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_78(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_77(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_79(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_78(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_80(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_79(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_81(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_80(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_82(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_81(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_83(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_82(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_84(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_83(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_85(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_84(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_86(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_85(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_87(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_86(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_88(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_87(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_89(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_88(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_90(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_89(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_91(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_90(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_92(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_91(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_93(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_92(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_94(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_93(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_95(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_94(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_96(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_95(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_97(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_96(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_98(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_97(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_99(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_98(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_100(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_99(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_101(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_100(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_102(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_101(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_103(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_102(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_104(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_103(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_105(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_104(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_106(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_105(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_107(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_106(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_108(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_107(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_109(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_108(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_110(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_109(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_111(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_110(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_112(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_111(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_113(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_112(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_114(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_113(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_115(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_114(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_116(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_115(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_117(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_116(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_118(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_117(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_119(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_118(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_120(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_119(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_121(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_120(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_122(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_121(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_123(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_122(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_124(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_123(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_125(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_124(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_126(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_125(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_127(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_126(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_128(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_127(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_129(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_128(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_130(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_129(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_131(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_130(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_132(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_131(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_133(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_132(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_134(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_133(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_135(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_134(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_136(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_135(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_137(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_136(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_138(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_137(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_139(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_138(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_140(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_139(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_141(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_140(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_142(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_141(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_143(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_142(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_144(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_143(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_145(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_144(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_146(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_145(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_147(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_146(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_148(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_147(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_149(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_148(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_150(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_149(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_151(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_150(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_152(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_151(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_153(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_152(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_154(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_153(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_155(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_154(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_156(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_155(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_157(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_156(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_158(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_157(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_159(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_158(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_160(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_159(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_161(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_160(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_162(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_161(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_163(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_162(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_164(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_163(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_165(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_164(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_166(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_165(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_167(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_166(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_168(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_167(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_169(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_168(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_170(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_169(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_171(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_170(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_172(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_171(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_173(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_172(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_174(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_173(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_175(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_174(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_176(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_175(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_177(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_176(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_178(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_177(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_179(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_178(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_180(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_179(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_181(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_180(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_182(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_181(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_183(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_182(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_184(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_183(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_185(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_184(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_186(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_185(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_187(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_186(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_188(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_187(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_189(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_188(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_190(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_189(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_191(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_190(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_192(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_191(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_193(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_192(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_194(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_193(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_195(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_194(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_196(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_195(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_197(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_196(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_198(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_197(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_199(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_198(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_200(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_199(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_201(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_200(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_202(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_201(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_203(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_202(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_204(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_203(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_205(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_204(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_206(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_205(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_207(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_206(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_208(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_207(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_209(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_208(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_210(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_209(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_211(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_210(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_212(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_211(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_213(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_212(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_214(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_213(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_215(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_214(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_216(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_215(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_217(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_216(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_218(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_217(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_219(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_218(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_220(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_219(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_221(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_220(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_222(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_221(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_223(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_222(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_224(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_223(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_225(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_224(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_226(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_225(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_227(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_226(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_228(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_227(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_229(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_228(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_230(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_229(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_231(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_230(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_232(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_231(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_233(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_232(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_234(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_233(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_235(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_234(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_236(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_235(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_237(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_236(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_238(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_237(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_239(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_238(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_240(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_239(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_241(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_240(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_242(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_241(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_243(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_242(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_244(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_243(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_245(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_244(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_246(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_245(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_247(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_246(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_248(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_247(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_249(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_248(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_250(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_249(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_251(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_250(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_252(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_251(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_253(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_252(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_254(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_253(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_255(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_254(op, op(state, x), __VA_ARGS__) )
+
+#endif // GMP_MACRO_LIMITS_FOLD_254_HPP_
@@ -0,0 +1,74 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_FOLD_64_HPP_
+#define GMP_MACRO_LIMITS_FOLD_64_HPP_
+
+// GMP_FOLD_LEFT
+#define _GMP_FOLD_LEFT_0(op, state, ...) state
+#define _GMP_FOLD_LEFT_1(op, state, x) op(state, x)
+#define _GMP_FOLD_LEFT_2(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_1(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_3(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_2(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_4(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_3(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_5(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_4(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_6(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_5(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_7(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_6(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_8(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_7(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_9(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_8(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_10(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_9(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_11(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_10(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_12(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_11(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_13(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_12(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_14(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_13(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_15(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_14(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_16(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_15(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_17(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_16(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_18(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_17(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_19(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_18(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_20(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_19(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_21(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_20(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_22(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_21(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_23(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_22(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_24(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_23(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_25(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_24(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_26(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_25(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_27(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_26(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_28(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_27(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_29(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_28(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_30(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_29(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_31(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_30(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_32(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_31(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_33(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_32(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_34(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_33(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_35(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_34(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_36(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_35(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_37(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_36(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_38(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_37(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_39(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_38(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_40(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_39(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_41(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_40(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_42(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_41(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_43(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_42(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_44(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_43(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_45(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_44(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_46(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_45(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_47(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_46(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_48(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_47(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_49(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_48(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_50(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_49(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_51(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_50(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_52(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_51(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_53(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_52(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_54(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_53(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_55(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_54(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_56(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_55(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_57(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_56(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_58(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_57(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_59(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_58(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_60(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_59(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_61(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_60(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_62(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_61(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_63(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_62(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_64(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_63(op, op(state, x), __VA_ARGS__) )
+#define _GMP_FOLD_LEFT_65(op, state, x, ...) GMP_EXPAND( _GMP_FOLD_LEFT_64(op, op(state, x), __VA_ARGS__) )
+
+#endif // GMP_MACRO_LIMITS_FOLD_64_HPP_
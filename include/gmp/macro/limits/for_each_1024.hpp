@@ -0,0 +1,2062 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_FOR_EACH_1024_HPP_
+#define GMP_MACRO_LIMITS_FOR_EACH_1024_HPP_
+
+// GMP_FOR_EACH
+#define _GMP_FOR_EACH_0(call, ...)
+#define _GMP_FOR_EACH_1(call, x) call(x)
+#define _GMP_FOR_EACH_2(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_3(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_2(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_4(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_3(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_5(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_4(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_6(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_5(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_7(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_6(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_8(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_7(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_9(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_8(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_10(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_9(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_11(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_10(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_12(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_11(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_13(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_12(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_14(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_13(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_15(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_14(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_16(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_15(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_17(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_16(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_18(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_17(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_19(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_18(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_20(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_19(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_21(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_20(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_22(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_21(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_23(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_22(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_24(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_23(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_25(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_24(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_26(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_25(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_27(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_26(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_28(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_27(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_29(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_28(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_30(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_29(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_31(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_30(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_32(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_31(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_33(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_32(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_34(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_33(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_35(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_34(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_36(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_35(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_37(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_36(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_38(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_37(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_39(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_38(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_40(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_39(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_41(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_40(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_42(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_41(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_43(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_42(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_44(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_43(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_45(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_44(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_46(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_45(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_47(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_46(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_48(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_47(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_49(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_48(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_50(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_49(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_51(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_50(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_52(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_51(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_53(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_52(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_54(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_53(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_55(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_54(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_56(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_55(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_57(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_56(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_58(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_57(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_59(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_58(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_60(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_59(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_61(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_60(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_62(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_61(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_63(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_62(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_64(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_63(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_65(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_64(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_66(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_65(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_67(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_66(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_68(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_67(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_69(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_68(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_70(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_69(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_71(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_70(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_72(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_71(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_73(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_72(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_74(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_73(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_75(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_74(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_76(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_75(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_77(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_76(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_78(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_77(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_79(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_78(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_80(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_79(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_81(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_80(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_82(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_81(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_83(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_82(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_84(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_83(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_85(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_84(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_86(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_85(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_87(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_86(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_88(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_87(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_89(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_88(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_90(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_89(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_91(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_90(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_92(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_91(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_93(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_92(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_94(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_93(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_95(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_94(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_96(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_95(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_97(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_96(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_98(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_97(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_99(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_98(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_100(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_99(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_101(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_100(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_102(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_101(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_103(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_102(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_104(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_103(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_105(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_104(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_106(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_105(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_107(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_106(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_108(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_107(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_109(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_108(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_110(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_109(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_111(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_110(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_112(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_111(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_113(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_112(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_114(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_113(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_115(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_114(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_116(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_115(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_117(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_116(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_118(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_117(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_119(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_118(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_120(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_119(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_121(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_120(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_122(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_121(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_123(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_122(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_124(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_123(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_125(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_124(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_126(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_125(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_127(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_126(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_128(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_127(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_129(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_128(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_130(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_129(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_131(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_130(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_132(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_131(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_133(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_132(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_134(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_133(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_135(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_134(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_136(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_135(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_137(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_136(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_138(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_137(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_139(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_138(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_140(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_139(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_141(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_140(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_142(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_141(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_143(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_142(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_144(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_143(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_145(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_144(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_146(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_145(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_147(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_146(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_148(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_147(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_149(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_148(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_150(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_149(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_151(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_150(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_152(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_151(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_153(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_152(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_154(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_153(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_155(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_154(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_156(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_155(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_157(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_156(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_158(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_157(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_159(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_158(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_160(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_159(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_161(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_160(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_162(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_161(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_163(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_162(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_164(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_163(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_165(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_164(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_166(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_165(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_167(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_166(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_168(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_167(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_169(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_168(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_170(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_169(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_171(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_170(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_172(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_171(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_173(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_172(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_174(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_173(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_175(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_174(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_176(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_175(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_177(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_176(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_178(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_177(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_179(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_178(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_180(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_179(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_181(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_180(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_182(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_181(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_183(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_182(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_184(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_183(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_185(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_184(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_186(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_185(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_187(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_186(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_188(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_187(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_189(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_188(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_190(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_189(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_191(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_190(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_192(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_191(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_193(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_192(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_194(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_193(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_195(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_194(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_196(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_195(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_197(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_196(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_198(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_197(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_199(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_198(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_200(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_199(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_201(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_200(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_202(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_201(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_203(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_202(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_204(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_203(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_205(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_204(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_206(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_205(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_207(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_206(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_208(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_207(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_209(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_208(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_210(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_209(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_211(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_210(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_212(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_211(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_213(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_212(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_214(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_213(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_215(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_214(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_216(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_215(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_217(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_216(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_218(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_217(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_219(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_218(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_220(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_219(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_221(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_220(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_222(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_221(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_223(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_222(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_224(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_223(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_225(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_224(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_226(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_225(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_227(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_226(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_228(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_227(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_229(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_228(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_230(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_229(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_231(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_230(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_232(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_231(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_233(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_232(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_234(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_233(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_235(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_234(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_236(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_235(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_237(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_236(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_238(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_237(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_239(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_238(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_240(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_239(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_241(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_240(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_242(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_241(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_243(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_242(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_244(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_243(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_245(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_244(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_246(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_245(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_247(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_246(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_248(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_247(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_249(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_248(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_250(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_249(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_251(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_250(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_252(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_251(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_253(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_252(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_254(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_253(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_255(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_254(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_256(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_255(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_257(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_256(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_258(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_257(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_259(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_258(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_260(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_259(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_261(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_260(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_262(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_261(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_263(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_262(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_264(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_263(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_265(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_264(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_266(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_265(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_267(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_266(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_268(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_267(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_269(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_268(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_270(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_269(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_271(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_270(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_272(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_271(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_273(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_272(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_274(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_273(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_275(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_274(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_276(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_275(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_277(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_276(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_278(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_277(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_279(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_278(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_280(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_279(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_281(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_280(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_282(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_281(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_283(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_282(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_284(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_283(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_285(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_284(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_286(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_285(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_287(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_286(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_288(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_287(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_289(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_288(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_290(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_289(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_291(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_290(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_292(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_291(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_293(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_292(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_294(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_293(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_295(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_294(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_296(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_295(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_297(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_296(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_298(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_297(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_299(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_298(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_300(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_299(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_301(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_300(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_302(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_301(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_303(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_302(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_304(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_303(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_305(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_304(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_306(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_305(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_307(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_306(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_308(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_307(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_309(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_308(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_310(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_309(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_311(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_310(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_312(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_311(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_313(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_312(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_314(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_313(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_315(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_314(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_316(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_315(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_317(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_316(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_318(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_317(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_319(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_318(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_320(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_319(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_321(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_320(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_322(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_321(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_323(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_322(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_324(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_323(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_325(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_324(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_326(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_325(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_327(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_326(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_328(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_327(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_329(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_328(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_330(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_329(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_331(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_330(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_332(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_331(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_333(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_332(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_334(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_333(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_335(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_334(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_336(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_335(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_337(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_336(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_338(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_337(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_339(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_338(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_340(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_339(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_341(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_340(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_342(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_341(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_343(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_342(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_344(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_343(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_345(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_344(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_346(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_345(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_347(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_346(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_348(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_347(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_349(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_348(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_350(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_349(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_351(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_350(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_352(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_351(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_353(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_352(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_354(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_353(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_355(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_354(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_356(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_355(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_357(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_356(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_358(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_357(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_359(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_358(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_360(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_359(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_361(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_360(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_362(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_361(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_363(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_362(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_364(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_363(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_365(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_364(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_366(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_365(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_367(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_366(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_368(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_367(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_369(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_368(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_370(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_369(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_371(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_370(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_372(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_371(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_373(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_372(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_374(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_373(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_375(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_374(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_376(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_375(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_377(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_376(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_378(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_377(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_379(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_378(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_380(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_379(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_381(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_380(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_382(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_381(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_383(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_382(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_384(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_383(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_385(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_384(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_386(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_385(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_387(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_386(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_388(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_387(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_389(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_388(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_390(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_389(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_391(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_390(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_392(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_391(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_393(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_392(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_394(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_393(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_395(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_394(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_396(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_395(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_397(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_396(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_398(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_397(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_399(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_398(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_400(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_399(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_401(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_400(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_402(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_401(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_403(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_402(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_404(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_403(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_405(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_404(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_406(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_405(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_407(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_406(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_408(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_407(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_409(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_408(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_410(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_409(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_411(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_410(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_412(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_411(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_413(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_412(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_414(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_413(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_415(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_414(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_416(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_415(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_417(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_416(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_418(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_417(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_419(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_418(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_420(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_419(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_421(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_420(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_422(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_421(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_423(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_422(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_424(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_423(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_425(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_424(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_426(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_425(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_427(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_426(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_428(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_427(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_429(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_428(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_430(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_429(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_431(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_430(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_432(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_431(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_433(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_432(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_434(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_433(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_435(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_434(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_436(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_435(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_437(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_436(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_438(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_437(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_439(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_438(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_440(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_439(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_441(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_440(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_442(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_441(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_443(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_442(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_444(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_443(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_445(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_444(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_446(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_445(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_447(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_446(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_448(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_447(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_449(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_448(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_450(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_449(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_451(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_450(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_452(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_451(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_453(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_452(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_454(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_453(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_455(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_454(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_456(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_455(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_457(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_456(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_458(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_457(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_459(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_458(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_460(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_459(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_461(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_460(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_462(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_461(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_463(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_462(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_464(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_463(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_465(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_464(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_466(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_465(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_467(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_466(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_468(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_467(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_469(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_468(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_470(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_469(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_471(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_470(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_472(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_471(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_473(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_472(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_474(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_473(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_475(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_474(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_476(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_475(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_477(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_476(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_478(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_477(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_479(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_478(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_480(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_479(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_481(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_480(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_482(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_481(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_483(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_482(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_484(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_483(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_485(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_484(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_486(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_485(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_487(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_486(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_488(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_487(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_489(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_488(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_490(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_489(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_491(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_490(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_492(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_491(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_493(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_492(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_494(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_493(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_495(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_494(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_496(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_495(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_497(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_496(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_498(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_497(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_499(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_498(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_500(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_499(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_501(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_500(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_502(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_501(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_503(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_502(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_504(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_503(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_505(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_504(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_506(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_505(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_507(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_506(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_508(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_507(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_509(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_508(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_510(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_509(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_511(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_510(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_512(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_511(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_513(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_512(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_514(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_513(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_515(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_514(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_516(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_515(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_517(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_516(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_518(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_517(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_519(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_518(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_520(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_519(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_521(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_520(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_522(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_521(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_523(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_522(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_524(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_523(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_525(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_524(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_526(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_525(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_527(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_526(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_528(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_527(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_529(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_528(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_530(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_529(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_531(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_530(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_532(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_531(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_533(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_532(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_534(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_533(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_535(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_534(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_536(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_535(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_537(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_536(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_538(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_537(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_539(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_538(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_540(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_539(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_541(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_540(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_542(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_541(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_543(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_542(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_544(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_543(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_545(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_544(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_546(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_545(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_547(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_546(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_548(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_547(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_549(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_548(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_550(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_549(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_551(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_550(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_552(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_551(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_553(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_552(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_554(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_553(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_555(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_554(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_556(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_555(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_557(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_556(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_558(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_557(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_559(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_558(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_560(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_559(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_561(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_560(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_562(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_561(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_563(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_562(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_564(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_563(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_565(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_564(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_566(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_565(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_567(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_566(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_568(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_567(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_569(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_568(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_570(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_569(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_571(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_570(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_572(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_571(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_573(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_572(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_574(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_573(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_575(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_574(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_576(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_575(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_577(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_576(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_578(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_577(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_579(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_578(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_580(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_579(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_581(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_580(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_582(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_581(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_583(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_582(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_584(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_583(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_585(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_584(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_586(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_585(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_587(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_586(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_588(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_587(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_589(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_588(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_590(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_589(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_591(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_590(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_592(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_591(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_593(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_592(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_594(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_593(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_595(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_594(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_596(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_595(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_597(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_596(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_598(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_597(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_599(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_598(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_600(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_599(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_601(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_600(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_602(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_601(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_603(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_602(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_604(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_603(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_605(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_604(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_606(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_605(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_607(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_606(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_608(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_607(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_609(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_608(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_610(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_609(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_611(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_610(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_612(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_611(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_613(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_612(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_614(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_613(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_615(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_614(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_616(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_615(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_617(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_616(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_618(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_617(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_619(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_618(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_620(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_619(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_621(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_620(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_622(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_621(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_623(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_622(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_624(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_623(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_625(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_624(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_626(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_625(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_627(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_626(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_628(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_627(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_629(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_628(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_630(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_629(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_631(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_630(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_632(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_631(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_633(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_632(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_634(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_633(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_635(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_634(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_636(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_635(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_637(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_636(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_638(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_637(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_639(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_638(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_640(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_639(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_641(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_640(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_642(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_641(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_643(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_642(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_644(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_643(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_645(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_644(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_646(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_645(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_647(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_646(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_648(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_647(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_649(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_648(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_650(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_649(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_651(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_650(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_652(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_651(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_653(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_652(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_654(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_653(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_655(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_654(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_656(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_655(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_657(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_656(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_658(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_657(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_659(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_658(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_660(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_659(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_661(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_660(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_662(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_661(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_663(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_662(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_664(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_663(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_665(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_664(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_666(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_665(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_667(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_666(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_668(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_667(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_669(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_668(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_670(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_669(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_671(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_670(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_672(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_671(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_673(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_672(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_674(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_673(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_675(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_674(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_676(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_675(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_677(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_676(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_678(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_677(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_679(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_678(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_680(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_679(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_681(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_680(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_682(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_681(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_683(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_682(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_684(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_683(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_685(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_684(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_686(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_685(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_687(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_686(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_688(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_687(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_689(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_688(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_690(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_689(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_691(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_690(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_692(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_691(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_693(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_692(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_694(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_693(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_695(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_694(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_696(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_695(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_697(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_696(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_698(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_697(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_699(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_698(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_700(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_699(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_701(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_700(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_702(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_701(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_703(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_702(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_704(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_703(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_705(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_704(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_706(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_705(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_707(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_706(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_708(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_707(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_709(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_708(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_710(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_709(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_711(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_710(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_712(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_711(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_713(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_712(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_714(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_713(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_715(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_714(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_716(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_715(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_717(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_716(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_718(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_717(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_719(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_718(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_720(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_719(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_721(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_720(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_722(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_721(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_723(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_722(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_724(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_723(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_725(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_724(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_726(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_725(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_727(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_726(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_728(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_727(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_729(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_728(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_730(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_729(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_731(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_730(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_732(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_731(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_733(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_732(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_734(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_733(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_735(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_734(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_736(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_735(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_737(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_736(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_738(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_737(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_739(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_738(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_740(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_739(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_741(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_740(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_742(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_741(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_743(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_742(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_744(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_743(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_745(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_744(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_746(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_745(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_747(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_746(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_748(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_747(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_749(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_748(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_750(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_749(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_751(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_750(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_752(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_751(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_753(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_752(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_754(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_753(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_755(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_754(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_756(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_755(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_757(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_756(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_758(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_757(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_759(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_758(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_760(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_759(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_761(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_760(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_762(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_761(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_763(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_762(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_764(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_763(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_765(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_764(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_766(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_765(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_767(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_766(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_768(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_767(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_769(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_768(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_770(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_769(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_771(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_770(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_772(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_771(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_773(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_772(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_774(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_773(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_775(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_774(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_776(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_775(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_777(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_776(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_778(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_777(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_779(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_778(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_780(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_779(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_781(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_780(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_782(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_781(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_783(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_782(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_784(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_783(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_785(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_784(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_786(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_785(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_787(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_786(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_788(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_787(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_789(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_788(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_790(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_789(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_791(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_790(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_792(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_791(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_793(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_792(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_794(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_793(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_795(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_794(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_796(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_795(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_797(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_796(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_798(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_797(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_799(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_798(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_800(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_799(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_801(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_800(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_802(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_801(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_803(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_802(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_804(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_803(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_805(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_804(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_806(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_805(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_807(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_806(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_808(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_807(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_809(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_808(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_810(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_809(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_811(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_810(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_812(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_811(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_813(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_812(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_814(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_813(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_815(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_814(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_816(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_815(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_817(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_816(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_818(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_817(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_819(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_818(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_820(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_819(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_821(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_820(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_822(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_821(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_823(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_822(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_824(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_823(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_825(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_824(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_826(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_825(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_827(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_826(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_828(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_827(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_829(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_828(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_830(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_829(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_831(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_830(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_832(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_831(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_833(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_832(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_834(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_833(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_835(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_834(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_836(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_835(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_837(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_836(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_838(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_837(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_839(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_838(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_840(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_839(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_841(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_840(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_842(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_841(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_843(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_842(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_844(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_843(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_845(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_844(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_846(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_845(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_847(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_846(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_848(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_847(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_849(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_848(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_850(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_849(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_851(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_850(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_852(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_851(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_853(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_852(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_854(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_853(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_855(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_854(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_856(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_855(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_857(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_856(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_858(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_857(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_859(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_858(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_860(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_859(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_861(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_860(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_862(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_861(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_863(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_862(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_864(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_863(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_865(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_864(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_866(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_865(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_867(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_866(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_868(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_867(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_869(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_868(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_870(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_869(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_871(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_870(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_872(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_871(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_873(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_872(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_874(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_873(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_875(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_874(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_876(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_875(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_877(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_876(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_878(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_877(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_879(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_878(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_880(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_879(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_881(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_880(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_882(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_881(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_883(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_882(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_884(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_883(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_885(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_884(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_886(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_885(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_887(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_886(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_888(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_887(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_889(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_888(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_890(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_889(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_891(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_890(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_892(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_891(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_893(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_892(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_894(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_893(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_895(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_894(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_896(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_895(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_897(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_896(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_898(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_897(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_899(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_898(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_900(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_899(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_901(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_900(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_902(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_901(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_903(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_902(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_904(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_903(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_905(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_904(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_906(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_905(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_907(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_906(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_908(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_907(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_909(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_908(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_910(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_909(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_911(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_910(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_912(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_911(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_913(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_912(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_914(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_913(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_915(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_914(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_916(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_915(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_917(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_916(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_918(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_917(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_919(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_918(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_920(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_919(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_921(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_920(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_922(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_921(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_923(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_922(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_924(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_923(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_925(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_924(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_926(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_925(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_927(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_926(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_928(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_927(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_929(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_928(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_930(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_929(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_931(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_930(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_932(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_931(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_933(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_932(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_934(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_933(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_935(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_934(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_936(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_935(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_937(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_936(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_938(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_937(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_939(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_938(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_940(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_939(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_941(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_940(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_942(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_941(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_943(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_942(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_944(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_943(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_945(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_944(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_946(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_945(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_947(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_946(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_948(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_947(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_949(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_948(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_950(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_949(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_951(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_950(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_952(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_951(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_953(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_952(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_954(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_953(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_955(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_954(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_956(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_955(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_957(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_956(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_958(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_957(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_959(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_958(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_960(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_959(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_961(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_960(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_962(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_961(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_963(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_962(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_964(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_963(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_965(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_964(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_966(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_965(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_967(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_966(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_968(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_967(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_969(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_968(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_970(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_969(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_971(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_970(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_972(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_971(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_973(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_972(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_974(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_973(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_975(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_974(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_976(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_975(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_977(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_976(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_978(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_977(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_979(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_978(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_980(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_979(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_981(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_980(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_982(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_981(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_983(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_982(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_984(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_983(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_985(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_984(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_986(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_985(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_987(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_986(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_988(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_987(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_989(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_988(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_990(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_989(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_991(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_990(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_992(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_991(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_993(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_992(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_994(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_993(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_995(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_994(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_996(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_995(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_997(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_996(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_998(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_997(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_999(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_998(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1000(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_999(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1001(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1000(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1002(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1001(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1003(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1002(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1004(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1003(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1005(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1004(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1006(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1005(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1007(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1006(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1008(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1007(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1009(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1008(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1010(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1009(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1011(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1010(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1012(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1011(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1013(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1012(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1014(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1013(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1015(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1014(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1016(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1015(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1017(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1016(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1018(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1017(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1019(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1018(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1020(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1019(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1021(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1020(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1022(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1021(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1023(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1022(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1024(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1023(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_1025(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1024(call, __VA_ARGS__) )
+
+// GMP_FOR_EACH_I
+#define _GMP_FOR_EACH_I_0(call, data, sep, i, ...)
+#define _GMP_FOR_EACH_I_1(call, data, sep, i, x, ...) call(data, i, x)
+#define _GMP_FOR_EACH_I_2(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_3(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_2(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_4(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_3(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_5(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_4(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_6(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_5(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_7(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_6(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_8(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_7(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_9(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_8(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_10(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_9(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_11(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_10(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_12(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_11(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_13(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_12(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_14(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_13(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_15(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_14(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_16(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_15(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_17(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_16(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_18(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_17(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_19(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_18(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_20(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_19(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_21(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_20(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_22(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_21(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_23(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_22(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_24(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_23(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_25(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_24(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_26(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_25(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_27(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_26(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_28(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_27(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_29(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_28(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_30(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_29(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_31(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_30(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_32(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_31(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_33(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_32(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_34(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_33(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_35(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_34(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_36(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_35(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_37(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_36(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_38(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_37(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_39(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_38(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_40(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_39(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_41(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_40(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_42(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_41(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_43(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_42(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_44(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_43(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_45(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_44(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_46(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_45(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_47(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_46(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_48(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_47(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_49(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_48(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_50(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_49(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_51(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_50(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_52(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_51(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_53(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_52(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_54(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_53(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_55(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_54(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_56(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_55(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_57(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_56(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_58(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_57(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_59(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_58(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_60(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_59(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_61(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_60(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_62(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_61(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_63(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_62(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_64(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_63(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_65(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_64(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_66(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_65(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_67(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_66(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_68(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_67(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_69(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_68(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_70(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_69(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_71(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_70(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_72(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_71(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_73(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_72(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_74(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_73(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_75(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_74(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_76(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_75(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_77(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_76(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_78(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_77(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_79(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_78(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_80(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_79(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_81(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_80(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_82(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_81(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_83(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_82(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_84(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_83(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_85(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_84(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_86(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_85(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_87(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_86(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_88(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_87(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_89(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_88(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_90(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_89(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_91(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_90(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_92(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_91(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_93(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_92(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_94(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_93(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_95(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_94(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_96(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_95(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_97(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_96(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_98(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_97(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_99(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_98(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_100(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_99(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_101(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_100(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_102(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_101(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_103(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_102(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_104(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_103(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_105(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_104(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_106(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_105(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_107(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_106(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_108(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_107(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_109(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_108(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_110(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_109(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_111(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_110(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_112(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_111(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_113(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_112(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_114(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_113(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_115(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_114(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_116(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_115(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_117(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_116(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_118(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_117(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_119(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_118(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_120(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_119(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_121(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_120(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_122(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_121(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_123(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_122(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_124(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_123(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_125(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_124(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_126(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_125(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_127(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_126(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_128(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_127(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_129(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_128(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_130(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_129(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_131(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_130(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_132(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_131(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_133(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_132(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_134(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_133(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_135(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_134(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_136(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_135(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_137(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_136(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_138(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_137(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_139(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_138(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_140(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_139(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_141(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_140(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_142(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_141(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_143(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_142(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_144(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_143(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_145(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_144(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_146(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_145(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_147(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_146(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_148(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_147(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_149(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_148(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_150(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_149(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_151(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_150(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_152(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_151(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_153(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_152(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_154(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_153(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_155(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_154(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_156(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_155(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_157(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_156(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_158(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_157(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_159(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_158(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_160(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_159(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_161(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_160(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_162(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_161(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_163(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_162(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_164(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_163(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_165(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_164(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_166(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_165(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_167(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_166(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_168(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_167(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_169(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_168(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_170(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_169(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_171(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_170(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_172(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_171(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_173(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_172(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_174(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_173(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_175(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_174(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_176(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_175(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_177(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_176(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_178(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_177(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_179(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_178(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_180(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_179(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_181(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_180(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_182(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_181(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_183(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_182(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_184(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_183(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_185(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_184(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_186(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_185(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_187(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_186(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_188(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_187(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_189(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_188(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_190(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_189(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_191(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_190(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_192(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_191(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_193(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_192(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_194(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_193(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_195(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_194(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_196(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_195(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_197(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_196(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_198(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_197(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_199(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_198(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_200(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_199(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_201(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_200(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_202(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_201(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_203(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_202(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_204(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_203(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_205(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_204(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_206(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_205(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_207(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_206(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_208(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_207(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_209(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_208(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_210(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_209(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_211(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_210(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_212(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_211(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_213(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_212(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_214(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_213(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_215(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_214(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_216(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_215(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_217(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_216(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_218(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_217(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_219(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_218(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_220(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_219(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_221(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_220(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_222(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_221(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_223(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_222(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_224(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_223(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_225(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_224(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_226(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_225(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_227(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_226(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_228(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_227(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_229(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_228(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_230(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_229(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_231(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_230(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_232(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_231(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_233(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_232(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_234(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_233(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_235(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_234(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_236(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_235(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_237(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_236(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_238(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_237(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_239(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_238(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_240(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_239(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_241(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_240(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_242(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_241(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_243(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_242(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_244(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_243(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_245(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_244(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_246(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_245(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_247(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_246(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_248(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_247(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_249(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_248(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_250(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_249(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_251(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_250(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_252(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_251(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_253(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_252(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_254(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_253(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_255(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_254(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_256(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_255(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_257(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_256(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_258(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_257(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_259(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_258(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_260(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_259(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_261(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_260(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_262(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_261(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_263(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_262(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_264(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_263(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_265(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_264(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_266(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_265(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_267(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_266(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_268(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_267(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_269(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_268(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_270(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_269(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_271(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_270(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_272(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_271(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_273(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_272(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_274(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_273(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_275(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_274(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_276(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_275(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_277(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_276(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_278(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_277(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_279(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_278(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_280(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_279(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_281(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_280(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_282(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_281(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_283(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_282(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_284(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_283(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_285(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_284(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_286(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_285(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_287(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_286(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_288(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_287(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_289(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_288(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_290(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_289(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_291(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_290(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_292(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_291(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_293(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_292(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_294(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_293(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_295(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_294(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_296(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_295(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_297(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_296(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_298(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_297(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_299(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_298(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_300(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_299(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_301(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_300(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_302(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_301(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_303(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_302(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_304(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_303(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_305(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_304(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_306(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_305(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_307(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_306(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_308(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_307(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_309(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_308(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_310(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_309(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_311(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_310(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_312(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_311(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_313(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_312(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_314(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_313(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_315(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_314(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_316(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_315(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_317(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_316(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_318(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_317(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_319(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_318(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_320(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_319(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_321(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_320(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_322(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_321(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_323(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_322(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_324(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_323(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_325(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_324(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_326(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_325(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_327(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_326(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_328(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_327(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_329(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_328(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_330(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_329(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_331(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_330(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_332(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_331(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_333(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_332(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_334(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_333(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_335(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_334(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_336(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_335(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_337(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_336(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_338(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_337(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_339(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_338(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_340(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_339(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_341(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_340(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_342(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_341(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_343(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_342(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_344(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_343(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_345(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_344(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_346(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_345(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_347(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_346(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_348(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_347(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_349(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_348(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_350(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_349(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_351(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_350(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_352(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_351(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_353(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_352(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_354(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_353(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_355(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_354(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_356(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_355(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_357(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_356(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_358(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_357(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_359(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_358(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_360(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_359(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_361(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_360(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_362(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_361(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_363(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_362(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_364(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_363(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_365(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_364(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_366(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_365(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_367(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_366(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_368(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_367(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_369(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_368(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_370(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_369(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_371(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_370(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_372(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_371(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_373(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_372(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_374(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_373(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_375(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_374(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_376(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_375(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_377(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_376(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_378(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_377(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_379(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_378(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_380(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_379(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_381(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_380(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_382(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_381(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_383(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_382(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_384(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_383(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_385(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_384(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_386(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_385(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_387(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_386(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_388(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_387(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_389(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_388(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_390(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_389(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_391(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_390(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_392(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_391(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_393(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_392(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_394(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_393(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_395(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_394(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_396(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_395(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_397(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_396(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_398(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_397(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_399(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_398(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_400(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_399(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_401(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_400(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_402(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_401(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_403(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_402(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_404(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_403(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_405(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_404(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_406(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_405(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_407(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_406(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_408(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_407(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_409(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_408(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_410(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_409(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_411(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_410(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_412(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_411(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_413(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_412(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_414(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_413(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_415(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_414(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_416(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_415(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_417(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_416(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_418(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_417(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_419(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_418(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_420(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_419(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_421(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_420(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_422(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_421(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_423(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_422(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_424(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_423(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_425(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_424(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_426(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_425(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_427(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_426(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_428(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_427(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_429(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_428(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_430(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_429(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_431(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_430(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_432(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_431(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_433(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_432(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_434(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_433(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_435(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_434(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_436(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_435(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_437(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_436(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_438(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_437(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_439(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_438(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_440(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_439(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_441(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_440(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_442(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_441(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_443(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_442(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_444(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_443(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_445(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_444(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_446(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_445(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_447(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_446(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_448(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_447(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_449(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_448(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_450(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_449(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_451(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_450(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_452(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_451(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_453(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_452(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_454(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_453(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_455(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_454(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_456(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_455(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_457(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_456(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_458(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_457(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_459(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_458(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_460(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_459(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_461(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_460(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_462(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_461(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_463(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_462(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_464(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_463(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_465(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_464(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_466(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_465(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_467(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_466(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_468(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_467(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_469(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_468(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_470(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_469(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_471(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_470(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_472(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_471(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_473(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_472(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_474(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_473(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_475(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_474(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_476(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_475(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_477(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_476(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_478(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_477(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_479(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_478(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_480(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_479(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_481(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_480(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_482(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_481(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_483(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_482(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_484(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_483(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_485(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_484(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_486(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_485(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_487(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_486(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_488(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_487(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_489(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_488(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_490(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_489(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_491(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_490(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_492(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_491(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_493(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_492(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_494(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_493(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_495(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_494(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_496(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_495(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_497(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_496(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_498(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_497(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_499(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_498(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_500(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_499(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_501(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_500(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_502(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_501(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_503(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_502(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_504(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_503(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_505(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_504(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_506(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_505(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_507(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_506(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_508(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_507(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_509(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_508(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_510(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_509(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_511(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_510(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_512(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_511(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_513(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_512(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_514(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_513(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_515(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_514(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_516(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_515(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_517(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_516(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_518(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_517(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_519(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_518(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_520(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_519(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_521(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_520(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_522(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_521(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_523(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_522(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_524(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_523(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_525(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_524(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_526(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_525(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_527(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_526(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_528(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_527(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_529(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_528(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_530(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_529(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_531(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_530(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_532(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_531(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_533(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_532(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_534(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_533(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_535(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_534(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_536(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_535(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_537(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_536(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_538(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_537(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_539(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_538(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_540(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_539(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_541(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_540(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_542(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_541(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_543(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_542(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_544(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_543(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_545(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_544(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_546(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_545(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_547(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_546(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_548(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_547(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_549(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_548(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_550(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_549(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_551(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_550(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_552(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_551(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_553(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_552(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_554(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_553(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_555(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_554(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_556(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_555(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_557(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_556(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_558(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_557(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_559(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_558(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_560(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_559(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_561(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_560(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_562(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_561(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_563(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_562(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_564(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_563(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_565(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_564(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_566(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_565(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_567(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_566(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_568(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_567(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_569(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_568(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_570(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_569(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_571(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_570(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_572(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_571(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_573(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_572(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_574(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_573(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_575(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_574(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_576(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_575(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_577(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_576(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_578(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_577(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_579(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_578(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_580(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_579(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_581(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_580(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_582(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_581(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_583(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_582(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_584(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_583(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_585(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_584(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_586(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_585(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_587(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_586(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_588(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_587(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_589(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_588(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_590(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_589(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_591(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_590(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_592(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_591(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_593(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_592(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_594(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_593(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_595(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_594(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_596(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_595(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_597(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_596(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_598(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_597(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_599(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_598(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_600(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_599(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_601(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_600(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_602(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_601(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_603(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_602(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_604(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_603(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_605(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_604(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_606(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_605(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_607(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_606(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_608(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_607(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_609(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_608(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_610(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_609(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_611(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_610(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_612(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_611(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_613(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_612(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_614(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_613(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_615(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_614(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_616(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_615(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_617(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_616(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_618(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_617(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_619(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_618(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_620(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_619(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_621(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_620(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_622(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_621(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_623(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_622(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_624(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_623(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_625(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_624(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_626(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_625(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_627(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_626(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_628(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_627(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_629(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_628(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_630(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_629(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_631(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_630(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_632(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_631(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_633(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_632(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_634(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_633(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_635(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_634(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_636(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_635(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_637(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_636(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_638(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_637(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_639(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_638(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_640(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_639(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_641(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_640(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_642(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_641(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_643(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_642(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_644(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_643(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_645(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_644(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_646(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_645(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_647(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_646(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_648(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_647(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_649(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_648(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_650(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_649(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_651(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_650(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_652(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_651(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_653(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_652(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_654(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_653(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_655(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_654(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_656(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_655(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_657(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_656(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_658(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_657(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_659(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_658(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_660(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_659(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_661(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_660(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_662(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_661(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_663(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_662(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_664(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_663(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_665(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_664(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_666(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_665(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_667(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_666(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_668(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_667(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_669(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_668(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_670(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_669(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_671(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_670(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_672(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_671(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_673(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_672(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_674(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_673(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_675(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_674(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_676(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_675(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_677(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_676(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_678(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_677(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_679(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_678(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_680(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_679(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_681(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_680(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_682(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_681(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_683(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_682(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_684(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_683(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_685(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_684(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_686(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_685(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_687(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_686(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_688(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_687(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_689(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_688(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_690(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_689(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_691(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_690(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_692(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_691(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_693(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_692(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_694(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_693(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_695(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_694(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_696(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_695(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_697(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_696(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_698(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_697(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_699(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_698(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_700(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_699(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_701(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_700(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_702(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_701(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_703(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_702(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_704(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_703(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_705(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_704(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_706(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_705(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_707(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_706(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_708(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_707(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_709(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_708(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_710(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_709(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_711(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_710(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_712(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_711(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_713(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_712(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_714(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_713(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_715(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_714(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_716(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_715(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_717(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_716(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_718(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_717(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_719(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_718(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_720(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_719(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_721(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_720(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_722(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_721(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_723(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_722(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_724(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_723(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_725(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_724(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_726(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_725(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_727(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_726(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_728(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_727(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_729(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_728(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_730(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_729(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_731(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_730(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_732(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_731(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_733(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_732(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_734(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_733(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_735(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_734(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_736(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_735(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_737(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_736(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_738(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_737(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_739(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_738(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_740(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_739(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_741(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_740(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_742(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_741(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_743(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_742(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_744(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_743(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_745(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_744(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_746(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_745(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_747(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_746(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_748(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_747(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_749(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_748(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_750(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_749(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_751(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_750(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_752(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_751(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_753(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_752(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_754(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_753(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_755(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_754(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_756(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_755(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_757(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_756(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_758(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_757(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_759(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_758(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_760(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_759(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_761(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_760(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_762(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_761(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_763(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_762(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_764(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_763(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_765(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_764(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_766(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_765(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_767(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_766(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_768(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_767(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_769(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_768(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_770(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_769(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_771(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_770(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_772(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_771(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_773(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_772(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_774(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_773(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_775(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_774(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_776(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_775(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_777(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_776(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_778(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_777(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_779(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_778(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_780(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_779(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_781(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_780(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_782(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_781(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_783(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_782(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_784(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_783(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_785(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_784(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_786(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_785(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_787(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_786(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_788(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_787(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_789(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_788(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_790(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_789(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_791(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_790(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_792(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_791(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_793(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_792(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_794(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_793(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_795(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_794(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_796(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_795(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_797(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_796(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_798(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_797(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_799(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_798(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_800(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_799(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_801(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_800(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_802(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_801(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_803(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_802(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_804(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_803(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_805(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_804(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_806(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_805(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_807(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_806(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_808(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_807(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_809(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_808(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_810(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_809(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_811(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_810(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_812(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_811(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_813(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_812(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_814(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_813(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_815(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_814(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_816(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_815(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_817(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_816(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_818(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_817(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_819(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_818(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_820(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_819(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_821(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_820(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_822(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_821(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_823(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_822(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_824(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_823(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_825(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_824(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_826(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_825(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_827(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_826(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_828(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_827(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_829(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_828(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_830(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_829(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_831(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_830(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_832(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_831(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_833(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_832(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_834(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_833(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_835(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_834(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_836(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_835(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_837(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_836(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_838(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_837(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_839(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_838(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_840(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_839(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_841(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_840(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_842(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_841(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_843(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_842(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_844(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_843(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_845(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_844(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_846(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_845(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_847(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_846(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_848(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_847(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_849(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_848(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_850(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_849(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_851(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_850(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_852(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_851(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_853(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_852(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_854(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_853(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_855(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_854(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_856(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_855(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_857(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_856(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_858(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_857(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_859(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_858(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_860(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_859(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_861(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_860(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_862(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_861(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_863(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_862(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_864(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_863(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_865(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_864(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_866(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_865(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_867(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_866(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_868(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_867(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_869(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_868(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_870(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_869(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_871(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_870(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_872(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_871(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_873(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_872(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_874(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_873(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_875(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_874(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_876(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_875(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_877(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_876(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_878(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_877(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_879(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_878(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_880(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_879(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_881(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_880(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_882(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_881(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_883(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_882(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_884(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_883(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_885(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_884(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_886(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_885(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_887(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_886(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_888(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_887(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_889(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_888(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_890(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_889(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_891(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_890(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_892(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_891(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_893(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_892(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_894(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_893(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_895(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_894(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_896(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_895(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_897(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_896(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_898(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_897(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_899(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_898(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_900(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_899(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_901(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_900(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_902(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_901(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_903(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_902(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_904(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_903(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_905(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_904(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_906(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_905(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_907(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_906(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_908(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_907(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_909(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_908(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_910(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_909(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_911(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_910(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_912(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_911(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_913(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_912(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_914(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_913(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_915(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_914(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_916(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_915(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_917(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_916(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_918(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_917(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_919(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_918(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_920(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_919(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_921(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_920(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_922(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_921(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_923(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_922(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_924(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_923(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_925(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_924(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_926(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_925(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_927(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_926(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_928(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_927(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_929(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_928(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_930(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_929(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_931(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_930(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_932(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_931(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_933(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_932(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_934(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_933(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_935(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_934(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_936(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_935(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_937(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_936(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_938(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_937(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_939(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_938(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_940(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_939(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_941(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_940(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_942(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_941(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_943(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_942(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_944(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_943(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_945(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_944(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_946(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_945(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_947(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_946(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_948(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_947(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_949(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_948(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_950(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_949(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_951(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_950(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_952(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_951(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_953(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_952(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_954(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_953(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_955(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_954(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_956(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_955(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_957(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_956(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_958(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_957(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_959(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_958(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_960(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_959(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_961(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_960(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_962(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_961(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_963(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_962(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_964(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_963(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_965(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_964(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_966(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_965(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_967(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_966(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_968(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_967(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_969(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_968(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_970(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_969(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_971(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_970(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_972(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_971(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_973(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_972(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_974(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_973(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_975(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_974(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_976(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_975(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_977(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_976(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_978(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_977(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_979(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_978(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_980(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_979(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_981(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_980(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_982(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_981(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_983(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_982(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_984(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_983(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_985(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_984(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_986(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_985(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_987(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_986(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_988(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_987(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_989(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_988(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_990(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_989(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_991(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_990(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_992(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_991(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_993(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_992(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_994(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_993(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_995(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_994(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_996(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_995(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_997(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_996(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_998(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_997(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_999(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_998(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1000(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_999(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1001(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1000(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1002(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1001(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1003(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1002(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1004(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1003(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1005(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1004(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1006(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1005(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1007(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1006(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1008(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1007(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1009(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1008(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1010(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1009(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1011(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1010(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1012(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1011(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1013(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1012(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1014(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1013(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1015(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1014(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1016(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1015(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1017(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1016(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1018(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1017(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1019(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1018(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1020(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1019(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1021(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1020(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1022(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1021(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1023(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1022(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1024(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1023(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_1025(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1024(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+
+#endif // GMP_MACRO_LIMITS_FOR_EACH_1024_HPP_
@@ -0,0 +1,522 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_FOR_EACH_254_HPP_
+#define GMP_MACRO_LIMITS_FOR_EACH_254_HPP_
+
+// GMP_FOR_EACH
+#define _GMP_FOR_EACH_0(call, ...)
+#define _GMP_FOR_EACH_1(call, x) call(x)
+#define _GMP_FOR_EACH_2(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_3(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_2(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_4(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_3(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_5(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_4(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_6(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_5(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_7(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_6(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_8(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_7(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_9(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_8(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_10(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_9(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_11(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_10(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_12(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_11(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_13(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_12(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_14(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_13(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_15(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_14(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_16(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_15(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_17(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_16(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_18(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_17(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_19(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_18(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_20(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_19(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_21(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_20(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_22(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_21(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_23(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_22(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_24(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_23(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_25(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_24(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_26(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_25(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_27(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_26(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_28(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_27(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_29(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_28(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_30(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_29(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_31(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_30(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_32(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_31(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_33(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_32(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_34(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_33(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_35(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_34(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_36(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_35(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_37(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_36(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_38(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_37(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_39(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_38(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_40(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_39(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_41(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_40(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_42(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_41(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_43(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_42(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_44(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_43(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_45(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_44(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_46(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_45(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_47(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_46(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_48(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_47(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_49(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_48(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_50(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_49(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_51(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_50(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_52(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_51(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_53(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_52(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_54(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_53(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_55(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_54(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_56(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_55(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_57(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_56(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_58(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_57(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_59(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_58(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_60(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_59(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_61(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_60(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_62(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_61(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_63(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_62(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_64(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_63(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_65(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_64(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_66(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_65(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_67(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_66(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_68(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_67(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_69(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_68(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_70(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_69(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_71(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_70(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_72(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_71(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_73(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_72(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_74(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_73(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_75(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_74(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_76(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_75(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_77(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_76(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_78(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_77(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_79(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_78(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_80(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_79(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_81(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_80(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_82(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_81(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_83(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_82(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_84(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_83(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_85(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_84(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_86(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_85(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_87(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_86(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_88(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_87(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_89(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_88(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_90(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_89(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_91(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_90(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_92(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_91(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_93(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_92(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_94(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_93(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_95(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_94(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_96(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_95(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_97(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_96(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_98(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_97(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_99(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_98(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_100(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_99(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_101(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_100(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_102(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_101(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_103(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_102(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_104(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_103(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_105(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_104(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_106(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_105(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_107(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_106(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_108(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_107(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_109(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_108(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_110(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_109(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_111(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_110(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_112(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_111(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_113(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_112(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_114(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_113(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_115(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_114(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_116(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_115(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_117(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_116(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_118(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_117(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_119(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_118(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_120(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_119(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_121(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_120(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_122(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_121(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_123(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_122(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_124(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_123(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_125(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_124(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_126(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_125(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_127(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_126(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_128(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_127(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_129(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_128(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_130(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_129(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_131(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_130(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_132(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_131(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_133(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_132(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_134(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_133(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_135(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_134(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_136(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_135(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_137(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_136(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_138(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_137(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_139(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_138(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_140(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_139(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_141(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_140(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_142(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_141(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_143(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_142(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_144(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_143(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_145(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_144(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_146(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_145(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_147(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_146(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_148(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_147(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_149(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_148(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_150(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_149(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_151(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_150(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_152(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_151(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_153(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_152(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_154(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_153(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_155(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_154(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_156(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_155(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_157(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_156(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_158(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_157(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_159(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_158(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_160(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_159(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_161(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_160(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_162(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_161(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_163(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_162(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_164(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_163(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_165(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_164(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_166(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_165(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_167(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_166(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_168(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_167(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_169(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_168(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_170(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_169(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_171(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_170(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_172(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_171(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_173(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_172(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_174(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_173(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_175(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_174(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_176(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_175(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_177(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_176(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_178(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_177(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_179(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_178(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_180(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_179(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_181(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_180(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_182(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_181(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_183(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_182(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_184(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_183(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_185(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_184(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_186(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_185(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_187(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_186(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_188(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_187(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_189(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_188(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_190(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_189(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_191(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_190(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_192(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_191(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_193(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_192(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_194(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_193(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_195(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_194(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_196(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_195(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_197(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_196(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_198(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_197(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_199(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_198(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_200(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_199(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_201(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_200(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_202(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_201(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_203(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_202(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_204(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_203(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_205(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_204(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_206(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_205(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_207(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_206(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_208(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_207(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_209(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_208(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_210(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_209(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_211(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_210(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_212(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_211(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_213(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_212(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_214(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_213(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_215(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_214(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_216(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_215(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_217(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_216(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_218(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_217(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_219(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_218(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_220(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_219(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_221(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_220(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_222(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_221(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_223(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_222(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_224(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_223(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_225(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_224(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_226(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_225(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_227(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_226(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_228(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_227(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_229(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_228(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_230(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_229(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_231(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_230(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_232(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_231(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_233(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_232(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_234(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_233(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_235(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_234(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_236(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_235(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_237(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_236(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_238(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_237(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_239(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_238(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_240(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_239(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_241(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_240(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_242(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_241(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_243(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_242(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_244(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_243(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_245(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_244(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_246(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_245(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_247(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_246(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_248(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_247(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_249(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_248(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_250(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_249(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_251(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_250(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_252(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_251(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_253(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_252(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_254(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_253(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_255(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_254(call, __VA_ARGS__) )
+
+// GMP_FOR_EACH_I
+#define _GMP_FOR_EACH_I_0(call, data, sep, i, ...)
+#define _GMP_FOR_EACH_I_1(call, data, sep, i, x, ...) call(data, i, x)
+#define _GMP_FOR_EACH_I_2(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_3(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_2(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_4(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_3(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_5(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_4(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_6(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_5(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_7(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_6(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_8(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_7(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_9(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_8(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_10(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_9(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_11(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_10(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_12(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_11(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_13(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_12(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_14(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_13(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_15(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_14(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_16(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_15(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_17(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_16(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_18(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_17(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_19(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_18(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_20(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_19(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_21(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_20(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_22(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_21(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_23(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_22(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_24(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_23(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_25(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_24(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_26(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_25(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_27(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_26(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_28(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_27(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_29(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_28(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_30(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_29(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_31(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_30(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_32(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_31(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_33(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_32(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_34(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_33(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_35(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_34(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_36(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_35(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_37(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_36(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_38(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_37(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_39(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_38(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_40(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_39(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_41(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_40(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_42(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_41(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_43(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_42(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_44(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_43(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_45(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_44(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_46(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_45(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_47(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_46(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_48(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_47(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_49(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_48(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_50(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_49(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_51(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_50(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_52(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_51(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_53(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_52(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_54(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_53(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_55(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_54(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_56(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_55(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_57(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_56(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_58(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_57(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_59(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_58(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_60(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_59(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_61(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_60(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_62(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_61(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_63(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_62(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_64(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_63(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_65(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_64(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_66(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_65(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_67(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_66(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_68(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_67(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_69(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_68(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_70(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_69(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_71(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_70(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_72(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_71(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_73(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_72(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_74(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_73(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_75(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_74(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_76(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_75(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_77(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_76(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_78(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_77(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_79(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_78(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_80(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_79(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_81(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_80(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_82(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_81(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_83(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_82(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_84(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_83(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_85(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_84(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_86(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_85(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_87(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_86(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_88(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_87(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_89(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_88(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_90(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_89(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_91(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_90(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_92(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_91(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_93(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_92(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_94(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_93(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_95(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_94(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_96(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_95(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_97(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_96(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_98(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_97(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_99(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_98(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_100(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_99(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_101(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_100(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_102(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_101(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_103(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_102(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_104(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_103(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_105(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_104(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_106(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_105(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_107(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_106(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_108(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_107(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_109(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_108(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_110(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_109(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_111(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_110(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_112(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_111(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_113(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_112(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_114(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_113(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_115(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_114(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_116(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_115(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_117(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_116(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_118(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_117(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_119(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_118(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_120(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_119(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_121(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_120(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_122(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_121(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_123(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_122(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_124(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_123(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_125(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_124(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_126(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_125(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_127(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_126(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_128(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_127(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_129(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_128(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_130(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_129(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_131(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_130(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_132(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_131(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_133(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_132(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_134(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_133(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_135(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_134(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_136(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_135(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_137(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_136(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_138(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_137(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_139(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_138(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_140(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_139(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_141(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_140(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_142(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_141(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_143(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_142(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_144(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_143(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_145(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_144(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_146(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_145(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_147(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_146(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_148(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_147(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_149(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_148(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_150(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_149(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_151(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_150(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_152(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_151(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_153(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_152(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_154(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_153(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_155(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_154(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_156(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_155(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_157(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_156(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_158(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_157(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_159(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_158(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_160(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_159(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_161(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_160(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_162(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_161(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_163(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_162(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_164(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_163(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_165(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_164(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_166(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_165(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_167(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_166(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_168(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_167(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_169(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_168(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_170(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_169(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_171(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_170(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_172(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_171(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_173(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_172(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_174(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_173(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_175(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_174(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_176(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_175(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_177(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_176(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_178(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_177(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_179(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_178(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_180(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_179(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_181(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_180(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_182(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_181(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_183(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_182(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_184(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_183(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_185(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_184(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_186(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_185(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_187(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_186(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_188(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_187(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_189(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_188(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_190(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_189(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_191(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_190(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_192(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_191(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_193(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_192(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_194(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_193(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_195(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_194(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_196(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_195(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_197(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_196(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_198(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_197(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_199(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_198(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_200(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_199(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_201(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_200(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_202(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_201(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_203(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_202(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_204(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_203(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_205(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_204(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_206(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_205(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_207(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_206(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_208(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_207(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_209(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_208(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_210(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_209(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_211(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_210(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_212(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_211(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_213(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_212(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_214(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_213(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_215(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_214(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_216(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_215(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_217(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_216(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_218(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_217(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_219(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_218(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_220(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_219(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_221(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_220(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_222(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_221(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_223(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_222(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_224(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_223(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_225(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_224(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_226(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_225(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_227(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_226(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_228(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_227(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_229(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_228(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_230(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_229(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_231(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_230(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_232(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_231(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_233(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_232(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_234(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_233(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_235(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_234(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_236(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_235(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_237(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_236(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_238(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_237(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_239(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_238(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_240(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_239(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_241(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_240(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_242(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_241(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_243(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_242(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_244(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_243(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_245(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_244(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_246(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_245(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_247(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_246(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_248(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_247(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_249(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_248(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_250(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_249(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_251(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_250(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_252(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_251(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_253(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_252(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_254(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_253(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_255(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_254(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+
+#endif // GMP_MACRO_LIMITS_FOR_EACH_254_HPP_
@@ -0,0 +1,142 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_FOR_EACH_64_HPP_
+#define GMP_MACRO_LIMITS_FOR_EACH_64_HPP_
+
+// GMP_FOR_EACH
+#define _GMP_FOR_EACH_0(call, ...)
+#define _GMP_FOR_EACH_1(call, x) call(x)
+#define _GMP_FOR_EACH_2(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_1(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_3(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_2(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_4(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_3(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_5(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_4(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_6(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_5(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_7(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_6(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_8(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_7(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_9(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_8(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_10(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_9(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_11(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_10(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_12(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_11(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_13(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_12(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_14(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_13(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_15(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_14(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_16(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_15(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_17(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_16(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_18(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_17(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_19(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_18(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_20(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_19(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_21(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_20(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_22(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_21(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_23(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_22(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_24(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_23(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_25(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_24(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_26(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_25(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_27(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_26(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_28(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_27(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_29(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_28(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_30(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_29(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_31(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_30(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_32(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_31(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_33(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_32(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_34(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_33(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_35(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_34(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_36(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_35(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_37(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_36(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_38(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_37(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_39(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_38(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_40(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_39(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_41(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_40(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_42(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_41(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_43(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_42(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_44(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_43(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_45(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_44(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_46(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_45(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_47(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_46(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_48(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_47(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_49(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_48(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_50(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_49(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_51(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_50(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_52(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_51(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_53(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_52(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_54(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_53(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_55(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_54(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_56(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_55(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_57(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_56(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_58(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_57(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_59(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_58(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_60(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_59(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_61(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_60(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_62(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_61(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_63(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_62(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_64(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_63(call, __VA_ARGS__) )
+#define _GMP_FOR_EACH_65(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_64(call, __VA_ARGS__) )
+
+// GMP_FOR_EACH_I
+#define _GMP_FOR_EACH_I_0(call, data, sep, i, ...)
+#define _GMP_FOR_EACH_I_1(call, data, sep, i, x, ...) call(data, i, x)
+#define _GMP_FOR_EACH_I_2(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_1(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_3(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_2(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_4(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_3(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_5(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_4(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_6(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_5(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_7(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_6(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_8(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_7(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_9(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_8(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_10(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_9(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_11(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_10(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_12(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_11(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_13(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_12(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_14(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_13(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_15(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_14(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_16(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_15(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_17(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_16(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_18(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_17(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_19(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_18(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_20(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_19(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_21(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_20(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_22(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_21(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_23(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_22(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_24(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_23(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_25(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_24(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_26(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_25(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_27(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_26(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_28(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_27(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_29(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_28(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_30(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_29(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_31(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_30(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_32(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_31(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_33(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_32(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_34(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_33(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_35(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_34(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_36(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_35(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_37(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_36(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_38(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_37(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_39(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_38(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_40(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_39(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_41(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_40(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_42(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_41(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_43(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_42(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_44(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_43(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_45(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_44(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_46(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_45(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_47(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_46(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_48(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_47(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_49(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_48(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_50(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_49(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_51(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_50(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_52(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_51(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_53(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_52(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_54(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_53(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_55(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_54(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_56(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_55(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_57(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_56(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_58(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_57(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_59(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_58(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_60(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_59(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_61(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_60(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_62(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_61(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_63(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_62(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_64(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_63(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+#define _GMP_FOR_EACH_I_65(call, data, sep, i, x, ...) call(data, i, x) sep() GMP_EXPAND( _GMP_FOR_EACH_I_64(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )
+
+#endif // GMP_MACRO_LIMITS_FOR_EACH_64_HPP_
@@ -0,0 +1,4114 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_LOOP_1024_HPP_
+#define GMP_MACRO_LIMITS_LOOP_1024_HPP_
+
+// GMP_EVAL_BOUNDED
+#define _GMP_EVAL_WIDE(...) GMP_EVAL(GMP_EVAL(GMP_EVAL(__VA_ARGS__)))
+#define _GMP_EVAL_BOUNDED_0 GMP_EVAL_5
+#define _GMP_EVAL_BOUNDED_1 GMP_EVAL_5
+#define _GMP_EVAL_BOUNDED_2 GMP_EVAL_5
+#define _GMP_EVAL_BOUNDED_3 GMP_EVAL_4
+#define _GMP_EVAL_BOUNDED_4 GMP_EVAL_4
+#define _GMP_EVAL_BOUNDED_5 GMP_EVAL_4
+#define _GMP_EVAL_BOUNDED_6 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_7 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_8 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_9 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_10 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_11 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_12 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_13 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_14 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_15 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_16 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_17 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_18 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_19 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_20 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_21 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_22 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_23 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_24 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_25 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_26 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_27 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_28 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_29 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_30 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_31 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_32 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_33 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_34 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_35 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_36 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_37 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_38 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_39 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_40 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_41 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_42 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_43 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_44 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_45 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_46 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_47 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_48 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_49 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_50 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_51 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_52 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_53 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_54 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_55 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_56 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_57 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_58 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_59 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_60 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_61 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_62 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_63 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_64 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_65 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_66 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_67 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_68 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_69 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_70 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_71 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_72 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_73 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_74 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_75 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_76 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_77 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_78 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_79 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_80 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_81 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_82 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_83 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_84 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_85 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_86 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_87 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_88 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_89 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_90 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_91 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_92 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_93 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_94 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_95 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_96 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_97 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_98 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_99 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_100 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_101 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_102 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_103 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_104 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_105 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_106 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_107 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_108 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_109 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_110 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_111 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_112 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_113 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_114 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_115 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_116 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_117 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_118 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_119 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_120 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_121 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_122 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_123 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_124 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_125 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_126 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_127 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_128 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_129 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_130 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_131 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_132 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_133 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_134 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_135 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_136 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_137 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_138 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_139 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_140 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_141 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_142 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_143 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_144 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_145 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_146 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_147 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_148 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_149 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_150 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_151 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_152 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_153 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_154 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_155 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_156 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_157 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_158 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_159 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_160 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_161 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_162 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_163 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_164 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_165 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_166 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_167 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_168 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_169 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_170 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_171 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_172 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_173 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_174 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_175 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_176 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_177 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_178 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_179 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_180 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_181 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_182 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_183 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_184 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_185 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_186 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_187 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_188 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_189 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_190 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_191 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_192 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_193 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_194 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_195 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_196 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_197 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_198 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_199 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_200 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_201 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_202 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_203 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_204 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_205 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_206 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_207 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_208 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_209 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_210 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_211 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_212 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_213 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_214 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_215 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_216 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_217 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_218 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_219 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_220 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_221 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_222 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_223 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_224 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_225 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_226 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_227 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_228 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_229 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_230 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_231 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_232 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_233 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_234 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_235 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_236 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_237 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_238 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_239 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_240 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_241 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_242 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_243 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_244 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_245 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_246 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_247 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_248 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_249 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_250 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_251 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_252 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_253 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_254 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_255 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_256 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_257 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_258 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_259 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_260 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_261 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_262 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_263 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_264 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_265 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_266 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_267 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_268 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_269 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_270 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_271 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_272 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_273 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_274 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_275 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_276 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_277 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_278 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_279 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_280 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_281 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_282 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_283 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_284 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_285 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_286 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_287 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_288 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_289 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_290 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_291 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_292 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_293 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_294 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_295 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_296 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_297 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_298 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_299 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_300 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_301 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_302 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_303 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_304 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_305 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_306 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_307 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_308 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_309 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_310 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_311 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_312 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_313 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_314 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_315 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_316 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_317 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_318 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_319 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_320 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_321 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_322 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_323 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_324 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_325 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_326 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_327 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_328 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_329 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_330 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_331 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_332 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_333 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_334 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_335 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_336 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_337 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_338 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_339 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_340 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_341 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_342 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_343 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_344 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_345 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_346 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_347 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_348 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_349 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_350 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_351 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_352 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_353 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_354 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_355 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_356 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_357 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_358 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_359 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_360 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_361 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_362 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_363 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_364 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_365 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_366 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_367 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_368 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_369 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_370 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_371 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_372 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_373 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_374 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_375 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_376 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_377 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_378 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_379 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_380 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_381 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_382 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_383 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_384 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_385 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_386 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_387 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_388 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_389 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_390 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_391 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_392 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_393 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_394 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_395 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_396 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_397 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_398 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_399 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_400 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_401 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_402 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_403 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_404 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_405 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_406 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_407 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_408 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_409 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_410 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_411 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_412 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_413 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_414 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_415 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_416 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_417 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_418 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_419 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_420 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_421 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_422 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_423 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_424 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_425 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_426 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_427 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_428 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_429 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_430 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_431 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_432 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_433 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_434 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_435 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_436 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_437 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_438 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_439 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_440 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_441 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_442 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_443 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_444 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_445 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_446 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_447 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_448 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_449 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_450 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_451 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_452 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_453 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_454 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_455 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_456 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_457 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_458 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_459 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_460 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_461 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_462 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_463 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_464 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_465 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_466 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_467 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_468 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_469 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_470 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_471 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_472 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_473 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_474 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_475 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_476 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_477 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_478 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_479 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_480 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_481 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_482 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_483 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_484 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_485 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_486 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_487 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_488 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_489 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_490 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_491 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_492 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_493 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_494 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_495 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_496 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_497 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_498 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_499 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_500 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_501 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_502 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_503 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_504 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_505 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_506 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_507 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_508 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_509 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_510 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_511 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_512 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_513 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_514 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_515 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_516 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_517 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_518 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_519 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_520 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_521 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_522 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_523 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_524 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_525 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_526 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_527 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_528 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_529 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_530 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_531 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_532 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_533 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_534 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_535 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_536 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_537 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_538 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_539 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_540 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_541 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_542 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_543 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_544 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_545 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_546 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_547 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_548 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_549 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_550 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_551 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_552 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_553 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_554 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_555 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_556 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_557 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_558 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_559 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_560 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_561 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_562 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_563 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_564 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_565 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_566 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_567 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_568 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_569 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_570 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_571 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_572 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_573 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_574 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_575 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_576 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_577 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_578 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_579 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_580 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_581 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_582 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_583 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_584 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_585 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_586 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_587 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_588 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_589 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_590 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_591 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_592 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_593 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_594 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_595 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_596 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_597 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_598 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_599 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_600 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_601 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_602 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_603 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_604 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_605 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_606 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_607 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_608 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_609 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_610 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_611 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_612 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_613 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_614 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_615 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_616 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_617 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_618 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_619 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_620 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_621 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_622 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_623 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_624 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_625 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_626 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_627 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_628 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_629 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_630 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_631 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_632 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_633 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_634 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_635 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_636 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_637 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_638 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_639 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_640 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_641 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_642 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_643 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_644 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_645 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_646 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_647 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_648 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_649 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_650 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_651 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_652 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_653 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_654 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_655 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_656 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_657 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_658 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_659 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_660 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_661 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_662 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_663 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_664 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_665 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_666 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_667 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_668 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_669 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_670 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_671 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_672 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_673 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_674 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_675 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_676 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_677 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_678 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_679 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_680 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_681 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_682 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_683 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_684 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_685 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_686 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_687 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_688 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_689 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_690 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_691 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_692 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_693 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_694 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_695 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_696 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_697 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_698 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_699 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_700 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_701 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_702 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_703 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_704 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_705 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_706 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_707 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_708 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_709 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_710 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_711 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_712 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_713 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_714 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_715 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_716 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_717 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_718 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_719 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_720 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_721 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_722 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_723 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_724 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_725 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_726 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_727 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_728 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_729 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_730 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_731 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_732 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_733 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_734 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_735 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_736 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_737 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_738 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_739 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_740 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_741 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_742 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_743 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_744 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_745 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_746 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_747 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_748 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_749 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_750 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_751 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_752 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_753 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_754 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_755 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_756 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_757 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_758 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_759 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_760 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_761 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_762 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_763 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_764 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_765 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_766 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_767 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_768 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_769 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_770 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_771 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_772 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_773 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_774 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_775 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_776 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_777 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_778 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_779 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_780 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_781 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_782 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_783 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_784 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_785 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_786 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_787 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_788 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_789 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_790 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_791 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_792 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_793 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_794 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_795 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_796 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_797 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_798 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_799 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_800 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_801 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_802 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_803 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_804 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_805 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_806 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_807 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_808 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_809 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_810 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_811 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_812 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_813 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_814 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_815 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_816 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_817 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_818 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_819 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_820 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_821 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_822 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_823 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_824 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_825 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_826 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_827 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_828 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_829 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_830 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_831 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_832 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_833 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_834 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_835 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_836 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_837 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_838 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_839 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_840 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_841 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_842 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_843 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_844 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_845 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_846 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_847 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_848 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_849 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_850 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_851 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_852 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_853 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_854 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_855 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_856 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_857 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_858 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_859 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_860 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_861 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_862 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_863 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_864 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_865 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_866 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_867 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_868 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_869 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_870 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_871 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_872 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_873 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_874 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_875 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_876 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_877 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_878 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_879 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_880 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_881 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_882 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_883 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_884 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_885 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_886 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_887 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_888 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_889 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_890 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_891 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_892 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_893 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_894 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_895 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_896 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_897 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_898 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_899 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_900 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_901 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_902 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_903 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_904 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_905 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_906 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_907 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_908 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_909 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_910 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_911 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_912 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_913 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_914 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_915 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_916 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_917 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_918 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_919 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_920 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_921 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_922 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_923 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_924 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_925 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_926 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_927 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_928 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_929 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_930 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_931 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_932 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_933 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_934 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_935 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_936 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_937 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_938 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_939 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_940 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_941 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_942 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_943 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_944 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_945 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_946 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_947 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_948 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_949 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_950 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_951 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_952 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_953 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_954 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_955 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_956 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_957 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_958 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_959 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_960 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_961 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_962 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_963 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_964 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_965 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_966 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_967 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_968 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_969 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_970 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_971 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_972 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_973 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_974 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_975 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_976 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_977 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_978 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_979 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_980 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_981 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_982 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_983 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_984 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_985 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_986 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_987 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_988 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_989 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_990 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_991 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_992 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_993 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_994 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_995 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_996 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_997 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_998 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_999 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1000 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1001 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1002 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1003 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1004 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1005 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1006 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1007 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1008 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1009 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1010 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1011 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1012 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1013 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1014 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1015 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1016 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1017 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1018 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1019 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1020 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1021 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1022 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1023 _GMP_EVAL_WIDE
+#define _GMP_EVAL_BOUNDED_1024 _GMP_EVAL_WIDE
+
+// GMP_MAKE_INDEX_SEQUENCE
+#define _GMP_MAKE_INDEX_SEQUENCE_0() 0
+#define _GMP_MAKE_INDEX_SEQUENCE_1() _GMP_MAKE_INDEX_SEQUENCE_0(), 1
+#define _GMP_MAKE_INDEX_SEQUENCE_2() _GMP_MAKE_INDEX_SEQUENCE_1(), 2
+#define _GMP_MAKE_INDEX_SEQUENCE_3() _GMP_MAKE_INDEX_SEQUENCE_2(), 3
+#define _GMP_MAKE_INDEX_SEQUENCE_4() _GMP_MAKE_INDEX_SEQUENCE_3(), 4
+#define _GMP_MAKE_INDEX_SEQUENCE_5() _GMP_MAKE_INDEX_SEQUENCE_4(), 5
+#define _GMP_MAKE_INDEX_SEQUENCE_6() _GMP_MAKE_INDEX_SEQUENCE_5(), 6
+#define _GMP_MAKE_INDEX_SEQUENCE_7() _GMP_MAKE_INDEX_SEQUENCE_6(), 7
+#define _GMP_MAKE_INDEX_SEQUENCE_8() _GMP_MAKE_INDEX_SEQUENCE_7(), 8
+#define _GMP_MAKE_INDEX_SEQUENCE_9() _GMP_MAKE_INDEX_SEQUENCE_8(), 9
+#define _GMP_MAKE_INDEX_SEQUENCE_10() _GMP_MAKE_INDEX_SEQUENCE_9(), 10
+#define _GMP_MAKE_INDEX_SEQUENCE_11() _GMP_MAKE_INDEX_SEQUENCE_10(), 11
+#define _GMP_MAKE_INDEX_SEQUENCE_12() _GMP_MAKE_INDEX_SEQUENCE_11(), 12
+#define _GMP_MAKE_INDEX_SEQUENCE_13() _GMP_MAKE_INDEX_SEQUENCE_12(), 13
+#define _GMP_MAKE_INDEX_SEQUENCE_14() _GMP_MAKE_INDEX_SEQUENCE_13(), 14
+#define _GMP_MAKE_INDEX_SEQUENCE_15() _GMP_MAKE_INDEX_SEQUENCE_14(), 15
+#define _GMP_MAKE_INDEX_SEQUENCE_16() _GMP_MAKE_INDEX_SEQUENCE_15(), 16
+#define _GMP_MAKE_INDEX_SEQUENCE_17() _GMP_MAKE_INDEX_SEQUENCE_16(), 17
+#define _GMP_MAKE_INDEX_SEQUENCE_18() _GMP_MAKE_INDEX_SEQUENCE_17(), 18
+#define _GMP_MAKE_INDEX_SEQUENCE_19() _GMP_MAKE_INDEX_SEQUENCE_18(), 19
+#define _GMP_MAKE_INDEX_SEQUENCE_20() _GMP_MAKE_INDEX_SEQUENCE_19(), 20
+#define _GMP_MAKE_INDEX_SEQUENCE_21() _GMP_MAKE_INDEX_SEQUENCE_20(), 21
+#define _GMP_MAKE_INDEX_SEQUENCE_22() _GMP_MAKE_INDEX_SEQUENCE_21(), 22
+#define _GMP_MAKE_INDEX_SEQUENCE_23() _GMP_MAKE_INDEX_SEQUENCE_22(), 23
+#define _GMP_MAKE_INDEX_SEQUENCE_24() _GMP_MAKE_INDEX_SEQUENCE_23(), 24
+#define _GMP_MAKE_INDEX_SEQUENCE_25() _GMP_MAKE_INDEX_SEQUENCE_24(), 25
+#define _GMP_MAKE_INDEX_SEQUENCE_26() _GMP_MAKE_INDEX_SEQUENCE_25(), 26
+#define _GMP_MAKE_INDEX_SEQUENCE_27() _GMP_MAKE_INDEX_SEQUENCE_26(), 27
+#define _GMP_MAKE_INDEX_SEQUENCE_28() _GMP_MAKE_INDEX_SEQUENCE_27(), 28
+#define _GMP_MAKE_INDEX_SEQUENCE_29() _GMP_MAKE_INDEX_SEQUENCE_28(), 29
+#define _GMP_MAKE_INDEX_SEQUENCE_30() _GMP_MAKE_INDEX_SEQUENCE_29(), 30
+#define _GMP_MAKE_INDEX_SEQUENCE_31() _GMP_MAKE_INDEX_SEQUENCE_30(), 31
+#define _GMP_MAKE_INDEX_SEQUENCE_32() _GMP_MAKE_INDEX_SEQUENCE_31(), 32
+#define _GMP_MAKE_INDEX_SEQUENCE_33() _GMP_MAKE_INDEX_SEQUENCE_32(), 33
+#define _GMP_MAKE_INDEX_SEQUENCE_34() _GMP_MAKE_INDEX_SEQUENCE_33(), 34
+#define _GMP_MAKE_INDEX_SEQUENCE_35() _GMP_MAKE_INDEX_SEQUENCE_34(), 35
+#define _GMP_MAKE_INDEX_SEQUENCE_36() _GMP_MAKE_INDEX_SEQUENCE_35(), 36
+#define _GMP_MAKE_INDEX_SEQUENCE_37() _GMP_MAKE_INDEX_SEQUENCE_36(), 37
+#define _GMP_MAKE_INDEX_SEQUENCE_38() _GMP_MAKE_INDEX_SEQUENCE_37(), 38
+#define _GMP_MAKE_INDEX_SEQUENCE_39() _GMP_MAKE_INDEX_SEQUENCE_38(), 39
+#define _GMP_MAKE_INDEX_SEQUENCE_40() _GMP_MAKE_INDEX_SEQUENCE_39(), 40
+#define _GMP_MAKE_INDEX_SEQUENCE_41() _GMP_MAKE_INDEX_SEQUENCE_40(), 41
+#define _GMP_MAKE_INDEX_SEQUENCE_42() _GMP_MAKE_INDEX_SEQUENCE_41(), 42
+#define _GMP_MAKE_INDEX_SEQUENCE_43() _GMP_MAKE_INDEX_SEQUENCE_42(), 43
+#define _GMP_MAKE_INDEX_SEQUENCE_44() _GMP_MAKE_INDEX_SEQUENCE_43(), 44
+#define _GMP_MAKE_INDEX_SEQUENCE_45() _GMP_MAKE_INDEX_SEQUENCE_44(), 45
+#define _GMP_MAKE_INDEX_SEQUENCE_46() _GMP_MAKE_INDEX_SEQUENCE_45(), 46
+#define _GMP_MAKE_INDEX_SEQUENCE_47() _GMP_MAKE_INDEX_SEQUENCE_46(), 47
+#define _GMP_MAKE_INDEX_SEQUENCE_48() _GMP_MAKE_INDEX_SEQUENCE_47(), 48
+#define _GMP_MAKE_INDEX_SEQUENCE_49() _GMP_MAKE_INDEX_SEQUENCE_48(), 49
+#define _GMP_MAKE_INDEX_SEQUENCE_50() _GMP_MAKE_INDEX_SEQUENCE_49(), 50
+#define _GMP_MAKE_INDEX_SEQUENCE_51() _GMP_MAKE_INDEX_SEQUENCE_50(), 51
+#define _GMP_MAKE_INDEX_SEQUENCE_52() _GMP_MAKE_INDEX_SEQUENCE_51(), 52
+#define _GMP_MAKE_INDEX_SEQUENCE_53() _GMP_MAKE_INDEX_SEQUENCE_52(), 53
+#define _GMP_MAKE_INDEX_SEQUENCE_54() _GMP_MAKE_INDEX_SEQUENCE_53(), 54
+#define _GMP_MAKE_INDEX_SEQUENCE_55() _GMP_MAKE_INDEX_SEQUENCE_54(), 55
+#define _GMP_MAKE_INDEX_SEQUENCE_56() _GMP_MAKE_INDEX_SEQUENCE_55(), 56
+#define _GMP_MAKE_INDEX_SEQUENCE_57() _GMP_MAKE_INDEX_SEQUENCE_56(), 57
+#define _GMP_MAKE_INDEX_SEQUENCE_58() _GMP_MAKE_INDEX_SEQUENCE_57(), 58
+#define _GMP_MAKE_INDEX_SEQUENCE_59() _GMP_MAKE_INDEX_SEQUENCE_58(), 59
+#define _GMP_MAKE_INDEX_SEQUENCE_60() _GMP_MAKE_INDEX_SEQUENCE_59(), 60
+#define _GMP_MAKE_INDEX_SEQUENCE_61() _GMP_MAKE_INDEX_SEQUENCE_60(), 61
+#define _GMP_MAKE_INDEX_SEQUENCE_62() _GMP_MAKE_INDEX_SEQUENCE_61(), 62
+#define _GMP_MAKE_INDEX_SEQUENCE_63() _GMP_MAKE_INDEX_SEQUENCE_62(), 63
+#define _GMP_MAKE_INDEX_SEQUENCE_64() _GMP_MAKE_INDEX_SEQUENCE_63(), 64
+#define _GMP_MAKE_INDEX_SEQUENCE_65() _GMP_MAKE_INDEX_SEQUENCE_64(), 65
+#define _GMP_MAKE_INDEX_SEQUENCE_66() _GMP_MAKE_INDEX_SEQUENCE_65(), 66
+#define _GMP_MAKE_INDEX_SEQUENCE_67() _GMP_MAKE_INDEX_SEQUENCE_66(), 67
+#define _GMP_MAKE_INDEX_SEQUENCE_68() _GMP_MAKE_INDEX_SEQUENCE_67(), 68
+#define _GMP_MAKE_INDEX_SEQUENCE_69() _GMP_MAKE_INDEX_SEQUENCE_68(), 69
+#define _GMP_MAKE_INDEX_SEQUENCE_70() _GMP_MAKE_INDEX_SEQUENCE_69(), 70
+#define _GMP_MAKE_INDEX_SEQUENCE_71() _GMP_MAKE_INDEX_SEQUENCE_70(), 71
+#define _GMP_MAKE_INDEX_SEQUENCE_72() _GMP_MAKE_INDEX_SEQUENCE_71(), 72
+#define _GMP_MAKE_INDEX_SEQUENCE_73() _GMP_MAKE_INDEX_SEQUENCE_72(), 73
+#define _GMP_MAKE_INDEX_SEQUENCE_74() _GMP_MAKE_INDEX_SEQUENCE_73(), 74
+#define _GMP_MAKE_INDEX_SEQUENCE_75() _GMP_MAKE_INDEX_SEQUENCE_74(), 75
+#define _GMP_MAKE_INDEX_SEQUENCE_76() _GMP_MAKE_INDEX_SEQUENCE_75(), 76
+#define _GMP_MAKE_INDEX_SEQUENCE_77() _GMP_MAKE_INDEX_SEQUENCE_76(), 77
+#define _GMP_MAKE_INDEX_SEQUENCE_78() _GMP_MAKE_INDEX_SEQUENCE_77(), 78
+#define _GMP_MAKE_INDEX_SEQUENCE_79() _GMP_MAKE_INDEX_SEQUENCE_78(), 79
+#define _GMP_MAKE_INDEX_SEQUENCE_80() _GMP_MAKE_INDEX_SEQUENCE_79(), 80
+#define _GMP_MAKE_INDEX_SEQUENCE_81() _GMP_MAKE_INDEX_SEQUENCE_80(), 81
+#define _GMP_MAKE_INDEX_SEQUENCE_82() _GMP_MAKE_INDEX_SEQUENCE_81(), 82
+#define _GMP_MAKE_INDEX_SEQUENCE_83() _GMP_MAKE_INDEX_SEQUENCE_82(), 83
+#define _GMP_MAKE_INDEX_SEQUENCE_84() _GMP_MAKE_INDEX_SEQUENCE_83(), 84
+#define _GMP_MAKE_INDEX_SEQUENCE_85() _GMP_MAKE_INDEX_SEQUENCE_84(), 85
+#define _GMP_MAKE_INDEX_SEQUENCE_86() _GMP_MAKE_INDEX_SEQUENCE_85(), 86
+#define _GMP_MAKE_INDEX_SEQUENCE_87() _GMP_MAKE_INDEX_SEQUENCE_86(), 87
+#define _GMP_MAKE_INDEX_SEQUENCE_88() _GMP_MAKE_INDEX_SEQUENCE_87(), 88
+#define _GMP_MAKE_INDEX_SEQUENCE_89() _GMP_MAKE_INDEX_SEQUENCE_88(), 89
+#define _GMP_MAKE_INDEX_SEQUENCE_90() _GMP_MAKE_INDEX_SEQUENCE_89(), 90
+#define _GMP_MAKE_INDEX_SEQUENCE_91() _GMP_MAKE_INDEX_SEQUENCE_90(), 91
+#define _GMP_MAKE_INDEX_SEQUENCE_92() _GMP_MAKE_INDEX_SEQUENCE_91(), 92
+#define _GMP_MAKE_INDEX_SEQUENCE_93() _GMP_MAKE_INDEX_SEQUENCE_92(), 93
+#define _GMP_MAKE_INDEX_SEQUENCE_94() _GMP_MAKE_INDEX_SEQUENCE_93(), 94
+#define _GMP_MAKE_INDEX_SEQUENCE_95() _GMP_MAKE_INDEX_SEQUENCE_94(), 95
+#define _GMP_MAKE_INDEX_SEQUENCE_96() _GMP_MAKE_INDEX_SEQUENCE_95(), 96
+#define _GMP_MAKE_INDEX_SEQUENCE_97() _GMP_MAKE_INDEX_SEQUENCE_96(), 97
+#define _GMP_MAKE_INDEX_SEQUENCE_98() _GMP_MAKE_INDEX_SEQUENCE_97(), 98
+#define _GMP_MAKE_INDEX_SEQUENCE_99() _GMP_MAKE_INDEX_SEQUENCE_98(), 99
+#define _GMP_MAKE_INDEX_SEQUENCE_100() _GMP_MAKE_INDEX_SEQUENCE_99(), 100
+#define _GMP_MAKE_INDEX_SEQUENCE_101() _GMP_MAKE_INDEX_SEQUENCE_100(), 101
+#define _GMP_MAKE_INDEX_SEQUENCE_102() _GMP_MAKE_INDEX_SEQUENCE_101(), 102
+#define _GMP_MAKE_INDEX_SEQUENCE_103() _GMP_MAKE_INDEX_SEQUENCE_102(), 103
+#define _GMP_MAKE_INDEX_SEQUENCE_104() _GMP_MAKE_INDEX_SEQUENCE_103(), 104
+#define _GMP_MAKE_INDEX_SEQUENCE_105() _GMP_MAKE_INDEX_SEQUENCE_104(), 105
+#define _GMP_MAKE_INDEX_SEQUENCE_106() _GMP_MAKE_INDEX_SEQUENCE_105(), 106
+#define _GMP_MAKE_INDEX_SEQUENCE_107() _GMP_MAKE_INDEX_SEQUENCE_106(), 107
+#define _GMP_MAKE_INDEX_SEQUENCE_108() _GMP_MAKE_INDEX_SEQUENCE_107(), 108
+#define _GMP_MAKE_INDEX_SEQUENCE_109() _GMP_MAKE_INDEX_SEQUENCE_108(), 109
+#define _GMP_MAKE_INDEX_SEQUENCE_110() _GMP_MAKE_INDEX_SEQUENCE_109(), 110
+#define _GMP_MAKE_INDEX_SEQUENCE_111() _GMP_MAKE_INDEX_SEQUENCE_110(), 111
+#define _GMP_MAKE_INDEX_SEQUENCE_112() _GMP_MAKE_INDEX_SEQUENCE_111(), 112
+#define _GMP_MAKE_INDEX_SEQUENCE_113() _GMP_MAKE_INDEX_SEQUENCE_112(), 113
+#define _GMP_MAKE_INDEX_SEQUENCE_114() _GMP_MAKE_INDEX_SEQUENCE_113(), 114
+#define _GMP_MAKE_INDEX_SEQUENCE_115() _GMP_MAKE_INDEX_SEQUENCE_114(), 115
+#define _GMP_MAKE_INDEX_SEQUENCE_116() _GMP_MAKE_INDEX_SEQUENCE_115(), 116
+#define _GMP_MAKE_INDEX_SEQUENCE_117() _GMP_MAKE_INDEX_SEQUENCE_116(), 117
+#define _GMP_MAKE_INDEX_SEQUENCE_118() _GMP_MAKE_INDEX_SEQUENCE_117(), 118
+#define _GMP_MAKE_INDEX_SEQUENCE_119() _GMP_MAKE_INDEX_SEQUENCE_118(), 119
+#define _GMP_MAKE_INDEX_SEQUENCE_120() _GMP_MAKE_INDEX_SEQUENCE_119(), 120
+#define _GMP_MAKE_INDEX_SEQUENCE_121() _GMP_MAKE_INDEX_SEQUENCE_120(), 121
+#define _GMP_MAKE_INDEX_SEQUENCE_122() _GMP_MAKE_INDEX_SEQUENCE_121(), 122
+#define _GMP_MAKE_INDEX_SEQUENCE_123() _GMP_MAKE_INDEX_SEQUENCE_122(), 123
+#define _GMP_MAKE_INDEX_SEQUENCE_124() _GMP_MAKE_INDEX_SEQUENCE_123(), 124
+#define _GMP_MAKE_INDEX_SEQUENCE_125() _GMP_MAKE_INDEX_SEQUENCE_124(), 125
+#define _GMP_MAKE_INDEX_SEQUENCE_126() _GMP_MAKE_INDEX_SEQUENCE_125(), 126
+#define _GMP_MAKE_INDEX_SEQUENCE_127() _GMP_MAKE_INDEX_SEQUENCE_126(), 127
+#define _GMP_MAKE_INDEX_SEQUENCE_128() _GMP_MAKE_INDEX_SEQUENCE_127(), 128
+#define _GMP_MAKE_INDEX_SEQUENCE_129() _GMP_MAKE_INDEX_SEQUENCE_128(), 129
+#define _GMP_MAKE_INDEX_SEQUENCE_130() _GMP_MAKE_INDEX_SEQUENCE_129(), 130
+#define _GMP_MAKE_INDEX_SEQUENCE_131() _GMP_MAKE_INDEX_SEQUENCE_130(), 131
+#define _GMP_MAKE_INDEX_SEQUENCE_132() _GMP_MAKE_INDEX_SEQUENCE_131(), 132
+#define _GMP_MAKE_INDEX_SEQUENCE_133() _GMP_MAKE_INDEX_SEQUENCE_132(), 133
+#define _GMP_MAKE_INDEX_SEQUENCE_134() _GMP_MAKE_INDEX_SEQUENCE_133(), 134
+#define _GMP_MAKE_INDEX_SEQUENCE_135() _GMP_MAKE_INDEX_SEQUENCE_134(), 135
+#define _GMP_MAKE_INDEX_SEQUENCE_136() _GMP_MAKE_INDEX_SEQUENCE_135(), 136
+#define _GMP_MAKE_INDEX_SEQUENCE_137() _GMP_MAKE_INDEX_SEQUENCE_136(), 137
+#define _GMP_MAKE_INDEX_SEQUENCE_138() _GMP_MAKE_INDEX_SEQUENCE_137(), 138
+#define _GMP_MAKE_INDEX_SEQUENCE_139() _GMP_MAKE_INDEX_SEQUENCE_138(), 139
+#define _GMP_MAKE_INDEX_SEQUENCE_140() _GMP_MAKE_INDEX_SEQUENCE_139(), 140
+#define _GMP_MAKE_INDEX_SEQUENCE_141() _GMP_MAKE_INDEX_SEQUENCE_140(), 141
+#define _GMP_MAKE_INDEX_SEQUENCE_142() _GMP_MAKE_INDEX_SEQUENCE_141(), 142
+#define _GMP_MAKE_INDEX_SEQUENCE_143() _GMP_MAKE_INDEX_SEQUENCE_142(), 143
+#define _GMP_MAKE_INDEX_SEQUENCE_144() _GMP_MAKE_INDEX_SEQUENCE_143(), 144
+#define _GMP_MAKE_INDEX_SEQUENCE_145() _GMP_MAKE_INDEX_SEQUENCE_144(), 145
+#define _GMP_MAKE_INDEX_SEQUENCE_146() _GMP_MAKE_INDEX_SEQUENCE_145(), 146
+#define _GMP_MAKE_INDEX_SEQUENCE_147() _GMP_MAKE_INDEX_SEQUENCE_146(), 147
+#define _GMP_MAKE_INDEX_SEQUENCE_148() _GMP_MAKE_INDEX_SEQUENCE_147(), 148
+#define _GMP_MAKE_INDEX_SEQUENCE_149() _GMP_MAKE_INDEX_SEQUENCE_148(), 149
+#define _GMP_MAKE_INDEX_SEQUENCE_150() _GMP_MAKE_INDEX_SEQUENCE_149(), 150
+#define _GMP_MAKE_INDEX_SEQUENCE_151() _GMP_MAKE_INDEX_SEQUENCE_150(), 151
+#define _GMP_MAKE_INDEX_SEQUENCE_152() _GMP_MAKE_INDEX_SEQUENCE_151(), 152
+#define _GMP_MAKE_INDEX_SEQUENCE_153() _GMP_MAKE_INDEX_SEQUENCE_152(), 153
+#define _GMP_MAKE_INDEX_SEQUENCE_154() _GMP_MAKE_INDEX_SEQUENCE_153(), 154
+#define _GMP_MAKE_INDEX_SEQUENCE_155() _GMP_MAKE_INDEX_SEQUENCE_154(), 155
+#define _GMP_MAKE_INDEX_SEQUENCE_156() _GMP_MAKE_INDEX_SEQUENCE_155(), 156
+#define _GMP_MAKE_INDEX_SEQUENCE_157() _GMP_MAKE_INDEX_SEQUENCE_156(), 157
+#define _GMP_MAKE_INDEX_SEQUENCE_158() _GMP_MAKE_INDEX_SEQUENCE_157(), 158
+#define _GMP_MAKE_INDEX_SEQUENCE_159() _GMP_MAKE_INDEX_SEQUENCE_158(), 159
+#define _GMP_MAKE_INDEX_SEQUENCE_160() _GMP_MAKE_INDEX_SEQUENCE_159(), 160
+#define _GMP_MAKE_INDEX_SEQUENCE_161() _GMP_MAKE_INDEX_SEQUENCE_160(), 161
+#define _GMP_MAKE_INDEX_SEQUENCE_162() _GMP_MAKE_INDEX_SEQUENCE_161(), 162
+#define _GMP_MAKE_INDEX_SEQUENCE_163() _GMP_MAKE_INDEX_SEQUENCE_162(), 163
+#define _GMP_MAKE_INDEX_SEQUENCE_164() _GMP_MAKE_INDEX_SEQUENCE_163(), 164
+#define _GMP_MAKE_INDEX_SEQUENCE_165() _GMP_MAKE_INDEX_SEQUENCE_164(), 165
+#define _GMP_MAKE_INDEX_SEQUENCE_166() _GMP_MAKE_INDEX_SEQUENCE_165(), 166
+#define _GMP_MAKE_INDEX_SEQUENCE_167() _GMP_MAKE_INDEX_SEQUENCE_166(), 167
+#define _GMP_MAKE_INDEX_SEQUENCE_168() _GMP_MAKE_INDEX_SEQUENCE_167(), 168
+#define _GMP_MAKE_INDEX_SEQUENCE_169() _GMP_MAKE_INDEX_SEQUENCE_168(), 169
+#define _GMP_MAKE_INDEX_SEQUENCE_170() _GMP_MAKE_INDEX_SEQUENCE_169(), 170
+#define _GMP_MAKE_INDEX_SEQUENCE_171() _GMP_MAKE_INDEX_SEQUENCE_170(), 171
+#define _GMP_MAKE_INDEX_SEQUENCE_172() _GMP_MAKE_INDEX_SEQUENCE_171(), 172
+#define _GMP_MAKE_INDEX_SEQUENCE_173() _GMP_MAKE_INDEX_SEQUENCE_172(), 173
+#define _GMP_MAKE_INDEX_SEQUENCE_174() _GMP_MAKE_INDEX_SEQUENCE_173(), 174
+#define _GMP_MAKE_INDEX_SEQUENCE_175() _GMP_MAKE_INDEX_SEQUENCE_174(), 175
+#define _GMP_MAKE_INDEX_SEQUENCE_176() _GMP_MAKE_INDEX_SEQUENCE_175(), 176
+#define _GMP_MAKE_INDEX_SEQUENCE_177() _GMP_MAKE_INDEX_SEQUENCE_176(), 177
+#define _GMP_MAKE_INDEX_SEQUENCE_178() _GMP_MAKE_INDEX_SEQUENCE_177(), 178
+#define _GMP_MAKE_INDEX_SEQUENCE_179() _GMP_MAKE_INDEX_SEQUENCE_178(), 179
+#define _GMP_MAKE_INDEX_SEQUENCE_180() _GMP_MAKE_INDEX_SEQUENCE_179(), 180
+#define _GMP_MAKE_INDEX_SEQUENCE_181() _GMP_MAKE_INDEX_SEQUENCE_180(), 181
+#define _GMP_MAKE_INDEX_SEQUENCE_182() _GMP_MAKE_INDEX_SEQUENCE_181(), 182
+#define _GMP_MAKE_INDEX_SEQUENCE_183() _GMP_MAKE_INDEX_SEQUENCE_182(), 183
+#define _GMP_MAKE_INDEX_SEQUENCE_184() _GMP_MAKE_INDEX_SEQUENCE_183(), 184
+#define _GMP_MAKE_INDEX_SEQUENCE_185() _GMP_MAKE_INDEX_SEQUENCE_184(), 185
+#define _GMP_MAKE_INDEX_SEQUENCE_186() _GMP_MAKE_INDEX_SEQUENCE_185(), 186
+#define _GMP_MAKE_INDEX_SEQUENCE_187() _GMP_MAKE_INDEX_SEQUENCE_186(), 187
+#define _GMP_MAKE_INDEX_SEQUENCE_188() _GMP_MAKE_INDEX_SEQUENCE_187(), 188
+#define _GMP_MAKE_INDEX_SEQUENCE_189() _GMP_MAKE_INDEX_SEQUENCE_188(), 189
+#define _GMP_MAKE_INDEX_SEQUENCE_190() _GMP_MAKE_INDEX_SEQUENCE_189(), 190
+#define _GMP_MAKE_INDEX_SEQUENCE_191() _GMP_MAKE_INDEX_SEQUENCE_190(), 191
+#define _GMP_MAKE_INDEX_SEQUENCE_192() _GMP_MAKE_INDEX_SEQUENCE_191(), 192
+#define _GMP_MAKE_INDEX_SEQUENCE_193() _GMP_MAKE_INDEX_SEQUENCE_192(), 193
+#define _GMP_MAKE_INDEX_SEQUENCE_194() _GMP_MAKE_INDEX_SEQUENCE_193(), 194
+#define _GMP_MAKE_INDEX_SEQUENCE_195() _GMP_MAKE_INDEX_SEQUENCE_194(), 195
+#define _GMP_MAKE_INDEX_SEQUENCE_196() _GMP_MAKE_INDEX_SEQUENCE_195(), 196
+#define _GMP_MAKE_INDEX_SEQUENCE_197() _GMP_MAKE_INDEX_SEQUENCE_196(), 197
+#define _GMP_MAKE_INDEX_SEQUENCE_198() _GMP_MAKE_INDEX_SEQUENCE_197(), 198
+#define _GMP_MAKE_INDEX_SEQUENCE_199() _GMP_MAKE_INDEX_SEQUENCE_198(), 199
+#define _GMP_MAKE_INDEX_SEQUENCE_200() _GMP_MAKE_INDEX_SEQUENCE_199(), 200
+#define _GMP_MAKE_INDEX_SEQUENCE_201() _GMP_MAKE_INDEX_SEQUENCE_200(), 201
+#define _GMP_MAKE_INDEX_SEQUENCE_202() _GMP_MAKE_INDEX_SEQUENCE_201(), 202
+#define _GMP_MAKE_INDEX_SEQUENCE_203() _GMP_MAKE_INDEX_SEQUENCE_202(), 203
+#define _GMP_MAKE_INDEX_SEQUENCE_204() _GMP_MAKE_INDEX_SEQUENCE_203(), 204
+#define _GMP_MAKE_INDEX_SEQUENCE_205() _GMP_MAKE_INDEX_SEQUENCE_204(), 205
+#define _GMP_MAKE_INDEX_SEQUENCE_206() _GMP_MAKE_INDEX_SEQUENCE_205(), 206
+#define _GMP_MAKE_INDEX_SEQUENCE_207() _GMP_MAKE_INDEX_SEQUENCE_206(), 207
+#define _GMP_MAKE_INDEX_SEQUENCE_208() _GMP_MAKE_INDEX_SEQUENCE_207(), 208
+#define _GMP_MAKE_INDEX_SEQUENCE_209() _GMP_MAKE_INDEX_SEQUENCE_208(), 209
+#define _GMP_MAKE_INDEX_SEQUENCE_210() _GMP_MAKE_INDEX_SEQUENCE_209(), 210
+#define _GMP_MAKE_INDEX_SEQUENCE_211() _GMP_MAKE_INDEX_SEQUENCE_210(), 211
+#define _GMP_MAKE_INDEX_SEQUENCE_212() _GMP_MAKE_INDEX_SEQUENCE_211(), 212
+#define _GMP_MAKE_INDEX_SEQUENCE_213() _GMP_MAKE_INDEX_SEQUENCE_212(), 213
+#define _GMP_MAKE_INDEX_SEQUENCE_214() _GMP_MAKE_INDEX_SEQUENCE_213(), 214
+#define _GMP_MAKE_INDEX_SEQUENCE_215() _GMP_MAKE_INDEX_SEQUENCE_214(), 215
+#define _GMP_MAKE_INDEX_SEQUENCE_216() _GMP_MAKE_INDEX_SEQUENCE_215(), 216
+#define _GMP_MAKE_INDEX_SEQUENCE_217() _GMP_MAKE_INDEX_SEQUENCE_216(), 217
+#define _GMP_MAKE_INDEX_SEQUENCE_218() _GMP_MAKE_INDEX_SEQUENCE_217(), 218
+#define _GMP_MAKE_INDEX_SEQUENCE_219() _GMP_MAKE_INDEX_SEQUENCE_218(), 219
+#define _GMP_MAKE_INDEX_SEQUENCE_220() _GMP_MAKE_INDEX_SEQUENCE_219(), 220
+#define _GMP_MAKE_INDEX_SEQUENCE_221() _GMP_MAKE_INDEX_SEQUENCE_220(), 221
+#define _GMP_MAKE_INDEX_SEQUENCE_222() _GMP_MAKE_INDEX_SEQUENCE_221(), 222
+#define _GMP_MAKE_INDEX_SEQUENCE_223() _GMP_MAKE_INDEX_SEQUENCE_222(), 223
+#define _GMP_MAKE_INDEX_SEQUENCE_224() _GMP_MAKE_INDEX_SEQUENCE_223(), 224
+#define _GMP_MAKE_INDEX_SEQUENCE_225() _GMP_MAKE_INDEX_SEQUENCE_224(), 225
+#define _GMP_MAKE_INDEX_SEQUENCE_226() _GMP_MAKE_INDEX_SEQUENCE_225(), 226
+#define _GMP_MAKE_INDEX_SEQUENCE_227() _GMP_MAKE_INDEX_SEQUENCE_226(), 227
+#define _GMP_MAKE_INDEX_SEQUENCE_228() _GMP_MAKE_INDEX_SEQUENCE_227(), 228
+#define _GMP_MAKE_INDEX_SEQUENCE_229() _GMP_MAKE_INDEX_SEQUENCE_228(), 229
+#define _GMP_MAKE_INDEX_SEQUENCE_230() _GMP_MAKE_INDEX_SEQUENCE_229(), 230
+#define _GMP_MAKE_INDEX_SEQUENCE_231() _GMP_MAKE_INDEX_SEQUENCE_230(), 231
+#define _GMP_MAKE_INDEX_SEQUENCE_232() _GMP_MAKE_INDEX_SEQUENCE_231(), 232
+#define _GMP_MAKE_INDEX_SEQUENCE_233() _GMP_MAKE_INDEX_SEQUENCE_232(), 233
+#define _GMP_MAKE_INDEX_SEQUENCE_234() _GMP_MAKE_INDEX_SEQUENCE_233(), 234
+#define _GMP_MAKE_INDEX_SEQUENCE_235() _GMP_MAKE_INDEX_SEQUENCE_234(), 235
+#define _GMP_MAKE_INDEX_SEQUENCE_236() _GMP_MAKE_INDEX_SEQUENCE_235(), 236
+#define _GMP_MAKE_INDEX_SEQUENCE_237() _GMP_MAKE_INDEX_SEQUENCE_236(), 237
+#define _GMP_MAKE_INDEX_SEQUENCE_238() _GMP_MAKE_INDEX_SEQUENCE_237(), 238
+#define _GMP_MAKE_INDEX_SEQUENCE_239() _GMP_MAKE_INDEX_SEQUENCE_238(), 239
+#define _GMP_MAKE_INDEX_SEQUENCE_240() _GMP_MAKE_INDEX_SEQUENCE_239(), 240
+#define _GMP_MAKE_INDEX_SEQUENCE_241() _GMP_MAKE_INDEX_SEQUENCE_240(), 241
+#define _GMP_MAKE_INDEX_SEQUENCE_242() _GMP_MAKE_INDEX_SEQUENCE_241(), 242
+#define _GMP_MAKE_INDEX_SEQUENCE_243() _GMP_MAKE_INDEX_SEQUENCE_242(), 243
+#define _GMP_MAKE_INDEX_SEQUENCE_244() _GMP_MAKE_INDEX_SEQUENCE_243(), 244
+#define _GMP_MAKE_INDEX_SEQUENCE_245() _GMP_MAKE_INDEX_SEQUENCE_244(), 245
+#define _GMP_MAKE_INDEX_SEQUENCE_246() _GMP_MAKE_INDEX_SEQUENCE_245(), 246
+#define _GMP_MAKE_INDEX_SEQUENCE_247() _GMP_MAKE_INDEX_SEQUENCE_246(), 247
+#define _GMP_MAKE_INDEX_SEQUENCE_248() _GMP_MAKE_INDEX_SEQUENCE_247(), 248
+#define _GMP_MAKE_INDEX_SEQUENCE_249() _GMP_MAKE_INDEX_SEQUENCE_248(), 249
+#define _GMP_MAKE_INDEX_SEQUENCE_250() _GMP_MAKE_INDEX_SEQUENCE_249(), 250
+#define _GMP_MAKE_INDEX_SEQUENCE_251() _GMP_MAKE_INDEX_SEQUENCE_250(), 251
+#define _GMP_MAKE_INDEX_SEQUENCE_252() _GMP_MAKE_INDEX_SEQUENCE_251(), 252
+#define _GMP_MAKE_INDEX_SEQUENCE_253() _GMP_MAKE_INDEX_SEQUENCE_252(), 253
+#define _GMP_MAKE_INDEX_SEQUENCE_254() _GMP_MAKE_INDEX_SEQUENCE_253(), 254
+#define _GMP_MAKE_INDEX_SEQUENCE_255() _GMP_MAKE_INDEX_SEQUENCE_254(), 255
+#define _GMP_MAKE_INDEX_SEQUENCE_256() _GMP_MAKE_INDEX_SEQUENCE_255(), 256
+#define _GMP_MAKE_INDEX_SEQUENCE_257() _GMP_MAKE_INDEX_SEQUENCE_256(), 257
+#define _GMP_MAKE_INDEX_SEQUENCE_258() _GMP_MAKE_INDEX_SEQUENCE_257(), 258
+#define _GMP_MAKE_INDEX_SEQUENCE_259() _GMP_MAKE_INDEX_SEQUENCE_258(), 259
+#define _GMP_MAKE_INDEX_SEQUENCE_260() _GMP_MAKE_INDEX_SEQUENCE_259(), 260
+#define _GMP_MAKE_INDEX_SEQUENCE_261() _GMP_MAKE_INDEX_SEQUENCE_260(), 261
+#define _GMP_MAKE_INDEX_SEQUENCE_262() _GMP_MAKE_INDEX_SEQUENCE_261(), 262
+#define _GMP_MAKE_INDEX_SEQUENCE_263() _GMP_MAKE_INDEX_SEQUENCE_262(), 263
+#define _GMP_MAKE_INDEX_SEQUENCE_264() _GMP_MAKE_INDEX_SEQUENCE_263(), 264
+#define _GMP_MAKE_INDEX_SEQUENCE_265() _GMP_MAKE_INDEX_SEQUENCE_264(), 265
+#define _GMP_MAKE_INDEX_SEQUENCE_266() _GMP_MAKE_INDEX_SEQUENCE_265(), 266
+#define _GMP_MAKE_INDEX_SEQUENCE_267() _GMP_MAKE_INDEX_SEQUENCE_266(), 267
+#define _GMP_MAKE_INDEX_SEQUENCE_268() _GMP_MAKE_INDEX_SEQUENCE_267(), 268
+#define _GMP_MAKE_INDEX_SEQUENCE_269() _GMP_MAKE_INDEX_SEQUENCE_268(), 269
+#define _GMP_MAKE_INDEX_SEQUENCE_270() _GMP_MAKE_INDEX_SEQUENCE_269(), 270
+#define _GMP_MAKE_INDEX_SEQUENCE_271() _GMP_MAKE_INDEX_SEQUENCE_270(), 271
+#define _GMP_MAKE_INDEX_SEQUENCE_272() _GMP_MAKE_INDEX_SEQUENCE_271(), 272
+#define _GMP_MAKE_INDEX_SEQUENCE_273() _GMP_MAKE_INDEX_SEQUENCE_272(), 273
+#define _GMP_MAKE_INDEX_SEQUENCE_274() _GMP_MAKE_INDEX_SEQUENCE_273(), 274
+#define _GMP_MAKE_INDEX_SEQUENCE_275() _GMP_MAKE_INDEX_SEQUENCE_274(), 275
+#define _GMP_MAKE_INDEX_SEQUENCE_276() _GMP_MAKE_INDEX_SEQUENCE_275(), 276
+#define _GMP_MAKE_INDEX_SEQUENCE_277() _GMP_MAKE_INDEX_SEQUENCE_276(), 277
+#define _GMP_MAKE_INDEX_SEQUENCE_278() _GMP_MAKE_INDEX_SEQUENCE_277(), 278
+#define _GMP_MAKE_INDEX_SEQUENCE_279() _GMP_MAKE_INDEX_SEQUENCE_278(), 279
+#define _GMP_MAKE_INDEX_SEQUENCE_280() _GMP_MAKE_INDEX_SEQUENCE_279(), 280
+#define _GMP_MAKE_INDEX_SEQUENCE_281() _GMP_MAKE_INDEX_SEQUENCE_280(), 281
+#define _GMP_MAKE_INDEX_SEQUENCE_282() _GMP_MAKE_INDEX_SEQUENCE_281(), 282
+#define _GMP_MAKE_INDEX_SEQUENCE_283() _GMP_MAKE_INDEX_SEQUENCE_282(), 283
+#define _GMP_MAKE_INDEX_SEQUENCE_284() _GMP_MAKE_INDEX_SEQUENCE_283(), 284
+#define _GMP_MAKE_INDEX_SEQUENCE_285() _GMP_MAKE_INDEX_SEQUENCE_284(), 285
+#define _GMP_MAKE_INDEX_SEQUENCE_286() _GMP_MAKE_INDEX_SEQUENCE_285(), 286
+#define _GMP_MAKE_INDEX_SEQUENCE_287() _GMP_MAKE_INDEX_SEQUENCE_286(), 287
+#define _GMP_MAKE_INDEX_SEQUENCE_288() _GMP_MAKE_INDEX_SEQUENCE_287(), 288
+#define _GMP_MAKE_INDEX_SEQUENCE_289() _GMP_MAKE_INDEX_SEQUENCE_288(), 289
+#define _GMP_MAKE_INDEX_SEQUENCE_290() _GMP_MAKE_INDEX_SEQUENCE_289(), 290
+#define _GMP_MAKE_INDEX_SEQUENCE_291() _GMP_MAKE_INDEX_SEQUENCE_290(), 291
+#define _GMP_MAKE_INDEX_SEQUENCE_292() _GMP_MAKE_INDEX_SEQUENCE_291(), 292
+#define _GMP_MAKE_INDEX_SEQUENCE_293() _GMP_MAKE_INDEX_SEQUENCE_292(), 293
+#define _GMP_MAKE_INDEX_SEQUENCE_294() _GMP_MAKE_INDEX_SEQUENCE_293(), 294
+#define _GMP_MAKE_INDEX_SEQUENCE_295() _GMP_MAKE_INDEX_SEQUENCE_294(), 295
+#define _GMP_MAKE_INDEX_SEQUENCE_296() _GMP_MAKE_INDEX_SEQUENCE_295(), 296
+#define _GMP_MAKE_INDEX_SEQUENCE_297() _GMP_MAKE_INDEX_SEQUENCE_296(), 297
+#define _GMP_MAKE_INDEX_SEQUENCE_298() _GMP_MAKE_INDEX_SEQUENCE_297(), 298
+#define _GMP_MAKE_INDEX_SEQUENCE_299() _GMP_MAKE_INDEX_SEQUENCE_298(), 299
+#define _GMP_MAKE_INDEX_SEQUENCE_300() _GMP_MAKE_INDEX_SEQUENCE_299(), 300
+#define _GMP_MAKE_INDEX_SEQUENCE_301() _GMP_MAKE_INDEX_SEQUENCE_300(), 301
+#define _GMP_MAKE_INDEX_SEQUENCE_302() _GMP_MAKE_INDEX_SEQUENCE_301(), 302
+#define _GMP_MAKE_INDEX_SEQUENCE_303() _GMP_MAKE_INDEX_SEQUENCE_302(), 303
+#define _GMP_MAKE_INDEX_SEQUENCE_304() _GMP_MAKE_INDEX_SEQUENCE_303(), 304
+#define _GMP_MAKE_INDEX_SEQUENCE_305() _GMP_MAKE_INDEX_SEQUENCE_304(), 305
+#define _GMP_MAKE_INDEX_SEQUENCE_306() _GMP_MAKE_INDEX_SEQUENCE_305(), 306
+#define _GMP_MAKE_INDEX_SEQUENCE_307() _GMP_MAKE_INDEX_SEQUENCE_306(), 307
+#define _GMP_MAKE_INDEX_SEQUENCE_308() _GMP_MAKE_INDEX_SEQUENCE_307(), 308
+#define _GMP_MAKE_INDEX_SEQUENCE_309() _GMP_MAKE_INDEX_SEQUENCE_308(), 309
+#define _GMP_MAKE_INDEX_SEQUENCE_310() _GMP_MAKE_INDEX_SEQUENCE_309(), 310
+#define _GMP_MAKE_INDEX_SEQUENCE_311() _GMP_MAKE_INDEX_SEQUENCE_310(), 311
+#define _GMP_MAKE_INDEX_SEQUENCE_312() _GMP_MAKE_INDEX_SEQUENCE_311(), 312
+#define _GMP_MAKE_INDEX_SEQUENCE_313() _GMP_MAKE_INDEX_SEQUENCE_312(), 313
+#define _GMP_MAKE_INDEX_SEQUENCE_314() _GMP_MAKE_INDEX_SEQUENCE_313(), 314
+#define _GMP_MAKE_INDEX_SEQUENCE_315() _GMP_MAKE_INDEX_SEQUENCE_314(), 315
+#define _GMP_MAKE_INDEX_SEQUENCE_316() _GMP_MAKE_INDEX_SEQUENCE_315(), 316
+#define _GMP_MAKE_INDEX_SEQUENCE_317() _GMP_MAKE_INDEX_SEQUENCE_316(), 317
+#define _GMP_MAKE_INDEX_SEQUENCE_318() _GMP_MAKE_INDEX_SEQUENCE_317(), 318
+#define _GMP_MAKE_INDEX_SEQUENCE_319() _GMP_MAKE_INDEX_SEQUENCE_318(), 319
+#define _GMP_MAKE_INDEX_SEQUENCE_320() _GMP_MAKE_INDEX_SEQUENCE_319(), 320
+#define _GMP_MAKE_INDEX_SEQUENCE_321() _GMP_MAKE_INDEX_SEQUENCE_320(), 321
+#define _GMP_MAKE_INDEX_SEQUENCE_322() _GMP_MAKE_INDEX_SEQUENCE_321(), 322
+#define _GMP_MAKE_INDEX_SEQUENCE_323() _GMP_MAKE_INDEX_SEQUENCE_322(), 323
+#define _GMP_MAKE_INDEX_SEQUENCE_324() _GMP_MAKE_INDEX_SEQUENCE_323(), 324
+#define _GMP_MAKE_INDEX_SEQUENCE_325() _GMP_MAKE_INDEX_SEQUENCE_324(), 325
+#define _GMP_MAKE_INDEX_SEQUENCE_326() _GMP_MAKE_INDEX_SEQUENCE_325(), 326
+#define _GMP_MAKE_INDEX_SEQUENCE_327() _GMP_MAKE_INDEX_SEQUENCE_326(), 327
+#define _GMP_MAKE_INDEX_SEQUENCE_328() _GMP_MAKE_INDEX_SEQUENCE_327(), 328
+#define _GMP_MAKE_INDEX_SEQUENCE_329() _GMP_MAKE_INDEX_SEQUENCE_328(), 329
+#define _GMP_MAKE_INDEX_SEQUENCE_330() _GMP_MAKE_INDEX_SEQUENCE_329(), 330
+#define _GMP_MAKE_INDEX_SEQUENCE_331() _GMP_MAKE_INDEX_SEQUENCE_330(), 331
+#define _GMP_MAKE_INDEX_SEQUENCE_332() _GMP_MAKE_INDEX_SEQUENCE_331(), 332
+#define _GMP_MAKE_INDEX_SEQUENCE_333() _GMP_MAKE_INDEX_SEQUENCE_332(), 333
+#define _GMP_MAKE_INDEX_SEQUENCE_334() _GMP_MAKE_INDEX_SEQUENCE_333(), 334
+#define _GMP_MAKE_INDEX_SEQUENCE_335() _GMP_MAKE_INDEX_SEQUENCE_334(), 335
+#define _GMP_MAKE_INDEX_SEQUENCE_336() _GMP_MAKE_INDEX_SEQUENCE_335(), 336
+#define _GMP_MAKE_INDEX_SEQUENCE_337() _GMP_MAKE_INDEX_SEQUENCE_336(), 337
+#define _GMP_MAKE_INDEX_SEQUENCE_338() _GMP_MAKE_INDEX_SEQUENCE_337(), 338
+#define _GMP_MAKE_INDEX_SEQUENCE_339() _GMP_MAKE_INDEX_SEQUENCE_338(), 339
+#define _GMP_MAKE_INDEX_SEQUENCE_340() _GMP_MAKE_INDEX_SEQUENCE_339(), 340
+#define _GMP_MAKE_INDEX_SEQUENCE_341() _GMP_MAKE_INDEX_SEQUENCE_340(), 341
+#define _GMP_MAKE_INDEX_SEQUENCE_342() _GMP_MAKE_INDEX_SEQUENCE_341(), 342
+#define _GMP_MAKE_INDEX_SEQUENCE_343() _GMP_MAKE_INDEX_SEQUENCE_342(), 343
+#define _GMP_MAKE_INDEX_SEQUENCE_344() _GMP_MAKE_INDEX_SEQUENCE_343(), 344
+#define _GMP_MAKE_INDEX_SEQUENCE_345() _GMP_MAKE_INDEX_SEQUENCE_344(), 345
+#define _GMP_MAKE_INDEX_SEQUENCE_346() _GMP_MAKE_INDEX_SEQUENCE_345(), 346
+#define _GMP_MAKE_INDEX_SEQUENCE_347() _GMP_MAKE_INDEX_SEQUENCE_346(), 347
+#define _GMP_MAKE_INDEX_SEQUENCE_348() _GMP_MAKE_INDEX_SEQUENCE_347(), 348
+#define _GMP_MAKE_INDEX_SEQUENCE_349() _GMP_MAKE_INDEX_SEQUENCE_348(), 349
+#define _GMP_MAKE_INDEX_SEQUENCE_350() _GMP_MAKE_INDEX_SEQUENCE_349(), 350
+#define _GMP_MAKE_INDEX_SEQUENCE_351() _GMP_MAKE_INDEX_SEQUENCE_350(), 351
+#define _GMP_MAKE_INDEX_SEQUENCE_352() _GMP_MAKE_INDEX_SEQUENCE_351(), 352
+#define _GMP_MAKE_INDEX_SEQUENCE_353() _GMP_MAKE_INDEX_SEQUENCE_352(), 353
+#define _GMP_MAKE_INDEX_SEQUENCE_354() _GMP_MAKE_INDEX_SEQUENCE_353(), 354
+#define _GMP_MAKE_INDEX_SEQUENCE_355() _GMP_MAKE_INDEX_SEQUENCE_354(), 355
+#define _GMP_MAKE_INDEX_SEQUENCE_356() _GMP_MAKE_INDEX_SEQUENCE_355(), 356
+#define _GMP_MAKE_INDEX_SEQUENCE_357() _GMP_MAKE_INDEX_SEQUENCE_356(), 357
+#define _GMP_MAKE_INDEX_SEQUENCE_358() _GMP_MAKE_INDEX_SEQUENCE_357(), 358
+#define _GMP_MAKE_INDEX_SEQUENCE_359() _GMP_MAKE_INDEX_SEQUENCE_358(), 359
+#define _GMP_MAKE_INDEX_SEQUENCE_360() _GMP_MAKE_INDEX_SEQUENCE_359(), 360
+#define _GMP_MAKE_INDEX_SEQUENCE_361() _GMP_MAKE_INDEX_SEQUENCE_360(), 361
+#define _GMP_MAKE_INDEX_SEQUENCE_362() _GMP_MAKE_INDEX_SEQUENCE_361(), 362
+#define _GMP_MAKE_INDEX_SEQUENCE_363() _GMP_MAKE_INDEX_SEQUENCE_362(), 363
+#define _GMP_MAKE_INDEX_SEQUENCE_364() _GMP_MAKE_INDEX_SEQUENCE_363(), 364
+#define _GMP_MAKE_INDEX_SEQUENCE_365() _GMP_MAKE_INDEX_SEQUENCE_364(), 365
+#define _GMP_MAKE_INDEX_SEQUENCE_366() _GMP_MAKE_INDEX_SEQUENCE_365(), 366
+#define _GMP_MAKE_INDEX_SEQUENCE_367() _GMP_MAKE_INDEX_SEQUENCE_366(), 367
+#define _GMP_MAKE_INDEX_SEQUENCE_368() _GMP_MAKE_INDEX_SEQUENCE_367(), 368
+#define _GMP_MAKE_INDEX_SEQUENCE_369() _GMP_MAKE_INDEX_SEQUENCE_368(), 369
+#define _GMP_MAKE_INDEX_SEQUENCE_370() _GMP_MAKE_INDEX_SEQUENCE_369(), 370
+#define _GMP_MAKE_INDEX_SEQUENCE_371() _GMP_MAKE_INDEX_SEQUENCE_370(), 371
+#define _GMP_MAKE_INDEX_SEQUENCE_372() _GMP_MAKE_INDEX_SEQUENCE_371(), 372
+#define _GMP_MAKE_INDEX_SEQUENCE_373() _GMP_MAKE_INDEX_SEQUENCE_372(), 373
+#define _GMP_MAKE_INDEX_SEQUENCE_374() _GMP_MAKE_INDEX_SEQUENCE_373(), 374
+#define _GMP_MAKE_INDEX_SEQUENCE_375() _GMP_MAKE_INDEX_SEQUENCE_374(), 375
+#define _GMP_MAKE_INDEX_SEQUENCE_376() _GMP_MAKE_INDEX_SEQUENCE_375(), 376
+#define _GMP_MAKE_INDEX_SEQUENCE_377() _GMP_MAKE_INDEX_SEQUENCE_376(), 377
+#define _GMP_MAKE_INDEX_SEQUENCE_378() _GMP_MAKE_INDEX_SEQUENCE_377(), 378
+#define _GMP_MAKE_INDEX_SEQUENCE_379() _GMP_MAKE_INDEX_SEQUENCE_378(), 379
+#define _GMP_MAKE_INDEX_SEQUENCE_380() _GMP_MAKE_INDEX_SEQUENCE_379(), 380
+#define _GMP_MAKE_INDEX_SEQUENCE_381() _GMP_MAKE_INDEX_SEQUENCE_380(), 381
+#define _GMP_MAKE_INDEX_SEQUENCE_382() _GMP_MAKE_INDEX_SEQUENCE_381(), 382
+#define _GMP_MAKE_INDEX_SEQUENCE_383() _GMP_MAKE_INDEX_SEQUENCE_382(), 383
+#define _GMP_MAKE_INDEX_SEQUENCE_384() _GMP_MAKE_INDEX_SEQUENCE_383(), 384
+#define _GMP_MAKE_INDEX_SEQUENCE_385() _GMP_MAKE_INDEX_SEQUENCE_384(), 385
+#define _GMP_MAKE_INDEX_SEQUENCE_386() _GMP_MAKE_INDEX_SEQUENCE_385(), 386
+#define _GMP_MAKE_INDEX_SEQUENCE_387() _GMP_MAKE_INDEX_SEQUENCE_386(), 387
+#define _GMP_MAKE_INDEX_SEQUENCE_388() _GMP_MAKE_INDEX_SEQUENCE_387(), 388
+#define _GMP_MAKE_INDEX_SEQUENCE_389() _GMP_MAKE_INDEX_SEQUENCE_388(), 389
+#define _GMP_MAKE_INDEX_SEQUENCE_390() _GMP_MAKE_INDEX_SEQUENCE_389(), 390
+#define _GMP_MAKE_INDEX_SEQUENCE_391() _GMP_MAKE_INDEX_SEQUENCE_390(), 391
+#define _GMP_MAKE_INDEX_SEQUENCE_392() _GMP_MAKE_INDEX_SEQUENCE_391(), 392
+#define _GMP_MAKE_INDEX_SEQUENCE_393() _GMP_MAKE_INDEX_SEQUENCE_392(), 393
+#define _GMP_MAKE_INDEX_SEQUENCE_394() _GMP_MAKE_INDEX_SEQUENCE_393(), 394
+#define _GMP_MAKE_INDEX_SEQUENCE_395() _GMP_MAKE_INDEX_SEQUENCE_394(), 395
+#define _GMP_MAKE_INDEX_SEQUENCE_396() _GMP_MAKE_INDEX_SEQUENCE_395(), 396
+#define _GMP_MAKE_INDEX_SEQUENCE_397() _GMP_MAKE_INDEX_SEQUENCE_396(), 397
+#define _GMP_MAKE_INDEX_SEQUENCE_398() _GMP_MAKE_INDEX_SEQUENCE_397(), 398
+#define _GMP_MAKE_INDEX_SEQUENCE_399() _GMP_MAKE_INDEX_SEQUENCE_398(), 399
+#define _GMP_MAKE_INDEX_SEQUENCE_400() _GMP_MAKE_INDEX_SEQUENCE_399(), 400
+#define _GMP_MAKE_INDEX_SEQUENCE_401() _GMP_MAKE_INDEX_SEQUENCE_400(), 401
+#define _GMP_MAKE_INDEX_SEQUENCE_402() _GMP_MAKE_INDEX_SEQUENCE_401(), 402
+#define _GMP_MAKE_INDEX_SEQUENCE_403() _GMP_MAKE_INDEX_SEQUENCE_402(), 403
+#define _GMP_MAKE_INDEX_SEQUENCE_404() _GMP_MAKE_INDEX_SEQUENCE_403(), 404
+#define _GMP_MAKE_INDEX_SEQUENCE_405() _GMP_MAKE_INDEX_SEQUENCE_404(), 405
+#define _GMP_MAKE_INDEX_SEQUENCE_406() _GMP_MAKE_INDEX_SEQUENCE_405(), 406
+#define _GMP_MAKE_INDEX_SEQUENCE_407() _GMP_MAKE_INDEX_SEQUENCE_406(), 407
+#define _GMP_MAKE_INDEX_SEQUENCE_408() _GMP_MAKE_INDEX_SEQUENCE_407(), 408
+#define _GMP_MAKE_INDEX_SEQUENCE_409() _GMP_MAKE_INDEX_SEQUENCE_408(), 409
+#define _GMP_MAKE_INDEX_SEQUENCE_410() _GMP_MAKE_INDEX_SEQUENCE_409(), 410
+#define _GMP_MAKE_INDEX_SEQUENCE_411() _GMP_MAKE_INDEX_SEQUENCE_410(), 411
+#define _GMP_MAKE_INDEX_SEQUENCE_412() _GMP_MAKE_INDEX_SEQUENCE_411(), 412
+#define _GMP_MAKE_INDEX_SEQUENCE_413() _GMP_MAKE_INDEX_SEQUENCE_412(), 413
+#define _GMP_MAKE_INDEX_SEQUENCE_414() _GMP_MAKE_INDEX_SEQUENCE_413(), 414
+#define _GMP_MAKE_INDEX_SEQUENCE_415() _GMP_MAKE_INDEX_SEQUENCE_414(), 415
+#define _GMP_MAKE_INDEX_SEQUENCE_416() _GMP_MAKE_INDEX_SEQUENCE_415(), 416
+#define _GMP_MAKE_INDEX_SEQUENCE_417() _GMP_MAKE_INDEX_SEQUENCE_416(), 417
+#define _GMP_MAKE_INDEX_SEQUENCE_418() _GMP_MAKE_INDEX_SEQUENCE_417(), 418
+#define _GMP_MAKE_INDEX_SEQUENCE_419() _GMP_MAKE_INDEX_SEQUENCE_418(), 419
+#define _GMP_MAKE_INDEX_SEQUENCE_420() _GMP_MAKE_INDEX_SEQUENCE_419(), 420
+#define _GMP_MAKE_INDEX_SEQUENCE_421() _GMP_MAKE_INDEX_SEQUENCE_420(), 421
+#define _GMP_MAKE_INDEX_SEQUENCE_422() _GMP_MAKE_INDEX_SEQUENCE_421(), 422
+#define _GMP_MAKE_INDEX_SEQUENCE_423() _GMP_MAKE_INDEX_SEQUENCE_422(), 423
+#define _GMP_MAKE_INDEX_SEQUENCE_424() _GMP_MAKE_INDEX_SEQUENCE_423(), 424
+#define _GMP_MAKE_INDEX_SEQUENCE_425() _GMP_MAKE_INDEX_SEQUENCE_424(), 425
+#define _GMP_MAKE_INDEX_SEQUENCE_426() _GMP_MAKE_INDEX_SEQUENCE_425(), 426
+#define _GMP_MAKE_INDEX_SEQUENCE_427() _GMP_MAKE_INDEX_SEQUENCE_426(), 427
+#define _GMP_MAKE_INDEX_SEQUENCE_428() _GMP_MAKE_INDEX_SEQUENCE_427(), 428
+#define _GMP_MAKE_INDEX_SEQUENCE_429() _GMP_MAKE_INDEX_SEQUENCE_428(), 429
+#define _GMP_MAKE_INDEX_SEQUENCE_430() _GMP_MAKE_INDEX_SEQUENCE_429(), 430
+#define _GMP_MAKE_INDEX_SEQUENCE_431() _GMP_MAKE_INDEX_SEQUENCE_430(), 431
+#define _GMP_MAKE_INDEX_SEQUENCE_432() _GMP_MAKE_INDEX_SEQUENCE_431(), 432
+#define _GMP_MAKE_INDEX_SEQUENCE_433() _GMP_MAKE_INDEX_SEQUENCE_432(), 433
+#define _GMP_MAKE_INDEX_SEQUENCE_434() _GMP_MAKE_INDEX_SEQUENCE_433(), 434
+#define _GMP_MAKE_INDEX_SEQUENCE_435() _GMP_MAKE_INDEX_SEQUENCE_434(), 435
+#define _GMP_MAKE_INDEX_SEQUENCE_436() _GMP_MAKE_INDEX_SEQUENCE_435(), 436
+#define _GMP_MAKE_INDEX_SEQUENCE_437() _GMP_MAKE_INDEX_SEQUENCE_436(), 437
+#define _GMP_MAKE_INDEX_SEQUENCE_438() _GMP_MAKE_INDEX_SEQUENCE_437(), 438
+#define _GMP_MAKE_INDEX_SEQUENCE_439() _GMP_MAKE_INDEX_SEQUENCE_438(), 439
+#define _GMP_MAKE_INDEX_SEQUENCE_440() _GMP_MAKE_INDEX_SEQUENCE_439(), 440
+#define _GMP_MAKE_INDEX_SEQUENCE_441() _GMP_MAKE_INDEX_SEQUENCE_440(), 441
+#define _GMP_MAKE_INDEX_SEQUENCE_442() _GMP_MAKE_INDEX_SEQUENCE_441(), 442
+#define _GMP_MAKE_INDEX_SEQUENCE_443() _GMP_MAKE_INDEX_SEQUENCE_442(), 443
+#define _GMP_MAKE_INDEX_SEQUENCE_444() _GMP_MAKE_INDEX_SEQUENCE_443(), 444
+#define _GMP_MAKE_INDEX_SEQUENCE_445() _GMP_MAKE_INDEX_SEQUENCE_444(), 445
+#define _GMP_MAKE_INDEX_SEQUENCE_446() _GMP_MAKE_INDEX_SEQUENCE_445(), 446
+#define _GMP_MAKE_INDEX_SEQUENCE_447() _GMP_MAKE_INDEX_SEQUENCE_446(), 447
+#define _GMP_MAKE_INDEX_SEQUENCE_448() _GMP_MAKE_INDEX_SEQUENCE_447(), 448
+#define _GMP_MAKE_INDEX_SEQUENCE_449() _GMP_MAKE_INDEX_SEQUENCE_448(), 449
+#define _GMP_MAKE_INDEX_SEQUENCE_450() _GMP_MAKE_INDEX_SEQUENCE_449(), 450
+#define _GMP_MAKE_INDEX_SEQUENCE_451() _GMP_MAKE_INDEX_SEQUENCE_450(), 451
+#define _GMP_MAKE_INDEX_SEQUENCE_452() _GMP_MAKE_INDEX_SEQUENCE_451(), 452
+#define _GMP_MAKE_INDEX_SEQUENCE_453() _GMP_MAKE_INDEX_SEQUENCE_452(), 453
+#define _GMP_MAKE_INDEX_SEQUENCE_454() _GMP_MAKE_INDEX_SEQUENCE_453(), 454
+#define _GMP_MAKE_INDEX_SEQUENCE_455() _GMP_MAKE_INDEX_SEQUENCE_454(), 455
+#define _GMP_MAKE_INDEX_SEQUENCE_456() _GMP_MAKE_INDEX_SEQUENCE_455(), 456
+#define _GMP_MAKE_INDEX_SEQUENCE_457() _GMP_MAKE_INDEX_SEQUENCE_456(), 457
+#define _GMP_MAKE_INDEX_SEQUENCE_458() _GMP_MAKE_INDEX_SEQUENCE_457(), 458
+#define _GMP_MAKE_INDEX_SEQUENCE_459() _GMP_MAKE_INDEX_SEQUENCE_458(), 459
+#define _GMP_MAKE_INDEX_SEQUENCE_460() _GMP_MAKE_INDEX_SEQUENCE_459(), 460
+#define _GMP_MAKE_INDEX_SEQUENCE_461() _GMP_MAKE_INDEX_SEQUENCE_460(), 461
+#define _GMP_MAKE_INDEX_SEQUENCE_462() _GMP_MAKE_INDEX_SEQUENCE_461(), 462
+#define _GMP_MAKE_INDEX_SEQUENCE_463() _GMP_MAKE_INDEX_SEQUENCE_462(), 463
+#define _GMP_MAKE_INDEX_SEQUENCE_464() _GMP_MAKE_INDEX_SEQUENCE_463(), 464
+#define _GMP_MAKE_INDEX_SEQUENCE_465() _GMP_MAKE_INDEX_SEQUENCE_464(), 465
+#define _GMP_MAKE_INDEX_SEQUENCE_466() _GMP_MAKE_INDEX_SEQUENCE_465(), 466
+#define _GMP_MAKE_INDEX_SEQUENCE_467() _GMP_MAKE_INDEX_SEQUENCE_466(), 467
+#define _GMP_MAKE_INDEX_SEQUENCE_468() _GMP_MAKE_INDEX_SEQUENCE_467(), 468
+#define _GMP_MAKE_INDEX_SEQUENCE_469() _GMP_MAKE_INDEX_SEQUENCE_468(), 469
+#define _GMP_MAKE_INDEX_SEQUENCE_470() _GMP_MAKE_INDEX_SEQUENCE_469(), 470
+#define _GMP_MAKE_INDEX_SEQUENCE_471() _GMP_MAKE_INDEX_SEQUENCE_470(), 471
+#define _GMP_MAKE_INDEX_SEQUENCE_472() _GMP_MAKE_INDEX_SEQUENCE_471(), 472
+#define _GMP_MAKE_INDEX_SEQUENCE_473() _GMP_MAKE_INDEX_SEQUENCE_472(), 473
+#define _GMP_MAKE_INDEX_SEQUENCE_474() _GMP_MAKE_INDEX_SEQUENCE_473(), 474
+#define _GMP_MAKE_INDEX_SEQUENCE_475() _GMP_MAKE_INDEX_SEQUENCE_474(), 475
+#define _GMP_MAKE_INDEX_SEQUENCE_476() _GMP_MAKE_INDEX_SEQUENCE_475(), 476
+#define _GMP_MAKE_INDEX_SEQUENCE_477() _GMP_MAKE_INDEX_SEQUENCE_476(), 477
+#define _GMP_MAKE_INDEX_SEQUENCE_478() _GMP_MAKE_INDEX_SEQUENCE_477(), 478
+#define _GMP_MAKE_INDEX_SEQUENCE_479() _GMP_MAKE_INDEX_SEQUENCE_478(), 479
+#define _GMP_MAKE_INDEX_SEQUENCE_480() _GMP_MAKE_INDEX_SEQUENCE_479(), 480
+#define _GMP_MAKE_INDEX_SEQUENCE_481() _GMP_MAKE_INDEX_SEQUENCE_480(), 481
+#define _GMP_MAKE_INDEX_SEQUENCE_482() _GMP_MAKE_INDEX_SEQUENCE_481(), 482
+#define _GMP_MAKE_INDEX_SEQUENCE_483() _GMP_MAKE_INDEX_SEQUENCE_482(), 483
+#define _GMP_MAKE_INDEX_SEQUENCE_484() _GMP_MAKE_INDEX_SEQUENCE_483(), 484
+#define _GMP_MAKE_INDEX_SEQUENCE_485() _GMP_MAKE_INDEX_SEQUENCE_484(), 485
+#define _GMP_MAKE_INDEX_SEQUENCE_486() _GMP_MAKE_INDEX_SEQUENCE_485(), 486
+#define _GMP_MAKE_INDEX_SEQUENCE_487() _GMP_MAKE_INDEX_SEQUENCE_486(), 487
+#define _GMP_MAKE_INDEX_SEQUENCE_488() _GMP_MAKE_INDEX_SEQUENCE_487(), 488
+#define _GMP_MAKE_INDEX_SEQUENCE_489() _GMP_MAKE_INDEX_SEQUENCE_488(), 489
+#define _GMP_MAKE_INDEX_SEQUENCE_490() _GMP_MAKE_INDEX_SEQUENCE_489(), 490
+#define _GMP_MAKE_INDEX_SEQUENCE_491() _GMP_MAKE_INDEX_SEQUENCE_490(), 491
+#define _GMP_MAKE_INDEX_SEQUENCE_492() _GMP_MAKE_INDEX_SEQUENCE_491(), 492
+#define _GMP_MAKE_INDEX_SEQUENCE_493() _GMP_MAKE_INDEX_SEQUENCE_492(), 493
+#define _GMP_MAKE_INDEX_SEQUENCE_494() _GMP_MAKE_INDEX_SEQUENCE_493(), 494
+#define _GMP_MAKE_INDEX_SEQUENCE_495() _GMP_MAKE_INDEX_SEQUENCE_494(), 495
+#define _GMP_MAKE_INDEX_SEQUENCE_496() _GMP_MAKE_INDEX_SEQUENCE_495(), 496
+#define _GMP_MAKE_INDEX_SEQUENCE_497() _GMP_MAKE_INDEX_SEQUENCE_496(), 497
+#define _GMP_MAKE_INDEX_SEQUENCE_498() _GMP_MAKE_INDEX_SEQUENCE_497(), 498
+#define _GMP_MAKE_INDEX_SEQUENCE_499() _GMP_MAKE_INDEX_SEQUENCE_498(), 499
+#define _GMP_MAKE_INDEX_SEQUENCE_500() _GMP_MAKE_INDEX_SEQUENCE_499(), 500
+#define _GMP_MAKE_INDEX_SEQUENCE_501() _GMP_MAKE_INDEX_SEQUENCE_500(), 501
+#define _GMP_MAKE_INDEX_SEQUENCE_502() _GMP_MAKE_INDEX_SEQUENCE_501(), 502
+#define _GMP_MAKE_INDEX_SEQUENCE_503() _GMP_MAKE_INDEX_SEQUENCE_502(), 503
+#define _GMP_MAKE_INDEX_SEQUENCE_504() _GMP_MAKE_INDEX_SEQUENCE_503(), 504
+#define _GMP_MAKE_INDEX_SEQUENCE_505() _GMP_MAKE_INDEX_SEQUENCE_504(), 505
+#define _GMP_MAKE_INDEX_SEQUENCE_506() _GMP_MAKE_INDEX_SEQUENCE_505(), 506
+#define _GMP_MAKE_INDEX_SEQUENCE_507() _GMP_MAKE_INDEX_SEQUENCE_506(), 507
+#define _GMP_MAKE_INDEX_SEQUENCE_508() _GMP_MAKE_INDEX_SEQUENCE_507(), 508
+#define _GMP_MAKE_INDEX_SEQUENCE_509() _GMP_MAKE_INDEX_SEQUENCE_508(), 509
+#define _GMP_MAKE_INDEX_SEQUENCE_510() _GMP_MAKE_INDEX_SEQUENCE_509(), 510
+#define _GMP_MAKE_INDEX_SEQUENCE_511() _GMP_MAKE_INDEX_SEQUENCE_510(), 511
+#define _GMP_MAKE_INDEX_SEQUENCE_512() _GMP_MAKE_INDEX_SEQUENCE_511(), 512
+#define _GMP_MAKE_INDEX_SEQUENCE_513() _GMP_MAKE_INDEX_SEQUENCE_512(), 513
+#define _GMP_MAKE_INDEX_SEQUENCE_514() _GMP_MAKE_INDEX_SEQUENCE_513(), 514
+#define _GMP_MAKE_INDEX_SEQUENCE_515() _GMP_MAKE_INDEX_SEQUENCE_514(), 515
+#define _GMP_MAKE_INDEX_SEQUENCE_516() _GMP_MAKE_INDEX_SEQUENCE_515(), 516
+#define _GMP_MAKE_INDEX_SEQUENCE_517() _GMP_MAKE_INDEX_SEQUENCE_516(), 517
+#define _GMP_MAKE_INDEX_SEQUENCE_518() _GMP_MAKE_INDEX_SEQUENCE_517(), 518
+#define _GMP_MAKE_INDEX_SEQUENCE_519() _GMP_MAKE_INDEX_SEQUENCE_518(), 519
+#define _GMP_MAKE_INDEX_SEQUENCE_520() _GMP_MAKE_INDEX_SEQUENCE_519(), 520
+#define _GMP_MAKE_INDEX_SEQUENCE_521() _GMP_MAKE_INDEX_SEQUENCE_520(), 521
+#define _GMP_MAKE_INDEX_SEQUENCE_522() _GMP_MAKE_INDEX_SEQUENCE_521(), 522
+#define _GMP_MAKE_INDEX_SEQUENCE_523() _GMP_MAKE_INDEX_SEQUENCE_522(), 523
+#define _GMP_MAKE_INDEX_SEQUENCE_524() _GMP_MAKE_INDEX_SEQUENCE_523(), 524
+#define _GMP_MAKE_INDEX_SEQUENCE_525() _GMP_MAKE_INDEX_SEQUENCE_524(), 525
+#define _GMP_MAKE_INDEX_SEQUENCE_526() _GMP_MAKE_INDEX_SEQUENCE_525(), 526
+#define _GMP_MAKE_INDEX_SEQUENCE_527() _GMP_MAKE_INDEX_SEQUENCE_526(), 527
+#define _GMP_MAKE_INDEX_SEQUENCE_528() _GMP_MAKE_INDEX_SEQUENCE_527(), 528
+#define _GMP_MAKE_INDEX_SEQUENCE_529() _GMP_MAKE_INDEX_SEQUENCE_528(), 529
+#define _GMP_MAKE_INDEX_SEQUENCE_530() _GMP_MAKE_INDEX_SEQUENCE_529(), 530
+#define _GMP_MAKE_INDEX_SEQUENCE_531() _GMP_MAKE_INDEX_SEQUENCE_530(), 531
+#define _GMP_MAKE_INDEX_SEQUENCE_532() _GMP_MAKE_INDEX_SEQUENCE_531(), 532
+#define _GMP_MAKE_INDEX_SEQUENCE_533() _GMP_MAKE_INDEX_SEQUENCE_532(), 533
+#define _GMP_MAKE_INDEX_SEQUENCE_534() _GMP_MAKE_INDEX_SEQUENCE_533(), 534
+#define _GMP_MAKE_INDEX_SEQUENCE_535() _GMP_MAKE_INDEX_SEQUENCE_534(), 535
+#define _GMP_MAKE_INDEX_SEQUENCE_536() _GMP_MAKE_INDEX_SEQUENCE_535(), 536
+#define _GMP_MAKE_INDEX_SEQUENCE_537() _GMP_MAKE_INDEX_SEQUENCE_536(), 537
+#define _GMP_MAKE_INDEX_SEQUENCE_538() _GMP_MAKE_INDEX_SEQUENCE_537(), 538
+#define _GMP_MAKE_INDEX_SEQUENCE_539() _GMP_MAKE_INDEX_SEQUENCE_538(), 539
+#define _GMP_MAKE_INDEX_SEQUENCE_540() _GMP_MAKE_INDEX_SEQUENCE_539(), 540
+#define _GMP_MAKE_INDEX_SEQUENCE_541() _GMP_MAKE_INDEX_SEQUENCE_540(), 541
+#define _GMP_MAKE_INDEX_SEQUENCE_542() _GMP_MAKE_INDEX_SEQUENCE_541(), 542
+#define _GMP_MAKE_INDEX_SEQUENCE_543() _GMP_MAKE_INDEX_SEQUENCE_542(), 543
+#define _GMP_MAKE_INDEX_SEQUENCE_544() _GMP_MAKE_INDEX_SEQUENCE_543(), 544
+#define _GMP_MAKE_INDEX_SEQUENCE_545() _GMP_MAKE_INDEX_SEQUENCE_544(), 545
+#define _GMP_MAKE_INDEX_SEQUENCE_546() _GMP_MAKE_INDEX_SEQUENCE_545(), 546
+#define _GMP_MAKE_INDEX_SEQUENCE_547() _GMP_MAKE_INDEX_SEQUENCE_546(), 547
+#define _GMP_MAKE_INDEX_SEQUENCE_548() _GMP_MAKE_INDEX_SEQUENCE_547(), 548
+#define _GMP_MAKE_INDEX_SEQUENCE_549() _GMP_MAKE_INDEX_SEQUENCE_548(), 549
+#define _GMP_MAKE_INDEX_SEQUENCE_550() _GMP_MAKE_INDEX_SEQUENCE_549(), 550
+#define _GMP_MAKE_INDEX_SEQUENCE_551() _GMP_MAKE_INDEX_SEQUENCE_550(), 551
+#define _GMP_MAKE_INDEX_SEQUENCE_552() _GMP_MAKE_INDEX_SEQUENCE_551(), 552
+#define _GMP_MAKE_INDEX_SEQUENCE_553() _GMP_MAKE_INDEX_SEQUENCE_552(), 553
+#define _GMP_MAKE_INDEX_SEQUENCE_554() _GMP_MAKE_INDEX_SEQUENCE_553(), 554
+#define _GMP_MAKE_INDEX_SEQUENCE_555() _GMP_MAKE_INDEX_SEQUENCE_554(), 555
+#define _GMP_MAKE_INDEX_SEQUENCE_556() _GMP_MAKE_INDEX_SEQUENCE_555(), 556
+#define _GMP_MAKE_INDEX_SEQUENCE_557() _GMP_MAKE_INDEX_SEQUENCE_556(), 557
+#define _GMP_MAKE_INDEX_SEQUENCE_558() _GMP_MAKE_INDEX_SEQUENCE_557(), 558
+#define _GMP_MAKE_INDEX_SEQUENCE_559() _GMP_MAKE_INDEX_SEQUENCE_558(), 559
+#define _GMP_MAKE_INDEX_SEQUENCE_560() _GMP_MAKE_INDEX_SEQUENCE_559(), 560
+#define _GMP_MAKE_INDEX_SEQUENCE_561() _GMP_MAKE_INDEX_SEQUENCE_560(), 561
+#define _GMP_MAKE_INDEX_SEQUENCE_562() _GMP_MAKE_INDEX_SEQUENCE_561(), 562
+#define _GMP_MAKE_INDEX_SEQUENCE_563() _GMP_MAKE_INDEX_SEQUENCE_562(), 563
+#define _GMP_MAKE_INDEX_SEQUENCE_564() _GMP_MAKE_INDEX_SEQUENCE_563(), 564
+#define _GMP_MAKE_INDEX_SEQUENCE_565() _GMP_MAKE_INDEX_SEQUENCE_564(), 565
+#define _GMP_MAKE_INDEX_SEQUENCE_566() _GMP_MAKE_INDEX_SEQUENCE_565(), 566
+#define _GMP_MAKE_INDEX_SEQUENCE_567() _GMP_MAKE_INDEX_SEQUENCE_566(), 567
+#define _GMP_MAKE_INDEX_SEQUENCE_568() _GMP_MAKE_INDEX_SEQUENCE_567(), 568
+#define _GMP_MAKE_INDEX_SEQUENCE_569() _GMP_MAKE_INDEX_SEQUENCE_568(), 569
+#define _GMP_MAKE_INDEX_SEQUENCE_570() _GMP_MAKE_INDEX_SEQUENCE_569(), 570
+#define _GMP_MAKE_INDEX_SEQUENCE_571() _GMP_MAKE_INDEX_SEQUENCE_570(), 571
+#define _GMP_MAKE_INDEX_SEQUENCE_572() _GMP_MAKE_INDEX_SEQUENCE_571(), 572
+#define _GMP_MAKE_INDEX_SEQUENCE_573() _GMP_MAKE_INDEX_SEQUENCE_572(), 573
+#define _GMP_MAKE_INDEX_SEQUENCE_574() _GMP_MAKE_INDEX_SEQUENCE_573(), 574
+#define _GMP_MAKE_INDEX_SEQUENCE_575() _GMP_MAKE_INDEX_SEQUENCE_574(), 575
+#define _GMP_MAKE_INDEX_SEQUENCE_576() _GMP_MAKE_INDEX_SEQUENCE_575(), 576
+#define _GMP_MAKE_INDEX_SEQUENCE_577() _GMP_MAKE_INDEX_SEQUENCE_576(), 577
+#define _GMP_MAKE_INDEX_SEQUENCE_578() _GMP_MAKE_INDEX_SEQUENCE_577(), 578
+#define _GMP_MAKE_INDEX_SEQUENCE_579() _GMP_MAKE_INDEX_SEQUENCE_578(), 579
+#define _GMP_MAKE_INDEX_SEQUENCE_580() _GMP_MAKE_INDEX_SEQUENCE_579(), 580
+#define _GMP_MAKE_INDEX_SEQUENCE_581() _GMP_MAKE_INDEX_SEQUENCE_580(), 581
+#define _GMP_MAKE_INDEX_SEQUENCE_582() _GMP_MAKE_INDEX_SEQUENCE_581(), 582
+#define _GMP_MAKE_INDEX_SEQUENCE_583() _GMP_MAKE_INDEX_SEQUENCE_582(), 583
+#define _GMP_MAKE_INDEX_SEQUENCE_584() _GMP_MAKE_INDEX_SEQUENCE_583(), 584
+#define _GMP_MAKE_INDEX_SEQUENCE_585() _GMP_MAKE_INDEX_SEQUENCE_584(), 585
+#define _GMP_MAKE_INDEX_SEQUENCE_586() _GMP_MAKE_INDEX_SEQUENCE_585(), 586
+#define _GMP_MAKE_INDEX_SEQUENCE_587() _GMP_MAKE_INDEX_SEQUENCE_586(), 587
+#define _GMP_MAKE_INDEX_SEQUENCE_588() _GMP_MAKE_INDEX_SEQUENCE_587(), 588
+#define _GMP_MAKE_INDEX_SEQUENCE_589() _GMP_MAKE_INDEX_SEQUENCE_588(), 589
+#define _GMP_MAKE_INDEX_SEQUENCE_590() _GMP_MAKE_INDEX_SEQUENCE_589(), 590
+#define _GMP_MAKE_INDEX_SEQUENCE_591() _GMP_MAKE_INDEX_SEQUENCE_590(), 591
+#define _GMP_MAKE_INDEX_SEQUENCE_592() _GMP_MAKE_INDEX_SEQUENCE_591(), 592
+#define _GMP_MAKE_INDEX_SEQUENCE_593() _GMP_MAKE_INDEX_SEQUENCE_592(), 593
+#define _GMP_MAKE_INDEX_SEQUENCE_594() _GMP_MAKE_INDEX_SEQUENCE_593(), 594
+#define _GMP_MAKE_INDEX_SEQUENCE_595() _GMP_MAKE_INDEX_SEQUENCE_594(), 595
+#define _GMP_MAKE_INDEX_SEQUENCE_596() _GMP_MAKE_INDEX_SEQUENCE_595(), 596
+#define _GMP_MAKE_INDEX_SEQUENCE_597() _GMP_MAKE_INDEX_SEQUENCE_596(), 597
+#define _GMP_MAKE_INDEX_SEQUENCE_598() _GMP_MAKE_INDEX_SEQUENCE_597(), 598
+#define _GMP_MAKE_INDEX_SEQUENCE_599() _GMP_MAKE_INDEX_SEQUENCE_598(), 599
+#define _GMP_MAKE_INDEX_SEQUENCE_600() _GMP_MAKE_INDEX_SEQUENCE_599(), 600
+#define _GMP_MAKE_INDEX_SEQUENCE_601() _GMP_MAKE_INDEX_SEQUENCE_600(), 601
+#define _GMP_MAKE_INDEX_SEQUENCE_602() _GMP_MAKE_INDEX_SEQUENCE_601(), 602
+#define _GMP_MAKE_INDEX_SEQUENCE_603() _GMP_MAKE_INDEX_SEQUENCE_602(), 603
+#define _GMP_MAKE_INDEX_SEQUENCE_604() _GMP_MAKE_INDEX_SEQUENCE_603(), 604
+#define _GMP_MAKE_INDEX_SEQUENCE_605() _GMP_MAKE_INDEX_SEQUENCE_604(), 605
+#define _GMP_MAKE_INDEX_SEQUENCE_606() _GMP_MAKE_INDEX_SEQUENCE_605(), 606
+#define _GMP_MAKE_INDEX_SEQUENCE_607() _GMP_MAKE_INDEX_SEQUENCE_606(), 607
+#define _GMP_MAKE_INDEX_SEQUENCE_608() _GMP_MAKE_INDEX_SEQUENCE_607(), 608
+#define _GMP_MAKE_INDEX_SEQUENCE_609() _GMP_MAKE_INDEX_SEQUENCE_608(), 609
+#define _GMP_MAKE_INDEX_SEQUENCE_610() _GMP_MAKE_INDEX_SEQUENCE_609(), 610
+#define _GMP_MAKE_INDEX_SEQUENCE_611() _GMP_MAKE_INDEX_SEQUENCE_610(), 611
+#define _GMP_MAKE_INDEX_SEQUENCE_612() _GMP_MAKE_INDEX_SEQUENCE_611(), 612
+#define _GMP_MAKE_INDEX_SEQUENCE_613() _GMP_MAKE_INDEX_SEQUENCE_612(), 613
+#define _GMP_MAKE_INDEX_SEQUENCE_614() _GMP_MAKE_INDEX_SEQUENCE_613(), 614
+#define _GMP_MAKE_INDEX_SEQUENCE_615() _GMP_MAKE_INDEX_SEQUENCE_614(), 615
+#define _GMP_MAKE_INDEX_SEQUENCE_616() _GMP_MAKE_INDEX_SEQUENCE_615(), 616
+#define _GMP_MAKE_INDEX_SEQUENCE_617() _GMP_MAKE_INDEX_SEQUENCE_616(), 617
+#define _GMP_MAKE_INDEX_SEQUENCE_618() _GMP_MAKE_INDEX_SEQUENCE_617(), 618
+#define _GMP_MAKE_INDEX_SEQUENCE_619() _GMP_MAKE_INDEX_SEQUENCE_618(), 619
+#define _GMP_MAKE_INDEX_SEQUENCE_620() _GMP_MAKE_INDEX_SEQUENCE_619(), 620
+#define _GMP_MAKE_INDEX_SEQUENCE_621() _GMP_MAKE_INDEX_SEQUENCE_620(), 621
+#define _GMP_MAKE_INDEX_SEQUENCE_622() _GMP_MAKE_INDEX_SEQUENCE_621(), 622
+#define _GMP_MAKE_INDEX_SEQUENCE_623() _GMP_MAKE_INDEX_SEQUENCE_622(), 623
+#define _GMP_MAKE_INDEX_SEQUENCE_624() _GMP_MAKE_INDEX_SEQUENCE_623(), 624
+#define _GMP_MAKE_INDEX_SEQUENCE_625() _GMP_MAKE_INDEX_SEQUENCE_624(), 625
+#define _GMP_MAKE_INDEX_SEQUENCE_626() _GMP_MAKE_INDEX_SEQUENCE_625(), 626
+#define _GMP_MAKE_INDEX_SEQUENCE_627() _GMP_MAKE_INDEX_SEQUENCE_626(), 627
+#define _GMP_MAKE_INDEX_SEQUENCE_628() _GMP_MAKE_INDEX_SEQUENCE_627(), 628
+#define _GMP_MAKE_INDEX_SEQUENCE_629() _GMP_MAKE_INDEX_SEQUENCE_628(), 629
+#define _GMP_MAKE_INDEX_SEQUENCE_630() _GMP_MAKE_INDEX_SEQUENCE_629(), 630
+#define _GMP_MAKE_INDEX_SEQUENCE_631() _GMP_MAKE_INDEX_SEQUENCE_630(), 631
+#define _GMP_MAKE_INDEX_SEQUENCE_632() _GMP_MAKE_INDEX_SEQUENCE_631(), 632
+#define _GMP_MAKE_INDEX_SEQUENCE_633() _GMP_MAKE_INDEX_SEQUENCE_632(), 633
+#define _GMP_MAKE_INDEX_SEQUENCE_634() _GMP_MAKE_INDEX_SEQUENCE_633(), 634
+#define _GMP_MAKE_INDEX_SEQUENCE_635() _GMP_MAKE_INDEX_SEQUENCE_634(), 635
+#define _GMP_MAKE_INDEX_SEQUENCE_636() _GMP_MAKE_INDEX_SEQUENCE_635(), 636
+#define _GMP_MAKE_INDEX_SEQUENCE_637() _GMP_MAKE_INDEX_SEQUENCE_636(), 637
+#define _GMP_MAKE_INDEX_SEQUENCE_638() _GMP_MAKE_INDEX_SEQUENCE_637(), 638
+#define _GMP_MAKE_INDEX_SEQUENCE_639() _GMP_MAKE_INDEX_SEQUENCE_638(), 639
+#define _GMP_MAKE_INDEX_SEQUENCE_640() _GMP_MAKE_INDEX_SEQUENCE_639(), 640
+#define _GMP_MAKE_INDEX_SEQUENCE_641() _GMP_MAKE_INDEX_SEQUENCE_640(), 641
+#define _GMP_MAKE_INDEX_SEQUENCE_642() _GMP_MAKE_INDEX_SEQUENCE_641(), 642
+#define _GMP_MAKE_INDEX_SEQUENCE_643() _GMP_MAKE_INDEX_SEQUENCE_642(), 643
+#define _GMP_MAKE_INDEX_SEQUENCE_644() _GMP_MAKE_INDEX_SEQUENCE_643(), 644
+#define _GMP_MAKE_INDEX_SEQUENCE_645() _GMP_MAKE_INDEX_SEQUENCE_644(), 645
+#define _GMP_MAKE_INDEX_SEQUENCE_646() _GMP_MAKE_INDEX_SEQUENCE_645(), 646
+#define _GMP_MAKE_INDEX_SEQUENCE_647() _GMP_MAKE_INDEX_SEQUENCE_646(), 647
+#define _GMP_MAKE_INDEX_SEQUENCE_648() _GMP_MAKE_INDEX_SEQUENCE_647(), 648
+#define _GMP_MAKE_INDEX_SEQUENCE_649() _GMP_MAKE_INDEX_SEQUENCE_648(), 649
+#define _GMP_MAKE_INDEX_SEQUENCE_650() _GMP_MAKE_INDEX_SEQUENCE_649(), 650
+#define _GMP_MAKE_INDEX_SEQUENCE_651() _GMP_MAKE_INDEX_SEQUENCE_650(), 651
+#define _GMP_MAKE_INDEX_SEQUENCE_652() _GMP_MAKE_INDEX_SEQUENCE_651(), 652
+#define _GMP_MAKE_INDEX_SEQUENCE_653() _GMP_MAKE_INDEX_SEQUENCE_652(), 653
+#define _GMP_MAKE_INDEX_SEQUENCE_654() _GMP_MAKE_INDEX_SEQUENCE_653(), 654
+#define _GMP_MAKE_INDEX_SEQUENCE_655() _GMP_MAKE_INDEX_SEQUENCE_654(), 655
+#define _GMP_MAKE_INDEX_SEQUENCE_656() _GMP_MAKE_INDEX_SEQUENCE_655(), 656
+#define _GMP_MAKE_INDEX_SEQUENCE_657() _GMP_MAKE_INDEX_SEQUENCE_656(), 657
+#define _GMP_MAKE_INDEX_SEQUENCE_658() _GMP_MAKE_INDEX_SEQUENCE_657(), 658
+#define _GMP_MAKE_INDEX_SEQUENCE_659() _GMP_MAKE_INDEX_SEQUENCE_658(), 659
+#define _GMP_MAKE_INDEX_SEQUENCE_660() _GMP_MAKE_INDEX_SEQUENCE_659(), 660
+#define _GMP_MAKE_INDEX_SEQUENCE_661() _GMP_MAKE_INDEX_SEQUENCE_660(), 661
+#define _GMP_MAKE_INDEX_SEQUENCE_662() _GMP_MAKE_INDEX_SEQUENCE_661(), 662
+#define _GMP_MAKE_INDEX_SEQUENCE_663() _GMP_MAKE_INDEX_SEQUENCE_662(), 663
+#define _GMP_MAKE_INDEX_SEQUENCE_664() _GMP_MAKE_INDEX_SEQUENCE_663(), 664
+#define _GMP_MAKE_INDEX_SEQUENCE_665() _GMP_MAKE_INDEX_SEQUENCE_664(), 665
+#define _GMP_MAKE_INDEX_SEQUENCE_666() _GMP_MAKE_INDEX_SEQUENCE_665(), 666
+#define _GMP_MAKE_INDEX_SEQUENCE_667() _GMP_MAKE_INDEX_SEQUENCE_666(), 667
+#define _GMP_MAKE_INDEX_SEQUENCE_668() _GMP_MAKE_INDEX_SEQUENCE_667(), 668
+#define _GMP_MAKE_INDEX_SEQUENCE_669() _GMP_MAKE_INDEX_SEQUENCE_668(), 669
+#define _GMP_MAKE_INDEX_SEQUENCE_670() _GMP_MAKE_INDEX_SEQUENCE_669(), 670
+#define _GMP_MAKE_INDEX_SEQUENCE_671() _GMP_MAKE_INDEX_SEQUENCE_670(), 671
+#define _GMP_MAKE_INDEX_SEQUENCE_672() _GMP_MAKE_INDEX_SEQUENCE_671(), 672
+#define _GMP_MAKE_INDEX_SEQUENCE_673() _GMP_MAKE_INDEX_SEQUENCE_672(), 673
+#define _GMP_MAKE_INDEX_SEQUENCE_674() _GMP_MAKE_INDEX_SEQUENCE_673(), 674
+#define _GMP_MAKE_INDEX_SEQUENCE_675() _GMP_MAKE_INDEX_SEQUENCE_674(), 675
+#define _GMP_MAKE_INDEX_SEQUENCE_676() _GMP_MAKE_INDEX_SEQUENCE_675(), 676
+#define _GMP_MAKE_INDEX_SEQUENCE_677() _GMP_MAKE_INDEX_SEQUENCE_676(), 677
+#define _GMP_MAKE_INDEX_SEQUENCE_678() _GMP_MAKE_INDEX_SEQUENCE_677(), 678
+#define _GMP_MAKE_INDEX_SEQUENCE_679() _GMP_MAKE_INDEX_SEQUENCE_678(), 679
+#define _GMP_MAKE_INDEX_SEQUENCE_680() _GMP_MAKE_INDEX_SEQUENCE_679(), 680
+#define _GMP_MAKE_INDEX_SEQUENCE_681() _GMP_MAKE_INDEX_SEQUENCE_680(), 681
+#define _GMP_MAKE_INDEX_SEQUENCE_682() _GMP_MAKE_INDEX_SEQUENCE_681(), 682
+#define _GMP_MAKE_INDEX_SEQUENCE_683() _GMP_MAKE_INDEX_SEQUENCE_682(), 683
+#define _GMP_MAKE_INDEX_SEQUENCE_684() _GMP_MAKE_INDEX_SEQUENCE_683(), 684
+#define _GMP_MAKE_INDEX_SEQUENCE_685() _GMP_MAKE_INDEX_SEQUENCE_684(), 685
+#define _GMP_MAKE_INDEX_SEQUENCE_686() _GMP_MAKE_INDEX_SEQUENCE_685(), 686
+#define _GMP_MAKE_INDEX_SEQUENCE_687() _GMP_MAKE_INDEX_SEQUENCE_686(), 687
+#define _GMP_MAKE_INDEX_SEQUENCE_688() _GMP_MAKE_INDEX_SEQUENCE_687(), 688
+#define _GMP_MAKE_INDEX_SEQUENCE_689() _GMP_MAKE_INDEX_SEQUENCE_688(), 689
+#define _GMP_MAKE_INDEX_SEQUENCE_690() _GMP_MAKE_INDEX_SEQUENCE_689(), 690
+#define _GMP_MAKE_INDEX_SEQUENCE_691() _GMP_MAKE_INDEX_SEQUENCE_690(), 691
+#define _GMP_MAKE_INDEX_SEQUENCE_692() _GMP_MAKE_INDEX_SEQUENCE_691(), 692
+#define _GMP_MAKE_INDEX_SEQUENCE_693() _GMP_MAKE_INDEX_SEQUENCE_692(), 693
+#define _GMP_MAKE_INDEX_SEQUENCE_694() _GMP_MAKE_INDEX_SEQUENCE_693(), 694
+#define _GMP_MAKE_INDEX_SEQUENCE_695() _GMP_MAKE_INDEX_SEQUENCE_694(), 695
+#define _GMP_MAKE_INDEX_SEQUENCE_696() _GMP_MAKE_INDEX_SEQUENCE_695(), 696
+#define _GMP_MAKE_INDEX_SEQUENCE_697() _GMP_MAKE_INDEX_SEQUENCE_696(), 697
+#define _GMP_MAKE_INDEX_SEQUENCE_698() _GMP_MAKE_INDEX_SEQUENCE_697(), 698
+#define _GMP_MAKE_INDEX_SEQUENCE_699() _GMP_MAKE_INDEX_SEQUENCE_698(), 699
+#define _GMP_MAKE_INDEX_SEQUENCE_700() _GMP_MAKE_INDEX_SEQUENCE_699(), 700
+#define _GMP_MAKE_INDEX_SEQUENCE_701() _GMP_MAKE_INDEX_SEQUENCE_700(), 701
+#define _GMP_MAKE_INDEX_SEQUENCE_702() _GMP_MAKE_INDEX_SEQUENCE_701(), 702
+#define _GMP_MAKE_INDEX_SEQUENCE_703() _GMP_MAKE_INDEX_SEQUENCE_702(), 703
+#define _GMP_MAKE_INDEX_SEQUENCE_704() _GMP_MAKE_INDEX_SEQUENCE_703(), 704
+#define _GMP_MAKE_INDEX_SEQUENCE_705() _GMP_MAKE_INDEX_SEQUENCE_704(), 705
+#define _GMP_MAKE_INDEX_SEQUENCE_706() _GMP_MAKE_INDEX_SEQUENCE_705(), 706
+#define _GMP_MAKE_INDEX_SEQUENCE_707() _GMP_MAKE_INDEX_SEQUENCE_706(), 707
+#define _GMP_MAKE_INDEX_SEQUENCE_708() _GMP_MAKE_INDEX_SEQUENCE_707(), 708
+#define _GMP_MAKE_INDEX_SEQUENCE_709() _GMP_MAKE_INDEX_SEQUENCE_708(), 709
+#define _GMP_MAKE_INDEX_SEQUENCE_710() _GMP_MAKE_INDEX_SEQUENCE_709(), 710
+#define _GMP_MAKE_INDEX_SEQUENCE_711() _GMP_MAKE_INDEX_SEQUENCE_710(), 711
+#define _GMP_MAKE_INDEX_SEQUENCE_712() _GMP_MAKE_INDEX_SEQUENCE_711(), 712
+#define _GMP_MAKE_INDEX_SEQUENCE_713() _GMP_MAKE_INDEX_SEQUENCE_712(), 713
+#define _GMP_MAKE_INDEX_SEQUENCE_714() _GMP_MAKE_INDEX_SEQUENCE_713(), 714
+#define _GMP_MAKE_INDEX_SEQUENCE_715() _GMP_MAKE_INDEX_SEQUENCE_714(), 715
+#define _GMP_MAKE_INDEX_SEQUENCE_716() _GMP_MAKE_INDEX_SEQUENCE_715(), 716
+#define _GMP_MAKE_INDEX_SEQUENCE_717() _GMP_MAKE_INDEX_SEQUENCE_716(), 717
+#define _GMP_MAKE_INDEX_SEQUENCE_718() _GMP_MAKE_INDEX_SEQUENCE_717(), 718
+#define _GMP_MAKE_INDEX_SEQUENCE_719() _GMP_MAKE_INDEX_SEQUENCE_718(), 719
+#define _GMP_MAKE_INDEX_SEQUENCE_720() _GMP_MAKE_INDEX_SEQUENCE_719(), 720
+#define _GMP_MAKE_INDEX_SEQUENCE_721() _GMP_MAKE_INDEX_SEQUENCE_720(), 721
+#define _GMP_MAKE_INDEX_SEQUENCE_722() _GMP_MAKE_INDEX_SEQUENCE_721(), 722
+#define _GMP_MAKE_INDEX_SEQUENCE_723() _GMP_MAKE_INDEX_SEQUENCE_722(), 723
+#define _GMP_MAKE_INDEX_SEQUENCE_724() _GMP_MAKE_INDEX_SEQUENCE_723(), 724
+#define _GMP_MAKE_INDEX_SEQUENCE_725() _GMP_MAKE_INDEX_SEQUENCE_724(), 725
+#define _GMP_MAKE_INDEX_SEQUENCE_726() _GMP_MAKE_INDEX_SEQUENCE_725(), 726
+#define _GMP_MAKE_INDEX_SEQUENCE_727() _GMP_MAKE_INDEX_SEQUENCE_726(), 727
+#define _GMP_MAKE_INDEX_SEQUENCE_728() _GMP_MAKE_INDEX_SEQUENCE_727(), 728
+#define _GMP_MAKE_INDEX_SEQUENCE_729() _GMP_MAKE_INDEX_SEQUENCE_728(), 729
+#define _GMP_MAKE_INDEX_SEQUENCE_730() _GMP_MAKE_INDEX_SEQUENCE_729(), 730
+#define _GMP_MAKE_INDEX_SEQUENCE_731() _GMP_MAKE_INDEX_SEQUENCE_730(), 731
+#define _GMP_MAKE_INDEX_SEQUENCE_732() _GMP_MAKE_INDEX_SEQUENCE_731(), 732
+#define _GMP_MAKE_INDEX_SEQUENCE_733() _GMP_MAKE_INDEX_SEQUENCE_732(), 733
+#define _GMP_MAKE_INDEX_SEQUENCE_734() _GMP_MAKE_INDEX_SEQUENCE_733(), 734
+#define _GMP_MAKE_INDEX_SEQUENCE_735() _GMP_MAKE_INDEX_SEQUENCE_734(), 735
+#define _GMP_MAKE_INDEX_SEQUENCE_736() _GMP_MAKE_INDEX_SEQUENCE_735(), 736
+#define _GMP_MAKE_INDEX_SEQUENCE_737() _GMP_MAKE_INDEX_SEQUENCE_736(), 737
+#define _GMP_MAKE_INDEX_SEQUENCE_738() _GMP_MAKE_INDEX_SEQUENCE_737(), 738
+#define _GMP_MAKE_INDEX_SEQUENCE_739() _GMP_MAKE_INDEX_SEQUENCE_738(), 739
+#define _GMP_MAKE_INDEX_SEQUENCE_740() _GMP_MAKE_INDEX_SEQUENCE_739(), 740
+#define _GMP_MAKE_INDEX_SEQUENCE_741() _GMP_MAKE_INDEX_SEQUENCE_740(), 741
+#define _GMP_MAKE_INDEX_SEQUENCE_742() _GMP_MAKE_INDEX_SEQUENCE_741(), 742
+#define _GMP_MAKE_INDEX_SEQUENCE_743() _GMP_MAKE_INDEX_SEQUENCE_742(), 743
+#define _GMP_MAKE_INDEX_SEQUENCE_744() _GMP_MAKE_INDEX_SEQUENCE_743(), 744
+#define _GMP_MAKE_INDEX_SEQUENCE_745() _GMP_MAKE_INDEX_SEQUENCE_744(), 745
+#define _GMP_MAKE_INDEX_SEQUENCE_746() _GMP_MAKE_INDEX_SEQUENCE_745(), 746
+#define _GMP_MAKE_INDEX_SEQUENCE_747() _GMP_MAKE_INDEX_SEQUENCE_746(), 747
+#define _GMP_MAKE_INDEX_SEQUENCE_748() _GMP_MAKE_INDEX_SEQUENCE_747(), 748
+#define _GMP_MAKE_INDEX_SEQUENCE_749() _GMP_MAKE_INDEX_SEQUENCE_748(), 749
+#define _GMP_MAKE_INDEX_SEQUENCE_750() _GMP_MAKE_INDEX_SEQUENCE_749(), 750
+#define _GMP_MAKE_INDEX_SEQUENCE_751() _GMP_MAKE_INDEX_SEQUENCE_750(), 751
+#define _GMP_MAKE_INDEX_SEQUENCE_752() _GMP_MAKE_INDEX_SEQUENCE_751(), 752
+#define _GMP_MAKE_INDEX_SEQUENCE_753() _GMP_MAKE_INDEX_SEQUENCE_752(), 753
+#define _GMP_MAKE_INDEX_SEQUENCE_754() _GMP_MAKE_INDEX_SEQUENCE_753(), 754
+#define _GMP_MAKE_INDEX_SEQUENCE_755() _GMP_MAKE_INDEX_SEQUENCE_754(), 755
+#define _GMP_MAKE_INDEX_SEQUENCE_756() _GMP_MAKE_INDEX_SEQUENCE_755(), 756
+#define _GMP_MAKE_INDEX_SEQUENCE_757() _GMP_MAKE_INDEX_SEQUENCE_756(), 757
+#define _GMP_MAKE_INDEX_SEQUENCE_758() _GMP_MAKE_INDEX_SEQUENCE_757(), 758
+#define _GMP_MAKE_INDEX_SEQUENCE_759() _GMP_MAKE_INDEX_SEQUENCE_758(), 759
+#define _GMP_MAKE_INDEX_SEQUENCE_760() _GMP_MAKE_INDEX_SEQUENCE_759(), 760
+#define _GMP_MAKE_INDEX_SEQUENCE_761() _GMP_MAKE_INDEX_SEQUENCE_760(), 761
+#define _GMP_MAKE_INDEX_SEQUENCE_762() _GMP_MAKE_INDEX_SEQUENCE_761(), 762
+#define _GMP_MAKE_INDEX_SEQUENCE_763() _GMP_MAKE_INDEX_SEQUENCE_762(), 763
+#define _GMP_MAKE_INDEX_SEQUENCE_764() _GMP_MAKE_INDEX_SEQUENCE_763(), 764
+#define _GMP_MAKE_INDEX_SEQUENCE_765() _GMP_MAKE_INDEX_SEQUENCE_764(), 765
+#define _GMP_MAKE_INDEX_SEQUENCE_766() _GMP_MAKE_INDEX_SEQUENCE_765(), 766
+#define _GMP_MAKE_INDEX_SEQUENCE_767() _GMP_MAKE_INDEX_SEQUENCE_766(), 767
+#define _GMP_MAKE_INDEX_SEQUENCE_768() _GMP_MAKE_INDEX_SEQUENCE_767(), 768
+#define _GMP_MAKE_INDEX_SEQUENCE_769() _GMP_MAKE_INDEX_SEQUENCE_768(), 769
+#define _GMP_MAKE_INDEX_SEQUENCE_770() _GMP_MAKE_INDEX_SEQUENCE_769(), 770
+#define _GMP_MAKE_INDEX_SEQUENCE_771() _GMP_MAKE_INDEX_SEQUENCE_770(), 771
+#define _GMP_MAKE_INDEX_SEQUENCE_772() _GMP_MAKE_INDEX_SEQUENCE_771(), 772
+#define _GMP_MAKE_INDEX_SEQUENCE_773() _GMP_MAKE_INDEX_SEQUENCE_772(), 773
+#define _GMP_MAKE_INDEX_SEQUENCE_774() _GMP_MAKE_INDEX_SEQUENCE_773(), 774
+#define _GMP_MAKE_INDEX_SEQUENCE_775() _GMP_MAKE_INDEX_SEQUENCE_774(), 775
+#define _GMP_MAKE_INDEX_SEQUENCE_776() _GMP_MAKE_INDEX_SEQUENCE_775(), 776
+#define _GMP_MAKE_INDEX_SEQUENCE_777() _GMP_MAKE_INDEX_SEQUENCE_776(), 777
+#define _GMP_MAKE_INDEX_SEQUENCE_778() _GMP_MAKE_INDEX_SEQUENCE_777(), 778
+#define _GMP_MAKE_INDEX_SEQUENCE_779() _GMP_MAKE_INDEX_SEQUENCE_778(), 779
+#define _GMP_MAKE_INDEX_SEQUENCE_780() _GMP_MAKE_INDEX_SEQUENCE_779(), 780
+#define _GMP_MAKE_INDEX_SEQUENCE_781() _GMP_MAKE_INDEX_SEQUENCE_780(), 781
+#define _GMP_MAKE_INDEX_SEQUENCE_782() _GMP_MAKE_INDEX_SEQUENCE_781(), 782
+#define _GMP_MAKE_INDEX_SEQUENCE_783() _GMP_MAKE_INDEX_SEQUENCE_782(), 783
+#define _GMP_MAKE_INDEX_SEQUENCE_784() _GMP_MAKE_INDEX_SEQUENCE_783(), 784
+#define _GMP_MAKE_INDEX_SEQUENCE_785() _GMP_MAKE_INDEX_SEQUENCE_784(), 785
+#define _GMP_MAKE_INDEX_SEQUENCE_786() _GMP_MAKE_INDEX_SEQUENCE_785(), 786
+#define _GMP_MAKE_INDEX_SEQUENCE_787() _GMP_MAKE_INDEX_SEQUENCE_786(), 787
+#define _GMP_MAKE_INDEX_SEQUENCE_788() _GMP_MAKE_INDEX_SEQUENCE_787(), 788
+#define _GMP_MAKE_INDEX_SEQUENCE_789() _GMP_MAKE_INDEX_SEQUENCE_788(), 789
+#define _GMP_MAKE_INDEX_SEQUENCE_790() _GMP_MAKE_INDEX_SEQUENCE_789(), 790
+#define _GMP_MAKE_INDEX_SEQUENCE_791() _GMP_MAKE_INDEX_SEQUENCE_790(), 791
+#define _GMP_MAKE_INDEX_SEQUENCE_792() _GMP_MAKE_INDEX_SEQUENCE_791(), 792
+#define _GMP_MAKE_INDEX_SEQUENCE_793() _GMP_MAKE_INDEX_SEQUENCE_792(), 793
+#define _GMP_MAKE_INDEX_SEQUENCE_794() _GMP_MAKE_INDEX_SEQUENCE_793(), 794
+#define _GMP_MAKE_INDEX_SEQUENCE_795() _GMP_MAKE_INDEX_SEQUENCE_794(), 795
+#define _GMP_MAKE_INDEX_SEQUENCE_796() _GMP_MAKE_INDEX_SEQUENCE_795(), 796
+#define _GMP_MAKE_INDEX_SEQUENCE_797() _GMP_MAKE_INDEX_SEQUENCE_796(), 797
+#define _GMP_MAKE_INDEX_SEQUENCE_798() _GMP_MAKE_INDEX_SEQUENCE_797(), 798
+#define _GMP_MAKE_INDEX_SEQUENCE_799() _GMP_MAKE_INDEX_SEQUENCE_798(), 799
+#define _GMP_MAKE_INDEX_SEQUENCE_800() _GMP_MAKE_INDEX_SEQUENCE_799(), 800
+#define _GMP_MAKE_INDEX_SEQUENCE_801() _GMP_MAKE_INDEX_SEQUENCE_800(), 801
+#define _GMP_MAKE_INDEX_SEQUENCE_802() _GMP_MAKE_INDEX_SEQUENCE_801(), 802
+#define _GMP_MAKE_INDEX_SEQUENCE_803() _GMP_MAKE_INDEX_SEQUENCE_802(), 803
+#define _GMP_MAKE_INDEX_SEQUENCE_804() _GMP_MAKE_INDEX_SEQUENCE_803(), 804
+#define _GMP_MAKE_INDEX_SEQUENCE_805() _GMP_MAKE_INDEX_SEQUENCE_804(), 805
+#define _GMP_MAKE_INDEX_SEQUENCE_806() _GMP_MAKE_INDEX_SEQUENCE_805(), 806
+#define _GMP_MAKE_INDEX_SEQUENCE_807() _GMP_MAKE_INDEX_SEQUENCE_806(), 807
+#define _GMP_MAKE_INDEX_SEQUENCE_808() _GMP_MAKE_INDEX_SEQUENCE_807(), 808
+#define _GMP_MAKE_INDEX_SEQUENCE_809() _GMP_MAKE_INDEX_SEQUENCE_808(), 809
+#define _GMP_MAKE_INDEX_SEQUENCE_810() _GMP_MAKE_INDEX_SEQUENCE_809(), 810
+#define _GMP_MAKE_INDEX_SEQUENCE_811() _GMP_MAKE_INDEX_SEQUENCE_810(), 811
+#define _GMP_MAKE_INDEX_SEQUENCE_812() _GMP_MAKE_INDEX_SEQUENCE_811(), 812
+#define _GMP_MAKE_INDEX_SEQUENCE_813() _GMP_MAKE_INDEX_SEQUENCE_812(), 813
+#define _GMP_MAKE_INDEX_SEQUENCE_814() _GMP_MAKE_INDEX_SEQUENCE_813(), 814
+#define _GMP_MAKE_INDEX_SEQUENCE_815() _GMP_MAKE_INDEX_SEQUENCE_814(), 815
+#define _GMP_MAKE_INDEX_SEQUENCE_816() _GMP_MAKE_INDEX_SEQUENCE_815(), 816
+#define _GMP_MAKE_INDEX_SEQUENCE_817() _GMP_MAKE_INDEX_SEQUENCE_816(), 817
+#define _GMP_MAKE_INDEX_SEQUENCE_818() _GMP_MAKE_INDEX_SEQUENCE_817(), 818
+#define _GMP_MAKE_INDEX_SEQUENCE_819() _GMP_MAKE_INDEX_SEQUENCE_818(), 819
+#define _GMP_MAKE_INDEX_SEQUENCE_820() _GMP_MAKE_INDEX_SEQUENCE_819(), 820
+#define _GMP_MAKE_INDEX_SEQUENCE_821() _GMP_MAKE_INDEX_SEQUENCE_820(), 821
+#define _GMP_MAKE_INDEX_SEQUENCE_822() _GMP_MAKE_INDEX_SEQUENCE_821(), 822
+#define _GMP_MAKE_INDEX_SEQUENCE_823() _GMP_MAKE_INDEX_SEQUENCE_822(), 823
+#define _GMP_MAKE_INDEX_SEQUENCE_824() _GMP_MAKE_INDEX_SEQUENCE_823(), 824
+#define _GMP_MAKE_INDEX_SEQUENCE_825() _GMP_MAKE_INDEX_SEQUENCE_824(), 825
+#define _GMP_MAKE_INDEX_SEQUENCE_826() _GMP_MAKE_INDEX_SEQUENCE_825(), 826
+#define _GMP_MAKE_INDEX_SEQUENCE_827() _GMP_MAKE_INDEX_SEQUENCE_826(), 827
+#define _GMP_MAKE_INDEX_SEQUENCE_828() _GMP_MAKE_INDEX_SEQUENCE_827(), 828
+#define _GMP_MAKE_INDEX_SEQUENCE_829() _GMP_MAKE_INDEX_SEQUENCE_828(), 829
+#define _GMP_MAKE_INDEX_SEQUENCE_830() _GMP_MAKE_INDEX_SEQUENCE_829(), 830
+#define _GMP_MAKE_INDEX_SEQUENCE_831() _GMP_MAKE_INDEX_SEQUENCE_830(), 831
+#define _GMP_MAKE_INDEX_SEQUENCE_832() _GMP_MAKE_INDEX_SEQUENCE_831(), 832
+#define _GMP_MAKE_INDEX_SEQUENCE_833() _GMP_MAKE_INDEX_SEQUENCE_832(), 833
+#define _GMP_MAKE_INDEX_SEQUENCE_834() _GMP_MAKE_INDEX_SEQUENCE_833(), 834
+#define _GMP_MAKE_INDEX_SEQUENCE_835() _GMP_MAKE_INDEX_SEQUENCE_834(), 835
+#define _GMP_MAKE_INDEX_SEQUENCE_836() _GMP_MAKE_INDEX_SEQUENCE_835(), 836
+#define _GMP_MAKE_INDEX_SEQUENCE_837() _GMP_MAKE_INDEX_SEQUENCE_836(), 837
+#define _GMP_MAKE_INDEX_SEQUENCE_838() _GMP_MAKE_INDEX_SEQUENCE_837(), 838
+#define _GMP_MAKE_INDEX_SEQUENCE_839() _GMP_MAKE_INDEX_SEQUENCE_838(), 839
+#define _GMP_MAKE_INDEX_SEQUENCE_840() _GMP_MAKE_INDEX_SEQUENCE_839(), 840
+#define _GMP_MAKE_INDEX_SEQUENCE_841() _GMP_MAKE_INDEX_SEQUENCE_840(), 841
+#define _GMP_MAKE_INDEX_SEQUENCE_842() _GMP_MAKE_INDEX_SEQUENCE_841(), 842
+#define _GMP_MAKE_INDEX_SEQUENCE_843() _GMP_MAKE_INDEX_SEQUENCE_842(), 843
+#define _GMP_MAKE_INDEX_SEQUENCE_844() _GMP_MAKE_INDEX_SEQUENCE_843(), 844
+#define _GMP_MAKE_INDEX_SEQUENCE_845() _GMP_MAKE_INDEX_SEQUENCE_844(), 845
+#define _GMP_MAKE_INDEX_SEQUENCE_846() _GMP_MAKE_INDEX_SEQUENCE_845(), 846
+#define _GMP_MAKE_INDEX_SEQUENCE_847() _GMP_MAKE_INDEX_SEQUENCE_846(), 847
+#define _GMP_MAKE_INDEX_SEQUENCE_848() _GMP_MAKE_INDEX_SEQUENCE_847(), 848
+#define _GMP_MAKE_INDEX_SEQUENCE_849() _GMP_MAKE_INDEX_SEQUENCE_848(), 849
+#define _GMP_MAKE_INDEX_SEQUENCE_850() _GMP_MAKE_INDEX_SEQUENCE_849(), 850
+#define _GMP_MAKE_INDEX_SEQUENCE_851() _GMP_MAKE_INDEX_SEQUENCE_850(), 851
+#define _GMP_MAKE_INDEX_SEQUENCE_852() _GMP_MAKE_INDEX_SEQUENCE_851(), 852
+#define _GMP_MAKE_INDEX_SEQUENCE_853() _GMP_MAKE_INDEX_SEQUENCE_852(), 853
+#define _GMP_MAKE_INDEX_SEQUENCE_854() _GMP_MAKE_INDEX_SEQUENCE_853(), 854
+#define _GMP_MAKE_INDEX_SEQUENCE_855() _GMP_MAKE_INDEX_SEQUENCE_854(), 855
+#define _GMP_MAKE_INDEX_SEQUENCE_856() _GMP_MAKE_INDEX_SEQUENCE_855(), 856
+#define _GMP_MAKE_INDEX_SEQUENCE_857() _GMP_MAKE_INDEX_SEQUENCE_856(), 857
+#define _GMP_MAKE_INDEX_SEQUENCE_858() _GMP_MAKE_INDEX_SEQUENCE_857(), 858
+#define _GMP_MAKE_INDEX_SEQUENCE_859() _GMP_MAKE_INDEX_SEQUENCE_858(), 859
+#define _GMP_MAKE_INDEX_SEQUENCE_860() _GMP_MAKE_INDEX_SEQUENCE_859(), 860
+#define _GMP_MAKE_INDEX_SEQUENCE_861() _GMP_MAKE_INDEX_SEQUENCE_860(), 861
+#define _GMP_MAKE_INDEX_SEQUENCE_862() _GMP_MAKE_INDEX_SEQUENCE_861(), 862
+#define _GMP_MAKE_INDEX_SEQUENCE_863() _GMP_MAKE_INDEX_SEQUENCE_862(), 863
+#define _GMP_MAKE_INDEX_SEQUENCE_864() _GMP_MAKE_INDEX_SEQUENCE_863(), 864
+#define _GMP_MAKE_INDEX_SEQUENCE_865() _GMP_MAKE_INDEX_SEQUENCE_864(), 865
+#define _GMP_MAKE_INDEX_SEQUENCE_866() _GMP_MAKE_INDEX_SEQUENCE_865(), 866
+#define _GMP_MAKE_INDEX_SEQUENCE_867() _GMP_MAKE_INDEX_SEQUENCE_866(), 867
+#define _GMP_MAKE_INDEX_SEQUENCE_868() _GMP_MAKE_INDEX_SEQUENCE_867(), 868
+#define _GMP_MAKE_INDEX_SEQUENCE_869() _GMP_MAKE_INDEX_SEQUENCE_868(), 869
+#define _GMP_MAKE_INDEX_SEQUENCE_870() _GMP_MAKE_INDEX_SEQUENCE_869(), 870
+#define _GMP_MAKE_INDEX_SEQUENCE_871() _GMP_MAKE_INDEX_SEQUENCE_870(), 871
+#define _GMP_MAKE_INDEX_SEQUENCE_872() _GMP_MAKE_INDEX_SEQUENCE_871(), 872
+#define _GMP_MAKE_INDEX_SEQUENCE_873() _GMP_MAKE_INDEX_SEQUENCE_872(), 873
+#define _GMP_MAKE_INDEX_SEQUENCE_874() _GMP_MAKE_INDEX_SEQUENCE_873(), 874
+#define _GMP_MAKE_INDEX_SEQUENCE_875() _GMP_MAKE_INDEX_SEQUENCE_874(), 875
+#define _GMP_MAKE_INDEX_SEQUENCE_876() _GMP_MAKE_INDEX_SEQUENCE_875(), 876
+#define _GMP_MAKE_INDEX_SEQUENCE_877() _GMP_MAKE_INDEX_SEQUENCE_876(), 877
+#define _GMP_MAKE_INDEX_SEQUENCE_878() _GMP_MAKE_INDEX_SEQUENCE_877(), 878
+#define _GMP_MAKE_INDEX_SEQUENCE_879() _GMP_MAKE_INDEX_SEQUENCE_878(), 879
+#define _GMP_MAKE_INDEX_SEQUENCE_880() _GMP_MAKE_INDEX_SEQUENCE_879(), 880
+#define _GMP_MAKE_INDEX_SEQUENCE_881() _GMP_MAKE_INDEX_SEQUENCE_880(), 881
+#define _GMP_MAKE_INDEX_SEQUENCE_882() _GMP_MAKE_INDEX_SEQUENCE_881(), 882
+#define _GMP_MAKE_INDEX_SEQUENCE_883() _GMP_MAKE_INDEX_SEQUENCE_882(), 883
+#define _GMP_MAKE_INDEX_SEQUENCE_884() _GMP_MAKE_INDEX_SEQUENCE_883(), 884
+#define _GMP_MAKE_INDEX_SEQUENCE_885() _GMP_MAKE_INDEX_SEQUENCE_884(), 885
+#define _GMP_MAKE_INDEX_SEQUENCE_886() _GMP_MAKE_INDEX_SEQUENCE_885(), 886
+#define _GMP_MAKE_INDEX_SEQUENCE_887() _GMP_MAKE_INDEX_SEQUENCE_886(), 887
+#define _GMP_MAKE_INDEX_SEQUENCE_888() _GMP_MAKE_INDEX_SEQUENCE_887(), 888
+#define _GMP_MAKE_INDEX_SEQUENCE_889() _GMP_MAKE_INDEX_SEQUENCE_888(), 889
+#define _GMP_MAKE_INDEX_SEQUENCE_890() _GMP_MAKE_INDEX_SEQUENCE_889(), 890
+#define _GMP_MAKE_INDEX_SEQUENCE_891() _GMP_MAKE_INDEX_SEQUENCE_890(), 891
+#define _GMP_MAKE_INDEX_SEQUENCE_892() _GMP_MAKE_INDEX_SEQUENCE_891(), 892
+#define _GMP_MAKE_INDEX_SEQUENCE_893() _GMP_MAKE_INDEX_SEQUENCE_892(), 893
+#define _GMP_MAKE_INDEX_SEQUENCE_894() _GMP_MAKE_INDEX_SEQUENCE_893(), 894
+#define _GMP_MAKE_INDEX_SEQUENCE_895() _GMP_MAKE_INDEX_SEQUENCE_894(), 895
+#define _GMP_MAKE_INDEX_SEQUENCE_896() _GMP_MAKE_INDEX_SEQUENCE_895(), 896
+#define _GMP_MAKE_INDEX_SEQUENCE_897() _GMP_MAKE_INDEX_SEQUENCE_896(), 897
+#define _GMP_MAKE_INDEX_SEQUENCE_898() _GMP_MAKE_INDEX_SEQUENCE_897(), 898
+#define _GMP_MAKE_INDEX_SEQUENCE_899() _GMP_MAKE_INDEX_SEQUENCE_898(), 899
+#define _GMP_MAKE_INDEX_SEQUENCE_900() _GMP_MAKE_INDEX_SEQUENCE_899(), 900
+#define _GMP_MAKE_INDEX_SEQUENCE_901() _GMP_MAKE_INDEX_SEQUENCE_900(), 901
+#define _GMP_MAKE_INDEX_SEQUENCE_902() _GMP_MAKE_INDEX_SEQUENCE_901(), 902
+#define _GMP_MAKE_INDEX_SEQUENCE_903() _GMP_MAKE_INDEX_SEQUENCE_902(), 903
+#define _GMP_MAKE_INDEX_SEQUENCE_904() _GMP_MAKE_INDEX_SEQUENCE_903(), 904
+#define _GMP_MAKE_INDEX_SEQUENCE_905() _GMP_MAKE_INDEX_SEQUENCE_904(), 905
+#define _GMP_MAKE_INDEX_SEQUENCE_906() _GMP_MAKE_INDEX_SEQUENCE_905(), 906
+#define _GMP_MAKE_INDEX_SEQUENCE_907() _GMP_MAKE_INDEX_SEQUENCE_906(), 907
+#define _GMP_MAKE_INDEX_SEQUENCE_908() _GMP_MAKE_INDEX_SEQUENCE_907(), 908
+#define _GMP_MAKE_INDEX_SEQUENCE_909() _GMP_MAKE_INDEX_SEQUENCE_908(), 909
+#define _GMP_MAKE_INDEX_SEQUENCE_910() _GMP_MAKE_INDEX_SEQUENCE_909(), 910
+#define _GMP_MAKE_INDEX_SEQUENCE_911() _GMP_MAKE_INDEX_SEQUENCE_910(), 911
+#define _GMP_MAKE_INDEX_SEQUENCE_912() _GMP_MAKE_INDEX_SEQUENCE_911(), 912
+#define _GMP_MAKE_INDEX_SEQUENCE_913() _GMP_MAKE_INDEX_SEQUENCE_912(), 913
+#define _GMP_MAKE_INDEX_SEQUENCE_914() _GMP_MAKE_INDEX_SEQUENCE_913(), 914
+#define _GMP_MAKE_INDEX_SEQUENCE_915() _GMP_MAKE_INDEX_SEQUENCE_914(), 915
+#define _GMP_MAKE_INDEX_SEQUENCE_916() _GMP_MAKE_INDEX_SEQUENCE_915(), 916
+#define _GMP_MAKE_INDEX_SEQUENCE_917() _GMP_MAKE_INDEX_SEQUENCE_916(), 917
+#define _GMP_MAKE_INDEX_SEQUENCE_918() _GMP_MAKE_INDEX_SEQUENCE_917(), 918
+#define _GMP_MAKE_INDEX_SEQUENCE_919() _GMP_MAKE_INDEX_SEQUENCE_918(), 919
+#define _GMP_MAKE_INDEX_SEQUENCE_920() _GMP_MAKE_INDEX_SEQUENCE_919(), 920
+#define _GMP_MAKE_INDEX_SEQUENCE_921() _GMP_MAKE_INDEX_SEQUENCE_920(), 921
+#define _GMP_MAKE_INDEX_SEQUENCE_922() _GMP_MAKE_INDEX_SEQUENCE_921(), 922
+#define _GMP_MAKE_INDEX_SEQUENCE_923() _GMP_MAKE_INDEX_SEQUENCE_922(), 923
+#define _GMP_MAKE_INDEX_SEQUENCE_924() _GMP_MAKE_INDEX_SEQUENCE_923(), 924
+#define _GMP_MAKE_INDEX_SEQUENCE_925() _GMP_MAKE_INDEX_SEQUENCE_924(), 925
+#define _GMP_MAKE_INDEX_SEQUENCE_926() _GMP_MAKE_INDEX_SEQUENCE_925(), 926
+#define _GMP_MAKE_INDEX_SEQUENCE_927() _GMP_MAKE_INDEX_SEQUENCE_926(), 927
+#define _GMP_MAKE_INDEX_SEQUENCE_928() _GMP_MAKE_INDEX_SEQUENCE_927(), 928
+#define _GMP_MAKE_INDEX_SEQUENCE_929() _GMP_MAKE_INDEX_SEQUENCE_928(), 929
+#define _GMP_MAKE_INDEX_SEQUENCE_930() _GMP_MAKE_INDEX_SEQUENCE_929(), 930
+#define _GMP_MAKE_INDEX_SEQUENCE_931() _GMP_MAKE_INDEX_SEQUENCE_930(), 931
+#define _GMP_MAKE_INDEX_SEQUENCE_932() _GMP_MAKE_INDEX_SEQUENCE_931(), 932
+#define _GMP_MAKE_INDEX_SEQUENCE_933() _GMP_MAKE_INDEX_SEQUENCE_932(), 933
+#define _GMP_MAKE_INDEX_SEQUENCE_934() _GMP_MAKE_INDEX_SEQUENCE_933(), 934
+#define _GMP_MAKE_INDEX_SEQUENCE_935() _GMP_MAKE_INDEX_SEQUENCE_934(), 935
+#define _GMP_MAKE_INDEX_SEQUENCE_936() _GMP_MAKE_INDEX_SEQUENCE_935(), 936
+#define _GMP_MAKE_INDEX_SEQUENCE_937() _GMP_MAKE_INDEX_SEQUENCE_936(), 937
+#define _GMP_MAKE_INDEX_SEQUENCE_938() _GMP_MAKE_INDEX_SEQUENCE_937(), 938
+#define _GMP_MAKE_INDEX_SEQUENCE_939() _GMP_MAKE_INDEX_SEQUENCE_938(), 939
+#define _GMP_MAKE_INDEX_SEQUENCE_940() _GMP_MAKE_INDEX_SEQUENCE_939(), 940
+#define _GMP_MAKE_INDEX_SEQUENCE_941() _GMP_MAKE_INDEX_SEQUENCE_940(), 941
+#define _GMP_MAKE_INDEX_SEQUENCE_942() _GMP_MAKE_INDEX_SEQUENCE_941(), 942
+#define _GMP_MAKE_INDEX_SEQUENCE_943() _GMP_MAKE_INDEX_SEQUENCE_942(), 943
+#define _GMP_MAKE_INDEX_SEQUENCE_944() _GMP_MAKE_INDEX_SEQUENCE_943(), 944
+#define _GMP_MAKE_INDEX_SEQUENCE_945() _GMP_MAKE_INDEX_SEQUENCE_944(), 945
+#define _GMP_MAKE_INDEX_SEQUENCE_946() _GMP_MAKE_INDEX_SEQUENCE_945(), 946
+#define _GMP_MAKE_INDEX_SEQUENCE_947() _GMP_MAKE_INDEX_SEQUENCE_946(), 947
+#define _GMP_MAKE_INDEX_SEQUENCE_948() _GMP_MAKE_INDEX_SEQUENCE_947(), 948
+#define _GMP_MAKE_INDEX_SEQUENCE_949() _GMP_MAKE_INDEX_SEQUENCE_948(), 949
+#define _GMP_MAKE_INDEX_SEQUENCE_950() _GMP_MAKE_INDEX_SEQUENCE_949(), 950
+#define _GMP_MAKE_INDEX_SEQUENCE_951() _GMP_MAKE_INDEX_SEQUENCE_950(), 951
+#define _GMP_MAKE_INDEX_SEQUENCE_952() _GMP_MAKE_INDEX_SEQUENCE_951(), 952
+#define _GMP_MAKE_INDEX_SEQUENCE_953() _GMP_MAKE_INDEX_SEQUENCE_952(), 953
+#define _GMP_MAKE_INDEX_SEQUENCE_954() _GMP_MAKE_INDEX_SEQUENCE_953(), 954
+#define _GMP_MAKE_INDEX_SEQUENCE_955() _GMP_MAKE_INDEX_SEQUENCE_954(), 955
+#define _GMP_MAKE_INDEX_SEQUENCE_956() _GMP_MAKE_INDEX_SEQUENCE_955(), 956
+#define _GMP_MAKE_INDEX_SEQUENCE_957() _GMP_MAKE_INDEX_SEQUENCE_956(), 957
+#define _GMP_MAKE_INDEX_SEQUENCE_958() _GMP_MAKE_INDEX_SEQUENCE_957(), 958
+#define _GMP_MAKE_INDEX_SEQUENCE_959() _GMP_MAKE_INDEX_SEQUENCE_958(), 959
+#define _GMP_MAKE_INDEX_SEQUENCE_960() _GMP_MAKE_INDEX_SEQUENCE_959(), 960
+#define _GMP_MAKE_INDEX_SEQUENCE_961() _GMP_MAKE_INDEX_SEQUENCE_960(), 961
+#define _GMP_MAKE_INDEX_SEQUENCE_962() _GMP_MAKE_INDEX_SEQUENCE_961(), 962
+#define _GMP_MAKE_INDEX_SEQUENCE_963() _GMP_MAKE_INDEX_SEQUENCE_962(), 963
+#define _GMP_MAKE_INDEX_SEQUENCE_964() _GMP_MAKE_INDEX_SEQUENCE_963(), 964
+#define _GMP_MAKE_INDEX_SEQUENCE_965() _GMP_MAKE_INDEX_SEQUENCE_964(), 965
+#define _GMP_MAKE_INDEX_SEQUENCE_966() _GMP_MAKE_INDEX_SEQUENCE_965(), 966
+#define _GMP_MAKE_INDEX_SEQUENCE_967() _GMP_MAKE_INDEX_SEQUENCE_966(), 967
+#define _GMP_MAKE_INDEX_SEQUENCE_968() _GMP_MAKE_INDEX_SEQUENCE_967(), 968
+#define _GMP_MAKE_INDEX_SEQUENCE_969() _GMP_MAKE_INDEX_SEQUENCE_968(), 969
+#define _GMP_MAKE_INDEX_SEQUENCE_970() _GMP_MAKE_INDEX_SEQUENCE_969(), 970
+#define _GMP_MAKE_INDEX_SEQUENCE_971() _GMP_MAKE_INDEX_SEQUENCE_970(), 971
+#define _GMP_MAKE_INDEX_SEQUENCE_972() _GMP_MAKE_INDEX_SEQUENCE_971(), 972
+#define _GMP_MAKE_INDEX_SEQUENCE_973() _GMP_MAKE_INDEX_SEQUENCE_972(), 973
+#define _GMP_MAKE_INDEX_SEQUENCE_974() _GMP_MAKE_INDEX_SEQUENCE_973(), 974
+#define _GMP_MAKE_INDEX_SEQUENCE_975() _GMP_MAKE_INDEX_SEQUENCE_974(), 975
+#define _GMP_MAKE_INDEX_SEQUENCE_976() _GMP_MAKE_INDEX_SEQUENCE_975(), 976
+#define _GMP_MAKE_INDEX_SEQUENCE_977() _GMP_MAKE_INDEX_SEQUENCE_976(), 977
+#define _GMP_MAKE_INDEX_SEQUENCE_978() _GMP_MAKE_INDEX_SEQUENCE_977(), 978
+#define _GMP_MAKE_INDEX_SEQUENCE_979() _GMP_MAKE_INDEX_SEQUENCE_978(), 979
+#define _GMP_MAKE_INDEX_SEQUENCE_980() _GMP_MAKE_INDEX_SEQUENCE_979(), 980
+#define _GMP_MAKE_INDEX_SEQUENCE_981() _GMP_MAKE_INDEX_SEQUENCE_980(), 981
+#define _GMP_MAKE_INDEX_SEQUENCE_982() _GMP_MAKE_INDEX_SEQUENCE_981(), 982
+#define _GMP_MAKE_INDEX_SEQUENCE_983() _GMP_MAKE_INDEX_SEQUENCE_982(), 983
+#define _GMP_MAKE_INDEX_SEQUENCE_984() _GMP_MAKE_INDEX_SEQUENCE_983(), 984
+#define _GMP_MAKE_INDEX_SEQUENCE_985() _GMP_MAKE_INDEX_SEQUENCE_984(), 985
+#define _GMP_MAKE_INDEX_SEQUENCE_986() _GMP_MAKE_INDEX_SEQUENCE_985(), 986
+#define _GMP_MAKE_INDEX_SEQUENCE_987() _GMP_MAKE_INDEX_SEQUENCE_986(), 987
+#define _GMP_MAKE_INDEX_SEQUENCE_988() _GMP_MAKE_INDEX_SEQUENCE_987(), 988
+#define _GMP_MAKE_INDEX_SEQUENCE_989() _GMP_MAKE_INDEX_SEQUENCE_988(), 989
+#define _GMP_MAKE_INDEX_SEQUENCE_990() _GMP_MAKE_INDEX_SEQUENCE_989(), 990
+#define _GMP_MAKE_INDEX_SEQUENCE_991() _GMP_MAKE_INDEX_SEQUENCE_990(), 991
+#define _GMP_MAKE_INDEX_SEQUENCE_992() _GMP_MAKE_INDEX_SEQUENCE_991(), 992
+#define _GMP_MAKE_INDEX_SEQUENCE_993() _GMP_MAKE_INDEX_SEQUENCE_992(), 993
+#define _GMP_MAKE_INDEX_SEQUENCE_994() _GMP_MAKE_INDEX_SEQUENCE_993(), 994
+#define _GMP_MAKE_INDEX_SEQUENCE_995() _GMP_MAKE_INDEX_SEQUENCE_994(), 995
+#define _GMP_MAKE_INDEX_SEQUENCE_996() _GMP_MAKE_INDEX_SEQUENCE_995(), 996
+#define _GMP_MAKE_INDEX_SEQUENCE_997() _GMP_MAKE_INDEX_SEQUENCE_996(), 997
+#define _GMP_MAKE_INDEX_SEQUENCE_998() _GMP_MAKE_INDEX_SEQUENCE_997(), 998
+#define _GMP_MAKE_INDEX_SEQUENCE_999() _GMP_MAKE_INDEX_SEQUENCE_998(), 999
+#define _GMP_MAKE_INDEX_SEQUENCE_1000() _GMP_MAKE_INDEX_SEQUENCE_999(), 1000
+#define _GMP_MAKE_INDEX_SEQUENCE_1001() _GMP_MAKE_INDEX_SEQUENCE_1000(), 1001
+#define _GMP_MAKE_INDEX_SEQUENCE_1002() _GMP_MAKE_INDEX_SEQUENCE_1001(), 1002
+#define _GMP_MAKE_INDEX_SEQUENCE_1003() _GMP_MAKE_INDEX_SEQUENCE_1002(), 1003
+#define _GMP_MAKE_INDEX_SEQUENCE_1004() _GMP_MAKE_INDEX_SEQUENCE_1003(), 1004
+#define _GMP_MAKE_INDEX_SEQUENCE_1005() _GMP_MAKE_INDEX_SEQUENCE_1004(), 1005
+#define _GMP_MAKE_INDEX_SEQUENCE_1006() _GMP_MAKE_INDEX_SEQUENCE_1005(), 1006
+#define _GMP_MAKE_INDEX_SEQUENCE_1007() _GMP_MAKE_INDEX_SEQUENCE_1006(), 1007
+#define _GMP_MAKE_INDEX_SEQUENCE_1008() _GMP_MAKE_INDEX_SEQUENCE_1007(), 1008
+#define _GMP_MAKE_INDEX_SEQUENCE_1009() _GMP_MAKE_INDEX_SEQUENCE_1008(), 1009
+#define _GMP_MAKE_INDEX_SEQUENCE_1010() _GMP_MAKE_INDEX_SEQUENCE_1009(), 1010
+#define _GMP_MAKE_INDEX_SEQUENCE_1011() _GMP_MAKE_INDEX_SEQUENCE_1010(), 1011
+#define _GMP_MAKE_INDEX_SEQUENCE_1012() _GMP_MAKE_INDEX_SEQUENCE_1011(), 1012
+#define _GMP_MAKE_INDEX_SEQUENCE_1013() _GMP_MAKE_INDEX_SEQUENCE_1012(), 1013
+#define _GMP_MAKE_INDEX_SEQUENCE_1014() _GMP_MAKE_INDEX_SEQUENCE_1013(), 1014
+#define _GMP_MAKE_INDEX_SEQUENCE_1015() _GMP_MAKE_INDEX_SEQUENCE_1014(), 1015
+#define _GMP_MAKE_INDEX_SEQUENCE_1016() _GMP_MAKE_INDEX_SEQUENCE_1015(), 1016
+#define _GMP_MAKE_INDEX_SEQUENCE_1017() _GMP_MAKE_INDEX_SEQUENCE_1016(), 1017
+#define _GMP_MAKE_INDEX_SEQUENCE_1018() _GMP_MAKE_INDEX_SEQUENCE_1017(), 1018
+#define _GMP_MAKE_INDEX_SEQUENCE_1019() _GMP_MAKE_INDEX_SEQUENCE_1018(), 1019
+#define _GMP_MAKE_INDEX_SEQUENCE_1020() _GMP_MAKE_INDEX_SEQUENCE_1019(), 1020
+#define _GMP_MAKE_INDEX_SEQUENCE_1021() _GMP_MAKE_INDEX_SEQUENCE_1020(), 1021
+#define _GMP_MAKE_INDEX_SEQUENCE_1022() _GMP_MAKE_INDEX_SEQUENCE_1021(), 1022
+#define _GMP_MAKE_INDEX_SEQUENCE_1023() _GMP_MAKE_INDEX_SEQUENCE_1022(), 1023
+
+// GMP_RANGE
+#define _GMP_DROP_0(...) __VA_ARGS__
+#define _GMP_DROP_1(x, ...) _GMP_DROP_0(__VA_ARGS__)
+#define _GMP_DROP_2(x, ...) _GMP_DROP_1(__VA_ARGS__)
+#define _GMP_DROP_3(x, ...) _GMP_DROP_2(__VA_ARGS__)
+#define _GMP_DROP_4(x, ...) _GMP_DROP_3(__VA_ARGS__)
+#define _GMP_DROP_5(x, ...) _GMP_DROP_4(__VA_ARGS__)
+#define _GMP_DROP_6(x, ...) _GMP_DROP_5(__VA_ARGS__)
+#define _GMP_DROP_7(x, ...) _GMP_DROP_6(__VA_ARGS__)
+#define _GMP_DROP_8(x, ...) _GMP_DROP_7(__VA_ARGS__)
+#define _GMP_DROP_9(x, ...) _GMP_DROP_8(__VA_ARGS__)
+#define _GMP_DROP_10(x, ...) _GMP_DROP_9(__VA_ARGS__)
+#define _GMP_DROP_11(x, ...) _GMP_DROP_10(__VA_ARGS__)
+#define _GMP_DROP_12(x, ...) _GMP_DROP_11(__VA_ARGS__)
+#define _GMP_DROP_13(x, ...) _GMP_DROP_12(__VA_ARGS__)
+#define _GMP_DROP_14(x, ...) _GMP_DROP_13(__VA_ARGS__)
+#define _GMP_DROP_15(x, ...) _GMP_DROP_14(__VA_ARGS__)
+#define _GMP_DROP_16(x, ...) _GMP_DROP_15(__VA_ARGS__)
+#define _GMP_DROP_17(x, ...) _GMP_DROP_16(__VA_ARGS__)
+#define _GMP_DROP_18(x, ...) _GMP_DROP_17(__VA_ARGS__)
+#define _GMP_DROP_19(x, ...) _GMP_DROP_18(__VA_ARGS__)
+#define _GMP_DROP_20(x, ...) _GMP_DROP_19(__VA_ARGS__)
+#define _GMP_DROP_21(x, ...) _GMP_DROP_20(__VA_ARGS__)
+#define _GMP_DROP_22(x, ...) _GMP_DROP_21(__VA_ARGS__)
+#define _GMP_DROP_23(x, ...) _GMP_DROP_22(__VA_ARGS__)
+#define _GMP_DROP_24(x, ...) _GMP_DROP_23(__VA_ARGS__)
+#define _GMP_DROP_25(x, ...) _GMP_DROP_24(__VA_ARGS__)
+#define _GMP_DROP_26(x, ...) _GMP_DROP_25(__VA_ARGS__)
+#define _GMP_DROP_27(x, ...) _GMP_DROP_26(__VA_ARGS__)
+#define _GMP_DROP_28(x, ...) _GMP_DROP_27(__VA_ARGS__)
+#define _GMP_DROP_29(x, ...) _GMP_DROP_28(__VA_ARGS__)
+#define _GMP_DROP_30(x, ...) _GMP_DROP_29(__VA_ARGS__)
+#define _GMP_DROP_31(x, ...) _GMP_DROP_30(__VA_ARGS__)
+#define _GMP_DROP_32(x, ...) _GMP_DROP_31(__VA_ARGS__)
+#define _GMP_DROP_33(x, ...) _GMP_DROP_32(__VA_ARGS__)
+#define _GMP_DROP_34(x, ...) _GMP_DROP_33(__VA_ARGS__)
+#define _GMP_DROP_35(x, ...) _GMP_DROP_34(__VA_ARGS__)
+#define _GMP_DROP_36(x, ...) _GMP_DROP_35(__VA_ARGS__)
+#define _GMP_DROP_37(x, ...) _GMP_DROP_36(__VA_ARGS__)
+#define _GMP_DROP_38(x, ...) _GMP_DROP_37(__VA_ARGS__)
+#define _GMP_DROP_39(x, ...) _GMP_DROP_38(__VA_ARGS__)
+#define _GMP_DROP_40(x, ...) _GMP_DROP_39(__VA_ARGS__)
+#define _GMP_DROP_41(x, ...) _GMP_DROP_40(__VA_ARGS__)
+#define _GMP_DROP_42(x, ...) _GMP_DROP_41(__VA_ARGS__)
+#define _GMP_DROP_43(x, ...) _GMP_DROP_42(__VA_ARGS__)
+#define _GMP_DROP_44(x, ...) _GMP_DROP_43(__VA_ARGS__)
+#define _GMP_DROP_45(x, ...) _GMP_DROP_44(__VA_ARGS__)
+#define _GMP_DROP_46(x, ...) _GMP_DROP_45(__VA_ARGS__)
+#define _GMP_DROP_47(x, ...) _GMP_DROP_46(__VA_ARGS__)
+#define _GMP_DROP_48(x, ...) _GMP_DROP_47(__VA_ARGS__)
+#define _GMP_DROP_49(x, ...) _GMP_DROP_48(__VA_ARGS__)
+#define _GMP_DROP_50(x, ...) _GMP_DROP_49(__VA_ARGS__)
+#define _GMP_DROP_51(x, ...) _GMP_DROP_50(__VA_ARGS__)
+#define _GMP_DROP_52(x, ...) _GMP_DROP_51(__VA_ARGS__)
+#define _GMP_DROP_53(x, ...) _GMP_DROP_52(__VA_ARGS__)
+#define _GMP_DROP_54(x, ...) _GMP_DROP_53(__VA_ARGS__)
+#define _GMP_DROP_55(x, ...) _GMP_DROP_54(__VA_ARGS__)
+#define _GMP_DROP_56(x, ...) _GMP_DROP_55(__VA_ARGS__)
+#define _GMP_DROP_57(x, ...) _GMP_DROP_56(__VA_ARGS__)
+#define _GMP_DROP_58(x, ...) _GMP_DROP_57(__VA_ARGS__)
+#define _GMP_DROP_59(x, ...) _GMP_DROP_58(__VA_ARGS__)
+#define _GMP_DROP_60(x, ...) _GMP_DROP_59(__VA_ARGS__)
+#define _GMP_DROP_61(x, ...) _GMP_DROP_60(__VA_ARGS__)
+#define _GMP_DROP_62(x, ...) _GMP_DROP_61(__VA_ARGS__)
+#define _GMP_DROP_63(x, ...) _GMP_DROP_62(__VA_ARGS__)
+#define _GMP_DROP_64(x, ...) _GMP_DROP_63(__VA_ARGS__)
+#define _GMP_DROP_65(x, ...) _GMP_DROP_64(__VA_ARGS__)
+#define _GMP_DROP_66(x, ...) _GMP_DROP_65(__VA_ARGS__)
+#define _GMP_DROP_67(x, ...) _GMP_DROP_66(__VA_ARGS__)
+#define _GMP_DROP_68(x, ...) _GMP_DROP_67(__VA_ARGS__)
+#define _GMP_DROP_69(x, ...) _GMP_DROP_68(__VA_ARGS__)
+#define _GMP_DROP_70(x, ...) _GMP_DROP_69(__VA_ARGS__)
+#define _GMP_DROP_71(x, ...) _GMP_DROP_70(__VA_ARGS__)
+#define _GMP_DROP_72(x, ...) _GMP_DROP_71(__VA_ARGS__)
+#define _GMP_DROP_73(x, ...) _GMP_DROP_72(__VA_ARGS__)
+#define _GMP_DROP_74(x, ...) _GMP_DROP_73(__VA_ARGS__)
+#define _GMP_DROP_75(x, ...) _GMP_DROP_74(__VA_ARGS__)
+#define _GMP_DROP_76(x, ...) _GMP_DROP_75(__VA_ARGS__)
+#define _GMP_DROP_77(x, ...) _GMP_DROP_76(__VA_ARGS__)
+#define _GMP_DROP_78(x, ...) _GMP_DROP_77(__VA_ARGS__)
+#define _GMP_DROP_79(x, ...) _GMP_DROP_78(__VA_ARGS__)
+#define _GMP_DROP_80(x, ...) _GMP_DROP_79(__VA_ARGS__)
+#define _GMP_DROP_81(x, ...) _GMP_DROP_80(__VA_ARGS__)
+#define _GMP_DROP_82(x, ...) _GMP_DROP_81(__VA_ARGS__)
+#define _GMP_DROP_83(x, ...) _GMP_DROP_82(__VA_ARGS__)
+#define _GMP_DROP_84(x, ...) _GMP_DROP_83(__VA_ARGS__)
+#define _GMP_DROP_85(x, ...) _GMP_DROP_84(__VA_ARGS__)
+#define _GMP_DROP_86(x, ...) _GMP_DROP_85(__VA_ARGS__)
+#define _GMP_DROP_87(x, ...) _GMP_DROP_86(__VA_ARGS__)
+#define _GMP_DROP_88(x, ...) _GMP_DROP_87(__VA_ARGS__)
+#define _GMP_DROP_89(x, ...) _GMP_DROP_88(__VA_ARGS__)
+#define _GMP_DROP_90(x, ...) _GMP_DROP_89(__VA_ARGS__)
+#define _GMP_DROP_91(x, ...) _GMP_DROP_90(__VA_ARGS__)
+#define _GMP_DROP_92(x, ...) _GMP_DROP_91(__VA_ARGS__)
+#define _GMP_DROP_93(x, ...) _GMP_DROP_92(__VA_ARGS__)
+#define _GMP_DROP_94(x, ...) _GMP_DROP_93(__VA_ARGS__)
+#define _GMP_DROP_95(x, ...) _GMP_DROP_94(__VA_ARGS__)
+#define _GMP_DROP_96(x, ...) _GMP_DROP_95(__VA_ARGS__)
+#define _GMP_DROP_97(x, ...) _GMP_DROP_96(__VA_ARGS__)
+#define _GMP_DROP_98(x, ...) _GMP_DROP_97(__VA_ARGS__)
+#define _GMP_DROP_99(x, ...) _GMP_DROP_98(__VA_ARGS__)
+#define _GMP_DROP_100(x, ...) _GMP_DROP_99(__VA_ARGS__)
+#define _GMP_DROP_101(x, ...) _GMP_DROP_100(__VA_ARGS__)
+#define _GMP_DROP_102(x, ...) _GMP_DROP_101(__VA_ARGS__)
+#define _GMP_DROP_103(x, ...) _GMP_DROP_102(__VA_ARGS__)
+#define _GMP_DROP_104(x, ...) _GMP_DROP_103(__VA_ARGS__)
+#define _GMP_DROP_105(x, ...) _GMP_DROP_104(__VA_ARGS__)
+#define _GMP_DROP_106(x, ...) _GMP_DROP_105(__VA_ARGS__)
+#define _GMP_DROP_107(x, ...) _GMP_DROP_106(__VA_ARGS__)
+#define _GMP_DROP_108(x, ...) _GMP_DROP_107(__VA_ARGS__)
+#define _GMP_DROP_109(x, ...) _GMP_DROP_108(__VA_ARGS__)
+#define _GMP_DROP_110(x, ...) _GMP_DROP_109(__VA_ARGS__)
+#define _GMP_DROP_111(x, ...) _GMP_DROP_110(__VA_ARGS__)
+#define _GMP_DROP_112(x, ...) _GMP_DROP_111(__VA_ARGS__)
+#define _GMP_DROP_113(x, ...) _GMP_DROP_112(__VA_ARGS__)
+#define _GMP_DROP_114(x, ...) _GMP_DROP_113(__VA_ARGS__)
+#define _GMP_DROP_115(x, ...) _GMP_DROP_114(__VA_ARGS__)
+#define _GMP_DROP_116(x, ...) _GMP_DROP_115(__VA_ARGS__)
+#define _GMP_DROP_117(x, ...) _GMP_DROP_116(__VA_ARGS__)
+#define _GMP_DROP_118(x, ...) _GMP_DROP_117(__VA_ARGS__)
+#define _GMP_DROP_119(x, ...) _GMP_DROP_118(__VA_ARGS__)
+#define _GMP_DROP_120(x, ...) _GMP_DROP_119(__VA_ARGS__)
+#define _GMP_DROP_121(x, ...) _GMP_DROP_120(__VA_ARGS__)
+#define _GMP_DROP_122(x, ...) _GMP_DROP_121(__VA_ARGS__)
+#define _GMP_DROP_123(x, ...) _GMP_DROP_122(__VA_ARGS__)
+#define _GMP_DROP_124(x, ...) _GMP_DROP_123(__VA_ARGS__)
+#define _GMP_DROP_125(x, ...) _GMP_DROP_124(__VA_ARGS__)
+#define _GMP_DROP_126(x, ...) _GMP_DROP_125(__VA_ARGS__)
+#define _GMP_DROP_127(x, ...) _GMP_DROP_126(__VA_ARGS__)
+#define _GMP_DROP_128(x, ...) _GMP_DROP_127(__VA_ARGS__)
+#define _GMP_DROP_129(x, ...) _GMP_DROP_128(__VA_ARGS__)
+#define _GMP_DROP_130(x, ...) _GMP_DROP_129(__VA_ARGS__)
+#define _GMP_DROP_131(x, ...) _GMP_DROP_130(__VA_ARGS__)
+#define _GMP_DROP_132(x, ...) _GMP_DROP_131(__VA_ARGS__)
+#define _GMP_DROP_133(x, ...) _GMP_DROP_132(__VA_ARGS__)
+#define _GMP_DROP_134(x, ...) _GMP_DROP_133(__VA_ARGS__)
+#define _GMP_DROP_135(x, ...) _GMP_DROP_134(__VA_ARGS__)
+#define _GMP_DROP_136(x, ...) _GMP_DROP_135(__VA_ARGS__)
+#define _GMP_DROP_137(x, ...) _GMP_DROP_136(__VA_ARGS__)
+#define _GMP_DROP_138(x, ...) _GMP_DROP_137(__VA_ARGS__)
+#define _GMP_DROP_139(x, ...) _GMP_DROP_138(__VA_ARGS__)
+#define _GMP_DROP_140(x, ...) _GMP_DROP_139(__VA_ARGS__)
+#define _GMP_DROP_141(x, ...) _GMP_DROP_140(__VA_ARGS__)
+#define _GMP_DROP_142(x, ...) _GMP_DROP_141(__VA_ARGS__)
+#define _GMP_DROP_143(x, ...) _GMP_DROP_142(__VA_ARGS__)
+#define _GMP_DROP_144(x, ...) _GMP_DROP_143(__VA_ARGS__)
+#define _GMP_DROP_145(x, ...) _GMP_DROP_144(__VA_ARGS__)
+#define _GMP_DROP_146(x, ...) _GMP_DROP_145(__VA_ARGS__)
+#define _GMP_DROP_147(x, ...) _GMP_DROP_146(__VA_ARGS__)
+#define _GMP_DROP_148(x, ...) _GMP_DROP_147(__VA_ARGS__)
+#define _GMP_DROP_149(x, ...) _GMP_DROP_148(__VA_ARGS__)
+#define _GMP_DROP_150(x, ...) _GMP_DROP_149(__VA_ARGS__)
+#define _GMP_DROP_151(x, ...) _GMP_DROP_150(__VA_ARGS__)
+#define _GMP_DROP_152(x, ...) _GMP_DROP_151(__VA_ARGS__)
+#define _GMP_DROP_153(x, ...) _GMP_DROP_152(__VA_ARGS__)
+#define _GMP_DROP_154(x, ...) _GMP_DROP_153(__VA_ARGS__)
+#define _GMP_DROP_155(x, ...) _GMP_DROP_154(__VA_ARGS__)
+#define _GMP_DROP_156(x, ...) _GMP_DROP_155(__VA_ARGS__)
+#define _GMP_DROP_157(x, ...) _GMP_DROP_156(__VA_ARGS__)
+#define _GMP_DROP_158(x, ...) _GMP_DROP_157(__VA_ARGS__)
+#define _GMP_DROP_159(x, ...) _GMP_DROP_158(__VA_ARGS__)
+#define _GMP_DROP_160(x, ...) _GMP_DROP_159(__VA_ARGS__)
+#define _GMP_DROP_161(x, ...) _GMP_DROP_160(__VA_ARGS__)
+#define _GMP_DROP_162(x, ...) _GMP_DROP_161(__VA_ARGS__)
+#define _GMP_DROP_163(x, ...) _GMP_DROP_162(__VA_ARGS__)
+#define _GMP_DROP_164(x, ...) _GMP_DROP_163(__VA_ARGS__)
+#define _GMP_DROP_165(x, ...) _GMP_DROP_164(__VA_ARGS__)
+#define _GMP_DROP_166(x, ...) _GMP_DROP_165(__VA_ARGS__)
+#define _GMP_DROP_167(x, ...) _GMP_DROP_166(__VA_ARGS__)
+#define _GMP_DROP_168(x, ...) _GMP_DROP_167(__VA_ARGS__)
+#define _GMP_DROP_169(x, ...) _GMP_DROP_168(__VA_ARGS__)
+#define _GMP_DROP_170(x, ...) _GMP_DROP_169(__VA_ARGS__)
+#define _GMP_DROP_171(x, ...) _GMP_DROP_170(__VA_ARGS__)
+#define _GMP_DROP_172(x, ...) _GMP_DROP_171(__VA_ARGS__)
+#define _GMP_DROP_173(x, ...) _GMP_DROP_172(__VA_ARGS__)
+#define _GMP_DROP_174(x, ...) _GMP_DROP_173(__VA_ARGS__)
+#define _GMP_DROP_175(x, ...) _GMP_DROP_174(__VA_ARGS__)
+#define _GMP_DROP_176(x, ...) _GMP_DROP_175(__VA_ARGS__)
+#define _GMP_DROP_177(x, ...) _GMP_DROP_176(__VA_ARGS__)
+#define _GMP_DROP_178(x, ...) _GMP_DROP_177(__VA_ARGS__)
+#define _GMP_DROP_179(x, ...) _GMP_DROP_178(__VA_ARGS__)
+#define _GMP_DROP_180(x, ...) _GMP_DROP_179(__VA_ARGS__)
+#define _GMP_DROP_181(x, ...) _GMP_DROP_180(__VA_ARGS__)
+#define _GMP_DROP_182(x, ...) _GMP_DROP_181(__VA_ARGS__)
+#define _GMP_DROP_183(x, ...) _GMP_DROP_182(__VA_ARGS__)
+#define _GMP_DROP_184(x, ...) _GMP_DROP_183(__VA_ARGS__)
+#define _GMP_DROP_185(x, ...) _GMP_DROP_184(__VA_ARGS__)
+#define _GMP_DROP_186(x, ...) _GMP_DROP_185(__VA_ARGS__)
+#define _GMP_DROP_187(x, ...) _GMP_DROP_186(__VA_ARGS__)
+#define _GMP_DROP_188(x, ...) _GMP_DROP_187(__VA_ARGS__)
+#define _GMP_DROP_189(x, ...) _GMP_DROP_188(__VA_ARGS__)
+#define _GMP_DROP_190(x, ...) _GMP_DROP_189(__VA_ARGS__)
+#define _GMP_DROP_191(x, ...) _GMP_DROP_190(__VA_ARGS__)
+#define _GMP_DROP_192(x, ...) _GMP_DROP_191(__VA_ARGS__)
+#define _GMP_DROP_193(x, ...) _GMP_DROP_192(__VA_ARGS__)
+#define _GMP_DROP_194(x, ...) _GMP_DROP_193(__VA_ARGS__)
+#define _GMP_DROP_195(x, ...) _GMP_DROP_194(__VA_ARGS__)
+#define _GMP_DROP_196(x, ...) _GMP_DROP_195(__VA_ARGS__)
+#define _GMP_DROP_197(x, ...) _GMP_DROP_196(__VA_ARGS__)
+#define _GMP_DROP_198(x, ...) _GMP_DROP_197(__VA_ARGS__)
+#define _GMP_DROP_199(x, ...) _GMP_DROP_198(__VA_ARGS__)
+#define _GMP_DROP_200(x, ...) _GMP_DROP_199(__VA_ARGS__)
+#define _GMP_DROP_201(x, ...) _GMP_DROP_200(__VA_ARGS__)
+#define _GMP_DROP_202(x, ...) _GMP_DROP_201(__VA_ARGS__)
+#define _GMP_DROP_203(x, ...) _GMP_DROP_202(__VA_ARGS__)
+#define _GMP_DROP_204(x, ...) _GMP_DROP_203(__VA_ARGS__)
+#define _GMP_DROP_205(x, ...) _GMP_DROP_204(__VA_ARGS__)
+#define _GMP_DROP_206(x, ...) _GMP_DROP_205(__VA_ARGS__)
+#define _GMP_DROP_207(x, ...) _GMP_DROP_206(__VA_ARGS__)
+#define _GMP_DROP_208(x, ...) _GMP_DROP_207(__VA_ARGS__)
+#define _GMP_DROP_209(x, ...) _GMP_DROP_208(__VA_ARGS__)
+#define _GMP_DROP_210(x, ...) _GMP_DROP_209(__VA_ARGS__)
+#define _GMP_DROP_211(x, ...) _GMP_DROP_210(__VA_ARGS__)
+#define _GMP_DROP_212(x, ...) _GMP_DROP_211(__VA_ARGS__)
+#define _GMP_DROP_213(x, ...) _GMP_DROP_212(__VA_ARGS__)
+#define _GMP_DROP_214(x, ...) _GMP_DROP_213(__VA_ARGS__)
+#define _GMP_DROP_215(x, ...) _GMP_DROP_214(__VA_ARGS__)
+#define _GMP_DROP_216(x, ...) _GMP_DROP_215(__VA_ARGS__)
+#define _GMP_DROP_217(x, ...) _GMP_DROP_216(__VA_ARGS__)
+#define _GMP_DROP_218(x, ...) _GMP_DROP_217(__VA_ARGS__)
+#define _GMP_DROP_219(x, ...) _GMP_DROP_218(__VA_ARGS__)
+#define _GMP_DROP_220(x, ...) _GMP_DROP_219(__VA_ARGS__)
+#define _GMP_DROP_221(x, ...) _GMP_DROP_220(__VA_ARGS__)
+#define _GMP_DROP_222(x, ...) _GMP_DROP_221(__VA_ARGS__)
+#define _GMP_DROP_223(x, ...) _GMP_DROP_222(__VA_ARGS__)
+#define _GMP_DROP_224(x, ...) _GMP_DROP_223(__VA_ARGS__)
+#define _GMP_DROP_225(x, ...) _GMP_DROP_224(__VA_ARGS__)
+#define _GMP_DROP_226(x, ...) _GMP_DROP_225(__VA_ARGS__)
+#define _GMP_DROP_227(x, ...) _GMP_DROP_226(__VA_ARGS__)
+#define _GMP_DROP_228(x, ...) _GMP_DROP_227(__VA_ARGS__)
+#define _GMP_DROP_229(x, ...) _GMP_DROP_228(__VA_ARGS__)
+#define _GMP_DROP_230(x, ...) _GMP_DROP_229(__VA_ARGS__)
+#define _GMP_DROP_231(x, ...) _GMP_DROP_230(__VA_ARGS__)
+#define _GMP_DROP_232(x, ...) _GMP_DROP_231(__VA_ARGS__)
+#define _GMP_DROP_233(x, ...) _GMP_DROP_232(__VA_ARGS__)
+#define _GMP_DROP_234(x, ...) _GMP_DROP_233(__VA_ARGS__)
+#define _GMP_DROP_235(x, ...) _GMP_DROP_234(__VA_ARGS__)
+#define _GMP_DROP_236(x, ...) _GMP_DROP_235(__VA_ARGS__)
+#define _GMP_DROP_237(x, ...) _GMP_DROP_236(__VA_ARGS__)
+#define _GMP_DROP_238(x, ...) _GMP_DROP_237(__VA_ARGS__)
+#define _GMP_DROP_239(x, ...) _GMP_DROP_238(__VA_ARGS__)
+#define _GMP_DROP_240(x, ...) _GMP_DROP_239(__VA_ARGS__)
+#define _GMP_DROP_241(x, ...) _GMP_DROP_240(__VA_ARGS__)
+#define _GMP_DROP_242(x, ...) _GMP_DROP_241(__VA_ARGS__)
+#define _GMP_DROP_243(x, ...) _GMP_DROP_242(__VA_ARGS__)
+#define _GMP_DROP_244(x, ...) _GMP_DROP_243(__VA_ARGS__)
+#define _GMP_DROP_245(x, ...) _GMP_DROP_244(__VA_ARGS__)
+#define _GMP_DROP_246(x, ...) _GMP_DROP_245(__VA_ARGS__)
+#define _GMP_DROP_247(x, ...) _GMP_DROP_246(__VA_ARGS__)
+#define _GMP_DROP_248(x, ...) _GMP_DROP_247(__VA_ARGS__)
+#define _GMP_DROP_249(x, ...) _GMP_DROP_248(__VA_ARGS__)
+#define _GMP_DROP_250(x, ...) _GMP_DROP_249(__VA_ARGS__)
+#define _GMP_DROP_251(x, ...) _GMP_DROP_250(__VA_ARGS__)
+#define _GMP_DROP_252(x, ...) _GMP_DROP_251(__VA_ARGS__)
+#define _GMP_DROP_253(x, ...) _GMP_DROP_252(__VA_ARGS__)
+#define _GMP_DROP_254(x, ...) _GMP_DROP_253(__VA_ARGS__)
+#define _GMP_DROP_255(x, ...) _GMP_DROP_254(__VA_ARGS__)
+#define _GMP_DROP_256(x, ...) _GMP_DROP_255(__VA_ARGS__)
+#define _GMP_DROP_257(x, ...) _GMP_DROP_256(__VA_ARGS__)
+#define _GMP_DROP_258(x, ...) _GMP_DROP_257(__VA_ARGS__)
+#define _GMP_DROP_259(x, ...) _GMP_DROP_258(__VA_ARGS__)
+#define _GMP_DROP_260(x, ...) _GMP_DROP_259(__VA_ARGS__)
+#define _GMP_DROP_261(x, ...) _GMP_DROP_260(__VA_ARGS__)
+#define _GMP_DROP_262(x, ...) _GMP_DROP_261(__VA_ARGS__)
+#define _GMP_DROP_263(x, ...) _GMP_DROP_262(__VA_ARGS__)
+#define _GMP_DROP_264(x, ...) _GMP_DROP_263(__VA_ARGS__)
+#define _GMP_DROP_265(x, ...) _GMP_DROP_264(__VA_ARGS__)
+#define _GMP_DROP_266(x, ...) _GMP_DROP_265(__VA_ARGS__)
+#define _GMP_DROP_267(x, ...) _GMP_DROP_266(__VA_ARGS__)
+#define _GMP_DROP_268(x, ...) _GMP_DROP_267(__VA_ARGS__)
+#define _GMP_DROP_269(x, ...) _GMP_DROP_268(__VA_ARGS__)
+#define _GMP_DROP_270(x, ...) _GMP_DROP_269(__VA_ARGS__)
+#define _GMP_DROP_271(x, ...) _GMP_DROP_270(__VA_ARGS__)
+#define _GMP_DROP_272(x, ...) _GMP_DROP_271(__VA_ARGS__)
+#define _GMP_DROP_273(x, ...) _GMP_DROP_272(__VA_ARGS__)
+#define _GMP_DROP_274(x, ...) _GMP_DROP_273(__VA_ARGS__)
+#define _GMP_DROP_275(x, ...) _GMP_DROP_274(__VA_ARGS__)
+#define _GMP_DROP_276(x, ...) _GMP_DROP_275(__VA_ARGS__)
+#define _GMP_DROP_277(x, ...) _GMP_DROP_276(__VA_ARGS__)
+#define _GMP_DROP_278(x, ...) _GMP_DROP_277(__VA_ARGS__)
+#define _GMP_DROP_279(x, ...) _GMP_DROP_278(__VA_ARGS__)
+#define _GMP_DROP_280(x, ...) _GMP_DROP_279(__VA_ARGS__)
+#define _GMP_DROP_281(x, ...) _GMP_DROP_280(__VA_ARGS__)
+#define _GMP_DROP_282(x, ...) _GMP_DROP_281(__VA_ARGS__)
+#define _GMP_DROP_283(x, ...) _GMP_DROP_282(__VA_ARGS__)
+#define _GMP_DROP_284(x, ...) _GMP_DROP_283(__VA_ARGS__)
+#define _GMP_DROP_285(x, ...) _GMP_DROP_284(__VA_ARGS__)
+#define _GMP_DROP_286(x, ...) _GMP_DROP_285(__VA_ARGS__)
+#define _GMP_DROP_287(x, ...) _GMP_DROP_286(__VA_ARGS__)
+#define _GMP_DROP_288(x, ...) _GMP_DROP_287(__VA_ARGS__)
+#define _GMP_DROP_289(x, ...) _GMP_DROP_288(__VA_ARGS__)
+#define _GMP_DROP_290(x, ...) _GMP_DROP_289(__VA_ARGS__)
+#define _GMP_DROP_291(x, ...) _GMP_DROP_290(__VA_ARGS__)
+#define _GMP_DROP_292(x, ...) _GMP_DROP_291(__VA_ARGS__)
+#define _GMP_DROP_293(x, ...) _GMP_DROP_292(__VA_ARGS__)
+#define _GMP_DROP_294(x, ...) _GMP_DROP_293(__VA_ARGS__)
+#define _GMP_DROP_295(x, ...) _GMP_DROP_294(__VA_ARGS__)
+#define _GMP_DROP_296(x, ...) _GMP_DROP_295(__VA_ARGS__)
+#define _GMP_DROP_297(x, ...) _GMP_DROP_296(__VA_ARGS__)
+#define _GMP_DROP_298(x, ...) _GMP_DROP_297(__VA_ARGS__)
+#define _GMP_DROP_299(x, ...) _GMP_DROP_298(__VA_ARGS__)
+#define _GMP_DROP_300(x, ...) _GMP_DROP_299(__VA_ARGS__)
+#define _GMP_DROP_301(x, ...) _GMP_DROP_300(__VA_ARGS__)
+#define _GMP_DROP_302(x, ...) _GMP_DROP_301(__VA_ARGS__)
+#define _GMP_DROP_303(x, ...) _GMP_DROP_302(__VA_ARGS__)
+#define _GMP_DROP_304(x, ...) _GMP_DROP_303(__VA_ARGS__)
+#define _GMP_DROP_305(x, ...) _GMP_DROP_304(__VA_ARGS__)
+#define _GMP_DROP_306(x, ...) _GMP_DROP_305(__VA_ARGS__)
+#define _GMP_DROP_307(x, ...) _GMP_DROP_306(__VA_ARGS__)
+#define _GMP_DROP_308(x, ...) _GMP_DROP_307(__VA_ARGS__)
+#define _GMP_DROP_309(x, ...) _GMP_DROP_308(__VA_ARGS__)
+#define _GMP_DROP_310(x, ...) _GMP_DROP_309(__VA_ARGS__)
+#define _GMP_DROP_311(x, ...) _GMP_DROP_310(__VA_ARGS__)
+#define _GMP_DROP_312(x, ...) _GMP_DROP_311(__VA_ARGS__)
+#define _GMP_DROP_313(x, ...) _GMP_DROP_312(__VA_ARGS__)
+#define _GMP_DROP_314(x, ...) _GMP_DROP_313(__VA_ARGS__)
+#define _GMP_DROP_315(x, ...) _GMP_DROP_314(__VA_ARGS__)
+#define _GMP_DROP_316(x, ...) _GMP_DROP_315(__VA_ARGS__)
+#define _GMP_DROP_317(x, ...) _GMP_DROP_316(__VA_ARGS__)
+#define _GMP_DROP_318(x, ...) _GMP_DROP_317(__VA_ARGS__)
+#define _GMP_DROP_319(x, ...) _GMP_DROP_318(__VA_ARGS__)
+#define _GMP_DROP_320(x, ...) _GMP_DROP_319(__VA_ARGS__)
+#define _GMP_DROP_321(x, ...) _GMP_DROP_320(__VA_ARGS__)
+#define _GMP_DROP_322(x, ...) _GMP_DROP_321(__VA_ARGS__)
+#define _GMP_DROP_323(x, ...) _GMP_DROP_322(__VA_ARGS__)
+#define _GMP_DROP_324(x, ...) _GMP_DROP_323(__VA_ARGS__)
+#define _GMP_DROP_325(x, ...) _GMP_DROP_324(__VA_ARGS__)
+#define _GMP_DROP_326(x, ...) _GMP_DROP_325(__VA_ARGS__)
+#define _GMP_DROP_327(x, ...) _GMP_DROP_326(__VA_ARGS__)
+#define _GMP_DROP_328(x, ...) _GMP_DROP_327(__VA_ARGS__)
+#define _GMP_DROP_329(x, ...) _GMP_DROP_328(__VA_ARGS__)
+#define _GMP_DROP_330(x, ...) _GMP_DROP_329(__VA_ARGS__)
+#define _GMP_DROP_331(x, ...) _GMP_DROP_330(__VA_ARGS__)
+#define _GMP_DROP_332(x, ...) _GMP_DROP_331(__VA_ARGS__)
+#define _GMP_DROP_333(x, ...) _GMP_DROP_332(__VA_ARGS__)
+#define _GMP_DROP_334(x, ...) _GMP_DROP_333(__VA_ARGS__)
+#define _GMP_DROP_335(x, ...) _GMP_DROP_334(__VA_ARGS__)
+#define _GMP_DROP_336(x, ...) _GMP_DROP_335(__VA_ARGS__)
+#define _GMP_DROP_337(x, ...) _GMP_DROP_336(__VA_ARGS__)
+#define _GMP_DROP_338(x, ...) _GMP_DROP_337(__VA_ARGS__)
+#define _GMP_DROP_339(x, ...) _GMP_DROP_338(__VA_ARGS__)
+#define _GMP_DROP_340(x, ...) _GMP_DROP_339(__VA_ARGS__)
+#define _GMP_DROP_341(x, ...) _GMP_DROP_340(__VA_ARGS__)
+#define _GMP_DROP_342(x, ...) _GMP_DROP_341(__VA_ARGS__)
+#define _GMP_DROP_343(x, ...) _GMP_DROP_342(__VA_ARGS__)
+#define _GMP_DROP_344(x, ...) _GMP_DROP_343(__VA_ARGS__)
+#define _GMP_DROP_345(x, ...) _GMP_DROP_344(__VA_ARGS__)
+#define _GMP_DROP_346(x, ...) _GMP_DROP_345(__VA_ARGS__)
+#define _GMP_DROP_347(x, ...) _GMP_DROP_346(__VA_ARGS__)
+#define _GMP_DROP_348(x, ...) _GMP_DROP_347(__VA_ARGS__)
+#define _GMP_DROP_349(x, ...) _GMP_DROP_348(__VA_ARGS__)
+#define _GMP_DROP_350(x, ...) _GMP_DROP_349(__VA_ARGS__)
+#define _GMP_DROP_351(x, ...) _GMP_DROP_350(__VA_ARGS__)
+#define _GMP_DROP_352(x, ...) _GMP_DROP_351(__VA_ARGS__)
+#define _GMP_DROP_353(x, ...) _GMP_DROP_352(__VA_ARGS__)
+#define _GMP_DROP_354(x, ...) _GMP_DROP_353(__VA_ARGS__)
+#define _GMP_DROP_355(x, ...) _GMP_DROP_354(__VA_ARGS__)
+#define _GMP_DROP_356(x, ...) _GMP_DROP_355(__VA_ARGS__)
+#define _GMP_DROP_357(x, ...) _GMP_DROP_356(__VA_ARGS__)
+#define _GMP_DROP_358(x, ...) _GMP_DROP_357(__VA_ARGS__)
+#define _GMP_DROP_359(x, ...) _GMP_DROP_358(__VA_ARGS__)
+#define _GMP_DROP_360(x, ...) _GMP_DROP_359(__VA_ARGS__)
+#define _GMP_DROP_361(x, ...) _GMP_DROP_360(__VA_ARGS__)
+#define _GMP_DROP_362(x, ...) _GMP_DROP_361(__VA_ARGS__)
+#define _GMP_DROP_363(x, ...) _GMP_DROP_362(__VA_ARGS__)
+#define _GMP_DROP_364(x, ...) _GMP_DROP_363(__VA_ARGS__)
+#define _GMP_DROP_365(x, ...) _GMP_DROP_364(__VA_ARGS__)
+#define _GMP_DROP_366(x, ...) _GMP_DROP_365(__VA_ARGS__)
+#define _GMP_DROP_367(x, ...) _GMP_DROP_366(__VA_ARGS__)
+#define _GMP_DROP_368(x, ...) _GMP_DROP_367(__VA_ARGS__)
+#define _GMP_DROP_369(x, ...) _GMP_DROP_368(__VA_ARGS__)
+#define _GMP_DROP_370(x, ...) _GMP_DROP_369(__VA_ARGS__)
+#define _GMP_DROP_371(x, ...) _GMP_DROP_370(__VA_ARGS__)
+#define _GMP_DROP_372(x, ...) _GMP_DROP_371(__VA_ARGS__)
+#define _GMP_DROP_373(x, ...) _GMP_DROP_372(__VA_ARGS__)
+#define _GMP_DROP_374(x, ...) _GMP_DROP_373(__VA_ARGS__)
+#define _GMP_DROP_375(x, ...) _GMP_DROP_374(__VA_ARGS__)
+#define _GMP_DROP_376(x, ...) _GMP_DROP_375(__VA_ARGS__)
+#define _GMP_DROP_377(x, ...) _GMP_DROP_376(__VA_ARGS__)
+#define _GMP_DROP_378(x, ...) _GMP_DROP_377(__VA_ARGS__)
+#define _GMP_DROP_379(x, ...) _GMP_DROP_378(__VA_ARGS__)
+#define _GMP_DROP_380(x, ...) _GMP_DROP_379(__VA_ARGS__)
+#define _GMP_DROP_381(x, ...) _GMP_DROP_380(__VA_ARGS__)
+#define _GMP_DROP_382(x, ...) _GMP_DROP_381(__VA_ARGS__)
+#define _GMP_DROP_383(x, ...) _GMP_DROP_382(__VA_ARGS__)
+#define _GMP_DROP_384(x, ...) _GMP_DROP_383(__VA_ARGS__)
+#define _GMP_DROP_385(x, ...) _GMP_DROP_384(__VA_ARGS__)
+#define _GMP_DROP_386(x, ...) _GMP_DROP_385(__VA_ARGS__)
+#define _GMP_DROP_387(x, ...) _GMP_DROP_386(__VA_ARGS__)
+#define _GMP_DROP_388(x, ...) _GMP_DROP_387(__VA_ARGS__)
+#define _GMP_DROP_389(x, ...) _GMP_DROP_388(__VA_ARGS__)
+#define _GMP_DROP_390(x, ...) _GMP_DROP_389(__VA_ARGS__)
+#define _GMP_DROP_391(x, ...) _GMP_DROP_390(__VA_ARGS__)
+#define _GMP_DROP_392(x, ...) _GMP_DROP_391(__VA_ARGS__)
+#define _GMP_DROP_393(x, ...) _GMP_DROP_392(__VA_ARGS__)
+#define _GMP_DROP_394(x, ...) _GMP_DROP_393(__VA_ARGS__)
+#define _GMP_DROP_395(x, ...) _GMP_DROP_394(__VA_ARGS__)
+#define _GMP_DROP_396(x, ...) _GMP_DROP_395(__VA_ARGS__)
+#define _GMP_DROP_397(x, ...) _GMP_DROP_396(__VA_ARGS__)
+#define _GMP_DROP_398(x, ...) _GMP_DROP_397(__VA_ARGS__)
+#define _GMP_DROP_399(x, ...) _GMP_DROP_398(__VA_ARGS__)
+#define _GMP_DROP_400(x, ...) _GMP_DROP_399(__VA_ARGS__)
+#define _GMP_DROP_401(x, ...) _GMP_DROP_400(__VA_ARGS__)
+#define _GMP_DROP_402(x, ...) _GMP_DROP_401(__VA_ARGS__)
+#define _GMP_DROP_403(x, ...) _GMP_DROP_402(__VA_ARGS__)
+#define _GMP_DROP_404(x, ...) _GMP_DROP_403(__VA_ARGS__)
+#define _GMP_DROP_405(x, ...) _GMP_DROP_404(__VA_ARGS__)
+#define _GMP_DROP_406(x, ...) _GMP_DROP_405(__VA_ARGS__)
+#define _GMP_DROP_407(x, ...) _GMP_DROP_406(__VA_ARGS__)
+#define _GMP_DROP_408(x, ...) _GMP_DROP_407(__VA_ARGS__)
+#define _GMP_DROP_409(x, ...) _GMP_DROP_408(__VA_ARGS__)
+#define _GMP_DROP_410(x, ...) _GMP_DROP_409(__VA_ARGS__)
+#define _GMP_DROP_411(x, ...) _GMP_DROP_410(__VA_ARGS__)
+#define _GMP_DROP_412(x, ...) _GMP_DROP_411(__VA_ARGS__)
+#define _GMP_DROP_413(x, ...) _GMP_DROP_412(__VA_ARGS__)
+#define _GMP_DROP_414(x, ...) _GMP_DROP_413(__VA_ARGS__)
+#define _GMP_DROP_415(x, ...) _GMP_DROP_414(__VA_ARGS__)
+#define _GMP_DROP_416(x, ...) _GMP_DROP_415(__VA_ARGS__)
+#define _GMP_DROP_417(x, ...) _GMP_DROP_416(__VA_ARGS__)
+#define _GMP_DROP_418(x, ...) _GMP_DROP_417(__VA_ARGS__)
+#define _GMP_DROP_419(x, ...) _GMP_DROP_418(__VA_ARGS__)
+#define _GMP_DROP_420(x, ...) _GMP_DROP_419(__VA_ARGS__)
+#define _GMP_DROP_421(x, ...) _GMP_DROP_420(__VA_ARGS__)
+#define _GMP_DROP_422(x, ...) _GMP_DROP_421(__VA_ARGS__)
+#define _GMP_DROP_423(x, ...) _GMP_DROP_422(__VA_ARGS__)
+#define _GMP_DROP_424(x, ...) _GMP_DROP_423(__VA_ARGS__)
+#define _GMP_DROP_425(x, ...) _GMP_DROP_424(__VA_ARGS__)
+#define _GMP_DROP_426(x, ...) _GMP_DROP_425(__VA_ARGS__)
+#define _GMP_DROP_427(x, ...) _GMP_DROP_426(__VA_ARGS__)
+#define _GMP_DROP_428(x, ...) _GMP_DROP_427(__VA_ARGS__)
+#define _GMP_DROP_429(x, ...) _GMP_DROP_428(__VA_ARGS__)
+#define _GMP_DROP_430(x, ...) _GMP_DROP_429(__VA_ARGS__)
+#define _GMP_DROP_431(x, ...) _GMP_DROP_430(__VA_ARGS__)
+#define _GMP_DROP_432(x, ...) _GMP_DROP_431(__VA_ARGS__)
+#define _GMP_DROP_433(x, ...) _GMP_DROP_432(__VA_ARGS__)
+#define _GMP_DROP_434(x, ...) _GMP_DROP_433(__VA_ARGS__)
+#define _GMP_DROP_435(x, ...) _GMP_DROP_434(__VA_ARGS__)
+#define _GMP_DROP_436(x, ...) _GMP_DROP_435(__VA_ARGS__)
+#define _GMP_DROP_437(x, ...) _GMP_DROP_436(__VA_ARGS__)
+#define _GMP_DROP_438(x, ...) _GMP_DROP_437(__VA_ARGS__)
+#define _GMP_DROP_439(x, ...) _GMP_DROP_438(__VA_ARGS__)
+#define _GMP_DROP_440(x, ...) _GMP_DROP_439(__VA_ARGS__)
+#define _GMP_DROP_441(x, ...) _GMP_DROP_440(__VA_ARGS__)
+#define _GMP_DROP_442(x, ...) _GMP_DROP_441(__VA_ARGS__)
+#define _GMP_DROP_443(x, ...) _GMP_DROP_442(__VA_ARGS__)
+#define _GMP_DROP_444(x, ...) _GMP_DROP_443(__VA_ARGS__)
+#define _GMP_DROP_445(x, ...) _GMP_DROP_444(__VA_ARGS__)
+#define _GMP_DROP_446(x, ...) _GMP_DROP_445(__VA_ARGS__)
+#define _GMP_DROP_447(x, ...) _GMP_DROP_446(__VA_ARGS__)
+#define _GMP_DROP_448(x, ...) _GMP_DROP_447(__VA_ARGS__)
+#define _GMP_DROP_449(x, ...) _GMP_DROP_448(__VA_ARGS__)
+#define _GMP_DROP_450(x, ...) _GMP_DROP_449(__VA_ARGS__)
+#define _GMP_DROP_451(x, ...) _GMP_DROP_450(__VA_ARGS__)
+#define _GMP_DROP_452(x, ...) _GMP_DROP_451(__VA_ARGS__)
+#define _GMP_DROP_453(x, ...) _GMP_DROP_452(__VA_ARGS__)
+#define _GMP_DROP_454(x, ...) _GMP_DROP_453(__VA_ARGS__)
+#define _GMP_DROP_455(x, ...) _GMP_DROP_454(__VA_ARGS__)
+#define _GMP_DROP_456(x, ...) _GMP_DROP_455(__VA_ARGS__)
+#define _GMP_DROP_457(x, ...) _GMP_DROP_456(__VA_ARGS__)
+#define _GMP_DROP_458(x, ...) _GMP_DROP_457(__VA_ARGS__)
+#define _GMP_DROP_459(x, ...) _GMP_DROP_458(__VA_ARGS__)
+#define _GMP_DROP_460(x, ...) _GMP_DROP_459(__VA_ARGS__)
+#define _GMP_DROP_461(x, ...) _GMP_DROP_460(__VA_ARGS__)
+#define _GMP_DROP_462(x, ...) _GMP_DROP_461(__VA_ARGS__)
+#define _GMP_DROP_463(x, ...) _GMP_DROP_462(__VA_ARGS__)
+#define _GMP_DROP_464(x, ...) _GMP_DROP_463(__VA_ARGS__)
+#define _GMP_DROP_465(x, ...) _GMP_DROP_464(__VA_ARGS__)
+#define _GMP_DROP_466(x, ...) _GMP_DROP_465(__VA_ARGS__)
+#define _GMP_DROP_467(x, ...) _GMP_DROP_466(__VA_ARGS__)
+#define _GMP_DROP_468(x, ...) _GMP_DROP_467(__VA_ARGS__)
+#define _GMP_DROP_469(x, ...) _GMP_DROP_468(__VA_ARGS__)
+#define _GMP_DROP_470(x, ...) _GMP_DROP_469(__VA_ARGS__)
+#define _GMP_DROP_471(x, ...) _GMP_DROP_470(__VA_ARGS__)
+#define _GMP_DROP_472(x, ...) _GMP_DROP_471(__VA_ARGS__)
+#define _GMP_DROP_473(x, ...) _GMP_DROP_472(__VA_ARGS__)
+#define _GMP_DROP_474(x, ...) _GMP_DROP_473(__VA_ARGS__)
+#define _GMP_DROP_475(x, ...) _GMP_DROP_474(__VA_ARGS__)
+#define _GMP_DROP_476(x, ...) _GMP_DROP_475(__VA_ARGS__)
+#define _GMP_DROP_477(x, ...) _GMP_DROP_476(__VA_ARGS__)
+#define _GMP_DROP_478(x, ...) _GMP_DROP_477(__VA_ARGS__)
+#define _GMP_DROP_479(x, ...) _GMP_DROP_478(__VA_ARGS__)
+#define _GMP_DROP_480(x, ...) _GMP_DROP_479(__VA_ARGS__)
+#define _GMP_DROP_481(x, ...) _GMP_DROP_480(__VA_ARGS__)
+#define _GMP_DROP_482(x, ...) _GMP_DROP_481(__VA_ARGS__)
+#define _GMP_DROP_483(x, ...) _GMP_DROP_482(__VA_ARGS__)
+#define _GMP_DROP_484(x, ...) _GMP_DROP_483(__VA_ARGS__)
+#define _GMP_DROP_485(x, ...) _GMP_DROP_484(__VA_ARGS__)
+#define _GMP_DROP_486(x, ...) _GMP_DROP_485(__VA_ARGS__)
+#define _GMP_DROP_487(x, ...) _GMP_DROP_486(__VA_ARGS__)
+#define _GMP_DROP_488(x, ...) _GMP_DROP_487(__VA_ARGS__)
+#define _GMP_DROP_489(x, ...) _GMP_DROP_488(__VA_ARGS__)
+#define _GMP_DROP_490(x, ...) _GMP_DROP_489(__VA_ARGS__)
+#define _GMP_DROP_491(x, ...) _GMP_DROP_490(__VA_ARGS__)
+#define _GMP_DROP_492(x, ...) _GMP_DROP_491(__VA_ARGS__)
+#define _GMP_DROP_493(x, ...) _GMP_DROP_492(__VA_ARGS__)
+#define _GMP_DROP_494(x, ...) _GMP_DROP_493(__VA_ARGS__)
+#define _GMP_DROP_495(x, ...) _GMP_DROP_494(__VA_ARGS__)
+#define _GMP_DROP_496(x, ...) _GMP_DROP_495(__VA_ARGS__)
+#define _GMP_DROP_497(x, ...) _GMP_DROP_496(__VA_ARGS__)
+#define _GMP_DROP_498(x, ...) _GMP_DROP_497(__VA_ARGS__)
+#define _GMP_DROP_499(x, ...) _GMP_DROP_498(__VA_ARGS__)
+#define _GMP_DROP_500(x, ...) _GMP_DROP_499(__VA_ARGS__)
+#define _GMP_DROP_501(x, ...) _GMP_DROP_500(__VA_ARGS__)
+#define _GMP_DROP_502(x, ...) _GMP_DROP_501(__VA_ARGS__)
+#define _GMP_DROP_503(x, ...) _GMP_DROP_502(__VA_ARGS__)
+#define _GMP_DROP_504(x, ...) _GMP_DROP_503(__VA_ARGS__)
+#define _GMP_DROP_505(x, ...) _GMP_DROP_504(__VA_ARGS__)
+#define _GMP_DROP_506(x, ...) _GMP_DROP_505(__VA_ARGS__)
+#define _GMP_DROP_507(x, ...) _GMP_DROP_506(__VA_ARGS__)
+#define _GMP_DROP_508(x, ...) _GMP_DROP_507(__VA_ARGS__)
+#define _GMP_DROP_509(x, ...) _GMP_DROP_508(__VA_ARGS__)
+#define _GMP_DROP_510(x, ...) _GMP_DROP_509(__VA_ARGS__)
+#define _GMP_DROP_511(x, ...) _GMP_DROP_510(__VA_ARGS__)
+#define _GMP_DROP_512(x, ...) _GMP_DROP_511(__VA_ARGS__)
+#define _GMP_DROP_513(x, ...) _GMP_DROP_512(__VA_ARGS__)
+#define _GMP_DROP_514(x, ...) _GMP_DROP_513(__VA_ARGS__)
+#define _GMP_DROP_515(x, ...) _GMP_DROP_514(__VA_ARGS__)
+#define _GMP_DROP_516(x, ...) _GMP_DROP_515(__VA_ARGS__)
+#define _GMP_DROP_517(x, ...) _GMP_DROP_516(__VA_ARGS__)
+#define _GMP_DROP_518(x, ...) _GMP_DROP_517(__VA_ARGS__)
+#define _GMP_DROP_519(x, ...) _GMP_DROP_518(__VA_ARGS__)
+#define _GMP_DROP_520(x, ...) _GMP_DROP_519(__VA_ARGS__)
+#define _GMP_DROP_521(x, ...) _GMP_DROP_520(__VA_ARGS__)
+#define _GMP_DROP_522(x, ...) _GMP_DROP_521(__VA_ARGS__)
+#define _GMP_DROP_523(x, ...) _GMP_DROP_522(__VA_ARGS__)
+#define _GMP_DROP_524(x, ...) _GMP_DROP_523(__VA_ARGS__)
+#define _GMP_DROP_525(x, ...) _GMP_DROP_524(__VA_ARGS__)
+#define _GMP_DROP_526(x, ...) _GMP_DROP_525(__VA_ARGS__)
+#define _GMP_DROP_527(x, ...) _GMP_DROP_526(__VA_ARGS__)
+#define _GMP_DROP_528(x, ...) _GMP_DROP_527(__VA_ARGS__)
+#define _GMP_DROP_529(x, ...) _GMP_DROP_528(__VA_ARGS__)
+#define _GMP_DROP_530(x, ...) _GMP_DROP_529(__VA_ARGS__)
+#define _GMP_DROP_531(x, ...) _GMP_DROP_530(__VA_ARGS__)
+#define _GMP_DROP_532(x, ...) _GMP_DROP_531(__VA_ARGS__)
+#define _GMP_DROP_533(x, ...) _GMP_DROP_532(__VA_ARGS__)
+#define _GMP_DROP_534(x, ...) _GMP_DROP_533(__VA_ARGS__)
+#define _GMP_DROP_535(x, ...) _GMP_DROP_534(__VA_ARGS__)
+#define _GMP_DROP_536(x, ...) _GMP_DROP_535(__VA_ARGS__)
+#define _GMP_DROP_537(x, ...) _GMP_DROP_536(__VA_ARGS__)
+#define _GMP_DROP_538(x, ...) _GMP_DROP_537(__VA_ARGS__)
+#define _GMP_DROP_539(x, ...) _GMP_DROP_538(__VA_ARGS__)
+#define _GMP_DROP_540(x, ...) _GMP_DROP_539(__VA_ARGS__)
+#define _GMP_DROP_541(x, ...) _GMP_DROP_540(__VA_ARGS__)
+#define _GMP_DROP_542(x, ...) _GMP_DROP_541(__VA_ARGS__)
+#define _GMP_DROP_543(x, ...) _GMP_DROP_542(__VA_ARGS__)
+#define _GMP_DROP_544(x, ...) _GMP_DROP_543(__VA_ARGS__)
+#define _GMP_DROP_545(x, ...) _GMP_DROP_544(__VA_ARGS__)
+#define _GMP_DROP_546(x, ...) _GMP_DROP_545(__VA_ARGS__)
+#define _GMP_DROP_547(x, ...) _GMP_DROP_546(__VA_ARGS__)
+#define _GMP_DROP_548(x, ...) _GMP_DROP_547(__VA_ARGS__)
+#define _GMP_DROP_549(x, ...) _GMP_DROP_548(__VA_ARGS__)
+#define _GMP_DROP_550(x, ...) _GMP_DROP_549(__VA_ARGS__)
+#define _GMP_DROP_551(x, ...) _GMP_DROP_550(__VA_ARGS__)
+#define _GMP_DROP_552(x, ...) _GMP_DROP_551(__VA_ARGS__)
+#define _GMP_DROP_553(x, ...) _GMP_DROP_552(__VA_ARGS__)
+#define _GMP_DROP_554(x, ...) _GMP_DROP_553(__VA_ARGS__)
+#define _GMP_DROP_555(x, ...) _GMP_DROP_554(__VA_ARGS__)
+#define _GMP_DROP_556(x, ...) _GMP_DROP_555(__VA_ARGS__)
+#define _GMP_DROP_557(x, ...) _GMP_DROP_556(__VA_ARGS__)
+#define _GMP_DROP_558(x, ...) _GMP_DROP_557(__VA_ARGS__)
+#define _GMP_DROP_559(x, ...) _GMP_DROP_558(__VA_ARGS__)
+#define _GMP_DROP_560(x, ...) _GMP_DROP_559(__VA_ARGS__)
+#define _GMP_DROP_561(x, ...) _GMP_DROP_560(__VA_ARGS__)
+#define _GMP_DROP_562(x, ...) _GMP_DROP_561(__VA_ARGS__)
+#define _GMP_DROP_563(x, ...) _GMP_DROP_562(__VA_ARGS__)
+#define _GMP_DROP_564(x, ...) _GMP_DROP_563(__VA_ARGS__)
+#define _GMP_DROP_565(x, ...) _GMP_DROP_564(__VA_ARGS__)
+#define _GMP_DROP_566(x, ...) _GMP_DROP_565(__VA_ARGS__)
+#define _GMP_DROP_567(x, ...) _GMP_DROP_566(__VA_ARGS__)
+#define _GMP_DROP_568(x, ...) _GMP_DROP_567(__VA_ARGS__)
+#define _GMP_DROP_569(x, ...) _GMP_DROP_568(__VA_ARGS__)
+#define _GMP_DROP_570(x, ...) _GMP_DROP_569(__VA_ARGS__)
+#define _GMP_DROP_571(x, ...) _GMP_DROP_570(__VA_ARGS__)
+#define _GMP_DROP_572(x, ...) _GMP_DROP_571(__VA_ARGS__)
+#define _GMP_DROP_573(x, ...) _GMP_DROP_572(__VA_ARGS__)
+#define _GMP_DROP_574(x, ...) _GMP_DROP_573(__VA_ARGS__)
+#define _GMP_DROP_575(x, ...) _GMP_DROP_574(__VA_ARGS__)
+#define _GMP_DROP_576(x, ...) _GMP_DROP_575(__VA_ARGS__)
+#define _GMP_DROP_577(x, ...) _GMP_DROP_576(__VA_ARGS__)
+#define _GMP_DROP_578(x, ...) _GMP_DROP_577(__VA_ARGS__)
+#define _GMP_DROP_579(x, ...) _GMP_DROP_578(__VA_ARGS__)
+#define _GMP_DROP_580(x, ...) _GMP_DROP_579(__VA_ARGS__)
+#define _GMP_DROP_581(x, ...) _GMP_DROP_580(__VA_ARGS__)
+#define _GMP_DROP_582(x, ...) _GMP_DROP_581(__VA_ARGS__)
+#define _GMP_DROP_583(x, ...) _GMP_DROP_582(__VA_ARGS__)
+#define _GMP_DROP_584(x, ...) _GMP_DROP_583(__VA_ARGS__)
+#define _GMP_DROP_585(x, ...) _GMP_DROP_584(__VA_ARGS__)
+#define _GMP_DROP_586(x, ...) _GMP_DROP_585(__VA_ARGS__)
+#define _GMP_DROP_587(x, ...) _GMP_DROP_586(__VA_ARGS__)
+#define _GMP_DROP_588(x, ...) _GMP_DROP_587(__VA_ARGS__)
+#define _GMP_DROP_589(x, ...) _GMP_DROP_588(__VA_ARGS__)
+#define _GMP_DROP_590(x, ...) _GMP_DROP_589(__VA_ARGS__)
+#define _GMP_DROP_591(x, ...) _GMP_DROP_590(__VA_ARGS__)
+#define _GMP_DROP_592(x, ...) _GMP_DROP_591(__VA_ARGS__)
+#define _GMP_DROP_593(x, ...) _GMP_DROP_592(__VA_ARGS__)
+#define _GMP_DROP_594(x, ...) _GMP_DROP_593(__VA_ARGS__)
+#define _GMP_DROP_595(x, ...) _GMP_DROP_594(__VA_ARGS__)
+#define _GMP_DROP_596(x, ...) _GMP_DROP_595(__VA_ARGS__)
+#define _GMP_DROP_597(x, ...) _GMP_DROP_596(__VA_ARGS__)
+#define _GMP_DROP_598(x, ...) _GMP_DROP_597(__VA_ARGS__)
+#define _GMP_DROP_599(x, ...) _GMP_DROP_598(__VA_ARGS__)
+#define _GMP_DROP_600(x, ...) _GMP_DROP_599(__VA_ARGS__)
+#define _GMP_DROP_601(x, ...) _GMP_DROP_600(__VA_ARGS__)
+#define _GMP_DROP_602(x, ...) _GMP_DROP_601(__VA_ARGS__)
+#define _GMP_DROP_603(x, ...) _GMP_DROP_602(__VA_ARGS__)
+#define _GMP_DROP_604(x, ...) _GMP_DROP_603(__VA_ARGS__)
+#define _GMP_DROP_605(x, ...) _GMP_DROP_604(__VA_ARGS__)
+#define _GMP_DROP_606(x, ...) _GMP_DROP_605(__VA_ARGS__)
+#define _GMP_DROP_607(x, ...) _GMP_DROP_606(__VA_ARGS__)
+#define _GMP_DROP_608(x, ...) _GMP_DROP_607(__VA_ARGS__)
+#define _GMP_DROP_609(x, ...) _GMP_DROP_608(__VA_ARGS__)
+#define _GMP_DROP_610(x, ...) _GMP_DROP_609(__VA_ARGS__)
+#define _GMP_DROP_611(x, ...) _GMP_DROP_610(__VA_ARGS__)
+#define _GMP_DROP_612(x, ...) _GMP_DROP_611(__VA_ARGS__)
+#define _GMP_DROP_613(x, ...) _GMP_DROP_612(__VA_ARGS__)
+#define _GMP_DROP_614(x, ...) _GMP_DROP_613(__VA_ARGS__)
+#define _GMP_DROP_615(x, ...) _GMP_DROP_614(__VA_ARGS__)
+#define _GMP_DROP_616(x, ...) _GMP_DROP_615(__VA_ARGS__)
+#define _GMP_DROP_617(x, ...) _GMP_DROP_616(__VA_ARGS__)
+#define _GMP_DROP_618(x, ...) _GMP_DROP_617(__VA_ARGS__)
+#define _GMP_DROP_619(x, ...) _GMP_DROP_618(__VA_ARGS__)
+#define _GMP_DROP_620(x, ...) _GMP_DROP_619(__VA_ARGS__)
+#define _GMP_DROP_621(x, ...) _GMP_DROP_620(__VA_ARGS__)
+#define _GMP_DROP_622(x, ...) _GMP_DROP_621(__VA_ARGS__)
+#define _GMP_DROP_623(x, ...) _GMP_DROP_622(__VA_ARGS__)
+#define _GMP_DROP_624(x, ...) _GMP_DROP_623(__VA_ARGS__)
+#define _GMP_DROP_625(x, ...) _GMP_DROP_624(__VA_ARGS__)
+#define _GMP_DROP_626(x, ...) _GMP_DROP_625(__VA_ARGS__)
+#define _GMP_DROP_627(x, ...) _GMP_DROP_626(__VA_ARGS__)
+#define _GMP_DROP_628(x, ...) _GMP_DROP_627(__VA_ARGS__)
+#define _GMP_DROP_629(x, ...) _GMP_DROP_628(__VA_ARGS__)
+#define _GMP_DROP_630(x, ...) _GMP_DROP_629(__VA_ARGS__)
+#define _GMP_DROP_631(x, ...) _GMP_DROP_630(__VA_ARGS__)
+#define _GMP_DROP_632(x, ...) _GMP_DROP_631(__VA_ARGS__)
+#define _GMP_DROP_633(x, ...) _GMP_DROP_632(__VA_ARGS__)
+#define _GMP_DROP_634(x, ...) _GMP_DROP_633(__VA_ARGS__)
+#define _GMP_DROP_635(x, ...) _GMP_DROP_634(__VA_ARGS__)
+#define _GMP_DROP_636(x, ...) _GMP_DROP_635(__VA_ARGS__)
+#define _GMP_DROP_637(x, ...) _GMP_DROP_636(__VA_ARGS__)
+#define _GMP_DROP_638(x, ...) _GMP_DROP_637(__VA_ARGS__)
+#define _GMP_DROP_639(x, ...) _GMP_DROP_638(__VA_ARGS__)
+#define _GMP_DROP_640(x, ...) _GMP_DROP_639(__VA_ARGS__)
+#define _GMP_DROP_641(x, ...) _GMP_DROP_640(__VA_ARGS__)
+#define _GMP_DROP_642(x, ...) _GMP_DROP_641(__VA_ARGS__)
+#define _GMP_DROP_643(x, ...) _GMP_DROP_642(__VA_ARGS__)
+#define _GMP_DROP_644(x, ...) _GMP_DROP_643(__VA_ARGS__)
+#define _GMP_DROP_645(x, ...) _GMP_DROP_644(__VA_ARGS__)
+#define _GMP_DROP_646(x, ...) _GMP_DROP_645(__VA_ARGS__)
+#define _GMP_DROP_647(x, ...) _GMP_DROP_646(__VA_ARGS__)
+#define _GMP_DROP_648(x, ...) _GMP_DROP_647(__VA_ARGS__)
+#define _GMP_DROP_649(x, ...) _GMP_DROP_648(__VA_ARGS__)
+#define _GMP_DROP_650(x, ...) _GMP_DROP_649(__VA_ARGS__)
+#define _GMP_DROP_651(x, ...) _GMP_DROP_650(__VA_ARGS__)
+#define _GMP_DROP_652(x, ...) _GMP_DROP_651(__VA_ARGS__)
+#define _GMP_DROP_653(x, ...) _GMP_DROP_652(__VA_ARGS__)
+#define _GMP_DROP_654(x, ...) _GMP_DROP_653(__VA_ARGS__)
+#define _GMP_DROP_655(x, ...) _GMP_DROP_654(__VA_ARGS__)
+#define _GMP_DROP_656(x, ...) _GMP_DROP_655(__VA_ARGS__)
+#define _GMP_DROP_657(x, ...) _GMP_DROP_656(__VA_ARGS__)
+#define _GMP_DROP_658(x, ...) _GMP_DROP_657(__VA_ARGS__)
+#define _GMP_DROP_659(x, ...) _GMP_DROP_658(__VA_ARGS__)
+#define _GMP_DROP_660(x, ...) _GMP_DROP_659(__VA_ARGS__)
+#define _GMP_DROP_661(x, ...) _GMP_DROP_660(__VA_ARGS__)
+#define _GMP_DROP_662(x, ...) _GMP_DROP_661(__VA_ARGS__)
+#define _GMP_DROP_663(x, ...) _GMP_DROP_662(__VA_ARGS__)
+#define _GMP_DROP_664(x, ...) _GMP_DROP_663(__VA_ARGS__)
+#define _GMP_DROP_665(x, ...) _GMP_DROP_664(__VA_ARGS__)
+#define _GMP_DROP_666(x, ...) _GMP_DROP_665(__VA_ARGS__)
+#define _GMP_DROP_667(x, ...) _GMP_DROP_666(__VA_ARGS__)
+#define _GMP_DROP_668(x, ...) _GMP_DROP_667(__VA_ARGS__)
+#define _GMP_DROP_669(x, ...) _GMP_DROP_668(__VA_ARGS__)
+#define _GMP_DROP_670(x, ...) _GMP_DROP_669(__VA_ARGS__)
+#define _GMP_DROP_671(x, ...) _GMP_DROP_670(__VA_ARGS__)
+#define _GMP_DROP_672(x, ...) _GMP_DROP_671(__VA_ARGS__)
+#define _GMP_DROP_673(x, ...) _GMP_DROP_672(__VA_ARGS__)
+#define _GMP_DROP_674(x, ...) _GMP_DROP_673(__VA_ARGS__)
+#define _GMP_DROP_675(x, ...) _GMP_DROP_674(__VA_ARGS__)
+#define _GMP_DROP_676(x, ...) _GMP_DROP_675(__VA_ARGS__)
+#define _GMP_DROP_677(x, ...) _GMP_DROP_676(__VA_ARGS__)
+#define _GMP_DROP_678(x, ...) _GMP_DROP_677(__VA_ARGS__)
+#define _GMP_DROP_679(x, ...) _GMP_DROP_678(__VA_ARGS__)
+#define _GMP_DROP_680(x, ...) _GMP_DROP_679(__VA_ARGS__)
+#define _GMP_DROP_681(x, ...) _GMP_DROP_680(__VA_ARGS__)
+#define _GMP_DROP_682(x, ...) _GMP_DROP_681(__VA_ARGS__)
+#define _GMP_DROP_683(x, ...) _GMP_DROP_682(__VA_ARGS__)
+#define _GMP_DROP_684(x, ...) _GMP_DROP_683(__VA_ARGS__)
+#define _GMP_DROP_685(x, ...) _GMP_DROP_684(__VA_ARGS__)
+#define _GMP_DROP_686(x, ...) _GMP_DROP_685(__VA_ARGS__)
+#define _GMP_DROP_687(x, ...) _GMP_DROP_686(__VA_ARGS__)
+#define _GMP_DROP_688(x, ...) _GMP_DROP_687(__VA_ARGS__)
+#define _GMP_DROP_689(x, ...) _GMP_DROP_688(__VA_ARGS__)
+#define _GMP_DROP_690(x, ...) _GMP_DROP_689(__VA_ARGS__)
+#define _GMP_DROP_691(x, ...) _GMP_DROP_690(__VA_ARGS__)
+#define _GMP_DROP_692(x, ...) _GMP_DROP_691(__VA_ARGS__)
+#define _GMP_DROP_693(x, ...) _GMP_DROP_692(__VA_ARGS__)
+#define _GMP_DROP_694(x, ...) _GMP_DROP_693(__VA_ARGS__)
+#define _GMP_DROP_695(x, ...) _GMP_DROP_694(__VA_ARGS__)
+#define _GMP_DROP_696(x, ...) _GMP_DROP_695(__VA_ARGS__)
+#define _GMP_DROP_697(x, ...) _GMP_DROP_696(__VA_ARGS__)
+#define _GMP_DROP_698(x, ...) _GMP_DROP_697(__VA_ARGS__)
+#define _GMP_DROP_699(x, ...) _GMP_DROP_698(__VA_ARGS__)
+#define _GMP_DROP_700(x, ...) _GMP_DROP_699(__VA_ARGS__)
+#define _GMP_DROP_701(x, ...) _GMP_DROP_700(__VA_ARGS__)
+#define _GMP_DROP_702(x, ...) _GMP_DROP_701(__VA_ARGS__)
+#define _GMP_DROP_703(x, ...) _GMP_DROP_702(__VA_ARGS__)
+#define _GMP_DROP_704(x, ...) _GMP_DROP_703(__VA_ARGS__)
+#define _GMP_DROP_705(x, ...) _GMP_DROP_704(__VA_ARGS__)
+#define _GMP_DROP_706(x, ...) _GMP_DROP_705(__VA_ARGS__)
+#define _GMP_DROP_707(x, ...) _GMP_DROP_706(__VA_ARGS__)
+#define _GMP_DROP_708(x, ...) _GMP_DROP_707(__VA_ARGS__)
+#define _GMP_DROP_709(x, ...) _GMP_DROP_708(__VA_ARGS__)
+#define _GMP_DROP_710(x, ...) _GMP_DROP_709(__VA_ARGS__)
+#define _GMP_DROP_711(x, ...) _GMP_DROP_710(__VA_ARGS__)
+#define _GMP_DROP_712(x, ...) _GMP_DROP_711(__VA_ARGS__)
+#define _GMP_DROP_713(x, ...) _GMP_DROP_712(__VA_ARGS__)
+#define _GMP_DROP_714(x, ...) _GMP_DROP_713(__VA_ARGS__)
+#define _GMP_DROP_715(x, ...) _GMP_DROP_714(__VA_ARGS__)
+#define _GMP_DROP_716(x, ...) _GMP_DROP_715(__VA_ARGS__)
+#define _GMP_DROP_717(x, ...) _GMP_DROP_716(__VA_ARGS__)
+#define _GMP_DROP_718(x, ...) _GMP_DROP_717(__VA_ARGS__)
+#define _GMP_DROP_719(x, ...) _GMP_DROP_718(__VA_ARGS__)
+#define _GMP_DROP_720(x, ...) _GMP_DROP_719(__VA_ARGS__)
+#define _GMP_DROP_721(x, ...) _GMP_DROP_720(__VA_ARGS__)
+#define _GMP_DROP_722(x, ...) _GMP_DROP_721(__VA_ARGS__)
+#define _GMP_DROP_723(x, ...) _GMP_DROP_722(__VA_ARGS__)
+#define _GMP_DROP_724(x, ...) _GMP_DROP_723(__VA_ARGS__)
+#define _GMP_DROP_725(x, ...) _GMP_DROP_724(__VA_ARGS__)
+#define _GMP_DROP_726(x, ...) _GMP_DROP_725(__VA_ARGS__)
+#define _GMP_DROP_727(x, ...) _GMP_DROP_726(__VA_ARGS__)
+#define _GMP_DROP_728(x, ...) _GMP_DROP_727(__VA_ARGS__)
+#define _GMP_DROP_729(x, ...) _GMP_DROP_728(__VA_ARGS__)
+#define _GMP_DROP_730(x, ...) _GMP_DROP_729(__VA_ARGS__)
+#define _GMP_DROP_731(x, ...) _GMP_DROP_730(__VA_ARGS__)
+#define _GMP_DROP_732(x, ...) _GMP_DROP_731(__VA_ARGS__)
+#define _GMP_DROP_733(x, ...) _GMP_DROP_732(__VA_ARGS__)
+#define _GMP_DROP_734(x, ...) _GMP_DROP_733(__VA_ARGS__)
+#define _GMP_DROP_735(x, ...) _GMP_DROP_734(__VA_ARGS__)
+#define _GMP_DROP_736(x, ...) _GMP_DROP_735(__VA_ARGS__)
+#define _GMP_DROP_737(x, ...) _GMP_DROP_736(__VA_ARGS__)
+#define _GMP_DROP_738(x, ...) _GMP_DROP_737(__VA_ARGS__)
+#define _GMP_DROP_739(x, ...) _GMP_DROP_738(__VA_ARGS__)
+#define _GMP_DROP_740(x, ...) _GMP_DROP_739(__VA_ARGS__)
+#define _GMP_DROP_741(x, ...) _GMP_DROP_740(__VA_ARGS__)
+#define _GMP_DROP_742(x, ...) _GMP_DROP_741(__VA_ARGS__)
+#define _GMP_DROP_743(x, ...) _GMP_DROP_742(__VA_ARGS__)
+#define _GMP_DROP_744(x, ...) _GMP_DROP_743(__VA_ARGS__)
+#define _GMP_DROP_745(x, ...) _GMP_DROP_744(__VA_ARGS__)
+#define _GMP_DROP_746(x, ...) _GMP_DROP_745(__VA_ARGS__)
+#define _GMP_DROP_747(x, ...) _GMP_DROP_746(__VA_ARGS__)
+#define _GMP_DROP_748(x, ...) _GMP_DROP_747(__VA_ARGS__)
+#define _GMP_DROP_749(x, ...) _GMP_DROP_748(__VA_ARGS__)
+#define _GMP_DROP_750(x, ...) _GMP_DROP_749(__VA_ARGS__)
+#define _GMP_DROP_751(x, ...) _GMP_DROP_750(__VA_ARGS__)
+#define _GMP_DROP_752(x, ...) _GMP_DROP_751(__VA_ARGS__)
+#define _GMP_DROP_753(x, ...) _GMP_DROP_752(__VA_ARGS__)
+#define _GMP_DROP_754(x, ...) _GMP_DROP_753(__VA_ARGS__)
+#define _GMP_DROP_755(x, ...) _GMP_DROP_754(__VA_ARGS__)
+#define _GMP_DROP_756(x, ...) _GMP_DROP_755(__VA_ARGS__)
+#define _GMP_DROP_757(x, ...) _GMP_DROP_756(__VA_ARGS__)
+#define _GMP_DROP_758(x, ...) _GMP_DROP_757(__VA_ARGS__)
+#define _GMP_DROP_759(x, ...) _GMP_DROP_758(__VA_ARGS__)
+#define _GMP_DROP_760(x, ...) _GMP_DROP_759(__VA_ARGS__)
+#define _GMP_DROP_761(x, ...) _GMP_DROP_760(__VA_ARGS__)
+#define _GMP_DROP_762(x, ...) _GMP_DROP_761(__VA_ARGS__)
+#define _GMP_DROP_763(x, ...) _GMP_DROP_762(__VA_ARGS__)
+#define _GMP_DROP_764(x, ...) _GMP_DROP_763(__VA_ARGS__)
+#define _GMP_DROP_765(x, ...) _GMP_DROP_764(__VA_ARGS__)
+#define _GMP_DROP_766(x, ...) _GMP_DROP_765(__VA_ARGS__)
+#define _GMP_DROP_767(x, ...) _GMP_DROP_766(__VA_ARGS__)
+#define _GMP_DROP_768(x, ...) _GMP_DROP_767(__VA_ARGS__)
+#define _GMP_DROP_769(x, ...) _GMP_DROP_768(__VA_ARGS__)
+#define _GMP_DROP_770(x, ...) _GMP_DROP_769(__VA_ARGS__)
+#define _GMP_DROP_771(x, ...) _GMP_DROP_770(__VA_ARGS__)
+#define _GMP_DROP_772(x, ...) _GMP_DROP_771(__VA_ARGS__)
+#define _GMP_DROP_773(x, ...) _GMP_DROP_772(__VA_ARGS__)
+#define _GMP_DROP_774(x, ...) _GMP_DROP_773(__VA_ARGS__)
+#define _GMP_DROP_775(x, ...) _GMP_DROP_774(__VA_ARGS__)
+#define _GMP_DROP_776(x, ...) _GMP_DROP_775(__VA_ARGS__)
+#define _GMP_DROP_777(x, ...) _GMP_DROP_776(__VA_ARGS__)
+#define _GMP_DROP_778(x, ...) _GMP_DROP_777(__VA_ARGS__)
+#define _GMP_DROP_779(x, ...) _GMP_DROP_778(__VA_ARGS__)
+#define _GMP_DROP_780(x, ...) _GMP_DROP_779(__VA_ARGS__)
+#define _GMP_DROP_781(x, ...) _GMP_DROP_780(__VA_ARGS__)
+#define _GMP_DROP_782(x, ...) _GMP_DROP_781(__VA_ARGS__)
+#define _GMP_DROP_783(x, ...) _GMP_DROP_782(__VA_ARGS__)
+#define _GMP_DROP_784(x, ...) _GMP_DROP_783(__VA_ARGS__)
+#define _GMP_DROP_785(x, ...) _GMP_DROP_784(__VA_ARGS__)
+#define _GMP_DROP_786(x, ...) _GMP_DROP_785(__VA_ARGS__)
+#define _GMP_DROP_787(x, ...) _GMP_DROP_786(__VA_ARGS__)
+#define _GMP_DROP_788(x, ...) _GMP_DROP_787(__VA_ARGS__)
+#define _GMP_DROP_789(x, ...) _GMP_DROP_788(__VA_ARGS__)
+#define _GMP_DROP_790(x, ...) _GMP_DROP_789(__VA_ARGS__)
+#define _GMP_DROP_791(x, ...) _GMP_DROP_790(__VA_ARGS__)
+#define _GMP_DROP_792(x, ...) _GMP_DROP_791(__VA_ARGS__)
+#define _GMP_DROP_793(x, ...) _GMP_DROP_792(__VA_ARGS__)
+#define _GMP_DROP_794(x, ...) _GMP_DROP_793(__VA_ARGS__)
+#define _GMP_DROP_795(x, ...) _GMP_DROP_794(__VA_ARGS__)
+#define _GMP_DROP_796(x, ...) _GMP_DROP_795(__VA_ARGS__)
+#define _GMP_DROP_797(x, ...) _GMP_DROP_796(__VA_ARGS__)
+#define _GMP_DROP_798(x, ...) _GMP_DROP_797(__VA_ARGS__)
+#define _GMP_DROP_799(x, ...) _GMP_DROP_798(__VA_ARGS__)
+#define _GMP_DROP_800(x, ...) _GMP_DROP_799(__VA_ARGS__)
+#define _GMP_DROP_801(x, ...) _GMP_DROP_800(__VA_ARGS__)
+#define _GMP_DROP_802(x, ...) _GMP_DROP_801(__VA_ARGS__)
+#define _GMP_DROP_803(x, ...) _GMP_DROP_802(__VA_ARGS__)
+#define _GMP_DROP_804(x, ...) _GMP_DROP_803(__VA_ARGS__)
+#define _GMP_DROP_805(x, ...) _GMP_DROP_804(__VA_ARGS__)
+#define _GMP_DROP_806(x, ...) _GMP_DROP_805(__VA_ARGS__)
+#define _GMP_DROP_807(x, ...) _GMP_DROP_806(__VA_ARGS__)
+#define _GMP_DROP_808(x, ...) _GMP_DROP_807(__VA_ARGS__)
+#define _GMP_DROP_809(x, ...) _GMP_DROP_808(__VA_ARGS__)
+#define _GMP_DROP_810(x, ...) _GMP_DROP_809(__VA_ARGS__)
+#define _GMP_DROP_811(x, ...) _GMP_DROP_810(__VA_ARGS__)
+#define _GMP_DROP_812(x, ...) _GMP_DROP_811(__VA_ARGS__)
+#define _GMP_DROP_813(x, ...) _GMP_DROP_812(__VA_ARGS__)
+#define _GMP_DROP_814(x, ...) _GMP_DROP_813(__VA_ARGS__)
+#define _GMP_DROP_815(x, ...) _GMP_DROP_814(__VA_ARGS__)
+#define _GMP_DROP_816(x, ...) _GMP_DROP_815(__VA_ARGS__)
+#define _GMP_DROP_817(x, ...) _GMP_DROP_816(__VA_ARGS__)
+#define _GMP_DROP_818(x, ...) _GMP_DROP_817(__VA_ARGS__)
+#define _GMP_DROP_819(x, ...) _GMP_DROP_818(__VA_ARGS__)
+#define _GMP_DROP_820(x, ...) _GMP_DROP_819(__VA_ARGS__)
+#define _GMP_DROP_821(x, ...) _GMP_DROP_820(__VA_ARGS__)
+#define _GMP_DROP_822(x, ...) _GMP_DROP_821(__VA_ARGS__)
+#define _GMP_DROP_823(x, ...) _GMP_DROP_822(__VA_ARGS__)
+#define _GMP_DROP_824(x, ...) _GMP_DROP_823(__VA_ARGS__)
+#define _GMP_DROP_825(x, ...) _GMP_DROP_824(__VA_ARGS__)
+#define _GMP_DROP_826(x, ...) _GMP_DROP_825(__VA_ARGS__)
+#define _GMP_DROP_827(x, ...) _GMP_DROP_826(__VA_ARGS__)
+#define _GMP_DROP_828(x, ...) _GMP_DROP_827(__VA_ARGS__)
+#define _GMP_DROP_829(x, ...) _GMP_DROP_828(__VA_ARGS__)
+#define _GMP_DROP_830(x, ...) _GMP_DROP_829(__VA_ARGS__)
+#define _GMP_DROP_831(x, ...) _GMP_DROP_830(__VA_ARGS__)
+#define _GMP_DROP_832(x, ...) _GMP_DROP_831(__VA_ARGS__)
+#define _GMP_DROP_833(x, ...) _GMP_DROP_832(__VA_ARGS__)
+#define _GMP_DROP_834(x, ...) _GMP_DROP_833(__VA_ARGS__)
+#define _GMP_DROP_835(x, ...) _GMP_DROP_834(__VA_ARGS__)
+#define _GMP_DROP_836(x, ...) _GMP_DROP_835(__VA_ARGS__)
+#define _GMP_DROP_837(x, ...) _GMP_DROP_836(__VA_ARGS__)
+#define _GMP_DROP_838(x, ...) _GMP_DROP_837(__VA_ARGS__)
+#define _GMP_DROP_839(x, ...) _GMP_DROP_838(__VA_ARGS__)
+#define _GMP_DROP_840(x, ...) _GMP_DROP_839(__VA_ARGS__)
+#define _GMP_DROP_841(x, ...) _GMP_DROP_840(__VA_ARGS__)
+#define _GMP_DROP_842(x, ...) _GMP_DROP_841(__VA_ARGS__)
+#define _GMP_DROP_843(x, ...) _GMP_DROP_842(__VA_ARGS__)
+#define _GMP_DROP_844(x, ...) _GMP_DROP_843(__VA_ARGS__)
+#define _GMP_DROP_845(x, ...) _GMP_DROP_844(__VA_ARGS__)
+#define _GMP_DROP_846(x, ...) _GMP_DROP_845(__VA_ARGS__)
+#define _GMP_DROP_847(x, ...) _GMP_DROP_846(__VA_ARGS__)
+#define _GMP_DROP_848(x, ...) _GMP_DROP_847(__VA_ARGS__)
+#define _GMP_DROP_849(x, ...) _GMP_DROP_848(__VA_ARGS__)
+#define _GMP_DROP_850(x, ...) _GMP_DROP_849(__VA_ARGS__)
+#define _GMP_DROP_851(x, ...) _GMP_DROP_850(__VA_ARGS__)
+#define _GMP_DROP_852(x, ...) _GMP_DROP_851(__VA_ARGS__)
+#define _GMP_DROP_853(x, ...) _GMP_DROP_852(__VA_ARGS__)
+#define _GMP_DROP_854(x, ...) _GMP_DROP_853(__VA_ARGS__)
+#define _GMP_DROP_855(x, ...) _GMP_DROP_854(__VA_ARGS__)
+#define _GMP_DROP_856(x, ...) _GMP_DROP_855(__VA_ARGS__)
+#define _GMP_DROP_857(x, ...) _GMP_DROP_856(__VA_ARGS__)
+#define _GMP_DROP_858(x, ...) _GMP_DROP_857(__VA_ARGS__)
+#define _GMP_DROP_859(x, ...) _GMP_DROP_858(__VA_ARGS__)
+#define _GMP_DROP_860(x, ...) _GMP_DROP_859(__VA_ARGS__)
+#define _GMP_DROP_861(x, ...) _GMP_DROP_860(__VA_ARGS__)
+#define _GMP_DROP_862(x, ...) _GMP_DROP_861(__VA_ARGS__)
+#define _GMP_DROP_863(x, ...) _GMP_DROP_862(__VA_ARGS__)
+#define _GMP_DROP_864(x, ...) _GMP_DROP_863(__VA_ARGS__)
+#define _GMP_DROP_865(x, ...) _GMP_DROP_864(__VA_ARGS__)
+#define _GMP_DROP_866(x, ...) _GMP_DROP_865(__VA_ARGS__)
+#define _GMP_DROP_867(x, ...) _GMP_DROP_866(__VA_ARGS__)
+#define _GMP_DROP_868(x, ...) _GMP_DROP_867(__VA_ARGS__)
+#define _GMP_DROP_869(x, ...) _GMP_DROP_868(__VA_ARGS__)
+#define _GMP_DROP_870(x, ...) _GMP_DROP_869(__VA_ARGS__)
+#define _GMP_DROP_871(x, ...) _GMP_DROP_870(__VA_ARGS__)
+#define _GMP_DROP_872(x, ...) _GMP_DROP_871(__VA_ARGS__)
+#define _GMP_DROP_873(x, ...) _GMP_DROP_872(__VA_ARGS__)
+#define _GMP_DROP_874(x, ...) _GMP_DROP_873(__VA_ARGS__)
+#define _GMP_DROP_875(x, ...) _GMP_DROP_874(__VA_ARGS__)
+#define _GMP_DROP_876(x, ...) _GMP_DROP_875(__VA_ARGS__)
+#define _GMP_DROP_877(x, ...) _GMP_DROP_876(__VA_ARGS__)
+#define _GMP_DROP_878(x, ...) _GMP_DROP_877(__VA_ARGS__)
+#define _GMP_DROP_879(x, ...) _GMP_DROP_878(__VA_ARGS__)
+#define _GMP_DROP_880(x, ...) _GMP_DROP_879(__VA_ARGS__)
+#define _GMP_DROP_881(x, ...) _GMP_DROP_880(__VA_ARGS__)
+#define _GMP_DROP_882(x, ...) _GMP_DROP_881(__VA_ARGS__)
+#define _GMP_DROP_883(x, ...) _GMP_DROP_882(__VA_ARGS__)
+#define _GMP_DROP_884(x, ...) _GMP_DROP_883(__VA_ARGS__)
+#define _GMP_DROP_885(x, ...) _GMP_DROP_884(__VA_ARGS__)
+#define _GMP_DROP_886(x, ...) _GMP_DROP_885(__VA_ARGS__)
+#define _GMP_DROP_887(x, ...) _GMP_DROP_886(__VA_ARGS__)
+#define _GMP_DROP_888(x, ...) _GMP_DROP_887(__VA_ARGS__)
+#define _GMP_DROP_889(x, ...) _GMP_DROP_888(__VA_ARGS__)
+#define _GMP_DROP_890(x, ...) _GMP_DROP_889(__VA_ARGS__)
+#define _GMP_DROP_891(x, ...) _GMP_DROP_890(__VA_ARGS__)
+#define _GMP_DROP_892(x, ...) _GMP_DROP_891(__VA_ARGS__)
+#define _GMP_DROP_893(x, ...) _GMP_DROP_892(__VA_ARGS__)
+#define _GMP_DROP_894(x, ...) _GMP_DROP_893(__VA_ARGS__)
+#define _GMP_DROP_895(x, ...) _GMP_DROP_894(__VA_ARGS__)
+#define _GMP_DROP_896(x, ...) _GMP_DROP_895(__VA_ARGS__)
+#define _GMP_DROP_897(x, ...) _GMP_DROP_896(__VA_ARGS__)
+#define _GMP_DROP_898(x, ...) _GMP_DROP_897(__VA_ARGS__)
+#define _GMP_DROP_899(x, ...) _GMP_DROP_898(__VA_ARGS__)
+#define _GMP_DROP_900(x, ...) _GMP_DROP_899(__VA_ARGS__)
+#define _GMP_DROP_901(x, ...) _GMP_DROP_900(__VA_ARGS__)
+#define _GMP_DROP_902(x, ...) _GMP_DROP_901(__VA_ARGS__)
+#define _GMP_DROP_903(x, ...) _GMP_DROP_902(__VA_ARGS__)
+#define _GMP_DROP_904(x, ...) _GMP_DROP_903(__VA_ARGS__)
+#define _GMP_DROP_905(x, ...) _GMP_DROP_904(__VA_ARGS__)
+#define _GMP_DROP_906(x, ...) _GMP_DROP_905(__VA_ARGS__)
+#define _GMP_DROP_907(x, ...) _GMP_DROP_906(__VA_ARGS__)
+#define _GMP_DROP_908(x, ...) _GMP_DROP_907(__VA_ARGS__)
+#define _GMP_DROP_909(x, ...) _GMP_DROP_908(__VA_ARGS__)
+#define _GMP_DROP_910(x, ...) _GMP_DROP_909(__VA_ARGS__)
+#define _GMP_DROP_911(x, ...) _GMP_DROP_910(__VA_ARGS__)
+#define _GMP_DROP_912(x, ...) _GMP_DROP_911(__VA_ARGS__)
+#define _GMP_DROP_913(x, ...) _GMP_DROP_912(__VA_ARGS__)
+#define _GMP_DROP_914(x, ...) _GMP_DROP_913(__VA_ARGS__)
+#define _GMP_DROP_915(x, ...) _GMP_DROP_914(__VA_ARGS__)
+#define _GMP_DROP_916(x, ...) _GMP_DROP_915(__VA_ARGS__)
+#define _GMP_DROP_917(x, ...) _GMP_DROP_916(__VA_ARGS__)
+#define _GMP_DROP_918(x, ...) _GMP_DROP_917(__VA_ARGS__)
+#define _GMP_DROP_919(x, ...) _GMP_DROP_918(__VA_ARGS__)
+#define _GMP_DROP_920(x, ...) _GMP_DROP_919(__VA_ARGS__)
+#define _GMP_DROP_921(x, ...) _GMP_DROP_920(__VA_ARGS__)
+#define _GMP_DROP_922(x, ...) _GMP_DROP_921(__VA_ARGS__)
+#define _GMP_DROP_923(x, ...) _GMP_DROP_922(__VA_ARGS__)
+#define _GMP_DROP_924(x, ...) _GMP_DROP_923(__VA_ARGS__)
+#define _GMP_DROP_925(x, ...) _GMP_DROP_924(__VA_ARGS__)
+#define _GMP_DROP_926(x, ...) _GMP_DROP_925(__VA_ARGS__)
+#define _GMP_DROP_927(x, ...) _GMP_DROP_926(__VA_ARGS__)
+#define _GMP_DROP_928(x, ...) _GMP_DROP_927(__VA_ARGS__)
+#define _GMP_DROP_929(x, ...) _GMP_DROP_928(__VA_ARGS__)
+#define _GMP_DROP_930(x, ...) _GMP_DROP_929(__VA_ARGS__)
+#define _GMP_DROP_931(x, ...) _GMP_DROP_930(__VA_ARGS__)
+#define _GMP_DROP_932(x, ...) _GMP_DROP_931(__VA_ARGS__)
+#define _GMP_DROP_933(x, ...) _GMP_DROP_932(__VA_ARGS__)
+#define _GMP_DROP_934(x, ...) _GMP_DROP_933(__VA_ARGS__)
+#define _GMP_DROP_935(x, ...) _GMP_DROP_934(__VA_ARGS__)
+#define _GMP_DROP_936(x, ...) _GMP_DROP_935(__VA_ARGS__)
+#define _GMP_DROP_937(x, ...) _GMP_DROP_936(__VA_ARGS__)
+#define _GMP_DROP_938(x, ...) _GMP_DROP_937(__VA_ARGS__)
+#define _GMP_DROP_939(x, ...) _GMP_DROP_938(__VA_ARGS__)
+#define _GMP_DROP_940(x, ...) _GMP_DROP_939(__VA_ARGS__)
+#define _GMP_DROP_941(x, ...) _GMP_DROP_940(__VA_ARGS__)
+#define _GMP_DROP_942(x, ...) _GMP_DROP_941(__VA_ARGS__)
+#define _GMP_DROP_943(x, ...) _GMP_DROP_942(__VA_ARGS__)
+#define _GMP_DROP_944(x, ...) _GMP_DROP_943(__VA_ARGS__)
+#define _GMP_DROP_945(x, ...) _GMP_DROP_944(__VA_ARGS__)
+#define _GMP_DROP_946(x, ...) _GMP_DROP_945(__VA_ARGS__)
+#define _GMP_DROP_947(x, ...) _GMP_DROP_946(__VA_ARGS__)
+#define _GMP_DROP_948(x, ...) _GMP_DROP_947(__VA_ARGS__)
+#define _GMP_DROP_949(x, ...) _GMP_DROP_948(__VA_ARGS__)
+#define _GMP_DROP_950(x, ...) _GMP_DROP_949(__VA_ARGS__)
+#define _GMP_DROP_951(x, ...) _GMP_DROP_950(__VA_ARGS__)
+#define _GMP_DROP_952(x, ...) _GMP_DROP_951(__VA_ARGS__)
+#define _GMP_DROP_953(x, ...) _GMP_DROP_952(__VA_ARGS__)
+#define _GMP_DROP_954(x, ...) _GMP_DROP_953(__VA_ARGS__)
+#define _GMP_DROP_955(x, ...) _GMP_DROP_954(__VA_ARGS__)
+#define _GMP_DROP_956(x, ...) _GMP_DROP_955(__VA_ARGS__)
+#define _GMP_DROP_957(x, ...) _GMP_DROP_956(__VA_ARGS__)
+#define _GMP_DROP_958(x, ...) _GMP_DROP_957(__VA_ARGS__)
+#define _GMP_DROP_959(x, ...) _GMP_DROP_958(__VA_ARGS__)
+#define _GMP_DROP_960(x, ...) _GMP_DROP_959(__VA_ARGS__)
+#define _GMP_DROP_961(x, ...) _GMP_DROP_960(__VA_ARGS__)
+#define _GMP_DROP_962(x, ...) _GMP_DROP_961(__VA_ARGS__)
+#define _GMP_DROP_963(x, ...) _GMP_DROP_962(__VA_ARGS__)
+#define _GMP_DROP_964(x, ...) _GMP_DROP_963(__VA_ARGS__)
+#define _GMP_DROP_965(x, ...) _GMP_DROP_964(__VA_ARGS__)
+#define _GMP_DROP_966(x, ...) _GMP_DROP_965(__VA_ARGS__)
+#define _GMP_DROP_967(x, ...) _GMP_DROP_966(__VA_ARGS__)
+#define _GMP_DROP_968(x, ...) _GMP_DROP_967(__VA_ARGS__)
+#define _GMP_DROP_969(x, ...) _GMP_DROP_968(__VA_ARGS__)
+#define _GMP_DROP_970(x, ...) _GMP_DROP_969(__VA_ARGS__)
+#define _GMP_DROP_971(x, ...) _GMP_DROP_970(__VA_ARGS__)
+#define _GMP_DROP_972(x, ...) _GMP_DROP_971(__VA_ARGS__)
+#define _GMP_DROP_973(x, ...) _GMP_DROP_972(__VA_ARGS__)
+#define _GMP_DROP_974(x, ...) _GMP_DROP_973(__VA_ARGS__)
+#define _GMP_DROP_975(x, ...) _GMP_DROP_974(__VA_ARGS__)
+#define _GMP_DROP_976(x, ...) _GMP_DROP_975(__VA_ARGS__)
+#define _GMP_DROP_977(x, ...) _GMP_DROP_976(__VA_ARGS__)
+#define _GMP_DROP_978(x, ...) _GMP_DROP_977(__VA_ARGS__)
+#define _GMP_DROP_979(x, ...) _GMP_DROP_978(__VA_ARGS__)
+#define _GMP_DROP_980(x, ...) _GMP_DROP_979(__VA_ARGS__)
+#define _GMP_DROP_981(x, ...) _GMP_DROP_980(__VA_ARGS__)
+#define _GMP_DROP_982(x, ...) _GMP_DROP_981(__VA_ARGS__)
+#define _GMP_DROP_983(x, ...) _GMP_DROP_982(__VA_ARGS__)
+#define _GMP_DROP_984(x, ...) _GMP_DROP_983(__VA_ARGS__)
+#define _GMP_DROP_985(x, ...) _GMP_DROP_984(__VA_ARGS__)
+#define _GMP_DROP_986(x, ...) _GMP_DROP_985(__VA_ARGS__)
+#define _GMP_DROP_987(x, ...) _GMP_DROP_986(__VA_ARGS__)
+#define _GMP_DROP_988(x, ...) _GMP_DROP_987(__VA_ARGS__)
+#define _GMP_DROP_989(x, ...) _GMP_DROP_988(__VA_ARGS__)
+#define _GMP_DROP_990(x, ...) _GMP_DROP_989(__VA_ARGS__)
+#define _GMP_DROP_991(x, ...) _GMP_DROP_990(__VA_ARGS__)
+#define _GMP_DROP_992(x, ...) _GMP_DROP_991(__VA_ARGS__)
+#define _GMP_DROP_993(x, ...) _GMP_DROP_992(__VA_ARGS__)
+#define _GMP_DROP_994(x, ...) _GMP_DROP_993(__VA_ARGS__)
+#define _GMP_DROP_995(x, ...) _GMP_DROP_994(__VA_ARGS__)
+#define _GMP_DROP_996(x, ...) _GMP_DROP_995(__VA_ARGS__)
+#define _GMP_DROP_997(x, ...) _GMP_DROP_996(__VA_ARGS__)
+#define _GMP_DROP_998(x, ...) _GMP_DROP_997(__VA_ARGS__)
+#define _GMP_DROP_999(x, ...) _GMP_DROP_998(__VA_ARGS__)
+#define _GMP_DROP_1000(x, ...) _GMP_DROP_999(__VA_ARGS__)
+#define _GMP_DROP_1001(x, ...) _GMP_DROP_1000(__VA_ARGS__)
+#define _GMP_DROP_1002(x, ...) _GMP_DROP_1001(__VA_ARGS__)
+#define _GMP_DROP_1003(x, ...) _GMP_DROP_1002(__VA_ARGS__)
+#define _GMP_DROP_1004(x, ...) _GMP_DROP_1003(__VA_ARGS__)
+#define _GMP_DROP_1005(x, ...) _GMP_DROP_1004(__VA_ARGS__)
+#define _GMP_DROP_1006(x, ...) _GMP_DROP_1005(__VA_ARGS__)
+#define _GMP_DROP_1007(x, ...) _GMP_DROP_1006(__VA_ARGS__)
+#define _GMP_DROP_1008(x, ...) _GMP_DROP_1007(__VA_ARGS__)
+#define _GMP_DROP_1009(x, ...) _GMP_DROP_1008(__VA_ARGS__)
+#define _GMP_DROP_1010(x, ...) _GMP_DROP_1009(__VA_ARGS__)
+#define _GMP_DROP_1011(x, ...) _GMP_DROP_1010(__VA_ARGS__)
+#define _GMP_DROP_1012(x, ...) _GMP_DROP_1011(__VA_ARGS__)
+#define _GMP_DROP_1013(x, ...) _GMP_DROP_1012(__VA_ARGS__)
+#define _GMP_DROP_1014(x, ...) _GMP_DROP_1013(__VA_ARGS__)
+#define _GMP_DROP_1015(x, ...) _GMP_DROP_1014(__VA_ARGS__)
+#define _GMP_DROP_1016(x, ...) _GMP_DROP_1015(__VA_ARGS__)
+#define _GMP_DROP_1017(x, ...) _GMP_DROP_1016(__VA_ARGS__)
+#define _GMP_DROP_1018(x, ...) _GMP_DROP_1017(__VA_ARGS__)
+#define _GMP_DROP_1019(x, ...) _GMP_DROP_1018(__VA_ARGS__)
+#define _GMP_DROP_1020(x, ...) _GMP_DROP_1019(__VA_ARGS__)
+#define _GMP_DROP_1021(x, ...) _GMP_DROP_1020(__VA_ARGS__)
+#define _GMP_DROP_1022(x, ...) _GMP_DROP_1021(__VA_ARGS__)
+#define _GMP_DROP_1023(x, ...) _GMP_DROP_1022(__VA_ARGS__)
+#define _GMP_DROP_1024(x, ...) _GMP_DROP_1023(__VA_ARGS__)
+
+// GMP_LOOP
+#define _GMP_LOOP_0(call, ...)
+#define _GMP_LOOP_1(call, ...) call(__VA_ARGS__) _GMP_LOOP_0(call, __VA_ARGS__)
+#define _GMP_LOOP_2(call, ...) call(__VA_ARGS__) _GMP_LOOP_1(call, __VA_ARGS__)
+#define _GMP_LOOP_3(call, ...) call(__VA_ARGS__) _GMP_LOOP_2(call, __VA_ARGS__)
+#define _GMP_LOOP_4(call, ...) call(__VA_ARGS__) _GMP_LOOP_3(call, __VA_ARGS__)
+#define _GMP_LOOP_5(call, ...) call(__VA_ARGS__) _GMP_LOOP_4(call, __VA_ARGS__)
+#define _GMP_LOOP_6(call, ...) call(__VA_ARGS__) _GMP_LOOP_5(call, __VA_ARGS__)
+#define _GMP_LOOP_7(call, ...) call(__VA_ARGS__) _GMP_LOOP_6(call, __VA_ARGS__)
+#define _GMP_LOOP_8(call, ...) call(__VA_ARGS__) _GMP_LOOP_7(call, __VA_ARGS__)
+#define _GMP_LOOP_9(call, ...) call(__VA_ARGS__) _GMP_LOOP_8(call, __VA_ARGS__)
+#define _GMP_LOOP_10(call, ...) call(__VA_ARGS__) _GMP_LOOP_9(call, __VA_ARGS__)
+#define _GMP_LOOP_11(call, ...) call(__VA_ARGS__) _GMP_LOOP_10(call, __VA_ARGS__)
+#define _GMP_LOOP_12(call, ...) call(__VA_ARGS__) _GMP_LOOP_11(call, __VA_ARGS__)
+#define _GMP_LOOP_13(call, ...) call(__VA_ARGS__) _GMP_LOOP_12(call, __VA_ARGS__)
+#define _GMP_LOOP_14(call, ...) call(__VA_ARGS__) _GMP_LOOP_13(call, __VA_ARGS__)
+#define _GMP_LOOP_15(call, ...) call(__VA_ARGS__) _GMP_LOOP_14(call, __VA_ARGS__)
+#define _GMP_LOOP_16(call, ...) call(__VA_ARGS__) _GMP_LOOP_15(call, __VA_ARGS__)
+#define _GMP_LOOP_17(call, ...) call(__VA_ARGS__) _GMP_LOOP_16(call, __VA_ARGS__)
+#define _GMP_LOOP_18(call, ...) call(__VA_ARGS__) _GMP_LOOP_17(call, __VA_ARGS__)
+#define _GMP_LOOP_19(call, ...) call(__VA_ARGS__) _GMP_LOOP_18(call, __VA_ARGS__)
+#define _GMP_LOOP_20(call, ...) call(__VA_ARGS__) _GMP_LOOP_19(call, __VA_ARGS__)
+#define _GMP_LOOP_21(call, ...) call(__VA_ARGS__) _GMP_LOOP_20(call, __VA_ARGS__)
+#define _GMP_LOOP_22(call, ...) call(__VA_ARGS__) _GMP_LOOP_21(call, __VA_ARGS__)
+#define _GMP_LOOP_23(call, ...) call(__VA_ARGS__) _GMP_LOOP_22(call, __VA_ARGS__)
+#define _GMP_LOOP_24(call, ...) call(__VA_ARGS__) _GMP_LOOP_23(call, __VA_ARGS__)
+#define _GMP_LOOP_25(call, ...) call(__VA_ARGS__) _GMP_LOOP_24(call, __VA_ARGS__)
+#define _GMP_LOOP_26(call, ...) call(__VA_ARGS__) _GMP_LOOP_25(call, __VA_ARGS__)
+#define _GMP_LOOP_27(call, ...) call(__VA_ARGS__) _GMP_LOOP_26(call, __VA_ARGS__)
+#define _GMP_LOOP_28(call, ...) call(__VA_ARGS__) _GMP_LOOP_27(call, __VA_ARGS__)
+#define _GMP_LOOP_29(call, ...) call(__VA_ARGS__) _GMP_LOOP_28(call, __VA_ARGS__)
+#define _GMP_LOOP_30(call, ...) call(__VA_ARGS__) _GMP_LOOP_29(call, __VA_ARGS__)
+#define _GMP_LOOP_31(call, ...) call(__VA_ARGS__) _GMP_LOOP_30(call, __VA_ARGS__)
+#define _GMP_LOOP_32(call, ...) call(__VA_ARGS__) _GMP_LOOP_31(call, __VA_ARGS__)
+#define _GMP_LOOP_33(call, ...) call(__VA_ARGS__) _GMP_LOOP_32(call, __VA_ARGS__)
+#define _GMP_LOOP_34(call, ...) call(__VA_ARGS__) _GMP_LOOP_33(call, __VA_ARGS__)
+#define _GMP_LOOP_35(call, ...) call(__VA_ARGS__) _GMP_LOOP_34(call, __VA_ARGS__)
+#define _GMP_LOOP_36(call, ...) call(__VA_ARGS__) _GMP_LOOP_35(call, __VA_ARGS__)
+#define _GMP_LOOP_37(call, ...) call(__VA_ARGS__) _GMP_LOOP_36(call, __VA_ARGS__)
+#define _GMP_LOOP_38(call, ...) call(__VA_ARGS__) _GMP_LOOP_37(call, __VA_ARGS__)
+#define _GMP_LOOP_39(call, ...) call(__VA_ARGS__) _GMP_LOOP_38(call, __VA_ARGS__)
+#define _GMP_LOOP_40(call, ...) call(__VA_ARGS__) _GMP_LOOP_39(call, __VA_ARGS__)
+#define _GMP_LOOP_41(call, ...) call(__VA_ARGS__) _GMP_LOOP_40(call, __VA_ARGS__)
+#define _GMP_LOOP_42(call, ...) call(__VA_ARGS__) _GMP_LOOP_41(call, __VA_ARGS__)
+#define _GMP_LOOP_43(call, ...) call(__VA_ARGS__) _GMP_LOOP_42(call, __VA_ARGS__)
+#define _GMP_LOOP_44(call, ...) call(__VA_ARGS__) _GMP_LOOP_43(call, __VA_ARGS__)
+#define _GMP_LOOP_45(call, ...) call(__VA_ARGS__) _GMP_LOOP_44(call, __VA_ARGS__)
+#define _GMP_LOOP_46(call, ...) call(__VA_ARGS__) _GMP_LOOP_45(call, __VA_ARGS__)
+#define _GMP_LOOP_47(call, ...) call(__VA_ARGS__) _GMP_LOOP_46(call, __VA_ARGS__)
+#define _GMP_LOOP_48(call, ...) call(__VA_ARGS__) _GMP_LOOP_47(call, __VA_ARGS__)
+#define _GMP_LOOP_49(call, ...) call(__VA_ARGS__) _GMP_LOOP_48(call, __VA_ARGS__)
+#define _GMP_LOOP_50(call, ...) call(__VA_ARGS__) _GMP_LOOP_49(call, __VA_ARGS__)
+#define _GMP_LOOP_51(call, ...) call(__VA_ARGS__) _GMP_LOOP_50(call, __VA_ARGS__)
+#define _GMP_LOOP_52(call, ...) call(__VA_ARGS__) _GMP_LOOP_51(call, __VA_ARGS__)
+#define _GMP_LOOP_53(call, ...) call(__VA_ARGS__) _GMP_LOOP_52(call, __VA_ARGS__)
+#define _GMP_LOOP_54(call, ...) call(__VA_ARGS__) _GMP_LOOP_53(call, __VA_ARGS__)
+#define _GMP_LOOP_55(call, ...) call(__VA_ARGS__) _GMP_LOOP_54(call, __VA_ARGS__)
+#define _GMP_LOOP_56(call, ...) call(__VA_ARGS__) _GMP_LOOP_55(call, __VA_ARGS__)
+#define _GMP_LOOP_57(call, ...) call(__VA_ARGS__) _GMP_LOOP_56(call, __VA_ARGS__)
+#define _GMP_LOOP_58(call, ...) call(__VA_ARGS__) _GMP_LOOP_57(call, __VA_ARGS__)
+#define _GMP_LOOP_59(call, ...) call(__VA_ARGS__) _GMP_LOOP_58(call, __VA_ARGS__)
+#define _GMP_LOOP_60(call, ...) call(__VA_ARGS__) _GMP_LOOP_59(call, __VA_ARGS__)
+#define _GMP_LOOP_61(call, ...) call(__VA_ARGS__) _GMP_LOOP_60(call, __VA_ARGS__)
+#define _GMP_LOOP_62(call, ...) call(__VA_ARGS__) _GMP_LOOP_61(call, __VA_ARGS__)
+#define _GMP_LOOP_63(call, ...) call(__VA_ARGS__) _GMP_LOOP_62(call, __VA_ARGS__)
+#define _GMP_LOOP_64(call, ...) call(__VA_ARGS__) _GMP_LOOP_63(call, __VA_ARGS__)
+#define _GMP_LOOP_65(call, ...) call(__VA_ARGS__) _GMP_LOOP_64(call, __VA_ARGS__)
+#define _GMP_LOOP_66(call, ...) call(__VA_ARGS__) _GMP_LOOP_65(call, __VA_ARGS__)
+#define _GMP_LOOP_67(call, ...) call(__VA_ARGS__) _GMP_LOOP_66(call, __VA_ARGS__)
+#define _GMP_LOOP_68(call, ...) call(__VA_ARGS__) _GMP_LOOP_67(call, __VA_ARGS__)
+#define _GMP_LOOP_69(call, ...) call(__VA_ARGS__) _GMP_LOOP_68(call, __VA_ARGS__)
+#define _GMP_LOOP_70(call, ...) call(__VA_ARGS__) _GMP_LOOP_69(call, __VA_ARGS__)
+#define _GMP_LOOP_71(call, ...) call(__VA_ARGS__) _GMP_LOOP_70(call, __VA_ARGS__)
+#define _GMP_LOOP_72(call, ...) call(__VA_ARGS__) _GMP_LOOP_71(call, __VA_ARGS__)
+#define _GMP_LOOP_73(call, ...) call(__VA_ARGS__) _GMP_LOOP_72(call, __VA_ARGS__)
+#define _GMP_LOOP_74(call, ...) call(__VA_ARGS__) _GMP_LOOP_73(call, __VA_ARGS__)
+#define _GMP_LOOP_75(call, ...) call(__VA_ARGS__) _GMP_LOOP_74(call, __VA_ARGS__)
+#define _GMP_LOOP_76(call, ...) call(__VA_ARGS__) _GMP_LOOP_75(call, __VA_ARGS__)
+#define _GMP_LOOP_77(call, ...) call(__VA_ARGS__) _GMP_LOOP_76(call, __VA_ARGS__)
+#define _GMP_LOOP_78(call, ...) call(__VA_ARGS__) _GMP_LOOP_77(call, __VA_ARGS__)
+#define _GMP_LOOP_79(call, ...) call(__VA_ARGS__) _GMP_LOOP_78(call, __VA_ARGS__)
+#define _GMP_LOOP_80(call, ...) call(__VA_ARGS__) _GMP_LOOP_79(call, __VA_ARGS__)
+#define _GMP_LOOP_81(call, ...) call(__VA_ARGS__) _GMP_LOOP_80(call, __VA_ARGS__)
+#define _GMP_LOOP_82(call, ...) call(__VA_ARGS__) _GMP_LOOP_81(call, __VA_ARGS__)
+#define _GMP_LOOP_83(call, ...) call(__VA_ARGS__) _GMP_LOOP_82(call, __VA_ARGS__)
+#define _GMP_LOOP_84(call, ...) call(__VA_ARGS__) _GMP_LOOP_83(call, __VA_ARGS__)
+#define _GMP_LOOP_85(call, ...) call(__VA_ARGS__) _GMP_LOOP_84(call, __VA_ARGS__)
+#define _GMP_LOOP_86(call, ...) call(__VA_ARGS__) _GMP_LOOP_85(call, __VA_ARGS__)
+#define _GMP_LOOP_87(call, ...) call(__VA_ARGS__) _GMP_LOOP_86(call, __VA_ARGS__)
+#define _GMP_LOOP_88(call, ...) call(__VA_ARGS__) _GMP_LOOP_87(call, __VA_ARGS__)
+#define _GMP_LOOP_89(call, ...) call(__VA_ARGS__) _GMP_LOOP_88(call, __VA_ARGS__)
+#define _GMP_LOOP_90(call, ...) call(__VA_ARGS__) _GMP_LOOP_89(call, __VA_ARGS__)
+#define _GMP_LOOP_91(call, ...) call(__VA_ARGS__) _GMP_LOOP_90(call, __VA_ARGS__)
+#define _GMP_LOOP_92(call, ...) call(__VA_ARGS__) _GMP_LOOP_91(call, __VA_ARGS__)
+#define _GMP_LOOP_93(call, ...) call(__VA_ARGS__) _GMP_LOOP_92(call, __VA_ARGS__)
+#define _GMP_LOOP_94(call, ...) call(__VA_ARGS__) _GMP_LOOP_93(call, __VA_ARGS__)
+#define _GMP_LOOP_95(call, ...) call(__VA_ARGS__) _GMP_LOOP_94(call, __VA_ARGS__)
+#define _GMP_LOOP_96(call, ...) call(__VA_ARGS__) _GMP_LOOP_95(call, __VA_ARGS__)
+#define _GMP_LOOP_97(call, ...) call(__VA_ARGS__) _GMP_LOOP_96(call, __VA_ARGS__)
+#define _GMP_LOOP_98(call, ...) call(__VA_ARGS__) _GMP_LOOP_97(call, __VA_ARGS__)
+#define _GMP_LOOP_99(call, ...) call(__VA_ARGS__) _GMP_LOOP_98(call, __VA_ARGS__)
+#define _GMP_LOOP_100(call, ...) call(__VA_ARGS__) _GMP_LOOP_99(call, __VA_ARGS__)
+#define _GMP_LOOP_101(call, ...) call(__VA_ARGS__) _GMP_LOOP_100(call, __VA_ARGS__)
+#define _GMP_LOOP_102(call, ...) call(__VA_ARGS__) _GMP_LOOP_101(call, __VA_ARGS__)
+#define _GMP_LOOP_103(call, ...) call(__VA_ARGS__) _GMP_LOOP_102(call, __VA_ARGS__)
+#define _GMP_LOOP_104(call, ...) call(__VA_ARGS__) _GMP_LOOP_103(call, __VA_ARGS__)
+#define _GMP_LOOP_105(call, ...) call(__VA_ARGS__) _GMP_LOOP_104(call, __VA_ARGS__)
+#define _GMP_LOOP_106(call, ...) call(__VA_ARGS__) _GMP_LOOP_105(call, __VA_ARGS__)
+#define _GMP_LOOP_107(call, ...) call(__VA_ARGS__) _GMP_LOOP_106(call, __VA_ARGS__)
+#define _GMP_LOOP_108(call, ...) call(__VA_ARGS__) _GMP_LOOP_107(call, __VA_ARGS__)
+#define _GMP_LOOP_109(call, ...) call(__VA_ARGS__) _GMP_LOOP_108(call, __VA_ARGS__)
+#define _GMP_LOOP_110(call, ...) call(__VA_ARGS__) _GMP_LOOP_109(call, __VA_ARGS__)
+#define _GMP_LOOP_111(call, ...) call(__VA_ARGS__) _GMP_LOOP_110(call, __VA_ARGS__)
+#define _GMP_LOOP_112(call, ...) call(__VA_ARGS__) _GMP_LOOP_111(call, __VA_ARGS__)
+#define _GMP_LOOP_113(call, ...) call(__VA_ARGS__) _GMP_LOOP_112(call, __VA_ARGS__)
+#define _GMP_LOOP_114(call, ...) call(__VA_ARGS__) _GMP_LOOP_113(call, __VA_ARGS__)
+#define _GMP_LOOP_115(call, ...) call(__VA_ARGS__) _GMP_LOOP_114(call, __VA_ARGS__)
+#define _GMP_LOOP_116(call, ...) call(__VA_ARGS__) _GMP_LOOP_115(call, __VA_ARGS__)
+#define _GMP_LOOP_117(call, ...) call(__VA_ARGS__) _GMP_LOOP_116(call, __VA_ARGS__)
+#define _GMP_LOOP_118(call, ...) call(__VA_ARGS__) _GMP_LOOP_117(call, __VA_ARGS__)
+#define _GMP_LOOP_119(call, ...) call(__VA_ARGS__) _GMP_LOOP_118(call, __VA_ARGS__)
+#define _GMP_LOOP_120(call, ...) call(__VA_ARGS__) _GMP_LOOP_119(call, __VA_ARGS__)
+#define _GMP_LOOP_121(call, ...) call(__VA_ARGS__) _GMP_LOOP_120(call, __VA_ARGS__)
+#define _GMP_LOOP_122(call, ...) call(__VA_ARGS__) _GMP_LOOP_121(call, __VA_ARGS__)
+#define _GMP_LOOP_123(call, ...) call(__VA_ARGS__) _GMP_LOOP_122(call, __VA_ARGS__)
+#define _GMP_LOOP_124(call, ...) call(__VA_ARGS__) _GMP_LOOP_123(call, __VA_ARGS__)
+#define _GMP_LOOP_125(call, ...) call(__VA_ARGS__) _GMP_LOOP_124(call, __VA_ARGS__)
+#define _GMP_LOOP_126(call, ...) call(__VA_ARGS__) _GMP_LOOP_125(call, __VA_ARGS__)
+#define _GMP_LOOP_127(call, ...) call(__VA_ARGS__) _GMP_LOOP_126(call, __VA_ARGS__)
+#define _GMP_LOOP_128(call, ...) call(__VA_ARGS__) _GMP_LOOP_127(call, __VA_ARGS__)
+#define _GMP_LOOP_129(call, ...) call(__VA_ARGS__) _GMP_LOOP_128(call, __VA_ARGS__)
+#define _GMP_LOOP_130(call, ...) call(__VA_ARGS__) _GMP_LOOP_129(call, __VA_ARGS__)
+#define _GMP_LOOP_131(call, ...) call(__VA_ARGS__) _GMP_LOOP_130(call, __VA_ARGS__)
+#define _GMP_LOOP_132(call, ...) call(__VA_ARGS__) _GMP_LOOP_131(call, __VA_ARGS__)
+#define _GMP_LOOP_133(call, ...) call(__VA_ARGS__) _GMP_LOOP_132(call, __VA_ARGS__)
+#define _GMP_LOOP_134(call, ...) call(__VA_ARGS__) _GMP_LOOP_133(call, __VA_ARGS__)
+#define _GMP_LOOP_135(call, ...) call(__VA_ARGS__) _GMP_LOOP_134(call, __VA_ARGS__)
+#define _GMP_LOOP_136(call, ...) call(__VA_ARGS__) _GMP_LOOP_135(call, __VA_ARGS__)
+#define _GMP_LOOP_137(call, ...) call(__VA_ARGS__) _GMP_LOOP_136(call, __VA_ARGS__)
+#define _GMP_LOOP_138(call, ...) call(__VA_ARGS__) _GMP_LOOP_137(call, __VA_ARGS__)
+#define _GMP_LOOP_139(call, ...) call(__VA_ARGS__) _GMP_LOOP_138(call, __VA_ARGS__)
+#define _GMP_LOOP_140(call, ...) call(__VA_ARGS__) _GMP_LOOP_139(call, __VA_ARGS__)
+#define _GMP_LOOP_141(call, ...) call(__VA_ARGS__) _GMP_LOOP_140(call, __VA_ARGS__)
+#define _GMP_LOOP_142(call, ...) call(__VA_ARGS__) _GMP_LOOP_141(call, __VA_ARGS__)
+#define _GMP_LOOP_143(call, ...) call(__VA_ARGS__) _GMP_LOOP_142(call, __VA_ARGS__)
+#define _GMP_LOOP_144(call, ...) call(__VA_ARGS__) _GMP_LOOP_143(call, __VA_ARGS__)
+#define _GMP_LOOP_145(call, ...) call(__VA_ARGS__) _GMP_LOOP_144(call, __VA_ARGS__)
+#define _GMP_LOOP_146(call, ...) call(__VA_ARGS__) _GMP_LOOP_145(call, __VA_ARGS__)
+#define _GMP_LOOP_147(call, ...) call(__VA_ARGS__) _GMP_LOOP_146(call, __VA_ARGS__)
+#define _GMP_LOOP_148(call, ...) call(__VA_ARGS__) _GMP_LOOP_147(call, __VA_ARGS__)
+#define _GMP_LOOP_149(call, ...) call(__VA_ARGS__) _GMP_LOOP_148(call, __VA_ARGS__)
+#define _GMP_LOOP_150(call, ...) call(__VA_ARGS__) _GMP_LOOP_149(call, __VA_ARGS__)
+#define _GMP_LOOP_151(call, ...) call(__VA_ARGS__) _GMP_LOOP_150(call, __VA_ARGS__)
+#define _GMP_LOOP_152(call, ...) call(__VA_ARGS__) _GMP_LOOP_151(call, __VA_ARGS__)
+#define _GMP_LOOP_153(call, ...) call(__VA_ARGS__) _GMP_LOOP_152(call, __VA_ARGS__)
+#define _GMP_LOOP_154(call, ...) call(__VA_ARGS__) _GMP_LOOP_153(call, __VA_ARGS__)
+#define _GMP_LOOP_155(call, ...) call(__VA_ARGS__) _GMP_LOOP_154(call, __VA_ARGS__)
+#define _GMP_LOOP_156(call, ...) call(__VA_ARGS__) _GMP_LOOP_155(call, __VA_ARGS__)
+#define _GMP_LOOP_157(call, ...) call(__VA_ARGS__) _GMP_LOOP_156(call, __VA_ARGS__)
+#define _GMP_LOOP_158(call, ...) call(__VA_ARGS__) _GMP_LOOP_157(call, __VA_ARGS__)
+#define _GMP_LOOP_159(call, ...) call(__VA_ARGS__) _GMP_LOOP_158(call, __VA_ARGS__)
+#define _GMP_LOOP_160(call, ...) call(__VA_ARGS__) _GMP_LOOP_159(call, __VA_ARGS__)
+#define _GMP_LOOP_161(call, ...) call(__VA_ARGS__) _GMP_LOOP_160(call, __VA_ARGS__)
+#define _GMP_LOOP_162(call, ...) call(__VA_ARGS__) _GMP_LOOP_161(call, __VA_ARGS__)
+#define _GMP_LOOP_163(call, ...) call(__VA_ARGS__) _GMP_LOOP_162(call, __VA_ARGS__)
+#define _GMP_LOOP_164(call, ...) call(__VA_ARGS__) _GMP_LOOP_163(call, __VA_ARGS__)
+#define _GMP_LOOP_165(call, ...) call(__VA_ARGS__) _GMP_LOOP_164(call, __VA_ARGS__)
+#define _GMP_LOOP_166(call, ...) call(__VA_ARGS__) _GMP_LOOP_165(call, __VA_ARGS__)
+#define _GMP_LOOP_167(call, ...) call(__VA_ARGS__) _GMP_LOOP_166(call, __VA_ARGS__)
+#define _GMP_LOOP_168(call, ...) call(__VA_ARGS__) _GMP_LOOP_167(call, __VA_ARGS__)
+#define _GMP_LOOP_169(call, ...) call(__VA_ARGS__) _GMP_LOOP_168(call, __VA_ARGS__)
+#define _GMP_LOOP_170(call, ...) call(__VA_ARGS__) _GMP_LOOP_169(call, __VA_ARGS__)
+#define _GMP_LOOP_171(call, ...) call(__VA_ARGS__) _GMP_LOOP_170(call, __VA_ARGS__)
+#define _GMP_LOOP_172(call, ...) call(__VA_ARGS__) _GMP_LOOP_171(call, __VA_ARGS__)
+#define _GMP_LOOP_173(call, ...) call(__VA_ARGS__) _GMP_LOOP_172(call, __VA_ARGS__)
+#define _GMP_LOOP_174(call, ...) call(__VA_ARGS__) _GMP_LOOP_173(call, __VA_ARGS__)
+#define _GMP_LOOP_175(call, ...) call(__VA_ARGS__) _GMP_LOOP_174(call, __VA_ARGS__)
+#define _GMP_LOOP_176(call, ...) call(__VA_ARGS__) _GMP_LOOP_175(call, __VA_ARGS__)
+#define _GMP_LOOP_177(call, ...) call(__VA_ARGS__) _GMP_LOOP_176(call, __VA_ARGS__)
+#define _GMP_LOOP_178(call, ...) call(__VA_ARGS__) _GMP_LOOP_177(call, __VA_ARGS__)
+#define _GMP_LOOP_179(call, ...) call(__VA_ARGS__) _GMP_LOOP_178(call, __VA_ARGS__)
+#define _GMP_LOOP_180(call, ...) call(__VA_ARGS__) _GMP_LOOP_179(call, __VA_ARGS__)
+#define _GMP_LOOP_181(call, ...) call(__VA_ARGS__) _GMP_LOOP_180(call, __VA_ARGS__)
+#define _GMP_LOOP_182(call, ...) call(__VA_ARGS__) _GMP_LOOP_181(call, __VA_ARGS__)
+#define _GMP_LOOP_183(call, ...) call(__VA_ARGS__) _GMP_LOOP_182(call, __VA_ARGS__)
+#define _GMP_LOOP_184(call, ...) call(__VA_ARGS__) _GMP_LOOP_183(call, __VA_ARGS__)
+#define _GMP_LOOP_185(call, ...) call(__VA_ARGS__) _GMP_LOOP_184(call, __VA_ARGS__)
+#define _GMP_LOOP_186(call, ...) call(__VA_ARGS__) _GMP_LOOP_185(call, __VA_ARGS__)
+#define _GMP_LOOP_187(call, ...) call(__VA_ARGS__) _GMP_LOOP_186(call, __VA_ARGS__)
+#define _GMP_LOOP_188(call, ...) call(__VA_ARGS__) _GMP_LOOP_187(call, __VA_ARGS__)
+#define _GMP_LOOP_189(call, ...) call(__VA_ARGS__) _GMP_LOOP_188(call, __VA_ARGS__)
+#define _GMP_LOOP_190(call, ...) call(__VA_ARGS__) _GMP_LOOP_189(call, __VA_ARGS__)
+#define _GMP_LOOP_191(call, ...) call(__VA_ARGS__) _GMP_LOOP_190(call, __VA_ARGS__)
+#define _GMP_LOOP_192(call, ...) call(__VA_ARGS__) _GMP_LOOP_191(call, __VA_ARGS__)
+#define _GMP_LOOP_193(call, ...) call(__VA_ARGS__) _GMP_LOOP_192(call, __VA_ARGS__)
+#define _GMP_LOOP_194(call, ...) call(__VA_ARGS__) _GMP_LOOP_193(call, __VA_ARGS__)
+#define _GMP_LOOP_195(call, ...) call(__VA_ARGS__) _GMP_LOOP_194(call, __VA_ARGS__)
+#define _GMP_LOOP_196(call, ...) call(__VA_ARGS__) _GMP_LOOP_195(call, __VA_ARGS__)
+#define _GMP_LOOP_197(call, ...) call(__VA_ARGS__) _GMP_LOOP_196(call, __VA_ARGS__)
+#define _GMP_LOOP_198(call, ...) call(__VA_ARGS__) _GMP_LOOP_197(call, __VA_ARGS__)
+#define _GMP_LOOP_199(call, ...) call(__VA_ARGS__) _GMP_LOOP_198(call, __VA_ARGS__)
+#define _GMP_LOOP_200(call, ...) call(__VA_ARGS__) _GMP_LOOP_199(call, __VA_ARGS__)
+#define _GMP_LOOP_201(call, ...) call(__VA_ARGS__) _GMP_LOOP_200(call, __VA_ARGS__)
+#define _GMP_LOOP_202(call, ...) call(__VA_ARGS__) _GMP_LOOP_201(call, __VA_ARGS__)
+#define _GMP_LOOP_203(call, ...) call(__VA_ARGS__) _GMP_LOOP_202(call, __VA_ARGS__)
+#define _GMP_LOOP_204(call, ...) call(__VA_ARGS__) _GMP_LOOP_203(call, __VA_ARGS__)
+#define _GMP_LOOP_205(call, ...) call(__VA_ARGS__) _GMP_LOOP_204(call, __VA_ARGS__)
+#define _GMP_LOOP_206(call, ...) call(__VA_ARGS__) _GMP_LOOP_205(call, __VA_ARGS__)
+#define _GMP_LOOP_207(call, ...) call(__VA_ARGS__) _GMP_LOOP_206(call, __VA_ARGS__)
+#define _GMP_LOOP_208(call, ...) call(__VA_ARGS__) _GMP_LOOP_207(call, __VA_ARGS__)
+#define _GMP_LOOP_209(call, ...) call(__VA_ARGS__) _GMP_LOOP_208(call, __VA_ARGS__)
+#define _GMP_LOOP_210(call, ...) call(__VA_ARGS__) _GMP_LOOP_209(call, __VA_ARGS__)
+#define _GMP_LOOP_211(call, ...) call(__VA_ARGS__) _GMP_LOOP_210(call, __VA_ARGS__)
+#define _GMP_LOOP_212(call, ...) call(__VA_ARGS__) _GMP_LOOP_211(call, __VA_ARGS__)
+#define _GMP_LOOP_213(call, ...) call(__VA_ARGS__) _GMP_LOOP_212(call, __VA_ARGS__)
+#define _GMP_LOOP_214(call, ...) call(__VA_ARGS__) _GMP_LOOP_213(call, __VA_ARGS__)
+#define _GMP_LOOP_215(call, ...) call(__VA_ARGS__) _GMP_LOOP_214(call, __VA_ARGS__)
+#define _GMP_LOOP_216(call, ...) call(__VA_ARGS__) _GMP_LOOP_215(call, __VA_ARGS__)
+#define _GMP_LOOP_217(call, ...) call(__VA_ARGS__) _GMP_LOOP_216(call, __VA_ARGS__)
+#define _GMP_LOOP_218(call, ...) call(__VA_ARGS__) _GMP_LOOP_217(call, __VA_ARGS__)
+#define _GMP_LOOP_219(call, ...) call(__VA_ARGS__) _GMP_LOOP_218(call, __VA_ARGS__)
+#define _GMP_LOOP_220(call, ...) call(__VA_ARGS__) _GMP_LOOP_219(call, __VA_ARGS__)
+#define _GMP_LOOP_221(call, ...) call(__VA_ARGS__) _GMP_LOOP_220(call, __VA_ARGS__)
+#define _GMP_LOOP_222(call, ...) call(__VA_ARGS__) _GMP_LOOP_221(call, __VA_ARGS__)
+#define _GMP_LOOP_223(call, ...) call(__VA_ARGS__) _GMP_LOOP_222(call, __VA_ARGS__)
+#define _GMP_LOOP_224(call, ...) call(__VA_ARGS__) _GMP_LOOP_223(call, __VA_ARGS__)
+#define _GMP_LOOP_225(call, ...) call(__VA_ARGS__) _GMP_LOOP_224(call, __VA_ARGS__)
+#define _GMP_LOOP_226(call, ...) call(__VA_ARGS__) _GMP_LOOP_225(call, __VA_ARGS__)
+#define _GMP_LOOP_227(call, ...) call(__VA_ARGS__) _GMP_LOOP_226(call, __VA_ARGS__)
+#define _GMP_LOOP_228(call, ...) call(__VA_ARGS__) _GMP_LOOP_227(call, __VA_ARGS__)
+#define _GMP_LOOP_229(call, ...) call(__VA_ARGS__) _GMP_LOOP_228(call, __VA_ARGS__)
+#define _GMP_LOOP_230(call, ...) call(__VA_ARGS__) _GMP_LOOP_229(call, __VA_ARGS__)
+#define _GMP_LOOP_231(call, ...) call(__VA_ARGS__) _GMP_LOOP_230(call, __VA_ARGS__)
+#define _GMP_LOOP_232(call, ...) call(__VA_ARGS__) _GMP_LOOP_231(call, __VA_ARGS__)
+#define _GMP_LOOP_233(call, ...) call(__VA_ARGS__) _GMP_LOOP_232(call, __VA_ARGS__)
+#define _GMP_LOOP_234(call, ...) call(__VA_ARGS__) _GMP_LOOP_233(call, __VA_ARGS__)
+#define _GMP_LOOP_235(call, ...) call(__VA_ARGS__) _GMP_LOOP_234(call, __VA_ARGS__)
+#define _GMP_LOOP_236(call, ...) call(__VA_ARGS__) _GMP_LOOP_235(call, __VA_ARGS__)
+#define _GMP_LOOP_237(call, ...) call(__VA_ARGS__) _GMP_LOOP_236(call, __VA_ARGS__)
+#define _GMP_LOOP_238(call, ...) call(__VA_ARGS__) _GMP_LOOP_237(call, __VA_ARGS__)
+#define _GMP_LOOP_239(call, ...) call(__VA_ARGS__) _GMP_LOOP_238(call, __VA_ARGS__)
+#define _GMP_LOOP_240(call, ...) call(__VA_ARGS__) _GMP_LOOP_239(call, __VA_ARGS__)
+#define _GMP_LOOP_241(call, ...) call(__VA_ARGS__) _GMP_LOOP_240(call, __VA_ARGS__)
+#define _GMP_LOOP_242(call, ...) call(__VA_ARGS__) _GMP_LOOP_241(call, __VA_ARGS__)
+#define _GMP_LOOP_243(call, ...) call(__VA_ARGS__) _GMP_LOOP_242(call, __VA_ARGS__)
+#define _GMP_LOOP_244(call, ...) call(__VA_ARGS__) _GMP_LOOP_243(call, __VA_ARGS__)
+#define _GMP_LOOP_245(call, ...) call(__VA_ARGS__) _GMP_LOOP_244(call, __VA_ARGS__)
+#define _GMP_LOOP_246(call, ...) call(__VA_ARGS__) _GMP_LOOP_245(call, __VA_ARGS__)
+#define _GMP_LOOP_247(call, ...) call(__VA_ARGS__) _GMP_LOOP_246(call, __VA_ARGS__)
+#define _GMP_LOOP_248(call, ...) call(__VA_ARGS__) _GMP_LOOP_247(call, __VA_ARGS__)
+#define _GMP_LOOP_249(call, ...) call(__VA_ARGS__) _GMP_LOOP_248(call, __VA_ARGS__)
+#define _GMP_LOOP_250(call, ...) call(__VA_ARGS__) _GMP_LOOP_249(call, __VA_ARGS__)
+#define _GMP_LOOP_251(call, ...) call(__VA_ARGS__) _GMP_LOOP_250(call, __VA_ARGS__)
+#define _GMP_LOOP_252(call, ...) call(__VA_ARGS__) _GMP_LOOP_251(call, __VA_ARGS__)
+#define _GMP_LOOP_253(call, ...) call(__VA_ARGS__) _GMP_LOOP_252(call, __VA_ARGS__)
+#define _GMP_LOOP_254(call, ...) call(__VA_ARGS__) _GMP_LOOP_253(call, __VA_ARGS__)
+#define _GMP_LOOP_255(call, ...) call(__VA_ARGS__) _GMP_LOOP_254(call, __VA_ARGS__)
+#define _GMP_LOOP_256(call, ...) call(__VA_ARGS__) _GMP_LOOP_255(call, __VA_ARGS__)
+#define _GMP_LOOP_257(call, ...) call(__VA_ARGS__) _GMP_LOOP_256(call, __VA_ARGS__)
+#define _GMP_LOOP_258(call, ...) call(__VA_ARGS__) _GMP_LOOP_257(call, __VA_ARGS__)
+#define _GMP_LOOP_259(call, ...) call(__VA_ARGS__) _GMP_LOOP_258(call, __VA_ARGS__)
+#define _GMP_LOOP_260(call, ...) call(__VA_ARGS__) _GMP_LOOP_259(call, __VA_ARGS__)
+#define _GMP_LOOP_261(call, ...) call(__VA_ARGS__) _GMP_LOOP_260(call, __VA_ARGS__)
+#define _GMP_LOOP_262(call, ...) call(__VA_ARGS__) _GMP_LOOP_261(call, __VA_ARGS__)
+#define _GMP_LOOP_263(call, ...) call(__VA_ARGS__) _GMP_LOOP_262(call, __VA_ARGS__)
+#define _GMP_LOOP_264(call, ...) call(__VA_ARGS__) _GMP_LOOP_263(call, __VA_ARGS__)
+#define _GMP_LOOP_265(call, ...) call(__VA_ARGS__) _GMP_LOOP_264(call, __VA_ARGS__)
+#define _GMP_LOOP_266(call, ...) call(__VA_ARGS__) _GMP_LOOP_265(call, __VA_ARGS__)
+#define _GMP_LOOP_267(call, ...) call(__VA_ARGS__) _GMP_LOOP_266(call, __VA_ARGS__)
+#define _GMP_LOOP_268(call, ...) call(__VA_ARGS__) _GMP_LOOP_267(call, __VA_ARGS__)
+#define _GMP_LOOP_269(call, ...) call(__VA_ARGS__) _GMP_LOOP_268(call, __VA_ARGS__)
+#define _GMP_LOOP_270(call, ...) call(__VA_ARGS__) _GMP_LOOP_269(call, __VA_ARGS__)
+#define _GMP_LOOP_271(call, ...) call(__VA_ARGS__) _GMP_LOOP_270(call, __VA_ARGS__)
+#define _GMP_LOOP_272(call, ...) call(__VA_ARGS__) _GMP_LOOP_271(call, __VA_ARGS__)
+#define _GMP_LOOP_273(call, ...) call(__VA_ARGS__) _GMP_LOOP_272(call, __VA_ARGS__)
+#define _GMP_LOOP_274(call, ...) call(__VA_ARGS__) _GMP_LOOP_273(call, __VA_ARGS__)
+#define _GMP_LOOP_275(call, ...) call(__VA_ARGS__) _GMP_LOOP_274(call, __VA_ARGS__)
+#define _GMP_LOOP_276(call, ...) call(__VA_ARGS__) _GMP_LOOP_275(call, __VA_ARGS__)
+#define _GMP_LOOP_277(call, ...) call(__VA_ARGS__) _GMP_LOOP_276(call, __VA_ARGS__)
+#define _GMP_LOOP_278(call, ...) call(__VA_ARGS__) _GMP_LOOP_277(call, __VA_ARGS__)
+#define _GMP_LOOP_279(call, ...) call(__VA_ARGS__) _GMP_LOOP_278(call, __VA_ARGS__)
+#define _GMP_LOOP_280(call, ...) call(__VA_ARGS__) _GMP_LOOP_279(call, __VA_ARGS__)
+#define _GMP_LOOP_281(call, ...) call(__VA_ARGS__) _GMP_LOOP_280(call, __VA_ARGS__)
+#define _GMP_LOOP_282(call, ...) call(__VA_ARGS__) _GMP_LOOP_281(call, __VA_ARGS__)
+#define _GMP_LOOP_283(call, ...) call(__VA_ARGS__) _GMP_LOOP_282(call, __VA_ARGS__)
+#define _GMP_LOOP_284(call, ...) call(__VA_ARGS__) _GMP_LOOP_283(call, __VA_ARGS__)
+#define _GMP_LOOP_285(call, ...) call(__VA_ARGS__) _GMP_LOOP_284(call, __VA_ARGS__)
+#define _GMP_LOOP_286(call, ...) call(__VA_ARGS__) _GMP_LOOP_285(call, __VA_ARGS__)
+#define _GMP_LOOP_287(call, ...) call(__VA_ARGS__) _GMP_LOOP_286(call, __VA_ARGS__)
+#define _GMP_LOOP_288(call, ...) call(__VA_ARGS__) _GMP_LOOP_287(call, __VA_ARGS__)
+#define _GMP_LOOP_289(call, ...) call(__VA_ARGS__) _GMP_LOOP_288(call, __VA_ARGS__)
+#define _GMP_LOOP_290(call, ...) call(__VA_ARGS__) _GMP_LOOP_289(call, __VA_ARGS__)
+#define _GMP_LOOP_291(call, ...) call(__VA_ARGS__) _GMP_LOOP_290(call, __VA_ARGS__)
+#define _GMP_LOOP_292(call, ...) call(__VA_ARGS__) _GMP_LOOP_291(call, __VA_ARGS__)
+#define _GMP_LOOP_293(call, ...) call(__VA_ARGS__) _GMP_LOOP_292(call, __VA_ARGS__)
+#define _GMP_LOOP_294(call, ...) call(__VA_ARGS__) _GMP_LOOP_293(call, __VA_ARGS__)
+#define _GMP_LOOP_295(call, ...) call(__VA_ARGS__) _GMP_LOOP_294(call, __VA_ARGS__)
+#define _GMP_LOOP_296(call, ...) call(__VA_ARGS__) _GMP_LOOP_295(call, __VA_ARGS__)
+#define _GMP_LOOP_297(call, ...) call(__VA_ARGS__) _GMP_LOOP_296(call, __VA_ARGS__)
+#define _GMP_LOOP_298(call, ...) call(__VA_ARGS__) _GMP_LOOP_297(call, __VA_ARGS__)
+#define _GMP_LOOP_299(call, ...) call(__VA_ARGS__) _GMP_LOOP_298(call, __VA_ARGS__)
+#define _GMP_LOOP_300(call, ...) call(__VA_ARGS__) _GMP_LOOP_299(call, __VA_ARGS__)
+#define _GMP_LOOP_301(call, ...) call(__VA_ARGS__) _GMP_LOOP_300(call, __VA_ARGS__)
+#define _GMP_LOOP_302(call, ...) call(__VA_ARGS__) _GMP_LOOP_301(call, __VA_ARGS__)
+#define _GMP_LOOP_303(call, ...) call(__VA_ARGS__) _GMP_LOOP_302(call, __VA_ARGS__)
+#define _GMP_LOOP_304(call, ...) call(__VA_ARGS__) _GMP_LOOP_303(call, __VA_ARGS__)
+#define _GMP_LOOP_305(call, ...) call(__VA_ARGS__) _GMP_LOOP_304(call, __VA_ARGS__)
+#define _GMP_LOOP_306(call, ...) call(__VA_ARGS__) _GMP_LOOP_305(call, __VA_ARGS__)
+#define _GMP_LOOP_307(call, ...) call(__VA_ARGS__) _GMP_LOOP_306(call, __VA_ARGS__)
+#define _GMP_LOOP_308(call, ...) call(__VA_ARGS__) _GMP_LOOP_307(call, __VA_ARGS__)
+#define _GMP_LOOP_309(call, ...) call(__VA_ARGS__) _GMP_LOOP_308(call, __VA_ARGS__)
+#define _GMP_LOOP_310(call, ...) call(__VA_ARGS__) _GMP_LOOP_309(call, __VA_ARGS__)
+#define _GMP_LOOP_311(call, ...) call(__VA_ARGS__) _GMP_LOOP_310(call, __VA_ARGS__)
+#define _GMP_LOOP_312(call, ...) call(__VA_ARGS__) _GMP_LOOP_311(call, __VA_ARGS__)
+#define _GMP_LOOP_313(call, ...) call(__VA_ARGS__) _GMP_LOOP_312(call, __VA_ARGS__)
+#define _GMP_LOOP_314(call, ...) call(__VA_ARGS__) _GMP_LOOP_313(call, __VA_ARGS__)
+#define _GMP_LOOP_315(call, ...) call(__VA_ARGS__) _GMP_LOOP_314(call, __VA_ARGS__)
+#define _GMP_LOOP_316(call, ...) call(__VA_ARGS__) _GMP_LOOP_315(call, __VA_ARGS__)
+#define _GMP_LOOP_317(call, ...) call(__VA_ARGS__) _GMP_LOOP_316(call, __VA_ARGS__)
+#define _GMP_LOOP_318(call, ...) call(__VA_ARGS__) _GMP_LOOP_317(call, __VA_ARGS__)
+#define _GMP_LOOP_319(call, ...) call(__VA_ARGS__) _GMP_LOOP_318(call, __VA_ARGS__)
+#define _GMP_LOOP_320(call, ...) call(__VA_ARGS__) _GMP_LOOP_319(call, __VA_ARGS__)
+#define _GMP_LOOP_321(call, ...) call(__VA_ARGS__) _GMP_LOOP_320(call, __VA_ARGS__)
+#define _GMP_LOOP_322(call, ...) call(__VA_ARGS__) _GMP_LOOP_321(call, __VA_ARGS__)
+#define _GMP_LOOP_323(call, ...) call(__VA_ARGS__) _GMP_LOOP_322(call, __VA_ARGS__)
+#define _GMP_LOOP_324(call, ...) call(__VA_ARGS__) _GMP_LOOP_323(call, __VA_ARGS__)
+#define _GMP_LOOP_325(call, ...) call(__VA_ARGS__) _GMP_LOOP_324(call, __VA_ARGS__)
+#define _GMP_LOOP_326(call, ...) call(__VA_ARGS__) _GMP_LOOP_325(call, __VA_ARGS__)
+#define _GMP_LOOP_327(call, ...) call(__VA_ARGS__) _GMP_LOOP_326(call, __VA_ARGS__)
+#define _GMP_LOOP_328(call, ...) call(__VA_ARGS__) _GMP_LOOP_327(call, __VA_ARGS__)
+#define _GMP_LOOP_329(call, ...) call(__VA_ARGS__) _GMP_LOOP_328(call, __VA_ARGS__)
+#define _GMP_LOOP_330(call, ...) call(__VA_ARGS__) _GMP_LOOP_329(call, __VA_ARGS__)
+#define _GMP_LOOP_331(call, ...) call(__VA_ARGS__) _GMP_LOOP_330(call, __VA_ARGS__)
+#define _GMP_LOOP_332(call, ...) call(__VA_ARGS__) _GMP_LOOP_331(call, __VA_ARGS__)
+#define _GMP_LOOP_333(call, ...) call(__VA_ARGS__) _GMP_LOOP_332(call, __VA_ARGS__)
+#define _GMP_LOOP_334(call, ...) call(__VA_ARGS__) _GMP_LOOP_333(call, __VA_ARGS__)
+#define _GMP_LOOP_335(call, ...) call(__VA_ARGS__) _GMP_LOOP_334(call, __VA_ARGS__)
+#define _GMP_LOOP_336(call, ...) call(__VA_ARGS__) _GMP_LOOP_335(call, __VA_ARGS__)
+#define _GMP_LOOP_337(call, ...) call(__VA_ARGS__) _GMP_LOOP_336(call, __VA_ARGS__)
+#define _GMP_LOOP_338(call, ...) call(__VA_ARGS__) _GMP_LOOP_337(call, __VA_ARGS__)
+#define _GMP_LOOP_339(call, ...) call(__VA_ARGS__) _GMP_LOOP_338(call, __VA_ARGS__)
+#define _GMP_LOOP_340(call, ...) call(__VA_ARGS__) _GMP_LOOP_339(call, __VA_ARGS__)
+#define _GMP_LOOP_341(call, ...) call(__VA_ARGS__) _GMP_LOOP_340(call, __VA_ARGS__)
+#define _GMP_LOOP_342(call, ...) call(__VA_ARGS__) _GMP_LOOP_341(call, __VA_ARGS__)
+#define _GMP_LOOP_343(call, ...) call(__VA_ARGS__) _GMP_LOOP_342(call, __VA_ARGS__)
+#define _GMP_LOOP_344(call, ...) call(__VA_ARGS__) _GMP_LOOP_343(call, __VA_ARGS__)
+#define _GMP_LOOP_345(call, ...) call(__VA_ARGS__) _GMP_LOOP_344(call, __VA_ARGS__)
+#define _GMP_LOOP_346(call, ...) call(__VA_ARGS__) _GMP_LOOP_345(call, __VA_ARGS__)
+#define _GMP_LOOP_347(call, ...) call(__VA_ARGS__) _GMP_LOOP_346(call, __VA_ARGS__)
+#define _GMP_LOOP_348(call, ...) call(__VA_ARGS__) _GMP_LOOP_347(call, __VA_ARGS__)
+#define _GMP_LOOP_349(call, ...) call(__VA_ARGS__) _GMP_LOOP_348(call, __VA_ARGS__)
+#define _GMP_LOOP_350(call, ...) call(__VA_ARGS__) _GMP_LOOP_349(call, __VA_ARGS__)
+#define _GMP_LOOP_351(call, ...) call(__VA_ARGS__) _GMP_LOOP_350(call, __VA_ARGS__)
+#define _GMP_LOOP_352(call, ...) call(__VA_ARGS__) _GMP_LOOP_351(call, __VA_ARGS__)
+#define _GMP_LOOP_353(call, ...) call(__VA_ARGS__) _GMP_LOOP_352(call, __VA_ARGS__)
+#define _GMP_LOOP_354(call, ...) call(__VA_ARGS__) _GMP_LOOP_353(call, __VA_ARGS__)
+#define _GMP_LOOP_355(call, ...) call(__VA_ARGS__) _GMP_LOOP_354(call, __VA_ARGS__)
+#define _GMP_LOOP_356(call, ...) call(__VA_ARGS__) _GMP_LOOP_355(call, __VA_ARGS__)
+#define _GMP_LOOP_357(call, ...) call(__VA_ARGS__) _GMP_LOOP_356(call, __VA_ARGS__)
+#define _GMP_LOOP_358(call, ...) call(__VA_ARGS__) _GMP_LOOP_357(call, __VA_ARGS__)
+#define _GMP_LOOP_359(call, ...) call(__VA_ARGS__) _GMP_LOOP_358(call, __VA_ARGS__)
+#define _GMP_LOOP_360(call, ...) call(__VA_ARGS__) _GMP_LOOP_359(call, __VA_ARGS__)
+#define _GMP_LOOP_361(call, ...) call(__VA_ARGS__) _GMP_LOOP_360(call, __VA_ARGS__)
+#define _GMP_LOOP_362(call, ...) call(__VA_ARGS__) _GMP_LOOP_361(call, __VA_ARGS__)
+#define _GMP_LOOP_363(call, ...) call(__VA_ARGS__) _GMP_LOOP_362(call, __VA_ARGS__)
+#define _GMP_LOOP_364(call, ...) call(__VA_ARGS__) _GMP_LOOP_363(call, __VA_ARGS__)
+#define _GMP_LOOP_365(call, ...) call(__VA_ARGS__) _GMP_LOOP_364(call, __VA_ARGS__)
+#define _GMP_LOOP_366(call, ...) call(__VA_ARGS__) _GMP_LOOP_365(call, __VA_ARGS__)
+#define _GMP_LOOP_367(call, ...) call(__VA_ARGS__) _GMP_LOOP_366(call, __VA_ARGS__)
+#define _GMP_LOOP_368(call, ...) call(__VA_ARGS__) _GMP_LOOP_367(call, __VA_ARGS__)
+#define _GMP_LOOP_369(call, ...) call(__VA_ARGS__) _GMP_LOOP_368(call, __VA_ARGS__)
+#define _GMP_LOOP_370(call, ...) call(__VA_ARGS__) _GMP_LOOP_369(call, __VA_ARGS__)
+#define _GMP_LOOP_371(call, ...) call(__VA_ARGS__) _GMP_LOOP_370(call, __VA_ARGS__)
+#define _GMP_LOOP_372(call, ...) call(__VA_ARGS__) _GMP_LOOP_371(call, __VA_ARGS__)
+#define _GMP_LOOP_373(call, ...) call(__VA_ARGS__) _GMP_LOOP_372(call, __VA_ARGS__)
+#define _GMP_LOOP_374(call, ...) call(__VA_ARGS__) _GMP_LOOP_373(call, __VA_ARGS__)
+#define _GMP_LOOP_375(call, ...) call(__VA_ARGS__) _GMP_LOOP_374(call, __VA_ARGS__)
+#define _GMP_LOOP_376(call, ...) call(__VA_ARGS__) _GMP_LOOP_375(call, __VA_ARGS__)
+#define _GMP_LOOP_377(call, ...) call(__VA_ARGS__) _GMP_LOOP_376(call, __VA_ARGS__)
+#define _GMP_LOOP_378(call, ...) call(__VA_ARGS__) _GMP_LOOP_377(call, __VA_ARGS__)
+#define _GMP_LOOP_379(call, ...) call(__VA_ARGS__) _GMP_LOOP_378(call, __VA_ARGS__)
+#define _GMP_LOOP_380(call, ...) call(__VA_ARGS__) _GMP_LOOP_379(call, __VA_ARGS__)
+#define _GMP_LOOP_381(call, ...) call(__VA_ARGS__) _GMP_LOOP_380(call, __VA_ARGS__)
+#define _GMP_LOOP_382(call, ...) call(__VA_ARGS__) _GMP_LOOP_381(call, __VA_ARGS__)
+#define _GMP_LOOP_383(call, ...) call(__VA_ARGS__) _GMP_LOOP_382(call, __VA_ARGS__)
+#define _GMP_LOOP_384(call, ...) call(__VA_ARGS__) _GMP_LOOP_383(call, __VA_ARGS__)
+#define _GMP_LOOP_385(call, ...) call(__VA_ARGS__) _GMP_LOOP_384(call, __VA_ARGS__)
+#define _GMP_LOOP_386(call, ...) call(__VA_ARGS__) _GMP_LOOP_385(call, __VA_ARGS__)
+#define _GMP_LOOP_387(call, ...) call(__VA_ARGS__) _GMP_LOOP_386(call, __VA_ARGS__)
+#define _GMP_LOOP_388(call, ...) call(__VA_ARGS__) _GMP_LOOP_387(call, __VA_ARGS__)
+#define _GMP_LOOP_389(call, ...) call(__VA_ARGS__) _GMP_LOOP_388(call, __VA_ARGS__)
+#define _GMP_LOOP_390(call, ...) call(__VA_ARGS__) _GMP_LOOP_389(call, __VA_ARGS__)
+#define _GMP_LOOP_391(call, ...) call(__VA_ARGS__) _GMP_LOOP_390(call, __VA_ARGS__)
+#define _GMP_LOOP_392(call, ...) call(__VA_ARGS__) _GMP_LOOP_391(call, __VA_ARGS__)
+#define _GMP_LOOP_393(call, ...) call(__VA_ARGS__) _GMP_LOOP_392(call, __VA_ARGS__)
+#define _GMP_LOOP_394(call, ...) call(__VA_ARGS__) _GMP_LOOP_393(call, __VA_ARGS__)
+#define _GMP_LOOP_395(call, ...) call(__VA_ARGS__) _GMP_LOOP_394(call, __VA_ARGS__)
+#define _GMP_LOOP_396(call, ...) call(__VA_ARGS__) _GMP_LOOP_395(call, __VA_ARGS__)
+#define _GMP_LOOP_397(call, ...) call(__VA_ARGS__) _GMP_LOOP_396(call, __VA_ARGS__)
+#define _GMP_LOOP_398(call, ...) call(__VA_ARGS__) _GMP_LOOP_397(call, __VA_ARGS__)
+#define _GMP_LOOP_399(call, ...) call(__VA_ARGS__) _GMP_LOOP_398(call, __VA_ARGS__)
+#define _GMP_LOOP_400(call, ...) call(__VA_ARGS__) _GMP_LOOP_399(call, __VA_ARGS__)
+#define _GMP_LOOP_401(call, ...) call(__VA_ARGS__) _GMP_LOOP_400(call, __VA_ARGS__)
+#define _GMP_LOOP_402(call, ...) call(__VA_ARGS__) _GMP_LOOP_401(call, __VA_ARGS__)
+#define _GMP_LOOP_403(call, ...) call(__VA_ARGS__) _GMP_LOOP_402(call, __VA_ARGS__)
+#define _GMP_LOOP_404(call, ...) call(__VA_ARGS__) _GMP_LOOP_403(call, __VA_ARGS__)
+#define _GMP_LOOP_405(call, ...) call(__VA_ARGS__) _GMP_LOOP_404(call, __VA_ARGS__)
+#define _GMP_LOOP_406(call, ...) call(__VA_ARGS__) _GMP_LOOP_405(call, __VA_ARGS__)
+#define _GMP_LOOP_407(call, ...) call(__VA_ARGS__) _GMP_LOOP_406(call, __VA_ARGS__)
+#define _GMP_LOOP_408(call, ...) call(__VA_ARGS__) _GMP_LOOP_407(call, __VA_ARGS__)
+#define _GMP_LOOP_409(call, ...) call(__VA_ARGS__) _GMP_LOOP_408(call, __VA_ARGS__)
+#define _GMP_LOOP_410(call, ...) call(__VA_ARGS__) _GMP_LOOP_409(call, __VA_ARGS__)
+#define _GMP_LOOP_411(call, ...) call(__VA_ARGS__) _GMP_LOOP_410(call, __VA_ARGS__)
+#define _GMP_LOOP_412(call, ...) call(__VA_ARGS__) _GMP_LOOP_411(call, __VA_ARGS__)
+#define _GMP_LOOP_413(call, ...) call(__VA_ARGS__) _GMP_LOOP_412(call, __VA_ARGS__)
+#define _GMP_LOOP_414(call, ...) call(__VA_ARGS__) _GMP_LOOP_413(call, __VA_ARGS__)
+#define _GMP_LOOP_415(call, ...) call(__VA_ARGS__) _GMP_LOOP_414(call, __VA_ARGS__)
+#define _GMP_LOOP_416(call, ...) call(__VA_ARGS__) _GMP_LOOP_415(call, __VA_ARGS__)
+#define _GMP_LOOP_417(call, ...) call(__VA_ARGS__) _GMP_LOOP_416(call, __VA_ARGS__)
+#define _GMP_LOOP_418(call, ...) call(__VA_ARGS__) _GMP_LOOP_417(call, __VA_ARGS__)
+#define _GMP_LOOP_419(call, ...) call(__VA_ARGS__) _GMP_LOOP_418(call, __VA_ARGS__)
+#define _GMP_LOOP_420(call, ...) call(__VA_ARGS__) _GMP_LOOP_419(call, __VA_ARGS__)
+#define _GMP_LOOP_421(call, ...) call(__VA_ARGS__) _GMP_LOOP_420(call, __VA_ARGS__)
+#define _GMP_LOOP_422(call, ...) call(__VA_ARGS__) _GMP_LOOP_421(call, __VA_ARGS__)
+#define _GMP_LOOP_423(call, ...) call(__VA_ARGS__) _GMP_LOOP_422(call, __VA_ARGS__)
+#define _GMP_LOOP_424(call, ...) call(__VA_ARGS__) _GMP_LOOP_423(call, __VA_ARGS__)
+#define _GMP_LOOP_425(call, ...) call(__VA_ARGS__) _GMP_LOOP_424(call, __VA_ARGS__)
+#define _GMP_LOOP_426(call, ...) call(__VA_ARGS__) _GMP_LOOP_425(call, __VA_ARGS__)
+#define _GMP_LOOP_427(call, ...) call(__VA_ARGS__) _GMP_LOOP_426(call, __VA_ARGS__)
+#define _GMP_LOOP_428(call, ...) call(__VA_ARGS__) _GMP_LOOP_427(call, __VA_ARGS__)
+#define _GMP_LOOP_429(call, ...) call(__VA_ARGS__) _GMP_LOOP_428(call, __VA_ARGS__)
+#define _GMP_LOOP_430(call, ...) call(__VA_ARGS__) _GMP_LOOP_429(call, __VA_ARGS__)
+#define _GMP_LOOP_431(call, ...) call(__VA_ARGS__) _GMP_LOOP_430(call, __VA_ARGS__)
+#define _GMP_LOOP_432(call, ...) call(__VA_ARGS__) _GMP_LOOP_431(call, __VA_ARGS__)
+#define _GMP_LOOP_433(call, ...) call(__VA_ARGS__) _GMP_LOOP_432(call, __VA_ARGS__)
+#define _GMP_LOOP_434(call, ...) call(__VA_ARGS__) _GMP_LOOP_433(call, __VA_ARGS__)
+#define _GMP_LOOP_435(call, ...) call(__VA_ARGS__) _GMP_LOOP_434(call, __VA_ARGS__)
+#define _GMP_LOOP_436(call, ...) call(__VA_ARGS__) _GMP_LOOP_435(call, __VA_ARGS__)
+#define _GMP_LOOP_437(call, ...) call(__VA_ARGS__) _GMP_LOOP_436(call, __VA_ARGS__)
+#define _GMP_LOOP_438(call, ...) call(__VA_ARGS__) _GMP_LOOP_437(call, __VA_ARGS__)
+#define _GMP_LOOP_439(call, ...) call(__VA_ARGS__) _GMP_LOOP_438(call, __VA_ARGS__)
+#define _GMP_LOOP_440(call, ...) call(__VA_ARGS__) _GMP_LOOP_439(call, __VA_ARGS__)
+#define _GMP_LOOP_441(call, ...) call(__VA_ARGS__) _GMP_LOOP_440(call, __VA_ARGS__)
+#define _GMP_LOOP_442(call, ...) call(__VA_ARGS__) _GMP_LOOP_441(call, __VA_ARGS__)
+#define _GMP_LOOP_443(call, ...) call(__VA_ARGS__) _GMP_LOOP_442(call, __VA_ARGS__)
+#define _GMP_LOOP_444(call, ...) call(__VA_ARGS__) _GMP_LOOP_443(call, __VA_ARGS__)
+#define _GMP_LOOP_445(call, ...) call(__VA_ARGS__) _GMP_LOOP_444(call, __VA_ARGS__)
+#define _GMP_LOOP_446(call, ...) call(__VA_ARGS__) _GMP_LOOP_445(call, __VA_ARGS__)
+#define _GMP_LOOP_447(call, ...) call(__VA_ARGS__) _GMP_LOOP_446(call, __VA_ARGS__)
+#define _GMP_LOOP_448(call, ...) call(__VA_ARGS__) _GMP_LOOP_447(call, __VA_ARGS__)
+#define _GMP_LOOP_449(call, ...) call(__VA_ARGS__) _GMP_LOOP_448(call, __VA_ARGS__)
+#define _GMP_LOOP_450(call, ...) call(__VA_ARGS__) _GMP_LOOP_449(call, __VA_ARGS__)
+#define _GMP_LOOP_451(call, ...) call(__VA_ARGS__) _GMP_LOOP_450(call, __VA_ARGS__)
+#define _GMP_LOOP_452(call, ...) call(__VA_ARGS__) _GMP_LOOP_451(call, __VA_ARGS__)
+#define _GMP_LOOP_453(call, ...) call(__VA_ARGS__) _GMP_LOOP_452(call, __VA_ARGS__)
+#define _GMP_LOOP_454(call, ...) call(__VA_ARGS__) _GMP_LOOP_453(call, __VA_ARGS__)
+#define _GMP_LOOP_455(call, ...) call(__VA_ARGS__) _GMP_LOOP_454(call, __VA_ARGS__)
+#define _GMP_LOOP_456(call, ...) call(__VA_ARGS__) _GMP_LOOP_455(call, __VA_ARGS__)
+#define _GMP_LOOP_457(call, ...) call(__VA_ARGS__) _GMP_LOOP_456(call, __VA_ARGS__)
+#define _GMP_LOOP_458(call, ...) call(__VA_ARGS__) _GMP_LOOP_457(call, __VA_ARGS__)
+#define _GMP_LOOP_459(call, ...) call(__VA_ARGS__) _GMP_LOOP_458(call, __VA_ARGS__)
+#define _GMP_LOOP_460(call, ...) call(__VA_ARGS__) _GMP_LOOP_459(call, __VA_ARGS__)
+#define _GMP_LOOP_461(call, ...) call(__VA_ARGS__) _GMP_LOOP_460(call, __VA_ARGS__)
+#define _GMP_LOOP_462(call, ...) call(__VA_ARGS__) _GMP_LOOP_461(call, __VA_ARGS__)
+#define _GMP_LOOP_463(call, ...) call(__VA_ARGS__) _GMP_LOOP_462(call, __VA_ARGS__)
+#define _GMP_LOOP_464(call, ...) call(__VA_ARGS__) _GMP_LOOP_463(call, __VA_ARGS__)
+#define _GMP_LOOP_465(call, ...) call(__VA_ARGS__) _GMP_LOOP_464(call, __VA_ARGS__)
+#define _GMP_LOOP_466(call, ...) call(__VA_ARGS__) _GMP_LOOP_465(call, __VA_ARGS__)
+#define _GMP_LOOP_467(call, ...) call(__VA_ARGS__) _GMP_LOOP_466(call, __VA_ARGS__)
+#define _GMP_LOOP_468(call, ...) call(__VA_ARGS__) _GMP_LOOP_467(call, __VA_ARGS__)
+#define _GMP_LOOP_469(call, ...) call(__VA_ARGS__) _GMP_LOOP_468(call, __VA_ARGS__)
+#define _GMP_LOOP_470(call, ...) call(__VA_ARGS__) _GMP_LOOP_469(call, __VA_ARGS__)
+#define _GMP_LOOP_471(call, ...) call(__VA_ARGS__) _GMP_LOOP_470(call, __VA_ARGS__)
+#define _GMP_LOOP_472(call, ...) call(__VA_ARGS__) _GMP_LOOP_471(call, __VA_ARGS__)
+#define _GMP_LOOP_473(call, ...) call(__VA_ARGS__) _GMP_LOOP_472(call, __VA_ARGS__)
+#define _GMP_LOOP_474(call, ...) call(__VA_ARGS__) _GMP_LOOP_473(call, __VA_ARGS__)
+#define _GMP_LOOP_475(call, ...) call(__VA_ARGS__) _GMP_LOOP_474(call, __VA_ARGS__)
+#define _GMP_LOOP_476(call, ...) call(__VA_ARGS__) _GMP_LOOP_475(call, __VA_ARGS__)
+#define _GMP_LOOP_477(call, ...) call(__VA_ARGS__) _GMP_LOOP_476(call, __VA_ARGS__)
+#define _GMP_LOOP_478(call, ...) call(__VA_ARGS__) _GMP_LOOP_477(call, __VA_ARGS__)
+#define _GMP_LOOP_479(call, ...) call(__VA_ARGS__) _GMP_LOOP_478(call, __VA_ARGS__)
+#define _GMP_LOOP_480(call, ...) call(__VA_ARGS__) _GMP_LOOP_479(call, __VA_ARGS__)
+#define _GMP_LOOP_481(call, ...) call(__VA_ARGS__) _GMP_LOOP_480(call, __VA_ARGS__)
+#define _GMP_LOOP_482(call, ...) call(__VA_ARGS__) _GMP_LOOP_481(call, __VA_ARGS__)
+#define _GMP_LOOP_483(call, ...) call(__VA_ARGS__) _GMP_LOOP_482(call, __VA_ARGS__)
+#define _GMP_LOOP_484(call, ...) call(__VA_ARGS__) _GMP_LOOP_483(call, __VA_ARGS__)
+#define _GMP_LOOP_485(call, ...) call(__VA_ARGS__) _GMP_LOOP_484(call, __VA_ARGS__)
+#define _GMP_LOOP_486(call, ...) call(__VA_ARGS__) _GMP_LOOP_485(call, __VA_ARGS__)
+#define _GMP_LOOP_487(call, ...) call(__VA_ARGS__) _GMP_LOOP_486(call, __VA_ARGS__)
+#define _GMP_LOOP_488(call, ...) call(__VA_ARGS__) _GMP_LOOP_487(call, __VA_ARGS__)
+#define _GMP_LOOP_489(call, ...) call(__VA_ARGS__) _GMP_LOOP_488(call, __VA_ARGS__)
+#define _GMP_LOOP_490(call, ...) call(__VA_ARGS__) _GMP_LOOP_489(call, __VA_ARGS__)
+#define _GMP_LOOP_491(call, ...) call(__VA_ARGS__) _GMP_LOOP_490(call, __VA_ARGS__)
+#define _GMP_LOOP_492(call, ...) call(__VA_ARGS__) _GMP_LOOP_491(call, __VA_ARGS__)
+#define _GMP_LOOP_493(call, ...) call(__VA_ARGS__) _GMP_LOOP_492(call, __VA_ARGS__)
+#define _GMP_LOOP_494(call, ...) call(__VA_ARGS__) _GMP_LOOP_493(call, __VA_ARGS__)
+#define _GMP_LOOP_495(call, ...) call(__VA_ARGS__) _GMP_LOOP_494(call, __VA_ARGS__)
+#define _GMP_LOOP_496(call, ...) call(__VA_ARGS__) _GMP_LOOP_495(call, __VA_ARGS__)
+#define _GMP_LOOP_497(call, ...) call(__VA_ARGS__) _GMP_LOOP_496(call, __VA_ARGS__)
+#define _GMP_LOOP_498(call, ...) call(__VA_ARGS__) _GMP_LOOP_497(call, __VA_ARGS__)
+#define _GMP_LOOP_499(call, ...) call(__VA_ARGS__) _GMP_LOOP_498(call, __VA_ARGS__)
+#define _GMP_LOOP_500(call, ...) call(__VA_ARGS__) _GMP_LOOP_499(call, __VA_ARGS__)
+#define _GMP_LOOP_501(call, ...) call(__VA_ARGS__) _GMP_LOOP_500(call, __VA_ARGS__)
+#define _GMP_LOOP_502(call, ...) call(__VA_ARGS__) _GMP_LOOP_501(call, __VA_ARGS__)
+#define _GMP_LOOP_503(call, ...) call(__VA_ARGS__) _GMP_LOOP_502(call, __VA_ARGS__)
+#define _GMP_LOOP_504(call, ...) call(__VA_ARGS__) _GMP_LOOP_503(call, __VA_ARGS__)
+#define _GMP_LOOP_505(call, ...) call(__VA_ARGS__) _GMP_LOOP_504(call, __VA_ARGS__)
+#define _GMP_LOOP_506(call, ...) call(__VA_ARGS__) _GMP_LOOP_505(call, __VA_ARGS__)
+#define _GMP_LOOP_507(call, ...) call(__VA_ARGS__) _GMP_LOOP_506(call, __VA_ARGS__)
+#define _GMP_LOOP_508(call, ...) call(__VA_ARGS__) _GMP_LOOP_507(call, __VA_ARGS__)
+#define _GMP_LOOP_509(call, ...) call(__VA_ARGS__) _GMP_LOOP_508(call, __VA_ARGS__)
+#define _GMP_LOOP_510(call, ...) call(__VA_ARGS__) _GMP_LOOP_509(call, __VA_ARGS__)
+#define _GMP_LOOP_511(call, ...) call(__VA_ARGS__) _GMP_LOOP_510(call, __VA_ARGS__)
+#define _GMP_LOOP_512(call, ...) call(__VA_ARGS__) _GMP_LOOP_511(call, __VA_ARGS__)
+#define _GMP_LOOP_513(call, ...) call(__VA_ARGS__) _GMP_LOOP_512(call, __VA_ARGS__)
+#define _GMP_LOOP_514(call, ...) call(__VA_ARGS__) _GMP_LOOP_513(call, __VA_ARGS__)
+#define _GMP_LOOP_515(call, ...) call(__VA_ARGS__) _GMP_LOOP_514(call, __VA_ARGS__)
+#define _GMP_LOOP_516(call, ...) call(__VA_ARGS__) _GMP_LOOP_515(call, __VA_ARGS__)
+#define _GMP_LOOP_517(call, ...) call(__VA_ARGS__) _GMP_LOOP_516(call, __VA_ARGS__)
+#define _GMP_LOOP_518(call, ...) call(__VA_ARGS__) _GMP_LOOP_517(call, __VA_ARGS__)
+#define _GMP_LOOP_519(call, ...) call(__VA_ARGS__) _GMP_LOOP_518(call, __VA_ARGS__)
+#define _GMP_LOOP_520(call, ...) call(__VA_ARGS__) _GMP_LOOP_519(call, __VA_ARGS__)
+#define _GMP_LOOP_521(call, ...) call(__VA_ARGS__) _GMP_LOOP_520(call, __VA_ARGS__)
+#define _GMP_LOOP_522(call, ...) call(__VA_ARGS__) _GMP_LOOP_521(call, __VA_ARGS__)
+#define _GMP_LOOP_523(call, ...) call(__VA_ARGS__) _GMP_LOOP_522(call, __VA_ARGS__)
+#define _GMP_LOOP_524(call, ...) call(__VA_ARGS__) _GMP_LOOP_523(call, __VA_ARGS__)
+#define _GMP_LOOP_525(call, ...) call(__VA_ARGS__) _GMP_LOOP_524(call, __VA_ARGS__)
+#define _GMP_LOOP_526(call, ...) call(__VA_ARGS__) _GMP_LOOP_525(call, __VA_ARGS__)
+#define _GMP_LOOP_527(call, ...) call(__VA_ARGS__) _GMP_LOOP_526(call, __VA_ARGS__)
+#define _GMP_LOOP_528(call, ...) call(__VA_ARGS__) _GMP_LOOP_527(call, __VA_ARGS__)
+#define _GMP_LOOP_529(call, ...) call(__VA_ARGS__) _GMP_LOOP_528(call, __VA_ARGS__)
+#define _GMP_LOOP_530(call, ...) call(__VA_ARGS__) _GMP_LOOP_529(call, __VA_ARGS__)
+#define _GMP_LOOP_531(call, ...) call(__VA_ARGS__) _GMP_LOOP_530(call, __VA_ARGS__)
+#define _GMP_LOOP_532(call, ...) call(__VA_ARGS__) _GMP_LOOP_531(call, __VA_ARGS__)
+#define _GMP_LOOP_533(call, ...) call(__VA_ARGS__) _GMP_LOOP_532(call, __VA_ARGS__)
+#define _GMP_LOOP_534(call, ...) call(__VA_ARGS__) _GMP_LOOP_533(call, __VA_ARGS__)
+#define _GMP_LOOP_535(call, ...) call(__VA_ARGS__) _GMP_LOOP_534(call, __VA_ARGS__)
+#define _GMP_LOOP_536(call, ...) call(__VA_ARGS__) _GMP_LOOP_535(call, __VA_ARGS__)
+#define _GMP_LOOP_537(call, ...) call(__VA_ARGS__) _GMP_LOOP_536(call, __VA_ARGS__)
+#define _GMP_LOOP_538(call, ...) call(__VA_ARGS__) _GMP_LOOP_537(call, __VA_ARGS__)
+#define _GMP_LOOP_539(call, ...) call(__VA_ARGS__) _GMP_LOOP_538(call, __VA_ARGS__)
+#define _GMP_LOOP_540(call, ...) call(__VA_ARGS__) _GMP_LOOP_539(call, __VA_ARGS__)
+#define _GMP_LOOP_541(call, ...) call(__VA_ARGS__) _GMP_LOOP_540(call, __VA_ARGS__)
+#define _GMP_LOOP_542(call, ...) call(__VA_ARGS__) _GMP_LOOP_541(call, __VA_ARGS__)
+#define _GMP_LOOP_543(call, ...) call(__VA_ARGS__) _GMP_LOOP_542(call, __VA_ARGS__)
+#define _GMP_LOOP_544(call, ...) call(__VA_ARGS__) _GMP_LOOP_543(call, __VA_ARGS__)
+#define _GMP_LOOP_545(call, ...) call(__VA_ARGS__) _GMP_LOOP_544(call, __VA_ARGS__)
+#define _GMP_LOOP_546(call, ...) call(__VA_ARGS__) _GMP_LOOP_545(call, __VA_ARGS__)
+#define _GMP_LOOP_547(call, ...) call(__VA_ARGS__) _GMP_LOOP_546(call, __VA_ARGS__)
+#define _GMP_LOOP_548(call, ...) call(__VA_ARGS__) _GMP_LOOP_547(call, __VA_ARGS__)
+#define _GMP_LOOP_549(call, ...) call(__VA_ARGS__) _GMP_LOOP_548(call, __VA_ARGS__)
+#define _GMP_LOOP_550(call, ...) call(__VA_ARGS__) _GMP_LOOP_549(call, __VA_ARGS__)
+#define _GMP_LOOP_551(call, ...) call(__VA_ARGS__) _GMP_LOOP_550(call, __VA_ARGS__)
+#define _GMP_LOOP_552(call, ...) call(__VA_ARGS__) _GMP_LOOP_551(call, __VA_ARGS__)
+#define _GMP_LOOP_553(call, ...) call(__VA_ARGS__) _GMP_LOOP_552(call, __VA_ARGS__)
+#define _GMP_LOOP_554(call, ...) call(__VA_ARGS__) _GMP_LOOP_553(call, __VA_ARGS__)
+#define _GMP_LOOP_555(call, ...) call(__VA_ARGS__) _GMP_LOOP_554(call, __VA_ARGS__)
+#define _GMP_LOOP_556(call, ...) call(__VA_ARGS__) _GMP_LOOP_555(call, __VA_ARGS__)
+#define _GMP_LOOP_557(call, ...) call(__VA_ARGS__) _GMP_LOOP_556(call, __VA_ARGS__)
+#define _GMP_LOOP_558(call, ...) call(__VA_ARGS__) _GMP_LOOP_557(call, __VA_ARGS__)
+#define _GMP_LOOP_559(call, ...) call(__VA_ARGS__) _GMP_LOOP_558(call, __VA_ARGS__)
+#define _GMP_LOOP_560(call, ...) call(__VA_ARGS__) _GMP_LOOP_559(call, __VA_ARGS__)
+#define _GMP_LOOP_561(call, ...) call(__VA_ARGS__) _GMP_LOOP_560(call, __VA_ARGS__)
+#define _GMP_LOOP_562(call, ...) call(__VA_ARGS__) _GMP_LOOP_561(call, __VA_ARGS__)
+#define _GMP_LOOP_563(call, ...) call(__VA_ARGS__) _GMP_LOOP_562(call, __VA_ARGS__)
+#define _GMP_LOOP_564(call, ...) call(__VA_ARGS__) _GMP_LOOP_563(call, __VA_ARGS__)
+#define _GMP_LOOP_565(call, ...) call(__VA_ARGS__) _GMP_LOOP_564(call, __VA_ARGS__)
+#define _GMP_LOOP_566(call, ...) call(__VA_ARGS__) _GMP_LOOP_565(call, __VA_ARGS__)
+#define _GMP_LOOP_567(call, ...) call(__VA_ARGS__) _GMP_LOOP_566(call, __VA_ARGS__)
+#define _GMP_LOOP_568(call, ...) call(__VA_ARGS__) _GMP_LOOP_567(call, __VA_ARGS__)
+#define _GMP_LOOP_569(call, ...) call(__VA_ARGS__) _GMP_LOOP_568(call, __VA_ARGS__)
+#define _GMP_LOOP_570(call, ...) call(__VA_ARGS__) _GMP_LOOP_569(call, __VA_ARGS__)
+#define _GMP_LOOP_571(call, ...) call(__VA_ARGS__) _GMP_LOOP_570(call, __VA_ARGS__)
+#define _GMP_LOOP_572(call, ...) call(__VA_ARGS__) _GMP_LOOP_571(call, __VA_ARGS__)
+#define _GMP_LOOP_573(call, ...) call(__VA_ARGS__) _GMP_LOOP_572(call, __VA_ARGS__)
+#define _GMP_LOOP_574(call, ...) call(__VA_ARGS__) _GMP_LOOP_573(call, __VA_ARGS__)
+#define _GMP_LOOP_575(call, ...) call(__VA_ARGS__) _GMP_LOOP_574(call, __VA_ARGS__)
+#define _GMP_LOOP_576(call, ...) call(__VA_ARGS__) _GMP_LOOP_575(call, __VA_ARGS__)
+#define _GMP_LOOP_577(call, ...) call(__VA_ARGS__) _GMP_LOOP_576(call, __VA_ARGS__)
+#define _GMP_LOOP_578(call, ...) call(__VA_ARGS__) _GMP_LOOP_577(call, __VA_ARGS__)
+#define _GMP_LOOP_579(call, ...) call(__VA_ARGS__) _GMP_LOOP_578(call, __VA_ARGS__)
+#define _GMP_LOOP_580(call, ...) call(__VA_ARGS__) _GMP_LOOP_579(call, __VA_ARGS__)
+#define _GMP_LOOP_581(call, ...) call(__VA_ARGS__) _GMP_LOOP_580(call, __VA_ARGS__)
+#define _GMP_LOOP_582(call, ...) call(__VA_ARGS__) _GMP_LOOP_581(call, __VA_ARGS__)
+#define _GMP_LOOP_583(call, ...) call(__VA_ARGS__) _GMP_LOOP_582(call, __VA_ARGS__)
+#define _GMP_LOOP_584(call, ...) call(__VA_ARGS__) _GMP_LOOP_583(call, __VA_ARGS__)
+#define _GMP_LOOP_585(call, ...) call(__VA_ARGS__) _GMP_LOOP_584(call, __VA_ARGS__)
+#define _GMP_LOOP_586(call, ...) call(__VA_ARGS__) _GMP_LOOP_585(call, __VA_ARGS__)
+#define _GMP_LOOP_587(call, ...) call(__VA_ARGS__) _GMP_LOOP_586(call, __VA_ARGS__)
+#define _GMP_LOOP_588(call, ...) call(__VA_ARGS__) _GMP_LOOP_587(call, __VA_ARGS__)
+#define _GMP_LOOP_589(call, ...) call(__VA_ARGS__) _GMP_LOOP_588(call, __VA_ARGS__)
+#define _GMP_LOOP_590(call, ...) call(__VA_ARGS__) _GMP_LOOP_589(call, __VA_ARGS__)
+#define _GMP_LOOP_591(call, ...) call(__VA_ARGS__) _GMP_LOOP_590(call, __VA_ARGS__)
+#define _GMP_LOOP_592(call, ...) call(__VA_ARGS__) _GMP_LOOP_591(call, __VA_ARGS__)
+#define _GMP_LOOP_593(call, ...) call(__VA_ARGS__) _GMP_LOOP_592(call, __VA_ARGS__)
+#define _GMP_LOOP_594(call, ...) call(__VA_ARGS__) _GMP_LOOP_593(call, __VA_ARGS__)
+#define _GMP_LOOP_595(call, ...) call(__VA_ARGS__) _GMP_LOOP_594(call, __VA_ARGS__)
+#define _GMP_LOOP_596(call, ...) call(__VA_ARGS__) _GMP_LOOP_595(call, __VA_ARGS__)
+#define _GMP_LOOP_597(call, ...) call(__VA_ARGS__) _GMP_LOOP_596(call, __VA_ARGS__)
+#define _GMP_LOOP_598(call, ...) call(__VA_ARGS__) _GMP_LOOP_597(call, __VA_ARGS__)
+#define _GMP_LOOP_599(call, ...) call(__VA_ARGS__) _GMP_LOOP_598(call, __VA_ARGS__)
+#define _GMP_LOOP_600(call, ...) call(__VA_ARGS__) _GMP_LOOP_599(call, __VA_ARGS__)
+#define _GMP_LOOP_601(call, ...) call(__VA_ARGS__) _GMP_LOOP_600(call, __VA_ARGS__)
+#define _GMP_LOOP_602(call, ...) call(__VA_ARGS__) _GMP_LOOP_601(call, __VA_ARGS__)
+#define _GMP_LOOP_603(call, ...) call(__VA_ARGS__) _GMP_LOOP_602(call, __VA_ARGS__)
+#define _GMP_LOOP_604(call, ...) call(__VA_ARGS__) _GMP_LOOP_603(call, __VA_ARGS__)
+#define _GMP_LOOP_605(call, ...) call(__VA_ARGS__) _GMP_LOOP_604(call, __VA_ARGS__)
+#define _GMP_LOOP_606(call, ...) call(__VA_ARGS__) _GMP_LOOP_605(call, __VA_ARGS__)
+#define _GMP_LOOP_607(call, ...) call(__VA_ARGS__) _GMP_LOOP_606(call, __VA_ARGS__)
+#define _GMP_LOOP_608(call, ...) call(__VA_ARGS__) _GMP_LOOP_607(call, __VA_ARGS__)
+#define _GMP_LOOP_609(call, ...) call(__VA_ARGS__) _GMP_LOOP_608(call, __VA_ARGS__)
+#define _GMP_LOOP_610(call, ...) call(__VA_ARGS__) _GMP_LOOP_609(call, __VA_ARGS__)
+#define _GMP_LOOP_611(call, ...) call(__VA_ARGS__) _GMP_LOOP_610(call, __VA_ARGS__)
+#define _GMP_LOOP_612(call, ...) call(__VA_ARGS__) _GMP_LOOP_611(call, __VA_ARGS__)
+#define _GMP_LOOP_613(call, ...) call(__VA_ARGS__) _GMP_LOOP_612(call, __VA_ARGS__)
+#define _GMP_LOOP_614(call, ...) call(__VA_ARGS__) _GMP_LOOP_613(call, __VA_ARGS__)
+#define _GMP_LOOP_615(call, ...) call(__VA_ARGS__) _GMP_LOOP_614(call, __VA_ARGS__)
+#define _GMP_LOOP_616(call, ...) call(__VA_ARGS__) _GMP_LOOP_615(call, __VA_ARGS__)
+#define _GMP_LOOP_617(call, ...) call(__VA_ARGS__) _GMP_LOOP_616(call, __VA_ARGS__)
+#define _GMP_LOOP_618(call, ...) call(__VA_ARGS__) _GMP_LOOP_617(call, __VA_ARGS__)
+#define _GMP_LOOP_619(call, ...) call(__VA_ARGS__) _GMP_LOOP_618(call, __VA_ARGS__)
+#define _GMP_LOOP_620(call, ...) call(__VA_ARGS__) _GMP_LOOP_619(call, __VA_ARGS__)
+#define _GMP_LOOP_621(call, ...) call(__VA_ARGS__) _GMP_LOOP_620(call, __VA_ARGS__)
+#define _GMP_LOOP_622(call, ...) call(__VA_ARGS__) _GMP_LOOP_621(call, __VA_ARGS__)
+#define _GMP_LOOP_623(call, ...) call(__VA_ARGS__) _GMP_LOOP_622(call, __VA_ARGS__)
+#define _GMP_LOOP_624(call, ...) call(__VA_ARGS__) _GMP_LOOP_623(call, __VA_ARGS__)
+#define _GMP_LOOP_625(call, ...) call(__VA_ARGS__) _GMP_LOOP_624(call, __VA_ARGS__)
+#define _GMP_LOOP_626(call, ...) call(__VA_ARGS__) _GMP_LOOP_625(call, __VA_ARGS__)
+#define _GMP_LOOP_627(call, ...) call(__VA_ARGS__) _GMP_LOOP_626(call, __VA_ARGS__)
+#define _GMP_LOOP_628(call, ...) call(__VA_ARGS__) _GMP_LOOP_627(call, __VA_ARGS__)
+#define _GMP_LOOP_629(call, ...) call(__VA_ARGS__) _GMP_LOOP_628(call, __VA_ARGS__)
+#define _GMP_LOOP_630(call, ...) call(__VA_ARGS__) _GMP_LOOP_629(call, __VA_ARGS__)
+#define _GMP_LOOP_631(call, ...) call(__VA_ARGS__) _GMP_LOOP_630(call, __VA_ARGS__)
+#define _GMP_LOOP_632(call, ...) call(__VA_ARGS__) _GMP_LOOP_631(call, __VA_ARGS__)
+#define _GMP_LOOP_633(call, ...) call(__VA_ARGS__) _GMP_LOOP_632(call, __VA_ARGS__)
+#define _GMP_LOOP_634(call, ...) call(__VA_ARGS__) _GMP_LOOP_633(call, __VA_ARGS__)
+#define _GMP_LOOP_635(call, ...) call(__VA_ARGS__) _GMP_LOOP_634(call, __VA_ARGS__)
+#define _GMP_LOOP_636(call, ...) call(__VA_ARGS__) _GMP_LOOP_635(call, __VA_ARGS__)
+#define _GMP_LOOP_637(call, ...) call(__VA_ARGS__) _GMP_LOOP_636(call, __VA_ARGS__)
+#define _GMP_LOOP_638(call, ...) call(__VA_ARGS__) _GMP_LOOP_637(call, __VA_ARGS__)
+#define _GMP_LOOP_639(call, ...) call(__VA_ARGS__) _GMP_LOOP_638(call, __VA_ARGS__)
+#define _GMP_LOOP_640(call, ...) call(__VA_ARGS__) _GMP_LOOP_639(call, __VA_ARGS__)
+#define _GMP_LOOP_641(call, ...) call(__VA_ARGS__) _GMP_LOOP_640(call, __VA_ARGS__)
+#define _GMP_LOOP_642(call, ...) call(__VA_ARGS__) _GMP_LOOP_641(call, __VA_ARGS__)
+#define _GMP_LOOP_643(call, ...) call(__VA_ARGS__) _GMP_LOOP_642(call, __VA_ARGS__)
+#define _GMP_LOOP_644(call, ...) call(__VA_ARGS__) _GMP_LOOP_643(call, __VA_ARGS__)
+#define _GMP_LOOP_645(call, ...) call(__VA_ARGS__) _GMP_LOOP_644(call, __VA_ARGS__)
+#define _GMP_LOOP_646(call, ...) call(__VA_ARGS__) _GMP_LOOP_645(call, __VA_ARGS__)
+#define _GMP_LOOP_647(call, ...) call(__VA_ARGS__) _GMP_LOOP_646(call, __VA_ARGS__)
+#define _GMP_LOOP_648(call, ...) call(__VA_ARGS__) _GMP_LOOP_647(call, __VA_ARGS__)
+#define _GMP_LOOP_649(call, ...) call(__VA_ARGS__) _GMP_LOOP_648(call, __VA_ARGS__)
+#define _GMP_LOOP_650(call, ...) call(__VA_ARGS__) _GMP_LOOP_649(call, __VA_ARGS__)
+#define _GMP_LOOP_651(call, ...) call(__VA_ARGS__) _GMP_LOOP_650(call, __VA_ARGS__)
+#define _GMP_LOOP_652(call, ...) call(__VA_ARGS__) _GMP_LOOP_651(call, __VA_ARGS__)
+#define _GMP_LOOP_653(call, ...) call(__VA_ARGS__) _GMP_LOOP_652(call, __VA_ARGS__)
+#define _GMP_LOOP_654(call, ...) call(__VA_ARGS__) _GMP_LOOP_653(call, __VA_ARGS__)
+#define _GMP_LOOP_655(call, ...) call(__VA_ARGS__) _GMP_LOOP_654(call, __VA_ARGS__)
+#define _GMP_LOOP_656(call, ...) call(__VA_ARGS__) _GMP_LOOP_655(call, __VA_ARGS__)
+#define _GMP_LOOP_657(call, ...) call(__VA_ARGS__) _GMP_LOOP_656(call, __VA_ARGS__)
+#define _GMP_LOOP_658(call, ...) call(__VA_ARGS__) _GMP_LOOP_657(call, __VA_ARGS__)
+#define _GMP_LOOP_659(call, ...) call(__VA_ARGS__) _GMP_LOOP_658(call, __VA_ARGS__)
+#define _GMP_LOOP_660(call, ...) call(__VA_ARGS__) _GMP_LOOP_659(call, __VA_ARGS__)
+#define _GMP_LOOP_661(call, ...) call(__VA_ARGS__) _GMP_LOOP_660(call, __VA_ARGS__)
+#define _GMP_LOOP_662(call, ...) call(__VA_ARGS__) _GMP_LOOP_661(call, __VA_ARGS__)
+#define _GMP_LOOP_663(call, ...) call(__VA_ARGS__) _GMP_LOOP_662(call, __VA_ARGS__)
+#define _GMP_LOOP_664(call, ...) call(__VA_ARGS__) _GMP_LOOP_663(call, __VA_ARGS__)
+#define _GMP_LOOP_665(call, ...) call(__VA_ARGS__) _GMP_LOOP_664(call, __VA_ARGS__)
+#define _GMP_LOOP_666(call, ...) call(__VA_ARGS__) _GMP_LOOP_665(call, __VA_ARGS__)
+#define _GMP_LOOP_667(call, ...) call(__VA_ARGS__) _GMP_LOOP_666(call, __VA_ARGS__)
+#define _GMP_LOOP_668(call, ...) call(__VA_ARGS__) _GMP_LOOP_667(call, __VA_ARGS__)
+#define _GMP_LOOP_669(call, ...) call(__VA_ARGS__) _GMP_LOOP_668(call, __VA_ARGS__)
+#define _GMP_LOOP_670(call, ...) call(__VA_ARGS__) _GMP_LOOP_669(call, __VA_ARGS__)
+#define _GMP_LOOP_671(call, ...) call(__VA_ARGS__) _GMP_LOOP_670(call, __VA_ARGS__)
+#define _GMP_LOOP_672(call, ...) call(__VA_ARGS__) _GMP_LOOP_671(call, __VA_ARGS__)
+#define _GMP_LOOP_673(call, ...) call(__VA_ARGS__) _GMP_LOOP_672(call, __VA_ARGS__)
+#define _GMP_LOOP_674(call, ...) call(__VA_ARGS__) _GMP_LOOP_673(call, __VA_ARGS__)
+#define _GMP_LOOP_675(call, ...) call(__VA_ARGS__) _GMP_LOOP_674(call, __VA_ARGS__)
+#define _GMP_LOOP_676(call, ...) call(__VA_ARGS__) _GMP_LOOP_675(call, __VA_ARGS__)
+#define _GMP_LOOP_677(call, ...) call(__VA_ARGS__) _GMP_LOOP_676(call, __VA_ARGS__)
+#define _GMP_LOOP_678(call, ...) call(__VA_ARGS__) _GMP_LOOP_677(call, __VA_ARGS__)
+#define _GMP_LOOP_679(call, ...) call(__VA_ARGS__) _GMP_LOOP_678(call, __VA_ARGS__)
+#define _GMP_LOOP_680(call, ...) call(__VA_ARGS__) _GMP_LOOP_679(call, __VA_ARGS__)
+#define _GMP_LOOP_681(call, ...) call(__VA_ARGS__) _GMP_LOOP_680(call, __VA_ARGS__)
+#define _GMP_LOOP_682(call, ...) call(__VA_ARGS__) _GMP_LOOP_681(call, __VA_ARGS__)
+#define _GMP_LOOP_683(call, ...) call(__VA_ARGS__) _GMP_LOOP_682(call, __VA_ARGS__)
+#define _GMP_LOOP_684(call, ...) call(__VA_ARGS__) _GMP_LOOP_683(call, __VA_ARGS__)
+#define _GMP_LOOP_685(call, ...) call(__VA_ARGS__) _GMP_LOOP_684(call, __VA_ARGS__)
+#define _GMP_LOOP_686(call, ...) call(__VA_ARGS__) _GMP_LOOP_685(call, __VA_ARGS__)
+#define _GMP_LOOP_687(call, ...) call(__VA_ARGS__) _GMP_LOOP_686(call, __VA_ARGS__)
+#define _GMP_LOOP_688(call, ...) call(__VA_ARGS__) _GMP_LOOP_687(call, __VA_ARGS__)
+#define _GMP_LOOP_689(call, ...) call(__VA_ARGS__) _GMP_LOOP_688(call, __VA_ARGS__)
+#define _GMP_LOOP_690(call, ...) call(__VA_ARGS__) _GMP_LOOP_689(call, __VA_ARGS__)
+#define _GMP_LOOP_691(call, ...) call(__VA_ARGS__) _GMP_LOOP_690(call, __VA_ARGS__)
+#define _GMP_LOOP_692(call, ...) call(__VA_ARGS__) _GMP_LOOP_691(call, __VA_ARGS__)
+#define _GMP_LOOP_693(call, ...) call(__VA_ARGS__) _GMP_LOOP_692(call, __VA_ARGS__)
+#define _GMP_LOOP_694(call, ...) call(__VA_ARGS__) _GMP_LOOP_693(call, __VA_ARGS__)
+#define _GMP_LOOP_695(call, ...) call(__VA_ARGS__) _GMP_LOOP_694(call, __VA_ARGS__)
+#define _GMP_LOOP_696(call, ...) call(__VA_ARGS__) _GMP_LOOP_695(call, __VA_ARGS__)
+#define _GMP_LOOP_697(call, ...) call(__VA_ARGS__) _GMP_LOOP_696(call, __VA_ARGS__)
+#define _GMP_LOOP_698(call, ...) call(__VA_ARGS__) _GMP_LOOP_697(call, __VA_ARGS__)
+#define _GMP_LOOP_699(call, ...) call(__VA_ARGS__) _GMP_LOOP_698(call, __VA_ARGS__)
+#define _GMP_LOOP_700(call, ...) call(__VA_ARGS__) _GMP_LOOP_699(call, __VA_ARGS__)
+#define _GMP_LOOP_701(call, ...) call(__VA_ARGS__) _GMP_LOOP_700(call, __VA_ARGS__)
+#define _GMP_LOOP_702(call, ...) call(__VA_ARGS__) _GMP_LOOP_701(call, __VA_ARGS__)
+#define _GMP_LOOP_703(call, ...) call(__VA_ARGS__) _GMP_LOOP_702(call, __VA_ARGS__)
+#define _GMP_LOOP_704(call, ...) call(__VA_ARGS__) _GMP_LOOP_703(call, __VA_ARGS__)
+#define _GMP_LOOP_705(call, ...) call(__VA_ARGS__) _GMP_LOOP_704(call, __VA_ARGS__)
+#define _GMP_LOOP_706(call, ...) call(__VA_ARGS__) _GMP_LOOP_705(call, __VA_ARGS__)
+#define _GMP_LOOP_707(call, ...) call(__VA_ARGS__) _GMP_LOOP_706(call, __VA_ARGS__)
+#define _GMP_LOOP_708(call, ...) call(__VA_ARGS__) _GMP_LOOP_707(call, __VA_ARGS__)
+#define _GMP_LOOP_709(call, ...) call(__VA_ARGS__) _GMP_LOOP_708(call, __VA_ARGS__)
+#define _GMP_LOOP_710(call, ...) call(__VA_ARGS__) _GMP_LOOP_709(call, __VA_ARGS__)
+#define _GMP_LOOP_711(call, ...) call(__VA_ARGS__) _GMP_LOOP_710(call, __VA_ARGS__)
+#define _GMP_LOOP_712(call, ...) call(__VA_ARGS__) _GMP_LOOP_711(call, __VA_ARGS__)
+#define _GMP_LOOP_713(call, ...) call(__VA_ARGS__) _GMP_LOOP_712(call, __VA_ARGS__)
+#define _GMP_LOOP_714(call, ...) call(__VA_ARGS__) _GMP_LOOP_713(call, __VA_ARGS__)
+#define _GMP_LOOP_715(call, ...) call(__VA_ARGS__) _GMP_LOOP_714(call, __VA_ARGS__)
+#define _GMP_LOOP_716(call, ...) call(__VA_ARGS__) _GMP_LOOP_715(call, __VA_ARGS__)
+#define _GMP_LOOP_717(call, ...) call(__VA_ARGS__) _GMP_LOOP_716(call, __VA_ARGS__)
+#define _GMP_LOOP_718(call, ...) call(__VA_ARGS__) _GMP_LOOP_717(call, __VA_ARGS__)
+#define _GMP_LOOP_719(call, ...) call(__VA_ARGS__) _GMP_LOOP_718(call, __VA_ARGS__)
+#define _GMP_LOOP_720(call, ...) call(__VA_ARGS__) _GMP_LOOP_719(call, __VA_ARGS__)
+#define _GMP_LOOP_721(call, ...) call(__VA_ARGS__) _GMP_LOOP_720(call, __VA_ARGS__)
+#define _GMP_LOOP_722(call, ...) call(__VA_ARGS__) _GMP_LOOP_721(call, __VA_ARGS__)
+#define _GMP_LOOP_723(call, ...) call(__VA_ARGS__) _GMP_LOOP_722(call, __VA_ARGS__)
+#define _GMP_LOOP_724(call, ...) call(__VA_ARGS__) _GMP_LOOP_723(call, __VA_ARGS__)
+#define _GMP_LOOP_725(call, ...) call(__VA_ARGS__) _GMP_LOOP_724(call, __VA_ARGS__)
+#define _GMP_LOOP_726(call, ...) call(__VA_ARGS__) _GMP_LOOP_725(call, __VA_ARGS__)
+#define _GMP_LOOP_727(call, ...) call(__VA_ARGS__) _GMP_LOOP_726(call, __VA_ARGS__)
+#define _GMP_LOOP_728(call, ...) call(__VA_ARGS__) _GMP_LOOP_727(call, __VA_ARGS__)
+#define _GMP_LOOP_729(call, ...) call(__VA_ARGS__) _GMP_LOOP_728(call, __VA_ARGS__)
+#define _GMP_LOOP_730(call, ...) call(__VA_ARGS__) _GMP_LOOP_729(call, __VA_ARGS__)
+#define _GMP_LOOP_731(call, ...) call(__VA_ARGS__) _GMP_LOOP_730(call, __VA_ARGS__)
+#define _GMP_LOOP_732(call, ...) call(__VA_ARGS__) _GMP_LOOP_731(call, __VA_ARGS__)
+#define _GMP_LOOP_733(call, ...) call(__VA_ARGS__) _GMP_LOOP_732(call, __VA_ARGS__)
+#define _GMP_LOOP_734(call, ...) call(__VA_ARGS__) _GMP_LOOP_733(call, __VA_ARGS__)
+#define _GMP_LOOP_735(call, ...) call(__VA_ARGS__) _GMP_LOOP_734(call, __VA_ARGS__)
+#define _GMP_LOOP_736(call, ...) call(__VA_ARGS__) _GMP_LOOP_735(call, __VA_ARGS__)
+#define _GMP_LOOP_737(call, ...) call(__VA_ARGS__) _GMP_LOOP_736(call, __VA_ARGS__)
+#define _GMP_LOOP_738(call, ...) call(__VA_ARGS__) _GMP_LOOP_737(call, __VA_ARGS__)
+#define _GMP_LOOP_739(call, ...) call(__VA_ARGS__) _GMP_LOOP_738(call, __VA_ARGS__)
+#define _GMP_LOOP_740(call, ...) call(__VA_ARGS__) _GMP_LOOP_739(call, __VA_ARGS__)
+#define _GMP_LOOP_741(call, ...) call(__VA_ARGS__) _GMP_LOOP_740(call, __VA_ARGS__)
+#define _GMP_LOOP_742(call, ...) call(__VA_ARGS__) _GMP_LOOP_741(call, __VA_ARGS__)
+#define _GMP_LOOP_743(call, ...) call(__VA_ARGS__) _GMP_LOOP_742(call, __VA_ARGS__)
+#define _GMP_LOOP_744(call, ...) call(__VA_ARGS__) _GMP_LOOP_743(call, __VA_ARGS__)
+#define _GMP_LOOP_745(call, ...) call(__VA_ARGS__) _GMP_LOOP_744(call, __VA_ARGS__)
+#define _GMP_LOOP_746(call, ...) call(__VA_ARGS__) _GMP_LOOP_745(call, __VA_ARGS__)
+#define _GMP_LOOP_747(call, ...) call(__VA_ARGS__) _GMP_LOOP_746(call, __VA_ARGS__)
+#define _GMP_LOOP_748(call, ...) call(__VA_ARGS__) _GMP_LOOP_747(call, __VA_ARGS__)
+#define _GMP_LOOP_749(call, ...) call(__VA_ARGS__) _GMP_LOOP_748(call, __VA_ARGS__)
+#define _GMP_LOOP_750(call, ...) call(__VA_ARGS__) _GMP_LOOP_749(call, __VA_ARGS__)
+#define _GMP_LOOP_751(call, ...) call(__VA_ARGS__) _GMP_LOOP_750(call, __VA_ARGS__)
+#define _GMP_LOOP_752(call, ...) call(__VA_ARGS__) _GMP_LOOP_751(call, __VA_ARGS__)
+#define _GMP_LOOP_753(call, ...) call(__VA_ARGS__) _GMP_LOOP_752(call, __VA_ARGS__)
+#define _GMP_LOOP_754(call, ...) call(__VA_ARGS__) _GMP_LOOP_753(call, __VA_ARGS__)
+#define _GMP_LOOP_755(call, ...) call(__VA_ARGS__) _GMP_LOOP_754(call, __VA_ARGS__)
+#define _GMP_LOOP_756(call, ...) call(__VA_ARGS__) _GMP_LOOP_755(call, __VA_ARGS__)
+#define _GMP_LOOP_757(call, ...) call(__VA_ARGS__) _GMP_LOOP_756(call, __VA_ARGS__)
+#define _GMP_LOOP_758(call, ...) call(__VA_ARGS__) _GMP_LOOP_757(call, __VA_ARGS__)
+#define _GMP_LOOP_759(call, ...) call(__VA_ARGS__) _GMP_LOOP_758(call, __VA_ARGS__)
+#define _GMP_LOOP_760(call, ...) call(__VA_ARGS__) _GMP_LOOP_759(call, __VA_ARGS__)
+#define _GMP_LOOP_761(call, ...) call(__VA_ARGS__) _GMP_LOOP_760(call, __VA_ARGS__)
+#define _GMP_LOOP_762(call, ...) call(__VA_ARGS__) _GMP_LOOP_761(call, __VA_ARGS__)
+#define _GMP_LOOP_763(call, ...) call(__VA_ARGS__) _GMP_LOOP_762(call, __VA_ARGS__)
+#define _GMP_LOOP_764(call, ...) call(__VA_ARGS__) _GMP_LOOP_763(call, __VA_ARGS__)
+#define _GMP_LOOP_765(call, ...) call(__VA_ARGS__) _GMP_LOOP_764(call, __VA_ARGS__)
+#define _GMP_LOOP_766(call, ...) call(__VA_ARGS__) _GMP_LOOP_765(call, __VA_ARGS__)
+#define _GMP_LOOP_767(call, ...) call(__VA_ARGS__) _GMP_LOOP_766(call, __VA_ARGS__)
+#define _GMP_LOOP_768(call, ...) call(__VA_ARGS__) _GMP_LOOP_767(call, __VA_ARGS__)
+#define _GMP_LOOP_769(call, ...) call(__VA_ARGS__) _GMP_LOOP_768(call, __VA_ARGS__)
+#define _GMP_LOOP_770(call, ...) call(__VA_ARGS__) _GMP_LOOP_769(call, __VA_ARGS__)
+#define _GMP_LOOP_771(call, ...) call(__VA_ARGS__) _GMP_LOOP_770(call, __VA_ARGS__)
+#define _GMP_LOOP_772(call, ...) call(__VA_ARGS__) _GMP_LOOP_771(call, __VA_ARGS__)
+#define _GMP_LOOP_773(call, ...) call(__VA_ARGS__) _GMP_LOOP_772(call, __VA_ARGS__)
+#define _GMP_LOOP_774(call, ...) call(__VA_ARGS__) _GMP_LOOP_773(call, __VA_ARGS__)
+#define _GMP_LOOP_775(call, ...) call(__VA_ARGS__) _GMP_LOOP_774(call, __VA_ARGS__)
+#define _GMP_LOOP_776(call, ...) call(__VA_ARGS__) _GMP_LOOP_775(call, __VA_ARGS__)
+#define _GMP_LOOP_777(call, ...) call(__VA_ARGS__) _GMP_LOOP_776(call, __VA_ARGS__)
+#define _GMP_LOOP_778(call, ...) call(__VA_ARGS__) _GMP_LOOP_777(call, __VA_ARGS__)
+#define _GMP_LOOP_779(call, ...) call(__VA_ARGS__) _GMP_LOOP_778(call, __VA_ARGS__)
+#define _GMP_LOOP_780(call, ...) call(__VA_ARGS__) _GMP_LOOP_779(call, __VA_ARGS__)
+#define _GMP_LOOP_781(call, ...) call(__VA_ARGS__) _GMP_LOOP_780(call, __VA_ARGS__)
+#define _GMP_LOOP_782(call, ...) call(__VA_ARGS__) _GMP_LOOP_781(call, __VA_ARGS__)
+#define _GMP_LOOP_783(call, ...) call(__VA_ARGS__) _GMP_LOOP_782(call, __VA_ARGS__)
+#define _GMP_LOOP_784(call, ...) call(__VA_ARGS__) _GMP_LOOP_783(call, __VA_ARGS__)
+#define _GMP_LOOP_785(call, ...) call(__VA_ARGS__) _GMP_LOOP_784(call, __VA_ARGS__)
+#define _GMP_LOOP_786(call, ...) call(__VA_ARGS__) _GMP_LOOP_785(call, __VA_ARGS__)
+#define _GMP_LOOP_787(call, ...) call(__VA_ARGS__) _GMP_LOOP_786(call, __VA_ARGS__)
+#define _GMP_LOOP_788(call, ...) call(__VA_ARGS__) _GMP_LOOP_787(call, __VA_ARGS__)
+#define _GMP_LOOP_789(call, ...) call(__VA_ARGS__) _GMP_LOOP_788(call, __VA_ARGS__)
+#define _GMP_LOOP_790(call, ...) call(__VA_ARGS__) _GMP_LOOP_789(call, __VA_ARGS__)
+#define _GMP_LOOP_791(call, ...) call(__VA_ARGS__) _GMP_LOOP_790(call, __VA_ARGS__)
+#define _GMP_LOOP_792(call, ...) call(__VA_ARGS__) _GMP_LOOP_791(call, __VA_ARGS__)
+#define _GMP_LOOP_793(call, ...) call(__VA_ARGS__) _GMP_LOOP_792(call, __VA_ARGS__)
+#define _GMP_LOOP_794(call, ...) call(__VA_ARGS__) _GMP_LOOP_793(call, __VA_ARGS__)
+#define _GMP_LOOP_795(call, ...) call(__VA_ARGS__) _GMP_LOOP_794(call, __VA_ARGS__)
+#define _GMP_LOOP_796(call, ...) call(__VA_ARGS__) _GMP_LOOP_795(call, __VA_ARGS__)
+#define _GMP_LOOP_797(call, ...) call(__VA_ARGS__) _GMP_LOOP_796(call, __VA_ARGS__)
+#define _GMP_LOOP_798(call, ...) call(__VA_ARGS__) _GMP_LOOP_797(call, __VA_ARGS__)
+#define _GMP_LOOP_799(call, ...) call(__VA_ARGS__) _GMP_LOOP_798(call, __VA_ARGS__)
+#define _GMP_LOOP_800(call, ...) call(__VA_ARGS__) _GMP_LOOP_799(call, __VA_ARGS__)
+#define _GMP_LOOP_801(call, ...) call(__VA_ARGS__) _GMP_LOOP_800(call, __VA_ARGS__)
+#define _GMP_LOOP_802(call, ...) call(__VA_ARGS__) _GMP_LOOP_801(call, __VA_ARGS__)
+#define _GMP_LOOP_803(call, ...) call(__VA_ARGS__) _GMP_LOOP_802(call, __VA_ARGS__)
+#define _GMP_LOOP_804(call, ...) call(__VA_ARGS__) _GMP_LOOP_803(call, __VA_ARGS__)
+#define _GMP_LOOP_805(call, ...) call(__VA_ARGS__) _GMP_LOOP_804(call, __VA_ARGS__)
+#define _GMP_LOOP_806(call, ...) call(__VA_ARGS__) _GMP_LOOP_805(call, __VA_ARGS__)
+#define _GMP_LOOP_807(call, ...) call(__VA_ARGS__) _GMP_LOOP_806(call, __VA_ARGS__)
+#define _GMP_LOOP_808(call, ...) call(__VA_ARGS__) _GMP_LOOP_807(call, __VA_ARGS__)
+#define _GMP_LOOP_809(call, ...) call(__VA_ARGS__) _GMP_LOOP_808(call, __VA_ARGS__)
+#define _GMP_LOOP_810(call, ...) call(__VA_ARGS__) _GMP_LOOP_809(call, __VA_ARGS__)
+#define _GMP_LOOP_811(call, ...) call(__VA_ARGS__) _GMP_LOOP_810(call, __VA_ARGS__)
+#define _GMP_LOOP_812(call, ...) call(__VA_ARGS__) _GMP_LOOP_811(call, __VA_ARGS__)
+#define _GMP_LOOP_813(call, ...) call(__VA_ARGS__) _GMP_LOOP_812(call, __VA_ARGS__)
+#define _GMP_LOOP_814(call, ...) call(__VA_ARGS__) _GMP_LOOP_813(call, __VA_ARGS__)
+#define _GMP_LOOP_815(call, ...) call(__VA_ARGS__) _GMP_LOOP_814(call, __VA_ARGS__)
+#define _GMP_LOOP_816(call, ...) call(__VA_ARGS__) _GMP_LOOP_815(call, __VA_ARGS__)
+#define _GMP_LOOP_817(call, ...) call(__VA_ARGS__) _GMP_LOOP_816(call, __VA_ARGS__)
+#define _GMP_LOOP_818(call, ...) call(__VA_ARGS__) _GMP_LOOP_817(call, __VA_ARGS__)
+#define _GMP_LOOP_819(call, ...) call(__VA_ARGS__) _GMP_LOOP_818(call, __VA_ARGS__)
+#define _GMP_LOOP_820(call, ...) call(__VA_ARGS__) _GMP_LOOP_819(call, __VA_ARGS__)
+#define _GMP_LOOP_821(call, ...) call(__VA_ARGS__) _GMP_LOOP_820(call, __VA_ARGS__)
+#define _GMP_LOOP_822(call, ...) call(__VA_ARGS__) _GMP_LOOP_821(call, __VA_ARGS__)
+#define _GMP_LOOP_823(call, ...) call(__VA_ARGS__) _GMP_LOOP_822(call, __VA_ARGS__)
+#define _GMP_LOOP_824(call, ...) call(__VA_ARGS__) _GMP_LOOP_823(call, __VA_ARGS__)
+#define _GMP_LOOP_825(call, ...) call(__VA_ARGS__) _GMP_LOOP_824(call, __VA_ARGS__)
+#define _GMP_LOOP_826(call, ...) call(__VA_ARGS__) _GMP_LOOP_825(call, __VA_ARGS__)
+#define _GMP_LOOP_827(call, ...) call(__VA_ARGS__) _GMP_LOOP_826(call, __VA_ARGS__)
+#define _GMP_LOOP_828(call, ...) call(__VA_ARGS__) _GMP_LOOP_827(call, __VA_ARGS__)
+#define _GMP_LOOP_829(call, ...) call(__VA_ARGS__) _GMP_LOOP_828(call, __VA_ARGS__)
+#define _GMP_LOOP_830(call, ...) call(__VA_ARGS__) _GMP_LOOP_829(call, __VA_ARGS__)
+#define _GMP_LOOP_831(call, ...) call(__VA_ARGS__) _GMP_LOOP_830(call, __VA_ARGS__)
+#define _GMP_LOOP_832(call, ...) call(__VA_ARGS__) _GMP_LOOP_831(call, __VA_ARGS__)
+#define _GMP_LOOP_833(call, ...) call(__VA_ARGS__) _GMP_LOOP_832(call, __VA_ARGS__)
+#define _GMP_LOOP_834(call, ...) call(__VA_ARGS__) _GMP_LOOP_833(call, __VA_ARGS__)
+#define _GMP_LOOP_835(call, ...) call(__VA_ARGS__) _GMP_LOOP_834(call, __VA_ARGS__)
+#define _GMP_LOOP_836(call, ...) call(__VA_ARGS__) _GMP_LOOP_835(call, __VA_ARGS__)
+#define _GMP_LOOP_837(call, ...) call(__VA_ARGS__) _GMP_LOOP_836(call, __VA_ARGS__)
+#define _GMP_LOOP_838(call, ...) call(__VA_ARGS__) _GMP_LOOP_837(call, __VA_ARGS__)
+#define _GMP_LOOP_839(call, ...) call(__VA_ARGS__) _GMP_LOOP_838(call, __VA_ARGS__)
+#define _GMP_LOOP_840(call, ...) call(__VA_ARGS__) _GMP_LOOP_839(call, __VA_ARGS__)
+#define _GMP_LOOP_841(call, ...) call(__VA_ARGS__) _GMP_LOOP_840(call, __VA_ARGS__)
+#define _GMP_LOOP_842(call, ...) call(__VA_ARGS__) _GMP_LOOP_841(call, __VA_ARGS__)
+#define _GMP_LOOP_843(call, ...) call(__VA_ARGS__) _GMP_LOOP_842(call, __VA_ARGS__)
+#define _GMP_LOOP_844(call, ...) call(__VA_ARGS__) _GMP_LOOP_843(call, __VA_ARGS__)
+#define _GMP_LOOP_845(call, ...) call(__VA_ARGS__) _GMP_LOOP_844(call, __VA_ARGS__)
+#define _GMP_LOOP_846(call, ...) call(__VA_ARGS__) _GMP_LOOP_845(call, __VA_ARGS__)
+#define _GMP_LOOP_847(call, ...) call(__VA_ARGS__) _GMP_LOOP_846(call, __VA_ARGS__)
+#define _GMP_LOOP_848(call, ...) call(__VA_ARGS__) _GMP_LOOP_847(call, __VA_ARGS__)
+#define _GMP_LOOP_849(call, ...) call(__VA_ARGS__) _GMP_LOOP_848(call, __VA_ARGS__)
+#define _GMP_LOOP_850(call, ...) call(__VA_ARGS__) _GMP_LOOP_849(call, __VA_ARGS__)
+#define _GMP_LOOP_851(call, ...) call(__VA_ARGS__) _GMP_LOOP_850(call, __VA_ARGS__)
+#define _GMP_LOOP_852(call, ...) call(__VA_ARGS__) _GMP_LOOP_851(call, __VA_ARGS__)
+#define _GMP_LOOP_853(call, ...) call(__VA_ARGS__) _GMP_LOOP_852(call, __VA_ARGS__)
+#define _GMP_LOOP_854(call, ...) call(__VA_ARGS__) _GMP_LOOP_853(call, __VA_ARGS__)
+#define _GMP_LOOP_855(call, ...) call(__VA_ARGS__) _GMP_LOOP_854(call, __VA_ARGS__)
+#define _GMP_LOOP_856(call, ...) call(__VA_ARGS__) _GMP_LOOP_855(call, __VA_ARGS__)
+#define _GMP_LOOP_857(call, ...) call(__VA_ARGS__) _GMP_LOOP_856(call, __VA_ARGS__)
+#define _GMP_LOOP_858(call, ...) call(__VA_ARGS__) _GMP_LOOP_857(call, __VA_ARGS__)
+#define _GMP_LOOP_859(call, ...) call(__VA_ARGS__) _GMP_LOOP_858(call, __VA_ARGS__)
+#define _GMP_LOOP_860(call, ...) call(__VA_ARGS__) _GMP_LOOP_859(call, __VA_ARGS__)
+#define _GMP_LOOP_861(call, ...) call(__VA_ARGS__) _GMP_LOOP_860(call, __VA_ARGS__)
+#define _GMP_LOOP_862(call, ...) call(__VA_ARGS__) _GMP_LOOP_861(call, __VA_ARGS__)
+#define _GMP_LOOP_863(call, ...) call(__VA_ARGS__) _GMP_LOOP_862(call, __VA_ARGS__)
+#define _GMP_LOOP_864(call, ...) call(__VA_ARGS__) _GMP_LOOP_863(call, __VA_ARGS__)
+#define _GMP_LOOP_865(call, ...) call(__VA_ARGS__) _GMP_LOOP_864(call, __VA_ARGS__)
+#define _GMP_LOOP_866(call, ...) call(__VA_ARGS__) _GMP_LOOP_865(call, __VA_ARGS__)
+#define _GMP_LOOP_867(call, ...) call(__VA_ARGS__) _GMP_LOOP_866(call, __VA_ARGS__)
+#define _GMP_LOOP_868(call, ...) call(__VA_ARGS__) _GMP_LOOP_867(call, __VA_ARGS__)
+#define _GMP_LOOP_869(call, ...) call(__VA_ARGS__) _GMP_LOOP_868(call, __VA_ARGS__)
+#define _GMP_LOOP_870(call, ...) call(__VA_ARGS__) _GMP_LOOP_869(call, __VA_ARGS__)
+#define _GMP_LOOP_871(call, ...) call(__VA_ARGS__) _GMP_LOOP_870(call, __VA_ARGS__)
+#define _GMP_LOOP_872(call, ...) call(__VA_ARGS__) _GMP_LOOP_871(call, __VA_ARGS__)
+#define _GMP_LOOP_873(call, ...) call(__VA_ARGS__) _GMP_LOOP_872(call, __VA_ARGS__)
+#define _GMP_LOOP_874(call, ...) call(__VA_ARGS__) _GMP_LOOP_873(call, __VA_ARGS__)
+#define _GMP_LOOP_875(call, ...) call(__VA_ARGS__) _GMP_LOOP_874(call, __VA_ARGS__)
+#define _GMP_LOOP_876(call, ...) call(__VA_ARGS__) _GMP_LOOP_875(call, __VA_ARGS__)
+#define _GMP_LOOP_877(call, ...) call(__VA_ARGS__) _GMP_LOOP_876(call, __VA_ARGS__)
+#define _GMP_LOOP_878(call, ...) call(__VA_ARGS__) _GMP_LOOP_877(call, __VA_ARGS__)
+#define _GMP_LOOP_879(call, ...) call(__VA_ARGS__) _GMP_LOOP_878(call, __VA_ARGS__)
+#define _GMP_LOOP_880(call, ...) call(__VA_ARGS__) _GMP_LOOP_879(call, __VA_ARGS__)
+#define _GMP_LOOP_881(call, ...) call(__VA_ARGS__) _GMP_LOOP_880(call, __VA_ARGS__)
+#define _GMP_LOOP_882(call, ...) call(__VA_ARGS__) _GMP_LOOP_881(call, __VA_ARGS__)
+#define _GMP_LOOP_883(call, ...) call(__VA_ARGS__) _GMP_LOOP_882(call, __VA_ARGS__)
+#define _GMP_LOOP_884(call, ...) call(__VA_ARGS__) _GMP_LOOP_883(call, __VA_ARGS__)
+#define _GMP_LOOP_885(call, ...) call(__VA_ARGS__) _GMP_LOOP_884(call, __VA_ARGS__)
+#define _GMP_LOOP_886(call, ...) call(__VA_ARGS__) _GMP_LOOP_885(call, __VA_ARGS__)
+#define _GMP_LOOP_887(call, ...) call(__VA_ARGS__) _GMP_LOOP_886(call, __VA_ARGS__)
+#define _GMP_LOOP_888(call, ...) call(__VA_ARGS__) _GMP_LOOP_887(call, __VA_ARGS__)
+#define _GMP_LOOP_889(call, ...) call(__VA_ARGS__) _GMP_LOOP_888(call, __VA_ARGS__)
+#define _GMP_LOOP_890(call, ...) call(__VA_ARGS__) _GMP_LOOP_889(call, __VA_ARGS__)
+#define _GMP_LOOP_891(call, ...) call(__VA_ARGS__) _GMP_LOOP_890(call, __VA_ARGS__)
+#define _GMP_LOOP_892(call, ...) call(__VA_ARGS__) _GMP_LOOP_891(call, __VA_ARGS__)
+#define _GMP_LOOP_893(call, ...) call(__VA_ARGS__) _GMP_LOOP_892(call, __VA_ARGS__)
+#define _GMP_LOOP_894(call, ...) call(__VA_ARGS__) _GMP_LOOP_893(call, __VA_ARGS__)
+#define _GMP_LOOP_895(call, ...) call(__VA_ARGS__) _GMP_LOOP_894(call, __VA_ARGS__)
+#define _GMP_LOOP_896(call, ...) call(__VA_ARGS__) _GMP_LOOP_895(call, __VA_ARGS__)
+#define _GMP_LOOP_897(call, ...) call(__VA_ARGS__) _GMP_LOOP_896(call, __VA_ARGS__)
+#define _GMP_LOOP_898(call, ...) call(__VA_ARGS__) _GMP_LOOP_897(call, __VA_ARGS__)
+#define _GMP_LOOP_899(call, ...) call(__VA_ARGS__) _GMP_LOOP_898(call, __VA_ARGS__)
+#define _GMP_LOOP_900(call, ...) call(__VA_ARGS__) _GMP_LOOP_899(call, __VA_ARGS__)
+#define _GMP_LOOP_901(call, ...) call(__VA_ARGS__) _GMP_LOOP_900(call, __VA_ARGS__)
+#define _GMP_LOOP_902(call, ...) call(__VA_ARGS__) _GMP_LOOP_901(call, __VA_ARGS__)
+#define _GMP_LOOP_903(call, ...) call(__VA_ARGS__) _GMP_LOOP_902(call, __VA_ARGS__)
+#define _GMP_LOOP_904(call, ...) call(__VA_ARGS__) _GMP_LOOP_903(call, __VA_ARGS__)
+#define _GMP_LOOP_905(call, ...) call(__VA_ARGS__) _GMP_LOOP_904(call, __VA_ARGS__)
+#define _GMP_LOOP_906(call, ...) call(__VA_ARGS__) _GMP_LOOP_905(call, __VA_ARGS__)
+#define _GMP_LOOP_907(call, ...) call(__VA_ARGS__) _GMP_LOOP_906(call, __VA_ARGS__)
+#define _GMP_LOOP_908(call, ...) call(__VA_ARGS__) _GMP_LOOP_907(call, __VA_ARGS__)
+#define _GMP_LOOP_909(call, ...) call(__VA_ARGS__) _GMP_LOOP_908(call, __VA_ARGS__)
+#define _GMP_LOOP_910(call, ...) call(__VA_ARGS__) _GMP_LOOP_909(call, __VA_ARGS__)
+#define _GMP_LOOP_911(call, ...) call(__VA_ARGS__) _GMP_LOOP_910(call, __VA_ARGS__)
+#define _GMP_LOOP_912(call, ...) call(__VA_ARGS__) _GMP_LOOP_911(call, __VA_ARGS__)
+#define _GMP_LOOP_913(call, ...) call(__VA_ARGS__) _GMP_LOOP_912(call, __VA_ARGS__)
+#define _GMP_LOOP_914(call, ...) call(__VA_ARGS__) _GMP_LOOP_913(call, __VA_ARGS__)
+#define _GMP_LOOP_915(call, ...) call(__VA_ARGS__) _GMP_LOOP_914(call, __VA_ARGS__)
+#define _GMP_LOOP_916(call, ...) call(__VA_ARGS__) _GMP_LOOP_915(call, __VA_ARGS__)
+#define _GMP_LOOP_917(call, ...) call(__VA_ARGS__) _GMP_LOOP_916(call, __VA_ARGS__)
+#define _GMP_LOOP_918(call, ...) call(__VA_ARGS__) _GMP_LOOP_917(call, __VA_ARGS__)
+#define _GMP_LOOP_919(call, ...) call(__VA_ARGS__) _GMP_LOOP_918(call, __VA_ARGS__)
+#define _GMP_LOOP_920(call, ...) call(__VA_ARGS__) _GMP_LOOP_919(call, __VA_ARGS__)
+#define _GMP_LOOP_921(call, ...) call(__VA_ARGS__) _GMP_LOOP_920(call, __VA_ARGS__)
+#define _GMP_LOOP_922(call, ...) call(__VA_ARGS__) _GMP_LOOP_921(call, __VA_ARGS__)
+#define _GMP_LOOP_923(call, ...) call(__VA_ARGS__) _GMP_LOOP_922(call, __VA_ARGS__)
+#define _GMP_LOOP_924(call, ...) call(__VA_ARGS__) _GMP_LOOP_923(call, __VA_ARGS__)
+#define _GMP_LOOP_925(call, ...) call(__VA_ARGS__) _GMP_LOOP_924(call, __VA_ARGS__)
+#define _GMP_LOOP_926(call, ...) call(__VA_ARGS__) _GMP_LOOP_925(call, __VA_ARGS__)
+#define _GMP_LOOP_927(call, ...) call(__VA_ARGS__) _GMP_LOOP_926(call, __VA_ARGS__)
+#define _GMP_LOOP_928(call, ...) call(__VA_ARGS__) _GMP_LOOP_927(call, __VA_ARGS__)
+#define _GMP_LOOP_929(call, ...) call(__VA_ARGS__) _GMP_LOOP_928(call, __VA_ARGS__)
+#define _GMP_LOOP_930(call, ...) call(__VA_ARGS__) _GMP_LOOP_929(call, __VA_ARGS__)
+#define _GMP_LOOP_931(call, ...) call(__VA_ARGS__) _GMP_LOOP_930(call, __VA_ARGS__)
+#define _GMP_LOOP_932(call, ...) call(__VA_ARGS__) _GMP_LOOP_931(call, __VA_ARGS__)
+#define _GMP_LOOP_933(call, ...) call(__VA_ARGS__) _GMP_LOOP_932(call, __VA_ARGS__)
+#define _GMP_LOOP_934(call, ...) call(__VA_ARGS__) _GMP_LOOP_933(call, __VA_ARGS__)
+#define _GMP_LOOP_935(call, ...) call(__VA_ARGS__) _GMP_LOOP_934(call, __VA_ARGS__)
+#define _GMP_LOOP_936(call, ...) call(__VA_ARGS__) _GMP_LOOP_935(call, __VA_ARGS__)
+#define _GMP_LOOP_937(call, ...) call(__VA_ARGS__) _GMP_LOOP_936(call, __VA_ARGS__)
+#define _GMP_LOOP_938(call, ...) call(__VA_ARGS__) _GMP_LOOP_937(call, __VA_ARGS__)
+#define _GMP_LOOP_939(call, ...) call(__VA_ARGS__) _GMP_LOOP_938(call, __VA_ARGS__)
+#define _GMP_LOOP_940(call, ...) call(__VA_ARGS__) _GMP_LOOP_939(call, __VA_ARGS__)
+#define _GMP_LOOP_941(call, ...) call(__VA_ARGS__) _GMP_LOOP_940(call, __VA_ARGS__)
+#define _GMP_LOOP_942(call, ...) call(__VA_ARGS__) _GMP_LOOP_941(call, __VA_ARGS__)
+#define _GMP_LOOP_943(call, ...) call(__VA_ARGS__) _GMP_LOOP_942(call, __VA_ARGS__)
+#define _GMP_LOOP_944(call, ...) call(__VA_ARGS__) _GMP_LOOP_943(call, __VA_ARGS__)
+#define _GMP_LOOP_945(call, ...) call(__VA_ARGS__) _GMP_LOOP_944(call, __VA_ARGS__)
+#define _GMP_LOOP_946(call, ...) call(__VA_ARGS__) _GMP_LOOP_945(call, __VA_ARGS__)
+#define _GMP_LOOP_947(call, ...) call(__VA_ARGS__) _GMP_LOOP_946(call, __VA_ARGS__)
+#define _GMP_LOOP_948(call, ...) call(__VA_ARGS__) _GMP_LOOP_947(call, __VA_ARGS__)
+#define _GMP_LOOP_949(call, ...) call(__VA_ARGS__) _GMP_LOOP_948(call, __VA_ARGS__)
+#define _GMP_LOOP_950(call, ...) call(__VA_ARGS__) _GMP_LOOP_949(call, __VA_ARGS__)
+#define _GMP_LOOP_951(call, ...) call(__VA_ARGS__) _GMP_LOOP_950(call, __VA_ARGS__)
+#define _GMP_LOOP_952(call, ...) call(__VA_ARGS__) _GMP_LOOP_951(call, __VA_ARGS__)
+#define _GMP_LOOP_953(call, ...) call(__VA_ARGS__) _GMP_LOOP_952(call, __VA_ARGS__)
+#define _GMP_LOOP_954(call, ...) call(__VA_ARGS__) _GMP_LOOP_953(call, __VA_ARGS__)
+#define _GMP_LOOP_955(call, ...) call(__VA_ARGS__) _GMP_LOOP_954(call, __VA_ARGS__)
+#define _GMP_LOOP_956(call, ...) call(__VA_ARGS__) _GMP_LOOP_955(call, __VA_ARGS__)
+#define _GMP_LOOP_957(call, ...) call(__VA_ARGS__) _GMP_LOOP_956(call, __VA_ARGS__)
+#define _GMP_LOOP_958(call, ...) call(__VA_ARGS__) _GMP_LOOP_957(call, __VA_ARGS__)
+#define _GMP_LOOP_959(call, ...) call(__VA_ARGS__) _GMP_LOOP_958(call, __VA_ARGS__)
+#define _GMP_LOOP_960(call, ...) call(__VA_ARGS__) _GMP_LOOP_959(call, __VA_ARGS__)
+#define _GMP_LOOP_961(call, ...) call(__VA_ARGS__) _GMP_LOOP_960(call, __VA_ARGS__)
+#define _GMP_LOOP_962(call, ...) call(__VA_ARGS__) _GMP_LOOP_961(call, __VA_ARGS__)
+#define _GMP_LOOP_963(call, ...) call(__VA_ARGS__) _GMP_LOOP_962(call, __VA_ARGS__)
+#define _GMP_LOOP_964(call, ...) call(__VA_ARGS__) _GMP_LOOP_963(call, __VA_ARGS__)
+#define _GMP_LOOP_965(call, ...) call(__VA_ARGS__) _GMP_LOOP_964(call, __VA_ARGS__)
+#define _GMP_LOOP_966(call, ...) call(__VA_ARGS__) _GMP_LOOP_965(call, __VA_ARGS__)
+#define _GMP_LOOP_967(call, ...) call(__VA_ARGS__) _GMP_LOOP_966(call, __VA_ARGS__)
+#define _GMP_LOOP_968(call, ...) call(__VA_ARGS__) _GMP_LOOP_967(call, __VA_ARGS__)
+#define _GMP_LOOP_969(call, ...) call(__VA_ARGS__) _GMP_LOOP_968(call, __VA_ARGS__)
+#define _GMP_LOOP_970(call, ...) call(__VA_ARGS__) _GMP_LOOP_969(call, __VA_ARGS__)
+#define _GMP_LOOP_971(call, ...) call(__VA_ARGS__) _GMP_LOOP_970(call, __VA_ARGS__)
+#define _GMP_LOOP_972(call, ...) call(__VA_ARGS__) _GMP_LOOP_971(call, __VA_ARGS__)
+#define _GMP_LOOP_973(call, ...) call(__VA_ARGS__) _GMP_LOOP_972(call, __VA_ARGS__)
+#define _GMP_LOOP_974(call, ...) call(__VA_ARGS__) _GMP_LOOP_973(call, __VA_ARGS__)
+#define _GMP_LOOP_975(call, ...) call(__VA_ARGS__) _GMP_LOOP_974(call, __VA_ARGS__)
+#define _GMP_LOOP_976(call, ...) call(__VA_ARGS__) _GMP_LOOP_975(call, __VA_ARGS__)
+#define _GMP_LOOP_977(call, ...) call(__VA_ARGS__) _GMP_LOOP_976(call, __VA_ARGS__)
+#define _GMP_LOOP_978(call, ...) call(__VA_ARGS__) _GMP_LOOP_977(call, __VA_ARGS__)
+#define _GMP_LOOP_979(call, ...) call(__VA_ARGS__) _GMP_LOOP_978(call, __VA_ARGS__)
+#define _GMP_LOOP_980(call, ...) call(__VA_ARGS__) _GMP_LOOP_979(call, __VA_ARGS__)
+#define _GMP_LOOP_981(call, ...) call(__VA_ARGS__) _GMP_LOOP_980(call, __VA_ARGS__)
+#define _GMP_LOOP_982(call, ...) call(__VA_ARGS__) _GMP_LOOP_981(call, __VA_ARGS__)
+#define _GMP_LOOP_983(call, ...) call(__VA_ARGS__) _GMP_LOOP_982(call, __VA_ARGS__)
+#define _GMP_LOOP_984(call, ...) call(__VA_ARGS__) _GMP_LOOP_983(call, __VA_ARGS__)
+#define _GMP_LOOP_985(call, ...) call(__VA_ARGS__) _GMP_LOOP_984(call, __VA_ARGS__)
+#define _GMP_LOOP_986(call, ...) call(__VA_ARGS__) _GMP_LOOP_985(call, __VA_ARGS__)
+#define _GMP_LOOP_987(call, ...) call(__VA_ARGS__) _GMP_LOOP_986(call, __VA_ARGS__)
+#define _GMP_LOOP_988(call, ...) call(__VA_ARGS__) _GMP_LOOP_987(call, __VA_ARGS__)
+#define _GMP_LOOP_989(call, ...) call(__VA_ARGS__) _GMP_LOOP_988(call, __VA_ARGS__)
+#define _GMP_LOOP_990(call, ...) call(__VA_ARGS__) _GMP_LOOP_989(call, __VA_ARGS__)
+#define _GMP_LOOP_991(call, ...) call(__VA_ARGS__) _GMP_LOOP_990(call, __VA_ARGS__)
+#define _GMP_LOOP_992(call, ...) call(__VA_ARGS__) _GMP_LOOP_991(call, __VA_ARGS__)
+#define _GMP_LOOP_993(call, ...) call(__VA_ARGS__) _GMP_LOOP_992(call, __VA_ARGS__)
+#define _GMP_LOOP_994(call, ...) call(__VA_ARGS__) _GMP_LOOP_993(call, __VA_ARGS__)
+#define _GMP_LOOP_995(call, ...) call(__VA_ARGS__) _GMP_LOOP_994(call, __VA_ARGS__)
+#define _GMP_LOOP_996(call, ...) call(__VA_ARGS__) _GMP_LOOP_995(call, __VA_ARGS__)
+#define _GMP_LOOP_997(call, ...) call(__VA_ARGS__) _GMP_LOOP_996(call, __VA_ARGS__)
+#define _GMP_LOOP_998(call, ...) call(__VA_ARGS__) _GMP_LOOP_997(call, __VA_ARGS__)
+#define _GMP_LOOP_999(call, ...) call(__VA_ARGS__) _GMP_LOOP_998(call, __VA_ARGS__)
+#define _GMP_LOOP_1000(call, ...) call(__VA_ARGS__) _GMP_LOOP_999(call, __VA_ARGS__)
+#define _GMP_LOOP_1001(call, ...) call(__VA_ARGS__) _GMP_LOOP_1000(call, __VA_ARGS__)
+#define _GMP_LOOP_1002(call, ...) call(__VA_ARGS__) _GMP_LOOP_1001(call, __VA_ARGS__)
+#define _GMP_LOOP_1003(call, ...) call(__VA_ARGS__) _GMP_LOOP_1002(call, __VA_ARGS__)
+#define _GMP_LOOP_1004(call, ...) call(__VA_ARGS__) _GMP_LOOP_1003(call, __VA_ARGS__)
+#define _GMP_LOOP_1005(call, ...) call(__VA_ARGS__) _GMP_LOOP_1004(call, __VA_ARGS__)
+#define _GMP_LOOP_1006(call, ...) call(__VA_ARGS__) _GMP_LOOP_1005(call, __VA_ARGS__)
+#define _GMP_LOOP_1007(call, ...) call(__VA_ARGS__) _GMP_LOOP_1006(call, __VA_ARGS__)
+#define _GMP_LOOP_1008(call, ...) call(__VA_ARGS__) _GMP_LOOP_1007(call, __VA_ARGS__)
+#define _GMP_LOOP_1009(call, ...) call(__VA_ARGS__) _GMP_LOOP_1008(call, __VA_ARGS__)
+#define _GMP_LOOP_1010(call, ...) call(__VA_ARGS__) _GMP_LOOP_1009(call, __VA_ARGS__)
+#define _GMP_LOOP_1011(call, ...) call(__VA_ARGS__) _GMP_LOOP_1010(call, __VA_ARGS__)
+#define _GMP_LOOP_1012(call, ...) call(__VA_ARGS__) _GMP_LOOP_1011(call, __VA_ARGS__)
+#define _GMP_LOOP_1013(call, ...) call(__VA_ARGS__) _GMP_LOOP_1012(call, __VA_ARGS__)
+#define _GMP_LOOP_1014(call, ...) call(__VA_ARGS__) _GMP_LOOP_1013(call, __VA_ARGS__)
+#define _GMP_LOOP_1015(call, ...) call(__VA_ARGS__) _GMP_LOOP_1014(call, __VA_ARGS__)
+#define _GMP_LOOP_1016(call, ...) call(__VA_ARGS__) _GMP_LOOP_1015(call, __VA_ARGS__)
+#define _GMP_LOOP_1017(call, ...) call(__VA_ARGS__) _GMP_LOOP_1016(call, __VA_ARGS__)
+#define _GMP_LOOP_1018(call, ...) call(__VA_ARGS__) _GMP_LOOP_1017(call, __VA_ARGS__)
+#define _GMP_LOOP_1019(call, ...) call(__VA_ARGS__) _GMP_LOOP_1018(call, __VA_ARGS__)
+#define _GMP_LOOP_1020(call, ...) call(__VA_ARGS__) _GMP_LOOP_1019(call, __VA_ARGS__)
+#define _GMP_LOOP_1021(call, ...) call(__VA_ARGS__) _GMP_LOOP_1020(call, __VA_ARGS__)
+#define _GMP_LOOP_1022(call, ...) call(__VA_ARGS__) _GMP_LOOP_1021(call, __VA_ARGS__)
+#define _GMP_LOOP_1023(call, ...) call(__VA_ARGS__) _GMP_LOOP_1022(call, __VA_ARGS__)
+#define _GMP_LOOP_1024(call, ...) call(__VA_ARGS__) _GMP_LOOP_1023(call, __VA_ARGS__)
+
+#endif // GMP_MACRO_LIMITS_LOOP_1024_HPP_
@@ -0,0 +1,1033 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_LOOP_254_HPP_
+#define GMP_MACRO_LIMITS_LOOP_254_HPP_
+
+// GMP_EVAL_BOUNDED
+#define _GMP_EVAL_BOUNDED_0 GMP_EVAL_5
+#define _GMP_EVAL_BOUNDED_1 GMP_EVAL_5
+#define _GMP_EVAL_BOUNDED_2 GMP_EVAL_5
+#define _GMP_EVAL_BOUNDED_3 GMP_EVAL_4
+#define _GMP_EVAL_BOUNDED_4 GMP_EVAL_4
+#define _GMP_EVAL_BOUNDED_5 GMP_EVAL_4
+#define _GMP_EVAL_BOUNDED_6 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_7 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_8 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_9 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_10 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_11 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_12 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_13 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_14 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_15 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_16 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_17 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_18 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_19 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_20 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_21 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_22 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_23 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_24 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_25 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_26 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_27 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_28 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_29 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_30 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_31 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_32 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_33 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_34 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_35 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_36 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_37 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_38 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_39 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_40 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_41 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_42 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_43 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_44 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_45 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_46 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_47 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_48 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_49 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_50 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_51 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_52 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_53 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_54 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_55 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_56 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_57 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_58 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_59 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_60 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_61 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_62 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_63 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_64 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_65 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_66 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_67 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_68 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_69 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_70 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_71 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_72 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_73 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_74 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_75 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_76 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_77 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_78 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_79 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_80 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_81 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_82 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_83 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_84 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_85 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_86 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_87 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_88 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_89 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_90 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_91 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_92 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_93 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_94 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_95 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_96 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_97 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_98 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_99 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_100 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_101 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_102 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_103 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_104 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_105 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_106 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_107 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_108 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_109 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_110 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_111 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_112 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_113 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_114 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_115 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_116 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_117 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_118 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_119 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_120 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_121 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_122 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_123 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_124 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_125 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_126 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_127 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_128 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_129 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_130 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_131 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_132 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_133 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_134 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_135 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_136 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_137 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_138 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_139 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_140 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_141 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_142 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_143 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_144 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_145 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_146 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_147 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_148 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_149 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_150 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_151 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_152 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_153 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_154 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_155 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_156 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_157 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_158 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_159 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_160 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_161 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_162 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_163 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_164 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_165 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_166 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_167 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_168 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_169 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_170 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_171 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_172 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_173 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_174 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_175 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_176 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_177 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_178 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_179 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_180 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_181 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_182 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_183 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_184 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_185 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_186 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_187 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_188 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_189 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_190 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_191 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_192 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_193 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_194 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_195 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_196 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_197 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_198 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_199 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_200 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_201 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_202 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_203 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_204 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_205 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_206 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_207 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_208 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_209 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_210 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_211 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_212 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_213 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_214 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_215 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_216 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_217 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_218 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_219 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_220 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_221 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_222 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_223 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_224 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_225 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_226 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_227 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_228 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_229 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_230 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_231 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_232 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_233 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_234 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_235 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_236 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_237 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_238 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_239 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_240 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_241 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_242 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_243 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_244 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_245 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_246 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_247 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_248 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_249 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_250 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_251 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_252 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_253 GMP_EVAL
+#define _GMP_EVAL_BOUNDED_254 GMP_EVAL
+
+// GMP_MAKE_INDEX_SEQUENCE
+#define _GMP_MAKE_INDEX_SEQUENCE_0() 0
+#define _GMP_MAKE_INDEX_SEQUENCE_1() _GMP_MAKE_INDEX_SEQUENCE_0(), 1
+#define _GMP_MAKE_INDEX_SEQUENCE_2() _GMP_MAKE_INDEX_SEQUENCE_1(), 2
+#define _GMP_MAKE_INDEX_SEQUENCE_3() _GMP_MAKE_INDEX_SEQUENCE_2(), 3
+#define _GMP_MAKE_INDEX_SEQUENCE_4() _GMP_MAKE_INDEX_SEQUENCE_3(), 4
+#define _GMP_MAKE_INDEX_SEQUENCE_5() _GMP_MAKE_INDEX_SEQUENCE_4(), 5
+#define _GMP_MAKE_INDEX_SEQUENCE_6() _GMP_MAKE_INDEX_SEQUENCE_5(), 6
+#define _GMP_MAKE_INDEX_SEQUENCE_7() _GMP_MAKE_INDEX_SEQUENCE_6(), 7
+#define _GMP_MAKE_INDEX_SEQUENCE_8() _GMP_MAKE_INDEX_SEQUENCE_7(), 8
+#define _GMP_MAKE_INDEX_SEQUENCE_9() _GMP_MAKE_INDEX_SEQUENCE_8(), 9
+#define _GMP_MAKE_INDEX_SEQUENCE_10() _GMP_MAKE_INDEX_SEQUENCE_9(), 10
+#define _GMP_MAKE_INDEX_SEQUENCE_11() _GMP_MAKE_INDEX_SEQUENCE_10(), 11
+#define _GMP_MAKE_INDEX_SEQUENCE_12() _GMP_MAKE_INDEX_SEQUENCE_11(), 12
+#define _GMP_MAKE_INDEX_SEQUENCE_13() _GMP_MAKE_INDEX_SEQUENCE_12(), 13
+#define _GMP_MAKE_INDEX_SEQUENCE_14() _GMP_MAKE_INDEX_SEQUENCE_13(), 14
+#define _GMP_MAKE_INDEX_SEQUENCE_15() _GMP_MAKE_INDEX_SEQUENCE_14(), 15
+#define _GMP_MAKE_INDEX_SEQUENCE_16() _GMP_MAKE_INDEX_SEQUENCE_15(), 16
+#define _GMP_MAKE_INDEX_SEQUENCE_17() _GMP_MAKE_INDEX_SEQUENCE_16(), 17
+#define _GMP_MAKE_INDEX_SEQUENCE_18() _GMP_MAKE_INDEX_SEQUENCE_17(), 18
+#define _GMP_MAKE_INDEX_SEQUENCE_19() _GMP_MAKE_INDEX_SEQUENCE_18(), 19
+#define _GMP_MAKE_INDEX_SEQUENCE_20() _GMP_MAKE_INDEX_SEQUENCE_19(), 20
+#define _GMP_MAKE_INDEX_SEQUENCE_21() _GMP_MAKE_INDEX_SEQUENCE_20(), 21
+#define _GMP_MAKE_INDEX_SEQUENCE_22() _GMP_MAKE_INDEX_SEQUENCE_21(), 22
+#define _GMP_MAKE_INDEX_SEQUENCE_23() _GMP_MAKE_INDEX_SEQUENCE_22(), 23
+#define _GMP_MAKE_INDEX_SEQUENCE_24() _GMP_MAKE_INDEX_SEQUENCE_23(), 24
+#define _GMP_MAKE_INDEX_SEQUENCE_25() _GMP_MAKE_INDEX_SEQUENCE_24(), 25
+#define _GMP_MAKE_INDEX_SEQUENCE_26() _GMP_MAKE_INDEX_SEQUENCE_25(), 26
+#define _GMP_MAKE_INDEX_SEQUENCE_27() _GMP_MAKE_INDEX_SEQUENCE_26(), 27
+#define _GMP_MAKE_INDEX_SEQUENCE_28() _GMP_MAKE_INDEX_SEQUENCE_27(), 28
+#define _GMP_MAKE_INDEX_SEQUENCE_29() _GMP_MAKE_INDEX_SEQUENCE_28(), 29
+#define _GMP_MAKE_INDEX_SEQUENCE_30() _GMP_MAKE_INDEX_SEQUENCE_29(), 30
+#define _GMP_MAKE_INDEX_SEQUENCE_31() _GMP_MAKE_INDEX_SEQUENCE_30(), 31
+#define _GMP_MAKE_INDEX_SEQUENCE_32() _GMP_MAKE_INDEX_SEQUENCE_31(), 32
+#define _GMP_MAKE_INDEX_SEQUENCE_33() _GMP_MAKE_INDEX_SEQUENCE_32(), 33
+#define _GMP_MAKE_INDEX_SEQUENCE_34() _GMP_MAKE_INDEX_SEQUENCE_33(), 34
+#define _GMP_MAKE_INDEX_SEQUENCE_35() _GMP_MAKE_INDEX_SEQUENCE_34(), 35
+#define _GMP_MAKE_INDEX_SEQUENCE_36() _GMP_MAKE_INDEX_SEQUENCE_35(), 36
+#define _GMP_MAKE_INDEX_SEQUENCE_37() _GMP_MAKE_INDEX_SEQUENCE_36(), 37
+#define _GMP_MAKE_INDEX_SEQUENCE_38() _GMP_MAKE_INDEX_SEQUENCE_37(), 38
+#define _GMP_MAKE_INDEX_SEQUENCE_39() _GMP_MAKE_INDEX_SEQUENCE_38(), 39
+#define _GMP_MAKE_INDEX_SEQUENCE_40() _GMP_MAKE_INDEX_SEQUENCE_39(), 40
+#define _GMP_MAKE_INDEX_SEQUENCE_41() _GMP_MAKE_INDEX_SEQUENCE_40(), 41
+#define _GMP_MAKE_INDEX_SEQUENCE_42() _GMP_MAKE_INDEX_SEQUENCE_41(), 42
+#define _GMP_MAKE_INDEX_SEQUENCE_43() _GMP_MAKE_INDEX_SEQUENCE_42(), 43
+#define _GMP_MAKE_INDEX_SEQUENCE_44() _GMP_MAKE_INDEX_SEQUENCE_43(), 44
+#define _GMP_MAKE_INDEX_SEQUENCE_45() _GMP_MAKE_INDEX_SEQUENCE_44(), 45
+#define _GMP_MAKE_INDEX_SEQUENCE_46() _GMP_MAKE_INDEX_SEQUENCE_45(), 46
+#define _GMP_MAKE_INDEX_SEQUENCE_47() _GMP_MAKE_INDEX_SEQUENCE_46(), 47
+#define _GMP_MAKE_INDEX_SEQUENCE_48() _GMP_MAKE_INDEX_SEQUENCE_47(), 48
+#define _GMP_MAKE_INDEX_SEQUENCE_49() _GMP_MAKE_INDEX_SEQUENCE_48(), 49
+#define _GMP_MAKE_INDEX_SEQUENCE_50() _GMP_MAKE_INDEX_SEQUENCE_49(), 50
+#define _GMP_MAKE_INDEX_SEQUENCE_51() _GMP_MAKE_INDEX_SEQUENCE_50(), 51
+#define _GMP_MAKE_INDEX_SEQUENCE_52() _GMP_MAKE_INDEX_SEQUENCE_51(), 52
+#define _GMP_MAKE_INDEX_SEQUENCE_53() _GMP_MAKE_INDEX_SEQUENCE_52(), 53
+#define _GMP_MAKE_INDEX_SEQUENCE_54() _GMP_MAKE_INDEX_SEQUENCE_53(), 54
+#define _GMP_MAKE_INDEX_SEQUENCE_55() _GMP_MAKE_INDEX_SEQUENCE_54(), 55
+#define _GMP_MAKE_INDEX_SEQUENCE_56() _GMP_MAKE_INDEX_SEQUENCE_55(), 56
+#define _GMP_MAKE_INDEX_SEQUENCE_57() _GMP_MAKE_INDEX_SEQUENCE_56(), 57
+#define _GMP_MAKE_INDEX_SEQUENCE_58() _GMP_MAKE_INDEX_SEQUENCE_57(), 58
+#define _GMP_MAKE_INDEX_SEQUENCE_59() _GMP_MAKE_INDEX_SEQUENCE_58(), 59
+#define _GMP_MAKE_INDEX_SEQUENCE_60() _GMP_MAKE_INDEX_SEQUENCE_59(), 60
+#define _GMP_MAKE_INDEX_SEQUENCE_61() _GMP_MAKE_INDEX_SEQUENCE_60(), 61
+#define _GMP_MAKE_INDEX_SEQUENCE_62() _GMP_MAKE_INDEX_SEQUENCE_61(), 62
+#define _GMP_MAKE_INDEX_SEQUENCE_63() _GMP_MAKE_INDEX_SEQUENCE_62(), 63
+#define _GMP_MAKE_INDEX_SEQUENCE_64() _GMP_MAKE_INDEX_SEQUENCE_63(), 64
+#define _GMP_MAKE_INDEX_SEQUENCE_65() _GMP_MAKE_INDEX_SEQUENCE_64(), 65
+#define _GMP_MAKE_INDEX_SEQUENCE_66() _GMP_MAKE_INDEX_SEQUENCE_65(), 66
+#define _GMP_MAKE_INDEX_SEQUENCE_67() _GMP_MAKE_INDEX_SEQUENCE_66(), 67
+#define _GMP_MAKE_INDEX_SEQUENCE_68() _GMP_MAKE_INDEX_SEQUENCE_67(), 68
+#define _GMP_MAKE_INDEX_SEQUENCE_69() _GMP_MAKE_INDEX_SEQUENCE_68(), 69
+#define _GMP_MAKE_INDEX_SEQUENCE_70() _GMP_MAKE_INDEX_SEQUENCE_69(), 70
+#define _GMP_MAKE_INDEX_SEQUENCE_71() _GMP_MAKE_INDEX_SEQUENCE_70(), 71
+#define _GMP_MAKE_INDEX_SEQUENCE_72() _GMP_MAKE_INDEX_SEQUENCE_71(), 72
+#define _GMP_MAKE_INDEX_SEQUENCE_73() _GMP_MAKE_INDEX_SEQUENCE_72(), 73
+#define _GMP_MAKE_INDEX_SEQUENCE_74() _GMP_MAKE_INDEX_SEQUENCE_73(), 74
+#define _GMP_MAKE_INDEX_SEQUENCE_75() _GMP_MAKE_INDEX_SEQUENCE_74(), 75
+#define _GMP_MAKE_INDEX_SEQUENCE_76() _GMP_MAKE_INDEX_SEQUENCE_75(), 76
+#define _GMP_MAKE_INDEX_SEQUENCE_77() _GMP_MAKE_INDEX_SEQUENCE_76(), 77
+#define _GMP_MAKE_INDEX_SEQUENCE_78() _GMP_MAKE_INDEX_SEQUENCE_77(), 78
+#define _GMP_MAKE_INDEX_SEQUENCE_79() _GMP_MAKE_INDEX_SEQUENCE_78(), 79
+#define _GMP_MAKE_INDEX_SEQUENCE_80() _GMP_MAKE_INDEX_SEQUENCE_79(), 80
+#define _GMP_MAKE_INDEX_SEQUENCE_81() _GMP_MAKE_INDEX_SEQUENCE_80(), 81
+#define _GMP_MAKE_INDEX_SEQUENCE_82() _GMP_MAKE_INDEX_SEQUENCE_81(), 82
+#define _GMP_MAKE_INDEX_SEQUENCE_83() _GMP_MAKE_INDEX_SEQUENCE_82(), 83
+#define _GMP_MAKE_INDEX_SEQUENCE_84() _GMP_MAKE_INDEX_SEQUENCE_83(), 84
+#define _GMP_MAKE_INDEX_SEQUENCE_85() _GMP_MAKE_INDEX_SEQUENCE_84(), 85
+#define _GMP_MAKE_INDEX_SEQUENCE_86() _GMP_MAKE_INDEX_SEQUENCE_85(), 86
+#define _GMP_MAKE_INDEX_SEQUENCE_87() _GMP_MAKE_INDEX_SEQUENCE_86(), 87
+#define _GMP_MAKE_INDEX_SEQUENCE_88() _GMP_MAKE_INDEX_SEQUENCE_87(), 88
+#define _GMP_MAKE_INDEX_SEQUENCE_89() _GMP_MAKE_INDEX_SEQUENCE_88(), 89
+#define _GMP_MAKE_INDEX_SEQUENCE_90() _GMP_MAKE_INDEX_SEQUENCE_89(), 90
+#define _GMP_MAKE_INDEX_SEQUENCE_91() _GMP_MAKE_INDEX_SEQUENCE_90(), 91
+#define _GMP_MAKE_INDEX_SEQUENCE_92() _GMP_MAKE_INDEX_SEQUENCE_91(), 92
+#define _GMP_MAKE_INDEX_SEQUENCE_93() _GMP_MAKE_INDEX_SEQUENCE_92(), 93
+#define _GMP_MAKE_INDEX_SEQUENCE_94() _GMP_MAKE_INDEX_SEQUENCE_93(), 94
+#define _GMP_MAKE_INDEX_SEQUENCE_95() _GMP_MAKE_INDEX_SEQUENCE_94(), 95
+#define _GMP_MAKE_INDEX_SEQUENCE_96() _GMP_MAKE_INDEX_SEQUENCE_95(), 96
+#define _GMP_MAKE_INDEX_SEQUENCE_97() _GMP_MAKE_INDEX_SEQUENCE_96(), 97
+#define _GMP_MAKE_INDEX_SEQUENCE_98() _GMP_MAKE_INDEX_SEQUENCE_97(), 98
+#define _GMP_MAKE_INDEX_SEQUENCE_99() _GMP_MAKE_INDEX_SEQUENCE_98(), 99
+#define _GMP_MAKE_INDEX_SEQUENCE_100() _GMP_MAKE_INDEX_SEQUENCE_99(), 100
+#define _GMP_MAKE_INDEX_SEQUENCE_101() _GMP_MAKE_INDEX_SEQUENCE_100(), 101
+#define _GMP_MAKE_INDEX_SEQUENCE_102() _GMP_MAKE_INDEX_SEQUENCE_101(), 102
+#define _GMP_MAKE_INDEX_SEQUENCE_103() _GMP_MAKE_INDEX_SEQUENCE_102(), 103
+#define _GMP_MAKE_INDEX_SEQUENCE_104() _GMP_MAKE_INDEX_SEQUENCE_103(), 104
+#define _GMP_MAKE_INDEX_SEQUENCE_105() _GMP_MAKE_INDEX_SEQUENCE_104(), 105
+#define _GMP_MAKE_INDEX_SEQUENCE_106() _GMP_MAKE_INDEX_SEQUENCE_105(), 106
+#define _GMP_MAKE_INDEX_SEQUENCE_107() _GMP_MAKE_INDEX_SEQUENCE_106(), 107
+#define _GMP_MAKE_INDEX_SEQUENCE_108() _GMP_MAKE_INDEX_SEQUENCE_107(), 108
+#define _GMP_MAKE_INDEX_SEQUENCE_109() _GMP_MAKE_INDEX_SEQUENCE_108(), 109
+#define _GMP_MAKE_INDEX_SEQUENCE_110() _GMP_MAKE_INDEX_SEQUENCE_109(), 110
+#define _GMP_MAKE_INDEX_SEQUENCE_111() _GMP_MAKE_INDEX_SEQUENCE_110(), 111
+#define _GMP_MAKE_INDEX_SEQUENCE_112() _GMP_MAKE_INDEX_SEQUENCE_111(), 112
+#define _GMP_MAKE_INDEX_SEQUENCE_113() _GMP_MAKE_INDEX_SEQUENCE_112(), 113
+#define _GMP_MAKE_INDEX_SEQUENCE_114() _GMP_MAKE_INDEX_SEQUENCE_113(), 114
+#define _GMP_MAKE_INDEX_SEQUENCE_115() _GMP_MAKE_INDEX_SEQUENCE_114(), 115
+#define _GMP_MAKE_INDEX_SEQUENCE_116() _GMP_MAKE_INDEX_SEQUENCE_115(), 116
+#define _GMP_MAKE_INDEX_SEQUENCE_117() _GMP_MAKE_INDEX_SEQUENCE_116(), 117
+#define _GMP_MAKE_INDEX_SEQUENCE_118() _GMP_MAKE_INDEX_SEQUENCE_117(), 118
+#define _GMP_MAKE_INDEX_SEQUENCE_119() _GMP_MAKE_INDEX_SEQUENCE_118(), 119
+#define _GMP_MAKE_INDEX_SEQUENCE_120() _GMP_MAKE_INDEX_SEQUENCE_119(), 120
+#define _GMP_MAKE_INDEX_SEQUENCE_121() _GMP_MAKE_INDEX_SEQUENCE_120(), 121
+#define _GMP_MAKE_INDEX_SEQUENCE_122() _GMP_MAKE_INDEX_SEQUENCE_121(), 122
+#define _GMP_MAKE_INDEX_SEQUENCE_123() _GMP_MAKE_INDEX_SEQUENCE_122(), 123
+#define _GMP_MAKE_INDEX_SEQUENCE_124() _GMP_MAKE_INDEX_SEQUENCE_123(), 124
+#define _GMP_MAKE_INDEX_SEQUENCE_125() _GMP_MAKE_INDEX_SEQUENCE_124(), 125
+#define _GMP_MAKE_INDEX_SEQUENCE_126() _GMP_MAKE_INDEX_SEQUENCE_125(), 126
+#define _GMP_MAKE_INDEX_SEQUENCE_127() _GMP_MAKE_INDEX_SEQUENCE_126(), 127
+#define _GMP_MAKE_INDEX_SEQUENCE_128() _GMP_MAKE_INDEX_SEQUENCE_127(), 128
+#define _GMP_MAKE_INDEX_SEQUENCE_129() _GMP_MAKE_INDEX_SEQUENCE_128(), 129
+#define _GMP_MAKE_INDEX_SEQUENCE_130() _GMP_MAKE_INDEX_SEQUENCE_129(), 130
+#define _GMP_MAKE_INDEX_SEQUENCE_131() _GMP_MAKE_INDEX_SEQUENCE_130(), 131
+#define _GMP_MAKE_INDEX_SEQUENCE_132() _GMP_MAKE_INDEX_SEQUENCE_131(), 132
+#define _GMP_MAKE_INDEX_SEQUENCE_133() _GMP_MAKE_INDEX_SEQUENCE_132(), 133
+#define _GMP_MAKE_INDEX_SEQUENCE_134() _GMP_MAKE_INDEX_SEQUENCE_133(), 134
+#define _GMP_MAKE_INDEX_SEQUENCE_135() _GMP_MAKE_INDEX_SEQUENCE_134(), 135
+#define _GMP_MAKE_INDEX_SEQUENCE_136() _GMP_MAKE_INDEX_SEQUENCE_135(), 136
+#define _GMP_MAKE_INDEX_SEQUENCE_137() _GMP_MAKE_INDEX_SEQUENCE_136(), 137
+#define _GMP_MAKE_INDEX_SEQUENCE_138() _GMP_MAKE_INDEX_SEQUENCE_137(), 138
+#define _GMP_MAKE_INDEX_SEQUENCE_139() _GMP_MAKE_INDEX_SEQUENCE_138(), 139
+#define _GMP_MAKE_INDEX_SEQUENCE_140() _GMP_MAKE_INDEX_SEQUENCE_139(), 140
+#define _GMP_MAKE_INDEX_SEQUENCE_141() _GMP_MAKE_INDEX_SEQUENCE_140(), 141
+#define _GMP_MAKE_INDEX_SEQUENCE_142() _GMP_MAKE_INDEX_SEQUENCE_141(), 142
+#define _GMP_MAKE_INDEX_SEQUENCE_143() _GMP_MAKE_INDEX_SEQUENCE_142(), 143
+#define _GMP_MAKE_INDEX_SEQUENCE_144() _GMP_MAKE_INDEX_SEQUENCE_143(), 144
+#define _GMP_MAKE_INDEX_SEQUENCE_145() _GMP_MAKE_INDEX_SEQUENCE_144(), 145
+#define _GMP_MAKE_INDEX_SEQUENCE_146() _GMP_MAKE_INDEX_SEQUENCE_145(), 146
+#define _GMP_MAKE_INDEX_SEQUENCE_147() _GMP_MAKE_INDEX_SEQUENCE_146(), 147
+#define _GMP_MAKE_INDEX_SEQUENCE_148() _GMP_MAKE_INDEX_SEQUENCE_147(), 148
+#define _GMP_MAKE_INDEX_SEQUENCE_149() _GMP_MAKE_INDEX_SEQUENCE_148(), 149
+#define _GMP_MAKE_INDEX_SEQUENCE_150() _GMP_MAKE_INDEX_SEQUENCE_149(), 150
+#define _GMP_MAKE_INDEX_SEQUENCE_151() _GMP_MAKE_INDEX_SEQUENCE_150(), 151
+#define _GMP_MAKE_INDEX_SEQUENCE_152() _GMP_MAKE_INDEX_SEQUENCE_151(), 152
+#define _GMP_MAKE_INDEX_SEQUENCE_153() _GMP_MAKE_INDEX_SEQUENCE_152(), 153
+#define _GMP_MAKE_INDEX_SEQUENCE_154() _GMP_MAKE_INDEX_SEQUENCE_153(), 154
+#define _GMP_MAKE_INDEX_SEQUENCE_155() _GMP_MAKE_INDEX_SEQUENCE_154(), 155
+#define _GMP_MAKE_INDEX_SEQUENCE_156() _GMP_MAKE_INDEX_SEQUENCE_155(), 156
+#define _GMP_MAKE_INDEX_SEQUENCE_157() _GMP_MAKE_INDEX_SEQUENCE_156(), 157
+#define _GMP_MAKE_INDEX_SEQUENCE_158() _GMP_MAKE_INDEX_SEQUENCE_157(), 158
+#define _GMP_MAKE_INDEX_SEQUENCE_159() _GMP_MAKE_INDEX_SEQUENCE_158(), 159
+#define _GMP_MAKE_INDEX_SEQUENCE_160() _GMP_MAKE_INDEX_SEQUENCE_159(), 160
+#define _GMP_MAKE_INDEX_SEQUENCE_161() _GMP_MAKE_INDEX_SEQUENCE_160(), 161
+#define _GMP_MAKE_INDEX_SEQUENCE_162() _GMP_MAKE_INDEX_SEQUENCE_161(), 162
+#define _GMP_MAKE_INDEX_SEQUENCE_163() _GMP_MAKE_INDEX_SEQUENCE_162(), 163
+#define _GMP_MAKE_INDEX_SEQUENCE_164() _GMP_MAKE_INDEX_SEQUENCE_163(), 164
+#define _GMP_MAKE_INDEX_SEQUENCE_165() _GMP_MAKE_INDEX_SEQUENCE_164(), 165
+#define _GMP_MAKE_INDEX_SEQUENCE_166() _GMP_MAKE_INDEX_SEQUENCE_165(), 166
+#define _GMP_MAKE_INDEX_SEQUENCE_167() _GMP_MAKE_INDEX_SEQUENCE_166(), 167
+#define _GMP_MAKE_INDEX_SEQUENCE_168() _GMP_MAKE_INDEX_SEQUENCE_167(), 168
+#define _GMP_MAKE_INDEX_SEQUENCE_169() _GMP_MAKE_INDEX_SEQUENCE_168(), 169
+#define _GMP_MAKE_INDEX_SEQUENCE_170() _GMP_MAKE_INDEX_SEQUENCE_169(), 170
+#define _GMP_MAKE_INDEX_SEQUENCE_171() _GMP_MAKE_INDEX_SEQUENCE_170(), 171
+#define _GMP_MAKE_INDEX_SEQUENCE_172() _GMP_MAKE_INDEX_SEQUENCE_171(), 172
+#define _GMP_MAKE_INDEX_SEQUENCE_173() _GMP_MAKE_INDEX_SEQUENCE_172(), 173
+#define _GMP_MAKE_INDEX_SEQUENCE_174() _GMP_MAKE_INDEX_SEQUENCE_173(), 174
+#define _GMP_MAKE_INDEX_SEQUENCE_175() _GMP_MAKE_INDEX_SEQUENCE_174(), 175
+#define _GMP_MAKE_INDEX_SEQUENCE_176() _GMP_MAKE_INDEX_SEQUENCE_175(), 176
+#define _GMP_MAKE_INDEX_SEQUENCE_177() _GMP_MAKE_INDEX_SEQUENCE_176(), 177
+#define _GMP_MAKE_INDEX_SEQUENCE_178() _GMP_MAKE_INDEX_SEQUENCE_177(), 178
+#define _GMP_MAKE_INDEX_SEQUENCE_179() _GMP_MAKE_INDEX_SEQUENCE_178(), 179
+#define _GMP_MAKE_INDEX_SEQUENCE_180() _GMP_MAKE_INDEX_SEQUENCE_179(), 180
+#define _GMP_MAKE_INDEX_SEQUENCE_181() _GMP_MAKE_INDEX_SEQUENCE_180(), 181
+#define _GMP_MAKE_INDEX_SEQUENCE_182() _GMP_MAKE_INDEX_SEQUENCE_181(), 182
+#define _GMP_MAKE_INDEX_SEQUENCE_183() _GMP_MAKE_INDEX_SEQUENCE_182(), 183
+#define _GMP_MAKE_INDEX_SEQUENCE_184() _GMP_MAKE_INDEX_SEQUENCE_183(), 184
+#define _GMP_MAKE_INDEX_SEQUENCE_185() _GMP_MAKE_INDEX_SEQUENCE_184(), 185
+#define _GMP_MAKE_INDEX_SEQUENCE_186() _GMP_MAKE_INDEX_SEQUENCE_185(), 186
+#define _GMP_MAKE_INDEX_SEQUENCE_187() _GMP_MAKE_INDEX_SEQUENCE_186(), 187
+#define _GMP_MAKE_INDEX_SEQUENCE_188() _GMP_MAKE_INDEX_SEQUENCE_187(), 188
+#define _GMP_MAKE_INDEX_SEQUENCE_189() _GMP_MAKE_INDEX_SEQUENCE_188(), 189
+#define _GMP_MAKE_INDEX_SEQUENCE_190() _GMP_MAKE_INDEX_SEQUENCE_189(), 190
+#define _GMP_MAKE_INDEX_SEQUENCE_191() _GMP_MAKE_INDEX_SEQUENCE_190(), 191
+#define _GMP_MAKE_INDEX_SEQUENCE_192() _GMP_MAKE_INDEX_SEQUENCE_191(), 192
+#define _GMP_MAKE_INDEX_SEQUENCE_193() _GMP_MAKE_INDEX_SEQUENCE_192(), 193
+#define _GMP_MAKE_INDEX_SEQUENCE_194() _GMP_MAKE_INDEX_SEQUENCE_193(), 194
+#define _GMP_MAKE_INDEX_SEQUENCE_195() _GMP_MAKE_INDEX_SEQUENCE_194(), 195
+#define _GMP_MAKE_INDEX_SEQUENCE_196() _GMP_MAKE_INDEX_SEQUENCE_195(), 196
+#define _GMP_MAKE_INDEX_SEQUENCE_197() _GMP_MAKE_INDEX_SEQUENCE_196(), 197
+#define _GMP_MAKE_INDEX_SEQUENCE_198() _GMP_MAKE_INDEX_SEQUENCE_197(), 198
+#define _GMP_MAKE_INDEX_SEQUENCE_199() _GMP_MAKE_INDEX_SEQUENCE_198(), 199
+#define _GMP_MAKE_INDEX_SEQUENCE_200() _GMP_MAKE_INDEX_SEQUENCE_199(), 200
+#define _GMP_MAKE_INDEX_SEQUENCE_201() _GMP_MAKE_INDEX_SEQUENCE_200(), 201
+#define _GMP_MAKE_INDEX_SEQUENCE_202() _GMP_MAKE_INDEX_SEQUENCE_201(), 202
+#define _GMP_MAKE_INDEX_SEQUENCE_203() _GMP_MAKE_INDEX_SEQUENCE_202(), 203
+#define _GMP_MAKE_INDEX_SEQUENCE_204() _GMP_MAKE_INDEX_SEQUENCE_203(), 204
+#define _GMP_MAKE_INDEX_SEQUENCE_205() _GMP_MAKE_INDEX_SEQUENCE_204(), 205
+#define _GMP_MAKE_INDEX_SEQUENCE_206() _GMP_MAKE_INDEX_SEQUENCE_205(), 206
+#define _GMP_MAKE_INDEX_SEQUENCE_207() _GMP_MAKE_INDEX_SEQUENCE_206(), 207
+#define _GMP_MAKE_INDEX_SEQUENCE_208() _GMP_MAKE_INDEX_SEQUENCE_207(), 208
+#define _GMP_MAKE_INDEX_SEQUENCE_209() _GMP_MAKE_INDEX_SEQUENCE_208(), 209
+#define _GMP_MAKE_INDEX_SEQUENCE_210() _GMP_MAKE_INDEX_SEQUENCE_209(), 210
+#define _GMP_MAKE_INDEX_SEQUENCE_211() _GMP_MAKE_INDEX_SEQUENCE_210(), 211
+#define _GMP_MAKE_INDEX_SEQUENCE_212() _GMP_MAKE_INDEX_SEQUENCE_211(), 212
+#define _GMP_MAKE_INDEX_SEQUENCE_213() _GMP_MAKE_INDEX_SEQUENCE_212(), 213
+#define _GMP_MAKE_INDEX_SEQUENCE_214() _GMP_MAKE_INDEX_SEQUENCE_213(), 214
+#define _GMP_MAKE_INDEX_SEQUENCE_215() _GMP_MAKE_INDEX_SEQUENCE_214(), 215
+#define _GMP_MAKE_INDEX_SEQUENCE_216() _GMP_MAKE_INDEX_SEQUENCE_215(), 216
+#define _GMP_MAKE_INDEX_SEQUENCE_217() _GMP_MAKE_INDEX_SEQUENCE_216(), 217
+#define _GMP_MAKE_INDEX_SEQUENCE_218() _GMP_MAKE_INDEX_SEQUENCE_217(), 218
+#define _GMP_MAKE_INDEX_SEQUENCE_219() _GMP_MAKE_INDEX_SEQUENCE_218(), 219
+#define _GMP_MAKE_INDEX_SEQUENCE_220() _GMP_MAKE_INDEX_SEQUENCE_219(), 220
+#define _GMP_MAKE_INDEX_SEQUENCE_221() _GMP_MAKE_INDEX_SEQUENCE_220(), 221
+#define _GMP_MAKE_INDEX_SEQUENCE_222() _GMP_MAKE_INDEX_SEQUENCE_221(), 222
+#define _GMP_MAKE_INDEX_SEQUENCE_223() _GMP_MAKE_INDEX_SEQUENCE_222(), 223
+#define _GMP_MAKE_INDEX_SEQUENCE_224() _GMP_MAKE_INDEX_SEQUENCE_223(), 224
+#define _GMP_MAKE_INDEX_SEQUENCE_225() _GMP_MAKE_INDEX_SEQUENCE_224(), 225
+#define _GMP_MAKE_INDEX_SEQUENCE_226() _GMP_MAKE_INDEX_SEQUENCE_225(), 226
+#define _GMP_MAKE_INDEX_SEQUENCE_227() _GMP_MAKE_INDEX_SEQUENCE_226(), 227
+#define _GMP_MAKE_INDEX_SEQUENCE_228() _GMP_MAKE_INDEX_SEQUENCE_227(), 228
+#define _GMP_MAKE_INDEX_SEQUENCE_229() _GMP_MAKE_INDEX_SEQUENCE_228(), 229
+#define _GMP_MAKE_INDEX_SEQUENCE_230() _GMP_MAKE_INDEX_SEQUENCE_229(), 230
+#define _GMP_MAKE_INDEX_SEQUENCE_231() _GMP_MAKE_INDEX_SEQUENCE_230(), 231
+#define _GMP_MAKE_INDEX_SEQUENCE_232() _GMP_MAKE_INDEX_SEQUENCE_231(), 232
+#define _GMP_MAKE_INDEX_SEQUENCE_233() _GMP_MAKE_INDEX_SEQUENCE_232(), 233
+#define _GMP_MAKE_INDEX_SEQUENCE_234() _GMP_MAKE_INDEX_SEQUENCE_233(), 234
+#define _GMP_MAKE_INDEX_SEQUENCE_235() _GMP_MAKE_INDEX_SEQUENCE_234(), 235
+#define _GMP_MAKE_INDEX_SEQUENCE_236() _GMP_MAKE_INDEX_SEQUENCE_235(), 236
+#define _GMP_MAKE_INDEX_SEQUENCE_237() _GMP_MAKE_INDEX_SEQUENCE_236(), 237
+#define _GMP_MAKE_INDEX_SEQUENCE_238() _GMP_MAKE_INDEX_SEQUENCE_237(), 238
+#define _GMP_MAKE_INDEX_SEQUENCE_239() _GMP_MAKE_INDEX_SEQUENCE_238(), 239
+#define _GMP_MAKE_INDEX_SEQUENCE_240() _GMP_MAKE_INDEX_SEQUENCE_239(), 240
+#define _GMP_MAKE_INDEX_SEQUENCE_241() _GMP_MAKE_INDEX_SEQUENCE_240(), 241
+#define _GMP_MAKE_INDEX_SEQUENCE_242() _GMP_MAKE_INDEX_SEQUENCE_241(), 242
+#define _GMP_MAKE_INDEX_SEQUENCE_243() _GMP_MAKE_INDEX_SEQUENCE_242(), 243
+#define _GMP_MAKE_INDEX_SEQUENCE_244() _GMP_MAKE_INDEX_SEQUENCE_243(), 244
+#define _GMP_MAKE_INDEX_SEQUENCE_245() _GMP_MAKE_INDEX_SEQUENCE_244(), 245
+#define _GMP_MAKE_INDEX_SEQUENCE_246() _GMP_MAKE_INDEX_SEQUENCE_245(), 246
+#define _GMP_MAKE_INDEX_SEQUENCE_247() _GMP_MAKE_INDEX_SEQUENCE_246(), 247
+#define _GMP_MAKE_INDEX_SEQUENCE_248() _GMP_MAKE_INDEX_SEQUENCE_247(), 248
+#define _GMP_MAKE_INDEX_SEQUENCE_249() _GMP_MAKE_INDEX_SEQUENCE_248(), 249
+#define _GMP_MAKE_INDEX_SEQUENCE_250() _GMP_MAKE_INDEX_SEQUENCE_249(), 250
+#define _GMP_MAKE_INDEX_SEQUENCE_251() _GMP_MAKE_INDEX_SEQUENCE_250(), 251
+#define _GMP_MAKE_INDEX_SEQUENCE_252() _GMP_MAKE_INDEX_SEQUENCE_251(), 252
+#define _GMP_MAKE_INDEX_SEQUENCE_253() _GMP_MAKE_INDEX_SEQUENCE_252(), 253
+
+// GMP_RANGE
+#define _GMP_DROP_0(...) __VA_ARGS__
+#define _GMP_DROP_1(x, ...) _GMP_DROP_0(__VA_ARGS__)
+#define _GMP_DROP_2(x, ...) _GMP_DROP_1(__VA_ARGS__)
+#define _GMP_DROP_3(x, ...) _GMP_DROP_2(__VA_ARGS__)
+#define _GMP_DROP_4(x, ...) _GMP_DROP_3(__VA_ARGS__)
+#define _GMP_DROP_5(x, ...) _GMP_DROP_4(__VA_ARGS__)
+#define _GMP_DROP_6(x, ...) _GMP_DROP_5(__VA_ARGS__)
+#define _GMP_DROP_7(x, ...) _GMP_DROP_6(__VA_ARGS__)
+#define _GMP_DROP_8(x, ...) _GMP_DROP_7(__VA_ARGS__)
+#define _GMP_DROP_9(x, ...) _GMP_DROP_8(__VA_ARGS__)
+#define _GMP_DROP_10(x, ...) _GMP_DROP_9(__VA_ARGS__)
+#define _GMP_DROP_11(x, ...) _GMP_DROP_10(__VA_ARGS__)
+#define _GMP_DROP_12(x, ...) _GMP_DROP_11(__VA_ARGS__)
+#define _GMP_DROP_13(x, ...) _GMP_DROP_12(__VA_ARGS__)
+#define _GMP_DROP_14(x, ...) _GMP_DROP_13(__VA_ARGS__)
+#define _GMP_DROP_15(x, ...) _GMP_DROP_14(__VA_ARGS__)
+#define _GMP_DROP_16(x, ...) _GMP_DROP_15(__VA_ARGS__)
+#define _GMP_DROP_17(x, ...) _GMP_DROP_16(__VA_ARGS__)
+#define _GMP_DROP_18(x, ...) _GMP_DROP_17(__VA_ARGS__)
+#define _GMP_DROP_19(x, ...) _GMP_DROP_18(__VA_ARGS__)
+#define _GMP_DROP_20(x, ...) _GMP_DROP_19(__VA_ARGS__)
+#define _GMP_DROP_21(x, ...) _GMP_DROP_20(__VA_ARGS__)
+#define _GMP_DROP_22(x, ...) _GMP_DROP_21(__VA_ARGS__)
+#define _GMP_DROP_23(x, ...) _GMP_DROP_22(__VA_ARGS__)
+#define _GMP_DROP_24(x, ...) _GMP_DROP_23(__VA_ARGS__)
+#define _GMP_DROP_25(x, ...) _GMP_DROP_24(__VA_ARGS__)
+#define _GMP_DROP_26(x, ...) _GMP_DROP_25(__VA_ARGS__)
+#define _GMP_DROP_27(x, ...) _GMP_DROP_26(__VA_ARGS__)
+#define _GMP_DROP_28(x, ...) _GMP_DROP_27(__VA_ARGS__)
+#define _GMP_DROP_29(x, ...) _GMP_DROP_28(__VA_ARGS__)
+#define _GMP_DROP_30(x, ...) _GMP_DROP_29(__VA_ARGS__)
+#define _GMP_DROP_31(x, ...) _GMP_DROP_30(__VA_ARGS__)
+#define _GMP_DROP_32(x, ...) _GMP_DROP_31(__VA_ARGS__)
+#define _GMP_DROP_33(x, ...) _GMP_DROP_32(__VA_ARGS__)
+#define _GMP_DROP_34(x, ...) _GMP_DROP_33(__VA_ARGS__)
+#define _GMP_DROP_35(x, ...) _GMP_DROP_34(__VA_ARGS__)
+#define _GMP_DROP_36(x, ...) _GMP_DROP_35(__VA_ARGS__)
+#define _GMP_DROP_37(x, ...) _GMP_DROP_36(__VA_ARGS__)
+#define _GMP_DROP_38(x, ...) _GMP_DROP_37(__VA_ARGS__)
+#define _GMP_DROP_39(x, ...) _GMP_DROP_38(__VA_ARGS__)
+#define _GMP_DROP_40(x, ...) _GMP_DROP_39(__VA_ARGS__)
+#define _GMP_DROP_41(x, ...) _GMP_DROP_40(__VA_ARGS__)
+#define _GMP_DROP_42(x, ...) _GMP_DROP_41(__VA_ARGS__)
+#define _GMP_DROP_43(x, ...) _GMP_DROP_42(__VA_ARGS__)
+#define _GMP_DROP_44(x, ...) _GMP_DROP_43(__VA_ARGS__)
+#define _GMP_DROP_45(x, ...) _GMP_DROP_44(__VA_ARGS__)
+#define _GMP_DROP_46(x, ...) _GMP_DROP_45(__VA_ARGS__)
+#define _GMP_DROP_47(x, ...) _GMP_DROP_46(__VA_ARGS__)
+#define _GMP_DROP_48(x, ...) _GMP_DROP_47(__VA_ARGS__)
+#define _GMP_DROP_49(x, ...) _GMP_DROP_48(__VA_ARGS__)
+#define _GMP_DROP_50(x, ...) _GMP_DROP_49(__VA_ARGS__)
+#define _GMP_DROP_51(x, ...) _GMP_DROP_50(__VA_ARGS__)
+#define _GMP_DROP_52(x, ...) _GMP_DROP_51(__VA_ARGS__)
+#define _GMP_DROP_53(x, ...) _GMP_DROP_52(__VA_ARGS__)
+#define _GMP_DROP_54(x, ...) _GMP_DROP_53(__VA_ARGS__)
+#define _GMP_DROP_55(x, ...) _GMP_DROP_54(__VA_ARGS__)
+#define _GMP_DROP_56(x, ...) _GMP_DROP_55(__VA_ARGS__)
+#define _GMP_DROP_57(x, ...) _GMP_DROP_56(__VA_ARGS__)
+#define _GMP_DROP_58(x, ...) _GMP_DROP_57(__VA_ARGS__)
+#define _GMP_DROP_59(x, ...) _GMP_DROP_58(__VA_ARGS__)
+#define _GMP_DROP_60(x, ...) _GMP_DROP_59(__VA_ARGS__)
+#define _GMP_DROP_61(x, ...) _GMP_DROP_60(__VA_ARGS__)
+#define _GMP_DROP_62(x, ...) _GMP_DROP_61(__VA_ARGS__)
+#define _GMP_DROP_63(x, ...) _GMP_DROP_62(__VA_ARGS__)
+#define _GMP_DROP_64(x, ...) _GMP_DROP_63(__VA_ARGS__)
+#define _GMP_DROP_65(x, ...) _GMP_DROP_64(__VA_ARGS__)
+#define _GMP_DROP_66(x, ...) _GMP_DROP_65(__VA_ARGS__)
+#define _GMP_DROP_67(x, ...) _GMP_DROP_66(__VA_ARGS__)
+#define _GMP_DROP_68(x, ...) _GMP_DROP_67(__VA_ARGS__)
+#define _GMP_DROP_69(x, ...) _GMP_DROP_68(__VA_ARGS__)
+#define _GMP_DROP_70(x, ...) _GMP_DROP_69(__VA_ARGS__)
+#define _GMP_DROP_71(x, ...) _GMP_DROP_70(__VA_ARGS__)
+#define _GMP_DROP_72(x, ...) _GMP_DROP_71(__VA_ARGS__)
+#define _GMP_DROP_73(x, ...) _GMP_DROP_72(__VA_ARGS__)
+#define _GMP_DROP_74(x, ...) _GMP_DROP_73(__VA_ARGS__)
+#define _GMP_DROP_75(x, ...) _GMP_DROP_74(__VA_ARGS__)
+#define _GMP_DROP_76(x, ...) _GMP_DROP_75(__VA_ARGS__)
+#define _GMP_DROP_77(x, ...) _GMP_DROP_76(__VA_ARGS__)
+#define _GMP_DROP_78(x, ...) _GMP_DROP_77(__VA_ARGS__)
+#define _GMP_DROP_79(x, ...) _GMP_DROP_78(__VA_ARGS__)
+#define _GMP_DROP_80(x, ...) _GMP_DROP_79(__VA_ARGS__)
+#define _GMP_DROP_81(x, ...) _GMP_DROP_80(__VA_ARGS__)
+#define _GMP_DROP_82(x, ...) _GMP_DROP_81(__VA_ARGS__)
+#define _GMP_DROP_83(x, ...) _GMP_DROP_82(__VA_ARGS__)
+#define _GMP_DROP_84(x, ...) _GMP_DROP_83(__VA_ARGS__)
+#define _GMP_DROP_85(x, ...) _GMP_DROP_84(__VA_ARGS__)
+#define _GMP_DROP_86(x, ...) _GMP_DROP_85(__VA_ARGS__)
+#define _GMP_DROP_87(x, ...) _GMP_DROP_86(__VA_ARGS__)
+#define _GMP_DROP_88(x, ...) _GMP_DROP_87(__VA_ARGS__)
+#define _GMP_DROP_89(x, ...) _GMP_DROP_88(__VA_ARGS__)
+#define _GMP_DROP_90(x, ...) _GMP_DROP_89(__VA_ARGS__)
+#define _GMP_DROP_91(x, ...) _GMP_DROP_90(__VA_ARGS__)
+#define _GMP_DROP_92(x, ...) _GMP_DROP_91(__VA_ARGS__)
+#define _GMP_DROP_93(x, ...) _GMP_DROP_92(__VA_ARGS__)
+#define _GMP_DROP_94(x, ...) _GMP_DROP_93(__VA_ARGS__)
+#define _GMP_DROP_95(x, ...) _GMP_DROP_94(__VA_ARGS__)
+#define _GMP_DROP_96(x, ...) _GMP_DROP_95(__VA_ARGS__)
+#define _GMP_DROP_97(x, ...) _GMP_DROP_96(__VA_ARGS__)
+#define _GMP_DROP_98(x, ...) _GMP_DROP_97(__VA_ARGS__)
+#define _GMP_DROP_99(x, ...) _GMP_DROP_98(__VA_ARGS__)
+#define _GMP_DROP_100(x, ...) _GMP_DROP_99(__VA_ARGS__)
+#define _GMP_DROP_101(x, ...) _GMP_DROP_100(__VA_ARGS__)
+#define _GMP_DROP_102(x, ...) _GMP_DROP_101(__VA_ARGS__)
+#define _GMP_DROP_103(x, ...) _GMP_DROP_102(__VA_ARGS__)
+#define _GMP_DROP_104(x, ...) _GMP_DROP_103(__VA_ARGS__)
+#define _GMP_DROP_105(x, ...) _GMP_DROP_104(__VA_ARGS__)
+#define _GMP_DROP_106(x, ...) _GMP_DROP_105(__VA_ARGS__)
+#define _GMP_DROP_107(x, ...) _GMP_DROP_106(__VA_ARGS__)
+#define _GMP_DROP_108(x, ...) _GMP_DROP_107(__VA_ARGS__)
+#define _GMP_DROP_109(x, ...) _GMP_DROP_108(__VA_ARGS__)
+#define _GMP_DROP_110(x, ...) _GMP_DROP_109(__VA_ARGS__)
+#define _GMP_DROP_111(x, ...) _GMP_DROP_110(__VA_ARGS__)
+#define _GMP_DROP_112(x, ...) _GMP_DROP_111(__VA_ARGS__)
+#define _GMP_DROP_113(x, ...) _GMP_DROP_112(__VA_ARGS__)
+#define _GMP_DROP_114(x, ...) _GMP_DROP_113(__VA_ARGS__)
+#define _GMP_DROP_115(x, ...) _GMP_DROP_114(__VA_ARGS__)
+#define _GMP_DROP_116(x, ...) _GMP_DROP_115(__VA_ARGS__)
+#define _GMP_DROP_117(x, ...) _GMP_DROP_116(__VA_ARGS__)
+#define _GMP_DROP_118(x, ...) _GMP_DROP_117(__VA_ARGS__)
+#define _GMP_DROP_119(x, ...) _GMP_DROP_118(__VA_ARGS__)
+#define _GMP_DROP_120(x, ...) _GMP_DROP_119(__VA_ARGS__)
+#define _GMP_DROP_121(x, ...) _GMP_DROP_120(__VA_ARGS__)
+#define _GMP_DROP_122(x, ...) _GMP_DROP_121(__VA_ARGS__)
+#define _GMP_DROP_123(x, ...) _GMP_DROP_122(__VA_ARGS__)
+#define _GMP_DROP_124(x, ...) _GMP_DROP_123(__VA_ARGS__)
+#define _GMP_DROP_125(x, ...) _GMP_DROP_124(__VA_ARGS__)
+#define _GMP_DROP_126(x, ...) _GMP_DROP_125(__VA_ARGS__)
+#define _GMP_DROP_127(x, ...) _GMP_DROP_126(__VA_ARGS__)
+#define _GMP_DROP_128(x, ...) _GMP_DROP_127(__VA_ARGS__)
+#define _GMP_DROP_129(x, ...) _GMP_DROP_128(__VA_ARGS__)
+#define _GMP_DROP_130(x, ...) _GMP_DROP_129(__VA_ARGS__)
+#define _GMP_DROP_131(x, ...) _GMP_DROP_130(__VA_ARGS__)
+#define _GMP_DROP_132(x, ...) _GMP_DROP_131(__VA_ARGS__)
+#define _GMP_DROP_133(x, ...) _GMP_DROP_132(__VA_ARGS__)
+#define _GMP_DROP_134(x, ...) _GMP_DROP_133(__VA_ARGS__)
+#define _GMP_DROP_135(x, ...) _GMP_DROP_134(__VA_ARGS__)
+#define _GMP_DROP_136(x, ...) _GMP_DROP_135(__VA_ARGS__)
+#define _GMP_DROP_137(x, ...) _GMP_DROP_136(__VA_ARGS__)
+#define _GMP_DROP_138(x, ...) _GMP_DROP_137(__VA_ARGS__)
+#define _GMP_DROP_139(x, ...) _GMP_DROP_138(__VA_ARGS__)
+#define _GMP_DROP_140(x, ...) _GMP_DROP_139(__VA_ARGS__)
+#define _GMP_DROP_141(x, ...) _GMP_DROP_140(__VA_ARGS__)
+#define _GMP_DROP_142(x, ...) _GMP_DROP_141(__VA_ARGS__)
+#define _GMP_DROP_143(x, ...) _GMP_DROP_142(__VA_ARGS__)
+#define _GMP_DROP_144(x, ...) _GMP_DROP_143(__VA_ARGS__)
+#define _GMP_DROP_145(x, ...) _GMP_DROP_144(__VA_ARGS__)
+#define _GMP_DROP_146(x, ...) _GMP_DROP_145(__VA_ARGS__)
+#define _GMP_DROP_147(x, ...) _GMP_DROP_146(__VA_ARGS__)
+#define _GMP_DROP_148(x, ...) _GMP_DROP_147(__VA_ARGS__)
+#define _GMP_DROP_149(x, ...) _GMP_DROP_148(__VA_ARGS__)
+#define _GMP_DROP_150(x, ...) _GMP_DROP_149(__VA_ARGS__)
+#define _GMP_DROP_151(x, ...) _GMP_DROP_150(__VA_ARGS__)
+#define _GMP_DROP_152(x, ...) _GMP_DROP_151(__VA_ARGS__)
+#define _GMP_DROP_153(x, ...) _GMP_DROP_152(__VA_ARGS__)
+#define _GMP_DROP_154(x, ...) _GMP_DROP_153(__VA_ARGS__)
+#define _GMP_DROP_155(x, ...) _GMP_DROP_154(__VA_ARGS__)
+#define _GMP_DROP_156(x, ...) _GMP_DROP_155(__VA_ARGS__)
+#define _GMP_DROP_157(x, ...) _GMP_DROP_156(__VA_ARGS__)
+#define _GMP_DROP_158(x, ...) _GMP_DROP_157(__VA_ARGS__)
+#define _GMP_DROP_159(x, ...) _GMP_DROP_158(__VA_ARGS__)
+#define _GMP_DROP_160(x, ...) _GMP_DROP_159(__VA_ARGS__)
+#define _GMP_DROP_161(x, ...) _GMP_DROP_160(__VA_ARGS__)
+#define _GMP_DROP_162(x, ...) _GMP_DROP_161(__VA_ARGS__)
+#define _GMP_DROP_163(x, ...) _GMP_DROP_162(__VA_ARGS__)
+#define _GMP_DROP_164(x, ...) _GMP_DROP_163(__VA_ARGS__)
+#define _GMP_DROP_165(x, ...) _GMP_DROP_164(__VA_ARGS__)
+#define _GMP_DROP_166(x, ...) _GMP_DROP_165(__VA_ARGS__)
+#define _GMP_DROP_167(x, ...) _GMP_DROP_166(__VA_ARGS__)
+#define _GMP_DROP_168(x, ...) _GMP_DROP_167(__VA_ARGS__)
+#define _GMP_DROP_169(x, ...) _GMP_DROP_168(__VA_ARGS__)
+#define _GMP_DROP_170(x, ...) _GMP_DROP_169(__VA_ARGS__)
+#define _GMP_DROP_171(x, ...) _GMP_DROP_170(__VA_ARGS__)
+#define _GMP_DROP_172(x, ...) _GMP_DROP_171(__VA_ARGS__)
+#define _GMP_DROP_173(x, ...) _GMP_DROP_172(__VA_ARGS__)
+#define _GMP_DROP_174(x, ...) _GMP_DROP_173(__VA_ARGS__)
+#define _GMP_DROP_175(x, ...) _GMP_DROP_174(__VA_ARGS__)
+#define _GMP_DROP_176(x, ...) _GMP_DROP_175(__VA_ARGS__)
+#define _GMP_DROP_177(x, ...) _GMP_DROP_176(__VA_ARGS__)
+#define _GMP_DROP_178(x, ...) _GMP_DROP_177(__VA_ARGS__)
+#define _GMP_DROP_179(x, ...) _GMP_DROP_178(__VA_ARGS__)
+#define _GMP_DROP_180(x, ...) _GMP_DROP_179(__VA_ARGS__)
+#define _GMP_DROP_181(x, ...) _GMP_DROP_180(__VA_ARGS__)
+#define _GMP_DROP_182(x, ...) _GMP_DROP_181(__VA_ARGS__)
+#define _GMP_DROP_183(x, ...) _GMP_DROP_182(__VA_ARGS__)
+#define _GMP_DROP_184(x, ...) _GMP_DROP_183(__VA_ARGS__)
+#define _GMP_DROP_185(x, ...) _GMP_DROP_184(__VA_ARGS__)
+#define _GMP_DROP_186(x, ...) _GMP_DROP_185(__VA_ARGS__)
+#define _GMP_DROP_187(x, ...) _GMP_DROP_186(__VA_ARGS__)
+#define _GMP_DROP_188(x, ...) _GMP_DROP_187(__VA_ARGS__)
+#define _GMP_DROP_189(x, ...) _GMP_DROP_188(__VA_ARGS__)
+#define _GMP_DROP_190(x, ...) _GMP_DROP_189(__VA_ARGS__)
+#define _GMP_DROP_191(x, ...) _GMP_DROP_190(__VA_ARGS__)
+#define _GMP_DROP_192(x, ...) _GMP_DROP_191(__VA_ARGS__)
+#define _GMP_DROP_193(x, ...) _GMP_DROP_192(__VA_ARGS__)
+#define _GMP_DROP_194(x, ...) _GMP_DROP_193(__VA_ARGS__)
+#define _GMP_DROP_195(x, ...) _GMP_DROP_194(__VA_ARGS__)
+#define _GMP_DROP_196(x, ...) _GMP_DROP_195(__VA_ARGS__)
+#define _GMP_DROP_197(x, ...) _GMP_DROP_196(__VA_ARGS__)
+#define _GMP_DROP_198(x, ...) _GMP_DROP_197(__VA_ARGS__)
+#define _GMP_DROP_199(x, ...) _GMP_DROP_198(__VA_ARGS__)
+#define _GMP_DROP_200(x, ...) _GMP_DROP_199(__VA_ARGS__)
+#define _GMP_DROP_201(x, ...) _GMP_DROP_200(__VA_ARGS__)
+#define _GMP_DROP_202(x, ...) _GMP_DROP_201(__VA_ARGS__)
+#define _GMP_DROP_203(x, ...) _GMP_DROP_202(__VA_ARGS__)
+#define _GMP_DROP_204(x, ...) _GMP_DROP_203(__VA_ARGS__)
+#define _GMP_DROP_205(x, ...) _GMP_DROP_204(__VA_ARGS__)
+#define _GMP_DROP_206(x, ...) _GMP_DROP_205(__VA_ARGS__)
+#define _GMP_DROP_207(x, ...) _GMP_DROP_206(__VA_ARGS__)
+#define _GMP_DROP_208(x, ...) _GMP_DROP_207(__VA_ARGS__)
+#define _GMP_DROP_209(x, ...) _GMP_DROP_208(__VA_ARGS__)
+#define _GMP_DROP_210(x, ...) _GMP_DROP_209(__VA_ARGS__)
+#define _GMP_DROP_211(x, ...) _GMP_DROP_210(__VA_ARGS__)
+#define _GMP_DROP_212(x, ...) _GMP_DROP_211(__VA_ARGS__)
+#define _GMP_DROP_213(x, ...) _GMP_DROP_212(__VA_ARGS__)
+#define _GMP_DROP_214(x, ...) _GMP_DROP_213(__VA_ARGS__)
+#define _GMP_DROP_215(x, ...) _GMP_DROP_214(__VA_ARGS__)
+#define _GMP_DROP_216(x, ...) _GMP_DROP_215(__VA_ARGS__)
+#define _GMP_DROP_217(x, ...) _GMP_DROP_216(__VA_ARGS__)
+#define _GMP_DROP_218(x, ...) _GMP_DROP_217(__VA_ARGS__)
+#define _GMP_DROP_219(x, ...) _GMP_DROP_218(__VA_ARGS__)
+#define _GMP_DROP_220(x, ...) _GMP_DROP_219(__VA_ARGS__)
+#define _GMP_DROP_221(x, ...) _GMP_DROP_220(__VA_ARGS__)
+#define _GMP_DROP_222(x, ...) _GMP_DROP_221(__VA_ARGS__)
+#define _GMP_DROP_223(x, ...) _GMP_DROP_222(__VA_ARGS__)
+#define _GMP_DROP_224(x, ...) _GMP_DROP_223(__VA_ARGS__)
+#define _GMP_DROP_225(x, ...) _GMP_DROP_224(__VA_ARGS__)
+#define _GMP_DROP_226(x, ...) _GMP_DROP_225(__VA_ARGS__)
+#define _GMP_DROP_227(x, ...) _GMP_DROP_226(__VA_ARGS__)
+#define _GMP_DROP_228(x, ...) _GMP_DROP_227(__VA_ARGS__)
+#define _GMP_DROP_229(x, ...) _GMP_DROP_228(__VA_ARGS__)
+#define _GMP_DROP_230(x, ...) _GMP_DROP_229(__VA_ARGS__)
+#define _GMP_DROP_231(x, ...) _GMP_DROP_230(__VA_ARGS__)
+#define _GMP_DROP_232(x, ...) _GMP_DROP_231(__VA_ARGS__)
+#define _GMP_DROP_233(x, ...) _GMP_DROP_232(__VA_ARGS__)
+#define _GMP_DROP_234(x, ...) _GMP_DROP_233(__VA_ARGS__)
+#define _GMP_DROP_235(x, ...) _GMP_DROP_234(__VA_ARGS__)
+#define _GMP_DROP_236(x, ...) _GMP_DROP_235(__VA_ARGS__)
+#define _GMP_DROP_237(x, ...) _GMP_DROP_236(__VA_ARGS__)
+#define _GMP_DROP_238(x, ...) _GMP_DROP_237(__VA_ARGS__)
+#define _GMP_DROP_239(x, ...) _GMP_DROP_238(__VA_ARGS__)
+#define _GMP_DROP_240(x, ...) _GMP_DROP_239(__VA_ARGS__)
+#define _GMP_DROP_241(x, ...) _GMP_DROP_240(__VA_ARGS__)
+#define _GMP_DROP_242(x, ...) _GMP_DROP_241(__VA_ARGS__)
+#define _GMP_DROP_243(x, ...) _GMP_DROP_242(__VA_ARGS__)
+#define _GMP_DROP_244(x, ...) _GMP_DROP_243(__VA_ARGS__)
+#define _GMP_DROP_245(x, ...) _GMP_DROP_244(__VA_ARGS__)
+#define _GMP_DROP_246(x, ...) _GMP_DROP_245(__VA_ARGS__)
+#define _GMP_DROP_247(x, ...) _GMP_DROP_246(__VA_ARGS__)
+#define _GMP_DROP_248(x, ...) _GMP_DROP_247(__VA_ARGS__)
+#define _GMP_DROP_249(x, ...) _GMP_DROP_248(__VA_ARGS__)
+#define _GMP_DROP_250(x, ...) _GMP_DROP_249(__VA_ARGS__)
+#define _GMP_DROP_251(x, ...) _GMP_DROP_250(__VA_ARGS__)
+#define _GMP_DROP_252(x, ...) _GMP_DROP_251(__VA_ARGS__)
+#define _GMP_DROP_253(x, ...) _GMP_DROP_252(__VA_ARGS__)
+#define _GMP_DROP_254(x, ...) _GMP_DROP_253(__VA_ARGS__)
+
+// GMP_LOOP
+#define _GMP_LOOP_0(call, ...)
+#define _GMP_LOOP_1(call, ...) call(__VA_ARGS__) _GMP_LOOP_0(call, __VA_ARGS__)
+#define _GMP_LOOP_2(call, ...) call(__VA_ARGS__) _GMP_LOOP_1(call, __VA_ARGS__)
+#define _GMP_LOOP_3(call, ...) call(__VA_ARGS__) _GMP_LOOP_2(call, __VA_ARGS__)
+#define _GMP_LOOP_4(call, ...) call(__VA_ARGS__) _GMP_LOOP_3(call, __VA_ARGS__)
+#define _GMP_LOOP_5(call, ...) call(__VA_ARGS__) _GMP_LOOP_4(call, __VA_ARGS__)
+#define _GMP_LOOP_6(call, ...) call(__VA_ARGS__) _GMP_LOOP_5(call, __VA_ARGS__)
+#define _GMP_LOOP_7(call, ...) call(__VA_ARGS__) _GMP_LOOP_6(call, __VA_ARGS__)
+#define _GMP_LOOP_8(call, ...) call(__VA_ARGS__) _GMP_LOOP_7(call, __VA_ARGS__)
+#define _GMP_LOOP_9(call, ...) call(__VA_ARGS__) _GMP_LOOP_8(call, __VA_ARGS__)
+#define _GMP_LOOP_10(call, ...) call(__VA_ARGS__) _GMP_LOOP_9(call, __VA_ARGS__)
+#define _GMP_LOOP_11(call, ...) call(__VA_ARGS__) _GMP_LOOP_10(call, __VA_ARGS__)
+#define _GMP_LOOP_12(call, ...) call(__VA_ARGS__) _GMP_LOOP_11(call, __VA_ARGS__)
+#define _GMP_LOOP_13(call, ...) call(__VA_ARGS__) _GMP_LOOP_12(call, __VA_ARGS__)
+#define _GMP_LOOP_14(call, ...) call(__VA_ARGS__) _GMP_LOOP_13(call, __VA_ARGS__)
+#define _GMP_LOOP_15(call, ...) call(__VA_ARGS__) _GMP_LOOP_14(call, __VA_ARGS__)
+#define _GMP_LOOP_16(call, ...) call(__VA_ARGS__) _GMP_LOOP_15(call, __VA_ARGS__)
+#define _GMP_LOOP_17(call, ...) call(__VA_ARGS__) _GMP_LOOP_16(call, __VA_ARGS__)
+#define _GMP_LOOP_18(call, ...) call(__VA_ARGS__) _GMP_LOOP_17(call, __VA_ARGS__)
+#define _GMP_LOOP_19(call, ...) call(__VA_ARGS__) _GMP_LOOP_18(call, __VA_ARGS__)
+#define _GMP_LOOP_20(call, ...) call(__VA_ARGS__) _GMP_LOOP_19(call, __VA_ARGS__)
+#define _GMP_LOOP_21(call, ...) call(__VA_ARGS__) _GMP_LOOP_20(call, __VA_ARGS__)
+#define _GMP_LOOP_22(call, ...) call(__VA_ARGS__) _GMP_LOOP_21(call, __VA_ARGS__)
+#define _GMP_LOOP_23(call, ...) call(__VA_ARGS__) _GMP_LOOP_22(call, __VA_ARGS__)
+#define _GMP_LOOP_24(call, ...) call(__VA_ARGS__) _GMP_LOOP_23(call, __VA_ARGS__)
+#define _GMP_LOOP_25(call, ...) call(__VA_ARGS__) _GMP_LOOP_24(call, __VA_ARGS__)
+#define _GMP_LOOP_26(call, ...) call(__VA_ARGS__) _GMP_LOOP_25(call, __VA_ARGS__)
+#define _GMP_LOOP_27(call, ...) call(__VA_ARGS__) _GMP_LOOP_26(call, __VA_ARGS__)
+#define _GMP_LOOP_28(call, ...) call(__VA_ARGS__) _GMP_LOOP_27(call, __VA_ARGS__)
+#define _GMP_LOOP_29(call, ...) call(__VA_ARGS__) _GMP_LOOP_28(call, __VA_ARGS__)
+#define _GMP_LOOP_30(call, ...) call(__VA_ARGS__) _GMP_LOOP_29(call, __VA_ARGS__)
+#define _GMP_LOOP_31(call, ...) call(__VA_ARGS__) _GMP_LOOP_30(call, __VA_ARGS__)
+#define _GMP_LOOP_32(call, ...) call(__VA_ARGS__) _GMP_LOOP_31(call, __VA_ARGS__)
+#define _GMP_LOOP_33(call, ...) call(__VA_ARGS__) _GMP_LOOP_32(call, __VA_ARGS__)
+#define _GMP_LOOP_34(call, ...) call(__VA_ARGS__) _GMP_LOOP_33(call, __VA_ARGS__)
+#define _GMP_LOOP_35(call, ...) call(__VA_ARGS__) _GMP_LOOP_34(call, __VA_ARGS__)
+#define _GMP_LOOP_36(call, ...) call(__VA_ARGS__) _GMP_LOOP_35(call, __VA_ARGS__)
+#define _GMP_LOOP_37(call, ...) call(__VA_ARGS__) _GMP_LOOP_36(call, __VA_ARGS__)
+#define _GMP_LOOP_38(call, ...) call(__VA_ARGS__) _GMP_LOOP_37(call, __VA_ARGS__)
+#define _GMP_LOOP_39(call, ...) call(__VA_ARGS__) _GMP_LOOP_38(call, __VA_ARGS__)
+#define _GMP_LOOP_40(call, ...) call(__VA_ARGS__) _GMP_LOOP_39(call, __VA_ARGS__)
+#define _GMP_LOOP_41(call, ...) call(__VA_ARGS__) _GMP_LOOP_40(call, __VA_ARGS__)
+#define _GMP_LOOP_42(call, ...) call(__VA_ARGS__) _GMP_LOOP_41(call, __VA_ARGS__)
+#define _GMP_LOOP_43(call, ...) call(__VA_ARGS__) _GMP_LOOP_42(call, __VA_ARGS__)
+#define _GMP_LOOP_44(call, ...) call(__VA_ARGS__) _GMP_LOOP_43(call, __VA_ARGS__)
+#define _GMP_LOOP_45(call, ...) call(__VA_ARGS__) _GMP_LOOP_44(call, __VA_ARGS__)
+#define _GMP_LOOP_46(call, ...) call(__VA_ARGS__) _GMP_LOOP_45(call, __VA_ARGS__)
+#define _GMP_LOOP_47(call, ...) call(__VA_ARGS__) _GMP_LOOP_46(call, __VA_ARGS__)
+#define _GMP_LOOP_48(call, ...) call(__VA_ARGS__) _GMP_LOOP_47(call, __VA_ARGS__)
+#define _GMP_LOOP_49(call, ...) call(__VA_ARGS__) _GMP_LOOP_48(call, __VA_ARGS__)
+#define _GMP_LOOP_50(call, ...) call(__VA_ARGS__) _GMP_LOOP_49(call, __VA_ARGS__)
+#define _GMP_LOOP_51(call, ...) call(__VA_ARGS__) _GMP_LOOP_50(call, __VA_ARGS__)
+#define _GMP_LOOP_52(call, ...) call(__VA_ARGS__) _GMP_LOOP_51(call, __VA_ARGS__)
+#define _GMP_LOOP_53(call, ...) call(__VA_ARGS__) _GMP_LOOP_52(call, __VA_ARGS__)
+#define _GMP_LOOP_54(call, ...) call(__VA_ARGS__) _GMP_LOOP_53(call, __VA_ARGS__)
+#define _GMP_LOOP_55(call, ...) call(__VA_ARGS__) _GMP_LOOP_54(call, __VA_ARGS__)
+#define _GMP_LOOP_56(call, ...) call(__VA_ARGS__) _GMP_LOOP_55(call, __VA_ARGS__)
+#define _GMP_LOOP_57(call, ...) call(__VA_ARGS__) _GMP_LOOP_56(call, __VA_ARGS__)
+#define _GMP_LOOP_58(call, ...) call(__VA_ARGS__) _GMP_LOOP_57(call, __VA_ARGS__)
+#define _GMP_LOOP_59(call, ...) call(__VA_ARGS__) _GMP_LOOP_58(call, __VA_ARGS__)
+#define _GMP_LOOP_60(call, ...) call(__VA_ARGS__) _GMP_LOOP_59(call, __VA_ARGS__)
+#define _GMP_LOOP_61(call, ...) call(__VA_ARGS__) _GMP_LOOP_60(call, __VA_ARGS__)
+#define _GMP_LOOP_62(call, ...) call(__VA_ARGS__) _GMP_LOOP_61(call, __VA_ARGS__)
+#define _GMP_LOOP_63(call, ...) call(__VA_ARGS__) _GMP_LOOP_62(call, __VA_ARGS__)
+#define _GMP_LOOP_64(call, ...) call(__VA_ARGS__) _GMP_LOOP_63(call, __VA_ARGS__)
+#define _GMP_LOOP_65(call, ...) call(__VA_ARGS__) _GMP_LOOP_64(call, __VA_ARGS__)
+#define _GMP_LOOP_66(call, ...) call(__VA_ARGS__) _GMP_LOOP_65(call, __VA_ARGS__)
+#define _GMP_LOOP_67(call, ...) call(__VA_ARGS__) _GMP_LOOP_66(call, __VA_ARGS__)
+#define _GMP_LOOP_68(call, ...) call(__VA_ARGS__) _GMP_LOOP_67(call, __VA_ARGS__)
+#define _GMP_LOOP_69(call, ...) call(__VA_ARGS__) _GMP_LOOP_68(call, __VA_ARGS__)
+#define _GMP_LOOP_70(call, ...) call(__VA_ARGS__) _GMP_LOOP_69(call, __VA_ARGS__)
+#define _GMP_LOOP_71(call, ...) call(__VA_ARGS__) _GMP_LOOP_70(call, __VA_ARGS__)
+#define _GMP_LOOP_72(call, ...) call(__VA_ARGS__) _GMP_LOOP_71(call, __VA_ARGS__)
+#define _GMP_LOOP_73(call, ...) call(__VA_ARGS__) _GMP_LOOP_72(call, __VA_ARGS__)
+#define _GMP_LOOP_74(call, ...) call(__VA_ARGS__) _GMP_LOOP_73(call, __VA_ARGS__)
+#define _GMP_LOOP_75(call, ...) call(__VA_ARGS__) _GMP_LOOP_74(call, __VA_ARGS__)
+#define _GMP_LOOP_76(call, ...) call(__VA_ARGS__) _GMP_LOOP_75(call, __VA_ARGS__)
+#define _GMP_LOOP_77(call, ...) call(__VA_ARGS__) _GMP_LOOP_76(call, __VA_ARGS__)
+#define _GMP_LOOP_78(call, ...) call(__VA_ARGS__) _GMP_LOOP_77(call, __VA_ARGS__)
+#define _GMP_LOOP_79(call, ...) call(__VA_ARGS__) _GMP_LOOP_78(call, __VA_ARGS__)
+#define _GMP_LOOP_80(call, ...) call(__VA_ARGS__) _GMP_LOOP_79(call, __VA_ARGS__)
+#define _GMP_LOOP_81(call, ...) call(__VA_ARGS__) _GMP_LOOP_80(call, __VA_ARGS__)
+#define _GMP_LOOP_82(call, ...) call(__VA_ARGS__) _GMP_LOOP_81(call, __VA_ARGS__)
+#define _GMP_LOOP_83(call, ...) call(__VA_ARGS__) _GMP_LOOP_82(call, __VA_ARGS__)
+#define _GMP_LOOP_84(call, ...) call(__VA_ARGS__) _GMP_LOOP_83(call, __VA_ARGS__)
+#define _GMP_LOOP_85(call, ...) call(__VA_ARGS__) _GMP_LOOP_84(call, __VA_ARGS__)
+#define _GMP_LOOP_86(call, ...) call(__VA_ARGS__) _GMP_LOOP_85(call, __VA_ARGS__)
+#define _GMP_LOOP_87(call, ...) call(__VA_ARGS__) _GMP_LOOP_86(call, __VA_ARGS__)
+#define _GMP_LOOP_88(call, ...) call(__VA_ARGS__) _GMP_LOOP_87(call, __VA_ARGS__)
+#define _GMP_LOOP_89(call, ...) call(__VA_ARGS__) _GMP_LOOP_88(call, __VA_ARGS__)
+#define _GMP_LOOP_90(call, ...) call(__VA_ARGS__) _GMP_LOOP_89(call, __VA_ARGS__)
+#define _GMP_LOOP_91(call, ...) call(__VA_ARGS__) _GMP_LOOP_90(call, __VA_ARGS__)
+#define _GMP_LOOP_92(call, ...) call(__VA_ARGS__) _GMP_LOOP_91(call, __VA_ARGS__)
+#define _GMP_LOOP_93(call, ...) call(__VA_ARGS__) _GMP_LOOP_92(call, __VA_ARGS__)
+#define _GMP_LOOP_94(call, ...) call(__VA_ARGS__) _GMP_LOOP_93(call, __VA_ARGS__)
+#define _GMP_LOOP_95(call, ...) call(__VA_ARGS__) _GMP_LOOP_94(call, __VA_ARGS__)
+#define _GMP_LOOP_96(call, ...) call(__VA_ARGS__) _GMP_LOOP_95(call, __VA_ARGS__)
+#define _GMP_LOOP_97(call, ...) call(__VA_ARGS__) _GMP_LOOP_96(call, __VA_ARGS__)
+#define _GMP_LOOP_98(call, ...) call(__VA_ARGS__) _GMP_LOOP_97(call, __VA_ARGS__)
+#define _GMP_LOOP_99(call, ...) call(__VA_ARGS__) _GMP_LOOP_98(call, __VA_ARGS__)
+#define _GMP_LOOP_100(call, ...) call(__VA_ARGS__) _GMP_LOOP_99(call, __VA_ARGS__)
+#define _GMP_LOOP_101(call, ...) call(__VA_ARGS__) _GMP_LOOP_100(call, __VA_ARGS__)
+#define _GMP_LOOP_102(call, ...) call(__VA_ARGS__) _GMP_LOOP_101(call, __VA_ARGS__)
+#define _GMP_LOOP_103(call, ...) call(__VA_ARGS__) _GMP_LOOP_102(call, __VA_ARGS__)
+#define _GMP_LOOP_104(call, ...) call(__VA_ARGS__) _GMP_LOOP_103(call, __VA_ARGS__)
+#define _GMP_LOOP_105(call, ...) call(__VA_ARGS__) _GMP_LOOP_104(call, __VA_ARGS__)
+#define _GMP_LOOP_106(call, ...) call(__VA_ARGS__) _GMP_LOOP_105(call, __VA_ARGS__)
+#define _GMP_LOOP_107(call, ...) call(__VA_ARGS__) _GMP_LOOP_106(call, __VA_ARGS__)
+#define _GMP_LOOP_108(call, ...) call(__VA_ARGS__) _GMP_LOOP_107(call, __VA_ARGS__)
+#define _GMP_LOOP_109(call, ...) call(__VA_ARGS__) _GMP_LOOP_108(call, __VA_ARGS__)
+#define _GMP_LOOP_110(call, ...) call(__VA_ARGS__) _GMP_LOOP_109(call, __VA_ARGS__)
+#define _GMP_LOOP_111(call, ...) call(__VA_ARGS__) _GMP_LOOP_110(call, __VA_ARGS__)
+#define _GMP_LOOP_112(call, ...) call(__VA_ARGS__) _GMP_LOOP_111(call, __VA_ARGS__)
+#define _GMP_LOOP_113(call, ...) call(__VA_ARGS__) _GMP_LOOP_112(call, __VA_ARGS__)
+#define _GMP_LOOP_114(call, ...) call(__VA_ARGS__) _GMP_LOOP_113(call, __VA_ARGS__)
+#define _GMP_LOOP_115(call, ...) call(__VA_ARGS__) _GMP_LOOP_114(call, __VA_ARGS__)
+#define _GMP_LOOP_116(call, ...) call(__VA_ARGS__) _GMP_LOOP_115(call, __VA_ARGS__)
+#define _GMP_LOOP_117(call, ...) call(__VA_ARGS__) _GMP_LOOP_116(call, __VA_ARGS__)
+#define _GMP_LOOP_118(call, ...) call(__VA_ARGS__) _GMP_LOOP_117(call, __VA_ARGS__)
+#define _GMP_LOOP_119(call, ...) call(__VA_ARGS__) _GMP_LOOP_118(call, __VA_ARGS__)
+#define _GMP_LOOP_120(call, ...) call(__VA_ARGS__) _GMP_LOOP_119(call, __VA_ARGS__)
+#define _GMP_LOOP_121(call, ...) call(__VA_ARGS__) _GMP_LOOP_120(call, __VA_ARGS__)
+#define _GMP_LOOP_122(call, ...) call(__VA_ARGS__) _GMP_LOOP_121(call, __VA_ARGS__)
+#define _GMP_LOOP_123(call, ...) call(__VA_ARGS__) _GMP_LOOP_122(call, __VA_ARGS__)
+#define _GMP_LOOP_124(call, ...) call(__VA_ARGS__) _GMP_LOOP_123(call, __VA_ARGS__)
+#define _GMP_LOOP_125(call, ...) call(__VA_ARGS__) _GMP_LOOP_124(call, __VA_ARGS__)
+#define _GMP_LOOP_126(call, ...) call(__VA_ARGS__) _GMP_LOOP_125(call, __VA_ARGS__)
+#define _GMP_LOOP_127(call, ...) call(__VA_ARGS__) _GMP_LOOP_126(call, __VA_ARGS__)
+#define _GMP_LOOP_128(call, ...) call(__VA_ARGS__) _GMP_LOOP_127(call, __VA_ARGS__)
+#define _GMP_LOOP_129(call, ...) call(__VA_ARGS__) _GMP_LOOP_128(call, __VA_ARGS__)
+#define _GMP_LOOP_130(call, ...) call(__VA_ARGS__) _GMP_LOOP_129(call, __VA_ARGS__)
+#define _GMP_LOOP_131(call, ...) call(__VA_ARGS__) _GMP_LOOP_130(call, __VA_ARGS__)
+#define _GMP_LOOP_132(call, ...) call(__VA_ARGS__) _GMP_LOOP_131(call, __VA_ARGS__)
+#define _GMP_LOOP_133(call, ...) call(__VA_ARGS__) _GMP_LOOP_132(call, __VA_ARGS__)
+#define _GMP_LOOP_134(call, ...) call(__VA_ARGS__) _GMP_LOOP_133(call, __VA_ARGS__)
+#define _GMP_LOOP_135(call, ...) call(__VA_ARGS__) _GMP_LOOP_134(call, __VA_ARGS__)
+#define _GMP_LOOP_136(call, ...) call(__VA_ARGS__) _GMP_LOOP_135(call, __VA_ARGS__)
+#define _GMP_LOOP_137(call, ...) call(__VA_ARGS__) _GMP_LOOP_136(call, __VA_ARGS__)
+#define _GMP_LOOP_138(call, ...) call(__VA_ARGS__) _GMP_LOOP_137(call, __VA_ARGS__)
+#define _GMP_LOOP_139(call, ...) call(__VA_ARGS__) _GMP_LOOP_138(call, __VA_ARGS__)
+#define _GMP_LOOP_140(call, ...) call(__VA_ARGS__) _GMP_LOOP_139(call, __VA_ARGS__)
+#define _GMP_LOOP_141(call, ...) call(__VA_ARGS__) _GMP_LOOP_140(call, __VA_ARGS__)
+#define _GMP_LOOP_142(call, ...) call(__VA_ARGS__) _GMP_LOOP_141(call, __VA_ARGS__)
+#define _GMP_LOOP_143(call, ...) call(__VA_ARGS__) _GMP_LOOP_142(call, __VA_ARGS__)
+#define _GMP_LOOP_144(call, ...) call(__VA_ARGS__) _GMP_LOOP_143(call, __VA_ARGS__)
+#define _GMP_LOOP_145(call, ...) call(__VA_ARGS__) _GMP_LOOP_144(call, __VA_ARGS__)
+#define _GMP_LOOP_146(call, ...) call(__VA_ARGS__) _GMP_LOOP_145(call, __VA_ARGS__)
+#define _GMP_LOOP_147(call, ...) call(__VA_ARGS__) _GMP_LOOP_146(call, __VA_ARGS__)
+#define _GMP_LOOP_148(call, ...) call(__VA_ARGS__) _GMP_LOOP_147(call, __VA_ARGS__)
+#define _GMP_LOOP_149(call, ...) call(__VA_ARGS__) _GMP_LOOP_148(call, __VA_ARGS__)
+#define _GMP_LOOP_150(call, ...) call(__VA_ARGS__) _GMP_LOOP_149(call, __VA_ARGS__)
+#define _GMP_LOOP_151(call, ...) call(__VA_ARGS__) _GMP_LOOP_150(call, __VA_ARGS__)
+#define _GMP_LOOP_152(call, ...) call(__VA_ARGS__) _GMP_LOOP_151(call, __VA_ARGS__)
+#define _GMP_LOOP_153(call, ...) call(__VA_ARGS__) _GMP_LOOP_152(call, __VA_ARGS__)
+#define _GMP_LOOP_154(call, ...) call(__VA_ARGS__) _GMP_LOOP_153(call, __VA_ARGS__)
+#define _GMP_LOOP_155(call, ...) call(__VA_ARGS__) _GMP_LOOP_154(call, __VA_ARGS__)
+#define _GMP_LOOP_156(call, ...) call(__VA_ARGS__) _GMP_LOOP_155(call, __VA_ARGS__)
+#define _GMP_LOOP_157(call, ...) call(__VA_ARGS__) _GMP_LOOP_156(call, __VA_ARGS__)
+#define _GMP_LOOP_158(call, ...) call(__VA_ARGS__) _GMP_LOOP_157(call, __VA_ARGS__)
+#define _GMP_LOOP_159(call, ...) call(__VA_ARGS__) _GMP_LOOP_158(call, __VA_ARGS__)
+#define _GMP_LOOP_160(call, ...) call(__VA_ARGS__) _GMP_LOOP_159(call, __VA_ARGS__)
+#define _GMP_LOOP_161(call, ...) call(__VA_ARGS__) _GMP_LOOP_160(call, __VA_ARGS__)
+#define _GMP_LOOP_162(call, ...) call(__VA_ARGS__) _GMP_LOOP_161(call, __VA_ARGS__)
+#define _GMP_LOOP_163(call, ...) call(__VA_ARGS__) _GMP_LOOP_162(call, __VA_ARGS__)
+#define _GMP_LOOP_164(call, ...) call(__VA_ARGS__) _GMP_LOOP_163(call, __VA_ARGS__)
+#define _GMP_LOOP_165(call, ...) call(__VA_ARGS__) _GMP_LOOP_164(call, __VA_ARGS__)
+#define _GMP_LOOP_166(call, ...) call(__VA_ARGS__) _GMP_LOOP_165(call, __VA_ARGS__)
+#define _GMP_LOOP_167(call, ...) call(__VA_ARGS__) _GMP_LOOP_166(call, __VA_ARGS__)
+#define _GMP_LOOP_168(call, ...) call(__VA_ARGS__) _GMP_LOOP_167(call, __VA_ARGS__)
+#define _GMP_LOOP_169(call, ...) call(__VA_ARGS__) _GMP_LOOP_168(call, __VA_ARGS__)
+#define _GMP_LOOP_170(call, ...) call(__VA_ARGS__) _GMP_LOOP_169(call, __VA_ARGS__)
+#define _GMP_LOOP_171(call, ...) call(__VA_ARGS__) _GMP_LOOP_170(call, __VA_ARGS__)
+#define _GMP_LOOP_172(call, ...) call(__VA_ARGS__) _GMP_LOOP_171(call, __VA_ARGS__)
+#define _GMP_LOOP_173(call, ...) call(__VA_ARGS__) _GMP_LOOP_172(call, __VA_ARGS__)
+#define _GMP_LOOP_174(call, ...) call(__VA_ARGS__) _GMP_LOOP_173(call, __VA_ARGS__)
+#define _GMP_LOOP_175(call, ...) call(__VA_ARGS__) _GMP_LOOP_174(call, __VA_ARGS__)
+#define _GMP_LOOP_176(call, ...) call(__VA_ARGS__) _GMP_LOOP_175(call, __VA_ARGS__)
+#define _GMP_LOOP_177(call, ...) call(__VA_ARGS__) _GMP_LOOP_176(call, __VA_ARGS__)
+#define _GMP_LOOP_178(call, ...) call(__VA_ARGS__) _GMP_LOOP_177(call, __VA_ARGS__)
+#define _GMP_LOOP_179(call, ...) call(__VA_ARGS__) _GMP_LOOP_178(call, __VA_ARGS__)
+#define _GMP_LOOP_180(call, ...) call(__VA_ARGS__) _GMP_LOOP_179(call, __VA_ARGS__)
+#define _GMP_LOOP_181(call, ...) call(__VA_ARGS__) _GMP_LOOP_180(call, __VA_ARGS__)
+#define _GMP_LOOP_182(call, ...) call(__VA_ARGS__) _GMP_LOOP_181(call, __VA_ARGS__)
+#define _GMP_LOOP_183(call, ...) call(__VA_ARGS__) _GMP_LOOP_182(call, __VA_ARGS__)
+#define _GMP_LOOP_184(call, ...) call(__VA_ARGS__) _GMP_LOOP_183(call, __VA_ARGS__)
+#define _GMP_LOOP_185(call, ...) call(__VA_ARGS__) _GMP_LOOP_184(call, __VA_ARGS__)
+#define _GMP_LOOP_186(call, ...) call(__VA_ARGS__) _GMP_LOOP_185(call, __VA_ARGS__)
+#define _GMP_LOOP_187(call, ...) call(__VA_ARGS__) _GMP_LOOP_186(call, __VA_ARGS__)
+#define _GMP_LOOP_188(call, ...) call(__VA_ARGS__) _GMP_LOOP_187(call, __VA_ARGS__)
+#define _GMP_LOOP_189(call, ...) call(__VA_ARGS__) _GMP_LOOP_188(call, __VA_ARGS__)
+#define _GMP_LOOP_190(call, ...) call(__VA_ARGS__) _GMP_LOOP_189(call, __VA_ARGS__)
+#define _GMP_LOOP_191(call, ...) call(__VA_ARGS__) _GMP_LOOP_190(call, __VA_ARGS__)
+#define _GMP_LOOP_192(call, ...) call(__VA_ARGS__) _GMP_LOOP_191(call, __VA_ARGS__)
+#define _GMP_LOOP_193(call, ...) call(__VA_ARGS__) _GMP_LOOP_192(call, __VA_ARGS__)
+#define _GMP_LOOP_194(call, ...) call(__VA_ARGS__) _GMP_LOOP_193(call, __VA_ARGS__)
+#define _GMP_LOOP_195(call, ...) call(__VA_ARGS__) _GMP_LOOP_194(call, __VA_ARGS__)
+#define _GMP_LOOP_196(call, ...) call(__VA_ARGS__) _GMP_LOOP_195(call, __VA_ARGS__)
+#define _GMP_LOOP_197(call, ...) call(__VA_ARGS__) _GMP_LOOP_196(call, __VA_ARGS__)
+#define _GMP_LOOP_198(call, ...) call(__VA_ARGS__) _GMP_LOOP_197(call, __VA_ARGS__)
+#define _GMP_LOOP_199(call, ...) call(__VA_ARGS__) _GMP_LOOP_198(call, __VA_ARGS__)
+#define _GMP_LOOP_200(call, ...) call(__VA_ARGS__) _GMP_LOOP_199(call, __VA_ARGS__)
+#define _GMP_LOOP_201(call, ...) call(__VA_ARGS__) _GMP_LOOP_200(call, __VA_ARGS__)
+#define _GMP_LOOP_202(call, ...) call(__VA_ARGS__) _GMP_LOOP_201(call, __VA_ARGS__)
+#define _GMP_LOOP_203(call, ...) call(__VA_ARGS__) _GMP_LOOP_202(call, __VA_ARGS__)
+#define _GMP_LOOP_204(call, ...) call(__VA_ARGS__) _GMP_LOOP_203(call, __VA_ARGS__)
+#define _GMP_LOOP_205(call, ...) call(__VA_ARGS__) _GMP_LOOP_204(call, __VA_ARGS__)
+#define _GMP_LOOP_206(call, ...) call(__VA_ARGS__) _GMP_LOOP_205(call, __VA_ARGS__)
+#define _GMP_LOOP_207(call, ...) call(__VA_ARGS__) _GMP_LOOP_206(call, __VA_ARGS__)
+#define _GMP_LOOP_208(call, ...) call(__VA_ARGS__) _GMP_LOOP_207(call, __VA_ARGS__)
+#define _GMP_LOOP_209(call, ...) call(__VA_ARGS__) _GMP_LOOP_208(call, __VA_ARGS__)
+#define _GMP_LOOP_210(call, ...) call(__VA_ARGS__) _GMP_LOOP_209(call, __VA_ARGS__)
+#define _GMP_LOOP_211(call, ...) call(__VA_ARGS__) _GMP_LOOP_210(call, __VA_ARGS__)
+#define _GMP_LOOP_212(call, ...) call(__VA_ARGS__) _GMP_LOOP_211(call, __VA_ARGS__)
+#define _GMP_LOOP_213(call, ...) call(__VA_ARGS__) _GMP_LOOP_212(call, __VA_ARGS__)
+#define _GMP_LOOP_214(call, ...) call(__VA_ARGS__) _GMP_LOOP_213(call, __VA_ARGS__)
+#define _GMP_LOOP_215(call, ...) call(__VA_ARGS__) _GMP_LOOP_214(call, __VA_ARGS__)
+#define _GMP_LOOP_216(call, ...) call(__VA_ARGS__) _GMP_LOOP_215(call, __VA_ARGS__)
+#define _GMP_LOOP_217(call, ...) call(__VA_ARGS__) _GMP_LOOP_216(call, __VA_ARGS__)
+#define _GMP_LOOP_218(call, ...) call(__VA_ARGS__) _GMP_LOOP_217(call, __VA_ARGS__)
+#define _GMP_LOOP_219(call, ...) call(__VA_ARGS__) _GMP_LOOP_218(call, __VA_ARGS__)
+#define _GMP_LOOP_220(call, ...) call(__VA_ARGS__) _GMP_LOOP_219(call, __VA_ARGS__)
+#define _GMP_LOOP_221(call, ...) call(__VA_ARGS__) _GMP_LOOP_220(call, __VA_ARGS__)
+#define _GMP_LOOP_222(call, ...) call(__VA_ARGS__) _GMP_LOOP_221(call, __VA_ARGS__)
+#define _GMP_LOOP_223(call, ...) call(__VA_ARGS__) _GMP_LOOP_222(call, __VA_ARGS__)
+#define _GMP_LOOP_224(call, ...) call(__VA_ARGS__) _GMP_LOOP_223(call, __VA_ARGS__)
+#define _GMP_LOOP_225(call, ...) call(__VA_ARGS__) _GMP_LOOP_224(call, __VA_ARGS__)
+#define _GMP_LOOP_226(call, ...) call(__VA_ARGS__) _GMP_LOOP_225(call, __VA_ARGS__)
+#define _GMP_LOOP_227(call, ...) call(__VA_ARGS__) _GMP_LOOP_226(call, __VA_ARGS__)
+#define _GMP_LOOP_228(call, ...) call(__VA_ARGS__) _GMP_LOOP_227(call, __VA_ARGS__)
+#define _GMP_LOOP_229(call, ...) call(__VA_ARGS__) _GMP_LOOP_228(call, __VA_ARGS__)
+#define _GMP_LOOP_230(call, ...) call(__VA_ARGS__) _GMP_LOOP_229(call, __VA_ARGS__)
+#define _GMP_LOOP_231(call, ...) call(__VA_ARGS__) _GMP_LOOP_230(call, __VA_ARGS__)
+#define _GMP_LOOP_232(call, ...) call(__VA_ARGS__) _GMP_LOOP_231(call, __VA_ARGS__)
+#define _GMP_LOOP_233(call, ...) call(__VA_ARGS__) _GMP_LOOP_232(call, __VA_ARGS__)
+#define _GMP_LOOP_234(call, ...) call(__VA_ARGS__) _GMP_LOOP_233(call, __VA_ARGS__)
+#define _GMP_LOOP_235(call, ...) call(__VA_ARGS__) _GMP_LOOP_234(call, __VA_ARGS__)
+#define _GMP_LOOP_236(call, ...) call(__VA_ARGS__) _GMP_LOOP_235(call, __VA_ARGS__)
+#define _GMP_LOOP_237(call, ...) call(__VA_ARGS__) _GMP_LOOP_236(call, __VA_ARGS__)
+#define _GMP_LOOP_238(call, ...) call(__VA_ARGS__) _GMP_LOOP_237(call, __VA_ARGS__)
+#define _GMP_LOOP_239(call, ...) call(__VA_ARGS__) _GMP_LOOP_238(call, __VA_ARGS__)
+#define _GMP_LOOP_240(call, ...) call(__VA_ARGS__) _GMP_LOOP_239(call, __VA_ARGS__)
+#define _GMP_LOOP_241(call, ...) call(__VA_ARGS__) _GMP_LOOP_240(call, __VA_ARGS__)
+#define _GMP_LOOP_242(call, ...) call(__VA_ARGS__) _GMP_LOOP_241(call, __VA_ARGS__)
+#define _GMP_LOOP_243(call, ...) call(__VA_ARGS__) _GMP_LOOP_242(call, __VA_ARGS__)
+#define _GMP_LOOP_244(call, ...) call(__VA_ARGS__) _GMP_LOOP_243(call, __VA_ARGS__)
+#define _GMP_LOOP_245(call, ...) call(__VA_ARGS__) _GMP_LOOP_244(call, __VA_ARGS__)
+#define _GMP_LOOP_246(call, ...) call(__VA_ARGS__) _GMP_LOOP_245(call, __VA_ARGS__)
+#define _GMP_LOOP_247(call, ...) call(__VA_ARGS__) _GMP_LOOP_246(call, __VA_ARGS__)
+#define _GMP_LOOP_248(call, ...) call(__VA_ARGS__) _GMP_LOOP_247(call, __VA_ARGS__)
+#define _GMP_LOOP_249(call, ...) call(__VA_ARGS__) _GMP_LOOP_248(call, __VA_ARGS__)
+#define _GMP_LOOP_250(call, ...) call(__VA_ARGS__) _GMP_LOOP_249(call, __VA_ARGS__)
+#define _GMP_LOOP_251(call, ...) call(__VA_ARGS__) _GMP_LOOP_250(call, __VA_ARGS__)
+#define _GMP_LOOP_252(call, ...) call(__VA_ARGS__) _GMP_LOOP_251(call, __VA_ARGS__)
+#define _GMP_LOOP_253(call, ...) call(__VA_ARGS__) _GMP_LOOP_252(call, __VA_ARGS__)
+#define _GMP_LOOP_254(call, ...) call(__VA_ARGS__) _GMP_LOOP_253(call, __VA_ARGS__)
+
+#endif // GMP_MACRO_LIMITS_LOOP_254_HPP_
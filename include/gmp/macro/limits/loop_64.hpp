@@ -0,0 +1,273 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_LOOP_64_HPP_
+#define GMP_MACRO_LIMITS_LOOP_64_HPP_
+
+// GMP_EVAL_BOUNDED
+#define _GMP_EVAL_BOUNDED_0 GMP_EVAL_5
+#define _GMP_EVAL_BOUNDED_1 GMP_EVAL_5
+#define _GMP_EVAL_BOUNDED_2 GMP_EVAL_5
+#define _GMP_EVAL_BOUNDED_3 GMP_EVAL_4
+#define _GMP_EVAL_BOUNDED_4 GMP_EVAL_4
+#define _GMP_EVAL_BOUNDED_5 GMP_EVAL_4
+#define _GMP_EVAL_BOUNDED_6 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_7 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_8 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_9 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_10 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_11 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_12 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_13 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_14 GMP_EVAL_3
+#define _GMP_EVAL_BOUNDED_15 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_16 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_17 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_18 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_19 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_20 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_21 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_22 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_23 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_24 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_25 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_26 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_27 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_28 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_29 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_30 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_31 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_32 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_33 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_34 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_35 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_36 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_37 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_38 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_39 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_40 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_41 GMP_EVAL_2
+#define _GMP_EVAL_BOUNDED_42 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_43 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_44 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_45 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_46 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_47 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_48 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_49 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_50 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_51 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_52 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_53 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_54 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_55 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_56 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_57 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_58 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_59 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_60 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_61 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_62 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_63 GMP_EVAL_1
+#define _GMP_EVAL_BOUNDED_64 GMP_EVAL_1
+
+// GMP_MAKE_INDEX_SEQUENCE
+#define _GMP_MAKE_INDEX_SEQUENCE_0() 0
+#define _GMP_MAKE_INDEX_SEQUENCE_1() _GMP_MAKE_INDEX_SEQUENCE_0(), 1
+#define _GMP_MAKE_INDEX_SEQUENCE_2() _GMP_MAKE_INDEX_SEQUENCE_1(), 2
+#define _GMP_MAKE_INDEX_SEQUENCE_3() _GMP_MAKE_INDEX_SEQUENCE_2(), 3
+#define _GMP_MAKE_INDEX_SEQUENCE_4() _GMP_MAKE_INDEX_SEQUENCE_3(), 4
+#define _GMP_MAKE_INDEX_SEQUENCE_5() _GMP_MAKE_INDEX_SEQUENCE_4(), 5
+#define _GMP_MAKE_INDEX_SEQUENCE_6() _GMP_MAKE_INDEX_SEQUENCE_5(), 6
+#define _GMP_MAKE_INDEX_SEQUENCE_7() _GMP_MAKE_INDEX_SEQUENCE_6(), 7
+#define _GMP_MAKE_INDEX_SEQUENCE_8() _GMP_MAKE_INDEX_SEQUENCE_7(), 8
+#define _GMP_MAKE_INDEX_SEQUENCE_9() _GMP_MAKE_INDEX_SEQUENCE_8(), 9
+#define _GMP_MAKE_INDEX_SEQUENCE_10() _GMP_MAKE_INDEX_SEQUENCE_9(), 10
+#define _GMP_MAKE_INDEX_SEQUENCE_11() _GMP_MAKE_INDEX_SEQUENCE_10(), 11
+#define _GMP_MAKE_INDEX_SEQUENCE_12() _GMP_MAKE_INDEX_SEQUENCE_11(), 12
+#define _GMP_MAKE_INDEX_SEQUENCE_13() _GMP_MAKE_INDEX_SEQUENCE_12(), 13
+#define _GMP_MAKE_INDEX_SEQUENCE_14() _GMP_MAKE_INDEX_SEQUENCE_13(), 14
+#define _GMP_MAKE_INDEX_SEQUENCE_15() _GMP_MAKE_INDEX_SEQUENCE_14(), 15
+#define _GMP_MAKE_INDEX_SEQUENCE_16() _GMP_MAKE_INDEX_SEQUENCE_15(), 16
+#define _GMP_MAKE_INDEX_SEQUENCE_17() _GMP_MAKE_INDEX_SEQUENCE_16(), 17
+#define _GMP_MAKE_INDEX_SEQUENCE_18() _GMP_MAKE_INDEX_SEQUENCE_17(), 18
+#define _GMP_MAKE_INDEX_SEQUENCE_19() _GMP_MAKE_INDEX_SEQUENCE_18(), 19
+#define _GMP_MAKE_INDEX_SEQUENCE_20() _GMP_MAKE_INDEX_SEQUENCE_19(), 20
+#define _GMP_MAKE_INDEX_SEQUENCE_21() _GMP_MAKE_INDEX_SEQUENCE_20(), 21
+#define _GMP_MAKE_INDEX_SEQUENCE_22() _GMP_MAKE_INDEX_SEQUENCE_21(), 22
+#define _GMP_MAKE_INDEX_SEQUENCE_23() _GMP_MAKE_INDEX_SEQUENCE_22(), 23
+#define _GMP_MAKE_INDEX_SEQUENCE_24() _GMP_MAKE_INDEX_SEQUENCE_23(), 24
+#define _GMP_MAKE_INDEX_SEQUENCE_25() _GMP_MAKE_INDEX_SEQUENCE_24(), 25
+#define _GMP_MAKE_INDEX_SEQUENCE_26() _GMP_MAKE_INDEX_SEQUENCE_25(), 26
+#define _GMP_MAKE_INDEX_SEQUENCE_27() _GMP_MAKE_INDEX_SEQUENCE_26(), 27
+#define _GMP_MAKE_INDEX_SEQUENCE_28() _GMP_MAKE_INDEX_SEQUENCE_27(), 28
+#define _GMP_MAKE_INDEX_SEQUENCE_29() _GMP_MAKE_INDEX_SEQUENCE_28(), 29
+#define _GMP_MAKE_INDEX_SEQUENCE_30() _GMP_MAKE_INDEX_SEQUENCE_29(), 30
+#define _GMP_MAKE_INDEX_SEQUENCE_31() _GMP_MAKE_INDEX_SEQUENCE_30(), 31
+#define _GMP_MAKE_INDEX_SEQUENCE_32() _GMP_MAKE_INDEX_SEQUENCE_31(), 32
+#define _GMP_MAKE_INDEX_SEQUENCE_33() _GMP_MAKE_INDEX_SEQUENCE_32(), 33
+#define _GMP_MAKE_INDEX_SEQUENCE_34() _GMP_MAKE_INDEX_SEQUENCE_33(), 34
+#define _GMP_MAKE_INDEX_SEQUENCE_35() _GMP_MAKE_INDEX_SEQUENCE_34(), 35
+#define _GMP_MAKE_INDEX_SEQUENCE_36() _GMP_MAKE_INDEX_SEQUENCE_35(), 36
+#define _GMP_MAKE_INDEX_SEQUENCE_37() _GMP_MAKE_INDEX_SEQUENCE_36(), 37
+#define _GMP_MAKE_INDEX_SEQUENCE_38() _GMP_MAKE_INDEX_SEQUENCE_37(), 38
+#define _GMP_MAKE_INDEX_SEQUENCE_39() _GMP_MAKE_INDEX_SEQUENCE_38(), 39
+#define _GMP_MAKE_INDEX_SEQUENCE_40() _GMP_MAKE_INDEX_SEQUENCE_39(), 40
+#define _GMP_MAKE_INDEX_SEQUENCE_41() _GMP_MAKE_INDEX_SEQUENCE_40(), 41
+#define _GMP_MAKE_INDEX_SEQUENCE_42() _GMP_MAKE_INDEX_SEQUENCE_41(), 42
+#define _GMP_MAKE_INDEX_SEQUENCE_43() _GMP_MAKE_INDEX_SEQUENCE_42(), 43
+#define _GMP_MAKE_INDEX_SEQUENCE_44() _GMP_MAKE_INDEX_SEQUENCE_43(), 44
+#define _GMP_MAKE_INDEX_SEQUENCE_45() _GMP_MAKE_INDEX_SEQUENCE_44(), 45
+#define _GMP_MAKE_INDEX_SEQUENCE_46() _GMP_MAKE_INDEX_SEQUENCE_45(), 46
+#define _GMP_MAKE_INDEX_SEQUENCE_47() _GMP_MAKE_INDEX_SEQUENCE_46(), 47
+#define _GMP_MAKE_INDEX_SEQUENCE_48() _GMP_MAKE_INDEX_SEQUENCE_47(), 48
+#define _GMP_MAKE_INDEX_SEQUENCE_49() _GMP_MAKE_INDEX_SEQUENCE_48(), 49
+#define _GMP_MAKE_INDEX_SEQUENCE_50() _GMP_MAKE_INDEX_SEQUENCE_49(), 50
+#define _GMP_MAKE_INDEX_SEQUENCE_51() _GMP_MAKE_INDEX_SEQUENCE_50(), 51
+#define _GMP_MAKE_INDEX_SEQUENCE_52() _GMP_MAKE_INDEX_SEQUENCE_51(), 52
+#define _GMP_MAKE_INDEX_SEQUENCE_53() _GMP_MAKE_INDEX_SEQUENCE_52(), 53
+#define _GMP_MAKE_INDEX_SEQUENCE_54() _GMP_MAKE_INDEX_SEQUENCE_53(), 54
+#define _GMP_MAKE_INDEX_SEQUENCE_55() _GMP_MAKE_INDEX_SEQUENCE_54(), 55
+#define _GMP_MAKE_INDEX_SEQUENCE_56() _GMP_MAKE_INDEX_SEQUENCE_55(), 56
+#define _GMP_MAKE_INDEX_SEQUENCE_57() _GMP_MAKE_INDEX_SEQUENCE_56(), 57
+#define _GMP_MAKE_INDEX_SEQUENCE_58() _GMP_MAKE_INDEX_SEQUENCE_57(), 58
+#define _GMP_MAKE_INDEX_SEQUENCE_59() _GMP_MAKE_INDEX_SEQUENCE_58(), 59
+#define _GMP_MAKE_INDEX_SEQUENCE_60() _GMP_MAKE_INDEX_SEQUENCE_59(), 60
+#define _GMP_MAKE_INDEX_SEQUENCE_61() _GMP_MAKE_INDEX_SEQUENCE_60(), 61
+#define _GMP_MAKE_INDEX_SEQUENCE_62() _GMP_MAKE_INDEX_SEQUENCE_61(), 62
+#define _GMP_MAKE_INDEX_SEQUENCE_63() _GMP_MAKE_INDEX_SEQUENCE_62(), 63
+
+// GMP_RANGE
+#define _GMP_DROP_0(...) __VA_ARGS__
+#define _GMP_DROP_1(x, ...) _GMP_DROP_0(__VA_ARGS__)
+#define _GMP_DROP_2(x, ...) _GMP_DROP_1(__VA_ARGS__)
+#define _GMP_DROP_3(x, ...) _GMP_DROP_2(__VA_ARGS__)
+#define _GMP_DROP_4(x, ...) _GMP_DROP_3(__VA_ARGS__)
+#define _GMP_DROP_5(x, ...) _GMP_DROP_4(__VA_ARGS__)
+#define _GMP_DROP_6(x, ...) _GMP_DROP_5(__VA_ARGS__)
+#define _GMP_DROP_7(x, ...) _GMP_DROP_6(__VA_ARGS__)
+#define _GMP_DROP_8(x, ...) _GMP_DROP_7(__VA_ARGS__)
+#define _GMP_DROP_9(x, ...) _GMP_DROP_8(__VA_ARGS__)
+#define _GMP_DROP_10(x, ...) _GMP_DROP_9(__VA_ARGS__)
+#define _GMP_DROP_11(x, ...) _GMP_DROP_10(__VA_ARGS__)
+#define _GMP_DROP_12(x, ...) _GMP_DROP_11(__VA_ARGS__)
+#define _GMP_DROP_13(x, ...) _GMP_DROP_12(__VA_ARGS__)
+#define _GMP_DROP_14(x, ...) _GMP_DROP_13(__VA_ARGS__)
+#define _GMP_DROP_15(x, ...) _GMP_DROP_14(__VA_ARGS__)
+#define _GMP_DROP_16(x, ...) _GMP_DROP_15(__VA_ARGS__)
+#define _GMP_DROP_17(x, ...) _GMP_DROP_16(__VA_ARGS__)
+#define _GMP_DROP_18(x, ...) _GMP_DROP_17(__VA_ARGS__)
+#define _GMP_DROP_19(x, ...) _GMP_DROP_18(__VA_ARGS__)
+#define _GMP_DROP_20(x, ...) _GMP_DROP_19(__VA_ARGS__)
+#define _GMP_DROP_21(x, ...) _GMP_DROP_20(__VA_ARGS__)
+#define _GMP_DROP_22(x, ...) _GMP_DROP_21(__VA_ARGS__)
+#define _GMP_DROP_23(x, ...) _GMP_DROP_22(__VA_ARGS__)
+#define _GMP_DROP_24(x, ...) _GMP_DROP_23(__VA_ARGS__)
+#define _GMP_DROP_25(x, ...) _GMP_DROP_24(__VA_ARGS__)
+#define _GMP_DROP_26(x, ...) _GMP_DROP_25(__VA_ARGS__)
+#define _GMP_DROP_27(x, ...) _GMP_DROP_26(__VA_ARGS__)
+#define _GMP_DROP_28(x, ...) _GMP_DROP_27(__VA_ARGS__)
+#define _GMP_DROP_29(x, ...) _GMP_DROP_28(__VA_ARGS__)
+#define _GMP_DROP_30(x, ...) _GMP_DROP_29(__VA_ARGS__)
+#define _GMP_DROP_31(x, ...) _GMP_DROP_30(__VA_ARGS__)
+#define _GMP_DROP_32(x, ...) _GMP_DROP_31(__VA_ARGS__)
+#define _GMP_DROP_33(x, ...) _GMP_DROP_32(__VA_ARGS__)
+#define _GMP_DROP_34(x, ...) _GMP_DROP_33(__VA_ARGS__)
+#define _GMP_DROP_35(x, ...) _GMP_DROP_34(__VA_ARGS__)
+#define _GMP_DROP_36(x, ...) _GMP_DROP_35(__VA_ARGS__)
+#define _GMP_DROP_37(x, ...) _GMP_DROP_36(__VA_ARGS__)
+#define _GMP_DROP_38(x, ...) _GMP_DROP_37(__VA_ARGS__)
+#define _GMP_DROP_39(x, ...) _GMP_DROP_38(__VA_ARGS__)
+#define _GMP_DROP_40(x, ...) _GMP_DROP_39(__VA_ARGS__)
+#define _GMP_DROP_41(x, ...) _GMP_DROP_40(__VA_ARGS__)
+#define _GMP_DROP_42(x, ...) _GMP_DROP_41(__VA_ARGS__)
+#define _GMP_DROP_43(x, ...) _GMP_DROP_42(__VA_ARGS__)
+#define _GMP_DROP_44(x, ...) _GMP_DROP_43(__VA_ARGS__)
+#define _GMP_DROP_45(x, ...) _GMP_DROP_44(__VA_ARGS__)
+#define _GMP_DROP_46(x, ...) _GMP_DROP_45(__VA_ARGS__)
+#define _GMP_DROP_47(x, ...) _GMP_DROP_46(__VA_ARGS__)
+#define _GMP_DROP_48(x, ...) _GMP_DROP_47(__VA_ARGS__)
+#define _GMP_DROP_49(x, ...) _GMP_DROP_48(__VA_ARGS__)
+#define _GMP_DROP_50(x, ...) _GMP_DROP_49(__VA_ARGS__)
+#define _GMP_DROP_51(x, ...) _GMP_DROP_50(__VA_ARGS__)
+#define _GMP_DROP_52(x, ...) _GMP_DROP_51(__VA_ARGS__)
+#define _GMP_DROP_53(x, ...) _GMP_DROP_52(__VA_ARGS__)
+#define _GMP_DROP_54(x, ...) _GMP_DROP_53(__VA_ARGS__)
+#define _GMP_DROP_55(x, ...) _GMP_DROP_54(__VA_ARGS__)
+#define _GMP_DROP_56(x, ...) _GMP_DROP_55(__VA_ARGS__)
+#define _GMP_DROP_57(x, ...) _GMP_DROP_56(__VA_ARGS__)
+#define _GMP_DROP_58(x, ...) _GMP_DROP_57(__VA_ARGS__)
+#define _GMP_DROP_59(x, ...) _GMP_DROP_58(__VA_ARGS__)
+#define _GMP_DROP_60(x, ...) _GMP_DROP_59(__VA_ARGS__)
+#define _GMP_DROP_61(x, ...) _GMP_DROP_60(__VA_ARGS__)
+#define _GMP_DROP_62(x, ...) _GMP_DROP_61(__VA_ARGS__)
+#define _GMP_DROP_63(x, ...) _GMP_DROP_62(__VA_ARGS__)
+#define _GMP_DROP_64(x, ...) _GMP_DROP_63(__VA_ARGS__)
+
+// GMP_LOOP
+#define _GMP_LOOP_0(call, ...)
+#define _GMP_LOOP_1(call, ...) call(__VA_ARGS__) _GMP_LOOP_0(call, __VA_ARGS__)
+#define _GMP_LOOP_2(call, ...) call(__VA_ARGS__) _GMP_LOOP_1(call, __VA_ARGS__)
+#define _GMP_LOOP_3(call, ...) call(__VA_ARGS__) _GMP_LOOP_2(call, __VA_ARGS__)
+#define _GMP_LOOP_4(call, ...) call(__VA_ARGS__) _GMP_LOOP_3(call, __VA_ARGS__)
+#define _GMP_LOOP_5(call, ...) call(__VA_ARGS__) _GMP_LOOP_4(call, __VA_ARGS__)
+#define _GMP_LOOP_6(call, ...) call(__VA_ARGS__) _GMP_LOOP_5(call, __VA_ARGS__)
+#define _GMP_LOOP_7(call, ...) call(__VA_ARGS__) _GMP_LOOP_6(call, __VA_ARGS__)
+#define _GMP_LOOP_8(call, ...) call(__VA_ARGS__) _GMP_LOOP_7(call, __VA_ARGS__)
+#define _GMP_LOOP_9(call, ...) call(__VA_ARGS__) _GMP_LOOP_8(call, __VA_ARGS__)
+#define _GMP_LOOP_10(call, ...) call(__VA_ARGS__) _GMP_LOOP_9(call, __VA_ARGS__)
+#define _GMP_LOOP_11(call, ...) call(__VA_ARGS__) _GMP_LOOP_10(call, __VA_ARGS__)
+#define _GMP_LOOP_12(call, ...) call(__VA_ARGS__) _GMP_LOOP_11(call, __VA_ARGS__)
+#define _GMP_LOOP_13(call, ...) call(__VA_ARGS__) _GMP_LOOP_12(call, __VA_ARGS__)
+#define _GMP_LOOP_14(call, ...) call(__VA_ARGS__) _GMP_LOOP_13(call, __VA_ARGS__)
+#define _GMP_LOOP_15(call, ...) call(__VA_ARGS__) _GMP_LOOP_14(call, __VA_ARGS__)
+#define _GMP_LOOP_16(call, ...) call(__VA_ARGS__) _GMP_LOOP_15(call, __VA_ARGS__)
+#define _GMP_LOOP_17(call, ...) call(__VA_ARGS__) _GMP_LOOP_16(call, __VA_ARGS__)
+#define _GMP_LOOP_18(call, ...) call(__VA_ARGS__) _GMP_LOOP_17(call, __VA_ARGS__)
+#define _GMP_LOOP_19(call, ...) call(__VA_ARGS__) _GMP_LOOP_18(call, __VA_ARGS__)
+#define _GMP_LOOP_20(call, ...) call(__VA_ARGS__) _GMP_LOOP_19(call, __VA_ARGS__)
+#define _GMP_LOOP_21(call, ...) call(__VA_ARGS__) _GMP_LOOP_20(call, __VA_ARGS__)
+#define _GMP_LOOP_22(call, ...) call(__VA_ARGS__) _GMP_LOOP_21(call, __VA_ARGS__)
+#define _GMP_LOOP_23(call, ...) call(__VA_ARGS__) _GMP_LOOP_22(call, __VA_ARGS__)
+#define _GMP_LOOP_24(call, ...) call(__VA_ARGS__) _GMP_LOOP_23(call, __VA_ARGS__)
+#define _GMP_LOOP_25(call, ...) call(__VA_ARGS__) _GMP_LOOP_24(call, __VA_ARGS__)
+#define _GMP_LOOP_26(call, ...) call(__VA_ARGS__) _GMP_LOOP_25(call, __VA_ARGS__)
+#define _GMP_LOOP_27(call, ...) call(__VA_ARGS__) _GMP_LOOP_26(call, __VA_ARGS__)
+#define _GMP_LOOP_28(call, ...) call(__VA_ARGS__) _GMP_LOOP_27(call, __VA_ARGS__)
+#define _GMP_LOOP_29(call, ...) call(__VA_ARGS__) _GMP_LOOP_28(call, __VA_ARGS__)
+#define _GMP_LOOP_30(call, ...) call(__VA_ARGS__) _GMP_LOOP_29(call, __VA_ARGS__)
+#define _GMP_LOOP_31(call, ...) call(__VA_ARGS__) _GMP_LOOP_30(call, __VA_ARGS__)
+#define _GMP_LOOP_32(call, ...) call(__VA_ARGS__) _GMP_LOOP_31(call, __VA_ARGS__)
+#define _GMP_LOOP_33(call, ...) call(__VA_ARGS__) _GMP_LOOP_32(call, __VA_ARGS__)
+#define _GMP_LOOP_34(call, ...) call(__VA_ARGS__) _GMP_LOOP_33(call, __VA_ARGS__)
+#define _GMP_LOOP_35(call, ...) call(__VA_ARGS__) _GMP_LOOP_34(call, __VA_ARGS__)
+#define _GMP_LOOP_36(call, ...) call(__VA_ARGS__) _GMP_LOOP_35(call, __VA_ARGS__)
+#define _GMP_LOOP_37(call, ...) call(__VA_ARGS__) _GMP_LOOP_36(call, __VA_ARGS__)
+#define _GMP_LOOP_38(call, ...) call(__VA_ARGS__) _GMP_LOOP_37(call, __VA_ARGS__)
+#define _GMP_LOOP_39(call, ...) call(__VA_ARGS__) _GMP_LOOP_38(call, __VA_ARGS__)
+#define _GMP_LOOP_40(call, ...) call(__VA_ARGS__) _GMP_LOOP_39(call, __VA_ARGS__)
+#define _GMP_LOOP_41(call, ...) call(__VA_ARGS__) _GMP_LOOP_40(call, __VA_ARGS__)
+#define _GMP_LOOP_42(call, ...) call(__VA_ARGS__) _GMP_LOOP_41(call, __VA_ARGS__)
+#define _GMP_LOOP_43(call, ...) call(__VA_ARGS__) _GMP_LOOP_42(call, __VA_ARGS__)
+#define _GMP_LOOP_44(call, ...) call(__VA_ARGS__) _GMP_LOOP_43(call, __VA_ARGS__)
+#define _GMP_LOOP_45(call, ...) call(__VA_ARGS__) _GMP_LOOP_44(call, __VA_ARGS__)
+#define _GMP_LOOP_46(call, ...) call(__VA_ARGS__) _GMP_LOOP_45(call, __VA_ARGS__)
+#define _GMP_LOOP_47(call, ...) call(__VA_ARGS__) _GMP_LOOP_46(call, __VA_ARGS__)
+#define _GMP_LOOP_48(call, ...) call(__VA_ARGS__) _GMP_LOOP_47(call, __VA_ARGS__)
+#define _GMP_LOOP_49(call, ...) call(__VA_ARGS__) _GMP_LOOP_48(call, __VA_ARGS__)
+#define _GMP_LOOP_50(call, ...) call(__VA_ARGS__) _GMP_LOOP_49(call, __VA_ARGS__)
+#define _GMP_LOOP_51(call, ...) call(__VA_ARGS__) _GMP_LOOP_50(call, __VA_ARGS__)
+#define _GMP_LOOP_52(call, ...) call(__VA_ARGS__) _GMP_LOOP_51(call, __VA_ARGS__)
+#define _GMP_LOOP_53(call, ...) call(__VA_ARGS__) _GMP_LOOP_52(call, __VA_ARGS__)
+#define _GMP_LOOP_54(call, ...) call(__VA_ARGS__) _GMP_LOOP_53(call, __VA_ARGS__)
+#define _GMP_LOOP_55(call, ...) call(__VA_ARGS__) _GMP_LOOP_54(call, __VA_ARGS__)
+#define _GMP_LOOP_56(call, ...) call(__VA_ARGS__) _GMP_LOOP_55(call, __VA_ARGS__)
+#define _GMP_LOOP_57(call, ...) call(__VA_ARGS__) _GMP_LOOP_56(call, __VA_ARGS__)
+#define _GMP_LOOP_58(call, ...) call(__VA_ARGS__) _GMP_LOOP_57(call, __VA_ARGS__)
+#define _GMP_LOOP_59(call, ...) call(__VA_ARGS__) _GMP_LOOP_58(call, __VA_ARGS__)
+#define _GMP_LOOP_60(call, ...) call(__VA_ARGS__) _GMP_LOOP_59(call, __VA_ARGS__)
+#define _GMP_LOOP_61(call, ...) call(__VA_ARGS__) _GMP_LOOP_60(call, __VA_ARGS__)
+#define _GMP_LOOP_62(call, ...) call(__VA_ARGS__) _GMP_LOOP_61(call, __VA_ARGS__)
+#define _GMP_LOOP_63(call, ...) call(__VA_ARGS__) _GMP_LOOP_62(call, __VA_ARGS__)
+#define _GMP_LOOP_64(call, ...) call(__VA_ARGS__) _GMP_LOOP_63(call, __VA_ARGS__)
+
+#endif // GMP_MACRO_LIMITS_LOOP_64_HPP_
@@ -0,0 +1,6168 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_LOOP_NESTED_1024_HPP_
+#define GMP_MACRO_LIMITS_LOOP_NESTED_1024_HPP_
+
+// GMP_LOOP_2
+#define _GMP_LOOP_L2_0(call, ...)
+#define _GMP_LOOP_L2_1(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_0(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_2(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_3(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_2(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_4(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_3(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_5(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_4(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_6(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_5(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_7(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_6(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_8(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_7(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_9(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_8(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_10(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_9(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_11(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_10(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_12(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_11(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_13(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_12(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_14(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_13(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_15(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_14(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_16(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_15(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_17(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_16(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_18(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_17(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_19(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_18(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_20(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_19(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_21(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_20(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_22(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_21(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_23(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_22(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_24(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_23(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_25(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_24(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_26(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_25(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_27(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_26(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_28(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_27(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_29(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_28(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_30(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_29(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_31(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_30(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_32(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_31(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_33(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_32(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_34(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_33(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_35(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_34(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_36(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_35(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_37(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_36(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_38(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_37(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_39(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_38(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_40(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_39(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_41(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_40(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_42(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_41(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_43(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_42(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_44(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_43(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_45(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_44(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_46(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_45(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_47(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_46(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_48(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_47(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_49(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_48(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_50(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_49(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_51(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_50(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_52(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_51(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_53(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_52(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_54(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_53(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_55(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_54(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_56(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_55(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_57(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_56(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_58(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_57(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_59(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_58(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_60(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_59(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_61(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_60(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_62(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_61(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_63(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_62(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_64(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_63(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_65(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_64(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_66(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_65(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_67(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_66(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_68(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_67(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_69(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_68(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_70(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_69(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_71(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_70(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_72(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_71(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_73(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_72(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_74(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_73(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_75(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_74(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_76(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_75(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_77(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_76(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_78(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_77(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_79(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_78(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_80(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_79(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_81(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_80(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_82(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_81(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_83(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_82(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_84(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_83(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_85(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_84(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_86(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_85(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_87(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_86(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_88(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_87(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_89(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_88(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_90(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_89(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_91(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_90(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_92(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_91(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_93(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_92(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_94(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_93(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_95(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_94(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_96(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_95(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_97(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_96(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_98(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_97(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_99(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_98(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_100(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_99(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_101(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_100(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_102(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_101(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_103(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_102(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_104(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_103(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_105(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_104(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_106(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_105(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_107(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_106(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_108(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_107(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_109(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_108(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_110(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_109(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_111(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_110(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_112(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_111(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_113(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_112(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_114(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_113(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_115(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_114(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_116(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_115(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_117(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_116(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_118(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_117(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_119(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_118(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_120(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_119(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_121(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_120(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_122(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_121(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_123(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_122(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_124(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_123(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_125(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_124(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_126(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_125(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_127(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_126(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_128(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_127(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_129(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_128(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_130(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_129(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_131(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_130(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_132(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_131(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_133(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_132(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_134(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_133(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_135(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_134(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_136(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_135(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_137(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_136(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_138(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_137(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_139(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_138(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_140(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_139(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_141(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_140(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_142(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_141(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_143(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_142(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_144(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_143(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_145(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_144(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_146(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_145(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_147(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_146(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_148(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_147(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_149(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_148(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_150(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_149(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_151(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_150(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_152(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_151(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_153(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_152(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_154(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_153(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_155(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_154(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_156(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_155(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_157(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_156(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_158(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_157(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_159(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_158(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_160(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_159(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_161(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_160(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_162(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_161(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_163(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_162(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_164(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_163(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_165(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_164(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_166(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_165(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_167(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_166(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_168(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_167(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_169(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_168(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_170(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_169(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_171(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_170(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_172(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_171(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_173(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_172(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_174(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_173(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_175(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_174(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_176(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_175(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_177(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_176(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_178(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_177(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_179(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_178(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_180(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_179(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_181(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_180(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_182(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_181(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_183(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_182(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_184(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_183(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_185(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_184(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_186(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_185(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_187(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_186(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_188(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_187(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_189(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_188(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_190(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_189(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_191(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_190(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_192(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_191(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_193(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_192(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_194(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_193(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_195(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_194(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_196(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_195(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_197(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_196(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_198(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_197(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_199(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_198(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_200(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_199(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_201(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_200(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_202(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_201(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_203(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_202(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_204(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_203(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_205(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_204(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_206(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_205(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_207(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_206(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_208(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_207(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_209(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_208(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_210(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_209(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_211(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_210(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_212(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_211(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_213(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_212(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_214(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_213(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_215(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_214(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_216(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_215(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_217(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_216(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_218(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_217(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_219(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_218(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_220(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_219(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_221(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_220(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_222(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_221(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_223(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_222(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_224(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_223(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_225(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_224(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_226(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_225(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_227(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_226(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_228(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_227(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_229(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_228(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_230(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_229(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_231(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_230(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_232(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_231(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_233(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_232(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_234(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_233(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_235(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_234(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_236(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_235(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_237(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_236(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_238(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_237(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_239(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_238(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_240(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_239(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_241(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_240(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_242(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_241(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_243(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_242(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_244(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_243(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_245(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_244(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_246(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_245(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_247(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_246(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_248(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_247(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_249(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_248(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_250(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_249(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_251(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_250(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_252(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_251(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_253(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_252(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_254(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_253(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_255(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_254(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_256(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_255(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_257(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_256(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_258(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_257(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_259(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_258(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_260(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_259(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_261(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_260(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_262(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_261(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_263(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_262(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_264(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_263(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_265(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_264(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_266(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_265(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_267(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_266(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_268(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_267(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_269(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_268(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_270(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_269(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_271(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_270(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_272(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_271(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_273(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_272(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_274(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_273(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_275(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_274(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_276(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_275(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_277(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_276(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_278(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_277(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_279(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_278(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_280(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_279(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_281(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_280(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_282(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_281(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_283(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_282(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_284(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_283(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_285(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_284(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_286(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_285(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_287(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_286(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_288(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_287(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_289(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_288(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_290(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_289(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_291(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_290(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_292(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_291(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_293(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_292(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_294(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_293(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_295(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_294(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_296(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_295(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_297(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_296(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_298(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_297(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_299(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_298(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_300(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_299(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_301(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_300(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_302(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_301(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_303(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_302(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_304(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_303(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_305(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_304(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_306(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_305(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_307(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_306(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_308(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_307(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_309(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_308(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_310(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_309(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_311(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_310(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_312(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_311(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_313(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_312(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_314(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_313(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_315(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_314(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_316(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_315(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_317(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_316(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_318(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_317(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_319(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_318(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_320(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_319(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_321(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_320(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_322(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_321(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_323(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_322(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_324(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_323(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_325(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_324(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_326(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_325(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_327(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_326(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_328(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_327(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_329(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_328(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_330(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_329(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_331(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_330(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_332(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_331(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_333(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_332(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_334(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_333(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_335(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_334(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_336(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_335(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_337(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_336(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_338(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_337(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_339(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_338(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_340(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_339(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_341(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_340(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_342(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_341(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_343(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_342(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_344(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_343(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_345(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_344(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_346(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_345(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_347(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_346(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_348(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_347(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_349(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_348(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_350(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_349(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_351(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_350(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_352(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_351(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_353(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_352(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_354(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_353(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_355(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_354(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_356(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_355(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_357(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_356(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_358(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_357(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_359(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_358(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_360(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_359(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_361(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_360(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_362(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_361(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_363(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_362(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_364(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_363(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_365(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_364(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_366(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_365(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_367(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_366(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_368(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_367(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_369(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_368(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_370(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_369(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_371(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_370(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_372(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_371(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_373(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_372(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_374(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_373(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_375(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_374(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_376(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_375(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_377(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_376(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_378(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_377(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_379(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_378(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_380(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_379(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_381(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_380(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_382(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_381(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_383(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_382(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_384(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_383(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_385(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_384(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_386(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_385(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_387(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_386(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_388(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_387(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_389(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_388(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_390(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_389(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_391(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_390(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_392(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_391(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_393(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_392(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_394(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_393(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_395(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_394(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_396(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_395(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_397(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_396(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_398(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_397(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_399(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_398(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_400(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_399(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_401(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_400(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_402(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_401(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_403(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_402(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_404(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_403(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_405(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_404(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_406(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_405(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_407(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_406(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_408(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_407(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_409(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_408(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_410(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_409(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_411(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_410(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_412(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_411(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_413(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_412(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_414(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_413(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_415(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_414(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_416(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_415(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_417(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_416(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_418(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_417(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_419(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_418(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_420(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_419(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_421(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_420(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_422(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_421(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_423(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_422(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_424(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_423(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_425(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_424(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_426(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_425(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_427(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_426(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_428(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_427(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_429(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_428(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_430(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_429(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_431(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_430(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_432(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_431(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_433(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_432(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_434(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_433(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_435(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_434(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_436(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_435(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_437(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_436(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_438(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_437(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_439(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_438(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_440(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_439(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_441(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_440(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_442(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_441(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_443(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_442(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_444(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_443(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_445(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_444(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_446(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_445(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_447(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_446(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_448(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_447(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_449(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_448(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_450(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_449(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_451(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_450(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_452(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_451(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_453(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_452(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_454(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_453(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_455(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_454(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_456(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_455(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_457(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_456(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_458(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_457(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_459(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_458(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_460(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_459(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_461(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_460(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_462(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_461(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_463(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_462(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_464(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_463(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_465(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_464(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_466(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_465(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_467(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_466(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_468(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_467(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_469(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_468(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_470(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_469(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_471(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_470(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_472(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_471(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_473(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_472(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_474(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_473(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_475(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_474(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_476(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_475(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_477(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_476(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_478(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_477(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_479(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_478(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_480(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_479(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_481(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_480(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_482(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_481(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_483(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_482(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_484(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_483(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_485(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_484(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_486(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_485(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_487(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_486(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_488(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_487(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_489(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_488(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_490(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_489(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_491(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_490(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_492(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_491(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_493(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_492(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_494(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_493(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_495(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_494(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_496(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_495(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_497(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_496(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_498(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_497(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_499(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_498(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_500(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_499(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_501(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_500(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_502(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_501(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_503(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_502(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_504(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_503(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_505(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_504(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_506(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_505(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_507(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_506(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_508(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_507(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_509(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_508(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_510(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_509(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_511(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_510(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_512(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_511(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_513(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_512(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_514(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_513(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_515(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_514(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_516(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_515(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_517(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_516(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_518(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_517(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_519(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_518(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_520(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_519(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_521(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_520(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_522(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_521(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_523(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_522(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_524(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_523(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_525(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_524(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_526(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_525(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_527(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_526(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_528(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_527(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_529(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_528(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_530(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_529(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_531(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_530(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_532(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_531(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_533(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_532(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_534(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_533(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_535(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_534(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_536(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_535(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_537(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_536(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_538(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_537(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_539(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_538(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_540(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_539(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_541(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_540(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_542(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_541(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_543(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_542(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_544(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_543(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_545(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_544(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_546(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_545(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_547(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_546(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_548(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_547(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_549(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_548(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_550(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_549(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_551(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_550(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_552(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_551(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_553(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_552(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_554(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_553(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_555(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_554(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_556(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_555(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_557(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_556(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_558(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_557(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_559(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_558(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_560(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_559(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_561(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_560(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_562(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_561(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_563(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_562(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_564(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_563(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_565(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_564(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_566(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_565(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_567(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_566(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_568(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_567(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_569(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_568(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_570(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_569(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_571(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_570(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_572(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_571(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_573(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_572(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_574(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_573(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_575(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_574(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_576(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_575(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_577(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_576(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_578(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_577(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_579(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_578(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_580(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_579(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_581(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_580(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_582(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_581(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_583(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_582(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_584(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_583(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_585(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_584(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_586(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_585(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_587(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_586(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_588(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_587(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_589(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_588(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_590(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_589(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_591(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_590(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_592(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_591(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_593(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_592(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_594(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_593(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_595(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_594(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_596(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_595(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_597(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_596(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_598(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_597(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_599(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_598(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_600(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_599(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_601(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_600(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_602(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_601(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_603(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_602(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_604(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_603(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_605(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_604(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_606(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_605(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_607(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_606(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_608(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_607(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_609(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_608(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_610(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_609(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_611(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_610(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_612(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_611(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_613(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_612(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_614(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_613(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_615(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_614(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_616(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_615(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_617(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_616(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_618(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_617(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_619(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_618(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_620(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_619(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_621(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_620(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_622(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_621(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_623(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_622(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_624(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_623(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_625(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_624(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_626(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_625(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_627(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_626(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_628(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_627(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_629(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_628(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_630(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_629(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_631(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_630(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_632(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_631(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_633(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_632(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_634(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_633(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_635(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_634(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_636(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_635(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_637(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_636(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_638(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_637(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_639(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_638(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_640(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_639(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_641(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_640(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_642(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_641(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_643(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_642(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_644(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_643(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_645(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_644(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_646(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_645(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_647(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_646(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_648(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_647(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_649(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_648(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_650(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_649(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_651(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_650(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_652(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_651(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_653(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_652(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_654(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_653(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_655(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_654(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_656(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_655(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_657(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_656(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_658(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_657(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_659(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_658(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_660(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_659(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_661(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_660(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_662(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_661(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_663(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_662(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_664(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_663(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_665(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_664(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_666(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_665(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_667(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_666(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_668(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_667(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_669(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_668(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_670(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_669(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_671(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_670(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_672(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_671(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_673(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_672(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_674(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_673(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_675(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_674(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_676(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_675(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_677(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_676(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_678(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_677(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_679(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_678(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_680(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_679(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_681(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_680(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_682(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_681(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_683(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_682(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_684(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_683(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_685(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_684(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_686(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_685(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_687(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_686(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_688(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_687(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_689(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_688(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_690(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_689(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_691(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_690(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_692(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_691(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_693(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_692(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_694(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_693(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_695(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_694(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_696(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_695(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_697(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_696(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_698(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_697(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_699(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_698(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_700(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_699(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_701(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_700(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_702(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_701(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_703(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_702(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_704(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_703(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_705(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_704(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_706(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_705(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_707(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_706(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_708(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_707(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_709(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_708(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_710(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_709(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_711(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_710(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_712(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_711(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_713(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_712(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_714(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_713(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_715(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_714(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_716(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_715(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_717(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_716(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_718(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_717(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_719(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_718(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_720(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_719(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_721(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_720(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_722(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_721(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_723(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_722(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_724(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_723(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_725(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_724(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_726(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_725(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_727(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_726(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_728(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_727(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_729(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_728(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_730(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_729(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_731(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_730(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_732(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_731(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_733(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_732(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_734(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_733(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_735(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_734(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_736(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_735(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_737(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_736(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_738(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_737(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_739(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_738(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_740(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_739(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_741(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_740(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_742(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_741(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_743(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_742(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_744(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_743(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_745(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_744(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_746(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_745(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_747(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_746(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_748(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_747(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_749(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_748(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_750(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_749(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_751(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_750(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_752(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_751(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_753(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_752(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_754(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_753(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_755(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_754(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_756(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_755(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_757(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_756(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_758(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_757(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_759(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_758(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_760(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_759(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_761(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_760(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_762(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_761(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_763(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_762(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_764(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_763(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_765(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_764(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_766(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_765(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_767(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_766(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_768(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_767(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_769(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_768(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_770(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_769(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_771(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_770(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_772(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_771(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_773(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_772(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_774(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_773(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_775(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_774(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_776(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_775(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_777(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_776(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_778(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_777(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_779(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_778(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_780(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_779(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_781(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_780(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_782(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_781(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_783(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_782(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_784(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_783(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_785(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_784(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_786(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_785(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_787(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_786(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_788(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_787(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_789(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_788(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_790(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_789(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_791(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_790(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_792(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_791(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_793(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_792(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_794(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_793(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_795(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_794(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_796(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_795(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_797(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_796(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_798(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_797(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_799(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_798(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_800(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_799(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_801(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_800(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_802(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_801(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_803(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_802(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_804(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_803(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_805(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_804(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_806(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_805(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_807(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_806(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_808(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_807(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_809(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_808(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_810(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_809(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_811(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_810(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_812(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_811(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_813(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_812(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_814(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_813(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_815(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_814(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_816(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_815(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_817(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_816(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_818(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_817(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_819(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_818(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_820(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_819(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_821(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_820(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_822(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_821(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_823(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_822(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_824(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_823(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_825(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_824(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_826(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_825(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_827(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_826(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_828(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_827(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_829(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_828(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_830(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_829(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_831(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_830(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_832(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_831(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_833(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_832(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_834(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_833(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_835(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_834(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_836(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_835(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_837(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_836(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_838(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_837(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_839(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_838(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_840(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_839(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_841(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_840(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_842(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_841(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_843(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_842(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_844(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_843(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_845(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_844(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_846(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_845(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_847(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_846(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_848(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_847(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_849(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_848(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_850(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_849(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_851(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_850(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_852(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_851(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_853(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_852(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_854(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_853(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_855(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_854(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_856(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_855(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_857(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_856(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_858(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_857(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_859(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_858(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_860(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_859(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_861(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_860(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_862(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_861(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_863(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_862(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_864(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_863(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_865(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_864(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_866(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_865(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_867(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_866(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_868(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_867(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_869(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_868(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_870(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_869(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_871(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_870(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_872(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_871(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_873(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_872(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_874(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_873(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_875(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_874(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_876(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_875(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_877(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_876(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_878(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_877(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_879(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_878(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_880(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_879(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_881(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_880(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_882(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_881(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_883(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_882(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_884(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_883(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_885(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_884(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_886(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_885(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_887(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_886(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_888(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_887(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_889(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_888(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_890(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_889(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_891(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_890(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_892(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_891(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_893(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_892(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_894(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_893(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_895(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_894(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_896(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_895(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_897(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_896(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_898(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_897(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_899(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_898(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_900(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_899(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_901(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_900(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_902(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_901(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_903(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_902(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_904(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_903(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_905(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_904(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_906(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_905(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_907(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_906(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_908(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_907(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_909(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_908(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_910(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_909(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_911(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_910(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_912(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_911(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_913(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_912(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_914(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_913(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_915(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_914(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_916(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_915(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_917(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_916(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_918(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_917(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_919(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_918(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_920(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_919(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_921(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_920(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_922(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_921(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_923(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_922(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_924(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_923(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_925(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_924(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_926(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_925(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_927(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_926(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_928(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_927(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_929(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_928(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_930(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_929(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_931(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_930(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_932(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_931(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_933(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_932(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_934(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_933(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_935(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_934(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_936(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_935(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_937(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_936(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_938(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_937(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_939(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_938(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_940(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_939(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_941(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_940(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_942(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_941(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_943(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_942(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_944(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_943(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_945(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_944(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_946(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_945(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_947(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_946(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_948(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_947(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_949(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_948(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_950(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_949(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_951(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_950(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_952(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_951(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_953(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_952(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_954(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_953(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_955(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_954(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_956(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_955(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_957(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_956(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_958(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_957(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_959(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_958(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_960(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_959(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_961(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_960(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_962(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_961(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_963(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_962(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_964(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_963(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_965(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_964(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_966(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_965(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_967(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_966(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_968(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_967(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_969(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_968(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_970(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_969(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_971(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_970(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_972(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_971(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_973(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_972(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_974(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_973(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_975(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_974(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_976(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_975(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_977(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_976(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_978(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_977(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_979(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_978(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_980(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_979(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_981(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_980(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_982(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_981(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_983(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_982(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_984(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_983(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_985(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_984(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_986(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_985(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_987(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_986(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_988(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_987(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_989(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_988(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_990(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_989(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_991(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_990(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_992(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_991(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_993(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_992(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_994(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_993(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_995(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_994(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_996(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_995(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_997(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_996(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_998(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_997(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_999(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_998(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1000(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_999(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1001(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1000(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1002(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1001(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1003(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1002(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1004(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1003(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1005(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1004(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1006(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1005(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1007(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1006(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1008(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1007(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1009(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1008(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1010(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1009(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1011(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1010(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1012(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1011(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1013(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1012(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1014(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1013(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1015(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1014(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1016(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1015(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1017(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1016(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1018(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1017(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1019(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1018(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1020(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1019(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1021(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1020(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1022(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1021(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1023(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1022(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_1024(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1023(call, __VA_ARGS__)
+
+// GMP_REPEAT_2
+#define _GMP_REPEAT_L2_0(call, data)
+#define _GMP_REPEAT_L2_1(call, data) _GMP_REPEAT_L2_0(call, data) call(0, data)
+#define _GMP_REPEAT_L2_2(call, data) _GMP_REPEAT_L2_1(call, data) call(1, data)
+#define _GMP_REPEAT_L2_3(call, data) _GMP_REPEAT_L2_2(call, data) call(2, data)
+#define _GMP_REPEAT_L2_4(call, data) _GMP_REPEAT_L2_3(call, data) call(3, data)
+#define _GMP_REPEAT_L2_5(call, data) _GMP_REPEAT_L2_4(call, data) call(4, data)
+#define _GMP_REPEAT_L2_6(call, data) _GMP_REPEAT_L2_5(call, data) call(5, data)
+#define _GMP_REPEAT_L2_7(call, data) _GMP_REPEAT_L2_6(call, data) call(6, data)
+#define _GMP_REPEAT_L2_8(call, data) _GMP_REPEAT_L2_7(call, data) call(7, data)
+#define _GMP_REPEAT_L2_9(call, data) _GMP_REPEAT_L2_8(call, data) call(8, data)
+#define _GMP_REPEAT_L2_10(call, data) _GMP_REPEAT_L2_9(call, data) call(9, data)
+#define _GMP_REPEAT_L2_11(call, data) _GMP_REPEAT_L2_10(call, data) call(10, data)
+#define _GMP_REPEAT_L2_12(call, data) _GMP_REPEAT_L2_11(call, data) call(11, data)
+#define _GMP_REPEAT_L2_13(call, data) _GMP_REPEAT_L2_12(call, data) call(12, data)
+#define _GMP_REPEAT_L2_14(call, data) _GMP_REPEAT_L2_13(call, data) call(13, data)
+#define _GMP_REPEAT_L2_15(call, data) _GMP_REPEAT_L2_14(call, data) call(14, data)
+#define _GMP_REPEAT_L2_16(call, data) _GMP_REPEAT_L2_15(call, data) call(15, data)
+#define _GMP_REPEAT_L2_17(call, data) _GMP_REPEAT_L2_16(call, data) call(16, data)
+#define _GMP_REPEAT_L2_18(call, data) _GMP_REPEAT_L2_17(call, data) call(17, data)
+#define _GMP_REPEAT_L2_19(call, data) _GMP_REPEAT_L2_18(call, data) call(18, data)
+#define _GMP_REPEAT_L2_20(call, data) _GMP_REPEAT_L2_19(call, data) call(19, data)
+#define _GMP_REPEAT_L2_21(call, data) _GMP_REPEAT_L2_20(call, data) call(20, data)
+#define _GMP_REPEAT_L2_22(call, data) _GMP_REPEAT_L2_21(call, data) call(21, data)
+#define _GMP_REPEAT_L2_23(call, data) _GMP_REPEAT_L2_22(call, data) call(22, data)
+#define _GMP_REPEAT_L2_24(call, data) _GMP_REPEAT_L2_23(call, data) call(23, data)
+#define _GMP_REPEAT_L2_25(call, data) _GMP_REPEAT_L2_24(call, data) call(24, data)
+#define _GMP_REPEAT_L2_26(call, data) _GMP_REPEAT_L2_25(call, data) call(25, data)
+#define _GMP_REPEAT_L2_27(call, data) _GMP_REPEAT_L2_26(call, data) call(26, data)
+#define _GMP_REPEAT_L2_28(call, data) _GMP_REPEAT_L2_27(call, data) call(27, data)
+#define _GMP_REPEAT_L2_29(call, data) _GMP_REPEAT_L2_28(call, data) call(28, data)
+#define _GMP_REPEAT_L2_30(call, data) _GMP_REPEAT_L2_29(call, data) call(29, data)
+#define _GMP_REPEAT_L2_31(call, data) _GMP_REPEAT_L2_30(call, data) call(30, data)
+#define _GMP_REPEAT_L2_32(call, data) _GMP_REPEAT_L2_31(call, data) call(31, data)
+#define _GMP_REPEAT_L2_33(call, data) _GMP_REPEAT_L2_32(call, data) call(32, data)
+#define _GMP_REPEAT_L2_34(call, data) _GMP_REPEAT_L2_33(call, data) call(33, data)
+#define _GMP_REPEAT_L2_35(call, data) _GMP_REPEAT_L2_34(call, data) call(34, data)
+#define _GMP_REPEAT_L2_36(call, data) _GMP_REPEAT_L2_35(call, data) call(35, data)
+#define _GMP_REPEAT_L2_37(call, data) _GMP_REPEAT_L2_36(call, data) call(36, data)
+#define _GMP_REPEAT_L2_38(call, data) _GMP_REPEAT_L2_37(call, data) call(37, data)
+#define _GMP_REPEAT_L2_39(call, data) _GMP_REPEAT_L2_38(call, data) call(38, data)
+#define _GMP_REPEAT_L2_40(call, data) _GMP_REPEAT_L2_39(call, data) call(39, data)
+#define _GMP_REPEAT_L2_41(call, data) _GMP_REPEAT_L2_40(call, data) call(40, data)
+#define _GMP_REPEAT_L2_42(call, data) _GMP_REPEAT_L2_41(call, data) call(41, data)
+#define _GMP_REPEAT_L2_43(call, data) _GMP_REPEAT_L2_42(call, data) call(42, data)
+#define _GMP_REPEAT_L2_44(call, data) _GMP_REPEAT_L2_43(call, data) call(43, data)
+#define _GMP_REPEAT_L2_45(call, data) _GMP_REPEAT_L2_44(call, data) call(44, data)
+#define _GMP_REPEAT_L2_46(call, data) _GMP_REPEAT_L2_45(call, data) call(45, data)
+#define _GMP_REPEAT_L2_47(call, data) _GMP_REPEAT_L2_46(call, data) call(46, data)
+#define _GMP_REPEAT_L2_48(call, data) _GMP_REPEAT_L2_47(call, data) call(47, data)
+#define _GMP_REPEAT_L2_49(call, data) _GMP_REPEAT_L2_48(call, data) call(48, data)
+#define _GMP_REPEAT_L2_50(call, data) _GMP_REPEAT_L2_49(call, data) call(49, data)
+#define _GMP_REPEAT_L2_51(call, data) _GMP_REPEAT_L2_50(call, data) call(50, data)
+#define _GMP_REPEAT_L2_52(call, data) _GMP_REPEAT_L2_51(call, data) call(51, data)
+#define _GMP_REPEAT_L2_53(call, data) _GMP_REPEAT_L2_52(call, data) call(52, data)
+#define _GMP_REPEAT_L2_54(call, data) _GMP_REPEAT_L2_53(call, data) call(53, data)
+#define _GMP_REPEAT_L2_55(call, data) _GMP_REPEAT_L2_54(call, data) call(54, data)
+#define _GMP_REPEAT_L2_56(call, data) _GMP_REPEAT_L2_55(call, data) call(55, data)
+#define _GMP_REPEAT_L2_57(call, data) _GMP_REPEAT_L2_56(call, data) call(56, data)
+#define _GMP_REPEAT_L2_58(call, data) _GMP_REPEAT_L2_57(call, data) call(57, data)
+#define _GMP_REPEAT_L2_59(call, data) _GMP_REPEAT_L2_58(call, data) call(58, data)
+#define _GMP_REPEAT_L2_60(call, data) _GMP_REPEAT_L2_59(call, data) call(59, data)
+#define _GMP_REPEAT_L2_61(call, data) _GMP_REPEAT_L2_60(call, data) call(60, data)
+#define _GMP_REPEAT_L2_62(call, data) _GMP_REPEAT_L2_61(call, data) call(61, data)
+#define _GMP_REPEAT_L2_63(call, data) _GMP_REPEAT_L2_62(call, data) call(62, data)
+#define _GMP_REPEAT_L2_64(call, data) _GMP_REPEAT_L2_63(call, data) call(63, data)
+#define _GMP_REPEAT_L2_65(call, data) _GMP_REPEAT_L2_64(call, data) call(64, data)
+#define _GMP_REPEAT_L2_66(call, data) _GMP_REPEAT_L2_65(call, data) call(65, data)
+#define _GMP_REPEAT_L2_67(call, data) _GMP_REPEAT_L2_66(call, data) call(66, data)
+#define _GMP_REPEAT_L2_68(call, data) _GMP_REPEAT_L2_67(call, data) call(67, data)
+#define _GMP_REPEAT_L2_69(call, data) _GMP_REPEAT_L2_68(call, data) call(68, data)
+#define _GMP_REPEAT_L2_70(call, data) _GMP_REPEAT_L2_69(call, data) call(69, data)
+#define _GMP_REPEAT_L2_71(call, data) _GMP_REPEAT_L2_70(call, data) call(70, data)
+#define _GMP_REPEAT_L2_72(call, data) _GMP_REPEAT_L2_71(call, data) call(71, data)
+#define _GMP_REPEAT_L2_73(call, data) _GMP_REPEAT_L2_72(call, data) call(72, data)
+#define _GMP_REPEAT_L2_74(call, data) _GMP_REPEAT_L2_73(call, data) call(73, data)
+#define _GMP_REPEAT_L2_75(call, data) _GMP_REPEAT_L2_74(call, data) call(74, data)
+#define _GMP_REPEAT_L2_76(call, data) _GMP_REPEAT_L2_75(call, data) call(75, data)
+#define _GMP_REPEAT_L2_77(call, data) _GMP_REPEAT_L2_76(call, data) call(76, data)
+#define _GMP_REPEAT_L2_78(call, data) _GMP_REPEAT_L2_77(call, data) call(77, data)
+#define _GMP_REPEAT_L2_79(call, data) _GMP_REPEAT_L2_78(call, data) call(78, data)
+#define _GMP_REPEAT_L2_80(call, data) _GMP_REPEAT_L2_79(call, data) call(79, data)
+#define _GMP_REPEAT_L2_81(call, data) _GMP_REPEAT_L2_80(call, data) call(80, data)
+#define _GMP_REPEAT_L2_82(call, data) _GMP_REPEAT_L2_81(call, data) call(81, data)
+#define _GMP_REPEAT_L2_83(call, data) _GMP_REPEAT_L2_82(call, data) call(82, data)
+#define _GMP_REPEAT_L2_84(call, data) _GMP_REPEAT_L2_83(call, data) call(83, data)
+#define _GMP_REPEAT_L2_85(call, data) _GMP_REPEAT_L2_84(call, data) call(84, data)
+#define _GMP_REPEAT_L2_86(call, data) _GMP_REPEAT_L2_85(call, data) call(85, data)
+#define _GMP_REPEAT_L2_87(call, data) _GMP_REPEAT_L2_86(call, data) call(86, data)
+#define _GMP_REPEAT_L2_88(call, data) _GMP_REPEAT_L2_87(call, data) call(87, data)
+#define _GMP_REPEAT_L2_89(call, data) _GMP_REPEAT_L2_88(call, data) call(88, data)
+#define _GMP_REPEAT_L2_90(call, data) _GMP_REPEAT_L2_89(call, data) call(89, data)
+#define _GMP_REPEAT_L2_91(call, data) _GMP_REPEAT_L2_90(call, data) call(90, data)
+#define _GMP_REPEAT_L2_92(call, data) _GMP_REPEAT_L2_91(call, data) call(91, data)
+#define _GMP_REPEAT_L2_93(call, data) _GMP_REPEAT_L2_92(call, data) call(92, data)
+#define _GMP_REPEAT_L2_94(call, data) _GMP_REPEAT_L2_93(call, data) call(93, data)
+#define _GMP_REPEAT_L2_95(call, data) _GMP_REPEAT_L2_94(call, data) call(94, data)
+#define _GMP_REPEAT_L2_96(call, data) _GMP_REPEAT_L2_95(call, data) call(95, data)
+#define _GMP_REPEAT_L2_97(call, data) _GMP_REPEAT_L2_96(call, data) call(96, data)
+#define _GMP_REPEAT_L2_98(call, data) _GMP_REPEAT_L2_97(call, data) call(97, data)
+#define _GMP_REPEAT_L2_99(call, data) _GMP_REPEAT_L2_98(call, data) call(98, data)
+#define _GMP_REPEAT_L2_100(call, data) _GMP_REPEAT_L2_99(call, data) call(99, data)
+#define _GMP_REPEAT_L2_101(call, data) _GMP_REPEAT_L2_100(call, data) call(100, data)
+#define _GMP_REPEAT_L2_102(call, data) _GMP_REPEAT_L2_101(call, data) call(101, data)
+#define _GMP_REPEAT_L2_103(call, data) _GMP_REPEAT_L2_102(call, data) call(102, data)
+#define _GMP_REPEAT_L2_104(call, data) _GMP_REPEAT_L2_103(call, data) call(103, data)
+#define _GMP_REPEAT_L2_105(call, data) _GMP_REPEAT_L2_104(call, data) call(104, data)
+#define _GMP_REPEAT_L2_106(call, data) _GMP_REPEAT_L2_105(call, data) call(105, data)
+#define _GMP_REPEAT_L2_107(call, data) _GMP_REPEAT_L2_106(call, data) call(106, data)
+#define _GMP_REPEAT_L2_108(call, data) _GMP_REPEAT_L2_107(call, data) call(107, data)
+#define _GMP_REPEAT_L2_109(call, data) _GMP_REPEAT_L2_108(call, data) call(108, data)
+#define _GMP_REPEAT_L2_110(call, data) _GMP_REPEAT_L2_109(call, data) call(109, data)
+#define _GMP_REPEAT_L2_111(call, data) _GMP_REPEAT_L2_110(call, data) call(110, data)
+#define _GMP_REPEAT_L2_112(call, data) _GMP_REPEAT_L2_111(call, data) call(111, data)
+#define _GMP_REPEAT_L2_113(call, data) _GMP_REPEAT_L2_112(call, data) call(112, data)
+#define _GMP_REPEAT_L2_114(call, data) _GMP_REPEAT_L2_113(call, data) call(113, data)
+#define _GMP_REPEAT_L2_115(call, data) _GMP_REPEAT_L2_114(call, data) call(114, data)
+#define _GMP_REPEAT_L2_116(call, data) _GMP_REPEAT_L2_115(call, data) call(115, data)
+#define _GMP_REPEAT_L2_117(call, data) _GMP_REPEAT_L2_116(call, data) call(116, data)
+#define _GMP_REPEAT_L2_118(call, data) _GMP_REPEAT_L2_117(call, data) call(117, data)
+#define _GMP_REPEAT_L2_119(call, data) _GMP_REPEAT_L2_118(call, data) call(118, data)
+#define _GMP_REPEAT_L2_120(call, data) _GMP_REPEAT_L2_119(call, data) call(119, data)
+#define _GMP_REPEAT_L2_121(call, data) _GMP_REPEAT_L2_120(call, data) call(120, data)
+#define _GMP_REPEAT_L2_122(call, data) _GMP_REPEAT_L2_121(call, data) call(121, data)
+#define _GMP_REPEAT_L2_123(call, data) _GMP_REPEAT_L2_122(call, data) call(122, data)
+#define _GMP_REPEAT_L2_124(call, data) _GMP_REPEAT_L2_123(call, data) call(123, data)
+#define _GMP_REPEAT_L2_125(call, data) _GMP_REPEAT_L2_124(call, data) call(124, data)
+#define _GMP_REPEAT_L2_126(call, data) _GMP_REPEAT_L2_125(call, data) call(125, data)
+#define _GMP_REPEAT_L2_127(call, data) _GMP_REPEAT_L2_126(call, data) call(126, data)
+#define _GMP_REPEAT_L2_128(call, data) _GMP_REPEAT_L2_127(call, data) call(127, data)
+#define _GMP_REPEAT_L2_129(call, data) _GMP_REPEAT_L2_128(call, data) call(128, data)
+#define _GMP_REPEAT_L2_130(call, data) _GMP_REPEAT_L2_129(call, data) call(129, data)
+#define _GMP_REPEAT_L2_131(call, data) _GMP_REPEAT_L2_130(call, data) call(130, data)
+#define _GMP_REPEAT_L2_132(call, data) _GMP_REPEAT_L2_131(call, data) call(131, data)
+#define _GMP_REPEAT_L2_133(call, data) _GMP_REPEAT_L2_132(call, data) call(132, data)
+#define _GMP_REPEAT_L2_134(call, data) _GMP_REPEAT_L2_133(call, data) call(133, data)
+#define _GMP_REPEAT_L2_135(call, data) _GMP_REPEAT_L2_134(call, data) call(134, data)
+#define _GMP_REPEAT_L2_136(call, data) _GMP_REPEAT_L2_135(call, data) call(135, data)
+#define _GMP_REPEAT_L2_137(call, data) _GMP_REPEAT_L2_136(call, data) call(136, data)
+#define _GMP_REPEAT_L2_138(call, data) _GMP_REPEAT_L2_137(call, data) call(137, data)
+#define _GMP_REPEAT_L2_139(call, data) _GMP_REPEAT_L2_138(call, data) call(138, data)
+#define _GMP_REPEAT_L2_140(call, data) _GMP_REPEAT_L2_139(call, data) call(139, data)
+#define _GMP_REPEAT_L2_141(call, data) _GMP_REPEAT_L2_140(call, data) call(140, data)
+#define _GMP_REPEAT_L2_142(call, data) _GMP_REPEAT_L2_141(call, data) call(141, data)
+#define _GMP_REPEAT_L2_143(call, data) _GMP_REPEAT_L2_142(call, data) call(142, data)
+#define _GMP_REPEAT_L2_144(call, data) _GMP_REPEAT_L2_143(call, data) call(143, data)
+#define _GMP_REPEAT_L2_145(call, data) _GMP_REPEAT_L2_144(call, data) call(144, data)
+#define _GMP_REPEAT_L2_146(call, data) _GMP_REPEAT_L2_145(call, data) call(145, data)
+#define _GMP_REPEAT_L2_147(call, data) _GMP_REPEAT_L2_146(call, data) call(146, data)
+#define _GMP_REPEAT_L2_148(call, data) _GMP_REPEAT_L2_147(call, data) call(147, data)
+#define _GMP_REPEAT_L2_149(call, data) _GMP_REPEAT_L2_148(call, data) call(148, data)
+#define _GMP_REPEAT_L2_150(call, data) _GMP_REPEAT_L2_149(call, data) call(149, data)
+#define _GMP_REPEAT_L2_151(call, data) _GMP_REPEAT_L2_150(call, data) call(150, data)
+#define _GMP_REPEAT_L2_152(call, data) _GMP_REPEAT_L2_151(call, data) call(151, data)
+#define _GMP_REPEAT_L2_153(call, data) _GMP_REPEAT_L2_152(call, data) call(152, data)
+#define _GMP_REPEAT_L2_154(call, data) _GMP_REPEAT_L2_153(call, data) call(153, data)
+#define _GMP_REPEAT_L2_155(call, data) _GMP_REPEAT_L2_154(call, data) call(154, data)
+#define _GMP_REPEAT_L2_156(call, data) _GMP_REPEAT_L2_155(call, data) call(155, data)
+#define _GMP_REPEAT_L2_157(call, data) _GMP_REPEAT_L2_156(call, data) call(156, data)
+#define _GMP_REPEAT_L2_158(call, data) _GMP_REPEAT_L2_157(call, data) call(157, data)
+#define _GMP_REPEAT_L2_159(call, data) _GMP_REPEAT_L2_158(call, data) call(158, data)
+#define _GMP_REPEAT_L2_160(call, data) _GMP_REPEAT_L2_159(call, data) call(159, data)
+#define _GMP_REPEAT_L2_161(call, data) _GMP_REPEAT_L2_160(call, data) call(160, data)
+#define _GMP_REPEAT_L2_162(call, data) _GMP_REPEAT_L2_161(call, data) call(161, data)
+#define _GMP_REPEAT_L2_163(call, data) _GMP_REPEAT_L2_162(call, data) call(162, data)
+#define _GMP_REPEAT_L2_164(call, data) _GMP_REPEAT_L2_163(call, data) call(163, data)
+#define _GMP_REPEAT_L2_165(call, data) _GMP_REPEAT_L2_164(call, data) call(164, data)
+#define _GMP_REPEAT_L2_166(call, data) _GMP_REPEAT_L2_165(call, data) call(165, data)
+#define _GMP_REPEAT_L2_167(call, data) _GMP_REPEAT_L2_166(call, data) call(166, data)
+#define _GMP_REPEAT_L2_168(call, data) _GMP_REPEAT_L2_167(call, data) call(167, data)
+#define _GMP_REPEAT_L2_169(call, data) _GMP_REPEAT_L2_168(call, data) call(168, data)
+#define _GMP_REPEAT_L2_170(call, data) _GMP_REPEAT_L2_169(call, data) call(169, data)
+#define _GMP_REPEAT_L2_171(call, data) _GMP_REPEAT_L2_170(call, data) call(170, data)
+#define _GMP_REPEAT_L2_172(call, data) _GMP_REPEAT_L2_171(call, data) call(171, data)
+#define _GMP_REPEAT_L2_173(call, data) _GMP_REPEAT_L2_172(call, data) call(172, data)
+#define _GMP_REPEAT_L2_174(call, data) _GMP_REPEAT_L2_173(call, data) call(173, data)
+#define _GMP_REPEAT_L2_175(call, data) _GMP_REPEAT_L2_174(call, data) call(174, data)
+#define _GMP_REPEAT_L2_176(call, data) _GMP_REPEAT_L2_175(call, data) call(175, data)
+#define _GMP_REPEAT_L2_177(call, data) _GMP_REPEAT_L2_176(call, data) call(176, data)
+#define _GMP_REPEAT_L2_178(call, data) _GMP_REPEAT_L2_177(call, data) call(177, data)
+#define _GMP_REPEAT_L2_179(call, data) _GMP_REPEAT_L2_178(call, data) call(178, data)
+#define _GMP_REPEAT_L2_180(call, data) _GMP_REPEAT_L2_179(call, data) call(179, data)
+#define _GMP_REPEAT_L2_181(call, data) _GMP_REPEAT_L2_180(call, data) call(180, data)
+#define _GMP_REPEAT_L2_182(call, data) _GMP_REPEAT_L2_181(call, data) call(181, data)
+#define _GMP_REPEAT_L2_183(call, data) _GMP_REPEAT_L2_182(call, data) call(182, data)
+#define _GMP_REPEAT_L2_184(call, data) _GMP_REPEAT_L2_183(call, data) call(183, data)
+#define _GMP_REPEAT_L2_185(call, data) _GMP_REPEAT_L2_184(call, data) call(184, data)
+#define _GMP_REPEAT_L2_186(call, data) _GMP_REPEAT_L2_185(call, data) call(185, data)
+#define _GMP_REPEAT_L2_187(call, data) _GMP_REPEAT_L2_186(call, data) call(186, data)
+#define _GMP_REPEAT_L2_188(call, data) _GMP_REPEAT_L2_187(call, data) call(187, data)
+#define _GMP_REPEAT_L2_189(call, data) _GMP_REPEAT_L2_188(call, data) call(188, data)
+#define _GMP_REPEAT_L2_190(call, data) _GMP_REPEAT_L2_189(call, data) call(189, data)
+#define _GMP_REPEAT_L2_191(call, data) _GMP_REPEAT_L2_190(call, data) call(190, data)
+#define _GMP_REPEAT_L2_192(call, data) _GMP_REPEAT_L2_191(call, data) call(191, data)
+#define _GMP_REPEAT_L2_193(call, data) _GMP_REPEAT_L2_192(call, data) call(192, data)
+#define _GMP_REPEAT_L2_194(call, data) _GMP_REPEAT_L2_193(call, data) call(193, data)
+#define _GMP_REPEAT_L2_195(call, data) _GMP_REPEAT_L2_194(call, data) call(194, data)
+#define _GMP_REPEAT_L2_196(call, data) _GMP_REPEAT_L2_195(call, data) call(195, data)
+#define _GMP_REPEAT_L2_197(call, data) _GMP_REPEAT_L2_196(call, data) call(196, data)
+#define _GMP_REPEAT_L2_198(call, data) _GMP_REPEAT_L2_197(call, data) call(197, data)
+#define _GMP_REPEAT_L2_199(call, data) _GMP_REPEAT_L2_198(call, data) call(198, data)
+#define _GMP_REPEAT_L2_200(call, data) _GMP_REPEAT_L2_199(call, data) call(199, data)
+#define _GMP_REPEAT_L2_201(call, data) _GMP_REPEAT_L2_200(call, data) call(200, data)
+#define _GMP_REPEAT_L2_202(call, data) _GMP_REPEAT_L2_201(call, data) call(201, data)
+#define _GMP_REPEAT_L2_203(call, data) _GMP_REPEAT_L2_202(call, data) call(202, data)
+#define _GMP_REPEAT_L2_204(call, data) _GMP_REPEAT_L2_203(call, data) call(203, data)
+#define _GMP_REPEAT_L2_205(call, data) _GMP_REPEAT_L2_204(call, data) call(204, data)
+#define _GMP_REPEAT_L2_206(call, data) _GMP_REPEAT_L2_205(call, data) call(205, data)
+#define _GMP_REPEAT_L2_207(call, data) _GMP_REPEAT_L2_206(call, data) call(206, data)
+#define _GMP_REPEAT_L2_208(call, data) _GMP_REPEAT_L2_207(call, data) call(207, data)
+#define _GMP_REPEAT_L2_209(call, data) _GMP_REPEAT_L2_208(call, data) call(208, data)
+#define _GMP_REPEAT_L2_210(call, data) _GMP_REPEAT_L2_209(call, data) call(209, data)
+#define _GMP_REPEAT_L2_211(call, data) _GMP_REPEAT_L2_210(call, data) call(210, data)
+#define _GMP_REPEAT_L2_212(call, data) _GMP_REPEAT_L2_211(call, data) call(211, data)
+#define _GMP_REPEAT_L2_213(call, data) _GMP_REPEAT_L2_212(call, data) call(212, data)
+#define _GMP_REPEAT_L2_214(call, data) _GMP_REPEAT_L2_213(call, data) call(213, data)
+#define _GMP_REPEAT_L2_215(call, data) _GMP_REPEAT_L2_214(call, data) call(214, data)
+#define _GMP_REPEAT_L2_216(call, data) _GMP_REPEAT_L2_215(call, data) call(215, data)
+#define _GMP_REPEAT_L2_217(call, data) _GMP_REPEAT_L2_216(call, data) call(216, data)
+#define _GMP_REPEAT_L2_218(call, data) _GMP_REPEAT_L2_217(call, data) call(217, data)
+#define _GMP_REPEAT_L2_219(call, data) _GMP_REPEAT_L2_218(call, data) call(218, data)
+#define _GMP_REPEAT_L2_220(call, data) _GMP_REPEAT_L2_219(call, data) call(219, data)
+#define _GMP_REPEAT_L2_221(call, data) _GMP_REPEAT_L2_220(call, data) call(220, data)
+#define _GMP_REPEAT_L2_222(call, data) _GMP_REPEAT_L2_221(call, data) call(221, data)
+#define _GMP_REPEAT_L2_223(call, data) _GMP_REPEAT_L2_222(call, data) call(222, data)
+#define _GMP_REPEAT_L2_224(call, data) _GMP_REPEAT_L2_223(call, data) call(223, data)
+#define _GMP_REPEAT_L2_225(call, data) _GMP_REPEAT_L2_224(call, data) call(224, data)
+#define _GMP_REPEAT_L2_226(call, data) _GMP_REPEAT_L2_225(call, data) call(225, data)
+#define _GMP_REPEAT_L2_227(call, data) _GMP_REPEAT_L2_226(call, data) call(226, data)
+#define _GMP_REPEAT_L2_228(call, data) _GMP_REPEAT_L2_227(call, data) call(227, data)
+#define _GMP_REPEAT_L2_229(call, data) _GMP_REPEAT_L2_228(call, data) call(228, data)
+#define _GMP_REPEAT_L2_230(call, data) _GMP_REPEAT_L2_229(call, data) call(229, data)
+#define _GMP_REPEAT_L2_231(call, data) _GMP_REPEAT_L2_230(call, data) call(230, data)
+#define _GMP_REPEAT_L2_232(call, data) _GMP_REPEAT_L2_231(call, data) call(231, data)
+#define _GMP_REPEAT_L2_233(call, data) _GMP_REPEAT_L2_232(call, data) call(232, data)
+#define _GMP_REPEAT_L2_234(call, data) _GMP_REPEAT_L2_233(call, data) call(233, data)
+#define _GMP_REPEAT_L2_235(call, data) _GMP_REPEAT_L2_234(call, data) call(234, data)
+#define _GMP_REPEAT_L2_236(call, data) _GMP_REPEAT_L2_235(call, data) call(235, data)
+#define _GMP_REPEAT_L2_237(call, data) _GMP_REPEAT_L2_236(call, data) call(236, data)
+#define _GMP_REPEAT_L2_238(call, data) _GMP_REPEAT_L2_237(call, data) call(237, data)
+#define _GMP_REPEAT_L2_239(call, data) _GMP_REPEAT_L2_238(call, data) call(238, data)
+#define _GMP_REPEAT_L2_240(call, data) _GMP_REPEAT_L2_239(call, data) call(239, data)
+#define _GMP_REPEAT_L2_241(call, data) _GMP_REPEAT_L2_240(call, data) call(240, data)
+#define _GMP_REPEAT_L2_242(call, data) _GMP_REPEAT_L2_241(call, data) call(241, data)
+#define _GMP_REPEAT_L2_243(call, data) _GMP_REPEAT_L2_242(call, data) call(242, data)
+#define _GMP_REPEAT_L2_244(call, data) _GMP_REPEAT_L2_243(call, data) call(243, data)
+#define _GMP_REPEAT_L2_245(call, data) _GMP_REPEAT_L2_244(call, data) call(244, data)
+#define _GMP_REPEAT_L2_246(call, data) _GMP_REPEAT_L2_245(call, data) call(245, data)
+#define _GMP_REPEAT_L2_247(call, data) _GMP_REPEAT_L2_246(call, data) call(246, data)
+#define _GMP_REPEAT_L2_248(call, data) _GMP_REPEAT_L2_247(call, data) call(247, data)
+#define _GMP_REPEAT_L2_249(call, data) _GMP_REPEAT_L2_248(call, data) call(248, data)
+#define _GMP_REPEAT_L2_250(call, data) _GMP_REPEAT_L2_249(call, data) call(249, data)
+#define _GMP_REPEAT_L2_251(call, data) _GMP_REPEAT_L2_250(call, data) call(250, data)
+#define _GMP_REPEAT_L2_252(call, data) _GMP_REPEAT_L2_251(call, data) call(251, data)
+#define _GMP_REPEAT_L2_253(call, data) _GMP_REPEAT_L2_252(call, data) call(252, data)
+#define _GMP_REPEAT_L2_254(call, data) _GMP_REPEAT_L2_253(call, data) call(253, data)
+#define _GMP_REPEAT_L2_255(call, data) _GMP_REPEAT_L2_254(call, data) call(254, data)
+#define _GMP_REPEAT_L2_256(call, data) _GMP_REPEAT_L2_255(call, data) call(255, data)
+#define _GMP_REPEAT_L2_257(call, data) _GMP_REPEAT_L2_256(call, data) call(256, data)
+#define _GMP_REPEAT_L2_258(call, data) _GMP_REPEAT_L2_257(call, data) call(257, data)
+#define _GMP_REPEAT_L2_259(call, data) _GMP_REPEAT_L2_258(call, data) call(258, data)
+#define _GMP_REPEAT_L2_260(call, data) _GMP_REPEAT_L2_259(call, data) call(259, data)
+#define _GMP_REPEAT_L2_261(call, data) _GMP_REPEAT_L2_260(call, data) call(260, data)
+#define _GMP_REPEAT_L2_262(call, data) _GMP_REPEAT_L2_261(call, data) call(261, data)
+#define _GMP_REPEAT_L2_263(call, data) _GMP_REPEAT_L2_262(call, data) call(262, data)
+#define _GMP_REPEAT_L2_264(call, data) _GMP_REPEAT_L2_263(call, data) call(263, data)
+#define _GMP_REPEAT_L2_265(call, data) _GMP_REPEAT_L2_264(call, data) call(264, data)
+#define _GMP_REPEAT_L2_266(call, data) _GMP_REPEAT_L2_265(call, data) call(265, data)
+#define _GMP_REPEAT_L2_267(call, data) _GMP_REPEAT_L2_266(call, data) call(266, data)
+#define _GMP_REPEAT_L2_268(call, data) _GMP_REPEAT_L2_267(call, data) call(267, data)
+#define _GMP_REPEAT_L2_269(call, data) _GMP_REPEAT_L2_268(call, data) call(268, data)
+#define _GMP_REPEAT_L2_270(call, data) _GMP_REPEAT_L2_269(call, data) call(269, data)
+#define _GMP_REPEAT_L2_271(call, data) _GMP_REPEAT_L2_270(call, data) call(270, data)
+#define _GMP_REPEAT_L2_272(call, data) _GMP_REPEAT_L2_271(call, data) call(271, data)
+#define _GMP_REPEAT_L2_273(call, data) _GMP_REPEAT_L2_272(call, data) call(272, data)
+#define _GMP_REPEAT_L2_274(call, data) _GMP_REPEAT_L2_273(call, data) call(273, data)
+#define _GMP_REPEAT_L2_275(call, data) _GMP_REPEAT_L2_274(call, data) call(274, data)
+#define _GMP_REPEAT_L2_276(call, data) _GMP_REPEAT_L2_275(call, data) call(275, data)
+#define _GMP_REPEAT_L2_277(call, data) _GMP_REPEAT_L2_276(call, data) call(276, data)
+#define _GMP_REPEAT_L2_278(call, data) _GMP_REPEAT_L2_277(call, data) call(277, data)
+#define _GMP_REPEAT_L2_279(call, data) _GMP_REPEAT_L2_278(call, data) call(278, data)
+#define _GMP_REPEAT_L2_280(call, data) _GMP_REPEAT_L2_279(call, data) call(279, data)
+#define _GMP_REPEAT_L2_281(call, data) _GMP_REPEAT_L2_280(call, data) call(280, data)
+#define _GMP_REPEAT_L2_282(call, data) _GMP_REPEAT_L2_281(call, data) call(281, data)
+#define _GMP_REPEAT_L2_283(call, data) _GMP_REPEAT_L2_282(call, data) call(282, data)
+#define _GMP_REPEAT_L2_284(call, data) _GMP_REPEAT_L2_283(call, data) call(283, data)
+#define _GMP_REPEAT_L2_285(call, data) _GMP_REPEAT_L2_284(call, data) call(284, data)
+#define _GMP_REPEAT_L2_286(call, data) _GMP_REPEAT_L2_285(call, data) call(285, data)
+#define _GMP_REPEAT_L2_287(call, data) _GMP_REPEAT_L2_286(call, data) call(286, data)
+#define _GMP_REPEAT_L2_288(call, data) _GMP_REPEAT_L2_287(call, data) call(287, data)
+#define _GMP_REPEAT_L2_289(call, data) _GMP_REPEAT_L2_288(call, data) call(288, data)
+#define _GMP_REPEAT_L2_290(call, data) _GMP_REPEAT_L2_289(call, data) call(289, data)
+#define _GMP_REPEAT_L2_291(call, data) _GMP_REPEAT_L2_290(call, data) call(290, data)
+#define _GMP_REPEAT_L2_292(call, data) _GMP_REPEAT_L2_291(call, data) call(291, data)
+#define _GMP_REPEAT_L2_293(call, data) _GMP_REPEAT_L2_292(call, data) call(292, data)
+#define _GMP_REPEAT_L2_294(call, data) _GMP_REPEAT_L2_293(call, data) call(293, data)
+#define _GMP_REPEAT_L2_295(call, data) _GMP_REPEAT_L2_294(call, data) call(294, data)
+#define _GMP_REPEAT_L2_296(call, data) _GMP_REPEAT_L2_295(call, data) call(295, data)
+#define _GMP_REPEAT_L2_297(call, data) _GMP_REPEAT_L2_296(call, data) call(296, data)
+#define _GMP_REPEAT_L2_298(call, data) _GMP_REPEAT_L2_297(call, data) call(297, data)
+#define _GMP_REPEAT_L2_299(call, data) _GMP_REPEAT_L2_298(call, data) call(298, data)
+#define _GMP_REPEAT_L2_300(call, data) _GMP_REPEAT_L2_299(call, data) call(299, data)
+#define _GMP_REPEAT_L2_301(call, data) _GMP_REPEAT_L2_300(call, data) call(300, data)
+#define _GMP_REPEAT_L2_302(call, data) _GMP_REPEAT_L2_301(call, data) call(301, data)
+#define _GMP_REPEAT_L2_303(call, data) _GMP_REPEAT_L2_302(call, data) call(302, data)
+#define _GMP_REPEAT_L2_304(call, data) _GMP_REPEAT_L2_303(call, data) call(303, data)
+#define _GMP_REPEAT_L2_305(call, data) _GMP_REPEAT_L2_304(call, data) call(304, data)
+#define _GMP_REPEAT_L2_306(call, data) _GMP_REPEAT_L2_305(call, data) call(305, data)
+#define _GMP_REPEAT_L2_307(call, data) _GMP_REPEAT_L2_306(call, data) call(306, data)
+#define _GMP_REPEAT_L2_308(call, data) _GMP_REPEAT_L2_307(call, data) call(307, data)
+#define _GMP_REPEAT_L2_309(call, data) _GMP_REPEAT_L2_308(call, data) call(308, data)
+#define _GMP_REPEAT_L2_310(call, data) _GMP_REPEAT_L2_309(call, data) call(309, data)
+#define _GMP_REPEAT_L2_311(call, data) _GMP_REPEAT_L2_310(call, data) call(310, data)
+#define _GMP_REPEAT_L2_312(call, data) _GMP_REPEAT_L2_311(call, data) call(311, data)
+#define _GMP_REPEAT_L2_313(call, data) _GMP_REPEAT_L2_312(call, data) call(312, data)
+#define _GMP_REPEAT_L2_314(call, data) _GMP_REPEAT_L2_313(call, data) call(313, data)
+#define _GMP_REPEAT_L2_315(call, data) _GMP_REPEAT_L2_314(call, data) call(314, data)
+#define _GMP_REPEAT_L2_316(call, data) _GMP_REPEAT_L2_315(call, data) call(315, data)
+#define _GMP_REPEAT_L2_317(call, data) _GMP_REPEAT_L2_316(call, data) call(316, data)
+#define _GMP_REPEAT_L2_318(call, data) _GMP_REPEAT_L2_317(call, data) call(317, data)
+#define _GMP_REPEAT_L2_319(call, data) _GMP_REPEAT_L2_318(call, data) call(318, data)
+#define _GMP_REPEAT_L2_320(call, data) _GMP_REPEAT_L2_319(call, data) call(319, data)
+#define _GMP_REPEAT_L2_321(call, data) _GMP_REPEAT_L2_320(call, data) call(320, data)
+#define _GMP_REPEAT_L2_322(call, data) _GMP_REPEAT_L2_321(call, data) call(321, data)
+#define _GMP_REPEAT_L2_323(call, data) _GMP_REPEAT_L2_322(call, data) call(322, data)
+#define _GMP_REPEAT_L2_324(call, data) _GMP_REPEAT_L2_323(call, data) call(323, data)
+#define _GMP_REPEAT_L2_325(call, data) _GMP_REPEAT_L2_324(call, data) call(324, data)
+#define _GMP_REPEAT_L2_326(call, data) _GMP_REPEAT_L2_325(call, data) call(325, data)
+#define _GMP_REPEAT_L2_327(call, data) _GMP_REPEAT_L2_326(call, data) call(326, data)
+#define _GMP_REPEAT_L2_328(call, data) _GMP_REPEAT_L2_327(call, data) call(327, data)
+#define _GMP_REPEAT_L2_329(call, data) _GMP_REPEAT_L2_328(call, data) call(328, data)
+#define _GMP_REPEAT_L2_330(call, data) _GMP_REPEAT_L2_329(call, data) call(329, data)
+#define _GMP_REPEAT_L2_331(call, data) _GMP_REPEAT_L2_330(call, data) call(330, data)
+#define _GMP_REPEAT_L2_332(call, data) _GMP_REPEAT_L2_331(call, data) call(331, data)
+#define _GMP_REPEAT_L2_333(call, data) _GMP_REPEAT_L2_332(call, data) call(332, data)
+#define _GMP_REPEAT_L2_334(call, data) _GMP_REPEAT_L2_333(call, data) call(333, data)
+#define _GMP_REPEAT_L2_335(call, data) _GMP_REPEAT_L2_334(call, data) call(334, data)
+#define _GMP_REPEAT_L2_336(call, data) _GMP_REPEAT_L2_335(call, data) call(335, data)
+#define _GMP_REPEAT_L2_337(call, data) _GMP_REPEAT_L2_336(call, data) call(336, data)
+#define _GMP_REPEAT_L2_338(call, data) _GMP_REPEAT_L2_337(call, data) call(337, data)
+#define _GMP_REPEAT_L2_339(call, data) _GMP_REPEAT_L2_338(call, data) call(338, data)
+#define _GMP_REPEAT_L2_340(call, data) _GMP_REPEAT_L2_339(call, data) call(339, data)
+#define _GMP_REPEAT_L2_341(call, data) _GMP_REPEAT_L2_340(call, data) call(340, data)
+#define _GMP_REPEAT_L2_342(call, data) _GMP_REPEAT_L2_341(call, data) call(341, data)
+#define _GMP_REPEAT_L2_343(call, data) _GMP_REPEAT_L2_342(call, data) call(342, data)
+#define _GMP_REPEAT_L2_344(call, data) _GMP_REPEAT_L2_343(call, data) call(343, data)
+#define _GMP_REPEAT_L2_345(call, data) _GMP_REPEAT_L2_344(call, data) call(344, data)
+#define _GMP_REPEAT_L2_346(call, data) _GMP_REPEAT_L2_345(call, data) call(345, data)
+#define _GMP_REPEAT_L2_347(call, data) _GMP_REPEAT_L2_346(call, data) call(346, data)
+#define _GMP_REPEAT_L2_348(call, data) _GMP_REPEAT_L2_347(call, data) call(347, data)
+#define _GMP_REPEAT_L2_349(call, data) _GMP_REPEAT_L2_348(call, data) call(348, data)
+#define _GMP_REPEAT_L2_350(call, data) _GMP_REPEAT_L2_349(call, data) call(349, data)
+#define _GMP_REPEAT_L2_351(call, data) _GMP_REPEAT_L2_350(call, data) call(350, data)
+#define _GMP_REPEAT_L2_352(call, data) _GMP_REPEAT_L2_351(call, data) call(351, data)
+#define _GMP_REPEAT_L2_353(call, data) _GMP_REPEAT_L2_352(call, data) call(352, data)
+#define _GMP_REPEAT_L2_354(call, data) _GMP_REPEAT_L2_353(call, data) call(353, data)
+#define _GMP_REPEAT_L2_355(call, data) _GMP_REPEAT_L2_354(call, data) call(354, data)
+#define _GMP_REPEAT_L2_356(call, data) _GMP_REPEAT_L2_355(call, data) call(355, data)
+#define _GMP_REPEAT_L2_357(call, data) _GMP_REPEAT_L2_356(call, data) call(356, data)
+#define _GMP_REPEAT_L2_358(call, data) _GMP_REPEAT_L2_357(call, data) call(357, data)
+#define _GMP_REPEAT_L2_359(call, data) _GMP_REPEAT_L2_358(call, data) call(358, data)
+#define _GMP_REPEAT_L2_360(call, data) _GMP_REPEAT_L2_359(call, data) call(359, data)
+#define _GMP_REPEAT_L2_361(call, data) _GMP_REPEAT_L2_360(call, data) call(360, data)
+#define _GMP_REPEAT_L2_362(call, data) _GMP_REPEAT_L2_361(call, data) call(361, data)
+#define _GMP_REPEAT_L2_363(call, data) _GMP_REPEAT_L2_362(call, data) call(362, data)
+#define _GMP_REPEAT_L2_364(call, data) _GMP_REPEAT_L2_363(call, data) call(363, data)
+#define _GMP_REPEAT_L2_365(call, data) _GMP_REPEAT_L2_364(call, data) call(364, data)
+#define _GMP_REPEAT_L2_366(call, data) _GMP_REPEAT_L2_365(call, data) call(365, data)
+#define _GMP_REPEAT_L2_367(call, data) _GMP_REPEAT_L2_366(call, data) call(366, data)
+#define _GMP_REPEAT_L2_368(call, data) _GMP_REPEAT_L2_367(call, data) call(367, data)
+#define _GMP_REPEAT_L2_369(call, data) _GMP_REPEAT_L2_368(call, data) call(368, data)
+#define _GMP_REPEAT_L2_370(call, data) _GMP_REPEAT_L2_369(call, data) call(369, data)
+#define _GMP_REPEAT_L2_371(call, data) _GMP_REPEAT_L2_370(call, data) call(370, data)
+#define _GMP_REPEAT_L2_372(call, data) _GMP_REPEAT_L2_371(call, data) call(371, data)
+#define _GMP_REPEAT_L2_373(call, data) _GMP_REPEAT_L2_372(call, data) call(372, data)
+#define _GMP_REPEAT_L2_374(call, data) _GMP_REPEAT_L2_373(call, data) call(373, data)
+#define _GMP_REPEAT_L2_375(call, data) _GMP_REPEAT_L2_374(call, data) call(374, data)
+#define _GMP_REPEAT_L2_376(call, data) _GMP_REPEAT_L2_375(call, data) call(375, data)
+#define _GMP_REPEAT_L2_377(call, data) _GMP_REPEAT_L2_376(call, data) call(376, data)
+#define _GMP_REPEAT_L2_378(call, data) _GMP_REPEAT_L2_377(call, data) call(377, data)
+#define _GMP_REPEAT_L2_379(call, data) _GMP_REPEAT_L2_378(call, data) call(378, data)
+#define _GMP_REPEAT_L2_380(call, data) _GMP_REPEAT_L2_379(call, data) call(379, data)
+#define _GMP_REPEAT_L2_381(call, data) _GMP_REPEAT_L2_380(call, data) call(380, data)
+#define _GMP_REPEAT_L2_382(call, data) _GMP_REPEAT_L2_381(call, data) call(381, data)
+#define _GMP_REPEAT_L2_383(call, data) _GMP_REPEAT_L2_382(call, data) call(382, data)
+#define _GMP_REPEAT_L2_384(call, data) _GMP_REPEAT_L2_383(call, data) call(383, data)
+#define _GMP_REPEAT_L2_385(call, data) _GMP_REPEAT_L2_384(call, data) call(384, data)
+#define _GMP_REPEAT_L2_386(call, data) _GMP_REPEAT_L2_385(call, data) call(385, data)
+#define _GMP_REPEAT_L2_387(call, data) _GMP_REPEAT_L2_386(call, data) call(386, data)
+#define _GMP_REPEAT_L2_388(call, data) _GMP_REPEAT_L2_387(call, data) call(387, data)
+#define _GMP_REPEAT_L2_389(call, data) _GMP_REPEAT_L2_388(call, data) call(388, data)
+#define _GMP_REPEAT_L2_390(call, data) _GMP_REPEAT_L2_389(call, data) call(389, data)
+#define _GMP_REPEAT_L2_391(call, data) _GMP_REPEAT_L2_390(call, data) call(390, data)
+#define _GMP_REPEAT_L2_392(call, data) _GMP_REPEAT_L2_391(call, data) call(391, data)
+#define _GMP_REPEAT_L2_393(call, data) _GMP_REPEAT_L2_392(call, data) call(392, data)
+#define _GMP_REPEAT_L2_394(call, data) _GMP_REPEAT_L2_393(call, data) call(393, data)
+#define _GMP_REPEAT_L2_395(call, data) _GMP_REPEAT_L2_394(call, data) call(394, data)
+#define _GMP_REPEAT_L2_396(call, data) _GMP_REPEAT_L2_395(call, data) call(395, data)
+#define _GMP_REPEAT_L2_397(call, data) _GMP_REPEAT_L2_396(call, data) call(396, data)
+#define _GMP_REPEAT_L2_398(call, data) _GMP_REPEAT_L2_397(call, data) call(397, data)
+#define _GMP_REPEAT_L2_399(call, data) _GMP_REPEAT_L2_398(call, data) call(398, data)
+#define _GMP_REPEAT_L2_400(call, data) _GMP_REPEAT_L2_399(call, data) call(399, data)
+#define _GMP_REPEAT_L2_401(call, data) _GMP_REPEAT_L2_400(call, data) call(400, data)
+#define _GMP_REPEAT_L2_402(call, data) _GMP_REPEAT_L2_401(call, data) call(401, data)
+#define _GMP_REPEAT_L2_403(call, data) _GMP_REPEAT_L2_402(call, data) call(402, data)
+#define _GMP_REPEAT_L2_404(call, data) _GMP_REPEAT_L2_403(call, data) call(403, data)
+#define _GMP_REPEAT_L2_405(call, data) _GMP_REPEAT_L2_404(call, data) call(404, data)
+#define _GMP_REPEAT_L2_406(call, data) _GMP_REPEAT_L2_405(call, data) call(405, data)
+#define _GMP_REPEAT_L2_407(call, data) _GMP_REPEAT_L2_406(call, data) call(406, data)
+#define _GMP_REPEAT_L2_408(call, data) _GMP_REPEAT_L2_407(call, data) call(407, data)
+#define _GMP_REPEAT_L2_409(call, data) _GMP_REPEAT_L2_408(call, data) call(408, data)
+#define _GMP_REPEAT_L2_410(call, data) _GMP_REPEAT_L2_409(call, data) call(409, data)
+#define _GMP_REPEAT_L2_411(call, data) _GMP_REPEAT_L2_410(call, data) call(410, data)
+#define _GMP_REPEAT_L2_412(call, data) _GMP_REPEAT_L2_411(call, data) call(411, data)
+#define _GMP_REPEAT_L2_413(call, data) _GMP_REPEAT_L2_412(call, data) call(412, data)
+#define _GMP_REPEAT_L2_414(call, data) _GMP_REPEAT_L2_413(call, data) call(413, data)
+#define _GMP_REPEAT_L2_415(call, data) _GMP_REPEAT_L2_414(call, data) call(414, data)
+#define _GMP_REPEAT_L2_416(call, data) _GMP_REPEAT_L2_415(call, data) call(415, data)
+#define _GMP_REPEAT_L2_417(call, data) _GMP_REPEAT_L2_416(call, data) call(416, data)
+#define _GMP_REPEAT_L2_418(call, data) _GMP_REPEAT_L2_417(call, data) call(417, data)
+#define _GMP_REPEAT_L2_419(call, data) _GMP_REPEAT_L2_418(call, data) call(418, data)
+#define _GMP_REPEAT_L2_420(call, data) _GMP_REPEAT_L2_419(call, data) call(419, data)
+#define _GMP_REPEAT_L2_421(call, data) _GMP_REPEAT_L2_420(call, data) call(420, data)
+#define _GMP_REPEAT_L2_422(call, data) _GMP_REPEAT_L2_421(call, data) call(421, data)
+#define _GMP_REPEAT_L2_423(call, data) _GMP_REPEAT_L2_422(call, data) call(422, data)
+#define _GMP_REPEAT_L2_424(call, data) _GMP_REPEAT_L2_423(call, data) call(423, data)
+#define _GMP_REPEAT_L2_425(call, data) _GMP_REPEAT_L2_424(call, data) call(424, data)
+#define _GMP_REPEAT_L2_426(call, data) _GMP_REPEAT_L2_425(call, data) call(425, data)
+#define _GMP_REPEAT_L2_427(call, data) _GMP_REPEAT_L2_426(call, data) call(426, data)
+#define _GMP_REPEAT_L2_428(call, data) _GMP_REPEAT_L2_427(call, data) call(427, data)
+#define _GMP_REPEAT_L2_429(call, data) _GMP_REPEAT_L2_428(call, data) call(428, data)
+#define _GMP_REPEAT_L2_430(call, data) _GMP_REPEAT_L2_429(call, data) call(429, data)
+#define _GMP_REPEAT_L2_431(call, data) _GMP_REPEAT_L2_430(call, data) call(430, data)
+#define _GMP_REPEAT_L2_432(call, data) _GMP_REPEAT_L2_431(call, data) call(431, data)
+#define _GMP_REPEAT_L2_433(call, data) _GMP_REPEAT_L2_432(call, data) call(432, data)
+#define _GMP_REPEAT_L2_434(call, data) _GMP_REPEAT_L2_433(call, data) call(433, data)
+#define _GMP_REPEAT_L2_435(call, data) _GMP_REPEAT_L2_434(call, data) call(434, data)
+#define _GMP_REPEAT_L2_436(call, data) _GMP_REPEAT_L2_435(call, data) call(435, data)
+#define _GMP_REPEAT_L2_437(call, data) _GMP_REPEAT_L2_436(call, data) call(436, data)
+#define _GMP_REPEAT_L2_438(call, data) _GMP_REPEAT_L2_437(call, data) call(437, data)
+#define _GMP_REPEAT_L2_439(call, data) _GMP_REPEAT_L2_438(call, data) call(438, data)
+#define _GMP_REPEAT_L2_440(call, data) _GMP_REPEAT_L2_439(call, data) call(439, data)
+#define _GMP_REPEAT_L2_441(call, data) _GMP_REPEAT_L2_440(call, data) call(440, data)
+#define _GMP_REPEAT_L2_442(call, data) _GMP_REPEAT_L2_441(call, data) call(441, data)
+#define _GMP_REPEAT_L2_443(call, data) _GMP_REPEAT_L2_442(call, data) call(442, data)
+#define _GMP_REPEAT_L2_444(call, data) _GMP_REPEAT_L2_443(call, data) call(443, data)
+#define _GMP_REPEAT_L2_445(call, data) _GMP_REPEAT_L2_444(call, data) call(444, data)
+#define _GMP_REPEAT_L2_446(call, data) _GMP_REPEAT_L2_445(call, data) call(445, data)
+#define _GMP_REPEAT_L2_447(call, data) _GMP_REPEAT_L2_446(call, data) call(446, data)
+#define _GMP_REPEAT_L2_448(call, data) _GMP_REPEAT_L2_447(call, data) call(447, data)
+#define _GMP_REPEAT_L2_449(call, data) _GMP_REPEAT_L2_448(call, data) call(448, data)
+#define _GMP_REPEAT_L2_450(call, data) _GMP_REPEAT_L2_449(call, data) call(449, data)
+#define _GMP_REPEAT_L2_451(call, data) _GMP_REPEAT_L2_450(call, data) call(450, data)
+#define _GMP_REPEAT_L2_452(call, data) _GMP_REPEAT_L2_451(call, data) call(451, data)
+#define _GMP_REPEAT_L2_453(call, data) _GMP_REPEAT_L2_452(call, data) call(452, data)
+#define _GMP_REPEAT_L2_454(call, data) _GMP_REPEAT_L2_453(call, data) call(453, data)
+#define _GMP_REPEAT_L2_455(call, data) _GMP_REPEAT_L2_454(call, data) call(454, data)
+#define _GMP_REPEAT_L2_456(call, data) _GMP_REPEAT_L2_455(call, data) call(455, data)
+#define _GMP_REPEAT_L2_457(call, data) _GMP_REPEAT_L2_456(call, data) call(456, data)
+#define _GMP_REPEAT_L2_458(call, data) _GMP_REPEAT_L2_457(call, data) call(457, data)
+#define _GMP_REPEAT_L2_459(call, data) _GMP_REPEAT_L2_458(call, data) call(458, data)
+#define _GMP_REPEAT_L2_460(call, data) _GMP_REPEAT_L2_459(call, data) call(459, data)
+#define _GMP_REPEAT_L2_461(call, data) _GMP_REPEAT_L2_460(call, data) call(460, data)
+#define _GMP_REPEAT_L2_462(call, data) _GMP_REPEAT_L2_461(call, data) call(461, data)
+#define _GMP_REPEAT_L2_463(call, data) _GMP_REPEAT_L2_462(call, data) call(462, data)
+#define _GMP_REPEAT_L2_464(call, data) _GMP_REPEAT_L2_463(call, data) call(463, data)
+#define _GMP_REPEAT_L2_465(call, data) _GMP_REPEAT_L2_464(call, data) call(464, data)
+#define _GMP_REPEAT_L2_466(call, data) _GMP_REPEAT_L2_465(call, data) call(465, data)
+#define _GMP_REPEAT_L2_467(call, data) _GMP_REPEAT_L2_466(call, data) call(466, data)
+#define _GMP_REPEAT_L2_468(call, data) _GMP_REPEAT_L2_467(call, data) call(467, data)
+#define _GMP_REPEAT_L2_469(call, data) _GMP_REPEAT_L2_468(call, data) call(468, data)
+#define _GMP_REPEAT_L2_470(call, data) _GMP_REPEAT_L2_469(call, data) call(469, data)
+#define _GMP_REPEAT_L2_471(call, data) _GMP_REPEAT_L2_470(call, data) call(470, data)
+#define _GMP_REPEAT_L2_472(call, data) _GMP_REPEAT_L2_471(call, data) call(471, data)
+#define _GMP_REPEAT_L2_473(call, data) _GMP_REPEAT_L2_472(call, data) call(472, data)
+#define _GMP_REPEAT_L2_474(call, data) _GMP_REPEAT_L2_473(call, data) call(473, data)
+#define _GMP_REPEAT_L2_475(call, data) _GMP_REPEAT_L2_474(call, data) call(474, data)
+#define _GMP_REPEAT_L2_476(call, data) _GMP_REPEAT_L2_475(call, data) call(475, data)
+#define _GMP_REPEAT_L2_477(call, data) _GMP_REPEAT_L2_476(call, data) call(476, data)
+#define _GMP_REPEAT_L2_478(call, data) _GMP_REPEAT_L2_477(call, data) call(477, data)
+#define _GMP_REPEAT_L2_479(call, data) _GMP_REPEAT_L2_478(call, data) call(478, data)
+#define _GMP_REPEAT_L2_480(call, data) _GMP_REPEAT_L2_479(call, data) call(479, data)
+#define _GMP_REPEAT_L2_481(call, data) _GMP_REPEAT_L2_480(call, data) call(480, data)
+#define _GMP_REPEAT_L2_482(call, data) _GMP_REPEAT_L2_481(call, data) call(481, data)
+#define _GMP_REPEAT_L2_483(call, data) _GMP_REPEAT_L2_482(call, data) call(482, data)
+#define _GMP_REPEAT_L2_484(call, data) _GMP_REPEAT_L2_483(call, data) call(483, data)
+#define _GMP_REPEAT_L2_485(call, data) _GMP_REPEAT_L2_484(call, data) call(484, data)
+#define _GMP_REPEAT_L2_486(call, data) _GMP_REPEAT_L2_485(call, data) call(485, data)
+#define _GMP_REPEAT_L2_487(call, data) _GMP_REPEAT_L2_486(call, data) call(486, data)
+#define _GMP_REPEAT_L2_488(call, data) _GMP_REPEAT_L2_487(call, data) call(487, data)
+#define _GMP_REPEAT_L2_489(call, data) _GMP_REPEAT_L2_488(call, data) call(488, data)
+#define _GMP_REPEAT_L2_490(call, data) _GMP_REPEAT_L2_489(call, data) call(489, data)
+#define _GMP_REPEAT_L2_491(call, data) _GMP_REPEAT_L2_490(call, data) call(490, data)
+#define _GMP_REPEAT_L2_492(call, data) _GMP_REPEAT_L2_491(call, data) call(491, data)
+#define _GMP_REPEAT_L2_493(call, data) _GMP_REPEAT_L2_492(call, data) call(492, data)
+#define _GMP_REPEAT_L2_494(call, data) _GMP_REPEAT_L2_493(call, data) call(493, data)
+#define _GMP_REPEAT_L2_495(call, data) _GMP_REPEAT_L2_494(call, data) call(494, data)
+#define _GMP_REPEAT_L2_496(call, data) _GMP_REPEAT_L2_495(call, data) call(495, data)
+#define _GMP_REPEAT_L2_497(call, data) _GMP_REPEAT_L2_496(call, data) call(496, data)
+#define _GMP_REPEAT_L2_498(call, data) _GMP_REPEAT_L2_497(call, data) call(497, data)
+#define _GMP_REPEAT_L2_499(call, data) _GMP_REPEAT_L2_498(call, data) call(498, data)
+#define _GMP_REPEAT_L2_500(call, data) _GMP_REPEAT_L2_499(call, data) call(499, data)
+#define _GMP_REPEAT_L2_501(call, data) _GMP_REPEAT_L2_500(call, data) call(500, data)
+#define _GMP_REPEAT_L2_502(call, data) _GMP_REPEAT_L2_501(call, data) call(501, data)
+#define _GMP_REPEAT_L2_503(call, data) _GMP_REPEAT_L2_502(call, data) call(502, data)
+#define _GMP_REPEAT_L2_504(call, data) _GMP_REPEAT_L2_503(call, data) call(503, data)
+#define _GMP_REPEAT_L2_505(call, data) _GMP_REPEAT_L2_504(call, data) call(504, data)
+#define _GMP_REPEAT_L2_506(call, data) _GMP_REPEAT_L2_505(call, data) call(505, data)
+#define _GMP_REPEAT_L2_507(call, data) _GMP_REPEAT_L2_506(call, data) call(506, data)
+#define _GMP_REPEAT_L2_508(call, data) _GMP_REPEAT_L2_507(call, data) call(507, data)
+#define _GMP_REPEAT_L2_509(call, data) _GMP_REPEAT_L2_508(call, data) call(508, data)
+#define _GMP_REPEAT_L2_510(call, data) _GMP_REPEAT_L2_509(call, data) call(509, data)
+#define _GMP_REPEAT_L2_511(call, data) _GMP_REPEAT_L2_510(call, data) call(510, data)
+#define _GMP_REPEAT_L2_512(call, data) _GMP_REPEAT_L2_511(call, data) call(511, data)
+#define _GMP_REPEAT_L2_513(call, data) _GMP_REPEAT_L2_512(call, data) call(512, data)
+#define _GMP_REPEAT_L2_514(call, data) _GMP_REPEAT_L2_513(call, data) call(513, data)
+#define _GMP_REPEAT_L2_515(call, data) _GMP_REPEAT_L2_514(call, data) call(514, data)
+#define _GMP_REPEAT_L2_516(call, data) _GMP_REPEAT_L2_515(call, data) call(515, data)
+#define _GMP_REPEAT_L2_517(call, data) _GMP_REPEAT_L2_516(call, data) call(516, data)
+#define _GMP_REPEAT_L2_518(call, data) _GMP_REPEAT_L2_517(call, data) call(517, data)
+#define _GMP_REPEAT_L2_519(call, data) _GMP_REPEAT_L2_518(call, data) call(518, data)
+#define _GMP_REPEAT_L2_520(call, data) _GMP_REPEAT_L2_519(call, data) call(519, data)
+#define _GMP_REPEAT_L2_521(call, data) _GMP_REPEAT_L2_520(call, data) call(520, data)
+#define _GMP_REPEAT_L2_522(call, data) _GMP_REPEAT_L2_521(call, data) call(521, data)
+#define _GMP_REPEAT_L2_523(call, data) _GMP_REPEAT_L2_522(call, data) call(522, data)
+#define _GMP_REPEAT_L2_524(call, data) _GMP_REPEAT_L2_523(call, data) call(523, data)
+#define _GMP_REPEAT_L2_525(call, data) _GMP_REPEAT_L2_524(call, data) call(524, data)
+#define _GMP_REPEAT_L2_526(call, data) _GMP_REPEAT_L2_525(call, data) call(525, data)
+#define _GMP_REPEAT_L2_527(call, data) _GMP_REPEAT_L2_526(call, data) call(526, data)
+#define _GMP_REPEAT_L2_528(call, data) _GMP_REPEAT_L2_527(call, data) call(527, data)
+#define _GMP_REPEAT_L2_529(call, data) _GMP_REPEAT_L2_528(call, data) call(528, data)
+#define _GMP_REPEAT_L2_530(call, data) _GMP_REPEAT_L2_529(call, data) call(529, data)
+#define _GMP_REPEAT_L2_531(call, data) _GMP_REPEAT_L2_530(call, data) call(530, data)
+#define _GMP_REPEAT_L2_532(call, data) _GMP_REPEAT_L2_531(call, data) call(531, data)
+#define _GMP_REPEAT_L2_533(call, data) _GMP_REPEAT_L2_532(call, data) call(532, data)
+#define _GMP_REPEAT_L2_534(call, data) _GMP_REPEAT_L2_533(call, data) call(533, data)
+#define _GMP_REPEAT_L2_535(call, data) _GMP_REPEAT_L2_534(call, data) call(534, data)
+#define _GMP_REPEAT_L2_536(call, data) _GMP_REPEAT_L2_535(call, data) call(535, data)
+#define _GMP_REPEAT_L2_537(call, data) _GMP_REPEAT_L2_536(call, data) call(536, data)
+#define _GMP_REPEAT_L2_538(call, data) _GMP_REPEAT_L2_537(call, data) call(537, data)
+#define _GMP_REPEAT_L2_539(call, data) _GMP_REPEAT_L2_538(call, data) call(538, data)
+#define _GMP_REPEAT_L2_540(call, data) _GMP_REPEAT_L2_539(call, data) call(539, data)
+#define _GMP_REPEAT_L2_541(call, data) _GMP_REPEAT_L2_540(call, data) call(540, data)
+#define _GMP_REPEAT_L2_542(call, data) _GMP_REPEAT_L2_541(call, data) call(541, data)
+#define _GMP_REPEAT_L2_543(call, data) _GMP_REPEAT_L2_542(call, data) call(542, data)
+#define _GMP_REPEAT_L2_544(call, data) _GMP_REPEAT_L2_543(call, data) call(543, data)
+#define _GMP_REPEAT_L2_545(call, data) _GMP_REPEAT_L2_544(call, data) call(544, data)
+#define _GMP_REPEAT_L2_546(call, data) _GMP_REPEAT_L2_545(call, data) call(545, data)
+#define _GMP_REPEAT_L2_547(call, data) _GMP_REPEAT_L2_546(call, data) call(546, data)
+#define _GMP_REPEAT_L2_548(call, data) _GMP_REPEAT_L2_547(call, data) call(547, data)
+#define _GMP_REPEAT_L2_549(call, data) _GMP_REPEAT_L2_548(call, data) call(548, data)
+#define _GMP_REPEAT_L2_550(call, data) _GMP_REPEAT_L2_549(call, data) call(549, data)
+#define _GMP_REPEAT_L2_551(call, data) _GMP_REPEAT_L2_550(call, data) call(550, data)
+#define _GMP_REPEAT_L2_552(call, data) _GMP_REPEAT_L2_551(call, data) call(551, data)
+#define _GMP_REPEAT_L2_553(call, data) _GMP_REPEAT_L2_552(call, data) call(552, data)
+#define _GMP_REPEAT_L2_554(call, data) _GMP_REPEAT_L2_553(call, data) call(553, data)
+#define _GMP_REPEAT_L2_555(call, data) _GMP_REPEAT_L2_554(call, data) call(554, data)
+#define _GMP_REPEAT_L2_556(call, data) _GMP_REPEAT_L2_555(call, data) call(555, data)
+#define _GMP_REPEAT_L2_557(call, data) _GMP_REPEAT_L2_556(call, data) call(556, data)
+#define _GMP_REPEAT_L2_558(call, data) _GMP_REPEAT_L2_557(call, data) call(557, data)
+#define _GMP_REPEAT_L2_559(call, data) _GMP_REPEAT_L2_558(call, data) call(558, data)
+#define _GMP_REPEAT_L2_560(call, data) _GMP_REPEAT_L2_559(call, data) call(559, data)
+#define _GMP_REPEAT_L2_561(call, data) _GMP_REPEAT_L2_560(call, data) call(560, data)
+#define _GMP_REPEAT_L2_562(call, data) _GMP_REPEAT_L2_561(call, data) call(561, data)
+#define _GMP_REPEAT_L2_563(call, data) _GMP_REPEAT_L2_562(call, data) call(562, data)
+#define _GMP_REPEAT_L2_564(call, data) _GMP_REPEAT_L2_563(call, data) call(563, data)
+#define _GMP_REPEAT_L2_565(call, data) _GMP_REPEAT_L2_564(call, data) call(564, data)
+#define _GMP_REPEAT_L2_566(call, data) _GMP_REPEAT_L2_565(call, data) call(565, data)
+#define _GMP_REPEAT_L2_567(call, data) _GMP_REPEAT_L2_566(call, data) call(566, data)
+#define _GMP_REPEAT_L2_568(call, data) _GMP_REPEAT_L2_567(call, data) call(567, data)
+#define _GMP_REPEAT_L2_569(call, data) _GMP_REPEAT_L2_568(call, data) call(568, data)
+#define _GMP_REPEAT_L2_570(call, data) _GMP_REPEAT_L2_569(call, data) call(569, data)
+#define _GMP_REPEAT_L2_571(call, data) _GMP_REPEAT_L2_570(call, data) call(570, data)
+#define _GMP_REPEAT_L2_572(call, data) _GMP_REPEAT_L2_571(call, data) call(571, data)
+#define _GMP_REPEAT_L2_573(call, data) _GMP_REPEAT_L2_572(call, data) call(572, data)
+#define _GMP_REPEAT_L2_574(call, data) _GMP_REPEAT_L2_573(call, data) call(573, data)
+#define _GMP_REPEAT_L2_575(call, data) _GMP_REPEAT_L2_574(call, data) call(574, data)
+#define _GMP_REPEAT_L2_576(call, data) _GMP_REPEAT_L2_575(call, data) call(575, data)
+#define _GMP_REPEAT_L2_577(call, data) _GMP_REPEAT_L2_576(call, data) call(576, data)
+#define _GMP_REPEAT_L2_578(call, data) _GMP_REPEAT_L2_577(call, data) call(577, data)
+#define _GMP_REPEAT_L2_579(call, data) _GMP_REPEAT_L2_578(call, data) call(578, data)
+#define _GMP_REPEAT_L2_580(call, data) _GMP_REPEAT_L2_579(call, data) call(579, data)
+#define _GMP_REPEAT_L2_581(call, data) _GMP_REPEAT_L2_580(call, data) call(580, data)
+#define _GMP_REPEAT_L2_582(call, data) _GMP_REPEAT_L2_581(call, data) call(581, data)
+#define _GMP_REPEAT_L2_583(call, data) _GMP_REPEAT_L2_582(call, data) call(582, data)
+#define _GMP_REPEAT_L2_584(call, data) _GMP_REPEAT_L2_583(call, data) call(583, data)
+#define _GMP_REPEAT_L2_585(call, data) _GMP_REPEAT_L2_584(call, data) call(584, data)
+#define _GMP_REPEAT_L2_586(call, data) _GMP_REPEAT_L2_585(call, data) call(585, data)
+#define _GMP_REPEAT_L2_587(call, data) _GMP_REPEAT_L2_586(call, data) call(586, data)
+#define _GMP_REPEAT_L2_588(call, data) _GMP_REPEAT_L2_587(call, data) call(587, data)
+#define _GMP_REPEAT_L2_589(call, data) _GMP_REPEAT_L2_588(call, data) call(588, data)
+#define _GMP_REPEAT_L2_590(call, data) _GMP_REPEAT_L2_589(call, data) call(589, data)
+#define _GMP_REPEAT_L2_591(call, data) _GMP_REPEAT_L2_590(call, data) call(590, data)
+#define _GMP_REPEAT_L2_592(call, data) _GMP_REPEAT_L2_591(call, data) call(591, data)
+#define _GMP_REPEAT_L2_593(call, data) _GMP_REPEAT_L2_592(call, data) call(592, data)
+#define _GMP_REPEAT_L2_594(call, data) _GMP_REPEAT_L2_593(call, data) call(593, data)
+#define _GMP_REPEAT_L2_595(call, data) _GMP_REPEAT_L2_594(call, data) call(594, data)
+#define _GMP_REPEAT_L2_596(call, data) _GMP_REPEAT_L2_595(call, data) call(595, data)
+#define _GMP_REPEAT_L2_597(call, data) _GMP_REPEAT_L2_596(call, data) call(596, data)
+#define _GMP_REPEAT_L2_598(call, data) _GMP_REPEAT_L2_597(call, data) call(597, data)
+#define _GMP_REPEAT_L2_599(call, data) _GMP_REPEAT_L2_598(call, data) call(598, data)
+#define _GMP_REPEAT_L2_600(call, data) _GMP_REPEAT_L2_599(call, data) call(599, data)
+#define _GMP_REPEAT_L2_601(call, data) _GMP_REPEAT_L2_600(call, data) call(600, data)
+#define _GMP_REPEAT_L2_602(call, data) _GMP_REPEAT_L2_601(call, data) call(601, data)
+#define _GMP_REPEAT_L2_603(call, data) _GMP_REPEAT_L2_602(call, data) call(602, data)
+#define _GMP_REPEAT_L2_604(call, data) _GMP_REPEAT_L2_603(call, data) call(603, data)
+#define _GMP_REPEAT_L2_605(call, data) _GMP_REPEAT_L2_604(call, data) call(604, data)
+#define _GMP_REPEAT_L2_606(call, data) _GMP_REPEAT_L2_605(call, data) call(605, data)
+#define _GMP_REPEAT_L2_607(call, data) _GMP_REPEAT_L2_606(call, data) call(606, data)
+#define _GMP_REPEAT_L2_608(call, data) _GMP_REPEAT_L2_607(call, data) call(607, data)
+#define _GMP_REPEAT_L2_609(call, data) _GMP_REPEAT_L2_608(call, data) call(608, data)
+#define _GMP_REPEAT_L2_610(call, data) _GMP_REPEAT_L2_609(call, data) call(609, data)
+#define _GMP_REPEAT_L2_611(call, data) _GMP_REPEAT_L2_610(call, data) call(610, data)
+#define _GMP_REPEAT_L2_612(call, data) _GMP_REPEAT_L2_611(call, data) call(611, data)
+#define _GMP_REPEAT_L2_613(call, data) _GMP_REPEAT_L2_612(call, data) call(612, data)
+#define _GMP_REPEAT_L2_614(call, data) _GMP_REPEAT_L2_613(call, data) call(613, data)
+#define _GMP_REPEAT_L2_615(call, data) _GMP_REPEAT_L2_614(call, data) call(614, data)
+#define _GMP_REPEAT_L2_616(call, data) _GMP_REPEAT_L2_615(call, data) call(615, data)
+#define _GMP_REPEAT_L2_617(call, data) _GMP_REPEAT_L2_616(call, data) call(616, data)
+#define _GMP_REPEAT_L2_618(call, data) _GMP_REPEAT_L2_617(call, data) call(617, data)
+#define _GMP_REPEAT_L2_619(call, data) _GMP_REPEAT_L2_618(call, data) call(618, data)
+#define _GMP_REPEAT_L2_620(call, data) _GMP_REPEAT_L2_619(call, data) call(619, data)
+#define _GMP_REPEAT_L2_621(call, data) _GMP_REPEAT_L2_620(call, data) call(620, data)
+#define _GMP_REPEAT_L2_622(call, data) _GMP_REPEAT_L2_621(call, data) call(621, data)
+#define _GMP_REPEAT_L2_623(call, data) _GMP_REPEAT_L2_622(call, data) call(622, data)
+#define _GMP_REPEAT_L2_624(call, data) _GMP_REPEAT_L2_623(call, data) call(623, data)
+#define _GMP_REPEAT_L2_625(call, data) _GMP_REPEAT_L2_624(call, data) call(624, data)
+#define _GMP_REPEAT_L2_626(call, data) _GMP_REPEAT_L2_625(call, data) call(625, data)
+#define _GMP_REPEAT_L2_627(call, data) _GMP_REPEAT_L2_626(call, data) call(626, data)
+#define _GMP_REPEAT_L2_628(call, data) _GMP_REPEAT_L2_627(call, data) call(627, data)
+#define _GMP_REPEAT_L2_629(call, data) _GMP_REPEAT_L2_628(call, data) call(628, data)
+#define _GMP_REPEAT_L2_630(call, data) _GMP_REPEAT_L2_629(call, data) call(629, data)
+#define _GMP_REPEAT_L2_631(call, data) _GMP_REPEAT_L2_630(call, data) call(630, data)
+#define _GMP_REPEAT_L2_632(call, data) _GMP_REPEAT_L2_631(call, data) call(631, data)
+#define _GMP_REPEAT_L2_633(call, data) _GMP_REPEAT_L2_632(call, data) call(632, data)
+#define _GMP_REPEAT_L2_634(call, data) _GMP_REPEAT_L2_633(call, data) call(633, data)
+#define _GMP_REPEAT_L2_635(call, data) _GMP_REPEAT_L2_634(call, data) call(634, data)
+#define _GMP_REPEAT_L2_636(call, data) _GMP_REPEAT_L2_635(call, data) call(635, data)
+#define _GMP_REPEAT_L2_637(call, data) _GMP_REPEAT_L2_636(call, data) call(636, data)
+#define _GMP_REPEAT_L2_638(call, data) _GMP_REPEAT_L2_637(call, data) call(637, data)
+#define _GMP_REPEAT_L2_639(call, data) _GMP_REPEAT_L2_638(call, data) call(638, data)
+#define _GMP_REPEAT_L2_640(call, data) _GMP_REPEAT_L2_639(call, data) call(639, data)
+#define _GMP_REPEAT_L2_641(call, data) _GMP_REPEAT_L2_640(call, data) call(640, data)
+#define _GMP_REPEAT_L2_642(call, data) _GMP_REPEAT_L2_641(call, data) call(641, data)
+#define _GMP_REPEAT_L2_643(call, data) _GMP_REPEAT_L2_642(call, data) call(642, data)
+#define _GMP_REPEAT_L2_644(call, data) _GMP_REPEAT_L2_643(call, data) call(643, data)
+#define _GMP_REPEAT_L2_645(call, data) _GMP_REPEAT_L2_644(call, data) call(644, data)
+#define _GMP_REPEAT_L2_646(call, data) _GMP_REPEAT_L2_645(call, data) call(645, data)
+#define _GMP_REPEAT_L2_647(call, data) _GMP_REPEAT_L2_646(call, data) call(646, data)
+#define _GMP_REPEAT_L2_648(call, data) _GMP_REPEAT_L2_647(call, data) call(647, data)
+#define _GMP_REPEAT_L2_649(call, data) _GMP_REPEAT_L2_648(call, data) call(648, data)
+#define _GMP_REPEAT_L2_650(call, data) _GMP_REPEAT_L2_649(call, data) call(649, data)
+#define _GMP_REPEAT_L2_651(call, data) _GMP_REPEAT_L2_650(call, data) call(650, data)
+#define _GMP_REPEAT_L2_652(call, data) _GMP_REPEAT_L2_651(call, data) call(651, data)
+#define _GMP_REPEAT_L2_653(call, data) _GMP_REPEAT_L2_652(call, data) call(652, data)
+#define _GMP_REPEAT_L2_654(call, data) _GMP_REPEAT_L2_653(call, data) call(653, data)
+#define _GMP_REPEAT_L2_655(call, data) _GMP_REPEAT_L2_654(call, data) call(654, data)
+#define _GMP_REPEAT_L2_656(call, data) _GMP_REPEAT_L2_655(call, data) call(655, data)
+#define _GMP_REPEAT_L2_657(call, data) _GMP_REPEAT_L2_656(call, data) call(656, data)
+#define _GMP_REPEAT_L2_658(call, data) _GMP_REPEAT_L2_657(call, data) call(657, data)
+#define _GMP_REPEAT_L2_659(call, data) _GMP_REPEAT_L2_658(call, data) call(658, data)
+#define _GMP_REPEAT_L2_660(call, data) _GMP_REPEAT_L2_659(call, data) call(659, data)
+#define _GMP_REPEAT_L2_661(call, data) _GMP_REPEAT_L2_660(call, data) call(660, data)
+#define _GMP_REPEAT_L2_662(call, data) _GMP_REPEAT_L2_661(call, data) call(661, data)
+#define _GMP_REPEAT_L2_663(call, data) _GMP_REPEAT_L2_662(call, data) call(662, data)
+#define _GMP_REPEAT_L2_664(call, data) _GMP_REPEAT_L2_663(call, data) call(663, data)
+#define _GMP_REPEAT_L2_665(call, data) _GMP_REPEAT_L2_664(call, data) call(664, data)
+#define _GMP_REPEAT_L2_666(call, data) _GMP_REPEAT_L2_665(call, data) call(665, data)
+#define _GMP_REPEAT_L2_667(call, data) _GMP_REPEAT_L2_666(call, data) call(666, data)
+#define _GMP_REPEAT_L2_668(call, data) _GMP_REPEAT_L2_667(call, data) call(667, data)
+#define _GMP_REPEAT_L2_669(call, data) _GMP_REPEAT_L2_668(call, data) call(668, data)
+#define _GMP_REPEAT_L2_670(call, data) _GMP_REPEAT_L2_669(call, data) call(669, data)
+#define _GMP_REPEAT_L2_671(call, data) _GMP_REPEAT_L2_670(call, data) call(670, data)
+#define _GMP_REPEAT_L2_672(call, data) _GMP_REPEAT_L2_671(call, data) call(671, data)
+#define _GMP_REPEAT_L2_673(call, data) _GMP_REPEAT_L2_672(call, data) call(672, data)
+#define _GMP_REPEAT_L2_674(call, data) _GMP_REPEAT_L2_673(call, data) call(673, data)
+#define _GMP_REPEAT_L2_675(call, data) _GMP_REPEAT_L2_674(call, data) call(674, data)
+#define _GMP_REPEAT_L2_676(call, data) _GMP_REPEAT_L2_675(call, data) call(675, data)
+#define _GMP_REPEAT_L2_677(call, data) _GMP_REPEAT_L2_676(call, data) call(676, data)
+#define _GMP_REPEAT_L2_678(call, data) _GMP_REPEAT_L2_677(call, data) call(677, data)
+#define _GMP_REPEAT_L2_679(call, data) _GMP_REPEAT_L2_678(call, data) call(678, data)
+#define _GMP_REPEAT_L2_680(call, data) _GMP_REPEAT_L2_679(call, data) call(679, data)
+#define _GMP_REPEAT_L2_681(call, data) _GMP_REPEAT_L2_680(call, data) call(680, data)
+#define _GMP_REPEAT_L2_682(call, data) _GMP_REPEAT_L2_681(call, data) call(681, data)
+#define _GMP_REPEAT_L2_683(call, data) _GMP_REPEAT_L2_682(call, data) call(682, data)
+#define _GMP_REPEAT_L2_684(call, data) _GMP_REPEAT_L2_683(call, data) call(683, data)
+#define _GMP_REPEAT_L2_685(call, data) _GMP_REPEAT_L2_684(call, data) call(684, data)
+#define _GMP_REPEAT_L2_686(call, data) _GMP_REPEAT_L2_685(call, data) call(685, data)
+#define _GMP_REPEAT_L2_687(call, data) _GMP_REPEAT_L2_686(call, data) call(686, data)
+#define _GMP_REPEAT_L2_688(call, data) _GMP_REPEAT_L2_687(call, data) call(687, data)
+#define _GMP_REPEAT_L2_689(call, data) _GMP_REPEAT_L2_688(call, data) call(688, data)
+#define _GMP_REPEAT_L2_690(call, data) _GMP_REPEAT_L2_689(call, data) call(689, data)
+#define _GMP_REPEAT_L2_691(call, data) _GMP_REPEAT_L2_690(call, data) call(690, data)
+#define _GMP_REPEAT_L2_692(call, data) _GMP_REPEAT_L2_691(call, data) call(691, data)
+#define _GMP_REPEAT_L2_693(call, data) _GMP_REPEAT_L2_692(call, data) call(692, data)
+#define _GMP_REPEAT_L2_694(call, data) _GMP_REPEAT_L2_693(call, data) call(693, data)
+#define _GMP_REPEAT_L2_695(call, data) _GMP_REPEAT_L2_694(call, data) call(694, data)
+#define _GMP_REPEAT_L2_696(call, data) _GMP_REPEAT_L2_695(call, data) call(695, data)
+#define _GMP_REPEAT_L2_697(call, data) _GMP_REPEAT_L2_696(call, data) call(696, data)
+#define _GMP_REPEAT_L2_698(call, data) _GMP_REPEAT_L2_697(call, data) call(697, data)
+#define _GMP_REPEAT_L2_699(call, data) _GMP_REPEAT_L2_698(call, data) call(698, data)
+#define _GMP_REPEAT_L2_700(call, data) _GMP_REPEAT_L2_699(call, data) call(699, data)
+#define _GMP_REPEAT_L2_701(call, data) _GMP_REPEAT_L2_700(call, data) call(700, data)
+#define _GMP_REPEAT_L2_702(call, data) _GMP_REPEAT_L2_701(call, data) call(701, data)
+#define _GMP_REPEAT_L2_703(call, data) _GMP_REPEAT_L2_702(call, data) call(702, data)
+#define _GMP_REPEAT_L2_704(call, data) _GMP_REPEAT_L2_703(call, data) call(703, data)
+#define _GMP_REPEAT_L2_705(call, data) _GMP_REPEAT_L2_704(call, data) call(704, data)
+#define _GMP_REPEAT_L2_706(call, data) _GMP_REPEAT_L2_705(call, data) call(705, data)
+#define _GMP_REPEAT_L2_707(call, data) _GMP_REPEAT_L2_706(call, data) call(706, data)
+#define _GMP_REPEAT_L2_708(call, data) _GMP_REPEAT_L2_707(call, data) call(707, data)
+#define _GMP_REPEAT_L2_709(call, data) _GMP_REPEAT_L2_708(call, data) call(708, data)
+#define _GMP_REPEAT_L2_710(call, data) _GMP_REPEAT_L2_709(call, data) call(709, data)
+#define _GMP_REPEAT_L2_711(call, data) _GMP_REPEAT_L2_710(call, data) call(710, data)
+#define _GMP_REPEAT_L2_712(call, data) _GMP_REPEAT_L2_711(call, data) call(711, data)
+#define _GMP_REPEAT_L2_713(call, data) _GMP_REPEAT_L2_712(call, data) call(712, data)
+#define _GMP_REPEAT_L2_714(call, data) _GMP_REPEAT_L2_713(call, data) call(713, data)
+#define _GMP_REPEAT_L2_715(call, data) _GMP_REPEAT_L2_714(call, data) call(714, data)
+#define _GMP_REPEAT_L2_716(call, data) _GMP_REPEAT_L2_715(call, data) call(715, data)
+#define _GMP_REPEAT_L2_717(call, data) _GMP_REPEAT_L2_716(call, data) call(716, data)
+#define _GMP_REPEAT_L2_718(call, data) _GMP_REPEAT_L2_717(call, data) call(717, data)
+#define _GMP_REPEAT_L2_719(call, data) _GMP_REPEAT_L2_718(call, data) call(718, data)
+#define _GMP_REPEAT_L2_720(call, data) _GMP_REPEAT_L2_719(call, data) call(719, data)
+#define _GMP_REPEAT_L2_721(call, data) _GMP_REPEAT_L2_720(call, data) call(720, data)
+#define _GMP_REPEAT_L2_722(call, data) _GMP_REPEAT_L2_721(call, data) call(721, data)
+#define _GMP_REPEAT_L2_723(call, data) _GMP_REPEAT_L2_722(call, data) call(722, data)
+#define _GMP_REPEAT_L2_724(call, data) _GMP_REPEAT_L2_723(call, data) call(723, data)
+#define _GMP_REPEAT_L2_725(call, data) _GMP_REPEAT_L2_724(call, data) call(724, data)
+#define _GMP_REPEAT_L2_726(call, data) _GMP_REPEAT_L2_725(call, data) call(725, data)
+#define _GMP_REPEAT_L2_727(call, data) _GMP_REPEAT_L2_726(call, data) call(726, data)
+#define _GMP_REPEAT_L2_728(call, data) _GMP_REPEAT_L2_727(call, data) call(727, data)
+#define _GMP_REPEAT_L2_729(call, data) _GMP_REPEAT_L2_728(call, data) call(728, data)
+#define _GMP_REPEAT_L2_730(call, data) _GMP_REPEAT_L2_729(call, data) call(729, data)
+#define _GMP_REPEAT_L2_731(call, data) _GMP_REPEAT_L2_730(call, data) call(730, data)
+#define _GMP_REPEAT_L2_732(call, data) _GMP_REPEAT_L2_731(call, data) call(731, data)
+#define _GMP_REPEAT_L2_733(call, data) _GMP_REPEAT_L2_732(call, data) call(732, data)
+#define _GMP_REPEAT_L2_734(call, data) _GMP_REPEAT_L2_733(call, data) call(733, data)
+#define _GMP_REPEAT_L2_735(call, data) _GMP_REPEAT_L2_734(call, data) call(734, data)
+#define _GMP_REPEAT_L2_736(call, data) _GMP_REPEAT_L2_735(call, data) call(735, data)
+#define _GMP_REPEAT_L2_737(call, data) _GMP_REPEAT_L2_736(call, data) call(736, data)
+#define _GMP_REPEAT_L2_738(call, data) _GMP_REPEAT_L2_737(call, data) call(737, data)
+#define _GMP_REPEAT_L2_739(call, data) _GMP_REPEAT_L2_738(call, data) call(738, data)
+#define _GMP_REPEAT_L2_740(call, data) _GMP_REPEAT_L2_739(call, data) call(739, data)
+#define _GMP_REPEAT_L2_741(call, data) _GMP_REPEAT_L2_740(call, data) call(740, data)
+#define _GMP_REPEAT_L2_742(call, data) _GMP_REPEAT_L2_741(call, data) call(741, data)
+#define _GMP_REPEAT_L2_743(call, data) _GMP_REPEAT_L2_742(call, data) call(742, data)
+#define _GMP_REPEAT_L2_744(call, data) _GMP_REPEAT_L2_743(call, data) call(743, data)
+#define _GMP_REPEAT_L2_745(call, data) _GMP_REPEAT_L2_744(call, data) call(744, data)
+#define _GMP_REPEAT_L2_746(call, data) _GMP_REPEAT_L2_745(call, data) call(745, data)
+#define _GMP_REPEAT_L2_747(call, data) _GMP_REPEAT_L2_746(call, data) call(746, data)
+#define _GMP_REPEAT_L2_748(call, data) _GMP_REPEAT_L2_747(call, data) call(747, data)
+#define _GMP_REPEAT_L2_749(call, data) _GMP_REPEAT_L2_748(call, data) call(748, data)
+#define _GMP_REPEAT_L2_750(call, data) _GMP_REPEAT_L2_749(call, data) call(749, data)
+#define _GMP_REPEAT_L2_751(call, data) _GMP_REPEAT_L2_750(call, data) call(750, data)
+#define _GMP_REPEAT_L2_752(call, data) _GMP_REPEAT_L2_751(call, data) call(751, data)
+#define _GMP_REPEAT_L2_753(call, data) _GMP_REPEAT_L2_752(call, data) call(752, data)
+#define _GMP_REPEAT_L2_754(call, data) _GMP_REPEAT_L2_753(call, data) call(753, data)
+#define _GMP_REPEAT_L2_755(call, data) _GMP_REPEAT_L2_754(call, data) call(754, data)
+#define _GMP_REPEAT_L2_756(call, data) _GMP_REPEAT_L2_755(call, data) call(755, data)
+#define _GMP_REPEAT_L2_757(call, data) _GMP_REPEAT_L2_756(call, data) call(756, data)
+#define _GMP_REPEAT_L2_758(call, data) _GMP_REPEAT_L2_757(call, data) call(757, data)
+#define _GMP_REPEAT_L2_759(call, data) _GMP_REPEAT_L2_758(call, data) call(758, data)
+#define _GMP_REPEAT_L2_760(call, data) _GMP_REPEAT_L2_759(call, data) call(759, data)
+#define _GMP_REPEAT_L2_761(call, data) _GMP_REPEAT_L2_760(call, data) call(760, data)
+#define _GMP_REPEAT_L2_762(call, data) _GMP_REPEAT_L2_761(call, data) call(761, data)
+#define _GMP_REPEAT_L2_763(call, data) _GMP_REPEAT_L2_762(call, data) call(762, data)
+#define _GMP_REPEAT_L2_764(call, data) _GMP_REPEAT_L2_763(call, data) call(763, data)
+#define _GMP_REPEAT_L2_765(call, data) _GMP_REPEAT_L2_764(call, data) call(764, data)
+#define _GMP_REPEAT_L2_766(call, data) _GMP_REPEAT_L2_765(call, data) call(765, data)
+#define _GMP_REPEAT_L2_767(call, data) _GMP_REPEAT_L2_766(call, data) call(766, data)
+#define _GMP_REPEAT_L2_768(call, data) _GMP_REPEAT_L2_767(call, data) call(767, data)
+#define _GMP_REPEAT_L2_769(call, data) _GMP_REPEAT_L2_768(call, data) call(768, data)
+#define _GMP_REPEAT_L2_770(call, data) _GMP_REPEAT_L2_769(call, data) call(769, data)
+#define _GMP_REPEAT_L2_771(call, data) _GMP_REPEAT_L2_770(call, data) call(770, data)
+#define _GMP_REPEAT_L2_772(call, data) _GMP_REPEAT_L2_771(call, data) call(771, data)
+#define _GMP_REPEAT_L2_773(call, data) _GMP_REPEAT_L2_772(call, data) call(772, data)
+#define _GMP_REPEAT_L2_774(call, data) _GMP_REPEAT_L2_773(call, data) call(773, data)
+#define _GMP_REPEAT_L2_775(call, data) _GMP_REPEAT_L2_774(call, data) call(774, data)
+#define _GMP_REPEAT_L2_776(call, data) _GMP_REPEAT_L2_775(call, data) call(775, data)
+#define _GMP_REPEAT_L2_777(call, data) _GMP_REPEAT_L2_776(call, data) call(776, data)
+#define _GMP_REPEAT_L2_778(call, data) _GMP_REPEAT_L2_777(call, data) call(777, data)
+#define _GMP_REPEAT_L2_779(call, data) _GMP_REPEAT_L2_778(call, data) call(778, data)
+#define _GMP_REPEAT_L2_780(call, data) _GMP_REPEAT_L2_779(call, data) call(779, data)
+#define _GMP_REPEAT_L2_781(call, data) _GMP_REPEAT_L2_780(call, data) call(780, data)
+#define _GMP_REPEAT_L2_782(call, data) _GMP_REPEAT_L2_781(call, data) call(781, data)
+#define _GMP_REPEAT_L2_783(call, data) _GMP_REPEAT_L2_782(call, data) call(782, data)
+#define _GMP_REPEAT_L2_784(call, data) _GMP_REPEAT_L2_783(call, data) call(783, data)
+#define _GMP_REPEAT_L2_785(call, data) _GMP_REPEAT_L2_784(call, data) call(784, data)
+#define _GMP_REPEAT_L2_786(call, data) _GMP_REPEAT_L2_785(call, data) call(785, data)
+#define _GMP_REPEAT_L2_787(call, data) _GMP_REPEAT_L2_786(call, data) call(786, data)
+#define _GMP_REPEAT_L2_788(call, data) _GMP_REPEAT_L2_787(call, data) call(787, data)
+#define _GMP_REPEAT_L2_789(call, data) _GMP_REPEAT_L2_788(call, data) call(788, data)
+#define _GMP_REPEAT_L2_790(call, data) _GMP_REPEAT_L2_789(call, data) call(789, data)
+#define _GMP_REPEAT_L2_791(call, data) _GMP_REPEAT_L2_790(call, data) call(790, data)
+#define _GMP_REPEAT_L2_792(call, data) _GMP_REPEAT_L2_791(call, data) call(791, data)
+#define _GMP_REPEAT_L2_793(call, data) _GMP_REPEAT_L2_792(call, data) call(792, data)
+#define _GMP_REPEAT_L2_794(call, data) _GMP_REPEAT_L2_793(call, data) call(793, data)
+#define _GMP_REPEAT_L2_795(call, data) _GMP_REPEAT_L2_794(call, data) call(794, data)
+#define _GMP_REPEAT_L2_796(call, data) _GMP_REPEAT_L2_795(call, data) call(795, data)
+#define _GMP_REPEAT_L2_797(call, data) _GMP_REPEAT_L2_796(call, data) call(796, data)
+#define _GMP_REPEAT_L2_798(call, data) _GMP_REPEAT_L2_797(call, data) call(797, data)
+#define _GMP_REPEAT_L2_799(call, data) _GMP_REPEAT_L2_798(call, data) call(798, data)
+#define _GMP_REPEAT_L2_800(call, data) _GMP_REPEAT_L2_799(call, data) call(799, data)
+#define _GMP_REPEAT_L2_801(call, data) _GMP_REPEAT_L2_800(call, data) call(800, data)
+#define _GMP_REPEAT_L2_802(call, data) _GMP_REPEAT_L2_801(call, data) call(801, data)
+#define _GMP_REPEAT_L2_803(call, data) _GMP_REPEAT_L2_802(call, data) call(802, data)
+#define _GMP_REPEAT_L2_804(call, data) _GMP_REPEAT_L2_803(call, data) call(803, data)
+#define _GMP_REPEAT_L2_805(call, data) _GMP_REPEAT_L2_804(call, data) call(804, data)
+#define _GMP_REPEAT_L2_806(call, data) _GMP_REPEAT_L2_805(call, data) call(805, data)
+#define _GMP_REPEAT_L2_807(call, data) _GMP_REPEAT_L2_806(call, data) call(806, data)
+#define _GMP_REPEAT_L2_808(call, data) _GMP_REPEAT_L2_807(call, data) call(807, data)
+#define _GMP_REPEAT_L2_809(call, data) _GMP_REPEAT_L2_808(call, data) call(808, data)
+#define _GMP_REPEAT_L2_810(call, data) _GMP_REPEAT_L2_809(call, data) call(809, data)
+#define _GMP_REPEAT_L2_811(call, data) _GMP_REPEAT_L2_810(call, data) call(810, data)
+#define _GMP_REPEAT_L2_812(call, data) _GMP_REPEAT_L2_811(call, data) call(811, data)
+#define _GMP_REPEAT_L2_813(call, data) _GMP_REPEAT_L2_812(call, data) call(812, data)
+#define _GMP_REPEAT_L2_814(call, data) _GMP_REPEAT_L2_813(call, data) call(813, data)
+#define _GMP_REPEAT_L2_815(call, data) _GMP_REPEAT_L2_814(call, data) call(814, data)
+#define _GMP_REPEAT_L2_816(call, data) _GMP_REPEAT_L2_815(call, data) call(815, data)
+#define _GMP_REPEAT_L2_817(call, data) _GMP_REPEAT_L2_816(call, data) call(816, data)
+#define _GMP_REPEAT_L2_818(call, data) _GMP_REPEAT_L2_817(call, data) call(817, data)
+#define _GMP_REPEAT_L2_819(call, data) _GMP_REPEAT_L2_818(call, data) call(818, data)
+#define _GMP_REPEAT_L2_820(call, data) _GMP_REPEAT_L2_819(call, data) call(819, data)
+#define _GMP_REPEAT_L2_821(call, data) _GMP_REPEAT_L2_820(call, data) call(820, data)
+#define _GMP_REPEAT_L2_822(call, data) _GMP_REPEAT_L2_821(call, data) call(821, data)
+#define _GMP_REPEAT_L2_823(call, data) _GMP_REPEAT_L2_822(call, data) call(822, data)
+#define _GMP_REPEAT_L2_824(call, data) _GMP_REPEAT_L2_823(call, data) call(823, data)
+#define _GMP_REPEAT_L2_825(call, data) _GMP_REPEAT_L2_824(call, data) call(824, data)
+#define _GMP_REPEAT_L2_826(call, data) _GMP_REPEAT_L2_825(call, data) call(825, data)
+#define _GMP_REPEAT_L2_827(call, data) _GMP_REPEAT_L2_826(call, data) call(826, data)
+#define _GMP_REPEAT_L2_828(call, data) _GMP_REPEAT_L2_827(call, data) call(827, data)
+#define _GMP_REPEAT_L2_829(call, data) _GMP_REPEAT_L2_828(call, data) call(828, data)
+#define _GMP_REPEAT_L2_830(call, data) _GMP_REPEAT_L2_829(call, data) call(829, data)
+#define _GMP_REPEAT_L2_831(call, data) _GMP_REPEAT_L2_830(call, data) call(830, data)
+#define _GMP_REPEAT_L2_832(call, data) _GMP_REPEAT_L2_831(call, data) call(831, data)
+#define _GMP_REPEAT_L2_833(call, data) _GMP_REPEAT_L2_832(call, data) call(832, data)
+#define _GMP_REPEAT_L2_834(call, data) _GMP_REPEAT_L2_833(call, data) call(833, data)
+#define _GMP_REPEAT_L2_835(call, data) _GMP_REPEAT_L2_834(call, data) call(834, data)
+#define _GMP_REPEAT_L2_836(call, data) _GMP_REPEAT_L2_835(call, data) call(835, data)
+#define _GMP_REPEAT_L2_837(call, data) _GMP_REPEAT_L2_836(call, data) call(836, data)
+#define _GMP_REPEAT_L2_838(call, data) _GMP_REPEAT_L2_837(call, data) call(837, data)
+#define _GMP_REPEAT_L2_839(call, data) _GMP_REPEAT_L2_838(call, data) call(838, data)
+#define _GMP_REPEAT_L2_840(call, data) _GMP_REPEAT_L2_839(call, data) call(839, data)
+#define _GMP_REPEAT_L2_841(call, data) _GMP_REPEAT_L2_840(call, data) call(840, data)
+#define _GMP_REPEAT_L2_842(call, data) _GMP_REPEAT_L2_841(call, data) call(841, data)
+#define _GMP_REPEAT_L2_843(call, data) _GMP_REPEAT_L2_842(call, data) call(842, data)
+#define _GMP_REPEAT_L2_844(call, data) _GMP_REPEAT_L2_843(call, data) call(843, data)
+#define _GMP_REPEAT_L2_845(call, data) _GMP_REPEAT_L2_844(call, data) call(844, data)
+#define _GMP_REPEAT_L2_846(call, data) _GMP_REPEAT_L2_845(call, data) call(845, data)
+#define _GMP_REPEAT_L2_847(call, data) _GMP_REPEAT_L2_846(call, data) call(846, data)
+#define _GMP_REPEAT_L2_848(call, data) _GMP_REPEAT_L2_847(call, data) call(847, data)
+#define _GMP_REPEAT_L2_849(call, data) _GMP_REPEAT_L2_848(call, data) call(848, data)
+#define _GMP_REPEAT_L2_850(call, data) _GMP_REPEAT_L2_849(call, data) call(849, data)
+#define _GMP_REPEAT_L2_851(call, data) _GMP_REPEAT_L2_850(call, data) call(850, data)
+#define _GMP_REPEAT_L2_852(call, data) _GMP_REPEAT_L2_851(call, data) call(851, data)
+#define _GMP_REPEAT_L2_853(call, data) _GMP_REPEAT_L2_852(call, data) call(852, data)
+#define _GMP_REPEAT_L2_854(call, data) _GMP_REPEAT_L2_853(call, data) call(853, data)
+#define _GMP_REPEAT_L2_855(call, data) _GMP_REPEAT_L2_854(call, data) call(854, data)
+#define _GMP_REPEAT_L2_856(call, data) _GMP_REPEAT_L2_855(call, data) call(855, data)
+#define _GMP_REPEAT_L2_857(call, data) _GMP_REPEAT_L2_856(call, data) call(856, data)
+#define _GMP_REPEAT_L2_858(call, data) _GMP_REPEAT_L2_857(call, data) call(857, data)
+#define _GMP_REPEAT_L2_859(call, data) _GMP_REPEAT_L2_858(call, data) call(858, data)
+#define _GMP_REPEAT_L2_860(call, data) _GMP_REPEAT_L2_859(call, data) call(859, data)
+#define _GMP_REPEAT_L2_861(call, data) _GMP_REPEAT_L2_860(call, data) call(860, data)
+#define _GMP_REPEAT_L2_862(call, data) _GMP_REPEAT_L2_861(call, data) call(861, data)
+#define _GMP_REPEAT_L2_863(call, data) _GMP_REPEAT_L2_862(call, data) call(862, data)
+#define _GMP_REPEAT_L2_864(call, data) _GMP_REPEAT_L2_863(call, data) call(863, data)
+#define _GMP_REPEAT_L2_865(call, data) _GMP_REPEAT_L2_864(call, data) call(864, data)
+#define _GMP_REPEAT_L2_866(call, data) _GMP_REPEAT_L2_865(call, data) call(865, data)
+#define _GMP_REPEAT_L2_867(call, data) _GMP_REPEAT_L2_866(call, data) call(866, data)
+#define _GMP_REPEAT_L2_868(call, data) _GMP_REPEAT_L2_867(call, data) call(867, data)
+#define _GMP_REPEAT_L2_869(call, data) _GMP_REPEAT_L2_868(call, data) call(868, data)
+#define _GMP_REPEAT_L2_870(call, data) _GMP_REPEAT_L2_869(call, data) call(869, data)
+#define _GMP_REPEAT_L2_871(call, data) _GMP_REPEAT_L2_870(call, data) call(870, data)
+#define _GMP_REPEAT_L2_872(call, data) _GMP_REPEAT_L2_871(call, data) call(871, data)
+#define _GMP_REPEAT_L2_873(call, data) _GMP_REPEAT_L2_872(call, data) call(872, data)
+#define _GMP_REPEAT_L2_874(call, data) _GMP_REPEAT_L2_873(call, data) call(873, data)
+#define _GMP_REPEAT_L2_875(call, data) _GMP_REPEAT_L2_874(call, data) call(874, data)
+#define _GMP_REPEAT_L2_876(call, data) _GMP_REPEAT_L2_875(call, data) call(875, data)
+#define _GMP_REPEAT_L2_877(call, data) _GMP_REPEAT_L2_876(call, data) call(876, data)
+#define _GMP_REPEAT_L2_878(call, data) _GMP_REPEAT_L2_877(call, data) call(877, data)
+#define _GMP_REPEAT_L2_879(call, data) _GMP_REPEAT_L2_878(call, data) call(878, data)
+#define _GMP_REPEAT_L2_880(call, data) _GMP_REPEAT_L2_879(call, data) call(879, data)
+#define _GMP_REPEAT_L2_881(call, data) _GMP_REPEAT_L2_880(call, data) call(880, data)
+#define _GMP_REPEAT_L2_882(call, data) _GMP_REPEAT_L2_881(call, data) call(881, data)
+#define _GMP_REPEAT_L2_883(call, data) _GMP_REPEAT_L2_882(call, data) call(882, data)
+#define _GMP_REPEAT_L2_884(call, data) _GMP_REPEAT_L2_883(call, data) call(883, data)
+#define _GMP_REPEAT_L2_885(call, data) _GMP_REPEAT_L2_884(call, data) call(884, data)
+#define _GMP_REPEAT_L2_886(call, data) _GMP_REPEAT_L2_885(call, data) call(885, data)
+#define _GMP_REPEAT_L2_887(call, data) _GMP_REPEAT_L2_886(call, data) call(886, data)
+#define _GMP_REPEAT_L2_888(call, data) _GMP_REPEAT_L2_887(call, data) call(887, data)
+#define _GMP_REPEAT_L2_889(call, data) _GMP_REPEAT_L2_888(call, data) call(888, data)
+#define _GMP_REPEAT_L2_890(call, data) _GMP_REPEAT_L2_889(call, data) call(889, data)
+#define _GMP_REPEAT_L2_891(call, data) _GMP_REPEAT_L2_890(call, data) call(890, data)
+#define _GMP_REPEAT_L2_892(call, data) _GMP_REPEAT_L2_891(call, data) call(891, data)
+#define _GMP_REPEAT_L2_893(call, data) _GMP_REPEAT_L2_892(call, data) call(892, data)
+#define _GMP_REPEAT_L2_894(call, data) _GMP_REPEAT_L2_893(call, data) call(893, data)
+#define _GMP_REPEAT_L2_895(call, data) _GMP_REPEAT_L2_894(call, data) call(894, data)
+#define _GMP_REPEAT_L2_896(call, data) _GMP_REPEAT_L2_895(call, data) call(895, data)
+#define _GMP_REPEAT_L2_897(call, data) _GMP_REPEAT_L2_896(call, data) call(896, data)
+#define _GMP_REPEAT_L2_898(call, data) _GMP_REPEAT_L2_897(call, data) call(897, data)
+#define _GMP_REPEAT_L2_899(call, data) _GMP_REPEAT_L2_898(call, data) call(898, data)
+#define _GMP_REPEAT_L2_900(call, data) _GMP_REPEAT_L2_899(call, data) call(899, data)
+#define _GMP_REPEAT_L2_901(call, data) _GMP_REPEAT_L2_900(call, data) call(900, data)
+#define _GMP_REPEAT_L2_902(call, data) _GMP_REPEAT_L2_901(call, data) call(901, data)
+#define _GMP_REPEAT_L2_903(call, data) _GMP_REPEAT_L2_902(call, data) call(902, data)
+#define _GMP_REPEAT_L2_904(call, data) _GMP_REPEAT_L2_903(call, data) call(903, data)
+#define _GMP_REPEAT_L2_905(call, data) _GMP_REPEAT_L2_904(call, data) call(904, data)
+#define _GMP_REPEAT_L2_906(call, data) _GMP_REPEAT_L2_905(call, data) call(905, data)
+#define _GMP_REPEAT_L2_907(call, data) _GMP_REPEAT_L2_906(call, data) call(906, data)
+#define _GMP_REPEAT_L2_908(call, data) _GMP_REPEAT_L2_907(call, data) call(907, data)
+#define _GMP_REPEAT_L2_909(call, data) _GMP_REPEAT_L2_908(call, data) call(908, data)
+#define _GMP_REPEAT_L2_910(call, data) _GMP_REPEAT_L2_909(call, data) call(909, data)
+#define _GMP_REPEAT_L2_911(call, data) _GMP_REPEAT_L2_910(call, data) call(910, data)
+#define _GMP_REPEAT_L2_912(call, data) _GMP_REPEAT_L2_911(call, data) call(911, data)
+#define _GMP_REPEAT_L2_913(call, data) _GMP_REPEAT_L2_912(call, data) call(912, data)
+#define _GMP_REPEAT_L2_914(call, data) _GMP_REPEAT_L2_913(call, data) call(913, data)
+#define _GMP_REPEAT_L2_915(call, data) _GMP_REPEAT_L2_914(call, data) call(914, data)
+#define _GMP_REPEAT_L2_916(call, data) _GMP_REPEAT_L2_915(call, data) call(915, data)
+#define _GMP_REPEAT_L2_917(call, data) _GMP_REPEAT_L2_916(call, data) call(916, data)
+#define _GMP_REPEAT_L2_918(call, data) _GMP_REPEAT_L2_917(call, data) call(917, data)
+#define _GMP_REPEAT_L2_919(call, data) _GMP_REPEAT_L2_918(call, data) call(918, data)
+#define _GMP_REPEAT_L2_920(call, data) _GMP_REPEAT_L2_919(call, data) call(919, data)
+#define _GMP_REPEAT_L2_921(call, data) _GMP_REPEAT_L2_920(call, data) call(920, data)
+#define _GMP_REPEAT_L2_922(call, data) _GMP_REPEAT_L2_921(call, data) call(921, data)
+#define _GMP_REPEAT_L2_923(call, data) _GMP_REPEAT_L2_922(call, data) call(922, data)
+#define _GMP_REPEAT_L2_924(call, data) _GMP_REPEAT_L2_923(call, data) call(923, data)
+#define _GMP_REPEAT_L2_925(call, data) _GMP_REPEAT_L2_924(call, data) call(924, data)
+#define _GMP_REPEAT_L2_926(call, data) _GMP_REPEAT_L2_925(call, data) call(925, data)
+#define _GMP_REPEAT_L2_927(call, data) _GMP_REPEAT_L2_926(call, data) call(926, data)
+#define _GMP_REPEAT_L2_928(call, data) _GMP_REPEAT_L2_927(call, data) call(927, data)
+#define _GMP_REPEAT_L2_929(call, data) _GMP_REPEAT_L2_928(call, data) call(928, data)
+#define _GMP_REPEAT_L2_930(call, data) _GMP_REPEAT_L2_929(call, data) call(929, data)
+#define _GMP_REPEAT_L2_931(call, data) _GMP_REPEAT_L2_930(call, data) call(930, data)
+#define _GMP_REPEAT_L2_932(call, data) _GMP_REPEAT_L2_931(call, data) call(931, data)
+#define _GMP_REPEAT_L2_933(call, data) _GMP_REPEAT_L2_932(call, data) call(932, data)
+#define _GMP_REPEAT_L2_934(call, data) _GMP_REPEAT_L2_933(call, data) call(933, data)
+#define _GMP_REPEAT_L2_935(call, data) _GMP_REPEAT_L2_934(call, data) call(934, data)
+#define _GMP_REPEAT_L2_936(call, data) _GMP_REPEAT_L2_935(call, data) call(935, data)
+#define _GMP_REPEAT_L2_937(call, data) _GMP_REPEAT_L2_936(call, data) call(936, data)
+#define _GMP_REPEAT_L2_938(call, data) _GMP_REPEAT_L2_937(call, data) call(937, data)
+#define _GMP_REPEAT_L2_939(call, data) _GMP_REPEAT_L2_938(call, data) call(938, data)
+#define _GMP_REPEAT_L2_940(call, data) _GMP_REPEAT_L2_939(call, data) call(939, data)
+#define _GMP_REPEAT_L2_941(call, data) _GMP_REPEAT_L2_940(call, data) call(940, data)
+#define _GMP_REPEAT_L2_942(call, data) _GMP_REPEAT_L2_941(call, data) call(941, data)
+#define _GMP_REPEAT_L2_943(call, data) _GMP_REPEAT_L2_942(call, data) call(942, data)
+#define _GMP_REPEAT_L2_944(call, data) _GMP_REPEAT_L2_943(call, data) call(943, data)
+#define _GMP_REPEAT_L2_945(call, data) _GMP_REPEAT_L2_944(call, data) call(944, data)
+#define _GMP_REPEAT_L2_946(call, data) _GMP_REPEAT_L2_945(call, data) call(945, data)
+#define _GMP_REPEAT_L2_947(call, data) _GMP_REPEAT_L2_946(call, data) call(946, data)
+#define _GMP_REPEAT_L2_948(call, data) _GMP_REPEAT_L2_947(call, data) call(947, data)
+#define _GMP_REPEAT_L2_949(call, data) _GMP_REPEAT_L2_948(call, data) call(948, data)
+#define _GMP_REPEAT_L2_950(call, data) _GMP_REPEAT_L2_949(call, data) call(949, data)
+#define _GMP_REPEAT_L2_951(call, data) _GMP_REPEAT_L2_950(call, data) call(950, data)
+#define _GMP_REPEAT_L2_952(call, data) _GMP_REPEAT_L2_951(call, data) call(951, data)
+#define _GMP_REPEAT_L2_953(call, data) _GMP_REPEAT_L2_952(call, data) call(952, data)
+#define _GMP_REPEAT_L2_954(call, data) _GMP_REPEAT_L2_953(call, data) call(953, data)
+#define _GMP_REPEAT_L2_955(call, data) _GMP_REPEAT_L2_954(call, data) call(954, data)
+#define _GMP_REPEAT_L2_956(call, data) _GMP_REPEAT_L2_955(call, data) call(955, data)
+#define _GMP_REPEAT_L2_957(call, data) _GMP_REPEAT_L2_956(call, data) call(956, data)
+#define _GMP_REPEAT_L2_958(call, data) _GMP_REPEAT_L2_957(call, data) call(957, data)
+#define _GMP_REPEAT_L2_959(call, data) _GMP_REPEAT_L2_958(call, data) call(958, data)
+#define _GMP_REPEAT_L2_960(call, data) _GMP_REPEAT_L2_959(call, data) call(959, data)
+#define _GMP_REPEAT_L2_961(call, data) _GMP_REPEAT_L2_960(call, data) call(960, data)
+#define _GMP_REPEAT_L2_962(call, data) _GMP_REPEAT_L2_961(call, data) call(961, data)
+#define _GMP_REPEAT_L2_963(call, data) _GMP_REPEAT_L2_962(call, data) call(962, data)
+#define _GMP_REPEAT_L2_964(call, data) _GMP_REPEAT_L2_963(call, data) call(963, data)
+#define _GMP_REPEAT_L2_965(call, data) _GMP_REPEAT_L2_964(call, data) call(964, data)
+#define _GMP_REPEAT_L2_966(call, data) _GMP_REPEAT_L2_965(call, data) call(965, data)
+#define _GMP_REPEAT_L2_967(call, data) _GMP_REPEAT_L2_966(call, data) call(966, data)
+#define _GMP_REPEAT_L2_968(call, data) _GMP_REPEAT_L2_967(call, data) call(967, data)
+#define _GMP_REPEAT_L2_969(call, data) _GMP_REPEAT_L2_968(call, data) call(968, data)
+#define _GMP_REPEAT_L2_970(call, data) _GMP_REPEAT_L2_969(call, data) call(969, data)
+#define _GMP_REPEAT_L2_971(call, data) _GMP_REPEAT_L2_970(call, data) call(970, data)
+#define _GMP_REPEAT_L2_972(call, data) _GMP_REPEAT_L2_971(call, data) call(971, data)
+#define _GMP_REPEAT_L2_973(call, data) _GMP_REPEAT_L2_972(call, data) call(972, data)
+#define _GMP_REPEAT_L2_974(call, data) _GMP_REPEAT_L2_973(call, data) call(973, data)
+#define _GMP_REPEAT_L2_975(call, data) _GMP_REPEAT_L2_974(call, data) call(974, data)
+#define _GMP_REPEAT_L2_976(call, data) _GMP_REPEAT_L2_975(call, data) call(975, data)
+#define _GMP_REPEAT_L2_977(call, data) _GMP_REPEAT_L2_976(call, data) call(976, data)
+#define _GMP_REPEAT_L2_978(call, data) _GMP_REPEAT_L2_977(call, data) call(977, data)
+#define _GMP_REPEAT_L2_979(call, data) _GMP_REPEAT_L2_978(call, data) call(978, data)
+#define _GMP_REPEAT_L2_980(call, data) _GMP_REPEAT_L2_979(call, data) call(979, data)
+#define _GMP_REPEAT_L2_981(call, data) _GMP_REPEAT_L2_980(call, data) call(980, data)
+#define _GMP_REPEAT_L2_982(call, data) _GMP_REPEAT_L2_981(call, data) call(981, data)
+#define _GMP_REPEAT_L2_983(call, data) _GMP_REPEAT_L2_982(call, data) call(982, data)
+#define _GMP_REPEAT_L2_984(call, data) _GMP_REPEAT_L2_983(call, data) call(983, data)
+#define _GMP_REPEAT_L2_985(call, data) _GMP_REPEAT_L2_984(call, data) call(984, data)
+#define _GMP_REPEAT_L2_986(call, data) _GMP_REPEAT_L2_985(call, data) call(985, data)
+#define _GMP_REPEAT_L2_987(call, data) _GMP_REPEAT_L2_986(call, data) call(986, data)
+#define _GMP_REPEAT_L2_988(call, data) _GMP_REPEAT_L2_987(call, data) call(987, data)
+#define _GMP_REPEAT_L2_989(call, data) _GMP_REPEAT_L2_988(call, data) call(988, data)
+#define _GMP_REPEAT_L2_990(call, data) _GMP_REPEAT_L2_989(call, data) call(989, data)
+#define _GMP_REPEAT_L2_991(call, data) _GMP_REPEAT_L2_990(call, data) call(990, data)
+#define _GMP_REPEAT_L2_992(call, data) _GMP_REPEAT_L2_991(call, data) call(991, data)
+#define _GMP_REPEAT_L2_993(call, data) _GMP_REPEAT_L2_992(call, data) call(992, data)
+#define _GMP_REPEAT_L2_994(call, data) _GMP_REPEAT_L2_993(call, data) call(993, data)
+#define _GMP_REPEAT_L2_995(call, data) _GMP_REPEAT_L2_994(call, data) call(994, data)
+#define _GMP_REPEAT_L2_996(call, data) _GMP_REPEAT_L2_995(call, data) call(995, data)
+#define _GMP_REPEAT_L2_997(call, data) _GMP_REPEAT_L2_996(call, data) call(996, data)
+#define _GMP_REPEAT_L2_998(call, data) _GMP_REPEAT_L2_997(call, data) call(997, data)
+#define _GMP_REPEAT_L2_999(call, data) _GMP_REPEAT_L2_998(call, data) call(998, data)
+#define _GMP_REPEAT_L2_1000(call, data) _GMP_REPEAT_L2_999(call, data) call(999, data)
+#define _GMP_REPEAT_L2_1001(call, data) _GMP_REPEAT_L2_1000(call, data) call(1000, data)
+#define _GMP_REPEAT_L2_1002(call, data) _GMP_REPEAT_L2_1001(call, data) call(1001, data)
+#define _GMP_REPEAT_L2_1003(call, data) _GMP_REPEAT_L2_1002(call, data) call(1002, data)
+#define _GMP_REPEAT_L2_1004(call, data) _GMP_REPEAT_L2_1003(call, data) call(1003, data)
+#define _GMP_REPEAT_L2_1005(call, data) _GMP_REPEAT_L2_1004(call, data) call(1004, data)
+#define _GMP_REPEAT_L2_1006(call, data) _GMP_REPEAT_L2_1005(call, data) call(1005, data)
+#define _GMP_REPEAT_L2_1007(call, data) _GMP_REPEAT_L2_1006(call, data) call(1006, data)
+#define _GMP_REPEAT_L2_1008(call, data) _GMP_REPEAT_L2_1007(call, data) call(1007, data)
+#define _GMP_REPEAT_L2_1009(call, data) _GMP_REPEAT_L2_1008(call, data) call(1008, data)
+#define _GMP_REPEAT_L2_1010(call, data) _GMP_REPEAT_L2_1009(call, data) call(1009, data)
+#define _GMP_REPEAT_L2_1011(call, data) _GMP_REPEAT_L2_1010(call, data) call(1010, data)
+#define _GMP_REPEAT_L2_1012(call, data) _GMP_REPEAT_L2_1011(call, data) call(1011, data)
+#define _GMP_REPEAT_L2_1013(call, data) _GMP_REPEAT_L2_1012(call, data) call(1012, data)
+#define _GMP_REPEAT_L2_1014(call, data) _GMP_REPEAT_L2_1013(call, data) call(1013, data)
+#define _GMP_REPEAT_L2_1015(call, data) _GMP_REPEAT_L2_1014(call, data) call(1014, data)
+#define _GMP_REPEAT_L2_1016(call, data) _GMP_REPEAT_L2_1015(call, data) call(1015, data)
+#define _GMP_REPEAT_L2_1017(call, data) _GMP_REPEAT_L2_1016(call, data) call(1016, data)
+#define _GMP_REPEAT_L2_1018(call, data) _GMP_REPEAT_L2_1017(call, data) call(1017, data)
+#define _GMP_REPEAT_L2_1019(call, data) _GMP_REPEAT_L2_1018(call, data) call(1018, data)
+#define _GMP_REPEAT_L2_1020(call, data) _GMP_REPEAT_L2_1019(call, data) call(1019, data)
+#define _GMP_REPEAT_L2_1021(call, data) _GMP_REPEAT_L2_1020(call, data) call(1020, data)
+#define _GMP_REPEAT_L2_1022(call, data) _GMP_REPEAT_L2_1021(call, data) call(1021, data)
+#define _GMP_REPEAT_L2_1023(call, data) _GMP_REPEAT_L2_1022(call, data) call(1022, data)
+#define _GMP_REPEAT_L2_1024(call, data) _GMP_REPEAT_L2_1023(call, data) call(1023, data)
+
+// GMP_REPEAT_FROM_2
+#define _GMP_REPEAT_FROM_L2_0(call, data, i)
+#define _GMP_REPEAT_FROM_L2_1(call, data, i) call(i, data)
+#define _GMP_REPEAT_FROM_L2_2(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_3(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_2(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_4(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_3(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_5(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_4(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_6(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_5(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_7(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_6(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_8(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_7(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_9(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_8(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_10(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_9(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_11(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_10(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_12(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_11(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_13(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_12(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_14(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_13(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_15(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_14(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_16(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_15(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_17(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_16(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_18(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_17(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_19(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_18(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_20(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_19(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_21(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_20(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_22(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_21(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_23(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_22(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_24(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_23(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_25(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_24(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_26(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_25(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_27(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_26(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_28(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_27(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_29(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_28(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_30(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_29(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_31(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_30(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_32(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_31(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_33(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_32(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_34(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_33(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_35(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_34(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_36(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_35(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_37(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_36(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_38(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_37(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_39(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_38(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_40(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_39(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_41(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_40(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_42(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_41(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_43(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_42(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_44(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_43(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_45(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_44(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_46(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_45(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_47(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_46(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_48(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_47(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_49(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_48(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_50(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_49(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_51(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_50(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_52(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_51(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_53(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_52(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_54(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_53(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_55(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_54(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_56(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_55(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_57(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_56(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_58(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_57(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_59(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_58(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_60(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_59(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_61(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_60(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_62(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_61(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_63(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_62(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_64(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_63(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_65(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_64(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_66(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_65(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_67(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_66(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_68(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_67(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_69(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_68(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_70(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_69(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_71(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_70(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_72(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_71(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_73(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_72(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_74(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_73(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_75(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_74(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_76(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_75(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_77(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_76(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_78(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_77(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_79(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_78(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_80(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_79(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_81(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_80(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_82(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_81(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_83(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_82(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_84(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_83(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_85(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_84(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_86(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_85(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_87(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_86(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_88(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_87(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_89(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_88(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_90(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_89(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_91(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_90(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_92(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_91(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_93(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_92(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_94(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_93(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_95(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_94(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_96(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_95(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_97(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_96(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_98(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_97(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_99(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_98(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_100(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_99(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_101(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_100(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_102(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_101(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_103(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_102(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_104(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_103(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_105(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_104(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_106(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_105(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_107(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_106(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_108(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_107(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_109(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_108(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_110(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_109(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_111(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_110(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_112(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_111(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_113(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_112(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_114(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_113(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_115(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_114(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_116(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_115(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_117(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_116(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_118(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_117(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_119(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_118(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_120(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_119(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_121(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_120(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_122(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_121(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_123(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_122(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_124(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_123(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_125(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_124(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_126(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_125(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_127(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_126(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_128(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_127(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_129(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_128(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_130(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_129(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_131(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_130(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_132(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_131(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_133(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_132(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_134(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_133(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_135(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_134(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_136(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_135(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_137(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_136(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_138(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_137(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_139(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_138(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_140(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_139(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_141(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_140(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_142(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_141(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_143(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_142(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_144(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_143(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_145(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_144(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_146(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_145(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_147(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_146(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_148(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_147(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_149(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_148(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_150(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_149(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_151(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_150(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_152(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_151(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_153(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_152(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_154(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_153(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_155(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_154(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_156(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_155(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_157(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_156(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_158(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_157(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_159(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_158(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_160(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_159(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_161(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_160(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_162(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_161(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_163(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_162(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_164(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_163(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_165(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_164(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_166(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_165(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_167(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_166(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_168(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_167(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_169(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_168(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_170(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_169(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_171(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_170(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_172(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_171(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_173(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_172(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_174(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_173(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_175(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_174(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_176(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_175(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_177(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_176(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_178(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_177(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_179(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_178(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_180(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_179(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_181(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_180(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_182(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_181(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_183(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_182(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_184(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_183(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_185(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_184(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_186(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_185(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_187(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_186(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_188(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_187(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_189(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_188(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_190(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_189(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_191(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_190(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_192(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_191(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_193(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_192(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_194(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_193(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_195(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_194(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_196(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_195(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_197(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_196(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_198(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_197(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_199(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_198(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_200(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_199(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_201(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_200(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_202(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_201(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_203(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_202(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_204(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_203(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_205(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_204(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_206(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_205(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_207(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_206(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_208(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_207(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_209(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_208(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_210(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_209(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_211(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_210(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_212(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_211(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_213(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_212(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_214(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_213(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_215(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_214(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_216(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_215(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_217(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_216(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_218(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_217(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_219(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_218(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_220(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_219(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_221(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_220(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_222(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_221(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_223(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_222(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_224(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_223(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_225(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_224(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_226(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_225(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_227(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_226(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_228(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_227(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_229(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_228(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_230(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_229(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_231(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_230(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_232(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_231(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_233(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_232(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_234(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_233(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_235(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_234(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_236(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_235(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_237(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_236(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_238(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_237(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_239(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_238(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_240(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_239(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_241(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_240(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_242(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_241(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_243(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_242(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_244(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_243(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_245(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_244(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_246(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_245(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_247(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_246(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_248(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_247(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_249(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_248(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_250(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_249(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_251(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_250(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_252(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_251(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_253(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_252(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_254(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_253(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_255(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_254(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_256(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_255(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_257(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_256(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_258(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_257(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_259(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_258(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_260(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_259(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_261(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_260(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_262(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_261(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_263(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_262(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_264(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_263(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_265(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_264(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_266(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_265(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_267(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_266(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_268(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_267(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_269(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_268(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_270(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_269(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_271(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_270(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_272(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_271(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_273(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_272(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_274(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_273(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_275(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_274(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_276(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_275(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_277(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_276(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_278(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_277(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_279(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_278(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_280(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_279(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_281(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_280(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_282(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_281(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_283(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_282(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_284(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_283(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_285(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_284(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_286(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_285(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_287(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_286(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_288(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_287(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_289(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_288(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_290(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_289(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_291(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_290(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_292(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_291(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_293(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_292(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_294(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_293(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_295(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_294(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_296(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_295(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_297(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_296(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_298(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_297(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_299(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_298(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_300(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_299(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_301(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_300(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_302(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_301(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_303(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_302(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_304(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_303(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_305(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_304(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_306(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_305(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_307(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_306(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_308(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_307(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_309(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_308(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_310(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_309(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_311(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_310(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_312(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_311(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_313(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_312(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_314(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_313(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_315(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_314(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_316(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_315(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_317(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_316(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_318(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_317(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_319(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_318(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_320(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_319(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_321(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_320(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_322(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_321(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_323(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_322(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_324(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_323(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_325(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_324(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_326(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_325(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_327(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_326(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_328(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_327(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_329(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_328(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_330(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_329(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_331(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_330(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_332(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_331(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_333(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_332(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_334(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_333(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_335(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_334(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_336(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_335(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_337(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_336(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_338(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_337(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_339(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_338(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_340(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_339(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_341(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_340(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_342(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_341(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_343(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_342(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_344(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_343(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_345(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_344(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_346(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_345(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_347(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_346(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_348(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_347(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_349(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_348(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_350(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_349(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_351(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_350(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_352(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_351(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_353(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_352(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_354(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_353(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_355(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_354(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_356(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_355(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_357(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_356(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_358(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_357(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_359(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_358(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_360(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_359(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_361(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_360(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_362(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_361(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_363(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_362(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_364(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_363(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_365(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_364(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_366(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_365(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_367(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_366(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_368(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_367(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_369(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_368(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_370(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_369(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_371(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_370(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_372(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_371(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_373(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_372(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_374(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_373(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_375(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_374(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_376(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_375(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_377(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_376(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_378(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_377(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_379(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_378(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_380(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_379(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_381(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_380(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_382(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_381(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_383(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_382(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_384(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_383(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_385(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_384(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_386(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_385(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_387(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_386(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_388(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_387(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_389(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_388(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_390(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_389(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_391(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_390(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_392(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_391(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_393(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_392(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_394(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_393(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_395(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_394(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_396(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_395(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_397(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_396(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_398(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_397(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_399(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_398(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_400(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_399(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_401(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_400(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_402(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_401(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_403(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_402(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_404(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_403(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_405(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_404(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_406(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_405(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_407(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_406(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_408(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_407(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_409(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_408(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_410(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_409(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_411(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_410(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_412(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_411(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_413(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_412(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_414(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_413(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_415(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_414(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_416(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_415(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_417(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_416(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_418(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_417(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_419(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_418(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_420(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_419(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_421(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_420(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_422(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_421(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_423(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_422(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_424(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_423(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_425(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_424(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_426(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_425(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_427(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_426(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_428(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_427(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_429(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_428(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_430(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_429(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_431(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_430(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_432(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_431(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_433(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_432(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_434(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_433(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_435(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_434(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_436(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_435(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_437(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_436(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_438(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_437(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_439(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_438(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_440(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_439(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_441(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_440(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_442(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_441(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_443(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_442(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_444(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_443(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_445(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_444(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_446(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_445(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_447(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_446(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_448(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_447(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_449(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_448(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_450(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_449(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_451(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_450(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_452(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_451(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_453(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_452(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_454(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_453(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_455(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_454(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_456(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_455(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_457(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_456(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_458(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_457(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_459(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_458(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_460(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_459(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_461(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_460(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_462(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_461(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_463(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_462(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_464(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_463(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_465(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_464(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_466(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_465(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_467(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_466(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_468(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_467(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_469(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_468(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_470(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_469(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_471(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_470(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_472(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_471(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_473(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_472(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_474(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_473(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_475(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_474(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_476(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_475(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_477(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_476(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_478(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_477(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_479(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_478(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_480(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_479(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_481(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_480(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_482(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_481(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_483(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_482(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_484(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_483(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_485(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_484(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_486(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_485(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_487(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_486(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_488(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_487(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_489(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_488(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_490(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_489(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_491(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_490(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_492(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_491(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_493(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_492(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_494(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_493(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_495(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_494(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_496(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_495(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_497(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_496(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_498(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_497(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_499(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_498(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_500(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_499(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_501(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_500(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_502(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_501(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_503(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_502(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_504(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_503(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_505(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_504(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_506(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_505(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_507(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_506(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_508(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_507(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_509(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_508(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_510(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_509(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_511(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_510(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_512(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_511(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_513(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_512(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_514(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_513(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_515(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_514(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_516(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_515(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_517(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_516(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_518(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_517(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_519(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_518(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_520(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_519(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_521(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_520(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_522(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_521(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_523(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_522(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_524(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_523(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_525(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_524(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_526(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_525(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_527(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_526(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_528(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_527(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_529(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_528(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_530(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_529(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_531(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_530(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_532(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_531(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_533(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_532(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_534(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_533(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_535(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_534(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_536(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_535(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_537(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_536(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_538(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_537(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_539(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_538(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_540(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_539(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_541(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_540(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_542(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_541(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_543(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_542(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_544(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_543(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_545(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_544(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_546(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_545(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_547(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_546(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_548(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_547(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_549(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_548(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_550(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_549(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_551(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_550(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_552(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_551(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_553(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_552(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_554(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_553(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_555(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_554(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_556(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_555(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_557(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_556(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_558(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_557(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_559(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_558(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_560(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_559(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_561(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_560(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_562(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_561(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_563(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_562(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_564(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_563(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_565(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_564(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_566(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_565(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_567(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_566(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_568(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_567(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_569(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_568(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_570(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_569(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_571(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_570(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_572(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_571(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_573(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_572(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_574(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_573(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_575(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_574(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_576(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_575(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_577(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_576(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_578(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_577(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_579(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_578(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_580(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_579(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_581(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_580(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_582(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_581(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_583(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_582(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_584(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_583(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_585(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_584(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_586(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_585(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_587(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_586(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_588(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_587(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_589(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_588(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_590(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_589(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_591(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_590(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_592(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_591(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_593(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_592(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_594(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_593(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_595(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_594(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_596(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_595(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_597(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_596(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_598(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_597(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_599(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_598(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_600(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_599(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_601(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_600(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_602(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_601(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_603(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_602(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_604(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_603(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_605(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_604(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_606(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_605(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_607(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_606(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_608(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_607(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_609(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_608(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_610(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_609(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_611(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_610(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_612(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_611(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_613(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_612(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_614(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_613(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_615(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_614(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_616(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_615(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_617(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_616(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_618(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_617(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_619(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_618(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_620(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_619(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_621(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_620(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_622(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_621(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_623(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_622(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_624(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_623(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_625(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_624(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_626(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_625(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_627(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_626(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_628(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_627(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_629(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_628(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_630(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_629(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_631(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_630(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_632(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_631(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_633(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_632(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_634(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_633(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_635(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_634(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_636(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_635(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_637(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_636(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_638(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_637(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_639(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_638(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_640(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_639(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_641(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_640(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_642(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_641(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_643(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_642(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_644(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_643(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_645(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_644(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_646(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_645(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_647(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_646(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_648(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_647(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_649(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_648(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_650(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_649(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_651(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_650(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_652(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_651(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_653(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_652(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_654(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_653(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_655(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_654(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_656(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_655(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_657(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_656(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_658(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_657(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_659(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_658(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_660(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_659(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_661(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_660(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_662(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_661(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_663(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_662(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_664(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_663(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_665(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_664(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_666(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_665(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_667(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_666(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_668(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_667(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_669(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_668(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_670(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_669(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_671(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_670(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_672(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_671(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_673(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_672(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_674(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_673(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_675(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_674(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_676(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_675(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_677(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_676(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_678(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_677(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_679(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_678(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_680(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_679(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_681(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_680(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_682(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_681(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_683(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_682(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_684(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_683(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_685(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_684(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_686(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_685(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_687(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_686(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_688(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_687(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_689(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_688(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_690(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_689(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_691(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_690(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_692(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_691(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_693(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_692(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_694(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_693(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_695(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_694(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_696(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_695(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_697(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_696(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_698(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_697(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_699(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_698(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_700(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_699(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_701(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_700(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_702(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_701(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_703(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_702(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_704(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_703(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_705(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_704(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_706(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_705(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_707(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_706(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_708(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_707(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_709(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_708(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_710(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_709(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_711(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_710(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_712(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_711(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_713(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_712(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_714(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_713(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_715(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_714(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_716(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_715(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_717(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_716(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_718(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_717(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_719(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_718(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_720(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_719(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_721(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_720(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_722(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_721(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_723(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_722(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_724(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_723(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_725(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_724(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_726(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_725(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_727(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_726(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_728(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_727(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_729(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_728(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_730(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_729(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_731(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_730(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_732(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_731(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_733(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_732(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_734(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_733(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_735(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_734(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_736(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_735(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_737(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_736(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_738(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_737(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_739(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_738(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_740(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_739(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_741(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_740(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_742(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_741(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_743(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_742(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_744(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_743(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_745(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_744(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_746(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_745(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_747(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_746(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_748(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_747(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_749(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_748(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_750(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_749(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_751(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_750(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_752(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_751(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_753(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_752(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_754(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_753(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_755(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_754(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_756(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_755(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_757(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_756(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_758(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_757(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_759(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_758(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_760(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_759(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_761(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_760(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_762(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_761(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_763(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_762(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_764(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_763(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_765(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_764(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_766(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_765(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_767(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_766(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_768(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_767(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_769(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_768(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_770(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_769(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_771(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_770(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_772(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_771(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_773(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_772(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_774(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_773(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_775(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_774(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_776(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_775(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_777(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_776(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_778(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_777(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_779(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_778(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_780(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_779(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_781(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_780(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_782(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_781(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_783(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_782(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_784(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_783(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_785(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_784(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_786(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_785(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_787(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_786(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_788(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_787(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_789(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_788(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_790(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_789(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_791(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_790(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_792(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_791(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_793(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_792(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_794(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_793(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_795(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_794(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_796(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_795(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_797(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_796(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_798(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_797(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_799(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_798(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_800(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_799(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_801(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_800(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_802(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_801(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_803(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_802(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_804(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_803(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_805(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_804(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_806(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_805(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_807(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_806(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_808(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_807(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_809(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_808(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_810(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_809(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_811(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_810(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_812(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_811(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_813(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_812(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_814(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_813(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_815(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_814(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_816(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_815(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_817(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_816(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_818(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_817(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_819(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_818(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_820(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_819(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_821(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_820(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_822(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_821(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_823(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_822(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_824(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_823(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_825(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_824(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_826(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_825(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_827(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_826(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_828(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_827(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_829(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_828(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_830(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_829(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_831(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_830(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_832(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_831(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_833(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_832(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_834(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_833(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_835(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_834(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_836(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_835(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_837(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_836(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_838(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_837(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_839(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_838(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_840(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_839(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_841(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_840(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_842(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_841(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_843(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_842(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_844(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_843(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_845(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_844(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_846(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_845(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_847(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_846(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_848(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_847(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_849(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_848(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_850(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_849(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_851(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_850(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_852(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_851(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_853(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_852(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_854(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_853(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_855(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_854(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_856(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_855(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_857(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_856(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_858(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_857(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_859(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_858(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_860(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_859(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_861(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_860(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_862(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_861(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_863(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_862(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_864(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_863(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_865(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_864(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_866(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_865(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_867(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_866(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_868(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_867(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_869(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_868(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_870(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_869(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_871(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_870(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_872(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_871(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_873(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_872(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_874(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_873(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_875(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_874(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_876(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_875(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_877(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_876(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_878(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_877(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_879(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_878(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_880(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_879(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_881(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_880(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_882(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_881(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_883(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_882(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_884(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_883(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_885(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_884(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_886(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_885(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_887(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_886(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_888(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_887(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_889(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_888(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_890(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_889(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_891(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_890(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_892(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_891(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_893(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_892(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_894(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_893(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_895(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_894(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_896(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_895(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_897(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_896(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_898(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_897(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_899(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_898(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_900(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_899(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_901(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_900(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_902(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_901(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_903(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_902(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_904(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_903(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_905(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_904(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_906(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_905(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_907(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_906(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_908(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_907(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_909(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_908(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_910(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_909(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_911(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_910(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_912(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_911(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_913(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_912(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_914(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_913(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_915(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_914(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_916(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_915(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_917(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_916(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_918(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_917(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_919(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_918(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_920(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_919(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_921(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_920(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_922(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_921(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_923(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_922(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_924(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_923(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_925(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_924(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_926(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_925(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_927(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_926(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_928(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_927(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_929(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_928(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_930(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_929(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_931(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_930(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_932(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_931(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_933(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_932(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_934(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_933(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_935(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_934(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_936(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_935(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_937(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_936(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_938(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_937(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_939(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_938(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_940(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_939(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_941(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_940(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_942(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_941(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_943(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_942(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_944(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_943(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_945(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_944(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_946(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_945(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_947(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_946(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_948(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_947(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_949(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_948(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_950(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_949(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_951(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_950(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_952(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_951(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_953(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_952(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_954(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_953(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_955(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_954(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_956(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_955(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_957(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_956(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_958(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_957(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_959(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_958(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_960(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_959(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_961(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_960(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_962(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_961(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_963(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_962(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_964(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_963(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_965(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_964(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_966(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_965(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_967(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_966(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_968(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_967(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_969(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_968(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_970(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_969(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_971(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_970(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_972(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_971(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_973(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_972(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_974(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_973(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_975(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_974(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_976(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_975(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_977(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_976(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_978(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_977(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_979(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_978(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_980(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_979(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_981(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_980(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_982(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_981(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_983(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_982(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_984(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_983(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_985(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_984(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_986(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_985(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_987(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_986(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_988(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_987(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_989(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_988(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_990(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_989(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_991(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_990(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_992(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_991(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_993(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_992(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_994(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_993(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_995(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_994(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_996(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_995(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_997(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_996(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_998(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_997(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_999(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_998(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1000(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_999(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1001(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1000(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1002(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1001(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1003(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1002(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1004(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1003(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1005(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1004(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1006(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1005(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1007(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1006(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1008(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1007(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1009(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1008(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1010(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1009(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1011(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1010(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1012(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1011(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1013(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1012(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1014(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1013(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1015(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1014(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1016(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1015(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1017(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1016(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1018(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1017(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1019(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1018(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1020(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1019(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1021(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1020(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1022(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1021(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1023(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1022(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_1024(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1023(call, data, GMP_CONCAT(_GMP_INC_, i)())
+
+// GMP_LOOP_3
+#define _GMP_LOOP_L3_0(call, ...)
+#define _GMP_LOOP_L3_1(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_0(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_2(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_3(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_2(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_4(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_3(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_5(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_4(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_6(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_5(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_7(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_6(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_8(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_7(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_9(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_8(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_10(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_9(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_11(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_10(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_12(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_11(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_13(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_12(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_14(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_13(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_15(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_14(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_16(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_15(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_17(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_16(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_18(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_17(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_19(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_18(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_20(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_19(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_21(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_20(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_22(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_21(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_23(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_22(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_24(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_23(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_25(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_24(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_26(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_25(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_27(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_26(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_28(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_27(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_29(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_28(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_30(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_29(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_31(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_30(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_32(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_31(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_33(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_32(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_34(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_33(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_35(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_34(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_36(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_35(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_37(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_36(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_38(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_37(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_39(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_38(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_40(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_39(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_41(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_40(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_42(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_41(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_43(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_42(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_44(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_43(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_45(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_44(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_46(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_45(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_47(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_46(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_48(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_47(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_49(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_48(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_50(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_49(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_51(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_50(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_52(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_51(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_53(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_52(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_54(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_53(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_55(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_54(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_56(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_55(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_57(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_56(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_58(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_57(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_59(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_58(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_60(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_59(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_61(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_60(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_62(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_61(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_63(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_62(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_64(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_63(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_65(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_64(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_66(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_65(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_67(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_66(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_68(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_67(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_69(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_68(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_70(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_69(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_71(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_70(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_72(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_71(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_73(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_72(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_74(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_73(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_75(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_74(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_76(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_75(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_77(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_76(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_78(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_77(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_79(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_78(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_80(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_79(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_81(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_80(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_82(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_81(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_83(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_82(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_84(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_83(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_85(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_84(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_86(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_85(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_87(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_86(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_88(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_87(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_89(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_88(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_90(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_89(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_91(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_90(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_92(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_91(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_93(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_92(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_94(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_93(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_95(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_94(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_96(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_95(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_97(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_96(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_98(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_97(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_99(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_98(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_100(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_99(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_101(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_100(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_102(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_101(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_103(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_102(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_104(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_103(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_105(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_104(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_106(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_105(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_107(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_106(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_108(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_107(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_109(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_108(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_110(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_109(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_111(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_110(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_112(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_111(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_113(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_112(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_114(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_113(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_115(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_114(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_116(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_115(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_117(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_116(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_118(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_117(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_119(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_118(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_120(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_119(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_121(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_120(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_122(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_121(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_123(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_122(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_124(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_123(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_125(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_124(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_126(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_125(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_127(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_126(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_128(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_127(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_129(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_128(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_130(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_129(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_131(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_130(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_132(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_131(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_133(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_132(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_134(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_133(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_135(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_134(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_136(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_135(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_137(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_136(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_138(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_137(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_139(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_138(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_140(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_139(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_141(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_140(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_142(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_141(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_143(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_142(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_144(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_143(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_145(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_144(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_146(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_145(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_147(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_146(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_148(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_147(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_149(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_148(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_150(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_149(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_151(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_150(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_152(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_151(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_153(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_152(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_154(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_153(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_155(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_154(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_156(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_155(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_157(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_156(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_158(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_157(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_159(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_158(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_160(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_159(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_161(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_160(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_162(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_161(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_163(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_162(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_164(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_163(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_165(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_164(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_166(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_165(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_167(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_166(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_168(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_167(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_169(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_168(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_170(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_169(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_171(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_170(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_172(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_171(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_173(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_172(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_174(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_173(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_175(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_174(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_176(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_175(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_177(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_176(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_178(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_177(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_179(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_178(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_180(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_179(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_181(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_180(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_182(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_181(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_183(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_182(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_184(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_183(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_185(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_184(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_186(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_185(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_187(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_186(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_188(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_187(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_189(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_188(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_190(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_189(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_191(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_190(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_192(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_191(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_193(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_192(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_194(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_193(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_195(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_194(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_196(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_195(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_197(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_196(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_198(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_197(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_199(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_198(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_200(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_199(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_201(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_200(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_202(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_201(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_203(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_202(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_204(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_203(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_205(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_204(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_206(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_205(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_207(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_206(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_208(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_207(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_209(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_208(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_210(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_209(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_211(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_210(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_212(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_211(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_213(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_212(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_214(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_213(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_215(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_214(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_216(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_215(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_217(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_216(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_218(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_217(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_219(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_218(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_220(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_219(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_221(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_220(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_222(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_221(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_223(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_222(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_224(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_223(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_225(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_224(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_226(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_225(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_227(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_226(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_228(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_227(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_229(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_228(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_230(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_229(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_231(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_230(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_232(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_231(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_233(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_232(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_234(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_233(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_235(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_234(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_236(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_235(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_237(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_236(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_238(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_237(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_239(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_238(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_240(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_239(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_241(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_240(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_242(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_241(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_243(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_242(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_244(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_243(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_245(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_244(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_246(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_245(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_247(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_246(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_248(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_247(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_249(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_248(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_250(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_249(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_251(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_250(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_252(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_251(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_253(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_252(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_254(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_253(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_255(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_254(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_256(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_255(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_257(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_256(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_258(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_257(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_259(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_258(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_260(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_259(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_261(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_260(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_262(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_261(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_263(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_262(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_264(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_263(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_265(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_264(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_266(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_265(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_267(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_266(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_268(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_267(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_269(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_268(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_270(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_269(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_271(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_270(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_272(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_271(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_273(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_272(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_274(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_273(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_275(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_274(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_276(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_275(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_277(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_276(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_278(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_277(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_279(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_278(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_280(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_279(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_281(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_280(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_282(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_281(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_283(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_282(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_284(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_283(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_285(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_284(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_286(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_285(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_287(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_286(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_288(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_287(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_289(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_288(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_290(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_289(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_291(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_290(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_292(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_291(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_293(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_292(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_294(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_293(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_295(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_294(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_296(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_295(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_297(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_296(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_298(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_297(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_299(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_298(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_300(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_299(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_301(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_300(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_302(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_301(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_303(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_302(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_304(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_303(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_305(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_304(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_306(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_305(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_307(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_306(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_308(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_307(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_309(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_308(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_310(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_309(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_311(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_310(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_312(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_311(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_313(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_312(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_314(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_313(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_315(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_314(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_316(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_315(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_317(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_316(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_318(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_317(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_319(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_318(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_320(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_319(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_321(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_320(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_322(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_321(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_323(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_322(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_324(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_323(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_325(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_324(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_326(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_325(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_327(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_326(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_328(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_327(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_329(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_328(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_330(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_329(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_331(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_330(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_332(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_331(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_333(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_332(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_334(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_333(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_335(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_334(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_336(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_335(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_337(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_336(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_338(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_337(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_339(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_338(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_340(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_339(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_341(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_340(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_342(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_341(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_343(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_342(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_344(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_343(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_345(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_344(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_346(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_345(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_347(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_346(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_348(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_347(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_349(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_348(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_350(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_349(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_351(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_350(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_352(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_351(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_353(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_352(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_354(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_353(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_355(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_354(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_356(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_355(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_357(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_356(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_358(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_357(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_359(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_358(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_360(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_359(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_361(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_360(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_362(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_361(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_363(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_362(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_364(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_363(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_365(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_364(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_366(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_365(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_367(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_366(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_368(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_367(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_369(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_368(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_370(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_369(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_371(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_370(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_372(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_371(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_373(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_372(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_374(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_373(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_375(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_374(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_376(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_375(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_377(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_376(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_378(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_377(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_379(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_378(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_380(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_379(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_381(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_380(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_382(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_381(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_383(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_382(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_384(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_383(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_385(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_384(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_386(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_385(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_387(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_386(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_388(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_387(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_389(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_388(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_390(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_389(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_391(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_390(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_392(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_391(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_393(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_392(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_394(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_393(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_395(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_394(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_396(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_395(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_397(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_396(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_398(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_397(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_399(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_398(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_400(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_399(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_401(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_400(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_402(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_401(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_403(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_402(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_404(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_403(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_405(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_404(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_406(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_405(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_407(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_406(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_408(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_407(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_409(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_408(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_410(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_409(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_411(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_410(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_412(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_411(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_413(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_412(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_414(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_413(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_415(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_414(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_416(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_415(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_417(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_416(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_418(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_417(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_419(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_418(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_420(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_419(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_421(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_420(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_422(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_421(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_423(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_422(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_424(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_423(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_425(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_424(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_426(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_425(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_427(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_426(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_428(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_427(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_429(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_428(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_430(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_429(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_431(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_430(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_432(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_431(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_433(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_432(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_434(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_433(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_435(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_434(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_436(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_435(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_437(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_436(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_438(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_437(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_439(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_438(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_440(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_439(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_441(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_440(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_442(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_441(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_443(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_442(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_444(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_443(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_445(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_444(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_446(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_445(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_447(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_446(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_448(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_447(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_449(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_448(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_450(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_449(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_451(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_450(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_452(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_451(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_453(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_452(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_454(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_453(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_455(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_454(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_456(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_455(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_457(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_456(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_458(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_457(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_459(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_458(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_460(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_459(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_461(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_460(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_462(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_461(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_463(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_462(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_464(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_463(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_465(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_464(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_466(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_465(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_467(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_466(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_468(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_467(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_469(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_468(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_470(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_469(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_471(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_470(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_472(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_471(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_473(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_472(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_474(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_473(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_475(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_474(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_476(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_475(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_477(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_476(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_478(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_477(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_479(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_478(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_480(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_479(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_481(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_480(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_482(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_481(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_483(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_482(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_484(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_483(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_485(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_484(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_486(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_485(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_487(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_486(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_488(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_487(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_489(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_488(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_490(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_489(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_491(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_490(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_492(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_491(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_493(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_492(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_494(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_493(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_495(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_494(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_496(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_495(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_497(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_496(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_498(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_497(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_499(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_498(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_500(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_499(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_501(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_500(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_502(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_501(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_503(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_502(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_504(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_503(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_505(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_504(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_506(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_505(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_507(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_506(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_508(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_507(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_509(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_508(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_510(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_509(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_511(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_510(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_512(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_511(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_513(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_512(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_514(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_513(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_515(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_514(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_516(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_515(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_517(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_516(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_518(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_517(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_519(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_518(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_520(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_519(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_521(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_520(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_522(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_521(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_523(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_522(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_524(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_523(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_525(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_524(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_526(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_525(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_527(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_526(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_528(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_527(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_529(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_528(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_530(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_529(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_531(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_530(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_532(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_531(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_533(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_532(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_534(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_533(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_535(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_534(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_536(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_535(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_537(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_536(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_538(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_537(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_539(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_538(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_540(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_539(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_541(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_540(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_542(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_541(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_543(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_542(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_544(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_543(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_545(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_544(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_546(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_545(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_547(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_546(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_548(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_547(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_549(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_548(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_550(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_549(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_551(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_550(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_552(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_551(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_553(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_552(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_554(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_553(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_555(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_554(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_556(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_555(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_557(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_556(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_558(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_557(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_559(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_558(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_560(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_559(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_561(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_560(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_562(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_561(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_563(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_562(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_564(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_563(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_565(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_564(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_566(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_565(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_567(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_566(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_568(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_567(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_569(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_568(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_570(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_569(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_571(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_570(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_572(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_571(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_573(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_572(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_574(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_573(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_575(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_574(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_576(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_575(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_577(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_576(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_578(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_577(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_579(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_578(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_580(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_579(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_581(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_580(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_582(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_581(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_583(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_582(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_584(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_583(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_585(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_584(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_586(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_585(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_587(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_586(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_588(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_587(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_589(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_588(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_590(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_589(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_591(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_590(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_592(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_591(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_593(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_592(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_594(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_593(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_595(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_594(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_596(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_595(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_597(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_596(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_598(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_597(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_599(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_598(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_600(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_599(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_601(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_600(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_602(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_601(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_603(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_602(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_604(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_603(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_605(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_604(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_606(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_605(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_607(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_606(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_608(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_607(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_609(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_608(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_610(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_609(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_611(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_610(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_612(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_611(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_613(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_612(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_614(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_613(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_615(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_614(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_616(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_615(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_617(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_616(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_618(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_617(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_619(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_618(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_620(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_619(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_621(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_620(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_622(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_621(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_623(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_622(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_624(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_623(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_625(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_624(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_626(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_625(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_627(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_626(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_628(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_627(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_629(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_628(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_630(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_629(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_631(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_630(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_632(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_631(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_633(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_632(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_634(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_633(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_635(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_634(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_636(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_635(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_637(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_636(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_638(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_637(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_639(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_638(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_640(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_639(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_641(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_640(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_642(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_641(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_643(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_642(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_644(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_643(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_645(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_644(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_646(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_645(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_647(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_646(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_648(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_647(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_649(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_648(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_650(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_649(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_651(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_650(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_652(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_651(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_653(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_652(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_654(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_653(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_655(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_654(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_656(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_655(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_657(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_656(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_658(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_657(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_659(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_658(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_660(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_659(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_661(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_660(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_662(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_661(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_663(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_662(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_664(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_663(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_665(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_664(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_666(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_665(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_667(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_666(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_668(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_667(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_669(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_668(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_670(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_669(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_671(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_670(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_672(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_671(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_673(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_672(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_674(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_673(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_675(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_674(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_676(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_675(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_677(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_676(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_678(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_677(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_679(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_678(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_680(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_679(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_681(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_680(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_682(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_681(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_683(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_682(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_684(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_683(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_685(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_684(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_686(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_685(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_687(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_686(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_688(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_687(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_689(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_688(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_690(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_689(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_691(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_690(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_692(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_691(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_693(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_692(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_694(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_693(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_695(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_694(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_696(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_695(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_697(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_696(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_698(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_697(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_699(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_698(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_700(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_699(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_701(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_700(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_702(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_701(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_703(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_702(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_704(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_703(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_705(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_704(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_706(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_705(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_707(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_706(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_708(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_707(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_709(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_708(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_710(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_709(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_711(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_710(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_712(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_711(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_713(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_712(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_714(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_713(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_715(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_714(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_716(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_715(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_717(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_716(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_718(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_717(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_719(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_718(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_720(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_719(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_721(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_720(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_722(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_721(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_723(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_722(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_724(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_723(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_725(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_724(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_726(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_725(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_727(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_726(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_728(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_727(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_729(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_728(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_730(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_729(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_731(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_730(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_732(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_731(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_733(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_732(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_734(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_733(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_735(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_734(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_736(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_735(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_737(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_736(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_738(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_737(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_739(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_738(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_740(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_739(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_741(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_740(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_742(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_741(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_743(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_742(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_744(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_743(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_745(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_744(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_746(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_745(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_747(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_746(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_748(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_747(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_749(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_748(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_750(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_749(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_751(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_750(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_752(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_751(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_753(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_752(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_754(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_753(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_755(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_754(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_756(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_755(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_757(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_756(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_758(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_757(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_759(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_758(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_760(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_759(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_761(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_760(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_762(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_761(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_763(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_762(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_764(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_763(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_765(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_764(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_766(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_765(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_767(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_766(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_768(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_767(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_769(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_768(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_770(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_769(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_771(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_770(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_772(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_771(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_773(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_772(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_774(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_773(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_775(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_774(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_776(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_775(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_777(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_776(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_778(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_777(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_779(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_778(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_780(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_779(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_781(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_780(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_782(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_781(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_783(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_782(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_784(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_783(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_785(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_784(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_786(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_785(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_787(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_786(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_788(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_787(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_789(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_788(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_790(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_789(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_791(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_790(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_792(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_791(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_793(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_792(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_794(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_793(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_795(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_794(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_796(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_795(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_797(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_796(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_798(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_797(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_799(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_798(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_800(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_799(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_801(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_800(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_802(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_801(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_803(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_802(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_804(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_803(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_805(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_804(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_806(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_805(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_807(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_806(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_808(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_807(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_809(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_808(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_810(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_809(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_811(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_810(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_812(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_811(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_813(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_812(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_814(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_813(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_815(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_814(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_816(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_815(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_817(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_816(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_818(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_817(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_819(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_818(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_820(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_819(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_821(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_820(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_822(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_821(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_823(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_822(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_824(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_823(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_825(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_824(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_826(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_825(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_827(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_826(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_828(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_827(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_829(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_828(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_830(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_829(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_831(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_830(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_832(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_831(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_833(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_832(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_834(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_833(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_835(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_834(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_836(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_835(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_837(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_836(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_838(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_837(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_839(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_838(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_840(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_839(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_841(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_840(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_842(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_841(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_843(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_842(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_844(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_843(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_845(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_844(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_846(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_845(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_847(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_846(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_848(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_847(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_849(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_848(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_850(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_849(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_851(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_850(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_852(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_851(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_853(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_852(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_854(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_853(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_855(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_854(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_856(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_855(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_857(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_856(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_858(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_857(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_859(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_858(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_860(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_859(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_861(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_860(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_862(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_861(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_863(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_862(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_864(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_863(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_865(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_864(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_866(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_865(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_867(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_866(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_868(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_867(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_869(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_868(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_870(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_869(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_871(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_870(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_872(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_871(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_873(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_872(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_874(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_873(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_875(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_874(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_876(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_875(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_877(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_876(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_878(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_877(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_879(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_878(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_880(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_879(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_881(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_880(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_882(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_881(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_883(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_882(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_884(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_883(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_885(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_884(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_886(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_885(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_887(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_886(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_888(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_887(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_889(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_888(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_890(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_889(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_891(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_890(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_892(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_891(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_893(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_892(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_894(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_893(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_895(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_894(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_896(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_895(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_897(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_896(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_898(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_897(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_899(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_898(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_900(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_899(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_901(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_900(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_902(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_901(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_903(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_902(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_904(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_903(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_905(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_904(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_906(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_905(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_907(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_906(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_908(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_907(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_909(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_908(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_910(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_909(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_911(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_910(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_912(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_911(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_913(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_912(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_914(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_913(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_915(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_914(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_916(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_915(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_917(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_916(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_918(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_917(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_919(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_918(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_920(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_919(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_921(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_920(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_922(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_921(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_923(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_922(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_924(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_923(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_925(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_924(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_926(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_925(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_927(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_926(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_928(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_927(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_929(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_928(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_930(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_929(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_931(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_930(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_932(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_931(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_933(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_932(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_934(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_933(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_935(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_934(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_936(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_935(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_937(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_936(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_938(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_937(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_939(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_938(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_940(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_939(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_941(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_940(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_942(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_941(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_943(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_942(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_944(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_943(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_945(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_944(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_946(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_945(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_947(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_946(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_948(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_947(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_949(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_948(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_950(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_949(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_951(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_950(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_952(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_951(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_953(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_952(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_954(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_953(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_955(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_954(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_956(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_955(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_957(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_956(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_958(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_957(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_959(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_958(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_960(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_959(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_961(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_960(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_962(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_961(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_963(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_962(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_964(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_963(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_965(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_964(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_966(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_965(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_967(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_966(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_968(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_967(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_969(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_968(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_970(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_969(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_971(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_970(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_972(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_971(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_973(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_972(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_974(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_973(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_975(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_974(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_976(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_975(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_977(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_976(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_978(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_977(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_979(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_978(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_980(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_979(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_981(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_980(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_982(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_981(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_983(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_982(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_984(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_983(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_985(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_984(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_986(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_985(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_987(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_986(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_988(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_987(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_989(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_988(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_990(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_989(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_991(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_990(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_992(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_991(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_993(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_992(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_994(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_993(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_995(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_994(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_996(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_995(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_997(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_996(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_998(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_997(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_999(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_998(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1000(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_999(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1001(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1000(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1002(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1001(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1003(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1002(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1004(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1003(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1005(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1004(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1006(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1005(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1007(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1006(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1008(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1007(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1009(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1008(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1010(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1009(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1011(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1010(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1012(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1011(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1013(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1012(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1014(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1013(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1015(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1014(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1016(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1015(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1017(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1016(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1018(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1017(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1019(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1018(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1020(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1019(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1021(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1020(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1022(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1021(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1023(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1022(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_1024(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1023(call, __VA_ARGS__)
+
+// GMP_REPEAT_3
+#define _GMP_REPEAT_L3_0(call, data)
+#define _GMP_REPEAT_L3_1(call, data) _GMP_REPEAT_L3_0(call, data) call(0, data)
+#define _GMP_REPEAT_L3_2(call, data) _GMP_REPEAT_L3_1(call, data) call(1, data)
+#define _GMP_REPEAT_L3_3(call, data) _GMP_REPEAT_L3_2(call, data) call(2, data)
+#define _GMP_REPEAT_L3_4(call, data) _GMP_REPEAT_L3_3(call, data) call(3, data)
+#define _GMP_REPEAT_L3_5(call, data) _GMP_REPEAT_L3_4(call, data) call(4, data)
+#define _GMP_REPEAT_L3_6(call, data) _GMP_REPEAT_L3_5(call, data) call(5, data)
+#define _GMP_REPEAT_L3_7(call, data) _GMP_REPEAT_L3_6(call, data) call(6, data)
+#define _GMP_REPEAT_L3_8(call, data) _GMP_REPEAT_L3_7(call, data) call(7, data)
+#define _GMP_REPEAT_L3_9(call, data) _GMP_REPEAT_L3_8(call, data) call(8, data)
+#define _GMP_REPEAT_L3_10(call, data) _GMP_REPEAT_L3_9(call, data) call(9, data)
+#define _GMP_REPEAT_L3_11(call, data) _GMP_REPEAT_L3_10(call, data) call(10, data)
+#define _GMP_REPEAT_L3_12(call, data) _GMP_REPEAT_L3_11(call, data) call(11, data)
+#define _GMP_REPEAT_L3_13(call, data) _GMP_REPEAT_L3_12(call, data) call(12, data)
+#define _GMP_REPEAT_L3_14(call, data) _GMP_REPEAT_L3_13(call, data) call(13, data)
+#define _GMP_REPEAT_L3_15(call, data) _GMP_REPEAT_L3_14(call, data) call(14, data)
+#define _GMP_REPEAT_L3_16(call, data) _GMP_REPEAT_L3_15(call, data) call(15, data)
+#define _GMP_REPEAT_L3_17(call, data) _GMP_REPEAT_L3_16(call, data) call(16, data)
+#define _GMP_REPEAT_L3_18(call, data) _GMP_REPEAT_L3_17(call, data) call(17, data)
+#define _GMP_REPEAT_L3_19(call, data) _GMP_REPEAT_L3_18(call, data) call(18, data)
+#define _GMP_REPEAT_L3_20(call, data) _GMP_REPEAT_L3_19(call, data) call(19, data)
+#define _GMP_REPEAT_L3_21(call, data) _GMP_REPEAT_L3_20(call, data) call(20, data)
+#define _GMP_REPEAT_L3_22(call, data) _GMP_REPEAT_L3_21(call, data) call(21, data)
+#define _GMP_REPEAT_L3_23(call, data) _GMP_REPEAT_L3_22(call, data) call(22, data)
+#define _GMP_REPEAT_L3_24(call, data) _GMP_REPEAT_L3_23(call, data) call(23, data)
+#define _GMP_REPEAT_L3_25(call, data) _GMP_REPEAT_L3_24(call, data) call(24, data)
+#define _GMP_REPEAT_L3_26(call, data) _GMP_REPEAT_L3_25(call, data) call(25, data)
+#define _GMP_REPEAT_L3_27(call, data) _GMP_REPEAT_L3_26(call, data) call(26, data)
+#define _GMP_REPEAT_L3_28(call, data) _GMP_REPEAT_L3_27(call, data) call(27, data)
+#define _GMP_REPEAT_L3_29(call, data) _GMP_REPEAT_L3_28(call, data) call(28, data)
+#define _GMP_REPEAT_L3_30(call, data) _GMP_REPEAT_L3_29(call, data) call(29, data)
+#define _GMP_REPEAT_L3_31(call, data) _GMP_REPEAT_L3_30(call, data) call(30, data)
+#define _GMP_REPEAT_L3_32(call, data) _GMP_REPEAT_L3_31(call, data) call(31, data)
+#define _GMP_REPEAT_L3_33(call, data) _GMP_REPEAT_L3_32(call, data) call(32, data)
+#define _GMP_REPEAT_L3_34(call, data) _GMP_REPEAT_L3_33(call, data) call(33, data)
+#define _GMP_REPEAT_L3_35(call, data) _GMP_REPEAT_L3_34(call, data) call(34, data)
+#define _GMP_REPEAT_L3_36(call, data) _GMP_REPEAT_L3_35(call, data) call(35, data)
+#define _GMP_REPEAT_L3_37(call, data) _GMP_REPEAT_L3_36(call, data) call(36, data)
+#define _GMP_REPEAT_L3_38(call, data) _GMP_REPEAT_L3_37(call, data) call(37, data)
+#define _GMP_REPEAT_L3_39(call, data) _GMP_REPEAT_L3_38(call, data) call(38, data)
+#define _GMP_REPEAT_L3_40(call, data) _GMP_REPEAT_L3_39(call, data) call(39, data)
+#define _GMP_REPEAT_L3_41(call, data) _GMP_REPEAT_L3_40(call, data) call(40, data)
+#define _GMP_REPEAT_L3_42(call, data) _GMP_REPEAT_L3_41(call, data) call(41, data)
+#define _GMP_REPEAT_L3_43(call, data) _GMP_REPEAT_L3_42(call, data) call(42, data)
+#define _GMP_REPEAT_L3_44(call, data) _GMP_REPEAT_L3_43(call, data) call(43, data)
+#define _GMP_REPEAT_L3_45(call, data) _GMP_REPEAT_L3_44(call, data) call(44, data)
+#define _GMP_REPEAT_L3_46(call, data) _GMP_REPEAT_L3_45(call, data) call(45, data)
+#define _GMP_REPEAT_L3_47(call, data) _GMP_REPEAT_L3_46(call, data) call(46, data)
+#define _GMP_REPEAT_L3_48(call, data) _GMP_REPEAT_L3_47(call, data) call(47, data)
+#define _GMP_REPEAT_L3_49(call, data) _GMP_REPEAT_L3_48(call, data) call(48, data)
+#define _GMP_REPEAT_L3_50(call, data) _GMP_REPEAT_L3_49(call, data) call(49, data)
+#define _GMP_REPEAT_L3_51(call, data) _GMP_REPEAT_L3_50(call, data) call(50, data)
+#define _GMP_REPEAT_L3_52(call, data) _GMP_REPEAT_L3_51(call, data) call(51, data)
+#define _GMP_REPEAT_L3_53(call, data) _GMP_REPEAT_L3_52(call, data) call(52, data)
+#define _GMP_REPEAT_L3_54(call, data) _GMP_REPEAT_L3_53(call, data) call(53, data)
+#define _GMP_REPEAT_L3_55(call, data) _GMP_REPEAT_L3_54(call, data) call(54, data)
+#define _GMP_REPEAT_L3_56(call, data) _GMP_REPEAT_L3_55(call, data) call(55, data)
+#define _GMP_REPEAT_L3_57(call, data) _GMP_REPEAT_L3_56(call, data) call(56, data)
+#define _GMP_REPEAT_L3_58(call, data) _GMP_REPEAT_L3_57(call, data) call(57, data)
+#define _GMP_REPEAT_L3_59(call, data) _GMP_REPEAT_L3_58(call, data) call(58, data)
+#define _GMP_REPEAT_L3_60(call, data) _GMP_REPEAT_L3_59(call, data) call(59, data)
+#define _GMP_REPEAT_L3_61(call, data) _GMP_REPEAT_L3_60(call, data) call(60, data)
+#define _GMP_REPEAT_L3_62(call, data) _GMP_REPEAT_L3_61(call, data) call(61, data)
+#define _GMP_REPEAT_L3_63(call, data) _GMP_REPEAT_L3_62(call, data) call(62, data)
+#define _GMP_REPEAT_L3_64(call, data) _GMP_REPEAT_L3_63(call, data) call(63, data)
+#define _GMP_REPEAT_L3_65(call, data) _GMP_REPEAT_L3_64(call, data) call(64, data)
+#define _GMP_REPEAT_L3_66(call, data) _GMP_REPEAT_L3_65(call, data) call(65, data)
+#define _GMP_REPEAT_L3_67(call, data) _GMP_REPEAT_L3_66(call, data) call(66, data)
+#define _GMP_REPEAT_L3_68(call, data) _GMP_REPEAT_L3_67(call, data) call(67, data)
+#define _GMP_REPEAT_L3_69(call, data) _GMP_REPEAT_L3_68(call, data) call(68, data)
+#define _GMP_REPEAT_L3_70(call, data) _GMP_REPEAT_L3_69(call, data) call(69, data)
+#define _GMP_REPEAT_L3_71(call, data) _GMP_REPEAT_L3_70(call, data) call(70, data)
+#define _GMP_REPEAT_L3_72(call, data) _GMP_REPEAT_L3_71(call, data) call(71, data)
+#define _GMP_REPEAT_L3_73(call, data) _GMP_REPEAT_L3_72(call, data) call(72, data)
+#define _GMP_REPEAT_L3_74(call, data) _GMP_REPEAT_L3_73(call, data) call(73, data)
+#define _GMP_REPEAT_L3_75(call, data) _GMP_REPEAT_L3_74(call, data) call(74, data)
+#define _GMP_REPEAT_L3_76(call, data) _GMP_REPEAT_L3_75(call, data) call(75, data)
+#define _GMP_REPEAT_L3_77(call, data) _GMP_REPEAT_L3_76(call, data) call(76, data)
+#define _GMP_REPEAT_L3_78(call, data) _GMP_REPEAT_L3_77(call, data) call(77, data)
+#define _GMP_REPEAT_L3_79(call, data) _GMP_REPEAT_L3_78(call, data) call(78, data)
+#define _GMP_REPEAT_L3_80(call, data) _GMP_REPEAT_L3_79(call, data) call(79, data)
+#define _GMP_REPEAT_L3_81(call, data) _GMP_REPEAT_L3_80(call, data) call(80, data)
+#define _GMP_REPEAT_L3_82(call, data) _GMP_REPEAT_L3_81(call, data) call(81, data)
+#define _GMP_REPEAT_L3_83(call, data) _GMP_REPEAT_L3_82(call, data) call(82, data)
+#define _GMP_REPEAT_L3_84(call, data) _GMP_REPEAT_L3_83(call, data) call(83, data)
+#define _GMP_REPEAT_L3_85(call, data) _GMP_REPEAT_L3_84(call, data) call(84, data)
+#define _GMP_REPEAT_L3_86(call, data) _GMP_REPEAT_L3_85(call, data) call(85, data)
+#define _GMP_REPEAT_L3_87(call, data) _GMP_REPEAT_L3_86(call, data) call(86, data)
+#define _GMP_REPEAT_L3_88(call, data) _GMP_REPEAT_L3_87(call, data) call(87, data)
+#define _GMP_REPEAT_L3_89(call, data) _GMP_REPEAT_L3_88(call, data) call(88, data)
+#define _GMP_REPEAT_L3_90(call, data) _GMP_REPEAT_L3_89(call, data) call(89, data)
+#define _GMP_REPEAT_L3_91(call, data) _GMP_REPEAT_L3_90(call, data) call(90, data)
+#define _GMP_REPEAT_L3_92(call, data) _GMP_REPEAT_L3_91(call, data) call(91, data)
+#define _GMP_REPEAT_L3_93(call, data) _GMP_REPEAT_L3_92(call, data) call(92, data)
+#define _GMP_REPEAT_L3_94(call, data) _GMP_REPEAT_L3_93(call, data) call(93, data)
+#define _GMP_REPEAT_L3_95(call, data) _GMP_REPEAT_L3_94(call, data) call(94, data)
+#define _GMP_REPEAT_L3_96(call, data) _GMP_REPEAT_L3_95(call, data) call(95, data)
+#define _GMP_REPEAT_L3_97(call, data) _GMP_REPEAT_L3_96(call, data) call(96, data)
+#define _GMP_REPEAT_L3_98(call, data) _GMP_REPEAT_L3_97(call, data) call(97, data)
+#define _GMP_REPEAT_L3_99(call, data) _GMP_REPEAT_L3_98(call, data) call(98, data)
+#define _GMP_REPEAT_L3_100(call, data) _GMP_REPEAT_L3_99(call, data) call(99, data)
+#define _GMP_REPEAT_L3_101(call, data) _GMP_REPEAT_L3_100(call, data) call(100, data)
+#define _GMP_REPEAT_L3_102(call, data) _GMP_REPEAT_L3_101(call, data) call(101, data)
+#define _GMP_REPEAT_L3_103(call, data) _GMP_REPEAT_L3_102(call, data) call(102, data)
+#define _GMP_REPEAT_L3_104(call, data) _GMP_REPEAT_L3_103(call, data) call(103, data)
+#define _GMP_REPEAT_L3_105(call, data) _GMP_REPEAT_L3_104(call, data) call(104, data)
+#define _GMP_REPEAT_L3_106(call, data) _GMP_REPEAT_L3_105(call, data) call(105, data)
+#define _GMP_REPEAT_L3_107(call, data) _GMP_REPEAT_L3_106(call, data) call(106, data)
+#define _GMP_REPEAT_L3_108(call, data) _GMP_REPEAT_L3_107(call, data) call(107, data)
+#define _GMP_REPEAT_L3_109(call, data) _GMP_REPEAT_L3_108(call, data) call(108, data)
+#define _GMP_REPEAT_L3_110(call, data) _GMP_REPEAT_L3_109(call, data) call(109, data)
+#define _GMP_REPEAT_L3_111(call, data) _GMP_REPEAT_L3_110(call, data) call(110, data)
+#define _GMP_REPEAT_L3_112(call, data) _GMP_REPEAT_L3_111(call, data) call(111, data)
+#define _GMP_REPEAT_L3_113(call, data) _GMP_REPEAT_L3_112(call, data) call(112, data)
+#define _GMP_REPEAT_L3_114(call, data) _GMP_REPEAT_L3_113(call, data) call(113, data)
+#define _GMP_REPEAT_L3_115(call, data) _GMP_REPEAT_L3_114(call, data) call(114, data)
+#define _GMP_REPEAT_L3_116(call, data) _GMP_REPEAT_L3_115(call, data) call(115, data)
+#define _GMP_REPEAT_L3_117(call, data) _GMP_REPEAT_L3_116(call, data) call(116, data)
+#define _GMP_REPEAT_L3_118(call, data) _GMP_REPEAT_L3_117(call, data) call(117, data)
+#define _GMP_REPEAT_L3_119(call, data) _GMP_REPEAT_L3_118(call, data) call(118, data)
+#define _GMP_REPEAT_L3_120(call, data) _GMP_REPEAT_L3_119(call, data) call(119, data)
+#define _GMP_REPEAT_L3_121(call, data) _GMP_REPEAT_L3_120(call, data) call(120, data)
+#define _GMP_REPEAT_L3_122(call, data) _GMP_REPEAT_L3_121(call, data) call(121, data)
+#define _GMP_REPEAT_L3_123(call, data) _GMP_REPEAT_L3_122(call, data) call(122, data)
+#define _GMP_REPEAT_L3_124(call, data) _GMP_REPEAT_L3_123(call, data) call(123, data)
+#define _GMP_REPEAT_L3_125(call, data) _GMP_REPEAT_L3_124(call, data) call(124, data)
+#define _GMP_REPEAT_L3_126(call, data) _GMP_REPEAT_L3_125(call, data) call(125, data)
+#define _GMP_REPEAT_L3_127(call, data) _GMP_REPEAT_L3_126(call, data) call(126, data)
+#define _GMP_REPEAT_L3_128(call, data) _GMP_REPEAT_L3_127(call, data) call(127, data)
+#define _GMP_REPEAT_L3_129(call, data) _GMP_REPEAT_L3_128(call, data) call(128, data)
+#define _GMP_REPEAT_L3_130(call, data) _GMP_REPEAT_L3_129(call, data) call(129, data)
+#define _GMP_REPEAT_L3_131(call, data) _GMP_REPEAT_L3_130(call, data) call(130, data)
+#define _GMP_REPEAT_L3_132(call, data) _GMP_REPEAT_L3_131(call, data) call(131, data)
+#define _GMP_REPEAT_L3_133(call, data) _GMP_REPEAT_L3_132(call, data) call(132, data)
+#define _GMP_REPEAT_L3_134(call, data) _GMP_REPEAT_L3_133(call, data) call(133, data)
+#define _GMP_REPEAT_L3_135(call, data) _GMP_REPEAT_L3_134(call, data) call(134, data)
+#define _GMP_REPEAT_L3_136(call, data) _GMP_REPEAT_L3_135(call, data) call(135, data)
+#define _GMP_REPEAT_L3_137(call, data) _GMP_REPEAT_L3_136(call, data) call(136, data)
+#define _GMP_REPEAT_L3_138(call, data) _GMP_REPEAT_L3_137(call, data) call(137, data)
+#define _GMP_REPEAT_L3_139(call, data) _GMP_REPEAT_L3_138(call, data) call(138, data)
+#define _GMP_REPEAT_L3_140(call, data) _GMP_REPEAT_L3_139(call, data) call(139, data)
+#define _GMP_REPEAT_L3_141(call, data) _GMP_REPEAT_L3_140(call, data) call(140, data)
+#define _GMP_REPEAT_L3_142(call, data) _GMP_REPEAT_L3_141(call, data) call(141, data)
+#define _GMP_REPEAT_L3_143(call, data) _GMP_REPEAT_L3_142(call, data) call(142, data)
+#define _GMP_REPEAT_L3_144(call, data) _GMP_REPEAT_L3_143(call, data) call(143, data)
+#define _GMP_REPEAT_L3_145(call, data) _GMP_REPEAT_L3_144(call, data) call(144, data)
+#define _GMP_REPEAT_L3_146(call, data) _GMP_REPEAT_L3_145(call, data) call(145, data)
+#define _GMP_REPEAT_L3_147(call, data) _GMP_REPEAT_L3_146(call, data) call(146, data)
+#define _GMP_REPEAT_L3_148(call, data) _GMP_REPEAT_L3_147(call, data) call(147, data)
+#define _GMP_REPEAT_L3_149(call, data) _GMP_REPEAT_L3_148(call, data) call(148, data)
+#define _GMP_REPEAT_L3_150(call, data) _GMP_REPEAT_L3_149(call, data) call(149, data)
+#define _GMP_REPEAT_L3_151(call, data) _GMP_REPEAT_L3_150(call, data) call(150, data)
+#define _GMP_REPEAT_L3_152(call, data) _GMP_REPEAT_L3_151(call, data) call(151, data)
+#define _GMP_REPEAT_L3_153(call, data) _GMP_REPEAT_L3_152(call, data) call(152, data)
+#define _GMP_REPEAT_L3_154(call, data) _GMP_REPEAT_L3_153(call, data) call(153, data)
+#define _GMP_REPEAT_L3_155(call, data) _GMP_REPEAT_L3_154(call, data) call(154, data)
+#define _GMP_REPEAT_L3_156(call, data) _GMP_REPEAT_L3_155(call, data) call(155, data)
+#define _GMP_REPEAT_L3_157(call, data) _GMP_REPEAT_L3_156(call, data) call(156, data)
+#define _GMP_REPEAT_L3_158(call, data) _GMP_REPEAT_L3_157(call, data) call(157, data)
+#define _GMP_REPEAT_L3_159(call, data) _GMP_REPEAT_L3_158(call, data) call(158, data)
+#define _GMP_REPEAT_L3_160(call, data) _GMP_REPEAT_L3_159(call, data) call(159, data)
+#define _GMP_REPEAT_L3_161(call, data) _GMP_REPEAT_L3_160(call, data) call(160, data)
+#define _GMP_REPEAT_L3_162(call, data) _GMP_REPEAT_L3_161(call, data) call(161, data)
+#define _GMP_REPEAT_L3_163(call, data) _GMP_REPEAT_L3_162(call, data) call(162, data)
+#define _GMP_REPEAT_L3_164(call, data) _GMP_REPEAT_L3_163(call, data) call(163, data)
+#define _GMP_REPEAT_L3_165(call, data) _GMP_REPEAT_L3_164(call, data) call(164, data)
+#define _GMP_REPEAT_L3_166(call, data) _GMP_REPEAT_L3_165(call, data) call(165, data)
+#define _GMP_REPEAT_L3_167(call, data) _GMP_REPEAT_L3_166(call, data) call(166, data)
+#define _GMP_REPEAT_L3_168(call, data) _GMP_REPEAT_L3_167(call, data) call(167, data)
+#define _GMP_REPEAT_L3_169(call, data) _GMP_REPEAT_L3_168(call, data) call(168, data)
+#define _GMP_REPEAT_L3_170(call, data) _GMP_REPEAT_L3_169(call, data) call(169, data)
+#define _GMP_REPEAT_L3_171(call, data) _GMP_REPEAT_L3_170(call, data) call(170, data)
+#define _GMP_REPEAT_L3_172(call, data) _GMP_REPEAT_L3_171(call, data) call(171, data)
+#define _GMP_REPEAT_L3_173(call, data) _GMP_REPEAT_L3_172(call, data) call(172, data)
+#define _GMP_REPEAT_L3_174(call, data) _GMP_REPEAT_L3_173(call, data) call(173, data)
+#define _GMP_REPEAT_L3_175(call, data) _GMP_REPEAT_L3_174(call, data) call(174, data)
+#define _GMP_REPEAT_L3_176(call, data) _GMP_REPEAT_L3_175(call, data) call(175, data)
+#define _GMP_REPEAT_L3_177(call, data) _GMP_REPEAT_L3_176(call, data) call(176, data)
+#define _GMP_REPEAT_L3_178(call, data) _GMP_REPEAT_L3_177(call, data) call(177, data)
+#define _GMP_REPEAT_L3_179(call, data) _GMP_REPEAT_L3_178(call, data) call(178, data)
+#define _GMP_REPEAT_L3_180(call, data) _GMP_REPEAT_L3_179(call, data) call(179, data)
+#define _GMP_REPEAT_L3_181(call, data) _GMP_REPEAT_L3_180(call, data) call(180, data)
+#define _GMP_REPEAT_L3_182(call, data) _GMP_REPEAT_L3_181(call, data) call(181, data)
+#define _GMP_REPEAT_L3_183(call, data) _GMP_REPEAT_L3_182(call, data) call(182, data)
+#define _GMP_REPEAT_L3_184(call, data) _GMP_REPEAT_L3_183(call, data) call(183, data)
+#define _GMP_REPEAT_L3_185(call, data) _GMP_REPEAT_L3_184(call, data) call(184, data)
+#define _GMP_REPEAT_L3_186(call, data) _GMP_REPEAT_L3_185(call, data) call(185, data)
+#define _GMP_REPEAT_L3_187(call, data) _GMP_REPEAT_L3_186(call, data) call(186, data)
+#define _GMP_REPEAT_L3_188(call, data) _GMP_REPEAT_L3_187(call, data) call(187, data)
+#define _GMP_REPEAT_L3_189(call, data) _GMP_REPEAT_L3_188(call, data) call(188, data)
+#define _GMP_REPEAT_L3_190(call, data) _GMP_REPEAT_L3_189(call, data) call(189, data)
+#define _GMP_REPEAT_L3_191(call, data) _GMP_REPEAT_L3_190(call, data) call(190, data)
+#define _GMP_REPEAT_L3_192(call, data) _GMP_REPEAT_L3_191(call, data) call(191, data)
+#define _GMP_REPEAT_L3_193(call, data) _GMP_REPEAT_L3_192(call, data) call(192, data)
+#define _GMP_REPEAT_L3_194(call, data) _GMP_REPEAT_L3_193(call, data) call(193, data)
+#define _GMP_REPEAT_L3_195(call, data) _GMP_REPEAT_L3_194(call, data) call(194, data)
+#define _GMP_REPEAT_L3_196(call, data) _GMP_REPEAT_L3_195(call, data) call(195, data)
+#define _GMP_REPEAT_L3_197(call, data) _GMP_REPEAT_L3_196(call, data) call(196, data)
+#define _GMP_REPEAT_L3_198(call, data) _GMP_REPEAT_L3_197(call, data) call(197, data)
+#define _GMP_REPEAT_L3_199(call, data) _GMP_REPEAT_L3_198(call, data) call(198, data)
+#define _GMP_REPEAT_L3_200(call, data) _GMP_REPEAT_L3_199(call, data) call(199, data)
+#define _GMP_REPEAT_L3_201(call, data) _GMP_REPEAT_L3_200(call, data) call(200, data)
+#define _GMP_REPEAT_L3_202(call, data) _GMP_REPEAT_L3_201(call, data) call(201, data)
+#define _GMP_REPEAT_L3_203(call, data) _GMP_REPEAT_L3_202(call, data) call(202, data)
+#define _GMP_REPEAT_L3_204(call, data) _GMP_REPEAT_L3_203(call, data) call(203, data)
+#define _GMP_REPEAT_L3_205(call, data) _GMP_REPEAT_L3_204(call, data) call(204, data)
+#define _GMP_REPEAT_L3_206(call, data) _GMP_REPEAT_L3_205(call, data) call(205, data)
+#define _GMP_REPEAT_L3_207(call, data) _GMP_REPEAT_L3_206(call, data) call(206, data)
+#define _GMP_REPEAT_L3_208(call, data) _GMP_REPEAT_L3_207(call, data) call(207, data)
+#define _GMP_REPEAT_L3_209(call, data) _GMP_REPEAT_L3_208(call, data) call(208, data)
+#define _GMP_REPEAT_L3_210(call, data) _GMP_REPEAT_L3_209(call, data) call(209, data)
+#define _GMP_REPEAT_L3_211(call, data) _GMP_REPEAT_L3_210(call, data) call(210, data)
+#define _GMP_REPEAT_L3_212(call, data) _GMP_REPEAT_L3_211(call, data) call(211, data)
+#define _GMP_REPEAT_L3_213(call, data) _GMP_REPEAT_L3_212(call, data) call(212, data)
+#define _GMP_REPEAT_L3_214(call, data) _GMP_REPEAT_L3_213(call, data) call(213, data)
+#define _GMP_REPEAT_L3_215(call, data) _GMP_REPEAT_L3_214(call, data) call(214, data)
+#define _GMP_REPEAT_L3_216(call, data) _GMP_REPEAT_L3_215(call, data) call(215, data)
+#define _GMP_REPEAT_L3_217(call, data) _GMP_REPEAT_L3_216(call, data) call(216, data)
+#define _GMP_REPEAT_L3_218(call, data) _GMP_REPEAT_L3_217(call, data) call(217, data)
+#define _GMP_REPEAT_L3_219(call, data) _GMP_REPEAT_L3_218(call, data) call(218, data)
+#define _GMP_REPEAT_L3_220(call, data) _GMP_REPEAT_L3_219(call, data) call(219, data)
+#define _GMP_REPEAT_L3_221(call, data) _GMP_REPEAT_L3_220(call, data) call(220, data)
+#define _GMP_REPEAT_L3_222(call, data) _GMP_REPEAT_L3_221(call, data) call(221, data)
+#define _GMP_REPEAT_L3_223(call, data) _GMP_REPEAT_L3_222(call, data) call(222, data)
+#define _GMP_REPEAT_L3_224(call, data) _GMP_REPEAT_L3_223(call, data) call(223, data)
+#define _GMP_REPEAT_L3_225(call, data) _GMP_REPEAT_L3_224(call, data) call(224, data)
+#define _GMP_REPEAT_L3_226(call, data) _GMP_REPEAT_L3_225(call, data) call(225, data)
+#define _GMP_REPEAT_L3_227(call, data) _GMP_REPEAT_L3_226(call, data) call(226, data)
+#define _GMP_REPEAT_L3_228(call, data) _GMP_REPEAT_L3_227(call, data) call(227, data)
+#define _GMP_REPEAT_L3_229(call, data) _GMP_REPEAT_L3_228(call, data) call(228, data)
+#define _GMP_REPEAT_L3_230(call, data) _GMP_REPEAT_L3_229(call, data) call(229, data)
+#define _GMP_REPEAT_L3_231(call, data) _GMP_REPEAT_L3_230(call, data) call(230, data)
+#define _GMP_REPEAT_L3_232(call, data) _GMP_REPEAT_L3_231(call, data) call(231, data)
+#define _GMP_REPEAT_L3_233(call, data) _GMP_REPEAT_L3_232(call, data) call(232, data)
+#define _GMP_REPEAT_L3_234(call, data) _GMP_REPEAT_L3_233(call, data) call(233, data)
+#define _GMP_REPEAT_L3_235(call, data) _GMP_REPEAT_L3_234(call, data) call(234, data)
+#define _GMP_REPEAT_L3_236(call, data) _GMP_REPEAT_L3_235(call, data) call(235, data)
+#define _GMP_REPEAT_L3_237(call, data) _GMP_REPEAT_L3_236(call, data) call(236, data)
+#define _GMP_REPEAT_L3_238(call, data) _GMP_REPEAT_L3_237(call, data) call(237, data)
+#define _GMP_REPEAT_L3_239(call, data) _GMP_REPEAT_L3_238(call, data) call(238, data)
+#define _GMP_REPEAT_L3_240(call, data) _GMP_REPEAT_L3_239(call, data) call(239, data)
+#define _GMP_REPEAT_L3_241(call, data) _GMP_REPEAT_L3_240(call, data) call(240, data)
+#define _GMP_REPEAT_L3_242(call, data) _GMP_REPEAT_L3_241(call, data) call(241, data)
+#define _GMP_REPEAT_L3_243(call, data) _GMP_REPEAT_L3_242(call, data) call(242, data)
+#define _GMP_REPEAT_L3_244(call, data) _GMP_REPEAT_L3_243(call, data) call(243, data)
+#define _GMP_REPEAT_L3_245(call, data) _GMP_REPEAT_L3_244(call, data) call(244, data)
+#define _GMP_REPEAT_L3_246(call, data) _GMP_REPEAT_L3_245(call, data) call(245, data)
+#define _GMP_REPEAT_L3_247(call, data) _GMP_REPEAT_L3_246(call, data) call(246, data)
+#define _GMP_REPEAT_L3_248(call, data) _GMP_REPEAT_L3_247(call, data) call(247, data)
+#define _GMP_REPEAT_L3_249(call, data) _GMP_REPEAT_L3_248(call, data) call(248, data)
+#define _GMP_REPEAT_L3_250(call, data) _GMP_REPEAT_L3_249(call, data) call(249, data)
+#define _GMP_REPEAT_L3_251(call, data) _GMP_REPEAT_L3_250(call, data) call(250, data)
+#define _GMP_REPEAT_L3_252(call, data) _GMP_REPEAT_L3_251(call, data) call(251, data)
+#define _GMP_REPEAT_L3_253(call, data) _GMP_REPEAT_L3_252(call, data) call(252, data)
+#define _GMP_REPEAT_L3_254(call, data) _GMP_REPEAT_L3_253(call, data) call(253, data)
+#define _GMP_REPEAT_L3_255(call, data) _GMP_REPEAT_L3_254(call, data) call(254, data)
+#define _GMP_REPEAT_L3_256(call, data) _GMP_REPEAT_L3_255(call, data) call(255, data)
+#define _GMP_REPEAT_L3_257(call, data) _GMP_REPEAT_L3_256(call, data) call(256, data)
+#define _GMP_REPEAT_L3_258(call, data) _GMP_REPEAT_L3_257(call, data) call(257, data)
+#define _GMP_REPEAT_L3_259(call, data) _GMP_REPEAT_L3_258(call, data) call(258, data)
+#define _GMP_REPEAT_L3_260(call, data) _GMP_REPEAT_L3_259(call, data) call(259, data)
+#define _GMP_REPEAT_L3_261(call, data) _GMP_REPEAT_L3_260(call, data) call(260, data)
+#define _GMP_REPEAT_L3_262(call, data) _GMP_REPEAT_L3_261(call, data) call(261, data)
+#define _GMP_REPEAT_L3_263(call, data) _GMP_REPEAT_L3_262(call, data) call(262, data)
+#define _GMP_REPEAT_L3_264(call, data) _GMP_REPEAT_L3_263(call, data) call(263, data)
+#define _GMP_REPEAT_L3_265(call, data) _GMP_REPEAT_L3_264(call, data) call(264, data)
+#define _GMP_REPEAT_L3_266(call, data) _GMP_REPEAT_L3_265(call, data) call(265, data)
+#define _GMP_REPEAT_L3_267(call, data) _GMP_REPEAT_L3_266(call, data) call(266, data)
+#define _GMP_REPEAT_L3_268(call, data) _GMP_REPEAT_L3_267(call, data) call(267, data)
+#define _GMP_REPEAT_L3_269(call, data) _GMP_REPEAT_L3_268(call, data) call(268, data)
+#define _GMP_REPEAT_L3_270(call, data) _GMP_REPEAT_L3_269(call, data) call(269, data)
+#define _GMP_REPEAT_L3_271(call, data) _GMP_REPEAT_L3_270(call, data) call(270, data)
+#define _GMP_REPEAT_L3_272(call, data) _GMP_REPEAT_L3_271(call, data) call(271, data)
+#define _GMP_REPEAT_L3_273(call, data) _GMP_REPEAT_L3_272(call, data) call(272, data)
+#define _GMP_REPEAT_L3_274(call, data) _GMP_REPEAT_L3_273(call, data) call(273, data)
+#define _GMP_REPEAT_L3_275(call, data) _GMP_REPEAT_L3_274(call, data) call(274, data)
+#define _GMP_REPEAT_L3_276(call, data) _GMP_REPEAT_L3_275(call, data) call(275, data)
+#define _GMP_REPEAT_L3_277(call, data) _GMP_REPEAT_L3_276(call, data) call(276, data)
+#define _GMP_REPEAT_L3_278(call, data) _GMP_REPEAT_L3_277(call, data) call(277, data)
+#define _GMP_REPEAT_L3_279(call, data) _GMP_REPEAT_L3_278(call, data) call(278, data)
+#define _GMP_REPEAT_L3_280(call, data) _GMP_REPEAT_L3_279(call, data) call(279, data)
+#define _GMP_REPEAT_L3_281(call, data) _GMP_REPEAT_L3_280(call, data) call(280, data)
+#define _GMP_REPEAT_L3_282(call, data) _GMP_REPEAT_L3_281(call, data) call(281, data)
+#define _GMP_REPEAT_L3_283(call, data) _GMP_REPEAT_L3_282(call, data) call(282, data)
+#define _GMP_REPEAT_L3_284(call, data) _GMP_REPEAT_L3_283(call, data) call(283, data)
+#define _GMP_REPEAT_L3_285(call, data) _GMP_REPEAT_L3_284(call, data) call(284, data)
+#define _GMP_REPEAT_L3_286(call, data) _GMP_REPEAT_L3_285(call, data) call(285, data)
+#define _GMP_REPEAT_L3_287(call, data) _GMP_REPEAT_L3_286(call, data) call(286, data)
+#define _GMP_REPEAT_L3_288(call, data) _GMP_REPEAT_L3_287(call, data) call(287, data)
+#define _GMP_REPEAT_L3_289(call, data) _GMP_REPEAT_L3_288(call, data) call(288, data)
+#define _GMP_REPEAT_L3_290(call, data) _GMP_REPEAT_L3_289(call, data) call(289, data)
+#define _GMP_REPEAT_L3_291(call, data) _GMP_REPEAT_L3_290(call, data) call(290, data)
+#define _GMP_REPEAT_L3_292(call, data) _GMP_REPEAT_L3_291(call, data) call(291, data)
+#define _GMP_REPEAT_L3_293(call, data) _GMP_REPEAT_L3_292(call, data) call(292, data)
+#define _GMP_REPEAT_L3_294(call, data) _GMP_REPEAT_L3_293(call, data) call(293, data)
+#define _GMP_REPEAT_L3_295(call, data) _GMP_REPEAT_L3_294(call, data) call(294, data)
+#define _GMP_REPEAT_L3_296(call, data) _GMP_REPEAT_L3_295(call, data) call(295, data)
+#define _GMP_REPEAT_L3_297(call, data) _GMP_REPEAT_L3_296(call, data) call(296, data)
+#define _GMP_REPEAT_L3_298(call, data) _GMP_REPEAT_L3_297(call, data) call(297, data)
+#define _GMP_REPEAT_L3_299(call, data) _GMP_REPEAT_L3_298(call, data) call(298, data)
+#define _GMP_REPEAT_L3_300(call, data) _GMP_REPEAT_L3_299(call, data) call(299, data)
+#define _GMP_REPEAT_L3_301(call, data) _GMP_REPEAT_L3_300(call, data) call(300, data)
+#define _GMP_REPEAT_L3_302(call, data) _GMP_REPEAT_L3_301(call, data) call(301, data)
+#define _GMP_REPEAT_L3_303(call, data) _GMP_REPEAT_L3_302(call, data) call(302, data)
+#define _GMP_REPEAT_L3_304(call, data) _GMP_REPEAT_L3_303(call, data) call(303, data)
+#define _GMP_REPEAT_L3_305(call, data) _GMP_REPEAT_L3_304(call, data) call(304, data)
+#define _GMP_REPEAT_L3_306(call, data) _GMP_REPEAT_L3_305(call, data) call(305, data)
+#define _GMP_REPEAT_L3_307(call, data) _GMP_REPEAT_L3_306(call, data) call(306, data)
+#define _GMP_REPEAT_L3_308(call, data) _GMP_REPEAT_L3_307(call, data) call(307, data)
+#define _GMP_REPEAT_L3_309(call, data) _GMP_REPEAT_L3_308(call, data) call(308, data)
+#define _GMP_REPEAT_L3_310(call, data) _GMP_REPEAT_L3_309(call, data) call(309, data)
+#define _GMP_REPEAT_L3_311(call, data) _GMP_REPEAT_L3_310(call, data) call(310, data)
+#define _GMP_REPEAT_L3_312(call, data) _GMP_REPEAT_L3_311(call, data) call(311, data)
+#define _GMP_REPEAT_L3_313(call, data) _GMP_REPEAT_L3_312(call, data) call(312, data)
+#define _GMP_REPEAT_L3_314(call, data) _GMP_REPEAT_L3_313(call, data) call(313, data)
+#define _GMP_REPEAT_L3_315(call, data) _GMP_REPEAT_L3_314(call, data) call(314, data)
+#define _GMP_REPEAT_L3_316(call, data) _GMP_REPEAT_L3_315(call, data) call(315, data)
+#define _GMP_REPEAT_L3_317(call, data) _GMP_REPEAT_L3_316(call, data) call(316, data)
+#define _GMP_REPEAT_L3_318(call, data) _GMP_REPEAT_L3_317(call, data) call(317, data)
+#define _GMP_REPEAT_L3_319(call, data) _GMP_REPEAT_L3_318(call, data) call(318, data)
+#define _GMP_REPEAT_L3_320(call, data) _GMP_REPEAT_L3_319(call, data) call(319, data)
+#define _GMP_REPEAT_L3_321(call, data) _GMP_REPEAT_L3_320(call, data) call(320, data)
+#define _GMP_REPEAT_L3_322(call, data) _GMP_REPEAT_L3_321(call, data) call(321, data)
+#define _GMP_REPEAT_L3_323(call, data) _GMP_REPEAT_L3_322(call, data) call(322, data)
+#define _GMP_REPEAT_L3_324(call, data) _GMP_REPEAT_L3_323(call, data) call(323, data)
+#define _GMP_REPEAT_L3_325(call, data) _GMP_REPEAT_L3_324(call, data) call(324, data)
+#define _GMP_REPEAT_L3_326(call, data) _GMP_REPEAT_L3_325(call, data) call(325, data)
+#define _GMP_REPEAT_L3_327(call, data) _GMP_REPEAT_L3_326(call, data) call(326, data)
+#define _GMP_REPEAT_L3_328(call, data) _GMP_REPEAT_L3_327(call, data) call(327, data)
+#define _GMP_REPEAT_L3_329(call, data) _GMP_REPEAT_L3_328(call, data) call(328, data)
+#define _GMP_REPEAT_L3_330(call, data) _GMP_REPEAT_L3_329(call, data) call(329, data)
+#define _GMP_REPEAT_L3_331(call, data) _GMP_REPEAT_L3_330(call, data) call(330, data)
+#define _GMP_REPEAT_L3_332(call, data) _GMP_REPEAT_L3_331(call, data) call(331, data)
+#define _GMP_REPEAT_L3_333(call, data) _GMP_REPEAT_L3_332(call, data) call(332, data)
+#define _GMP_REPEAT_L3_334(call, data) _GMP_REPEAT_L3_333(call, data) call(333, data)
+#define _GMP_REPEAT_L3_335(call, data) _GMP_REPEAT_L3_334(call, data) call(334, data)
+#define _GMP_REPEAT_L3_336(call, data) _GMP_REPEAT_L3_335(call, data) call(335, data)
+#define _GMP_REPEAT_L3_337(call, data) _GMP_REPEAT_L3_336(call, data) call(336, data)
+#define _GMP_REPEAT_L3_338(call, data) _GMP_REPEAT_L3_337(call, data) call(337, data)
+#define _GMP_REPEAT_L3_339(call, data) _GMP_REPEAT_L3_338(call, data) call(338, data)
+#define _GMP_REPEAT_L3_340(call, data) _GMP_REPEAT_L3_339(call, data) call(339, data)
+#define _GMP_REPEAT_L3_341(call, data) _GMP_REPEAT_L3_340(call, data) call(340, data)
+#define _GMP_REPEAT_L3_342(call, data) _GMP_REPEAT_L3_341(call, data) call(341, data)
+#define _GMP_REPEAT_L3_343(call, data) _GMP_REPEAT_L3_342(call, data) call(342, data)
+#define _GMP_REPEAT_L3_344(call, data) _GMP_REPEAT_L3_343(call, data) call(343, data)
+#define _GMP_REPEAT_L3_345(call, data) _GMP_REPEAT_L3_344(call, data) call(344, data)
+#define _GMP_REPEAT_L3_346(call, data) _GMP_REPEAT_L3_345(call, data) call(345, data)
+#define _GMP_REPEAT_L3_347(call, data) _GMP_REPEAT_L3_346(call, data) call(346, data)
+#define _GMP_REPEAT_L3_348(call, data) _GMP_REPEAT_L3_347(call, data) call(347, data)
+#define _GMP_REPEAT_L3_349(call, data) _GMP_REPEAT_L3_348(call, data) call(348, data)
+#define _GMP_REPEAT_L3_350(call, data) _GMP_REPEAT_L3_349(call, data) call(349, data)
+#define _GMP_REPEAT_L3_351(call, data) _GMP_REPEAT_L3_350(call, data) call(350, data)
+#define _GMP_REPEAT_L3_352(call, data) _GMP_REPEAT_L3_351(call, data) call(351, data)
+#define _GMP_REPEAT_L3_353(call, data) _GMP_REPEAT_L3_352(call, data) call(352, data)
+#define _GMP_REPEAT_L3_354(call, data) _GMP_REPEAT_L3_353(call, data) call(353, data)
+#define _GMP_REPEAT_L3_355(call, data) _GMP_REPEAT_L3_354(call, data) call(354, data)
+#define _GMP_REPEAT_L3_356(call, data) _GMP_REPEAT_L3_355(call, data) call(355, data)
+#define _GMP_REPEAT_L3_357(call, data) _GMP_REPEAT_L3_356(call, data) call(356, data)
+#define _GMP_REPEAT_L3_358(call, data) _GMP_REPEAT_L3_357(call, data) call(357, data)
+#define _GMP_REPEAT_L3_359(call, data) _GMP_REPEAT_L3_358(call, data) call(358, data)
+#define _GMP_REPEAT_L3_360(call, data) _GMP_REPEAT_L3_359(call, data) call(359, data)
+#define _GMP_REPEAT_L3_361(call, data) _GMP_REPEAT_L3_360(call, data) call(360, data)
+#define _GMP_REPEAT_L3_362(call, data) _GMP_REPEAT_L3_361(call, data) call(361, data)
+#define _GMP_REPEAT_L3_363(call, data) _GMP_REPEAT_L3_362(call, data) call(362, data)
+#define _GMP_REPEAT_L3_364(call, data) _GMP_REPEAT_L3_363(call, data) call(363, data)
+#define _GMP_REPEAT_L3_365(call, data) _GMP_REPEAT_L3_364(call, data) call(364, data)
+#define _GMP_REPEAT_L3_366(call, data) _GMP_REPEAT_L3_365(call, data) call(365, data)
+#define _GMP_REPEAT_L3_367(call, data) _GMP_REPEAT_L3_366(call, data) call(366, data)
+#define _GMP_REPEAT_L3_368(call, data) _GMP_REPEAT_L3_367(call, data) call(367, data)
+#define _GMP_REPEAT_L3_369(call, data) _GMP_REPEAT_L3_368(call, data) call(368, data)
+#define _GMP_REPEAT_L3_370(call, data) _GMP_REPEAT_L3_369(call, data) call(369, data)
+#define _GMP_REPEAT_L3_371(call, data) _GMP_REPEAT_L3_370(call, data) call(370, data)
+#define _GMP_REPEAT_L3_372(call, data) _GMP_REPEAT_L3_371(call, data) call(371, data)
+#define _GMP_REPEAT_L3_373(call, data) _GMP_REPEAT_L3_372(call, data) call(372, data)
+#define _GMP_REPEAT_L3_374(call, data) _GMP_REPEAT_L3_373(call, data) call(373, data)
+#define _GMP_REPEAT_L3_375(call, data) _GMP_REPEAT_L3_374(call, data) call(374, data)
+#define _GMP_REPEAT_L3_376(call, data) _GMP_REPEAT_L3_375(call, data) call(375, data)
+#define _GMP_REPEAT_L3_377(call, data) _GMP_REPEAT_L3_376(call, data) call(376, data)
+#define _GMP_REPEAT_L3_378(call, data) _GMP_REPEAT_L3_377(call, data) call(377, data)
+#define _GMP_REPEAT_L3_379(call, data) _GMP_REPEAT_L3_378(call, data) call(378, data)
+#define _GMP_REPEAT_L3_380(call, data) _GMP_REPEAT_L3_379(call, data) call(379, data)
+#define _GMP_REPEAT_L3_381(call, data) _GMP_REPEAT_L3_380(call, data) call(380, data)
+#define _GMP_REPEAT_L3_382(call, data) _GMP_REPEAT_L3_381(call, data) call(381, data)
+#define _GMP_REPEAT_L3_383(call, data) _GMP_REPEAT_L3_382(call, data) call(382, data)
+#define _GMP_REPEAT_L3_384(call, data) _GMP_REPEAT_L3_383(call, data) call(383, data)
+#define _GMP_REPEAT_L3_385(call, data) _GMP_REPEAT_L3_384(call, data) call(384, data)
+#define _GMP_REPEAT_L3_386(call, data) _GMP_REPEAT_L3_385(call, data) call(385, data)
+#define _GMP_REPEAT_L3_387(call, data) _GMP_REPEAT_L3_386(call, data) call(386, data)
+#define _GMP_REPEAT_L3_388(call, data) _GMP_REPEAT_L3_387(call, data) call(387, data)
+#define _GMP_REPEAT_L3_389(call, data) _GMP_REPEAT_L3_388(call, data) call(388, data)
+#define _GMP_REPEAT_L3_390(call, data) _GMP_REPEAT_L3_389(call, data) call(389, data)
+#define _GMP_REPEAT_L3_391(call, data) _GMP_REPEAT_L3_390(call, data) call(390, data)
+#define _GMP_REPEAT_L3_392(call, data) _GMP_REPEAT_L3_391(call, data) call(391, data)
+#define _GMP_REPEAT_L3_393(call, data) _GMP_REPEAT_L3_392(call, data) call(392, data)
+#define _GMP_REPEAT_L3_394(call, data) _GMP_REPEAT_L3_393(call, data) call(393, data)
+#define _GMP_REPEAT_L3_395(call, data) _GMP_REPEAT_L3_394(call, data) call(394, data)
+#define _GMP_REPEAT_L3_396(call, data) _GMP_REPEAT_L3_395(call, data) call(395, data)
+#define _GMP_REPEAT_L3_397(call, data) _GMP_REPEAT_L3_396(call, data) call(396, data)
+#define _GMP_REPEAT_L3_398(call, data) _GMP_REPEAT_L3_397(call, data) call(397, data)
+#define _GMP_REPEAT_L3_399(call, data) _GMP_REPEAT_L3_398(call, data) call(398, data)
+#define _GMP_REPEAT_L3_400(call, data) _GMP_REPEAT_L3_399(call, data) call(399, data)
+#define _GMP_REPEAT_L3_401(call, data) _GMP_REPEAT_L3_400(call, data) call(400, data)
+#define _GMP_REPEAT_L3_402(call, data) _GMP_REPEAT_L3_401(call, data) call(401, data)
+#define _GMP_REPEAT_L3_403(call, data) _GMP_REPEAT_L3_402(call, data) call(402, data)
+#define _GMP_REPEAT_L3_404(call, data) _GMP_REPEAT_L3_403(call, data) call(403, data)
+#define _GMP_REPEAT_L3_405(call, data) _GMP_REPEAT_L3_404(call, data) call(404, data)
+#define _GMP_REPEAT_L3_406(call, data) _GMP_REPEAT_L3_405(call, data) call(405, data)
+#define _GMP_REPEAT_L3_407(call, data) _GMP_REPEAT_L3_406(call, data) call(406, data)
+#define _GMP_REPEAT_L3_408(call, data) _GMP_REPEAT_L3_407(call, data) call(407, data)
+#define _GMP_REPEAT_L3_409(call, data) _GMP_REPEAT_L3_408(call, data) call(408, data)
+#define _GMP_REPEAT_L3_410(call, data) _GMP_REPEAT_L3_409(call, data) call(409, data)
+#define _GMP_REPEAT_L3_411(call, data) _GMP_REPEAT_L3_410(call, data) call(410, data)
+#define _GMP_REPEAT_L3_412(call, data) _GMP_REPEAT_L3_411(call, data) call(411, data)
+#define _GMP_REPEAT_L3_413(call, data) _GMP_REPEAT_L3_412(call, data) call(412, data)
+#define _GMP_REPEAT_L3_414(call, data) _GMP_REPEAT_L3_413(call, data) call(413, data)
+#define _GMP_REPEAT_L3_415(call, data) _GMP_REPEAT_L3_414(call, data) call(414, data)
+#define _GMP_REPEAT_L3_416(call, data) _GMP_REPEAT_L3_415(call, data) call(415, data)
+#define _GMP_REPEAT_L3_417(call, data) _GMP_REPEAT_L3_416(call, data) call(416, data)
+#define _GMP_REPEAT_L3_418(call, data) _GMP_REPEAT_L3_417(call, data) call(417, data)
+#define _GMP_REPEAT_L3_419(call, data) _GMP_REPEAT_L3_418(call, data) call(418, data)
+#define _GMP_REPEAT_L3_420(call, data) _GMP_REPEAT_L3_419(call, data) call(419, data)
+#define _GMP_REPEAT_L3_421(call, data) _GMP_REPEAT_L3_420(call, data) call(420, data)
+#define _GMP_REPEAT_L3_422(call, data) _GMP_REPEAT_L3_421(call, data) call(421, data)
+#define _GMP_REPEAT_L3_423(call, data) _GMP_REPEAT_L3_422(call, data) call(422, data)
+#define _GMP_REPEAT_L3_424(call, data) _GMP_REPEAT_L3_423(call, data) call(423, data)
+#define _GMP_REPEAT_L3_425(call, data) _GMP_REPEAT_L3_424(call, data) call(424, data)
+#define _GMP_REPEAT_L3_426(call, data) _GMP_REPEAT_L3_425(call, data) call(425, data)
+#define _GMP_REPEAT_L3_427(call, data) _GMP_REPEAT_L3_426(call, data) call(426, data)
+#define _GMP_REPEAT_L3_428(call, data) _GMP_REPEAT_L3_427(call, data) call(427, data)
+#define _GMP_REPEAT_L3_429(call, data) _GMP_REPEAT_L3_428(call, data) call(428, data)
+#define _GMP_REPEAT_L3_430(call, data) _GMP_REPEAT_L3_429(call, data) call(429, data)
+#define _GMP_REPEAT_L3_431(call, data) _GMP_REPEAT_L3_430(call, data) call(430, data)
+#define _GMP_REPEAT_L3_432(call, data) _GMP_REPEAT_L3_431(call, data) call(431, data)
+#define _GMP_REPEAT_L3_433(call, data) _GMP_REPEAT_L3_432(call, data) call(432, data)
+#define _GMP_REPEAT_L3_434(call, data) _GMP_REPEAT_L3_433(call, data) call(433, data)
+#define _GMP_REPEAT_L3_435(call, data) _GMP_REPEAT_L3_434(call, data) call(434, data)
+#define _GMP_REPEAT_L3_436(call, data) _GMP_REPEAT_L3_435(call, data) call(435, data)
+#define _GMP_REPEAT_L3_437(call, data) _GMP_REPEAT_L3_436(call, data) call(436, data)
+#define _GMP_REPEAT_L3_438(call, data) _GMP_REPEAT_L3_437(call, data) call(437, data)
+#define _GMP_REPEAT_L3_439(call, data) _GMP_REPEAT_L3_438(call, data) call(438, data)
+#define _GMP_REPEAT_L3_440(call, data) _GMP_REPEAT_L3_439(call, data) call(439, data)
+#define _GMP_REPEAT_L3_441(call, data) _GMP_REPEAT_L3_440(call, data) call(440, data)
+#define _GMP_REPEAT_L3_442(call, data) _GMP_REPEAT_L3_441(call, data) call(441, data)
+#define _GMP_REPEAT_L3_443(call, data) _GMP_REPEAT_L3_442(call, data) call(442, data)
+#define _GMP_REPEAT_L3_444(call, data) _GMP_REPEAT_L3_443(call, data) call(443, data)
+#define _GMP_REPEAT_L3_445(call, data) _GMP_REPEAT_L3_444(call, data) call(444, data)
+#define _GMP_REPEAT_L3_446(call, data) _GMP_REPEAT_L3_445(call, data) call(445, data)
+#define _GMP_REPEAT_L3_447(call, data) _GMP_REPEAT_L3_446(call, data) call(446, data)
+#define _GMP_REPEAT_L3_448(call, data) _GMP_REPEAT_L3_447(call, data) call(447, data)
+#define _GMP_REPEAT_L3_449(call, data) _GMP_REPEAT_L3_448(call, data) call(448, data)
+#define _GMP_REPEAT_L3_450(call, data) _GMP_REPEAT_L3_449(call, data) call(449, data)
+#define _GMP_REPEAT_L3_451(call, data) _GMP_REPEAT_L3_450(call, data) call(450, data)
+#define _GMP_REPEAT_L3_452(call, data) _GMP_REPEAT_L3_451(call, data) call(451, data)
+#define _GMP_REPEAT_L3_453(call, data) _GMP_REPEAT_L3_452(call, data) call(452, data)
+#define _GMP_REPEAT_L3_454(call, data) _GMP_REPEAT_L3_453(call, data) call(453, data)
+#define _GMP_REPEAT_L3_455(call, data) _GMP_REPEAT_L3_454(call, data) call(454, data)
+#define _GMP_REPEAT_L3_456(call, data) _GMP_REPEAT_L3_455(call, data) call(455, data)
+#define _GMP_REPEAT_L3_457(call, data) _GMP_REPEAT_L3_456(call, data) call(456, data)
+#define _GMP_REPEAT_L3_458(call, data) _GMP_REPEAT_L3_457(call, data) call(457, data)
+#define _GMP_REPEAT_L3_459(call, data) _GMP_REPEAT_L3_458(call, data) call(458, data)
+#define _GMP_REPEAT_L3_460(call, data) _GMP_REPEAT_L3_459(call, data) call(459, data)
+#define _GMP_REPEAT_L3_461(call, data) _GMP_REPEAT_L3_460(call, data) call(460, data)
+#define _GMP_REPEAT_L3_462(call, data) _GMP_REPEAT_L3_461(call, data) call(461, data)
+#define _GMP_REPEAT_L3_463(call, data) _GMP_REPEAT_L3_462(call, data) call(462, data)
+#define _GMP_REPEAT_L3_464(call, data) _GMP_REPEAT_L3_463(call, data) call(463, data)
+#define _GMP_REPEAT_L3_465(call, data) _GMP_REPEAT_L3_464(call, data) call(464, data)
+#define _GMP_REPEAT_L3_466(call, data) _GMP_REPEAT_L3_465(call, data) call(465, data)
+#define _GMP_REPEAT_L3_467(call, data) _GMP_REPEAT_L3_466(call, data) call(466, data)
+#define _GMP_REPEAT_L3_468(call, data) _GMP_REPEAT_L3_467(call, data) call(467, data)
+#define _GMP_REPEAT_L3_469(call, data) _GMP_REPEAT_L3_468(call, data) call(468, data)
+#define _GMP_REPEAT_L3_470(call, data) _GMP_REPEAT_L3_469(call, data) call(469, data)
+#define _GMP_REPEAT_L3_471(call, data) _GMP_REPEAT_L3_470(call, data) call(470, data)
+#define _GMP_REPEAT_L3_472(call, data) _GMP_REPEAT_L3_471(call, data) call(471, data)
+#define _GMP_REPEAT_L3_473(call, data) _GMP_REPEAT_L3_472(call, data) call(472, data)
+#define _GMP_REPEAT_L3_474(call, data) _GMP_REPEAT_L3_473(call, data) call(473, data)
+#define _GMP_REPEAT_L3_475(call, data) _GMP_REPEAT_L3_474(call, data) call(474, data)
+#define _GMP_REPEAT_L3_476(call, data) _GMP_REPEAT_L3_475(call, data) call(475, data)
+#define _GMP_REPEAT_L3_477(call, data) _GMP_REPEAT_L3_476(call, data) call(476, data)
+#define _GMP_REPEAT_L3_478(call, data) _GMP_REPEAT_L3_477(call, data) call(477, data)
+#define _GMP_REPEAT_L3_479(call, data) _GMP_REPEAT_L3_478(call, data) call(478, data)
+#define _GMP_REPEAT_L3_480(call, data) _GMP_REPEAT_L3_479(call, data) call(479, data)
+#define _GMP_REPEAT_L3_481(call, data) _GMP_REPEAT_L3_480(call, data) call(480, data)
+#define _GMP_REPEAT_L3_482(call, data) _GMP_REPEAT_L3_481(call, data) call(481, data)
+#define _GMP_REPEAT_L3_483(call, data) _GMP_REPEAT_L3_482(call, data) call(482, data)
+#define _GMP_REPEAT_L3_484(call, data) _GMP_REPEAT_L3_483(call, data) call(483, data)
+#define _GMP_REPEAT_L3_485(call, data) _GMP_REPEAT_L3_484(call, data) call(484, data)
+#define _GMP_REPEAT_L3_486(call, data) _GMP_REPEAT_L3_485(call, data) call(485, data)
+#define _GMP_REPEAT_L3_487(call, data) _GMP_REPEAT_L3_486(call, data) call(486, data)
+#define _GMP_REPEAT_L3_488(call, data) _GMP_REPEAT_L3_487(call, data) call(487, data)
+#define _GMP_REPEAT_L3_489(call, data) _GMP_REPEAT_L3_488(call, data) call(488, data)
+#define _GMP_REPEAT_L3_490(call, data) _GMP_REPEAT_L3_489(call, data) call(489, data)
+#define _GMP_REPEAT_L3_491(call, data) _GMP_REPEAT_L3_490(call, data) call(490, data)
+#define _GMP_REPEAT_L3_492(call, data) _GMP_REPEAT_L3_491(call, data) call(491, data)
+#define _GMP_REPEAT_L3_493(call, data) _GMP_REPEAT_L3_492(call, data) call(492, data)
+#define _GMP_REPEAT_L3_494(call, data) _GMP_REPEAT_L3_493(call, data) call(493, data)
+#define _GMP_REPEAT_L3_495(call, data) _GMP_REPEAT_L3_494(call, data) call(494, data)
+#define _GMP_REPEAT_L3_496(call, data) _GMP_REPEAT_L3_495(call, data) call(495, data)
+#define _GMP_REPEAT_L3_497(call, data) _GMP_REPEAT_L3_496(call, data) call(496, data)
+#define _GMP_REPEAT_L3_498(call, data) _GMP_REPEAT_L3_497(call, data) call(497, data)
+#define _GMP_REPEAT_L3_499(call, data) _GMP_REPEAT_L3_498(call, data) call(498, data)
+#define _GMP_REPEAT_L3_500(call, data) _GMP_REPEAT_L3_499(call, data) call(499, data)
+#define _GMP_REPEAT_L3_501(call, data) _GMP_REPEAT_L3_500(call, data) call(500, data)
+#define _GMP_REPEAT_L3_502(call, data) _GMP_REPEAT_L3_501(call, data) call(501, data)
+#define _GMP_REPEAT_L3_503(call, data) _GMP_REPEAT_L3_502(call, data) call(502, data)
+#define _GMP_REPEAT_L3_504(call, data) _GMP_REPEAT_L3_503(call, data) call(503, data)
+#define _GMP_REPEAT_L3_505(call, data) _GMP_REPEAT_L3_504(call, data) call(504, data)
+#define _GMP_REPEAT_L3_506(call, data) _GMP_REPEAT_L3_505(call, data) call(505, data)
+#define _GMP_REPEAT_L3_507(call, data) _GMP_REPEAT_L3_506(call, data) call(506, data)
+#define _GMP_REPEAT_L3_508(call, data) _GMP_REPEAT_L3_507(call, data) call(507, data)
+#define _GMP_REPEAT_L3_509(call, data) _GMP_REPEAT_L3_508(call, data) call(508, data)
+#define _GMP_REPEAT_L3_510(call, data) _GMP_REPEAT_L3_509(call, data) call(509, data)
+#define _GMP_REPEAT_L3_511(call, data) _GMP_REPEAT_L3_510(call, data) call(510, data)
+#define _GMP_REPEAT_L3_512(call, data) _GMP_REPEAT_L3_511(call, data) call(511, data)
+#define _GMP_REPEAT_L3_513(call, data) _GMP_REPEAT_L3_512(call, data) call(512, data)
+#define _GMP_REPEAT_L3_514(call, data) _GMP_REPEAT_L3_513(call, data) call(513, data)
+#define _GMP_REPEAT_L3_515(call, data) _GMP_REPEAT_L3_514(call, data) call(514, data)
+#define _GMP_REPEAT_L3_516(call, data) _GMP_REPEAT_L3_515(call, data) call(515, data)
+#define _GMP_REPEAT_L3_517(call, data) _GMP_REPEAT_L3_516(call, data) call(516, data)
+#define _GMP_REPEAT_L3_518(call, data) _GMP_REPEAT_L3_517(call, data) call(517, data)
+#define _GMP_REPEAT_L3_519(call, data) _GMP_REPEAT_L3_518(call, data) call(518, data)
+#define _GMP_REPEAT_L3_520(call, data) _GMP_REPEAT_L3_519(call, data) call(519, data)
+#define _GMP_REPEAT_L3_521(call, data) _GMP_REPEAT_L3_520(call, data) call(520, data)
+#define _GMP_REPEAT_L3_522(call, data) _GMP_REPEAT_L3_521(call, data) call(521, data)
+#define _GMP_REPEAT_L3_523(call, data) _GMP_REPEAT_L3_522(call, data) call(522, data)
+#define _GMP_REPEAT_L3_524(call, data) _GMP_REPEAT_L3_523(call, data) call(523, data)
+#define _GMP_REPEAT_L3_525(call, data) _GMP_REPEAT_L3_524(call, data) call(524, data)
+#define _GMP_REPEAT_L3_526(call, data) _GMP_REPEAT_L3_525(call, data) call(525, data)
+#define _GMP_REPEAT_L3_527(call, data) _GMP_REPEAT_L3_526(call, data) call(526, data)
+#define _GMP_REPEAT_L3_528(call, data) _GMP_REPEAT_L3_527(call, data) call(527, data)
+#define _GMP_REPEAT_L3_529(call, data) _GMP_REPEAT_L3_528(call, data) call(528, data)
+#define _GMP_REPEAT_L3_530(call, data) _GMP_REPEAT_L3_529(call, data) call(529, data)
+#define _GMP_REPEAT_L3_531(call, data) _GMP_REPEAT_L3_530(call, data) call(530, data)
+#define _GMP_REPEAT_L3_532(call, data) _GMP_REPEAT_L3_531(call, data) call(531, data)
+#define _GMP_REPEAT_L3_533(call, data) _GMP_REPEAT_L3_532(call, data) call(532, data)
+#define _GMP_REPEAT_L3_534(call, data) _GMP_REPEAT_L3_533(call, data) call(533, data)
+#define _GMP_REPEAT_L3_535(call, data) _GMP_REPEAT_L3_534(call, data) call(534, data)
+#define _GMP_REPEAT_L3_536(call, data) _GMP_REPEAT_L3_535(call, data) call(535, data)
+#define _GMP_REPEAT_L3_537(call, data) _GMP_REPEAT_L3_536(call, data) call(536, data)
+#define _GMP_REPEAT_L3_538(call, data) _GMP_REPEAT_L3_537(call, data) call(537, data)
+#define _GMP_REPEAT_L3_539(call, data) _GMP_REPEAT_L3_538(call, data) call(538, data)
+#define _GMP_REPEAT_L3_540(call, data) _GMP_REPEAT_L3_539(call, data) call(539, data)
+#define _GMP_REPEAT_L3_541(call, data) _GMP_REPEAT_L3_540(call, data) call(540, data)
+#define _GMP_REPEAT_L3_542(call, data) _GMP_REPEAT_L3_541(call, data) call(541, data)
+#define _GMP_REPEAT_L3_543(call, data) _GMP_REPEAT_L3_542(call, data) call(542, data)
+#define _GMP_REPEAT_L3_544(call, data) _GMP_REPEAT_L3_543(call, data) call(543, data)
+#define _GMP_REPEAT_L3_545(call, data) _GMP_REPEAT_L3_544(call, data) call(544, data)
+#define _GMP_REPEAT_L3_546(call, data) _GMP_REPEAT_L3_545(call, data) call(545, data)
+#define _GMP_REPEAT_L3_547(call, data) _GMP_REPEAT_L3_546(call, data) call(546, data)
+#define _GMP_REPEAT_L3_548(call, data) _GMP_REPEAT_L3_547(call, data) call(547, data)
+#define _GMP_REPEAT_L3_549(call, data) _GMP_REPEAT_L3_548(call, data) call(548, data)
+#define _GMP_REPEAT_L3_550(call, data) _GMP_REPEAT_L3_549(call, data) call(549, data)
+#define _GMP_REPEAT_L3_551(call, data) _GMP_REPEAT_L3_550(call, data) call(550, data)
+#define _GMP_REPEAT_L3_552(call, data) _GMP_REPEAT_L3_551(call, data) call(551, data)
+#define _GMP_REPEAT_L3_553(call, data) _GMP_REPEAT_L3_552(call, data) call(552, data)
+#define _GMP_REPEAT_L3_554(call, data) _GMP_REPEAT_L3_553(call, data) call(553, data)
+#define _GMP_REPEAT_L3_555(call, data) _GMP_REPEAT_L3_554(call, data) call(554, data)
+#define _GMP_REPEAT_L3_556(call, data) _GMP_REPEAT_L3_555(call, data) call(555, data)
+#define _GMP_REPEAT_L3_557(call, data) _GMP_REPEAT_L3_556(call, data) call(556, data)
+#define _GMP_REPEAT_L3_558(call, data) _GMP_REPEAT_L3_557(call, data) call(557, data)
+#define _GMP_REPEAT_L3_559(call, data) _GMP_REPEAT_L3_558(call, data) call(558, data)
+#define _GMP_REPEAT_L3_560(call, data) _GMP_REPEAT_L3_559(call, data) call(559, data)
+#define _GMP_REPEAT_L3_561(call, data) _GMP_REPEAT_L3_560(call, data) call(560, data)
+#define _GMP_REPEAT_L3_562(call, data) _GMP_REPEAT_L3_561(call, data) call(561, data)
+#define _GMP_REPEAT_L3_563(call, data) _GMP_REPEAT_L3_562(call, data) call(562, data)
+#define _GMP_REPEAT_L3_564(call, data) _GMP_REPEAT_L3_563(call, data) call(563, data)
+#define _GMP_REPEAT_L3_565(call, data) _GMP_REPEAT_L3_564(call, data) call(564, data)
+#define _GMP_REPEAT_L3_566(call, data) _GMP_REPEAT_L3_565(call, data) call(565, data)
+#define _GMP_REPEAT_L3_567(call, data) _GMP_REPEAT_L3_566(call, data) call(566, data)
+#define _GMP_REPEAT_L3_568(call, data) _GMP_REPEAT_L3_567(call, data) call(567, data)
+#define _GMP_REPEAT_L3_569(call, data) _GMP_REPEAT_L3_568(call, data) call(568, data)
+#define _GMP_REPEAT_L3_570(call, data) _GMP_REPEAT_L3_569(call, data) call(569, data)
+#define _GMP_REPEAT_L3_571(call, data) _GMP_REPEAT_L3_570(call, data) call(570, data)
+#define _GMP_REPEAT_L3_572(call, data) _GMP_REPEAT_L3_571(call, data) call(571, data)
+#define _GMP_REPEAT_L3_573(call, data) _GMP_REPEAT_L3_572(call, data) call(572, data)
+#define _GMP_REPEAT_L3_574(call, data) _GMP_REPEAT_L3_573(call, data) call(573, data)
+#define _GMP_REPEAT_L3_575(call, data) _GMP_REPEAT_L3_574(call, data) call(574, data)
+#define _GMP_REPEAT_L3_576(call, data) _GMP_REPEAT_L3_575(call, data) call(575, data)
+#define _GMP_REPEAT_L3_577(call, data) _GMP_REPEAT_L3_576(call, data) call(576, data)
+#define _GMP_REPEAT_L3_578(call, data) _GMP_REPEAT_L3_577(call, data) call(577, data)
+#define _GMP_REPEAT_L3_579(call, data) _GMP_REPEAT_L3_578(call, data) call(578, data)
+#define _GMP_REPEAT_L3_580(call, data) _GMP_REPEAT_L3_579(call, data) call(579, data)
+#define _GMP_REPEAT_L3_581(call, data) _GMP_REPEAT_L3_580(call, data) call(580, data)
+#define _GMP_REPEAT_L3_582(call, data) _GMP_REPEAT_L3_581(call, data) call(581, data)
+#define _GMP_REPEAT_L3_583(call, data) _GMP_REPEAT_L3_582(call, data) call(582, data)
+#define _GMP_REPEAT_L3_584(call, data) _GMP_REPEAT_L3_583(call, data) call(583, data)
+#define _GMP_REPEAT_L3_585(call, data) _GMP_REPEAT_L3_584(call, data) call(584, data)
+#define _GMP_REPEAT_L3_586(call, data) _GMP_REPEAT_L3_585(call, data) call(585, data)
+#define _GMP_REPEAT_L3_587(call, data) _GMP_REPEAT_L3_586(call, data) call(586, data)
+#define _GMP_REPEAT_L3_588(call, data) _GMP_REPEAT_L3_587(call, data) call(587, data)
+#define _GMP_REPEAT_L3_589(call, data) _GMP_REPEAT_L3_588(call, data) call(588, data)
+#define _GMP_REPEAT_L3_590(call, data) _GMP_REPEAT_L3_589(call, data) call(589, data)
+#define _GMP_REPEAT_L3_591(call, data) _GMP_REPEAT_L3_590(call, data) call(590, data)
+#define _GMP_REPEAT_L3_592(call, data) _GMP_REPEAT_L3_591(call, data) call(591, data)
+#define _GMP_REPEAT_L3_593(call, data) _GMP_REPEAT_L3_592(call, data) call(592, data)
+#define _GMP_REPEAT_L3_594(call, data) _GMP_REPEAT_L3_593(call, data) call(593, data)
+#define _GMP_REPEAT_L3_595(call, data) _GMP_REPEAT_L3_594(call, data) call(594, data)
+#define _GMP_REPEAT_L3_596(call, data) _GMP_REPEAT_L3_595(call, data) call(595, data)
+#define _GMP_REPEAT_L3_597(call, data) _GMP_REPEAT_L3_596(call, data) call(596, data)
+#define _GMP_REPEAT_L3_598(call, data) _GMP_REPEAT_L3_597(call, data) call(597, data)
+#define _GMP_REPEAT_L3_599(call, data) _GMP_REPEAT_L3_598(call, data) call(598, data)
+#define _GMP_REPEAT_L3_600(call, data) _GMP_REPEAT_L3_599(call, data) call(599, data)
+#define _GMP_REPEAT_L3_601(call, data) _GMP_REPEAT_L3_600(call, data) call(600, data)
+#define _GMP_REPEAT_L3_602(call, data) _GMP_REPEAT_L3_601(call, data) call(601, data)
+#define _GMP_REPEAT_L3_603(call, data) _GMP_REPEAT_L3_602(call, data) call(602, data)
+#define _GMP_REPEAT_L3_604(call, data) _GMP_REPEAT_L3_603(call, data) call(603, data)
+#define _GMP_REPEAT_L3_605(call, data) _GMP_REPEAT_L3_604(call, data) call(604, data)
+#define _GMP_REPEAT_L3_606(call, data) _GMP_REPEAT_L3_605(call, data) call(605, data)
+#define _GMP_REPEAT_L3_607(call, data) _GMP_REPEAT_L3_606(call, data) call(606, data)
+#define _GMP_REPEAT_L3_608(call, data) _GMP_REPEAT_L3_607(call, data) call(607, data)
+#define _GMP_REPEAT_L3_609(call, data) _GMP_REPEAT_L3_608(call, data) call(608, data)
+#define _GMP_REPEAT_L3_610(call, data) _GMP_REPEAT_L3_609(call, data) call(609, data)
+#define _GMP_REPEAT_L3_611(call, data) _GMP_REPEAT_L3_610(call, data) call(610, data)
+#define _GMP_REPEAT_L3_612(call, data) _GMP_REPEAT_L3_611(call, data) call(611, data)
+#define _GMP_REPEAT_L3_613(call, data) _GMP_REPEAT_L3_612(call, data) call(612, data)
+#define _GMP_REPEAT_L3_614(call, data) _GMP_REPEAT_L3_613(call, data) call(613, data)
+#define _GMP_REPEAT_L3_615(call, data) _GMP_REPEAT_L3_614(call, data) call(614, data)
+#define _GMP_REPEAT_L3_616(call, data) _GMP_REPEAT_L3_615(call, data) call(615, data)
+#define _GMP_REPEAT_L3_617(call, data) _GMP_REPEAT_L3_616(call, data) call(616, data)
+#define _GMP_REPEAT_L3_618(call, data) _GMP_REPEAT_L3_617(call, data) call(617, data)
+#define _GMP_REPEAT_L3_619(call, data) _GMP_REPEAT_L3_618(call, data) call(618, data)
+#define _GMP_REPEAT_L3_620(call, data) _GMP_REPEAT_L3_619(call, data) call(619, data)
+#define _GMP_REPEAT_L3_621(call, data) _GMP_REPEAT_L3_620(call, data) call(620, data)
+#define _GMP_REPEAT_L3_622(call, data) _GMP_REPEAT_L3_621(call, data) call(621, data)
+#define _GMP_REPEAT_L3_623(call, data) _GMP_REPEAT_L3_622(call, data) call(622, data)
+#define _GMP_REPEAT_L3_624(call, data) _GMP_REPEAT_L3_623(call, data) call(623, data)
+#define _GMP_REPEAT_L3_625(call, data) _GMP_REPEAT_L3_624(call, data) call(624, data)
+#define _GMP_REPEAT_L3_626(call, data) _GMP_REPEAT_L3_625(call, data) call(625, data)
+#define _GMP_REPEAT_L3_627(call, data) _GMP_REPEAT_L3_626(call, data) call(626, data)
+#define _GMP_REPEAT_L3_628(call, data) _GMP_REPEAT_L3_627(call, data) call(627, data)
+#define _GMP_REPEAT_L3_629(call, data) _GMP_REPEAT_L3_628(call, data) call(628, data)
+#define _GMP_REPEAT_L3_630(call, data) _GMP_REPEAT_L3_629(call, data) call(629, data)
+#define _GMP_REPEAT_L3_631(call, data) _GMP_REPEAT_L3_630(call, data) call(630, data)
+#define _GMP_REPEAT_L3_632(call, data) _GMP_REPEAT_L3_631(call, data) call(631, data)
+#define _GMP_REPEAT_L3_633(call, data) _GMP_REPEAT_L3_632(call, data) call(632, data)
+#define _GMP_REPEAT_L3_634(call, data) _GMP_REPEAT_L3_633(call, data) call(633, data)
+#define _GMP_REPEAT_L3_635(call, data) _GMP_REPEAT_L3_634(call, data) call(634, data)
+#define _GMP_REPEAT_L3_636(call, data) _GMP_REPEAT_L3_635(call, data) call(635, data)
+#define _GMP_REPEAT_L3_637(call, data) _GMP_REPEAT_L3_636(call, data) call(636, data)
+#define _GMP_REPEAT_L3_638(call, data) _GMP_REPEAT_L3_637(call, data) call(637, data)
+#define _GMP_REPEAT_L3_639(call, data) _GMP_REPEAT_L3_638(call, data) call(638, data)
+#define _GMP_REPEAT_L3_640(call, data) _GMP_REPEAT_L3_639(call, data) call(639, data)
+#define _GMP_REPEAT_L3_641(call, data) _GMP_REPEAT_L3_640(call, data) call(640, data)
+#define _GMP_REPEAT_L3_642(call, data) _GMP_REPEAT_L3_641(call, data) call(641, data)
+#define _GMP_REPEAT_L3_643(call, data) _GMP_REPEAT_L3_642(call, data) call(642, data)
+#define _GMP_REPEAT_L3_644(call, data) _GMP_REPEAT_L3_643(call, data) call(643, data)
+#define _GMP_REPEAT_L3_645(call, data) _GMP_REPEAT_L3_644(call, data) call(644, data)
+#define _GMP_REPEAT_L3_646(call, data) _GMP_REPEAT_L3_645(call, data) call(645, data)
+#define _GMP_REPEAT_L3_647(call, data) _GMP_REPEAT_L3_646(call, data) call(646, data)
+#define _GMP_REPEAT_L3_648(call, data) _GMP_REPEAT_L3_647(call, data) call(647, data)
+#define _GMP_REPEAT_L3_649(call, data) _GMP_REPEAT_L3_648(call, data) call(648, data)
+#define _GMP_REPEAT_L3_650(call, data) _GMP_REPEAT_L3_649(call, data) call(649, data)
+#define _GMP_REPEAT_L3_651(call, data) _GMP_REPEAT_L3_650(call, data) call(650, data)
+#define _GMP_REPEAT_L3_652(call, data) _GMP_REPEAT_L3_651(call, data) call(651, data)
+#define _GMP_REPEAT_L3_653(call, data) _GMP_REPEAT_L3_652(call, data) call(652, data)
+#define _GMP_REPEAT_L3_654(call, data) _GMP_REPEAT_L3_653(call, data) call(653, data)
+#define _GMP_REPEAT_L3_655(call, data) _GMP_REPEAT_L3_654(call, data) call(654, data)
+#define _GMP_REPEAT_L3_656(call, data) _GMP_REPEAT_L3_655(call, data) call(655, data)
+#define _GMP_REPEAT_L3_657(call, data) _GMP_REPEAT_L3_656(call, data) call(656, data)
+#define _GMP_REPEAT_L3_658(call, data) _GMP_REPEAT_L3_657(call, data) call(657, data)
+#define _GMP_REPEAT_L3_659(call, data) _GMP_REPEAT_L3_658(call, data) call(658, data)
+#define _GMP_REPEAT_L3_660(call, data) _GMP_REPEAT_L3_659(call, data) call(659, data)
+#define _GMP_REPEAT_L3_661(call, data) _GMP_REPEAT_L3_660(call, data) call(660, data)
+#define _GMP_REPEAT_L3_662(call, data) _GMP_REPEAT_L3_661(call, data) call(661, data)
+#define _GMP_REPEAT_L3_663(call, data) _GMP_REPEAT_L3_662(call, data) call(662, data)
+#define _GMP_REPEAT_L3_664(call, data) _GMP_REPEAT_L3_663(call, data) call(663, data)
+#define _GMP_REPEAT_L3_665(call, data) _GMP_REPEAT_L3_664(call, data) call(664, data)
+#define _GMP_REPEAT_L3_666(call, data) _GMP_REPEAT_L3_665(call, data) call(665, data)
+#define _GMP_REPEAT_L3_667(call, data) _GMP_REPEAT_L3_666(call, data) call(666, data)
+#define _GMP_REPEAT_L3_668(call, data) _GMP_REPEAT_L3_667(call, data) call(667, data)
+#define _GMP_REPEAT_L3_669(call, data) _GMP_REPEAT_L3_668(call, data) call(668, data)
+#define _GMP_REPEAT_L3_670(call, data) _GMP_REPEAT_L3_669(call, data) call(669, data)
+#define _GMP_REPEAT_L3_671(call, data) _GMP_REPEAT_L3_670(call, data) call(670, data)
+#define _GMP_REPEAT_L3_672(call, data) _GMP_REPEAT_L3_671(call, data) call(671, data)
+#define _GMP_REPEAT_L3_673(call, data) _GMP_REPEAT_L3_672(call, data) call(672, data)
+#define _GMP_REPEAT_L3_674(call, data) _GMP_REPEAT_L3_673(call, data) call(673, data)
+#define _GMP_REPEAT_L3_675(call, data) _GMP_REPEAT_L3_674(call, data) call(674, data)
+#define _GMP_REPEAT_L3_676(call, data) _GMP_REPEAT_L3_675(call, data) call(675, data)
+#define _GMP_REPEAT_L3_677(call, data) _GMP_REPEAT_L3_676(call, data) call(676, data)
+#define _GMP_REPEAT_L3_678(call, data) _GMP_REPEAT_L3_677(call, data) call(677, data)
+#define _GMP_REPEAT_L3_679(call, data) _GMP_REPEAT_L3_678(call, data) call(678, data)
+#define _GMP_REPEAT_L3_680(call, data) _GMP_REPEAT_L3_679(call, data) call(679, data)
+#define _GMP_REPEAT_L3_681(call, data) _GMP_REPEAT_L3_680(call, data) call(680, data)
+#define _GMP_REPEAT_L3_682(call, data) _GMP_REPEAT_L3_681(call, data) call(681, data)
+#define _GMP_REPEAT_L3_683(call, data) _GMP_REPEAT_L3_682(call, data) call(682, data)
+#define _GMP_REPEAT_L3_684(call, data) _GMP_REPEAT_L3_683(call, data) call(683, data)
+#define _GMP_REPEAT_L3_685(call, data) _GMP_REPEAT_L3_684(call, data) call(684, data)
+#define _GMP_REPEAT_L3_686(call, data) _GMP_REPEAT_L3_685(call, data) call(685, data)
+#define _GMP_REPEAT_L3_687(call, data) _GMP_REPEAT_L3_686(call, data) call(686, data)
+#define _GMP_REPEAT_L3_688(call, data) _GMP_REPEAT_L3_687(call, data) call(687, data)
+#define _GMP_REPEAT_L3_689(call, data) _GMP_REPEAT_L3_688(call, data) call(688, data)
+#define _GMP_REPEAT_L3_690(call, data) _GMP_REPEAT_L3_689(call, data) call(689, data)
+#define _GMP_REPEAT_L3_691(call, data) _GMP_REPEAT_L3_690(call, data) call(690, data)
+#define _GMP_REPEAT_L3_692(call, data) _GMP_REPEAT_L3_691(call, data) call(691, data)
+#define _GMP_REPEAT_L3_693(call, data) _GMP_REPEAT_L3_692(call, data) call(692, data)
+#define _GMP_REPEAT_L3_694(call, data) _GMP_REPEAT_L3_693(call, data) call(693, data)
+#define _GMP_REPEAT_L3_695(call, data) _GMP_REPEAT_L3_694(call, data) call(694, data)
+#define _GMP_REPEAT_L3_696(call, data) _GMP_REPEAT_L3_695(call, data) call(695, data)
+#define _GMP_REPEAT_L3_697(call, data) _GMP_REPEAT_L3_696(call, data) call(696, data)
+#define _GMP_REPEAT_L3_698(call, data) _GMP_REPEAT_L3_697(call, data) call(697, data)
+#define _GMP_REPEAT_L3_699(call, data) _GMP_REPEAT_L3_698(call, data) call(698, data)
+#define _GMP_REPEAT_L3_700(call, data) _GMP_REPEAT_L3_699(call, data) call(699, data)
+#define _GMP_REPEAT_L3_701(call, data) _GMP_REPEAT_L3_700(call, data) call(700, data)
+#define _GMP_REPEAT_L3_702(call, data) _GMP_REPEAT_L3_701(call, data) call(701, data)
+#define _GMP_REPEAT_L3_703(call, data) _GMP_REPEAT_L3_702(call, data) call(702, data)
+#define _GMP_REPEAT_L3_704(call, data) _GMP_REPEAT_L3_703(call, data) call(703, data)
+#define _GMP_REPEAT_L3_705(call, data) _GMP_REPEAT_L3_704(call, data) call(704, data)
+#define _GMP_REPEAT_L3_706(call, data) _GMP_REPEAT_L3_705(call, data) call(705, data)
+#define _GMP_REPEAT_L3_707(call, data) _GMP_REPEAT_L3_706(call, data) call(706, data)
+#define _GMP_REPEAT_L3_708(call, data) _GMP_REPEAT_L3_707(call, data) call(707, data)
+#define _GMP_REPEAT_L3_709(call, data) _GMP_REPEAT_L3_708(call, data) call(708, data)
+#define _GMP_REPEAT_L3_710(call, data) _GMP_REPEAT_L3_709(call, data) call(709, data)
+#define _GMP_REPEAT_L3_711(call, data) _GMP_REPEAT_L3_710(call, data) call(710, data)
+#define _GMP_REPEAT_L3_712(call, data) _GMP_REPEAT_L3_711(call, data) call(711, data)
+#define _GMP_REPEAT_L3_713(call, data) _GMP_REPEAT_L3_712(call, data) call(712, data)
+#define _GMP_REPEAT_L3_714(call, data) _GMP_REPEAT_L3_713(call, data) call(713, data)
+#define _GMP_REPEAT_L3_715(call, data) _GMP_REPEAT_L3_714(call, data) call(714, data)
+#define _GMP_REPEAT_L3_716(call, data) _GMP_REPEAT_L3_715(call, data) call(715, data)
+#define _GMP_REPEAT_L3_717(call, data) _GMP_REPEAT_L3_716(call, data) call(716, data)
+#define _GMP_REPEAT_L3_718(call, data) _GMP_REPEAT_L3_717(call, data) call(717, data)
+#define _GMP_REPEAT_L3_719(call, data) _GMP_REPEAT_L3_718(call, data) call(718, data)
+#define _GMP_REPEAT_L3_720(call, data) _GMP_REPEAT_L3_719(call, data) call(719, data)
+#define _GMP_REPEAT_L3_721(call, data) _GMP_REPEAT_L3_720(call, data) call(720, data)
+#define _GMP_REPEAT_L3_722(call, data) _GMP_REPEAT_L3_721(call, data) call(721, data)
+#define _GMP_REPEAT_L3_723(call, data) _GMP_REPEAT_L3_722(call, data) call(722, data)
+#define _GMP_REPEAT_L3_724(call, data) _GMP_REPEAT_L3_723(call, data) call(723, data)
+#define _GMP_REPEAT_L3_725(call, data) _GMP_REPEAT_L3_724(call, data) call(724, data)
+#define _GMP_REPEAT_L3_726(call, data) _GMP_REPEAT_L3_725(call, data) call(725, data)
+#define _GMP_REPEAT_L3_727(call, data) _GMP_REPEAT_L3_726(call, data) call(726, data)
+#define _GMP_REPEAT_L3_728(call, data) _GMP_REPEAT_L3_727(call, data) call(727, data)
+#define _GMP_REPEAT_L3_729(call, data) _GMP_REPEAT_L3_728(call, data) call(728, data)
+#define _GMP_REPEAT_L3_730(call, data) _GMP_REPEAT_L3_729(call, data) call(729, data)
+#define _GMP_REPEAT_L3_731(call, data) _GMP_REPEAT_L3_730(call, data) call(730, data)
+#define _GMP_REPEAT_L3_732(call, data) _GMP_REPEAT_L3_731(call, data) call(731, data)
+#define _GMP_REPEAT_L3_733(call, data) _GMP_REPEAT_L3_732(call, data) call(732, data)
+#define _GMP_REPEAT_L3_734(call, data) _GMP_REPEAT_L3_733(call, data) call(733, data)
+#define _GMP_REPEAT_L3_735(call, data) _GMP_REPEAT_L3_734(call, data) call(734, data)
+#define _GMP_REPEAT_L3_736(call, data) _GMP_REPEAT_L3_735(call, data) call(735, data)
+#define _GMP_REPEAT_L3_737(call, data) _GMP_REPEAT_L3_736(call, data) call(736, data)
+#define _GMP_REPEAT_L3_738(call, data) _GMP_REPEAT_L3_737(call, data) call(737, data)
+#define _GMP_REPEAT_L3_739(call, data) _GMP_REPEAT_L3_738(call, data) call(738, data)
+#define _GMP_REPEAT_L3_740(call, data) _GMP_REPEAT_L3_739(call, data) call(739, data)
+#define _GMP_REPEAT_L3_741(call, data) _GMP_REPEAT_L3_740(call, data) call(740, data)
+#define _GMP_REPEAT_L3_742(call, data) _GMP_REPEAT_L3_741(call, data) call(741, data)
+#define _GMP_REPEAT_L3_743(call, data) _GMP_REPEAT_L3_742(call, data) call(742, data)
+#define _GMP_REPEAT_L3_744(call, data) _GMP_REPEAT_L3_743(call, data) call(743, data)
+#define _GMP_REPEAT_L3_745(call, data) _GMP_REPEAT_L3_744(call, data) call(744, data)
+#define _GMP_REPEAT_L3_746(call, data) _GMP_REPEAT_L3_745(call, data) call(745, data)
+#define _GMP_REPEAT_L3_747(call, data) _GMP_REPEAT_L3_746(call, data) call(746, data)
+#define _GMP_REPEAT_L3_748(call, data) _GMP_REPEAT_L3_747(call, data) call(747, data)
+#define _GMP_REPEAT_L3_749(call, data) _GMP_REPEAT_L3_748(call, data) call(748, data)
+#define _GMP_REPEAT_L3_750(call, data) _GMP_REPEAT_L3_749(call, data) call(749, data)
+#define _GMP_REPEAT_L3_751(call, data) _GMP_REPEAT_L3_750(call, data) call(750, data)
+#define _GMP_REPEAT_L3_752(call, data) _GMP_REPEAT_L3_751(call, data) call(751, data)
+#define _GMP_REPEAT_L3_753(call, data) _GMP_REPEAT_L3_752(call, data) call(752, data)
+#define _GMP_REPEAT_L3_754(call, data) _GMP_REPEAT_L3_753(call, data) call(753, data)
+#define _GMP_REPEAT_L3_755(call, data) _GMP_REPEAT_L3_754(call, data) call(754, data)
+#define _GMP_REPEAT_L3_756(call, data) _GMP_REPEAT_L3_755(call, data) call(755, data)
+#define _GMP_REPEAT_L3_757(call, data) _GMP_REPEAT_L3_756(call, data) call(756, data)
+#define _GMP_REPEAT_L3_758(call, data) _GMP_REPEAT_L3_757(call, data) call(757, data)
+#define _GMP_REPEAT_L3_759(call, data) _GMP_REPEAT_L3_758(call, data) call(758, data)
+#define _GMP_REPEAT_L3_760(call, data) _GMP_REPEAT_L3_759(call, data) call(759, data)
+#define _GMP_REPEAT_L3_761(call, data) _GMP_REPEAT_L3_760(call, data) call(760, data)
+#define _GMP_REPEAT_L3_762(call, data) _GMP_REPEAT_L3_761(call, data) call(761, data)
+#define _GMP_REPEAT_L3_763(call, data) _GMP_REPEAT_L3_762(call, data) call(762, data)
+#define _GMP_REPEAT_L3_764(call, data) _GMP_REPEAT_L3_763(call, data) call(763, data)
+#define _GMP_REPEAT_L3_765(call, data) _GMP_REPEAT_L3_764(call, data) call(764, data)
+#define _GMP_REPEAT_L3_766(call, data) _GMP_REPEAT_L3_765(call, data) call(765, data)
+#define _GMP_REPEAT_L3_767(call, data) _GMP_REPEAT_L3_766(call, data) call(766, data)
+#define _GMP_REPEAT_L3_768(call, data) _GMP_REPEAT_L3_767(call, data) call(767, data)
+#define _GMP_REPEAT_L3_769(call, data) _GMP_REPEAT_L3_768(call, data) call(768, data)
+#define _GMP_REPEAT_L3_770(call, data) _GMP_REPEAT_L3_769(call, data) call(769, data)
+#define _GMP_REPEAT_L3_771(call, data) _GMP_REPEAT_L3_770(call, data) call(770, data)
+#define _GMP_REPEAT_L3_772(call, data) _GMP_REPEAT_L3_771(call, data) call(771, data)
+#define _GMP_REPEAT_L3_773(call, data) _GMP_REPEAT_L3_772(call, data) call(772, data)
+#define _GMP_REPEAT_L3_774(call, data) _GMP_REPEAT_L3_773(call, data) call(773, data)
+#define _GMP_REPEAT_L3_775(call, data) _GMP_REPEAT_L3_774(call, data) call(774, data)
+#define _GMP_REPEAT_L3_776(call, data) _GMP_REPEAT_L3_775(call, data) call(775, data)
+#define _GMP_REPEAT_L3_777(call, data) _GMP_REPEAT_L3_776(call, data) call(776, data)
+#define _GMP_REPEAT_L3_778(call, data) _GMP_REPEAT_L3_777(call, data) call(777, data)
+#define _GMP_REPEAT_L3_779(call, data) _GMP_REPEAT_L3_778(call, data) call(778, data)
+#define _GMP_REPEAT_L3_780(call, data) _GMP_REPEAT_L3_779(call, data) call(779, data)
+#define _GMP_REPEAT_L3_781(call, data) _GMP_REPEAT_L3_780(call, data) call(780, data)
+#define _GMP_REPEAT_L3_782(call, data) _GMP_REPEAT_L3_781(call, data) call(781, data)
+#define _GMP_REPEAT_L3_783(call, data) _GMP_REPEAT_L3_782(call, data) call(782, data)
+#define _GMP_REPEAT_L3_784(call, data) _GMP_REPEAT_L3_783(call, data) call(783, data)
+#define _GMP_REPEAT_L3_785(call, data) _GMP_REPEAT_L3_784(call, data) call(784, data)
+#define _GMP_REPEAT_L3_786(call, data) _GMP_REPEAT_L3_785(call, data) call(785, data)
+#define _GMP_REPEAT_L3_787(call, data) _GMP_REPEAT_L3_786(call, data) call(786, data)
+#define _GMP_REPEAT_L3_788(call, data) _GMP_REPEAT_L3_787(call, data) call(787, data)
+#define _GMP_REPEAT_L3_789(call, data) _GMP_REPEAT_L3_788(call, data) call(788, data)
+#define _GMP_REPEAT_L3_790(call, data) _GMP_REPEAT_L3_789(call, data) call(789, data)
+#define _GMP_REPEAT_L3_791(call, data) _GMP_REPEAT_L3_790(call, data) call(790, data)
+#define _GMP_REPEAT_L3_792(call, data) _GMP_REPEAT_L3_791(call, data) call(791, data)
+#define _GMP_REPEAT_L3_793(call, data) _GMP_REPEAT_L3_792(call, data) call(792, data)
+#define _GMP_REPEAT_L3_794(call, data) _GMP_REPEAT_L3_793(call, data) call(793, data)
+#define _GMP_REPEAT_L3_795(call, data) _GMP_REPEAT_L3_794(call, data) call(794, data)
+#define _GMP_REPEAT_L3_796(call, data) _GMP_REPEAT_L3_795(call, data) call(795, data)
+#define _GMP_REPEAT_L3_797(call, data) _GMP_REPEAT_L3_796(call, data) call(796, data)
+#define _GMP_REPEAT_L3_798(call, data) _GMP_REPEAT_L3_797(call, data) call(797, data)
+#define _GMP_REPEAT_L3_799(call, data) _GMP_REPEAT_L3_798(call, data) call(798, data)
+#define _GMP_REPEAT_L3_800(call, data) _GMP_REPEAT_L3_799(call, data) call(799, data)
+#define _GMP_REPEAT_L3_801(call, data) _GMP_REPEAT_L3_800(call, data) call(800, data)
+#define _GMP_REPEAT_L3_802(call, data) _GMP_REPEAT_L3_801(call, data) call(801, data)
+#define _GMP_REPEAT_L3_803(call, data) _GMP_REPEAT_L3_802(call, data) call(802, data)
+#define _GMP_REPEAT_L3_804(call, data) _GMP_REPEAT_L3_803(call, data) call(803, data)
+#define _GMP_REPEAT_L3_805(call, data) _GMP_REPEAT_L3_804(call, data) call(804, data)
+#define _GMP_REPEAT_L3_806(call, data) _GMP_REPEAT_L3_805(call, data) call(805, data)
+#define _GMP_REPEAT_L3_807(call, data) _GMP_REPEAT_L3_806(call, data) call(806, data)
+#define _GMP_REPEAT_L3_808(call, data) _GMP_REPEAT_L3_807(call, data) call(807, data)
+#define _GMP_REPEAT_L3_809(call, data) _GMP_REPEAT_L3_808(call, data) call(808, data)
+#define _GMP_REPEAT_L3_810(call, data) _GMP_REPEAT_L3_809(call, data) call(809, data)
+#define _GMP_REPEAT_L3_811(call, data) _GMP_REPEAT_L3_810(call, data) call(810, data)
+#define _GMP_REPEAT_L3_812(call, data) _GMP_REPEAT_L3_811(call, data) call(811, data)
+#define _GMP_REPEAT_L3_813(call, data) _GMP_REPEAT_L3_812(call, data) call(812, data)
+#define _GMP_REPEAT_L3_814(call, data) _GMP_REPEAT_L3_813(call, data) call(813, data)
+#define _GMP_REPEAT_L3_815(call, data) _GMP_REPEAT_L3_814(call, data) call(814, data)
+#define _GMP_REPEAT_L3_816(call, data) _GMP_REPEAT_L3_815(call, data) call(815, data)
+#define _GMP_REPEAT_L3_817(call, data) _GMP_REPEAT_L3_816(call, data) call(816, data)
+#define _GMP_REPEAT_L3_818(call, data) _GMP_REPEAT_L3_817(call, data) call(817, data)
+#define _GMP_REPEAT_L3_819(call, data) _GMP_REPEAT_L3_818(call, data) call(818, data)
+#define _GMP_REPEAT_L3_820(call, data) _GMP_REPEAT_L3_819(call, data) call(819, data)
+#define _GMP_REPEAT_L3_821(call, data) _GMP_REPEAT_L3_820(call, data) call(820, data)
+#define _GMP_REPEAT_L3_822(call, data) _GMP_REPEAT_L3_821(call, data) call(821, data)
+#define _GMP_REPEAT_L3_823(call, data) _GMP_REPEAT_L3_822(call, data) call(822, data)
+#define _GMP_REPEAT_L3_824(call, data) _GMP_REPEAT_L3_823(call, data) call(823, data)
+#define _GMP_REPEAT_L3_825(call, data) _GMP_REPEAT_L3_824(call, data) call(824, data)
+#define _GMP_REPEAT_L3_826(call, data) _GMP_REPEAT_L3_825(call, data) call(825, data)
+#define _GMP_REPEAT_L3_827(call, data) _GMP_REPEAT_L3_826(call, data) call(826, data)
+#define _GMP_REPEAT_L3_828(call, data) _GMP_REPEAT_L3_827(call, data) call(827, data)
+#define _GMP_REPEAT_L3_829(call, data) _GMP_REPEAT_L3_828(call, data) call(828, data)
+#define _GMP_REPEAT_L3_830(call, data) _GMP_REPEAT_L3_829(call, data) call(829, data)
+#define _GMP_REPEAT_L3_831(call, data) _GMP_REPEAT_L3_830(call, data) call(830, data)
+#define _GMP_REPEAT_L3_832(call, data) _GMP_REPEAT_L3_831(call, data) call(831, data)
+#define _GMP_REPEAT_L3_833(call, data) _GMP_REPEAT_L3_832(call, data) call(832, data)
+#define _GMP_REPEAT_L3_834(call, data) _GMP_REPEAT_L3_833(call, data) call(833, data)
+#define _GMP_REPEAT_L3_835(call, data) _GMP_REPEAT_L3_834(call, data) call(834, data)
+#define _GMP_REPEAT_L3_836(call, data) _GMP_REPEAT_L3_835(call, data) call(835, data)
+#define _GMP_REPEAT_L3_837(call, data) _GMP_REPEAT_L3_836(call, data) call(836, data)
+#define _GMP_REPEAT_L3_838(call, data) _GMP_REPEAT_L3_837(call, data) call(837, data)
+#define _GMP_REPEAT_L3_839(call, data) _GMP_REPEAT_L3_838(call, data) call(838, data)
+#define _GMP_REPEAT_L3_840(call, data) _GMP_REPEAT_L3_839(call, data) call(839, data)
+#define _GMP_REPEAT_L3_841(call, data) _GMP_REPEAT_L3_840(call, data) call(840, data)
+#define _GMP_REPEAT_L3_842(call, data) _GMP_REPEAT_L3_841(call, data) call(841, data)
+#define _GMP_REPEAT_L3_843(call, data) _GMP_REPEAT_L3_842(call, data) call(842, data)
+#define _GMP_REPEAT_L3_844(call, data) _GMP_REPEAT_L3_843(call, data) call(843, data)
+#define _GMP_REPEAT_L3_845(call, data) _GMP_REPEAT_L3_844(call, data) call(844, data)
+#define _GMP_REPEAT_L3_846(call, data) _GMP_REPEAT_L3_845(call, data) call(845, data)
+#define _GMP_REPEAT_L3_847(call, data) _GMP_REPEAT_L3_846(call, data) call(846, data)
+#define _GMP_REPEAT_L3_848(call, data) _GMP_REPEAT_L3_847(call, data) call(847, data)
+#define _GMP_REPEAT_L3_849(call, data) _GMP_REPEAT_L3_848(call, data) call(848, data)
+#define _GMP_REPEAT_L3_850(call, data) _GMP_REPEAT_L3_849(call, data) call(849, data)
+#define _GMP_REPEAT_L3_851(call, data) _GMP_REPEAT_L3_850(call, data) call(850, data)
+#define _GMP_REPEAT_L3_852(call, data) _GMP_REPEAT_L3_851(call, data) call(851, data)
+#define _GMP_REPEAT_L3_853(call, data) _GMP_REPEAT_L3_852(call, data) call(852, data)
+#define _GMP_REPEAT_L3_854(call, data) _GMP_REPEAT_L3_853(call, data) call(853, data)
+#define _GMP_REPEAT_L3_855(call, data) _GMP_REPEAT_L3_854(call, data) call(854, data)
+#define _GMP_REPEAT_L3_856(call, data) _GMP_REPEAT_L3_855(call, data) call(855, data)
+#define _GMP_REPEAT_L3_857(call, data) _GMP_REPEAT_L3_856(call, data) call(856, data)
+#define _GMP_REPEAT_L3_858(call, data) _GMP_REPEAT_L3_857(call, data) call(857, data)
+#define _GMP_REPEAT_L3_859(call, data) _GMP_REPEAT_L3_858(call, data) call(858, data)
+#define _GMP_REPEAT_L3_860(call, data) _GMP_REPEAT_L3_859(call, data) call(859, data)
+#define _GMP_REPEAT_L3_861(call, data) _GMP_REPEAT_L3_860(call, data) call(860, data)
+#define _GMP_REPEAT_L3_862(call, data) _GMP_REPEAT_L3_861(call, data) call(861, data)
+#define _GMP_REPEAT_L3_863(call, data) _GMP_REPEAT_L3_862(call, data) call(862, data)
+#define _GMP_REPEAT_L3_864(call, data) _GMP_REPEAT_L3_863(call, data) call(863, data)
+#define _GMP_REPEAT_L3_865(call, data) _GMP_REPEAT_L3_864(call, data) call(864, data)
+#define _GMP_REPEAT_L3_866(call, data) _GMP_REPEAT_L3_865(call, data) call(865, data)
+#define _GMP_REPEAT_L3_867(call, data) _GMP_REPEAT_L3_866(call, data) call(866, data)
+#define _GMP_REPEAT_L3_868(call, data) _GMP_REPEAT_L3_867(call, data) call(867, data)
+#define _GMP_REPEAT_L3_869(call, data) _GMP_REPEAT_L3_868(call, data) call(868, data)
+#define _GMP_REPEAT_L3_870(call, data) _GMP_REPEAT_L3_869(call, data) call(869, data)
+#define _GMP_REPEAT_L3_871(call, data) _GMP_REPEAT_L3_870(call, data) call(870, data)
+#define _GMP_REPEAT_L3_872(call, data) _GMP_REPEAT_L3_871(call, data) call(871, data)
+#define _GMP_REPEAT_L3_873(call, data) _GMP_REPEAT_L3_872(call, data) call(872, data)
+#define _GMP_REPEAT_L3_874(call, data) _GMP_REPEAT_L3_873(call, data) call(873, data)
+#define _GMP_REPEAT_L3_875(call, data) _GMP_REPEAT_L3_874(call, data) call(874, data)
+#define _GMP_REPEAT_L3_876(call, data) _GMP_REPEAT_L3_875(call, data) call(875, data)
+#define _GMP_REPEAT_L3_877(call, data) _GMP_REPEAT_L3_876(call, data) call(876, data)
+#define _GMP_REPEAT_L3_878(call, data) _GMP_REPEAT_L3_877(call, data) call(877, data)
+#define _GMP_REPEAT_L3_879(call, data) _GMP_REPEAT_L3_878(call, data) call(878, data)
+#define _GMP_REPEAT_L3_880(call, data) _GMP_REPEAT_L3_879(call, data) call(879, data)
+#define _GMP_REPEAT_L3_881(call, data) _GMP_REPEAT_L3_880(call, data) call(880, data)
+#define _GMP_REPEAT_L3_882(call, data) _GMP_REPEAT_L3_881(call, data) call(881, data)
+#define _GMP_REPEAT_L3_883(call, data) _GMP_REPEAT_L3_882(call, data) call(882, data)
+#define _GMP_REPEAT_L3_884(call, data) _GMP_REPEAT_L3_883(call, data) call(883, data)
+#define _GMP_REPEAT_L3_885(call, data) _GMP_REPEAT_L3_884(call, data) call(884, data)
+#define _GMP_REPEAT_L3_886(call, data) _GMP_REPEAT_L3_885(call, data) call(885, data)
+#define _GMP_REPEAT_L3_887(call, data) _GMP_REPEAT_L3_886(call, data) call(886, data)
+#define _GMP_REPEAT_L3_888(call, data) _GMP_REPEAT_L3_887(call, data) call(887, data)
+#define _GMP_REPEAT_L3_889(call, data) _GMP_REPEAT_L3_888(call, data) call(888, data)
+#define _GMP_REPEAT_L3_890(call, data) _GMP_REPEAT_L3_889(call, data) call(889, data)
+#define _GMP_REPEAT_L3_891(call, data) _GMP_REPEAT_L3_890(call, data) call(890, data)
+#define _GMP_REPEAT_L3_892(call, data) _GMP_REPEAT_L3_891(call, data) call(891, data)
+#define _GMP_REPEAT_L3_893(call, data) _GMP_REPEAT_L3_892(call, data) call(892, data)
+#define _GMP_REPEAT_L3_894(call, data) _GMP_REPEAT_L3_893(call, data) call(893, data)
+#define _GMP_REPEAT_L3_895(call, data) _GMP_REPEAT_L3_894(call, data) call(894, data)
+#define _GMP_REPEAT_L3_896(call, data) _GMP_REPEAT_L3_895(call, data) call(895, data)
+#define _GMP_REPEAT_L3_897(call, data) _GMP_REPEAT_L3_896(call, data) call(896, data)
+#define _GMP_REPEAT_L3_898(call, data) _GMP_REPEAT_L3_897(call, data) call(897, data)
+#define _GMP_REPEAT_L3_899(call, data) _GMP_REPEAT_L3_898(call, data) call(898, data)
+#define _GMP_REPEAT_L3_900(call, data) _GMP_REPEAT_L3_899(call, data) call(899, data)
+#define _GMP_REPEAT_L3_901(call, data) _GMP_REPEAT_L3_900(call, data) call(900, data)
+#define _GMP_REPEAT_L3_902(call, data) _GMP_REPEAT_L3_901(call, data) call(901, data)
+#define _GMP_REPEAT_L3_903(call, data) _GMP_REPEAT_L3_902(call, data) call(902, data)
+#define _GMP_REPEAT_L3_904(call, data) _GMP_REPEAT_L3_903(call, data) call(903, data)
+#define _GMP_REPEAT_L3_905(call, data) _GMP_REPEAT_L3_904(call, data) call(904, data)
+#define _GMP_REPEAT_L3_906(call, data) _GMP_REPEAT_L3_905(call, data) call(905, data)
+#define _GMP_REPEAT_L3_907(call, data) _GMP_REPEAT_L3_906(call, data) call(906, data)
+#define _GMP_REPEAT_L3_908(call, data) _GMP_REPEAT_L3_907(call, data) call(907, data)
+#define _GMP_REPEAT_L3_909(call, data) _GMP_REPEAT_L3_908(call, data) call(908, data)
+#define _GMP_REPEAT_L3_910(call, data) _GMP_REPEAT_L3_909(call, data) call(909, data)
+#define _GMP_REPEAT_L3_911(call, data) _GMP_REPEAT_L3_910(call, data) call(910, data)
+#define _GMP_REPEAT_L3_912(call, data) _GMP_REPEAT_L3_911(call, data) call(911, data)
+#define _GMP_REPEAT_L3_913(call, data) _GMP_REPEAT_L3_912(call, data) call(912, data)
+#define _GMP_REPEAT_L3_914(call, data) _GMP_REPEAT_L3_913(call, data) call(913, data)
+#define _GMP_REPEAT_L3_915(call, data) _GMP_REPEAT_L3_914(call, data) call(914, data)
+#define _GMP_REPEAT_L3_916(call, data) _GMP_REPEAT_L3_915(call, data) call(915, data)
+#define _GMP_REPEAT_L3_917(call, data) _GMP_REPEAT_L3_916(call, data) call(916, data)
+#define _GMP_REPEAT_L3_918(call, data) _GMP_REPEAT_L3_917(call, data) call(917, data)
+#define _GMP_REPEAT_L3_919(call, data) _GMP_REPEAT_L3_918(call, data) call(918, data)
+#define _GMP_REPEAT_L3_920(call, data) _GMP_REPEAT_L3_919(call, data) call(919, data)
+#define _GMP_REPEAT_L3_921(call, data) _GMP_REPEAT_L3_920(call, data) call(920, data)
+#define _GMP_REPEAT_L3_922(call, data) _GMP_REPEAT_L3_921(call, data) call(921, data)
+#define _GMP_REPEAT_L3_923(call, data) _GMP_REPEAT_L3_922(call, data) call(922, data)
+#define _GMP_REPEAT_L3_924(call, data) _GMP_REPEAT_L3_923(call, data) call(923, data)
+#define _GMP_REPEAT_L3_925(call, data) _GMP_REPEAT_L3_924(call, data) call(924, data)
+#define _GMP_REPEAT_L3_926(call, data) _GMP_REPEAT_L3_925(call, data) call(925, data)
+#define _GMP_REPEAT_L3_927(call, data) _GMP_REPEAT_L3_926(call, data) call(926, data)
+#define _GMP_REPEAT_L3_928(call, data) _GMP_REPEAT_L3_927(call, data) call(927, data)
+#define _GMP_REPEAT_L3_929(call, data) _GMP_REPEAT_L3_928(call, data) call(928, data)
+#define _GMP_REPEAT_L3_930(call, data) _GMP_REPEAT_L3_929(call, data) call(929, data)
+#define _GMP_REPEAT_L3_931(call, data) _GMP_REPEAT_L3_930(call, data) call(930, data)
+#define _GMP_REPEAT_L3_932(call, data) _GMP_REPEAT_L3_931(call, data) call(931, data)
+#define _GMP_REPEAT_L3_933(call, data) _GMP_REPEAT_L3_932(call, data) call(932, data)
+#define _GMP_REPEAT_L3_934(call, data) _GMP_REPEAT_L3_933(call, data) call(933, data)
+#define _GMP_REPEAT_L3_935(call, data) _GMP_REPEAT_L3_934(call, data) call(934, data)
+#define _GMP_REPEAT_L3_936(call, data) _GMP_REPEAT_L3_935(call, data) call(935, data)
+#define _GMP_REPEAT_L3_937(call, data) _GMP_REPEAT_L3_936(call, data) call(936, data)
+#define _GMP_REPEAT_L3_938(call, data) _GMP_REPEAT_L3_937(call, data) call(937, data)
+#define _GMP_REPEAT_L3_939(call, data) _GMP_REPEAT_L3_938(call, data) call(938, data)
+#define _GMP_REPEAT_L3_940(call, data) _GMP_REPEAT_L3_939(call, data) call(939, data)
+#define _GMP_REPEAT_L3_941(call, data) _GMP_REPEAT_L3_940(call, data) call(940, data)
+#define _GMP_REPEAT_L3_942(call, data) _GMP_REPEAT_L3_941(call, data) call(941, data)
+#define _GMP_REPEAT_L3_943(call, data) _GMP_REPEAT_L3_942(call, data) call(942, data)
+#define _GMP_REPEAT_L3_944(call, data) _GMP_REPEAT_L3_943(call, data) call(943, data)
+#define _GMP_REPEAT_L3_945(call, data) _GMP_REPEAT_L3_944(call, data) call(944, data)
+#define _GMP_REPEAT_L3_946(call, data) _GMP_REPEAT_L3_945(call, data) call(945, data)
+#define _GMP_REPEAT_L3_947(call, data) _GMP_REPEAT_L3_946(call, data) call(946, data)
+#define _GMP_REPEAT_L3_948(call, data) _GMP_REPEAT_L3_947(call, data) call(947, data)
+#define _GMP_REPEAT_L3_949(call, data) _GMP_REPEAT_L3_948(call, data) call(948, data)
+#define _GMP_REPEAT_L3_950(call, data) _GMP_REPEAT_L3_949(call, data) call(949, data)
+#define _GMP_REPEAT_L3_951(call, data) _GMP_REPEAT_L3_950(call, data) call(950, data)
+#define _GMP_REPEAT_L3_952(call, data) _GMP_REPEAT_L3_951(call, data) call(951, data)
+#define _GMP_REPEAT_L3_953(call, data) _GMP_REPEAT_L3_952(call, data) call(952, data)
+#define _GMP_REPEAT_L3_954(call, data) _GMP_REPEAT_L3_953(call, data) call(953, data)
+#define _GMP_REPEAT_L3_955(call, data) _GMP_REPEAT_L3_954(call, data) call(954, data)
+#define _GMP_REPEAT_L3_956(call, data) _GMP_REPEAT_L3_955(call, data) call(955, data)
+#define _GMP_REPEAT_L3_957(call, data) _GMP_REPEAT_L3_956(call, data) call(956, data)
+#define _GMP_REPEAT_L3_958(call, data) _GMP_REPEAT_L3_957(call, data) call(957, data)
+#define _GMP_REPEAT_L3_959(call, data) _GMP_REPEAT_L3_958(call, data) call(958, data)
+#define _GMP_REPEAT_L3_960(call, data) _GMP_REPEAT_L3_959(call, data) call(959, data)
+#define _GMP_REPEAT_L3_961(call, data) _GMP_REPEAT_L3_960(call, data) call(960, data)
+#define _GMP_REPEAT_L3_962(call, data) _GMP_REPEAT_L3_961(call, data) call(961, data)
+#define _GMP_REPEAT_L3_963(call, data) _GMP_REPEAT_L3_962(call, data) call(962, data)
+#define _GMP_REPEAT_L3_964(call, data) _GMP_REPEAT_L3_963(call, data) call(963, data)
+#define _GMP_REPEAT_L3_965(call, data) _GMP_REPEAT_L3_964(call, data) call(964, data)
+#define _GMP_REPEAT_L3_966(call, data) _GMP_REPEAT_L3_965(call, data) call(965, data)
+#define _GMP_REPEAT_L3_967(call, data) _GMP_REPEAT_L3_966(call, data) call(966, data)
+#define _GMP_REPEAT_L3_968(call, data) _GMP_REPEAT_L3_967(call, data) call(967, data)
+#define _GMP_REPEAT_L3_969(call, data) _GMP_REPEAT_L3_968(call, data) call(968, data)
+#define _GMP_REPEAT_L3_970(call, data) _GMP_REPEAT_L3_969(call, data) call(969, data)
+#define _GMP_REPEAT_L3_971(call, data) _GMP_REPEAT_L3_970(call, data) call(970, data)
+#define _GMP_REPEAT_L3_972(call, data) _GMP_REPEAT_L3_971(call, data) call(971, data)
+#define _GMP_REPEAT_L3_973(call, data) _GMP_REPEAT_L3_972(call, data) call(972, data)
+#define _GMP_REPEAT_L3_974(call, data) _GMP_REPEAT_L3_973(call, data) call(973, data)
+#define _GMP_REPEAT_L3_975(call, data) _GMP_REPEAT_L3_974(call, data) call(974, data)
+#define _GMP_REPEAT_L3_976(call, data) _GMP_REPEAT_L3_975(call, data) call(975, data)
+#define _GMP_REPEAT_L3_977(call, data) _GMP_REPEAT_L3_976(call, data) call(976, data)
+#define _GMP_REPEAT_L3_978(call, data) _GMP_REPEAT_L3_977(call, data) call(977, data)
+#define _GMP_REPEAT_L3_979(call, data) _GMP_REPEAT_L3_978(call, data) call(978, data)
+#define _GMP_REPEAT_L3_980(call, data) _GMP_REPEAT_L3_979(call, data) call(979, data)
+#define _GMP_REPEAT_L3_981(call, data) _GMP_REPEAT_L3_980(call, data) call(980, data)
+#define _GMP_REPEAT_L3_982(call, data) _GMP_REPEAT_L3_981(call, data) call(981, data)
+#define _GMP_REPEAT_L3_983(call, data) _GMP_REPEAT_L3_982(call, data) call(982, data)
+#define _GMP_REPEAT_L3_984(call, data) _GMP_REPEAT_L3_983(call, data) call(983, data)
+#define _GMP_REPEAT_L3_985(call, data) _GMP_REPEAT_L3_984(call, data) call(984, data)
+#define _GMP_REPEAT_L3_986(call, data) _GMP_REPEAT_L3_985(call, data) call(985, data)
+#define _GMP_REPEAT_L3_987(call, data) _GMP_REPEAT_L3_986(call, data) call(986, data)
+#define _GMP_REPEAT_L3_988(call, data) _GMP_REPEAT_L3_987(call, data) call(987, data)
+#define _GMP_REPEAT_L3_989(call, data) _GMP_REPEAT_L3_988(call, data) call(988, data)
+#define _GMP_REPEAT_L3_990(call, data) _GMP_REPEAT_L3_989(call, data) call(989, data)
+#define _GMP_REPEAT_L3_991(call, data) _GMP_REPEAT_L3_990(call, data) call(990, data)
+#define _GMP_REPEAT_L3_992(call, data) _GMP_REPEAT_L3_991(call, data) call(991, data)
+#define _GMP_REPEAT_L3_993(call, data) _GMP_REPEAT_L3_992(call, data) call(992, data)
+#define _GMP_REPEAT_L3_994(call, data) _GMP_REPEAT_L3_993(call, data) call(993, data)
+#define _GMP_REPEAT_L3_995(call, data) _GMP_REPEAT_L3_994(call, data) call(994, data)
+#define _GMP_REPEAT_L3_996(call, data) _GMP_REPEAT_L3_995(call, data) call(995, data)
+#define _GMP_REPEAT_L3_997(call, data) _GMP_REPEAT_L3_996(call, data) call(996, data)
+#define _GMP_REPEAT_L3_998(call, data) _GMP_REPEAT_L3_997(call, data) call(997, data)
+#define _GMP_REPEAT_L3_999(call, data) _GMP_REPEAT_L3_998(call, data) call(998, data)
+#define _GMP_REPEAT_L3_1000(call, data) _GMP_REPEAT_L3_999(call, data) call(999, data)
+#define _GMP_REPEAT_L3_1001(call, data) _GMP_REPEAT_L3_1000(call, data) call(1000, data)
+#define _GMP_REPEAT_L3_1002(call, data) _GMP_REPEAT_L3_1001(call, data) call(1001, data)
+#define _GMP_REPEAT_L3_1003(call, data) _GMP_REPEAT_L3_1002(call, data) call(1002, data)
+#define _GMP_REPEAT_L3_1004(call, data) _GMP_REPEAT_L3_1003(call, data) call(1003, data)
+#define _GMP_REPEAT_L3_1005(call, data) _GMP_REPEAT_L3_1004(call, data) call(1004, data)
+#define _GMP_REPEAT_L3_1006(call, data) _GMP_REPEAT_L3_1005(call, data) call(1005, data)
+#define _GMP_REPEAT_L3_1007(call, data) _GMP_REPEAT_L3_1006(call, data) call(1006, data)
+#define _GMP_REPEAT_L3_1008(call, data) _GMP_REPEAT_L3_1007(call, data) call(1007, data)
+#define _GMP_REPEAT_L3_1009(call, data) _GMP_REPEAT_L3_1008(call, data) call(1008, data)
+#define _GMP_REPEAT_L3_1010(call, data) _GMP_REPEAT_L3_1009(call, data) call(1009, data)
+#define _GMP_REPEAT_L3_1011(call, data) _GMP_REPEAT_L3_1010(call, data) call(1010, data)
+#define _GMP_REPEAT_L3_1012(call, data) _GMP_REPEAT_L3_1011(call, data) call(1011, data)
+#define _GMP_REPEAT_L3_1013(call, data) _GMP_REPEAT_L3_1012(call, data) call(1012, data)
+#define _GMP_REPEAT_L3_1014(call, data) _GMP_REPEAT_L3_1013(call, data) call(1013, data)
+#define _GMP_REPEAT_L3_1015(call, data) _GMP_REPEAT_L3_1014(call, data) call(1014, data)
+#define _GMP_REPEAT_L3_1016(call, data) _GMP_REPEAT_L3_1015(call, data) call(1015, data)
+#define _GMP_REPEAT_L3_1017(call, data) _GMP_REPEAT_L3_1016(call, data) call(1016, data)
+#define _GMP_REPEAT_L3_1018(call, data) _GMP_REPEAT_L3_1017(call, data) call(1017, data)
+#define _GMP_REPEAT_L3_1019(call, data) _GMP_REPEAT_L3_1018(call, data) call(1018, data)
+#define _GMP_REPEAT_L3_1020(call, data) _GMP_REPEAT_L3_1019(call, data) call(1019, data)
+#define _GMP_REPEAT_L3_1021(call, data) _GMP_REPEAT_L3_1020(call, data) call(1020, data)
+#define _GMP_REPEAT_L3_1022(call, data) _GMP_REPEAT_L3_1021(call, data) call(1021, data)
+#define _GMP_REPEAT_L3_1023(call, data) _GMP_REPEAT_L3_1022(call, data) call(1022, data)
+#define _GMP_REPEAT_L3_1024(call, data) _GMP_REPEAT_L3_1023(call, data) call(1023, data)
+
+// GMP_REPEAT_FROM_3
+#define _GMP_REPEAT_FROM_L3_0(call, data, i)
+#define _GMP_REPEAT_FROM_L3_1(call, data, i) call(i, data)
+#define _GMP_REPEAT_FROM_L3_2(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_3(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_2(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_4(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_3(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_5(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_4(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_6(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_5(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_7(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_6(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_8(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_7(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_9(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_8(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_10(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_9(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_11(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_10(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_12(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_11(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_13(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_12(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_14(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_13(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_15(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_14(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_16(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_15(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_17(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_16(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_18(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_17(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_19(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_18(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_20(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_19(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_21(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_20(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_22(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_21(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_23(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_22(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_24(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_23(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_25(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_24(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_26(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_25(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_27(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_26(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_28(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_27(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_29(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_28(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_30(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_29(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_31(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_30(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_32(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_31(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_33(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_32(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_34(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_33(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_35(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_34(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_36(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_35(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_37(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_36(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_38(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_37(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_39(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_38(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_40(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_39(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_41(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_40(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_42(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_41(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_43(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_42(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_44(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_43(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_45(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_44(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_46(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_45(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_47(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_46(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_48(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_47(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_49(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_48(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_50(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_49(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_51(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_50(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_52(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_51(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_53(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_52(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_54(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_53(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_55(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_54(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_56(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_55(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_57(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_56(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_58(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_57(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_59(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_58(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_60(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_59(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_61(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_60(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_62(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_61(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_63(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_62(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_64(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_63(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_65(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_64(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_66(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_65(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_67(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_66(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_68(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_67(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_69(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_68(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_70(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_69(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_71(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_70(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_72(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_71(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_73(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_72(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_74(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_73(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_75(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_74(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_76(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_75(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_77(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_76(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_78(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_77(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_79(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_78(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_80(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_79(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_81(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_80(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_82(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_81(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_83(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_82(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_84(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_83(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_85(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_84(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_86(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_85(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_87(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_86(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_88(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_87(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_89(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_88(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_90(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_89(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_91(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_90(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_92(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_91(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_93(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_92(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_94(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_93(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_95(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_94(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_96(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_95(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_97(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_96(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_98(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_97(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_99(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_98(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_100(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_99(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_101(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_100(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_102(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_101(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_103(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_102(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_104(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_103(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_105(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_104(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_106(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_105(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_107(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_106(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_108(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_107(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_109(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_108(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_110(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_109(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_111(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_110(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_112(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_111(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_113(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_112(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_114(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_113(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_115(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_114(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_116(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_115(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_117(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_116(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_118(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_117(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_119(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_118(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_120(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_119(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_121(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_120(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_122(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_121(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_123(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_122(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_124(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_123(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_125(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_124(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_126(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_125(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_127(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_126(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_128(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_127(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_129(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_128(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_130(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_129(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_131(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_130(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_132(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_131(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_133(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_132(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_134(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_133(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_135(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_134(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_136(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_135(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_137(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_136(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_138(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_137(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_139(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_138(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_140(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_139(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_141(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_140(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_142(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_141(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_143(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_142(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_144(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_143(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_145(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_144(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_146(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_145(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_147(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_146(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_148(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_147(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_149(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_148(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_150(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_149(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_151(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_150(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_152(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_151(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_153(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_152(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_154(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_153(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_155(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_154(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_156(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_155(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_157(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_156(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_158(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_157(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_159(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_158(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_160(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_159(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_161(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_160(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_162(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_161(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_163(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_162(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_164(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_163(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_165(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_164(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_166(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_165(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_167(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_166(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_168(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_167(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_169(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_168(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_170(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_169(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_171(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_170(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_172(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_171(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_173(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_172(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_174(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_173(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_175(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_174(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_176(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_175(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_177(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_176(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_178(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_177(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_179(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_178(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_180(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_179(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_181(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_180(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_182(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_181(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_183(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_182(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_184(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_183(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_185(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_184(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_186(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_185(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_187(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_186(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_188(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_187(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_189(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_188(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_190(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_189(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_191(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_190(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_192(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_191(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_193(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_192(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_194(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_193(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_195(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_194(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_196(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_195(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_197(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_196(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_198(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_197(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_199(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_198(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_200(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_199(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_201(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_200(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_202(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_201(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_203(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_202(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_204(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_203(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_205(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_204(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_206(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_205(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_207(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_206(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_208(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_207(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_209(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_208(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_210(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_209(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_211(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_210(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_212(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_211(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_213(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_212(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_214(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_213(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_215(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_214(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_216(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_215(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_217(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_216(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_218(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_217(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_219(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_218(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_220(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_219(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_221(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_220(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_222(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_221(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_223(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_222(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_224(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_223(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_225(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_224(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_226(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_225(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_227(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_226(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_228(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_227(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_229(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_228(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_230(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_229(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_231(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_230(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_232(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_231(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_233(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_232(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_234(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_233(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_235(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_234(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_236(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_235(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_237(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_236(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_238(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_237(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_239(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_238(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_240(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_239(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_241(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_240(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_242(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_241(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_243(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_242(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_244(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_243(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_245(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_244(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_246(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_245(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_247(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_246(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_248(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_247(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_249(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_248(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_250(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_249(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_251(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_250(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_252(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_251(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_253(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_252(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_254(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_253(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_255(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_254(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_256(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_255(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_257(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_256(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_258(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_257(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_259(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_258(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_260(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_259(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_261(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_260(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_262(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_261(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_263(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_262(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_264(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_263(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_265(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_264(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_266(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_265(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_267(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_266(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_268(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_267(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_269(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_268(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_270(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_269(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_271(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_270(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_272(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_271(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_273(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_272(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_274(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_273(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_275(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_274(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_276(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_275(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_277(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_276(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_278(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_277(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_279(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_278(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_280(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_279(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_281(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_280(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_282(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_281(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_283(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_282(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_284(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_283(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_285(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_284(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_286(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_285(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_287(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_286(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_288(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_287(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_289(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_288(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_290(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_289(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_291(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_290(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_292(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_291(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_293(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_292(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_294(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_293(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_295(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_294(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_296(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_295(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_297(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_296(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_298(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_297(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_299(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_298(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_300(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_299(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_301(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_300(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_302(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_301(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_303(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_302(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_304(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_303(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_305(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_304(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_306(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_305(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_307(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_306(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_308(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_307(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_309(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_308(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_310(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_309(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_311(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_310(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_312(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_311(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_313(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_312(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_314(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_313(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_315(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_314(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_316(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_315(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_317(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_316(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_318(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_317(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_319(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_318(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_320(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_319(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_321(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_320(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_322(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_321(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_323(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_322(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_324(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_323(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_325(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_324(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_326(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_325(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_327(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_326(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_328(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_327(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_329(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_328(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_330(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_329(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_331(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_330(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_332(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_331(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_333(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_332(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_334(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_333(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_335(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_334(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_336(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_335(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_337(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_336(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_338(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_337(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_339(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_338(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_340(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_339(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_341(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_340(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_342(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_341(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_343(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_342(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_344(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_343(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_345(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_344(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_346(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_345(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_347(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_346(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_348(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_347(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_349(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_348(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_350(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_349(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_351(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_350(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_352(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_351(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_353(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_352(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_354(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_353(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_355(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_354(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_356(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_355(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_357(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_356(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_358(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_357(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_359(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_358(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_360(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_359(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_361(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_360(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_362(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_361(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_363(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_362(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_364(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_363(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_365(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_364(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_366(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_365(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_367(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_366(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_368(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_367(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_369(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_368(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_370(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_369(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_371(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_370(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_372(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_371(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_373(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_372(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_374(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_373(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_375(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_374(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_376(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_375(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_377(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_376(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_378(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_377(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_379(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_378(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_380(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_379(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_381(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_380(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_382(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_381(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_383(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_382(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_384(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_383(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_385(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_384(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_386(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_385(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_387(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_386(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_388(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_387(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_389(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_388(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_390(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_389(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_391(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_390(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_392(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_391(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_393(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_392(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_394(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_393(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_395(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_394(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_396(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_395(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_397(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_396(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_398(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_397(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_399(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_398(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_400(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_399(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_401(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_400(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_402(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_401(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_403(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_402(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_404(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_403(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_405(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_404(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_406(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_405(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_407(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_406(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_408(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_407(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_409(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_408(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_410(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_409(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_411(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_410(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_412(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_411(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_413(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_412(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_414(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_413(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_415(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_414(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_416(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_415(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_417(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_416(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_418(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_417(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_419(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_418(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_420(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_419(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_421(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_420(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_422(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_421(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_423(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_422(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_424(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_423(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_425(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_424(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_426(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_425(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_427(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_426(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_428(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_427(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_429(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_428(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_430(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_429(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_431(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_430(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_432(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_431(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_433(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_432(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_434(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_433(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_435(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_434(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_436(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_435(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_437(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_436(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_438(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_437(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_439(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_438(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_440(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_439(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_441(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_440(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_442(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_441(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_443(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_442(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_444(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_443(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_445(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_444(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_446(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_445(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_447(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_446(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_448(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_447(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_449(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_448(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_450(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_449(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_451(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_450(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_452(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_451(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_453(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_452(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_454(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_453(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_455(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_454(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_456(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_455(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_457(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_456(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_458(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_457(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_459(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_458(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_460(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_459(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_461(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_460(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_462(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_461(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_463(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_462(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_464(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_463(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_465(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_464(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_466(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_465(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_467(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_466(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_468(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_467(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_469(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_468(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_470(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_469(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_471(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_470(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_472(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_471(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_473(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_472(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_474(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_473(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_475(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_474(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_476(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_475(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_477(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_476(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_478(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_477(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_479(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_478(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_480(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_479(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_481(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_480(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_482(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_481(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_483(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_482(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_484(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_483(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_485(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_484(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_486(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_485(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_487(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_486(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_488(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_487(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_489(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_488(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_490(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_489(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_491(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_490(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_492(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_491(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_493(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_492(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_494(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_493(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_495(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_494(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_496(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_495(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_497(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_496(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_498(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_497(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_499(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_498(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_500(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_499(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_501(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_500(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_502(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_501(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_503(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_502(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_504(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_503(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_505(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_504(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_506(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_505(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_507(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_506(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_508(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_507(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_509(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_508(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_510(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_509(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_511(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_510(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_512(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_511(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_513(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_512(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_514(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_513(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_515(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_514(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_516(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_515(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_517(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_516(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_518(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_517(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_519(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_518(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_520(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_519(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_521(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_520(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_522(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_521(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_523(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_522(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_524(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_523(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_525(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_524(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_526(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_525(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_527(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_526(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_528(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_527(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_529(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_528(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_530(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_529(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_531(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_530(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_532(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_531(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_533(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_532(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_534(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_533(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_535(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_534(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_536(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_535(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_537(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_536(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_538(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_537(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_539(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_538(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_540(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_539(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_541(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_540(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_542(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_541(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_543(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_542(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_544(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_543(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_545(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_544(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_546(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_545(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_547(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_546(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_548(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_547(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_549(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_548(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_550(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_549(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_551(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_550(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_552(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_551(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_553(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_552(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_554(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_553(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_555(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_554(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_556(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_555(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_557(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_556(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_558(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_557(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_559(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_558(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_560(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_559(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_561(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_560(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_562(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_561(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_563(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_562(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_564(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_563(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_565(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_564(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_566(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_565(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_567(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_566(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_568(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_567(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_569(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_568(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_570(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_569(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_571(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_570(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_572(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_571(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_573(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_572(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_574(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_573(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_575(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_574(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_576(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_575(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_577(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_576(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_578(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_577(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_579(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_578(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_580(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_579(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_581(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_580(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_582(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_581(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_583(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_582(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_584(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_583(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_585(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_584(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_586(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_585(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_587(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_586(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_588(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_587(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_589(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_588(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_590(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_589(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_591(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_590(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_592(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_591(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_593(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_592(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_594(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_593(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_595(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_594(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_596(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_595(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_597(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_596(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_598(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_597(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_599(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_598(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_600(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_599(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_601(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_600(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_602(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_601(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_603(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_602(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_604(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_603(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_605(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_604(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_606(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_605(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_607(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_606(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_608(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_607(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_609(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_608(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_610(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_609(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_611(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_610(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_612(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_611(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_613(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_612(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_614(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_613(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_615(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_614(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_616(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_615(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_617(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_616(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_618(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_617(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_619(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_618(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_620(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_619(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_621(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_620(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_622(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_621(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_623(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_622(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_624(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_623(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_625(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_624(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_626(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_625(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_627(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_626(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_628(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_627(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_629(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_628(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_630(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_629(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_631(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_630(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_632(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_631(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_633(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_632(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_634(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_633(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_635(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_634(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_636(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_635(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_637(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_636(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_638(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_637(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_639(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_638(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_640(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_639(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_641(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_640(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_642(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_641(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_643(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_642(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_644(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_643(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_645(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_644(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_646(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_645(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_647(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_646(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_648(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_647(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_649(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_648(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_650(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_649(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_651(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_650(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_652(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_651(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_653(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_652(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_654(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_653(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_655(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_654(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_656(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_655(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_657(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_656(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_658(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_657(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_659(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_658(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_660(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_659(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_661(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_660(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_662(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_661(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_663(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_662(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_664(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_663(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_665(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_664(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_666(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_665(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_667(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_666(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_668(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_667(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_669(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_668(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_670(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_669(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_671(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_670(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_672(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_671(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_673(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_672(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_674(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_673(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_675(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_674(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_676(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_675(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_677(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_676(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_678(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_677(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_679(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_678(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_680(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_679(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_681(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_680(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_682(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_681(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_683(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_682(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_684(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_683(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_685(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_684(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_686(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_685(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_687(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_686(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_688(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_687(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_689(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_688(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_690(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_689(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_691(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_690(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_692(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_691(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_693(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_692(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_694(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_693(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_695(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_694(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_696(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_695(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_697(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_696(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_698(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_697(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_699(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_698(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_700(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_699(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_701(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_700(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_702(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_701(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_703(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_702(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_704(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_703(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_705(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_704(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_706(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_705(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_707(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_706(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_708(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_707(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_709(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_708(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_710(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_709(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_711(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_710(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_712(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_711(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_713(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_712(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_714(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_713(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_715(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_714(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_716(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_715(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_717(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_716(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_718(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_717(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_719(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_718(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_720(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_719(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_721(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_720(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_722(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_721(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_723(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_722(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_724(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_723(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_725(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_724(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_726(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_725(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_727(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_726(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_728(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_727(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_729(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_728(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_730(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_729(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_731(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_730(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_732(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_731(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_733(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_732(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_734(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_733(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_735(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_734(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_736(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_735(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_737(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_736(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_738(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_737(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_739(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_738(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_740(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_739(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_741(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_740(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_742(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_741(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_743(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_742(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_744(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_743(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_745(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_744(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_746(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_745(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_747(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_746(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_748(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_747(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_749(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_748(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_750(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_749(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_751(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_750(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_752(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_751(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_753(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_752(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_754(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_753(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_755(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_754(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_756(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_755(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_757(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_756(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_758(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_757(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_759(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_758(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_760(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_759(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_761(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_760(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_762(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_761(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_763(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_762(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_764(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_763(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_765(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_764(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_766(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_765(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_767(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_766(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_768(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_767(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_769(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_768(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_770(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_769(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_771(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_770(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_772(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_771(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_773(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_772(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_774(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_773(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_775(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_774(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_776(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_775(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_777(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_776(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_778(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_777(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_779(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_778(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_780(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_779(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_781(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_780(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_782(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_781(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_783(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_782(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_784(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_783(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_785(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_784(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_786(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_785(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_787(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_786(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_788(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_787(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_789(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_788(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_790(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_789(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_791(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_790(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_792(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_791(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_793(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_792(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_794(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_793(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_795(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_794(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_796(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_795(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_797(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_796(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_798(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_797(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_799(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_798(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_800(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_799(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_801(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_800(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_802(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_801(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_803(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_802(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_804(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_803(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_805(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_804(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_806(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_805(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_807(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_806(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_808(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_807(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_809(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_808(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_810(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_809(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_811(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_810(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_812(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_811(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_813(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_812(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_814(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_813(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_815(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_814(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_816(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_815(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_817(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_816(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_818(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_817(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_819(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_818(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_820(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_819(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_821(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_820(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_822(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_821(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_823(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_822(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_824(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_823(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_825(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_824(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_826(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_825(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_827(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_826(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_828(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_827(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_829(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_828(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_830(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_829(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_831(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_830(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_832(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_831(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_833(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_832(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_834(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_833(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_835(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_834(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_836(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_835(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_837(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_836(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_838(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_837(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_839(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_838(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_840(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_839(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_841(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_840(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_842(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_841(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_843(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_842(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_844(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_843(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_845(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_844(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_846(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_845(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_847(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_846(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_848(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_847(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_849(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_848(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_850(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_849(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_851(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_850(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_852(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_851(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_853(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_852(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_854(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_853(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_855(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_854(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_856(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_855(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_857(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_856(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_858(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_857(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_859(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_858(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_860(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_859(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_861(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_860(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_862(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_861(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_863(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_862(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_864(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_863(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_865(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_864(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_866(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_865(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_867(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_866(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_868(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_867(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_869(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_868(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_870(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_869(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_871(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_870(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_872(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_871(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_873(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_872(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_874(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_873(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_875(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_874(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_876(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_875(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_877(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_876(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_878(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_877(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_879(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_878(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_880(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_879(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_881(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_880(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_882(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_881(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_883(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_882(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_884(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_883(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_885(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_884(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_886(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_885(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_887(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_886(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_888(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_887(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_889(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_888(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_890(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_889(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_891(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_890(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_892(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_891(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_893(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_892(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_894(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_893(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_895(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_894(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_896(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_895(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_897(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_896(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_898(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_897(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_899(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_898(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_900(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_899(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_901(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_900(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_902(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_901(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_903(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_902(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_904(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_903(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_905(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_904(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_906(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_905(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_907(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_906(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_908(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_907(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_909(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_908(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_910(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_909(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_911(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_910(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_912(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_911(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_913(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_912(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_914(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_913(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_915(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_914(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_916(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_915(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_917(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_916(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_918(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_917(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_919(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_918(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_920(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_919(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_921(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_920(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_922(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_921(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_923(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_922(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_924(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_923(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_925(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_924(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_926(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_925(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_927(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_926(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_928(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_927(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_929(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_928(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_930(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_929(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_931(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_930(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_932(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_931(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_933(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_932(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_934(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_933(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_935(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_934(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_936(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_935(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_937(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_936(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_938(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_937(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_939(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_938(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_940(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_939(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_941(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_940(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_942(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_941(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_943(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_942(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_944(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_943(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_945(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_944(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_946(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_945(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_947(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_946(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_948(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_947(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_949(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_948(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_950(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_949(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_951(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_950(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_952(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_951(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_953(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_952(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_954(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_953(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_955(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_954(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_956(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_955(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_957(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_956(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_958(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_957(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_959(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_958(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_960(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_959(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_961(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_960(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_962(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_961(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_963(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_962(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_964(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_963(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_965(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_964(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_966(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_965(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_967(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_966(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_968(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_967(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_969(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_968(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_970(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_969(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_971(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_970(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_972(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_971(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_973(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_972(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_974(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_973(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_975(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_974(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_976(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_975(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_977(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_976(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_978(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_977(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_979(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_978(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_980(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_979(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_981(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_980(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_982(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_981(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_983(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_982(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_984(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_983(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_985(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_984(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_986(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_985(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_987(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_986(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_988(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_987(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_989(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_988(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_990(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_989(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_991(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_990(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_992(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_991(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_993(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_992(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_994(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_993(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_995(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_994(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_996(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_995(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_997(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_996(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_998(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_997(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_999(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_998(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1000(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_999(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1001(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1000(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1002(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1001(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1003(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1002(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1004(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1003(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1005(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1004(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1006(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1005(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1007(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1006(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1008(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1007(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1009(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1008(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1010(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1009(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1011(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1010(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1012(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1011(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1013(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1012(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1014(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1013(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1015(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1014(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1016(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1015(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1017(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1016(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1018(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1017(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1019(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1018(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1020(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1019(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1021(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1020(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1022(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1021(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1023(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1022(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_1024(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1023(call, data, GMP_CONCAT(_GMP_INC_, i)())
+
+#endif // GMP_MACRO_LIMITS_LOOP_NESTED_1024_HPP_
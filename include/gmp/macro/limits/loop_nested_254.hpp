@@ -0,0 +1,1548 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_LOOP_NESTED_254_HPP_
+#define GMP_MACRO_LIMITS_LOOP_NESTED_254_HPP_
+
+// GMP_LOOP_2
+#define _GMP_LOOP_L2_0(call, ...)
+#define _GMP_LOOP_L2_1(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_0(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_2(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_3(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_2(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_4(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_3(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_5(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_4(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_6(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_5(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_7(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_6(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_8(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_7(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_9(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_8(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_10(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_9(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_11(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_10(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_12(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_11(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_13(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_12(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_14(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_13(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_15(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_14(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_16(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_15(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_17(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_16(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_18(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_17(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_19(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_18(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_20(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_19(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_21(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_20(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_22(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_21(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_23(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_22(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_24(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_23(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_25(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_24(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_26(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_25(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_27(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_26(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_28(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_27(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_29(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_28(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_30(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_29(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_31(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_30(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_32(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_31(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_33(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_32(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_34(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_33(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_35(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_34(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_36(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_35(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_37(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_36(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_38(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_37(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_39(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_38(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_40(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_39(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_41(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_40(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_42(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_41(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_43(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_42(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_44(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_43(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_45(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_44(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_46(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_45(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_47(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_46(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_48(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_47(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_49(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_48(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_50(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_49(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_51(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_50(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_52(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_51(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_53(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_52(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_54(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_53(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_55(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_54(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_56(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_55(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_57(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_56(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_58(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_57(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_59(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_58(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_60(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_59(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_61(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_60(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_62(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_61(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_63(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_62(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_64(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_63(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_65(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_64(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_66(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_65(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_67(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_66(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_68(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_67(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_69(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_68(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_70(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_69(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_71(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_70(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_72(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_71(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_73(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_72(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_74(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_73(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_75(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_74(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_76(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_75(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_77(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_76(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_78(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_77(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_79(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_78(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_80(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_79(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_81(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_80(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_82(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_81(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_83(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_82(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_84(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_83(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_85(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_84(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_86(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_85(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_87(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_86(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_88(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_87(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_89(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_88(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_90(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_89(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_91(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_90(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_92(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_91(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_93(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_92(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_94(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_93(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_95(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_94(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_96(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_95(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_97(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_96(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_98(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_97(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_99(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_98(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_100(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_99(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_101(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_100(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_102(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_101(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_103(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_102(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_104(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_103(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_105(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_104(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_106(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_105(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_107(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_106(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_108(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_107(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_109(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_108(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_110(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_109(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_111(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_110(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_112(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_111(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_113(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_112(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_114(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_113(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_115(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_114(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_116(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_115(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_117(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_116(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_118(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_117(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_119(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_118(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_120(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_119(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_121(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_120(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_122(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_121(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_123(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_122(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_124(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_123(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_125(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_124(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_126(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_125(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_127(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_126(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_128(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_127(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_129(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_128(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_130(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_129(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_131(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_130(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_132(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_131(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_133(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_132(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_134(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_133(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_135(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_134(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_136(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_135(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_137(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_136(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_138(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_137(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_139(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_138(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_140(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_139(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_141(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_140(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_142(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_141(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_143(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_142(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_144(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_143(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_145(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_144(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_146(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_145(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_147(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_146(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_148(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_147(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_149(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_148(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_150(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_149(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_151(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_150(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_152(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_151(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_153(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_152(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_154(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_153(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_155(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_154(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_156(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_155(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_157(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_156(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_158(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_157(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_159(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_158(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_160(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_159(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_161(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_160(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_162(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_161(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_163(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_162(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_164(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_163(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_165(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_164(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_166(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_165(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_167(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_166(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_168(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_167(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_169(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_168(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_170(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_169(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_171(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_170(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_172(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_171(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_173(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_172(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_174(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_173(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_175(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_174(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_176(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_175(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_177(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_176(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_178(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_177(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_179(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_178(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_180(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_179(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_181(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_180(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_182(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_181(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_183(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_182(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_184(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_183(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_185(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_184(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_186(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_185(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_187(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_186(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_188(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_187(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_189(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_188(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_190(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_189(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_191(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_190(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_192(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_191(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_193(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_192(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_194(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_193(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_195(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_194(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_196(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_195(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_197(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_196(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_198(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_197(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_199(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_198(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_200(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_199(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_201(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_200(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_202(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_201(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_203(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_202(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_204(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_203(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_205(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_204(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_206(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_205(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_207(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_206(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_208(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_207(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_209(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_208(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_210(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_209(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_211(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_210(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_212(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_211(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_213(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_212(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_214(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_213(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_215(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_214(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_216(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_215(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_217(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_216(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_218(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_217(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_219(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_218(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_220(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_219(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_221(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_220(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_222(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_221(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_223(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_222(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_224(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_223(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_225(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_224(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_226(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_225(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_227(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_226(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_228(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_227(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_229(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_228(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_230(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_229(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_231(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_230(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_232(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_231(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_233(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_232(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_234(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_233(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_235(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_234(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_236(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_235(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_237(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_236(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_238(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_237(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_239(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_238(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_240(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_239(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_241(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_240(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_242(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_241(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_243(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_242(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_244(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_243(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_245(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_244(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_246(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_245(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_247(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_246(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_248(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_247(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_249(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_248(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_250(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_249(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_251(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_250(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_252(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_251(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_253(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_252(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_254(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_253(call, __VA_ARGS__)
+
+// GMP_REPEAT_2
+#define _GMP_REPEAT_L2_0(call, data)
+#define _GMP_REPEAT_L2_1(call, data) _GMP_REPEAT_L2_0(call, data) call(0, data)
+#define _GMP_REPEAT_L2_2(call, data) _GMP_REPEAT_L2_1(call, data) call(1, data)
+#define _GMP_REPEAT_L2_3(call, data) _GMP_REPEAT_L2_2(call, data) call(2, data)
+#define _GMP_REPEAT_L2_4(call, data) _GMP_REPEAT_L2_3(call, data) call(3, data)
+#define _GMP_REPEAT_L2_5(call, data) _GMP_REPEAT_L2_4(call, data) call(4, data)
+#define _GMP_REPEAT_L2_6(call, data) _GMP_REPEAT_L2_5(call, data) call(5, data)
+#define _GMP_REPEAT_L2_7(call, data) _GMP_REPEAT_L2_6(call, data) call(6, data)
+#define _GMP_REPEAT_L2_8(call, data) _GMP_REPEAT_L2_7(call, data) call(7, data)
+#define _GMP_REPEAT_L2_9(call, data) _GMP_REPEAT_L2_8(call, data) call(8, data)
+#define _GMP_REPEAT_L2_10(call, data) _GMP_REPEAT_L2_9(call, data) call(9, data)
+#define _GMP_REPEAT_L2_11(call, data) _GMP_REPEAT_L2_10(call, data) call(10, data)
+#define _GMP_REPEAT_L2_12(call, data) _GMP_REPEAT_L2_11(call, data) call(11, data)
+#define _GMP_REPEAT_L2_13(call, data) _GMP_REPEAT_L2_12(call, data) call(12, data)
+#define _GMP_REPEAT_L2_14(call, data) _GMP_REPEAT_L2_13(call, data) call(13, data)
+#define _GMP_REPEAT_L2_15(call, data) _GMP_REPEAT_L2_14(call, data) call(14, data)
+#define _GMP_REPEAT_L2_16(call, data) _GMP_REPEAT_L2_15(call, data) call(15, data)
+#define _GMP_REPEAT_L2_17(call, data) _GMP_REPEAT_L2_16(call, data) call(16, data)
+#define _GMP_REPEAT_L2_18(call, data) _GMP_REPEAT_L2_17(call, data) call(17, data)
+#define _GMP_REPEAT_L2_19(call, data) _GMP_REPEAT_L2_18(call, data) call(18, data)
+#define _GMP_REPEAT_L2_20(call, data) _GMP_REPEAT_L2_19(call, data) call(19, data)
+#define _GMP_REPEAT_L2_21(call, data) _GMP_REPEAT_L2_20(call, data) call(20, data)
+#define _GMP_REPEAT_L2_22(call, data) _GMP_REPEAT_L2_21(call, data) call(21, data)
+#define _GMP_REPEAT_L2_23(call, data) _GMP_REPEAT_L2_22(call, data) call(22, data)
+#define _GMP_REPEAT_L2_24(call, data) _GMP_REPEAT_L2_23(call, data) call(23, data)
+#define _GMP_REPEAT_L2_25(call, data) _GMP_REPEAT_L2_24(call, data) call(24, data)
+#define _GMP_REPEAT_L2_26(call, data) _GMP_REPEAT_L2_25(call, data) call(25, data)
+#define _GMP_REPEAT_L2_27(call, data) _GMP_REPEAT_L2_26(call, data) call(26, data)
+#define _GMP_REPEAT_L2_28(call, data) _GMP_REPEAT_L2_27(call, data) call(27, data)
+#define _GMP_REPEAT_L2_29(call, data) _GMP_REPEAT_L2_28(call, data) call(28, data)
+#define _GMP_REPEAT_L2_30(call, data) _GMP_REPEAT_L2_29(call, data) call(29, data)
+#define _GMP_REPEAT_L2_31(call, data) _GMP_REPEAT_L2_30(call, data) call(30, data)
+#define _GMP_REPEAT_L2_32(call, data) _GMP_REPEAT_L2_31(call, data) call(31, data)
+#define _GMP_REPEAT_L2_33(call, data) _GMP_REPEAT_L2_32(call, data) call(32, data)
+#define _GMP_REPEAT_L2_34(call, data) _GMP_REPEAT_L2_33(call, data) call(33, data)
+#define _GMP_REPEAT_L2_35(call, data) _GMP_REPEAT_L2_34(call, data) call(34, data)
+#define _GMP_REPEAT_L2_36(call, data) _GMP_REPEAT_L2_35(call, data) call(35, data)
+#define _GMP_REPEAT_L2_37(call, data) _GMP_REPEAT_L2_36(call, data) call(36, data)
+#define _GMP_REPEAT_L2_38(call, data) _GMP_REPEAT_L2_37(call, data) call(37, data)
+#define _GMP_REPEAT_L2_39(call, data) _GMP_REPEAT_L2_38(call, data) call(38, data)
+#define _GMP_REPEAT_L2_40(call, data) _GMP_REPEAT_L2_39(call, data) call(39, data)
+#define _GMP_REPEAT_L2_41(call, data) _GMP_REPEAT_L2_40(call, data) call(40, data)
+#define _GMP_REPEAT_L2_42(call, data) _GMP_REPEAT_L2_41(call, data) call(41, data)
+#define _GMP_REPEAT_L2_43(call, data) _GMP_REPEAT_L2_42(call, data) call(42, data)
+#define _GMP_REPEAT_L2_44(call, data) _GMP_REPEAT_L2_43(call, data) call(43, data)
+#define _GMP_REPEAT_L2_45(call, data) _GMP_REPEAT_L2_44(call, data) call(44, data)
+#define _GMP_REPEAT_L2_46(call, data) _GMP_REPEAT_L2_45(call, data) call(45, data)
+#define _GMP_REPEAT_L2_47(call, data) _GMP_REPEAT_L2_46(call, data) call(46, data)
+#define _GMP_REPEAT_L2_48(call, data) _GMP_REPEAT_L2_47(call, data) call(47, data)
+#define _GMP_REPEAT_L2_49(call, data) _GMP_REPEAT_L2_48(call, data) call(48, data)
+#define _GMP_REPEAT_L2_50(call, data) _GMP_REPEAT_L2_49(call, data) call(49, data)
+#define _GMP_REPEAT_L2_51(call, data) _GMP_REPEAT_L2_50(call, data) call(50, data)
+#define _GMP_REPEAT_L2_52(call, data) _GMP_REPEAT_L2_51(call, data) call(51, data)
+#define _GMP_REPEAT_L2_53(call, data) _GMP_REPEAT_L2_52(call, data) call(52, data)
+#define _GMP_REPEAT_L2_54(call, data) _GMP_REPEAT_L2_53(call, data) call(53, data)
+#define _GMP_REPEAT_L2_55(call, data) _GMP_REPEAT_L2_54(call, data) call(54, data)
+#define _GMP_REPEAT_L2_56(call, data) _GMP_REPEAT_L2_55(call, data) call(55, data)
+#define _GMP_REPEAT_L2_57(call, data) _GMP_REPEAT_L2_56(call, data) call(56, data)
+#define _GMP_REPEAT_L2_58(call, data) _GMP_REPEAT_L2_57(call, data) call(57, data)
+#define _GMP_REPEAT_L2_59(call, data) _GMP_REPEAT_L2_58(call, data) call(58, data)
+#define _GMP_REPEAT_L2_60(call, data) _GMP_REPEAT_L2_59(call, data) call(59, data)
+#define _GMP_REPEAT_L2_61(call, data) _GMP_REPEAT_L2_60(call, data) call(60, data)
+#define _GMP_REPEAT_L2_62(call, data) _GMP_REPEAT_L2_61(call, data) call(61, data)
+#define _GMP_REPEAT_L2_63(call, data) _GMP_REPEAT_L2_62(call, data) call(62, data)
+#define _GMP_REPEAT_L2_64(call, data) _GMP_REPEAT_L2_63(call, data) call(63, data)
+#define _GMP_REPEAT_L2_65(call, data) _GMP_REPEAT_L2_64(call, data) call(64, data)
+#define _GMP_REPEAT_L2_66(call, data) _GMP_REPEAT_L2_65(call, data) call(65, data)
+#define _GMP_REPEAT_L2_67(call, data) _GMP_REPEAT_L2_66(call, data) call(66, data)
+#define _GMP_REPEAT_L2_68(call, data) _GMP_REPEAT_L2_67(call, data) call(67, data)
+#define _GMP_REPEAT_L2_69(call, data) _GMP_REPEAT_L2_68(call, data) call(68, data)
+#define _GMP_REPEAT_L2_70(call, data) _GMP_REPEAT_L2_69(call, data) call(69, data)
+#define _GMP_REPEAT_L2_71(call, data) _GMP_REPEAT_L2_70(call, data) call(70, data)
+#define _GMP_REPEAT_L2_72(call, data) _GMP_REPEAT_L2_71(call, data) call(71, data)
+#define _GMP_REPEAT_L2_73(call, data) _GMP_REPEAT_L2_72(call, data) call(72, data)
+#define _GMP_REPEAT_L2_74(call, data) _GMP_REPEAT_L2_73(call, data) call(73, data)
+#define _GMP_REPEAT_L2_75(call, data) _GMP_REPEAT_L2_74(call, data) call(74, data)
+#define _GMP_REPEAT_L2_76(call, data) _GMP_REPEAT_L2_75(call, data) call(75, data)
+#define _GMP_REPEAT_L2_77(call, data) _GMP_REPEAT_L2_76(call, data) call(76, data)
+#define _GMP_REPEAT_L2_78(call, data) _GMP_REPEAT_L2_77(call, data) call(77, data)
+#define _GMP_REPEAT_L2_79(call, data) _GMP_REPEAT_L2_78(call, data) call(78, data)
+#define _GMP_REPEAT_L2_80(call, data) _GMP_REPEAT_L2_79(call, data) call(79, data)
+#define _GMP_REPEAT_L2_81(call, data) _GMP_REPEAT_L2_80(call, data) call(80, data)
+#define _GMP_REPEAT_L2_82(call, data) _GMP_REPEAT_L2_81(call, data) call(81, data)
+#define _GMP_REPEAT_L2_83(call, data) _GMP_REPEAT_L2_82(call, data) call(82, data)
+#define _GMP_REPEAT_L2_84(call, data) _GMP_REPEAT_L2_83(call, data) call(83, data)
+#define _GMP_REPEAT_L2_85(call, data) _GMP_REPEAT_L2_84(call, data) call(84, data)
+#define _GMP_REPEAT_L2_86(call, data) _GMP_REPEAT_L2_85(call, data) call(85, data)
+#define _GMP_REPEAT_L2_87(call, data) _GMP_REPEAT_L2_86(call, data) call(86, data)
+#define _GMP_REPEAT_L2_88(call, data) _GMP_REPEAT_L2_87(call, data) call(87, data)
+#define _GMP_REPEAT_L2_89(call, data) _GMP_REPEAT_L2_88(call, data) call(88, data)
+#define _GMP_REPEAT_L2_90(call, data) _GMP_REPEAT_L2_89(call, data) call(89, data)
+#define _GMP_REPEAT_L2_91(call, data) _GMP_REPEAT_L2_90(call, data) call(90, data)
+#define _GMP_REPEAT_L2_92(call, data) _GMP_REPEAT_L2_91(call, data) call(91, data)
+#define _GMP_REPEAT_L2_93(call, data) _GMP_REPEAT_L2_92(call, data) call(92, data)
+#define _GMP_REPEAT_L2_94(call, data) _GMP_REPEAT_L2_93(call, data) call(93, data)
+#define _GMP_REPEAT_L2_95(call, data) _GMP_REPEAT_L2_94(call, data) call(94, data)
+#define _GMP_REPEAT_L2_96(call, data) _GMP_REPEAT_L2_95(call, data) call(95, data)
+#define _GMP_REPEAT_L2_97(call, data) _GMP_REPEAT_L2_96(call, data) call(96, data)
+#define _GMP_REPEAT_L2_98(call, data) _GMP_REPEAT_L2_97(call, data) call(97, data)
+#define _GMP_REPEAT_L2_99(call, data) _GMP_REPEAT_L2_98(call, data) call(98, data)
+#define _GMP_REPEAT_L2_100(call, data) _GMP_REPEAT_L2_99(call, data) call(99, data)
+#define _GMP_REPEAT_L2_101(call, data) _GMP_REPEAT_L2_100(call, data) call(100, data)
+#define _GMP_REPEAT_L2_102(call, data) _GMP_REPEAT_L2_101(call, data) call(101, data)
+#define _GMP_REPEAT_L2_103(call, data) _GMP_REPEAT_L2_102(call, data) call(102, data)
+#define _GMP_REPEAT_L2_104(call, data) _GMP_REPEAT_L2_103(call, data) call(103, data)
+#define _GMP_REPEAT_L2_105(call, data) _GMP_REPEAT_L2_104(call, data) call(104, data)
+#define _GMP_REPEAT_L2_106(call, data) _GMP_REPEAT_L2_105(call, data) call(105, data)
+#define _GMP_REPEAT_L2_107(call, data) _GMP_REPEAT_L2_106(call, data) call(106, data)
+#define _GMP_REPEAT_L2_108(call, data) _GMP_REPEAT_L2_107(call, data) call(107, data)
+#define _GMP_REPEAT_L2_109(call, data) _GMP_REPEAT_L2_108(call, data) call(108, data)
+#define _GMP_REPEAT_L2_110(call, data) _GMP_REPEAT_L2_109(call, data) call(109, data)
+#define _GMP_REPEAT_L2_111(call, data) _GMP_REPEAT_L2_110(call, data) call(110, data)
+#define _GMP_REPEAT_L2_112(call, data) _GMP_REPEAT_L2_111(call, data) call(111, data)
+#define _GMP_REPEAT_L2_113(call, data) _GMP_REPEAT_L2_112(call, data) call(112, data)
+#define _GMP_REPEAT_L2_114(call, data) _GMP_REPEAT_L2_113(call, data) call(113, data)
+#define _GMP_REPEAT_L2_115(call, data) _GMP_REPEAT_L2_114(call, data) call(114, data)
+#define _GMP_REPEAT_L2_116(call, data) _GMP_REPEAT_L2_115(call, data) call(115, data)
+#define _GMP_REPEAT_L2_117(call, data) _GMP_REPEAT_L2_116(call, data) call(116, data)
+#define _GMP_REPEAT_L2_118(call, data) _GMP_REPEAT_L2_117(call, data) call(117, data)
+#define _GMP_REPEAT_L2_119(call, data) _GMP_REPEAT_L2_118(call, data) call(118, data)
+#define _GMP_REPEAT_L2_120(call, data) _GMP_REPEAT_L2_119(call, data) call(119, data)
+#define _GMP_REPEAT_L2_121(call, data) _GMP_REPEAT_L2_120(call, data) call(120, data)
+#define _GMP_REPEAT_L2_122(call, data) _GMP_REPEAT_L2_121(call, data) call(121, data)
+#define _GMP_REPEAT_L2_123(call, data) _GMP_REPEAT_L2_122(call, data) call(122, data)
+#define _GMP_REPEAT_L2_124(call, data) _GMP_REPEAT_L2_123(call, data) call(123, data)
+#define _GMP_REPEAT_L2_125(call, data) _GMP_REPEAT_L2_124(call, data) call(124, data)
+#define _GMP_REPEAT_L2_126(call, data) _GMP_REPEAT_L2_125(call, data) call(125, data)
+#define _GMP_REPEAT_L2_127(call, data) _GMP_REPEAT_L2_126(call, data) call(126, data)
+#define _GMP_REPEAT_L2_128(call, data) _GMP_REPEAT_L2_127(call, data) call(127, data)
+#define _GMP_REPEAT_L2_129(call, data) _GMP_REPEAT_L2_128(call, data) call(128, data)
+#define _GMP_REPEAT_L2_130(call, data) _GMP_REPEAT_L2_129(call, data) call(129, data)
+#define _GMP_REPEAT_L2_131(call, data) _GMP_REPEAT_L2_130(call, data) call(130, data)
+#define _GMP_REPEAT_L2_132(call, data) _GMP_REPEAT_L2_131(call, data) call(131, data)
+#define _GMP_REPEAT_L2_133(call, data) _GMP_REPEAT_L2_132(call, data) call(132, data)
+#define _GMP_REPEAT_L2_134(call, data) _GMP_REPEAT_L2_133(call, data) call(133, data)
+#define _GMP_REPEAT_L2_135(call, data) _GMP_REPEAT_L2_134(call, data) call(134, data)
+#define _GMP_REPEAT_L2_136(call, data) _GMP_REPEAT_L2_135(call, data) call(135, data)
+#define _GMP_REPEAT_L2_137(call, data) _GMP_REPEAT_L2_136(call, data) call(136, data)
+#define _GMP_REPEAT_L2_138(call, data) _GMP_REPEAT_L2_137(call, data) call(137, data)
+#define _GMP_REPEAT_L2_139(call, data) _GMP_REPEAT_L2_138(call, data) call(138, data)
+#define _GMP_REPEAT_L2_140(call, data) _GMP_REPEAT_L2_139(call, data) call(139, data)
+#define _GMP_REPEAT_L2_141(call, data) _GMP_REPEAT_L2_140(call, data) call(140, data)
+#define _GMP_REPEAT_L2_142(call, data) _GMP_REPEAT_L2_141(call, data) call(141, data)
+#define _GMP_REPEAT_L2_143(call, data) _GMP_REPEAT_L2_142(call, data) call(142, data)
+#define _GMP_REPEAT_L2_144(call, data) _GMP_REPEAT_L2_143(call, data) call(143, data)
+#define _GMP_REPEAT_L2_145(call, data) _GMP_REPEAT_L2_144(call, data) call(144, data)
+#define _GMP_REPEAT_L2_146(call, data) _GMP_REPEAT_L2_145(call, data) call(145, data)
+#define _GMP_REPEAT_L2_147(call, data) _GMP_REPEAT_L2_146(call, data) call(146, data)
+#define _GMP_REPEAT_L2_148(call, data) _GMP_REPEAT_L2_147(call, data) call(147, data)
+#define _GMP_REPEAT_L2_149(call, data) _GMP_REPEAT_L2_148(call, data) call(148, data)
+#define _GMP_REPEAT_L2_150(call, data) _GMP_REPEAT_L2_149(call, data) call(149, data)
+#define _GMP_REPEAT_L2_151(call, data) _GMP_REPEAT_L2_150(call, data) call(150, data)
+#define _GMP_REPEAT_L2_152(call, data) _GMP_REPEAT_L2_151(call, data) call(151, data)
+#define _GMP_REPEAT_L2_153(call, data) _GMP_REPEAT_L2_152(call, data) call(152, data)
+#define _GMP_REPEAT_L2_154(call, data) _GMP_REPEAT_L2_153(call, data) call(153, data)
+#define _GMP_REPEAT_L2_155(call, data) _GMP_REPEAT_L2_154(call, data) call(154, data)
+#define _GMP_REPEAT_L2_156(call, data) _GMP_REPEAT_L2_155(call, data) call(155, data)
+#define _GMP_REPEAT_L2_157(call, data) _GMP_REPEAT_L2_156(call, data) call(156, data)
+#define _GMP_REPEAT_L2_158(call, data) _GMP_REPEAT_L2_157(call, data) call(157, data)
+#define _GMP_REPEAT_L2_159(call, data) _GMP_REPEAT_L2_158(call, data) call(158, data)
+#define _GMP_REPEAT_L2_160(call, data) _GMP_REPEAT_L2_159(call, data) call(159, data)
+#define _GMP_REPEAT_L2_161(call, data) _GMP_REPEAT_L2_160(call, data) call(160, data)
+#define _GMP_REPEAT_L2_162(call, data) _GMP_REPEAT_L2_161(call, data) call(161, data)
+#define _GMP_REPEAT_L2_163(call, data) _GMP_REPEAT_L2_162(call, data) call(162, data)
+#define _GMP_REPEAT_L2_164(call, data) _GMP_REPEAT_L2_163(call, data) call(163, data)
+#define _GMP_REPEAT_L2_165(call, data) _GMP_REPEAT_L2_164(call, data) call(164, data)
+#define _GMP_REPEAT_L2_166(call, data) _GMP_REPEAT_L2_165(call, data) call(165, data)
+#define _GMP_REPEAT_L2_167(call, data) _GMP_REPEAT_L2_166(call, data) call(166, data)
+#define _GMP_REPEAT_L2_168(call, data) _GMP_REPEAT_L2_167(call, data) call(167, data)
+#define _GMP_REPEAT_L2_169(call, data) _GMP_REPEAT_L2_168(call, data) call(168, data)
+#define _GMP_REPEAT_L2_170(call, data) _GMP_REPEAT_L2_169(call, data) call(169, data)
+#define _GMP_REPEAT_L2_171(call, data) _GMP_REPEAT_L2_170(call, data) call(170, data)
+#define _GMP_REPEAT_L2_172(call, data) _GMP_REPEAT_L2_171(call, data) call(171, data)
+#define _GMP_REPEAT_L2_173(call, data) _GMP_REPEAT_L2_172(call, data) call(172, data)
+#define _GMP_REPEAT_L2_174(call, data) _GMP_REPEAT_L2_173(call, data) call(173, data)
+#define _GMP_REPEAT_L2_175(call, data) _GMP_REPEAT_L2_174(call, data) call(174, data)
+#define _GMP_REPEAT_L2_176(call, data) _GMP_REPEAT_L2_175(call, data) call(175, data)
+#define _GMP_REPEAT_L2_177(call, data) _GMP_REPEAT_L2_176(call, data) call(176, data)
+#define _GMP_REPEAT_L2_178(call, data) _GMP_REPEAT_L2_177(call, data) call(177, data)
+#define _GMP_REPEAT_L2_179(call, data) _GMP_REPEAT_L2_178(call, data) call(178, data)
+#define _GMP_REPEAT_L2_180(call, data) _GMP_REPEAT_L2_179(call, data) call(179, data)
+#define _GMP_REPEAT_L2_181(call, data) _GMP_REPEAT_L2_180(call, data) call(180, data)
+#define _GMP_REPEAT_L2_182(call, data) _GMP_REPEAT_L2_181(call, data) call(181, data)
+#define _GMP_REPEAT_L2_183(call, data) _GMP_REPEAT_L2_182(call, data) call(182, data)
+#define _GMP_REPEAT_L2_184(call, data) _GMP_REPEAT_L2_183(call, data) call(183, data)
+#define _GMP_REPEAT_L2_185(call, data) _GMP_REPEAT_L2_184(call, data) call(184, data)
+#define _GMP_REPEAT_L2_186(call, data) _GMP_REPEAT_L2_185(call, data) call(185, data)
+#define _GMP_REPEAT_L2_187(call, data) _GMP_REPEAT_L2_186(call, data) call(186, data)
+#define _GMP_REPEAT_L2_188(call, data) _GMP_REPEAT_L2_187(call, data) call(187, data)
+#define _GMP_REPEAT_L2_189(call, data) _GMP_REPEAT_L2_188(call, data) call(188, data)
+#define _GMP_REPEAT_L2_190(call, data) _GMP_REPEAT_L2_189(call, data) call(189, data)
+#define _GMP_REPEAT_L2_191(call, data) _GMP_REPEAT_L2_190(call, data) call(190, data)
+#define _GMP_REPEAT_L2_192(call, data) _GMP_REPEAT_L2_191(call, data) call(191, data)
+#define _GMP_REPEAT_L2_193(call, data) _GMP_REPEAT_L2_192(call, data) call(192, data)
+#define _GMP_REPEAT_L2_194(call, data) _GMP_REPEAT_L2_193(call, data) call(193, data)
+#define _GMP_REPEAT_L2_195(call, data) _GMP_REPEAT_L2_194(call, data) call(194, data)
+#define _GMP_REPEAT_L2_196(call, data) _GMP_REPEAT_L2_195(call, data) call(195, data)
+#define _GMP_REPEAT_L2_197(call, data) _GMP_REPEAT_L2_196(call, data) call(196, data)
+#define _GMP_REPEAT_L2_198(call, data) _GMP_REPEAT_L2_197(call, data) call(197, data)
+#define _GMP_REPEAT_L2_199(call, data) _GMP_REPEAT_L2_198(call, data) call(198, data)
+#define _GMP_REPEAT_L2_200(call, data) _GMP_REPEAT_L2_199(call, data) call(199, data)
+#define _GMP_REPEAT_L2_201(call, data) _GMP_REPEAT_L2_200(call, data) call(200, data)
+#define _GMP_REPEAT_L2_202(call, data) _GMP_REPEAT_L2_201(call, data) call(201, data)
+#define _GMP_REPEAT_L2_203(call, data) _GMP_REPEAT_L2_202(call, data) call(202, data)
+#define _GMP_REPEAT_L2_204(call, data) _GMP_REPEAT_L2_203(call, data) call(203, data)
+#define _GMP_REPEAT_L2_205(call, data) _GMP_REPEAT_L2_204(call, data) call(204, data)
+#define _GMP_REPEAT_L2_206(call, data) _GMP_REPEAT_L2_205(call, data) call(205, data)
+#define _GMP_REPEAT_L2_207(call, data) _GMP_REPEAT_L2_206(call, data) call(206, data)
+#define _GMP_REPEAT_L2_208(call, data) _GMP_REPEAT_L2_207(call, data) call(207, data)
+#define _GMP_REPEAT_L2_209(call, data) _GMP_REPEAT_L2_208(call, data) call(208, data)
+#define _GMP_REPEAT_L2_210(call, data) _GMP_REPEAT_L2_209(call, data) call(209, data)
+#define _GMP_REPEAT_L2_211(call, data) _GMP_REPEAT_L2_210(call, data) call(210, data)
+#define _GMP_REPEAT_L2_212(call, data) _GMP_REPEAT_L2_211(call, data) call(211, data)
+#define _GMP_REPEAT_L2_213(call, data) _GMP_REPEAT_L2_212(call, data) call(212, data)
+#define _GMP_REPEAT_L2_214(call, data) _GMP_REPEAT_L2_213(call, data) call(213, data)
+#define _GMP_REPEAT_L2_215(call, data) _GMP_REPEAT_L2_214(call, data) call(214, data)
+#define _GMP_REPEAT_L2_216(call, data) _GMP_REPEAT_L2_215(call, data) call(215, data)
+#define _GMP_REPEAT_L2_217(call, data) _GMP_REPEAT_L2_216(call, data) call(216, data)
+#define _GMP_REPEAT_L2_218(call, data) _GMP_REPEAT_L2_217(call, data) call(217, data)
+#define _GMP_REPEAT_L2_219(call, data) _GMP_REPEAT_L2_218(call, data) call(218, data)
+#define _GMP_REPEAT_L2_220(call, data) _GMP_REPEAT_L2_219(call, data) call(219, data)
+#define _GMP_REPEAT_L2_221(call, data) _GMP_REPEAT_L2_220(call, data) call(220, data)
+#define _GMP_REPEAT_L2_222(call, data) _GMP_REPEAT_L2_221(call, data) call(221, data)
+#define _GMP_REPEAT_L2_223(call, data) _GMP_REPEAT_L2_222(call, data) call(222, data)
+#define _GMP_REPEAT_L2_224(call, data) _GMP_REPEAT_L2_223(call, data) call(223, data)
+#define _GMP_REPEAT_L2_225(call, data) _GMP_REPEAT_L2_224(call, data) call(224, data)
+#define _GMP_REPEAT_L2_226(call, data) _GMP_REPEAT_L2_225(call, data) call(225, data)
+#define _GMP_REPEAT_L2_227(call, data) _GMP_REPEAT_L2_226(call, data) call(226, data)
+#define _GMP_REPEAT_L2_228(call, data) _GMP_REPEAT_L2_227(call, data) call(227, data)
+#define _GMP_REPEAT_L2_229(call, data) _GMP_REPEAT_L2_228(call, data) call(228, data)
+#define _GMP_REPEAT_L2_230(call, data) _GMP_REPEAT_L2_229(call, data) call(229, data)
+#define _GMP_REPEAT_L2_231(call, data) _GMP_REPEAT_L2_230(call, data) call(230, data)
+#define _GMP_REPEAT_L2_232(call, data) _GMP_REPEAT_L2_231(call, data) call(231, data)
+#define _GMP_REPEAT_L2_233(call, data) _GMP_REPEAT_L2_232(call, data) call(232, data)
+#define _GMP_REPEAT_L2_234(call, data) _GMP_REPEAT_L2_233(call, data) call(233, data)
+#define _GMP_REPEAT_L2_235(call, data) _GMP_REPEAT_L2_234(call, data) call(234, data)
+#define _GMP_REPEAT_L2_236(call, data) _GMP_REPEAT_L2_235(call, data) call(235, data)
+#define _GMP_REPEAT_L2_237(call, data) _GMP_REPEAT_L2_236(call, data) call(236, data)
+#define _GMP_REPEAT_L2_238(call, data) _GMP_REPEAT_L2_237(call, data) call(237, data)
+#define _GMP_REPEAT_L2_239(call, data) _GMP_REPEAT_L2_238(call, data) call(238, data)
+#define _GMP_REPEAT_L2_240(call, data) _GMP_REPEAT_L2_239(call, data) call(239, data)
+#define _GMP_REPEAT_L2_241(call, data) _GMP_REPEAT_L2_240(call, data) call(240, data)
+#define _GMP_REPEAT_L2_242(call, data) _GMP_REPEAT_L2_241(call, data) call(241, data)
+#define _GMP_REPEAT_L2_243(call, data) _GMP_REPEAT_L2_242(call, data) call(242, data)
+#define _GMP_REPEAT_L2_244(call, data) _GMP_REPEAT_L2_243(call, data) call(243, data)
+#define _GMP_REPEAT_L2_245(call, data) _GMP_REPEAT_L2_244(call, data) call(244, data)
+#define _GMP_REPEAT_L2_246(call, data) _GMP_REPEAT_L2_245(call, data) call(245, data)
+#define _GMP_REPEAT_L2_247(call, data) _GMP_REPEAT_L2_246(call, data) call(246, data)
+#define _GMP_REPEAT_L2_248(call, data) _GMP_REPEAT_L2_247(call, data) call(247, data)
+#define _GMP_REPEAT_L2_249(call, data) _GMP_REPEAT_L2_248(call, data) call(248, data)
+#define _GMP_REPEAT_L2_250(call, data) _GMP_REPEAT_L2_249(call, data) call(249, data)
+#define _GMP_REPEAT_L2_251(call, data) _GMP_REPEAT_L2_250(call, data) call(250, data)
+#define _GMP_REPEAT_L2_252(call, data) _GMP_REPEAT_L2_251(call, data) call(251, data)
+#define _GMP_REPEAT_L2_253(call, data) _GMP_REPEAT_L2_252(call, data) call(252, data)
+#define _GMP_REPEAT_L2_254(call, data) _GMP_REPEAT_L2_253(call, data) call(253, data)
+
+// GMP_REPEAT_FROM_2
+#define _GMP_REPEAT_FROM_L2_0(call, data, i)
+#define _GMP_REPEAT_FROM_L2_1(call, data, i) call(i, data)
+#define _GMP_REPEAT_FROM_L2_2(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_3(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_2(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_4(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_3(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_5(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_4(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_6(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_5(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_7(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_6(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_8(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_7(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_9(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_8(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_10(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_9(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_11(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_10(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_12(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_11(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_13(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_12(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_14(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_13(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_15(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_14(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_16(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_15(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_17(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_16(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_18(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_17(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_19(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_18(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_20(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_19(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_21(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_20(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_22(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_21(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_23(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_22(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_24(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_23(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_25(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_24(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_26(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_25(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_27(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_26(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_28(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_27(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_29(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_28(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_30(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_29(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_31(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_30(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_32(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_31(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_33(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_32(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_34(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_33(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_35(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_34(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_36(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_35(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_37(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_36(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_38(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_37(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_39(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_38(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_40(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_39(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_41(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_40(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_42(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_41(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_43(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_42(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_44(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_43(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_45(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_44(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_46(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_45(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_47(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_46(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_48(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_47(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_49(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_48(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_50(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_49(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_51(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_50(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_52(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_51(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_53(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_52(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_54(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_53(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_55(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_54(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_56(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_55(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_57(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_56(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_58(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_57(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_59(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_58(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_60(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_59(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_61(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_60(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_62(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_61(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_63(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_62(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_64(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_63(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_65(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_64(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_66(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_65(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_67(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_66(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_68(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_67(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_69(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_68(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_70(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_69(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_71(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_70(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_72(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_71(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_73(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_72(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_74(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_73(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_75(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_74(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_76(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_75(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_77(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_76(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_78(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_77(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_79(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_78(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_80(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_79(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_81(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_80(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_82(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_81(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_83(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_82(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_84(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_83(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_85(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_84(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_86(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_85(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_87(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_86(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_88(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_87(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_89(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_88(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_90(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_89(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_91(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_90(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_92(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_91(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_93(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_92(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_94(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_93(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_95(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_94(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_96(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_95(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_97(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_96(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_98(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_97(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_99(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_98(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_100(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_99(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_101(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_100(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_102(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_101(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_103(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_102(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_104(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_103(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_105(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_104(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_106(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_105(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_107(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_106(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_108(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_107(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_109(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_108(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_110(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_109(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_111(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_110(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_112(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_111(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_113(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_112(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_114(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_113(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_115(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_114(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_116(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_115(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_117(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_116(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_118(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_117(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_119(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_118(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_120(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_119(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_121(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_120(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_122(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_121(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_123(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_122(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_124(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_123(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_125(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_124(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_126(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_125(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_127(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_126(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_128(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_127(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_129(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_128(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_130(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_129(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_131(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_130(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_132(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_131(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_133(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_132(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_134(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_133(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_135(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_134(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_136(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_135(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_137(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_136(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_138(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_137(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_139(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_138(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_140(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_139(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_141(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_140(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_142(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_141(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_143(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_142(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_144(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_143(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_145(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_144(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_146(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_145(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_147(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_146(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_148(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_147(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_149(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_148(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_150(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_149(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_151(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_150(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_152(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_151(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_153(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_152(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_154(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_153(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_155(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_154(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_156(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_155(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_157(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_156(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_158(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_157(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_159(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_158(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_160(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_159(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_161(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_160(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_162(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_161(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_163(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_162(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_164(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_163(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_165(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_164(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_166(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_165(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_167(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_166(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_168(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_167(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_169(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_168(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_170(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_169(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_171(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_170(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_172(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_171(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_173(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_172(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_174(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_173(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_175(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_174(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_176(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_175(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_177(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_176(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_178(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_177(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_179(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_178(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_180(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_179(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_181(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_180(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_182(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_181(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_183(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_182(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_184(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_183(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_185(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_184(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_186(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_185(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_187(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_186(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_188(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_187(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_189(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_188(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_190(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_189(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_191(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_190(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_192(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_191(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_193(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_192(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_194(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_193(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_195(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_194(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_196(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_195(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_197(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_196(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_198(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_197(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_199(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_198(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_200(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_199(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_201(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_200(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_202(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_201(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_203(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_202(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_204(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_203(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_205(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_204(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_206(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_205(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_207(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_206(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_208(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_207(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_209(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_208(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_210(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_209(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_211(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_210(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_212(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_211(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_213(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_212(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_214(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_213(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_215(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_214(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_216(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_215(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_217(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_216(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_218(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_217(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_219(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_218(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_220(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_219(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_221(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_220(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_222(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_221(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_223(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_222(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_224(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_223(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_225(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_224(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_226(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_225(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_227(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_226(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_228(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_227(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_229(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_228(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_230(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_229(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_231(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_230(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_232(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_231(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_233(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_232(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_234(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_233(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_235(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_234(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_236(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_235(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_237(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_236(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_238(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_237(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_239(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_238(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_240(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_239(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_241(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_240(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_242(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_241(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_243(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_242(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_244(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_243(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_245(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_244(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_246(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_245(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_247(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_246(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_248(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_247(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_249(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_248(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_250(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_249(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_251(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_250(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_252(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_251(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_253(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_252(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_254(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_253(call, data, GMP_CONCAT(_GMP_INC_, i)())
+
+// GMP_LOOP_3
+#define _GMP_LOOP_L3_0(call, ...)
+#define _GMP_LOOP_L3_1(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_0(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_2(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_3(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_2(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_4(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_3(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_5(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_4(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_6(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_5(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_7(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_6(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_8(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_7(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_9(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_8(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_10(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_9(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_11(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_10(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_12(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_11(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_13(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_12(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_14(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_13(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_15(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_14(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_16(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_15(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_17(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_16(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_18(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_17(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_19(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_18(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_20(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_19(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_21(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_20(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_22(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_21(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_23(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_22(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_24(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_23(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_25(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_24(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_26(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_25(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_27(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_26(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_28(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_27(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_29(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_28(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_30(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_29(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_31(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_30(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_32(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_31(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_33(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_32(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_34(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_33(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_35(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_34(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_36(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_35(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_37(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_36(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_38(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_37(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_39(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_38(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_40(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_39(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_41(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_40(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_42(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_41(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_43(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_42(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_44(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_43(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_45(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_44(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_46(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_45(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_47(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_46(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_48(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_47(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_49(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_48(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_50(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_49(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_51(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_50(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_52(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_51(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_53(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_52(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_54(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_53(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_55(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_54(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_56(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_55(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_57(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_56(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_58(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_57(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_59(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_58(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_60(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_59(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_61(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_60(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_62(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_61(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_63(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_62(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_64(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_63(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_65(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_64(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_66(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_65(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_67(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_66(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_68(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_67(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_69(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_68(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_70(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_69(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_71(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_70(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_72(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_71(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_73(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_72(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_74(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_73(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_75(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_74(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_76(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_75(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_77(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_76(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_78(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_77(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_79(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_78(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_80(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_79(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_81(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_80(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_82(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_81(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_83(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_82(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_84(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_83(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_85(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_84(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_86(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_85(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_87(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_86(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_88(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_87(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_89(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_88(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_90(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_89(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_91(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_90(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_92(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_91(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_93(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_92(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_94(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_93(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_95(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_94(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_96(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_95(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_97(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_96(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_98(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_97(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_99(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_98(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_100(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_99(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_101(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_100(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_102(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_101(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_103(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_102(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_104(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_103(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_105(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_104(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_106(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_105(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_107(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_106(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_108(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_107(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_109(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_108(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_110(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_109(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_111(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_110(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_112(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_111(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_113(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_112(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_114(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_113(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_115(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_114(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_116(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_115(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_117(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_116(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_118(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_117(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_119(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_118(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_120(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_119(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_121(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_120(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_122(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_121(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_123(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_122(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_124(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_123(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_125(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_124(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_126(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_125(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_127(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_126(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_128(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_127(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_129(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_128(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_130(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_129(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_131(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_130(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_132(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_131(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_133(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_132(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_134(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_133(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_135(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_134(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_136(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_135(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_137(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_136(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_138(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_137(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_139(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_138(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_140(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_139(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_141(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_140(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_142(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_141(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_143(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_142(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_144(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_143(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_145(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_144(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_146(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_145(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_147(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_146(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_148(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_147(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_149(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_148(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_150(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_149(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_151(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_150(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_152(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_151(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_153(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_152(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_154(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_153(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_155(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_154(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_156(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_155(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_157(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_156(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_158(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_157(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_159(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_158(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_160(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_159(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_161(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_160(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_162(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_161(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_163(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_162(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_164(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_163(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_165(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_164(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_166(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_165(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_167(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_166(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_168(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_167(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_169(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_168(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_170(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_169(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_171(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_170(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_172(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_171(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_173(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_172(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_174(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_173(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_175(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_174(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_176(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_175(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_177(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_176(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_178(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_177(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_179(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_178(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_180(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_179(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_181(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_180(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_182(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_181(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_183(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_182(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_184(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_183(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_185(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_184(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_186(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_185(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_187(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_186(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_188(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_187(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_189(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_188(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_190(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_189(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_191(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_190(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_192(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_191(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_193(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_192(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_194(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_193(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_195(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_194(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_196(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_195(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_197(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_196(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_198(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_197(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_199(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_198(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_200(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_199(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_201(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_200(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_202(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_201(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_203(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_202(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_204(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_203(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_205(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_204(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_206(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_205(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_207(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_206(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_208(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_207(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_209(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_208(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_210(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_209(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_211(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_210(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_212(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_211(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_213(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_212(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_214(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_213(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_215(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_214(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_216(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_215(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_217(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_216(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_218(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_217(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_219(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_218(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_220(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_219(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_221(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_220(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_222(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_221(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_223(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_222(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_224(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_223(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_225(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_224(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_226(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_225(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_227(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_226(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_228(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_227(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_229(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_228(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_230(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_229(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_231(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_230(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_232(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_231(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_233(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_232(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_234(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_233(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_235(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_234(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_236(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_235(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_237(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_236(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_238(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_237(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_239(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_238(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_240(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_239(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_241(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_240(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_242(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_241(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_243(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_242(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_244(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_243(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_245(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_244(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_246(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_245(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_247(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_246(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_248(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_247(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_249(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_248(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_250(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_249(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_251(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_250(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_252(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_251(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_253(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_252(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_254(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_253(call, __VA_ARGS__)
+
+// GMP_REPEAT_3
+#define _GMP_REPEAT_L3_0(call, data)
+#define _GMP_REPEAT_L3_1(call, data) _GMP_REPEAT_L3_0(call, data) call(0, data)
+#define _GMP_REPEAT_L3_2(call, data) _GMP_REPEAT_L3_1(call, data) call(1, data)
+#define _GMP_REPEAT_L3_3(call, data) _GMP_REPEAT_L3_2(call, data) call(2, data)
+#define _GMP_REPEAT_L3_4(call, data) _GMP_REPEAT_L3_3(call, data) call(3, data)
+#define _GMP_REPEAT_L3_5(call, data) _GMP_REPEAT_L3_4(call, data) call(4, data)
+#define _GMP_REPEAT_L3_6(call, data) _GMP_REPEAT_L3_5(call, data) call(5, data)
+#define _GMP_REPEAT_L3_7(call, data) _GMP_REPEAT_L3_6(call, data) call(6, data)
+#define _GMP_REPEAT_L3_8(call, data) _GMP_REPEAT_L3_7(call, data) call(7, data)
+#define _GMP_REPEAT_L3_9(call, data) _GMP_REPEAT_L3_8(call, data) call(8, data)
+#define _GMP_REPEAT_L3_10(call, data) _GMP_REPEAT_L3_9(call, data) call(9, data)
+#define _GMP_REPEAT_L3_11(call, data) _GMP_REPEAT_L3_10(call, data) call(10, data)
+#define _GMP_REPEAT_L3_12(call, data) _GMP_REPEAT_L3_11(call, data) call(11, data)
+#define _GMP_REPEAT_L3_13(call, data) _GMP_REPEAT_L3_12(call, data) call(12, data)
+#define _GMP_REPEAT_L3_14(call, data) _GMP_REPEAT_L3_13(call, data) call(13, data)
+#define _GMP_REPEAT_L3_15(call, data) _GMP_REPEAT_L3_14(call, data) call(14, data)
+#define _GMP_REPEAT_L3_16(call, data) _GMP_REPEAT_L3_15(call, data) call(15, data)
+#define _GMP_REPEAT_L3_17(call, data) _GMP_REPEAT_L3_16(call, data) call(16, data)
+#define _GMP_REPEAT_L3_18(call, data) _GMP_REPEAT_L3_17(call, data) call(17, data)
+#define _GMP_REPEAT_L3_19(call, data) _GMP_REPEAT_L3_18(call, data) call(18, data)
+#define _GMP_REPEAT_L3_20(call, data) _GMP_REPEAT_L3_19(call, data) call(19, data)
+#define _GMP_REPEAT_L3_21(call, data) _GMP_REPEAT_L3_20(call, data) call(20, data)
+#define _GMP_REPEAT_L3_22(call, data) _GMP_REPEAT_L3_21(call, data) call(21, data)
+#define _GMP_REPEAT_L3_23(call, data) _GMP_REPEAT_L3_22(call, data) call(22, data)
+#define _GMP_REPEAT_L3_24(call, data) _GMP_REPEAT_L3_23(call, data) call(23, data)
+#define _GMP_REPEAT_L3_25(call, data) _GMP_REPEAT_L3_24(call, data) call(24, data)
+#define _GMP_REPEAT_L3_26(call, data) _GMP_REPEAT_L3_25(call, data) call(25, data)
+#define _GMP_REPEAT_L3_27(call, data) _GMP_REPEAT_L3_26(call, data) call(26, data)
+#define _GMP_REPEAT_L3_28(call, data) _GMP_REPEAT_L3_27(call, data) call(27, data)
+#define _GMP_REPEAT_L3_29(call, data) _GMP_REPEAT_L3_28(call, data) call(28, data)
+#define _GMP_REPEAT_L3_30(call, data) _GMP_REPEAT_L3_29(call, data) call(29, data)
+#define _GMP_REPEAT_L3_31(call, data) _GMP_REPEAT_L3_30(call, data) call(30, data)
+#define _GMP_REPEAT_L3_32(call, data) _GMP_REPEAT_L3_31(call, data) call(31, data)
+#define _GMP_REPEAT_L3_33(call, data) _GMP_REPEAT_L3_32(call, data) call(32, data)
+#define _GMP_REPEAT_L3_34(call, data) _GMP_REPEAT_L3_33(call, data) call(33, data)
+#define _GMP_REPEAT_L3_35(call, data) _GMP_REPEAT_L3_34(call, data) call(34, data)
+#define _GMP_REPEAT_L3_36(call, data) _GMP_REPEAT_L3_35(call, data) call(35, data)
+#define _GMP_REPEAT_L3_37(call, data) _GMP_REPEAT_L3_36(call, data) call(36, data)
+#define _GMP_REPEAT_L3_38(call, data) _GMP_REPEAT_L3_37(call, data) call(37, data)
+#define _GMP_REPEAT_L3_39(call, data) _GMP_REPEAT_L3_38(call, data) call(38, data)
+#define _GMP_REPEAT_L3_40(call, data) _GMP_REPEAT_L3_39(call, data) call(39, data)
+#define _GMP_REPEAT_L3_41(call, data) _GMP_REPEAT_L3_40(call, data) call(40, data)
+#define _GMP_REPEAT_L3_42(call, data) _GMP_REPEAT_L3_41(call, data) call(41, data)
+#define _GMP_REPEAT_L3_43(call, data) _GMP_REPEAT_L3_42(call, data) call(42, data)
+#define _GMP_REPEAT_L3_44(call, data) _GMP_REPEAT_L3_43(call, data) call(43, data)
+#define _GMP_REPEAT_L3_45(call, data) _GMP_REPEAT_L3_44(call, data) call(44, data)
+#define _GMP_REPEAT_L3_46(call, data) _GMP_REPEAT_L3_45(call, data) call(45, data)
+#define _GMP_REPEAT_L3_47(call, data) _GMP_REPEAT_L3_46(call, data) call(46, data)
+#define _GMP_REPEAT_L3_48(call, data) _GMP_REPEAT_L3_47(call, data) call(47, data)
+#define _GMP_REPEAT_L3_49(call, data) _GMP_REPEAT_L3_48(call, data) call(48, data)
+#define _GMP_REPEAT_L3_50(call, data) _GMP_REPEAT_L3_49(call, data) call(49, data)
+#define _GMP_REPEAT_L3_51(call, data) _GMP_REPEAT_L3_50(call, data) call(50, data)
+#define _GMP_REPEAT_L3_52(call, data) _GMP_REPEAT_L3_51(call, data) call(51, data)
+#define _GMP_REPEAT_L3_53(call, data) _GMP_REPEAT_L3_52(call, data) call(52, data)
+#define _GMP_REPEAT_L3_54(call, data) _GMP_REPEAT_L3_53(call, data) call(53, data)
+#define _GMP_REPEAT_L3_55(call, data) _GMP_REPEAT_L3_54(call, data) call(54, data)
+#define _GMP_REPEAT_L3_56(call, data) _GMP_REPEAT_L3_55(call, data) call(55, data)
+#define _GMP_REPEAT_L3_57(call, data) _GMP_REPEAT_L3_56(call, data) call(56, data)
+#define _GMP_REPEAT_L3_58(call, data) _GMP_REPEAT_L3_57(call, data) call(57, data)
+#define _GMP_REPEAT_L3_59(call, data) _GMP_REPEAT_L3_58(call, data) call(58, data)
+#define _GMP_REPEAT_L3_60(call, data) _GMP_REPEAT_L3_59(call, data) call(59, data)
+#define _GMP_REPEAT_L3_61(call, data) _GMP_REPEAT_L3_60(call, data) call(60, data)
+#define _GMP_REPEAT_L3_62(call, data) _GMP_REPEAT_L3_61(call, data) call(61, data)
+#define _GMP_REPEAT_L3_63(call, data) _GMP_REPEAT_L3_62(call, data) call(62, data)
+#define _GMP_REPEAT_L3_64(call, data) _GMP_REPEAT_L3_63(call, data) call(63, data)
+#define _GMP_REPEAT_L3_65(call, data) _GMP_REPEAT_L3_64(call, data) call(64, data)
+#define _GMP_REPEAT_L3_66(call, data) _GMP_REPEAT_L3_65(call, data) call(65, data)
+#define _GMP_REPEAT_L3_67(call, data) _GMP_REPEAT_L3_66(call, data) call(66, data)
+#define _GMP_REPEAT_L3_68(call, data) _GMP_REPEAT_L3_67(call, data) call(67, data)
+#define _GMP_REPEAT_L3_69(call, data) _GMP_REPEAT_L3_68(call, data) call(68, data)
+#define _GMP_REPEAT_L3_70(call, data) _GMP_REPEAT_L3_69(call, data) call(69, data)
+#define _GMP_REPEAT_L3_71(call, data) _GMP_REPEAT_L3_70(call, data) call(70, data)
+#define _GMP_REPEAT_L3_72(call, data) _GMP_REPEAT_L3_71(call, data) call(71, data)
+#define _GMP_REPEAT_L3_73(call, data) _GMP_REPEAT_L3_72(call, data) call(72, data)
+#define _GMP_REPEAT_L3_74(call, data) _GMP_REPEAT_L3_73(call, data) call(73, data)
+#define _GMP_REPEAT_L3_75(call, data) _GMP_REPEAT_L3_74(call, data) call(74, data)
+#define _GMP_REPEAT_L3_76(call, data) _GMP_REPEAT_L3_75(call, data) call(75, data)
+#define _GMP_REPEAT_L3_77(call, data) _GMP_REPEAT_L3_76(call, data) call(76, data)
+#define _GMP_REPEAT_L3_78(call, data) _GMP_REPEAT_L3_77(call, data) call(77, data)
+#define _GMP_REPEAT_L3_79(call, data) _GMP_REPEAT_L3_78(call, data) call(78, data)
+#define _GMP_REPEAT_L3_80(call, data) _GMP_REPEAT_L3_79(call, data) call(79, data)
+#define _GMP_REPEAT_L3_81(call, data) _GMP_REPEAT_L3_80(call, data) call(80, data)
+#define _GMP_REPEAT_L3_82(call, data) _GMP_REPEAT_L3_81(call, data) call(81, data)
+#define _GMP_REPEAT_L3_83(call, data) _GMP_REPEAT_L3_82(call, data) call(82, data)
+#define _GMP_REPEAT_L3_84(call, data) _GMP_REPEAT_L3_83(call, data) call(83, data)
+#define _GMP_REPEAT_L3_85(call, data) _GMP_REPEAT_L3_84(call, data) call(84, data)
+#define _GMP_REPEAT_L3_86(call, data) _GMP_REPEAT_L3_85(call, data) call(85, data)
+#define _GMP_REPEAT_L3_87(call, data) _GMP_REPEAT_L3_86(call, data) call(86, data)
+#define _GMP_REPEAT_L3_88(call, data) _GMP_REPEAT_L3_87(call, data) call(87, data)
+#define _GMP_REPEAT_L3_89(call, data) _GMP_REPEAT_L3_88(call, data) call(88, data)
+#define _GMP_REPEAT_L3_90(call, data) _GMP_REPEAT_L3_89(call, data) call(89, data)
+#define _GMP_REPEAT_L3_91(call, data) _GMP_REPEAT_L3_90(call, data) call(90, data)
+#define _GMP_REPEAT_L3_92(call, data) _GMP_REPEAT_L3_91(call, data) call(91, data)
+#define _GMP_REPEAT_L3_93(call, data) _GMP_REPEAT_L3_92(call, data) call(92, data)
+#define _GMP_REPEAT_L3_94(call, data) _GMP_REPEAT_L3_93(call, data) call(93, data)
+#define _GMP_REPEAT_L3_95(call, data) _GMP_REPEAT_L3_94(call, data) call(94, data)
+#define _GMP_REPEAT_L3_96(call, data) _GMP_REPEAT_L3_95(call, data) call(95, data)
+#define _GMP_REPEAT_L3_97(call, data) _GMP_REPEAT_L3_96(call, data) call(96, data)
+#define _GMP_REPEAT_L3_98(call, data) _GMP_REPEAT_L3_97(call, data) call(97, data)
+#define _GMP_REPEAT_L3_99(call, data) _GMP_REPEAT_L3_98(call, data) call(98, data)
+#define _GMP_REPEAT_L3_100(call, data) _GMP_REPEAT_L3_99(call, data) call(99, data)
+#define _GMP_REPEAT_L3_101(call, data) _GMP_REPEAT_L3_100(call, data) call(100, data)
+#define _GMP_REPEAT_L3_102(call, data) _GMP_REPEAT_L3_101(call, data) call(101, data)
+#define _GMP_REPEAT_L3_103(call, data) _GMP_REPEAT_L3_102(call, data) call(102, data)
+#define _GMP_REPEAT_L3_104(call, data) _GMP_REPEAT_L3_103(call, data) call(103, data)
+#define _GMP_REPEAT_L3_105(call, data) _GMP_REPEAT_L3_104(call, data) call(104, data)
+#define _GMP_REPEAT_L3_106(call, data) _GMP_REPEAT_L3_105(call, data) call(105, data)
+#define _GMP_REPEAT_L3_107(call, data) _GMP_REPEAT_L3_106(call, data) call(106, data)
+#define _GMP_REPEAT_L3_108(call, data) _GMP_REPEAT_L3_107(call, data) call(107, data)
+#define _GMP_REPEAT_L3_109(call, data) _GMP_REPEAT_L3_108(call, data) call(108, data)
+#define _GMP_REPEAT_L3_110(call, data) _GMP_REPEAT_L3_109(call, data) call(109, data)
+#define _GMP_REPEAT_L3_111(call, data) _GMP_REPEAT_L3_110(call, data) call(110, data)
+#define _GMP_REPEAT_L3_112(call, data) _GMP_REPEAT_L3_111(call, data) call(111, data)
+#define _GMP_REPEAT_L3_113(call, data) _GMP_REPEAT_L3_112(call, data) call(112, data)
+#define _GMP_REPEAT_L3_114(call, data) _GMP_REPEAT_L3_113(call, data) call(113, data)
+#define _GMP_REPEAT_L3_115(call, data) _GMP_REPEAT_L3_114(call, data) call(114, data)
+#define _GMP_REPEAT_L3_116(call, data) _GMP_REPEAT_L3_115(call, data) call(115, data)
+#define _GMP_REPEAT_L3_117(call, data) _GMP_REPEAT_L3_116(call, data) call(116, data)
+#define _GMP_REPEAT_L3_118(call, data) _GMP_REPEAT_L3_117(call, data) call(117, data)
+#define _GMP_REPEAT_L3_119(call, data) _GMP_REPEAT_L3_118(call, data) call(118, data)
+#define _GMP_REPEAT_L3_120(call, data) _GMP_REPEAT_L3_119(call, data) call(119, data)
+#define _GMP_REPEAT_L3_121(call, data) _GMP_REPEAT_L3_120(call, data) call(120, data)
+#define _GMP_REPEAT_L3_122(call, data) _GMP_REPEAT_L3_121(call, data) call(121, data)
+#define _GMP_REPEAT_L3_123(call, data) _GMP_REPEAT_L3_122(call, data) call(122, data)
+#define _GMP_REPEAT_L3_124(call, data) _GMP_REPEAT_L3_123(call, data) call(123, data)
+#define _GMP_REPEAT_L3_125(call, data) _GMP_REPEAT_L3_124(call, data) call(124, data)
+#define _GMP_REPEAT_L3_126(call, data) _GMP_REPEAT_L3_125(call, data) call(125, data)
+#define _GMP_REPEAT_L3_127(call, data) _GMP_REPEAT_L3_126(call, data) call(126, data)
+#define _GMP_REPEAT_L3_128(call, data) _GMP_REPEAT_L3_127(call, data) call(127, data)
+#define _GMP_REPEAT_L3_129(call, data) _GMP_REPEAT_L3_128(call, data) call(128, data)
+#define _GMP_REPEAT_L3_130(call, data) _GMP_REPEAT_L3_129(call, data) call(129, data)
+#define _GMP_REPEAT_L3_131(call, data) _GMP_REPEAT_L3_130(call, data) call(130, data)
+#define _GMP_REPEAT_L3_132(call, data) _GMP_REPEAT_L3_131(call, data) call(131, data)
+#define _GMP_REPEAT_L3_133(call, data) _GMP_REPEAT_L3_132(call, data) call(132, data)
+#define _GMP_REPEAT_L3_134(call, data) _GMP_REPEAT_L3_133(call, data) call(133, data)
+#define _GMP_REPEAT_L3_135(call, data) _GMP_REPEAT_L3_134(call, data) call(134, data)
+#define _GMP_REPEAT_L3_136(call, data) _GMP_REPEAT_L3_135(call, data) call(135, data)
+#define _GMP_REPEAT_L3_137(call, data) _GMP_REPEAT_L3_136(call, data) call(136, data)
+#define _GMP_REPEAT_L3_138(call, data) _GMP_REPEAT_L3_137(call, data) call(137, data)
+#define _GMP_REPEAT_L3_139(call, data) _GMP_REPEAT_L3_138(call, data) call(138, data)
+#define _GMP_REPEAT_L3_140(call, data) _GMP_REPEAT_L3_139(call, data) call(139, data)
+#define _GMP_REPEAT_L3_141(call, data) _GMP_REPEAT_L3_140(call, data) call(140, data)
+#define _GMP_REPEAT_L3_142(call, data) _GMP_REPEAT_L3_141(call, data) call(141, data)
+#define _GMP_REPEAT_L3_143(call, data) _GMP_REPEAT_L3_142(call, data) call(142, data)
+#define _GMP_REPEAT_L3_144(call, data) _GMP_REPEAT_L3_143(call, data) call(143, data)
+#define _GMP_REPEAT_L3_145(call, data) _GMP_REPEAT_L3_144(call, data) call(144, data)
+#define _GMP_REPEAT_L3_146(call, data) _GMP_REPEAT_L3_145(call, data) call(145, data)
+#define _GMP_REPEAT_L3_147(call, data) _GMP_REPEAT_L3_146(call, data) call(146, data)
+#define _GMP_REPEAT_L3_148(call, data) _GMP_REPEAT_L3_147(call, data) call(147, data)
+#define _GMP_REPEAT_L3_149(call, data) _GMP_REPEAT_L3_148(call, data) call(148, data)
+#define _GMP_REPEAT_L3_150(call, data) _GMP_REPEAT_L3_149(call, data) call(149, data)
+#define _GMP_REPEAT_L3_151(call, data) _GMP_REPEAT_L3_150(call, data) call(150, data)
+#define _GMP_REPEAT_L3_152(call, data) _GMP_REPEAT_L3_151(call, data) call(151, data)
+#define _GMP_REPEAT_L3_153(call, data) _GMP_REPEAT_L3_152(call, data) call(152, data)
+#define _GMP_REPEAT_L3_154(call, data) _GMP_REPEAT_L3_153(call, data) call(153, data)
+#define _GMP_REPEAT_L3_155(call, data) _GMP_REPEAT_L3_154(call, data) call(154, data)
+#define _GMP_REPEAT_L3_156(call, data) _GMP_REPEAT_L3_155(call, data) call(155, data)
+#define _GMP_REPEAT_L3_157(call, data) _GMP_REPEAT_L3_156(call, data) call(156, data)
+#define _GMP_REPEAT_L3_158(call, data) _GMP_REPEAT_L3_157(call, data) call(157, data)
+#define _GMP_REPEAT_L3_159(call, data) _GMP_REPEAT_L3_158(call, data) call(158, data)
+#define _GMP_REPEAT_L3_160(call, data) _GMP_REPEAT_L3_159(call, data) call(159, data)
+#define _GMP_REPEAT_L3_161(call, data) _GMP_REPEAT_L3_160(call, data) call(160, data)
+#define _GMP_REPEAT_L3_162(call, data) _GMP_REPEAT_L3_161(call, data) call(161, data)
+#define _GMP_REPEAT_L3_163(call, data) _GMP_REPEAT_L3_162(call, data) call(162, data)
+#define _GMP_REPEAT_L3_164(call, data) _GMP_REPEAT_L3_163(call, data) call(163, data)
+#define _GMP_REPEAT_L3_165(call, data) _GMP_REPEAT_L3_164(call, data) call(164, data)
+#define _GMP_REPEAT_L3_166(call, data) _GMP_REPEAT_L3_165(call, data) call(165, data)
+#define _GMP_REPEAT_L3_167(call, data) _GMP_REPEAT_L3_166(call, data) call(166, data)
+#define _GMP_REPEAT_L3_168(call, data) _GMP_REPEAT_L3_167(call, data) call(167, data)
+#define _GMP_REPEAT_L3_169(call, data) _GMP_REPEAT_L3_168(call, data) call(168, data)
+#define _GMP_REPEAT_L3_170(call, data) _GMP_REPEAT_L3_169(call, data) call(169, data)
+#define _GMP_REPEAT_L3_171(call, data) _GMP_REPEAT_L3_170(call, data) call(170, data)
+#define _GMP_REPEAT_L3_172(call, data) _GMP_REPEAT_L3_171(call, data) call(171, data)
+#define _GMP_REPEAT_L3_173(call, data) _GMP_REPEAT_L3_172(call, data) call(172, data)
+#define _GMP_REPEAT_L3_174(call, data) _GMP_REPEAT_L3_173(call, data) call(173, data)
+#define _GMP_REPEAT_L3_175(call, data) _GMP_REPEAT_L3_174(call, data) call(174, data)
+#define _GMP_REPEAT_L3_176(call, data) _GMP_REPEAT_L3_175(call, data) call(175, data)
+#define _GMP_REPEAT_L3_177(call, data) _GMP_REPEAT_L3_176(call, data) call(176, data)
+#define _GMP_REPEAT_L3_178(call, data) _GMP_REPEAT_L3_177(call, data) call(177, data)
+#define _GMP_REPEAT_L3_179(call, data) _GMP_REPEAT_L3_178(call, data) call(178, data)
+#define _GMP_REPEAT_L3_180(call, data) _GMP_REPEAT_L3_179(call, data) call(179, data)
+#define _GMP_REPEAT_L3_181(call, data) _GMP_REPEAT_L3_180(call, data) call(180, data)
+#define _GMP_REPEAT_L3_182(call, data) _GMP_REPEAT_L3_181(call, data) call(181, data)
+#define _GMP_REPEAT_L3_183(call, data) _GMP_REPEAT_L3_182(call, data) call(182, data)
+#define _GMP_REPEAT_L3_184(call, data) _GMP_REPEAT_L3_183(call, data) call(183, data)
+#define _GMP_REPEAT_L3_185(call, data) _GMP_REPEAT_L3_184(call, data) call(184, data)
+#define _GMP_REPEAT_L3_186(call, data) _GMP_REPEAT_L3_185(call, data) call(185, data)
+#define _GMP_REPEAT_L3_187(call, data) _GMP_REPEAT_L3_186(call, data) call(186, data)
+#define _GMP_REPEAT_L3_188(call, data) _GMP_REPEAT_L3_187(call, data) call(187, data)
+#define _GMP_REPEAT_L3_189(call, data) _GMP_REPEAT_L3_188(call, data) call(188, data)
+#define _GMP_REPEAT_L3_190(call, data) _GMP_REPEAT_L3_189(call, data) call(189, data)
+#define _GMP_REPEAT_L3_191(call, data) _GMP_REPEAT_L3_190(call, data) call(190, data)
+#define _GMP_REPEAT_L3_192(call, data) _GMP_REPEAT_L3_191(call, data) call(191, data)
+#define _GMP_REPEAT_L3_193(call, data) _GMP_REPEAT_L3_192(call, data) call(192, data)
+#define _GMP_REPEAT_L3_194(call, data) _GMP_REPEAT_L3_193(call, data) call(193, data)
+#define _GMP_REPEAT_L3_195(call, data) _GMP_REPEAT_L3_194(call, data) call(194, data)
+#define _GMP_REPEAT_L3_196(call, data) _GMP_REPEAT_L3_195(call, data) call(195, data)
+#define _GMP_REPEAT_L3_197(call, data) _GMP_REPEAT_L3_196(call, data) call(196, data)
+#define _GMP_REPEAT_L3_198(call, data) _GMP_REPEAT_L3_197(call, data) call(197, data)
+#define _GMP_REPEAT_L3_199(call, data) _GMP_REPEAT_L3_198(call, data) call(198, data)
+#define _GMP_REPEAT_L3_200(call, data) _GMP_REPEAT_L3_199(call, data) call(199, data)
+#define _GMP_REPEAT_L3_201(call, data) _GMP_REPEAT_L3_200(call, data) call(200, data)
+#define _GMP_REPEAT_L3_202(call, data) _GMP_REPEAT_L3_201(call, data) call(201, data)
+#define _GMP_REPEAT_L3_203(call, data) _GMP_REPEAT_L3_202(call, data) call(202, data)
+#define _GMP_REPEAT_L3_204(call, data) _GMP_REPEAT_L3_203(call, data) call(203, data)
+#define _GMP_REPEAT_L3_205(call, data) _GMP_REPEAT_L3_204(call, data) call(204, data)
+#define _GMP_REPEAT_L3_206(call, data) _GMP_REPEAT_L3_205(call, data) call(205, data)
+#define _GMP_REPEAT_L3_207(call, data) _GMP_REPEAT_L3_206(call, data) call(206, data)
+#define _GMP_REPEAT_L3_208(call, data) _GMP_REPEAT_L3_207(call, data) call(207, data)
+#define _GMP_REPEAT_L3_209(call, data) _GMP_REPEAT_L3_208(call, data) call(208, data)
+#define _GMP_REPEAT_L3_210(call, data) _GMP_REPEAT_L3_209(call, data) call(209, data)
+#define _GMP_REPEAT_L3_211(call, data) _GMP_REPEAT_L3_210(call, data) call(210, data)
+#define _GMP_REPEAT_L3_212(call, data) _GMP_REPEAT_L3_211(call, data) call(211, data)
+#define _GMP_REPEAT_L3_213(call, data) _GMP_REPEAT_L3_212(call, data) call(212, data)
+#define _GMP_REPEAT_L3_214(call, data) _GMP_REPEAT_L3_213(call, data) call(213, data)
+#define _GMP_REPEAT_L3_215(call, data) _GMP_REPEAT_L3_214(call, data) call(214, data)
+#define _GMP_REPEAT_L3_216(call, data) _GMP_REPEAT_L3_215(call, data) call(215, data)
+#define _GMP_REPEAT_L3_217(call, data) _GMP_REPEAT_L3_216(call, data) call(216, data)
+#define _GMP_REPEAT_L3_218(call, data) _GMP_REPEAT_L3_217(call, data) call(217, data)
+#define _GMP_REPEAT_L3_219(call, data) _GMP_REPEAT_L3_218(call, data) call(218, data)
+#define _GMP_REPEAT_L3_220(call, data) _GMP_REPEAT_L3_219(call, data) call(219, data)
+#define _GMP_REPEAT_L3_221(call, data) _GMP_REPEAT_L3_220(call, data) call(220, data)
+#define _GMP_REPEAT_L3_222(call, data) _GMP_REPEAT_L3_221(call, data) call(221, data)
+#define _GMP_REPEAT_L3_223(call, data) _GMP_REPEAT_L3_222(call, data) call(222, data)
+#define _GMP_REPEAT_L3_224(call, data) _GMP_REPEAT_L3_223(call, data) call(223, data)
+#define _GMP_REPEAT_L3_225(call, data) _GMP_REPEAT_L3_224(call, data) call(224, data)
+#define _GMP_REPEAT_L3_226(call, data) _GMP_REPEAT_L3_225(call, data) call(225, data)
+#define _GMP_REPEAT_L3_227(call, data) _GMP_REPEAT_L3_226(call, data) call(226, data)
+#define _GMP_REPEAT_L3_228(call, data) _GMP_REPEAT_L3_227(call, data) call(227, data)
+#define _GMP_REPEAT_L3_229(call, data) _GMP_REPEAT_L3_228(call, data) call(228, data)
+#define _GMP_REPEAT_L3_230(call, data) _GMP_REPEAT_L3_229(call, data) call(229, data)
+#define _GMP_REPEAT_L3_231(call, data) _GMP_REPEAT_L3_230(call, data) call(230, data)
+#define _GMP_REPEAT_L3_232(call, data) _GMP_REPEAT_L3_231(call, data) call(231, data)
+#define _GMP_REPEAT_L3_233(call, data) _GMP_REPEAT_L3_232(call, data) call(232, data)
+#define _GMP_REPEAT_L3_234(call, data) _GMP_REPEAT_L3_233(call, data) call(233, data)
+#define _GMP_REPEAT_L3_235(call, data) _GMP_REPEAT_L3_234(call, data) call(234, data)
+#define _GMP_REPEAT_L3_236(call, data) _GMP_REPEAT_L3_235(call, data) call(235, data)
+#define _GMP_REPEAT_L3_237(call, data) _GMP_REPEAT_L3_236(call, data) call(236, data)
+#define _GMP_REPEAT_L3_238(call, data) _GMP_REPEAT_L3_237(call, data) call(237, data)
+#define _GMP_REPEAT_L3_239(call, data) _GMP_REPEAT_L3_238(call, data) call(238, data)
+#define _GMP_REPEAT_L3_240(call, data) _GMP_REPEAT_L3_239(call, data) call(239, data)
+#define _GMP_REPEAT_L3_241(call, data) _GMP_REPEAT_L3_240(call, data) call(240, data)
+#define _GMP_REPEAT_L3_242(call, data) _GMP_REPEAT_L3_241(call, data) call(241, data)
+#define _GMP_REPEAT_L3_243(call, data) _GMP_REPEAT_L3_242(call, data) call(242, data)
+#define _GMP_REPEAT_L3_244(call, data) _GMP_REPEAT_L3_243(call, data) call(243, data)
+#define _GMP_REPEAT_L3_245(call, data) _GMP_REPEAT_L3_244(call, data) call(244, data)
+#define _GMP_REPEAT_L3_246(call, data) _GMP_REPEAT_L3_245(call, data) call(245, data)
+#define _GMP_REPEAT_L3_247(call, data) _GMP_REPEAT_L3_246(call, data) call(246, data)
+#define _GMP_REPEAT_L3_248(call, data) _GMP_REPEAT_L3_247(call, data) call(247, data)
+#define _GMP_REPEAT_L3_249(call, data) _GMP_REPEAT_L3_248(call, data) call(248, data)
+#define _GMP_REPEAT_L3_250(call, data) _GMP_REPEAT_L3_249(call, data) call(249, data)
+#define _GMP_REPEAT_L3_251(call, data) _GMP_REPEAT_L3_250(call, data) call(250, data)
+#define _GMP_REPEAT_L3_252(call, data) _GMP_REPEAT_L3_251(call, data) call(251, data)
+#define _GMP_REPEAT_L3_253(call, data) _GMP_REPEAT_L3_252(call, data) call(252, data)
+#define _GMP_REPEAT_L3_254(call, data) _GMP_REPEAT_L3_253(call, data) call(253, data)
+
+// GMP_REPEAT_FROM_3
+#define _GMP_REPEAT_FROM_L3_0(call, data, i)
+#define _GMP_REPEAT_FROM_L3_1(call, data, i) call(i, data)
+#define _GMP_REPEAT_FROM_L3_2(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_3(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_2(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_4(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_3(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_5(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_4(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_6(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_5(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_7(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_6(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_8(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_7(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_9(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_8(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_10(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_9(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_11(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_10(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_12(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_11(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_13(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_12(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_14(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_13(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_15(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_14(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_16(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_15(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_17(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_16(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_18(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_17(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_19(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_18(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_20(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_19(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_21(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_20(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_22(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_21(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_23(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_22(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_24(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_23(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_25(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_24(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_26(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_25(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_27(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_26(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_28(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_27(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_29(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_28(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_30(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_29(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_31(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_30(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_32(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_31(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_33(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_32(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_34(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_33(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_35(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_34(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_36(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_35(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_37(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_36(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_38(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_37(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_39(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_38(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_40(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_39(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_41(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_40(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_42(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_41(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_43(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_42(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_44(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_43(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_45(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_44(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_46(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_45(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_47(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_46(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_48(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_47(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_49(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_48(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_50(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_49(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_51(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_50(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_52(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_51(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_53(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_52(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_54(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_53(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_55(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_54(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_56(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_55(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_57(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_56(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_58(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_57(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_59(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_58(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_60(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_59(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_61(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_60(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_62(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_61(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_63(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_62(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_64(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_63(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_65(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_64(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_66(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_65(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_67(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_66(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_68(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_67(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_69(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_68(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_70(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_69(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_71(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_70(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_72(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_71(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_73(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_72(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_74(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_73(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_75(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_74(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_76(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_75(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_77(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_76(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_78(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_77(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_79(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_78(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_80(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_79(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_81(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_80(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_82(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_81(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_83(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_82(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_84(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_83(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_85(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_84(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_86(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_85(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_87(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_86(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_88(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_87(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_89(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_88(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_90(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_89(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_91(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_90(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_92(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_91(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_93(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_92(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_94(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_93(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_95(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_94(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_96(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_95(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_97(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_96(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_98(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_97(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_99(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_98(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_100(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_99(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_101(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_100(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_102(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_101(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_103(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_102(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_104(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_103(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_105(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_104(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_106(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_105(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_107(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_106(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_108(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_107(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_109(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_108(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_110(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_109(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_111(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_110(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_112(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_111(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_113(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_112(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_114(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_113(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_115(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_114(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_116(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_115(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_117(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_116(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_118(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_117(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_119(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_118(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_120(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_119(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_121(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_120(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_122(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_121(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_123(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_122(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_124(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_123(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_125(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_124(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_126(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_125(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_127(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_126(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_128(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_127(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_129(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_128(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_130(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_129(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_131(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_130(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_132(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_131(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_133(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_132(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_134(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_133(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_135(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_134(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_136(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_135(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_137(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_136(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_138(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_137(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_139(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_138(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_140(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_139(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_141(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_140(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_142(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_141(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_143(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_142(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_144(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_143(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_145(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_144(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_146(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_145(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_147(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_146(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_148(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_147(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_149(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_148(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_150(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_149(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_151(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_150(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_152(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_151(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_153(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_152(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_154(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_153(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_155(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_154(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_156(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_155(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_157(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_156(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_158(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_157(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_159(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_158(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_160(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_159(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_161(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_160(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_162(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_161(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_163(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_162(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_164(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_163(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_165(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_164(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_166(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_165(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_167(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_166(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_168(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_167(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_169(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_168(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_170(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_169(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_171(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_170(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_172(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_171(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_173(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_172(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_174(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_173(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_175(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_174(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_176(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_175(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_177(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_176(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_178(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_177(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_179(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_178(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_180(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_179(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_181(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_180(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_182(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_181(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_183(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_182(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_184(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_183(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_185(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_184(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_186(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_185(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_187(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_186(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_188(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_187(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_189(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_188(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_190(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_189(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_191(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_190(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_192(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_191(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_193(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_192(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_194(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_193(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_195(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_194(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_196(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_195(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_197(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_196(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_198(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_197(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_199(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_198(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_200(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_199(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_201(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_200(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_202(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_201(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_203(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_202(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_204(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_203(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_205(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_204(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_206(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_205(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_207(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_206(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_208(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_207(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_209(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_208(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_210(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_209(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_211(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_210(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_212(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_211(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_213(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_212(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_214(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_213(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_215(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_214(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_216(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_215(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_217(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_216(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_218(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_217(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_219(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_218(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_220(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_219(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_221(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_220(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_222(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_221(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_223(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_222(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_224(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_223(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_225(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_224(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_226(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_225(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_227(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_226(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_228(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_227(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_229(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_228(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_230(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_229(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_231(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_230(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_232(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_231(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_233(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_232(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_234(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_233(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_235(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_234(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_236(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_235(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_237(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_236(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_238(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_237(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_239(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_238(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_240(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_239(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_241(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_240(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_242(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_241(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_243(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_242(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_244(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_243(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_245(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_244(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_246(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_245(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_247(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_246(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_248(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_247(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_249(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_248(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_250(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_249(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_251(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_250(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_252(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_251(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_253(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_252(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_254(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_253(call, data, GMP_CONCAT(_GMP_INC_, i)())
+
+#endif // GMP_MACRO_LIMITS_LOOP_NESTED_254_HPP_
@@ -0,0 +1,408 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_LOOP_NESTED_64_HPP_
+#define GMP_MACRO_LIMITS_LOOP_NESTED_64_HPP_
+
+// GMP_LOOP_2
+#define _GMP_LOOP_L2_0(call, ...)
+#define _GMP_LOOP_L2_1(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_0(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_2(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_1(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_3(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_2(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_4(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_3(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_5(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_4(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_6(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_5(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_7(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_6(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_8(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_7(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_9(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_8(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_10(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_9(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_11(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_10(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_12(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_11(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_13(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_12(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_14(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_13(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_15(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_14(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_16(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_15(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_17(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_16(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_18(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_17(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_19(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_18(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_20(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_19(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_21(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_20(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_22(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_21(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_23(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_22(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_24(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_23(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_25(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_24(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_26(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_25(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_27(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_26(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_28(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_27(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_29(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_28(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_30(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_29(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_31(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_30(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_32(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_31(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_33(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_32(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_34(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_33(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_35(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_34(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_36(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_35(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_37(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_36(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_38(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_37(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_39(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_38(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_40(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_39(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_41(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_40(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_42(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_41(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_43(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_42(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_44(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_43(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_45(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_44(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_46(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_45(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_47(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_46(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_48(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_47(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_49(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_48(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_50(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_49(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_51(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_50(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_52(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_51(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_53(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_52(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_54(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_53(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_55(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_54(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_56(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_55(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_57(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_56(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_58(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_57(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_59(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_58(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_60(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_59(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_61(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_60(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_62(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_61(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_63(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_62(call, __VA_ARGS__)
+#define _GMP_LOOP_L2_64(call, ...) call(__VA_ARGS__) _GMP_LOOP_L2_63(call, __VA_ARGS__)
+
+// GMP_REPEAT_2
+#define _GMP_REPEAT_L2_0(call, data)
+#define _GMP_REPEAT_L2_1(call, data) _GMP_REPEAT_L2_0(call, data) call(0, data)
+#define _GMP_REPEAT_L2_2(call, data) _GMP_REPEAT_L2_1(call, data) call(1, data)
+#define _GMP_REPEAT_L2_3(call, data) _GMP_REPEAT_L2_2(call, data) call(2, data)
+#define _GMP_REPEAT_L2_4(call, data) _GMP_REPEAT_L2_3(call, data) call(3, data)
+#define _GMP_REPEAT_L2_5(call, data) _GMP_REPEAT_L2_4(call, data) call(4, data)
+#define _GMP_REPEAT_L2_6(call, data) _GMP_REPEAT_L2_5(call, data) call(5, data)
+#define _GMP_REPEAT_L2_7(call, data) _GMP_REPEAT_L2_6(call, data) call(6, data)
+#define _GMP_REPEAT_L2_8(call, data) _GMP_REPEAT_L2_7(call, data) call(7, data)
+#define _GMP_REPEAT_L2_9(call, data) _GMP_REPEAT_L2_8(call, data) call(8, data)
+#define _GMP_REPEAT_L2_10(call, data) _GMP_REPEAT_L2_9(call, data) call(9, data)
+#define _GMP_REPEAT_L2_11(call, data) _GMP_REPEAT_L2_10(call, data) call(10, data)
+#define _GMP_REPEAT_L2_12(call, data) _GMP_REPEAT_L2_11(call, data) call(11, data)
+#define _GMP_REPEAT_L2_13(call, data) _GMP_REPEAT_L2_12(call, data) call(12, data)
+#define _GMP_REPEAT_L2_14(call, data) _GMP_REPEAT_L2_13(call, data) call(13, data)
+#define _GMP_REPEAT_L2_15(call, data) _GMP_REPEAT_L2_14(call, data) call(14, data)
+#define _GMP_REPEAT_L2_16(call, data) _GMP_REPEAT_L2_15(call, data) call(15, data)
+#define _GMP_REPEAT_L2_17(call, data) _GMP_REPEAT_L2_16(call, data) call(16, data)
+#define _GMP_REPEAT_L2_18(call, data) _GMP_REPEAT_L2_17(call, data) call(17, data)
+#define _GMP_REPEAT_L2_19(call, data) _GMP_REPEAT_L2_18(call, data) call(18, data)
+#define _GMP_REPEAT_L2_20(call, data) _GMP_REPEAT_L2_19(call, data) call(19, data)
+#define _GMP_REPEAT_L2_21(call, data) _GMP_REPEAT_L2_20(call, data) call(20, data)
+#define _GMP_REPEAT_L2_22(call, data) _GMP_REPEAT_L2_21(call, data) call(21, data)
+#define _GMP_REPEAT_L2_23(call, data) _GMP_REPEAT_L2_22(call, data) call(22, data)
+#define _GMP_REPEAT_L2_24(call, data) _GMP_REPEAT_L2_23(call, data) call(23, data)
+#define _GMP_REPEAT_L2_25(call, data) _GMP_REPEAT_L2_24(call, data) call(24, data)
+#define _GMP_REPEAT_L2_26(call, data) _GMP_REPEAT_L2_25(call, data) call(25, data)
+#define _GMP_REPEAT_L2_27(call, data) _GMP_REPEAT_L2_26(call, data) call(26, data)
+#define _GMP_REPEAT_L2_28(call, data) _GMP_REPEAT_L2_27(call, data) call(27, data)
+#define _GMP_REPEAT_L2_29(call, data) _GMP_REPEAT_L2_28(call, data) call(28, data)
+#define _GMP_REPEAT_L2_30(call, data) _GMP_REPEAT_L2_29(call, data) call(29, data)
+#define _GMP_REPEAT_L2_31(call, data) _GMP_REPEAT_L2_30(call, data) call(30, data)
+#define _GMP_REPEAT_L2_32(call, data) _GMP_REPEAT_L2_31(call, data) call(31, data)
+#define _GMP_REPEAT_L2_33(call, data) _GMP_REPEAT_L2_32(call, data) call(32, data)
+#define _GMP_REPEAT_L2_34(call, data) _GMP_REPEAT_L2_33(call, data) call(33, data)
+#define _GMP_REPEAT_L2_35(call, data) _GMP_REPEAT_L2_34(call, data) call(34, data)
+#define _GMP_REPEAT_L2_36(call, data) _GMP_REPEAT_L2_35(call, data) call(35, data)
+#define _GMP_REPEAT_L2_37(call, data) _GMP_REPEAT_L2_36(call, data) call(36, data)
+#define _GMP_REPEAT_L2_38(call, data) _GMP_REPEAT_L2_37(call, data) call(37, data)
+#define _GMP_REPEAT_L2_39(call, data) _GMP_REPEAT_L2_38(call, data) call(38, data)
+#define _GMP_REPEAT_L2_40(call, data) _GMP_REPEAT_L2_39(call, data) call(39, data)
+#define _GMP_REPEAT_L2_41(call, data) _GMP_REPEAT_L2_40(call, data) call(40, data)
+#define _GMP_REPEAT_L2_42(call, data) _GMP_REPEAT_L2_41(call, data) call(41, data)
+#define _GMP_REPEAT_L2_43(call, data) _GMP_REPEAT_L2_42(call, data) call(42, data)
+#define _GMP_REPEAT_L2_44(call, data) _GMP_REPEAT_L2_43(call, data) call(43, data)
+#define _GMP_REPEAT_L2_45(call, data) _GMP_REPEAT_L2_44(call, data) call(44, data)
+#define _GMP_REPEAT_L2_46(call, data) _GMP_REPEAT_L2_45(call, data) call(45, data)
+#define _GMP_REPEAT_L2_47(call, data) _GMP_REPEAT_L2_46(call, data) call(46, data)
+#define _GMP_REPEAT_L2_48(call, data) _GMP_REPEAT_L2_47(call, data) call(47, data)
+#define _GMP_REPEAT_L2_49(call, data) _GMP_REPEAT_L2_48(call, data) call(48, data)
+#define _GMP_REPEAT_L2_50(call, data) _GMP_REPEAT_L2_49(call, data) call(49, data)
+#define _GMP_REPEAT_L2_51(call, data) _GMP_REPEAT_L2_50(call, data) call(50, data)
+#define _GMP_REPEAT_L2_52(call, data) _GMP_REPEAT_L2_51(call, data) call(51, data)
+#define _GMP_REPEAT_L2_53(call, data) _GMP_REPEAT_L2_52(call, data) call(52, data)
+#define _GMP_REPEAT_L2_54(call, data) _GMP_REPEAT_L2_53(call, data) call(53, data)
+#define _GMP_REPEAT_L2_55(call, data) _GMP_REPEAT_L2_54(call, data) call(54, data)
+#define _GMP_REPEAT_L2_56(call, data) _GMP_REPEAT_L2_55(call, data) call(55, data)
+#define _GMP_REPEAT_L2_57(call, data) _GMP_REPEAT_L2_56(call, data) call(56, data)
+#define _GMP_REPEAT_L2_58(call, data) _GMP_REPEAT_L2_57(call, data) call(57, data)
+#define _GMP_REPEAT_L2_59(call, data) _GMP_REPEAT_L2_58(call, data) call(58, data)
+#define _GMP_REPEAT_L2_60(call, data) _GMP_REPEAT_L2_59(call, data) call(59, data)
+#define _GMP_REPEAT_L2_61(call, data) _GMP_REPEAT_L2_60(call, data) call(60, data)
+#define _GMP_REPEAT_L2_62(call, data) _GMP_REPEAT_L2_61(call, data) call(61, data)
+#define _GMP_REPEAT_L2_63(call, data) _GMP_REPEAT_L2_62(call, data) call(62, data)
+#define _GMP_REPEAT_L2_64(call, data) _GMP_REPEAT_L2_63(call, data) call(63, data)
+
+// GMP_REPEAT_FROM_2
+#define _GMP_REPEAT_FROM_L2_0(call, data, i)
+#define _GMP_REPEAT_FROM_L2_1(call, data, i) call(i, data)
+#define _GMP_REPEAT_FROM_L2_2(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_1(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_3(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_2(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_4(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_3(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_5(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_4(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_6(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_5(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_7(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_6(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_8(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_7(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_9(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_8(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_10(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_9(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_11(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_10(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_12(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_11(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_13(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_12(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_14(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_13(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_15(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_14(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_16(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_15(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_17(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_16(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_18(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_17(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_19(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_18(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_20(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_19(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_21(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_20(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_22(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_21(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_23(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_22(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_24(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_23(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_25(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_24(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_26(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_25(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_27(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_26(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_28(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_27(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_29(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_28(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_30(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_29(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_31(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_30(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_32(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_31(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_33(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_32(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_34(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_33(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_35(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_34(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_36(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_35(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_37(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_36(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_38(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_37(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_39(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_38(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_40(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_39(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_41(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_40(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_42(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_41(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_43(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_42(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_44(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_43(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_45(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_44(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_46(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_45(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_47(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_46(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_48(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_47(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_49(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_48(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_50(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_49(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_51(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_50(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_52(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_51(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_53(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_52(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_54(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_53(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_55(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_54(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_56(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_55(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_57(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_56(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_58(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_57(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_59(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_58(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_60(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_59(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_61(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_60(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_62(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_61(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_63(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_62(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L2_64(call, data, i) call(i, data) _GMP_REPEAT_FROM_L2_63(call, data, GMP_CONCAT(_GMP_INC_, i)())
+
+// GMP_LOOP_3
+#define _GMP_LOOP_L3_0(call, ...)
+#define _GMP_LOOP_L3_1(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_0(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_2(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_1(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_3(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_2(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_4(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_3(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_5(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_4(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_6(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_5(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_7(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_6(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_8(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_7(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_9(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_8(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_10(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_9(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_11(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_10(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_12(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_11(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_13(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_12(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_14(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_13(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_15(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_14(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_16(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_15(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_17(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_16(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_18(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_17(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_19(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_18(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_20(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_19(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_21(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_20(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_22(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_21(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_23(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_22(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_24(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_23(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_25(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_24(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_26(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_25(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_27(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_26(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_28(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_27(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_29(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_28(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_30(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_29(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_31(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_30(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_32(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_31(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_33(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_32(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_34(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_33(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_35(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_34(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_36(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_35(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_37(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_36(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_38(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_37(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_39(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_38(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_40(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_39(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_41(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_40(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_42(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_41(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_43(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_42(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_44(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_43(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_45(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_44(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_46(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_45(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_47(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_46(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_48(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_47(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_49(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_48(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_50(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_49(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_51(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_50(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_52(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_51(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_53(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_52(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_54(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_53(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_55(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_54(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_56(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_55(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_57(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_56(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_58(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_57(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_59(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_58(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_60(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_59(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_61(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_60(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_62(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_61(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_63(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_62(call, __VA_ARGS__)
+#define _GMP_LOOP_L3_64(call, ...) call(__VA_ARGS__) _GMP_LOOP_L3_63(call, __VA_ARGS__)
+
+// GMP_REPEAT_3
+#define _GMP_REPEAT_L3_0(call, data)
+#define _GMP_REPEAT_L3_1(call, data) _GMP_REPEAT_L3_0(call, data) call(0, data)
+#define _GMP_REPEAT_L3_2(call, data) _GMP_REPEAT_L3_1(call, data) call(1, data)
+#define _GMP_REPEAT_L3_3(call, data) _GMP_REPEAT_L3_2(call, data) call(2, data)
+#define _GMP_REPEAT_L3_4(call, data) _GMP_REPEAT_L3_3(call, data) call(3, data)
+#define _GMP_REPEAT_L3_5(call, data) _GMP_REPEAT_L3_4(call, data) call(4, data)
+#define _GMP_REPEAT_L3_6(call, data) _GMP_REPEAT_L3_5(call, data) call(5, data)
+#define _GMP_REPEAT_L3_7(call, data) _GMP_REPEAT_L3_6(call, data) call(6, data)
+#define _GMP_REPEAT_L3_8(call, data) _GMP_REPEAT_L3_7(call, data) call(7, data)
+#define _GMP_REPEAT_L3_9(call, data) _GMP_REPEAT_L3_8(call, data) call(8, data)
+#define _GMP_REPEAT_L3_10(call, data) _GMP_REPEAT_L3_9(call, data) call(9, data)
+#define _GMP_REPEAT_L3_11(call, data) _GMP_REPEAT_L3_10(call, data) call(10, data)
+#define _GMP_REPEAT_L3_12(call, data) _GMP_REPEAT_L3_11(call, data) call(11, data)
+#define _GMP_REPEAT_L3_13(call, data) _GMP_REPEAT_L3_12(call, data) call(12, data)
+#define _GMP_REPEAT_L3_14(call, data) _GMP_REPEAT_L3_13(call, data) call(13, data)
+#define _GMP_REPEAT_L3_15(call, data) _GMP_REPEAT_L3_14(call, data) call(14, data)
+#define _GMP_REPEAT_L3_16(call, data) _GMP_REPEAT_L3_15(call, data) call(15, data)
+#define _GMP_REPEAT_L3_17(call, data) _GMP_REPEAT_L3_16(call, data) call(16, data)
+#define _GMP_REPEAT_L3_18(call, data) _GMP_REPEAT_L3_17(call, data) call(17, data)
+#define _GMP_REPEAT_L3_19(call, data) _GMP_REPEAT_L3_18(call, data) call(18, data)
+#define _GMP_REPEAT_L3_20(call, data) _GMP_REPEAT_L3_19(call, data) call(19, data)
+#define _GMP_REPEAT_L3_21(call, data) _GMP_REPEAT_L3_20(call, data) call(20, data)
+#define _GMP_REPEAT_L3_22(call, data) _GMP_REPEAT_L3_21(call, data) call(21, data)
+#define _GMP_REPEAT_L3_23(call, data) _GMP_REPEAT_L3_22(call, data) call(22, data)
+#define _GMP_REPEAT_L3_24(call, data) _GMP_REPEAT_L3_23(call, data) call(23, data)
+#define _GMP_REPEAT_L3_25(call, data) _GMP_REPEAT_L3_24(call, data) call(24, data)
+#define _GMP_REPEAT_L3_26(call, data) _GMP_REPEAT_L3_25(call, data) call(25, data)
+#define _GMP_REPEAT_L3_27(call, data) _GMP_REPEAT_L3_26(call, data) call(26, data)
+#define _GMP_REPEAT_L3_28(call, data) _GMP_REPEAT_L3_27(call, data) call(27, data)
+#define _GMP_REPEAT_L3_29(call, data) _GMP_REPEAT_L3_28(call, data) call(28, data)
+#define _GMP_REPEAT_L3_30(call, data) _GMP_REPEAT_L3_29(call, data) call(29, data)
+#define _GMP_REPEAT_L3_31(call, data) _GMP_REPEAT_L3_30(call, data) call(30, data)
+#define _GMP_REPEAT_L3_32(call, data) _GMP_REPEAT_L3_31(call, data) call(31, data)
+#define _GMP_REPEAT_L3_33(call, data) _GMP_REPEAT_L3_32(call, data) call(32, data)
+#define _GMP_REPEAT_L3_34(call, data) _GMP_REPEAT_L3_33(call, data) call(33, data)
+#define _GMP_REPEAT_L3_35(call, data) _GMP_REPEAT_L3_34(call, data) call(34, data)
+#define _GMP_REPEAT_L3_36(call, data) _GMP_REPEAT_L3_35(call, data) call(35, data)
+#define _GMP_REPEAT_L3_37(call, data) _GMP_REPEAT_L3_36(call, data) call(36, data)
+#define _GMP_REPEAT_L3_38(call, data) _GMP_REPEAT_L3_37(call, data) call(37, data)
+#define _GMP_REPEAT_L3_39(call, data) _GMP_REPEAT_L3_38(call, data) call(38, data)
+#define _GMP_REPEAT_L3_40(call, data) _GMP_REPEAT_L3_39(call, data) call(39, data)
+#define _GMP_REPEAT_L3_41(call, data) _GMP_REPEAT_L3_40(call, data) call(40, data)
+#define _GMP_REPEAT_L3_42(call, data) _GMP_REPEAT_L3_41(call, data) call(41, data)
+#define _GMP_REPEAT_L3_43(call, data) _GMP_REPEAT_L3_42(call, data) call(42, data)
+#define _GMP_REPEAT_L3_44(call, data) _GMP_REPEAT_L3_43(call, data) call(43, data)
+#define _GMP_REPEAT_L3_45(call, data) _GMP_REPEAT_L3_44(call, data) call(44, data)
+#define _GMP_REPEAT_L3_46(call, data) _GMP_REPEAT_L3_45(call, data) call(45, data)
+#define _GMP_REPEAT_L3_47(call, data) _GMP_REPEAT_L3_46(call, data) call(46, data)
+#define _GMP_REPEAT_L3_48(call, data) _GMP_REPEAT_L3_47(call, data) call(47, data)
+#define _GMP_REPEAT_L3_49(call, data) _GMP_REPEAT_L3_48(call, data) call(48, data)
+#define _GMP_REPEAT_L3_50(call, data) _GMP_REPEAT_L3_49(call, data) call(49, data)
+#define _GMP_REPEAT_L3_51(call, data) _GMP_REPEAT_L3_50(call, data) call(50, data)
+#define _GMP_REPEAT_L3_52(call, data) _GMP_REPEAT_L3_51(call, data) call(51, data)
+#define _GMP_REPEAT_L3_53(call, data) _GMP_REPEAT_L3_52(call, data) call(52, data)
+#define _GMP_REPEAT_L3_54(call, data) _GMP_REPEAT_L3_53(call, data) call(53, data)
+#define _GMP_REPEAT_L3_55(call, data) _GMP_REPEAT_L3_54(call, data) call(54, data)
+#define _GMP_REPEAT_L3_56(call, data) _GMP_REPEAT_L3_55(call, data) call(55, data)
+#define _GMP_REPEAT_L3_57(call, data) _GMP_REPEAT_L3_56(call, data) call(56, data)
+#define _GMP_REPEAT_L3_58(call, data) _GMP_REPEAT_L3_57(call, data) call(57, data)
+#define _GMP_REPEAT_L3_59(call, data) _GMP_REPEAT_L3_58(call, data) call(58, data)
+#define _GMP_REPEAT_L3_60(call, data) _GMP_REPEAT_L3_59(call, data) call(59, data)
+#define _GMP_REPEAT_L3_61(call, data) _GMP_REPEAT_L3_60(call, data) call(60, data)
+#define _GMP_REPEAT_L3_62(call, data) _GMP_REPEAT_L3_61(call, data) call(61, data)
+#define _GMP_REPEAT_L3_63(call, data) _GMP_REPEAT_L3_62(call, data) call(62, data)
+#define _GMP_REPEAT_L3_64(call, data) _GMP_REPEAT_L3_63(call, data) call(63, data)
+
+// GMP_REPEAT_FROM_3
+#define _GMP_REPEAT_FROM_L3_0(call, data, i)
+#define _GMP_REPEAT_FROM_L3_1(call, data, i) call(i, data)
+#define _GMP_REPEAT_FROM_L3_2(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_1(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_3(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_2(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_4(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_3(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_5(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_4(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_6(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_5(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_7(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_6(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_8(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_7(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_9(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_8(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_10(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_9(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_11(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_10(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_12(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_11(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_13(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_12(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_14(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_13(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_15(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_14(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_16(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_15(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_17(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_16(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_18(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_17(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_19(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_18(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_20(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_19(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_21(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_20(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_22(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_21(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_23(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_22(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_24(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_23(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_25(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_24(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_26(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_25(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_27(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_26(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_28(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_27(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_29(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_28(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_30(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_29(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_31(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_30(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_32(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_31(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_33(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_32(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_34(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_33(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_35(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_34(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_36(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_35(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_37(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_36(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_38(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_37(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_39(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_38(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_40(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_39(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_41(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_40(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_42(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_41(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_43(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_42(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_44(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_43(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_45(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_44(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_46(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_45(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_47(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_46(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_48(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_47(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_49(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_48(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_50(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_49(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_51(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_50(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_52(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_51(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_53(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_52(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_54(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_53(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_55(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_54(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_56(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_55(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_57(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_56(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_58(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_57(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_59(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_58(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_60(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_59(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_61(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_60(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_62(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_61(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_63(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_62(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_L3_64(call, data, i) call(i, data) _GMP_REPEAT_FROM_L3_63(call, data, GMP_CONCAT(_GMP_INC_, i)())
+
+#endif // GMP_MACRO_LIMITS_LOOP_NESTED_64_HPP_
@@ -0,0 +1,1033 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_NUMBER_1024_HPP_
+#define GMP_MACRO_LIMITS_NUMBER_1024_HPP_
+
+// GMP_NUMBER_FROM_INT
+#define _GMP_NUMBER_FROM_INT_0 (0, 0, 0, 0)
+#define _GMP_NUMBER_FROM_INT_1 (0, 0, 0, 1)
+#define _GMP_NUMBER_FROM_INT_2 (0, 0, 0, 2)
+#define _GMP_NUMBER_FROM_INT_3 (0, 0, 0, 3)
+#define _GMP_NUMBER_FROM_INT_4 (0, 0, 0, 4)
+#define _GMP_NUMBER_FROM_INT_5 (0, 0, 0, 5)
+#define _GMP_NUMBER_FROM_INT_6 (0, 0, 0, 6)
+#define _GMP_NUMBER_FROM_INT_7 (0, 0, 0, 7)
+#define _GMP_NUMBER_FROM_INT_8 (0, 0, 0, 8)
+#define _GMP_NUMBER_FROM_INT_9 (0, 0, 0, 9)
+#define _GMP_NUMBER_FROM_INT_10 (0, 0, 1, 0)
+#define _GMP_NUMBER_FROM_INT_11 (0, 0, 1, 1)
+#define _GMP_NUMBER_FROM_INT_12 (0, 0, 1, 2)
+#define _GMP_NUMBER_FROM_INT_13 (0, 0, 1, 3)
+#define _GMP_NUMBER_FROM_INT_14 (0, 0, 1, 4)
+#define _GMP_NUMBER_FROM_INT_15 (0, 0, 1, 5)
+#define _GMP_NUMBER_FROM_INT_16 (0, 0, 1, 6)
+#define _GMP_NUMBER_FROM_INT_17 (0, 0, 1, 7)
+#define _GMP_NUMBER_FROM_INT_18 (0, 0, 1, 8)
+#define _GMP_NUMBER_FROM_INT_19 (0, 0, 1, 9)
+#define _GMP_NUMBER_FROM_INT_20 (0, 0, 2, 0)
+#define _GMP_NUMBER_FROM_INT_21 (0, 0, 2, 1)
+#define _GMP_NUMBER_FROM_INT_22 (0, 0, 2, 2)
+#define _GMP_NUMBER_FROM_INT_23 (0, 0, 2, 3)
+#define _GMP_NUMBER_FROM_INT_24 (0, 0, 2, 4)
+#define _GMP_NUMBER_FROM_INT_25 (0, 0, 2, 5)
+#define _GMP_NUMBER_FROM_INT_26 (0, 0, 2, 6)
+#define _GMP_NUMBER_FROM_INT_27 (0, 0, 2, 7)
+#define _GMP_NUMBER_FROM_INT_28 (0, 0, 2, 8)
+#define _GMP_NUMBER_FROM_INT_29 (0, 0, 2, 9)
+#define _GMP_NUMBER_FROM_INT_30 (0, 0, 3, 0)
+#define _GMP_NUMBER_FROM_INT_31 (0, 0, 3, 1)
+#define _GMP_NUMBER_FROM_INT_32 (0, 0, 3, 2)
+#define _GMP_NUMBER_FROM_INT_33 (0, 0, 3, 3)
+#define _GMP_NUMBER_FROM_INT_34 (0, 0, 3, 4)
+#define _GMP_NUMBER_FROM_INT_35 (0, 0, 3, 5)
+#define _GMP_NUMBER_FROM_INT_36 (0, 0, 3, 6)
+#define _GMP_NUMBER_FROM_INT_37 (0, 0, 3, 7)
+#define _GMP_NUMBER_FROM_INT_38 (0, 0, 3, 8)
+#define _GMP_NUMBER_FROM_INT_39 (0, 0, 3, 9)
+#define _GMP_NUMBER_FROM_INT_40 (0, 0, 4, 0)
+#define _GMP_NUMBER_FROM_INT_41 (0, 0, 4, 1)
+#define _GMP_NUMBER_FROM_INT_42 (0, 0, 4, 2)
+#define _GMP_NUMBER_FROM_INT_43 (0, 0, 4, 3)
+#define _GMP_NUMBER_FROM_INT_44 (0, 0, 4, 4)
+#define _GMP_NUMBER_FROM_INT_45 (0, 0, 4, 5)
+#define _GMP_NUMBER_FROM_INT_46 (0, 0, 4, 6)
+#define _GMP_NUMBER_FROM_INT_47 (0, 0, 4, 7)
+#define _GMP_NUMBER_FROM_INT_48 (0, 0, 4, 8)
+#define _GMP_NUMBER_FROM_INT_49 (0, 0, 4, 9)
+#define _GMP_NUMBER_FROM_INT_50 (0, 0, 5, 0)
+#define _GMP_NUMBER_FROM_INT_51 (0, 0, 5, 1)
+#define _GMP_NUMBER_FROM_INT_52 (0, 0, 5, 2)
+#define _GMP_NUMBER_FROM_INT_53 (0, 0, 5, 3)
+#define _GMP_NUMBER_FROM_INT_54 (0, 0, 5, 4)
+#define _GMP_NUMBER_FROM_INT_55 (0, 0, 5, 5)
+#define _GMP_NUMBER_FROM_INT_56 (0, 0, 5, 6)
+#define _GMP_NUMBER_FROM_INT_57 (0, 0, 5, 7)
+#define _GMP_NUMBER_FROM_INT_58 (0, 0, 5, 8)
+#define _GMP_NUMBER_FROM_INT_59 (0, 0, 5, 9)
+#define _GMP_NUMBER_FROM_INT_60 (0, 0, 6, 0)
+#define _GMP_NUMBER_FROM_INT_61 (0, 0, 6, 1)
+#define _GMP_NUMBER_FROM_INT_62 (0, 0, 6, 2)
+#define _GMP_NUMBER_FROM_INT_63 (0, 0, 6, 3)
+#define _GMP_NUMBER_FROM_INT_64 (0, 0, 6, 4)
+#define _GMP_NUMBER_FROM_INT_65 (0, 0, 6, 5)
+#define _GMP_NUMBER_FROM_INT_66 (0, 0, 6, 6)
+#define _GMP_NUMBER_FROM_INT_67 (0, 0, 6, 7)
+#define _GMP_NUMBER_FROM_INT_68 (0, 0, 6, 8)
+#define _GMP_NUMBER_FROM_INT_69 (0, 0, 6, 9)
+#define _GMP_NUMBER_FROM_INT_70 (0, 0, 7, 0)
+#define _GMP_NUMBER_FROM_INT_71 (0, 0, 7, 1)
+#define _GMP_NUMBER_FROM_INT_72 (0, 0, 7, 2)
+#define _GMP_NUMBER_FROM_INT_73 (0, 0, 7, 3)
+#define _GMP_NUMBER_FROM_INT_74 (0, 0, 7, 4)
+#define _GMP_NUMBER_FROM_INT_75 (0, 0, 7, 5)
+#define _GMP_NUMBER_FROM_INT_76 (0, 0, 7, 6)
+#define _GMP_NUMBER_FROM_INT_77 (0, 0, 7, 7)
+#define _GMP_NUMBER_FROM_INT_78 (0, 0, 7, 8)
+#define _GMP_NUMBER_FROM_INT_79 (0, 0, 7, 9)
+#define _GMP_NUMBER_FROM_INT_80 (0, 0, 8, 0)
+#define _GMP_NUMBER_FROM_INT_81 (0, 0, 8, 1)
+#define _GMP_NUMBER_FROM_INT_82 (0, 0, 8, 2)
+#define _GMP_NUMBER_FROM_INT_83 (0, 0, 8, 3)
+#define _GMP_NUMBER_FROM_INT_84 (0, 0, 8, 4)
+#define _GMP_NUMBER_FROM_INT_85 (0, 0, 8, 5)
+#define _GMP_NUMBER_FROM_INT_86 (0, 0, 8, 6)
+#define _GMP_NUMBER_FROM_INT_87 (0, 0, 8, 7)
+#define _GMP_NUMBER_FROM_INT_88 (0, 0, 8, 8)
+#define _GMP_NUMBER_FROM_INT_89 (0, 0, 8, 9)
+#define _GMP_NUMBER_FROM_INT_90 (0, 0, 9, 0)
+#define _GMP_NUMBER_FROM_INT_91 (0, 0, 9, 1)
+#define _GMP_NUMBER_FROM_INT_92 (0, 0, 9, 2)
+#define _GMP_NUMBER_FROM_INT_93 (0, 0, 9, 3)
+#define _GMP_NUMBER_FROM_INT_94 (0, 0, 9, 4)
+#define _GMP_NUMBER_FROM_INT_95 (0, 0, 9, 5)
+#define _GMP_NUMBER_FROM_INT_96 (0, 0, 9, 6)
+#define _GMP_NUMBER_FROM_INT_97 (0, 0, 9, 7)
+#define _GMP_NUMBER_FROM_INT_98 (0, 0, 9, 8)
+#define _GMP_NUMBER_FROM_INT_99 (0, 0, 9, 9)
+#define _GMP_NUMBER_FROM_INT_100 (0, 1, 0, 0)
+#define _GMP_NUMBER_FROM_INT_101 (0, 1, 0, 1)
+#define _GMP_NUMBER_FROM_INT_102 (0, 1, 0, 2)
+#define _GMP_NUMBER_FROM_INT_103 (0, 1, 0, 3)
+#define _GMP_NUMBER_FROM_INT_104 (0, 1, 0, 4)
+#define _GMP_NUMBER_FROM_INT_105 (0, 1, 0, 5)
+#define _GMP_NUMBER_FROM_INT_106 (0, 1, 0, 6)
+#define _GMP_NUMBER_FROM_INT_107 (0, 1, 0, 7)
+#define _GMP_NUMBER_FROM_INT_108 (0, 1, 0, 8)
+#define _GMP_NUMBER_FROM_INT_109 (0, 1, 0, 9)
+#define _GMP_NUMBER_FROM_INT_110 (0, 1, 1, 0)
+#define _GMP_NUMBER_FROM_INT_111 (0, 1, 1, 1)
+#define _GMP_NUMBER_FROM_INT_112 (0, 1, 1, 2)
+#define _GMP_NUMBER_FROM_INT_113 (0, 1, 1, 3)
+#define _GMP_NUMBER_FROM_INT_114 (0, 1, 1, 4)
+#define _GMP_NUMBER_FROM_INT_115 (0, 1, 1, 5)
+#define _GMP_NUMBER_FROM_INT_116 (0, 1, 1, 6)
+#define _GMP_NUMBER_FROM_INT_117 (0, 1, 1, 7)
+#define _GMP_NUMBER_FROM_INT_118 (0, 1, 1, 8)
+#define _GMP_NUMBER_FROM_INT_119 (0, 1, 1, 9)
+#define _GMP_NUMBER_FROM_INT_120 (0, 1, 2, 0)
+#define _GMP_NUMBER_FROM_INT_121 (0, 1, 2, 1)
+#define _GMP_NUMBER_FROM_INT_122 (0, 1, 2, 2)
+#define _GMP_NUMBER_FROM_INT_123 (0, 1, 2, 3)
+#define _GMP_NUMBER_FROM_INT_124 (0, 1, 2, 4)
+#define _GMP_NUMBER_FROM_INT_125 (0, 1, 2, 5)
+#define _GMP_NUMBER_FROM_INT_126 (0, 1, 2, 6)
+#define _GMP_NUMBER_FROM_INT_127 (0, 1, 2, 7)
+#define _GMP_NUMBER_FROM_INT_128 (0, 1, 2, 8)
+#define _GMP_NUMBER_FROM_INT_129 (0, 1, 2, 9)
+#define _GMP_NUMBER_FROM_INT_130 (0, 1, 3, 0)
+#define _GMP_NUMBER_FROM_INT_131 (0, 1, 3, 1)
+#define _GMP_NUMBER_FROM_INT_132 (0, 1, 3, 2)
+#define _GMP_NUMBER_FROM_INT_133 (0, 1, 3, 3)
+#define _GMP_NUMBER_FROM_INT_134 (0, 1, 3, 4)
+#define _GMP_NUMBER_FROM_INT_135 (0, 1, 3, 5)
+#define _GMP_NUMBER_FROM_INT_136 (0, 1, 3, 6)
+#define _GMP_NUMBER_FROM_INT_137 (0, 1, 3, 7)
+#define _GMP_NUMBER_FROM_INT_138 (0, 1, 3, 8)
+#define _GMP_NUMBER_FROM_INT_139 (0, 1, 3, 9)
+#define _GMP_NUMBER_FROM_INT_140 (0, 1, 4, 0)
+#define _GMP_NUMBER_FROM_INT_141 (0, 1, 4, 1)
+#define _GMP_NUMBER_FROM_INT_142 (0, 1, 4, 2)
+#define _GMP_NUMBER_FROM_INT_143 (0, 1, 4, 3)
+#define _GMP_NUMBER_FROM_INT_144 (0, 1, 4, 4)
+#define _GMP_NUMBER_FROM_INT_145 (0, 1, 4, 5)
+#define _GMP_NUMBER_FROM_INT_146 (0, 1, 4, 6)
+#define _GMP_NUMBER_FROM_INT_147 (0, 1, 4, 7)
+#define _GMP_NUMBER_FROM_INT_148 (0, 1, 4, 8)
+#define _GMP_NUMBER_FROM_INT_149 (0, 1, 4, 9)
+#define _GMP_NUMBER_FROM_INT_150 (0, 1, 5, 0)
+#define _GMP_NUMBER_FROM_INT_151 (0, 1, 5, 1)
+#define _GMP_NUMBER_FROM_INT_152 (0, 1, 5, 2)
+#define _GMP_NUMBER_FROM_INT_153 (0, 1, 5, 3)
+#define _GMP_NUMBER_FROM_INT_154 (0, 1, 5, 4)
+#define _GMP_NUMBER_FROM_INT_155 (0, 1, 5, 5)
+#define _GMP_NUMBER_FROM_INT_156 (0, 1, 5, 6)
+#define _GMP_NUMBER_FROM_INT_157 (0, 1, 5, 7)
+#define _GMP_NUMBER_FROM_INT_158 (0, 1, 5, 8)
+#define _GMP_NUMBER_FROM_INT_159 (0, 1, 5, 9)
+#define _GMP_NUMBER_FROM_INT_160 (0, 1, 6, 0)
+#define _GMP_NUMBER_FROM_INT_161 (0, 1, 6, 1)
+#define _GMP_NUMBER_FROM_INT_162 (0, 1, 6, 2)
+#define _GMP_NUMBER_FROM_INT_163 (0, 1, 6, 3)
+#define _GMP_NUMBER_FROM_INT_164 (0, 1, 6, 4)
+#define _GMP_NUMBER_FROM_INT_165 (0, 1, 6, 5)
+#define _GMP_NUMBER_FROM_INT_166 (0, 1, 6, 6)
+#define _GMP_NUMBER_FROM_INT_167 (0, 1, 6, 7)
+#define _GMP_NUMBER_FROM_INT_168 (0, 1, 6, 8)
+#define _GMP_NUMBER_FROM_INT_169 (0, 1, 6, 9)
+#define _GMP_NUMBER_FROM_INT_170 (0, 1, 7, 0)
+#define _GMP_NUMBER_FROM_INT_171 (0, 1, 7, 1)
+#define _GMP_NUMBER_FROM_INT_172 (0, 1, 7, 2)
+#define _GMP_NUMBER_FROM_INT_173 (0, 1, 7, 3)
+#define _GMP_NUMBER_FROM_INT_174 (0, 1, 7, 4)
+#define _GMP_NUMBER_FROM_INT_175 (0, 1, 7, 5)
+#define _GMP_NUMBER_FROM_INT_176 (0, 1, 7, 6)
+#define _GMP_NUMBER_FROM_INT_177 (0, 1, 7, 7)
+#define _GMP_NUMBER_FROM_INT_178 (0, 1, 7, 8)
+#define _GMP_NUMBER_FROM_INT_179 (0, 1, 7, 9)
+#define _GMP_NUMBER_FROM_INT_180 (0, 1, 8, 0)
+#define _GMP_NUMBER_FROM_INT_181 (0, 1, 8, 1)
+#define _GMP_NUMBER_FROM_INT_182 (0, 1, 8, 2)
+#define _GMP_NUMBER_FROM_INT_183 (0, 1, 8, 3)
+#define _GMP_NUMBER_FROM_INT_184 (0, 1, 8, 4)
+#define _GMP_NUMBER_FROM_INT_185 (0, 1, 8, 5)
+#define _GMP_NUMBER_FROM_INT_186 (0, 1, 8, 6)
+#define _GMP_NUMBER_FROM_INT_187 (0, 1, 8, 7)
+#define _GMP_NUMBER_FROM_INT_188 (0, 1, 8, 8)
+#define _GMP_NUMBER_FROM_INT_189 (0, 1, 8, 9)
+#define _GMP_NUMBER_FROM_INT_190 (0, 1, 9, 0)
+#define _GMP_NUMBER_FROM_INT_191 (0, 1, 9, 1)
+#define _GMP_NUMBER_FROM_INT_192 (0, 1, 9, 2)
+#define _GMP_NUMBER_FROM_INT_193 (0, 1, 9, 3)
+#define _GMP_NUMBER_FROM_INT_194 (0, 1, 9, 4)
+#define _GMP_NUMBER_FROM_INT_195 (0, 1, 9, 5)
+#define _GMP_NUMBER_FROM_INT_196 (0, 1, 9, 6)
+#define _GMP_NUMBER_FROM_INT_197 (0, 1, 9, 7)
+#define _GMP_NUMBER_FROM_INT_198 (0, 1, 9, 8)
+#define _GMP_NUMBER_FROM_INT_199 (0, 1, 9, 9)
+#define _GMP_NUMBER_FROM_INT_200 (0, 2, 0, 0)
+#define _GMP_NUMBER_FROM_INT_201 (0, 2, 0, 1)
+#define _GMP_NUMBER_FROM_INT_202 (0, 2, 0, 2)
+#define _GMP_NUMBER_FROM_INT_203 (0, 2, 0, 3)
+#define _GMP_NUMBER_FROM_INT_204 (0, 2, 0, 4)
+#define _GMP_NUMBER_FROM_INT_205 (0, 2, 0, 5)
+#define _GMP_NUMBER_FROM_INT_206 (0, 2, 0, 6)
+#define _GMP_NUMBER_FROM_INT_207 (0, 2, 0, 7)
+#define _GMP_NUMBER_FROM_INT_208 (0, 2, 0, 8)
+#define _GMP_NUMBER_FROM_INT_209 (0, 2, 0, 9)
+#define _GMP_NUMBER_FROM_INT_210 (0, 2, 1, 0)
+#define _GMP_NUMBER_FROM_INT_211 (0, 2, 1, 1)
+#define _GMP_NUMBER_FROM_INT_212 (0, 2, 1, 2)
+#define _GMP_NUMBER_FROM_INT_213 (0, 2, 1, 3)
+#define _GMP_NUMBER_FROM_INT_214 (0, 2, 1, 4)
+#define _GMP_NUMBER_FROM_INT_215 (0, 2, 1, 5)
+#define _GMP_NUMBER_FROM_INT_216 (0, 2, 1, 6)
+#define _GMP_NUMBER_FROM_INT_217 (0, 2, 1, 7)
+#define _GMP_NUMBER_FROM_INT_218 (0, 2, 1, 8)
+#define _GMP_NUMBER_FROM_INT_219 (0, 2, 1, 9)
+#define _GMP_NUMBER_FROM_INT_220 (0, 2, 2, 0)
+#define _GMP_NUMBER_FROM_INT_221 (0, 2, 2, 1)
+#define _GMP_NUMBER_FROM_INT_222 (0, 2, 2, 2)
+#define _GMP_NUMBER_FROM_INT_223 (0, 2, 2, 3)
+#define _GMP_NUMBER_FROM_INT_224 (0, 2, 2, 4)
+#define _GMP_NUMBER_FROM_INT_225 (0, 2, 2, 5)
+#define _GMP_NUMBER_FROM_INT_226 (0, 2, 2, 6)
+#define _GMP_NUMBER_FROM_INT_227 (0, 2, 2, 7)
+#define _GMP_NUMBER_FROM_INT_228 (0, 2, 2, 8)
+#define _GMP_NUMBER_FROM_INT_229 (0, 2, 2, 9)
+#define _GMP_NUMBER_FROM_INT_230 (0, 2, 3, 0)
+#define _GMP_NUMBER_FROM_INT_231 (0, 2, 3, 1)
+#define _GMP_NUMBER_FROM_INT_232 (0, 2, 3, 2)
+#define _GMP_NUMBER_FROM_INT_233 (0, 2, 3, 3)
+#define _GMP_NUMBER_FROM_INT_234 (0, 2, 3, 4)
+#define _GMP_NUMBER_FROM_INT_235 (0, 2, 3, 5)
+#define _GMP_NUMBER_FROM_INT_236 (0, 2, 3, 6)
+#define _GMP_NUMBER_FROM_INT_237 (0, 2, 3, 7)
+#define _GMP_NUMBER_FROM_INT_238 (0, 2, 3, 8)
+#define _GMP_NUMBER_FROM_INT_239 (0, 2, 3, 9)
+#define _GMP_NUMBER_FROM_INT_240 (0, 2, 4, 0)
+#define _GMP_NUMBER_FROM_INT_241 (0, 2, 4, 1)
+#define _GMP_NUMBER_FROM_INT_242 (0, 2, 4, 2)
+#define _GMP_NUMBER_FROM_INT_243 (0, 2, 4, 3)
+#define _GMP_NUMBER_FROM_INT_244 (0, 2, 4, 4)
+#define _GMP_NUMBER_FROM_INT_245 (0, 2, 4, 5)
+#define _GMP_NUMBER_FROM_INT_246 (0, 2, 4, 6)
+#define _GMP_NUMBER_FROM_INT_247 (0, 2, 4, 7)
+#define _GMP_NUMBER_FROM_INT_248 (0, 2, 4, 8)
+#define _GMP_NUMBER_FROM_INT_249 (0, 2, 4, 9)
+#define _GMP_NUMBER_FROM_INT_250 (0, 2, 5, 0)
+#define _GMP_NUMBER_FROM_INT_251 (0, 2, 5, 1)
+#define _GMP_NUMBER_FROM_INT_252 (0, 2, 5, 2)
+#define _GMP_NUMBER_FROM_INT_253 (0, 2, 5, 3)
+#define _GMP_NUMBER_FROM_INT_254 (0, 2, 5, 4)
+#define _GMP_NUMBER_FROM_INT_255 (0, 2, 5, 5)
+#define _GMP_NUMBER_FROM_INT_256 (0, 2, 5, 6)
+#define _GMP_NUMBER_FROM_INT_257 (0, 2, 5, 7)
+#define _GMP_NUMBER_FROM_INT_258 (0, 2, 5, 8)
+#define _GMP_NUMBER_FROM_INT_259 (0, 2, 5, 9)
+#define _GMP_NUMBER_FROM_INT_260 (0, 2, 6, 0)
+#define _GMP_NUMBER_FROM_INT_261 (0, 2, 6, 1)
+#define _GMP_NUMBER_FROM_INT_262 (0, 2, 6, 2)
+#define _GMP_NUMBER_FROM_INT_263 (0, 2, 6, 3)
+#define _GMP_NUMBER_FROM_INT_264 (0, 2, 6, 4)
+#define _GMP_NUMBER_FROM_INT_265 (0, 2, 6, 5)
+#define _GMP_NUMBER_FROM_INT_266 (0, 2, 6, 6)
+#define _GMP_NUMBER_FROM_INT_267 (0, 2, 6, 7)
+#define _GMP_NUMBER_FROM_INT_268 (0, 2, 6, 8)
+#define _GMP_NUMBER_FROM_INT_269 (0, 2, 6, 9)
+#define _GMP_NUMBER_FROM_INT_270 (0, 2, 7, 0)
+#define _GMP_NUMBER_FROM_INT_271 (0, 2, 7, 1)
+#define _GMP_NUMBER_FROM_INT_272 (0, 2, 7, 2)
+#define _GMP_NUMBER_FROM_INT_273 (0, 2, 7, 3)
+#define _GMP_NUMBER_FROM_INT_274 (0, 2, 7, 4)
+#define _GMP_NUMBER_FROM_INT_275 (0, 2, 7, 5)
+#define _GMP_NUMBER_FROM_INT_276 (0, 2, 7, 6)
+#define _GMP_NUMBER_FROM_INT_277 (0, 2, 7, 7)
+#define _GMP_NUMBER_FROM_INT_278 (0, 2, 7, 8)
+#define _GMP_NUMBER_FROM_INT_279 (0, 2, 7, 9)
+#define _GMP_NUMBER_FROM_INT_280 (0, 2, 8, 0)
+#define _GMP_NUMBER_FROM_INT_281 (0, 2, 8, 1)
+#define _GMP_NUMBER_FROM_INT_282 (0, 2, 8, 2)
+#define _GMP_NUMBER_FROM_INT_283 (0, 2, 8, 3)
+#define _GMP_NUMBER_FROM_INT_284 (0, 2, 8, 4)
+#define _GMP_NUMBER_FROM_INT_285 (0, 2, 8, 5)
+#define _GMP_NUMBER_FROM_INT_286 (0, 2, 8, 6)
+#define _GMP_NUMBER_FROM_INT_287 (0, 2, 8, 7)
+#define _GMP_NUMBER_FROM_INT_288 (0, 2, 8, 8)
+#define _GMP_NUMBER_FROM_INT_289 (0, 2, 8, 9)
+#define _GMP_NUMBER_FROM_INT_290 (0, 2, 9, 0)
+#define _GMP_NUMBER_FROM_INT_291 (0, 2, 9, 1)
+#define _GMP_NUMBER_FROM_INT_292 (0, 2, 9, 2)
+#define _GMP_NUMBER_FROM_INT_293 (0, 2, 9, 3)
+#define _GMP_NUMBER_FROM_INT_294 (0, 2, 9, 4)
+#define _GMP_NUMBER_FROM_INT_295 (0, 2, 9, 5)
+#define _GMP_NUMBER_FROM_INT_296 (0, 2, 9, 6)
+#define _GMP_NUMBER_FROM_INT_297 (0, 2, 9, 7)
+#define _GMP_NUMBER_FROM_INT_298 (0, 2, 9, 8)
+#define _GMP_NUMBER_FROM_INT_299 (0, 2, 9, 9)
+#define _GMP_NUMBER_FROM_INT_300 (0, 3, 0, 0)
+#define _GMP_NUMBER_FROM_INT_301 (0, 3, 0, 1)
+#define _GMP_NUMBER_FROM_INT_302 (0, 3, 0, 2)
+#define _GMP_NUMBER_FROM_INT_303 (0, 3, 0, 3)
+#define _GMP_NUMBER_FROM_INT_304 (0, 3, 0, 4)
+#define _GMP_NUMBER_FROM_INT_305 (0, 3, 0, 5)
+#define _GMP_NUMBER_FROM_INT_306 (0, 3, 0, 6)
+#define _GMP_NUMBER_FROM_INT_307 (0, 3, 0, 7)
+#define _GMP_NUMBER_FROM_INT_308 (0, 3, 0, 8)
+#define _GMP_NUMBER_FROM_INT_309 (0, 3, 0, 9)
+#define _GMP_NUMBER_FROM_INT_310 (0, 3, 1, 0)
+#define _GMP_NUMBER_FROM_INT_311 (0, 3, 1, 1)
+#define _GMP_NUMBER_FROM_INT_312 (0, 3, 1, 2)
+#define _GMP_NUMBER_FROM_INT_313 (0, 3, 1, 3)
+#define _GMP_NUMBER_FROM_INT_314 (0, 3, 1, 4)
+#define _GMP_NUMBER_FROM_INT_315 (0, 3, 1, 5)
+#define _GMP_NUMBER_FROM_INT_316 (0, 3, 1, 6)
+#define _GMP_NUMBER_FROM_INT_317 (0, 3, 1, 7)
+#define _GMP_NUMBER_FROM_INT_318 (0, 3, 1, 8)
+#define _GMP_NUMBER_FROM_INT_319 (0, 3, 1, 9)
+#define _GMP_NUMBER_FROM_INT_320 (0, 3, 2, 0)
+#define _GMP_NUMBER_FROM_INT_321 (0, 3, 2, 1)
+#define _GMP_NUMBER_FROM_INT_322 (0, 3, 2, 2)
+#define _GMP_NUMBER_FROM_INT_323 (0, 3, 2, 3)
+#define _GMP_NUMBER_FROM_INT_324 (0, 3, 2, 4)
+#define _GMP_NUMBER_FROM_INT_325 (0, 3, 2, 5)
+#define _GMP_NUMBER_FROM_INT_326 (0, 3, 2, 6)
+#define _GMP_NUMBER_FROM_INT_327 (0, 3, 2, 7)
+#define _GMP_NUMBER_FROM_INT_328 (0, 3, 2, 8)
+#define _GMP_NUMBER_FROM_INT_329 (0, 3, 2, 9)
+#define _GMP_NUMBER_FROM_INT_330 (0, 3, 3, 0)
+#define _GMP_NUMBER_FROM_INT_331 (0, 3, 3, 1)
+#define _GMP_NUMBER_FROM_INT_332 (0, 3, 3, 2)
+#define _GMP_NUMBER_FROM_INT_333 (0, 3, 3, 3)
+#define _GMP_NUMBER_FROM_INT_334 (0, 3, 3, 4)
+#define _GMP_NUMBER_FROM_INT_335 (0, 3, 3, 5)
+#define _GMP_NUMBER_FROM_INT_336 (0, 3, 3, 6)
+#define _GMP_NUMBER_FROM_INT_337 (0, 3, 3, 7)
+#define _GMP_NUMBER_FROM_INT_338 (0, 3, 3, 8)
+#define _GMP_NUMBER_FROM_INT_339 (0, 3, 3, 9)
+#define _GMP_NUMBER_FROM_INT_340 (0, 3, 4, 0)
+#define _GMP_NUMBER_FROM_INT_341 (0, 3, 4, 1)
+#define _GMP_NUMBER_FROM_INT_342 (0, 3, 4, 2)
+#define _GMP_NUMBER_FROM_INT_343 (0, 3, 4, 3)
+#define _GMP_NUMBER_FROM_INT_344 (0, 3, 4, 4)
+#define _GMP_NUMBER_FROM_INT_345 (0, 3, 4, 5)
+#define _GMP_NUMBER_FROM_INT_346 (0, 3, 4, 6)
+#define _GMP_NUMBER_FROM_INT_347 (0, 3, 4, 7)
+#define _GMP_NUMBER_FROM_INT_348 (0, 3, 4, 8)
+#define _GMP_NUMBER_FROM_INT_349 (0, 3, 4, 9)
+#define _GMP_NUMBER_FROM_INT_350 (0, 3, 5, 0)
+#define _GMP_NUMBER_FROM_INT_351 (0, 3, 5, 1)
+#define _GMP_NUMBER_FROM_INT_352 (0, 3, 5, 2)
+#define _GMP_NUMBER_FROM_INT_353 (0, 3, 5, 3)
+#define _GMP_NUMBER_FROM_INT_354 (0, 3, 5, 4)
+#define _GMP_NUMBER_FROM_INT_355 (0, 3, 5, 5)
+#define _GMP_NUMBER_FROM_INT_356 (0, 3, 5, 6)
+#define _GMP_NUMBER_FROM_INT_357 (0, 3, 5, 7)
+#define _GMP_NUMBER_FROM_INT_358 (0, 3, 5, 8)
+#define _GMP_NUMBER_FROM_INT_359 (0, 3, 5, 9)
+#define _GMP_NUMBER_FROM_INT_360 (0, 3, 6, 0)
+#define _GMP_NUMBER_FROM_INT_361 (0, 3, 6, 1)
+#define _GMP_NUMBER_FROM_INT_362 (0, 3, 6, 2)
+#define _GMP_NUMBER_FROM_INT_363 (0, 3, 6, 3)
+#define _GMP_NUMBER_FROM_INT_364 (0, 3, 6, 4)
+#define _GMP_NUMBER_FROM_INT_365 (0, 3, 6, 5)
+#define _GMP_NUMBER_FROM_INT_366 (0, 3, 6, 6)
+#define _GMP_NUMBER_FROM_INT_367 (0, 3, 6, 7)
+#define _GMP_NUMBER_FROM_INT_368 (0, 3, 6, 8)
+#define _GMP_NUMBER_FROM_INT_369 (0, 3, 6, 9)
+#define _GMP_NUMBER_FROM_INT_370 (0, 3, 7, 0)
+#define _GMP_NUMBER_FROM_INT_371 (0, 3, 7, 1)
+#define _GMP_NUMBER_FROM_INT_372 (0, 3, 7, 2)
+#define _GMP_NUMBER_FROM_INT_373 (0, 3, 7, 3)
+#define _GMP_NUMBER_FROM_INT_374 (0, 3, 7, 4)
+#define _GMP_NUMBER_FROM_INT_375 (0, 3, 7, 5)
+#define _GMP_NUMBER_FROM_INT_376 (0, 3, 7, 6)
+#define _GMP_NUMBER_FROM_INT_377 (0, 3, 7, 7)
+#define _GMP_NUMBER_FROM_INT_378 (0, 3, 7, 8)
+#define _GMP_NUMBER_FROM_INT_379 (0, 3, 7, 9)
+#define _GMP_NUMBER_FROM_INT_380 (0, 3, 8, 0)
+#define _GMP_NUMBER_FROM_INT_381 (0, 3, 8, 1)
+#define _GMP_NUMBER_FROM_INT_382 (0, 3, 8, 2)
+#define _GMP_NUMBER_FROM_INT_383 (0, 3, 8, 3)
+#define _GMP_NUMBER_FROM_INT_384 (0, 3, 8, 4)
+#define _GMP_NUMBER_FROM_INT_385 (0, 3, 8, 5)
+#define _GMP_NUMBER_FROM_INT_386 (0, 3, 8, 6)
+#define _GMP_NUMBER_FROM_INT_387 (0, 3, 8, 7)
+#define _GMP_NUMBER_FROM_INT_388 (0, 3, 8, 8)
+#define _GMP_NUMBER_FROM_INT_389 (0, 3, 8, 9)
+#define _GMP_NUMBER_FROM_INT_390 (0, 3, 9, 0)
+#define _GMP_NUMBER_FROM_INT_391 (0, 3, 9, 1)
+#define _GMP_NUMBER_FROM_INT_392 (0, 3, 9, 2)
+#define _GMP_NUMBER_FROM_INT_393 (0, 3, 9, 3)
+#define _GMP_NUMBER_FROM_INT_394 (0, 3, 9, 4)
+#define _GMP_NUMBER_FROM_INT_395 (0, 3, 9, 5)
+#define _GMP_NUMBER_FROM_INT_396 (0, 3, 9, 6)
+#define _GMP_NUMBER_FROM_INT_397 (0, 3, 9, 7)
+#define _GMP_NUMBER_FROM_INT_398 (0, 3, 9, 8)
+#define _GMP_NUMBER_FROM_INT_399 (0, 3, 9, 9)
+#define _GMP_NUMBER_FROM_INT_400 (0, 4, 0, 0)
+#define _GMP_NUMBER_FROM_INT_401 (0, 4, 0, 1)
+#define _GMP_NUMBER_FROM_INT_402 (0, 4, 0, 2)
+#define _GMP_NUMBER_FROM_INT_403 (0, 4, 0, 3)
+#define _GMP_NUMBER_FROM_INT_404 (0, 4, 0, 4)
+#define _GMP_NUMBER_FROM_INT_405 (0, 4, 0, 5)
+#define _GMP_NUMBER_FROM_INT_406 (0, 4, 0, 6)
+#define _GMP_NUMBER_FROM_INT_407 (0, 4, 0, 7)
+#define _GMP_NUMBER_FROM_INT_408 (0, 4, 0, 8)
+#define _GMP_NUMBER_FROM_INT_409 (0, 4, 0, 9)
+#define _GMP_NUMBER_FROM_INT_410 (0, 4, 1, 0)
+#define _GMP_NUMBER_FROM_INT_411 (0, 4, 1, 1)
+#define _GMP_NUMBER_FROM_INT_412 (0, 4, 1, 2)
+#define _GMP_NUMBER_FROM_INT_413 (0, 4, 1, 3)
+#define _GMP_NUMBER_FROM_INT_414 (0, 4, 1, 4)
+#define _GMP_NUMBER_FROM_INT_415 (0, 4, 1, 5)
+#define _GMP_NUMBER_FROM_INT_416 (0, 4, 1, 6)
+#define _GMP_NUMBER_FROM_INT_417 (0, 4, 1, 7)
+#define _GMP_NUMBER_FROM_INT_418 (0, 4, 1, 8)
+#define _GMP_NUMBER_FROM_INT_419 (0, 4, 1, 9)
+#define _GMP_NUMBER_FROM_INT_420 (0, 4, 2, 0)
+#define _GMP_NUMBER_FROM_INT_421 (0, 4, 2, 1)
+#define _GMP_NUMBER_FROM_INT_422 (0, 4, 2, 2)
+#define _GMP_NUMBER_FROM_INT_423 (0, 4, 2, 3)
+#define _GMP_NUMBER_FROM_INT_424 (0, 4, 2, 4)
+#define _GMP_NUMBER_FROM_INT_425 (0, 4, 2, 5)
+#define _GMP_NUMBER_FROM_INT_426 (0, 4, 2, 6)
+#define _GMP_NUMBER_FROM_INT_427 (0, 4, 2, 7)
+#define _GMP_NUMBER_FROM_INT_428 (0, 4, 2, 8)
+#define _GMP_NUMBER_FROM_INT_429 (0, 4, 2, 9)
+#define _GMP_NUMBER_FROM_INT_430 (0, 4, 3, 0)
+#define _GMP_NUMBER_FROM_INT_431 (0, 4, 3, 1)
+#define _GMP_NUMBER_FROM_INT_432 (0, 4, 3, 2)
+#define _GMP_NUMBER_FROM_INT_433 (0, 4, 3, 3)
+#define _GMP_NUMBER_FROM_INT_434 (0, 4, 3, 4)
+#define _GMP_NUMBER_FROM_INT_435 (0, 4, 3, 5)
+#define _GMP_NUMBER_FROM_INT_436 (0, 4, 3, 6)
+#define _GMP_NUMBER_FROM_INT_437 (0, 4, 3, 7)
+#define _GMP_NUMBER_FROM_INT_438 (0, 4, 3, 8)
+#define _GMP_NUMBER_FROM_INT_439 (0, 4, 3, 9)
+#define _GMP_NUMBER_FROM_INT_440 (0, 4, 4, 0)
+#define _GMP_NUMBER_FROM_INT_441 (0, 4, 4, 1)
+#define _GMP_NUMBER_FROM_INT_442 (0, 4, 4, 2)
+#define _GMP_NUMBER_FROM_INT_443 (0, 4, 4, 3)
+#define _GMP_NUMBER_FROM_INT_444 (0, 4, 4, 4)
+#define _GMP_NUMBER_FROM_INT_445 (0, 4, 4, 5)
+#define _GMP_NUMBER_FROM_INT_446 (0, 4, 4, 6)
+#define _GMP_NUMBER_FROM_INT_447 (0, 4, 4, 7)
+#define _GMP_NUMBER_FROM_INT_448 (0, 4, 4, 8)
+#define _GMP_NUMBER_FROM_INT_449 (0, 4, 4, 9)
+#define _GMP_NUMBER_FROM_INT_450 (0, 4, 5, 0)
+#define _GMP_NUMBER_FROM_INT_451 (0, 4, 5, 1)
+#define _GMP_NUMBER_FROM_INT_452 (0, 4, 5, 2)
+#define _GMP_NUMBER_FROM_INT_453 (0, 4, 5, 3)
+#define _GMP_NUMBER_FROM_INT_454 (0, 4, 5, 4)
+#define _GMP_NUMBER_FROM_INT_455 (0, 4, 5, 5)
+#define _GMP_NUMBER_FROM_INT_456 (0, 4, 5, 6)
+#define _GMP_NUMBER_FROM_INT_457 (0, 4, 5, 7)
+#define _GMP_NUMBER_FROM_INT_458 (0, 4, 5, 8)
+#define _GMP_NUMBER_FROM_INT_459 (0, 4, 5, 9)
+#define _GMP_NUMBER_FROM_INT_460 (0, 4, 6, 0)
+#define _GMP_NUMBER_FROM_INT_461 (0, 4, 6, 1)
+#define _GMP_NUMBER_FROM_INT_462 (0, 4, 6, 2)
+#define _GMP_NUMBER_FROM_INT_463 (0, 4, 6, 3)
+#define _GMP_NUMBER_FROM_INT_464 (0, 4, 6, 4)
+#define _GMP_NUMBER_FROM_INT_465 (0, 4, 6, 5)
+#define _GMP_NUMBER_FROM_INT_466 (0, 4, 6, 6)
+#define _GMP_NUMBER_FROM_INT_467 (0, 4, 6, 7)
+#define _GMP_NUMBER_FROM_INT_468 (0, 4, 6, 8)
+#define _GMP_NUMBER_FROM_INT_469 (0, 4, 6, 9)
+#define _GMP_NUMBER_FROM_INT_470 (0, 4, 7, 0)
+#define _GMP_NUMBER_FROM_INT_471 (0, 4, 7, 1)
+#define _GMP_NUMBER_FROM_INT_472 (0, 4, 7, 2)
+#define _GMP_NUMBER_FROM_INT_473 (0, 4, 7, 3)
+#define _GMP_NUMBER_FROM_INT_474 (0, 4, 7, 4)
+#define _GMP_NUMBER_FROM_INT_475 (0, 4, 7, 5)
+#define _GMP_NUMBER_FROM_INT_476 (0, 4, 7, 6)
+#define _GMP_NUMBER_FROM_INT_477 (0, 4, 7, 7)
+#define _GMP_NUMBER_FROM_INT_478 (0, 4, 7, 8)
+#define _GMP_NUMBER_FROM_INT_479 (0, 4, 7, 9)
+#define _GMP_NUMBER_FROM_INT_480 (0, 4, 8, 0)
+#define _GMP_NUMBER_FROM_INT_481 (0, 4, 8, 1)
+#define _GMP_NUMBER_FROM_INT_482 (0, 4, 8, 2)
+#define _GMP_NUMBER_FROM_INT_483 (0, 4, 8, 3)
+#define _GMP_NUMBER_FROM_INT_484 (0, 4, 8, 4)
+#define _GMP_NUMBER_FROM_INT_485 (0, 4, 8, 5)
+#define _GMP_NUMBER_FROM_INT_486 (0, 4, 8, 6)
+#define _GMP_NUMBER_FROM_INT_487 (0, 4, 8, 7)
+#define _GMP_NUMBER_FROM_INT_488 (0, 4, 8, 8)
+#define _GMP_NUMBER_FROM_INT_489 (0, 4, 8, 9)
+#define _GMP_NUMBER_FROM_INT_490 (0, 4, 9, 0)
+#define _GMP_NUMBER_FROM_INT_491 (0, 4, 9, 1)
+#define _GMP_NUMBER_FROM_INT_492 (0, 4, 9, 2)
+#define _GMP_NUMBER_FROM_INT_493 (0, 4, 9, 3)
+#define _GMP_NUMBER_FROM_INT_494 (0, 4, 9, 4)
+#define _GMP_NUMBER_FROM_INT_495 (0, 4, 9, 5)
+#define _GMP_NUMBER_FROM_INT_496 (0, 4, 9, 6)
+#define _GMP_NUMBER_FROM_INT_497 (0, 4, 9, 7)
+#define _GMP_NUMBER_FROM_INT_498 (0, 4, 9, 8)
+#define _GMP_NUMBER_FROM_INT_499 (0, 4, 9, 9)
+#define _GMP_NUMBER_FROM_INT_500 (0, 5, 0, 0)
+#define _GMP_NUMBER_FROM_INT_501 (0, 5, 0, 1)
+#define _GMP_NUMBER_FROM_INT_502 (0, 5, 0, 2)
+#define _GMP_NUMBER_FROM_INT_503 (0, 5, 0, 3)
+#define _GMP_NUMBER_FROM_INT_504 (0, 5, 0, 4)
+#define _GMP_NUMBER_FROM_INT_505 (0, 5, 0, 5)
+#define _GMP_NUMBER_FROM_INT_506 (0, 5, 0, 6)
+#define _GMP_NUMBER_FROM_INT_507 (0, 5, 0, 7)
+#define _GMP_NUMBER_FROM_INT_508 (0, 5, 0, 8)
+#define _GMP_NUMBER_FROM_INT_509 (0, 5, 0, 9)
+#define _GMP_NUMBER_FROM_INT_510 (0, 5, 1, 0)
+#define _GMP_NUMBER_FROM_INT_511 (0, 5, 1, 1)
+#define _GMP_NUMBER_FROM_INT_512 (0, 5, 1, 2)
+#define _GMP_NUMBER_FROM_INT_513 (0, 5, 1, 3)
+#define _GMP_NUMBER_FROM_INT_514 (0, 5, 1, 4)
+#define _GMP_NUMBER_FROM_INT_515 (0, 5, 1, 5)
+#define _GMP_NUMBER_FROM_INT_516 (0, 5, 1, 6)
+#define _GMP_NUMBER_FROM_INT_517 (0, 5, 1, 7)
+#define _GMP_NUMBER_FROM_INT_518 (0, 5, 1, 8)
+#define _GMP_NUMBER_FROM_INT_519 (0, 5, 1, 9)
+#define _GMP_NUMBER_FROM_INT_520 (0, 5, 2, 0)
+#define _GMP_NUMBER_FROM_INT_521 (0, 5, 2, 1)
+#define _GMP_NUMBER_FROM_INT_522 (0, 5, 2, 2)
+#define _GMP_NUMBER_FROM_INT_523 (0, 5, 2, 3)
+#define _GMP_NUMBER_FROM_INT_524 (0, 5, 2, 4)
+#define _GMP_NUMBER_FROM_INT_525 (0, 5, 2, 5)
+#define _GMP_NUMBER_FROM_INT_526 (0, 5, 2, 6)
+#define _GMP_NUMBER_FROM_INT_527 (0, 5, 2, 7)
+#define _GMP_NUMBER_FROM_INT_528 (0, 5, 2, 8)
+#define _GMP_NUMBER_FROM_INT_529 (0, 5, 2, 9)
+#define _GMP_NUMBER_FROM_INT_530 (0, 5, 3, 0)
+#define _GMP_NUMBER_FROM_INT_531 (0, 5, 3, 1)
+#define _GMP_NUMBER_FROM_INT_532 (0, 5, 3, 2)
+#define _GMP_NUMBER_FROM_INT_533 (0, 5, 3, 3)
+#define _GMP_NUMBER_FROM_INT_534 (0, 5, 3, 4)
+#define _GMP_NUMBER_FROM_INT_535 (0, 5, 3, 5)
+#define _GMP_NUMBER_FROM_INT_536 (0, 5, 3, 6)
+#define _GMP_NUMBER_FROM_INT_537 (0, 5, 3, 7)
+#define _GMP_NUMBER_FROM_INT_538 (0, 5, 3, 8)
+#define _GMP_NUMBER_FROM_INT_539 (0, 5, 3, 9)
+#define _GMP_NUMBER_FROM_INT_540 (0, 5, 4, 0)
+#define _GMP_NUMBER_FROM_INT_541 (0, 5, 4, 1)
+#define _GMP_NUMBER_FROM_INT_542 (0, 5, 4, 2)
+#define _GMP_NUMBER_FROM_INT_543 (0, 5, 4, 3)
+#define _GMP_NUMBER_FROM_INT_544 (0, 5, 4, 4)
+#define _GMP_NUMBER_FROM_INT_545 (0, 5, 4, 5)
+#define _GMP_NUMBER_FROM_INT_546 (0, 5, 4, 6)
+#define _GMP_NUMBER_FROM_INT_547 (0, 5, 4, 7)
+#define _GMP_NUMBER_FROM_INT_548 (0, 5, 4, 8)
+#define _GMP_NUMBER_FROM_INT_549 (0, 5, 4, 9)
+#define _GMP_NUMBER_FROM_INT_550 (0, 5, 5, 0)
+#define _GMP_NUMBER_FROM_INT_551 (0, 5, 5, 1)
+#define _GMP_NUMBER_FROM_INT_552 (0, 5, 5, 2)
+#define _GMP_NUMBER_FROM_INT_553 (0, 5, 5, 3)
+#define _GMP_NUMBER_FROM_INT_554 (0, 5, 5, 4)
+#define _GMP_NUMBER_FROM_INT_555 (0, 5, 5, 5)
+#define _GMP_NUMBER_FROM_INT_556 (0, 5, 5, 6)
+#define _GMP_NUMBER_FROM_INT_557 (0, 5, 5, 7)
+#define _GMP_NUMBER_FROM_INT_558 (0, 5, 5, 8)
+#define _GMP_NUMBER_FROM_INT_559 (0, 5, 5, 9)
+#define _GMP_NUMBER_FROM_INT_560 (0, 5, 6, 0)
+#define _GMP_NUMBER_FROM_INT_561 (0, 5, 6, 1)
+#define _GMP_NUMBER_FROM_INT_562 (0, 5, 6, 2)
+#define _GMP_NUMBER_FROM_INT_563 (0, 5, 6, 3)
+#define _GMP_NUMBER_FROM_INT_564 (0, 5, 6, 4)
+#define _GMP_NUMBER_FROM_INT_565 (0, 5, 6, 5)
+#define _GMP_NUMBER_FROM_INT_566 (0, 5, 6, 6)
+#define _GMP_NUMBER_FROM_INT_567 (0, 5, 6, 7)
+#define _GMP_NUMBER_FROM_INT_568 (0, 5, 6, 8)
+#define _GMP_NUMBER_FROM_INT_569 (0, 5, 6, 9)
+#define _GMP_NUMBER_FROM_INT_570 (0, 5, 7, 0)
+#define _GMP_NUMBER_FROM_INT_571 (0, 5, 7, 1)
+#define _GMP_NUMBER_FROM_INT_572 (0, 5, 7, 2)
+#define _GMP_NUMBER_FROM_INT_573 (0, 5, 7, 3)
+#define _GMP_NUMBER_FROM_INT_574 (0, 5, 7, 4)
+#define _GMP_NUMBER_FROM_INT_575 (0, 5, 7, 5)
+#define _GMP_NUMBER_FROM_INT_576 (0, 5, 7, 6)
+#define _GMP_NUMBER_FROM_INT_577 (0, 5, 7, 7)
+#define _GMP_NUMBER_FROM_INT_578 (0, 5, 7, 8)
+#define _GMP_NUMBER_FROM_INT_579 (0, 5, 7, 9)
+#define _GMP_NUMBER_FROM_INT_580 (0, 5, 8, 0)
+#define _GMP_NUMBER_FROM_INT_581 (0, 5, 8, 1)
+#define _GMP_NUMBER_FROM_INT_582 (0, 5, 8, 2)
+#define _GMP_NUMBER_FROM_INT_583 (0, 5, 8, 3)
+#define _GMP_NUMBER_FROM_INT_584 (0, 5, 8, 4)
+#define _GMP_NUMBER_FROM_INT_585 (0, 5, 8, 5)
+#define _GMP_NUMBER_FROM_INT_586 (0, 5, 8, 6)
+#define _GMP_NUMBER_FROM_INT_587 (0, 5, 8, 7)
+#define _GMP_NUMBER_FROM_INT_588 (0, 5, 8, 8)
+#define _GMP_NUMBER_FROM_INT_589 (0, 5, 8, 9)
+#define _GMP_NUMBER_FROM_INT_590 (0, 5, 9, 0)
+#define _GMP_NUMBER_FROM_INT_591 (0, 5, 9, 1)
+#define _GMP_NUMBER_FROM_INT_592 (0, 5, 9, 2)
+#define _GMP_NUMBER_FROM_INT_593 (0, 5, 9, 3)
+#define _GMP_NUMBER_FROM_INT_594 (0, 5, 9, 4)
+#define _GMP_NUMBER_FROM_INT_595 (0, 5, 9, 5)
+#define _GMP_NUMBER_FROM_INT_596 (0, 5, 9, 6)
+#define _GMP_NUMBER_FROM_INT_597 (0, 5, 9, 7)
+#define _GMP_NUMBER_FROM_INT_598 (0, 5, 9, 8)
+#define _GMP_NUMBER_FROM_INT_599 (0, 5, 9, 9)
+#define _GMP_NUMBER_FROM_INT_600 (0, 6, 0, 0)
+#define _GMP_NUMBER_FROM_INT_601 (0, 6, 0, 1)
+#define _GMP_NUMBER_FROM_INT_602 (0, 6, 0, 2)
+#define _GMP_NUMBER_FROM_INT_603 (0, 6, 0, 3)
+#define _GMP_NUMBER_FROM_INT_604 (0, 6, 0, 4)
+#define _GMP_NUMBER_FROM_INT_605 (0, 6, 0, 5)
+#define _GMP_NUMBER_FROM_INT_606 (0, 6, 0, 6)
+#define _GMP_NUMBER_FROM_INT_607 (0, 6, 0, 7)
+#define _GMP_NUMBER_FROM_INT_608 (0, 6, 0, 8)
+#define _GMP_NUMBER_FROM_INT_609 (0, 6, 0, 9)
+#define _GMP_NUMBER_FROM_INT_610 (0, 6, 1, 0)
+#define _GMP_NUMBER_FROM_INT_611 (0, 6, 1, 1)
+#define _GMP_NUMBER_FROM_INT_612 (0, 6, 1, 2)
+#define _GMP_NUMBER_FROM_INT_613 (0, 6, 1, 3)
+#define _GMP_NUMBER_FROM_INT_614 (0, 6, 1, 4)
+#define _GMP_NUMBER_FROM_INT_615 (0, 6, 1, 5)
+#define _GMP_NUMBER_FROM_INT_616 (0, 6, 1, 6)
+#define _GMP_NUMBER_FROM_INT_617 (0, 6, 1, 7)
+#define _GMP_NUMBER_FROM_INT_618 (0, 6, 1, 8)
+#define _GMP_NUMBER_FROM_INT_619 (0, 6, 1, 9)
+#define _GMP_NUMBER_FROM_INT_620 (0, 6, 2, 0)
+#define _GMP_NUMBER_FROM_INT_621 (0, 6, 2, 1)
+#define _GMP_NUMBER_FROM_INT_622 (0, 6, 2, 2)
+#define _GMP_NUMBER_FROM_INT_623 (0, 6, 2, 3)
+#define _GMP_NUMBER_FROM_INT_624 (0, 6, 2, 4)
+#define _GMP_NUMBER_FROM_INT_625 (0, 6, 2, 5)
+#define _GMP_NUMBER_FROM_INT_626 (0, 6, 2, 6)
+#define _GMP_NUMBER_FROM_INT_627 (0, 6, 2, 7)
+#define _GMP_NUMBER_FROM_INT_628 (0, 6, 2, 8)
+#define _GMP_NUMBER_FROM_INT_629 (0, 6, 2, 9)
+#define _GMP_NUMBER_FROM_INT_630 (0, 6, 3, 0)
+#define _GMP_NUMBER_FROM_INT_631 (0, 6, 3, 1)
+#define _GMP_NUMBER_FROM_INT_632 (0, 6, 3, 2)
+#define _GMP_NUMBER_FROM_INT_633 (0, 6, 3, 3)
+#define _GMP_NUMBER_FROM_INT_634 (0, 6, 3, 4)
+#define _GMP_NUMBER_FROM_INT_635 (0, 6, 3, 5)
+#define _GMP_NUMBER_FROM_INT_636 (0, 6, 3, 6)
+#define _GMP_NUMBER_FROM_INT_637 (0, 6, 3, 7)
+#define _GMP_NUMBER_FROM_INT_638 (0, 6, 3, 8)
+#define _GMP_NUMBER_FROM_INT_639 (0, 6, 3, 9)
+#define _GMP_NUMBER_FROM_INT_640 (0, 6, 4, 0)
+#define _GMP_NUMBER_FROM_INT_641 (0, 6, 4, 1)
+#define _GMP_NUMBER_FROM_INT_642 (0, 6, 4, 2)
+#define _GMP_NUMBER_FROM_INT_643 (0, 6, 4, 3)
+#define _GMP_NUMBER_FROM_INT_644 (0, 6, 4, 4)
+#define _GMP_NUMBER_FROM_INT_645 (0, 6, 4, 5)
+#define _GMP_NUMBER_FROM_INT_646 (0, 6, 4, 6)
+#define _GMP_NUMBER_FROM_INT_647 (0, 6, 4, 7)
+#define _GMP_NUMBER_FROM_INT_648 (0, 6, 4, 8)
+#define _GMP_NUMBER_FROM_INT_649 (0, 6, 4, 9)
+#define _GMP_NUMBER_FROM_INT_650 (0, 6, 5, 0)
+#define _GMP_NUMBER_FROM_INT_651 (0, 6, 5, 1)
+#define _GMP_NUMBER_FROM_INT_652 (0, 6, 5, 2)
+#define _GMP_NUMBER_FROM_INT_653 (0, 6, 5, 3)
+#define _GMP_NUMBER_FROM_INT_654 (0, 6, 5, 4)
+#define _GMP_NUMBER_FROM_INT_655 (0, 6, 5, 5)
+#define _GMP_NUMBER_FROM_INT_656 (0, 6, 5, 6)
+#define _GMP_NUMBER_FROM_INT_657 (0, 6, 5, 7)
+#define _GMP_NUMBER_FROM_INT_658 (0, 6, 5, 8)
+#define _GMP_NUMBER_FROM_INT_659 (0, 6, 5, 9)
+#define _GMP_NUMBER_FROM_INT_660 (0, 6, 6, 0)
+#define _GMP_NUMBER_FROM_INT_661 (0, 6, 6, 1)
+#define _GMP_NUMBER_FROM_INT_662 (0, 6, 6, 2)
+#define _GMP_NUMBER_FROM_INT_663 (0, 6, 6, 3)
+#define _GMP_NUMBER_FROM_INT_664 (0, 6, 6, 4)
+#define _GMP_NUMBER_FROM_INT_665 (0, 6, 6, 5)
+#define _GMP_NUMBER_FROM_INT_666 (0, 6, 6, 6)
+#define _GMP_NUMBER_FROM_INT_667 (0, 6, 6, 7)
+#define _GMP_NUMBER_FROM_INT_668 (0, 6, 6, 8)
+#define _GMP_NUMBER_FROM_INT_669 (0, 6, 6, 9)
+#define _GMP_NUMBER_FROM_INT_670 (0, 6, 7, 0)
+#define _GMP_NUMBER_FROM_INT_671 (0, 6, 7, 1)
+#define _GMP_NUMBER_FROM_INT_672 (0, 6, 7, 2)
+#define _GMP_NUMBER_FROM_INT_673 (0, 6, 7, 3)
+#define _GMP_NUMBER_FROM_INT_674 (0, 6, 7, 4)
+#define _GMP_NUMBER_FROM_INT_675 (0, 6, 7, 5)
+#define _GMP_NUMBER_FROM_INT_676 (0, 6, 7, 6)
+#define _GMP_NUMBER_FROM_INT_677 (0, 6, 7, 7)
+#define _GMP_NUMBER_FROM_INT_678 (0, 6, 7, 8)
+#define _GMP_NUMBER_FROM_INT_679 (0, 6, 7, 9)
+#define _GMP_NUMBER_FROM_INT_680 (0, 6, 8, 0)
+#define _GMP_NUMBER_FROM_INT_681 (0, 6, 8, 1)
+#define _GMP_NUMBER_FROM_INT_682 (0, 6, 8, 2)
+#define _GMP_NUMBER_FROM_INT_683 (0, 6, 8, 3)
+#define _GMP_NUMBER_FROM_INT_684 (0, 6, 8, 4)
+#define _GMP_NUMBER_FROM_INT_685 (0, 6, 8, 5)
+#define _GMP_NUMBER_FROM_INT_686 (0, 6, 8, 6)
+#define _GMP_NUMBER_FROM_INT_687 (0, 6, 8, 7)
+#define _GMP_NUMBER_FROM_INT_688 (0, 6, 8, 8)
+#define _GMP_NUMBER_FROM_INT_689 (0, 6, 8, 9)
+#define _GMP_NUMBER_FROM_INT_690 (0, 6, 9, 0)
+#define _GMP_NUMBER_FROM_INT_691 (0, 6, 9, 1)
+#define _GMP_NUMBER_FROM_INT_692 (0, 6, 9, 2)
+#define _GMP_NUMBER_FROM_INT_693 (0, 6, 9, 3)
+#define _GMP_NUMBER_FROM_INT_694 (0, 6, 9, 4)
+#define _GMP_NUMBER_FROM_INT_695 (0, 6, 9, 5)
+#define _GMP_NUMBER_FROM_INT_696 (0, 6, 9, 6)
+#define _GMP_NUMBER_FROM_INT_697 (0, 6, 9, 7)
+#define _GMP_NUMBER_FROM_INT_698 (0, 6, 9, 8)
+#define _GMP_NUMBER_FROM_INT_699 (0, 6, 9, 9)
+#define _GMP_NUMBER_FROM_INT_700 (0, 7, 0, 0)
+#define _GMP_NUMBER_FROM_INT_701 (0, 7, 0, 1)
+#define _GMP_NUMBER_FROM_INT_702 (0, 7, 0, 2)
+#define _GMP_NUMBER_FROM_INT_703 (0, 7, 0, 3)
+#define _GMP_NUMBER_FROM_INT_704 (0, 7, 0, 4)
+#define _GMP_NUMBER_FROM_INT_705 (0, 7, 0, 5)
+#define _GMP_NUMBER_FROM_INT_706 (0, 7, 0, 6)
+#define _GMP_NUMBER_FROM_INT_707 (0, 7, 0, 7)
+#define _GMP_NUMBER_FROM_INT_708 (0, 7, 0, 8)
+#define _GMP_NUMBER_FROM_INT_709 (0, 7, 0, 9)
+#define _GMP_NUMBER_FROM_INT_710 (0, 7, 1, 0)
+#define _GMP_NUMBER_FROM_INT_711 (0, 7, 1, 1)
+#define _GMP_NUMBER_FROM_INT_712 (0, 7, 1, 2)
+#define _GMP_NUMBER_FROM_INT_713 (0, 7, 1, 3)
+#define _GMP_NUMBER_FROM_INT_714 (0, 7, 1, 4)
+#define _GMP_NUMBER_FROM_INT_715 (0, 7, 1, 5)
+#define _GMP_NUMBER_FROM_INT_716 (0, 7, 1, 6)
+#define _GMP_NUMBER_FROM_INT_717 (0, 7, 1, 7)
+#define _GMP_NUMBER_FROM_INT_718 (0, 7, 1, 8)
+#define _GMP_NUMBER_FROM_INT_719 (0, 7, 1, 9)
+#define _GMP_NUMBER_FROM_INT_720 (0, 7, 2, 0)
+#define _GMP_NUMBER_FROM_INT_721 (0, 7, 2, 1)
+#define _GMP_NUMBER_FROM_INT_722 (0, 7, 2, 2)
+#define _GMP_NUMBER_FROM_INT_723 (0, 7, 2, 3)
+#define _GMP_NUMBER_FROM_INT_724 (0, 7, 2, 4)
+#define _GMP_NUMBER_FROM_INT_725 (0, 7, 2, 5)
+#define _GMP_NUMBER_FROM_INT_726 (0, 7, 2, 6)
+#define _GMP_NUMBER_FROM_INT_727 (0, 7, 2, 7)
+#define _GMP_NUMBER_FROM_INT_728 (0, 7, 2, 8)
+#define _GMP_NUMBER_FROM_INT_729 (0, 7, 2, 9)
+#define _GMP_NUMBER_FROM_INT_730 (0, 7, 3, 0)
+#define _GMP_NUMBER_FROM_INT_731 (0, 7, 3, 1)
+#define _GMP_NUMBER_FROM_INT_732 (0, 7, 3, 2)
+#define _GMP_NUMBER_FROM_INT_733 (0, 7, 3, 3)
+#define _GMP_NUMBER_FROM_INT_734 (0, 7, 3, 4)
+#define _GMP_NUMBER_FROM_INT_735 (0, 7, 3, 5)
+#define _GMP_NUMBER_FROM_INT_736 (0, 7, 3, 6)
+#define _GMP_NUMBER_FROM_INT_737 (0, 7, 3, 7)
+#define _GMP_NUMBER_FROM_INT_738 (0, 7, 3, 8)
+#define _GMP_NUMBER_FROM_INT_739 (0, 7, 3, 9)
+#define _GMP_NUMBER_FROM_INT_740 (0, 7, 4, 0)
+#define _GMP_NUMBER_FROM_INT_741 (0, 7, 4, 1)
+#define _GMP_NUMBER_FROM_INT_742 (0, 7, 4, 2)
+#define _GMP_NUMBER_FROM_INT_743 (0, 7, 4, 3)
+#define _GMP_NUMBER_FROM_INT_744 (0, 7, 4, 4)
+#define _GMP_NUMBER_FROM_INT_745 (0, 7, 4, 5)
+#define _GMP_NUMBER_FROM_INT_746 (0, 7, 4, 6)
+#define _GMP_NUMBER_FROM_INT_747 (0, 7, 4, 7)
+#define _GMP_NUMBER_FROM_INT_748 (0, 7, 4, 8)
+#define _GMP_NUMBER_FROM_INT_749 (0, 7, 4, 9)
+#define _GMP_NUMBER_FROM_INT_750 (0, 7, 5, 0)
+#define _GMP_NUMBER_FROM_INT_751 (0, 7, 5, 1)
+#define _GMP_NUMBER_FROM_INT_752 (0, 7, 5, 2)
+#define _GMP_NUMBER_FROM_INT_753 (0, 7, 5, 3)
+#define _GMP_NUMBER_FROM_INT_754 (0, 7, 5, 4)
+#define _GMP_NUMBER_FROM_INT_755 (0, 7, 5, 5)
+#define _GMP_NUMBER_FROM_INT_756 (0, 7, 5, 6)
+#define _GMP_NUMBER_FROM_INT_757 (0, 7, 5, 7)
+#define _GMP_NUMBER_FROM_INT_758 (0, 7, 5, 8)
+#define _GMP_NUMBER_FROM_INT_759 (0, 7, 5, 9)
+#define _GMP_NUMBER_FROM_INT_760 (0, 7, 6, 0)
+#define _GMP_NUMBER_FROM_INT_761 (0, 7, 6, 1)
+#define _GMP_NUMBER_FROM_INT_762 (0, 7, 6, 2)
+#define _GMP_NUMBER_FROM_INT_763 (0, 7, 6, 3)
+#define _GMP_NUMBER_FROM_INT_764 (0, 7, 6, 4)
+#define _GMP_NUMBER_FROM_INT_765 (0, 7, 6, 5)
+#define _GMP_NUMBER_FROM_INT_766 (0, 7, 6, 6)
+#define _GMP_NUMBER_FROM_INT_767 (0, 7, 6, 7)
+#define _GMP_NUMBER_FROM_INT_768 (0, 7, 6, 8)
+#define _GMP_NUMBER_FROM_INT_769 (0, 7, 6, 9)
+#define _GMP_NUMBER_FROM_INT_770 (0, 7, 7, 0)
+#define _GMP_NUMBER_FROM_INT_771 (0, 7, 7, 1)
+#define _GMP_NUMBER_FROM_INT_772 (0, 7, 7, 2)
+#define _GMP_NUMBER_FROM_INT_773 (0, 7, 7, 3)
+#define _GMP_NUMBER_FROM_INT_774 (0, 7, 7, 4)
+#define _GMP_NUMBER_FROM_INT_775 (0, 7, 7, 5)
+#define _GMP_NUMBER_FROM_INT_776 (0, 7, 7, 6)
+#define _GMP_NUMBER_FROM_INT_777 (0, 7, 7, 7)
+#define _GMP_NUMBER_FROM_INT_778 (0, 7, 7, 8)
+#define _GMP_NUMBER_FROM_INT_779 (0, 7, 7, 9)
+#define _GMP_NUMBER_FROM_INT_780 (0, 7, 8, 0)
+#define _GMP_NUMBER_FROM_INT_781 (0, 7, 8, 1)
+#define _GMP_NUMBER_FROM_INT_782 (0, 7, 8, 2)
+#define _GMP_NUMBER_FROM_INT_783 (0, 7, 8, 3)
+#define _GMP_NUMBER_FROM_INT_784 (0, 7, 8, 4)
+#define _GMP_NUMBER_FROM_INT_785 (0, 7, 8, 5)
+#define _GMP_NUMBER_FROM_INT_786 (0, 7, 8, 6)
+#define _GMP_NUMBER_FROM_INT_787 (0, 7, 8, 7)
+#define _GMP_NUMBER_FROM_INT_788 (0, 7, 8, 8)
+#define _GMP_NUMBER_FROM_INT_789 (0, 7, 8, 9)
+#define _GMP_NUMBER_FROM_INT_790 (0, 7, 9, 0)
+#define _GMP_NUMBER_FROM_INT_791 (0, 7, 9, 1)
+#define _GMP_NUMBER_FROM_INT_792 (0, 7, 9, 2)
+#define _GMP_NUMBER_FROM_INT_793 (0, 7, 9, 3)
+#define _GMP_NUMBER_FROM_INT_794 (0, 7, 9, 4)
+#define _GMP_NUMBER_FROM_INT_795 (0, 7, 9, 5)
+#define _GMP_NUMBER_FROM_INT_796 (0, 7, 9, 6)
+#define _GMP_NUMBER_FROM_INT_797 (0, 7, 9, 7)
+#define _GMP_NUMBER_FROM_INT_798 (0, 7, 9, 8)
+#define _GMP_NUMBER_FROM_INT_799 (0, 7, 9, 9)
+#define _GMP_NUMBER_FROM_INT_800 (0, 8, 0, 0)
+#define _GMP_NUMBER_FROM_INT_801 (0, 8, 0, 1)
+#define _GMP_NUMBER_FROM_INT_802 (0, 8, 0, 2)
+#define _GMP_NUMBER_FROM_INT_803 (0, 8, 0, 3)
+#define _GMP_NUMBER_FROM_INT_804 (0, 8, 0, 4)
+#define _GMP_NUMBER_FROM_INT_805 (0, 8, 0, 5)
+#define _GMP_NUMBER_FROM_INT_806 (0, 8, 0, 6)
+#define _GMP_NUMBER_FROM_INT_807 (0, 8, 0, 7)
+#define _GMP_NUMBER_FROM_INT_808 (0, 8, 0, 8)
+#define _GMP_NUMBER_FROM_INT_809 (0, 8, 0, 9)
+#define _GMP_NUMBER_FROM_INT_810 (0, 8, 1, 0)
+#define _GMP_NUMBER_FROM_INT_811 (0, 8, 1, 1)
+#define _GMP_NUMBER_FROM_INT_812 (0, 8, 1, 2)
+#define _GMP_NUMBER_FROM_INT_813 (0, 8, 1, 3)
+#define _GMP_NUMBER_FROM_INT_814 (0, 8, 1, 4)
+#define _GMP_NUMBER_FROM_INT_815 (0, 8, 1, 5)
+#define _GMP_NUMBER_FROM_INT_816 (0, 8, 1, 6)
+#define _GMP_NUMBER_FROM_INT_817 (0, 8, 1, 7)
+#define _GMP_NUMBER_FROM_INT_818 (0, 8, 1, 8)
+#define _GMP_NUMBER_FROM_INT_819 (0, 8, 1, 9)
+#define _GMP_NUMBER_FROM_INT_820 (0, 8, 2, 0)
+#define _GMP_NUMBER_FROM_INT_821 (0, 8, 2, 1)
+#define _GMP_NUMBER_FROM_INT_822 (0, 8, 2, 2)
+#define _GMP_NUMBER_FROM_INT_823 (0, 8, 2, 3)
+#define _GMP_NUMBER_FROM_INT_824 (0, 8, 2, 4)
+#define _GMP_NUMBER_FROM_INT_825 (0, 8, 2, 5)
+#define _GMP_NUMBER_FROM_INT_826 (0, 8, 2, 6)
+#define _GMP_NUMBER_FROM_INT_827 (0, 8, 2, 7)
+#define _GMP_NUMBER_FROM_INT_828 (0, 8, 2, 8)
+#define _GMP_NUMBER_FROM_INT_829 (0, 8, 2, 9)
+#define _GMP_NUMBER_FROM_INT_830 (0, 8, 3, 0)
+#define _GMP_NUMBER_FROM_INT_831 (0, 8, 3, 1)
+#define _GMP_NUMBER_FROM_INT_832 (0, 8, 3, 2)
+#define _GMP_NUMBER_FROM_INT_833 (0, 8, 3, 3)
+#define _GMP_NUMBER_FROM_INT_834 (0, 8, 3, 4)
+#define _GMP_NUMBER_FROM_INT_835 (0, 8, 3, 5)
+#define _GMP_NUMBER_FROM_INT_836 (0, 8, 3, 6)
+#define _GMP_NUMBER_FROM_INT_837 (0, 8, 3, 7)
+#define _GMP_NUMBER_FROM_INT_838 (0, 8, 3, 8)
+#define _GMP_NUMBER_FROM_INT_839 (0, 8, 3, 9)
+#define _GMP_NUMBER_FROM_INT_840 (0, 8, 4, 0)
+#define _GMP_NUMBER_FROM_INT_841 (0, 8, 4, 1)
+#define _GMP_NUMBER_FROM_INT_842 (0, 8, 4, 2)
+#define _GMP_NUMBER_FROM_INT_843 (0, 8, 4, 3)
+#define _GMP_NUMBER_FROM_INT_844 (0, 8, 4, 4)
+#define _GMP_NUMBER_FROM_INT_845 (0, 8, 4, 5)
+#define _GMP_NUMBER_FROM_INT_846 (0, 8, 4, 6)
+#define _GMP_NUMBER_FROM_INT_847 (0, 8, 4, 7)
+#define _GMP_NUMBER_FROM_INT_848 (0, 8, 4, 8)
+#define _GMP_NUMBER_FROM_INT_849 (0, 8, 4, 9)
+#define _GMP_NUMBER_FROM_INT_850 (0, 8, 5, 0)
+#define _GMP_NUMBER_FROM_INT_851 (0, 8, 5, 1)
+#define _GMP_NUMBER_FROM_INT_852 (0, 8, 5, 2)
+#define _GMP_NUMBER_FROM_INT_853 (0, 8, 5, 3)
+#define _GMP_NUMBER_FROM_INT_854 (0, 8, 5, 4)
+#define _GMP_NUMBER_FROM_INT_855 (0, 8, 5, 5)
+#define _GMP_NUMBER_FROM_INT_856 (0, 8, 5, 6)
+#define _GMP_NUMBER_FROM_INT_857 (0, 8, 5, 7)
+#define _GMP_NUMBER_FROM_INT_858 (0, 8, 5, 8)
+#define _GMP_NUMBER_FROM_INT_859 (0, 8, 5, 9)
+#define _GMP_NUMBER_FROM_INT_860 (0, 8, 6, 0)
+#define _GMP_NUMBER_FROM_INT_861 (0, 8, 6, 1)
+#define _GMP_NUMBER_FROM_INT_862 (0, 8, 6, 2)
+#define _GMP_NUMBER_FROM_INT_863 (0, 8, 6, 3)
+#define _GMP_NUMBER_FROM_INT_864 (0, 8, 6, 4)
+#define _GMP_NUMBER_FROM_INT_865 (0, 8, 6, 5)
+#define _GMP_NUMBER_FROM_INT_866 (0, 8, 6, 6)
+#define _GMP_NUMBER_FROM_INT_867 (0, 8, 6, 7)
+#define _GMP_NUMBER_FROM_INT_868 (0, 8, 6, 8)
+#define _GMP_NUMBER_FROM_INT_869 (0, 8, 6, 9)
+#define _GMP_NUMBER_FROM_INT_870 (0, 8, 7, 0)
+#define _GMP_NUMBER_FROM_INT_871 (0, 8, 7, 1)
+#define _GMP_NUMBER_FROM_INT_872 (0, 8, 7, 2)
+#define _GMP_NUMBER_FROM_INT_873 (0, 8, 7, 3)
+#define _GMP_NUMBER_FROM_INT_874 (0, 8, 7, 4)
+#define _GMP_NUMBER_FROM_INT_875 (0, 8, 7, 5)
+#define _GMP_NUMBER_FROM_INT_876 (0, 8, 7, 6)
+#define _GMP_NUMBER_FROM_INT_877 (0, 8, 7, 7)
+#define _GMP_NUMBER_FROM_INT_878 (0, 8, 7, 8)
+#define _GMP_NUMBER_FROM_INT_879 (0, 8, 7, 9)
+#define _GMP_NUMBER_FROM_INT_880 (0, 8, 8, 0)
+#define _GMP_NUMBER_FROM_INT_881 (0, 8, 8, 1)
+#define _GMP_NUMBER_FROM_INT_882 (0, 8, 8, 2)
+#define _GMP_NUMBER_FROM_INT_883 (0, 8, 8, 3)
+#define _GMP_NUMBER_FROM_INT_884 (0, 8, 8, 4)
+#define _GMP_NUMBER_FROM_INT_885 (0, 8, 8, 5)
+#define _GMP_NUMBER_FROM_INT_886 (0, 8, 8, 6)
+#define _GMP_NUMBER_FROM_INT_887 (0, 8, 8, 7)
+#define _GMP_NUMBER_FROM_INT_888 (0, 8, 8, 8)
+#define _GMP_NUMBER_FROM_INT_889 (0, 8, 8, 9)
+#define _GMP_NUMBER_FROM_INT_890 (0, 8, 9, 0)
+#define _GMP_NUMBER_FROM_INT_891 (0, 8, 9, 1)
+#define _GMP_NUMBER_FROM_INT_892 (0, 8, 9, 2)
+#define _GMP_NUMBER_FROM_INT_893 (0, 8, 9, 3)
+#define _GMP_NUMBER_FROM_INT_894 (0, 8, 9, 4)
+#define _GMP_NUMBER_FROM_INT_895 (0, 8, 9, 5)
+#define _GMP_NUMBER_FROM_INT_896 (0, 8, 9, 6)
+#define _GMP_NUMBER_FROM_INT_897 (0, 8, 9, 7)
+#define _GMP_NUMBER_FROM_INT_898 (0, 8, 9, 8)
+#define _GMP_NUMBER_FROM_INT_899 (0, 8, 9, 9)
+#define _GMP_NUMBER_FROM_INT_900 (0, 9, 0, 0)
+#define _GMP_NUMBER_FROM_INT_901 (0, 9, 0, 1)
+#define _GMP_NUMBER_FROM_INT_902 (0, 9, 0, 2)
+#define _GMP_NUMBER_FROM_INT_903 (0, 9, 0, 3)
+#define _GMP_NUMBER_FROM_INT_904 (0, 9, 0, 4)
+#define _GMP_NUMBER_FROM_INT_905 (0, 9, 0, 5)
+#define _GMP_NUMBER_FROM_INT_906 (0, 9, 0, 6)
+#define _GMP_NUMBER_FROM_INT_907 (0, 9, 0, 7)
+#define _GMP_NUMBER_FROM_INT_908 (0, 9, 0, 8)
+#define _GMP_NUMBER_FROM_INT_909 (0, 9, 0, 9)
+#define _GMP_NUMBER_FROM_INT_910 (0, 9, 1, 0)
+#define _GMP_NUMBER_FROM_INT_911 (0, 9, 1, 1)
+#define _GMP_NUMBER_FROM_INT_912 (0, 9, 1, 2)
+#define _GMP_NUMBER_FROM_INT_913 (0, 9, 1, 3)
+#define _GMP_NUMBER_FROM_INT_914 (0, 9, 1, 4)
+#define _GMP_NUMBER_FROM_INT_915 (0, 9, 1, 5)
+#define _GMP_NUMBER_FROM_INT_916 (0, 9, 1, 6)
+#define _GMP_NUMBER_FROM_INT_917 (0, 9, 1, 7)
+#define _GMP_NUMBER_FROM_INT_918 (0, 9, 1, 8)
+#define _GMP_NUMBER_FROM_INT_919 (0, 9, 1, 9)
+#define _GMP_NUMBER_FROM_INT_920 (0, 9, 2, 0)
+#define _GMP_NUMBER_FROM_INT_921 (0, 9, 2, 1)
+#define _GMP_NUMBER_FROM_INT_922 (0, 9, 2, 2)
+#define _GMP_NUMBER_FROM_INT_923 (0, 9, 2, 3)
+#define _GMP_NUMBER_FROM_INT_924 (0, 9, 2, 4)
+#define _GMP_NUMBER_FROM_INT_925 (0, 9, 2, 5)
+#define _GMP_NUMBER_FROM_INT_926 (0, 9, 2, 6)
+#define _GMP_NUMBER_FROM_INT_927 (0, 9, 2, 7)
+#define _GMP_NUMBER_FROM_INT_928 (0, 9, 2, 8)
+#define _GMP_NUMBER_FROM_INT_929 (0, 9, 2, 9)
+#define _GMP_NUMBER_FROM_INT_930 (0, 9, 3, 0)
+#define _GMP_NUMBER_FROM_INT_931 (0, 9, 3, 1)
+#define _GMP_NUMBER_FROM_INT_932 (0, 9, 3, 2)
+#define _GMP_NUMBER_FROM_INT_933 (0, 9, 3, 3)
+#define _GMP_NUMBER_FROM_INT_934 (0, 9, 3, 4)
+#define _GMP_NUMBER_FROM_INT_935 (0, 9, 3, 5)
+#define _GMP_NUMBER_FROM_INT_936 (0, 9, 3, 6)
+#define _GMP_NUMBER_FROM_INT_937 (0, 9, 3, 7)
+#define _GMP_NUMBER_FROM_INT_938 (0, 9, 3, 8)
+#define _GMP_NUMBER_FROM_INT_939 (0, 9, 3, 9)
+#define _GMP_NUMBER_FROM_INT_940 (0, 9, 4, 0)
+#define _GMP_NUMBER_FROM_INT_941 (0, 9, 4, 1)
+#define _GMP_NUMBER_FROM_INT_942 (0, 9, 4, 2)
+#define _GMP_NUMBER_FROM_INT_943 (0, 9, 4, 3)
+#define _GMP_NUMBER_FROM_INT_944 (0, 9, 4, 4)
+#define _GMP_NUMBER_FROM_INT_945 (0, 9, 4, 5)
+#define _GMP_NUMBER_FROM_INT_946 (0, 9, 4, 6)
+#define _GMP_NUMBER_FROM_INT_947 (0, 9, 4, 7)
+#define _GMP_NUMBER_FROM_INT_948 (0, 9, 4, 8)
+#define _GMP_NUMBER_FROM_INT_949 (0, 9, 4, 9)
+#define _GMP_NUMBER_FROM_INT_950 (0, 9, 5, 0)
+#define _GMP_NUMBER_FROM_INT_951 (0, 9, 5, 1)
+#define _GMP_NUMBER_FROM_INT_952 (0, 9, 5, 2)
+#define _GMP_NUMBER_FROM_INT_953 (0, 9, 5, 3)
+#define _GMP_NUMBER_FROM_INT_954 (0, 9, 5, 4)
+#define _GMP_NUMBER_FROM_INT_955 (0, 9, 5, 5)
+#define _GMP_NUMBER_FROM_INT_956 (0, 9, 5, 6)
+#define _GMP_NUMBER_FROM_INT_957 (0, 9, 5, 7)
+#define _GMP_NUMBER_FROM_INT_958 (0, 9, 5, 8)
+#define _GMP_NUMBER_FROM_INT_959 (0, 9, 5, 9)
+#define _GMP_NUMBER_FROM_INT_960 (0, 9, 6, 0)
+#define _GMP_NUMBER_FROM_INT_961 (0, 9, 6, 1)
+#define _GMP_NUMBER_FROM_INT_962 (0, 9, 6, 2)
+#define _GMP_NUMBER_FROM_INT_963 (0, 9, 6, 3)
+#define _GMP_NUMBER_FROM_INT_964 (0, 9, 6, 4)
+#define _GMP_NUMBER_FROM_INT_965 (0, 9, 6, 5)
+#define _GMP_NUMBER_FROM_INT_966 (0, 9, 6, 6)
+#define _GMP_NUMBER_FROM_INT_967 (0, 9, 6, 7)
+#define _GMP_NUMBER_FROM_INT_968 (0, 9, 6, 8)
+#define _GMP_NUMBER_FROM_INT_969 (0, 9, 6, 9)
+#define _GMP_NUMBER_FROM_INT_970 (0, 9, 7, 0)
+#define _GMP_NUMBER_FROM_INT_971 (0, 9, 7, 1)
+#define _GMP_NUMBER_FROM_INT_972 (0, 9, 7, 2)
+#define _GMP_NUMBER_FROM_INT_973 (0, 9, 7, 3)
+#define _GMP_NUMBER_FROM_INT_974 (0, 9, 7, 4)
+#define _GMP_NUMBER_FROM_INT_975 (0, 9, 7, 5)
+#define _GMP_NUMBER_FROM_INT_976 (0, 9, 7, 6)
+#define _GMP_NUMBER_FROM_INT_977 (0, 9, 7, 7)
+#define _GMP_NUMBER_FROM_INT_978 (0, 9, 7, 8)
+#define _GMP_NUMBER_FROM_INT_979 (0, 9, 7, 9)
+#define _GMP_NUMBER_FROM_INT_980 (0, 9, 8, 0)
+#define _GMP_NUMBER_FROM_INT_981 (0, 9, 8, 1)
+#define _GMP_NUMBER_FROM_INT_982 (0, 9, 8, 2)
+#define _GMP_NUMBER_FROM_INT_983 (0, 9, 8, 3)
+#define _GMP_NUMBER_FROM_INT_984 (0, 9, 8, 4)
+#define _GMP_NUMBER_FROM_INT_985 (0, 9, 8, 5)
+#define _GMP_NUMBER_FROM_INT_986 (0, 9, 8, 6)
+#define _GMP_NUMBER_FROM_INT_987 (0, 9, 8, 7)
+#define _GMP_NUMBER_FROM_INT_988 (0, 9, 8, 8)
+#define _GMP_NUMBER_FROM_INT_989 (0, 9, 8, 9)
+#define _GMP_NUMBER_FROM_INT_990 (0, 9, 9, 0)
+#define _GMP_NUMBER_FROM_INT_991 (0, 9, 9, 1)
+#define _GMP_NUMBER_FROM_INT_992 (0, 9, 9, 2)
+#define _GMP_NUMBER_FROM_INT_993 (0, 9, 9, 3)
+#define _GMP_NUMBER_FROM_INT_994 (0, 9, 9, 4)
+#define _GMP_NUMBER_FROM_INT_995 (0, 9, 9, 5)
+#define _GMP_NUMBER_FROM_INT_996 (0, 9, 9, 6)
+#define _GMP_NUMBER_FROM_INT_997 (0, 9, 9, 7)
+#define _GMP_NUMBER_FROM_INT_998 (0, 9, 9, 8)
+#define _GMP_NUMBER_FROM_INT_999 (0, 9, 9, 9)
+#define _GMP_NUMBER_FROM_INT_1000 (1, 0, 0, 0)
+#define _GMP_NUMBER_FROM_INT_1001 (1, 0, 0, 1)
+#define _GMP_NUMBER_FROM_INT_1002 (1, 0, 0, 2)
+#define _GMP_NUMBER_FROM_INT_1003 (1, 0, 0, 3)
+#define _GMP_NUMBER_FROM_INT_1004 (1, 0, 0, 4)
+#define _GMP_NUMBER_FROM_INT_1005 (1, 0, 0, 5)
+#define _GMP_NUMBER_FROM_INT_1006 (1, 0, 0, 6)
+#define _GMP_NUMBER_FROM_INT_1007 (1, 0, 0, 7)
+#define _GMP_NUMBER_FROM_INT_1008 (1, 0, 0, 8)
+#define _GMP_NUMBER_FROM_INT_1009 (1, 0, 0, 9)
+#define _GMP_NUMBER_FROM_INT_1010 (1, 0, 1, 0)
+#define _GMP_NUMBER_FROM_INT_1011 (1, 0, 1, 1)
+#define _GMP_NUMBER_FROM_INT_1012 (1, 0, 1, 2)
+#define _GMP_NUMBER_FROM_INT_1013 (1, 0, 1, 3)
+#define _GMP_NUMBER_FROM_INT_1014 (1, 0, 1, 4)
+#define _GMP_NUMBER_FROM_INT_1015 (1, 0, 1, 5)
+#define _GMP_NUMBER_FROM_INT_1016 (1, 0, 1, 6)
+#define _GMP_NUMBER_FROM_INT_1017 (1, 0, 1, 7)
+#define _GMP_NUMBER_FROM_INT_1018 (1, 0, 1, 8)
+#define _GMP_NUMBER_FROM_INT_1019 (1, 0, 1, 9)
+#define _GMP_NUMBER_FROM_INT_1020 (1, 0, 2, 0)
+#define _GMP_NUMBER_FROM_INT_1021 (1, 0, 2, 1)
+#define _GMP_NUMBER_FROM_INT_1022 (1, 0, 2, 2)
+#define _GMP_NUMBER_FROM_INT_1023 (1, 0, 2, 3)
+#define _GMP_NUMBER_FROM_INT_1024 (1, 0, 2, 4)
+
+#endif // GMP_MACRO_LIMITS_NUMBER_1024_HPP_
@@ -0,0 +1,263 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_NUMBER_254_HPP_
+#define GMP_MACRO_LIMITS_NUMBER_254_HPP_
+
+// GMP_NUMBER_FROM_INT
+#define _GMP_NUMBER_FROM_INT_0 (0, 0, 0, 0)
+#define _GMP_NUMBER_FROM_INT_1 (0, 0, 0, 1)
+#define _GMP_NUMBER_FROM_INT_2 (0, 0, 0, 2)
+#define _GMP_NUMBER_FROM_INT_3 (0, 0, 0, 3)
+#define _GMP_NUMBER_FROM_INT_4 (0, 0, 0, 4)
+#define _GMP_NUMBER_FROM_INT_5 (0, 0, 0, 5)
+#define _GMP_NUMBER_FROM_INT_6 (0, 0, 0, 6)
+#define _GMP_NUMBER_FROM_INT_7 (0, 0, 0, 7)
+#define _GMP_NUMBER_FROM_INT_8 (0, 0, 0, 8)
+#define _GMP_NUMBER_FROM_INT_9 (0, 0, 0, 9)
+#define _GMP_NUMBER_FROM_INT_10 (0, 0, 1, 0)
+#define _GMP_NUMBER_FROM_INT_11 (0, 0, 1, 1)
+#define _GMP_NUMBER_FROM_INT_12 (0, 0, 1, 2)
+#define _GMP_NUMBER_FROM_INT_13 (0, 0, 1, 3)
+#define _GMP_NUMBER_FROM_INT_14 (0, 0, 1, 4)
+#define _GMP_NUMBER_FROM_INT_15 (0, 0, 1, 5)
+#define _GMP_NUMBER_FROM_INT_16 (0, 0, 1, 6)
+#define _GMP_NUMBER_FROM_INT_17 (0, 0, 1, 7)
+#define _GMP_NUMBER_FROM_INT_18 (0, 0, 1, 8)
+#define _GMP_NUMBER_FROM_INT_19 (0, 0, 1, 9)
+#define _GMP_NUMBER_FROM_INT_20 (0, 0, 2, 0)
+#define _GMP_NUMBER_FROM_INT_21 (0, 0, 2, 1)
+#define _GMP_NUMBER_FROM_INT_22 (0, 0, 2, 2)
+#define _GMP_NUMBER_FROM_INT_23 (0, 0, 2, 3)
+#define _GMP_NUMBER_FROM_INT_24 (0, 0, 2, 4)
+#define _GMP_NUMBER_FROM_INT_25 (0, 0, 2, 5)
+#define _GMP_NUMBER_FROM_INT_26 (0, 0, 2, 6)
+#define _GMP_NUMBER_FROM_INT_27 (0, 0, 2, 7)
+#define _GMP_NUMBER_FROM_INT_28 (0, 0, 2, 8)
+#define _GMP_NUMBER_FROM_INT_29 (0, 0, 2, 9)
+#define _GMP_NUMBER_FROM_INT_30 (0, 0, 3, 0)
+#define _GMP_NUMBER_FROM_INT_31 (0, 0, 3, 1)
+#define _GMP_NUMBER_FROM_INT_32 (0, 0, 3, 2)
+#define _GMP_NUMBER_FROM_INT_33 (0, 0, 3, 3)
+#define _GMP_NUMBER_FROM_INT_34 (0, 0, 3, 4)
+#define _GMP_NUMBER_FROM_INT_35 (0, 0, 3, 5)
+#define _GMP_NUMBER_FROM_INT_36 (0, 0, 3, 6)
+#define _GMP_NUMBER_FROM_INT_37 (0, 0, 3, 7)
+#define _GMP_NUMBER_FROM_INT_38 (0, 0, 3, 8)
+#define _GMP_NUMBER_FROM_INT_39 (0, 0, 3, 9)
+#define _GMP_NUMBER_FROM_INT_40 (0, 0, 4, 0)
+#define _GMP_NUMBER_FROM_INT_41 (0, 0, 4, 1)
+#define _GMP_NUMBER_FROM_INT_42 (0, 0, 4, 2)
+#define _GMP_NUMBER_FROM_INT_43 (0, 0, 4, 3)
+#define _GMP_NUMBER_FROM_INT_44 (0, 0, 4, 4)
+#define _GMP_NUMBER_FROM_INT_45 (0, 0, 4, 5)
+#define _GMP_NUMBER_FROM_INT_46 (0, 0, 4, 6)
+#define _GMP_NUMBER_FROM_INT_47 (0, 0, 4, 7)
+#define _GMP_NUMBER_FROM_INT_48 (0, 0, 4, 8)
+#define _GMP_NUMBER_FROM_INT_49 (0, 0, 4, 9)
+#define _GMP_NUMBER_FROM_INT_50 (0, 0, 5, 0)
+#define _GMP_NUMBER_FROM_INT_51 (0, 0, 5, 1)
+#define _GMP_NUMBER_FROM_INT_52 (0, 0, 5, 2)
+#define _GMP_NUMBER_FROM_INT_53 (0, 0, 5, 3)
+#define _GMP_NUMBER_FROM_INT_54 (0, 0, 5, 4)
+#define _GMP_NUMBER_FROM_INT_55 (0, 0, 5, 5)
+#define _GMP_NUMBER_FROM_INT_56 (0, 0, 5, 6)
+#define _GMP_NUMBER_FROM_INT_57 (0, 0, 5, 7)
+#define _GMP_NUMBER_FROM_INT_58 (0, 0, 5, 8)
+#define _GMP_NUMBER_FROM_INT_59 (0, 0, 5, 9)
+#define _GMP_NUMBER_FROM_INT_60 (0, 0, 6, 0)
+#define _GMP_NUMBER_FROM_INT_61 (0, 0, 6, 1)
+#define _GMP_NUMBER_FROM_INT_62 (0, 0, 6, 2)
+#define _GMP_NUMBER_FROM_INT_63 (0, 0, 6, 3)
+#define _GMP_NUMBER_FROM_INT_64 (0, 0, 6, 4)
+#define _GMP_NUMBER_FROM_INT_65 (0, 0, 6, 5)
+#define _GMP_NUMBER_FROM_INT_66 (0, 0, 6, 6)
+#define _GMP_NUMBER_FROM_INT_67 (0, 0, 6, 7)
+#define _GMP_NUMBER_FROM_INT_68 (0, 0, 6, 8)
+#define _GMP_NUMBER_FROM_INT_69 (0, 0, 6, 9)
+#define _GMP_NUMBER_FROM_INT_70 (0, 0, 7, 0)
+#define _GMP_NUMBER_FROM_INT_71 (0, 0, 7, 1)
+#define _GMP_NUMBER_FROM_INT_72 (0, 0, 7, 2)
+#define _GMP_NUMBER_FROM_INT_73 (0, 0, 7, 3)
+#define _GMP_NUMBER_FROM_INT_74 (0, 0, 7, 4)
+#define _GMP_NUMBER_FROM_INT_75 (0, 0, 7, 5)
+#define _GMP_NUMBER_FROM_INT_76 (0, 0, 7, 6)
+#define _GMP_NUMBER_FROM_INT_77 (0, 0, 7, 7)
+#define _GMP_NUMBER_FROM_INT_78 (0, 0, 7, 8)
+#define _GMP_NUMBER_FROM_INT_79 (0, 0, 7, 9)
+#define _GMP_NUMBER_FROM_INT_80 (0, 0, 8, 0)
+#define _GMP_NUMBER_FROM_INT_81 (0, 0, 8, 1)
+#define _GMP_NUMBER_FROM_INT_82 (0, 0, 8, 2)
+#define _GMP_NUMBER_FROM_INT_83 (0, 0, 8, 3)
+#define _GMP_NUMBER_FROM_INT_84 (0, 0, 8, 4)
+#define _GMP_NUMBER_FROM_INT_85 (0, 0, 8, 5)
+#define _GMP_NUMBER_FROM_INT_86 (0, 0, 8, 6)
+#define _GMP_NUMBER_FROM_INT_87 (0, 0, 8, 7)
+#define _GMP_NUMBER_FROM_INT_88 (0, 0, 8, 8)
+#define _GMP_NUMBER_FROM_INT_89 (0, 0, 8, 9)
+#define _GMP_NUMBER_FROM_INT_90 (0, 0, 9, 0)
+#define _GMP_NUMBER_FROM_INT_91 (0, 0, 9, 1)
+#define _GMP_NUMBER_FROM_INT_92 (0, 0, 9, 2)
+#define _GMP_NUMBER_FROM_INT_93 (0, 0, 9, 3)
+#define _GMP_NUMBER_FROM_INT_94 (0, 0, 9, 4)
+#define _GMP_NUMBER_FROM_INT_95 (0, 0, 9, 5)
+#define _GMP_NUMBER_FROM_INT_96 (0, 0, 9, 6)
+#define _GMP_NUMBER_FROM_INT_97 (0, 0, 9, 7)
+#define _GMP_NUMBER_FROM_INT_98 (0, 0, 9, 8)
+#define _GMP_NUMBER_FROM_INT_99 (0, 0, 9, 9)
+#define _GMP_NUMBER_FROM_INT_100 (0, 1, 0, 0)
+#define _GMP_NUMBER_FROM_INT_101 (0, 1, 0, 1)
+#define _GMP_NUMBER_FROM_INT_102 (0, 1, 0, 2)
+#define _GMP_NUMBER_FROM_INT_103 (0, 1, 0, 3)
+#define _GMP_NUMBER_FROM_INT_104 (0, 1, 0, 4)
+#define _GMP_NUMBER_FROM_INT_105 (0, 1, 0, 5)
+#define _GMP_NUMBER_FROM_INT_106 (0, 1, 0, 6)
+#define _GMP_NUMBER_FROM_INT_107 (0, 1, 0, 7)
+#define _GMP_NUMBER_FROM_INT_108 (0, 1, 0, 8)
+#define _GMP_NUMBER_FROM_INT_109 (0, 1, 0, 9)
+#define _GMP_NUMBER_FROM_INT_110 (0, 1, 1, 0)
+#define _GMP_NUMBER_FROM_INT_111 (0, 1, 1, 1)
+#define _GMP_NUMBER_FROM_INT_112 (0, 1, 1, 2)
+#define _GMP_NUMBER_FROM_INT_113 (0, 1, 1, 3)
+#define _GMP_NUMBER_FROM_INT_114 (0, 1, 1, 4)
+#define _GMP_NUMBER_FROM_INT_115 (0, 1, 1, 5)
+#define _GMP_NUMBER_FROM_INT_116 (0, 1, 1, 6)
+#define _GMP_NUMBER_FROM_INT_117 (0, 1, 1, 7)
+#define _GMP_NUMBER_FROM_INT_118 (0, 1, 1, 8)
+#define _GMP_NUMBER_FROM_INT_119 (0, 1, 1, 9)
+#define _GMP_NUMBER_FROM_INT_120 (0, 1, 2, 0)
+#define _GMP_NUMBER_FROM_INT_121 (0, 1, 2, 1)
+#define _GMP_NUMBER_FROM_INT_122 (0, 1, 2, 2)
+#define _GMP_NUMBER_FROM_INT_123 (0, 1, 2, 3)
+#define _GMP_NUMBER_FROM_INT_124 (0, 1, 2, 4)
+#define _GMP_NUMBER_FROM_INT_125 (0, 1, 2, 5)
+#define _GMP_NUMBER_FROM_INT_126 (0, 1, 2, 6)
+#define _GMP_NUMBER_FROM_INT_127 (0, 1, 2, 7)
+#define _GMP_NUMBER_FROM_INT_128 (0, 1, 2, 8)
+#define _GMP_NUMBER_FROM_INT_129 (0, 1, 2, 9)
+#define _GMP_NUMBER_FROM_INT_130 (0, 1, 3, 0)
+#define _GMP_NUMBER_FROM_INT_131 (0, 1, 3, 1)
+#define _GMP_NUMBER_FROM_INT_132 (0, 1, 3, 2)
+#define _GMP_NUMBER_FROM_INT_133 (0, 1, 3, 3)
+#define _GMP_NUMBER_FROM_INT_134 (0, 1, 3, 4)
+#define _GMP_NUMBER_FROM_INT_135 (0, 1, 3, 5)
+#define _GMP_NUMBER_FROM_INT_136 (0, 1, 3, 6)
+#define _GMP_NUMBER_FROM_INT_137 (0, 1, 3, 7)
+#define _GMP_NUMBER_FROM_INT_138 (0, 1, 3, 8)
+#define _GMP_NUMBER_FROM_INT_139 (0, 1, 3, 9)
+#define _GMP_NUMBER_FROM_INT_140 (0, 1, 4, 0)
+#define _GMP_NUMBER_FROM_INT_141 (0, 1, 4, 1)
+#define _GMP_NUMBER_FROM_INT_142 (0, 1, 4, 2)
+#define _GMP_NUMBER_FROM_INT_143 (0, 1, 4, 3)
+#define _GMP_NUMBER_FROM_INT_144 (0, 1, 4, 4)
+#define _GMP_NUMBER_FROM_INT_145 (0, 1, 4, 5)
+#define _GMP_NUMBER_FROM_INT_146 (0, 1, 4, 6)
+#define _GMP_NUMBER_FROM_INT_147 (0, 1, 4, 7)
+#define _GMP_NUMBER_FROM_INT_148 (0, 1, 4, 8)
+#define _GMP_NUMBER_FROM_INT_149 (0, 1, 4, 9)
+#define _GMP_NUMBER_FROM_INT_150 (0, 1, 5, 0)
+#define _GMP_NUMBER_FROM_INT_151 (0, 1, 5, 1)
+#define _GMP_NUMBER_FROM_INT_152 (0, 1, 5, 2)
+#define _GMP_NUMBER_FROM_INT_153 (0, 1, 5, 3)
+#define _GMP_NUMBER_FROM_INT_154 (0, 1, 5, 4)
+#define _GMP_NUMBER_FROM_INT_155 (0, 1, 5, 5)
+#define _GMP_NUMBER_FROM_INT_156 (0, 1, 5, 6)
+#define _GMP_NUMBER_FROM_INT_157 (0, 1, 5, 7)
+#define _GMP_NUMBER_FROM_INT_158 (0, 1, 5, 8)
+#define _GMP_NUMBER_FROM_INT_159 (0, 1, 5, 9)
+#define _GMP_NUMBER_FROM_INT_160 (0, 1, 6, 0)
+#define _GMP_NUMBER_FROM_INT_161 (0, 1, 6, 1)
+#define _GMP_NUMBER_FROM_INT_162 (0, 1, 6, 2)
+#define _GMP_NUMBER_FROM_INT_163 (0, 1, 6, 3)
+#define _GMP_NUMBER_FROM_INT_164 (0, 1, 6, 4)
+#define _GMP_NUMBER_FROM_INT_165 (0, 1, 6, 5)
+#define _GMP_NUMBER_FROM_INT_166 (0, 1, 6, 6)
+#define _GMP_NUMBER_FROM_INT_167 (0, 1, 6, 7)
+#define _GMP_NUMBER_FROM_INT_168 (0, 1, 6, 8)
+#define _GMP_NUMBER_FROM_INT_169 (0, 1, 6, 9)
+#define _GMP_NUMBER_FROM_INT_170 (0, 1, 7, 0)
+#define _GMP_NUMBER_FROM_INT_171 (0, 1, 7, 1)
+#define _GMP_NUMBER_FROM_INT_172 (0, 1, 7, 2)
+#define _GMP_NUMBER_FROM_INT_173 (0, 1, 7, 3)
+#define _GMP_NUMBER_FROM_INT_174 (0, 1, 7, 4)
+#define _GMP_NUMBER_FROM_INT_175 (0, 1, 7, 5)
+#define _GMP_NUMBER_FROM_INT_176 (0, 1, 7, 6)
+#define _GMP_NUMBER_FROM_INT_177 (0, 1, 7, 7)
+#define _GMP_NUMBER_FROM_INT_178 (0, 1, 7, 8)
+#define _GMP_NUMBER_FROM_INT_179 (0, 1, 7, 9)
+#define _GMP_NUMBER_FROM_INT_180 (0, 1, 8, 0)
+#define _GMP_NUMBER_FROM_INT_181 (0, 1, 8, 1)
+#define _GMP_NUMBER_FROM_INT_182 (0, 1, 8, 2)
+#define _GMP_NUMBER_FROM_INT_183 (0, 1, 8, 3)
+#define _GMP_NUMBER_FROM_INT_184 (0, 1, 8, 4)
+#define _GMP_NUMBER_FROM_INT_185 (0, 1, 8, 5)
+#define _GMP_NUMBER_FROM_INT_186 (0, 1, 8, 6)
+#define _GMP_NUMBER_FROM_INT_187 (0, 1, 8, 7)
+#define _GMP_NUMBER_FROM_INT_188 (0, 1, 8, 8)
+#define _GMP_NUMBER_FROM_INT_189 (0, 1, 8, 9)
+#define _GMP_NUMBER_FROM_INT_190 (0, 1, 9, 0)
+#define _GMP_NUMBER_FROM_INT_191 (0, 1, 9, 1)
+#define _GMP_NUMBER_FROM_INT_192 (0, 1, 9, 2)
+#define _GMP_NUMBER_FROM_INT_193 (0, 1, 9, 3)
+#define _GMP_NUMBER_FROM_INT_194 (0, 1, 9, 4)
+#define _GMP_NUMBER_FROM_INT_195 (0, 1, 9, 5)
+#define _GMP_NUMBER_FROM_INT_196 (0, 1, 9, 6)
+#define _GMP_NUMBER_FROM_INT_197 (0, 1, 9, 7)
+#define _GMP_NUMBER_FROM_INT_198 (0, 1, 9, 8)
+#define _GMP_NUMBER_FROM_INT_199 (0, 1, 9, 9)
+#define _GMP_NUMBER_FROM_INT_200 (0, 2, 0, 0)
+#define _GMP_NUMBER_FROM_INT_201 (0, 2, 0, 1)
+#define _GMP_NUMBER_FROM_INT_202 (0, 2, 0, 2)
+#define _GMP_NUMBER_FROM_INT_203 (0, 2, 0, 3)
+#define _GMP_NUMBER_FROM_INT_204 (0, 2, 0, 4)
+#define _GMP_NUMBER_FROM_INT_205 (0, 2, 0, 5)
+#define _GMP_NUMBER_FROM_INT_206 (0, 2, 0, 6)
+#define _GMP_NUMBER_FROM_INT_207 (0, 2, 0, 7)
+#define _GMP_NUMBER_FROM_INT_208 (0, 2, 0, 8)
+#define _GMP_NUMBER_FROM_INT_209 (0, 2, 0, 9)
+#define _GMP_NUMBER_FROM_INT_210 (0, 2, 1, 0)
+#define _GMP_NUMBER_FROM_INT_211 (0, 2, 1, 1)
+#define _GMP_NUMBER_FROM_INT_212 (0, 2, 1, 2)
+#define _GMP_NUMBER_FROM_INT_213 (0, 2, 1, 3)
+#define _GMP_NUMBER_FROM_INT_214 (0, 2, 1, 4)
+#define _GMP_NUMBER_FROM_INT_215 (0, 2, 1, 5)
+#define _GMP_NUMBER_FROM_INT_216 (0, 2, 1, 6)
+#define _GMP_NUMBER_FROM_INT_217 (0, 2, 1, 7)
+#define _GMP_NUMBER_FROM_INT_218 (0, 2, 1, 8)
+#define _GMP_NUMBER_FROM_INT_219 (0, 2, 1, 9)
+#define _GMP_NUMBER_FROM_INT_220 (0, 2, 2, 0)
+#define _GMP_NUMBER_FROM_INT_221 (0, 2, 2, 1)
+#define _GMP_NUMBER_FROM_INT_222 (0, 2, 2, 2)
+#define _GMP_NUMBER_FROM_INT_223 (0, 2, 2, 3)
+#define _GMP_NUMBER_FROM_INT_224 (0, 2, 2, 4)
+#define _GMP_NUMBER_FROM_INT_225 (0, 2, 2, 5)
+#define _GMP_NUMBER_FROM_INT_226 (0, 2, 2, 6)
+#define _GMP_NUMBER_FROM_INT_227 (0, 2, 2, 7)
+#define _GMP_NUMBER_FROM_INT_228 (0, 2, 2, 8)
+#define _GMP_NUMBER_FROM_INT_229 (0, 2, 2, 9)
+#define _GMP_NUMBER_FROM_INT_230 (0, 2, 3, 0)
+#define _GMP_NUMBER_FROM_INT_231 (0, 2, 3, 1)
+#define _GMP_NUMBER_FROM_INT_232 (0, 2, 3, 2)
+#define _GMP_NUMBER_FROM_INT_233 (0, 2, 3, 3)
+#define _GMP_NUMBER_FROM_INT_234 (0, 2, 3, 4)
+#define _GMP_NUMBER_FROM_INT_235 (0, 2, 3, 5)
+#define _GMP_NUMBER_FROM_INT_236 (0, 2, 3, 6)
+#define _GMP_NUMBER_FROM_INT_237 (0, 2, 3, 7)
+#define _GMP_NUMBER_FROM_INT_238 (0, 2, 3, 8)
+#define _GMP_NUMBER_FROM_INT_239 (0, 2, 3, 9)
+#define _GMP_NUMBER_FROM_INT_240 (0, 2, 4, 0)
+#define _GMP_NUMBER_FROM_INT_241 (0, 2, 4, 1)
+#define _GMP_NUMBER_FROM_INT_242 (0, 2, 4, 2)
+#define _GMP_NUMBER_FROM_INT_243 (0, 2, 4, 3)
+#define _GMP_NUMBER_FROM_INT_244 (0, 2, 4, 4)
+#define _GMP_NUMBER_FROM_INT_245 (0, 2, 4, 5)
+#define _GMP_NUMBER_FROM_INT_246 (0, 2, 4, 6)
+#define _GMP_NUMBER_FROM_INT_247 (0, 2, 4, 7)
+#define _GMP_NUMBER_FROM_INT_248 (0, 2, 4, 8)
+#define _GMP_NUMBER_FROM_INT_249 (0, 2, 4, 9)
+#define _GMP_NUMBER_FROM_INT_250 (0, 2, 5, 0)
+#define _GMP_NUMBER_FROM_INT_251 (0, 2, 5, 1)
+#define _GMP_NUMBER_FROM_INT_252 (0, 2, 5, 2)
+#define _GMP_NUMBER_FROM_INT_253 (0, 2, 5, 3)
+#define _GMP_NUMBER_FROM_INT_254 (0, 2, 5, 4)
+
+#endif // GMP_MACRO_LIMITS_NUMBER_254_HPP_
@@ -0,0 +1,73 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_NUMBER_64_HPP_
+#define GMP_MACRO_LIMITS_NUMBER_64_HPP_
+
+// GMP_NUMBER_FROM_INT
+#define _GMP_NUMBER_FROM_INT_0 (0, 0, 0, 0)
+#define _GMP_NUMBER_FROM_INT_1 (0, 0, 0, 1)
+#define _GMP_NUMBER_FROM_INT_2 (0, 0, 0, 2)
+#define _GMP_NUMBER_FROM_INT_3 (0, 0, 0, 3)
+#define _GMP_NUMBER_FROM_INT_4 (0, 0, 0, 4)
+#define _GMP_NUMBER_FROM_INT_5 (0, 0, 0, 5)
+#define _GMP_NUMBER_FROM_INT_6 (0, 0, 0, 6)
+#define _GMP_NUMBER_FROM_INT_7 (0, 0, 0, 7)
+#define _GMP_NUMBER_FROM_INT_8 (0, 0, 0, 8)
+#define _GMP_NUMBER_FROM_INT_9 (0, 0, 0, 9)
+#define _GMP_NUMBER_FROM_INT_10 (0, 0, 1, 0)
+#define _GMP_NUMBER_FROM_INT_11 (0, 0, 1, 1)
+#define _GMP_NUMBER_FROM_INT_12 (0, 0, 1, 2)
+#define _GMP_NUMBER_FROM_INT_13 (0, 0, 1, 3)
+#define _GMP_NUMBER_FROM_INT_14 (0, 0, 1, 4)
+#define _GMP_NUMBER_FROM_INT_15 (0, 0, 1, 5)
+#define _GMP_NUMBER_FROM_INT_16 (0, 0, 1, 6)
+#define _GMP_NUMBER_FROM_INT_17 (0, 0, 1, 7)
+#define _GMP_NUMBER_FROM_INT_18 (0, 0, 1, 8)
+#define _GMP_NUMBER_FROM_INT_19 (0, 0, 1, 9)
+#define _GMP_NUMBER_FROM_INT_20 (0, 0, 2, 0)
+#define _GMP_NUMBER_FROM_INT_21 (0, 0, 2, 1)
+#define _GMP_NUMBER_FROM_INT_22 (0, 0, 2, 2)
+#define _GMP_NUMBER_FROM_INT_23 (0, 0, 2, 3)
+#define _GMP_NUMBER_FROM_INT_24 (0, 0, 2, 4)
+#define _GMP_NUMBER_FROM_INT_25 (0, 0, 2, 5)
+#define _GMP_NUMBER_FROM_INT_26 (0, 0, 2, 6)
+#define _GMP_NUMBER_FROM_INT_27 (0, 0, 2, 7)
+#define _GMP_NUMBER_FROM_INT_28 (0, 0, 2, 8)
+#define _GMP_NUMBER_FROM_INT_29 (0, 0, 2, 9)
+#define _GMP_NUMBER_FROM_INT_30 (0, 0, 3, 0)
+#define _GMP_NUMBER_FROM_INT_31 (0, 0, 3, 1)
+#define _GMP_NUMBER_FROM_INT_32 (0, 0, 3, 2)
+#define _GMP_NUMBER_FROM_INT_33 (0, 0, 3, 3)
+#define _GMP_NUMBER_FROM_INT_34 (0, 0, 3, 4)
+#define _GMP_NUMBER_FROM_INT_35 (0, 0, 3, 5)
+#define _GMP_NUMBER_FROM_INT_36 (0, 0, 3, 6)
+#define _GMP_NUMBER_FROM_INT_37 (0, 0, 3, 7)
+#define _GMP_NUMBER_FROM_INT_38 (0, 0, 3, 8)
+#define _GMP_NUMBER_FROM_INT_39 (0, 0, 3, 9)
+#define _GMP_NUMBER_FROM_INT_40 (0, 0, 4, 0)
+#define _GMP_NUMBER_FROM_INT_41 (0, 0, 4, 1)
+#define _GMP_NUMBER_FROM_INT_42 (0, 0, 4, 2)
+#define _GMP_NUMBER_FROM_INT_43 (0, 0, 4, 3)
+#define _GMP_NUMBER_FROM_INT_44 (0, 0, 4, 4)
+#define _GMP_NUMBER_FROM_INT_45 (0, 0, 4, 5)
+#define _GMP_NUMBER_FROM_INT_46 (0, 0, 4, 6)
+#define _GMP_NUMBER_FROM_INT_47 (0, 0, 4, 7)
+#define _GMP_NUMBER_FROM_INT_48 (0, 0, 4, 8)
+#define _GMP_NUMBER_FROM_INT_49 (0, 0, 4, 9)
+#define _GMP_NUMBER_FROM_INT_50 (0, 0, 5, 0)
+#define _GMP_NUMBER_FROM_INT_51 (0, 0, 5, 1)
+#define _GMP_NUMBER_FROM_INT_52 (0, 0, 5, 2)
+#define _GMP_NUMBER_FROM_INT_53 (0, 0, 5, 3)
+#define _GMP_NUMBER_FROM_INT_54 (0, 0, 5, 4)
+#define _GMP_NUMBER_FROM_INT_55 (0, 0, 5, 5)
+#define _GMP_NUMBER_FROM_INT_56 (0, 0, 5, 6)
+#define _GMP_NUMBER_FROM_INT_57 (0, 0, 5, 7)
+#define _GMP_NUMBER_FROM_INT_58 (0, 0, 5, 8)
+#define _GMP_NUMBER_FROM_INT_59 (0, 0, 5, 9)
+#define _GMP_NUMBER_FROM_INT_60 (0, 0, 6, 0)
+#define _GMP_NUMBER_FROM_INT_61 (0, 0, 6, 1)
+#define _GMP_NUMBER_FROM_INT_62 (0, 0, 6, 2)
+#define _GMP_NUMBER_FROM_INT_63 (0, 0, 6, 3)
+#define _GMP_NUMBER_FROM_INT_64 (0, 0, 6, 4)
+
+#endif // GMP_MACRO_LIMITS_NUMBER_64_HPP_
@@ -0,0 +1,2060 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_REPEAT_1024_HPP_
+#define GMP_MACRO_LIMITS_REPEAT_1024_HPP_
+
+// GMP_REPEAT
+#define _GMP_REPEAT_0(call, data)
+#define _GMP_REPEAT_1(call, data) _GMP_REPEAT_0(call, data) call(0, data)
+#define _GMP_REPEAT_2(call, data) _GMP_REPEAT_1(call, data) call(1, data)
+#define _GMP_REPEAT_3(call, data) _GMP_REPEAT_2(call, data) call(2, data)
+#define _GMP_REPEAT_4(call, data) _GMP_REPEAT_3(call, data) call(3, data)
+#define _GMP_REPEAT_5(call, data) _GMP_REPEAT_4(call, data) call(4, data)
+#define _GMP_REPEAT_6(call, data) _GMP_REPEAT_5(call, data) call(5, data)
+#define _GMP_REPEAT_7(call, data) _GMP_REPEAT_6(call, data) call(6, data)
+#define _GMP_REPEAT_8(call, data) _GMP_REPEAT_7(call, data) call(7, data)
+#define _GMP_REPEAT_9(call, data) _GMP_REPEAT_8(call, data) call(8, data)
+#define _GMP_REPEAT_10(call, data) _GMP_REPEAT_9(call, data) call(9, data)
+#define _GMP_REPEAT_11(call, data) _GMP_REPEAT_10(call, data) call(10, data)
+#define _GMP_REPEAT_12(call, data) _GMP_REPEAT_11(call, data) call(11, data)
+#define _GMP_REPEAT_13(call, data) _GMP_REPEAT_12(call, data) call(12, data)
+#define _GMP_REPEAT_14(call, data) _GMP_REPEAT_13(call, data) call(13, data)
+#define _GMP_REPEAT_15(call, data) _GMP_REPEAT_14(call, data) call(14, data)
+#define _GMP_REPEAT_16(call, data) _GMP_REPEAT_15(call, data) call(15, data)
+#define _GMP_REPEAT_17(call, data) _GMP_REPEAT_16(call, data) call(16, data)
+#define _GMP_REPEAT_18(call, data) _GMP_REPEAT_17(call, data) call(17, data)
+#define _GMP_REPEAT_19(call, data) _GMP_REPEAT_18(call, data) call(18, data)
+#define _GMP_REPEAT_20(call, data) _GMP_REPEAT_19(call, data) call(19, data)
+#define _GMP_REPEAT_21(call, data) _GMP_REPEAT_20(call, data) call(20, data)
+#define _GMP_REPEAT_22(call, data) _GMP_REPEAT_21(call, data) call(21, data)
+#define _GMP_REPEAT_23(call, data) _GMP_REPEAT_22(call, data) call(22, data)
+#define _GMP_REPEAT_24(call, data) _GMP_REPEAT_23(call, data) call(23, data)
+#define _GMP_REPEAT_25(call, data) _GMP_REPEAT_24(call, data) call(24, data)
+#define _GMP_REPEAT_26(call, data) _GMP_REPEAT_25(call, data) call(25, data)
+#define _GMP_REPEAT_27(call, data) _GMP_REPEAT_26(call, data) call(26, data)
+#define _GMP_REPEAT_28(call, data) _GMP_REPEAT_27(call, data) call(27, data)
+#define _GMP_REPEAT_29(call, data) _GMP_REPEAT_28(call, data) call(28, data)
+#define _GMP_REPEAT_30(call, data) _GMP_REPEAT_29(call, data) call(29, data)
+#define _GMP_REPEAT_31(call, data) _GMP_REPEAT_30(call, data) call(30, data)
+#define _GMP_REPEAT_32(call, data) _GMP_REPEAT_31(call, data) call(31, data)
+#define _GMP_REPEAT_33(call, data) _GMP_REPEAT_32(call, data) call(32, data)
+#define _GMP_REPEAT_34(call, data) _GMP_REPEAT_33(call, data) call(33, data)
+#define _GMP_REPEAT_35(call, data) _GMP_REPEAT_34(call, data) call(34, data)
+#define _GMP_REPEAT_36(call, data) _GMP_REPEAT_35(call, data) call(35, data)
+#define _GMP_REPEAT_37(call, data) _GMP_REPEAT_36(call, data) call(36, data)
+#define _GMP_REPEAT_38(call, data) _GMP_REPEAT_37(call, data) call(37, data)
+#define _GMP_REPEAT_39(call, data) _GMP_REPEAT_38(call, data) call(38, data)
+#define _GMP_REPEAT_40(call, data) _GMP_REPEAT_39(call, data) call(39, data)
+#define _GMP_REPEAT_41(call, data) _GMP_REPEAT_40(call, data) call(40, data)
+#define _GMP_REPEAT_42(call, data) _GMP_REPEAT_41(call, data) call(41, data)
+#define _GMP_REPEAT_43(call, data) _GMP_REPEAT_42(call, data) call(42, data)
+#define _GMP_REPEAT_44(call, data) _GMP_REPEAT_43(call, data) call(43, data)
+#define _GMP_REPEAT_45(call, data) _GMP_REPEAT_44(call, data) call(44, data)
+#define _GMP_REPEAT_46(call, data) _GMP_REPEAT_45(call, data) call(45, data)
+#define _GMP_REPEAT_47(call, data) _GMP_REPEAT_46(call, data) call(46, data)
+#define _GMP_REPEAT_48(call, data) _GMP_REPEAT_47(call, data) call(47, data)
+#define _GMP_REPEAT_49(call, data) _GMP_REPEAT_48(call, data) call(48, data)
+#define _GMP_REPEAT_50(call, data) _GMP_REPEAT_49(call, data) call(49, data)
+#define _GMP_REPEAT_51(call, data) _GMP_REPEAT_50(call, data) call(50, data)
+#define _GMP_REPEAT_52(call, data) _GMP_REPEAT_51(call, data) call(51, data)
+#define _GMP_REPEAT_53(call, data) _GMP_REPEAT_52(call, data) call(52, data)
+#define _GMP_REPEAT_54(call, data) _GMP_REPEAT_53(call, data) call(53, data)
+#define _GMP_REPEAT_55(call, data) _GMP_REPEAT_54(call, data) call(54, data)
+#define _GMP_REPEAT_56(call, data) _GMP_REPEAT_55(call, data) call(55, data)
+#define _GMP_REPEAT_57(call, data) _GMP_REPEAT_56(call, data) call(56, data)
+#define _GMP_REPEAT_58(call, data) _GMP_REPEAT_57(call, data) call(57, data)
+#define _GMP_REPEAT_59(call, data) _GMP_REPEAT_58(call, data) call(58, data)
+#define _GMP_REPEAT_60(call, data) _GMP_REPEAT_59(call, data) call(59, data)
+#define _GMP_REPEAT_61(call, data) _GMP_REPEAT_60(call, data) call(60, data)
+#define _GMP_REPEAT_62(call, data) _GMP_REPEAT_61(call, data) call(61, data)
+#define _GMP_REPEAT_63(call, data) _GMP_REPEAT_62(call, data) call(62, data)
+#define _GMP_REPEAT_64(call, data) _GMP_REPEAT_63(call, data) call(63, data)
+#define _GMP_REPEAT_65(call, data) _GMP_REPEAT_64(call, data) call(64, data)
+#define _GMP_REPEAT_66(call, data) _GMP_REPEAT_65(call, data) call(65, data)
+#define _GMP_REPEAT_67(call, data) _GMP_REPEAT_66(call, data) call(66, data)
+#define _GMP_REPEAT_68(call, data) _GMP_REPEAT_67(call, data) call(67, data)
+#define _GMP_REPEAT_69(call, data) _GMP_REPEAT_68(call, data) call(68, data)
+#define _GMP_REPEAT_70(call, data) _GMP_REPEAT_69(call, data) call(69, data)
+#define _GMP_REPEAT_71(call, data) _GMP_REPEAT_70(call, data) call(70, data)
+#define _GMP_REPEAT_72(call, data) _GMP_REPEAT_71(call, data) call(71, data)
+#define _GMP_REPEAT_73(call, data) _GMP_REPEAT_72(call, data) call(72, data)
+#define _GMP_REPEAT_74(call, data) _GMP_REPEAT_73(call, data) call(73, data)
+#define _GMP_REPEAT_75(call, data) _GMP_REPEAT_74(call, data) call(74, data)
+#define _GMP_REPEAT_76(call, data) _GMP_REPEAT_75(call, data) call(75, data)
+#define _GMP_REPEAT_77(call, data) _GMP_REPEAT_76(call, data) call(76, data)
+#define _GMP_REPEAT_78(call, data) _GMP_REPEAT_77(call, data) call(77, data)
+#define _GMP_REPEAT_79(call, data) _GMP_REPEAT_78(call, data) call(78, data)
+#define _GMP_REPEAT_80(call, data) _GMP_REPEAT_79(call, data) call(79, data)
+#define _GMP_REPEAT_81(call, data) _GMP_REPEAT_80(call, data) call(80, data)
+#define _GMP_REPEAT_82(call, data) _GMP_REPEAT_81(call, data) call(81, data)
+#define _GMP_REPEAT_83(call, data) _GMP_REPEAT_82(call, data) call(82, data)
+#define _GMP_REPEAT_84(call, data) _GMP_REPEAT_83(call, data) call(83, data)
+#define _GMP_REPEAT_85(call, data) _GMP_REPEAT_84(call, data) call(84, data)
+#define _GMP_REPEAT_86(call, data) _GMP_REPEAT_85(call, data) call(85, data)
+#define _GMP_REPEAT_87(call, data) _GMP_REPEAT_86(call, data) call(86, data)
+#define _GMP_REPEAT_88(call, data) _GMP_REPEAT_87(call, data) call(87, data)
+#define _GMP_REPEAT_89(call, data) _GMP_REPEAT_88(call, data) call(88, data)
+#define _GMP_REPEAT_90(call, data) _GMP_REPEAT_89(call, data) call(89, data)
+#define _GMP_REPEAT_91(call, data) _GMP_REPEAT_90(call, data) call(90, data)
+#define _GMP_REPEAT_92(call, data) _GMP_REPEAT_91(call, data) call(91, data)
+#define _GMP_REPEAT_93(call, data) _GMP_REPEAT_92(call, data) call(92, data)
+#define _GMP_REPEAT_94(call, data) _GMP_REPEAT_93(call, data) call(93, data)
+#define _GMP_REPEAT_95(call, data) _GMP_REPEAT_94(call, data) call(94, data)
+#define _GMP_REPEAT_96(call, data) _GMP_REPEAT_95(call, data) call(95, data)
+#define _GMP_REPEAT_97(call, data) _GMP_REPEAT_96(call, data) call(96, data)
+#define _GMP_REPEAT_98(call, data) _GMP_REPEAT_97(call, data) call(97, data)
+#define _GMP_REPEAT_99(call, data) _GMP_REPEAT_98(call, data) call(98, data)
+#define _GMP_REPEAT_100(call, data) _GMP_REPEAT_99(call, data) call(99, data)
+#define _GMP_REPEAT_101(call, data) _GMP_REPEAT_100(call, data) call(100, data)
+#define _GMP_REPEAT_102(call, data) _GMP_REPEAT_101(call, data) call(101, data)
+#define _GMP_REPEAT_103(call, data) _GMP_REPEAT_102(call, data) call(102, data)
+#define _GMP_REPEAT_104(call, data) _GMP_REPEAT_103(call, data) call(103, data)
+#define _GMP_REPEAT_105(call, data) _GMP_REPEAT_104(call, data) call(104, data)
+#define _GMP_REPEAT_106(call, data) _GMP_REPEAT_105(call, data) call(105, data)
+#define _GMP_REPEAT_107(call, data) _GMP_REPEAT_106(call, data) call(106, data)
+#define _GMP_REPEAT_108(call, data) _GMP_REPEAT_107(call, data) call(107, data)
+#define _GMP_REPEAT_109(call, data) _GMP_REPEAT_108(call, data) call(108, data)
+#define _GMP_REPEAT_110(call, data) _GMP_REPEAT_109(call, data) call(109, data)
+#define _GMP_REPEAT_111(call, data) _GMP_REPEAT_110(call, data) call(110, data)
+#define _GMP_REPEAT_112(call, data) _GMP_REPEAT_111(call, data) call(111, data)
+#define _GMP_REPEAT_113(call, data) _GMP_REPEAT_112(call, data) call(112, data)
+#define _GMP_REPEAT_114(call, data) _GMP_REPEAT_113(call, data) call(113, data)
+#define _GMP_REPEAT_115(call, data) _GMP_REPEAT_114(call, data) call(114, data)
+#define _GMP_REPEAT_116(call, data) _GMP_REPEAT_115(call, data) call(115, data)
+#define _GMP_REPEAT_117(call, data) _GMP_REPEAT_116(call, data) call(116, data)
+#define _GMP_REPEAT_118(call, data) _GMP_REPEAT_117(call, data) call(117, data)
+#define _GMP_REPEAT_119(call, data) _GMP_REPEAT_118(call, data) call(118, data)
+#define _GMP_REPEAT_120(call, data) _GMP_REPEAT_119(call, data) call(119, data)
+#define _GMP_REPEAT_121(call, data) _GMP_REPEAT_120(call, data) call(120, data)
+#define _GMP_REPEAT_122(call, data) _GMP_REPEAT_121(call, data) call(121, data)
+#define _GMP_REPEAT_123(call, data) _GMP_REPEAT_122(call, data) call(122, data)
+#define _GMP_REPEAT_124(call, data) _GMP_REPEAT_123(call, data) call(123, data)
+#define _GMP_REPEAT_125(call, data) _GMP_REPEAT_124(call, data) call(124, data)
+#define _GMP_REPEAT_126(call, data) _GMP_REPEAT_125(call, data) call(125, data)
+#define _GMP_REPEAT_127(call, data) _GMP_REPEAT_126(call, data) call(126, data)
+#define _GMP_REPEAT_128(call, data) _GMP_REPEAT_127(call, data) call(127, data)
+#define _GMP_REPEAT_129(call, data) _GMP_REPEAT_128(call, data) call(128, data)
+#define _GMP_REPEAT_130(call, data) _GMP_REPEAT_129(call, data) call(129, data)
+#define _GMP_REPEAT_131(call, data) _GMP_REPEAT_130(call, data) call(130, data)
+#define _GMP_REPEAT_132(call, data) _GMP_REPEAT_131(call, data) call(131, data)
+#define _GMP_REPEAT_133(call, data) _GMP_REPEAT_132(call, data) call(132, data)
+#define _GMP_REPEAT_134(call, data) _GMP_REPEAT_133(call, data) call(133, data)
+#define _GMP_REPEAT_135(call, data) _GMP_REPEAT_134(call, data) call(134, data)
+#define _GMP_REPEAT_136(call, data) _GMP_REPEAT_135(call, data) call(135, data)
+#define _GMP_REPEAT_137(call, data) _GMP_REPEAT_136(call, data) call(136, data)
+#define _GMP_REPEAT_138(call, data) _GMP_REPEAT_137(call, data) call(137, data)
+#define _GMP_REPEAT_139(call, data) _GMP_REPEAT_138(call, data) call(138, data)
+#define _GMP_REPEAT_140(call, data) _GMP_REPEAT_139(call, data) call(139, data)
+#define _GMP_REPEAT_141(call, data) _GMP_REPEAT_140(call, data) call(140, data)
+#define _GMP_REPEAT_142(call, data) _GMP_REPEAT_141(call, data) call(141, data)
+#define _GMP_REPEAT_143(call, data) _GMP_REPEAT_142(call, data) call(142, data)
+#define _GMP_REPEAT_144(call, data) _GMP_REPEAT_143(call, data) call(143, data)
+#define _GMP_REPEAT_145(call, data) _GMP_REPEAT_144(call, data) call(144, data)
+#define _GMP_REPEAT_146(call, data) _GMP_REPEAT_145(call, data) call(145, data)
+#define _GMP_REPEAT_147(call, data) _GMP_REPEAT_146(call, data) call(146, data)
+#define _GMP_REPEAT_148(call, data) _GMP_REPEAT_147(call, data) call(147, data)
+#define _GMP_REPEAT_149(call, data) _GMP_REPEAT_148(call, data) call(148, data)
+#define _GMP_REPEAT_150(call, data) _GMP_REPEAT_149(call, data) call(149, data)
+#define _GMP_REPEAT_151(call, data) _GMP_REPEAT_150(call, data) call(150, data)
+#define _GMP_REPEAT_152(call, data) _GMP_REPEAT_151(call, data) call(151, data)
+#define _GMP_REPEAT_153(call, data) _GMP_REPEAT_152(call, data) call(152, data)
+#define _GMP_REPEAT_154(call, data) _GMP_REPEAT_153(call, data) call(153, data)
+#define _GMP_REPEAT_155(call, data) _GMP_REPEAT_154(call, data) call(154, data)
+#define _GMP_REPEAT_156(call, data) _GMP_REPEAT_155(call, data) call(155, data)
+#define _GMP_REPEAT_157(call, data) _GMP_REPEAT_156(call, data) call(156, data)
+#define _GMP_REPEAT_158(call, data) _GMP_REPEAT_157(call, data) call(157, data)
+#define _GMP_REPEAT_159(call, data) _GMP_REPEAT_158(call, data) call(158, data)
+#define _GMP_REPEAT_160(call, data) _GMP_REPEAT_159(call, data) call(159, data)
+#define _GMP_REPEAT_161(call, data) _GMP_REPEAT_160(call, data) call(160, data)
+#define _GMP_REPEAT_162(call, data) _GMP_REPEAT_161(call, data) call(161, data)
+#define _GMP_REPEAT_163(call, data) _GMP_REPEAT_162(call, data) call(162, data)
+#define _GMP_REPEAT_164(call, data) _GMP_REPEAT_163(call, data) call(163, data)
+#define _GMP_REPEAT_165(call, data) _GMP_REPEAT_164(call, data) call(164, data)
+#define _GMP_REPEAT_166(call, data) _GMP_REPEAT_165(call, data) call(165, data)
+#define _GMP_REPEAT_167(call, data) _GMP_REPEAT_166(call, data) call(166, data)
+#define _GMP_REPEAT_168(call, data) _GMP_REPEAT_167(call, data) call(167, data)
+#define _GMP_REPEAT_169(call, data) _GMP_REPEAT_168(call, data) call(168, data)
+#define _GMP_REPEAT_170(call, data) _GMP_REPEAT_169(call, data) call(169, data)
+#define _GMP_REPEAT_171(call, data) _GMP_REPEAT_170(call, data) call(170, data)
+#define _GMP_REPEAT_172(call, data) _GMP_REPEAT_171(call, data) call(171, data)
+#define _GMP_REPEAT_173(call, data) _GMP_REPEAT_172(call, data) call(172, data)
+#define _GMP_REPEAT_174(call, data) _GMP_REPEAT_173(call, data) call(173, data)
+#define _GMP_REPEAT_175(call, data) _GMP_REPEAT_174(call, data) call(174, data)
+#define _GMP_REPEAT_176(call, data) _GMP_REPEAT_175(call, data) call(175, data)
+#define _GMP_REPEAT_177(call, data) _GMP_REPEAT_176(call, data) call(176, data)
+#define _GMP_REPEAT_178(call, data) _GMP_REPEAT_177(call, data) call(177, data)
+#define _GMP_REPEAT_179(call, data) _GMP_REPEAT_178(call, data) call(178, data)
+#define _GMP_REPEAT_180(call, data) _GMP_REPEAT_179(call, data) call(179, data)
+#define _GMP_REPEAT_181(call, data) _GMP_REPEAT_180(call, data) call(180, data)
+#define _GMP_REPEAT_182(call, data) _GMP_REPEAT_181(call, data) call(181, data)
+#define _GMP_REPEAT_183(call, data) _GMP_REPEAT_182(call, data) call(182, data)
+#define _GMP_REPEAT_184(call, data) _GMP_REPEAT_183(call, data) call(183, data)
+#define _GMP_REPEAT_185(call, data) _GMP_REPEAT_184(call, data) call(184, data)
+#define _GMP_REPEAT_186(call, data) _GMP_REPEAT_185(call, data) call(185, data)
+#define _GMP_REPEAT_187(call, data) _GMP_REPEAT_186(call, data) call(186, data)
+#define _GMP_REPEAT_188(call, data) _GMP_REPEAT_187(call, data) call(187, data)
+#define _GMP_REPEAT_189(call, data) _GMP_REPEAT_188(call, data) call(188, data)
+#define _GMP_REPEAT_190(call, data) _GMP_REPEAT_189(call, data) call(189, data)
+#define _GMP_REPEAT_191(call, data) _GMP_REPEAT_190(call, data) call(190, data)
+#define _GMP_REPEAT_192(call, data) _GMP_REPEAT_191(call, data) call(191, data)
+#define _GMP_REPEAT_193(call, data) _GMP_REPEAT_192(call, data) call(192, data)
+#define _GMP_REPEAT_194(call, data) _GMP_REPEAT_193(call, data) call(193, data)
+#define _GMP_REPEAT_195(call, data) _GMP_REPEAT_194(call, data) call(194, data)
+#define _GMP_REPEAT_196(call, data) _GMP_REPEAT_195(call, data) call(195, data)
+#define _GMP_REPEAT_197(call, data) _GMP_REPEAT_196(call, data) call(196, data)
+#define _GMP_REPEAT_198(call, data) _GMP_REPEAT_197(call, data) call(197, data)
+#define _GMP_REPEAT_199(call, data) _GMP_REPEAT_198(call, data) call(198, data)
+#define _GMP_REPEAT_200(call, data) _GMP_REPEAT_199(call, data) call(199, data)
+#define _GMP_REPEAT_201(call, data) _GMP_REPEAT_200(call, data) call(200, data)
+#define _GMP_REPEAT_202(call, data) _GMP_REPEAT_201(call, data) call(201, data)
+#define _GMP_REPEAT_203(call, data) _GMP_REPEAT_202(call, data) call(202, data)
+#define _GMP_REPEAT_204(call, data) _GMP_REPEAT_203(call, data) call(203, data)
+#define _GMP_REPEAT_205(call, data) _GMP_REPEAT_204(call, data) call(204, data)
+#define _GMP_REPEAT_206(call, data) _GMP_REPEAT_205(call, data) call(205, data)
+#define _GMP_REPEAT_207(call, data) _GMP_REPEAT_206(call, data) call(206, data)
+#define _GMP_REPEAT_208(call, data) _GMP_REPEAT_207(call, data) call(207, data)
+#define _GMP_REPEAT_209(call, data) _GMP_REPEAT_208(call, data) call(208, data)
+#define _GMP_REPEAT_210(call, data) _GMP_REPEAT_209(call, data) call(209, data)
+#define _GMP_REPEAT_211(call, data) _GMP_REPEAT_210(call, data) call(210, data)
+#define _GMP_REPEAT_212(call, data) _GMP_REPEAT_211(call, data) call(211, data)
+#define _GMP_REPEAT_213(call, data) _GMP_REPEAT_212(call, data) call(212, data)
+#define _GMP_REPEAT_214(call, data) _GMP_REPEAT_213(call, data) call(213, data)
+#define _GMP_REPEAT_215(call, data) _GMP_REPEAT_214(call, data) call(214, data)
+#define _GMP_REPEAT_216(call, data) _GMP_REPEAT_215(call, data) call(215, data)
+#define _GMP_REPEAT_217(call, data) _GMP_REPEAT_216(call, data) call(216, data)
+#define _GMP_REPEAT_218(call, data) _GMP_REPEAT_217(call, data) call(217, data)
+#define _GMP_REPEAT_219(call, data) _GMP_REPEAT_218(call, data) call(218, data)
+#define _GMP_REPEAT_220(call, data) _GMP_REPEAT_219(call, data) call(219, data)
+#define _GMP_REPEAT_221(call, data) _GMP_REPEAT_220(call, data) call(220, data)
+#define _GMP_REPEAT_222(call, data) _GMP_REPEAT_221(call, data) call(221, data)
+#define _GMP_REPEAT_223(call, data) _GMP_REPEAT_222(call, data) call(222, data)
+#define _GMP_REPEAT_224(call, data) _GMP_REPEAT_223(call, data) call(223, data)
+#define _GMP_REPEAT_225(call, data) _GMP_REPEAT_224(call, data) call(224, data)
+#define _GMP_REPEAT_226(call, data) _GMP_REPEAT_225(call, data) call(225, data)
+#define _GMP_REPEAT_227(call, data) _GMP_REPEAT_226(call, data) call(226, data)
+#define _GMP_REPEAT_228(call, data) _GMP_REPEAT_227(call, data) call(227, data)
+#define _GMP_REPEAT_229(call, data) _GMP_REPEAT_228(call, data) call(228, data)
+#define _GMP_REPEAT_230(call, data) _GMP_REPEAT_229(call, data) call(229, data)
+#define _GMP_REPEAT_231(call, data) _GMP_REPEAT_230(call, data) call(230, data)
+#define _GMP_REPEAT_232(call, data) _GMP_REPEAT_231(call, data) call(231, data)
+#define _GMP_REPEAT_233(call, data) _GMP_REPEAT_232(call, data) call(232, data)
+#define _GMP_REPEAT_234(call, data) _GMP_REPEAT_233(call, data) call(233, data)
+#define _GMP_REPEAT_235(call, data) _GMP_REPEAT_234(call, data) call(234, data)
+#define _GMP_REPEAT_236(call, data) _GMP_REPEAT_235(call, data) call(235, data)
+#define _GMP_REPEAT_237(call, data) _GMP_REPEAT_236(call, data) call(236, data)
+#define _GMP_REPEAT_238(call, data) _GMP_REPEAT_237(call, data) call(237, data)
+#define _GMP_REPEAT_239(call, data) _GMP_REPEAT_238(call, data) call(238, data)
+#define _GMP_REPEAT_240(call, data) _GMP_REPEAT_239(call, data) call(239, data)
+#define _GMP_REPEAT_241(call, data) _GMP_REPEAT_240(call, data) call(240, data)
+#define _GMP_REPEAT_242(call, data) _GMP_REPEAT_241(call, data) call(241, data)
+#define _GMP_REPEAT_243(call, data) _GMP_REPEAT_242(call, data) call(242, data)
+#define _GMP_REPEAT_244(call, data) _GMP_REPEAT_243(call, data) call(243, data)
+#define _GMP_REPEAT_245(call, data) _GMP_REPEAT_244(call, data) call(244, data)
+#define _GMP_REPEAT_246(call, data) _GMP_REPEAT_245(call, data) call(245, data)
+#define _GMP_REPEAT_247(call, data) _GMP_REPEAT_246(call, data) call(246, data)
+#define _GMP_REPEAT_248(call, data) _GMP_REPEAT_247(call, data) call(247, data)
+#define _GMP_REPEAT_249(call, data) _GMP_REPEAT_248(call, data) call(248, data)
+#define _GMP_REPEAT_250(call, data) _GMP_REPEAT_249(call, data) call(249, data)
+#define _GMP_REPEAT_251(call, data) _GMP_REPEAT_250(call, data) call(250, data)
+#define _GMP_REPEAT_252(call, data) _GMP_REPEAT_251(call, data) call(251, data)
+#define _GMP_REPEAT_253(call, data) _GMP_REPEAT_252(call, data) call(252, data)
+#define _GMP_REPEAT_254(call, data) _GMP_REPEAT_253(call, data) call(253, data)
+#define _GMP_REPEAT_255(call, data) _GMP_REPEAT_254(call, data) call(254, data)
+#define _GMP_REPEAT_256(call, data) _GMP_REPEAT_255(call, data) call(255, data)
+#define _GMP_REPEAT_257(call, data) _GMP_REPEAT_256(call, data) call(256, data)
+#define _GMP_REPEAT_258(call, data) _GMP_REPEAT_257(call, data) call(257, data)
+#define _GMP_REPEAT_259(call, data) _GMP_REPEAT_258(call, data) call(258, data)
+#define _GMP_REPEAT_260(call, data) _GMP_REPEAT_259(call, data) call(259, data)
+#define _GMP_REPEAT_261(call, data) _GMP_REPEAT_260(call, data) call(260, data)
+#define _GMP_REPEAT_262(call, data) _GMP_REPEAT_261(call, data) call(261, data)
+#define _GMP_REPEAT_263(call, data) _GMP_REPEAT_262(call, data) call(262, data)
+#define _GMP_REPEAT_264(call, data) _GMP_REPEAT_263(call, data) call(263, data)
+#define _GMP_REPEAT_265(call, data) _GMP_REPEAT_264(call, data) call(264, data)
+#define _GMP_REPEAT_266(call, data) _GMP_REPEAT_265(call, data) call(265, data)
+#define _GMP_REPEAT_267(call, data) _GMP_REPEAT_266(call, data) call(266, data)
+#define _GMP_REPEAT_268(call, data) _GMP_REPEAT_267(call, data) call(267, data)
+#define _GMP_REPEAT_269(call, data) _GMP_REPEAT_268(call, data) call(268, data)
+#define _GMP_REPEAT_270(call, data) _GMP_REPEAT_269(call, data) call(269, data)
+#define _GMP_REPEAT_271(call, data) _GMP_REPEAT_270(call, data) call(270, data)
+#define _GMP_REPEAT_272(call, data) _GMP_REPEAT_271(call, data) call(271, data)
+#define _GMP_REPEAT_273(call, data) _GMP_REPEAT_272(call, data) call(272, data)
+#define _GMP_REPEAT_274(call, data) _GMP_REPEAT_273(call, data) call(273, data)
+#define _GMP_REPEAT_275(call, data) _GMP_REPEAT_274(call, data) call(274, data)
+#define _GMP_REPEAT_276(call, data) _GMP_REPEAT_275(call, data) call(275, data)
+#define _GMP_REPEAT_277(call, data) _GMP_REPEAT_276(call, data) call(276, data)
+#define _GMP_REPEAT_278(call, data) _GMP_REPEAT_277(call, data) call(277, data)
+#define _GMP_REPEAT_279(call, data) _GMP_REPEAT_278(call, data) call(278, data)
+#define _GMP_REPEAT_280(call, data) _GMP_REPEAT_279(call, data) call(279, data)
+#define _GMP_REPEAT_281(call, data) _GMP_REPEAT_280(call, data) call(280, data)
+#define _GMP_REPEAT_282(call, data) _GMP_REPEAT_281(call, data) call(281, data)
+#define _GMP_REPEAT_283(call, data) _GMP_REPEAT_282(call, data) call(282, data)
+#define _GMP_REPEAT_284(call, data) _GMP_REPEAT_283(call, data) call(283, data)
+#define _GMP_REPEAT_285(call, data) _GMP_REPEAT_284(call, data) call(284, data)
+#define _GMP_REPEAT_286(call, data) _GMP_REPEAT_285(call, data) call(285, data)
+#define _GMP_REPEAT_287(call, data) _GMP_REPEAT_286(call, data) call(286, data)
+#define _GMP_REPEAT_288(call, data) _GMP_REPEAT_287(call, data) call(287, data)
+#define _GMP_REPEAT_289(call, data) _GMP_REPEAT_288(call, data) call(288, data)
+#define _GMP_REPEAT_290(call, data) _GMP_REPEAT_289(call, data) call(289, data)
+#define _GMP_REPEAT_291(call, data) _GMP_REPEAT_290(call, data) call(290, data)
+#define _GMP_REPEAT_292(call, data) _GMP_REPEAT_291(call, data) call(291, data)
+#define _GMP_REPEAT_293(call, data) _GMP_REPEAT_292(call, data) call(292, data)
+#define _GMP_REPEAT_294(call, data) _GMP_REPEAT_293(call, data) call(293, data)
+#define _GMP_REPEAT_295(call, data) _GMP_REPEAT_294(call, data) call(294, data)
+#define _GMP_REPEAT_296(call, data) _GMP_REPEAT_295(call, data) call(295, data)
+#define _GMP_REPEAT_297(call, data) _GMP_REPEAT_296(call, data) call(296, data)
+#define _GMP_REPEAT_298(call, data) _GMP_REPEAT_297(call, data) call(297, data)
+#define _GMP_REPEAT_299(call, data) _GMP_REPEAT_298(call, data) call(298, data)
+#define _GMP_REPEAT_300(call, data) _GMP_REPEAT_299(call, data) call(299, data)
+#define _GMP_REPEAT_301(call, data) _GMP_REPEAT_300(call, data) call(300, data)
+#define _GMP_REPEAT_302(call, data) _GMP_REPEAT_301(call, data) call(301, data)
+#define _GMP_REPEAT_303(call, data) _GMP_REPEAT_302(call, data) call(302, data)
+#define _GMP_REPEAT_304(call, data) _GMP_REPEAT_303(call, data) call(303, data)
+#define _GMP_REPEAT_305(call, data) _GMP_REPEAT_304(call, data) call(304, data)
+#define _GMP_REPEAT_306(call, data) _GMP_REPEAT_305(call, data) call(305, data)
+#define _GMP_REPEAT_307(call, data) _GMP_REPEAT_306(call, data) call(306, data)
+#define _GMP_REPEAT_308(call, data) _GMP_REPEAT_307(call, data) call(307, data)
+#define _GMP_REPEAT_309(call, data) _GMP_REPEAT_308(call, data) call(308, data)
+#define _GMP_REPEAT_310(call, data) _GMP_REPEAT_309(call, data) call(309, data)
+#define _GMP_REPEAT_311(call, data) _GMP_REPEAT_310(call, data) call(310, data)
+#define _GMP_REPEAT_312(call, data) _GMP_REPEAT_311(call, data) call(311, data)
+#define _GMP_REPEAT_313(call, data) _GMP_REPEAT_312(call, data) call(312, data)
+#define _GMP_REPEAT_314(call, data) _GMP_REPEAT_313(call, data) call(313, data)
+#define _GMP_REPEAT_315(call, data) _GMP_REPEAT_314(call, data) call(314, data)
+#define _GMP_REPEAT_316(call, data) _GMP_REPEAT_315(call, data) call(315, data)
+#define _GMP_REPEAT_317(call, data) _GMP_REPEAT_316(call, data) call(316, data)
+#define _GMP_REPEAT_318(call, data) _GMP_REPEAT_317(call, data) call(317, data)
+#define _GMP_REPEAT_319(call, data) _GMP_REPEAT_318(call, data) call(318, data)
+#define _GMP_REPEAT_320(call, data) _GMP_REPEAT_319(call, data) call(319, data)
+#define _GMP_REPEAT_321(call, data) _GMP_REPEAT_320(call, data) call(320, data)
+#define _GMP_REPEAT_322(call, data) _GMP_REPEAT_321(call, data) call(321, data)
+#define _GMP_REPEAT_323(call, data) _GMP_REPEAT_322(call, data) call(322, data)
+#define _GMP_REPEAT_324(call, data) _GMP_REPEAT_323(call, data) call(323, data)
+#define _GMP_REPEAT_325(call, data) _GMP_REPEAT_324(call, data) call(324, data)
+#define _GMP_REPEAT_326(call, data) _GMP_REPEAT_325(call, data) call(325, data)
+#define _GMP_REPEAT_327(call, data) _GMP_REPEAT_326(call, data) call(326, data)
+#define _GMP_REPEAT_328(call, data) _GMP_REPEAT_327(call, data) call(327, data)
+#define _GMP_REPEAT_329(call, data) _GMP_REPEAT_328(call, data) call(328, data)
+#define _GMP_REPEAT_330(call, data) _GMP_REPEAT_329(call, data) call(329, data)
+#define _GMP_REPEAT_331(call, data) _GMP_REPEAT_330(call, data) call(330, data)
+#define _GMP_REPEAT_332(call, data) _GMP_REPEAT_331(call, data) call(331, data)
+#define _GMP_REPEAT_333(call, data) _GMP_REPEAT_332(call, data) call(332, data)
+#define _GMP_REPEAT_334(call, data) _GMP_REPEAT_333(call, data) call(333, data)
+#define _GMP_REPEAT_335(call, data) _GMP_REPEAT_334(call, data) call(334, data)
+#define _GMP_REPEAT_336(call, data) _GMP_REPEAT_335(call, data) call(335, data)
+#define _GMP_REPEAT_337(call, data) _GMP_REPEAT_336(call, data) call(336, data)
+#define _GMP_REPEAT_338(call, data) _GMP_REPEAT_337(call, data) call(337, data)
+#define _GMP_REPEAT_339(call, data) _GMP_REPEAT_338(call, data) call(338, data)
+#define _GMP_REPEAT_340(call, data) _GMP_REPEAT_339(call, data) call(339, data)
+#define _GMP_REPEAT_341(call, data) _GMP_REPEAT_340(call, data) call(340, data)
+#define _GMP_REPEAT_342(call, data) _GMP_REPEAT_341(call, data) call(341, data)
+#define _GMP_REPEAT_343(call, data) _GMP_REPEAT_342(call, data) call(342, data)
+#define _GMP_REPEAT_344(call, data) _GMP_REPEAT_343(call, data) call(343, data)
+#define _GMP_REPEAT_345(call, data) _GMP_REPEAT_344(call, data) call(344, data)
+#define _GMP_REPEAT_346(call, data) _GMP_REPEAT_345(call, data) call(345, data)
+#define _GMP_REPEAT_347(call, data) _GMP_REPEAT_346(call, data) call(346, data)
+#define _GMP_REPEAT_348(call, data) _GMP_REPEAT_347(call, data) call(347, data)
+#define _GMP_REPEAT_349(call, data) _GMP_REPEAT_348(call, data) call(348, data)
+#define _GMP_REPEAT_350(call, data) _GMP_REPEAT_349(call, data) call(349, data)
+#define _GMP_REPEAT_351(call, data) _GMP_REPEAT_350(call, data) call(350, data)
+#define _GMP_REPEAT_352(call, data) _GMP_REPEAT_351(call, data) call(351, data)
+#define _GMP_REPEAT_353(call, data) _GMP_REPEAT_352(call, data) call(352, data)
+#define _GMP_REPEAT_354(call, data) _GMP_REPEAT_353(call, data) call(353, data)
+#define _GMP_REPEAT_355(call, data) _GMP_REPEAT_354(call, data) call(354, data)
+#define _GMP_REPEAT_356(call, data) _GMP_REPEAT_355(call, data) call(355, data)
+#define _GMP_REPEAT_357(call, data) _GMP_REPEAT_356(call, data) call(356, data)
+#define _GMP_REPEAT_358(call, data) _GMP_REPEAT_357(call, data) call(357, data)
+#define _GMP_REPEAT_359(call, data) _GMP_REPEAT_358(call, data) call(358, data)
+#define _GMP_REPEAT_360(call, data) _GMP_REPEAT_359(call, data) call(359, data)
+#define _GMP_REPEAT_361(call, data) _GMP_REPEAT_360(call, data) call(360, data)
+#define _GMP_REPEAT_362(call, data) _GMP_REPEAT_361(call, data) call(361, data)
+#define _GMP_REPEAT_363(call, data) _GMP_REPEAT_362(call, data) call(362, data)
+#define _GMP_REPEAT_364(call, data) _GMP_REPEAT_363(call, data) call(363, data)
+#define _GMP_REPEAT_365(call, data) _GMP_REPEAT_364(call, data) call(364, data)
+#define _GMP_REPEAT_366(call, data) _GMP_REPEAT_365(call, data) call(365, data)
+#define _GMP_REPEAT_367(call, data) _GMP_REPEAT_366(call, data) call(366, data)
+#define _GMP_REPEAT_368(call, data) _GMP_REPEAT_367(call, data) call(367, data)
+#define _GMP_REPEAT_369(call, data) _GMP_REPEAT_368(call, data) call(368, data)
+#define _GMP_REPEAT_370(call, data) _GMP_REPEAT_369(call, data) call(369, data)
+#define _GMP_REPEAT_371(call, data) _GMP_REPEAT_370(call, data) call(370, data)
+#define _GMP_REPEAT_372(call, data) _GMP_REPEAT_371(call, data) call(371, data)
+#define _GMP_REPEAT_373(call, data) _GMP_REPEAT_372(call, data) call(372, data)
+#define _GMP_REPEAT_374(call, data) _GMP_REPEAT_373(call, data) call(373, data)
+#define _GMP_REPEAT_375(call, data) _GMP_REPEAT_374(call, data) call(374, data)
+#define _GMP_REPEAT_376(call, data) _GMP_REPEAT_375(call, data) call(375, data)
+#define _GMP_REPEAT_377(call, data) _GMP_REPEAT_376(call, data) call(376, data)
+#define _GMP_REPEAT_378(call, data) _GMP_REPEAT_377(call, data) call(377, data)
+#define _GMP_REPEAT_379(call, data) _GMP_REPEAT_378(call, data) call(378, data)
+#define _GMP_REPEAT_380(call, data) _GMP_REPEAT_379(call, data) call(379, data)
+#define _GMP_REPEAT_381(call, data) _GMP_REPEAT_380(call, data) call(380, data)
+#define _GMP_REPEAT_382(call, data) _GMP_REPEAT_381(call, data) call(381, data)
+#define _GMP_REPEAT_383(call, data) _GMP_REPEAT_382(call, data) call(382, data)
+#define _GMP_REPEAT_384(call, data) _GMP_REPEAT_383(call, data) call(383, data)
+#define _GMP_REPEAT_385(call, data) _GMP_REPEAT_384(call, data) call(384, data)
+#define _GMP_REPEAT_386(call, data) _GMP_REPEAT_385(call, data) call(385, data)
+#define _GMP_REPEAT_387(call, data) _GMP_REPEAT_386(call, data) call(386, data)
+#define _GMP_REPEAT_388(call, data) _GMP_REPEAT_387(call, data) call(387, data)
+#define _GMP_REPEAT_389(call, data) _GMP_REPEAT_388(call, data) call(388, data)
+#define _GMP_REPEAT_390(call, data) _GMP_REPEAT_389(call, data) call(389, data)
+#define _GMP_REPEAT_391(call, data) _GMP_REPEAT_390(call, data) call(390, data)
+#define _GMP_REPEAT_392(call, data) _GMP_REPEAT_391(call, data) call(391, data)
+#define _GMP_REPEAT_393(call, data) _GMP_REPEAT_392(call, data) call(392, data)
+#define _GMP_REPEAT_394(call, data) _GMP_REPEAT_393(call, data) call(393, data)
+#define _GMP_REPEAT_395(call, data) _GMP_REPEAT_394(call, data) call(394, data)
+#define _GMP_REPEAT_396(call, data) _GMP_REPEAT_395(call, data) call(395, data)
+#define _GMP_REPEAT_397(call, data) _GMP_REPEAT_396(call, data) call(396, data)
+#define _GMP_REPEAT_398(call, data) _GMP_REPEAT_397(call, data) call(397, data)
+#define _GMP_REPEAT_399(call, data) _GMP_REPEAT_398(call, data) call(398, data)
+#define _GMP_REPEAT_400(call, data) _GMP_REPEAT_399(call, data) call(399, data)
+#define _GMP_REPEAT_401(call, data) _GMP_REPEAT_400(call, data) call(400, data)
+#define _GMP_REPEAT_402(call, data) _GMP_REPEAT_401(call, data) call(401, data)
+#define _GMP_REPEAT_403(call, data) _GMP_REPEAT_402(call, data) call(402, data)
+#define _GMP_REPEAT_404(call, data) _GMP_REPEAT_403(call, data) call(403, data)
+#define _GMP_REPEAT_405(call, data) _GMP_REPEAT_404(call, data) call(404, data)
+#define _GMP_REPEAT_406(call, data) _GMP_REPEAT_405(call, data) call(405, data)
+#define _GMP_REPEAT_407(call, data) _GMP_REPEAT_406(call, data) call(406, data)
+#define _GMP_REPEAT_408(call, data) _GMP_REPEAT_407(call, data) call(407, data)
+#define _GMP_REPEAT_409(call, data) _GMP_REPEAT_408(call, data) call(408, data)
+#define _GMP_REPEAT_410(call, data) _GMP_REPEAT_409(call, data) call(409, data)
+#define _GMP_REPEAT_411(call, data) _GMP_REPEAT_410(call, data) call(410, data)
+#define _GMP_REPEAT_412(call, data) _GMP_REPEAT_411(call, data) call(411, data)
+#define _GMP_REPEAT_413(call, data) _GMP_REPEAT_412(call, data) call(412, data)
+#define _GMP_REPEAT_414(call, data) _GMP_REPEAT_413(call, data) call(413, data)
+#define _GMP_REPEAT_415(call, data) _GMP_REPEAT_414(call, data) call(414, data)
+#define _GMP_REPEAT_416(call, data) _GMP_REPEAT_415(call, data) call(415, data)
+#define _GMP_REPEAT_417(call, data) _GMP_REPEAT_416(call, data) call(416, data)
+#define _GMP_REPEAT_418(call, data) _GMP_REPEAT_417(call, data) call(417, data)
+#define _GMP_REPEAT_419(call, data) _GMP_REPEAT_418(call, data) call(418, data)
+#define _GMP_REPEAT_420(call, data) _GMP_REPEAT_419(call, data) call(419, data)
+#define _GMP_REPEAT_421(call, data) _GMP_REPEAT_420(call, data) call(420, data)
+#define _GMP_REPEAT_422(call, data) _GMP_REPEAT_421(call, data) call(421, data)
+#define _GMP_REPEAT_423(call, data) _GMP_REPEAT_422(call, data) call(422, data)
+#define _GMP_REPEAT_424(call, data) _GMP_REPEAT_423(call, data) call(423, data)
+#define _GMP_REPEAT_425(call, data) _GMP_REPEAT_424(call, data) call(424, data)
+#define _GMP_REPEAT_426(call, data) _GMP_REPEAT_425(call, data) call(425, data)
+#define _GMP_REPEAT_427(call, data) _GMP_REPEAT_426(call, data) call(426, data)
+#define _GMP_REPEAT_428(call, data) _GMP_REPEAT_427(call, data) call(427, data)
+#define _GMP_REPEAT_429(call, data) _GMP_REPEAT_428(call, data) call(428, data)
+#define _GMP_REPEAT_430(call, data) _GMP_REPEAT_429(call, data) call(429, data)
+#define _GMP_REPEAT_431(call, data) _GMP_REPEAT_430(call, data) call(430, data)
+#define _GMP_REPEAT_432(call, data) _GMP_REPEAT_431(call, data) call(431, data)
+#define _GMP_REPEAT_433(call, data) _GMP_REPEAT_432(call, data) call(432, data)
+#define _GMP_REPEAT_434(call, data) _GMP_REPEAT_433(call, data) call(433, data)
+#define _GMP_REPEAT_435(call, data) _GMP_REPEAT_434(call, data) call(434, data)
+#define _GMP_REPEAT_436(call, data) _GMP_REPEAT_435(call, data) call(435, data)
+#define _GMP_REPEAT_437(call, data) _GMP_REPEAT_436(call, data) call(436, data)
+#define _GMP_REPEAT_438(call, data) _GMP_REPEAT_437(call, data) call(437, data)
+#define _GMP_REPEAT_439(call, data) _GMP_REPEAT_438(call, data) call(438, data)
+#define _GMP_REPEAT_440(call, data) _GMP_REPEAT_439(call, data) call(439, data)
+#define _GMP_REPEAT_441(call, data) _GMP_REPEAT_440(call, data) call(440, data)
+#define _GMP_REPEAT_442(call, data) _GMP_REPEAT_441(call, data) call(441, data)
+#define _GMP_REPEAT_443(call, data) _GMP_REPEAT_442(call, data) call(442, data)
+#define _GMP_REPEAT_444(call, data) _GMP_REPEAT_443(call, data) call(443, data)
+#define _GMP_REPEAT_445(call, data) _GMP_REPEAT_444(call, data) call(444, data)
+#define _GMP_REPEAT_446(call, data) _GMP_REPEAT_445(call, data) call(445, data)
+#define _GMP_REPEAT_447(call, data) _GMP_REPEAT_446(call, data) call(446, data)
+#define _GMP_REPEAT_448(call, data) _GMP_REPEAT_447(call, data) call(447, data)
+#define _GMP_REPEAT_449(call, data) _GMP_REPEAT_448(call, data) call(448, data)
+#define _GMP_REPEAT_450(call, data) _GMP_REPEAT_449(call, data) call(449, data)
+#define _GMP_REPEAT_451(call, data) _GMP_REPEAT_450(call, data) call(450, data)
+#define _GMP_REPEAT_452(call, data) _GMP_REPEAT_451(call, data) call(451, data)
+#define _GMP_REPEAT_453(call, data) _GMP_REPEAT_452(call, data) call(452, data)
+#define _GMP_REPEAT_454(call, data) _GMP_REPEAT_453(call, data) call(453, data)
+#define _GMP_REPEAT_455(call, data) _GMP_REPEAT_454(call, data) call(454, data)
+#define _GMP_REPEAT_456(call, data) _GMP_REPEAT_455(call, data) call(455, data)
+#define _GMP_REPEAT_457(call, data) _GMP_REPEAT_456(call, data) call(456, data)
+#define _GMP_REPEAT_458(call, data) _GMP_REPEAT_457(call, data) call(457, data)
+#define _GMP_REPEAT_459(call, data) _GMP_REPEAT_458(call, data) call(458, data)
+#define _GMP_REPEAT_460(call, data) _GMP_REPEAT_459(call, data) call(459, data)
+#define _GMP_REPEAT_461(call, data) _GMP_REPEAT_460(call, data) call(460, data)
+#define _GMP_REPEAT_462(call, data) _GMP_REPEAT_461(call, data) call(461, data)
+#define _GMP_REPEAT_463(call, data) _GMP_REPEAT_462(call, data) call(462, data)
+#define _GMP_REPEAT_464(call, data) _GMP_REPEAT_463(call, data) call(463, data)
+#define _GMP_REPEAT_465(call, data) _GMP_REPEAT_464(call, data) call(464, data)
+#define _GMP_REPEAT_466(call, data) _GMP_REPEAT_465(call, data) call(465, data)
+#define _GMP_REPEAT_467(call, data) _GMP_REPEAT_466(call, data) call(466, data)
+#define _GMP_REPEAT_468(call, data) _GMP_REPEAT_467(call, data) call(467, data)
+#define _GMP_REPEAT_469(call, data) _GMP_REPEAT_468(call, data) call(468, data)
+#define _GMP_REPEAT_470(call, data) _GMP_REPEAT_469(call, data) call(469, data)
+#define _GMP_REPEAT_471(call, data) _GMP_REPEAT_470(call, data) call(470, data)
+#define _GMP_REPEAT_472(call, data) _GMP_REPEAT_471(call, data) call(471, data)
+#define _GMP_REPEAT_473(call, data) _GMP_REPEAT_472(call, data) call(472, data)
+#define _GMP_REPEAT_474(call, data) _GMP_REPEAT_473(call, data) call(473, data)
+#define _GMP_REPEAT_475(call, data) _GMP_REPEAT_474(call, data) call(474, data)
+#define _GMP_REPEAT_476(call, data) _GMP_REPEAT_475(call, data) call(475, data)
+#define _GMP_REPEAT_477(call, data) _GMP_REPEAT_476(call, data) call(476, data)
+#define _GMP_REPEAT_478(call, data) _GMP_REPEAT_477(call, data) call(477, data)
+#define _GMP_REPEAT_479(call, data) _GMP_REPEAT_478(call, data) call(478, data)
+#define _GMP_REPEAT_480(call, data) _GMP_REPEAT_479(call, data) call(479, data)
+#define _GMP_REPEAT_481(call, data) _GMP_REPEAT_480(call, data) call(480, data)
+#define _GMP_REPEAT_482(call, data) _GMP_REPEAT_481(call, data) call(481, data)
+#define _GMP_REPEAT_483(call, data) _GMP_REPEAT_482(call, data) call(482, data)
+#define _GMP_REPEAT_484(call, data) _GMP_REPEAT_483(call, data) call(483, data)
+#define _GMP_REPEAT_485(call, data) _GMP_REPEAT_484(call, data) call(484, data)
+#define _GMP_REPEAT_486(call, data) _GMP_REPEAT_485(call, data) call(485, data)
+#define _GMP_REPEAT_487(call, data) _GMP_REPEAT_486(call, data) call(486, data)
+#define _GMP_REPEAT_488(call, data) _GMP_REPEAT_487(call, data) call(487, data)
+#define _GMP_REPEAT_489(call, data) _GMP_REPEAT_488(call, data) call(488, data)
+#define _GMP_REPEAT_490(call, data) _GMP_REPEAT_489(call, data) call(489, data)
+#define _GMP_REPEAT_491(call, data) _GMP_REPEAT_490(call, data) call(490, data)
+#define _GMP_REPEAT_492(call, data) _GMP_REPEAT_491(call, data) call(491, data)
+#define _GMP_REPEAT_493(call, data) _GMP_REPEAT_492(call, data) call(492, data)
+#define _GMP_REPEAT_494(call, data) _GMP_REPEAT_493(call, data) call(493, data)
+#define _GMP_REPEAT_495(call, data) _GMP_REPEAT_494(call, data) call(494, data)
+#define _GMP_REPEAT_496(call, data) _GMP_REPEAT_495(call, data) call(495, data)
+#define _GMP_REPEAT_497(call, data) _GMP_REPEAT_496(call, data) call(496, data)
+#define _GMP_REPEAT_498(call, data) _GMP_REPEAT_497(call, data) call(497, data)
+#define _GMP_REPEAT_499(call, data) _GMP_REPEAT_498(call, data) call(498, data)
+#define _GMP_REPEAT_500(call, data) _GMP_REPEAT_499(call, data) call(499, data)
+#define _GMP_REPEAT_501(call, data) _GMP_REPEAT_500(call, data) call(500, data)
+#define _GMP_REPEAT_502(call, data) _GMP_REPEAT_501(call, data) call(501, data)
+#define _GMP_REPEAT_503(call, data) _GMP_REPEAT_502(call, data) call(502, data)
+#define _GMP_REPEAT_504(call, data) _GMP_REPEAT_503(call, data) call(503, data)
+#define _GMP_REPEAT_505(call, data) _GMP_REPEAT_504(call, data) call(504, data)
+#define _GMP_REPEAT_506(call, data) _GMP_REPEAT_505(call, data) call(505, data)
+#define _GMP_REPEAT_507(call, data) _GMP_REPEAT_506(call, data) call(506, data)
+#define _GMP_REPEAT_508(call, data) _GMP_REPEAT_507(call, data) call(507, data)
+#define _GMP_REPEAT_509(call, data) _GMP_REPEAT_508(call, data) call(508, data)
+#define _GMP_REPEAT_510(call, data) _GMP_REPEAT_509(call, data) call(509, data)
+#define _GMP_REPEAT_511(call, data) _GMP_REPEAT_510(call, data) call(510, data)
+#define _GMP_REPEAT_512(call, data) _GMP_REPEAT_511(call, data) call(511, data)
+#define _GMP_REPEAT_513(call, data) _GMP_REPEAT_512(call, data) call(512, data)
+#define _GMP_REPEAT_514(call, data) _GMP_REPEAT_513(call, data) call(513, data)
+#define _GMP_REPEAT_515(call, data) _GMP_REPEAT_514(call, data) call(514, data)
+#define _GMP_REPEAT_516(call, data) _GMP_REPEAT_515(call, data) call(515, data)
+#define _GMP_REPEAT_517(call, data) _GMP_REPEAT_516(call, data) call(516, data)
+#define _GMP_REPEAT_518(call, data) _GMP_REPEAT_517(call, data) call(517, data)
+#define _GMP_REPEAT_519(call, data) _GMP_REPEAT_518(call, data) call(518, data)
+#define _GMP_REPEAT_520(call, data) _GMP_REPEAT_519(call, data) call(519, data)
+#define _GMP_REPEAT_521(call, data) _GMP_REPEAT_520(call, data) call(520, data)
+#define _GMP_REPEAT_522(call, data) _GMP_REPEAT_521(call, data) call(521, data)
+#define _GMP_REPEAT_523(call, data) _GMP_REPEAT_522(call, data) call(522, data)
+#define _GMP_REPEAT_524(call, data) _GMP_REPEAT_523(call, data) call(523, data)
+#define _GMP_REPEAT_525(call, data) _GMP_REPEAT_524(call, data) call(524, data)
+#define _GMP_REPEAT_526(call, data) _GMP_REPEAT_525(call, data) call(525, data)
+#define _GMP_REPEAT_527(call, data) _GMP_REPEAT_526(call, data) call(526, data)
+#define _GMP_REPEAT_528(call, data) _GMP_REPEAT_527(call, data) call(527, data)
+#define _GMP_REPEAT_529(call, data) _GMP_REPEAT_528(call, data) call(528, data)
+#define _GMP_REPEAT_530(call, data) _GMP_REPEAT_529(call, data) call(529, data)
+#define _GMP_REPEAT_531(call, data) _GMP_REPEAT_530(call, data) call(530, data)
+#define _GMP_REPEAT_532(call, data) _GMP_REPEAT_531(call, data) call(531, data)
+#define _GMP_REPEAT_533(call, data) _GMP_REPEAT_532(call, data) call(532, data)
+#define _GMP_REPEAT_534(call, data) _GMP_REPEAT_533(call, data) call(533, data)
+#define _GMP_REPEAT_535(call, data) _GMP_REPEAT_534(call, data) call(534, data)
+#define _GMP_REPEAT_536(call, data) _GMP_REPEAT_535(call, data) call(535, data)
+#define _GMP_REPEAT_537(call, data) _GMP_REPEAT_536(call, data) call(536, data)
+#define _GMP_REPEAT_538(call, data) _GMP_REPEAT_537(call, data) call(537, data)
+#define _GMP_REPEAT_539(call, data) _GMP_REPEAT_538(call, data) call(538, data)
+#define _GMP_REPEAT_540(call, data) _GMP_REPEAT_539(call, data) call(539, data)
+#define _GMP_REPEAT_541(call, data) _GMP_REPEAT_540(call, data) call(540, data)
+#define _GMP_REPEAT_542(call, data) _GMP_REPEAT_541(call, data) call(541, data)
+#define _GMP_REPEAT_543(call, data) _GMP_REPEAT_542(call, data) call(542, data)
+#define _GMP_REPEAT_544(call, data) _GMP_REPEAT_543(call, data) call(543, data)
+#define _GMP_REPEAT_545(call, data) _GMP_REPEAT_544(call, data) call(544, data)
+#define _GMP_REPEAT_546(call, data) _GMP_REPEAT_545(call, data) call(545, data)
+#define _GMP_REPEAT_547(call, data) _GMP_REPEAT_546(call, data) call(546, data)
+#define _GMP_REPEAT_548(call, data) _GMP_REPEAT_547(call, data) call(547, data)
+#define _GMP_REPEAT_549(call, data) _GMP_REPEAT_548(call, data) call(548, data)
+#define _GMP_REPEAT_550(call, data) _GMP_REPEAT_549(call, data) call(549, data)
+#define _GMP_REPEAT_551(call, data) _GMP_REPEAT_550(call, data) call(550, data)
+#define _GMP_REPEAT_552(call, data) _GMP_REPEAT_551(call, data) call(551, data)
+#define _GMP_REPEAT_553(call, data) _GMP_REPEAT_552(call, data) call(552, data)
+#define _GMP_REPEAT_554(call, data) _GMP_REPEAT_553(call, data) call(553, data)
+#define _GMP_REPEAT_555(call, data) _GMP_REPEAT_554(call, data) call(554, data)
+#define _GMP_REPEAT_556(call, data) _GMP_REPEAT_555(call, data) call(555, data)
+#define _GMP_REPEAT_557(call, data) _GMP_REPEAT_556(call, data) call(556, data)
+#define _GMP_REPEAT_558(call, data) _GMP_REPEAT_557(call, data) call(557, data)
+#define _GMP_REPEAT_559(call, data) _GMP_REPEAT_558(call, data) call(558, data)
+#define _GMP_REPEAT_560(call, data) _GMP_REPEAT_559(call, data) call(559, data)
+#define _GMP_REPEAT_561(call, data) _GMP_REPEAT_560(call, data) call(560, data)
+#define _GMP_REPEAT_562(call, data) _GMP_REPEAT_561(call, data) call(561, data)
+#define _GMP_REPEAT_563(call, data) _GMP_REPEAT_562(call, data) call(562, data)
+#define _GMP_REPEAT_564(call, data) _GMP_REPEAT_563(call, data) call(563, data)
+#define _GMP_REPEAT_565(call, data) _GMP_REPEAT_564(call, data) call(564, data)
+#define _GMP_REPEAT_566(call, data) _GMP_REPEAT_565(call, data) call(565, data)
+#define _GMP_REPEAT_567(call, data) _GMP_REPEAT_566(call, data) call(566, data)
+#define _GMP_REPEAT_568(call, data) _GMP_REPEAT_567(call, data) call(567, data)
+#define _GMP_REPEAT_569(call, data) _GMP_REPEAT_568(call, data) call(568, data)
+#define _GMP_REPEAT_570(call, data) _GMP_REPEAT_569(call, data) call(569, data)
+#define _GMP_REPEAT_571(call, data) _GMP_REPEAT_570(call, data) call(570, data)
+#define _GMP_REPEAT_572(call, data) _GMP_REPEAT_571(call, data) call(571, data)
+#define _GMP_REPEAT_573(call, data) _GMP_REPEAT_572(call, data) call(572, data)
+#define _GMP_REPEAT_574(call, data) _GMP_REPEAT_573(call, data) call(573, data)
+#define _GMP_REPEAT_575(call, data) _GMP_REPEAT_574(call, data) call(574, data)
+#define _GMP_REPEAT_576(call, data) _GMP_REPEAT_575(call, data) call(575, data)
+#define _GMP_REPEAT_577(call, data) _GMP_REPEAT_576(call, data) call(576, data)
+#define _GMP_REPEAT_578(call, data) _GMP_REPEAT_577(call, data) call(577, data)
+#define _GMP_REPEAT_579(call, data) _GMP_REPEAT_578(call, data) call(578, data)
+#define _GMP_REPEAT_580(call, data) _GMP_REPEAT_579(call, data) call(579, data)
+#define _GMP_REPEAT_581(call, data) _GMP_REPEAT_580(call, data) call(580, data)
+#define _GMP_REPEAT_582(call, data) _GMP_REPEAT_581(call, data) call(581, data)
+#define _GMP_REPEAT_583(call, data) _GMP_REPEAT_582(call, data) call(582, data)
+#define _GMP_REPEAT_584(call, data) _GMP_REPEAT_583(call, data) call(583, data)
+#define _GMP_REPEAT_585(call, data) _GMP_REPEAT_584(call, data) call(584, data)
+#define _GMP_REPEAT_586(call, data) _GMP_REPEAT_585(call, data) call(585, data)
+#define _GMP_REPEAT_587(call, data) _GMP_REPEAT_586(call, data) call(586, data)
+#define _GMP_REPEAT_588(call, data) _GMP_REPEAT_587(call, data) call(587, data)
+#define _GMP_REPEAT_589(call, data) _GMP_REPEAT_588(call, data) call(588, data)
+#define _GMP_REPEAT_590(call, data) _GMP_REPEAT_589(call, data) call(589, data)
+#define _GMP_REPEAT_591(call, data) _GMP_REPEAT_590(call, data) call(590, data)
+#define _GMP_REPEAT_592(call, data) _GMP_REPEAT_591(call, data) call(591, data)
+#define _GMP_REPEAT_593(call, data) _GMP_REPEAT_592(call, data) call(592, data)
+#define _GMP_REPEAT_594(call, data) _GMP_REPEAT_593(call, data) call(593, data)
+#define _GMP_REPEAT_595(call, data) _GMP_REPEAT_594(call, data) call(594, data)
+#define _GMP_REPEAT_596(call, data) _GMP_REPEAT_595(call, data) call(595, data)
+#define _GMP_REPEAT_597(call, data) _GMP_REPEAT_596(call, data) call(596, data)
+#define _GMP_REPEAT_598(call, data) _GMP_REPEAT_597(call, data) call(597, data)
+#define _GMP_REPEAT_599(call, data) _GMP_REPEAT_598(call, data) call(598, data)
+#define _GMP_REPEAT_600(call, data) _GMP_REPEAT_599(call, data) call(599, data)
+#define _GMP_REPEAT_601(call, data) _GMP_REPEAT_600(call, data) call(600, data)
+#define _GMP_REPEAT_602(call, data) _GMP_REPEAT_601(call, data) call(601, data)
+#define _GMP_REPEAT_603(call, data) _GMP_REPEAT_602(call, data) call(602, data)
+#define _GMP_REPEAT_604(call, data) _GMP_REPEAT_603(call, data) call(603, data)
+#define _GMP_REPEAT_605(call, data) _GMP_REPEAT_604(call, data) call(604, data)
+#define _GMP_REPEAT_606(call, data) _GMP_REPEAT_605(call, data) call(605, data)
+#define _GMP_REPEAT_607(call, data) _GMP_REPEAT_606(call, data) call(606, data)
+#define _GMP_REPEAT_608(call, data) _GMP_REPEAT_607(call, data) call(607, data)
+#define _GMP_REPEAT_609(call, data) _GMP_REPEAT_608(call, data) call(608, data)
+#define _GMP_REPEAT_610(call, data) _GMP_REPEAT_609(call, data) call(609, data)
+#define _GMP_REPEAT_611(call, data) _GMP_REPEAT_610(call, data) call(610, data)
+#define _GMP_REPEAT_612(call, data) _GMP_REPEAT_611(call, data) call(611, data)
+#define _GMP_REPEAT_613(call, data) _GMP_REPEAT_612(call, data) call(612, data)
+#define _GMP_REPEAT_614(call, data) _GMP_REPEAT_613(call, data) call(613, data)
+#define _GMP_REPEAT_615(call, data) _GMP_REPEAT_614(call, data) call(614, data)
+#define _GMP_REPEAT_616(call, data) _GMP_REPEAT_615(call, data) call(615, data)
+#define _GMP_REPEAT_617(call, data) _GMP_REPEAT_616(call, data) call(616, data)
+#define _GMP_REPEAT_618(call, data) _GMP_REPEAT_617(call, data) call(617, data)
+#define _GMP_REPEAT_619(call, data) _GMP_REPEAT_618(call, data) call(618, data)
+#define _GMP_REPEAT_620(call, data) _GMP_REPEAT_619(call, data) call(619, data)
+#define _GMP_REPEAT_621(call, data) _GMP_REPEAT_620(call, data) call(620, data)
+#define _GMP_REPEAT_622(call, data) _GMP_REPEAT_621(call, data) call(621, data)
+#define _GMP_REPEAT_623(call, data) _GMP_REPEAT_622(call, data) call(622, data)
+#define _GMP_REPEAT_624(call, data) _GMP_REPEAT_623(call, data) call(623, data)
+#define _GMP_REPEAT_625(call, data) _GMP_REPEAT_624(call, data) call(624, data)
+#define _GMP_REPEAT_626(call, data) _GMP_REPEAT_625(call, data) call(625, data)
+#define _GMP_REPEAT_627(call, data) _GMP_REPEAT_626(call, data) call(626, data)
+#define _GMP_REPEAT_628(call, data) _GMP_REPEAT_627(call, data) call(627, data)
+#define _GMP_REPEAT_629(call, data) _GMP_REPEAT_628(call, data) call(628, data)
+#define _GMP_REPEAT_630(call, data) _GMP_REPEAT_629(call, data) call(629, data)
+#define _GMP_REPEAT_631(call, data) _GMP_REPEAT_630(call, data) call(630, data)
+#define _GMP_REPEAT_632(call, data) _GMP_REPEAT_631(call, data) call(631, data)
+#define _GMP_REPEAT_633(call, data) _GMP_REPEAT_632(call, data) call(632, data)
+#define _GMP_REPEAT_634(call, data) _GMP_REPEAT_633(call, data) call(633, data)
+#define _GMP_REPEAT_635(call, data) _GMP_REPEAT_634(call, data) call(634, data)
+#define _GMP_REPEAT_636(call, data) _GMP_REPEAT_635(call, data) call(635, data)
+#define _GMP_REPEAT_637(call, data) _GMP_REPEAT_636(call, data) call(636, data)
+#define _GMP_REPEAT_638(call, data) _GMP_REPEAT_637(call, data) call(637, data)
+#define _GMP_REPEAT_639(call, data) _GMP_REPEAT_638(call, data) call(638, data)
+#define _GMP_REPEAT_640(call, data) _GMP_REPEAT_639(call, data) call(639, data)
+#define _GMP_REPEAT_641(call, data) _GMP_REPEAT_640(call, data) call(640, data)
+#define _GMP_REPEAT_642(call, data) _GMP_REPEAT_641(call, data) call(641, data)
+#define _GMP_REPEAT_643(call, data) _GMP_REPEAT_642(call, data) call(642, data)
+#define _GMP_REPEAT_644(call, data) _GMP_REPEAT_643(call, data) call(643, data)
+#define _GMP_REPEAT_645(call, data) _GMP_REPEAT_644(call, data) call(644, data)
+#define _GMP_REPEAT_646(call, data) _GMP_REPEAT_645(call, data) call(645, data)
+#define _GMP_REPEAT_647(call, data) _GMP_REPEAT_646(call, data) call(646, data)
+#define _GMP_REPEAT_648(call, data) _GMP_REPEAT_647(call, data) call(647, data)
+#define _GMP_REPEAT_649(call, data) _GMP_REPEAT_648(call, data) call(648, data)
+#define _GMP_REPEAT_650(call, data) _GMP_REPEAT_649(call, data) call(649, data)
+#define _GMP_REPEAT_651(call, data) _GMP_REPEAT_650(call, data) call(650, data)
+#define _GMP_REPEAT_652(call, data) _GMP_REPEAT_651(call, data) call(651, data)
+#define _GMP_REPEAT_653(call, data) _GMP_REPEAT_652(call, data) call(652, data)
+#define _GMP_REPEAT_654(call, data) _GMP_REPEAT_653(call, data) call(653, data)
+#define _GMP_REPEAT_655(call, data) _GMP_REPEAT_654(call, data) call(654, data)
+#define _GMP_REPEAT_656(call, data) _GMP_REPEAT_655(call, data) call(655, data)
+#define _GMP_REPEAT_657(call, data) _GMP_REPEAT_656(call, data) call(656, data)
+#define _GMP_REPEAT_658(call, data) _GMP_REPEAT_657(call, data) call(657, data)
+#define _GMP_REPEAT_659(call, data) _GMP_REPEAT_658(call, data) call(658, data)
+#define _GMP_REPEAT_660(call, data) _GMP_REPEAT_659(call, data) call(659, data)
+#define _GMP_REPEAT_661(call, data) _GMP_REPEAT_660(call, data) call(660, data)
+#define _GMP_REPEAT_662(call, data) _GMP_REPEAT_661(call, data) call(661, data)
+#define _GMP_REPEAT_663(call, data) _GMP_REPEAT_662(call, data) call(662, data)
+#define _GMP_REPEAT_664(call, data) _GMP_REPEAT_663(call, data) call(663, data)
+#define _GMP_REPEAT_665(call, data) _GMP_REPEAT_664(call, data) call(664, data)
+#define _GMP_REPEAT_666(call, data) _GMP_REPEAT_665(call, data) call(665, data)
+#define _GMP_REPEAT_667(call, data) _GMP_REPEAT_666(call, data) call(666, data)
+#define _GMP_REPEAT_668(call, data) _GMP_REPEAT_667(call, data) call(667, data)
+#define _GMP_REPEAT_669(call, data) _GMP_REPEAT_668(call, data) call(668, data)
+#define _GMP_REPEAT_670(call, data) _GMP_REPEAT_669(call, data) call(669, data)
+#define _GMP_REPEAT_671(call, data) _GMP_REPEAT_670(call, data) call(670, data)
+#define _GMP_REPEAT_672(call, data) _GMP_REPEAT_671(call, data) call(671, data)
+#define _GMP_REPEAT_673(call, data) _GMP_REPEAT_672(call, data) call(672, data)
+#define _GMP_REPEAT_674(call, data) _GMP_REPEAT_673(call, data) call(673, data)
+#define _GMP_REPEAT_675(call, data) _GMP_REPEAT_674(call, data) call(674, data)
+#define _GMP_REPEAT_676(call, data) _GMP_REPEAT_675(call, data) call(675, data)
+#define _GMP_REPEAT_677(call, data) _GMP_REPEAT_676(call, data) call(676, data)
+#define _GMP_REPEAT_678(call, data) _GMP_REPEAT_677(call, data) call(677, data)
+#define _GMP_REPEAT_679(call, data) _GMP_REPEAT_678(call, data) call(678, data)
+#define _GMP_REPEAT_680(call, data) _GMP_REPEAT_679(call, data) call(679, data)
+#define _GMP_REPEAT_681(call, data) _GMP_REPEAT_680(call, data) call(680, data)
+#define _GMP_REPEAT_682(call, data) _GMP_REPEAT_681(call, data) call(681, data)
+#define _GMP_REPEAT_683(call, data) _GMP_REPEAT_682(call, data) call(682, data)
+#define _GMP_REPEAT_684(call, data) _GMP_REPEAT_683(call, data) call(683, data)
+#define _GMP_REPEAT_685(call, data) _GMP_REPEAT_684(call, data) call(684, data)
+#define _GMP_REPEAT_686(call, data) _GMP_REPEAT_685(call, data) call(685, data)
+#define _GMP_REPEAT_687(call, data) _GMP_REPEAT_686(call, data) call(686, data)
+#define _GMP_REPEAT_688(call, data) _GMP_REPEAT_687(call, data) call(687, data)
+#define _GMP_REPEAT_689(call, data) _GMP_REPEAT_688(call, data) call(688, data)
+#define _GMP_REPEAT_690(call, data) _GMP_REPEAT_689(call, data) call(689, data)
+#define _GMP_REPEAT_691(call, data) _GMP_REPEAT_690(call, data) call(690, data)
+#define _GMP_REPEAT_692(call, data) _GMP_REPEAT_691(call, data) call(691, data)
+#define _GMP_REPEAT_693(call, data) _GMP_REPEAT_692(call, data) call(692, data)
+#define _GMP_REPEAT_694(call, data) _GMP_REPEAT_693(call, data) call(693, data)
+#define _GMP_REPEAT_695(call, data) _GMP_REPEAT_694(call, data) call(694, data)
+#define _GMP_REPEAT_696(call, data) _GMP_REPEAT_695(call, data) call(695, data)
+#define _GMP_REPEAT_697(call, data) _GMP_REPEAT_696(call, data) call(696, data)
+#define _GMP_REPEAT_698(call, data) _GMP_REPEAT_697(call, data) call(697, data)
+#define _GMP_REPEAT_699(call, data) _GMP_REPEAT_698(call, data) call(698, data)
+#define _GMP_REPEAT_700(call, data) _GMP_REPEAT_699(call, data) call(699, data)
+#define _GMP_REPEAT_701(call, data) _GMP_REPEAT_700(call, data) call(700, data)
+#define _GMP_REPEAT_702(call, data) _GMP_REPEAT_701(call, data) call(701, data)
+#define _GMP_REPEAT_703(call, data) _GMP_REPEAT_702(call, data) call(702, data)
+#define _GMP_REPEAT_704(call, data) _GMP_REPEAT_703(call, data) call(703, data)
+#define _GMP_REPEAT_705(call, data) _GMP_REPEAT_704(call, data) call(704, data)
+#define _GMP_REPEAT_706(call, data) _GMP_REPEAT_705(call, data) call(705, data)
+#define _GMP_REPEAT_707(call, data) _GMP_REPEAT_706(call, data) call(706, data)
+#define _GMP_REPEAT_708(call, data) _GMP_REPEAT_707(call, data) call(707, data)
+#define _GMP_REPEAT_709(call, data) _GMP_REPEAT_708(call, data) call(708, data)
+#define _GMP_REPEAT_710(call, data) _GMP_REPEAT_709(call, data) call(709, data)
+#define _GMP_REPEAT_711(call, data) _GMP_REPEAT_710(call, data) call(710, data)
+#define _GMP_REPEAT_712(call, data) _GMP_REPEAT_711(call, data) call(711, data)
+#define _GMP_REPEAT_713(call, data) _GMP_REPEAT_712(call, data) call(712, data)
+#define _GMP_REPEAT_714(call, data) _GMP_REPEAT_713(call, data) call(713, data)
+#define _GMP_REPEAT_715(call, data) _GMP_REPEAT_714(call, data) call(714, data)
+#define _GMP_REPEAT_716(call, data) _GMP_REPEAT_715(call, data) call(715, data)
+#define _GMP_REPEAT_717(call, data) _GMP_REPEAT_716(call, data) call(716, data)
+#define _GMP_REPEAT_718(call, data) _GMP_REPEAT_717(call, data) call(717, data)
+#define _GMP_REPEAT_719(call, data) _GMP_REPEAT_718(call, data) call(718, data)
+#define _GMP_REPEAT_720(call, data) _GMP_REPEAT_719(call, data) call(719, data)
+#define _GMP_REPEAT_721(call, data) _GMP_REPEAT_720(call, data) call(720, data)
+#define _GMP_REPEAT_722(call, data) _GMP_REPEAT_721(call, data) call(721, data)
+#define _GMP_REPEAT_723(call, data) _GMP_REPEAT_722(call, data) call(722, data)
+#define _GMP_REPEAT_724(call, data) _GMP_REPEAT_723(call, data) call(723, data)
+#define _GMP_REPEAT_725(call, data) _GMP_REPEAT_724(call, data) call(724, data)
+#define _GMP_REPEAT_726(call, data) _GMP_REPEAT_725(call, data) call(725, data)
+#define _GMP_REPEAT_727(call, data) _GMP_REPEAT_726(call, data) call(726, data)
+#define _GMP_REPEAT_728(call, data) _GMP_REPEAT_727(call, data) call(727, data)
+#define _GMP_REPEAT_729(call, data) _GMP_REPEAT_728(call, data) call(728, data)
+#define _GMP_REPEAT_730(call, data) _GMP_REPEAT_729(call, data) call(729, data)
+#define _GMP_REPEAT_731(call, data) _GMP_REPEAT_730(call, data) call(730, data)
+#define _GMP_REPEAT_732(call, data) _GMP_REPEAT_731(call, data) call(731, data)
+#define _GMP_REPEAT_733(call, data) _GMP_REPEAT_732(call, data) call(732, data)
+#define _GMP_REPEAT_734(call, data) _GMP_REPEAT_733(call, data) call(733, data)
+#define _GMP_REPEAT_735(call, data) _GMP_REPEAT_734(call, data) call(734, data)
+#define _GMP_REPEAT_736(call, data) _GMP_REPEAT_735(call, data) call(735, data)
+#define _GMP_REPEAT_737(call, data) _GMP_REPEAT_736(call, data) call(736, data)
+#define _GMP_REPEAT_738(call, data) _GMP_REPEAT_737(call, data) call(737, data)
+#define _GMP_REPEAT_739(call, data) _GMP_REPEAT_738(call, data) call(738, data)
+#define _GMP_REPEAT_740(call, data) _GMP_REPEAT_739(call, data) call(739, data)
+#define _GMP_REPEAT_741(call, data) _GMP_REPEAT_740(call, data) call(740, data)
+#define _GMP_REPEAT_742(call, data) _GMP_REPEAT_741(call, data) call(741, data)
+#define _GMP_REPEAT_743(call, data) _GMP_REPEAT_742(call, data) call(742, data)
+#define _GMP_REPEAT_744(call, data) _GMP_REPEAT_743(call, data) call(743, data)
+#define _GMP_REPEAT_745(call, data) _GMP_REPEAT_744(call, data) call(744, data)
+#define _GMP_REPEAT_746(call, data) _GMP_REPEAT_745(call, data) call(745, data)
+#define _GMP_REPEAT_747(call, data) _GMP_REPEAT_746(call, data) call(746, data)
+#define _GMP_REPEAT_748(call, data) _GMP_REPEAT_747(call, data) call(747, data)
+#define _GMP_REPEAT_749(call, data) _GMP_REPEAT_748(call, data) call(748, data)
+#define _GMP_REPEAT_750(call, data) _GMP_REPEAT_749(call, data) call(749, data)
+#define _GMP_REPEAT_751(call, data) _GMP_REPEAT_750(call, data) call(750, data)
+#define _GMP_REPEAT_752(call, data) _GMP_REPEAT_751(call, data) call(751, data)
+#define _GMP_REPEAT_753(call, data) _GMP_REPEAT_752(call, data) call(752, data)
+#define _GMP_REPEAT_754(call, data) _GMP_REPEAT_753(call, data) call(753, data)
+#define _GMP_REPEAT_755(call, data) _GMP_REPEAT_754(call, data) call(754, data)
+#define _GMP_REPEAT_756(call, data) _GMP_REPEAT_755(call, data) call(755, data)
+#define _GMP_REPEAT_757(call, data) _GMP_REPEAT_756(call, data) call(756, data)
+#define _GMP_REPEAT_758(call, data) _GMP_REPEAT_757(call, data) call(757, data)
+#define _GMP_REPEAT_759(call, data) _GMP_REPEAT_758(call, data) call(758, data)
+#define _GMP_REPEAT_760(call, data) _GMP_REPEAT_759(call, data) call(759, data)
+#define _GMP_REPEAT_761(call, data) _GMP_REPEAT_760(call, data) call(760, data)
+#define _GMP_REPEAT_762(call, data) _GMP_REPEAT_761(call, data) call(761, data)
+#define _GMP_REPEAT_763(call, data) _GMP_REPEAT_762(call, data) call(762, data)
+#define _GMP_REPEAT_764(call, data) _GMP_REPEAT_763(call, data) call(763, data)
+#define _GMP_REPEAT_765(call, data) _GMP_REPEAT_764(call, data) call(764, data)
+#define _GMP_REPEAT_766(call, data) _GMP_REPEAT_765(call, data) call(765, data)
+#define _GMP_REPEAT_767(call, data) _GMP_REPEAT_766(call, data) call(766, data)
+#define _GMP_REPEAT_768(call, data) _GMP_REPEAT_767(call, data) call(767, data)
+#define _GMP_REPEAT_769(call, data) _GMP_REPEAT_768(call, data) call(768, data)
+#define _GMP_REPEAT_770(call, data) _GMP_REPEAT_769(call, data) call(769, data)
+#define _GMP_REPEAT_771(call, data) _GMP_REPEAT_770(call, data) call(770, data)
+#define _GMP_REPEAT_772(call, data) _GMP_REPEAT_771(call, data) call(771, data)
+#define _GMP_REPEAT_773(call, data) _GMP_REPEAT_772(call, data) call(772, data)
+#define _GMP_REPEAT_774(call, data) _GMP_REPEAT_773(call, data) call(773, data)
+#define _GMP_REPEAT_775(call, data) _GMP_REPEAT_774(call, data) call(774, data)
+#define _GMP_REPEAT_776(call, data) _GMP_REPEAT_775(call, data) call(775, data)
+#define _GMP_REPEAT_777(call, data) _GMP_REPEAT_776(call, data) call(776, data)
+#define _GMP_REPEAT_778(call, data) _GMP_REPEAT_777(call, data) call(777, data)
+#define _GMP_REPEAT_779(call, data) _GMP_REPEAT_778(call, data) call(778, data)
+#define _GMP_REPEAT_780(call, data) _GMP_REPEAT_779(call, data) call(779, data)
+#define _GMP_REPEAT_781(call, data) _GMP_REPEAT_780(call, data) call(780, data)
+#define _GMP_REPEAT_782(call, data) _GMP_REPEAT_781(call, data) call(781, data)
+#define _GMP_REPEAT_783(call, data) _GMP_REPEAT_782(call, data) call(782, data)
+#define _GMP_REPEAT_784(call, data) _GMP_REPEAT_783(call, data) call(783, data)
+#define _GMP_REPEAT_785(call, data) _GMP_REPEAT_784(call, data) call(784, data)
+#define _GMP_REPEAT_786(call, data) _GMP_REPEAT_785(call, data) call(785, data)
+#define _GMP_REPEAT_787(call, data) _GMP_REPEAT_786(call, data) call(786, data)
+#define _GMP_REPEAT_788(call, data) _GMP_REPEAT_787(call, data) call(787, data)
+#define _GMP_REPEAT_789(call, data) _GMP_REPEAT_788(call, data) call(788, data)
+#define _GMP_REPEAT_790(call, data) _GMP_REPEAT_789(call, data) call(789, data)
+#define _GMP_REPEAT_791(call, data) _GMP_REPEAT_790(call, data) call(790, data)
+#define _GMP_REPEAT_792(call, data) _GMP_REPEAT_791(call, data) call(791, data)
+#define _GMP_REPEAT_793(call, data) _GMP_REPEAT_792(call, data) call(792, data)
+#define _GMP_REPEAT_794(call, data) _GMP_REPEAT_793(call, data) call(793, data)
+#define _GMP_REPEAT_795(call, data) _GMP_REPEAT_794(call, data) call(794, data)
+#define _GMP_REPEAT_796(call, data) _GMP_REPEAT_795(call, data) call(795, data)
+#define _GMP_REPEAT_797(call, data) _GMP_REPEAT_796(call, data) call(796, data)
+#define _GMP_REPEAT_798(call, data) _GMP_REPEAT_797(call, data) call(797, data)
+#define _GMP_REPEAT_799(call, data) _GMP_REPEAT_798(call, data) call(798, data)
+#define _GMP_REPEAT_800(call, data) _GMP_REPEAT_799(call, data) call(799, data)
+#define _GMP_REPEAT_801(call, data) _GMP_REPEAT_800(call, data) call(800, data)
+#define _GMP_REPEAT_802(call, data) _GMP_REPEAT_801(call, data) call(801, data)
+#define _GMP_REPEAT_803(call, data) _GMP_REPEAT_802(call, data) call(802, data)
+#define _GMP_REPEAT_804(call, data) _GMP_REPEAT_803(call, data) call(803, data)
+#define _GMP_REPEAT_805(call, data) _GMP_REPEAT_804(call, data) call(804, data)
+#define _GMP_REPEAT_806(call, data) _GMP_REPEAT_805(call, data) call(805, data)
+#define _GMP_REPEAT_807(call, data) _GMP_REPEAT_806(call, data) call(806, data)
+#define _GMP_REPEAT_808(call, data) _GMP_REPEAT_807(call, data) call(807, data)
+#define _GMP_REPEAT_809(call, data) _GMP_REPEAT_808(call, data) call(808, data)
+#define _GMP_REPEAT_810(call, data) _GMP_REPEAT_809(call, data) call(809, data)
+#define _GMP_REPEAT_811(call, data) _GMP_REPEAT_810(call, data) call(810, data)
+#define _GMP_REPEAT_812(call, data) _GMP_REPEAT_811(call, data) call(811, data)
+#define _GMP_REPEAT_813(call, data) _GMP_REPEAT_812(call, data) call(812, data)
+#define _GMP_REPEAT_814(call, data) _GMP_REPEAT_813(call, data) call(813, data)
+#define _GMP_REPEAT_815(call, data) _GMP_REPEAT_814(call, data) call(814, data)
+#define _GMP_REPEAT_816(call, data) _GMP_REPEAT_815(call, data) call(815, data)
+#define _GMP_REPEAT_817(call, data) _GMP_REPEAT_816(call, data) call(816, data)
+#define _GMP_REPEAT_818(call, data) _GMP_REPEAT_817(call, data) call(817, data)
+#define _GMP_REPEAT_819(call, data) _GMP_REPEAT_818(call, data) call(818, data)
+#define _GMP_REPEAT_820(call, data) _GMP_REPEAT_819(call, data) call(819, data)
+#define _GMP_REPEAT_821(call, data) _GMP_REPEAT_820(call, data) call(820, data)
+#define _GMP_REPEAT_822(call, data) _GMP_REPEAT_821(call, data) call(821, data)
+#define _GMP_REPEAT_823(call, data) _GMP_REPEAT_822(call, data) call(822, data)
+#define _GMP_REPEAT_824(call, data) _GMP_REPEAT_823(call, data) call(823, data)
+#define _GMP_REPEAT_825(call, data) _GMP_REPEAT_824(call, data) call(824, data)
+#define _GMP_REPEAT_826(call, data) _GMP_REPEAT_825(call, data) call(825, data)
+#define _GMP_REPEAT_827(call, data) _GMP_REPEAT_826(call, data) call(826, data)
+#define _GMP_REPEAT_828(call, data) _GMP_REPEAT_827(call, data) call(827, data)
+#define _GMP_REPEAT_829(call, data) _GMP_REPEAT_828(call, data) call(828, data)
+#define _GMP_REPEAT_830(call, data) _GMP_REPEAT_829(call, data) call(829, data)
+#define _GMP_REPEAT_831(call, data) _GMP_REPEAT_830(call, data) call(830, data)
+#define _GMP_REPEAT_832(call, data) _GMP_REPEAT_831(call, data) call(831, data)
+#define _GMP_REPEAT_833(call, data) _GMP_REPEAT_832(call, data) call(832, data)
+#define _GMP_REPEAT_834(call, data) _GMP_REPEAT_833(call, data) call(833, data)
+#define _GMP_REPEAT_835(call, data) _GMP_REPEAT_834(call, data) call(834, data)
+#define _GMP_REPEAT_836(call, data) _GMP_REPEAT_835(call, data) call(835, data)
+#define _GMP_REPEAT_837(call, data) _GMP_REPEAT_836(call, data) call(836, data)
+#define _GMP_REPEAT_838(call, data) _GMP_REPEAT_837(call, data) call(837, data)
+#define _GMP_REPEAT_839(call, data) _GMP_REPEAT_838(call, data) call(838, data)
+#define _GMP_REPEAT_840(call, data) _GMP_REPEAT_839(call, data) call(839, data)
+#define _GMP_REPEAT_841(call, data) _GMP_REPEAT_840(call, data) call(840, data)
+#define _GMP_REPEAT_842(call, data) _GMP_REPEAT_841(call, data) call(841, data)
+#define _GMP_REPEAT_843(call, data) _GMP_REPEAT_842(call, data) call(842, data)
+#define _GMP_REPEAT_844(call, data) _GMP_REPEAT_843(call, data) call(843, data)
+#define _GMP_REPEAT_845(call, data) _GMP_REPEAT_844(call, data) call(844, data)
+#define _GMP_REPEAT_846(call, data) _GMP_REPEAT_845(call, data) call(845, data)
+#define _GMP_REPEAT_847(call, data) _GMP_REPEAT_846(call, data) call(846, data)
+#define _GMP_REPEAT_848(call, data) _GMP_REPEAT_847(call, data) call(847, data)
+#define _GMP_REPEAT_849(call, data) _GMP_REPEAT_848(call, data) call(848, data)
+#define _GMP_REPEAT_850(call, data) _GMP_REPEAT_849(call, data) call(849, data)
+#define _GMP_REPEAT_851(call, data) _GMP_REPEAT_850(call, data) call(850, data)
+#define _GMP_REPEAT_852(call, data) _GMP_REPEAT_851(call, data) call(851, data)
+#define _GMP_REPEAT_853(call, data) _GMP_REPEAT_852(call, data) call(852, data)
+#define _GMP_REPEAT_854(call, data) _GMP_REPEAT_853(call, data) call(853, data)
+#define _GMP_REPEAT_855(call, data) _GMP_REPEAT_854(call, data) call(854, data)
+#define _GMP_REPEAT_856(call, data) _GMP_REPEAT_855(call, data) call(855, data)
+#define _GMP_REPEAT_857(call, data) _GMP_REPEAT_856(call, data) call(856, data)
+#define _GMP_REPEAT_858(call, data) _GMP_REPEAT_857(call, data) call(857, data)
+#define _GMP_REPEAT_859(call, data) _GMP_REPEAT_858(call, data) call(858, data)
+#define _GMP_REPEAT_860(call, data) _GMP_REPEAT_859(call, data) call(859, data)
+#define _GMP_REPEAT_861(call, data) _GMP_REPEAT_860(call, data) call(860, data)
+#define _GMP_REPEAT_862(call, data) _GMP_REPEAT_861(call, data) call(861, data)
+#define _GMP_REPEAT_863(call, data) _GMP_REPEAT_862(call, data) call(862, data)
+#define _GMP_REPEAT_864(call, data) _GMP_REPEAT_863(call, data) call(863, data)
+#define _GMP_REPEAT_865(call, data) _GMP_REPEAT_864(call, data) call(864, data)
+#define _GMP_REPEAT_866(call, data) _GMP_REPEAT_865(call, data) call(865, data)
+#define _GMP_REPEAT_867(call, data) _GMP_REPEAT_866(call, data) call(866, data)
+#define _GMP_REPEAT_868(call, data) _GMP_REPEAT_867(call, data) call(867, data)
+#define _GMP_REPEAT_869(call, data) _GMP_REPEAT_868(call, data) call(868, data)
+#define _GMP_REPEAT_870(call, data) _GMP_REPEAT_869(call, data) call(869, data)
+#define _GMP_REPEAT_871(call, data) _GMP_REPEAT_870(call, data) call(870, data)
+#define _GMP_REPEAT_872(call, data) _GMP_REPEAT_871(call, data) call(871, data)
+#define _GMP_REPEAT_873(call, data) _GMP_REPEAT_872(call, data) call(872, data)
+#define _GMP_REPEAT_874(call, data) _GMP_REPEAT_873(call, data) call(873, data)
+#define _GMP_REPEAT_875(call, data) _GMP_REPEAT_874(call, data) call(874, data)
+#define _GMP_REPEAT_876(call, data) _GMP_REPEAT_875(call, data) call(875, data)
+#define _GMP_REPEAT_877(call, data) _GMP_REPEAT_876(call, data) call(876, data)
+#define _GMP_REPEAT_878(call, data) _GMP_REPEAT_877(call, data) call(877, data)
+#define _GMP_REPEAT_879(call, data) _GMP_REPEAT_878(call, data) call(878, data)
+#define _GMP_REPEAT_880(call, data) _GMP_REPEAT_879(call, data) call(879, data)
+#define _GMP_REPEAT_881(call, data) _GMP_REPEAT_880(call, data) call(880, data)
+#define _GMP_REPEAT_882(call, data) _GMP_REPEAT_881(call, data) call(881, data)
+#define _GMP_REPEAT_883(call, data) _GMP_REPEAT_882(call, data) call(882, data)
+#define _GMP_REPEAT_884(call, data) _GMP_REPEAT_883(call, data) call(883, data)
+#define _GMP_REPEAT_885(call, data) _GMP_REPEAT_884(call, data) call(884, data)
+#define _GMP_REPEAT_886(call, data) _GMP_REPEAT_885(call, data) call(885, data)
+#define _GMP_REPEAT_887(call, data) _GMP_REPEAT_886(call, data) call(886, data)
+#define _GMP_REPEAT_888(call, data) _GMP_REPEAT_887(call, data) call(887, data)
+#define _GMP_REPEAT_889(call, data) _GMP_REPEAT_888(call, data) call(888, data)
+#define _GMP_REPEAT_890(call, data) _GMP_REPEAT_889(call, data) call(889, data)
+#define _GMP_REPEAT_891(call, data) _GMP_REPEAT_890(call, data) call(890, data)
+#define _GMP_REPEAT_892(call, data) _GMP_REPEAT_891(call, data) call(891, data)
+#define _GMP_REPEAT_893(call, data) _GMP_REPEAT_892(call, data) call(892, data)
+#define _GMP_REPEAT_894(call, data) _GMP_REPEAT_893(call, data) call(893, data)
+#define _GMP_REPEAT_895(call, data) _GMP_REPEAT_894(call, data) call(894, data)
+#define _GMP_REPEAT_896(call, data) _GMP_REPEAT_895(call, data) call(895, data)
+#define _GMP_REPEAT_897(call, data) _GMP_REPEAT_896(call, data) call(896, data)
+#define _GMP_REPEAT_898(call, data) _GMP_REPEAT_897(call, data) call(897, data)
+#define _GMP_REPEAT_899(call, data) _GMP_REPEAT_898(call, data) call(898, data)
+#define _GMP_REPEAT_900(call, data) _GMP_REPEAT_899(call, data) call(899, data)
+#define _GMP_REPEAT_901(call, data) _GMP_REPEAT_900(call, data) call(900, data)
+#define _GMP_REPEAT_902(call, data) _GMP_REPEAT_901(call, data) call(901, data)
+#define _GMP_REPEAT_903(call, data) _GMP_REPEAT_902(call, data) call(902, data)
+#define _GMP_REPEAT_904(call, data) _GMP_REPEAT_903(call, data) call(903, data)
+#define _GMP_REPEAT_905(call, data) _GMP_REPEAT_904(call, data) call(904, data)
+#define _GMP_REPEAT_906(call, data) _GMP_REPEAT_905(call, data) call(905, data)
+#define _GMP_REPEAT_907(call, data) _GMP_REPEAT_906(call, data) call(906, data)
+#define _GMP_REPEAT_908(call, data) _GMP_REPEAT_907(call, data) call(907, data)
+#define _GMP_REPEAT_909(call, data) _GMP_REPEAT_908(call, data) call(908, data)
+#define _GMP_REPEAT_910(call, data) _GMP_REPEAT_909(call, data) call(909, data)
+#define _GMP_REPEAT_911(call, data) _GMP_REPEAT_910(call, data) call(910, data)
+#define _GMP_REPEAT_912(call, data) _GMP_REPEAT_911(call, data) call(911, data)
+#define _GMP_REPEAT_913(call, data) _GMP_REPEAT_912(call, data) call(912, data)
+#define _GMP_REPEAT_914(call, data) _GMP_REPEAT_913(call, data) call(913, data)
+#define _GMP_REPEAT_915(call, data) _GMP_REPEAT_914(call, data) call(914, data)
+#define _GMP_REPEAT_916(call, data) _GMP_REPEAT_915(call, data) call(915, data)
+#define _GMP_REPEAT_917(call, data) _GMP_REPEAT_916(call, data) call(916, data)
+#define _GMP_REPEAT_918(call, data) _GMP_REPEAT_917(call, data) call(917, data)
+#define _GMP_REPEAT_919(call, data) _GMP_REPEAT_918(call, data) call(918, data)
+#define _GMP_REPEAT_920(call, data) _GMP_REPEAT_919(call, data) call(919, data)
+#define _GMP_REPEAT_921(call, data) _GMP_REPEAT_920(call, data) call(920, data)
+#define _GMP_REPEAT_922(call, data) _GMP_REPEAT_921(call, data) call(921, data)
+#define _GMP_REPEAT_923(call, data) _GMP_REPEAT_922(call, data) call(922, data)
+#define _GMP_REPEAT_924(call, data) _GMP_REPEAT_923(call, data) call(923, data)
+#define _GMP_REPEAT_925(call, data) _GMP_REPEAT_924(call, data) call(924, data)
+#define _GMP_REPEAT_926(call, data) _GMP_REPEAT_925(call, data) call(925, data)
+#define _GMP_REPEAT_927(call, data) _GMP_REPEAT_926(call, data) call(926, data)
+#define _GMP_REPEAT_928(call, data) _GMP_REPEAT_927(call, data) call(927, data)
+#define _GMP_REPEAT_929(call, data) _GMP_REPEAT_928(call, data) call(928, data)
+#define _GMP_REPEAT_930(call, data) _GMP_REPEAT_929(call, data) call(929, data)
+#define _GMP_REPEAT_931(call, data) _GMP_REPEAT_930(call, data) call(930, data)
+#define _GMP_REPEAT_932(call, data) _GMP_REPEAT_931(call, data) call(931, data)
+#define _GMP_REPEAT_933(call, data) _GMP_REPEAT_932(call, data) call(932, data)
+#define _GMP_REPEAT_934(call, data) _GMP_REPEAT_933(call, data) call(933, data)
+#define _GMP_REPEAT_935(call, data) _GMP_REPEAT_934(call, data) call(934, data)
+#define _GMP_REPEAT_936(call, data) _GMP_REPEAT_935(call, data) call(935, data)
+#define _GMP_REPEAT_937(call, data) _GMP_REPEAT_936(call, data) call(936, data)
+#define _GMP_REPEAT_938(call, data) _GMP_REPEAT_937(call, data) call(937, data)
+#define _GMP_REPEAT_939(call, data) _GMP_REPEAT_938(call, data) call(938, data)
+#define _GMP_REPEAT_940(call, data) _GMP_REPEAT_939(call, data) call(939, data)
+#define _GMP_REPEAT_941(call, data) _GMP_REPEAT_940(call, data) call(940, data)
+#define _GMP_REPEAT_942(call, data) _GMP_REPEAT_941(call, data) call(941, data)
+#define _GMP_REPEAT_943(call, data) _GMP_REPEAT_942(call, data) call(942, data)
+#define _GMP_REPEAT_944(call, data) _GMP_REPEAT_943(call, data) call(943, data)
+#define _GMP_REPEAT_945(call, data) _GMP_REPEAT_944(call, data) call(944, data)
+#define _GMP_REPEAT_946(call, data) _GMP_REPEAT_945(call, data) call(945, data)
+#define _GMP_REPEAT_947(call, data) _GMP_REPEAT_946(call, data) call(946, data)
+#define _GMP_REPEAT_948(call, data) _GMP_REPEAT_947(call, data) call(947, data)
+#define _GMP_REPEAT_949(call, data) _GMP_REPEAT_948(call, data) call(948, data)
+#define _GMP_REPEAT_950(call, data) _GMP_REPEAT_949(call, data) call(949, data)
+#define _GMP_REPEAT_951(call, data) _GMP_REPEAT_950(call, data) call(950, data)
+#define _GMP_REPEAT_952(call, data) _GMP_REPEAT_951(call, data) call(951, data)
+#define _GMP_REPEAT_953(call, data) _GMP_REPEAT_952(call, data) call(952, data)
+#define _GMP_REPEAT_954(call, data) _GMP_REPEAT_953(call, data) call(953, data)
+#define _GMP_REPEAT_955(call, data) _GMP_REPEAT_954(call, data) call(954, data)
+#define _GMP_REPEAT_956(call, data) _GMP_REPEAT_955(call, data) call(955, data)
+#define _GMP_REPEAT_957(call, data) _GMP_REPEAT_956(call, data) call(956, data)
+#define _GMP_REPEAT_958(call, data) _GMP_REPEAT_957(call, data) call(957, data)
+#define _GMP_REPEAT_959(call, data) _GMP_REPEAT_958(call, data) call(958, data)
+#define _GMP_REPEAT_960(call, data) _GMP_REPEAT_959(call, data) call(959, data)
+#define _GMP_REPEAT_961(call, data) _GMP_REPEAT_960(call, data) call(960, data)
+#define _GMP_REPEAT_962(call, data) _GMP_REPEAT_961(call, data) call(961, data)
+#define _GMP_REPEAT_963(call, data) _GMP_REPEAT_962(call, data) call(962, data)
+#define _GMP_REPEAT_964(call, data) _GMP_REPEAT_963(call, data) call(963, data)
+#define _GMP_REPEAT_965(call, data) _GMP_REPEAT_964(call, data) call(964, data)
+#define _GMP_REPEAT_966(call, data) _GMP_REPEAT_965(call, data) call(965, data)
+#define _GMP_REPEAT_967(call, data) _GMP_REPEAT_966(call, data) call(966, data)
+#define _GMP_REPEAT_968(call, data) _GMP_REPEAT_967(call, data) call(967, data)
+#define _GMP_REPEAT_969(call, data) _GMP_REPEAT_968(call, data) call(968, data)
+#define _GMP_REPEAT_970(call, data) _GMP_REPEAT_969(call, data) call(969, data)
+#define _GMP_REPEAT_971(call, data) _GMP_REPEAT_970(call, data) call(970, data)
+#define _GMP_REPEAT_972(call, data) _GMP_REPEAT_971(call, data) call(971, data)
+#define _GMP_REPEAT_973(call, data) _GMP_REPEAT_972(call, data) call(972, data)
+#define _GMP_REPEAT_974(call, data) _GMP_REPEAT_973(call, data) call(973, data)
+#define _GMP_REPEAT_975(call, data) _GMP_REPEAT_974(call, data) call(974, data)
+#define _GMP_REPEAT_976(call, data) _GMP_REPEAT_975(call, data) call(975, data)
+#define _GMP_REPEAT_977(call, data) _GMP_REPEAT_976(call, data) call(976, data)
+#define _GMP_REPEAT_978(call, data) _GMP_REPEAT_977(call, data) call(977, data)
+#define _GMP_REPEAT_979(call, data) _GMP_REPEAT_978(call, data) call(978, data)
+#define _GMP_REPEAT_980(call, data) _GMP_REPEAT_979(call, data) call(979, data)
+#define _GMP_REPEAT_981(call, data) _GMP_REPEAT_980(call, data) call(980, data)
+#define _GMP_REPEAT_982(call, data) _GMP_REPEAT_981(call, data) call(981, data)
+#define _GMP_REPEAT_983(call, data) _GMP_REPEAT_982(call, data) call(982, data)
+#define _GMP_REPEAT_984(call, data) _GMP_REPEAT_983(call, data) call(983, data)
+#define _GMP_REPEAT_985(call, data) _GMP_REPEAT_984(call, data) call(984, data)
+#define _GMP_REPEAT_986(call, data) _GMP_REPEAT_985(call, data) call(985, data)
+#define _GMP_REPEAT_987(call, data) _GMP_REPEAT_986(call, data) call(986, data)
+#define _GMP_REPEAT_988(call, data) _GMP_REPEAT_987(call, data) call(987, data)
+#define _GMP_REPEAT_989(call, data) _GMP_REPEAT_988(call, data) call(988, data)
+#define _GMP_REPEAT_990(call, data) _GMP_REPEAT_989(call, data) call(989, data)
+#define _GMP_REPEAT_991(call, data) _GMP_REPEAT_990(call, data) call(990, data)
+#define _GMP_REPEAT_992(call, data) _GMP_REPEAT_991(call, data) call(991, data)
+#define _GMP_REPEAT_993(call, data) _GMP_REPEAT_992(call, data) call(992, data)
+#define _GMP_REPEAT_994(call, data) _GMP_REPEAT_993(call, data) call(993, data)
+#define _GMP_REPEAT_995(call, data) _GMP_REPEAT_994(call, data) call(994, data)
+#define _GMP_REPEAT_996(call, data) _GMP_REPEAT_995(call, data) call(995, data)
+#define _GMP_REPEAT_997(call, data) _GMP_REPEAT_996(call, data) call(996, data)
+#define _GMP_REPEAT_998(call, data) _GMP_REPEAT_997(call, data) call(997, data)
+#define _GMP_REPEAT_999(call, data) _GMP_REPEAT_998(call, data) call(998, data)
+#define _GMP_REPEAT_1000(call, data) _GMP_REPEAT_999(call, data) call(999, data)
+#define _GMP_REPEAT_1001(call, data) _GMP_REPEAT_1000(call, data) call(1000, data)
+#define _GMP_REPEAT_1002(call, data) _GMP_REPEAT_1001(call, data) call(1001, data)
+#define _GMP_REPEAT_1003(call, data) _GMP_REPEAT_1002(call, data) call(1002, data)
+#define _GMP_REPEAT_1004(call, data) _GMP_REPEAT_1003(call, data) call(1003, data)
+#define _GMP_REPEAT_1005(call, data) _GMP_REPEAT_1004(call, data) call(1004, data)
+#define _GMP_REPEAT_1006(call, data) _GMP_REPEAT_1005(call, data) call(1005, data)
+#define _GMP_REPEAT_1007(call, data) _GMP_REPEAT_1006(call, data) call(1006, data)
+#define _GMP_REPEAT_1008(call, data) _GMP_REPEAT_1007(call, data) call(1007, data)
+#define _GMP_REPEAT_1009(call, data) _GMP_REPEAT_1008(call, data) call(1008, data)
+#define _GMP_REPEAT_1010(call, data) _GMP_REPEAT_1009(call, data) call(1009, data)
+#define _GMP_REPEAT_1011(call, data) _GMP_REPEAT_1010(call, data) call(1010, data)
+#define _GMP_REPEAT_1012(call, data) _GMP_REPEAT_1011(call, data) call(1011, data)
+#define _GMP_REPEAT_1013(call, data) _GMP_REPEAT_1012(call, data) call(1012, data)
+#define _GMP_REPEAT_1014(call, data) _GMP_REPEAT_1013(call, data) call(1013, data)
+#define _GMP_REPEAT_1015(call, data) _GMP_REPEAT_1014(call, data) call(1014, data)
+#define _GMP_REPEAT_1016(call, data) _GMP_REPEAT_1015(call, data) call(1015, data)
+#define _GMP_REPEAT_1017(call, data) _GMP_REPEAT_1016(call, data) call(1016, data)
+#define _GMP_REPEAT_1018(call, data) _GMP_REPEAT_1017(call, data) call(1017, data)
+#define _GMP_REPEAT_1019(call, data) _GMP_REPEAT_1018(call, data) call(1018, data)
+#define _GMP_REPEAT_1020(call, data) _GMP_REPEAT_1019(call, data) call(1019, data)
+#define _GMP_REPEAT_1021(call, data) _GMP_REPEAT_1020(call, data) call(1020, data)
+#define _GMP_REPEAT_1022(call, data) _GMP_REPEAT_1021(call, data) call(1021, data)
+#define _GMP_REPEAT_1023(call, data) _GMP_REPEAT_1022(call, data) call(1022, data)
+#define _GMP_REPEAT_1024(call, data) _GMP_REPEAT_1023(call, data) call(1023, data)
+
+// GMP_REPEAT_FROM
+#define _GMP_REPEAT_FROM_0(call, data, i)
+#define _GMP_REPEAT_FROM_1(call, data, i) call(i, data)
+#define _GMP_REPEAT_FROM_2(call, data, i) call(i, data) _GMP_REPEAT_FROM_1(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_3(call, data, i) call(i, data) _GMP_REPEAT_FROM_2(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_4(call, data, i) call(i, data) _GMP_REPEAT_FROM_3(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_5(call, data, i) call(i, data) _GMP_REPEAT_FROM_4(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_6(call, data, i) call(i, data) _GMP_REPEAT_FROM_5(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_7(call, data, i) call(i, data) _GMP_REPEAT_FROM_6(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_8(call, data, i) call(i, data) _GMP_REPEAT_FROM_7(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_9(call, data, i) call(i, data) _GMP_REPEAT_FROM_8(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_10(call, data, i) call(i, data) _GMP_REPEAT_FROM_9(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_11(call, data, i) call(i, data) _GMP_REPEAT_FROM_10(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_12(call, data, i) call(i, data) _GMP_REPEAT_FROM_11(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_13(call, data, i) call(i, data) _GMP_REPEAT_FROM_12(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_14(call, data, i) call(i, data) _GMP_REPEAT_FROM_13(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_15(call, data, i) call(i, data) _GMP_REPEAT_FROM_14(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_16(call, data, i) call(i, data) _GMP_REPEAT_FROM_15(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_17(call, data, i) call(i, data) _GMP_REPEAT_FROM_16(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_18(call, data, i) call(i, data) _GMP_REPEAT_FROM_17(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_19(call, data, i) call(i, data) _GMP_REPEAT_FROM_18(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_20(call, data, i) call(i, data) _GMP_REPEAT_FROM_19(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_21(call, data, i) call(i, data) _GMP_REPEAT_FROM_20(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_22(call, data, i) call(i, data) _GMP_REPEAT_FROM_21(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_23(call, data, i) call(i, data) _GMP_REPEAT_FROM_22(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_24(call, data, i) call(i, data) _GMP_REPEAT_FROM_23(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_25(call, data, i) call(i, data) _GMP_REPEAT_FROM_24(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_26(call, data, i) call(i, data) _GMP_REPEAT_FROM_25(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_27(call, data, i) call(i, data) _GMP_REPEAT_FROM_26(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_28(call, data, i) call(i, data) _GMP_REPEAT_FROM_27(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_29(call, data, i) call(i, data) _GMP_REPEAT_FROM_28(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_30(call, data, i) call(i, data) _GMP_REPEAT_FROM_29(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_31(call, data, i) call(i, data) _GMP_REPEAT_FROM_30(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_32(call, data, i) call(i, data) _GMP_REPEAT_FROM_31(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_33(call, data, i) call(i, data) _GMP_REPEAT_FROM_32(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_34(call, data, i) call(i, data) _GMP_REPEAT_FROM_33(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_35(call, data, i) call(i, data) _GMP_REPEAT_FROM_34(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_36(call, data, i) call(i, data) _GMP_REPEAT_FROM_35(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_37(call, data, i) call(i, data) _GMP_REPEAT_FROM_36(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_38(call, data, i) call(i, data) _GMP_REPEAT_FROM_37(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_39(call, data, i) call(i, data) _GMP_REPEAT_FROM_38(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_40(call, data, i) call(i, data) _GMP_REPEAT_FROM_39(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_41(call, data, i) call(i, data) _GMP_REPEAT_FROM_40(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_42(call, data, i) call(i, data) _GMP_REPEAT_FROM_41(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_43(call, data, i) call(i, data) _GMP_REPEAT_FROM_42(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_44(call, data, i) call(i, data) _GMP_REPEAT_FROM_43(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_45(call, data, i) call(i, data) _GMP_REPEAT_FROM_44(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_46(call, data, i) call(i, data) _GMP_REPEAT_FROM_45(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_47(call, data, i) call(i, data) _GMP_REPEAT_FROM_46(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_48(call, data, i) call(i, data) _GMP_REPEAT_FROM_47(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_49(call, data, i) call(i, data) _GMP_REPEAT_FROM_48(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_50(call, data, i) call(i, data) _GMP_REPEAT_FROM_49(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_51(call, data, i) call(i, data) _GMP_REPEAT_FROM_50(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_52(call, data, i) call(i, data) _GMP_REPEAT_FROM_51(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_53(call, data, i) call(i, data) _GMP_REPEAT_FROM_52(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_54(call, data, i) call(i, data) _GMP_REPEAT_FROM_53(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_55(call, data, i) call(i, data) _GMP_REPEAT_FROM_54(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_56(call, data, i) call(i, data) _GMP_REPEAT_FROM_55(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_57(call, data, i) call(i, data) _GMP_REPEAT_FROM_56(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_58(call, data, i) call(i, data) _GMP_REPEAT_FROM_57(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_59(call, data, i) call(i, data) _GMP_REPEAT_FROM_58(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_60(call, data, i) call(i, data) _GMP_REPEAT_FROM_59(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_61(call, data, i) call(i, data) _GMP_REPEAT_FROM_60(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_62(call, data, i) call(i, data) _GMP_REPEAT_FROM_61(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_63(call, data, i) call(i, data) _GMP_REPEAT_FROM_62(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_64(call, data, i) call(i, data) _GMP_REPEAT_FROM_63(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_65(call, data, i) call(i, data) _GMP_REPEAT_FROM_64(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_66(call, data, i) call(i, data) _GMP_REPEAT_FROM_65(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_67(call, data, i) call(i, data) _GMP_REPEAT_FROM_66(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_68(call, data, i) call(i, data) _GMP_REPEAT_FROM_67(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_69(call, data, i) call(i, data) _GMP_REPEAT_FROM_68(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_70(call, data, i) call(i, data) _GMP_REPEAT_FROM_69(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_71(call, data, i) call(i, data) _GMP_REPEAT_FROM_70(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_72(call, data, i) call(i, data) _GMP_REPEAT_FROM_71(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_73(call, data, i) call(i, data) _GMP_REPEAT_FROM_72(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_74(call, data, i) call(i, data) _GMP_REPEAT_FROM_73(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_75(call, data, i) call(i, data) _GMP_REPEAT_FROM_74(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_76(call, data, i) call(i, data) _GMP_REPEAT_FROM_75(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_77(call, data, i) call(i, data) _GMP_REPEAT_FROM_76(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_78(call, data, i) call(i, data) _GMP_REPEAT_FROM_77(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_79(call, data, i) call(i, data) _GMP_REPEAT_FROM_78(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_80(call, data, i) call(i, data) _GMP_REPEAT_FROM_79(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_81(call, data, i) call(i, data) _GMP_REPEAT_FROM_80(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_82(call, data, i) call(i, data) _GMP_REPEAT_FROM_81(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_83(call, data, i) call(i, data) _GMP_REPEAT_FROM_82(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_84(call, data, i) call(i, data) _GMP_REPEAT_FROM_83(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_85(call, data, i) call(i, data) _GMP_REPEAT_FROM_84(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_86(call, data, i) call(i, data) _GMP_REPEAT_FROM_85(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_87(call, data, i) call(i, data) _GMP_REPEAT_FROM_86(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_88(call, data, i) call(i, data) _GMP_REPEAT_FROM_87(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_89(call, data, i) call(i, data) _GMP_REPEAT_FROM_88(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_90(call, data, i) call(i, data) _GMP_REPEAT_FROM_89(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_91(call, data, i) call(i, data) _GMP_REPEAT_FROM_90(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_92(call, data, i) call(i, data) _GMP_REPEAT_FROM_91(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_93(call, data, i) call(i, data) _GMP_REPEAT_FROM_92(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_94(call, data, i) call(i, data) _GMP_REPEAT_FROM_93(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_95(call, data, i) call(i, data) _GMP_REPEAT_FROM_94(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_96(call, data, i) call(i, data) _GMP_REPEAT_FROM_95(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_97(call, data, i) call(i, data) _GMP_REPEAT_FROM_96(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_98(call, data, i) call(i, data) _GMP_REPEAT_FROM_97(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_99(call, data, i) call(i, data) _GMP_REPEAT_FROM_98(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_100(call, data, i) call(i, data) _GMP_REPEAT_FROM_99(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_101(call, data, i) call(i, data) _GMP_REPEAT_FROM_100(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_102(call, data, i) call(i, data) _GMP_REPEAT_FROM_101(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_103(call, data, i) call(i, data) _GMP_REPEAT_FROM_102(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_104(call, data, i) call(i, data) _GMP_REPEAT_FROM_103(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_105(call, data, i) call(i, data) _GMP_REPEAT_FROM_104(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_106(call, data, i) call(i, data) _GMP_REPEAT_FROM_105(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_107(call, data, i) call(i, data) _GMP_REPEAT_FROM_106(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_108(call, data, i) call(i, data) _GMP_REPEAT_FROM_107(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_109(call, data, i) call(i, data) _GMP_REPEAT_FROM_108(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_110(call, data, i) call(i, data) _GMP_REPEAT_FROM_109(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_111(call, data, i) call(i, data) _GMP_REPEAT_FROM_110(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_112(call, data, i) call(i, data) _GMP_REPEAT_FROM_111(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_113(call, data, i) call(i, data) _GMP_REPEAT_FROM_112(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_114(call, data, i) call(i, data) _GMP_REPEAT_FROM_113(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_115(call, data, i) call(i, data) _GMP_REPEAT_FROM_114(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_116(call, data, i) call(i, data) _GMP_REPEAT_FROM_115(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_117(call, data, i) call(i, data) _GMP_REPEAT_FROM_116(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_118(call, data, i) call(i, data) _GMP_REPEAT_FROM_117(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_119(call, data, i) call(i, data) _GMP_REPEAT_FROM_118(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_120(call, data, i) call(i, data) _GMP_REPEAT_FROM_119(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_121(call, data, i) call(i, data) _GMP_REPEAT_FROM_120(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_122(call, data, i) call(i, data) _GMP_REPEAT_FROM_121(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_123(call, data, i) call(i, data) _GMP_REPEAT_FROM_122(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_124(call, data, i) call(i, data) _GMP_REPEAT_FROM_123(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_125(call, data, i) call(i, data) _GMP_REPEAT_FROM_124(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_126(call, data, i) call(i, data) _GMP_REPEAT_FROM_125(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_127(call, data, i) call(i, data) _GMP_REPEAT_FROM_126(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_128(call, data, i) call(i, data) _GMP_REPEAT_FROM_127(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_129(call, data, i) call(i, data) _GMP_REPEAT_FROM_128(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_130(call, data, i) call(i, data) _GMP_REPEAT_FROM_129(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_131(call, data, i) call(i, data) _GMP_REPEAT_FROM_130(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_132(call, data, i) call(i, data) _GMP_REPEAT_FROM_131(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_133(call, data, i) call(i, data) _GMP_REPEAT_FROM_132(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_134(call, data, i) call(i, data) _GMP_REPEAT_FROM_133(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_135(call, data, i) call(i, data) _GMP_REPEAT_FROM_134(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_136(call, data, i) call(i, data) _GMP_REPEAT_FROM_135(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_137(call, data, i) call(i, data) _GMP_REPEAT_FROM_136(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_138(call, data, i) call(i, data) _GMP_REPEAT_FROM_137(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_139(call, data, i) call(i, data) _GMP_REPEAT_FROM_138(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_140(call, data, i) call(i, data) _GMP_REPEAT_FROM_139(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_141(call, data, i) call(i, data) _GMP_REPEAT_FROM_140(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_142(call, data, i) call(i, data) _GMP_REPEAT_FROM_141(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_143(call, data, i) call(i, data) _GMP_REPEAT_FROM_142(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_144(call, data, i) call(i, data) _GMP_REPEAT_FROM_143(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_145(call, data, i) call(i, data) _GMP_REPEAT_FROM_144(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_146(call, data, i) call(i, data) _GMP_REPEAT_FROM_145(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_147(call, data, i) call(i, data) _GMP_REPEAT_FROM_146(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_148(call, data, i) call(i, data) _GMP_REPEAT_FROM_147(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_149(call, data, i) call(i, data) _GMP_REPEAT_FROM_148(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_150(call, data, i) call(i, data) _GMP_REPEAT_FROM_149(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_151(call, data, i) call(i, data) _GMP_REPEAT_FROM_150(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_152(call, data, i) call(i, data) _GMP_REPEAT_FROM_151(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_153(call, data, i) call(i, data) _GMP_REPEAT_FROM_152(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_154(call, data, i) call(i, data) _GMP_REPEAT_FROM_153(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_155(call, data, i) call(i, data) _GMP_REPEAT_FROM_154(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_156(call, data, i) call(i, data) _GMP_REPEAT_FROM_155(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_157(call, data, i) call(i, data) _GMP_REPEAT_FROM_156(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_158(call, data, i) call(i, data) _GMP_REPEAT_FROM_157(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_159(call, data, i) call(i, data) _GMP_REPEAT_FROM_158(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_160(call, data, i) call(i, data) _GMP_REPEAT_FROM_159(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_161(call, data, i) call(i, data) _GMP_REPEAT_FROM_160(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_162(call, data, i) call(i, data) _GMP_REPEAT_FROM_161(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_163(call, data, i) call(i, data) _GMP_REPEAT_FROM_162(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_164(call, data, i) call(i, data) _GMP_REPEAT_FROM_163(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_165(call, data, i) call(i, data) _GMP_REPEAT_FROM_164(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_166(call, data, i) call(i, data) _GMP_REPEAT_FROM_165(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_167(call, data, i) call(i, data) _GMP_REPEAT_FROM_166(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_168(call, data, i) call(i, data) _GMP_REPEAT_FROM_167(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_169(call, data, i) call(i, data) _GMP_REPEAT_FROM_168(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_170(call, data, i) call(i, data) _GMP_REPEAT_FROM_169(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_171(call, data, i) call(i, data) _GMP_REPEAT_FROM_170(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_172(call, data, i) call(i, data) _GMP_REPEAT_FROM_171(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_173(call, data, i) call(i, data) _GMP_REPEAT_FROM_172(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_174(call, data, i) call(i, data) _GMP_REPEAT_FROM_173(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_175(call, data, i) call(i, data) _GMP_REPEAT_FROM_174(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_176(call, data, i) call(i, data) _GMP_REPEAT_FROM_175(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_177(call, data, i) call(i, data) _GMP_REPEAT_FROM_176(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_178(call, data, i) call(i, data) _GMP_REPEAT_FROM_177(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_179(call, data, i) call(i, data) _GMP_REPEAT_FROM_178(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_180(call, data, i) call(i, data) _GMP_REPEAT_FROM_179(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_181(call, data, i) call(i, data) _GMP_REPEAT_FROM_180(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_182(call, data, i) call(i, data) _GMP_REPEAT_FROM_181(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_183(call, data, i) call(i, data) _GMP_REPEAT_FROM_182(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_184(call, data, i) call(i, data) _GMP_REPEAT_FROM_183(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_185(call, data, i) call(i, data) _GMP_REPEAT_FROM_184(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_186(call, data, i) call(i, data) _GMP_REPEAT_FROM_185(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_187(call, data, i) call(i, data) _GMP_REPEAT_FROM_186(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_188(call, data, i) call(i, data) _GMP_REPEAT_FROM_187(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_189(call, data, i) call(i, data) _GMP_REPEAT_FROM_188(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_190(call, data, i) call(i, data) _GMP_REPEAT_FROM_189(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_191(call, data, i) call(i, data) _GMP_REPEAT_FROM_190(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_192(call, data, i) call(i, data) _GMP_REPEAT_FROM_191(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_193(call, data, i) call(i, data) _GMP_REPEAT_FROM_192(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_194(call, data, i) call(i, data) _GMP_REPEAT_FROM_193(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_195(call, data, i) call(i, data) _GMP_REPEAT_FROM_194(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_196(call, data, i) call(i, data) _GMP_REPEAT_FROM_195(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_197(call, data, i) call(i, data) _GMP_REPEAT_FROM_196(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_198(call, data, i) call(i, data) _GMP_REPEAT_FROM_197(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_199(call, data, i) call(i, data) _GMP_REPEAT_FROM_198(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_200(call, data, i) call(i, data) _GMP_REPEAT_FROM_199(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_201(call, data, i) call(i, data) _GMP_REPEAT_FROM_200(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_202(call, data, i) call(i, data) _GMP_REPEAT_FROM_201(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_203(call, data, i) call(i, data) _GMP_REPEAT_FROM_202(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_204(call, data, i) call(i, data) _GMP_REPEAT_FROM_203(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_205(call, data, i) call(i, data) _GMP_REPEAT_FROM_204(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_206(call, data, i) call(i, data) _GMP_REPEAT_FROM_205(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_207(call, data, i) call(i, data) _GMP_REPEAT_FROM_206(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_208(call, data, i) call(i, data) _GMP_REPEAT_FROM_207(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_209(call, data, i) call(i, data) _GMP_REPEAT_FROM_208(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_210(call, data, i) call(i, data) _GMP_REPEAT_FROM_209(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_211(call, data, i) call(i, data) _GMP_REPEAT_FROM_210(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_212(call, data, i) call(i, data) _GMP_REPEAT_FROM_211(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_213(call, data, i) call(i, data) _GMP_REPEAT_FROM_212(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_214(call, data, i) call(i, data) _GMP_REPEAT_FROM_213(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_215(call, data, i) call(i, data) _GMP_REPEAT_FROM_214(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_216(call, data, i) call(i, data) _GMP_REPEAT_FROM_215(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_217(call, data, i) call(i, data) _GMP_REPEAT_FROM_216(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_218(call, data, i) call(i, data) _GMP_REPEAT_FROM_217(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_219(call, data, i) call(i, data) _GMP_REPEAT_FROM_218(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_220(call, data, i) call(i, data) _GMP_REPEAT_FROM_219(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_221(call, data, i) call(i, data) _GMP_REPEAT_FROM_220(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_222(call, data, i) call(i, data) _GMP_REPEAT_FROM_221(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_223(call, data, i) call(i, data) _GMP_REPEAT_FROM_222(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_224(call, data, i) call(i, data) _GMP_REPEAT_FROM_223(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_225(call, data, i) call(i, data) _GMP_REPEAT_FROM_224(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_226(call, data, i) call(i, data) _GMP_REPEAT_FROM_225(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_227(call, data, i) call(i, data) _GMP_REPEAT_FROM_226(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_228(call, data, i) call(i, data) _GMP_REPEAT_FROM_227(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_229(call, data, i) call(i, data) _GMP_REPEAT_FROM_228(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_230(call, data, i) call(i, data) _GMP_REPEAT_FROM_229(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_231(call, data, i) call(i, data) _GMP_REPEAT_FROM_230(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_232(call, data, i) call(i, data) _GMP_REPEAT_FROM_231(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_233(call, data, i) call(i, data) _GMP_REPEAT_FROM_232(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_234(call, data, i) call(i, data) _GMP_REPEAT_FROM_233(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_235(call, data, i) call(i, data) _GMP_REPEAT_FROM_234(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_236(call, data, i) call(i, data) _GMP_REPEAT_FROM_235(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_237(call, data, i) call(i, data) _GMP_REPEAT_FROM_236(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_238(call, data, i) call(i, data) _GMP_REPEAT_FROM_237(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_239(call, data, i) call(i, data) _GMP_REPEAT_FROM_238(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_240(call, data, i) call(i, data) _GMP_REPEAT_FROM_239(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_241(call, data, i) call(i, data) _GMP_REPEAT_FROM_240(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_242(call, data, i) call(i, data) _GMP_REPEAT_FROM_241(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_243(call, data, i) call(i, data) _GMP_REPEAT_FROM_242(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_244(call, data, i) call(i, data) _GMP_REPEAT_FROM_243(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_245(call, data, i) call(i, data) _GMP_REPEAT_FROM_244(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_246(call, data, i) call(i, data) _GMP_REPEAT_FROM_245(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_247(call, data, i) call(i, data) _GMP_REPEAT_FROM_246(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_248(call, data, i) call(i, data) _GMP_REPEAT_FROM_247(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_249(call, data, i) call(i, data) _GMP_REPEAT_FROM_248(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_250(call, data, i) call(i, data) _GMP_REPEAT_FROM_249(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_251(call, data, i) call(i, data) _GMP_REPEAT_FROM_250(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_252(call, data, i) call(i, data) _GMP_REPEAT_FROM_251(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_253(call, data, i) call(i, data) _GMP_REPEAT_FROM_252(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_254(call, data, i) call(i, data) _GMP_REPEAT_FROM_253(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_255(call, data, i) call(i, data) _GMP_REPEAT_FROM_254(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_256(call, data, i) call(i, data) _GMP_REPEAT_FROM_255(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_257(call, data, i) call(i, data) _GMP_REPEAT_FROM_256(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_258(call, data, i) call(i, data) _GMP_REPEAT_FROM_257(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_259(call, data, i) call(i, data) _GMP_REPEAT_FROM_258(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_260(call, data, i) call(i, data) _GMP_REPEAT_FROM_259(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_261(call, data, i) call(i, data) _GMP_REPEAT_FROM_260(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_262(call, data, i) call(i, data) _GMP_REPEAT_FROM_261(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_263(call, data, i) call(i, data) _GMP_REPEAT_FROM_262(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_264(call, data, i) call(i, data) _GMP_REPEAT_FROM_263(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_265(call, data, i) call(i, data) _GMP_REPEAT_FROM_264(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_266(call, data, i) call(i, data) _GMP_REPEAT_FROM_265(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_267(call, data, i) call(i, data) _GMP_REPEAT_FROM_266(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_268(call, data, i) call(i, data) _GMP_REPEAT_FROM_267(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_269(call, data, i) call(i, data) _GMP_REPEAT_FROM_268(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_270(call, data, i) call(i, data) _GMP_REPEAT_FROM_269(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_271(call, data, i) call(i, data) _GMP_REPEAT_FROM_270(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_272(call, data, i) call(i, data) _GMP_REPEAT_FROM_271(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_273(call, data, i) call(i, data) _GMP_REPEAT_FROM_272(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_274(call, data, i) call(i, data) _GMP_REPEAT_FROM_273(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_275(call, data, i) call(i, data) _GMP_REPEAT_FROM_274(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_276(call, data, i) call(i, data) _GMP_REPEAT_FROM_275(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_277(call, data, i) call(i, data) _GMP_REPEAT_FROM_276(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_278(call, data, i) call(i, data) _GMP_REPEAT_FROM_277(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_279(call, data, i) call(i, data) _GMP_REPEAT_FROM_278(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_280(call, data, i) call(i, data) _GMP_REPEAT_FROM_279(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_281(call, data, i) call(i, data) _GMP_REPEAT_FROM_280(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_282(call, data, i) call(i, data) _GMP_REPEAT_FROM_281(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_283(call, data, i) call(i, data) _GMP_REPEAT_FROM_282(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_284(call, data, i) call(i, data) _GMP_REPEAT_FROM_283(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_285(call, data, i) call(i, data) _GMP_REPEAT_FROM_284(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_286(call, data, i) call(i, data) _GMP_REPEAT_FROM_285(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_287(call, data, i) call(i, data) _GMP_REPEAT_FROM_286(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_288(call, data, i) call(i, data) _GMP_REPEAT_FROM_287(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_289(call, data, i) call(i, data) _GMP_REPEAT_FROM_288(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_290(call, data, i) call(i, data) _GMP_REPEAT_FROM_289(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_291(call, data, i) call(i, data) _GMP_REPEAT_FROM_290(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_292(call, data, i) call(i, data) _GMP_REPEAT_FROM_291(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_293(call, data, i) call(i, data) _GMP_REPEAT_FROM_292(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_294(call, data, i) call(i, data) _GMP_REPEAT_FROM_293(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_295(call, data, i) call(i, data) _GMP_REPEAT_FROM_294(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_296(call, data, i) call(i, data) _GMP_REPEAT_FROM_295(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_297(call, data, i) call(i, data) _GMP_REPEAT_FROM_296(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_298(call, data, i) call(i, data) _GMP_REPEAT_FROM_297(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_299(call, data, i) call(i, data) _GMP_REPEAT_FROM_298(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_300(call, data, i) call(i, data) _GMP_REPEAT_FROM_299(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_301(call, data, i) call(i, data) _GMP_REPEAT_FROM_300(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_302(call, data, i) call(i, data) _GMP_REPEAT_FROM_301(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_303(call, data, i) call(i, data) _GMP_REPEAT_FROM_302(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_304(call, data, i) call(i, data) _GMP_REPEAT_FROM_303(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_305(call, data, i) call(i, data) _GMP_REPEAT_FROM_304(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_306(call, data, i) call(i, data) _GMP_REPEAT_FROM_305(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_307(call, data, i) call(i, data) _GMP_REPEAT_FROM_306(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_308(call, data, i) call(i, data) _GMP_REPEAT_FROM_307(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_309(call, data, i) call(i, data) _GMP_REPEAT_FROM_308(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_310(call, data, i) call(i, data) _GMP_REPEAT_FROM_309(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_311(call, data, i) call(i, data) _GMP_REPEAT_FROM_310(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_312(call, data, i) call(i, data) _GMP_REPEAT_FROM_311(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_313(call, data, i) call(i, data) _GMP_REPEAT_FROM_312(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_314(call, data, i) call(i, data) _GMP_REPEAT_FROM_313(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_315(call, data, i) call(i, data) _GMP_REPEAT_FROM_314(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_316(call, data, i) call(i, data) _GMP_REPEAT_FROM_315(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_317(call, data, i) call(i, data) _GMP_REPEAT_FROM_316(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_318(call, data, i) call(i, data) _GMP_REPEAT_FROM_317(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_319(call, data, i) call(i, data) _GMP_REPEAT_FROM_318(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_320(call, data, i) call(i, data) _GMP_REPEAT_FROM_319(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_321(call, data, i) call(i, data) _GMP_REPEAT_FROM_320(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_322(call, data, i) call(i, data) _GMP_REPEAT_FROM_321(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_323(call, data, i) call(i, data) _GMP_REPEAT_FROM_322(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_324(call, data, i) call(i, data) _GMP_REPEAT_FROM_323(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_325(call, data, i) call(i, data) _GMP_REPEAT_FROM_324(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_326(call, data, i) call(i, data) _GMP_REPEAT_FROM_325(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_327(call, data, i) call(i, data) _GMP_REPEAT_FROM_326(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_328(call, data, i) call(i, data) _GMP_REPEAT_FROM_327(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_329(call, data, i) call(i, data) _GMP_REPEAT_FROM_328(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_330(call, data, i) call(i, data) _GMP_REPEAT_FROM_329(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_331(call, data, i) call(i, data) _GMP_REPEAT_FROM_330(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_332(call, data, i) call(i, data) _GMP_REPEAT_FROM_331(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_333(call, data, i) call(i, data) _GMP_REPEAT_FROM_332(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_334(call, data, i) call(i, data) _GMP_REPEAT_FROM_333(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_335(call, data, i) call(i, data) _GMP_REPEAT_FROM_334(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_336(call, data, i) call(i, data) _GMP_REPEAT_FROM_335(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_337(call, data, i) call(i, data) _GMP_REPEAT_FROM_336(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_338(call, data, i) call(i, data) _GMP_REPEAT_FROM_337(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_339(call, data, i) call(i, data) _GMP_REPEAT_FROM_338(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_340(call, data, i) call(i, data) _GMP_REPEAT_FROM_339(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_341(call, data, i) call(i, data) _GMP_REPEAT_FROM_340(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_342(call, data, i) call(i, data) _GMP_REPEAT_FROM_341(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_343(call, data, i) call(i, data) _GMP_REPEAT_FROM_342(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_344(call, data, i) call(i, data) _GMP_REPEAT_FROM_343(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_345(call, data, i) call(i, data) _GMP_REPEAT_FROM_344(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_346(call, data, i) call(i, data) _GMP_REPEAT_FROM_345(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_347(call, data, i) call(i, data) _GMP_REPEAT_FROM_346(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_348(call, data, i) call(i, data) _GMP_REPEAT_FROM_347(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_349(call, data, i) call(i, data) _GMP_REPEAT_FROM_348(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_350(call, data, i) call(i, data) _GMP_REPEAT_FROM_349(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_351(call, data, i) call(i, data) _GMP_REPEAT_FROM_350(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_352(call, data, i) call(i, data) _GMP_REPEAT_FROM_351(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_353(call, data, i) call(i, data) _GMP_REPEAT_FROM_352(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_354(call, data, i) call(i, data) _GMP_REPEAT_FROM_353(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_355(call, data, i) call(i, data) _GMP_REPEAT_FROM_354(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_356(call, data, i) call(i, data) _GMP_REPEAT_FROM_355(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_357(call, data, i) call(i, data) _GMP_REPEAT_FROM_356(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_358(call, data, i) call(i, data) _GMP_REPEAT_FROM_357(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_359(call, data, i) call(i, data) _GMP_REPEAT_FROM_358(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_360(call, data, i) call(i, data) _GMP_REPEAT_FROM_359(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_361(call, data, i) call(i, data) _GMP_REPEAT_FROM_360(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_362(call, data, i) call(i, data) _GMP_REPEAT_FROM_361(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_363(call, data, i) call(i, data) _GMP_REPEAT_FROM_362(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_364(call, data, i) call(i, data) _GMP_REPEAT_FROM_363(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_365(call, data, i) call(i, data) _GMP_REPEAT_FROM_364(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_366(call, data, i) call(i, data) _GMP_REPEAT_FROM_365(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_367(call, data, i) call(i, data) _GMP_REPEAT_FROM_366(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_368(call, data, i) call(i, data) _GMP_REPEAT_FROM_367(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_369(call, data, i) call(i, data) _GMP_REPEAT_FROM_368(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_370(call, data, i) call(i, data) _GMP_REPEAT_FROM_369(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_371(call, data, i) call(i, data) _GMP_REPEAT_FROM_370(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_372(call, data, i) call(i, data) _GMP_REPEAT_FROM_371(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_373(call, data, i) call(i, data) _GMP_REPEAT_FROM_372(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_374(call, data, i) call(i, data) _GMP_REPEAT_FROM_373(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_375(call, data, i) call(i, data) _GMP_REPEAT_FROM_374(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_376(call, data, i) call(i, data) _GMP_REPEAT_FROM_375(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_377(call, data, i) call(i, data) _GMP_REPEAT_FROM_376(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_378(call, data, i) call(i, data) _GMP_REPEAT_FROM_377(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_379(call, data, i) call(i, data) _GMP_REPEAT_FROM_378(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_380(call, data, i) call(i, data) _GMP_REPEAT_FROM_379(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_381(call, data, i) call(i, data) _GMP_REPEAT_FROM_380(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_382(call, data, i) call(i, data) _GMP_REPEAT_FROM_381(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_383(call, data, i) call(i, data) _GMP_REPEAT_FROM_382(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_384(call, data, i) call(i, data) _GMP_REPEAT_FROM_383(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_385(call, data, i) call(i, data) _GMP_REPEAT_FROM_384(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_386(call, data, i) call(i, data) _GMP_REPEAT_FROM_385(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_387(call, data, i) call(i, data) _GMP_REPEAT_FROM_386(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_388(call, data, i) call(i, data) _GMP_REPEAT_FROM_387(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_389(call, data, i) call(i, data) _GMP_REPEAT_FROM_388(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_390(call, data, i) call(i, data) _GMP_REPEAT_FROM_389(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_391(call, data, i) call(i, data) _GMP_REPEAT_FROM_390(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_392(call, data, i) call(i, data) _GMP_REPEAT_FROM_391(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_393(call, data, i) call(i, data) _GMP_REPEAT_FROM_392(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_394(call, data, i) call(i, data) _GMP_REPEAT_FROM_393(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_395(call, data, i) call(i, data) _GMP_REPEAT_FROM_394(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_396(call, data, i) call(i, data) _GMP_REPEAT_FROM_395(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_397(call, data, i) call(i, data) _GMP_REPEAT_FROM_396(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_398(call, data, i) call(i, data) _GMP_REPEAT_FROM_397(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_399(call, data, i) call(i, data) _GMP_REPEAT_FROM_398(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_400(call, data, i) call(i, data) _GMP_REPEAT_FROM_399(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_401(call, data, i) call(i, data) _GMP_REPEAT_FROM_400(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_402(call, data, i) call(i, data) _GMP_REPEAT_FROM_401(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_403(call, data, i) call(i, data) _GMP_REPEAT_FROM_402(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_404(call, data, i) call(i, data) _GMP_REPEAT_FROM_403(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_405(call, data, i) call(i, data) _GMP_REPEAT_FROM_404(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_406(call, data, i) call(i, data) _GMP_REPEAT_FROM_405(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_407(call, data, i) call(i, data) _GMP_REPEAT_FROM_406(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_408(call, data, i) call(i, data) _GMP_REPEAT_FROM_407(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_409(call, data, i) call(i, data) _GMP_REPEAT_FROM_408(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_410(call, data, i) call(i, data) _GMP_REPEAT_FROM_409(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_411(call, data, i) call(i, data) _GMP_REPEAT_FROM_410(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_412(call, data, i) call(i, data) _GMP_REPEAT_FROM_411(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_413(call, data, i) call(i, data) _GMP_REPEAT_FROM_412(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_414(call, data, i) call(i, data) _GMP_REPEAT_FROM_413(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_415(call, data, i) call(i, data) _GMP_REPEAT_FROM_414(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_416(call, data, i) call(i, data) _GMP_REPEAT_FROM_415(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_417(call, data, i) call(i, data) _GMP_REPEAT_FROM_416(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_418(call, data, i) call(i, data) _GMP_REPEAT_FROM_417(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_419(call, data, i) call(i, data) _GMP_REPEAT_FROM_418(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_420(call, data, i) call(i, data) _GMP_REPEAT_FROM_419(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_421(call, data, i) call(i, data) _GMP_REPEAT_FROM_420(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_422(call, data, i) call(i, data) _GMP_REPEAT_FROM_421(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_423(call, data, i) call(i, data) _GMP_REPEAT_FROM_422(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_424(call, data, i) call(i, data) _GMP_REPEAT_FROM_423(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_425(call, data, i) call(i, data) _GMP_REPEAT_FROM_424(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_426(call, data, i) call(i, data) _GMP_REPEAT_FROM_425(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_427(call, data, i) call(i, data) _GMP_REPEAT_FROM_426(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_428(call, data, i) call(i, data) _GMP_REPEAT_FROM_427(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_429(call, data, i) call(i, data) _GMP_REPEAT_FROM_428(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_430(call, data, i) call(i, data) _GMP_REPEAT_FROM_429(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_431(call, data, i) call(i, data) _GMP_REPEAT_FROM_430(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_432(call, data, i) call(i, data) _GMP_REPEAT_FROM_431(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_433(call, data, i) call(i, data) _GMP_REPEAT_FROM_432(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_434(call, data, i) call(i, data) _GMP_REPEAT_FROM_433(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_435(call, data, i) call(i, data) _GMP_REPEAT_FROM_434(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_436(call, data, i) call(i, data) _GMP_REPEAT_FROM_435(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_437(call, data, i) call(i, data) _GMP_REPEAT_FROM_436(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_438(call, data, i) call(i, data) _GMP_REPEAT_FROM_437(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_439(call, data, i) call(i, data) _GMP_REPEAT_FROM_438(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_440(call, data, i) call(i, data) _GMP_REPEAT_FROM_439(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_441(call, data, i) call(i, data) _GMP_REPEAT_FROM_440(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_442(call, data, i) call(i, data) _GMP_REPEAT_FROM_441(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_443(call, data, i) call(i, data) _GMP_REPEAT_FROM_442(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_444(call, data, i) call(i, data) _GMP_REPEAT_FROM_443(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_445(call, data, i) call(i, data) _GMP_REPEAT_FROM_444(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_446(call, data, i) call(i, data) _GMP_REPEAT_FROM_445(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_447(call, data, i) call(i, data) _GMP_REPEAT_FROM_446(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_448(call, data, i) call(i, data) _GMP_REPEAT_FROM_447(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_449(call, data, i) call(i, data) _GMP_REPEAT_FROM_448(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_450(call, data, i) call(i, data) _GMP_REPEAT_FROM_449(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_451(call, data, i) call(i, data) _GMP_REPEAT_FROM_450(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_452(call, data, i) call(i, data) _GMP_REPEAT_FROM_451(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_453(call, data, i) call(i, data) _GMP_REPEAT_FROM_452(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_454(call, data, i) call(i, data) _GMP_REPEAT_FROM_453(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_455(call, data, i) call(i, data) _GMP_REPEAT_FROM_454(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_456(call, data, i) call(i, data) _GMP_REPEAT_FROM_455(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_457(call, data, i) call(i, data) _GMP_REPEAT_FROM_456(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_458(call, data, i) call(i, data) _GMP_REPEAT_FROM_457(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_459(call, data, i) call(i, data) _GMP_REPEAT_FROM_458(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_460(call, data, i) call(i, data) _GMP_REPEAT_FROM_459(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_461(call, data, i) call(i, data) _GMP_REPEAT_FROM_460(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_462(call, data, i) call(i, data) _GMP_REPEAT_FROM_461(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_463(call, data, i) call(i, data) _GMP_REPEAT_FROM_462(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_464(call, data, i) call(i, data) _GMP_REPEAT_FROM_463(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_465(call, data, i) call(i, data) _GMP_REPEAT_FROM_464(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_466(call, data, i) call(i, data) _GMP_REPEAT_FROM_465(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_467(call, data, i) call(i, data) _GMP_REPEAT_FROM_466(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_468(call, data, i) call(i, data) _GMP_REPEAT_FROM_467(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_469(call, data, i) call(i, data) _GMP_REPEAT_FROM_468(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_470(call, data, i) call(i, data) _GMP_REPEAT_FROM_469(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_471(call, data, i) call(i, data) _GMP_REPEAT_FROM_470(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_472(call, data, i) call(i, data) _GMP_REPEAT_FROM_471(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_473(call, data, i) call(i, data) _GMP_REPEAT_FROM_472(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_474(call, data, i) call(i, data) _GMP_REPEAT_FROM_473(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_475(call, data, i) call(i, data) _GMP_REPEAT_FROM_474(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_476(call, data, i) call(i, data) _GMP_REPEAT_FROM_475(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_477(call, data, i) call(i, data) _GMP_REPEAT_FROM_476(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_478(call, data, i) call(i, data) _GMP_REPEAT_FROM_477(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_479(call, data, i) call(i, data) _GMP_REPEAT_FROM_478(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_480(call, data, i) call(i, data) _GMP_REPEAT_FROM_479(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_481(call, data, i) call(i, data) _GMP_REPEAT_FROM_480(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_482(call, data, i) call(i, data) _GMP_REPEAT_FROM_481(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_483(call, data, i) call(i, data) _GMP_REPEAT_FROM_482(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_484(call, data, i) call(i, data) _GMP_REPEAT_FROM_483(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_485(call, data, i) call(i, data) _GMP_REPEAT_FROM_484(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_486(call, data, i) call(i, data) _GMP_REPEAT_FROM_485(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_487(call, data, i) call(i, data) _GMP_REPEAT_FROM_486(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_488(call, data, i) call(i, data) _GMP_REPEAT_FROM_487(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_489(call, data, i) call(i, data) _GMP_REPEAT_FROM_488(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_490(call, data, i) call(i, data) _GMP_REPEAT_FROM_489(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_491(call, data, i) call(i, data) _GMP_REPEAT_FROM_490(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_492(call, data, i) call(i, data) _GMP_REPEAT_FROM_491(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_493(call, data, i) call(i, data) _GMP_REPEAT_FROM_492(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_494(call, data, i) call(i, data) _GMP_REPEAT_FROM_493(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_495(call, data, i) call(i, data) _GMP_REPEAT_FROM_494(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_496(call, data, i) call(i, data) _GMP_REPEAT_FROM_495(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_497(call, data, i) call(i, data) _GMP_REPEAT_FROM_496(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_498(call, data, i) call(i, data) _GMP_REPEAT_FROM_497(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_499(call, data, i) call(i, data) _GMP_REPEAT_FROM_498(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_500(call, data, i) call(i, data) _GMP_REPEAT_FROM_499(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_501(call, data, i) call(i, data) _GMP_REPEAT_FROM_500(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_502(call, data, i) call(i, data) _GMP_REPEAT_FROM_501(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_503(call, data, i) call(i, data) _GMP_REPEAT_FROM_502(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_504(call, data, i) call(i, data) _GMP_REPEAT_FROM_503(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_505(call, data, i) call(i, data) _GMP_REPEAT_FROM_504(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_506(call, data, i) call(i, data) _GMP_REPEAT_FROM_505(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_507(call, data, i) call(i, data) _GMP_REPEAT_FROM_506(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_508(call, data, i) call(i, data) _GMP_REPEAT_FROM_507(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_509(call, data, i) call(i, data) _GMP_REPEAT_FROM_508(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_510(call, data, i) call(i, data) _GMP_REPEAT_FROM_509(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_511(call, data, i) call(i, data) _GMP_REPEAT_FROM_510(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_512(call, data, i) call(i, data) _GMP_REPEAT_FROM_511(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_513(call, data, i) call(i, data) _GMP_REPEAT_FROM_512(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_514(call, data, i) call(i, data) _GMP_REPEAT_FROM_513(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_515(call, data, i) call(i, data) _GMP_REPEAT_FROM_514(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_516(call, data, i) call(i, data) _GMP_REPEAT_FROM_515(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_517(call, data, i) call(i, data) _GMP_REPEAT_FROM_516(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_518(call, data, i) call(i, data) _GMP_REPEAT_FROM_517(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_519(call, data, i) call(i, data) _GMP_REPEAT_FROM_518(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_520(call, data, i) call(i, data) _GMP_REPEAT_FROM_519(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_521(call, data, i) call(i, data) _GMP_REPEAT_FROM_520(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_522(call, data, i) call(i, data) _GMP_REPEAT_FROM_521(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_523(call, data, i) call(i, data) _GMP_REPEAT_FROM_522(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_524(call, data, i) call(i, data) _GMP_REPEAT_FROM_523(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_525(call, data, i) call(i, data) _GMP_REPEAT_FROM_524(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_526(call, data, i) call(i, data) _GMP_REPEAT_FROM_525(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_527(call, data, i) call(i, data) _GMP_REPEAT_FROM_526(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_528(call, data, i) call(i, data) _GMP_REPEAT_FROM_527(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_529(call, data, i) call(i, data) _GMP_REPEAT_FROM_528(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_530(call, data, i) call(i, data) _GMP_REPEAT_FROM_529(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_531(call, data, i) call(i, data) _GMP_REPEAT_FROM_530(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_532(call, data, i) call(i, data) _GMP_REPEAT_FROM_531(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_533(call, data, i) call(i, data) _GMP_REPEAT_FROM_532(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_534(call, data, i) call(i, data) _GMP_REPEAT_FROM_533(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_535(call, data, i) call(i, data) _GMP_REPEAT_FROM_534(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_536(call, data, i) call(i, data) _GMP_REPEAT_FROM_535(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_537(call, data, i) call(i, data) _GMP_REPEAT_FROM_536(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_538(call, data, i) call(i, data) _GMP_REPEAT_FROM_537(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_539(call, data, i) call(i, data) _GMP_REPEAT_FROM_538(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_540(call, data, i) call(i, data) _GMP_REPEAT_FROM_539(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_541(call, data, i) call(i, data) _GMP_REPEAT_FROM_540(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_542(call, data, i) call(i, data) _GMP_REPEAT_FROM_541(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_543(call, data, i) call(i, data) _GMP_REPEAT_FROM_542(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_544(call, data, i) call(i, data) _GMP_REPEAT_FROM_543(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_545(call, data, i) call(i, data) _GMP_REPEAT_FROM_544(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_546(call, data, i) call(i, data) _GMP_REPEAT_FROM_545(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_547(call, data, i) call(i, data) _GMP_REPEAT_FROM_546(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_548(call, data, i) call(i, data) _GMP_REPEAT_FROM_547(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_549(call, data, i) call(i, data) _GMP_REPEAT_FROM_548(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_550(call, data, i) call(i, data) _GMP_REPEAT_FROM_549(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_551(call, data, i) call(i, data) _GMP_REPEAT_FROM_550(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_552(call, data, i) call(i, data) _GMP_REPEAT_FROM_551(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_553(call, data, i) call(i, data) _GMP_REPEAT_FROM_552(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_554(call, data, i) call(i, data) _GMP_REPEAT_FROM_553(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_555(call, data, i) call(i, data) _GMP_REPEAT_FROM_554(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_556(call, data, i) call(i, data) _GMP_REPEAT_FROM_555(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_557(call, data, i) call(i, data) _GMP_REPEAT_FROM_556(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_558(call, data, i) call(i, data) _GMP_REPEAT_FROM_557(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_559(call, data, i) call(i, data) _GMP_REPEAT_FROM_558(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_560(call, data, i) call(i, data) _GMP_REPEAT_FROM_559(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_561(call, data, i) call(i, data) _GMP_REPEAT_FROM_560(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_562(call, data, i) call(i, data) _GMP_REPEAT_FROM_561(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_563(call, data, i) call(i, data) _GMP_REPEAT_FROM_562(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_564(call, data, i) call(i, data) _GMP_REPEAT_FROM_563(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_565(call, data, i) call(i, data) _GMP_REPEAT_FROM_564(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_566(call, data, i) call(i, data) _GMP_REPEAT_FROM_565(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_567(call, data, i) call(i, data) _GMP_REPEAT_FROM_566(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_568(call, data, i) call(i, data) _GMP_REPEAT_FROM_567(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_569(call, data, i) call(i, data) _GMP_REPEAT_FROM_568(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_570(call, data, i) call(i, data) _GMP_REPEAT_FROM_569(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_571(call, data, i) call(i, data) _GMP_REPEAT_FROM_570(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_572(call, data, i) call(i, data) _GMP_REPEAT_FROM_571(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_573(call, data, i) call(i, data) _GMP_REPEAT_FROM_572(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_574(call, data, i) call(i, data) _GMP_REPEAT_FROM_573(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_575(call, data, i) call(i, data) _GMP_REPEAT_FROM_574(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_576(call, data, i) call(i, data) _GMP_REPEAT_FROM_575(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_577(call, data, i) call(i, data) _GMP_REPEAT_FROM_576(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_578(call, data, i) call(i, data) _GMP_REPEAT_FROM_577(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_579(call, data, i) call(i, data) _GMP_REPEAT_FROM_578(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_580(call, data, i) call(i, data) _GMP_REPEAT_FROM_579(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_581(call, data, i) call(i, data) _GMP_REPEAT_FROM_580(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_582(call, data, i) call(i, data) _GMP_REPEAT_FROM_581(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_583(call, data, i) call(i, data) _GMP_REPEAT_FROM_582(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_584(call, data, i) call(i, data) _GMP_REPEAT_FROM_583(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_585(call, data, i) call(i, data) _GMP_REPEAT_FROM_584(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_586(call, data, i) call(i, data) _GMP_REPEAT_FROM_585(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_587(call, data, i) call(i, data) _GMP_REPEAT_FROM_586(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_588(call, data, i) call(i, data) _GMP_REPEAT_FROM_587(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_589(call, data, i) call(i, data) _GMP_REPEAT_FROM_588(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_590(call, data, i) call(i, data) _GMP_REPEAT_FROM_589(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_591(call, data, i) call(i, data) _GMP_REPEAT_FROM_590(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_592(call, data, i) call(i, data) _GMP_REPEAT_FROM_591(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_593(call, data, i) call(i, data) _GMP_REPEAT_FROM_592(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_594(call, data, i) call(i, data) _GMP_REPEAT_FROM_593(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_595(call, data, i) call(i, data) _GMP_REPEAT_FROM_594(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_596(call, data, i) call(i, data) _GMP_REPEAT_FROM_595(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_597(call, data, i) call(i, data) _GMP_REPEAT_FROM_596(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_598(call, data, i) call(i, data) _GMP_REPEAT_FROM_597(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_599(call, data, i) call(i, data) _GMP_REPEAT_FROM_598(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_600(call, data, i) call(i, data) _GMP_REPEAT_FROM_599(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_601(call, data, i) call(i, data) _GMP_REPEAT_FROM_600(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_602(call, data, i) call(i, data) _GMP_REPEAT_FROM_601(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_603(call, data, i) call(i, data) _GMP_REPEAT_FROM_602(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_604(call, data, i) call(i, data) _GMP_REPEAT_FROM_603(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_605(call, data, i) call(i, data) _GMP_REPEAT_FROM_604(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_606(call, data, i) call(i, data) _GMP_REPEAT_FROM_605(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_607(call, data, i) call(i, data) _GMP_REPEAT_FROM_606(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_608(call, data, i) call(i, data) _GMP_REPEAT_FROM_607(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_609(call, data, i) call(i, data) _GMP_REPEAT_FROM_608(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_610(call, data, i) call(i, data) _GMP_REPEAT_FROM_609(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_611(call, data, i) call(i, data) _GMP_REPEAT_FROM_610(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_612(call, data, i) call(i, data) _GMP_REPEAT_FROM_611(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_613(call, data, i) call(i, data) _GMP_REPEAT_FROM_612(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_614(call, data, i) call(i, data) _GMP_REPEAT_FROM_613(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_615(call, data, i) call(i, data) _GMP_REPEAT_FROM_614(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_616(call, data, i) call(i, data) _GMP_REPEAT_FROM_615(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_617(call, data, i) call(i, data) _GMP_REPEAT_FROM_616(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_618(call, data, i) call(i, data) _GMP_REPEAT_FROM_617(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_619(call, data, i) call(i, data) _GMP_REPEAT_FROM_618(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_620(call, data, i) call(i, data) _GMP_REPEAT_FROM_619(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_621(call, data, i) call(i, data) _GMP_REPEAT_FROM_620(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_622(call, data, i) call(i, data) _GMP_REPEAT_FROM_621(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_623(call, data, i) call(i, data) _GMP_REPEAT_FROM_622(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_624(call, data, i) call(i, data) _GMP_REPEAT_FROM_623(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_625(call, data, i) call(i, data) _GMP_REPEAT_FROM_624(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_626(call, data, i) call(i, data) _GMP_REPEAT_FROM_625(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_627(call, data, i) call(i, data) _GMP_REPEAT_FROM_626(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_628(call, data, i) call(i, data) _GMP_REPEAT_FROM_627(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_629(call, data, i) call(i, data) _GMP_REPEAT_FROM_628(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_630(call, data, i) call(i, data) _GMP_REPEAT_FROM_629(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_631(call, data, i) call(i, data) _GMP_REPEAT_FROM_630(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_632(call, data, i) call(i, data) _GMP_REPEAT_FROM_631(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_633(call, data, i) call(i, data) _GMP_REPEAT_FROM_632(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_634(call, data, i) call(i, data) _GMP_REPEAT_FROM_633(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_635(call, data, i) call(i, data) _GMP_REPEAT_FROM_634(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_636(call, data, i) call(i, data) _GMP_REPEAT_FROM_635(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_637(call, data, i) call(i, data) _GMP_REPEAT_FROM_636(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_638(call, data, i) call(i, data) _GMP_REPEAT_FROM_637(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_639(call, data, i) call(i, data) _GMP_REPEAT_FROM_638(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_640(call, data, i) call(i, data) _GMP_REPEAT_FROM_639(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_641(call, data, i) call(i, data) _GMP_REPEAT_FROM_640(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_642(call, data, i) call(i, data) _GMP_REPEAT_FROM_641(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_643(call, data, i) call(i, data) _GMP_REPEAT_FROM_642(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_644(call, data, i) call(i, data) _GMP_REPEAT_FROM_643(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_645(call, data, i) call(i, data) _GMP_REPEAT_FROM_644(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_646(call, data, i) call(i, data) _GMP_REPEAT_FROM_645(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_647(call, data, i) call(i, data) _GMP_REPEAT_FROM_646(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_648(call, data, i) call(i, data) _GMP_REPEAT_FROM_647(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_649(call, data, i) call(i, data) _GMP_REPEAT_FROM_648(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_650(call, data, i) call(i, data) _GMP_REPEAT_FROM_649(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_651(call, data, i) call(i, data) _GMP_REPEAT_FROM_650(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_652(call, data, i) call(i, data) _GMP_REPEAT_FROM_651(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_653(call, data, i) call(i, data) _GMP_REPEAT_FROM_652(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_654(call, data, i) call(i, data) _GMP_REPEAT_FROM_653(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_655(call, data, i) call(i, data) _GMP_REPEAT_FROM_654(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_656(call, data, i) call(i, data) _GMP_REPEAT_FROM_655(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_657(call, data, i) call(i, data) _GMP_REPEAT_FROM_656(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_658(call, data, i) call(i, data) _GMP_REPEAT_FROM_657(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_659(call, data, i) call(i, data) _GMP_REPEAT_FROM_658(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_660(call, data, i) call(i, data) _GMP_REPEAT_FROM_659(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_661(call, data, i) call(i, data) _GMP_REPEAT_FROM_660(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_662(call, data, i) call(i, data) _GMP_REPEAT_FROM_661(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_663(call, data, i) call(i, data) _GMP_REPEAT_FROM_662(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_664(call, data, i) call(i, data) _GMP_REPEAT_FROM_663(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_665(call, data, i) call(i, data) _GMP_REPEAT_FROM_664(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_666(call, data, i) call(i, data) _GMP_REPEAT_FROM_665(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_667(call, data, i) call(i, data) _GMP_REPEAT_FROM_666(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_668(call, data, i) call(i, data) _GMP_REPEAT_FROM_667(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_669(call, data, i) call(i, data) _GMP_REPEAT_FROM_668(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_670(call, data, i) call(i, data) _GMP_REPEAT_FROM_669(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_671(call, data, i) call(i, data) _GMP_REPEAT_FROM_670(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_672(call, data, i) call(i, data) _GMP_REPEAT_FROM_671(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_673(call, data, i) call(i, data) _GMP_REPEAT_FROM_672(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_674(call, data, i) call(i, data) _GMP_REPEAT_FROM_673(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_675(call, data, i) call(i, data) _GMP_REPEAT_FROM_674(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_676(call, data, i) call(i, data) _GMP_REPEAT_FROM_675(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_677(call, data, i) call(i, data) _GMP_REPEAT_FROM_676(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_678(call, data, i) call(i, data) _GMP_REPEAT_FROM_677(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_679(call, data, i) call(i, data) _GMP_REPEAT_FROM_678(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_680(call, data, i) call(i, data) _GMP_REPEAT_FROM_679(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_681(call, data, i) call(i, data) _GMP_REPEAT_FROM_680(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_682(call, data, i) call(i, data) _GMP_REPEAT_FROM_681(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_683(call, data, i) call(i, data) _GMP_REPEAT_FROM_682(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_684(call, data, i) call(i, data) _GMP_REPEAT_FROM_683(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_685(call, data, i) call(i, data) _GMP_REPEAT_FROM_684(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_686(call, data, i) call(i, data) _GMP_REPEAT_FROM_685(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_687(call, data, i) call(i, data) _GMP_REPEAT_FROM_686(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_688(call, data, i) call(i, data) _GMP_REPEAT_FROM_687(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_689(call, data, i) call(i, data) _GMP_REPEAT_FROM_688(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_690(call, data, i) call(i, data) _GMP_REPEAT_FROM_689(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_691(call, data, i) call(i, data) _GMP_REPEAT_FROM_690(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_692(call, data, i) call(i, data) _GMP_REPEAT_FROM_691(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_693(call, data, i) call(i, data) _GMP_REPEAT_FROM_692(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_694(call, data, i) call(i, data) _GMP_REPEAT_FROM_693(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_695(call, data, i) call(i, data) _GMP_REPEAT_FROM_694(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_696(call, data, i) call(i, data) _GMP_REPEAT_FROM_695(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_697(call, data, i) call(i, data) _GMP_REPEAT_FROM_696(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_698(call, data, i) call(i, data) _GMP_REPEAT_FROM_697(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_699(call, data, i) call(i, data) _GMP_REPEAT_FROM_698(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_700(call, data, i) call(i, data) _GMP_REPEAT_FROM_699(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_701(call, data, i) call(i, data) _GMP_REPEAT_FROM_700(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_702(call, data, i) call(i, data) _GMP_REPEAT_FROM_701(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_703(call, data, i) call(i, data) _GMP_REPEAT_FROM_702(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_704(call, data, i) call(i, data) _GMP_REPEAT_FROM_703(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_705(call, data, i) call(i, data) _GMP_REPEAT_FROM_704(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_706(call, data, i) call(i, data) _GMP_REPEAT_FROM_705(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_707(call, data, i) call(i, data) _GMP_REPEAT_FROM_706(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_708(call, data, i) call(i, data) _GMP_REPEAT_FROM_707(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_709(call, data, i) call(i, data) _GMP_REPEAT_FROM_708(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_710(call, data, i) call(i, data) _GMP_REPEAT_FROM_709(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_711(call, data, i) call(i, data) _GMP_REPEAT_FROM_710(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_712(call, data, i) call(i, data) _GMP_REPEAT_FROM_711(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_713(call, data, i) call(i, data) _GMP_REPEAT_FROM_712(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_714(call, data, i) call(i, data) _GMP_REPEAT_FROM_713(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_715(call, data, i) call(i, data) _GMP_REPEAT_FROM_714(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_716(call, data, i) call(i, data) _GMP_REPEAT_FROM_715(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_717(call, data, i) call(i, data) _GMP_REPEAT_FROM_716(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_718(call, data, i) call(i, data) _GMP_REPEAT_FROM_717(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_719(call, data, i) call(i, data) _GMP_REPEAT_FROM_718(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_720(call, data, i) call(i, data) _GMP_REPEAT_FROM_719(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_721(call, data, i) call(i, data) _GMP_REPEAT_FROM_720(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_722(call, data, i) call(i, data) _GMP_REPEAT_FROM_721(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_723(call, data, i) call(i, data) _GMP_REPEAT_FROM_722(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_724(call, data, i) call(i, data) _GMP_REPEAT_FROM_723(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_725(call, data, i) call(i, data) _GMP_REPEAT_FROM_724(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_726(call, data, i) call(i, data) _GMP_REPEAT_FROM_725(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_727(call, data, i) call(i, data) _GMP_REPEAT_FROM_726(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_728(call, data, i) call(i, data) _GMP_REPEAT_FROM_727(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_729(call, data, i) call(i, data) _GMP_REPEAT_FROM_728(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_730(call, data, i) call(i, data) _GMP_REPEAT_FROM_729(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_731(call, data, i) call(i, data) _GMP_REPEAT_FROM_730(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_732(call, data, i) call(i, data) _GMP_REPEAT_FROM_731(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_733(call, data, i) call(i, data) _GMP_REPEAT_FROM_732(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_734(call, data, i) call(i, data) _GMP_REPEAT_FROM_733(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_735(call, data, i) call(i, data) _GMP_REPEAT_FROM_734(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_736(call, data, i) call(i, data) _GMP_REPEAT_FROM_735(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_737(call, data, i) call(i, data) _GMP_REPEAT_FROM_736(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_738(call, data, i) call(i, data) _GMP_REPEAT_FROM_737(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_739(call, data, i) call(i, data) _GMP_REPEAT_FROM_738(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_740(call, data, i) call(i, data) _GMP_REPEAT_FROM_739(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_741(call, data, i) call(i, data) _GMP_REPEAT_FROM_740(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_742(call, data, i) call(i, data) _GMP_REPEAT_FROM_741(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_743(call, data, i) call(i, data) _GMP_REPEAT_FROM_742(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_744(call, data, i) call(i, data) _GMP_REPEAT_FROM_743(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_745(call, data, i) call(i, data) _GMP_REPEAT_FROM_744(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_746(call, data, i) call(i, data) _GMP_REPEAT_FROM_745(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_747(call, data, i) call(i, data) _GMP_REPEAT_FROM_746(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_748(call, data, i) call(i, data) _GMP_REPEAT_FROM_747(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_749(call, data, i) call(i, data) _GMP_REPEAT_FROM_748(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_750(call, data, i) call(i, data) _GMP_REPEAT_FROM_749(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_751(call, data, i) call(i, data) _GMP_REPEAT_FROM_750(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_752(call, data, i) call(i, data) _GMP_REPEAT_FROM_751(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_753(call, data, i) call(i, data) _GMP_REPEAT_FROM_752(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_754(call, data, i) call(i, data) _GMP_REPEAT_FROM_753(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_755(call, data, i) call(i, data) _GMP_REPEAT_FROM_754(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_756(call, data, i) call(i, data) _GMP_REPEAT_FROM_755(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_757(call, data, i) call(i, data) _GMP_REPEAT_FROM_756(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_758(call, data, i) call(i, data) _GMP_REPEAT_FROM_757(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_759(call, data, i) call(i, data) _GMP_REPEAT_FROM_758(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_760(call, data, i) call(i, data) _GMP_REPEAT_FROM_759(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_761(call, data, i) call(i, data) _GMP_REPEAT_FROM_760(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_762(call, data, i) call(i, data) _GMP_REPEAT_FROM_761(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_763(call, data, i) call(i, data) _GMP_REPEAT_FROM_762(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_764(call, data, i) call(i, data) _GMP_REPEAT_FROM_763(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_765(call, data, i) call(i, data) _GMP_REPEAT_FROM_764(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_766(call, data, i) call(i, data) _GMP_REPEAT_FROM_765(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_767(call, data, i) call(i, data) _GMP_REPEAT_FROM_766(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_768(call, data, i) call(i, data) _GMP_REPEAT_FROM_767(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_769(call, data, i) call(i, data) _GMP_REPEAT_FROM_768(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_770(call, data, i) call(i, data) _GMP_REPEAT_FROM_769(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_771(call, data, i) call(i, data) _GMP_REPEAT_FROM_770(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_772(call, data, i) call(i, data) _GMP_REPEAT_FROM_771(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_773(call, data, i) call(i, data) _GMP_REPEAT_FROM_772(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_774(call, data, i) call(i, data) _GMP_REPEAT_FROM_773(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_775(call, data, i) call(i, data) _GMP_REPEAT_FROM_774(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_776(call, data, i) call(i, data) _GMP_REPEAT_FROM_775(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_777(call, data, i) call(i, data) _GMP_REPEAT_FROM_776(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_778(call, data, i) call(i, data) _GMP_REPEAT_FROM_777(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_779(call, data, i) call(i, data) _GMP_REPEAT_FROM_778(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_780(call, data, i) call(i, data) _GMP_REPEAT_FROM_779(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_781(call, data, i) call(i, data) _GMP_REPEAT_FROM_780(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_782(call, data, i) call(i, data) _GMP_REPEAT_FROM_781(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_783(call, data, i) call(i, data) _GMP_REPEAT_FROM_782(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_784(call, data, i) call(i, data) _GMP_REPEAT_FROM_783(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_785(call, data, i) call(i, data) _GMP_REPEAT_FROM_784(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_786(call, data, i) call(i, data) _GMP_REPEAT_FROM_785(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_787(call, data, i) call(i, data) _GMP_REPEAT_FROM_786(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_788(call, data, i) call(i, data) _GMP_REPEAT_FROM_787(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_789(call, data, i) call(i, data) _GMP_REPEAT_FROM_788(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_790(call, data, i) call(i, data) _GMP_REPEAT_FROM_789(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_791(call, data, i) call(i, data) _GMP_REPEAT_FROM_790(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_792(call, data, i) call(i, data) _GMP_REPEAT_FROM_791(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_793(call, data, i) call(i, data) _GMP_REPEAT_FROM_792(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_794(call, data, i) call(i, data) _GMP_REPEAT_FROM_793(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_795(call, data, i) call(i, data) _GMP_REPEAT_FROM_794(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_796(call, data, i) call(i, data) _GMP_REPEAT_FROM_795(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_797(call, data, i) call(i, data) _GMP_REPEAT_FROM_796(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_798(call, data, i) call(i, data) _GMP_REPEAT_FROM_797(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_799(call, data, i) call(i, data) _GMP_REPEAT_FROM_798(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_800(call, data, i) call(i, data) _GMP_REPEAT_FROM_799(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_801(call, data, i) call(i, data) _GMP_REPEAT_FROM_800(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_802(call, data, i) call(i, data) _GMP_REPEAT_FROM_801(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_803(call, data, i) call(i, data) _GMP_REPEAT_FROM_802(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_804(call, data, i) call(i, data) _GMP_REPEAT_FROM_803(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_805(call, data, i) call(i, data) _GMP_REPEAT_FROM_804(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_806(call, data, i) call(i, data) _GMP_REPEAT_FROM_805(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_807(call, data, i) call(i, data) _GMP_REPEAT_FROM_806(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_808(call, data, i) call(i, data) _GMP_REPEAT_FROM_807(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_809(call, data, i) call(i, data) _GMP_REPEAT_FROM_808(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_810(call, data, i) call(i, data) _GMP_REPEAT_FROM_809(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_811(call, data, i) call(i, data) _GMP_REPEAT_FROM_810(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_812(call, data, i) call(i, data) _GMP_REPEAT_FROM_811(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_813(call, data, i) call(i, data) _GMP_REPEAT_FROM_812(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_814(call, data, i) call(i, data) _GMP_REPEAT_FROM_813(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_815(call, data, i) call(i, data) _GMP_REPEAT_FROM_814(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_816(call, data, i) call(i, data) _GMP_REPEAT_FROM_815(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_817(call, data, i) call(i, data) _GMP_REPEAT_FROM_816(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_818(call, data, i) call(i, data) _GMP_REPEAT_FROM_817(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_819(call, data, i) call(i, data) _GMP_REPEAT_FROM_818(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_820(call, data, i) call(i, data) _GMP_REPEAT_FROM_819(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_821(call, data, i) call(i, data) _GMP_REPEAT_FROM_820(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_822(call, data, i) call(i, data) _GMP_REPEAT_FROM_821(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_823(call, data, i) call(i, data) _GMP_REPEAT_FROM_822(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_824(call, data, i) call(i, data) _GMP_REPEAT_FROM_823(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_825(call, data, i) call(i, data) _GMP_REPEAT_FROM_824(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_826(call, data, i) call(i, data) _GMP_REPEAT_FROM_825(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_827(call, data, i) call(i, data) _GMP_REPEAT_FROM_826(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_828(call, data, i) call(i, data) _GMP_REPEAT_FROM_827(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_829(call, data, i) call(i, data) _GMP_REPEAT_FROM_828(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_830(call, data, i) call(i, data) _GMP_REPEAT_FROM_829(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_831(call, data, i) call(i, data) _GMP_REPEAT_FROM_830(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_832(call, data, i) call(i, data) _GMP_REPEAT_FROM_831(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_833(call, data, i) call(i, data) _GMP_REPEAT_FROM_832(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_834(call, data, i) call(i, data) _GMP_REPEAT_FROM_833(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_835(call, data, i) call(i, data) _GMP_REPEAT_FROM_834(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_836(call, data, i) call(i, data) _GMP_REPEAT_FROM_835(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_837(call, data, i) call(i, data) _GMP_REPEAT_FROM_836(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_838(call, data, i) call(i, data) _GMP_REPEAT_FROM_837(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_839(call, data, i) call(i, data) _GMP_REPEAT_FROM_838(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_840(call, data, i) call(i, data) _GMP_REPEAT_FROM_839(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_841(call, data, i) call(i, data) _GMP_REPEAT_FROM_840(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_842(call, data, i) call(i, data) _GMP_REPEAT_FROM_841(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_843(call, data, i) call(i, data) _GMP_REPEAT_FROM_842(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_844(call, data, i) call(i, data) _GMP_REPEAT_FROM_843(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_845(call, data, i) call(i, data) _GMP_REPEAT_FROM_844(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_846(call, data, i) call(i, data) _GMP_REPEAT_FROM_845(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_847(call, data, i) call(i, data) _GMP_REPEAT_FROM_846(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_848(call, data, i) call(i, data) _GMP_REPEAT_FROM_847(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_849(call, data, i) call(i, data) _GMP_REPEAT_FROM_848(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_850(call, data, i) call(i, data) _GMP_REPEAT_FROM_849(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_851(call, data, i) call(i, data) _GMP_REPEAT_FROM_850(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_852(call, data, i) call(i, data) _GMP_REPEAT_FROM_851(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_853(call, data, i) call(i, data) _GMP_REPEAT_FROM_852(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_854(call, data, i) call(i, data) _GMP_REPEAT_FROM_853(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_855(call, data, i) call(i, data) _GMP_REPEAT_FROM_854(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_856(call, data, i) call(i, data) _GMP_REPEAT_FROM_855(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_857(call, data, i) call(i, data) _GMP_REPEAT_FROM_856(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_858(call, data, i) call(i, data) _GMP_REPEAT_FROM_857(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_859(call, data, i) call(i, data) _GMP_REPEAT_FROM_858(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_860(call, data, i) call(i, data) _GMP_REPEAT_FROM_859(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_861(call, data, i) call(i, data) _GMP_REPEAT_FROM_860(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_862(call, data, i) call(i, data) _GMP_REPEAT_FROM_861(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_863(call, data, i) call(i, data) _GMP_REPEAT_FROM_862(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_864(call, data, i) call(i, data) _GMP_REPEAT_FROM_863(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_865(call, data, i) call(i, data) _GMP_REPEAT_FROM_864(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_866(call, data, i) call(i, data) _GMP_REPEAT_FROM_865(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_867(call, data, i) call(i, data) _GMP_REPEAT_FROM_866(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_868(call, data, i) call(i, data) _GMP_REPEAT_FROM_867(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_869(call, data, i) call(i, data) _GMP_REPEAT_FROM_868(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_870(call, data, i) call(i, data) _GMP_REPEAT_FROM_869(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_871(call, data, i) call(i, data) _GMP_REPEAT_FROM_870(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_872(call, data, i) call(i, data) _GMP_REPEAT_FROM_871(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_873(call, data, i) call(i, data) _GMP_REPEAT_FROM_872(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_874(call, data, i) call(i, data) _GMP_REPEAT_FROM_873(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_875(call, data, i) call(i, data) _GMP_REPEAT_FROM_874(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_876(call, data, i) call(i, data) _GMP_REPEAT_FROM_875(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_877(call, data, i) call(i, data) _GMP_REPEAT_FROM_876(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_878(call, data, i) call(i, data) _GMP_REPEAT_FROM_877(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_879(call, data, i) call(i, data) _GMP_REPEAT_FROM_878(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_880(call, data, i) call(i, data) _GMP_REPEAT_FROM_879(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_881(call, data, i) call(i, data) _GMP_REPEAT_FROM_880(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_882(call, data, i) call(i, data) _GMP_REPEAT_FROM_881(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_883(call, data, i) call(i, data) _GMP_REPEAT_FROM_882(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_884(call, data, i) call(i, data) _GMP_REPEAT_FROM_883(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_885(call, data, i) call(i, data) _GMP_REPEAT_FROM_884(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_886(call, data, i) call(i, data) _GMP_REPEAT_FROM_885(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_887(call, data, i) call(i, data) _GMP_REPEAT_FROM_886(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_888(call, data, i) call(i, data) _GMP_REPEAT_FROM_887(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_889(call, data, i) call(i, data) _GMP_REPEAT_FROM_888(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_890(call, data, i) call(i, data) _GMP_REPEAT_FROM_889(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_891(call, data, i) call(i, data) _GMP_REPEAT_FROM_890(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_892(call, data, i) call(i, data) _GMP_REPEAT_FROM_891(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_893(call, data, i) call(i, data) _GMP_REPEAT_FROM_892(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_894(call, data, i) call(i, data) _GMP_REPEAT_FROM_893(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_895(call, data, i) call(i, data) _GMP_REPEAT_FROM_894(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_896(call, data, i) call(i, data) _GMP_REPEAT_FROM_895(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_897(call, data, i) call(i, data) _GMP_REPEAT_FROM_896(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_898(call, data, i) call(i, data) _GMP_REPEAT_FROM_897(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_899(call, data, i) call(i, data) _GMP_REPEAT_FROM_898(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_900(call, data, i) call(i, data) _GMP_REPEAT_FROM_899(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_901(call, data, i) call(i, data) _GMP_REPEAT_FROM_900(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_902(call, data, i) call(i, data) _GMP_REPEAT_FROM_901(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_903(call, data, i) call(i, data) _GMP_REPEAT_FROM_902(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_904(call, data, i) call(i, data) _GMP_REPEAT_FROM_903(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_905(call, data, i) call(i, data) _GMP_REPEAT_FROM_904(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_906(call, data, i) call(i, data) _GMP_REPEAT_FROM_905(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_907(call, data, i) call(i, data) _GMP_REPEAT_FROM_906(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_908(call, data, i) call(i, data) _GMP_REPEAT_FROM_907(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_909(call, data, i) call(i, data) _GMP_REPEAT_FROM_908(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_910(call, data, i) call(i, data) _GMP_REPEAT_FROM_909(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_911(call, data, i) call(i, data) _GMP_REPEAT_FROM_910(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_912(call, data, i) call(i, data) _GMP_REPEAT_FROM_911(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_913(call, data, i) call(i, data) _GMP_REPEAT_FROM_912(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_914(call, data, i) call(i, data) _GMP_REPEAT_FROM_913(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_915(call, data, i) call(i, data) _GMP_REPEAT_FROM_914(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_916(call, data, i) call(i, data) _GMP_REPEAT_FROM_915(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_917(call, data, i) call(i, data) _GMP_REPEAT_FROM_916(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_918(call, data, i) call(i, data) _GMP_REPEAT_FROM_917(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_919(call, data, i) call(i, data) _GMP_REPEAT_FROM_918(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_920(call, data, i) call(i, data) _GMP_REPEAT_FROM_919(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_921(call, data, i) call(i, data) _GMP_REPEAT_FROM_920(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_922(call, data, i) call(i, data) _GMP_REPEAT_FROM_921(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_923(call, data, i) call(i, data) _GMP_REPEAT_FROM_922(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_924(call, data, i) call(i, data) _GMP_REPEAT_FROM_923(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_925(call, data, i) call(i, data) _GMP_REPEAT_FROM_924(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_926(call, data, i) call(i, data) _GMP_REPEAT_FROM_925(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_927(call, data, i) call(i, data) _GMP_REPEAT_FROM_926(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_928(call, data, i) call(i, data) _GMP_REPEAT_FROM_927(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_929(call, data, i) call(i, data) _GMP_REPEAT_FROM_928(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_930(call, data, i) call(i, data) _GMP_REPEAT_FROM_929(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_931(call, data, i) call(i, data) _GMP_REPEAT_FROM_930(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_932(call, data, i) call(i, data) _GMP_REPEAT_FROM_931(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_933(call, data, i) call(i, data) _GMP_REPEAT_FROM_932(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_934(call, data, i) call(i, data) _GMP_REPEAT_FROM_933(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_935(call, data, i) call(i, data) _GMP_REPEAT_FROM_934(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_936(call, data, i) call(i, data) _GMP_REPEAT_FROM_935(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_937(call, data, i) call(i, data) _GMP_REPEAT_FROM_936(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_938(call, data, i) call(i, data) _GMP_REPEAT_FROM_937(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_939(call, data, i) call(i, data) _GMP_REPEAT_FROM_938(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_940(call, data, i) call(i, data) _GMP_REPEAT_FROM_939(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_941(call, data, i) call(i, data) _GMP_REPEAT_FROM_940(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_942(call, data, i) call(i, data) _GMP_REPEAT_FROM_941(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_943(call, data, i) call(i, data) _GMP_REPEAT_FROM_942(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_944(call, data, i) call(i, data) _GMP_REPEAT_FROM_943(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_945(call, data, i) call(i, data) _GMP_REPEAT_FROM_944(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_946(call, data, i) call(i, data) _GMP_REPEAT_FROM_945(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_947(call, data, i) call(i, data) _GMP_REPEAT_FROM_946(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_948(call, data, i) call(i, data) _GMP_REPEAT_FROM_947(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_949(call, data, i) call(i, data) _GMP_REPEAT_FROM_948(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_950(call, data, i) call(i, data) _GMP_REPEAT_FROM_949(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_951(call, data, i) call(i, data) _GMP_REPEAT_FROM_950(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_952(call, data, i) call(i, data) _GMP_REPEAT_FROM_951(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_953(call, data, i) call(i, data) _GMP_REPEAT_FROM_952(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_954(call, data, i) call(i, data) _GMP_REPEAT_FROM_953(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_955(call, data, i) call(i, data) _GMP_REPEAT_FROM_954(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_956(call, data, i) call(i, data) _GMP_REPEAT_FROM_955(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_957(call, data, i) call(i, data) _GMP_REPEAT_FROM_956(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_958(call, data, i) call(i, data) _GMP_REPEAT_FROM_957(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_959(call, data, i) call(i, data) _GMP_REPEAT_FROM_958(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_960(call, data, i) call(i, data) _GMP_REPEAT_FROM_959(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_961(call, data, i) call(i, data) _GMP_REPEAT_FROM_960(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_962(call, data, i) call(i, data) _GMP_REPEAT_FROM_961(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_963(call, data, i) call(i, data) _GMP_REPEAT_FROM_962(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_964(call, data, i) call(i, data) _GMP_REPEAT_FROM_963(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_965(call, data, i) call(i, data) _GMP_REPEAT_FROM_964(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_966(call, data, i) call(i, data) _GMP_REPEAT_FROM_965(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_967(call, data, i) call(i, data) _GMP_REPEAT_FROM_966(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_968(call, data, i) call(i, data) _GMP_REPEAT_FROM_967(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_969(call, data, i) call(i, data) _GMP_REPEAT_FROM_968(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_970(call, data, i) call(i, data) _GMP_REPEAT_FROM_969(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_971(call, data, i) call(i, data) _GMP_REPEAT_FROM_970(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_972(call, data, i) call(i, data) _GMP_REPEAT_FROM_971(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_973(call, data, i) call(i, data) _GMP_REPEAT_FROM_972(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_974(call, data, i) call(i, data) _GMP_REPEAT_FROM_973(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_975(call, data, i) call(i, data) _GMP_REPEAT_FROM_974(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_976(call, data, i) call(i, data) _GMP_REPEAT_FROM_975(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_977(call, data, i) call(i, data) _GMP_REPEAT_FROM_976(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_978(call, data, i) call(i, data) _GMP_REPEAT_FROM_977(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_979(call, data, i) call(i, data) _GMP_REPEAT_FROM_978(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_980(call, data, i) call(i, data) _GMP_REPEAT_FROM_979(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_981(call, data, i) call(i, data) _GMP_REPEAT_FROM_980(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_982(call, data, i) call(i, data) _GMP_REPEAT_FROM_981(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_983(call, data, i) call(i, data) _GMP_REPEAT_FROM_982(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_984(call, data, i) call(i, data) _GMP_REPEAT_FROM_983(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_985(call, data, i) call(i, data) _GMP_REPEAT_FROM_984(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_986(call, data, i) call(i, data) _GMP_REPEAT_FROM_985(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_987(call, data, i) call(i, data) _GMP_REPEAT_FROM_986(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_988(call, data, i) call(i, data) _GMP_REPEAT_FROM_987(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_989(call, data, i) call(i, data) _GMP_REPEAT_FROM_988(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_990(call, data, i) call(i, data) _GMP_REPEAT_FROM_989(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_991(call, data, i) call(i, data) _GMP_REPEAT_FROM_990(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_992(call, data, i) call(i, data) _GMP_REPEAT_FROM_991(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_993(call, data, i) call(i, data) _GMP_REPEAT_FROM_992(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_994(call, data, i) call(i, data) _GMP_REPEAT_FROM_993(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_995(call, data, i) call(i, data) _GMP_REPEAT_FROM_994(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_996(call, data, i) call(i, data) _GMP_REPEAT_FROM_995(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_997(call, data, i) call(i, data) _GMP_REPEAT_FROM_996(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_998(call, data, i) call(i, data) _GMP_REPEAT_FROM_997(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_999(call, data, i) call(i, data) _GMP_REPEAT_FROM_998(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1000(call, data, i) call(i, data) _GMP_REPEAT_FROM_999(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1001(call, data, i) call(i, data) _GMP_REPEAT_FROM_1000(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1002(call, data, i) call(i, data) _GMP_REPEAT_FROM_1001(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1003(call, data, i) call(i, data) _GMP_REPEAT_FROM_1002(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1004(call, data, i) call(i, data) _GMP_REPEAT_FROM_1003(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1005(call, data, i) call(i, data) _GMP_REPEAT_FROM_1004(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1006(call, data, i) call(i, data) _GMP_REPEAT_FROM_1005(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1007(call, data, i) call(i, data) _GMP_REPEAT_FROM_1006(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1008(call, data, i) call(i, data) _GMP_REPEAT_FROM_1007(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1009(call, data, i) call(i, data) _GMP_REPEAT_FROM_1008(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1010(call, data, i) call(i, data) _GMP_REPEAT_FROM_1009(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1011(call, data, i) call(i, data) _GMP_REPEAT_FROM_1010(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1012(call, data, i) call(i, data) _GMP_REPEAT_FROM_1011(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1013(call, data, i) call(i, data) _GMP_REPEAT_FROM_1012(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1014(call, data, i) call(i, data) _GMP_REPEAT_FROM_1013(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1015(call, data, i) call(i, data) _GMP_REPEAT_FROM_1014(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1016(call, data, i) call(i, data) _GMP_REPEAT_FROM_1015(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1017(call, data, i) call(i, data) _GMP_REPEAT_FROM_1016(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1018(call, data, i) call(i, data) _GMP_REPEAT_FROM_1017(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1019(call, data, i) call(i, data) _GMP_REPEAT_FROM_1018(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1020(call, data, i) call(i, data) _GMP_REPEAT_FROM_1019(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1021(call, data, i) call(i, data) _GMP_REPEAT_FROM_1020(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1022(call, data, i) call(i, data) _GMP_REPEAT_FROM_1021(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1023(call, data, i) call(i, data) _GMP_REPEAT_FROM_1022(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_1024(call, data, i) call(i, data) _GMP_REPEAT_FROM_1023(call, data, GMP_CONCAT(_GMP_INC_, i)())
+
+#endif // GMP_MACRO_LIMITS_REPEAT_1024_HPP_
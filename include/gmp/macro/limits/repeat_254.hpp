@@ -0,0 +1,520 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_REPEAT_254_HPP_
+#define GMP_MACRO_LIMITS_REPEAT_254_HPP_
+
+// GMP_REPEAT
+#define _GMP_REPEAT_0(call, data)
+#define _GMP_REPEAT_1(call, data) _GMP_REPEAT_0(call, data) call(0, data)
+#define _GMP_REPEAT_2(call, data) _GMP_REPEAT_1(call, data) call(1, data)
+#define _GMP_REPEAT_3(call, data) _GMP_REPEAT_2(call, data) call(2, data)
+#define _GMP_REPEAT_4(call, data) _GMP_REPEAT_3(call, data) call(3, data)
+#define _GMP_REPEAT_5(call, data) _GMP_REPEAT_4(call, data) call(4, data)
+#define _GMP_REPEAT_6(call, data) _GMP_REPEAT_5(call, data) call(5, data)
+#define _GMP_REPEAT_7(call, data) _GMP_REPEAT_6(call, data) call(6, data)
+#define _GMP_REPEAT_8(call, data) _GMP_REPEAT_7(call, data) call(7, data)
+#define _GMP_REPEAT_9(call, data) _GMP_REPEAT_8(call, data) call(8, data)
+#define _GMP_REPEAT_10(call, data) _GMP_REPEAT_9(call, data) call(9, data)
+#define _GMP_REPEAT_11(call, data) _GMP_REPEAT_10(call, data) call(10, data)
+#define _GMP_REPEAT_12(call, data) _GMP_REPEAT_11(call, data) call(11, data)
+#define _GMP_REPEAT_13(call, data) _GMP_REPEAT_12(call, data) call(12, data)
+#define _GMP_REPEAT_14(call, data) _GMP_REPEAT_13(call, data) call(13, data)
+#define _GMP_REPEAT_15(call, data) _GMP_REPEAT_14(call, data) call(14, data)
+#define _GMP_REPEAT_16(call, data) _GMP_REPEAT_15(call, data) call(15, data)
+#define _GMP_REPEAT_17(call, data) _GMP_REPEAT_16(call, data) call(16, data)
+#define _GMP_REPEAT_18(call, data) _GMP_REPEAT_17(call, data) call(17, data)
+#define _GMP_REPEAT_19(call, data) _GMP_REPEAT_18(call, data) call(18, data)
+#define _GMP_REPEAT_20(call, data) _GMP_REPEAT_19(call, data) call(19, data)
+#define _GMP_REPEAT_21(call, data) _GMP_REPEAT_20(call, data) call(20, data)
+#define _GMP_REPEAT_22(call, data) _GMP_REPEAT_21(call, data) call(21, data)
+#define _GMP_REPEAT_23(call, data) _GMP_REPEAT_22(call, data) call(22, data)
+#define _GMP_REPEAT_24(call, data) _GMP_REPEAT_23(call, data) call(23, data)
+#define _GMP_REPEAT_25(call, data) _GMP_REPEAT_24(call, data) call(24, data)
+#define _GMP_REPEAT_26(call, data) _GMP_REPEAT_25(call, data) call(25, data)
+#define _GMP_REPEAT_27(call, data) _GMP_REPEAT_26(call, data) call(26, data)
+#define _GMP_REPEAT_28(call, data) _GMP_REPEAT_27(call, data) call(27, data)
+#define _GMP_REPEAT_29(call, data) _GMP_REPEAT_28(call, data) call(28, data)
+#define _GMP_REPEAT_30(call, data) _GMP_REPEAT_29(call, data) call(29, data)
+#define _GMP_REPEAT_31(call, data) _GMP_REPEAT_30(call, data) call(30, data)
+#define _GMP_REPEAT_32(call, data) _GMP_REPEAT_31(call, data) call(31, data)
+#define _GMP_REPEAT_33(call, data) _GMP_REPEAT_32(call, data) call(32, data)
+#define _GMP_REPEAT_34(call, data) _GMP_REPEAT_33(call, data) call(33, data)
+#define _GMP_REPEAT_35(call, data) _GMP_REPEAT_34(call, data) call(34, data)
+#define _GMP_REPEAT_36(call, data) _GMP_REPEAT_35(call, data) call(35, data)
+#define _GMP_REPEAT_37(call, data) _GMP_REPEAT_36(call, data) call(36, data)
+#define _GMP_REPEAT_38(call, data) _GMP_REPEAT_37(call, data) call(37, data)
+#define _GMP_REPEAT_39(call, data) _GMP_REPEAT_38(call, data) call(38, data)
+#define _GMP_REPEAT_40(call, data) _GMP_REPEAT_39(call, data) call(39, data)
+#define _GMP_REPEAT_41(call, data) _GMP_REPEAT_40(call, data) call(40, data)
+#define _GMP_REPEAT_42(call, data) _GMP_REPEAT_41(call, data) call(41, data)
+#define _GMP_REPEAT_43(call, data) _GMP_REPEAT_42(call, data) call(42, data)
+#define _GMP_REPEAT_44(call, data) _GMP_REPEAT_43(call, data) call(43, data)
+#define _GMP_REPEAT_45(call, data) _GMP_REPEAT_44(call, data) call(44, data)
+#define _GMP_REPEAT_46(call, data) _GMP_REPEAT_45(call, data) call(45, data)
+#define _GMP_REPEAT_47(call, data) _GMP_REPEAT_46(call, data) call(46, data)
+#define _GMP_REPEAT_48(call, data) _GMP_REPEAT_47(call, data) call(47, data)
+#define _GMP_REPEAT_49(call, data) _GMP_REPEAT_48(call, data) call(48, data)
+#define _GMP_REPEAT_50(call, data) _GMP_REPEAT_49(call, data) call(49, data)
+#define _GMP_REPEAT_51(call, data) _GMP_REPEAT_50(call, data) call(50, data)
+#define _GMP_REPEAT_52(call, data) _GMP_REPEAT_51(call, data) call(51, data)
+#define _GMP_REPEAT_53(call, data) _GMP_REPEAT_52(call, data) call(52, data)
+#define _GMP_REPEAT_54(call, data) _GMP_REPEAT_53(call, data) call(53, data)
+#define _GMP_REPEAT_55(call, data) _GMP_REPEAT_54(call, data) call(54, data)
+#define _GMP_REPEAT_56(call, data) _GMP_REPEAT_55(call, data) call(55, data)
+#define _GMP_REPEAT_57(call, data) _GMP_REPEAT_56(call, data) call(56, data)
+#define _GMP_REPEAT_58(call, data) _GMP_REPEAT_57(call, data) call(57, data)
+#define _GMP_REPEAT_59(call, data) _GMP_REPEAT_58(call, data) call(58, data)
+#define _GMP_REPEAT_60(call, data) _GMP_REPEAT_59(call, data) call(59, data)
+#define _GMP_REPEAT_61(call, data) _GMP_REPEAT_60(call, data) call(60, data)
+#define _GMP_REPEAT_62(call, data) _GMP_REPEAT_61(call, data) call(61, data)
+#define _GMP_REPEAT_63(call, data) _GMP_REPEAT_62(call, data) call(62, data)
+#define _GMP_REPEAT_64(call, data) _GMP_REPEAT_63(call, data) call(63, data)
+#define _GMP_REPEAT_65(call, data) _GMP_REPEAT_64(call, data) call(64, data)
+#define _GMP_REPEAT_66(call, data) _GMP_REPEAT_65(call, data) call(65, data)
+#define _GMP_REPEAT_67(call, data) _GMP_REPEAT_66(call, data) call(66, data)
+#define _GMP_REPEAT_68(call, data) _GMP_REPEAT_67(call, data) call(67, data)
+#define _GMP_REPEAT_69(call, data) _GMP_REPEAT_68(call, data) call(68, data)
+#define _GMP_REPEAT_70(call, data) _GMP_REPEAT_69(call, data) call(69, data)
+#define _GMP_REPEAT_71(call, data) _GMP_REPEAT_70(call, data) call(70, data)
+#define _GMP_REPEAT_72(call, data) _GMP_REPEAT_71(call, data) call(71, data)
+#define _GMP_REPEAT_73(call, data) _GMP_REPEAT_72(call, data) call(72, data)
+#define _GMP_REPEAT_74(call, data) _GMP_REPEAT_73(call, data) call(73, data)
+#define _GMP_REPEAT_75(call, data) _GMP_REPEAT_74(call, data) call(74, data)
+#define _GMP_REPEAT_76(call, data) _GMP_REPEAT_75(call, data) call(75, data)
+#define _GMP_REPEAT_77(call, data) _GMP_REPEAT_76(call, data) call(76, data)
+#define _GMP_REPEAT_78(call, data) _GMP_REPEAT_77(call, data) call(77, data)
+#define _GMP_REPEAT_79(call, data) _GMP_REPEAT_78(call, data) call(78, data)
+#define _GMP_REPEAT_80(call, data) _GMP_REPEAT_79(call, data) call(79, data)
+#define _GMP_REPEAT_81(call, data) _GMP_REPEAT_80(call, data) call(80, data)
+#define _GMP_REPEAT_82(call, data) _GMP_REPEAT_81(call, data) call(81, data)
+#define _GMP_REPEAT_83(call, data) _GMP_REPEAT_82(call, data) call(82, data)
+#define _GMP_REPEAT_84(call, data) _GMP_REPEAT_83(call, data) call(83, data)
+#define _GMP_REPEAT_85(call, data) _GMP_REPEAT_84(call, data) call(84, data)
+#define _GMP_REPEAT_86(call, data) _GMP_REPEAT_85(call, data) call(85, data)
+#define _GMP_REPEAT_87(call, data) _GMP_REPEAT_86(call, data) call(86, data)
+#define _GMP_REPEAT_88(call, data) _GMP_REPEAT_87(call, data) call(87, data)
+#define _GMP_REPEAT_89(call, data) _GMP_REPEAT_88(call, data) call(88, data)
+#define _GMP_REPEAT_90(call, data) _GMP_REPEAT_89(call, data) call(89, data)
+#define _GMP_REPEAT_91(call, data) _GMP_REPEAT_90(call, data) call(90, data)
+#define _GMP_REPEAT_92(call, data) _GMP_REPEAT_91(call, data) call(91, data)
+#define _GMP_REPEAT_93(call, data) _GMP_REPEAT_92(call, data) call(92, data)
+#define _GMP_REPEAT_94(call, data) _GMP_REPEAT_93(call, data) call(93, data)
+#define _GMP_REPEAT_95(call, data) _GMP_REPEAT_94(call, data) call(94, data)
+#define _GMP_REPEAT_96(call, data) _GMP_REPEAT_95(call, data) call(95, data)
+#define _GMP_REPEAT_97(call, data) _GMP_REPEAT_96(call, data) call(96, data)
+#define _GMP_REPEAT_98(call, data) _GMP_REPEAT_97(call, data) call(97, data)
+#define _GMP_REPEAT_99(call, data) _GMP_REPEAT_98(call, data) call(98, data)
+#define _GMP_REPEAT_100(call, data) _GMP_REPEAT_99(call, data) call(99, data)
+#define _GMP_REPEAT_101(call, data) _GMP_REPEAT_100(call, data) call(100, data)
+#define _GMP_REPEAT_102(call, data) _GMP_REPEAT_101(call, data) call(101, data)
+#define _GMP_REPEAT_103(call, data) _GMP_REPEAT_102(call, data) call(102, data)
+#define _GMP_REPEAT_104(call, data) _GMP_REPEAT_103(call, data) call(103, data)
+#define _GMP_REPEAT_105(call, data) _GMP_REPEAT_104(call, data) call(104, data)
+#define _GMP_REPEAT_106(call, data) _GMP_REPEAT_105(call, data) call(105, data)
+#define _GMP_REPEAT_107(call, data) _GMP_REPEAT_106(call, data) call(106, data)
+#define _GMP_REPEAT_108(call, data) _GMP_REPEAT_107(call, data) call(107, data)
+#define _GMP_REPEAT_109(call, data) _GMP_REPEAT_108(call, data) call(108, data)
+#define _GMP_REPEAT_110(call, data) _GMP_REPEAT_109(call, data) call(109, data)
+#define _GMP_REPEAT_111(call, data) _GMP_REPEAT_110(call, data) call(110, data)
+#define _GMP_REPEAT_112(call, data) _GMP_REPEAT_111(call, data) call(111, data)
+#define _GMP_REPEAT_113(call, data) _GMP_REPEAT_112(call, data) call(112, data)
+#define _GMP_REPEAT_114(call, data) _GMP_REPEAT_113(call, data) call(113, data)
+#define _GMP_REPEAT_115(call, data) _GMP_REPEAT_114(call, data) call(114, data)
+#define _GMP_REPEAT_116(call, data) _GMP_REPEAT_115(call, data) call(115, data)
+#define _GMP_REPEAT_117(call, data) _GMP_REPEAT_116(call, data) call(116, data)
+#define _GMP_REPEAT_118(call, data) _GMP_REPEAT_117(call, data) call(117, data)
+#define _GMP_REPEAT_119(call, data) _GMP_REPEAT_118(call, data) call(118, data)
+#define _GMP_REPEAT_120(call, data) _GMP_REPEAT_119(call, data) call(119, data)
+#define _GMP_REPEAT_121(call, data) _GMP_REPEAT_120(call, data) call(120, data)
+#define _GMP_REPEAT_122(call, data) _GMP_REPEAT_121(call, data) call(121, data)
+#define _GMP_REPEAT_123(call, data) _GMP_REPEAT_122(call, data) call(122, data)
+#define _GMP_REPEAT_124(call, data) _GMP_REPEAT_123(call, data) call(123, data)
+#define _GMP_REPEAT_125(call, data) _GMP_REPEAT_124(call, data) call(124, data)
+#define _GMP_REPEAT_126(call, data) _GMP_REPEAT_125(call, data) call(125, data)
+#define _GMP_REPEAT_127(call, data) _GMP_REPEAT_126(call, data) call(126, data)
+#define _GMP_REPEAT_128(call, data) _GMP_REPEAT_127(call, data) call(127, data)
+#define _GMP_REPEAT_129(call, data) _GMP_REPEAT_128(call, data) call(128, data)
+#define _GMP_REPEAT_130(call, data) _GMP_REPEAT_129(call, data) call(129, data)
+#define _GMP_REPEAT_131(call, data) _GMP_REPEAT_130(call, data) call(130, data)
+#define _GMP_REPEAT_132(call, data) _GMP_REPEAT_131(call, data) call(131, data)
+#define _GMP_REPEAT_133(call, data) _GMP_REPEAT_132(call, data) call(132, data)
+#define _GMP_REPEAT_134(call, data) _GMP_REPEAT_133(call, data) call(133, data)
+#define _GMP_REPEAT_135(call, data) _GMP_REPEAT_134(call, data) call(134, data)
+#define _GMP_REPEAT_136(call, data) _GMP_REPEAT_135(call, data) call(135, data)
+#define _GMP_REPEAT_137(call, data) _GMP_REPEAT_136(call, data) call(136, data)
+#define _GMP_REPEAT_138(call, data) _GMP_REPEAT_137(call, data) call(137, data)
+#define _GMP_REPEAT_139(call, data) _GMP_REPEAT_138(call, data) call(138, data)
+#define _GMP_REPEAT_140(call, data) _GMP_REPEAT_139(call, data) call(139, data)
+#define _GMP_REPEAT_141(call, data) _GMP_REPEAT_140(call, data) call(140, data)
+#define _GMP_REPEAT_142(call, data) _GMP_REPEAT_141(call, data) call(141, data)
+#define _GMP_REPEAT_143(call, data) _GMP_REPEAT_142(call, data) call(142, data)
+#define _GMP_REPEAT_144(call, data) _GMP_REPEAT_143(call, data) call(143, data)
+#define _GMP_REPEAT_145(call, data) _GMP_REPEAT_144(call, data) call(144, data)
+#define _GMP_REPEAT_146(call, data) _GMP_REPEAT_145(call, data) call(145, data)
+#define _GMP_REPEAT_147(call, data) _GMP_REPEAT_146(call, data) call(146, data)
+#define _GMP_REPEAT_148(call, data) _GMP_REPEAT_147(call, data) call(147, data)
+#define _GMP_REPEAT_149(call, data) _GMP_REPEAT_148(call, data) call(148, data)
+#define _GMP_REPEAT_150(call, data) _GMP_REPEAT_149(call, data) call(149, data)
+#define _GMP_REPEAT_151(call, data) _GMP_REPEAT_150(call, data) call(150, data)
+#define _GMP_REPEAT_152(call, data) _GMP_REPEAT_151(call, data) call(151, data)
+#define _GMP_REPEAT_153(call, data) _GMP_REPEAT_152(call, data) call(152, data)
+#define _GMP_REPEAT_154(call, data) _GMP_REPEAT_153(call, data) call(153, data)
+#define _GMP_REPEAT_155(call, data) _GMP_REPEAT_154(call, data) call(154, data)
+#define _GMP_REPEAT_156(call, data) _GMP_REPEAT_155(call, data) call(155, data)
+#define _GMP_REPEAT_157(call, data) _GMP_REPEAT_156(call, data) call(156, data)
+#define _GMP_REPEAT_158(call, data) _GMP_REPEAT_157(call, data) call(157, data)
+#define _GMP_REPEAT_159(call, data) _GMP_REPEAT_158(call, data) call(158, data)
+#define _GMP_REPEAT_160(call, data) _GMP_REPEAT_159(call, data) call(159, data)
+#define _GMP_REPEAT_161(call, data) _GMP_REPEAT_160(call, data) call(160, data)
+#define _GMP_REPEAT_162(call, data) _GMP_REPEAT_161(call, data) call(161, data)
+#define _GMP_REPEAT_163(call, data) _GMP_REPEAT_162(call, data) call(162, data)
+#define _GMP_REPEAT_164(call, data) _GMP_REPEAT_163(call, data) call(163, data)
+#define _GMP_REPEAT_165(call, data) _GMP_REPEAT_164(call, data) call(164, data)
+#define _GMP_REPEAT_166(call, data) _GMP_REPEAT_165(call, data) call(165, data)
+#define _GMP_REPEAT_167(call, data) _GMP_REPEAT_166(call, data) call(166, data)
+#define _GMP_REPEAT_168(call, data) _GMP_REPEAT_167(call, data) call(167, data)
+#define _GMP_REPEAT_169(call, data) _GMP_REPEAT_168(call, data) call(168, data)
+#define _GMP_REPEAT_170(call, data) _GMP_REPEAT_169(call, data) call(169, data)
+#define _GMP_REPEAT_171(call, data) _GMP_REPEAT_170(call, data) call(170, data)
+#define _GMP_REPEAT_172(call, data) _GMP_REPEAT_171(call, data) call(171, data)
+#define _GMP_REPEAT_173(call, data) _GMP_REPEAT_172(call, data) call(172, data)
+#define _GMP_REPEAT_174(call, data) _GMP_REPEAT_173(call, data) call(173, data)
+#define _GMP_REPEAT_175(call, data) _GMP_REPEAT_174(call, data) call(174, data)
+#define _GMP_REPEAT_176(call, data) _GMP_REPEAT_175(call, data) call(175, data)
+#define _GMP_REPEAT_177(call, data) _GMP_REPEAT_176(call, data) call(176, data)
+#define _GMP_REPEAT_178(call, data) _GMP_REPEAT_177(call, data) call(177, data)
+#define _GMP_REPEAT_179(call, data) _GMP_REPEAT_178(call, data) call(178, data)
+#define _GMP_REPEAT_180(call, data) _GMP_REPEAT_179(call, data) call(179, data)
+#define _GMP_REPEAT_181(call, data) _GMP_REPEAT_180(call, data) call(180, data)
+#define _GMP_REPEAT_182(call, data) _GMP_REPEAT_181(call, data) call(181, data)
+#define _GMP_REPEAT_183(call, data) _GMP_REPEAT_182(call, data) call(182, data)
+#define _GMP_REPEAT_184(call, data) _GMP_REPEAT_183(call, data) call(183, data)
+#define _GMP_REPEAT_185(call, data) _GMP_REPEAT_184(call, data) call(184, data)
+#define _GMP_REPEAT_186(call, data) _GMP_REPEAT_185(call, data) call(185, data)
+#define _GMP_REPEAT_187(call, data) _GMP_REPEAT_186(call, data) call(186, data)
+#define _GMP_REPEAT_188(call, data) _GMP_REPEAT_187(call, data) call(187, data)
+#define _GMP_REPEAT_189(call, data) _GMP_REPEAT_188(call, data) call(188, data)
+#define _GMP_REPEAT_190(call, data) _GMP_REPEAT_189(call, data) call(189, data)
+#define _GMP_REPEAT_191(call, data) _GMP_REPEAT_190(call, data) call(190, data)
+#define _GMP_REPEAT_192(call, data) _GMP_REPEAT_191(call, data) call(191, data)
+#define _GMP_REPEAT_193(call, data) _GMP_REPEAT_192(call, data) call(192, data)
+#define _GMP_REPEAT_194(call, data) _GMP_REPEAT_193(call, data) call(193, data)
+#define _GMP_REPEAT_195(call, data) _GMP_REPEAT_194(call, data) call(194, data)
+#define _GMP_REPEAT_196(call, data) _GMP_REPEAT_195(call, data) call(195, data)
+#define _GMP_REPEAT_197(call, data) _GMP_REPEAT_196(call, data) call(196, data)
+#define _GMP_REPEAT_198(call, data) _GMP_REPEAT_197(call, data) call(197, data)
+#define _GMP_REPEAT_199(call, data) _GMP_REPEAT_198(call, data) call(198, data)
+#define _GMP_REPEAT_200(call, data) _GMP_REPEAT_199(call, data) call(199, data)
+#define _GMP_REPEAT_201(call, data) _GMP_REPEAT_200(call, data) call(200, data)
+#define _GMP_REPEAT_202(call, data) _GMP_REPEAT_201(call, data) call(201, data)
+#define _GMP_REPEAT_203(call, data) _GMP_REPEAT_202(call, data) call(202, data)
+#define _GMP_REPEAT_204(call, data) _GMP_REPEAT_203(call, data) call(203, data)
+#define _GMP_REPEAT_205(call, data) _GMP_REPEAT_204(call, data) call(204, data)
+#define _GMP_REPEAT_206(call, data) _GMP_REPEAT_205(call, data) call(205, data)
+#define _GMP_REPEAT_207(call, data) _GMP_REPEAT_206(call, data) call(206, data)
+#define _GMP_REPEAT_208(call, data) _GMP_REPEAT_207(call, data) call(207, data)
+#define _GMP_REPEAT_209(call, data) _GMP_REPEAT_208(call, data) call(208, data)
+#define _GMP_REPEAT_210(call, data) _GMP_REPEAT_209(call, data) call(209, data)
+#define _GMP_REPEAT_211(call, data) _GMP_REPEAT_210(call, data) call(210, data)
+#define _GMP_REPEAT_212(call, data) _GMP_REPEAT_211(call, data) call(211, data)
+#define _GMP_REPEAT_213(call, data) _GMP_REPEAT_212(call, data) call(212, data)
+#define _GMP_REPEAT_214(call, data) _GMP_REPEAT_213(call, data) call(213, data)
+#define _GMP_REPEAT_215(call, data) _GMP_REPEAT_214(call, data) call(214, data)
+#define _GMP_REPEAT_216(call, data) _GMP_REPEAT_215(call, data) call(215, data)
+#define _GMP_REPEAT_217(call, data) _GMP_REPEAT_216(call, data) call(216, data)
+#define _GMP_REPEAT_218(call, data) _GMP_REPEAT_217(call, data) call(217, data)
+#define _GMP_REPEAT_219(call, data) _GMP_REPEAT_218(call, data) call(218, data)
+#define _GMP_REPEAT_220(call, data) _GMP_REPEAT_219(call, data) call(219, data)
+#define _GMP_REPEAT_221(call, data) _GMP_REPEAT_220(call, data) call(220, data)
+#define _GMP_REPEAT_222(call, data) _GMP_REPEAT_221(call, data) call(221, data)
+#define _GMP_REPEAT_223(call, data) _GMP_REPEAT_222(call, data) call(222, data)
+#define _GMP_REPEAT_224(call, data) _GMP_REPEAT_223(call, data) call(223, data)
+#define _GMP_REPEAT_225(call, data) _GMP_REPEAT_224(call, data) call(224, data)
+#define _GMP_REPEAT_226(call, data) _GMP_REPEAT_225(call, data) call(225, data)
+#define _GMP_REPEAT_227(call, data) _GMP_REPEAT_226(call, data) call(226, data)
+#define _GMP_REPEAT_228(call, data) _GMP_REPEAT_227(call, data) call(227, data)
+#define _GMP_REPEAT_229(call, data) _GMP_REPEAT_228(call, data) call(228, data)
+#define _GMP_REPEAT_230(call, data) _GMP_REPEAT_229(call, data) call(229, data)
+#define _GMP_REPEAT_231(call, data) _GMP_REPEAT_230(call, data) call(230, data)
+#define _GMP_REPEAT_232(call, data) _GMP_REPEAT_231(call, data) call(231, data)
+#define _GMP_REPEAT_233(call, data) _GMP_REPEAT_232(call, data) call(232, data)
+#define _GMP_REPEAT_234(call, data) _GMP_REPEAT_233(call, data) call(233, data)
+#define _GMP_REPEAT_235(call, data) _GMP_REPEAT_234(call, data) call(234, data)
+#define _GMP_REPEAT_236(call, data) _GMP_REPEAT_235(call, data) call(235, data)
+#define _GMP_REPEAT_237(call, data) _GMP_REPEAT_236(call, data) call(236, data)
+#define _GMP_REPEAT_238(call, data) _GMP_REPEAT_237(call, data) call(237, data)
+#define _GMP_REPEAT_239(call, data) _GMP_REPEAT_238(call, data) call(238, data)
+#define _GMP_REPEAT_240(call, data) _GMP_REPEAT_239(call, data) call(239, data)
+#define _GMP_REPEAT_241(call, data) _GMP_REPEAT_240(call, data) call(240, data)
+#define _GMP_REPEAT_242(call, data) _GMP_REPEAT_241(call, data) call(241, data)
+#define _GMP_REPEAT_243(call, data) _GMP_REPEAT_242(call, data) call(242, data)
+#define _GMP_REPEAT_244(call, data) _GMP_REPEAT_243(call, data) call(243, data)
+#define _GMP_REPEAT_245(call, data) _GMP_REPEAT_244(call, data) call(244, data)
+#define _GMP_REPEAT_246(call, data) _GMP_REPEAT_245(call, data) call(245, data)
+#define _GMP_REPEAT_247(call, data) _GMP_REPEAT_246(call, data) call(246, data)
+#define _GMP_REPEAT_248(call, data) _GMP_REPEAT_247(call, data) call(247, data)
+#define _GMP_REPEAT_249(call, data) _GMP_REPEAT_248(call, data) call(248, data)
+#define _GMP_REPEAT_250(call, data) _GMP_REPEAT_249(call, data) call(249, data)
+#define _GMP_REPEAT_251(call, data) _GMP_REPEAT_250(call, data) call(250, data)
+#define _GMP_REPEAT_252(call, data) _GMP_REPEAT_251(call, data) call(251, data)
+#define _GMP_REPEAT_253(call, data) _GMP_REPEAT_252(call, data) call(252, data)
+#define _GMP_REPEAT_254(call, data) _GMP_REPEAT_253(call, data) call(253, data)
+
+// GMP_REPEAT_FROM
+#define _GMP_REPEAT_FROM_0(call, data, i)
+#define _GMP_REPEAT_FROM_1(call, data, i) call(i, data)
+#define _GMP_REPEAT_FROM_2(call, data, i) call(i, data) _GMP_REPEAT_FROM_1(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_3(call, data, i) call(i, data) _GMP_REPEAT_FROM_2(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_4(call, data, i) call(i, data) _GMP_REPEAT_FROM_3(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_5(call, data, i) call(i, data) _GMP_REPEAT_FROM_4(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_6(call, data, i) call(i, data) _GMP_REPEAT_FROM_5(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_7(call, data, i) call(i, data) _GMP_REPEAT_FROM_6(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_8(call, data, i) call(i, data) _GMP_REPEAT_FROM_7(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_9(call, data, i) call(i, data) _GMP_REPEAT_FROM_8(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_10(call, data, i) call(i, data) _GMP_REPEAT_FROM_9(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_11(call, data, i) call(i, data) _GMP_REPEAT_FROM_10(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_12(call, data, i) call(i, data) _GMP_REPEAT_FROM_11(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_13(call, data, i) call(i, data) _GMP_REPEAT_FROM_12(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_14(call, data, i) call(i, data) _GMP_REPEAT_FROM_13(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_15(call, data, i) call(i, data) _GMP_REPEAT_FROM_14(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_16(call, data, i) call(i, data) _GMP_REPEAT_FROM_15(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_17(call, data, i) call(i, data) _GMP_REPEAT_FROM_16(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_18(call, data, i) call(i, data) _GMP_REPEAT_FROM_17(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_19(call, data, i) call(i, data) _GMP_REPEAT_FROM_18(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_20(call, data, i) call(i, data) _GMP_REPEAT_FROM_19(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_21(call, data, i) call(i, data) _GMP_REPEAT_FROM_20(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_22(call, data, i) call(i, data) _GMP_REPEAT_FROM_21(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_23(call, data, i) call(i, data) _GMP_REPEAT_FROM_22(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_24(call, data, i) call(i, data) _GMP_REPEAT_FROM_23(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_25(call, data, i) call(i, data) _GMP_REPEAT_FROM_24(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_26(call, data, i) call(i, data) _GMP_REPEAT_FROM_25(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_27(call, data, i) call(i, data) _GMP_REPEAT_FROM_26(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_28(call, data, i) call(i, data) _GMP_REPEAT_FROM_27(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_29(call, data, i) call(i, data) _GMP_REPEAT_FROM_28(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_30(call, data, i) call(i, data) _GMP_REPEAT_FROM_29(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_31(call, data, i) call(i, data) _GMP_REPEAT_FROM_30(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_32(call, data, i) call(i, data) _GMP_REPEAT_FROM_31(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_33(call, data, i) call(i, data) _GMP_REPEAT_FROM_32(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_34(call, data, i) call(i, data) _GMP_REPEAT_FROM_33(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_35(call, data, i) call(i, data) _GMP_REPEAT_FROM_34(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_36(call, data, i) call(i, data) _GMP_REPEAT_FROM_35(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_37(call, data, i) call(i, data) _GMP_REPEAT_FROM_36(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_38(call, data, i) call(i, data) _GMP_REPEAT_FROM_37(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_39(call, data, i) call(i, data) _GMP_REPEAT_FROM_38(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_40(call, data, i) call(i, data) _GMP_REPEAT_FROM_39(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_41(call, data, i) call(i, data) _GMP_REPEAT_FROM_40(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_42(call, data, i) call(i, data) _GMP_REPEAT_FROM_41(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_43(call, data, i) call(i, data) _GMP_REPEAT_FROM_42(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_44(call, data, i) call(i, data) _GMP_REPEAT_FROM_43(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_45(call, data, i) call(i, data) _GMP_REPEAT_FROM_44(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_46(call, data, i) call(i, data) _GMP_REPEAT_FROM_45(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_47(call, data, i) call(i, data) _GMP_REPEAT_FROM_46(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_48(call, data, i) call(i, data) _GMP_REPEAT_FROM_47(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_49(call, data, i) call(i, data) _GMP_REPEAT_FROM_48(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_50(call, data, i) call(i, data) _GMP_REPEAT_FROM_49(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_51(call, data, i) call(i, data) _GMP_REPEAT_FROM_50(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_52(call, data, i) call(i, data) _GMP_REPEAT_FROM_51(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_53(call, data, i) call(i, data) _GMP_REPEAT_FROM_52(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_54(call, data, i) call(i, data) _GMP_REPEAT_FROM_53(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_55(call, data, i) call(i, data) _GMP_REPEAT_FROM_54(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_56(call, data, i) call(i, data) _GMP_REPEAT_FROM_55(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_57(call, data, i) call(i, data) _GMP_REPEAT_FROM_56(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_58(call, data, i) call(i, data) _GMP_REPEAT_FROM_57(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_59(call, data, i) call(i, data) _GMP_REPEAT_FROM_58(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_60(call, data, i) call(i, data) _GMP_REPEAT_FROM_59(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_61(call, data, i) call(i, data) _GMP_REPEAT_FROM_60(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_62(call, data, i) call(i, data) _GMP_REPEAT_FROM_61(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_63(call, data, i) call(i, data) _GMP_REPEAT_FROM_62(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_64(call, data, i) call(i, data) _GMP_REPEAT_FROM_63(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_65(call, data, i) call(i, data) _GMP_REPEAT_FROM_64(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_66(call, data, i) call(i, data) _GMP_REPEAT_FROM_65(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_67(call, data, i) call(i, data) _GMP_REPEAT_FROM_66(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_68(call, data, i) call(i, data) _GMP_REPEAT_FROM_67(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_69(call, data, i) call(i, data) _GMP_REPEAT_FROM_68(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_70(call, data, i) call(i, data) _GMP_REPEAT_FROM_69(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_71(call, data, i) call(i, data) _GMP_REPEAT_FROM_70(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_72(call, data, i) call(i, data) _GMP_REPEAT_FROM_71(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_73(call, data, i) call(i, data) _GMP_REPEAT_FROM_72(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_74(call, data, i) call(i, data) _GMP_REPEAT_FROM_73(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_75(call, data, i) call(i, data) _GMP_REPEAT_FROM_74(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_76(call, data, i) call(i, data) _GMP_REPEAT_FROM_75(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_77(call, data, i) call(i, data) _GMP_REPEAT_FROM_76(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_78(call, data, i) call(i, data) _GMP_REPEAT_FROM_77(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_79(call, data, i) call(i, data) _GMP_REPEAT_FROM_78(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_80(call, data, i) call(i, data) _GMP_REPEAT_FROM_79(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_81(call, data, i) call(i, data) _GMP_REPEAT_FROM_80(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_82(call, data, i) call(i, data) _GMP_REPEAT_FROM_81(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_83(call, data, i) call(i, data) _GMP_REPEAT_FROM_82(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_84(call, data, i) call(i, data) _GMP_REPEAT_FROM_83(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_85(call, data, i) call(i, data) _GMP_REPEAT_FROM_84(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_86(call, data, i) call(i, data) _GMP_REPEAT_FROM_85(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_87(call, data, i) call(i, data) _GMP_REPEAT_FROM_86(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_88(call, data, i) call(i, data) _GMP_REPEAT_FROM_87(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_89(call, data, i) call(i, data) _GMP_REPEAT_FROM_88(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_90(call, data, i) call(i, data) _GMP_REPEAT_FROM_89(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_91(call, data, i) call(i, data) _GMP_REPEAT_FROM_90(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_92(call, data, i) call(i, data) _GMP_REPEAT_FROM_91(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_93(call, data, i) call(i, data) _GMP_REPEAT_FROM_92(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_94(call, data, i) call(i, data) _GMP_REPEAT_FROM_93(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_95(call, data, i) call(i, data) _GMP_REPEAT_FROM_94(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_96(call, data, i) call(i, data) _GMP_REPEAT_FROM_95(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_97(call, data, i) call(i, data) _GMP_REPEAT_FROM_96(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_98(call, data, i) call(i, data) _GMP_REPEAT_FROM_97(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_99(call, data, i) call(i, data) _GMP_REPEAT_FROM_98(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_100(call, data, i) call(i, data) _GMP_REPEAT_FROM_99(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_101(call, data, i) call(i, data) _GMP_REPEAT_FROM_100(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_102(call, data, i) call(i, data) _GMP_REPEAT_FROM_101(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_103(call, data, i) call(i, data) _GMP_REPEAT_FROM_102(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_104(call, data, i) call(i, data) _GMP_REPEAT_FROM_103(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_105(call, data, i) call(i, data) _GMP_REPEAT_FROM_104(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_106(call, data, i) call(i, data) _GMP_REPEAT_FROM_105(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_107(call, data, i) call(i, data) _GMP_REPEAT_FROM_106(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_108(call, data, i) call(i, data) _GMP_REPEAT_FROM_107(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_109(call, data, i) call(i, data) _GMP_REPEAT_FROM_108(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_110(call, data, i) call(i, data) _GMP_REPEAT_FROM_109(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_111(call, data, i) call(i, data) _GMP_REPEAT_FROM_110(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_112(call, data, i) call(i, data) _GMP_REPEAT_FROM_111(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_113(call, data, i) call(i, data) _GMP_REPEAT_FROM_112(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_114(call, data, i) call(i, data) _GMP_REPEAT_FROM_113(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_115(call, data, i) call(i, data) _GMP_REPEAT_FROM_114(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_116(call, data, i) call(i, data) _GMP_REPEAT_FROM_115(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_117(call, data, i) call(i, data) _GMP_REPEAT_FROM_116(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_118(call, data, i) call(i, data) _GMP_REPEAT_FROM_117(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_119(call, data, i) call(i, data) _GMP_REPEAT_FROM_118(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_120(call, data, i) call(i, data) _GMP_REPEAT_FROM_119(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_121(call, data, i) call(i, data) _GMP_REPEAT_FROM_120(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_122(call, data, i) call(i, data) _GMP_REPEAT_FROM_121(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_123(call, data, i) call(i, data) _GMP_REPEAT_FROM_122(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_124(call, data, i) call(i, data) _GMP_REPEAT_FROM_123(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_125(call, data, i) call(i, data) _GMP_REPEAT_FROM_124(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_126(call, data, i) call(i, data) _GMP_REPEAT_FROM_125(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_127(call, data, i) call(i, data) _GMP_REPEAT_FROM_126(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_128(call, data, i) call(i, data) _GMP_REPEAT_FROM_127(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_129(call, data, i) call(i, data) _GMP_REPEAT_FROM_128(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_130(call, data, i) call(i, data) _GMP_REPEAT_FROM_129(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_131(call, data, i) call(i, data) _GMP_REPEAT_FROM_130(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_132(call, data, i) call(i, data) _GMP_REPEAT_FROM_131(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_133(call, data, i) call(i, data) _GMP_REPEAT_FROM_132(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_134(call, data, i) call(i, data) _GMP_REPEAT_FROM_133(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_135(call, data, i) call(i, data) _GMP_REPEAT_FROM_134(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_136(call, data, i) call(i, data) _GMP_REPEAT_FROM_135(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_137(call, data, i) call(i, data) _GMP_REPEAT_FROM_136(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_138(call, data, i) call(i, data) _GMP_REPEAT_FROM_137(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_139(call, data, i) call(i, data) _GMP_REPEAT_FROM_138(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_140(call, data, i) call(i, data) _GMP_REPEAT_FROM_139(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_141(call, data, i) call(i, data) _GMP_REPEAT_FROM_140(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_142(call, data, i) call(i, data) _GMP_REPEAT_FROM_141(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_143(call, data, i) call(i, data) _GMP_REPEAT_FROM_142(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_144(call, data, i) call(i, data) _GMP_REPEAT_FROM_143(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_145(call, data, i) call(i, data) _GMP_REPEAT_FROM_144(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_146(call, data, i) call(i, data) _GMP_REPEAT_FROM_145(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_147(call, data, i) call(i, data) _GMP_REPEAT_FROM_146(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_148(call, data, i) call(i, data) _GMP_REPEAT_FROM_147(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_149(call, data, i) call(i, data) _GMP_REPEAT_FROM_148(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_150(call, data, i) call(i, data) _GMP_REPEAT_FROM_149(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_151(call, data, i) call(i, data) _GMP_REPEAT_FROM_150(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_152(call, data, i) call(i, data) _GMP_REPEAT_FROM_151(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_153(call, data, i) call(i, data) _GMP_REPEAT_FROM_152(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_154(call, data, i) call(i, data) _GMP_REPEAT_FROM_153(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_155(call, data, i) call(i, data) _GMP_REPEAT_FROM_154(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_156(call, data, i) call(i, data) _GMP_REPEAT_FROM_155(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_157(call, data, i) call(i, data) _GMP_REPEAT_FROM_156(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_158(call, data, i) call(i, data) _GMP_REPEAT_FROM_157(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_159(call, data, i) call(i, data) _GMP_REPEAT_FROM_158(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_160(call, data, i) call(i, data) _GMP_REPEAT_FROM_159(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_161(call, data, i) call(i, data) _GMP_REPEAT_FROM_160(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_162(call, data, i) call(i, data) _GMP_REPEAT_FROM_161(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_163(call, data, i) call(i, data) _GMP_REPEAT_FROM_162(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_164(call, data, i) call(i, data) _GMP_REPEAT_FROM_163(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_165(call, data, i) call(i, data) _GMP_REPEAT_FROM_164(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_166(call, data, i) call(i, data) _GMP_REPEAT_FROM_165(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_167(call, data, i) call(i, data) _GMP_REPEAT_FROM_166(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_168(call, data, i) call(i, data) _GMP_REPEAT_FROM_167(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_169(call, data, i) call(i, data) _GMP_REPEAT_FROM_168(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_170(call, data, i) call(i, data) _GMP_REPEAT_FROM_169(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_171(call, data, i) call(i, data) _GMP_REPEAT_FROM_170(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_172(call, data, i) call(i, data) _GMP_REPEAT_FROM_171(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_173(call, data, i) call(i, data) _GMP_REPEAT_FROM_172(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_174(call, data, i) call(i, data) _GMP_REPEAT_FROM_173(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_175(call, data, i) call(i, data) _GMP_REPEAT_FROM_174(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_176(call, data, i) call(i, data) _GMP_REPEAT_FROM_175(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_177(call, data, i) call(i, data) _GMP_REPEAT_FROM_176(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_178(call, data, i) call(i, data) _GMP_REPEAT_FROM_177(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_179(call, data, i) call(i, data) _GMP_REPEAT_FROM_178(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_180(call, data, i) call(i, data) _GMP_REPEAT_FROM_179(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_181(call, data, i) call(i, data) _GMP_REPEAT_FROM_180(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_182(call, data, i) call(i, data) _GMP_REPEAT_FROM_181(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_183(call, data, i) call(i, data) _GMP_REPEAT_FROM_182(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_184(call, data, i) call(i, data) _GMP_REPEAT_FROM_183(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_185(call, data, i) call(i, data) _GMP_REPEAT_FROM_184(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_186(call, data, i) call(i, data) _GMP_REPEAT_FROM_185(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_187(call, data, i) call(i, data) _GMP_REPEAT_FROM_186(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_188(call, data, i) call(i, data) _GMP_REPEAT_FROM_187(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_189(call, data, i) call(i, data) _GMP_REPEAT_FROM_188(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_190(call, data, i) call(i, data) _GMP_REPEAT_FROM_189(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_191(call, data, i) call(i, data) _GMP_REPEAT_FROM_190(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_192(call, data, i) call(i, data) _GMP_REPEAT_FROM_191(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_193(call, data, i) call(i, data) _GMP_REPEAT_FROM_192(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_194(call, data, i) call(i, data) _GMP_REPEAT_FROM_193(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_195(call, data, i) call(i, data) _GMP_REPEAT_FROM_194(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_196(call, data, i) call(i, data) _GMP_REPEAT_FROM_195(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_197(call, data, i) call(i, data) _GMP_REPEAT_FROM_196(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_198(call, data, i) call(i, data) _GMP_REPEAT_FROM_197(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_199(call, data, i) call(i, data) _GMP_REPEAT_FROM_198(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_200(call, data, i) call(i, data) _GMP_REPEAT_FROM_199(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_201(call, data, i) call(i, data) _GMP_REPEAT_FROM_200(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_202(call, data, i) call(i, data) _GMP_REPEAT_FROM_201(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_203(call, data, i) call(i, data) _GMP_REPEAT_FROM_202(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_204(call, data, i) call(i, data) _GMP_REPEAT_FROM_203(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_205(call, data, i) call(i, data) _GMP_REPEAT_FROM_204(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_206(call, data, i) call(i, data) _GMP_REPEAT_FROM_205(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_207(call, data, i) call(i, data) _GMP_REPEAT_FROM_206(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_208(call, data, i) call(i, data) _GMP_REPEAT_FROM_207(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_209(call, data, i) call(i, data) _GMP_REPEAT_FROM_208(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_210(call, data, i) call(i, data) _GMP_REPEAT_FROM_209(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_211(call, data, i) call(i, data) _GMP_REPEAT_FROM_210(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_212(call, data, i) call(i, data) _GMP_REPEAT_FROM_211(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_213(call, data, i) call(i, data) _GMP_REPEAT_FROM_212(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_214(call, data, i) call(i, data) _GMP_REPEAT_FROM_213(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_215(call, data, i) call(i, data) _GMP_REPEAT_FROM_214(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_216(call, data, i) call(i, data) _GMP_REPEAT_FROM_215(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_217(call, data, i) call(i, data) _GMP_REPEAT_FROM_216(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_218(call, data, i) call(i, data) _GMP_REPEAT_FROM_217(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_219(call, data, i) call(i, data) _GMP_REPEAT_FROM_218(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_220(call, data, i) call(i, data) _GMP_REPEAT_FROM_219(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_221(call, data, i) call(i, data) _GMP_REPEAT_FROM_220(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_222(call, data, i) call(i, data) _GMP_REPEAT_FROM_221(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_223(call, data, i) call(i, data) _GMP_REPEAT_FROM_222(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_224(call, data, i) call(i, data) _GMP_REPEAT_FROM_223(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_225(call, data, i) call(i, data) _GMP_REPEAT_FROM_224(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_226(call, data, i) call(i, data) _GMP_REPEAT_FROM_225(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_227(call, data, i) call(i, data) _GMP_REPEAT_FROM_226(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_228(call, data, i) call(i, data) _GMP_REPEAT_FROM_227(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_229(call, data, i) call(i, data) _GMP_REPEAT_FROM_228(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_230(call, data, i) call(i, data) _GMP_REPEAT_FROM_229(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_231(call, data, i) call(i, data) _GMP_REPEAT_FROM_230(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_232(call, data, i) call(i, data) _GMP_REPEAT_FROM_231(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_233(call, data, i) call(i, data) _GMP_REPEAT_FROM_232(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_234(call, data, i) call(i, data) _GMP_REPEAT_FROM_233(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_235(call, data, i) call(i, data) _GMP_REPEAT_FROM_234(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_236(call, data, i) call(i, data) _GMP_REPEAT_FROM_235(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_237(call, data, i) call(i, data) _GMP_REPEAT_FROM_236(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_238(call, data, i) call(i, data) _GMP_REPEAT_FROM_237(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_239(call, data, i) call(i, data) _GMP_REPEAT_FROM_238(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_240(call, data, i) call(i, data) _GMP_REPEAT_FROM_239(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_241(call, data, i) call(i, data) _GMP_REPEAT_FROM_240(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_242(call, data, i) call(i, data) _GMP_REPEAT_FROM_241(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_243(call, data, i) call(i, data) _GMP_REPEAT_FROM_242(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_244(call, data, i) call(i, data) _GMP_REPEAT_FROM_243(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_245(call, data, i) call(i, data) _GMP_REPEAT_FROM_244(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_246(call, data, i) call(i, data) _GMP_REPEAT_FROM_245(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_247(call, data, i) call(i, data) _GMP_REPEAT_FROM_246(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_248(call, data, i) call(i, data) _GMP_REPEAT_FROM_247(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_249(call, data, i) call(i, data) _GMP_REPEAT_FROM_248(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_250(call, data, i) call(i, data) _GMP_REPEAT_FROM_249(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_251(call, data, i) call(i, data) _GMP_REPEAT_FROM_250(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_252(call, data, i) call(i, data) _GMP_REPEAT_FROM_251(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_253(call, data, i) call(i, data) _GMP_REPEAT_FROM_252(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_254(call, data, i) call(i, data) _GMP_REPEAT_FROM_253(call, data, GMP_CONCAT(_GMP_INC_, i)())
+
+#endif // GMP_MACRO_LIMITS_REPEAT_254_HPP_
@@ -0,0 +1,140 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_REPEAT_64_HPP_
+#define GMP_MACRO_LIMITS_REPEAT_64_HPP_
+
+// GMP_REPEAT
+#define _GMP_REPEAT_0(call, data)
+#define _GMP_REPEAT_1(call, data) _GMP_REPEAT_0(call, data) call(0, data)
+#define _GMP_REPEAT_2(call, data) _GMP_REPEAT_1(call, data) call(1, data)
+#define _GMP_REPEAT_3(call, data) _GMP_REPEAT_2(call, data) call(2, data)
+#define _GMP_REPEAT_4(call, data) _GMP_REPEAT_3(call, data) call(3, data)
+#define _GMP_REPEAT_5(call, data) _GMP_REPEAT_4(call, data) call(4, data)
+#define _GMP_REPEAT_6(call, data) _GMP_REPEAT_5(call, data) call(5, data)
+#define _GMP_REPEAT_7(call, data) _GMP_REPEAT_6(call, data) call(6, data)
+#define _GMP_REPEAT_8(call, data) _GMP_REPEAT_7(call, data) call(7, data)
+#define _GMP_REPEAT_9(call, data) _GMP_REPEAT_8(call, data) call(8, data)
+#define _GMP_REPEAT_10(call, data) _GMP_REPEAT_9(call, data) call(9, data)
+#define _GMP_REPEAT_11(call, data) _GMP_REPEAT_10(call, data) call(10, data)
+#define _GMP_REPEAT_12(call, data) _GMP_REPEAT_11(call, data) call(11, data)
+#define _GMP_REPEAT_13(call, data) _GMP_REPEAT_12(call, data) call(12, data)
+#define _GMP_REPEAT_14(call, data) _GMP_REPEAT_13(call, data) call(13, data)
+#define _GMP_REPEAT_15(call, data) _GMP_REPEAT_14(call, data) call(14, data)
+#define _GMP_REPEAT_16(call, data) _GMP_REPEAT_15(call, data) call(15, data)
+#define _GMP_REPEAT_17(call, data) _GMP_REPEAT_16(call, data) call(16, data)
+#define _GMP_REPEAT_18(call, data) _GMP_REPEAT_17(call, data) call(17, data)
+#define _GMP_REPEAT_19(call, data) _GMP_REPEAT_18(call, data) call(18, data)
+#define _GMP_REPEAT_20(call, data) _GMP_REPEAT_19(call, data) call(19, data)
+#define _GMP_REPEAT_21(call, data) _GMP_REPEAT_20(call, data) call(20, data)
+#define _GMP_REPEAT_22(call, data) _GMP_REPEAT_21(call, data) call(21, data)
+#define _GMP_REPEAT_23(call, data) _GMP_REPEAT_22(call, data) call(22, data)
+#define _GMP_REPEAT_24(call, data) _GMP_REPEAT_23(call, data) call(23, data)
+#define _GMP_REPEAT_25(call, data) _GMP_REPEAT_24(call, data) call(24, data)
+#define _GMP_REPEAT_26(call, data) _GMP_REPEAT_25(call, data) call(25, data)
+#define _GMP_REPEAT_27(call, data) _GMP_REPEAT_26(call, data) call(26, data)
+#define _GMP_REPEAT_28(call, data) _GMP_REPEAT_27(call, data) call(27, data)
+#define _GMP_REPEAT_29(call, data) _GMP_REPEAT_28(call, data) call(28, data)
+#define _GMP_REPEAT_30(call, data) _GMP_REPEAT_29(call, data) call(29, data)
+#define _GMP_REPEAT_31(call, data) _GMP_REPEAT_30(call, data) call(30, data)
+#define _GMP_REPEAT_32(call, data) _GMP_REPEAT_31(call, data) call(31, data)
+#define _GMP_REPEAT_33(call, data) _GMP_REPEAT_32(call, data) call(32, data)
+#define _GMP_REPEAT_34(call, data) _GMP_REPEAT_33(call, data) call(33, data)
+#define _GMP_REPEAT_35(call, data) _GMP_REPEAT_34(call, data) call(34, data)
+#define _GMP_REPEAT_36(call, data) _GMP_REPEAT_35(call, data) call(35, data)
+#define _GMP_REPEAT_37(call, data) _GMP_REPEAT_36(call, data) call(36, data)
+#define _GMP_REPEAT_38(call, data) _GMP_REPEAT_37(call, data) call(37, data)
+#define _GMP_REPEAT_39(call, data) _GMP_REPEAT_38(call, data) call(38, data)
+#define _GMP_REPEAT_40(call, data) _GMP_REPEAT_39(call, data) call(39, data)
+#define _GMP_REPEAT_41(call, data) _GMP_REPEAT_40(call, data) call(40, data)
+#define _GMP_REPEAT_42(call, data) _GMP_REPEAT_41(call, data) call(41, data)
+#define _GMP_REPEAT_43(call, data) _GMP_REPEAT_42(call, data) call(42, data)
+#define _GMP_REPEAT_44(call, data) _GMP_REPEAT_43(call, data) call(43, data)
+#define _GMP_REPEAT_45(call, data) _GMP_REPEAT_44(call, data) call(44, data)
+#define _GMP_REPEAT_46(call, data) _GMP_REPEAT_45(call, data) call(45, data)
+#define _GMP_REPEAT_47(call, data) _GMP_REPEAT_46(call, data) call(46, data)
+#define _GMP_REPEAT_48(call, data) _GMP_REPEAT_47(call, data) call(47, data)
+#define _GMP_REPEAT_49(call, data) _GMP_REPEAT_48(call, data) call(48, data)
+#define _GMP_REPEAT_50(call, data) _GMP_REPEAT_49(call, data) call(49, data)
+#define _GMP_REPEAT_51(call, data) _GMP_REPEAT_50(call, data) call(50, data)
+#define _GMP_REPEAT_52(call, data) _GMP_REPEAT_51(call, data) call(51, data)
+#define _GMP_REPEAT_53(call, data) _GMP_REPEAT_52(call, data) call(52, data)
+#define _GMP_REPEAT_54(call, data) _GMP_REPEAT_53(call, data) call(53, data)
+#define _GMP_REPEAT_55(call, data) _GMP_REPEAT_54(call, data) call(54, data)
+#define _GMP_REPEAT_56(call, data) _GMP_REPEAT_55(call, data) call(55, data)
+#define _GMP_REPEAT_57(call, data) _GMP_REPEAT_56(call, data) call(56, data)
+#define _GMP_REPEAT_58(call, data) _GMP_REPEAT_57(call, data) call(57, data)
+#define _GMP_REPEAT_59(call, data) _GMP_REPEAT_58(call, data) call(58, data)
+#define _GMP_REPEAT_60(call, data) _GMP_REPEAT_59(call, data) call(59, data)
+#define _GMP_REPEAT_61(call, data) _GMP_REPEAT_60(call, data) call(60, data)
+#define _GMP_REPEAT_62(call, data) _GMP_REPEAT_61(call, data) call(61, data)
+#define _GMP_REPEAT_63(call, data) _GMP_REPEAT_62(call, data) call(62, data)
+#define _GMP_REPEAT_64(call, data) _GMP_REPEAT_63(call, data) call(63, data)
+
+// GMP_REPEAT_FROM
+#define _GMP_REPEAT_FROM_0(call, data, i)
+#define _GMP_REPEAT_FROM_1(call, data, i) call(i, data)
+#define _GMP_REPEAT_FROM_2(call, data, i) call(i, data) _GMP_REPEAT_FROM_1(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_3(call, data, i) call(i, data) _GMP_REPEAT_FROM_2(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_4(call, data, i) call(i, data) _GMP_REPEAT_FROM_3(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_5(call, data, i) call(i, data) _GMP_REPEAT_FROM_4(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_6(call, data, i) call(i, data) _GMP_REPEAT_FROM_5(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_7(call, data, i) call(i, data) _GMP_REPEAT_FROM_6(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_8(call, data, i) call(i, data) _GMP_REPEAT_FROM_7(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_9(call, data, i) call(i, data) _GMP_REPEAT_FROM_8(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_10(call, data, i) call(i, data) _GMP_REPEAT_FROM_9(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_11(call, data, i) call(i, data) _GMP_REPEAT_FROM_10(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_12(call, data, i) call(i, data) _GMP_REPEAT_FROM_11(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_13(call, data, i) call(i, data) _GMP_REPEAT_FROM_12(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_14(call, data, i) call(i, data) _GMP_REPEAT_FROM_13(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_15(call, data, i) call(i, data) _GMP_REPEAT_FROM_14(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_16(call, data, i) call(i, data) _GMP_REPEAT_FROM_15(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_17(call, data, i) call(i, data) _GMP_REPEAT_FROM_16(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_18(call, data, i) call(i, data) _GMP_REPEAT_FROM_17(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_19(call, data, i) call(i, data) _GMP_REPEAT_FROM_18(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_20(call, data, i) call(i, data) _GMP_REPEAT_FROM_19(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_21(call, data, i) call(i, data) _GMP_REPEAT_FROM_20(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_22(call, data, i) call(i, data) _GMP_REPEAT_FROM_21(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_23(call, data, i) call(i, data) _GMP_REPEAT_FROM_22(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_24(call, data, i) call(i, data) _GMP_REPEAT_FROM_23(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_25(call, data, i) call(i, data) _GMP_REPEAT_FROM_24(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_26(call, data, i) call(i, data) _GMP_REPEAT_FROM_25(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_27(call, data, i) call(i, data) _GMP_REPEAT_FROM_26(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_28(call, data, i) call(i, data) _GMP_REPEAT_FROM_27(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_29(call, data, i) call(i, data) _GMP_REPEAT_FROM_28(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_30(call, data, i) call(i, data) _GMP_REPEAT_FROM_29(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_31(call, data, i) call(i, data) _GMP_REPEAT_FROM_30(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_32(call, data, i) call(i, data) _GMP_REPEAT_FROM_31(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_33(call, data, i) call(i, data) _GMP_REPEAT_FROM_32(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_34(call, data, i) call(i, data) _GMP_REPEAT_FROM_33(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_35(call, data, i) call(i, data) _GMP_REPEAT_FROM_34(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_36(call, data, i) call(i, data) _GMP_REPEAT_FROM_35(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_37(call, data, i) call(i, data) _GMP_REPEAT_FROM_36(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_38(call, data, i) call(i, data) _GMP_REPEAT_FROM_37(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_39(call, data, i) call(i, data) _GMP_REPEAT_FROM_38(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_40(call, data, i) call(i, data) _GMP_REPEAT_FROM_39(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_41(call, data, i) call(i, data) _GMP_REPEAT_FROM_40(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_42(call, data, i) call(i, data) _GMP_REPEAT_FROM_41(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_43(call, data, i) call(i, data) _GMP_REPEAT_FROM_42(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_44(call, data, i) call(i, data) _GMP_REPEAT_FROM_43(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_45(call, data, i) call(i, data) _GMP_REPEAT_FROM_44(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_46(call, data, i) call(i, data) _GMP_REPEAT_FROM_45(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_47(call, data, i) call(i, data) _GMP_REPEAT_FROM_46(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_48(call, data, i) call(i, data) _GMP_REPEAT_FROM_47(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_49(call, data, i) call(i, data) _GMP_REPEAT_FROM_48(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_50(call, data, i) call(i, data) _GMP_REPEAT_FROM_49(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_51(call, data, i) call(i, data) _GMP_REPEAT_FROM_50(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_52(call, data, i) call(i, data) _GMP_REPEAT_FROM_51(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_53(call, data, i) call(i, data) _GMP_REPEAT_FROM_52(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_54(call, data, i) call(i, data) _GMP_REPEAT_FROM_53(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_55(call, data, i) call(i, data) _GMP_REPEAT_FROM_54(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_56(call, data, i) call(i, data) _GMP_REPEAT_FROM_55(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_57(call, data, i) call(i, data) _GMP_REPEAT_FROM_56(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_58(call, data, i) call(i, data) _GMP_REPEAT_FROM_57(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_59(call, data, i) call(i, data) _GMP_REPEAT_FROM_58(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_60(call, data, i) call(i, data) _GMP_REPEAT_FROM_59(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_61(call, data, i) call(i, data) _GMP_REPEAT_FROM_60(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_62(call, data, i) call(i, data) _GMP_REPEAT_FROM_61(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_63(call, data, i) call(i, data) _GMP_REPEAT_FROM_62(call, data, GMP_CONCAT(_GMP_INC_, i)())
+#define _GMP_REPEAT_FROM_64(call, data, i) call(i, data) _GMP_REPEAT_FROM_63(call, data, GMP_CONCAT(_GMP_INC_, i)())
+
+#endif // GMP_MACRO_LIMITS_REPEAT_64_HPP_
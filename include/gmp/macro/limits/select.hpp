@@ -0,0 +1,43 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_SELECT_HPP_
+#define GMP_MACRO_LIMITS_SELECT_HPP_
+
+#if GMP_MAX_INDEX == 64
+#  define _GMP_LIMIT_VARARGS_TABLES <gmp/macro/limits/varargs_64.hpp>
+#  define _GMP_LIMIT_ARITH_TABLES <gmp/macro/limits/arith_64.hpp>
+#  define _GMP_LIMIT_FOR_EACH_TABLES <gmp/macro/limits/for_each_64.hpp>
+#  define _GMP_LIMIT_FOLD_TABLES <gmp/macro/limits/fold_64.hpp>
+#  define _GMP_LIMIT_TUPLE_TABLES <gmp/macro/limits/tuple_64.hpp>
+#  define _GMP_LIMIT_LOOP_TABLES <gmp/macro/limits/loop_64.hpp>
+#  define _GMP_LIMIT_REPEAT_TABLES <gmp/macro/limits/repeat_64.hpp>
+#  define _GMP_LIMIT_LOOP_NESTED_TABLES <gmp/macro/limits/loop_nested_64.hpp>
+#  define _GMP_LIMIT_SEQ_TABLES <gmp/macro/limits/seq_1024.hpp>
+#  define _GMP_LIMIT_NUMBER_TABLES <gmp/macro/limits/number_64.hpp>
+#elif GMP_MAX_INDEX == 254
+#  define _GMP_LIMIT_VARARGS_TABLES <gmp/macro/limits/varargs_254.hpp>
+#  define _GMP_LIMIT_ARITH_TABLES <gmp/macro/limits/arith_254.hpp>
+#  define _GMP_LIMIT_FOR_EACH_TABLES <gmp/macro/limits/for_each_254.hpp>
+#  define _GMP_LIMIT_FOLD_TABLES <gmp/macro/limits/fold_254.hpp>
+#  define _GMP_LIMIT_TUPLE_TABLES <gmp/macro/limits/tuple_254.hpp>
+#  define _GMP_LIMIT_LOOP_TABLES <gmp/macro/limits/loop_254.hpp>
+#  define _GMP_LIMIT_REPEAT_TABLES <gmp/macro/limits/repeat_254.hpp>
+#  define _GMP_LIMIT_LOOP_NESTED_TABLES <gmp/macro/limits/loop_nested_254.hpp>
+#  define _GMP_LIMIT_SEQ_TABLES <gmp/macro/limits/seq_1024.hpp>
+#  define _GMP_LIMIT_NUMBER_TABLES <gmp/macro/limits/number_254.hpp>
+#elif GMP_MAX_INDEX == 1024
+#  define _GMP_LIMIT_VARARGS_TABLES <gmp/macro/limits/varargs_1024.hpp>
+#  define _GMP_LIMIT_ARITH_TABLES <gmp/macro/limits/arith_1024.hpp>
+#  define _GMP_LIMIT_FOR_EACH_TABLES <gmp/macro/limits/for_each_1024.hpp>
+#  define _GMP_LIMIT_FOLD_TABLES <gmp/macro/limits/fold_1024.hpp>
+#  define _GMP_LIMIT_TUPLE_TABLES <gmp/macro/limits/tuple_1024.hpp>
+#  define _GMP_LIMIT_LOOP_TABLES <gmp/macro/limits/loop_1024.hpp>
+#  define _GMP_LIMIT_REPEAT_TABLES <gmp/macro/limits/repeat_1024.hpp>
+#  define _GMP_LIMIT_LOOP_NESTED_TABLES <gmp/macro/limits/loop_nested_1024.hpp>
+#  define _GMP_LIMIT_SEQ_TABLES <gmp/macro/limits/seq_4096.hpp>
+#  define _GMP_LIMIT_NUMBER_TABLES <gmp/macro/limits/number_1024.hpp>
+#else
+#  error "GMP_MAX_INDEX must be one of 64, 254, 1024; see tools/generate_macro_tables.py"
+#endif
+
+#endif // GMP_MACRO_LIMITS_SELECT_HPP_
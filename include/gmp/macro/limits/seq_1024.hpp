@@ -0,0 +1,6162 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_SEQ_1024_HPP_
+#define GMP_MACRO_LIMITS_SEQ_1024_HPP_
+
+#define GMP_SEQ_MAX_SIZE 1024
+
+// GMP_SEQ_SIZE
+#define _GMP_SEQ_SIZE_0(...) _GMP_SEQ_SIZE_1
+#define _GMP_SEQ_SIZE_1(...) _GMP_SEQ_SIZE_2
+#define _GMP_SEQ_SIZE_2(...) _GMP_SEQ_SIZE_3
+#define _GMP_SEQ_SIZE_3(...) _GMP_SEQ_SIZE_4
+#define _GMP_SEQ_SIZE_4(...) _GMP_SEQ_SIZE_5
+#define _GMP_SEQ_SIZE_5(...) _GMP_SEQ_SIZE_6
+#define _GMP_SEQ_SIZE_6(...) _GMP_SEQ_SIZE_7
+#define _GMP_SEQ_SIZE_7(...) _GMP_SEQ_SIZE_8
+#define _GMP_SEQ_SIZE_8(...) _GMP_SEQ_SIZE_9
+#define _GMP_SEQ_SIZE_9(...) _GMP_SEQ_SIZE_10
+#define _GMP_SEQ_SIZE_10(...) _GMP_SEQ_SIZE_11
+#define _GMP_SEQ_SIZE_11(...) _GMP_SEQ_SIZE_12
+#define _GMP_SEQ_SIZE_12(...) _GMP_SEQ_SIZE_13
+#define _GMP_SEQ_SIZE_13(...) _GMP_SEQ_SIZE_14
+#define _GMP_SEQ_SIZE_14(...) _GMP_SEQ_SIZE_15
+#define _GMP_SEQ_SIZE_15(...) _GMP_SEQ_SIZE_16
+#define _GMP_SEQ_SIZE_16(...) _GMP_SEQ_SIZE_17
+#define _GMP_SEQ_SIZE_17(...) _GMP_SEQ_SIZE_18
+#define _GMP_SEQ_SIZE_18(...) _GMP_SEQ_SIZE_19
+#define _GMP_SEQ_SIZE_19(...) _GMP_SEQ_SIZE_20
+#define _GMP_SEQ_SIZE_20(...) _GMP_SEQ_SIZE_21
+#define _GMP_SEQ_SIZE_21(...) _GMP_SEQ_SIZE_22
+#define _GMP_SEQ_SIZE_22(...) _GMP_SEQ_SIZE_23
+#define _GMP_SEQ_SIZE_23(...) _GMP_SEQ_SIZE_24
+#define _GMP_SEQ_SIZE_24(...) _GMP_SEQ_SIZE_25
+#define _GMP_SEQ_SIZE_25(...) _GMP_SEQ_SIZE_26
+#define _GMP_SEQ_SIZE_26(...) _GMP_SEQ_SIZE_27
+#define _GMP_SEQ_SIZE_27(...) _GMP_SEQ_SIZE_28
+#define _GMP_SEQ_SIZE_28(...) _GMP_SEQ_SIZE_29
+#define _GMP_SEQ_SIZE_29(...) _GMP_SEQ_SIZE_30
+#define _GMP_SEQ_SIZE_30(...) _GMP_SEQ_SIZE_31
+#define _GMP_SEQ_SIZE_31(...) _GMP_SEQ_SIZE_32
+#define _GMP_SEQ_SIZE_32(...) _GMP_SEQ_SIZE_33
+#define _GMP_SEQ_SIZE_33(...) _GMP_SEQ_SIZE_34
+#define _GMP_SEQ_SIZE_34(...) _GMP_SEQ_SIZE_35
+#define _GMP_SEQ_SIZE_35(...) _GMP_SEQ_SIZE_36
+#define _GMP_SEQ_SIZE_36(...) _GMP_SEQ_SIZE_37
+#define _GMP_SEQ_SIZE_37(...) _GMP_SEQ_SIZE_38
+#define _GMP_SEQ_SIZE_38(...) _GMP_SEQ_SIZE_39
+#define _GMP_SEQ_SIZE_39(...) _GMP_SEQ_SIZE_40
+#define _GMP_SEQ_SIZE_40(...) _GMP_SEQ_SIZE_41
+#define _GMP_SEQ_SIZE_41(...) _GMP_SEQ_SIZE_42
+#define _GMP_SEQ_SIZE_42(...) _GMP_SEQ_SIZE_43
+#define _GMP_SEQ_SIZE_43(...) _GMP_SEQ_SIZE_44
+#define _GMP_SEQ_SIZE_44(...) _GMP_SEQ_SIZE_45
+#define _GMP_SEQ_SIZE_45(...) _GMP_SEQ_SIZE_46
+#define _GMP_SEQ_SIZE_46(...) _GMP_SEQ_SIZE_47
+#define _GMP_SEQ_SIZE_47(...) _GMP_SEQ_SIZE_48
+#define _GMP_SEQ_SIZE_48(...) _GMP_SEQ_SIZE_49
+#define _GMP_SEQ_SIZE_49(...) _GMP_SEQ_SIZE_50
+#define _GMP_SEQ_SIZE_50(...) _GMP_SEQ_SIZE_51
+#define _GMP_SEQ_SIZE_51(...) _GMP_SEQ_SIZE_52
+#define _GMP_SEQ_SIZE_52(...) _GMP_SEQ_SIZE_53
+#define _GMP_SEQ_SIZE_53(...) _GMP_SEQ_SIZE_54
+#define _GMP_SEQ_SIZE_54(...) _GMP_SEQ_SIZE_55
+#define _GMP_SEQ_SIZE_55(...) _GMP_SEQ_SIZE_56
+#define _GMP_SEQ_SIZE_56(...) _GMP_SEQ_SIZE_57
+#define _GMP_SEQ_SIZE_57(...) _GMP_SEQ_SIZE_58
+#define _GMP_SEQ_SIZE_58(...) _GMP_SEQ_SIZE_59
+#define _GMP_SEQ_SIZE_59(...) _GMP_SEQ_SIZE_60
+#define _GMP_SEQ_SIZE_60(...) _GMP_SEQ_SIZE_61
+#define _GMP_SEQ_SIZE_61(...) _GMP_SEQ_SIZE_62
+#define _GMP_SEQ_SIZE_62(...) _GMP_SEQ_SIZE_63
+#define _GMP_SEQ_SIZE_63(...) _GMP_SEQ_SIZE_64
+#define _GMP_SEQ_SIZE_64(...) _GMP_SEQ_SIZE_65
+#define _GMP_SEQ_SIZE_65(...) _GMP_SEQ_SIZE_66
+#define _GMP_SEQ_SIZE_66(...) _GMP_SEQ_SIZE_67
+#define _GMP_SEQ_SIZE_67(...) _GMP_SEQ_SIZE_68
+#define _GMP_SEQ_SIZE_68(...) _GMP_SEQ_SIZE_69
+#define _GMP_SEQ_SIZE_69(...) _GMP_SEQ_SIZE_70
+#define _GMP_SEQ_SIZE_70(...) _GMP_SEQ_SIZE_71
+#define _GMP_SEQ_SIZE_71(...) _GMP_SEQ_SIZE_72
+#define _GMP_SEQ_SIZE_72(...) _GMP_SEQ_SIZE_73
+#define _GMP_SEQ_SIZE_73(...) _GMP_SEQ_SIZE_74
+#define _GMP_SEQ_SIZE_74(...) _GMP_SEQ_SIZE_75
+#define _GMP_SEQ_SIZE_75(...) _GMP_SEQ_SIZE_76
+#define _GMP_SEQ_SIZE_76(...) _GMP_SEQ_SIZE_77
+#define _GMP_SEQ_SIZE_77(...) _GMP_SEQ_SIZE_78
+#define _GMP_SEQ_SIZE_78(...) _GMP_SEQ_SIZE_79
+#define _GMP_SEQ_SIZE_79(...) _GMP_SEQ_SIZE_80
+#define _GMP_SEQ_SIZE_80(...) _GMP_SEQ_SIZE_81
+#define _GMP_SEQ_SIZE_81(...) _GMP_SEQ_SIZE_82
+#define _GMP_SEQ_SIZE_82(...) _GMP_SEQ_SIZE_83
+#define _GMP_SEQ_SIZE_83(...) _GMP_SEQ_SIZE_84
+#define _GMP_SEQ_SIZE_84(...) _GMP_SEQ_SIZE_85
+#define _GMP_SEQ_SIZE_85(...) _GMP_SEQ_SIZE_86
+#define _GMP_SEQ_SIZE_86(...) _GMP_SEQ_SIZE_87
+#define _GMP_SEQ_SIZE_87(...) _GMP_SEQ_SIZE_88
+#define _GMP_SEQ_SIZE_88(...) _GMP_SEQ_SIZE_89
+#define _GMP_SEQ_SIZE_89(...) _GMP_SEQ_SIZE_90
+#define _GMP_SEQ_SIZE_90(...) _GMP_SEQ_SIZE_91
+#define _GMP_SEQ_SIZE_91(...) _GMP_SEQ_SIZE_92
+#define _GMP_SEQ_SIZE_92(...) _GMP_SEQ_SIZE_93
+#define _GMP_SEQ_SIZE_93(...) _GMP_SEQ_SIZE_94
+#define _GMP_SEQ_SIZE_94(...) _GMP_SEQ_SIZE_95
+#define _GMP_SEQ_SIZE_95(...) _GMP_SEQ_SIZE_96
+#define _GMP_SEQ_SIZE_96(...) _GMP_SEQ_SIZE_97
+#define _GMP_SEQ_SIZE_97(...) _GMP_SEQ_SIZE_98
+#define _GMP_SEQ_SIZE_98(...) _GMP_SEQ_SIZE_99
+#define _GMP_SEQ_SIZE_99(...) _GMP_SEQ_SIZE_100
+#define _GMP_SEQ_SIZE_100(...) _GMP_SEQ_SIZE_101
+#define _GMP_SEQ_SIZE_101(...) _GMP_SEQ_SIZE_102
+#define _GMP_SEQ_SIZE_102(...) _GMP_SEQ_SIZE_103
+#define _GMP_SEQ_SIZE_103(...) _GMP_SEQ_SIZE_104
+#define _GMP_SEQ_SIZE_104(...) _GMP_SEQ_SIZE_105
+#define _GMP_SEQ_SIZE_105(...) _GMP_SEQ_SIZE_106
+#define _GMP_SEQ_SIZE_106(...) _GMP_SEQ_SIZE_107
+#define _GMP_SEQ_SIZE_107(...) _GMP_SEQ_SIZE_108
+#define _GMP_SEQ_SIZE_108(...) _GMP_SEQ_SIZE_109
+#define _GMP_SEQ_SIZE_109(...) _GMP_SEQ_SIZE_110
+#define _GMP_SEQ_SIZE_110(...) _GMP_SEQ_SIZE_111
+#define _GMP_SEQ_SIZE_111(...) _GMP_SEQ_SIZE_112
+#define _GMP_SEQ_SIZE_112(...) _GMP_SEQ_SIZE_113
+#define _GMP_SEQ_SIZE_113(...) _GMP_SEQ_SIZE_114
+#define _GMP_SEQ_SIZE_114(...) _GMP_SEQ_SIZE_115
+#define _GMP_SEQ_SIZE_115(...) _GMP_SEQ_SIZE_116
+#define _GMP_SEQ_SIZE_116(...) _GMP_SEQ_SIZE_117
+#define _GMP_SEQ_SIZE_117(...) _GMP_SEQ_SIZE_118
+#define _GMP_SEQ_SIZE_118(...) _GMP_SEQ_SIZE_119
+#define _GMP_SEQ_SIZE_119(...) _GMP_SEQ_SIZE_120
+#define _GMP_SEQ_SIZE_120(...) _GMP_SEQ_SIZE_121
+#define _GMP_SEQ_SIZE_121(...) _GMP_SEQ_SIZE_122
+#define _GMP_SEQ_SIZE_122(...) _GMP_SEQ_SIZE_123
+#define _GMP_SEQ_SIZE_123(...) _GMP_SEQ_SIZE_124
+#define _GMP_SEQ_SIZE_124(...) _GMP_SEQ_SIZE_125
+#define _GMP_SEQ_SIZE_125(...) _GMP_SEQ_SIZE_126
+#define _GMP_SEQ_SIZE_126(...) _GMP_SEQ_SIZE_127
+#define _GMP_SEQ_SIZE_127(...) _GMP_SEQ_SIZE_128
+#define _GMP_SEQ_SIZE_128(...) _GMP_SEQ_SIZE_129
+#define _GMP_SEQ_SIZE_129(...) _GMP_SEQ_SIZE_130
+#define _GMP_SEQ_SIZE_130(...) _GMP_SEQ_SIZE_131
+#define _GMP_SEQ_SIZE_131(...) _GMP_SEQ_SIZE_132
+#define _GMP_SEQ_SIZE_132(...) _GMP_SEQ_SIZE_133
+#define _GMP_SEQ_SIZE_133(...) _GMP_SEQ_SIZE_134
+#define _GMP_SEQ_SIZE_134(...) _GMP_SEQ_SIZE_135
+#define _GMP_SEQ_SIZE_135(...) _GMP_SEQ_SIZE_136
+#define _GMP_SEQ_SIZE_136(...) _GMP_SEQ_SIZE_137
+#define _GMP_SEQ_SIZE_137(...) _GMP_SEQ_SIZE_138
+#define _GMP_SEQ_SIZE_138(...) _GMP_SEQ_SIZE_139
+#define _GMP_SEQ_SIZE_139(...) _GMP_SEQ_SIZE_140
+#define _GMP_SEQ_SIZE_140(...) _GMP_SEQ_SIZE_141
+#define _GMP_SEQ_SIZE_141(...) _GMP_SEQ_SIZE_142
+#define _GMP_SEQ_SIZE_142(...) _GMP_SEQ_SIZE_143
+#define _GMP_SEQ_SIZE_143(...) _GMP_SEQ_SIZE_144
+#define _GMP_SEQ_SIZE_144(...) _GMP_SEQ_SIZE_145
+#define _GMP_SEQ_SIZE_145(...) _GMP_SEQ_SIZE_146
+#define _GMP_SEQ_SIZE_146(...) _GMP_SEQ_SIZE_147
+#define _GMP_SEQ_SIZE_147(...) _GMP_SEQ_SIZE_148
+#define _GMP_SEQ_SIZE_148(...) _GMP_SEQ_SIZE_149
+#define _GMP_SEQ_SIZE_149(...) _GMP_SEQ_SIZE_150
+#define _GMP_SEQ_SIZE_150(...) _GMP_SEQ_SIZE_151
+#define _GMP_SEQ_SIZE_151(...) _GMP_SEQ_SIZE_152
+#define _GMP_SEQ_SIZE_152(...) _GMP_SEQ_SIZE_153
+#define _GMP_SEQ_SIZE_153(...) _GMP_SEQ_SIZE_154
+#define _GMP_SEQ_SIZE_154(...) _GMP_SEQ_SIZE_155
+#define _GMP_SEQ_SIZE_155(...) _GMP_SEQ_SIZE_156
+#define _GMP_SEQ_SIZE_156(...) _GMP_SEQ_SIZE_157
+#define _GMP_SEQ_SIZE_157(...) _GMP_SEQ_SIZE_158
+#define _GMP_SEQ_SIZE_158(...) _GMP_SEQ_SIZE_159
+#define _GMP_SEQ_SIZE_159(...) _GMP_SEQ_SIZE_160
+#define _GMP_SEQ_SIZE_160(...) _GMP_SEQ_SIZE_161
+#define _GMP_SEQ_SIZE_161(...) _GMP_SEQ_SIZE_162
+#define _GMP_SEQ_SIZE_162(...) _GMP_SEQ_SIZE_163
+#define _GMP_SEQ_SIZE_163(...) _GMP_SEQ_SIZE_164
+#define _GMP_SEQ_SIZE_164(...) _GMP_SEQ_SIZE_165
+#define _GMP_SEQ_SIZE_165(...) _GMP_SEQ_SIZE_166
+#define _GMP_SEQ_SIZE_166(...) _GMP_SEQ_SIZE_167
+#define _GMP_SEQ_SIZE_167(...) _GMP_SEQ_SIZE_168
+#define _GMP_SEQ_SIZE_168(...) _GMP_SEQ_SIZE_169
+#define _GMP_SEQ_SIZE_169(...) _GMP_SEQ_SIZE_170
+#define _GMP_SEQ_SIZE_170(...) _GMP_SEQ_SIZE_171
+#define _GMP_SEQ_SIZE_171(...) _GMP_SEQ_SIZE_172
+#define _GMP_SEQ_SIZE_172(...) _GMP_SEQ_SIZE_173
+#define _GMP_SEQ_SIZE_173(...) _GMP_SEQ_SIZE_174
+#define _GMP_SEQ_SIZE_174(...) _GMP_SEQ_SIZE_175
+#define _GMP_SEQ_SIZE_175(...) _GMP_SEQ_SIZE_176
+#define _GMP_SEQ_SIZE_176(...) _GMP_SEQ_SIZE_177
+#define _GMP_SEQ_SIZE_177(...) _GMP_SEQ_SIZE_178
+#define _GMP_SEQ_SIZE_178(...) _GMP_SEQ_SIZE_179
+#define _GMP_SEQ_SIZE_179(...) _GMP_SEQ_SIZE_180
+#define _GMP_SEQ_SIZE_180(...) _GMP_SEQ_SIZE_181
+#define _GMP_SEQ_SIZE_181(...) _GMP_SEQ_SIZE_182
+#define _GMP_SEQ_SIZE_182(...) _GMP_SEQ_SIZE_183
+#define _GMP_SEQ_SIZE_183(...) _GMP_SEQ_SIZE_184
+#define _GMP_SEQ_SIZE_184(...) _GMP_SEQ_SIZE_185
+#define _GMP_SEQ_SIZE_185(...) _GMP_SEQ_SIZE_186
+#define _GMP_SEQ_SIZE_186(...) _GMP_SEQ_SIZE_187
+#define _GMP_SEQ_SIZE_187(...) _GMP_SEQ_SIZE_188
+#define _GMP_SEQ_SIZE_188(...) _GMP_SEQ_SIZE_189
+#define _GMP_SEQ_SIZE_189(...) _GMP_SEQ_SIZE_190
+#define _GMP_SEQ_SIZE_190(...) _GMP_SEQ_SIZE_191
+#define _GMP_SEQ_SIZE_191(...) _GMP_SEQ_SIZE_192
+#define _GMP_SEQ_SIZE_192(...) _GMP_SEQ_SIZE_193
+#define _GMP_SEQ_SIZE_193(...) _GMP_SEQ_SIZE_194
+#define _GMP_SEQ_SIZE_194(...) _GMP_SEQ_SIZE_195
+#define _GMP_SEQ_SIZE_195(...) _GMP_SEQ_SIZE_196
+#define _GMP_SEQ_SIZE_196(...) _GMP_SEQ_SIZE_197
+#define _GMP_SEQ_SIZE_197(...) _GMP_SEQ_SIZE_198
+#define _GMP_SEQ_SIZE_198(...) _GMP_SEQ_SIZE_199
+#define _GMP_SEQ_SIZE_199(...) _GMP_SEQ_SIZE_200
+#define _GMP_SEQ_SIZE_200(...) _GMP_SEQ_SIZE_201
+#define _GMP_SEQ_SIZE_201(...) _GMP_SEQ_SIZE_202
+#define _GMP_SEQ_SIZE_202(...) _GMP_SEQ_SIZE_203
+#define _GMP_SEQ_SIZE_203(...) _GMP_SEQ_SIZE_204
+#define _GMP_SEQ_SIZE_204(...) _GMP_SEQ_SIZE_205
+#define _GMP_SEQ_SIZE_205(...) _GMP_SEQ_SIZE_206
+#define _GMP_SEQ_SIZE_206(...) _GMP_SEQ_SIZE_207
+#define _GMP_SEQ_SIZE_207(...) _GMP_SEQ_SIZE_208
+#define _GMP_SEQ_SIZE_208(...) _GMP_SEQ_SIZE_209
+#define _GMP_SEQ_SIZE_209(...) _GMP_SEQ_SIZE_210
+#define _GMP_SEQ_SIZE_210(...) _GMP_SEQ_SIZE_211
+#define _GMP_SEQ_SIZE_211(...) _GMP_SEQ_SIZE_212
+#define _GMP_SEQ_SIZE_212(...) _GMP_SEQ_SIZE_213
+#define _GMP_SEQ_SIZE_213(...) _GMP_SEQ_SIZE_214
+#define _GMP_SEQ_SIZE_214(...) _GMP_SEQ_SIZE_215
+#define _GMP_SEQ_SIZE_215(...) _GMP_SEQ_SIZE_216
+#define _GMP_SEQ_SIZE_216(...) _GMP_SEQ_SIZE_217
+#define _GMP_SEQ_SIZE_217(...) _GMP_SEQ_SIZE_218
+#define _GMP_SEQ_SIZE_218(...) _GMP_SEQ_SIZE_219
+#define _GMP_SEQ_SIZE_219(...) _GMP_SEQ_SIZE_220
+#define _GMP_SEQ_SIZE_220(...) _GMP_SEQ_SIZE_221
+#define _GMP_SEQ_SIZE_221(...) _GMP_SEQ_SIZE_222
+#define _GMP_SEQ_SIZE_222(...) _GMP_SEQ_SIZE_223
+#define _GMP_SEQ_SIZE_223(...) _GMP_SEQ_SIZE_224
+#define _GMP_SEQ_SIZE_224(...) _GMP_SEQ_SIZE_225
+#define _GMP_SEQ_SIZE_225(...) _GMP_SEQ_SIZE_226
+#define _GMP_SEQ_SIZE_226(...) _GMP_SEQ_SIZE_227
+#define _GMP_SEQ_SIZE_227(...) _GMP_SEQ_SIZE_228
+#define _GMP_SEQ_SIZE_228(...) _GMP_SEQ_SIZE_229
+#define _GMP_SEQ_SIZE_229(...) _GMP_SEQ_SIZE_230
+#define _GMP_SEQ_SIZE_230(...) _GMP_SEQ_SIZE_231
+#define _GMP_SEQ_SIZE_231(...) _GMP_SEQ_SIZE_232
+#define _GMP_SEQ_SIZE_232(...) _GMP_SEQ_SIZE_233
+#define _GMP_SEQ_SIZE_233(...) _GMP_SEQ_SIZE_234
+#define _GMP_SEQ_SIZE_234(...) _GMP_SEQ_SIZE_235
+#define _GMP_SEQ_SIZE_235(...) _GMP_SEQ_SIZE_236
+#define _GMP_SEQ_SIZE_236(...) _GMP_SEQ_SIZE_237
+#define _GMP_SEQ_SIZE_237(...) _GMP_SEQ_SIZE_238
+#define _GMP_SEQ_SIZE_238(...) _GMP_SEQ_SIZE_239
+#define _GMP_SEQ_SIZE_239(...) _GMP_SEQ_SIZE_240
+#define _GMP_SEQ_SIZE_240(...) _GMP_SEQ_SIZE_241
+#define _GMP_SEQ_SIZE_241(...) _GMP_SEQ_SIZE_242
+#define _GMP_SEQ_SIZE_242(...) _GMP_SEQ_SIZE_243
+#define _GMP_SEQ_SIZE_243(...) _GMP_SEQ_SIZE_244
+#define _GMP_SEQ_SIZE_244(...) _GMP_SEQ_SIZE_245
+#define _GMP_SEQ_SIZE_245(...) _GMP_SEQ_SIZE_246
+#define _GMP_SEQ_SIZE_246(...) _GMP_SEQ_SIZE_247
+#define _GMP_SEQ_SIZE_247(...) _GMP_SEQ_SIZE_248
+#define _GMP_SEQ_SIZE_248(...) _GMP_SEQ_SIZE_249
+#define _GMP_SEQ_SIZE_249(...) _GMP_SEQ_SIZE_250
+#define _GMP_SEQ_SIZE_250(...) _GMP_SEQ_SIZE_251
+#define _GMP_SEQ_SIZE_251(...) _GMP_SEQ_SIZE_252
+#define _GMP_SEQ_SIZE_252(...) _GMP_SEQ_SIZE_253
+#define _GMP_SEQ_SIZE_253(...) _GMP_SEQ_SIZE_254
+#define _GMP_SEQ_SIZE_254(...) _GMP_SEQ_SIZE_255
+#define _GMP_SEQ_SIZE_255(...) _GMP_SEQ_SIZE_256
+#define _GMP_SEQ_SIZE_256(...) _GMP_SEQ_SIZE_257
+#define _GMP_SEQ_SIZE_257(...) _GMP_SEQ_SIZE_258
+#define _GMP_SEQ_SIZE_258(...) _GMP_SEQ_SIZE_259
+#define _GMP_SEQ_SIZE_259(...) _GMP_SEQ_SIZE_260
+#define _GMP_SEQ_SIZE_260(...) _GMP_SEQ_SIZE_261
+#define _GMP_SEQ_SIZE_261(...) _GMP_SEQ_SIZE_262
+#define _GMP_SEQ_SIZE_262(...) _GMP_SEQ_SIZE_263
+#define _GMP_SEQ_SIZE_263(...) _GMP_SEQ_SIZE_264
+#define _GMP_SEQ_SIZE_264(...) _GMP_SEQ_SIZE_265
+#define _GMP_SEQ_SIZE_265(...) _GMP_SEQ_SIZE_266
+#define _GMP_SEQ_SIZE_266(...) _GMP_SEQ_SIZE_267
+#define _GMP_SEQ_SIZE_267(...) _GMP_SEQ_SIZE_268
+#define _GMP_SEQ_SIZE_268(...) _GMP_SEQ_SIZE_269
+#define _GMP_SEQ_SIZE_269(...) _GMP_SEQ_SIZE_270
+#define _GMP_SEQ_SIZE_270(...) _GMP_SEQ_SIZE_271
+#define _GMP_SEQ_SIZE_271(...) _GMP_SEQ_SIZE_272
+#define _GMP_SEQ_SIZE_272(...) _GMP_SEQ_SIZE_273
+#define _GMP_SEQ_SIZE_273(...) _GMP_SEQ_SIZE_274
+#define _GMP_SEQ_SIZE_274(...) _GMP_SEQ_SIZE_275
+#define _GMP_SEQ_SIZE_275(...) _GMP_SEQ_SIZE_276
+#define _GMP_SEQ_SIZE_276(...) _GMP_SEQ_SIZE_277
+#define _GMP_SEQ_SIZE_277(...) _GMP_SEQ_SIZE_278
+#define _GMP_SEQ_SIZE_278(...) _GMP_SEQ_SIZE_279
+#define _GMP_SEQ_SIZE_279(...) _GMP_SEQ_SIZE_280
+#define _GMP_SEQ_SIZE_280(...) _GMP_SEQ_SIZE_281
+#define _GMP_SEQ_SIZE_281(...) _GMP_SEQ_SIZE_282
+#define _GMP_SEQ_SIZE_282(...) _GMP_SEQ_SIZE_283
+#define _GMP_SEQ_SIZE_283(...) _GMP_SEQ_SIZE_284
+#define _GMP_SEQ_SIZE_284(...) _GMP_SEQ_SIZE_285
+#define _GMP_SEQ_SIZE_285(...) _GMP_SEQ_SIZE_286
+#define _GMP_SEQ_SIZE_286(...) _GMP_SEQ_SIZE_287
+#define _GMP_SEQ_SIZE_287(...) _GMP_SEQ_SIZE_288
+#define _GMP_SEQ_SIZE_288(...) _GMP_SEQ_SIZE_289
+#define _GMP_SEQ_SIZE_289(...) _GMP_SEQ_SIZE_290
+#define _GMP_SEQ_SIZE_290(...) _GMP_SEQ_SIZE_291
+#define _GMP_SEQ_SIZE_291(...) _GMP_SEQ_SIZE_292
+#define _GMP_SEQ_SIZE_292(...) _GMP_SEQ_SIZE_293
+#define _GMP_SEQ_SIZE_293(...) _GMP_SEQ_SIZE_294
+#define _GMP_SEQ_SIZE_294(...) _GMP_SEQ_SIZE_295
+#define _GMP_SEQ_SIZE_295(...) _GMP_SEQ_SIZE_296
+#define _GMP_SEQ_SIZE_296(...) _GMP_SEQ_SIZE_297
+#define _GMP_SEQ_SIZE_297(...) _GMP_SEQ_SIZE_298
+#define _GMP_SEQ_SIZE_298(...) _GMP_SEQ_SIZE_299
+#define _GMP_SEQ_SIZE_299(...) _GMP_SEQ_SIZE_300
+#define _GMP_SEQ_SIZE_300(...) _GMP_SEQ_SIZE_301
+#define _GMP_SEQ_SIZE_301(...) _GMP_SEQ_SIZE_302
+#define _GMP_SEQ_SIZE_302(...) _GMP_SEQ_SIZE_303
+#define _GMP_SEQ_SIZE_303(...) _GMP_SEQ_SIZE_304
+#define _GMP_SEQ_SIZE_304(...) _GMP_SEQ_SIZE_305
+#define _GMP_SEQ_SIZE_305(...) _GMP_SEQ_SIZE_306
+#define _GMP_SEQ_SIZE_306(...) _GMP_SEQ_SIZE_307
+#define _GMP_SEQ_SIZE_307(...) _GMP_SEQ_SIZE_308
+#define _GMP_SEQ_SIZE_308(...) _GMP_SEQ_SIZE_309
+#define _GMP_SEQ_SIZE_309(...) _GMP_SEQ_SIZE_310
+#define _GMP_SEQ_SIZE_310(...) _GMP_SEQ_SIZE_311
+#define _GMP_SEQ_SIZE_311(...) _GMP_SEQ_SIZE_312
+#define _GMP_SEQ_SIZE_312(...) _GMP_SEQ_SIZE_313
+#define _GMP_SEQ_SIZE_313(...) _GMP_SEQ_SIZE_314
+#define _GMP_SEQ_SIZE_314(...) _GMP_SEQ_SIZE_315
+#define _GMP_SEQ_SIZE_315(...) _GMP_SEQ_SIZE_316
+#define _GMP_SEQ_SIZE_316(...) _GMP_SEQ_SIZE_317
+#define _GMP_SEQ_SIZE_317(...) _GMP_SEQ_SIZE_318
+#define _GMP_SEQ_SIZE_318(...) _GMP_SEQ_SIZE_319
+#define _GMP_SEQ_SIZE_319(...) _GMP_SEQ_SIZE_320
+#define _GMP_SEQ_SIZE_320(...) _GMP_SEQ_SIZE_321
+#define _GMP_SEQ_SIZE_321(...) _GMP_SEQ_SIZE_322
+#define _GMP_SEQ_SIZE_322(...) _GMP_SEQ_SIZE_323
+#define _GMP_SEQ_SIZE_323(...) _GMP_SEQ_SIZE_324
+#define _GMP_SEQ_SIZE_324(...) _GMP_SEQ_SIZE_325
+#define _GMP_SEQ_SIZE_325(...) _GMP_SEQ_SIZE_326
+#define _GMP_SEQ_SIZE_326(...) _GMP_SEQ_SIZE_327
+#define _GMP_SEQ_SIZE_327(...) _GMP_SEQ_SIZE_328
+#define _GMP_SEQ_SIZE_328(...) _GMP_SEQ_SIZE_329
+#define _GMP_SEQ_SIZE_329(...) _GMP_SEQ_SIZE_330
+#define _GMP_SEQ_SIZE_330(...) _GMP_SEQ_SIZE_331
+#define _GMP_SEQ_SIZE_331(...) _GMP_SEQ_SIZE_332
+#define _GMP_SEQ_SIZE_332(...) _GMP_SEQ_SIZE_333
+#define _GMP_SEQ_SIZE_333(...) _GMP_SEQ_SIZE_334
+#define _GMP_SEQ_SIZE_334(...) _GMP_SEQ_SIZE_335
+#define _GMP_SEQ_SIZE_335(...) _GMP_SEQ_SIZE_336
+#define _GMP_SEQ_SIZE_336(...) _GMP_SEQ_SIZE_337
+#define _GMP_SEQ_SIZE_337(...) _GMP_SEQ_SIZE_338
+#define _GMP_SEQ_SIZE_338(...) _GMP_SEQ_SIZE_339
+#define _GMP_SEQ_SIZE_339(...) _GMP_SEQ_SIZE_340
+#define _GMP_SEQ_SIZE_340(...) _GMP_SEQ_SIZE_341
+#define _GMP_SEQ_SIZE_341(...) _GMP_SEQ_SIZE_342
+#define _GMP_SEQ_SIZE_342(...) _GMP_SEQ_SIZE_343
+#define _GMP_SEQ_SIZE_343(...) _GMP_SEQ_SIZE_344
+#define _GMP_SEQ_SIZE_344(...) _GMP_SEQ_SIZE_345
+#define _GMP_SEQ_SIZE_345(...) _GMP_SEQ_SIZE_346
+#define _GMP_SEQ_SIZE_346(...) _GMP_SEQ_SIZE_347
+#define _GMP_SEQ_SIZE_347(...) _GMP_SEQ_SIZE_348
+#define _GMP_SEQ_SIZE_348(...) _GMP_SEQ_SIZE_349
+#define _GMP_SEQ_SIZE_349(...) _GMP_SEQ_SIZE_350
+#define _GMP_SEQ_SIZE_350(...) _GMP_SEQ_SIZE_351
+#define _GMP_SEQ_SIZE_351(...) _GMP_SEQ_SIZE_352
+#define _GMP_SEQ_SIZE_352(...) _GMP_SEQ_SIZE_353
+#define _GMP_SEQ_SIZE_353(...) _GMP_SEQ_SIZE_354
+#define _GMP_SEQ_SIZE_354(...) _GMP_SEQ_SIZE_355
+#define _GMP_SEQ_SIZE_355(...) _GMP_SEQ_SIZE_356
+#define _GMP_SEQ_SIZE_356(...) _GMP_SEQ_SIZE_357
+#define _GMP_SEQ_SIZE_357(...) _GMP_SEQ_SIZE_358
+#define _GMP_SEQ_SIZE_358(...) _GMP_SEQ_SIZE_359
+#define _GMP_SEQ_SIZE_359(...) _GMP_SEQ_SIZE_360
+#define _GMP_SEQ_SIZE_360(...) _GMP_SEQ_SIZE_361
+#define _GMP_SEQ_SIZE_361(...) _GMP_SEQ_SIZE_362
+#define _GMP_SEQ_SIZE_362(...) _GMP_SEQ_SIZE_363
+#define _GMP_SEQ_SIZE_363(...) _GMP_SEQ_SIZE_364
+#define _GMP_SEQ_SIZE_364(...) _GMP_SEQ_SIZE_365
+#define _GMP_SEQ_SIZE_365(...) _GMP_SEQ_SIZE_366
+#define _GMP_SEQ_SIZE_366(...) _GMP_SEQ_SIZE_367
+#define _GMP_SEQ_SIZE_367(...) _GMP_SEQ_SIZE_368
+#define _GMP_SEQ_SIZE_368(...) _GMP_SEQ_SIZE_369
+#define _GMP_SEQ_SIZE_369(...) _GMP_SEQ_SIZE_370
+#define _GMP_SEQ_SIZE_370(...) _GMP_SEQ_SIZE_371
+#define _GMP_SEQ_SIZE_371(...) _GMP_SEQ_SIZE_372
+#define _GMP_SEQ_SIZE_372(...) _GMP_SEQ_SIZE_373
+#define _GMP_SEQ_SIZE_373(...) _GMP_SEQ_SIZE_374
+#define _GMP_SEQ_SIZE_374(...) _GMP_SEQ_SIZE_375
+#define _GMP_SEQ_SIZE_375(...) _GMP_SEQ_SIZE_376
+#define _GMP_SEQ_SIZE_376(...) _GMP_SEQ_SIZE_377
+#define _GMP_SEQ_SIZE_377(...) _GMP_SEQ_SIZE_378
+#define _GMP_SEQ_SIZE_378(...) _GMP_SEQ_SIZE_379
+#define _GMP_SEQ_SIZE_379(...) _GMP_SEQ_SIZE_380
+#define _GMP_SEQ_SIZE_380(...) _GMP_SEQ_SIZE_381
+#define _GMP_SEQ_SIZE_381(...) _GMP_SEQ_SIZE_382
+#define _GMP_SEQ_SIZE_382(...) _GMP_SEQ_SIZE_383
+#define _GMP_SEQ_SIZE_383(...) _GMP_SEQ_SIZE_384
+#define _GMP_SEQ_SIZE_384(...) _GMP_SEQ_SIZE_385
+#define _GMP_SEQ_SIZE_385(...) _GMP_SEQ_SIZE_386
+#define _GMP_SEQ_SIZE_386(...) _GMP_SEQ_SIZE_387
+#define _GMP_SEQ_SIZE_387(...) _GMP_SEQ_SIZE_388
+#define _GMP_SEQ_SIZE_388(...) _GMP_SEQ_SIZE_389
+#define _GMP_SEQ_SIZE_389(...) _GMP_SEQ_SIZE_390
+#define _GMP_SEQ_SIZE_390(...) _GMP_SEQ_SIZE_391
+#define _GMP_SEQ_SIZE_391(...) _GMP_SEQ_SIZE_392
+#define _GMP_SEQ_SIZE_392(...) _GMP_SEQ_SIZE_393
+#define _GMP_SEQ_SIZE_393(...) _GMP_SEQ_SIZE_394
+#define _GMP_SEQ_SIZE_394(...) _GMP_SEQ_SIZE_395
+#define _GMP_SEQ_SIZE_395(...) _GMP_SEQ_SIZE_396
+#define _GMP_SEQ_SIZE_396(...) _GMP_SEQ_SIZE_397
+#define _GMP_SEQ_SIZE_397(...) _GMP_SEQ_SIZE_398
+#define _GMP_SEQ_SIZE_398(...) _GMP_SEQ_SIZE_399
+#define _GMP_SEQ_SIZE_399(...) _GMP_SEQ_SIZE_400
+#define _GMP_SEQ_SIZE_400(...) _GMP_SEQ_SIZE_401
+#define _GMP_SEQ_SIZE_401(...) _GMP_SEQ_SIZE_402
+#define _GMP_SEQ_SIZE_402(...) _GMP_SEQ_SIZE_403
+#define _GMP_SEQ_SIZE_403(...) _GMP_SEQ_SIZE_404
+#define _GMP_SEQ_SIZE_404(...) _GMP_SEQ_SIZE_405
+#define _GMP_SEQ_SIZE_405(...) _GMP_SEQ_SIZE_406
+#define _GMP_SEQ_SIZE_406(...) _GMP_SEQ_SIZE_407
+#define _GMP_SEQ_SIZE_407(...) _GMP_SEQ_SIZE_408
+#define _GMP_SEQ_SIZE_408(...) _GMP_SEQ_SIZE_409
+#define _GMP_SEQ_SIZE_409(...) _GMP_SEQ_SIZE_410
+#define _GMP_SEQ_SIZE_410(...) _GMP_SEQ_SIZE_411
+#define _GMP_SEQ_SIZE_411(...) _GMP_SEQ_SIZE_412
+#define _GMP_SEQ_SIZE_412(...) _GMP_SEQ_SIZE_413
+#define _GMP_SEQ_SIZE_413(...) _GMP_SEQ_SIZE_414
+#define _GMP_SEQ_SIZE_414(...) _GMP_SEQ_SIZE_415
+#define _GMP_SEQ_SIZE_415(...) _GMP_SEQ_SIZE_416
+#define _GMP_SEQ_SIZE_416(...) _GMP_SEQ_SIZE_417
+#define _GMP_SEQ_SIZE_417(...) _GMP_SEQ_SIZE_418
+#define _GMP_SEQ_SIZE_418(...) _GMP_SEQ_SIZE_419
+#define _GMP_SEQ_SIZE_419(...) _GMP_SEQ_SIZE_420
+#define _GMP_SEQ_SIZE_420(...) _GMP_SEQ_SIZE_421
+#define _GMP_SEQ_SIZE_421(...) _GMP_SEQ_SIZE_422
+#define _GMP_SEQ_SIZE_422(...) _GMP_SEQ_SIZE_423
+#define _GMP_SEQ_SIZE_423(...) _GMP_SEQ_SIZE_424
+#define _GMP_SEQ_SIZE_424(...) _GMP_SEQ_SIZE_425
+#define _GMP_SEQ_SIZE_425(...) _GMP_SEQ_SIZE_426
+#define _GMP_SEQ_SIZE_426(...) _GMP_SEQ_SIZE_427
+#define _GMP_SEQ_SIZE_427(...) _GMP_SEQ_SIZE_428
+#define _GMP_SEQ_SIZE_428(...) _GMP_SEQ_SIZE_429
+#define _GMP_SEQ_SIZE_429(...) _GMP_SEQ_SIZE_430
+#define _GMP_SEQ_SIZE_430(...) _GMP_SEQ_SIZE_431
+#define _GMP_SEQ_SIZE_431(...) _GMP_SEQ_SIZE_432
+#define _GMP_SEQ_SIZE_432(...) _GMP_SEQ_SIZE_433
+#define _GMP_SEQ_SIZE_433(...) _GMP_SEQ_SIZE_434
+#define _GMP_SEQ_SIZE_434(...) _GMP_SEQ_SIZE_435
+#define _GMP_SEQ_SIZE_435(...) _GMP_SEQ_SIZE_436
+#define _GMP_SEQ_SIZE_436(...) _GMP_SEQ_SIZE_437
+#define _GMP_SEQ_SIZE_437(...) _GMP_SEQ_SIZE_438
+#define _GMP_SEQ_SIZE_438(...) _GMP_SEQ_SIZE_439
+#define _GMP_SEQ_SIZE_439(...) _GMP_SEQ_SIZE_440
+#define _GMP_SEQ_SIZE_440(...) _GMP_SEQ_SIZE_441
+#define _GMP_SEQ_SIZE_441(...) _GMP_SEQ_SIZE_442
+#define _GMP_SEQ_SIZE_442(...) _GMP_SEQ_SIZE_443
+#define _GMP_SEQ_SIZE_443(...) _GMP_SEQ_SIZE_444
+#define _GMP_SEQ_SIZE_444(...) _GMP_SEQ_SIZE_445
+#define _GMP_SEQ_SIZE_445(...) _GMP_SEQ_SIZE_446
+#define _GMP_SEQ_SIZE_446(...) _GMP_SEQ_SIZE_447
+#define _GMP_SEQ_SIZE_447(...) _GMP_SEQ_SIZE_448
+#define _GMP_SEQ_SIZE_448(...) _GMP_SEQ_SIZE_449
+#define _GMP_SEQ_SIZE_449(...) _GMP_SEQ_SIZE_450
+#define _GMP_SEQ_SIZE_450(...) _GMP_SEQ_SIZE_451
+#define _GMP_SEQ_SIZE_451(...) _GMP_SEQ_SIZE_452
+#define _GMP_SEQ_SIZE_452(...) _GMP_SEQ_SIZE_453
+#define _GMP_SEQ_SIZE_453(...) _GMP_SEQ_SIZE_454
+#define _GMP_SEQ_SIZE_454(...) _GMP_SEQ_SIZE_455
+#define _GMP_SEQ_SIZE_455(...) _GMP_SEQ_SIZE_456
+#define _GMP_SEQ_SIZE_456(...) _GMP_SEQ_SIZE_457
+#define _GMP_SEQ_SIZE_457(...) _GMP_SEQ_SIZE_458
+#define _GMP_SEQ_SIZE_458(...) _GMP_SEQ_SIZE_459
+#define _GMP_SEQ_SIZE_459(...) _GMP_SEQ_SIZE_460
+#define _GMP_SEQ_SIZE_460(...) _GMP_SEQ_SIZE_461
+#define _GMP_SEQ_SIZE_461(...) _GMP_SEQ_SIZE_462
+#define _GMP_SEQ_SIZE_462(...) _GMP_SEQ_SIZE_463
+#define _GMP_SEQ_SIZE_463(...) _GMP_SEQ_SIZE_464
+#define _GMP_SEQ_SIZE_464(...) _GMP_SEQ_SIZE_465
+#define _GMP_SEQ_SIZE_465(...) _GMP_SEQ_SIZE_466
+#define _GMP_SEQ_SIZE_466(...) _GMP_SEQ_SIZE_467
+#define _GMP_SEQ_SIZE_467(...) _GMP_SEQ_SIZE_468
+#define _GMP_SEQ_SIZE_468(...) _GMP_SEQ_SIZE_469
+#define _GMP_SEQ_SIZE_469(...) _GMP_SEQ_SIZE_470
+#define _GMP_SEQ_SIZE_470(...) _GMP_SEQ_SIZE_471
+#define _GMP_SEQ_SIZE_471(...) _GMP_SEQ_SIZE_472
+#define _GMP_SEQ_SIZE_472(...) _GMP_SEQ_SIZE_473
+#define _GMP_SEQ_SIZE_473(...) _GMP_SEQ_SIZE_474
+#define _GMP_SEQ_SIZE_474(...) _GMP_SEQ_SIZE_475
+#define _GMP_SEQ_SIZE_475(...) _GMP_SEQ_SIZE_476
+#define _GMP_SEQ_SIZE_476(...) _GMP_SEQ_SIZE_477
+#define _GMP_SEQ_SIZE_477(...) _GMP_SEQ_SIZE_478
+#define _GMP_SEQ_SIZE_478(...) _GMP_SEQ_SIZE_479
+#define _GMP_SEQ_SIZE_479(...) _GMP_SEQ_SIZE_480
+#define _GMP_SEQ_SIZE_480(...) _GMP_SEQ_SIZE_481
+#define _GMP_SEQ_SIZE_481(...) _GMP_SEQ_SIZE_482
+#define _GMP_SEQ_SIZE_482(...) _GMP_SEQ_SIZE_483
+#define _GMP_SEQ_SIZE_483(...) _GMP_SEQ_SIZE_484
+#define _GMP_SEQ_SIZE_484(...) _GMP_SEQ_SIZE_485
+#define _GMP_SEQ_SIZE_485(...) _GMP_SEQ_SIZE_486
+#define _GMP_SEQ_SIZE_486(...) _GMP_SEQ_SIZE_487
+#define _GMP_SEQ_SIZE_487(...) _GMP_SEQ_SIZE_488
+#define _GMP_SEQ_SIZE_488(...) _GMP_SEQ_SIZE_489
+#define _GMP_SEQ_SIZE_489(...) _GMP_SEQ_SIZE_490
+#define _GMP_SEQ_SIZE_490(...) _GMP_SEQ_SIZE_491
+#define _GMP_SEQ_SIZE_491(...) _GMP_SEQ_SIZE_492
+#define _GMP_SEQ_SIZE_492(...) _GMP_SEQ_SIZE_493
+#define _GMP_SEQ_SIZE_493(...) _GMP_SEQ_SIZE_494
+#define _GMP_SEQ_SIZE_494(...) _GMP_SEQ_SIZE_495
+#define _GMP_SEQ_SIZE_495(...) _GMP_SEQ_SIZE_496
+#define _GMP_SEQ_SIZE_496(...) _GMP_SEQ_SIZE_497
+#define _GMP_SEQ_SIZE_497(...) _GMP_SEQ_SIZE_498
+#define _GMP_SEQ_SIZE_498(...) _GMP_SEQ_SIZE_499
+#define _GMP_SEQ_SIZE_499(...) _GMP_SEQ_SIZE_500
+#define _GMP_SEQ_SIZE_500(...) _GMP_SEQ_SIZE_501
+#define _GMP_SEQ_SIZE_501(...) _GMP_SEQ_SIZE_502
+#define _GMP_SEQ_SIZE_502(...) _GMP_SEQ_SIZE_503
+#define _GMP_SEQ_SIZE_503(...) _GMP_SEQ_SIZE_504
+#define _GMP_SEQ_SIZE_504(...) _GMP_SEQ_SIZE_505
+#define _GMP_SEQ_SIZE_505(...) _GMP_SEQ_SIZE_506
+#define _GMP_SEQ_SIZE_506(...) _GMP_SEQ_SIZE_507
+#define _GMP_SEQ_SIZE_507(...) _GMP_SEQ_SIZE_508
+#define _GMP_SEQ_SIZE_508(...) _GMP_SEQ_SIZE_509
+#define _GMP_SEQ_SIZE_509(...) _GMP_SEQ_SIZE_510
+#define _GMP_SEQ_SIZE_510(...) _GMP_SEQ_SIZE_511
+#define _GMP_SEQ_SIZE_511(...) _GMP_SEQ_SIZE_512
+#define _GMP_SEQ_SIZE_512(...) _GMP_SEQ_SIZE_513
+#define _GMP_SEQ_SIZE_513(...) _GMP_SEQ_SIZE_514
+#define _GMP_SEQ_SIZE_514(...) _GMP_SEQ_SIZE_515
+#define _GMP_SEQ_SIZE_515(...) _GMP_SEQ_SIZE_516
+#define _GMP_SEQ_SIZE_516(...) _GMP_SEQ_SIZE_517
+#define _GMP_SEQ_SIZE_517(...) _GMP_SEQ_SIZE_518
+#define _GMP_SEQ_SIZE_518(...) _GMP_SEQ_SIZE_519
+#define _GMP_SEQ_SIZE_519(...) _GMP_SEQ_SIZE_520
+#define _GMP_SEQ_SIZE_520(...) _GMP_SEQ_SIZE_521
+#define _GMP_SEQ_SIZE_521(...) _GMP_SEQ_SIZE_522
+#define _GMP_SEQ_SIZE_522(...) _GMP_SEQ_SIZE_523
+#define _GMP_SEQ_SIZE_523(...) _GMP_SEQ_SIZE_524
+#define _GMP_SEQ_SIZE_524(...) _GMP_SEQ_SIZE_525
+#define _GMP_SEQ_SIZE_525(...) _GMP_SEQ_SIZE_526
+#define _GMP_SEQ_SIZE_526(...) _GMP_SEQ_SIZE_527
+#define _GMP_SEQ_SIZE_527(...) _GMP_SEQ_SIZE_528
+#define _GMP_SEQ_SIZE_528(...) _GMP_SEQ_SIZE_529
+#define _GMP_SEQ_SIZE_529(...) _GMP_SEQ_SIZE_530
+#define _GMP_SEQ_SIZE_530(...) _GMP_SEQ_SIZE_531
+#define _GMP_SEQ_SIZE_531(...) _GMP_SEQ_SIZE_532
+#define _GMP_SEQ_SIZE_532(...) _GMP_SEQ_SIZE_533
+#define _GMP_SEQ_SIZE_533(...) _GMP_SEQ_SIZE_534
+#define _GMP_SEQ_SIZE_534(...) _GMP_SEQ_SIZE_535
+#define _GMP_SEQ_SIZE_535(...) _GMP_SEQ_SIZE_536
+#define _GMP_SEQ_SIZE_536(...) _GMP_SEQ_SIZE_537
+#define _GMP_SEQ_SIZE_537(...) _GMP_SEQ_SIZE_538
+#define _GMP_SEQ_SIZE_538(...) _GMP_SEQ_SIZE_539
+#define _GMP_SEQ_SIZE_539(...) _GMP_SEQ_SIZE_540
+#define _GMP_SEQ_SIZE_540(...) _GMP_SEQ_SIZE_541
+#define _GMP_SEQ_SIZE_541(...) _GMP_SEQ_SIZE_542
+#define _GMP_SEQ_SIZE_542(...) _GMP_SEQ_SIZE_543
+#define _GMP_SEQ_SIZE_543(...) _GMP_SEQ_SIZE_544
+#define _GMP_SEQ_SIZE_544(...) _GMP_SEQ_SIZE_545
+#define _GMP_SEQ_SIZE_545(...) _GMP_SEQ_SIZE_546
+#define _GMP_SEQ_SIZE_546(...) _GMP_SEQ_SIZE_547
+#define _GMP_SEQ_SIZE_547(...) _GMP_SEQ_SIZE_548
+#define _GMP_SEQ_SIZE_548(...) _GMP_SEQ_SIZE_549
+#define _GMP_SEQ_SIZE_549(...) _GMP_SEQ_SIZE_550
+#define _GMP_SEQ_SIZE_550(...) _GMP_SEQ_SIZE_551
+#define _GMP_SEQ_SIZE_551(...) _GMP_SEQ_SIZE_552
+#define _GMP_SEQ_SIZE_552(...) _GMP_SEQ_SIZE_553
+#define _GMP_SEQ_SIZE_553(...) _GMP_SEQ_SIZE_554
+#define _GMP_SEQ_SIZE_554(...) _GMP_SEQ_SIZE_555
+#define _GMP_SEQ_SIZE_555(...) _GMP_SEQ_SIZE_556
+#define _GMP_SEQ_SIZE_556(...) _GMP_SEQ_SIZE_557
+#define _GMP_SEQ_SIZE_557(...) _GMP_SEQ_SIZE_558
+#define _GMP_SEQ_SIZE_558(...) _GMP_SEQ_SIZE_559
+#define _GMP_SEQ_SIZE_559(...) _GMP_SEQ_SIZE_560
+#define _GMP_SEQ_SIZE_560(...) _GMP_SEQ_SIZE_561
+#define _GMP_SEQ_SIZE_561(...) _GMP_SEQ_SIZE_562
+#define _GMP_SEQ_SIZE_562(...) _GMP_SEQ_SIZE_563
+#define _GMP_SEQ_SIZE_563(...) _GMP_SEQ_SIZE_564
+#define _GMP_SEQ_SIZE_564(...) _GMP_SEQ_SIZE_565
+#define _GMP_SEQ_SIZE_565(...) _GMP_SEQ_SIZE_566
+#define _GMP_SEQ_SIZE_566(...) _GMP_SEQ_SIZE_567
+#define _GMP_SEQ_SIZE_567(...) _GMP_SEQ_SIZE_568
+#define _GMP_SEQ_SIZE_568(...) _GMP_SEQ_SIZE_569
+#define _GMP_SEQ_SIZE_569(...) _GMP_SEQ_SIZE_570
+#define _GMP_SEQ_SIZE_570(...) _GMP_SEQ_SIZE_571
+#define _GMP_SEQ_SIZE_571(...) _GMP_SEQ_SIZE_572
+#define _GMP_SEQ_SIZE_572(...) _GMP_SEQ_SIZE_573
+#define _GMP_SEQ_SIZE_573(...) _GMP_SEQ_SIZE_574
+#define _GMP_SEQ_SIZE_574(...) _GMP_SEQ_SIZE_575
+#define _GMP_SEQ_SIZE_575(...) _GMP_SEQ_SIZE_576
+#define _GMP_SEQ_SIZE_576(...) _GMP_SEQ_SIZE_577
+#define _GMP_SEQ_SIZE_577(...) _GMP_SEQ_SIZE_578
+#define _GMP_SEQ_SIZE_578(...) _GMP_SEQ_SIZE_579
+#define _GMP_SEQ_SIZE_579(...) _GMP_SEQ_SIZE_580
+#define _GMP_SEQ_SIZE_580(...) _GMP_SEQ_SIZE_581
+#define _GMP_SEQ_SIZE_581(...) _GMP_SEQ_SIZE_582
+#define _GMP_SEQ_SIZE_582(...) _GMP_SEQ_SIZE_583
+#define _GMP_SEQ_SIZE_583(...) _GMP_SEQ_SIZE_584
+#define _GMP_SEQ_SIZE_584(...) _GMP_SEQ_SIZE_585
+#define _GMP_SEQ_SIZE_585(...) _GMP_SEQ_SIZE_586
+#define _GMP_SEQ_SIZE_586(...) _GMP_SEQ_SIZE_587
+#define _GMP_SEQ_SIZE_587(...) _GMP_SEQ_SIZE_588
+#define _GMP_SEQ_SIZE_588(...) _GMP_SEQ_SIZE_589
+#define _GMP_SEQ_SIZE_589(...) _GMP_SEQ_SIZE_590
+#define _GMP_SEQ_SIZE_590(...) _GMP_SEQ_SIZE_591
+#define _GMP_SEQ_SIZE_591(...) _GMP_SEQ_SIZE_592
+#define _GMP_SEQ_SIZE_592(...) _GMP_SEQ_SIZE_593
+#define _GMP_SEQ_SIZE_593(...) _GMP_SEQ_SIZE_594
+#define _GMP_SEQ_SIZE_594(...) _GMP_SEQ_SIZE_595
+#define _GMP_SEQ_SIZE_595(...) _GMP_SEQ_SIZE_596
+#define _GMP_SEQ_SIZE_596(...) _GMP_SEQ_SIZE_597
+#define _GMP_SEQ_SIZE_597(...) _GMP_SEQ_SIZE_598
+#define _GMP_SEQ_SIZE_598(...) _GMP_SEQ_SIZE_599
+#define _GMP_SEQ_SIZE_599(...) _GMP_SEQ_SIZE_600
+#define _GMP_SEQ_SIZE_600(...) _GMP_SEQ_SIZE_601
+#define _GMP_SEQ_SIZE_601(...) _GMP_SEQ_SIZE_602
+#define _GMP_SEQ_SIZE_602(...) _GMP_SEQ_SIZE_603
+#define _GMP_SEQ_SIZE_603(...) _GMP_SEQ_SIZE_604
+#define _GMP_SEQ_SIZE_604(...) _GMP_SEQ_SIZE_605
+#define _GMP_SEQ_SIZE_605(...) _GMP_SEQ_SIZE_606
+#define _GMP_SEQ_SIZE_606(...) _GMP_SEQ_SIZE_607
+#define _GMP_SEQ_SIZE_607(...) _GMP_SEQ_SIZE_608
+#define _GMP_SEQ_SIZE_608(...) _GMP_SEQ_SIZE_609
+#define _GMP_SEQ_SIZE_609(...) _GMP_SEQ_SIZE_610
+#define _GMP_SEQ_SIZE_610(...) _GMP_SEQ_SIZE_611
+#define _GMP_SEQ_SIZE_611(...) _GMP_SEQ_SIZE_612
+#define _GMP_SEQ_SIZE_612(...) _GMP_SEQ_SIZE_613
+#define _GMP_SEQ_SIZE_613(...) _GMP_SEQ_SIZE_614
+#define _GMP_SEQ_SIZE_614(...) _GMP_SEQ_SIZE_615
+#define _GMP_SEQ_SIZE_615(...) _GMP_SEQ_SIZE_616
+#define _GMP_SEQ_SIZE_616(...) _GMP_SEQ_SIZE_617
+#define _GMP_SEQ_SIZE_617(...) _GMP_SEQ_SIZE_618
+#define _GMP_SEQ_SIZE_618(...) _GMP_SEQ_SIZE_619
+#define _GMP_SEQ_SIZE_619(...) _GMP_SEQ_SIZE_620
+#define _GMP_SEQ_SIZE_620(...) _GMP_SEQ_SIZE_621
+#define _GMP_SEQ_SIZE_621(...) _GMP_SEQ_SIZE_622
+#define _GMP_SEQ_SIZE_622(...) _GMP_SEQ_SIZE_623
+#define _GMP_SEQ_SIZE_623(...) _GMP_SEQ_SIZE_624
+#define _GMP_SEQ_SIZE_624(...) _GMP_SEQ_SIZE_625
+#define _GMP_SEQ_SIZE_625(...) _GMP_SEQ_SIZE_626
+#define _GMP_SEQ_SIZE_626(...) _GMP_SEQ_SIZE_627
+#define _GMP_SEQ_SIZE_627(...) _GMP_SEQ_SIZE_628
+#define _GMP_SEQ_SIZE_628(...) _GMP_SEQ_SIZE_629
+#define _GMP_SEQ_SIZE_629(...) _GMP_SEQ_SIZE_630
+#define _GMP_SEQ_SIZE_630(...) _GMP_SEQ_SIZE_631
+#define _GMP_SEQ_SIZE_631(...) _GMP_SEQ_SIZE_632
+#define _GMP_SEQ_SIZE_632(...) _GMP_SEQ_SIZE_633
+#define _GMP_SEQ_SIZE_633(...) _GMP_SEQ_SIZE_634
+#define _GMP_SEQ_SIZE_634(...) _GMP_SEQ_SIZE_635
+#define _GMP_SEQ_SIZE_635(...) _GMP_SEQ_SIZE_636
+#define _GMP_SEQ_SIZE_636(...) _GMP_SEQ_SIZE_637
+#define _GMP_SEQ_SIZE_637(...) _GMP_SEQ_SIZE_638
+#define _GMP_SEQ_SIZE_638(...) _GMP_SEQ_SIZE_639
+#define _GMP_SEQ_SIZE_639(...) _GMP_SEQ_SIZE_640
+#define _GMP_SEQ_SIZE_640(...) _GMP_SEQ_SIZE_641
+#define _GMP_SEQ_SIZE_641(...) _GMP_SEQ_SIZE_642
+#define _GMP_SEQ_SIZE_642(...) _GMP_SEQ_SIZE_643
+#define _GMP_SEQ_SIZE_643(...) _GMP_SEQ_SIZE_644
+#define _GMP_SEQ_SIZE_644(...) _GMP_SEQ_SIZE_645
+#define _GMP_SEQ_SIZE_645(...) _GMP_SEQ_SIZE_646
+#define _GMP_SEQ_SIZE_646(...) _GMP_SEQ_SIZE_647
+#define _GMP_SEQ_SIZE_647(...) _GMP_SEQ_SIZE_648
+#define _GMP_SEQ_SIZE_648(...) _GMP_SEQ_SIZE_649
+#define _GMP_SEQ_SIZE_649(...) _GMP_SEQ_SIZE_650
+#define _GMP_SEQ_SIZE_650(...) _GMP_SEQ_SIZE_651
+#define _GMP_SEQ_SIZE_651(...) _GMP_SEQ_SIZE_652
+#define _GMP_SEQ_SIZE_652(...) _GMP_SEQ_SIZE_653
+#define _GMP_SEQ_SIZE_653(...) _GMP_SEQ_SIZE_654
+#define _GMP_SEQ_SIZE_654(...) _GMP_SEQ_SIZE_655
+#define _GMP_SEQ_SIZE_655(...) _GMP_SEQ_SIZE_656
+#define _GMP_SEQ_SIZE_656(...) _GMP_SEQ_SIZE_657
+#define _GMP_SEQ_SIZE_657(...) _GMP_SEQ_SIZE_658
+#define _GMP_SEQ_SIZE_658(...) _GMP_SEQ_SIZE_659
+#define _GMP_SEQ_SIZE_659(...) _GMP_SEQ_SIZE_660
+#define _GMP_SEQ_SIZE_660(...) _GMP_SEQ_SIZE_661
+#define _GMP_SEQ_SIZE_661(...) _GMP_SEQ_SIZE_662
+#define _GMP_SEQ_SIZE_662(...) _GMP_SEQ_SIZE_663
+#define _GMP_SEQ_SIZE_663(...) _GMP_SEQ_SIZE_664
+#define _GMP_SEQ_SIZE_664(...) _GMP_SEQ_SIZE_665
+#define _GMP_SEQ_SIZE_665(...) _GMP_SEQ_SIZE_666
+#define _GMP_SEQ_SIZE_666(...) _GMP_SEQ_SIZE_667
+#define _GMP_SEQ_SIZE_667(...) _GMP_SEQ_SIZE_668
+#define _GMP_SEQ_SIZE_668(...) _GMP_SEQ_SIZE_669
+#define _GMP_SEQ_SIZE_669(...) _GMP_SEQ_SIZE_670
+#define _GMP_SEQ_SIZE_670(...) _GMP_SEQ_SIZE_671
+#define _GMP_SEQ_SIZE_671(...) _GMP_SEQ_SIZE_672
+#define _GMP_SEQ_SIZE_672(...) _GMP_SEQ_SIZE_673
+#define _GMP_SEQ_SIZE_673(...) _GMP_SEQ_SIZE_674
+#define _GMP_SEQ_SIZE_674(...) _GMP_SEQ_SIZE_675
+#define _GMP_SEQ_SIZE_675(...) _GMP_SEQ_SIZE_676
+#define _GMP_SEQ_SIZE_676(...) _GMP_SEQ_SIZE_677
+#define _GMP_SEQ_SIZE_677(...) _GMP_SEQ_SIZE_678
+#define _GMP_SEQ_SIZE_678(...) _GMP_SEQ_SIZE_679
+#define _GMP_SEQ_SIZE_679(...) _GMP_SEQ_SIZE_680
+#define _GMP_SEQ_SIZE_680(...) _GMP_SEQ_SIZE_681
+#define _GMP_SEQ_SIZE_681(...) _GMP_SEQ_SIZE_682
+#define _GMP_SEQ_SIZE_682(...) _GMP_SEQ_SIZE_683
+#define _GMP_SEQ_SIZE_683(...) _GMP_SEQ_SIZE_684
+#define _GMP_SEQ_SIZE_684(...) _GMP_SEQ_SIZE_685
+#define _GMP_SEQ_SIZE_685(...) _GMP_SEQ_SIZE_686
+#define _GMP_SEQ_SIZE_686(...) _GMP_SEQ_SIZE_687
+#define _GMP_SEQ_SIZE_687(...) _GMP_SEQ_SIZE_688
+#define _GMP_SEQ_SIZE_688(...) _GMP_SEQ_SIZE_689
+#define _GMP_SEQ_SIZE_689(...) _GMP_SEQ_SIZE_690
+#define _GMP_SEQ_SIZE_690(...) _GMP_SEQ_SIZE_691
+#define _GMP_SEQ_SIZE_691(...) _GMP_SEQ_SIZE_692
+#define _GMP_SEQ_SIZE_692(...) _GMP_SEQ_SIZE_693
+#define _GMP_SEQ_SIZE_693(...) _GMP_SEQ_SIZE_694
+#define _GMP_SEQ_SIZE_694(...) _GMP_SEQ_SIZE_695
+#define _GMP_SEQ_SIZE_695(...) _GMP_SEQ_SIZE_696
+#define _GMP_SEQ_SIZE_696(...) _GMP_SEQ_SIZE_697
+#define _GMP_SEQ_SIZE_697(...) _GMP_SEQ_SIZE_698
+#define _GMP_SEQ_SIZE_698(...) _GMP_SEQ_SIZE_699
+#define _GMP_SEQ_SIZE_699(...) _GMP_SEQ_SIZE_700
+#define _GMP_SEQ_SIZE_700(...) _GMP_SEQ_SIZE_701
+#define _GMP_SEQ_SIZE_701(...) _GMP_SEQ_SIZE_702
+#define _GMP_SEQ_SIZE_702(...) _GMP_SEQ_SIZE_703
+#define _GMP_SEQ_SIZE_703(...) _GMP_SEQ_SIZE_704
+#define _GMP_SEQ_SIZE_704(...) _GMP_SEQ_SIZE_705
+#define _GMP_SEQ_SIZE_705(...) _GMP_SEQ_SIZE_706
+#define _GMP_SEQ_SIZE_706(...) _GMP_SEQ_SIZE_707
+#define _GMP_SEQ_SIZE_707(...) _GMP_SEQ_SIZE_708
+#define _GMP_SEQ_SIZE_708(...) _GMP_SEQ_SIZE_709
+#define _GMP_SEQ_SIZE_709(...) _GMP_SEQ_SIZE_710
+#define _GMP_SEQ_SIZE_710(...) _GMP_SEQ_SIZE_711
+#define _GMP_SEQ_SIZE_711(...) _GMP_SEQ_SIZE_712
+#define _GMP_SEQ_SIZE_712(...) _GMP_SEQ_SIZE_713
+#define _GMP_SEQ_SIZE_713(...) _GMP_SEQ_SIZE_714
+#define _GMP_SEQ_SIZE_714(...) _GMP_SEQ_SIZE_715
+#define _GMP_SEQ_SIZE_715(...) _GMP_SEQ_SIZE_716
+#define _GMP_SEQ_SIZE_716(...) _GMP_SEQ_SIZE_717
+#define _GMP_SEQ_SIZE_717(...) _GMP_SEQ_SIZE_718
+#define _GMP_SEQ_SIZE_718(...) _GMP_SEQ_SIZE_719
+#define _GMP_SEQ_SIZE_719(...) _GMP_SEQ_SIZE_720
+#define _GMP_SEQ_SIZE_720(...) _GMP_SEQ_SIZE_721
+#define _GMP_SEQ_SIZE_721(...) _GMP_SEQ_SIZE_722
+#define _GMP_SEQ_SIZE_722(...) _GMP_SEQ_SIZE_723
+#define _GMP_SEQ_SIZE_723(...) _GMP_SEQ_SIZE_724
+#define _GMP_SEQ_SIZE_724(...) _GMP_SEQ_SIZE_725
+#define _GMP_SEQ_SIZE_725(...) _GMP_SEQ_SIZE_726
+#define _GMP_SEQ_SIZE_726(...) _GMP_SEQ_SIZE_727
+#define _GMP_SEQ_SIZE_727(...) _GMP_SEQ_SIZE_728
+#define _GMP_SEQ_SIZE_728(...) _GMP_SEQ_SIZE_729
+#define _GMP_SEQ_SIZE_729(...) _GMP_SEQ_SIZE_730
+#define _GMP_SEQ_SIZE_730(...) _GMP_SEQ_SIZE_731
+#define _GMP_SEQ_SIZE_731(...) _GMP_SEQ_SIZE_732
+#define _GMP_SEQ_SIZE_732(...) _GMP_SEQ_SIZE_733
+#define _GMP_SEQ_SIZE_733(...) _GMP_SEQ_SIZE_734
+#define _GMP_SEQ_SIZE_734(...) _GMP_SEQ_SIZE_735
+#define _GMP_SEQ_SIZE_735(...) _GMP_SEQ_SIZE_736
+#define _GMP_SEQ_SIZE_736(...) _GMP_SEQ_SIZE_737
+#define _GMP_SEQ_SIZE_737(...) _GMP_SEQ_SIZE_738
+#define _GMP_SEQ_SIZE_738(...) _GMP_SEQ_SIZE_739
+#define _GMP_SEQ_SIZE_739(...) _GMP_SEQ_SIZE_740
+#define _GMP_SEQ_SIZE_740(...) _GMP_SEQ_SIZE_741
+#define _GMP_SEQ_SIZE_741(...) _GMP_SEQ_SIZE_742
+#define _GMP_SEQ_SIZE_742(...) _GMP_SEQ_SIZE_743
+#define _GMP_SEQ_SIZE_743(...) _GMP_SEQ_SIZE_744
+#define _GMP_SEQ_SIZE_744(...) _GMP_SEQ_SIZE_745
+#define _GMP_SEQ_SIZE_745(...) _GMP_SEQ_SIZE_746
+#define _GMP_SEQ_SIZE_746(...) _GMP_SEQ_SIZE_747
+#define _GMP_SEQ_SIZE_747(...) _GMP_SEQ_SIZE_748
+#define _GMP_SEQ_SIZE_748(...) _GMP_SEQ_SIZE_749
+#define _GMP_SEQ_SIZE_749(...) _GMP_SEQ_SIZE_750
+#define _GMP_SEQ_SIZE_750(...) _GMP_SEQ_SIZE_751
+#define _GMP_SEQ_SIZE_751(...) _GMP_SEQ_SIZE_752
+#define _GMP_SEQ_SIZE_752(...) _GMP_SEQ_SIZE_753
+#define _GMP_SEQ_SIZE_753(...) _GMP_SEQ_SIZE_754
+#define _GMP_SEQ_SIZE_754(...) _GMP_SEQ_SIZE_755
+#define _GMP_SEQ_SIZE_755(...) _GMP_SEQ_SIZE_756
+#define _GMP_SEQ_SIZE_756(...) _GMP_SEQ_SIZE_757
+#define _GMP_SEQ_SIZE_757(...) _GMP_SEQ_SIZE_758
+#define _GMP_SEQ_SIZE_758(...) _GMP_SEQ_SIZE_759
+#define _GMP_SEQ_SIZE_759(...) _GMP_SEQ_SIZE_760
+#define _GMP_SEQ_SIZE_760(...) _GMP_SEQ_SIZE_761
+#define _GMP_SEQ_SIZE_761(...) _GMP_SEQ_SIZE_762
+#define _GMP_SEQ_SIZE_762(...) _GMP_SEQ_SIZE_763
+#define _GMP_SEQ_SIZE_763(...) _GMP_SEQ_SIZE_764
+#define _GMP_SEQ_SIZE_764(...) _GMP_SEQ_SIZE_765
+#define _GMP_SEQ_SIZE_765(...) _GMP_SEQ_SIZE_766
+#define _GMP_SEQ_SIZE_766(...) _GMP_SEQ_SIZE_767
+#define _GMP_SEQ_SIZE_767(...) _GMP_SEQ_SIZE_768
+#define _GMP_SEQ_SIZE_768(...) _GMP_SEQ_SIZE_769
+#define _GMP_SEQ_SIZE_769(...) _GMP_SEQ_SIZE_770
+#define _GMP_SEQ_SIZE_770(...) _GMP_SEQ_SIZE_771
+#define _GMP_SEQ_SIZE_771(...) _GMP_SEQ_SIZE_772
+#define _GMP_SEQ_SIZE_772(...) _GMP_SEQ_SIZE_773
+#define _GMP_SEQ_SIZE_773(...) _GMP_SEQ_SIZE_774
+#define _GMP_SEQ_SIZE_774(...) _GMP_SEQ_SIZE_775
+#define _GMP_SEQ_SIZE_775(...) _GMP_SEQ_SIZE_776
+#define _GMP_SEQ_SIZE_776(...) _GMP_SEQ_SIZE_777
+#define _GMP_SEQ_SIZE_777(...) _GMP_SEQ_SIZE_778
+#define _GMP_SEQ_SIZE_778(...) _GMP_SEQ_SIZE_779
+#define _GMP_SEQ_SIZE_779(...) _GMP_SEQ_SIZE_780
+#define _GMP_SEQ_SIZE_780(...) _GMP_SEQ_SIZE_781
+#define _GMP_SEQ_SIZE_781(...) _GMP_SEQ_SIZE_782
+#define _GMP_SEQ_SIZE_782(...) _GMP_SEQ_SIZE_783
+#define _GMP_SEQ_SIZE_783(...) _GMP_SEQ_SIZE_784
+#define _GMP_SEQ_SIZE_784(...) _GMP_SEQ_SIZE_785
+#define _GMP_SEQ_SIZE_785(...) _GMP_SEQ_SIZE_786
+#define _GMP_SEQ_SIZE_786(...) _GMP_SEQ_SIZE_787
+#define _GMP_SEQ_SIZE_787(...) _GMP_SEQ_SIZE_788
+#define _GMP_SEQ_SIZE_788(...) _GMP_SEQ_SIZE_789
+#define _GMP_SEQ_SIZE_789(...) _GMP_SEQ_SIZE_790
+#define _GMP_SEQ_SIZE_790(...) _GMP_SEQ_SIZE_791
+#define _GMP_SEQ_SIZE_791(...) _GMP_SEQ_SIZE_792
+#define _GMP_SEQ_SIZE_792(...) _GMP_SEQ_SIZE_793
+#define _GMP_SEQ_SIZE_793(...) _GMP_SEQ_SIZE_794
+#define _GMP_SEQ_SIZE_794(...) _GMP_SEQ_SIZE_795
+#define _GMP_SEQ_SIZE_795(...) _GMP_SEQ_SIZE_796
+#define _GMP_SEQ_SIZE_796(...) _GMP_SEQ_SIZE_797
+#define _GMP_SEQ_SIZE_797(...) _GMP_SEQ_SIZE_798
+#define _GMP_SEQ_SIZE_798(...) _GMP_SEQ_SIZE_799
+#define _GMP_SEQ_SIZE_799(...) _GMP_SEQ_SIZE_800
+#define _GMP_SEQ_SIZE_800(...) _GMP_SEQ_SIZE_801
+#define _GMP_SEQ_SIZE_801(...) _GMP_SEQ_SIZE_802
+#define _GMP_SEQ_SIZE_802(...) _GMP_SEQ_SIZE_803
+#define _GMP_SEQ_SIZE_803(...) _GMP_SEQ_SIZE_804
+#define _GMP_SEQ_SIZE_804(...) _GMP_SEQ_SIZE_805
+#define _GMP_SEQ_SIZE_805(...) _GMP_SEQ_SIZE_806
+#define _GMP_SEQ_SIZE_806(...) _GMP_SEQ_SIZE_807
+#define _GMP_SEQ_SIZE_807(...) _GMP_SEQ_SIZE_808
+#define _GMP_SEQ_SIZE_808(...) _GMP_SEQ_SIZE_809
+#define _GMP_SEQ_SIZE_809(...) _GMP_SEQ_SIZE_810
+#define _GMP_SEQ_SIZE_810(...) _GMP_SEQ_SIZE_811
+#define _GMP_SEQ_SIZE_811(...) _GMP_SEQ_SIZE_812
+#define _GMP_SEQ_SIZE_812(...) _GMP_SEQ_SIZE_813
+#define _GMP_SEQ_SIZE_813(...) _GMP_SEQ_SIZE_814
+#define _GMP_SEQ_SIZE_814(...) _GMP_SEQ_SIZE_815
+#define _GMP_SEQ_SIZE_815(...) _GMP_SEQ_SIZE_816
+#define _GMP_SEQ_SIZE_816(...) _GMP_SEQ_SIZE_817
+#define _GMP_SEQ_SIZE_817(...) _GMP_SEQ_SIZE_818
+#define _GMP_SEQ_SIZE_818(...) _GMP_SEQ_SIZE_819
+#define _GMP_SEQ_SIZE_819(...) _GMP_SEQ_SIZE_820
+#define _GMP_SEQ_SIZE_820(...) _GMP_SEQ_SIZE_821
+#define _GMP_SEQ_SIZE_821(...) _GMP_SEQ_SIZE_822
+#define _GMP_SEQ_SIZE_822(...) _GMP_SEQ_SIZE_823
+#define _GMP_SEQ_SIZE_823(...) _GMP_SEQ_SIZE_824
+#define _GMP_SEQ_SIZE_824(...) _GMP_SEQ_SIZE_825
+#define _GMP_SEQ_SIZE_825(...) _GMP_SEQ_SIZE_826
+#define _GMP_SEQ_SIZE_826(...) _GMP_SEQ_SIZE_827
+#define _GMP_SEQ_SIZE_827(...) _GMP_SEQ_SIZE_828
+#define _GMP_SEQ_SIZE_828(...) _GMP_SEQ_SIZE_829
+#define _GMP_SEQ_SIZE_829(...) _GMP_SEQ_SIZE_830
+#define _GMP_SEQ_SIZE_830(...) _GMP_SEQ_SIZE_831
+#define _GMP_SEQ_SIZE_831(...) _GMP_SEQ_SIZE_832
+#define _GMP_SEQ_SIZE_832(...) _GMP_SEQ_SIZE_833
+#define _GMP_SEQ_SIZE_833(...) _GMP_SEQ_SIZE_834
+#define _GMP_SEQ_SIZE_834(...) _GMP_SEQ_SIZE_835
+#define _GMP_SEQ_SIZE_835(...) _GMP_SEQ_SIZE_836
+#define _GMP_SEQ_SIZE_836(...) _GMP_SEQ_SIZE_837
+#define _GMP_SEQ_SIZE_837(...) _GMP_SEQ_SIZE_838
+#define _GMP_SEQ_SIZE_838(...) _GMP_SEQ_SIZE_839
+#define _GMP_SEQ_SIZE_839(...) _GMP_SEQ_SIZE_840
+#define _GMP_SEQ_SIZE_840(...) _GMP_SEQ_SIZE_841
+#define _GMP_SEQ_SIZE_841(...) _GMP_SEQ_SIZE_842
+#define _GMP_SEQ_SIZE_842(...) _GMP_SEQ_SIZE_843
+#define _GMP_SEQ_SIZE_843(...) _GMP_SEQ_SIZE_844
+#define _GMP_SEQ_SIZE_844(...) _GMP_SEQ_SIZE_845
+#define _GMP_SEQ_SIZE_845(...) _GMP_SEQ_SIZE_846
+#define _GMP_SEQ_SIZE_846(...) _GMP_SEQ_SIZE_847
+#define _GMP_SEQ_SIZE_847(...) _GMP_SEQ_SIZE_848
+#define _GMP_SEQ_SIZE_848(...) _GMP_SEQ_SIZE_849
+#define _GMP_SEQ_SIZE_849(...) _GMP_SEQ_SIZE_850
+#define _GMP_SEQ_SIZE_850(...) _GMP_SEQ_SIZE_851
+#define _GMP_SEQ_SIZE_851(...) _GMP_SEQ_SIZE_852
+#define _GMP_SEQ_SIZE_852(...) _GMP_SEQ_SIZE_853
+#define _GMP_SEQ_SIZE_853(...) _GMP_SEQ_SIZE_854
+#define _GMP_SEQ_SIZE_854(...) _GMP_SEQ_SIZE_855
+#define _GMP_SEQ_SIZE_855(...) _GMP_SEQ_SIZE_856
+#define _GMP_SEQ_SIZE_856(...) _GMP_SEQ_SIZE_857
+#define _GMP_SEQ_SIZE_857(...) _GMP_SEQ_SIZE_858
+#define _GMP_SEQ_SIZE_858(...) _GMP_SEQ_SIZE_859
+#define _GMP_SEQ_SIZE_859(...) _GMP_SEQ_SIZE_860
+#define _GMP_SEQ_SIZE_860(...) _GMP_SEQ_SIZE_861
+#define _GMP_SEQ_SIZE_861(...) _GMP_SEQ_SIZE_862
+#define _GMP_SEQ_SIZE_862(...) _GMP_SEQ_SIZE_863
+#define _GMP_SEQ_SIZE_863(...) _GMP_SEQ_SIZE_864
+#define _GMP_SEQ_SIZE_864(...) _GMP_SEQ_SIZE_865
+#define _GMP_SEQ_SIZE_865(...) _GMP_SEQ_SIZE_866
+#define _GMP_SEQ_SIZE_866(...) _GMP_SEQ_SIZE_867
+#define _GMP_SEQ_SIZE_867(...) _GMP_SEQ_SIZE_868
+#define _GMP_SEQ_SIZE_868(...) _GMP_SEQ_SIZE_869
+#define _GMP_SEQ_SIZE_869(...) _GMP_SEQ_SIZE_870
+#define _GMP_SEQ_SIZE_870(...) _GMP_SEQ_SIZE_871
+#define _GMP_SEQ_SIZE_871(...) _GMP_SEQ_SIZE_872
+#define _GMP_SEQ_SIZE_872(...) _GMP_SEQ_SIZE_873
+#define _GMP_SEQ_SIZE_873(...) _GMP_SEQ_SIZE_874
+#define _GMP_SEQ_SIZE_874(...) _GMP_SEQ_SIZE_875
+#define _GMP_SEQ_SIZE_875(...) _GMP_SEQ_SIZE_876
+#define _GMP_SEQ_SIZE_876(...) _GMP_SEQ_SIZE_877
+#define _GMP_SEQ_SIZE_877(...) _GMP_SEQ_SIZE_878
+#define _GMP_SEQ_SIZE_878(...) _GMP_SEQ_SIZE_879
+#define _GMP_SEQ_SIZE_879(...) _GMP_SEQ_SIZE_880
+#define _GMP_SEQ_SIZE_880(...) _GMP_SEQ_SIZE_881
+#define _GMP_SEQ_SIZE_881(...) _GMP_SEQ_SIZE_882
+#define _GMP_SEQ_SIZE_882(...) _GMP_SEQ_SIZE_883
+#define _GMP_SEQ_SIZE_883(...) _GMP_SEQ_SIZE_884
+#define _GMP_SEQ_SIZE_884(...) _GMP_SEQ_SIZE_885
+#define _GMP_SEQ_SIZE_885(...) _GMP_SEQ_SIZE_886
+#define _GMP_SEQ_SIZE_886(...) _GMP_SEQ_SIZE_887
+#define _GMP_SEQ_SIZE_887(...) _GMP_SEQ_SIZE_888
+#define _GMP_SEQ_SIZE_888(...) _GMP_SEQ_SIZE_889
+#define _GMP_SEQ_SIZE_889(...) _GMP_SEQ_SIZE_890
+#define _GMP_SEQ_SIZE_890(...) _GMP_SEQ_SIZE_891
+#define _GMP_SEQ_SIZE_891(...) _GMP_SEQ_SIZE_892
+#define _GMP_SEQ_SIZE_892(...) _GMP_SEQ_SIZE_893
+#define _GMP_SEQ_SIZE_893(...) _GMP_SEQ_SIZE_894
+#define _GMP_SEQ_SIZE_894(...) _GMP_SEQ_SIZE_895
+#define _GMP_SEQ_SIZE_895(...) _GMP_SEQ_SIZE_896
+#define _GMP_SEQ_SIZE_896(...) _GMP_SEQ_SIZE_897
+#define _GMP_SEQ_SIZE_897(...) _GMP_SEQ_SIZE_898
+#define _GMP_SEQ_SIZE_898(...) _GMP_SEQ_SIZE_899
+#define _GMP_SEQ_SIZE_899(...) _GMP_SEQ_SIZE_900
+#define _GMP_SEQ_SIZE_900(...) _GMP_SEQ_SIZE_901
+#define _GMP_SEQ_SIZE_901(...) _GMP_SEQ_SIZE_902
+#define _GMP_SEQ_SIZE_902(...) _GMP_SEQ_SIZE_903
+#define _GMP_SEQ_SIZE_903(...) _GMP_SEQ_SIZE_904
+#define _GMP_SEQ_SIZE_904(...) _GMP_SEQ_SIZE_905
+#define _GMP_SEQ_SIZE_905(...) _GMP_SEQ_SIZE_906
+#define _GMP_SEQ_SIZE_906(...) _GMP_SEQ_SIZE_907
+#define _GMP_SEQ_SIZE_907(...) _GMP_SEQ_SIZE_908
+#define _GMP_SEQ_SIZE_908(...) _GMP_SEQ_SIZE_909
+#define _GMP_SEQ_SIZE_909(...) _GMP_SEQ_SIZE_910
+#define _GMP_SEQ_SIZE_910(...) _GMP_SEQ_SIZE_911
+#define _GMP_SEQ_SIZE_911(...) _GMP_SEQ_SIZE_912
+#define _GMP_SEQ_SIZE_912(...) _GMP_SEQ_SIZE_913
+#define _GMP_SEQ_SIZE_913(...) _GMP_SEQ_SIZE_914
+#define _GMP_SEQ_SIZE_914(...) _GMP_SEQ_SIZE_915
+#define _GMP_SEQ_SIZE_915(...) _GMP_SEQ_SIZE_916
+#define _GMP_SEQ_SIZE_916(...) _GMP_SEQ_SIZE_917
+#define _GMP_SEQ_SIZE_917(...) _GMP_SEQ_SIZE_918
+#define _GMP_SEQ_SIZE_918(...) _GMP_SEQ_SIZE_919
+#define _GMP_SEQ_SIZE_919(...) _GMP_SEQ_SIZE_920
+#define _GMP_SEQ_SIZE_920(...) _GMP_SEQ_SIZE_921
+#define _GMP_SEQ_SIZE_921(...) _GMP_SEQ_SIZE_922
+#define _GMP_SEQ_SIZE_922(...) _GMP_SEQ_SIZE_923
+#define _GMP_SEQ_SIZE_923(...) _GMP_SEQ_SIZE_924
+#define _GMP_SEQ_SIZE_924(...) _GMP_SEQ_SIZE_925
+#define _GMP_SEQ_SIZE_925(...) _GMP_SEQ_SIZE_926
+#define _GMP_SEQ_SIZE_926(...) _GMP_SEQ_SIZE_927
+#define _GMP_SEQ_SIZE_927(...) _GMP_SEQ_SIZE_928
+#define _GMP_SEQ_SIZE_928(...) _GMP_SEQ_SIZE_929
+#define _GMP_SEQ_SIZE_929(...) _GMP_SEQ_SIZE_930
+#define _GMP_SEQ_SIZE_930(...) _GMP_SEQ_SIZE_931
+#define _GMP_SEQ_SIZE_931(...) _GMP_SEQ_SIZE_932
+#define _GMP_SEQ_SIZE_932(...) _GMP_SEQ_SIZE_933
+#define _GMP_SEQ_SIZE_933(...) _GMP_SEQ_SIZE_934
+#define _GMP_SEQ_SIZE_934(...) _GMP_SEQ_SIZE_935
+#define _GMP_SEQ_SIZE_935(...) _GMP_SEQ_SIZE_936
+#define _GMP_SEQ_SIZE_936(...) _GMP_SEQ_SIZE_937
+#define _GMP_SEQ_SIZE_937(...) _GMP_SEQ_SIZE_938
+#define _GMP_SEQ_SIZE_938(...) _GMP_SEQ_SIZE_939
+#define _GMP_SEQ_SIZE_939(...) _GMP_SEQ_SIZE_940
+#define _GMP_SEQ_SIZE_940(...) _GMP_SEQ_SIZE_941
+#define _GMP_SEQ_SIZE_941(...) _GMP_SEQ_SIZE_942
+#define _GMP_SEQ_SIZE_942(...) _GMP_SEQ_SIZE_943
+#define _GMP_SEQ_SIZE_943(...) _GMP_SEQ_SIZE_944
+#define _GMP_SEQ_SIZE_944(...) _GMP_SEQ_SIZE_945
+#define _GMP_SEQ_SIZE_945(...) _GMP_SEQ_SIZE_946
+#define _GMP_SEQ_SIZE_946(...) _GMP_SEQ_SIZE_947
+#define _GMP_SEQ_SIZE_947(...) _GMP_SEQ_SIZE_948
+#define _GMP_SEQ_SIZE_948(...) _GMP_SEQ_SIZE_949
+#define _GMP_SEQ_SIZE_949(...) _GMP_SEQ_SIZE_950
+#define _GMP_SEQ_SIZE_950(...) _GMP_SEQ_SIZE_951
+#define _GMP_SEQ_SIZE_951(...) _GMP_SEQ_SIZE_952
+#define _GMP_SEQ_SIZE_952(...) _GMP_SEQ_SIZE_953
+#define _GMP_SEQ_SIZE_953(...) _GMP_SEQ_SIZE_954
+#define _GMP_SEQ_SIZE_954(...) _GMP_SEQ_SIZE_955
+#define _GMP_SEQ_SIZE_955(...) _GMP_SEQ_SIZE_956
+#define _GMP_SEQ_SIZE_956(...) _GMP_SEQ_SIZE_957
+#define _GMP_SEQ_SIZE_957(...) _GMP_SEQ_SIZE_958
+#define _GMP_SEQ_SIZE_958(...) _GMP_SEQ_SIZE_959
+#define _GMP_SEQ_SIZE_959(...) _GMP_SEQ_SIZE_960
+#define _GMP_SEQ_SIZE_960(...) _GMP_SEQ_SIZE_961
+#define _GMP_SEQ_SIZE_961(...) _GMP_SEQ_SIZE_962
+#define _GMP_SEQ_SIZE_962(...) _GMP_SEQ_SIZE_963
+#define _GMP_SEQ_SIZE_963(...) _GMP_SEQ_SIZE_964
+#define _GMP_SEQ_SIZE_964(...) _GMP_SEQ_SIZE_965
+#define _GMP_SEQ_SIZE_965(...) _GMP_SEQ_SIZE_966
+#define _GMP_SEQ_SIZE_966(...) _GMP_SEQ_SIZE_967
+#define _GMP_SEQ_SIZE_967(...) _GMP_SEQ_SIZE_968
+#define _GMP_SEQ_SIZE_968(...) _GMP_SEQ_SIZE_969
+#define _GMP_SEQ_SIZE_969(...) _GMP_SEQ_SIZE_970
+#define _GMP_SEQ_SIZE_970(...) _GMP_SEQ_SIZE_971
+#define _GMP_SEQ_SIZE_971(...) _GMP_SEQ_SIZE_972
+#define _GMP_SEQ_SIZE_972(...) _GMP_SEQ_SIZE_973
+#define _GMP_SEQ_SIZE_973(...) _GMP_SEQ_SIZE_974
+#define _GMP_SEQ_SIZE_974(...) _GMP_SEQ_SIZE_975
+#define _GMP_SEQ_SIZE_975(...) _GMP_SEQ_SIZE_976
+#define _GMP_SEQ_SIZE_976(...) _GMP_SEQ_SIZE_977
+#define _GMP_SEQ_SIZE_977(...) _GMP_SEQ_SIZE_978
+#define _GMP_SEQ_SIZE_978(...) _GMP_SEQ_SIZE_979
+#define _GMP_SEQ_SIZE_979(...) _GMP_SEQ_SIZE_980
+#define _GMP_SEQ_SIZE_980(...) _GMP_SEQ_SIZE_981
+#define _GMP_SEQ_SIZE_981(...) _GMP_SEQ_SIZE_982
+#define _GMP_SEQ_SIZE_982(...) _GMP_SEQ_SIZE_983
+#define _GMP_SEQ_SIZE_983(...) _GMP_SEQ_SIZE_984
+#define _GMP_SEQ_SIZE_984(...) _GMP_SEQ_SIZE_985
+#define _GMP_SEQ_SIZE_985(...) _GMP_SEQ_SIZE_986
+#define _GMP_SEQ_SIZE_986(...) _GMP_SEQ_SIZE_987
+#define _GMP_SEQ_SIZE_987(...) _GMP_SEQ_SIZE_988
+#define _GMP_SEQ_SIZE_988(...) _GMP_SEQ_SIZE_989
+#define _GMP_SEQ_SIZE_989(...) _GMP_SEQ_SIZE_990
+#define _GMP_SEQ_SIZE_990(...) _GMP_SEQ_SIZE_991
+#define _GMP_SEQ_SIZE_991(...) _GMP_SEQ_SIZE_992
+#define _GMP_SEQ_SIZE_992(...) _GMP_SEQ_SIZE_993
+#define _GMP_SEQ_SIZE_993(...) _GMP_SEQ_SIZE_994
+#define _GMP_SEQ_SIZE_994(...) _GMP_SEQ_SIZE_995
+#define _GMP_SEQ_SIZE_995(...) _GMP_SEQ_SIZE_996
+#define _GMP_SEQ_SIZE_996(...) _GMP_SEQ_SIZE_997
+#define _GMP_SEQ_SIZE_997(...) _GMP_SEQ_SIZE_998
+#define _GMP_SEQ_SIZE_998(...) _GMP_SEQ_SIZE_999
+#define _GMP_SEQ_SIZE_999(...) _GMP_SEQ_SIZE_1000
+#define _GMP_SEQ_SIZE_1000(...) _GMP_SEQ_SIZE_1001
+#define _GMP_SEQ_SIZE_1001(...) _GMP_SEQ_SIZE_1002
+#define _GMP_SEQ_SIZE_1002(...) _GMP_SEQ_SIZE_1003
+#define _GMP_SEQ_SIZE_1003(...) _GMP_SEQ_SIZE_1004
+#define _GMP_SEQ_SIZE_1004(...) _GMP_SEQ_SIZE_1005
+#define _GMP_SEQ_SIZE_1005(...) _GMP_SEQ_SIZE_1006
+#define _GMP_SEQ_SIZE_1006(...) _GMP_SEQ_SIZE_1007
+#define _GMP_SEQ_SIZE_1007(...) _GMP_SEQ_SIZE_1008
+#define _GMP_SEQ_SIZE_1008(...) _GMP_SEQ_SIZE_1009
+#define _GMP_SEQ_SIZE_1009(...) _GMP_SEQ_SIZE_1010
+#define _GMP_SEQ_SIZE_1010(...) _GMP_SEQ_SIZE_1011
+#define _GMP_SEQ_SIZE_1011(...) _GMP_SEQ_SIZE_1012
+#define _GMP_SEQ_SIZE_1012(...) _GMP_SEQ_SIZE_1013
+#define _GMP_SEQ_SIZE_1013(...) _GMP_SEQ_SIZE_1014
+#define _GMP_SEQ_SIZE_1014(...) _GMP_SEQ_SIZE_1015
+#define _GMP_SEQ_SIZE_1015(...) _GMP_SEQ_SIZE_1016
+#define _GMP_SEQ_SIZE_1016(...) _GMP_SEQ_SIZE_1017
+#define _GMP_SEQ_SIZE_1017(...) _GMP_SEQ_SIZE_1018
+#define _GMP_SEQ_SIZE_1018(...) _GMP_SEQ_SIZE_1019
+#define _GMP_SEQ_SIZE_1019(...) _GMP_SEQ_SIZE_1020
+#define _GMP_SEQ_SIZE_1020(...) _GMP_SEQ_SIZE_1021
+#define _GMP_SEQ_SIZE_1021(...) _GMP_SEQ_SIZE_1022
+#define _GMP_SEQ_SIZE_1022(...) _GMP_SEQ_SIZE_1023
+#define _GMP_SEQ_SIZE_1023(...) _GMP_SEQ_SIZE_1024
+#define _GMP_SEQ_SIZE_1024(...) _GMP_SEQ_SIZE_OVERFLOW_A
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_0 0
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1 1
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_2 2
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_3 3
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_4 4
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_5 5
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_6 6
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_7 7
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_8 8
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_9 9
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_10 10
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_11 11
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_12 12
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_13 13
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_14 14
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_15 15
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_16 16
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_17 17
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_18 18
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_19 19
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_20 20
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_21 21
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_22 22
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_23 23
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_24 24
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_25 25
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_26 26
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_27 27
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_28 28
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_29 29
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_30 30
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_31 31
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_32 32
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_33 33
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_34 34
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_35 35
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_36 36
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_37 37
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_38 38
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_39 39
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_40 40
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_41 41
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_42 42
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_43 43
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_44 44
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_45 45
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_46 46
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_47 47
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_48 48
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_49 49
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_50 50
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_51 51
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_52 52
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_53 53
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_54 54
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_55 55
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_56 56
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_57 57
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_58 58
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_59 59
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_60 60
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_61 61
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_62 62
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_63 63
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_64 64
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_65 65
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_66 66
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_67 67
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_68 68
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_69 69
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_70 70
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_71 71
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_72 72
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_73 73
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_74 74
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_75 75
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_76 76
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_77 77
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_78 78
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_79 79
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_80 80
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_81 81
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_82 82
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_83 83
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_84 84
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_85 85
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_86 86
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_87 87
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_88 88
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_89 89
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_90 90
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_91 91
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_92 92
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_93 93
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_94 94
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_95 95
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_96 96
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_97 97
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_98 98
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_99 99
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_100 100
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_101 101
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_102 102
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_103 103
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_104 104
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_105 105
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_106 106
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_107 107
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_108 108
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_109 109
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_110 110
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_111 111
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_112 112
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_113 113
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_114 114
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_115 115
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_116 116
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_117 117
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_118 118
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_119 119
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_120 120
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_121 121
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_122 122
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_123 123
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_124 124
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_125 125
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_126 126
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_127 127
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_128 128
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_129 129
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_130 130
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_131 131
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_132 132
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_133 133
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_134 134
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_135 135
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_136 136
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_137 137
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_138 138
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_139 139
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_140 140
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_141 141
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_142 142
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_143 143
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_144 144
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_145 145
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_146 146
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_147 147
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_148 148
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_149 149
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_150 150
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_151 151
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_152 152
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_153 153
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_154 154
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_155 155
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_156 156
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_157 157
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_158 158
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_159 159
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_160 160
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_161 161
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_162 162
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_163 163
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_164 164
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_165 165
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_166 166
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_167 167
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_168 168
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_169 169
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_170 170
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_171 171
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_172 172
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_173 173
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_174 174
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_175 175
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_176 176
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_177 177
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_178 178
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_179 179
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_180 180
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_181 181
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_182 182
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_183 183
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_184 184
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_185 185
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_186 186
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_187 187
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_188 188
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_189 189
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_190 190
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_191 191
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_192 192
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_193 193
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_194 194
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_195 195
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_196 196
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_197 197
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_198 198
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_199 199
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_200 200
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_201 201
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_202 202
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_203 203
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_204 204
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_205 205
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_206 206
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_207 207
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_208 208
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_209 209
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_210 210
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_211 211
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_212 212
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_213 213
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_214 214
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_215 215
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_216 216
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_217 217
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_218 218
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_219 219
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_220 220
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_221 221
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_222 222
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_223 223
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_224 224
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_225 225
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_226 226
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_227 227
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_228 228
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_229 229
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_230 230
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_231 231
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_232 232
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_233 233
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_234 234
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_235 235
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_236 236
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_237 237
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_238 238
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_239 239
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_240 240
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_241 241
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_242 242
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_243 243
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_244 244
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_245 245
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_246 246
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_247 247
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_248 248
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_249 249
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_250 250
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_251 251
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_252 252
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_253 253
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_254 254
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_255 255
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_256 256
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_257 257
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_258 258
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_259 259
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_260 260
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_261 261
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_262 262
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_263 263
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_264 264
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_265 265
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_266 266
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_267 267
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_268 268
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_269 269
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_270 270
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_271 271
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_272 272
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_273 273
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_274 274
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_275 275
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_276 276
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_277 277
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_278 278
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_279 279
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_280 280
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_281 281
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_282 282
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_283 283
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_284 284
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_285 285
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_286 286
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_287 287
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_288 288
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_289 289
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_290 290
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_291 291
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_292 292
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_293 293
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_294 294
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_295 295
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_296 296
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_297 297
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_298 298
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_299 299
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_300 300
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_301 301
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_302 302
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_303 303
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_304 304
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_305 305
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_306 306
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_307 307
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_308 308
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_309 309
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_310 310
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_311 311
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_312 312
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_313 313
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_314 314
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_315 315
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_316 316
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_317 317
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_318 318
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_319 319
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_320 320
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_321 321
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_322 322
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_323 323
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_324 324
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_325 325
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_326 326
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_327 327
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_328 328
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_329 329
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_330 330
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_331 331
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_332 332
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_333 333
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_334 334
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_335 335
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_336 336
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_337 337
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_338 338
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_339 339
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_340 340
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_341 341
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_342 342
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_343 343
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_344 344
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_345 345
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_346 346
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_347 347
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_348 348
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_349 349
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_350 350
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_351 351
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_352 352
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_353 353
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_354 354
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_355 355
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_356 356
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_357 357
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_358 358
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_359 359
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_360 360
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_361 361
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_362 362
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_363 363
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_364 364
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_365 365
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_366 366
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_367 367
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_368 368
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_369 369
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_370 370
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_371 371
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_372 372
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_373 373
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_374 374
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_375 375
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_376 376
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_377 377
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_378 378
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_379 379
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_380 380
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_381 381
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_382 382
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_383 383
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_384 384
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_385 385
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_386 386
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_387 387
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_388 388
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_389 389
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_390 390
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_391 391
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_392 392
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_393 393
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_394 394
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_395 395
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_396 396
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_397 397
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_398 398
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_399 399
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_400 400
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_401 401
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_402 402
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_403 403
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_404 404
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_405 405
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_406 406
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_407 407
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_408 408
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_409 409
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_410 410
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_411 411
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_412 412
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_413 413
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_414 414
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_415 415
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_416 416
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_417 417
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_418 418
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_419 419
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_420 420
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_421 421
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_422 422
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_423 423
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_424 424
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_425 425
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_426 426
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_427 427
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_428 428
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_429 429
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_430 430
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_431 431
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_432 432
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_433 433
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_434 434
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_435 435
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_436 436
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_437 437
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_438 438
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_439 439
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_440 440
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_441 441
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_442 442
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_443 443
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_444 444
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_445 445
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_446 446
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_447 447
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_448 448
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_449 449
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_450 450
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_451 451
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_452 452
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_453 453
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_454 454
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_455 455
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_456 456
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_457 457
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_458 458
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_459 459
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_460 460
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_461 461
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_462 462
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_463 463
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_464 464
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_465 465
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_466 466
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_467 467
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_468 468
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_469 469
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_470 470
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_471 471
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_472 472
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_473 473
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_474 474
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_475 475
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_476 476
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_477 477
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_478 478
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_479 479
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_480 480
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_481 481
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_482 482
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_483 483
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_484 484
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_485 485
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_486 486
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_487 487
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_488 488
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_489 489
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_490 490
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_491 491
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_492 492
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_493 493
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_494 494
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_495 495
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_496 496
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_497 497
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_498 498
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_499 499
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_500 500
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_501 501
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_502 502
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_503 503
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_504 504
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_505 505
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_506 506
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_507 507
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_508 508
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_509 509
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_510 510
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_511 511
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_512 512
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_513 513
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_514 514
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_515 515
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_516 516
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_517 517
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_518 518
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_519 519
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_520 520
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_521 521
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_522 522
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_523 523
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_524 524
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_525 525
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_526 526
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_527 527
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_528 528
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_529 529
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_530 530
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_531 531
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_532 532
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_533 533
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_534 534
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_535 535
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_536 536
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_537 537
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_538 538
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_539 539
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_540 540
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_541 541
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_542 542
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_543 543
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_544 544
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_545 545
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_546 546
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_547 547
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_548 548
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_549 549
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_550 550
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_551 551
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_552 552
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_553 553
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_554 554
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_555 555
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_556 556
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_557 557
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_558 558
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_559 559
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_560 560
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_561 561
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_562 562
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_563 563
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_564 564
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_565 565
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_566 566
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_567 567
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_568 568
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_569 569
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_570 570
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_571 571
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_572 572
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_573 573
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_574 574
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_575 575
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_576 576
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_577 577
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_578 578
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_579 579
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_580 580
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_581 581
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_582 582
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_583 583
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_584 584
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_585 585
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_586 586
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_587 587
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_588 588
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_589 589
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_590 590
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_591 591
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_592 592
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_593 593
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_594 594
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_595 595
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_596 596
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_597 597
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_598 598
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_599 599
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_600 600
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_601 601
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_602 602
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_603 603
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_604 604
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_605 605
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_606 606
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_607 607
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_608 608
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_609 609
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_610 610
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_611 611
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_612 612
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_613 613
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_614 614
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_615 615
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_616 616
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_617 617
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_618 618
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_619 619
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_620 620
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_621 621
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_622 622
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_623 623
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_624 624
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_625 625
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_626 626
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_627 627
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_628 628
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_629 629
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_630 630
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_631 631
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_632 632
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_633 633
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_634 634
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_635 635
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_636 636
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_637 637
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_638 638
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_639 639
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_640 640
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_641 641
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_642 642
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_643 643
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_644 644
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_645 645
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_646 646
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_647 647
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_648 648
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_649 649
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_650 650
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_651 651
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_652 652
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_653 653
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_654 654
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_655 655
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_656 656
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_657 657
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_658 658
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_659 659
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_660 660
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_661 661
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_662 662
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_663 663
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_664 664
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_665 665
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_666 666
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_667 667
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_668 668
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_669 669
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_670 670
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_671 671
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_672 672
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_673 673
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_674 674
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_675 675
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_676 676
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_677 677
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_678 678
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_679 679
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_680 680
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_681 681
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_682 682
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_683 683
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_684 684
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_685 685
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_686 686
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_687 687
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_688 688
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_689 689
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_690 690
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_691 691
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_692 692
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_693 693
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_694 694
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_695 695
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_696 696
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_697 697
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_698 698
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_699 699
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_700 700
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_701 701
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_702 702
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_703 703
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_704 704
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_705 705
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_706 706
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_707 707
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_708 708
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_709 709
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_710 710
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_711 711
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_712 712
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_713 713
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_714 714
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_715 715
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_716 716
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_717 717
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_718 718
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_719 719
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_720 720
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_721 721
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_722 722
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_723 723
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_724 724
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_725 725
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_726 726
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_727 727
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_728 728
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_729 729
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_730 730
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_731 731
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_732 732
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_733 733
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_734 734
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_735 735
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_736 736
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_737 737
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_738 738
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_739 739
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_740 740
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_741 741
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_742 742
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_743 743
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_744 744
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_745 745
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_746 746
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_747 747
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_748 748
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_749 749
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_750 750
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_751 751
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_752 752
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_753 753
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_754 754
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_755 755
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_756 756
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_757 757
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_758 758
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_759 759
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_760 760
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_761 761
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_762 762
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_763 763
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_764 764
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_765 765
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_766 766
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_767 767
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_768 768
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_769 769
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_770 770
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_771 771
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_772 772
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_773 773
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_774 774
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_775 775
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_776 776
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_777 777
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_778 778
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_779 779
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_780 780
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_781 781
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_782 782
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_783 783
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_784 784
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_785 785
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_786 786
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_787 787
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_788 788
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_789 789
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_790 790
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_791 791
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_792 792
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_793 793
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_794 794
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_795 795
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_796 796
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_797 797
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_798 798
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_799 799
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_800 800
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_801 801
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_802 802
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_803 803
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_804 804
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_805 805
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_806 806
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_807 807
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_808 808
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_809 809
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_810 810
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_811 811
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_812 812
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_813 813
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_814 814
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_815 815
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_816 816
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_817 817
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_818 818
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_819 819
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_820 820
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_821 821
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_822 822
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_823 823
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_824 824
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_825 825
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_826 826
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_827 827
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_828 828
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_829 829
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_830 830
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_831 831
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_832 832
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_833 833
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_834 834
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_835 835
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_836 836
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_837 837
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_838 838
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_839 839
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_840 840
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_841 841
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_842 842
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_843 843
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_844 844
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_845 845
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_846 846
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_847 847
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_848 848
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_849 849
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_850 850
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_851 851
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_852 852
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_853 853
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_854 854
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_855 855
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_856 856
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_857 857
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_858 858
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_859 859
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_860 860
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_861 861
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_862 862
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_863 863
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_864 864
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_865 865
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_866 866
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_867 867
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_868 868
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_869 869
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_870 870
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_871 871
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_872 872
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_873 873
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_874 874
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_875 875
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_876 876
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_877 877
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_878 878
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_879 879
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_880 880
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_881 881
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_882 882
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_883 883
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_884 884
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_885 885
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_886 886
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_887 887
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_888 888
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_889 889
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_890 890
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_891 891
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_892 892
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_893 893
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_894 894
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_895 895
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_896 896
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_897 897
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_898 898
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_899 899
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_900 900
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_901 901
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_902 902
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_903 903
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_904 904
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_905 905
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_906 906
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_907 907
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_908 908
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_909 909
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_910 910
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_911 911
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_912 912
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_913 913
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_914 914
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_915 915
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_916 916
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_917 917
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_918 918
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_919 919
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_920 920
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_921 921
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_922 922
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_923 923
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_924 924
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_925 925
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_926 926
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_927 927
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_928 928
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_929 929
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_930 930
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_931 931
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_932 932
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_933 933
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_934 934
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_935 935
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_936 936
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_937 937
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_938 938
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_939 939
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_940 940
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_941 941
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_942 942
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_943 943
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_944 944
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_945 945
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_946 946
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_947 947
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_948 948
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_949 949
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_950 950
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_951 951
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_952 952
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_953 953
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_954 954
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_955 955
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_956 956
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_957 957
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_958 958
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_959 959
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_960 960
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_961 961
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_962 962
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_963 963
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_964 964
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_965 965
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_966 966
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_967 967
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_968 968
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_969 969
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_970 970
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_971 971
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_972 972
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_973 973
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_974 974
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_975 975
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_976 976
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_977 977
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_978 978
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_979 979
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_980 980
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_981 981
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_982 982
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_983 983
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_984 984
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_985 985
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_986 986
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_987 987
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_988 988
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_989 989
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_990 990
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_991 991
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_992 992
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_993 993
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_994 994
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_995 995
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_996 996
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_997 997
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_998 998
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_999 999
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1000 1000
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1001 1001
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1002 1002
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1003 1003
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1004 1004
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1005 1005
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1006 1006
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1007 1007
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1008 1008
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1009 1009
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1010 1010
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1011 1011
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1012 1012
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1013 1013
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1014 1014
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1015 1015
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1016 1016
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1017 1017
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1018 1018
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1019 1019
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1020 1020
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1021 1021
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1022 1022
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1023 1023
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_1024 1024
+
+// GMP_SEQ_ELEM
+#define _GMP_SEQ_ELEM_0(...) (__VA_ARGS__), _GMP_SEQ_NIL
+#define _GMP_SEQ_ELEM_1(...) _GMP_SEQ_ELEM_0
+#define _GMP_SEQ_ELEM_2(...) _GMP_SEQ_ELEM_1
+#define _GMP_SEQ_ELEM_3(...) _GMP_SEQ_ELEM_2
+#define _GMP_SEQ_ELEM_4(...) _GMP_SEQ_ELEM_3
+#define _GMP_SEQ_ELEM_5(...) _GMP_SEQ_ELEM_4
+#define _GMP_SEQ_ELEM_6(...) _GMP_SEQ_ELEM_5
+#define _GMP_SEQ_ELEM_7(...) _GMP_SEQ_ELEM_6
+#define _GMP_SEQ_ELEM_8(...) _GMP_SEQ_ELEM_7
+#define _GMP_SEQ_ELEM_9(...) _GMP_SEQ_ELEM_8
+#define _GMP_SEQ_ELEM_10(...) _GMP_SEQ_ELEM_9
+#define _GMP_SEQ_ELEM_11(...) _GMP_SEQ_ELEM_10
+#define _GMP_SEQ_ELEM_12(...) _GMP_SEQ_ELEM_11
+#define _GMP_SEQ_ELEM_13(...) _GMP_SEQ_ELEM_12
+#define _GMP_SEQ_ELEM_14(...) _GMP_SEQ_ELEM_13
+#define _GMP_SEQ_ELEM_15(...) _GMP_SEQ_ELEM_14
+#define _GMP_SEQ_ELEM_16(...) _GMP_SEQ_ELEM_15
+#define _GMP_SEQ_ELEM_17(...) _GMP_SEQ_ELEM_16
+#define _GMP_SEQ_ELEM_18(...) _GMP_SEQ_ELEM_17
+#define _GMP_SEQ_ELEM_19(...) _GMP_SEQ_ELEM_18
+#define _GMP_SEQ_ELEM_20(...) _GMP_SEQ_ELEM_19
+#define _GMP_SEQ_ELEM_21(...) _GMP_SEQ_ELEM_20
+#define _GMP_SEQ_ELEM_22(...) _GMP_SEQ_ELEM_21
+#define _GMP_SEQ_ELEM_23(...) _GMP_SEQ_ELEM_22
+#define _GMP_SEQ_ELEM_24(...) _GMP_SEQ_ELEM_23
+#define _GMP_SEQ_ELEM_25(...) _GMP_SEQ_ELEM_24
+#define _GMP_SEQ_ELEM_26(...) _GMP_SEQ_ELEM_25
+#define _GMP_SEQ_ELEM_27(...) _GMP_SEQ_ELEM_26
+#define _GMP_SEQ_ELEM_28(...) _GMP_SEQ_ELEM_27
+#define _GMP_SEQ_ELEM_29(...) _GMP_SEQ_ELEM_28
+#define _GMP_SEQ_ELEM_30(...) _GMP_SEQ_ELEM_29
+#define _GMP_SEQ_ELEM_31(...) _GMP_SEQ_ELEM_30
+#define _GMP_SEQ_ELEM_32(...) _GMP_SEQ_ELEM_31
+#define _GMP_SEQ_ELEM_33(...) _GMP_SEQ_ELEM_32
+#define _GMP_SEQ_ELEM_34(...) _GMP_SEQ_ELEM_33
+#define _GMP_SEQ_ELEM_35(...) _GMP_SEQ_ELEM_34
+#define _GMP_SEQ_ELEM_36(...) _GMP_SEQ_ELEM_35
+#define _GMP_SEQ_ELEM_37(...) _GMP_SEQ_ELEM_36
+#define _GMP_SEQ_ELEM_38(...) _GMP_SEQ_ELEM_37
+#define _GMP_SEQ_ELEM_39(...) _GMP_SEQ_ELEM_38
+#define _GMP_SEQ_ELEM_40(...) _GMP_SEQ_ELEM_39
+#define _GMP_SEQ_ELEM_41(...) _GMP_SEQ_ELEM_40
+#define _GMP_SEQ_ELEM_42(...) _GMP_SEQ_ELEM_41
+#define _GMP_SEQ_ELEM_43(...) _GMP_SEQ_ELEM_42
+#define _GMP_SEQ_ELEM_44(...) _GMP_SEQ_ELEM_43
+#define _GMP_SEQ_ELEM_45(...) _GMP_SEQ_ELEM_44
+#define _GMP_SEQ_ELEM_46(...) _GMP_SEQ_ELEM_45
+#define _GMP_SEQ_ELEM_47(...) _GMP_SEQ_ELEM_46
+#define _GMP_SEQ_ELEM_48(...) _GMP_SEQ_ELEM_47
+#define _GMP_SEQ_ELEM_49(...) _GMP_SEQ_ELEM_48
+#define _GMP_SEQ_ELEM_50(...) _GMP_SEQ_ELEM_49
+#define _GMP_SEQ_ELEM_51(...) _GMP_SEQ_ELEM_50
+#define _GMP_SEQ_ELEM_52(...) _GMP_SEQ_ELEM_51
+#define _GMP_SEQ_ELEM_53(...) _GMP_SEQ_ELEM_52
+#define _GMP_SEQ_ELEM_54(...) _GMP_SEQ_ELEM_53
+#define _GMP_SEQ_ELEM_55(...) _GMP_SEQ_ELEM_54
+#define _GMP_SEQ_ELEM_56(...) _GMP_SEQ_ELEM_55
+#define _GMP_SEQ_ELEM_57(...) _GMP_SEQ_ELEM_56
+#define _GMP_SEQ_ELEM_58(...) _GMP_SEQ_ELEM_57
+#define _GMP_SEQ_ELEM_59(...) _GMP_SEQ_ELEM_58
+#define _GMP_SEQ_ELEM_60(...) _GMP_SEQ_ELEM_59
+#define _GMP_SEQ_ELEM_61(...) _GMP_SEQ_ELEM_60
+#define _GMP_SEQ_ELEM_62(...) _GMP_SEQ_ELEM_61
+#define _GMP_SEQ_ELEM_63(...) _GMP_SEQ_ELEM_62
+#define _GMP_SEQ_ELEM_64(...) _GMP_SEQ_ELEM_63
+#define _GMP_SEQ_ELEM_65(...) _GMP_SEQ_ELEM_64
+#define _GMP_SEQ_ELEM_66(...) _GMP_SEQ_ELEM_65
+#define _GMP_SEQ_ELEM_67(...) _GMP_SEQ_ELEM_66
+#define _GMP_SEQ_ELEM_68(...) _GMP_SEQ_ELEM_67
+#define _GMP_SEQ_ELEM_69(...) _GMP_SEQ_ELEM_68
+#define _GMP_SEQ_ELEM_70(...) _GMP_SEQ_ELEM_69
+#define _GMP_SEQ_ELEM_71(...) _GMP_SEQ_ELEM_70
+#define _GMP_SEQ_ELEM_72(...) _GMP_SEQ_ELEM_71
+#define _GMP_SEQ_ELEM_73(...) _GMP_SEQ_ELEM_72
+#define _GMP_SEQ_ELEM_74(...) _GMP_SEQ_ELEM_73
+#define _GMP_SEQ_ELEM_75(...) _GMP_SEQ_ELEM_74
+#define _GMP_SEQ_ELEM_76(...) _GMP_SEQ_ELEM_75
+#define _GMP_SEQ_ELEM_77(...) _GMP_SEQ_ELEM_76
+#define _GMP_SEQ_ELEM_78(...) _GMP_SEQ_ELEM_77
+#define _GMP_SEQ_ELEM_79(...) _GMP_SEQ_ELEM_78
+#define _GMP_SEQ_ELEM_80(...) _GMP_SEQ_ELEM_79
+#define _GMP_SEQ_ELEM_81(...) _GMP_SEQ_ELEM_80
+#define _GMP_SEQ_ELEM_82(...) _GMP_SEQ_ELEM_81
+#define _GMP_SEQ_ELEM_83(...) _GMP_SEQ_ELEM_82
+#define _GMP_SEQ_ELEM_84(...) _GMP_SEQ_ELEM_83
+#define _GMP_SEQ_ELEM_85(...) _GMP_SEQ_ELEM_84
+#define _GMP_SEQ_ELEM_86(...) _GMP_SEQ_ELEM_85
+#define _GMP_SEQ_ELEM_87(...) _GMP_SEQ_ELEM_86
+#define _GMP_SEQ_ELEM_88(...) _GMP_SEQ_ELEM_87
+#define _GMP_SEQ_ELEM_89(...) _GMP_SEQ_ELEM_88
+#define _GMP_SEQ_ELEM_90(...) _GMP_SEQ_ELEM_89
+#define _GMP_SEQ_ELEM_91(...) _GMP_SEQ_ELEM_90
+#define _GMP_SEQ_ELEM_92(...) _GMP_SEQ_ELEM_91
+#define _GMP_SEQ_ELEM_93(...) _GMP_SEQ_ELEM_92
+#define _GMP_SEQ_ELEM_94(...) _GMP_SEQ_ELEM_93
+#define _GMP_SEQ_ELEM_95(...) _GMP_SEQ_ELEM_94
+#define _GMP_SEQ_ELEM_96(...) _GMP_SEQ_ELEM_95
+#define _GMP_SEQ_ELEM_97(...) _GMP_SEQ_ELEM_96
+#define _GMP_SEQ_ELEM_98(...) _GMP_SEQ_ELEM_97
+#define _GMP_SEQ_ELEM_99(...) _GMP_SEQ_ELEM_98
+#define _GMP_SEQ_ELEM_100(...) _GMP_SEQ_ELEM_99
+#define _GMP_SEQ_ELEM_101(...) _GMP_SEQ_ELEM_100
+#define _GMP_SEQ_ELEM_102(...) _GMP_SEQ_ELEM_101
+#define _GMP_SEQ_ELEM_103(...) _GMP_SEQ_ELEM_102
+#define _GMP_SEQ_ELEM_104(...) _GMP_SEQ_ELEM_103
+#define _GMP_SEQ_ELEM_105(...) _GMP_SEQ_ELEM_104
+#define _GMP_SEQ_ELEM_106(...) _GMP_SEQ_ELEM_105
+#define _GMP_SEQ_ELEM_107(...) _GMP_SEQ_ELEM_106
+#define _GMP_SEQ_ELEM_108(...) _GMP_SEQ_ELEM_107
+#define _GMP_SEQ_ELEM_109(...) _GMP_SEQ_ELEM_108
+#define _GMP_SEQ_ELEM_110(...) _GMP_SEQ_ELEM_109
+#define _GMP_SEQ_ELEM_111(...) _GMP_SEQ_ELEM_110
+#define _GMP_SEQ_ELEM_112(...) _GMP_SEQ_ELEM_111
+#define _GMP_SEQ_ELEM_113(...) _GMP_SEQ_ELEM_112
+#define _GMP_SEQ_ELEM_114(...) _GMP_SEQ_ELEM_113
+#define _GMP_SEQ_ELEM_115(...) _GMP_SEQ_ELEM_114
+#define _GMP_SEQ_ELEM_116(...) _GMP_SEQ_ELEM_115
+#define _GMP_SEQ_ELEM_117(...) _GMP_SEQ_ELEM_116
+#define _GMP_SEQ_ELEM_118(...) _GMP_SEQ_ELEM_117
+#define _GMP_SEQ_ELEM_119(...) _GMP_SEQ_ELEM_118
+#define _GMP_SEQ_ELEM_120(...) _GMP_SEQ_ELEM_119
+#define _GMP_SEQ_ELEM_121(...) _GMP_SEQ_ELEM_120
+#define _GMP_SEQ_ELEM_122(...) _GMP_SEQ_ELEM_121
+#define _GMP_SEQ_ELEM_123(...) _GMP_SEQ_ELEM_122
+#define _GMP_SEQ_ELEM_124(...) _GMP_SEQ_ELEM_123
+#define _GMP_SEQ_ELEM_125(...) _GMP_SEQ_ELEM_124
+#define _GMP_SEQ_ELEM_126(...) _GMP_SEQ_ELEM_125
+#define _GMP_SEQ_ELEM_127(...) _GMP_SEQ_ELEM_126
+#define _GMP_SEQ_ELEM_128(...) _GMP_SEQ_ELEM_127
+#define _GMP_SEQ_ELEM_129(...) _GMP_SEQ_ELEM_128
+#define _GMP_SEQ_ELEM_130(...) _GMP_SEQ_ELEM_129
+#define _GMP_SEQ_ELEM_131(...) _GMP_SEQ_ELEM_130
+#define _GMP_SEQ_ELEM_132(...) _GMP_SEQ_ELEM_131
+#define _GMP_SEQ_ELEM_133(...) _GMP_SEQ_ELEM_132
+#define _GMP_SEQ_ELEM_134(...) _GMP_SEQ_ELEM_133
+#define _GMP_SEQ_ELEM_135(...) _GMP_SEQ_ELEM_134
+#define _GMP_SEQ_ELEM_136(...) _GMP_SEQ_ELEM_135
+#define _GMP_SEQ_ELEM_137(...) _GMP_SEQ_ELEM_136
+#define _GMP_SEQ_ELEM_138(...) _GMP_SEQ_ELEM_137
+#define _GMP_SEQ_ELEM_139(...) _GMP_SEQ_ELEM_138
+#define _GMP_SEQ_ELEM_140(...) _GMP_SEQ_ELEM_139
+#define _GMP_SEQ_ELEM_141(...) _GMP_SEQ_ELEM_140
+#define _GMP_SEQ_ELEM_142(...) _GMP_SEQ_ELEM_141
+#define _GMP_SEQ_ELEM_143(...) _GMP_SEQ_ELEM_142
+#define _GMP_SEQ_ELEM_144(...) _GMP_SEQ_ELEM_143
+#define _GMP_SEQ_ELEM_145(...) _GMP_SEQ_ELEM_144
+#define _GMP_SEQ_ELEM_146(...) _GMP_SEQ_ELEM_145
+#define _GMP_SEQ_ELEM_147(...) _GMP_SEQ_ELEM_146
+#define _GMP_SEQ_ELEM_148(...) _GMP_SEQ_ELEM_147
+#define _GMP_SEQ_ELEM_149(...) _GMP_SEQ_ELEM_148
+#define _GMP_SEQ_ELEM_150(...) _GMP_SEQ_ELEM_149
+#define _GMP_SEQ_ELEM_151(...) _GMP_SEQ_ELEM_150
+#define _GMP_SEQ_ELEM_152(...) _GMP_SEQ_ELEM_151
+#define _GMP_SEQ_ELEM_153(...) _GMP_SEQ_ELEM_152
+#define _GMP_SEQ_ELEM_154(...) _GMP_SEQ_ELEM_153
+#define _GMP_SEQ_ELEM_155(...) _GMP_SEQ_ELEM_154
+#define _GMP_SEQ_ELEM_156(...) _GMP_SEQ_ELEM_155
+#define _GMP_SEQ_ELEM_157(...) _GMP_SEQ_ELEM_156
+#define _GMP_SEQ_ELEM_158(...) _GMP_SEQ_ELEM_157
+#define _GMP_SEQ_ELEM_159(...) _GMP_SEQ_ELEM_158
+#define _GMP_SEQ_ELEM_160(...) _GMP_SEQ_ELEM_159
+#define _GMP_SEQ_ELEM_161(...) _GMP_SEQ_ELEM_160
+#define _GMP_SEQ_ELEM_162(...) _GMP_SEQ_ELEM_161
+#define _GMP_SEQ_ELEM_163(...) _GMP_SEQ_ELEM_162
+#define _GMP_SEQ_ELEM_164(...) _GMP_SEQ_ELEM_163
+#define _GMP_SEQ_ELEM_165(...) _GMP_SEQ_ELEM_164
+#define _GMP_SEQ_ELEM_166(...) _GMP_SEQ_ELEM_165
+#define _GMP_SEQ_ELEM_167(...) _GMP_SEQ_ELEM_166
+#define _GMP_SEQ_ELEM_168(...) _GMP_SEQ_ELEM_167
+#define _GMP_SEQ_ELEM_169(...) _GMP_SEQ_ELEM_168
+#define _GMP_SEQ_ELEM_170(...) _GMP_SEQ_ELEM_169
+#define _GMP_SEQ_ELEM_171(...) _GMP_SEQ_ELEM_170
+#define _GMP_SEQ_ELEM_172(...) _GMP_SEQ_ELEM_171
+#define _GMP_SEQ_ELEM_173(...) _GMP_SEQ_ELEM_172
+#define _GMP_SEQ_ELEM_174(...) _GMP_SEQ_ELEM_173
+#define _GMP_SEQ_ELEM_175(...) _GMP_SEQ_ELEM_174
+#define _GMP_SEQ_ELEM_176(...) _GMP_SEQ_ELEM_175
+#define _GMP_SEQ_ELEM_177(...) _GMP_SEQ_ELEM_176
+#define _GMP_SEQ_ELEM_178(...) _GMP_SEQ_ELEM_177
+#define _GMP_SEQ_ELEM_179(...) _GMP_SEQ_ELEM_178
+#define _GMP_SEQ_ELEM_180(...) _GMP_SEQ_ELEM_179
+#define _GMP_SEQ_ELEM_181(...) _GMP_SEQ_ELEM_180
+#define _GMP_SEQ_ELEM_182(...) _GMP_SEQ_ELEM_181
+#define _GMP_SEQ_ELEM_183(...) _GMP_SEQ_ELEM_182
+#define _GMP_SEQ_ELEM_184(...) _GMP_SEQ_ELEM_183
+#define _GMP_SEQ_ELEM_185(...) _GMP_SEQ_ELEM_184
+#define _GMP_SEQ_ELEM_186(...) _GMP_SEQ_ELEM_185
+#define _GMP_SEQ_ELEM_187(...) _GMP_SEQ_ELEM_186
+#define _GMP_SEQ_ELEM_188(...) _GMP_SEQ_ELEM_187
+#define _GMP_SEQ_ELEM_189(...) _GMP_SEQ_ELEM_188
+#define _GMP_SEQ_ELEM_190(...) _GMP_SEQ_ELEM_189
+#define _GMP_SEQ_ELEM_191(...) _GMP_SEQ_ELEM_190
+#define _GMP_SEQ_ELEM_192(...) _GMP_SEQ_ELEM_191
+#define _GMP_SEQ_ELEM_193(...) _GMP_SEQ_ELEM_192
+#define _GMP_SEQ_ELEM_194(...) _GMP_SEQ_ELEM_193
+#define _GMP_SEQ_ELEM_195(...) _GMP_SEQ_ELEM_194
+#define _GMP_SEQ_ELEM_196(...) _GMP_SEQ_ELEM_195
+#define _GMP_SEQ_ELEM_197(...) _GMP_SEQ_ELEM_196
+#define _GMP_SEQ_ELEM_198(...) _GMP_SEQ_ELEM_197
+#define _GMP_SEQ_ELEM_199(...) _GMP_SEQ_ELEM_198
+#define _GMP_SEQ_ELEM_200(...) _GMP_SEQ_ELEM_199
+#define _GMP_SEQ_ELEM_201(...) _GMP_SEQ_ELEM_200
+#define _GMP_SEQ_ELEM_202(...) _GMP_SEQ_ELEM_201
+#define _GMP_SEQ_ELEM_203(...) _GMP_SEQ_ELEM_202
+#define _GMP_SEQ_ELEM_204(...) _GMP_SEQ_ELEM_203
+#define _GMP_SEQ_ELEM_205(...) _GMP_SEQ_ELEM_204
+#define _GMP_SEQ_ELEM_206(...) _GMP_SEQ_ELEM_205
+#define _GMP_SEQ_ELEM_207(...) _GMP_SEQ_ELEM_206
+#define _GMP_SEQ_ELEM_208(...) _GMP_SEQ_ELEM_207
+#define _GMP_SEQ_ELEM_209(...) _GMP_SEQ_ELEM_208
+#define _GMP_SEQ_ELEM_210(...) _GMP_SEQ_ELEM_209
+#define _GMP_SEQ_ELEM_211(...) _GMP_SEQ_ELEM_210
+#define _GMP_SEQ_ELEM_212(...) _GMP_SEQ_ELEM_211
+#define _GMP_SEQ_ELEM_213(...) _GMP_SEQ_ELEM_212
+#define _GMP_SEQ_ELEM_214(...) _GMP_SEQ_ELEM_213
+#define _GMP_SEQ_ELEM_215(...) _GMP_SEQ_ELEM_214
+#define _GMP_SEQ_ELEM_216(...) _GMP_SEQ_ELEM_215
+#define _GMP_SEQ_ELEM_217(...) _GMP_SEQ_ELEM_216
+#define _GMP_SEQ_ELEM_218(...) _GMP_SEQ_ELEM_217
+#define _GMP_SEQ_ELEM_219(...) _GMP_SEQ_ELEM_218
+#define _GMP_SEQ_ELEM_220(...) _GMP_SEQ_ELEM_219
+#define _GMP_SEQ_ELEM_221(...) _GMP_SEQ_ELEM_220
+#define _GMP_SEQ_ELEM_222(...) _GMP_SEQ_ELEM_221
+#define _GMP_SEQ_ELEM_223(...) _GMP_SEQ_ELEM_222
+#define _GMP_SEQ_ELEM_224(...) _GMP_SEQ_ELEM_223
+#define _GMP_SEQ_ELEM_225(...) _GMP_SEQ_ELEM_224
+#define _GMP_SEQ_ELEM_226(...) _GMP_SEQ_ELEM_225
+#define _GMP_SEQ_ELEM_227(...) _GMP_SEQ_ELEM_226
+#define _GMP_SEQ_ELEM_228(...) _GMP_SEQ_ELEM_227
+#define _GMP_SEQ_ELEM_229(...) _GMP_SEQ_ELEM_228
+#define _GMP_SEQ_ELEM_230(...) _GMP_SEQ_ELEM_229
+#define _GMP_SEQ_ELEM_231(...) _GMP_SEQ_ELEM_230
+#define _GMP_SEQ_ELEM_232(...) _GMP_SEQ_ELEM_231
+#define _GMP_SEQ_ELEM_233(...) _GMP_SEQ_ELEM_232
+#define _GMP_SEQ_ELEM_234(...) _GMP_SEQ_ELEM_233
+#define _GMP_SEQ_ELEM_235(...) _GMP_SEQ_ELEM_234
+#define _GMP_SEQ_ELEM_236(...) _GMP_SEQ_ELEM_235
+#define _GMP_SEQ_ELEM_237(...) _GMP_SEQ_ELEM_236
+#define _GMP_SEQ_ELEM_238(...) _GMP_SEQ_ELEM_237
+#define _GMP_SEQ_ELEM_239(...) _GMP_SEQ_ELEM_238
+#define _GMP_SEQ_ELEM_240(...) _GMP_SEQ_ELEM_239
+#define _GMP_SEQ_ELEM_241(...) _GMP_SEQ_ELEM_240
+#define _GMP_SEQ_ELEM_242(...) _GMP_SEQ_ELEM_241
+#define _GMP_SEQ_ELEM_243(...) _GMP_SEQ_ELEM_242
+#define _GMP_SEQ_ELEM_244(...) _GMP_SEQ_ELEM_243
+#define _GMP_SEQ_ELEM_245(...) _GMP_SEQ_ELEM_244
+#define _GMP_SEQ_ELEM_246(...) _GMP_SEQ_ELEM_245
+#define _GMP_SEQ_ELEM_247(...) _GMP_SEQ_ELEM_246
+#define _GMP_SEQ_ELEM_248(...) _GMP_SEQ_ELEM_247
+#define _GMP_SEQ_ELEM_249(...) _GMP_SEQ_ELEM_248
+#define _GMP_SEQ_ELEM_250(...) _GMP_SEQ_ELEM_249
+#define _GMP_SEQ_ELEM_251(...) _GMP_SEQ_ELEM_250
+#define _GMP_SEQ_ELEM_252(...) _GMP_SEQ_ELEM_251
+#define _GMP_SEQ_ELEM_253(...) _GMP_SEQ_ELEM_252
+#define _GMP_SEQ_ELEM_254(...) _GMP_SEQ_ELEM_253
+#define _GMP_SEQ_ELEM_255(...) _GMP_SEQ_ELEM_254
+#define _GMP_SEQ_ELEM_256(...) _GMP_SEQ_ELEM_255
+#define _GMP_SEQ_ELEM_257(...) _GMP_SEQ_ELEM_256
+#define _GMP_SEQ_ELEM_258(...) _GMP_SEQ_ELEM_257
+#define _GMP_SEQ_ELEM_259(...) _GMP_SEQ_ELEM_258
+#define _GMP_SEQ_ELEM_260(...) _GMP_SEQ_ELEM_259
+#define _GMP_SEQ_ELEM_261(...) _GMP_SEQ_ELEM_260
+#define _GMP_SEQ_ELEM_262(...) _GMP_SEQ_ELEM_261
+#define _GMP_SEQ_ELEM_263(...) _GMP_SEQ_ELEM_262
+#define _GMP_SEQ_ELEM_264(...) _GMP_SEQ_ELEM_263
+#define _GMP_SEQ_ELEM_265(...) _GMP_SEQ_ELEM_264
+#define _GMP_SEQ_ELEM_266(...) _GMP_SEQ_ELEM_265
+#define _GMP_SEQ_ELEM_267(...) _GMP_SEQ_ELEM_266
+#define _GMP_SEQ_ELEM_268(...) _GMP_SEQ_ELEM_267
+#define _GMP_SEQ_ELEM_269(...) _GMP_SEQ_ELEM_268
+#define _GMP_SEQ_ELEM_270(...) _GMP_SEQ_ELEM_269
+#define _GMP_SEQ_ELEM_271(...) _GMP_SEQ_ELEM_270
+#define _GMP_SEQ_ELEM_272(...) _GMP_SEQ_ELEM_271
+#define _GMP_SEQ_ELEM_273(...) _GMP_SEQ_ELEM_272
+#define _GMP_SEQ_ELEM_274(...) _GMP_SEQ_ELEM_273
+#define _GMP_SEQ_ELEM_275(...) _GMP_SEQ_ELEM_274
+#define _GMP_SEQ_ELEM_276(...) _GMP_SEQ_ELEM_275
+#define _GMP_SEQ_ELEM_277(...) _GMP_SEQ_ELEM_276
+#define _GMP_SEQ_ELEM_278(...) _GMP_SEQ_ELEM_277
+#define _GMP_SEQ_ELEM_279(...) _GMP_SEQ_ELEM_278
+#define _GMP_SEQ_ELEM_280(...) _GMP_SEQ_ELEM_279
+#define _GMP_SEQ_ELEM_281(...) _GMP_SEQ_ELEM_280
+#define _GMP_SEQ_ELEM_282(...) _GMP_SEQ_ELEM_281
+#define _GMP_SEQ_ELEM_283(...) _GMP_SEQ_ELEM_282
+#define _GMP_SEQ_ELEM_284(...) _GMP_SEQ_ELEM_283
+#define _GMP_SEQ_ELEM_285(...) _GMP_SEQ_ELEM_284
+#define _GMP_SEQ_ELEM_286(...) _GMP_SEQ_ELEM_285
+#define _GMP_SEQ_ELEM_287(...) _GMP_SEQ_ELEM_286
+#define _GMP_SEQ_ELEM_288(...) _GMP_SEQ_ELEM_287
+#define _GMP_SEQ_ELEM_289(...) _GMP_SEQ_ELEM_288
+#define _GMP_SEQ_ELEM_290(...) _GMP_SEQ_ELEM_289
+#define _GMP_SEQ_ELEM_291(...) _GMP_SEQ_ELEM_290
+#define _GMP_SEQ_ELEM_292(...) _GMP_SEQ_ELEM_291
+#define _GMP_SEQ_ELEM_293(...) _GMP_SEQ_ELEM_292
+#define _GMP_SEQ_ELEM_294(...) _GMP_SEQ_ELEM_293
+#define _GMP_SEQ_ELEM_295(...) _GMP_SEQ_ELEM_294
+#define _GMP_SEQ_ELEM_296(...) _GMP_SEQ_ELEM_295
+#define _GMP_SEQ_ELEM_297(...) _GMP_SEQ_ELEM_296
+#define _GMP_SEQ_ELEM_298(...) _GMP_SEQ_ELEM_297
+#define _GMP_SEQ_ELEM_299(...) _GMP_SEQ_ELEM_298
+#define _GMP_SEQ_ELEM_300(...) _GMP_SEQ_ELEM_299
+#define _GMP_SEQ_ELEM_301(...) _GMP_SEQ_ELEM_300
+#define _GMP_SEQ_ELEM_302(...) _GMP_SEQ_ELEM_301
+#define _GMP_SEQ_ELEM_303(...) _GMP_SEQ_ELEM_302
+#define _GMP_SEQ_ELEM_304(...) _GMP_SEQ_ELEM_303
+#define _GMP_SEQ_ELEM_305(...) _GMP_SEQ_ELEM_304
+#define _GMP_SEQ_ELEM_306(...) _GMP_SEQ_ELEM_305
+#define _GMP_SEQ_ELEM_307(...) _GMP_SEQ_ELEM_306
+#define _GMP_SEQ_ELEM_308(...) _GMP_SEQ_ELEM_307
+#define _GMP_SEQ_ELEM_309(...) _GMP_SEQ_ELEM_308
+#define _GMP_SEQ_ELEM_310(...) _GMP_SEQ_ELEM_309
+#define _GMP_SEQ_ELEM_311(...) _GMP_SEQ_ELEM_310
+#define _GMP_SEQ_ELEM_312(...) _GMP_SEQ_ELEM_311
+#define _GMP_SEQ_ELEM_313(...) _GMP_SEQ_ELEM_312
+#define _GMP_SEQ_ELEM_314(...) _GMP_SEQ_ELEM_313
+#define _GMP_SEQ_ELEM_315(...) _GMP_SEQ_ELEM_314
+#define _GMP_SEQ_ELEM_316(...) _GMP_SEQ_ELEM_315
+#define _GMP_SEQ_ELEM_317(...) _GMP_SEQ_ELEM_316
+#define _GMP_SEQ_ELEM_318(...) _GMP_SEQ_ELEM_317
+#define _GMP_SEQ_ELEM_319(...) _GMP_SEQ_ELEM_318
+#define _GMP_SEQ_ELEM_320(...) _GMP_SEQ_ELEM_319
+#define _GMP_SEQ_ELEM_321(...) _GMP_SEQ_ELEM_320
+#define _GMP_SEQ_ELEM_322(...) _GMP_SEQ_ELEM_321
+#define _GMP_SEQ_ELEM_323(...) _GMP_SEQ_ELEM_322
+#define _GMP_SEQ_ELEM_324(...) _GMP_SEQ_ELEM_323
+#define _GMP_SEQ_ELEM_325(...) _GMP_SEQ_ELEM_324
+#define _GMP_SEQ_ELEM_326(...) _GMP_SEQ_ELEM_325
+#define _GMP_SEQ_ELEM_327(...) _GMP_SEQ_ELEM_326
+#define _GMP_SEQ_ELEM_328(...) _GMP_SEQ_ELEM_327
+#define _GMP_SEQ_ELEM_329(...) _GMP_SEQ_ELEM_328
+#define _GMP_SEQ_ELEM_330(...) _GMP_SEQ_ELEM_329
+#define _GMP_SEQ_ELEM_331(...) _GMP_SEQ_ELEM_330
+#define _GMP_SEQ_ELEM_332(...) _GMP_SEQ_ELEM_331
+#define _GMP_SEQ_ELEM_333(...) _GMP_SEQ_ELEM_332
+#define _GMP_SEQ_ELEM_334(...) _GMP_SEQ_ELEM_333
+#define _GMP_SEQ_ELEM_335(...) _GMP_SEQ_ELEM_334
+#define _GMP_SEQ_ELEM_336(...) _GMP_SEQ_ELEM_335
+#define _GMP_SEQ_ELEM_337(...) _GMP_SEQ_ELEM_336
+#define _GMP_SEQ_ELEM_338(...) _GMP_SEQ_ELEM_337
+#define _GMP_SEQ_ELEM_339(...) _GMP_SEQ_ELEM_338
+#define _GMP_SEQ_ELEM_340(...) _GMP_SEQ_ELEM_339
+#define _GMP_SEQ_ELEM_341(...) _GMP_SEQ_ELEM_340
+#define _GMP_SEQ_ELEM_342(...) _GMP_SEQ_ELEM_341
+#define _GMP_SEQ_ELEM_343(...) _GMP_SEQ_ELEM_342
+#define _GMP_SEQ_ELEM_344(...) _GMP_SEQ_ELEM_343
+#define _GMP_SEQ_ELEM_345(...) _GMP_SEQ_ELEM_344
+#define _GMP_SEQ_ELEM_346(...) _GMP_SEQ_ELEM_345
+#define _GMP_SEQ_ELEM_347(...) _GMP_SEQ_ELEM_346
+#define _GMP_SEQ_ELEM_348(...) _GMP_SEQ_ELEM_347
+#define _GMP_SEQ_ELEM_349(...) _GMP_SEQ_ELEM_348
+#define _GMP_SEQ_ELEM_350(...) _GMP_SEQ_ELEM_349
+#define _GMP_SEQ_ELEM_351(...) _GMP_SEQ_ELEM_350
+#define _GMP_SEQ_ELEM_352(...) _GMP_SEQ_ELEM_351
+#define _GMP_SEQ_ELEM_353(...) _GMP_SEQ_ELEM_352
+#define _GMP_SEQ_ELEM_354(...) _GMP_SEQ_ELEM_353
+#define _GMP_SEQ_ELEM_355(...) _GMP_SEQ_ELEM_354
+#define _GMP_SEQ_ELEM_356(...) _GMP_SEQ_ELEM_355
+#define _GMP_SEQ_ELEM_357(...) _GMP_SEQ_ELEM_356
+#define _GMP_SEQ_ELEM_358(...) _GMP_SEQ_ELEM_357
+#define _GMP_SEQ_ELEM_359(...) _GMP_SEQ_ELEM_358
+#define _GMP_SEQ_ELEM_360(...) _GMP_SEQ_ELEM_359
+#define _GMP_SEQ_ELEM_361(...) _GMP_SEQ_ELEM_360
+#define _GMP_SEQ_ELEM_362(...) _GMP_SEQ_ELEM_361
+#define _GMP_SEQ_ELEM_363(...) _GMP_SEQ_ELEM_362
+#define _GMP_SEQ_ELEM_364(...) _GMP_SEQ_ELEM_363
+#define _GMP_SEQ_ELEM_365(...) _GMP_SEQ_ELEM_364
+#define _GMP_SEQ_ELEM_366(...) _GMP_SEQ_ELEM_365
+#define _GMP_SEQ_ELEM_367(...) _GMP_SEQ_ELEM_366
+#define _GMP_SEQ_ELEM_368(...) _GMP_SEQ_ELEM_367
+#define _GMP_SEQ_ELEM_369(...) _GMP_SEQ_ELEM_368
+#define _GMP_SEQ_ELEM_370(...) _GMP_SEQ_ELEM_369
+#define _GMP_SEQ_ELEM_371(...) _GMP_SEQ_ELEM_370
+#define _GMP_SEQ_ELEM_372(...) _GMP_SEQ_ELEM_371
+#define _GMP_SEQ_ELEM_373(...) _GMP_SEQ_ELEM_372
+#define _GMP_SEQ_ELEM_374(...) _GMP_SEQ_ELEM_373
+#define _GMP_SEQ_ELEM_375(...) _GMP_SEQ_ELEM_374
+#define _GMP_SEQ_ELEM_376(...) _GMP_SEQ_ELEM_375
+#define _GMP_SEQ_ELEM_377(...) _GMP_SEQ_ELEM_376
+#define _GMP_SEQ_ELEM_378(...) _GMP_SEQ_ELEM_377
+#define _GMP_SEQ_ELEM_379(...) _GMP_SEQ_ELEM_378
+#define _GMP_SEQ_ELEM_380(...) _GMP_SEQ_ELEM_379
+#define _GMP_SEQ_ELEM_381(...) _GMP_SEQ_ELEM_380
+#define _GMP_SEQ_ELEM_382(...) _GMP_SEQ_ELEM_381
+#define _GMP_SEQ_ELEM_383(...) _GMP_SEQ_ELEM_382
+#define _GMP_SEQ_ELEM_384(...) _GMP_SEQ_ELEM_383
+#define _GMP_SEQ_ELEM_385(...) _GMP_SEQ_ELEM_384
+#define _GMP_SEQ_ELEM_386(...) _GMP_SEQ_ELEM_385
+#define _GMP_SEQ_ELEM_387(...) _GMP_SEQ_ELEM_386
+#define _GMP_SEQ_ELEM_388(...) _GMP_SEQ_ELEM_387
+#define _GMP_SEQ_ELEM_389(...) _GMP_SEQ_ELEM_388
+#define _GMP_SEQ_ELEM_390(...) _GMP_SEQ_ELEM_389
+#define _GMP_SEQ_ELEM_391(...) _GMP_SEQ_ELEM_390
+#define _GMP_SEQ_ELEM_392(...) _GMP_SEQ_ELEM_391
+#define _GMP_SEQ_ELEM_393(...) _GMP_SEQ_ELEM_392
+#define _GMP_SEQ_ELEM_394(...) _GMP_SEQ_ELEM_393
+#define _GMP_SEQ_ELEM_395(...) _GMP_SEQ_ELEM_394
+#define _GMP_SEQ_ELEM_396(...) _GMP_SEQ_ELEM_395
+#define _GMP_SEQ_ELEM_397(...) _GMP_SEQ_ELEM_396
+#define _GMP_SEQ_ELEM_398(...) _GMP_SEQ_ELEM_397
+#define _GMP_SEQ_ELEM_399(...) _GMP_SEQ_ELEM_398
+#define _GMP_SEQ_ELEM_400(...) _GMP_SEQ_ELEM_399
+#define _GMP_SEQ_ELEM_401(...) _GMP_SEQ_ELEM_400
+#define _GMP_SEQ_ELEM_402(...) _GMP_SEQ_ELEM_401
+#define _GMP_SEQ_ELEM_403(...) _GMP_SEQ_ELEM_402
+#define _GMP_SEQ_ELEM_404(...) _GMP_SEQ_ELEM_403
+#define _GMP_SEQ_ELEM_405(...) _GMP_SEQ_ELEM_404
+#define _GMP_SEQ_ELEM_406(...) _GMP_SEQ_ELEM_405
+#define _GMP_SEQ_ELEM_407(...) _GMP_SEQ_ELEM_406
+#define _GMP_SEQ_ELEM_408(...) _GMP_SEQ_ELEM_407
+#define _GMP_SEQ_ELEM_409(...) _GMP_SEQ_ELEM_408
+#define _GMP_SEQ_ELEM_410(...) _GMP_SEQ_ELEM_409
+#define _GMP_SEQ_ELEM_411(...) _GMP_SEQ_ELEM_410
+#define _GMP_SEQ_ELEM_412(...) _GMP_SEQ_ELEM_411
+#define _GMP_SEQ_ELEM_413(...) _GMP_SEQ_ELEM_412
+#define _GMP_SEQ_ELEM_414(...) _GMP_SEQ_ELEM_413
+#define _GMP_SEQ_ELEM_415(...) _GMP_SEQ_ELEM_414
+#define _GMP_SEQ_ELEM_416(...) _GMP_SEQ_ELEM_415
+#define _GMP_SEQ_ELEM_417(...) _GMP_SEQ_ELEM_416
+#define _GMP_SEQ_ELEM_418(...) _GMP_SEQ_ELEM_417
+#define _GMP_SEQ_ELEM_419(...) _GMP_SEQ_ELEM_418
+#define _GMP_SEQ_ELEM_420(...) _GMP_SEQ_ELEM_419
+#define _GMP_SEQ_ELEM_421(...) _GMP_SEQ_ELEM_420
+#define _GMP_SEQ_ELEM_422(...) _GMP_SEQ_ELEM_421
+#define _GMP_SEQ_ELEM_423(...) _GMP_SEQ_ELEM_422
+#define _GMP_SEQ_ELEM_424(...) _GMP_SEQ_ELEM_423
+#define _GMP_SEQ_ELEM_425(...) _GMP_SEQ_ELEM_424
+#define _GMP_SEQ_ELEM_426(...) _GMP_SEQ_ELEM_425
+#define _GMP_SEQ_ELEM_427(...) _GMP_SEQ_ELEM_426
+#define _GMP_SEQ_ELEM_428(...) _GMP_SEQ_ELEM_427
+#define _GMP_SEQ_ELEM_429(...) _GMP_SEQ_ELEM_428
+#define _GMP_SEQ_ELEM_430(...) _GMP_SEQ_ELEM_429
+#define _GMP_SEQ_ELEM_431(...) _GMP_SEQ_ELEM_430
+#define _GMP_SEQ_ELEM_432(...) _GMP_SEQ_ELEM_431
+#define _GMP_SEQ_ELEM_433(...) _GMP_SEQ_ELEM_432
+#define _GMP_SEQ_ELEM_434(...) _GMP_SEQ_ELEM_433
+#define _GMP_SEQ_ELEM_435(...) _GMP_SEQ_ELEM_434
+#define _GMP_SEQ_ELEM_436(...) _GMP_SEQ_ELEM_435
+#define _GMP_SEQ_ELEM_437(...) _GMP_SEQ_ELEM_436
+#define _GMP_SEQ_ELEM_438(...) _GMP_SEQ_ELEM_437
+#define _GMP_SEQ_ELEM_439(...) _GMP_SEQ_ELEM_438
+#define _GMP_SEQ_ELEM_440(...) _GMP_SEQ_ELEM_439
+#define _GMP_SEQ_ELEM_441(...) _GMP_SEQ_ELEM_440
+#define _GMP_SEQ_ELEM_442(...) _GMP_SEQ_ELEM_441
+#define _GMP_SEQ_ELEM_443(...) _GMP_SEQ_ELEM_442
+#define _GMP_SEQ_ELEM_444(...) _GMP_SEQ_ELEM_443
+#define _GMP_SEQ_ELEM_445(...) _GMP_SEQ_ELEM_444
+#define _GMP_SEQ_ELEM_446(...) _GMP_SEQ_ELEM_445
+#define _GMP_SEQ_ELEM_447(...) _GMP_SEQ_ELEM_446
+#define _GMP_SEQ_ELEM_448(...) _GMP_SEQ_ELEM_447
+#define _GMP_SEQ_ELEM_449(...) _GMP_SEQ_ELEM_448
+#define _GMP_SEQ_ELEM_450(...) _GMP_SEQ_ELEM_449
+#define _GMP_SEQ_ELEM_451(...) _GMP_SEQ_ELEM_450
+#define _GMP_SEQ_ELEM_452(...) _GMP_SEQ_ELEM_451
+#define _GMP_SEQ_ELEM_453(...) _GMP_SEQ_ELEM_452
+#define _GMP_SEQ_ELEM_454(...) _GMP_SEQ_ELEM_453
+#define _GMP_SEQ_ELEM_455(...) _GMP_SEQ_ELEM_454
+#define _GMP_SEQ_ELEM_456(...) _GMP_SEQ_ELEM_455
+#define _GMP_SEQ_ELEM_457(...) _GMP_SEQ_ELEM_456
+#define _GMP_SEQ_ELEM_458(...) _GMP_SEQ_ELEM_457
+#define _GMP_SEQ_ELEM_459(...) _GMP_SEQ_ELEM_458
+#define _GMP_SEQ_ELEM_460(...) _GMP_SEQ_ELEM_459
+#define _GMP_SEQ_ELEM_461(...) _GMP_SEQ_ELEM_460
+#define _GMP_SEQ_ELEM_462(...) _GMP_SEQ_ELEM_461
+#define _GMP_SEQ_ELEM_463(...) _GMP_SEQ_ELEM_462
+#define _GMP_SEQ_ELEM_464(...) _GMP_SEQ_ELEM_463
+#define _GMP_SEQ_ELEM_465(...) _GMP_SEQ_ELEM_464
+#define _GMP_SEQ_ELEM_466(...) _GMP_SEQ_ELEM_465
+#define _GMP_SEQ_ELEM_467(...) _GMP_SEQ_ELEM_466
+#define _GMP_SEQ_ELEM_468(...) _GMP_SEQ_ELEM_467
+#define _GMP_SEQ_ELEM_469(...) _GMP_SEQ_ELEM_468
+#define _GMP_SEQ_ELEM_470(...) _GMP_SEQ_ELEM_469
+#define _GMP_SEQ_ELEM_471(...) _GMP_SEQ_ELEM_470
+#define _GMP_SEQ_ELEM_472(...) _GMP_SEQ_ELEM_471
+#define _GMP_SEQ_ELEM_473(...) _GMP_SEQ_ELEM_472
+#define _GMP_SEQ_ELEM_474(...) _GMP_SEQ_ELEM_473
+#define _GMP_SEQ_ELEM_475(...) _GMP_SEQ_ELEM_474
+#define _GMP_SEQ_ELEM_476(...) _GMP_SEQ_ELEM_475
+#define _GMP_SEQ_ELEM_477(...) _GMP_SEQ_ELEM_476
+#define _GMP_SEQ_ELEM_478(...) _GMP_SEQ_ELEM_477
+#define _GMP_SEQ_ELEM_479(...) _GMP_SEQ_ELEM_478
+#define _GMP_SEQ_ELEM_480(...) _GMP_SEQ_ELEM_479
+#define _GMP_SEQ_ELEM_481(...) _GMP_SEQ_ELEM_480
+#define _GMP_SEQ_ELEM_482(...) _GMP_SEQ_ELEM_481
+#define _GMP_SEQ_ELEM_483(...) _GMP_SEQ_ELEM_482
+#define _GMP_SEQ_ELEM_484(...) _GMP_SEQ_ELEM_483
+#define _GMP_SEQ_ELEM_485(...) _GMP_SEQ_ELEM_484
+#define _GMP_SEQ_ELEM_486(...) _GMP_SEQ_ELEM_485
+#define _GMP_SEQ_ELEM_487(...) _GMP_SEQ_ELEM_486
+#define _GMP_SEQ_ELEM_488(...) _GMP_SEQ_ELEM_487
+#define _GMP_SEQ_ELEM_489(...) _GMP_SEQ_ELEM_488
+#define _GMP_SEQ_ELEM_490(...) _GMP_SEQ_ELEM_489
+#define _GMP_SEQ_ELEM_491(...) _GMP_SEQ_ELEM_490
+#define _GMP_SEQ_ELEM_492(...) _GMP_SEQ_ELEM_491
+#define _GMP_SEQ_ELEM_493(...) _GMP_SEQ_ELEM_492
+#define _GMP_SEQ_ELEM_494(...) _GMP_SEQ_ELEM_493
+#define _GMP_SEQ_ELEM_495(...) _GMP_SEQ_ELEM_494
+#define _GMP_SEQ_ELEM_496(...) _GMP_SEQ_ELEM_495
+#define _GMP_SEQ_ELEM_497(...) _GMP_SEQ_ELEM_496
+#define _GMP_SEQ_ELEM_498(...) _GMP_SEQ_ELEM_497
+#define _GMP_SEQ_ELEM_499(...) _GMP_SEQ_ELEM_498
+#define _GMP_SEQ_ELEM_500(...) _GMP_SEQ_ELEM_499
+#define _GMP_SEQ_ELEM_501(...) _GMP_SEQ_ELEM_500
+#define _GMP_SEQ_ELEM_502(...) _GMP_SEQ_ELEM_501
+#define _GMP_SEQ_ELEM_503(...) _GMP_SEQ_ELEM_502
+#define _GMP_SEQ_ELEM_504(...) _GMP_SEQ_ELEM_503
+#define _GMP_SEQ_ELEM_505(...) _GMP_SEQ_ELEM_504
+#define _GMP_SEQ_ELEM_506(...) _GMP_SEQ_ELEM_505
+#define _GMP_SEQ_ELEM_507(...) _GMP_SEQ_ELEM_506
+#define _GMP_SEQ_ELEM_508(...) _GMP_SEQ_ELEM_507
+#define _GMP_SEQ_ELEM_509(...) _GMP_SEQ_ELEM_508
+#define _GMP_SEQ_ELEM_510(...) _GMP_SEQ_ELEM_509
+#define _GMP_SEQ_ELEM_511(...) _GMP_SEQ_ELEM_510
+#define _GMP_SEQ_ELEM_512(...) _GMP_SEQ_ELEM_511
+#define _GMP_SEQ_ELEM_513(...) _GMP_SEQ_ELEM_512
+#define _GMP_SEQ_ELEM_514(...) _GMP_SEQ_ELEM_513
+#define _GMP_SEQ_ELEM_515(...) _GMP_SEQ_ELEM_514
+#define _GMP_SEQ_ELEM_516(...) _GMP_SEQ_ELEM_515
+#define _GMP_SEQ_ELEM_517(...) _GMP_SEQ_ELEM_516
+#define _GMP_SEQ_ELEM_518(...) _GMP_SEQ_ELEM_517
+#define _GMP_SEQ_ELEM_519(...) _GMP_SEQ_ELEM_518
+#define _GMP_SEQ_ELEM_520(...) _GMP_SEQ_ELEM_519
+#define _GMP_SEQ_ELEM_521(...) _GMP_SEQ_ELEM_520
+#define _GMP_SEQ_ELEM_522(...) _GMP_SEQ_ELEM_521
+#define _GMP_SEQ_ELEM_523(...) _GMP_SEQ_ELEM_522
+#define _GMP_SEQ_ELEM_524(...) _GMP_SEQ_ELEM_523
+#define _GMP_SEQ_ELEM_525(...) _GMP_SEQ_ELEM_524
+#define _GMP_SEQ_ELEM_526(...) _GMP_SEQ_ELEM_525
+#define _GMP_SEQ_ELEM_527(...) _GMP_SEQ_ELEM_526
+#define _GMP_SEQ_ELEM_528(...) _GMP_SEQ_ELEM_527
+#define _GMP_SEQ_ELEM_529(...) _GMP_SEQ_ELEM_528
+#define _GMP_SEQ_ELEM_530(...) _GMP_SEQ_ELEM_529
+#define _GMP_SEQ_ELEM_531(...) _GMP_SEQ_ELEM_530
+#define _GMP_SEQ_ELEM_532(...) _GMP_SEQ_ELEM_531
+#define _GMP_SEQ_ELEM_533(...) _GMP_SEQ_ELEM_532
+#define _GMP_SEQ_ELEM_534(...) _GMP_SEQ_ELEM_533
+#define _GMP_SEQ_ELEM_535(...) _GMP_SEQ_ELEM_534
+#define _GMP_SEQ_ELEM_536(...) _GMP_SEQ_ELEM_535
+#define _GMP_SEQ_ELEM_537(...) _GMP_SEQ_ELEM_536
+#define _GMP_SEQ_ELEM_538(...) _GMP_SEQ_ELEM_537
+#define _GMP_SEQ_ELEM_539(...) _GMP_SEQ_ELEM_538
+#define _GMP_SEQ_ELEM_540(...) _GMP_SEQ_ELEM_539
+#define _GMP_SEQ_ELEM_541(...) _GMP_SEQ_ELEM_540
+#define _GMP_SEQ_ELEM_542(...) _GMP_SEQ_ELEM_541
+#define _GMP_SEQ_ELEM_543(...) _GMP_SEQ_ELEM_542
+#define _GMP_SEQ_ELEM_544(...) _GMP_SEQ_ELEM_543
+#define _GMP_SEQ_ELEM_545(...) _GMP_SEQ_ELEM_544
+#define _GMP_SEQ_ELEM_546(...) _GMP_SEQ_ELEM_545
+#define _GMP_SEQ_ELEM_547(...) _GMP_SEQ_ELEM_546
+#define _GMP_SEQ_ELEM_548(...) _GMP_SEQ_ELEM_547
+#define _GMP_SEQ_ELEM_549(...) _GMP_SEQ_ELEM_548
+#define _GMP_SEQ_ELEM_550(...) _GMP_SEQ_ELEM_549
+#define _GMP_SEQ_ELEM_551(...) _GMP_SEQ_ELEM_550
+#define _GMP_SEQ_ELEM_552(...) _GMP_SEQ_ELEM_551
+#define _GMP_SEQ_ELEM_553(...) _GMP_SEQ_ELEM_552
+#define _GMP_SEQ_ELEM_554(...) _GMP_SEQ_ELEM_553
+#define _GMP_SEQ_ELEM_555(...) _GMP_SEQ_ELEM_554
+#define _GMP_SEQ_ELEM_556(...) _GMP_SEQ_ELEM_555
+#define _GMP_SEQ_ELEM_557(...) _GMP_SEQ_ELEM_556
+#define _GMP_SEQ_ELEM_558(...) _GMP_SEQ_ELEM_557
+#define _GMP_SEQ_ELEM_559(...) _GMP_SEQ_ELEM_558
+#define _GMP_SEQ_ELEM_560(...) _GMP_SEQ_ELEM_559
+#define _GMP_SEQ_ELEM_561(...) _GMP_SEQ_ELEM_560
+#define _GMP_SEQ_ELEM_562(...) _GMP_SEQ_ELEM_561
+#define _GMP_SEQ_ELEM_563(...) _GMP_SEQ_ELEM_562
+#define _GMP_SEQ_ELEM_564(...) _GMP_SEQ_ELEM_563
+#define _GMP_SEQ_ELEM_565(...) _GMP_SEQ_ELEM_564
+#define _GMP_SEQ_ELEM_566(...) _GMP_SEQ_ELEM_565
+#define _GMP_SEQ_ELEM_567(...) _GMP_SEQ_ELEM_566
+#define _GMP_SEQ_ELEM_568(...) _GMP_SEQ_ELEM_567
+#define _GMP_SEQ_ELEM_569(...) _GMP_SEQ_ELEM_568
+#define _GMP_SEQ_ELEM_570(...) _GMP_SEQ_ELEM_569
+#define _GMP_SEQ_ELEM_571(...) _GMP_SEQ_ELEM_570
+#define _GMP_SEQ_ELEM_572(...) _GMP_SEQ_ELEM_571
+#define _GMP_SEQ_ELEM_573(...) _GMP_SEQ_ELEM_572
+#define _GMP_SEQ_ELEM_574(...) _GMP_SEQ_ELEM_573
+#define _GMP_SEQ_ELEM_575(...) _GMP_SEQ_ELEM_574
+#define _GMP_SEQ_ELEM_576(...) _GMP_SEQ_ELEM_575
+#define _GMP_SEQ_ELEM_577(...) _GMP_SEQ_ELEM_576
+#define _GMP_SEQ_ELEM_578(...) _GMP_SEQ_ELEM_577
+#define _GMP_SEQ_ELEM_579(...) _GMP_SEQ_ELEM_578
+#define _GMP_SEQ_ELEM_580(...) _GMP_SEQ_ELEM_579
+#define _GMP_SEQ_ELEM_581(...) _GMP_SEQ_ELEM_580
+#define _GMP_SEQ_ELEM_582(...) _GMP_SEQ_ELEM_581
+#define _GMP_SEQ_ELEM_583(...) _GMP_SEQ_ELEM_582
+#define _GMP_SEQ_ELEM_584(...) _GMP_SEQ_ELEM_583
+#define _GMP_SEQ_ELEM_585(...) _GMP_SEQ_ELEM_584
+#define _GMP_SEQ_ELEM_586(...) _GMP_SEQ_ELEM_585
+#define _GMP_SEQ_ELEM_587(...) _GMP_SEQ_ELEM_586
+#define _GMP_SEQ_ELEM_588(...) _GMP_SEQ_ELEM_587
+#define _GMP_SEQ_ELEM_589(...) _GMP_SEQ_ELEM_588
+#define _GMP_SEQ_ELEM_590(...) _GMP_SEQ_ELEM_589
+#define _GMP_SEQ_ELEM_591(...) _GMP_SEQ_ELEM_590
+#define _GMP_SEQ_ELEM_592(...) _GMP_SEQ_ELEM_591
+#define _GMP_SEQ_ELEM_593(...) _GMP_SEQ_ELEM_592
+#define _GMP_SEQ_ELEM_594(...) _GMP_SEQ_ELEM_593
+#define _GMP_SEQ_ELEM_595(...) _GMP_SEQ_ELEM_594
+#define _GMP_SEQ_ELEM_596(...) _GMP_SEQ_ELEM_595
+#define _GMP_SEQ_ELEM_597(...) _GMP_SEQ_ELEM_596
+#define _GMP_SEQ_ELEM_598(...) _GMP_SEQ_ELEM_597
+#define _GMP_SEQ_ELEM_599(...) _GMP_SEQ_ELEM_598
+#define _GMP_SEQ_ELEM_600(...) _GMP_SEQ_ELEM_599
+#define _GMP_SEQ_ELEM_601(...) _GMP_SEQ_ELEM_600
+#define _GMP_SEQ_ELEM_602(...) _GMP_SEQ_ELEM_601
+#define _GMP_SEQ_ELEM_603(...) _GMP_SEQ_ELEM_602
+#define _GMP_SEQ_ELEM_604(...) _GMP_SEQ_ELEM_603
+#define _GMP_SEQ_ELEM_605(...) _GMP_SEQ_ELEM_604
+#define _GMP_SEQ_ELEM_606(...) _GMP_SEQ_ELEM_605
+#define _GMP_SEQ_ELEM_607(...) _GMP_SEQ_ELEM_606
+#define _GMP_SEQ_ELEM_608(...) _GMP_SEQ_ELEM_607
+#define _GMP_SEQ_ELEM_609(...) _GMP_SEQ_ELEM_608
+#define _GMP_SEQ_ELEM_610(...) _GMP_SEQ_ELEM_609
+#define _GMP_SEQ_ELEM_611(...) _GMP_SEQ_ELEM_610
+#define _GMP_SEQ_ELEM_612(...) _GMP_SEQ_ELEM_611
+#define _GMP_SEQ_ELEM_613(...) _GMP_SEQ_ELEM_612
+#define _GMP_SEQ_ELEM_614(...) _GMP_SEQ_ELEM_613
+#define _GMP_SEQ_ELEM_615(...) _GMP_SEQ_ELEM_614
+#define _GMP_SEQ_ELEM_616(...) _GMP_SEQ_ELEM_615
+#define _GMP_SEQ_ELEM_617(...) _GMP_SEQ_ELEM_616
+#define _GMP_SEQ_ELEM_618(...) _GMP_SEQ_ELEM_617
+#define _GMP_SEQ_ELEM_619(...) _GMP_SEQ_ELEM_618
+#define _GMP_SEQ_ELEM_620(...) _GMP_SEQ_ELEM_619
+#define _GMP_SEQ_ELEM_621(...) _GMP_SEQ_ELEM_620
+#define _GMP_SEQ_ELEM_622(...) _GMP_SEQ_ELEM_621
+#define _GMP_SEQ_ELEM_623(...) _GMP_SEQ_ELEM_622
+#define _GMP_SEQ_ELEM_624(...) _GMP_SEQ_ELEM_623
+#define _GMP_SEQ_ELEM_625(...) _GMP_SEQ_ELEM_624
+#define _GMP_SEQ_ELEM_626(...) _GMP_SEQ_ELEM_625
+#define _GMP_SEQ_ELEM_627(...) _GMP_SEQ_ELEM_626
+#define _GMP_SEQ_ELEM_628(...) _GMP_SEQ_ELEM_627
+#define _GMP_SEQ_ELEM_629(...) _GMP_SEQ_ELEM_628
+#define _GMP_SEQ_ELEM_630(...) _GMP_SEQ_ELEM_629
+#define _GMP_SEQ_ELEM_631(...) _GMP_SEQ_ELEM_630
+#define _GMP_SEQ_ELEM_632(...) _GMP_SEQ_ELEM_631
+#define _GMP_SEQ_ELEM_633(...) _GMP_SEQ_ELEM_632
+#define _GMP_SEQ_ELEM_634(...) _GMP_SEQ_ELEM_633
+#define _GMP_SEQ_ELEM_635(...) _GMP_SEQ_ELEM_634
+#define _GMP_SEQ_ELEM_636(...) _GMP_SEQ_ELEM_635
+#define _GMP_SEQ_ELEM_637(...) _GMP_SEQ_ELEM_636
+#define _GMP_SEQ_ELEM_638(...) _GMP_SEQ_ELEM_637
+#define _GMP_SEQ_ELEM_639(...) _GMP_SEQ_ELEM_638
+#define _GMP_SEQ_ELEM_640(...) _GMP_SEQ_ELEM_639
+#define _GMP_SEQ_ELEM_641(...) _GMP_SEQ_ELEM_640
+#define _GMP_SEQ_ELEM_642(...) _GMP_SEQ_ELEM_641
+#define _GMP_SEQ_ELEM_643(...) _GMP_SEQ_ELEM_642
+#define _GMP_SEQ_ELEM_644(...) _GMP_SEQ_ELEM_643
+#define _GMP_SEQ_ELEM_645(...) _GMP_SEQ_ELEM_644
+#define _GMP_SEQ_ELEM_646(...) _GMP_SEQ_ELEM_645
+#define _GMP_SEQ_ELEM_647(...) _GMP_SEQ_ELEM_646
+#define _GMP_SEQ_ELEM_648(...) _GMP_SEQ_ELEM_647
+#define _GMP_SEQ_ELEM_649(...) _GMP_SEQ_ELEM_648
+#define _GMP_SEQ_ELEM_650(...) _GMP_SEQ_ELEM_649
+#define _GMP_SEQ_ELEM_651(...) _GMP_SEQ_ELEM_650
+#define _GMP_SEQ_ELEM_652(...) _GMP_SEQ_ELEM_651
+#define _GMP_SEQ_ELEM_653(...) _GMP_SEQ_ELEM_652
+#define _GMP_SEQ_ELEM_654(...) _GMP_SEQ_ELEM_653
+#define _GMP_SEQ_ELEM_655(...) _GMP_SEQ_ELEM_654
+#define _GMP_SEQ_ELEM_656(...) _GMP_SEQ_ELEM_655
+#define _GMP_SEQ_ELEM_657(...) _GMP_SEQ_ELEM_656
+#define _GMP_SEQ_ELEM_658(...) _GMP_SEQ_ELEM_657
+#define _GMP_SEQ_ELEM_659(...) _GMP_SEQ_ELEM_658
+#define _GMP_SEQ_ELEM_660(...) _GMP_SEQ_ELEM_659
+#define _GMP_SEQ_ELEM_661(...) _GMP_SEQ_ELEM_660
+#define _GMP_SEQ_ELEM_662(...) _GMP_SEQ_ELEM_661
+#define _GMP_SEQ_ELEM_663(...) _GMP_SEQ_ELEM_662
+#define _GMP_SEQ_ELEM_664(...) _GMP_SEQ_ELEM_663
+#define _GMP_SEQ_ELEM_665(...) _GMP_SEQ_ELEM_664
+#define _GMP_SEQ_ELEM_666(...) _GMP_SEQ_ELEM_665
+#define _GMP_SEQ_ELEM_667(...) _GMP_SEQ_ELEM_666
+#define _GMP_SEQ_ELEM_668(...) _GMP_SEQ_ELEM_667
+#define _GMP_SEQ_ELEM_669(...) _GMP_SEQ_ELEM_668
+#define _GMP_SEQ_ELEM_670(...) _GMP_SEQ_ELEM_669
+#define _GMP_SEQ_ELEM_671(...) _GMP_SEQ_ELEM_670
+#define _GMP_SEQ_ELEM_672(...) _GMP_SEQ_ELEM_671
+#define _GMP_SEQ_ELEM_673(...) _GMP_SEQ_ELEM_672
+#define _GMP_SEQ_ELEM_674(...) _GMP_SEQ_ELEM_673
+#define _GMP_SEQ_ELEM_675(...) _GMP_SEQ_ELEM_674
+#define _GMP_SEQ_ELEM_676(...) _GMP_SEQ_ELEM_675
+#define _GMP_SEQ_ELEM_677(...) _GMP_SEQ_ELEM_676
+#define _GMP_SEQ_ELEM_678(...) _GMP_SEQ_ELEM_677
+#define _GMP_SEQ_ELEM_679(...) _GMP_SEQ_ELEM_678
+#define _GMP_SEQ_ELEM_680(...) _GMP_SEQ_ELEM_679
+#define _GMP_SEQ_ELEM_681(...) _GMP_SEQ_ELEM_680
+#define _GMP_SEQ_ELEM_682(...) _GMP_SEQ_ELEM_681
+#define _GMP_SEQ_ELEM_683(...) _GMP_SEQ_ELEM_682
+#define _GMP_SEQ_ELEM_684(...) _GMP_SEQ_ELEM_683
+#define _GMP_SEQ_ELEM_685(...) _GMP_SEQ_ELEM_684
+#define _GMP_SEQ_ELEM_686(...) _GMP_SEQ_ELEM_685
+#define _GMP_SEQ_ELEM_687(...) _GMP_SEQ_ELEM_686
+#define _GMP_SEQ_ELEM_688(...) _GMP_SEQ_ELEM_687
+#define _GMP_SEQ_ELEM_689(...) _GMP_SEQ_ELEM_688
+#define _GMP_SEQ_ELEM_690(...) _GMP_SEQ_ELEM_689
+#define _GMP_SEQ_ELEM_691(...) _GMP_SEQ_ELEM_690
+#define _GMP_SEQ_ELEM_692(...) _GMP_SEQ_ELEM_691
+#define _GMP_SEQ_ELEM_693(...) _GMP_SEQ_ELEM_692
+#define _GMP_SEQ_ELEM_694(...) _GMP_SEQ_ELEM_693
+#define _GMP_SEQ_ELEM_695(...) _GMP_SEQ_ELEM_694
+#define _GMP_SEQ_ELEM_696(...) _GMP_SEQ_ELEM_695
+#define _GMP_SEQ_ELEM_697(...) _GMP_SEQ_ELEM_696
+#define _GMP_SEQ_ELEM_698(...) _GMP_SEQ_ELEM_697
+#define _GMP_SEQ_ELEM_699(...) _GMP_SEQ_ELEM_698
+#define _GMP_SEQ_ELEM_700(...) _GMP_SEQ_ELEM_699
+#define _GMP_SEQ_ELEM_701(...) _GMP_SEQ_ELEM_700
+#define _GMP_SEQ_ELEM_702(...) _GMP_SEQ_ELEM_701
+#define _GMP_SEQ_ELEM_703(...) _GMP_SEQ_ELEM_702
+#define _GMP_SEQ_ELEM_704(...) _GMP_SEQ_ELEM_703
+#define _GMP_SEQ_ELEM_705(...) _GMP_SEQ_ELEM_704
+#define _GMP_SEQ_ELEM_706(...) _GMP_SEQ_ELEM_705
+#define _GMP_SEQ_ELEM_707(...) _GMP_SEQ_ELEM_706
+#define _GMP_SEQ_ELEM_708(...) _GMP_SEQ_ELEM_707
+#define _GMP_SEQ_ELEM_709(...) _GMP_SEQ_ELEM_708
+#define _GMP_SEQ_ELEM_710(...) _GMP_SEQ_ELEM_709
+#define _GMP_SEQ_ELEM_711(...) _GMP_SEQ_ELEM_710
+#define _GMP_SEQ_ELEM_712(...) _GMP_SEQ_ELEM_711
+#define _GMP_SEQ_ELEM_713(...) _GMP_SEQ_ELEM_712
+#define _GMP_SEQ_ELEM_714(...) _GMP_SEQ_ELEM_713
+#define _GMP_SEQ_ELEM_715(...) _GMP_SEQ_ELEM_714
+#define _GMP_SEQ_ELEM_716(...) _GMP_SEQ_ELEM_715
+#define _GMP_SEQ_ELEM_717(...) _GMP_SEQ_ELEM_716
+#define _GMP_SEQ_ELEM_718(...) _GMP_SEQ_ELEM_717
+#define _GMP_SEQ_ELEM_719(...) _GMP_SEQ_ELEM_718
+#define _GMP_SEQ_ELEM_720(...) _GMP_SEQ_ELEM_719
+#define _GMP_SEQ_ELEM_721(...) _GMP_SEQ_ELEM_720
+#define _GMP_SEQ_ELEM_722(...) _GMP_SEQ_ELEM_721
+#define _GMP_SEQ_ELEM_723(...) _GMP_SEQ_ELEM_722
+#define _GMP_SEQ_ELEM_724(...) _GMP_SEQ_ELEM_723
+#define _GMP_SEQ_ELEM_725(...) _GMP_SEQ_ELEM_724
+#define _GMP_SEQ_ELEM_726(...) _GMP_SEQ_ELEM_725
+#define _GMP_SEQ_ELEM_727(...) _GMP_SEQ_ELEM_726
+#define _GMP_SEQ_ELEM_728(...) _GMP_SEQ_ELEM_727
+#define _GMP_SEQ_ELEM_729(...) _GMP_SEQ_ELEM_728
+#define _GMP_SEQ_ELEM_730(...) _GMP_SEQ_ELEM_729
+#define _GMP_SEQ_ELEM_731(...) _GMP_SEQ_ELEM_730
+#define _GMP_SEQ_ELEM_732(...) _GMP_SEQ_ELEM_731
+#define _GMP_SEQ_ELEM_733(...) _GMP_SEQ_ELEM_732
+#define _GMP_SEQ_ELEM_734(...) _GMP_SEQ_ELEM_733
+#define _GMP_SEQ_ELEM_735(...) _GMP_SEQ_ELEM_734
+#define _GMP_SEQ_ELEM_736(...) _GMP_SEQ_ELEM_735
+#define _GMP_SEQ_ELEM_737(...) _GMP_SEQ_ELEM_736
+#define _GMP_SEQ_ELEM_738(...) _GMP_SEQ_ELEM_737
+#define _GMP_SEQ_ELEM_739(...) _GMP_SEQ_ELEM_738
+#define _GMP_SEQ_ELEM_740(...) _GMP_SEQ_ELEM_739
+#define _GMP_SEQ_ELEM_741(...) _GMP_SEQ_ELEM_740
+#define _GMP_SEQ_ELEM_742(...) _GMP_SEQ_ELEM_741
+#define _GMP_SEQ_ELEM_743(...) _GMP_SEQ_ELEM_742
+#define _GMP_SEQ_ELEM_744(...) _GMP_SEQ_ELEM_743
+#define _GMP_SEQ_ELEM_745(...) _GMP_SEQ_ELEM_744
+#define _GMP_SEQ_ELEM_746(...) _GMP_SEQ_ELEM_745
+#define _GMP_SEQ_ELEM_747(...) _GMP_SEQ_ELEM_746
+#define _GMP_SEQ_ELEM_748(...) _GMP_SEQ_ELEM_747
+#define _GMP_SEQ_ELEM_749(...) _GMP_SEQ_ELEM_748
+#define _GMP_SEQ_ELEM_750(...) _GMP_SEQ_ELEM_749
+#define _GMP_SEQ_ELEM_751(...) _GMP_SEQ_ELEM_750
+#define _GMP_SEQ_ELEM_752(...) _GMP_SEQ_ELEM_751
+#define _GMP_SEQ_ELEM_753(...) _GMP_SEQ_ELEM_752
+#define _GMP_SEQ_ELEM_754(...) _GMP_SEQ_ELEM_753
+#define _GMP_SEQ_ELEM_755(...) _GMP_SEQ_ELEM_754
+#define _GMP_SEQ_ELEM_756(...) _GMP_SEQ_ELEM_755
+#define _GMP_SEQ_ELEM_757(...) _GMP_SEQ_ELEM_756
+#define _GMP_SEQ_ELEM_758(...) _GMP_SEQ_ELEM_757
+#define _GMP_SEQ_ELEM_759(...) _GMP_SEQ_ELEM_758
+#define _GMP_SEQ_ELEM_760(...) _GMP_SEQ_ELEM_759
+#define _GMP_SEQ_ELEM_761(...) _GMP_SEQ_ELEM_760
+#define _GMP_SEQ_ELEM_762(...) _GMP_SEQ_ELEM_761
+#define _GMP_SEQ_ELEM_763(...) _GMP_SEQ_ELEM_762
+#define _GMP_SEQ_ELEM_764(...) _GMP_SEQ_ELEM_763
+#define _GMP_SEQ_ELEM_765(...) _GMP_SEQ_ELEM_764
+#define _GMP_SEQ_ELEM_766(...) _GMP_SEQ_ELEM_765
+#define _GMP_SEQ_ELEM_767(...) _GMP_SEQ_ELEM_766
+#define _GMP_SEQ_ELEM_768(...) _GMP_SEQ_ELEM_767
+#define _GMP_SEQ_ELEM_769(...) _GMP_SEQ_ELEM_768
+#define _GMP_SEQ_ELEM_770(...) _GMP_SEQ_ELEM_769
+#define _GMP_SEQ_ELEM_771(...) _GMP_SEQ_ELEM_770
+#define _GMP_SEQ_ELEM_772(...) _GMP_SEQ_ELEM_771
+#define _GMP_SEQ_ELEM_773(...) _GMP_SEQ_ELEM_772
+#define _GMP_SEQ_ELEM_774(...) _GMP_SEQ_ELEM_773
+#define _GMP_SEQ_ELEM_775(...) _GMP_SEQ_ELEM_774
+#define _GMP_SEQ_ELEM_776(...) _GMP_SEQ_ELEM_775
+#define _GMP_SEQ_ELEM_777(...) _GMP_SEQ_ELEM_776
+#define _GMP_SEQ_ELEM_778(...) _GMP_SEQ_ELEM_777
+#define _GMP_SEQ_ELEM_779(...) _GMP_SEQ_ELEM_778
+#define _GMP_SEQ_ELEM_780(...) _GMP_SEQ_ELEM_779
+#define _GMP_SEQ_ELEM_781(...) _GMP_SEQ_ELEM_780
+#define _GMP_SEQ_ELEM_782(...) _GMP_SEQ_ELEM_781
+#define _GMP_SEQ_ELEM_783(...) _GMP_SEQ_ELEM_782
+#define _GMP_SEQ_ELEM_784(...) _GMP_SEQ_ELEM_783
+#define _GMP_SEQ_ELEM_785(...) _GMP_SEQ_ELEM_784
+#define _GMP_SEQ_ELEM_786(...) _GMP_SEQ_ELEM_785
+#define _GMP_SEQ_ELEM_787(...) _GMP_SEQ_ELEM_786
+#define _GMP_SEQ_ELEM_788(...) _GMP_SEQ_ELEM_787
+#define _GMP_SEQ_ELEM_789(...) _GMP_SEQ_ELEM_788
+#define _GMP_SEQ_ELEM_790(...) _GMP_SEQ_ELEM_789
+#define _GMP_SEQ_ELEM_791(...) _GMP_SEQ_ELEM_790
+#define _GMP_SEQ_ELEM_792(...) _GMP_SEQ_ELEM_791
+#define _GMP_SEQ_ELEM_793(...) _GMP_SEQ_ELEM_792
+#define _GMP_SEQ_ELEM_794(...) _GMP_SEQ_ELEM_793
+#define _GMP_SEQ_ELEM_795(...) _GMP_SEQ_ELEM_794
+#define _GMP_SEQ_ELEM_796(...) _GMP_SEQ_ELEM_795
+#define _GMP_SEQ_ELEM_797(...) _GMP_SEQ_ELEM_796
+#define _GMP_SEQ_ELEM_798(...) _GMP_SEQ_ELEM_797
+#define _GMP_SEQ_ELEM_799(...) _GMP_SEQ_ELEM_798
+#define _GMP_SEQ_ELEM_800(...) _GMP_SEQ_ELEM_799
+#define _GMP_SEQ_ELEM_801(...) _GMP_SEQ_ELEM_800
+#define _GMP_SEQ_ELEM_802(...) _GMP_SEQ_ELEM_801
+#define _GMP_SEQ_ELEM_803(...) _GMP_SEQ_ELEM_802
+#define _GMP_SEQ_ELEM_804(...) _GMP_SEQ_ELEM_803
+#define _GMP_SEQ_ELEM_805(...) _GMP_SEQ_ELEM_804
+#define _GMP_SEQ_ELEM_806(...) _GMP_SEQ_ELEM_805
+#define _GMP_SEQ_ELEM_807(...) _GMP_SEQ_ELEM_806
+#define _GMP_SEQ_ELEM_808(...) _GMP_SEQ_ELEM_807
+#define _GMP_SEQ_ELEM_809(...) _GMP_SEQ_ELEM_808
+#define _GMP_SEQ_ELEM_810(...) _GMP_SEQ_ELEM_809
+#define _GMP_SEQ_ELEM_811(...) _GMP_SEQ_ELEM_810
+#define _GMP_SEQ_ELEM_812(...) _GMP_SEQ_ELEM_811
+#define _GMP_SEQ_ELEM_813(...) _GMP_SEQ_ELEM_812
+#define _GMP_SEQ_ELEM_814(...) _GMP_SEQ_ELEM_813
+#define _GMP_SEQ_ELEM_815(...) _GMP_SEQ_ELEM_814
+#define _GMP_SEQ_ELEM_816(...) _GMP_SEQ_ELEM_815
+#define _GMP_SEQ_ELEM_817(...) _GMP_SEQ_ELEM_816
+#define _GMP_SEQ_ELEM_818(...) _GMP_SEQ_ELEM_817
+#define _GMP_SEQ_ELEM_819(...) _GMP_SEQ_ELEM_818
+#define _GMP_SEQ_ELEM_820(...) _GMP_SEQ_ELEM_819
+#define _GMP_SEQ_ELEM_821(...) _GMP_SEQ_ELEM_820
+#define _GMP_SEQ_ELEM_822(...) _GMP_SEQ_ELEM_821
+#define _GMP_SEQ_ELEM_823(...) _GMP_SEQ_ELEM_822
+#define _GMP_SEQ_ELEM_824(...) _GMP_SEQ_ELEM_823
+#define _GMP_SEQ_ELEM_825(...) _GMP_SEQ_ELEM_824
+#define _GMP_SEQ_ELEM_826(...) _GMP_SEQ_ELEM_825
+#define _GMP_SEQ_ELEM_827(...) _GMP_SEQ_ELEM_826
+#define _GMP_SEQ_ELEM_828(...) _GMP_SEQ_ELEM_827
+#define _GMP_SEQ_ELEM_829(...) _GMP_SEQ_ELEM_828
+#define _GMP_SEQ_ELEM_830(...) _GMP_SEQ_ELEM_829
+#define _GMP_SEQ_ELEM_831(...) _GMP_SEQ_ELEM_830
+#define _GMP_SEQ_ELEM_832(...) _GMP_SEQ_ELEM_831
+#define _GMP_SEQ_ELEM_833(...) _GMP_SEQ_ELEM_832
+#define _GMP_SEQ_ELEM_834(...) _GMP_SEQ_ELEM_833
+#define _GMP_SEQ_ELEM_835(...) _GMP_SEQ_ELEM_834
+#define _GMP_SEQ_ELEM_836(...) _GMP_SEQ_ELEM_835
+#define _GMP_SEQ_ELEM_837(...) _GMP_SEQ_ELEM_836
+#define _GMP_SEQ_ELEM_838(...) _GMP_SEQ_ELEM_837
+#define _GMP_SEQ_ELEM_839(...) _GMP_SEQ_ELEM_838
+#define _GMP_SEQ_ELEM_840(...) _GMP_SEQ_ELEM_839
+#define _GMP_SEQ_ELEM_841(...) _GMP_SEQ_ELEM_840
+#define _GMP_SEQ_ELEM_842(...) _GMP_SEQ_ELEM_841
+#define _GMP_SEQ_ELEM_843(...) _GMP_SEQ_ELEM_842
+#define _GMP_SEQ_ELEM_844(...) _GMP_SEQ_ELEM_843
+#define _GMP_SEQ_ELEM_845(...) _GMP_SEQ_ELEM_844
+#define _GMP_SEQ_ELEM_846(...) _GMP_SEQ_ELEM_845
+#define _GMP_SEQ_ELEM_847(...) _GMP_SEQ_ELEM_846
+#define _GMP_SEQ_ELEM_848(...) _GMP_SEQ_ELEM_847
+#define _GMP_SEQ_ELEM_849(...) _GMP_SEQ_ELEM_848
+#define _GMP_SEQ_ELEM_850(...) _GMP_SEQ_ELEM_849
+#define _GMP_SEQ_ELEM_851(...) _GMP_SEQ_ELEM_850
+#define _GMP_SEQ_ELEM_852(...) _GMP_SEQ_ELEM_851
+#define _GMP_SEQ_ELEM_853(...) _GMP_SEQ_ELEM_852
+#define _GMP_SEQ_ELEM_854(...) _GMP_SEQ_ELEM_853
+#define _GMP_SEQ_ELEM_855(...) _GMP_SEQ_ELEM_854
+#define _GMP_SEQ_ELEM_856(...) _GMP_SEQ_ELEM_855
+#define _GMP_SEQ_ELEM_857(...) _GMP_SEQ_ELEM_856
+#define _GMP_SEQ_ELEM_858(...) _GMP_SEQ_ELEM_857
+#define _GMP_SEQ_ELEM_859(...) _GMP_SEQ_ELEM_858
+#define _GMP_SEQ_ELEM_860(...) _GMP_SEQ_ELEM_859
+#define _GMP_SEQ_ELEM_861(...) _GMP_SEQ_ELEM_860
+#define _GMP_SEQ_ELEM_862(...) _GMP_SEQ_ELEM_861
+#define _GMP_SEQ_ELEM_863(...) _GMP_SEQ_ELEM_862
+#define _GMP_SEQ_ELEM_864(...) _GMP_SEQ_ELEM_863
+#define _GMP_SEQ_ELEM_865(...) _GMP_SEQ_ELEM_864
+#define _GMP_SEQ_ELEM_866(...) _GMP_SEQ_ELEM_865
+#define _GMP_SEQ_ELEM_867(...) _GMP_SEQ_ELEM_866
+#define _GMP_SEQ_ELEM_868(...) _GMP_SEQ_ELEM_867
+#define _GMP_SEQ_ELEM_869(...) _GMP_SEQ_ELEM_868
+#define _GMP_SEQ_ELEM_870(...) _GMP_SEQ_ELEM_869
+#define _GMP_SEQ_ELEM_871(...) _GMP_SEQ_ELEM_870
+#define _GMP_SEQ_ELEM_872(...) _GMP_SEQ_ELEM_871
+#define _GMP_SEQ_ELEM_873(...) _GMP_SEQ_ELEM_872
+#define _GMP_SEQ_ELEM_874(...) _GMP_SEQ_ELEM_873
+#define _GMP_SEQ_ELEM_875(...) _GMP_SEQ_ELEM_874
+#define _GMP_SEQ_ELEM_876(...) _GMP_SEQ_ELEM_875
+#define _GMP_SEQ_ELEM_877(...) _GMP_SEQ_ELEM_876
+#define _GMP_SEQ_ELEM_878(...) _GMP_SEQ_ELEM_877
+#define _GMP_SEQ_ELEM_879(...) _GMP_SEQ_ELEM_878
+#define _GMP_SEQ_ELEM_880(...) _GMP_SEQ_ELEM_879
+#define _GMP_SEQ_ELEM_881(...) _GMP_SEQ_ELEM_880
+#define _GMP_SEQ_ELEM_882(...) _GMP_SEQ_ELEM_881
+#define _GMP_SEQ_ELEM_883(...) _GMP_SEQ_ELEM_882
+#define _GMP_SEQ_ELEM_884(...) _GMP_SEQ_ELEM_883
+#define _GMP_SEQ_ELEM_885(...) _GMP_SEQ_ELEM_884
+#define _GMP_SEQ_ELEM_886(...) _GMP_SEQ_ELEM_885
+#define _GMP_SEQ_ELEM_887(...) _GMP_SEQ_ELEM_886
+#define _GMP_SEQ_ELEM_888(...) _GMP_SEQ_ELEM_887
+#define _GMP_SEQ_ELEM_889(...) _GMP_SEQ_ELEM_888
+#define _GMP_SEQ_ELEM_890(...) _GMP_SEQ_ELEM_889
+#define _GMP_SEQ_ELEM_891(...) _GMP_SEQ_ELEM_890
+#define _GMP_SEQ_ELEM_892(...) _GMP_SEQ_ELEM_891
+#define _GMP_SEQ_ELEM_893(...) _GMP_SEQ_ELEM_892
+#define _GMP_SEQ_ELEM_894(...) _GMP_SEQ_ELEM_893
+#define _GMP_SEQ_ELEM_895(...) _GMP_SEQ_ELEM_894
+#define _GMP_SEQ_ELEM_896(...) _GMP_SEQ_ELEM_895
+#define _GMP_SEQ_ELEM_897(...) _GMP_SEQ_ELEM_896
+#define _GMP_SEQ_ELEM_898(...) _GMP_SEQ_ELEM_897
+#define _GMP_SEQ_ELEM_899(...) _GMP_SEQ_ELEM_898
+#define _GMP_SEQ_ELEM_900(...) _GMP_SEQ_ELEM_899
+#define _GMP_SEQ_ELEM_901(...) _GMP_SEQ_ELEM_900
+#define _GMP_SEQ_ELEM_902(...) _GMP_SEQ_ELEM_901
+#define _GMP_SEQ_ELEM_903(...) _GMP_SEQ_ELEM_902
+#define _GMP_SEQ_ELEM_904(...) _GMP_SEQ_ELEM_903
+#define _GMP_SEQ_ELEM_905(...) _GMP_SEQ_ELEM_904
+#define _GMP_SEQ_ELEM_906(...) _GMP_SEQ_ELEM_905
+#define _GMP_SEQ_ELEM_907(...) _GMP_SEQ_ELEM_906
+#define _GMP_SEQ_ELEM_908(...) _GMP_SEQ_ELEM_907
+#define _GMP_SEQ_ELEM_909(...) _GMP_SEQ_ELEM_908
+#define _GMP_SEQ_ELEM_910(...) _GMP_SEQ_ELEM_909
+#define _GMP_SEQ_ELEM_911(...) _GMP_SEQ_ELEM_910
+#define _GMP_SEQ_ELEM_912(...) _GMP_SEQ_ELEM_911
+#define _GMP_SEQ_ELEM_913(...) _GMP_SEQ_ELEM_912
+#define _GMP_SEQ_ELEM_914(...) _GMP_SEQ_ELEM_913
+#define _GMP_SEQ_ELEM_915(...) _GMP_SEQ_ELEM_914
+#define _GMP_SEQ_ELEM_916(...) _GMP_SEQ_ELEM_915
+#define _GMP_SEQ_ELEM_917(...) _GMP_SEQ_ELEM_916
+#define _GMP_SEQ_ELEM_918(...) _GMP_SEQ_ELEM_917
+#define _GMP_SEQ_ELEM_919(...) _GMP_SEQ_ELEM_918
+#define _GMP_SEQ_ELEM_920(...) _GMP_SEQ_ELEM_919
+#define _GMP_SEQ_ELEM_921(...) _GMP_SEQ_ELEM_920
+#define _GMP_SEQ_ELEM_922(...) _GMP_SEQ_ELEM_921
+#define _GMP_SEQ_ELEM_923(...) _GMP_SEQ_ELEM_922
+#define _GMP_SEQ_ELEM_924(...) _GMP_SEQ_ELEM_923
+#define _GMP_SEQ_ELEM_925(...) _GMP_SEQ_ELEM_924
+#define _GMP_SEQ_ELEM_926(...) _GMP_SEQ_ELEM_925
+#define _GMP_SEQ_ELEM_927(...) _GMP_SEQ_ELEM_926
+#define _GMP_SEQ_ELEM_928(...) _GMP_SEQ_ELEM_927
+#define _GMP_SEQ_ELEM_929(...) _GMP_SEQ_ELEM_928
+#define _GMP_SEQ_ELEM_930(...) _GMP_SEQ_ELEM_929
+#define _GMP_SEQ_ELEM_931(...) _GMP_SEQ_ELEM_930
+#define _GMP_SEQ_ELEM_932(...) _GMP_SEQ_ELEM_931
+#define _GMP_SEQ_ELEM_933(...) _GMP_SEQ_ELEM_932
+#define _GMP_SEQ_ELEM_934(...) _GMP_SEQ_ELEM_933
+#define _GMP_SEQ_ELEM_935(...) _GMP_SEQ_ELEM_934
+#define _GMP_SEQ_ELEM_936(...) _GMP_SEQ_ELEM_935
+#define _GMP_SEQ_ELEM_937(...) _GMP_SEQ_ELEM_936
+#define _GMP_SEQ_ELEM_938(...) _GMP_SEQ_ELEM_937
+#define _GMP_SEQ_ELEM_939(...) _GMP_SEQ_ELEM_938
+#define _GMP_SEQ_ELEM_940(...) _GMP_SEQ_ELEM_939
+#define _GMP_SEQ_ELEM_941(...) _GMP_SEQ_ELEM_940
+#define _GMP_SEQ_ELEM_942(...) _GMP_SEQ_ELEM_941
+#define _GMP_SEQ_ELEM_943(...) _GMP_SEQ_ELEM_942
+#define _GMP_SEQ_ELEM_944(...) _GMP_SEQ_ELEM_943
+#define _GMP_SEQ_ELEM_945(...) _GMP_SEQ_ELEM_944
+#define _GMP_SEQ_ELEM_946(...) _GMP_SEQ_ELEM_945
+#define _GMP_SEQ_ELEM_947(...) _GMP_SEQ_ELEM_946
+#define _GMP_SEQ_ELEM_948(...) _GMP_SEQ_ELEM_947
+#define _GMP_SEQ_ELEM_949(...) _GMP_SEQ_ELEM_948
+#define _GMP_SEQ_ELEM_950(...) _GMP_SEQ_ELEM_949
+#define _GMP_SEQ_ELEM_951(...) _GMP_SEQ_ELEM_950
+#define _GMP_SEQ_ELEM_952(...) _GMP_SEQ_ELEM_951
+#define _GMP_SEQ_ELEM_953(...) _GMP_SEQ_ELEM_952
+#define _GMP_SEQ_ELEM_954(...) _GMP_SEQ_ELEM_953
+#define _GMP_SEQ_ELEM_955(...) _GMP_SEQ_ELEM_954
+#define _GMP_SEQ_ELEM_956(...) _GMP_SEQ_ELEM_955
+#define _GMP_SEQ_ELEM_957(...) _GMP_SEQ_ELEM_956
+#define _GMP_SEQ_ELEM_958(...) _GMP_SEQ_ELEM_957
+#define _GMP_SEQ_ELEM_959(...) _GMP_SEQ_ELEM_958
+#define _GMP_SEQ_ELEM_960(...) _GMP_SEQ_ELEM_959
+#define _GMP_SEQ_ELEM_961(...) _GMP_SEQ_ELEM_960
+#define _GMP_SEQ_ELEM_962(...) _GMP_SEQ_ELEM_961
+#define _GMP_SEQ_ELEM_963(...) _GMP_SEQ_ELEM_962
+#define _GMP_SEQ_ELEM_964(...) _GMP_SEQ_ELEM_963
+#define _GMP_SEQ_ELEM_965(...) _GMP_SEQ_ELEM_964
+#define _GMP_SEQ_ELEM_966(...) _GMP_SEQ_ELEM_965
+#define _GMP_SEQ_ELEM_967(...) _GMP_SEQ_ELEM_966
+#define _GMP_SEQ_ELEM_968(...) _GMP_SEQ_ELEM_967
+#define _GMP_SEQ_ELEM_969(...) _GMP_SEQ_ELEM_968
+#define _GMP_SEQ_ELEM_970(...) _GMP_SEQ_ELEM_969
+#define _GMP_SEQ_ELEM_971(...) _GMP_SEQ_ELEM_970
+#define _GMP_SEQ_ELEM_972(...) _GMP_SEQ_ELEM_971
+#define _GMP_SEQ_ELEM_973(...) _GMP_SEQ_ELEM_972
+#define _GMP_SEQ_ELEM_974(...) _GMP_SEQ_ELEM_973
+#define _GMP_SEQ_ELEM_975(...) _GMP_SEQ_ELEM_974
+#define _GMP_SEQ_ELEM_976(...) _GMP_SEQ_ELEM_975
+#define _GMP_SEQ_ELEM_977(...) _GMP_SEQ_ELEM_976
+#define _GMP_SEQ_ELEM_978(...) _GMP_SEQ_ELEM_977
+#define _GMP_SEQ_ELEM_979(...) _GMP_SEQ_ELEM_978
+#define _GMP_SEQ_ELEM_980(...) _GMP_SEQ_ELEM_979
+#define _GMP_SEQ_ELEM_981(...) _GMP_SEQ_ELEM_980
+#define _GMP_SEQ_ELEM_982(...) _GMP_SEQ_ELEM_981
+#define _GMP_SEQ_ELEM_983(...) _GMP_SEQ_ELEM_982
+#define _GMP_SEQ_ELEM_984(...) _GMP_SEQ_ELEM_983
+#define _GMP_SEQ_ELEM_985(...) _GMP_SEQ_ELEM_984
+#define _GMP_SEQ_ELEM_986(...) _GMP_SEQ_ELEM_985
+#define _GMP_SEQ_ELEM_987(...) _GMP_SEQ_ELEM_986
+#define _GMP_SEQ_ELEM_988(...) _GMP_SEQ_ELEM_987
+#define _GMP_SEQ_ELEM_989(...) _GMP_SEQ_ELEM_988
+#define _GMP_SEQ_ELEM_990(...) _GMP_SEQ_ELEM_989
+#define _GMP_SEQ_ELEM_991(...) _GMP_SEQ_ELEM_990
+#define _GMP_SEQ_ELEM_992(...) _GMP_SEQ_ELEM_991
+#define _GMP_SEQ_ELEM_993(...) _GMP_SEQ_ELEM_992
+#define _GMP_SEQ_ELEM_994(...) _GMP_SEQ_ELEM_993
+#define _GMP_SEQ_ELEM_995(...) _GMP_SEQ_ELEM_994
+#define _GMP_SEQ_ELEM_996(...) _GMP_SEQ_ELEM_995
+#define _GMP_SEQ_ELEM_997(...) _GMP_SEQ_ELEM_996
+#define _GMP_SEQ_ELEM_998(...) _GMP_SEQ_ELEM_997
+#define _GMP_SEQ_ELEM_999(...) _GMP_SEQ_ELEM_998
+#define _GMP_SEQ_ELEM_1000(...) _GMP_SEQ_ELEM_999
+#define _GMP_SEQ_ELEM_1001(...) _GMP_SEQ_ELEM_1000
+#define _GMP_SEQ_ELEM_1002(...) _GMP_SEQ_ELEM_1001
+#define _GMP_SEQ_ELEM_1003(...) _GMP_SEQ_ELEM_1002
+#define _GMP_SEQ_ELEM_1004(...) _GMP_SEQ_ELEM_1003
+#define _GMP_SEQ_ELEM_1005(...) _GMP_SEQ_ELEM_1004
+#define _GMP_SEQ_ELEM_1006(...) _GMP_SEQ_ELEM_1005
+#define _GMP_SEQ_ELEM_1007(...) _GMP_SEQ_ELEM_1006
+#define _GMP_SEQ_ELEM_1008(...) _GMP_SEQ_ELEM_1007
+#define _GMP_SEQ_ELEM_1009(...) _GMP_SEQ_ELEM_1008
+#define _GMP_SEQ_ELEM_1010(...) _GMP_SEQ_ELEM_1009
+#define _GMP_SEQ_ELEM_1011(...) _GMP_SEQ_ELEM_1010
+#define _GMP_SEQ_ELEM_1012(...) _GMP_SEQ_ELEM_1011
+#define _GMP_SEQ_ELEM_1013(...) _GMP_SEQ_ELEM_1012
+#define _GMP_SEQ_ELEM_1014(...) _GMP_SEQ_ELEM_1013
+#define _GMP_SEQ_ELEM_1015(...) _GMP_SEQ_ELEM_1014
+#define _GMP_SEQ_ELEM_1016(...) _GMP_SEQ_ELEM_1015
+#define _GMP_SEQ_ELEM_1017(...) _GMP_SEQ_ELEM_1016
+#define _GMP_SEQ_ELEM_1018(...) _GMP_SEQ_ELEM_1017
+#define _GMP_SEQ_ELEM_1019(...) _GMP_SEQ_ELEM_1018
+#define _GMP_SEQ_ELEM_1020(...) _GMP_SEQ_ELEM_1019
+#define _GMP_SEQ_ELEM_1021(...) _GMP_SEQ_ELEM_1020
+#define _GMP_SEQ_ELEM_1022(...) _GMP_SEQ_ELEM_1021
+#define _GMP_SEQ_ELEM_1023(...) _GMP_SEQ_ELEM_1022
+
+// GMP_SEQ_FOR_EACH and GMP_SEQ_FOLD
+#define _GMP_SEQ_INDEX_0(...) 0, __VA_ARGS__) _GMP_SEQ_INDEX_1
+#define _GMP_SEQ_INDEX_1(...) 1, __VA_ARGS__) _GMP_SEQ_INDEX_2
+#define _GMP_SEQ_INDEX_2(...) 2, __VA_ARGS__) _GMP_SEQ_INDEX_3
+#define _GMP_SEQ_INDEX_3(...) 3, __VA_ARGS__) _GMP_SEQ_INDEX_4
+#define _GMP_SEQ_INDEX_4(...) 4, __VA_ARGS__) _GMP_SEQ_INDEX_5
+#define _GMP_SEQ_INDEX_5(...) 5, __VA_ARGS__) _GMP_SEQ_INDEX_6
+#define _GMP_SEQ_INDEX_6(...) 6, __VA_ARGS__) _GMP_SEQ_INDEX_7
+#define _GMP_SEQ_INDEX_7(...) 7, __VA_ARGS__) _GMP_SEQ_INDEX_8
+#define _GMP_SEQ_INDEX_8(...) 8, __VA_ARGS__) _GMP_SEQ_INDEX_9
+#define _GMP_SEQ_INDEX_9(...) 9, __VA_ARGS__) _GMP_SEQ_INDEX_10
+#define _GMP_SEQ_INDEX_10(...) 10, __VA_ARGS__) _GMP_SEQ_INDEX_11
+#define _GMP_SEQ_INDEX_11(...) 11, __VA_ARGS__) _GMP_SEQ_INDEX_12
+#define _GMP_SEQ_INDEX_12(...) 12, __VA_ARGS__) _GMP_SEQ_INDEX_13
+#define _GMP_SEQ_INDEX_13(...) 13, __VA_ARGS__) _GMP_SEQ_INDEX_14
+#define _GMP_SEQ_INDEX_14(...) 14, __VA_ARGS__) _GMP_SEQ_INDEX_15
+#define _GMP_SEQ_INDEX_15(...) 15, __VA_ARGS__) _GMP_SEQ_INDEX_16
+#define _GMP_SEQ_INDEX_16(...) 16, __VA_ARGS__) _GMP_SEQ_INDEX_17
+#define _GMP_SEQ_INDEX_17(...) 17, __VA_ARGS__) _GMP_SEQ_INDEX_18
+#define _GMP_SEQ_INDEX_18(...) 18, __VA_ARGS__) _GMP_SEQ_INDEX_19
+#define _GMP_SEQ_INDEX_19(...) 19, __VA_ARGS__) _GMP_SEQ_INDEX_20
+#define _GMP_SEQ_INDEX_20(...) 20, __VA_ARGS__) _GMP_SEQ_INDEX_21
+#define _GMP_SEQ_INDEX_21(...) 21, __VA_ARGS__) _GMP_SEQ_INDEX_22
+#define _GMP_SEQ_INDEX_22(...) 22, __VA_ARGS__) _GMP_SEQ_INDEX_23
+#define _GMP_SEQ_INDEX_23(...) 23, __VA_ARGS__) _GMP_SEQ_INDEX_24
+#define _GMP_SEQ_INDEX_24(...) 24, __VA_ARGS__) _GMP_SEQ_INDEX_25
+#define _GMP_SEQ_INDEX_25(...) 25, __VA_ARGS__) _GMP_SEQ_INDEX_26
+#define _GMP_SEQ_INDEX_26(...) 26, __VA_ARGS__) _GMP_SEQ_INDEX_27
+#define _GMP_SEQ_INDEX_27(...) 27, __VA_ARGS__) _GMP_SEQ_INDEX_28
+#define _GMP_SEQ_INDEX_28(...) 28, __VA_ARGS__) _GMP_SEQ_INDEX_29
+#define _GMP_SEQ_INDEX_29(...) 29, __VA_ARGS__) _GMP_SEQ_INDEX_30
+#define _GMP_SEQ_INDEX_30(...) 30, __VA_ARGS__) _GMP_SEQ_INDEX_31
+#define _GMP_SEQ_INDEX_31(...) 31, __VA_ARGS__) _GMP_SEQ_INDEX_32
+#define _GMP_SEQ_INDEX_32(...) 32, __VA_ARGS__) _GMP_SEQ_INDEX_33
+#define _GMP_SEQ_INDEX_33(...) 33, __VA_ARGS__) _GMP_SEQ_INDEX_34
+#define _GMP_SEQ_INDEX_34(...) 34, __VA_ARGS__) _GMP_SEQ_INDEX_35
+#define _GMP_SEQ_INDEX_35(...) 35, __VA_ARGS__) _GMP_SEQ_INDEX_36
+#define _GMP_SEQ_INDEX_36(...) 36, __VA_ARGS__) _GMP_SEQ_INDEX_37
+#define _GMP_SEQ_INDEX_37(...) 37, __VA_ARGS__) _GMP_SEQ_INDEX_38
+#define _GMP_SEQ_INDEX_38(...) 38, __VA_ARGS__) _GMP_SEQ_INDEX_39
+#define _GMP_SEQ_INDEX_39(...) 39, __VA_ARGS__) _GMP_SEQ_INDEX_40
+#define _GMP_SEQ_INDEX_40(...) 40, __VA_ARGS__) _GMP_SEQ_INDEX_41
+#define _GMP_SEQ_INDEX_41(...) 41, __VA_ARGS__) _GMP_SEQ_INDEX_42
+#define _GMP_SEQ_INDEX_42(...) 42, __VA_ARGS__) _GMP_SEQ_INDEX_43
+#define _GMP_SEQ_INDEX_43(...) 43, __VA_ARGS__) _GMP_SEQ_INDEX_44
+#define _GMP_SEQ_INDEX_44(...) 44, __VA_ARGS__) _GMP_SEQ_INDEX_45
+#define _GMP_SEQ_INDEX_45(...) 45, __VA_ARGS__) _GMP_SEQ_INDEX_46
+#define _GMP_SEQ_INDEX_46(...) 46, __VA_ARGS__) _GMP_SEQ_INDEX_47
+#define _GMP_SEQ_INDEX_47(...) 47, __VA_ARGS__) _GMP_SEQ_INDEX_48
+#define _GMP_SEQ_INDEX_48(...) 48, __VA_ARGS__) _GMP_SEQ_INDEX_49
+#define _GMP_SEQ_INDEX_49(...) 49, __VA_ARGS__) _GMP_SEQ_INDEX_50
+#define _GMP_SEQ_INDEX_50(...) 50, __VA_ARGS__) _GMP_SEQ_INDEX_51
+#define _GMP_SEQ_INDEX_51(...) 51, __VA_ARGS__) _GMP_SEQ_INDEX_52
+#define _GMP_SEQ_INDEX_52(...) 52, __VA_ARGS__) _GMP_SEQ_INDEX_53
+#define _GMP_SEQ_INDEX_53(...) 53, __VA_ARGS__) _GMP_SEQ_INDEX_54
+#define _GMP_SEQ_INDEX_54(...) 54, __VA_ARGS__) _GMP_SEQ_INDEX_55
+#define _GMP_SEQ_INDEX_55(...) 55, __VA_ARGS__) _GMP_SEQ_INDEX_56
+#define _GMP_SEQ_INDEX_56(...) 56, __VA_ARGS__) _GMP_SEQ_INDEX_57
+#define _GMP_SEQ_INDEX_57(...) 57, __VA_ARGS__) _GMP_SEQ_INDEX_58
+#define _GMP_SEQ_INDEX_58(...) 58, __VA_ARGS__) _GMP_SEQ_INDEX_59
+#define _GMP_SEQ_INDEX_59(...) 59, __VA_ARGS__) _GMP_SEQ_INDEX_60
+#define _GMP_SEQ_INDEX_60(...) 60, __VA_ARGS__) _GMP_SEQ_INDEX_61
+#define _GMP_SEQ_INDEX_61(...) 61, __VA_ARGS__) _GMP_SEQ_INDEX_62
+#define _GMP_SEQ_INDEX_62(...) 62, __VA_ARGS__) _GMP_SEQ_INDEX_63
+#define _GMP_SEQ_INDEX_63(...) 63, __VA_ARGS__) _GMP_SEQ_INDEX_64
+#define _GMP_SEQ_INDEX_64(...) 64, __VA_ARGS__) _GMP_SEQ_INDEX_65
+#define _GMP_SEQ_INDEX_65(...) 65, __VA_ARGS__) _GMP_SEQ_INDEX_66
+#define _GMP_SEQ_INDEX_66(...) 66, __VA_ARGS__) _GMP_SEQ_INDEX_67
+#define _GMP_SEQ_INDEX_67(...) 67, __VA_ARGS__) _GMP_SEQ_INDEX_68
+#define _GMP_SEQ_INDEX_68(...) 68, __VA_ARGS__) _GMP_SEQ_INDEX_69
+#define _GMP_SEQ_INDEX_69(...) 69, __VA_ARGS__) _GMP_SEQ_INDEX_70
+#define _GMP_SEQ_INDEX_70(...) 70, __VA_ARGS__) _GMP_SEQ_INDEX_71
+#define _GMP_SEQ_INDEX_71(...) 71, __VA_ARGS__) _GMP_SEQ_INDEX_72
+#define _GMP_SEQ_INDEX_72(...) 72, __VA_ARGS__) _GMP_SEQ_INDEX_73
+#define _GMP_SEQ_INDEX_73(...) 73, __VA_ARGS__) _GMP_SEQ_INDEX_74
+#define _GMP_SEQ_INDEX_74(...) 74, __VA_ARGS__) _GMP_SEQ_INDEX_75
+#define _GMP_SEQ_INDEX_75(...) 75, __VA_ARGS__) _GMP_SEQ_INDEX_76
+#define _GMP_SEQ_INDEX_76(...) 76, __VA_ARGS__) _GMP_SEQ_INDEX_77
+#define _GMP_SEQ_INDEX_77(...) 77, __VA_ARGS__) _GMP_SEQ_INDEX_78
+#define _GMP_SEQ_INDEX_78(...) 78, __VA_ARGS__) _GMP_SEQ_INDEX_79
+#define _GMP_SEQ_INDEX_79(...) 79, __VA_ARGS__) _GMP_SEQ_INDEX_80
+#define _GMP_SEQ_INDEX_80(...) 80, __VA_ARGS__) _GMP_SEQ_INDEX_81
+#define _GMP_SEQ_INDEX_81(...) 81, __VA_ARGS__) _GMP_SEQ_INDEX_82
+#define _GMP_SEQ_INDEX_82(...) 82, __VA_ARGS__) _GMP_SEQ_INDEX_83
+#define _GMP_SEQ_INDEX_83(...) 83, __VA_ARGS__) _GMP_SEQ_INDEX_84
+#define _GMP_SEQ_INDEX_84(...) 84, __VA_ARGS__) _GMP_SEQ_INDEX_85
+#define _GMP_SEQ_INDEX_85(...) 85, __VA_ARGS__) _GMP_SEQ_INDEX_86
+#define _GMP_SEQ_INDEX_86(...) 86, __VA_ARGS__) _GMP_SEQ_INDEX_87
+#define _GMP_SEQ_INDEX_87(...) 87, __VA_ARGS__) _GMP_SEQ_INDEX_88
+#define _GMP_SEQ_INDEX_88(...) 88, __VA_ARGS__) _GMP_SEQ_INDEX_89
+#define _GMP_SEQ_INDEX_89(...) 89, __VA_ARGS__) _GMP_SEQ_INDEX_90
+#define _GMP_SEQ_INDEX_90(...) 90, __VA_ARGS__) _GMP_SEQ_INDEX_91
+#define _GMP_SEQ_INDEX_91(...) 91, __VA_ARGS__) _GMP_SEQ_INDEX_92
+#define _GMP_SEQ_INDEX_92(...) 92, __VA_ARGS__) _GMP_SEQ_INDEX_93
+#define _GMP_SEQ_INDEX_93(...) 93, __VA_ARGS__) _GMP_SEQ_INDEX_94
+#define _GMP_SEQ_INDEX_94(...) 94, __VA_ARGS__) _GMP_SEQ_INDEX_95
+#define _GMP_SEQ_INDEX_95(...) 95, __VA_ARGS__) _GMP_SEQ_INDEX_96
+#define _GMP_SEQ_INDEX_96(...) 96, __VA_ARGS__) _GMP_SEQ_INDEX_97
+#define _GMP_SEQ_INDEX_97(...) 97, __VA_ARGS__) _GMP_SEQ_INDEX_98
+#define _GMP_SEQ_INDEX_98(...) 98, __VA_ARGS__) _GMP_SEQ_INDEX_99
+#define _GMP_SEQ_INDEX_99(...) 99, __VA_ARGS__) _GMP_SEQ_INDEX_100
+#define _GMP_SEQ_INDEX_100(...) 100, __VA_ARGS__) _GMP_SEQ_INDEX_101
+#define _GMP_SEQ_INDEX_101(...) 101, __VA_ARGS__) _GMP_SEQ_INDEX_102
+#define _GMP_SEQ_INDEX_102(...) 102, __VA_ARGS__) _GMP_SEQ_INDEX_103
+#define _GMP_SEQ_INDEX_103(...) 103, __VA_ARGS__) _GMP_SEQ_INDEX_104
+#define _GMP_SEQ_INDEX_104(...) 104, __VA_ARGS__) _GMP_SEQ_INDEX_105
+#define _GMP_SEQ_INDEX_105(...) 105, __VA_ARGS__) _GMP_SEQ_INDEX_106
+#define _GMP_SEQ_INDEX_106(...) 106, __VA_ARGS__) _GMP_SEQ_INDEX_107
+#define _GMP_SEQ_INDEX_107(...) 107, __VA_ARGS__) _GMP_SEQ_INDEX_108
+#define _GMP_SEQ_INDEX_108(...) 108, __VA_ARGS__) _GMP_SEQ_INDEX_109
+#define _GMP_SEQ_INDEX_109(...) 109, __VA_ARGS__) _GMP_SEQ_INDEX_110
+#define _GMP_SEQ_INDEX_110(...) 110, __VA_ARGS__) _GMP_SEQ_INDEX_111
+#define _GMP_SEQ_INDEX_111(...) 111, __VA_ARGS__) _GMP_SEQ_INDEX_112
+#define _GMP_SEQ_INDEX_112(...) 112, __VA_ARGS__) _GMP_SEQ_INDEX_113
+#define _GMP_SEQ_INDEX_113(...) 113, __VA_ARGS__) _GMP_SEQ_INDEX_114
+#define _GMP_SEQ_INDEX_114(...) 114, __VA_ARGS__) _GMP_SEQ_INDEX_115
+#define _GMP_SEQ_INDEX_115(...) 115, __VA_ARGS__) _GMP_SEQ_INDEX_116
+#define _GMP_SEQ_INDEX_116(...) 116, __VA_ARGS__) _GMP_SEQ_INDEX_117
+#define _GMP_SEQ_INDEX_117(...) 117, __VA_ARGS__) _GMP_SEQ_INDEX_118
+#define _GMP_SEQ_INDEX_118(...) 118, __VA_ARGS__) _GMP_SEQ_INDEX_119
+#define _GMP_SEQ_INDEX_119(...) 119, __VA_ARGS__) _GMP_SEQ_INDEX_120
+#define _GMP_SEQ_INDEX_120(...) 120, __VA_ARGS__) _GMP_SEQ_INDEX_121
+#define _GMP_SEQ_INDEX_121(...) 121, __VA_ARGS__) _GMP_SEQ_INDEX_122
+#define _GMP_SEQ_INDEX_122(...) 122, __VA_ARGS__) _GMP_SEQ_INDEX_123
+#define _GMP_SEQ_INDEX_123(...) 123, __VA_ARGS__) _GMP_SEQ_INDEX_124
+#define _GMP_SEQ_INDEX_124(...) 124, __VA_ARGS__) _GMP_SEQ_INDEX_125
+#define _GMP_SEQ_INDEX_125(...) 125, __VA_ARGS__) _GMP_SEQ_INDEX_126
+#define _GMP_SEQ_INDEX_126(...) 126, __VA_ARGS__) _GMP_SEQ_INDEX_127
+#define _GMP_SEQ_INDEX_127(...) 127, __VA_ARGS__) _GMP_SEQ_INDEX_128
+#define _GMP_SEQ_INDEX_128(...) 128, __VA_ARGS__) _GMP_SEQ_INDEX_129
+#define _GMP_SEQ_INDEX_129(...) 129, __VA_ARGS__) _GMP_SEQ_INDEX_130
+#define _GMP_SEQ_INDEX_130(...) 130, __VA_ARGS__) _GMP_SEQ_INDEX_131
+#define _GMP_SEQ_INDEX_131(...) 131, __VA_ARGS__) _GMP_SEQ_INDEX_132
+#define _GMP_SEQ_INDEX_132(...) 132, __VA_ARGS__) _GMP_SEQ_INDEX_133
+#define _GMP_SEQ_INDEX_133(...) 133, __VA_ARGS__) _GMP_SEQ_INDEX_134
+#define _GMP_SEQ_INDEX_134(...) 134, __VA_ARGS__) _GMP_SEQ_INDEX_135
+#define _GMP_SEQ_INDEX_135(...) 135, __VA_ARGS__) _GMP_SEQ_INDEX_136
+#define _GMP_SEQ_INDEX_136(...) 136, __VA_ARGS__) _GMP_SEQ_INDEX_137
+#define _GMP_SEQ_INDEX_137(...) 137, __VA_ARGS__) _GMP_SEQ_INDEX_138
+#define _GMP_SEQ_INDEX_138(...) 138, __VA_ARGS__) _GMP_SEQ_INDEX_139
+#define _GMP_SEQ_INDEX_139(...) 139, __VA_ARGS__) _GMP_SEQ_INDEX_140
+#define _GMP_SEQ_INDEX_140(...) 140, __VA_ARGS__) _GMP_SEQ_INDEX_141
+#define _GMP_SEQ_INDEX_141(...) 141, __VA_ARGS__) _GMP_SEQ_INDEX_142
+#define _GMP_SEQ_INDEX_142(...) 142, __VA_ARGS__) _GMP_SEQ_INDEX_143
+#define _GMP_SEQ_INDEX_143(...) 143, __VA_ARGS__) _GMP_SEQ_INDEX_144
+#define _GMP_SEQ_INDEX_144(...) 144, __VA_ARGS__) _GMP_SEQ_INDEX_145
+#define _GMP_SEQ_INDEX_145(...) 145, __VA_ARGS__) _GMP_SEQ_INDEX_146
+#define _GMP_SEQ_INDEX_146(...) 146, __VA_ARGS__) _GMP_SEQ_INDEX_147
+#define _GMP_SEQ_INDEX_147(...) 147, __VA_ARGS__) _GMP_SEQ_INDEX_148
+#define _GMP_SEQ_INDEX_148(...) 148, __VA_ARGS__) _GMP_SEQ_INDEX_149
+#define _GMP_SEQ_INDEX_149(...) 149, __VA_ARGS__) _GMP_SEQ_INDEX_150
+#define _GMP_SEQ_INDEX_150(...) 150, __VA_ARGS__) _GMP_SEQ_INDEX_151
+#define _GMP_SEQ_INDEX_151(...) 151, __VA_ARGS__) _GMP_SEQ_INDEX_152
+#define _GMP_SEQ_INDEX_152(...) 152, __VA_ARGS__) _GMP_SEQ_INDEX_153
+#define _GMP_SEQ_INDEX_153(...) 153, __VA_ARGS__) _GMP_SEQ_INDEX_154
+#define _GMP_SEQ_INDEX_154(...) 154, __VA_ARGS__) _GMP_SEQ_INDEX_155
+#define _GMP_SEQ_INDEX_155(...) 155, __VA_ARGS__) _GMP_SEQ_INDEX_156
+#define _GMP_SEQ_INDEX_156(...) 156, __VA_ARGS__) _GMP_SEQ_INDEX_157
+#define _GMP_SEQ_INDEX_157(...) 157, __VA_ARGS__) _GMP_SEQ_INDEX_158
+#define _GMP_SEQ_INDEX_158(...) 158, __VA_ARGS__) _GMP_SEQ_INDEX_159
+#define _GMP_SEQ_INDEX_159(...) 159, __VA_ARGS__) _GMP_SEQ_INDEX_160
+#define _GMP_SEQ_INDEX_160(...) 160, __VA_ARGS__) _GMP_SEQ_INDEX_161
+#define _GMP_SEQ_INDEX_161(...) 161, __VA_ARGS__) _GMP_SEQ_INDEX_162
+#define _GMP_SEQ_INDEX_162(...) 162, __VA_ARGS__) _GMP_SEQ_INDEX_163
+#define _GMP_SEQ_INDEX_163(...) 163, __VA_ARGS__) _GMP_SEQ_INDEX_164
+#define _GMP_SEQ_INDEX_164(...) 164, __VA_ARGS__) _GMP_SEQ_INDEX_165
+#define _GMP_SEQ_INDEX_165(...) 165, __VA_ARGS__) _GMP_SEQ_INDEX_166
+#define _GMP_SEQ_INDEX_166(...) 166, __VA_ARGS__) _GMP_SEQ_INDEX_167
+#define _GMP_SEQ_INDEX_167(...) 167, __VA_ARGS__) _GMP_SEQ_INDEX_168
+#define _GMP_SEQ_INDEX_168(...) 168, __VA_ARGS__) _GMP_SEQ_INDEX_169
+#define _GMP_SEQ_INDEX_169(...) 169, __VA_ARGS__) _GMP_SEQ_INDEX_170
+#define _GMP_SEQ_INDEX_170(...) 170, __VA_ARGS__) _GMP_SEQ_INDEX_171
+#define _GMP_SEQ_INDEX_171(...) 171, __VA_ARGS__) _GMP_SEQ_INDEX_172
+#define _GMP_SEQ_INDEX_172(...) 172, __VA_ARGS__) _GMP_SEQ_INDEX_173
+#define _GMP_SEQ_INDEX_173(...) 173, __VA_ARGS__) _GMP_SEQ_INDEX_174
+#define _GMP_SEQ_INDEX_174(...) 174, __VA_ARGS__) _GMP_SEQ_INDEX_175
+#define _GMP_SEQ_INDEX_175(...) 175, __VA_ARGS__) _GMP_SEQ_INDEX_176
+#define _GMP_SEQ_INDEX_176(...) 176, __VA_ARGS__) _GMP_SEQ_INDEX_177
+#define _GMP_SEQ_INDEX_177(...) 177, __VA_ARGS__) _GMP_SEQ_INDEX_178
+#define _GMP_SEQ_INDEX_178(...) 178, __VA_ARGS__) _GMP_SEQ_INDEX_179
+#define _GMP_SEQ_INDEX_179(...) 179, __VA_ARGS__) _GMP_SEQ_INDEX_180
+#define _GMP_SEQ_INDEX_180(...) 180, __VA_ARGS__) _GMP_SEQ_INDEX_181
+#define _GMP_SEQ_INDEX_181(...) 181, __VA_ARGS__) _GMP_SEQ_INDEX_182
+#define _GMP_SEQ_INDEX_182(...) 182, __VA_ARGS__) _GMP_SEQ_INDEX_183
+#define _GMP_SEQ_INDEX_183(...) 183, __VA_ARGS__) _GMP_SEQ_INDEX_184
+#define _GMP_SEQ_INDEX_184(...) 184, __VA_ARGS__) _GMP_SEQ_INDEX_185
+#define _GMP_SEQ_INDEX_185(...) 185, __VA_ARGS__) _GMP_SEQ_INDEX_186
+#define _GMP_SEQ_INDEX_186(...) 186, __VA_ARGS__) _GMP_SEQ_INDEX_187
+#define _GMP_SEQ_INDEX_187(...) 187, __VA_ARGS__) _GMP_SEQ_INDEX_188
+#define _GMP_SEQ_INDEX_188(...) 188, __VA_ARGS__) _GMP_SEQ_INDEX_189
+#define _GMP_SEQ_INDEX_189(...) 189, __VA_ARGS__) _GMP_SEQ_INDEX_190
+#define _GMP_SEQ_INDEX_190(...) 190, __VA_ARGS__) _GMP_SEQ_INDEX_191
+#define _GMP_SEQ_INDEX_191(...) 191, __VA_ARGS__) _GMP_SEQ_INDEX_192
+#define _GMP_SEQ_INDEX_192(...) 192, __VA_ARGS__) _GMP_SEQ_INDEX_193
+#define _GMP_SEQ_INDEX_193(...) 193, __VA_ARGS__) _GMP_SEQ_INDEX_194
+#define _GMP_SEQ_INDEX_194(...) 194, __VA_ARGS__) _GMP_SEQ_INDEX_195
+#define _GMP_SEQ_INDEX_195(...) 195, __VA_ARGS__) _GMP_SEQ_INDEX_196
+#define _GMP_SEQ_INDEX_196(...) 196, __VA_ARGS__) _GMP_SEQ_INDEX_197
+#define _GMP_SEQ_INDEX_197(...) 197, __VA_ARGS__) _GMP_SEQ_INDEX_198
+#define _GMP_SEQ_INDEX_198(...) 198, __VA_ARGS__) _GMP_SEQ_INDEX_199
+#define _GMP_SEQ_INDEX_199(...) 199, __VA_ARGS__) _GMP_SEQ_INDEX_200
+#define _GMP_SEQ_INDEX_200(...) 200, __VA_ARGS__) _GMP_SEQ_INDEX_201
+#define _GMP_SEQ_INDEX_201(...) 201, __VA_ARGS__) _GMP_SEQ_INDEX_202
+#define _GMP_SEQ_INDEX_202(...) 202, __VA_ARGS__) _GMP_SEQ_INDEX_203
+#define _GMP_SEQ_INDEX_203(...) 203, __VA_ARGS__) _GMP_SEQ_INDEX_204
+#define _GMP_SEQ_INDEX_204(...) 204, __VA_ARGS__) _GMP_SEQ_INDEX_205
+#define _GMP_SEQ_INDEX_205(...) 205, __VA_ARGS__) _GMP_SEQ_INDEX_206
+#define _GMP_SEQ_INDEX_206(...) 206, __VA_ARGS__) _GMP_SEQ_INDEX_207
+#define _GMP_SEQ_INDEX_207(...) 207, __VA_ARGS__) _GMP_SEQ_INDEX_208
+#define _GMP_SEQ_INDEX_208(...) 208, __VA_ARGS__) _GMP_SEQ_INDEX_209
+#define _GMP_SEQ_INDEX_209(...) 209, __VA_ARGS__) _GMP_SEQ_INDEX_210
+#define _GMP_SEQ_INDEX_210(...) 210, __VA_ARGS__) _GMP_SEQ_INDEX_211
+#define _GMP_SEQ_INDEX_211(...) 211, __VA_ARGS__) _GMP_SEQ_INDEX_212
+#define _GMP_SEQ_INDEX_212(...) 212, __VA_ARGS__) _GMP_SEQ_INDEX_213
+#define _GMP_SEQ_INDEX_213(...) 213, __VA_ARGS__) _GMP_SEQ_INDEX_214
+#define _GMP_SEQ_INDEX_214(...) 214, __VA_ARGS__) _GMP_SEQ_INDEX_215
+#define _GMP_SEQ_INDEX_215(...) 215, __VA_ARGS__) _GMP_SEQ_INDEX_216
+#define _GMP_SEQ_INDEX_216(...) 216, __VA_ARGS__) _GMP_SEQ_INDEX_217
+#define _GMP_SEQ_INDEX_217(...) 217, __VA_ARGS__) _GMP_SEQ_INDEX_218
+#define _GMP_SEQ_INDEX_218(...) 218, __VA_ARGS__) _GMP_SEQ_INDEX_219
+#define _GMP_SEQ_INDEX_219(...) 219, __VA_ARGS__) _GMP_SEQ_INDEX_220
+#define _GMP_SEQ_INDEX_220(...) 220, __VA_ARGS__) _GMP_SEQ_INDEX_221
+#define _GMP_SEQ_INDEX_221(...) 221, __VA_ARGS__) _GMP_SEQ_INDEX_222
+#define _GMP_SEQ_INDEX_222(...) 222, __VA_ARGS__) _GMP_SEQ_INDEX_223
+#define _GMP_SEQ_INDEX_223(...) 223, __VA_ARGS__) _GMP_SEQ_INDEX_224
+#define _GMP_SEQ_INDEX_224(...) 224, __VA_ARGS__) _GMP_SEQ_INDEX_225
+#define _GMP_SEQ_INDEX_225(...) 225, __VA_ARGS__) _GMP_SEQ_INDEX_226
+#define _GMP_SEQ_INDEX_226(...) 226, __VA_ARGS__) _GMP_SEQ_INDEX_227
+#define _GMP_SEQ_INDEX_227(...) 227, __VA_ARGS__) _GMP_SEQ_INDEX_228
+#define _GMP_SEQ_INDEX_228(...) 228, __VA_ARGS__) _GMP_SEQ_INDEX_229
+#define _GMP_SEQ_INDEX_229(...) 229, __VA_ARGS__) _GMP_SEQ_INDEX_230
+#define _GMP_SEQ_INDEX_230(...) 230, __VA_ARGS__) _GMP_SEQ_INDEX_231
+#define _GMP_SEQ_INDEX_231(...) 231, __VA_ARGS__) _GMP_SEQ_INDEX_232
+#define _GMP_SEQ_INDEX_232(...) 232, __VA_ARGS__) _GMP_SEQ_INDEX_233
+#define _GMP_SEQ_INDEX_233(...) 233, __VA_ARGS__) _GMP_SEQ_INDEX_234
+#define _GMP_SEQ_INDEX_234(...) 234, __VA_ARGS__) _GMP_SEQ_INDEX_235
+#define _GMP_SEQ_INDEX_235(...) 235, __VA_ARGS__) _GMP_SEQ_INDEX_236
+#define _GMP_SEQ_INDEX_236(...) 236, __VA_ARGS__) _GMP_SEQ_INDEX_237
+#define _GMP_SEQ_INDEX_237(...) 237, __VA_ARGS__) _GMP_SEQ_INDEX_238
+#define _GMP_SEQ_INDEX_238(...) 238, __VA_ARGS__) _GMP_SEQ_INDEX_239
+#define _GMP_SEQ_INDEX_239(...) 239, __VA_ARGS__) _GMP_SEQ_INDEX_240
+#define _GMP_SEQ_INDEX_240(...) 240, __VA_ARGS__) _GMP_SEQ_INDEX_241
+#define _GMP_SEQ_INDEX_241(...) 241, __VA_ARGS__) _GMP_SEQ_INDEX_242
+#define _GMP_SEQ_INDEX_242(...) 242, __VA_ARGS__) _GMP_SEQ_INDEX_243
+#define _GMP_SEQ_INDEX_243(...) 243, __VA_ARGS__) _GMP_SEQ_INDEX_244
+#define _GMP_SEQ_INDEX_244(...) 244, __VA_ARGS__) _GMP_SEQ_INDEX_245
+#define _GMP_SEQ_INDEX_245(...) 245, __VA_ARGS__) _GMP_SEQ_INDEX_246
+#define _GMP_SEQ_INDEX_246(...) 246, __VA_ARGS__) _GMP_SEQ_INDEX_247
+#define _GMP_SEQ_INDEX_247(...) 247, __VA_ARGS__) _GMP_SEQ_INDEX_248
+#define _GMP_SEQ_INDEX_248(...) 248, __VA_ARGS__) _GMP_SEQ_INDEX_249
+#define _GMP_SEQ_INDEX_249(...) 249, __VA_ARGS__) _GMP_SEQ_INDEX_250
+#define _GMP_SEQ_INDEX_250(...) 250, __VA_ARGS__) _GMP_SEQ_INDEX_251
+#define _GMP_SEQ_INDEX_251(...) 251, __VA_ARGS__) _GMP_SEQ_INDEX_252
+#define _GMP_SEQ_INDEX_252(...) 252, __VA_ARGS__) _GMP_SEQ_INDEX_253
+#define _GMP_SEQ_INDEX_253(...) 253, __VA_ARGS__) _GMP_SEQ_INDEX_254
+#define _GMP_SEQ_INDEX_254(...) 254, __VA_ARGS__) _GMP_SEQ_INDEX_255
+#define _GMP_SEQ_INDEX_255(...) 255, __VA_ARGS__) _GMP_SEQ_INDEX_256
+#define _GMP_SEQ_INDEX_256(...) 256, __VA_ARGS__) _GMP_SEQ_INDEX_257
+#define _GMP_SEQ_INDEX_257(...) 257, __VA_ARGS__) _GMP_SEQ_INDEX_258
+#define _GMP_SEQ_INDEX_258(...) 258, __VA_ARGS__) _GMP_SEQ_INDEX_259
+#define _GMP_SEQ_INDEX_259(...) 259, __VA_ARGS__) _GMP_SEQ_INDEX_260
+#define _GMP_SEQ_INDEX_260(...) 260, __VA_ARGS__) _GMP_SEQ_INDEX_261
+#define _GMP_SEQ_INDEX_261(...) 261, __VA_ARGS__) _GMP_SEQ_INDEX_262
+#define _GMP_SEQ_INDEX_262(...) 262, __VA_ARGS__) _GMP_SEQ_INDEX_263
+#define _GMP_SEQ_INDEX_263(...) 263, __VA_ARGS__) _GMP_SEQ_INDEX_264
+#define _GMP_SEQ_INDEX_264(...) 264, __VA_ARGS__) _GMP_SEQ_INDEX_265
+#define _GMP_SEQ_INDEX_265(...) 265, __VA_ARGS__) _GMP_SEQ_INDEX_266
+#define _GMP_SEQ_INDEX_266(...) 266, __VA_ARGS__) _GMP_SEQ_INDEX_267
+#define _GMP_SEQ_INDEX_267(...) 267, __VA_ARGS__) _GMP_SEQ_INDEX_268
+#define _GMP_SEQ_INDEX_268(...) 268, __VA_ARGS__) _GMP_SEQ_INDEX_269
+#define _GMP_SEQ_INDEX_269(...) 269, __VA_ARGS__) _GMP_SEQ_INDEX_270
+#define _GMP_SEQ_INDEX_270(...) 270, __VA_ARGS__) _GMP_SEQ_INDEX_271
+#define _GMP_SEQ_INDEX_271(...) 271, __VA_ARGS__) _GMP_SEQ_INDEX_272
+#define _GMP_SEQ_INDEX_272(...) 272, __VA_ARGS__) _GMP_SEQ_INDEX_273
+#define _GMP_SEQ_INDEX_273(...) 273, __VA_ARGS__) _GMP_SEQ_INDEX_274
+#define _GMP_SEQ_INDEX_274(...) 274, __VA_ARGS__) _GMP_SEQ_INDEX_275
+#define _GMP_SEQ_INDEX_275(...) 275, __VA_ARGS__) _GMP_SEQ_INDEX_276
+#define _GMP_SEQ_INDEX_276(...) 276, __VA_ARGS__) _GMP_SEQ_INDEX_277
+#define _GMP_SEQ_INDEX_277(...) 277, __VA_ARGS__) _GMP_SEQ_INDEX_278
+#define _GMP_SEQ_INDEX_278(...) 278, __VA_ARGS__) _GMP_SEQ_INDEX_279
+#define _GMP_SEQ_INDEX_279(...) 279, __VA_ARGS__) _GMP_SEQ_INDEX_280
+#define _GMP_SEQ_INDEX_280(...) 280, __VA_ARGS__) _GMP_SEQ_INDEX_281
+#define _GMP_SEQ_INDEX_281(...) 281, __VA_ARGS__) _GMP_SEQ_INDEX_282
+#define _GMP_SEQ_INDEX_282(...) 282, __VA_ARGS__) _GMP_SEQ_INDEX_283
+#define _GMP_SEQ_INDEX_283(...) 283, __VA_ARGS__) _GMP_SEQ_INDEX_284
+#define _GMP_SEQ_INDEX_284(...) 284, __VA_ARGS__) _GMP_SEQ_INDEX_285
+#define _GMP_SEQ_INDEX_285(...) 285, __VA_ARGS__) _GMP_SEQ_INDEX_286
+#define _GMP_SEQ_INDEX_286(...) 286, __VA_ARGS__) _GMP_SEQ_INDEX_287
+#define _GMP_SEQ_INDEX_287(...) 287, __VA_ARGS__) _GMP_SEQ_INDEX_288
+#define _GMP_SEQ_INDEX_288(...) 288, __VA_ARGS__) _GMP_SEQ_INDEX_289
+#define _GMP_SEQ_INDEX_289(...) 289, __VA_ARGS__) _GMP_SEQ_INDEX_290
+#define _GMP_SEQ_INDEX_290(...) 290, __VA_ARGS__) _GMP_SEQ_INDEX_291
+#define _GMP_SEQ_INDEX_291(...) 291, __VA_ARGS__) _GMP_SEQ_INDEX_292
+#define _GMP_SEQ_INDEX_292(...) 292, __VA_ARGS__) _GMP_SEQ_INDEX_293
+#define _GMP_SEQ_INDEX_293(...) 293, __VA_ARGS__) _GMP_SEQ_INDEX_294
+#define _GMP_SEQ_INDEX_294(...) 294, __VA_ARGS__) _GMP_SEQ_INDEX_295
+#define _GMP_SEQ_INDEX_295(...) 295, __VA_ARGS__) _GMP_SEQ_INDEX_296
+#define _GMP_SEQ_INDEX_296(...) 296, __VA_ARGS__) _GMP_SEQ_INDEX_297
+#define _GMP_SEQ_INDEX_297(...) 297, __VA_ARGS__) _GMP_SEQ_INDEX_298
+#define _GMP_SEQ_INDEX_298(...) 298, __VA_ARGS__) _GMP_SEQ_INDEX_299
+#define _GMP_SEQ_INDEX_299(...) 299, __VA_ARGS__) _GMP_SEQ_INDEX_300
+#define _GMP_SEQ_INDEX_300(...) 300, __VA_ARGS__) _GMP_SEQ_INDEX_301
+#define _GMP_SEQ_INDEX_301(...) 301, __VA_ARGS__) _GMP_SEQ_INDEX_302
+#define _GMP_SEQ_INDEX_302(...) 302, __VA_ARGS__) _GMP_SEQ_INDEX_303
+#define _GMP_SEQ_INDEX_303(...) 303, __VA_ARGS__) _GMP_SEQ_INDEX_304
+#define _GMP_SEQ_INDEX_304(...) 304, __VA_ARGS__) _GMP_SEQ_INDEX_305
+#define _GMP_SEQ_INDEX_305(...) 305, __VA_ARGS__) _GMP_SEQ_INDEX_306
+#define _GMP_SEQ_INDEX_306(...) 306, __VA_ARGS__) _GMP_SEQ_INDEX_307
+#define _GMP_SEQ_INDEX_307(...) 307, __VA_ARGS__) _GMP_SEQ_INDEX_308
+#define _GMP_SEQ_INDEX_308(...) 308, __VA_ARGS__) _GMP_SEQ_INDEX_309
+#define _GMP_SEQ_INDEX_309(...) 309, __VA_ARGS__) _GMP_SEQ_INDEX_310
+#define _GMP_SEQ_INDEX_310(...) 310, __VA_ARGS__) _GMP_SEQ_INDEX_311
+#define _GMP_SEQ_INDEX_311(...) 311, __VA_ARGS__) _GMP_SEQ_INDEX_312
+#define _GMP_SEQ_INDEX_312(...) 312, __VA_ARGS__) _GMP_SEQ_INDEX_313
+#define _GMP_SEQ_INDEX_313(...) 313, __VA_ARGS__) _GMP_SEQ_INDEX_314
+#define _GMP_SEQ_INDEX_314(...) 314, __VA_ARGS__) _GMP_SEQ_INDEX_315
+#define _GMP_SEQ_INDEX_315(...) 315, __VA_ARGS__) _GMP_SEQ_INDEX_316
+#define _GMP_SEQ_INDEX_316(...) 316, __VA_ARGS__) _GMP_SEQ_INDEX_317
+#define _GMP_SEQ_INDEX_317(...) 317, __VA_ARGS__) _GMP_SEQ_INDEX_318
+#define _GMP_SEQ_INDEX_318(...) 318, __VA_ARGS__) _GMP_SEQ_INDEX_319
+#define _GMP_SEQ_INDEX_319(...) 319, __VA_ARGS__) _GMP_SEQ_INDEX_320
+#define _GMP_SEQ_INDEX_320(...) 320, __VA_ARGS__) _GMP_SEQ_INDEX_321
+#define _GMP_SEQ_INDEX_321(...) 321, __VA_ARGS__) _GMP_SEQ_INDEX_322
+#define _GMP_SEQ_INDEX_322(...) 322, __VA_ARGS__) _GMP_SEQ_INDEX_323
+#define _GMP_SEQ_INDEX_323(...) 323, __VA_ARGS__) _GMP_SEQ_INDEX_324
+#define _GMP_SEQ_INDEX_324(...) 324, __VA_ARGS__) _GMP_SEQ_INDEX_325
+#define _GMP_SEQ_INDEX_325(...) 325, __VA_ARGS__) _GMP_SEQ_INDEX_326
+#define _GMP_SEQ_INDEX_326(...) 326, __VA_ARGS__) _GMP_SEQ_INDEX_327
+#define _GMP_SEQ_INDEX_327(...) 327, __VA_ARGS__) _GMP_SEQ_INDEX_328
+#define _GMP_SEQ_INDEX_328(...) 328, __VA_ARGS__) _GMP_SEQ_INDEX_329
+#define _GMP_SEQ_INDEX_329(...) 329, __VA_ARGS__) _GMP_SEQ_INDEX_330
+#define _GMP_SEQ_INDEX_330(...) 330, __VA_ARGS__) _GMP_SEQ_INDEX_331
+#define _GMP_SEQ_INDEX_331(...) 331, __VA_ARGS__) _GMP_SEQ_INDEX_332
+#define _GMP_SEQ_INDEX_332(...) 332, __VA_ARGS__) _GMP_SEQ_INDEX_333
+#define _GMP_SEQ_INDEX_333(...) 333, __VA_ARGS__) _GMP_SEQ_INDEX_334
+#define _GMP_SEQ_INDEX_334(...) 334, __VA_ARGS__) _GMP_SEQ_INDEX_335
+#define _GMP_SEQ_INDEX_335(...) 335, __VA_ARGS__) _GMP_SEQ_INDEX_336
+#define _GMP_SEQ_INDEX_336(...) 336, __VA_ARGS__) _GMP_SEQ_INDEX_337
+#define _GMP_SEQ_INDEX_337(...) 337, __VA_ARGS__) _GMP_SEQ_INDEX_338
+#define _GMP_SEQ_INDEX_338(...) 338, __VA_ARGS__) _GMP_SEQ_INDEX_339
+#define _GMP_SEQ_INDEX_339(...) 339, __VA_ARGS__) _GMP_SEQ_INDEX_340
+#define _GMP_SEQ_INDEX_340(...) 340, __VA_ARGS__) _GMP_SEQ_INDEX_341
+#define _GMP_SEQ_INDEX_341(...) 341, __VA_ARGS__) _GMP_SEQ_INDEX_342
+#define _GMP_SEQ_INDEX_342(...) 342, __VA_ARGS__) _GMP_SEQ_INDEX_343
+#define _GMP_SEQ_INDEX_343(...) 343, __VA_ARGS__) _GMP_SEQ_INDEX_344
+#define _GMP_SEQ_INDEX_344(...) 344, __VA_ARGS__) _GMP_SEQ_INDEX_345
+#define _GMP_SEQ_INDEX_345(...) 345, __VA_ARGS__) _GMP_SEQ_INDEX_346
+#define _GMP_SEQ_INDEX_346(...) 346, __VA_ARGS__) _GMP_SEQ_INDEX_347
+#define _GMP_SEQ_INDEX_347(...) 347, __VA_ARGS__) _GMP_SEQ_INDEX_348
+#define _GMP_SEQ_INDEX_348(...) 348, __VA_ARGS__) _GMP_SEQ_INDEX_349
+#define _GMP_SEQ_INDEX_349(...) 349, __VA_ARGS__) _GMP_SEQ_INDEX_350
+#define _GMP_SEQ_INDEX_350(...) 350, __VA_ARGS__) _GMP_SEQ_INDEX_351
+#define _GMP_SEQ_INDEX_351(...) 351, __VA_ARGS__) _GMP_SEQ_INDEX_352
+#define _GMP_SEQ_INDEX_352(...) 352, __VA_ARGS__) _GMP_SEQ_INDEX_353
+#define _GMP_SEQ_INDEX_353(...) 353, __VA_ARGS__) _GMP_SEQ_INDEX_354
+#define _GMP_SEQ_INDEX_354(...) 354, __VA_ARGS__) _GMP_SEQ_INDEX_355
+#define _GMP_SEQ_INDEX_355(...) 355, __VA_ARGS__) _GMP_SEQ_INDEX_356
+#define _GMP_SEQ_INDEX_356(...) 356, __VA_ARGS__) _GMP_SEQ_INDEX_357
+#define _GMP_SEQ_INDEX_357(...) 357, __VA_ARGS__) _GMP_SEQ_INDEX_358
+#define _GMP_SEQ_INDEX_358(...) 358, __VA_ARGS__) _GMP_SEQ_INDEX_359
+#define _GMP_SEQ_INDEX_359(...) 359, __VA_ARGS__) _GMP_SEQ_INDEX_360
+#define _GMP_SEQ_INDEX_360(...) 360, __VA_ARGS__) _GMP_SEQ_INDEX_361
+#define _GMP_SEQ_INDEX_361(...) 361, __VA_ARGS__) _GMP_SEQ_INDEX_362
+#define _GMP_SEQ_INDEX_362(...) 362, __VA_ARGS__) _GMP_SEQ_INDEX_363
+#define _GMP_SEQ_INDEX_363(...) 363, __VA_ARGS__) _GMP_SEQ_INDEX_364
+#define _GMP_SEQ_INDEX_364(...) 364, __VA_ARGS__) _GMP_SEQ_INDEX_365
+#define _GMP_SEQ_INDEX_365(...) 365, __VA_ARGS__) _GMP_SEQ_INDEX_366
+#define _GMP_SEQ_INDEX_366(...) 366, __VA_ARGS__) _GMP_SEQ_INDEX_367
+#define _GMP_SEQ_INDEX_367(...) 367, __VA_ARGS__) _GMP_SEQ_INDEX_368
+#define _GMP_SEQ_INDEX_368(...) 368, __VA_ARGS__) _GMP_SEQ_INDEX_369
+#define _GMP_SEQ_INDEX_369(...) 369, __VA_ARGS__) _GMP_SEQ_INDEX_370
+#define _GMP_SEQ_INDEX_370(...) 370, __VA_ARGS__) _GMP_SEQ_INDEX_371
+#define _GMP_SEQ_INDEX_371(...) 371, __VA_ARGS__) _GMP_SEQ_INDEX_372
+#define _GMP_SEQ_INDEX_372(...) 372, __VA_ARGS__) _GMP_SEQ_INDEX_373
+#define _GMP_SEQ_INDEX_373(...) 373, __VA_ARGS__) _GMP_SEQ_INDEX_374
+#define _GMP_SEQ_INDEX_374(...) 374, __VA_ARGS__) _GMP_SEQ_INDEX_375
+#define _GMP_SEQ_INDEX_375(...) 375, __VA_ARGS__) _GMP_SEQ_INDEX_376
+#define _GMP_SEQ_INDEX_376(...) 376, __VA_ARGS__) _GMP_SEQ_INDEX_377
+#define _GMP_SEQ_INDEX_377(...) 377, __VA_ARGS__) _GMP_SEQ_INDEX_378
+#define _GMP_SEQ_INDEX_378(...) 378, __VA_ARGS__) _GMP_SEQ_INDEX_379
+#define _GMP_SEQ_INDEX_379(...) 379, __VA_ARGS__) _GMP_SEQ_INDEX_380
+#define _GMP_SEQ_INDEX_380(...) 380, __VA_ARGS__) _GMP_SEQ_INDEX_381
+#define _GMP_SEQ_INDEX_381(...) 381, __VA_ARGS__) _GMP_SEQ_INDEX_382
+#define _GMP_SEQ_INDEX_382(...) 382, __VA_ARGS__) _GMP_SEQ_INDEX_383
+#define _GMP_SEQ_INDEX_383(...) 383, __VA_ARGS__) _GMP_SEQ_INDEX_384
+#define _GMP_SEQ_INDEX_384(...) 384, __VA_ARGS__) _GMP_SEQ_INDEX_385
+#define _GMP_SEQ_INDEX_385(...) 385, __VA_ARGS__) _GMP_SEQ_INDEX_386
+#define _GMP_SEQ_INDEX_386(...) 386, __VA_ARGS__) _GMP_SEQ_INDEX_387
+#define _GMP_SEQ_INDEX_387(...) 387, __VA_ARGS__) _GMP_SEQ_INDEX_388
+#define _GMP_SEQ_INDEX_388(...) 388, __VA_ARGS__) _GMP_SEQ_INDEX_389
+#define _GMP_SEQ_INDEX_389(...) 389, __VA_ARGS__) _GMP_SEQ_INDEX_390
+#define _GMP_SEQ_INDEX_390(...) 390, __VA_ARGS__) _GMP_SEQ_INDEX_391
+#define _GMP_SEQ_INDEX_391(...) 391, __VA_ARGS__) _GMP_SEQ_INDEX_392
+#define _GMP_SEQ_INDEX_392(...) 392, __VA_ARGS__) _GMP_SEQ_INDEX_393
+#define _GMP_SEQ_INDEX_393(...) 393, __VA_ARGS__) _GMP_SEQ_INDEX_394
+#define _GMP_SEQ_INDEX_394(...) 394, __VA_ARGS__) _GMP_SEQ_INDEX_395
+#define _GMP_SEQ_INDEX_395(...) 395, __VA_ARGS__) _GMP_SEQ_INDEX_396
+#define _GMP_SEQ_INDEX_396(...) 396, __VA_ARGS__) _GMP_SEQ_INDEX_397
+#define _GMP_SEQ_INDEX_397(...) 397, __VA_ARGS__) _GMP_SEQ_INDEX_398
+#define _GMP_SEQ_INDEX_398(...) 398, __VA_ARGS__) _GMP_SEQ_INDEX_399
+#define _GMP_SEQ_INDEX_399(...) 399, __VA_ARGS__) _GMP_SEQ_INDEX_400
+#define _GMP_SEQ_INDEX_400(...) 400, __VA_ARGS__) _GMP_SEQ_INDEX_401
+#define _GMP_SEQ_INDEX_401(...) 401, __VA_ARGS__) _GMP_SEQ_INDEX_402
+#define _GMP_SEQ_INDEX_402(...) 402, __VA_ARGS__) _GMP_SEQ_INDEX_403
+#define _GMP_SEQ_INDEX_403(...) 403, __VA_ARGS__) _GMP_SEQ_INDEX_404
+#define _GMP_SEQ_INDEX_404(...) 404, __VA_ARGS__) _GMP_SEQ_INDEX_405
+#define _GMP_SEQ_INDEX_405(...) 405, __VA_ARGS__) _GMP_SEQ_INDEX_406
+#define _GMP_SEQ_INDEX_406(...) 406, __VA_ARGS__) _GMP_SEQ_INDEX_407
+#define _GMP_SEQ_INDEX_407(...) 407, __VA_ARGS__) _GMP_SEQ_INDEX_408
+#define _GMP_SEQ_INDEX_408(...) 408, __VA_ARGS__) _GMP_SEQ_INDEX_409
+#define _GMP_SEQ_INDEX_409(...) 409, __VA_ARGS__) _GMP_SEQ_INDEX_410
+#define _GMP_SEQ_INDEX_410(...) 410, __VA_ARGS__) _GMP_SEQ_INDEX_411
+#define _GMP_SEQ_INDEX_411(...) 411, __VA_ARGS__) _GMP_SEQ_INDEX_412
+#define _GMP_SEQ_INDEX_412(...) 412, __VA_ARGS__) _GMP_SEQ_INDEX_413
+#define _GMP_SEQ_INDEX_413(...) 413, __VA_ARGS__) _GMP_SEQ_INDEX_414
+#define _GMP_SEQ_INDEX_414(...) 414, __VA_ARGS__) _GMP_SEQ_INDEX_415
+#define _GMP_SEQ_INDEX_415(...) 415, __VA_ARGS__) _GMP_SEQ_INDEX_416
+#define _GMP_SEQ_INDEX_416(...) 416, __VA_ARGS__) _GMP_SEQ_INDEX_417
+#define _GMP_SEQ_INDEX_417(...) 417, __VA_ARGS__) _GMP_SEQ_INDEX_418
+#define _GMP_SEQ_INDEX_418(...) 418, __VA_ARGS__) _GMP_SEQ_INDEX_419
+#define _GMP_SEQ_INDEX_419(...) 419, __VA_ARGS__) _GMP_SEQ_INDEX_420
+#define _GMP_SEQ_INDEX_420(...) 420, __VA_ARGS__) _GMP_SEQ_INDEX_421
+#define _GMP_SEQ_INDEX_421(...) 421, __VA_ARGS__) _GMP_SEQ_INDEX_422
+#define _GMP_SEQ_INDEX_422(...) 422, __VA_ARGS__) _GMP_SEQ_INDEX_423
+#define _GMP_SEQ_INDEX_423(...) 423, __VA_ARGS__) _GMP_SEQ_INDEX_424
+#define _GMP_SEQ_INDEX_424(...) 424, __VA_ARGS__) _GMP_SEQ_INDEX_425
+#define _GMP_SEQ_INDEX_425(...) 425, __VA_ARGS__) _GMP_SEQ_INDEX_426
+#define _GMP_SEQ_INDEX_426(...) 426, __VA_ARGS__) _GMP_SEQ_INDEX_427
+#define _GMP_SEQ_INDEX_427(...) 427, __VA_ARGS__) _GMP_SEQ_INDEX_428
+#define _GMP_SEQ_INDEX_428(...) 428, __VA_ARGS__) _GMP_SEQ_INDEX_429
+#define _GMP_SEQ_INDEX_429(...) 429, __VA_ARGS__) _GMP_SEQ_INDEX_430
+#define _GMP_SEQ_INDEX_430(...) 430, __VA_ARGS__) _GMP_SEQ_INDEX_431
+#define _GMP_SEQ_INDEX_431(...) 431, __VA_ARGS__) _GMP_SEQ_INDEX_432
+#define _GMP_SEQ_INDEX_432(...) 432, __VA_ARGS__) _GMP_SEQ_INDEX_433
+#define _GMP_SEQ_INDEX_433(...) 433, __VA_ARGS__) _GMP_SEQ_INDEX_434
+#define _GMP_SEQ_INDEX_434(...) 434, __VA_ARGS__) _GMP_SEQ_INDEX_435
+#define _GMP_SEQ_INDEX_435(...) 435, __VA_ARGS__) _GMP_SEQ_INDEX_436
+#define _GMP_SEQ_INDEX_436(...) 436, __VA_ARGS__) _GMP_SEQ_INDEX_437
+#define _GMP_SEQ_INDEX_437(...) 437, __VA_ARGS__) _GMP_SEQ_INDEX_438
+#define _GMP_SEQ_INDEX_438(...) 438, __VA_ARGS__) _GMP_SEQ_INDEX_439
+#define _GMP_SEQ_INDEX_439(...) 439, __VA_ARGS__) _GMP_SEQ_INDEX_440
+#define _GMP_SEQ_INDEX_440(...) 440, __VA_ARGS__) _GMP_SEQ_INDEX_441
+#define _GMP_SEQ_INDEX_441(...) 441, __VA_ARGS__) _GMP_SEQ_INDEX_442
+#define _GMP_SEQ_INDEX_442(...) 442, __VA_ARGS__) _GMP_SEQ_INDEX_443
+#define _GMP_SEQ_INDEX_443(...) 443, __VA_ARGS__) _GMP_SEQ_INDEX_444
+#define _GMP_SEQ_INDEX_444(...) 444, __VA_ARGS__) _GMP_SEQ_INDEX_445
+#define _GMP_SEQ_INDEX_445(...) 445, __VA_ARGS__) _GMP_SEQ_INDEX_446
+#define _GMP_SEQ_INDEX_446(...) 446, __VA_ARGS__) _GMP_SEQ_INDEX_447
+#define _GMP_SEQ_INDEX_447(...) 447, __VA_ARGS__) _GMP_SEQ_INDEX_448
+#define _GMP_SEQ_INDEX_448(...) 448, __VA_ARGS__) _GMP_SEQ_INDEX_449
+#define _GMP_SEQ_INDEX_449(...) 449, __VA_ARGS__) _GMP_SEQ_INDEX_450
+#define _GMP_SEQ_INDEX_450(...) 450, __VA_ARGS__) _GMP_SEQ_INDEX_451
+#define _GMP_SEQ_INDEX_451(...) 451, __VA_ARGS__) _GMP_SEQ_INDEX_452
+#define _GMP_SEQ_INDEX_452(...) 452, __VA_ARGS__) _GMP_SEQ_INDEX_453
+#define _GMP_SEQ_INDEX_453(...) 453, __VA_ARGS__) _GMP_SEQ_INDEX_454
+#define _GMP_SEQ_INDEX_454(...) 454, __VA_ARGS__) _GMP_SEQ_INDEX_455
+#define _GMP_SEQ_INDEX_455(...) 455, __VA_ARGS__) _GMP_SEQ_INDEX_456
+#define _GMP_SEQ_INDEX_456(...) 456, __VA_ARGS__) _GMP_SEQ_INDEX_457
+#define _GMP_SEQ_INDEX_457(...) 457, __VA_ARGS__) _GMP_SEQ_INDEX_458
+#define _GMP_SEQ_INDEX_458(...) 458, __VA_ARGS__) _GMP_SEQ_INDEX_459
+#define _GMP_SEQ_INDEX_459(...) 459, __VA_ARGS__) _GMP_SEQ_INDEX_460
+#define _GMP_SEQ_INDEX_460(...) 460, __VA_ARGS__) _GMP_SEQ_INDEX_461
+#define _GMP_SEQ_INDEX_461(...) 461, __VA_ARGS__) _GMP_SEQ_INDEX_462
+#define _GMP_SEQ_INDEX_462(...) 462, __VA_ARGS__) _GMP_SEQ_INDEX_463
+#define _GMP_SEQ_INDEX_463(...) 463, __VA_ARGS__) _GMP_SEQ_INDEX_464
+#define _GMP_SEQ_INDEX_464(...) 464, __VA_ARGS__) _GMP_SEQ_INDEX_465
+#define _GMP_SEQ_INDEX_465(...) 465, __VA_ARGS__) _GMP_SEQ_INDEX_466
+#define _GMP_SEQ_INDEX_466(...) 466, __VA_ARGS__) _GMP_SEQ_INDEX_467
+#define _GMP_SEQ_INDEX_467(...) 467, __VA_ARGS__) _GMP_SEQ_INDEX_468
+#define _GMP_SEQ_INDEX_468(...) 468, __VA_ARGS__) _GMP_SEQ_INDEX_469
+#define _GMP_SEQ_INDEX_469(...) 469, __VA_ARGS__) _GMP_SEQ_INDEX_470
+#define _GMP_SEQ_INDEX_470(...) 470, __VA_ARGS__) _GMP_SEQ_INDEX_471
+#define _GMP_SEQ_INDEX_471(...) 471, __VA_ARGS__) _GMP_SEQ_INDEX_472
+#define _GMP_SEQ_INDEX_472(...) 472, __VA_ARGS__) _GMP_SEQ_INDEX_473
+#define _GMP_SEQ_INDEX_473(...) 473, __VA_ARGS__) _GMP_SEQ_INDEX_474
+#define _GMP_SEQ_INDEX_474(...) 474, __VA_ARGS__) _GMP_SEQ_INDEX_475
+#define _GMP_SEQ_INDEX_475(...) 475, __VA_ARGS__) _GMP_SEQ_INDEX_476
+#define _GMP_SEQ_INDEX_476(...) 476, __VA_ARGS__) _GMP_SEQ_INDEX_477
+#define _GMP_SEQ_INDEX_477(...) 477, __VA_ARGS__) _GMP_SEQ_INDEX_478
+#define _GMP_SEQ_INDEX_478(...) 478, __VA_ARGS__) _GMP_SEQ_INDEX_479
+#define _GMP_SEQ_INDEX_479(...) 479, __VA_ARGS__) _GMP_SEQ_INDEX_480
+#define _GMP_SEQ_INDEX_480(...) 480, __VA_ARGS__) _GMP_SEQ_INDEX_481
+#define _GMP_SEQ_INDEX_481(...) 481, __VA_ARGS__) _GMP_SEQ_INDEX_482
+#define _GMP_SEQ_INDEX_482(...) 482, __VA_ARGS__) _GMP_SEQ_INDEX_483
+#define _GMP_SEQ_INDEX_483(...) 483, __VA_ARGS__) _GMP_SEQ_INDEX_484
+#define _GMP_SEQ_INDEX_484(...) 484, __VA_ARGS__) _GMP_SEQ_INDEX_485
+#define _GMP_SEQ_INDEX_485(...) 485, __VA_ARGS__) _GMP_SEQ_INDEX_486
+#define _GMP_SEQ_INDEX_486(...) 486, __VA_ARGS__) _GMP_SEQ_INDEX_487
+#define _GMP_SEQ_INDEX_487(...) 487, __VA_ARGS__) _GMP_SEQ_INDEX_488
+#define _GMP_SEQ_INDEX_488(...) 488, __VA_ARGS__) _GMP_SEQ_INDEX_489
+#define _GMP_SEQ_INDEX_489(...) 489, __VA_ARGS__) _GMP_SEQ_INDEX_490
+#define _GMP_SEQ_INDEX_490(...) 490, __VA_ARGS__) _GMP_SEQ_INDEX_491
+#define _GMP_SEQ_INDEX_491(...) 491, __VA_ARGS__) _GMP_SEQ_INDEX_492
+#define _GMP_SEQ_INDEX_492(...) 492, __VA_ARGS__) _GMP_SEQ_INDEX_493
+#define _GMP_SEQ_INDEX_493(...) 493, __VA_ARGS__) _GMP_SEQ_INDEX_494
+#define _GMP_SEQ_INDEX_494(...) 494, __VA_ARGS__) _GMP_SEQ_INDEX_495
+#define _GMP_SEQ_INDEX_495(...) 495, __VA_ARGS__) _GMP_SEQ_INDEX_496
+#define _GMP_SEQ_INDEX_496(...) 496, __VA_ARGS__) _GMP_SEQ_INDEX_497
+#define _GMP_SEQ_INDEX_497(...) 497, __VA_ARGS__) _GMP_SEQ_INDEX_498
+#define _GMP_SEQ_INDEX_498(...) 498, __VA_ARGS__) _GMP_SEQ_INDEX_499
+#define _GMP_SEQ_INDEX_499(...) 499, __VA_ARGS__) _GMP_SEQ_INDEX_500
+#define _GMP_SEQ_INDEX_500(...) 500, __VA_ARGS__) _GMP_SEQ_INDEX_501
+#define _GMP_SEQ_INDEX_501(...) 501, __VA_ARGS__) _GMP_SEQ_INDEX_502
+#define _GMP_SEQ_INDEX_502(...) 502, __VA_ARGS__) _GMP_SEQ_INDEX_503
+#define _GMP_SEQ_INDEX_503(...) 503, __VA_ARGS__) _GMP_SEQ_INDEX_504
+#define _GMP_SEQ_INDEX_504(...) 504, __VA_ARGS__) _GMP_SEQ_INDEX_505
+#define _GMP_SEQ_INDEX_505(...) 505, __VA_ARGS__) _GMP_SEQ_INDEX_506
+#define _GMP_SEQ_INDEX_506(...) 506, __VA_ARGS__) _GMP_SEQ_INDEX_507
+#define _GMP_SEQ_INDEX_507(...) 507, __VA_ARGS__) _GMP_SEQ_INDEX_508
+#define _GMP_SEQ_INDEX_508(...) 508, __VA_ARGS__) _GMP_SEQ_INDEX_509
+#define _GMP_SEQ_INDEX_509(...) 509, __VA_ARGS__) _GMP_SEQ_INDEX_510
+#define _GMP_SEQ_INDEX_510(...) 510, __VA_ARGS__) _GMP_SEQ_INDEX_511
+#define _GMP_SEQ_INDEX_511(...) 511, __VA_ARGS__) _GMP_SEQ_INDEX_512
+#define _GMP_SEQ_INDEX_512(...) 512, __VA_ARGS__) _GMP_SEQ_INDEX_513
+#define _GMP_SEQ_INDEX_513(...) 513, __VA_ARGS__) _GMP_SEQ_INDEX_514
+#define _GMP_SEQ_INDEX_514(...) 514, __VA_ARGS__) _GMP_SEQ_INDEX_515
+#define _GMP_SEQ_INDEX_515(...) 515, __VA_ARGS__) _GMP_SEQ_INDEX_516
+#define _GMP_SEQ_INDEX_516(...) 516, __VA_ARGS__) _GMP_SEQ_INDEX_517
+#define _GMP_SEQ_INDEX_517(...) 517, __VA_ARGS__) _GMP_SEQ_INDEX_518
+#define _GMP_SEQ_INDEX_518(...) 518, __VA_ARGS__) _GMP_SEQ_INDEX_519
+#define _GMP_SEQ_INDEX_519(...) 519, __VA_ARGS__) _GMP_SEQ_INDEX_520
+#define _GMP_SEQ_INDEX_520(...) 520, __VA_ARGS__) _GMP_SEQ_INDEX_521
+#define _GMP_SEQ_INDEX_521(...) 521, __VA_ARGS__) _GMP_SEQ_INDEX_522
+#define _GMP_SEQ_INDEX_522(...) 522, __VA_ARGS__) _GMP_SEQ_INDEX_523
+#define _GMP_SEQ_INDEX_523(...) 523, __VA_ARGS__) _GMP_SEQ_INDEX_524
+#define _GMP_SEQ_INDEX_524(...) 524, __VA_ARGS__) _GMP_SEQ_INDEX_525
+#define _GMP_SEQ_INDEX_525(...) 525, __VA_ARGS__) _GMP_SEQ_INDEX_526
+#define _GMP_SEQ_INDEX_526(...) 526, __VA_ARGS__) _GMP_SEQ_INDEX_527
+#define _GMP_SEQ_INDEX_527(...) 527, __VA_ARGS__) _GMP_SEQ_INDEX_528
+#define _GMP_SEQ_INDEX_528(...) 528, __VA_ARGS__) _GMP_SEQ_INDEX_529
+#define _GMP_SEQ_INDEX_529(...) 529, __VA_ARGS__) _GMP_SEQ_INDEX_530
+#define _GMP_SEQ_INDEX_530(...) 530, __VA_ARGS__) _GMP_SEQ_INDEX_531
+#define _GMP_SEQ_INDEX_531(...) 531, __VA_ARGS__) _GMP_SEQ_INDEX_532
+#define _GMP_SEQ_INDEX_532(...) 532, __VA_ARGS__) _GMP_SEQ_INDEX_533
+#define _GMP_SEQ_INDEX_533(...) 533, __VA_ARGS__) _GMP_SEQ_INDEX_534
+#define _GMP_SEQ_INDEX_534(...) 534, __VA_ARGS__) _GMP_SEQ_INDEX_535
+#define _GMP_SEQ_INDEX_535(...) 535, __VA_ARGS__) _GMP_SEQ_INDEX_536
+#define _GMP_SEQ_INDEX_536(...) 536, __VA_ARGS__) _GMP_SEQ_INDEX_537
+#define _GMP_SEQ_INDEX_537(...) 537, __VA_ARGS__) _GMP_SEQ_INDEX_538
+#define _GMP_SEQ_INDEX_538(...) 538, __VA_ARGS__) _GMP_SEQ_INDEX_539
+#define _GMP_SEQ_INDEX_539(...) 539, __VA_ARGS__) _GMP_SEQ_INDEX_540
+#define _GMP_SEQ_INDEX_540(...) 540, __VA_ARGS__) _GMP_SEQ_INDEX_541
+#define _GMP_SEQ_INDEX_541(...) 541, __VA_ARGS__) _GMP_SEQ_INDEX_542
+#define _GMP_SEQ_INDEX_542(...) 542, __VA_ARGS__) _GMP_SEQ_INDEX_543
+#define _GMP_SEQ_INDEX_543(...) 543, __VA_ARGS__) _GMP_SEQ_INDEX_544
+#define _GMP_SEQ_INDEX_544(...) 544, __VA_ARGS__) _GMP_SEQ_INDEX_545
+#define _GMP_SEQ_INDEX_545(...) 545, __VA_ARGS__) _GMP_SEQ_INDEX_546
+#define _GMP_SEQ_INDEX_546(...) 546, __VA_ARGS__) _GMP_SEQ_INDEX_547
+#define _GMP_SEQ_INDEX_547(...) 547, __VA_ARGS__) _GMP_SEQ_INDEX_548
+#define _GMP_SEQ_INDEX_548(...) 548, __VA_ARGS__) _GMP_SEQ_INDEX_549
+#define _GMP_SEQ_INDEX_549(...) 549, __VA_ARGS__) _GMP_SEQ_INDEX_550
+#define _GMP_SEQ_INDEX_550(...) 550, __VA_ARGS__) _GMP_SEQ_INDEX_551
+#define _GMP_SEQ_INDEX_551(...) 551, __VA_ARGS__) _GMP_SEQ_INDEX_552
+#define _GMP_SEQ_INDEX_552(...) 552, __VA_ARGS__) _GMP_SEQ_INDEX_553
+#define _GMP_SEQ_INDEX_553(...) 553, __VA_ARGS__) _GMP_SEQ_INDEX_554
+#define _GMP_SEQ_INDEX_554(...) 554, __VA_ARGS__) _GMP_SEQ_INDEX_555
+#define _GMP_SEQ_INDEX_555(...) 555, __VA_ARGS__) _GMP_SEQ_INDEX_556
+#define _GMP_SEQ_INDEX_556(...) 556, __VA_ARGS__) _GMP_SEQ_INDEX_557
+#define _GMP_SEQ_INDEX_557(...) 557, __VA_ARGS__) _GMP_SEQ_INDEX_558
+#define _GMP_SEQ_INDEX_558(...) 558, __VA_ARGS__) _GMP_SEQ_INDEX_559
+#define _GMP_SEQ_INDEX_559(...) 559, __VA_ARGS__) _GMP_SEQ_INDEX_560
+#define _GMP_SEQ_INDEX_560(...) 560, __VA_ARGS__) _GMP_SEQ_INDEX_561
+#define _GMP_SEQ_INDEX_561(...) 561, __VA_ARGS__) _GMP_SEQ_INDEX_562
+#define _GMP_SEQ_INDEX_562(...) 562, __VA_ARGS__) _GMP_SEQ_INDEX_563
+#define _GMP_SEQ_INDEX_563(...) 563, __VA_ARGS__) _GMP_SEQ_INDEX_564
+#define _GMP_SEQ_INDEX_564(...) 564, __VA_ARGS__) _GMP_SEQ_INDEX_565
+#define _GMP_SEQ_INDEX_565(...) 565, __VA_ARGS__) _GMP_SEQ_INDEX_566
+#define _GMP_SEQ_INDEX_566(...) 566, __VA_ARGS__) _GMP_SEQ_INDEX_567
+#define _GMP_SEQ_INDEX_567(...) 567, __VA_ARGS__) _GMP_SEQ_INDEX_568
+#define _GMP_SEQ_INDEX_568(...) 568, __VA_ARGS__) _GMP_SEQ_INDEX_569
+#define _GMP_SEQ_INDEX_569(...) 569, __VA_ARGS__) _GMP_SEQ_INDEX_570
+#define _GMP_SEQ_INDEX_570(...) 570, __VA_ARGS__) _GMP_SEQ_INDEX_571
+#define _GMP_SEQ_INDEX_571(...) 571, __VA_ARGS__) _GMP_SEQ_INDEX_572
+#define _GMP_SEQ_INDEX_572(...) 572, __VA_ARGS__) _GMP_SEQ_INDEX_573
+#define _GMP_SEQ_INDEX_573(...) 573, __VA_ARGS__) _GMP_SEQ_INDEX_574
+#define _GMP_SEQ_INDEX_574(...) 574, __VA_ARGS__) _GMP_SEQ_INDEX_575
+#define _GMP_SEQ_INDEX_575(...) 575, __VA_ARGS__) _GMP_SEQ_INDEX_576
+#define _GMP_SEQ_INDEX_576(...) 576, __VA_ARGS__) _GMP_SEQ_INDEX_577
+#define _GMP_SEQ_INDEX_577(...) 577, __VA_ARGS__) _GMP_SEQ_INDEX_578
+#define _GMP_SEQ_INDEX_578(...) 578, __VA_ARGS__) _GMP_SEQ_INDEX_579
+#define _GMP_SEQ_INDEX_579(...) 579, __VA_ARGS__) _GMP_SEQ_INDEX_580
+#define _GMP_SEQ_INDEX_580(...) 580, __VA_ARGS__) _GMP_SEQ_INDEX_581
+#define _GMP_SEQ_INDEX_581(...) 581, __VA_ARGS__) _GMP_SEQ_INDEX_582
+#define _GMP_SEQ_INDEX_582(...) 582, __VA_ARGS__) _GMP_SEQ_INDEX_583
+#define _GMP_SEQ_INDEX_583(...) 583, __VA_ARGS__) _GMP_SEQ_INDEX_584
+#define _GMP_SEQ_INDEX_584(...) 584, __VA_ARGS__) _GMP_SEQ_INDEX_585
+#define _GMP_SEQ_INDEX_585(...) 585, __VA_ARGS__) _GMP_SEQ_INDEX_586
+#define _GMP_SEQ_INDEX_586(...) 586, __VA_ARGS__) _GMP_SEQ_INDEX_587
+#define _GMP_SEQ_INDEX_587(...) 587, __VA_ARGS__) _GMP_SEQ_INDEX_588
+#define _GMP_SEQ_INDEX_588(...) 588, __VA_ARGS__) _GMP_SEQ_INDEX_589
+#define _GMP_SEQ_INDEX_589(...) 589, __VA_ARGS__) _GMP_SEQ_INDEX_590
+#define _GMP_SEQ_INDEX_590(...) 590, __VA_ARGS__) _GMP_SEQ_INDEX_591
+#define _GMP_SEQ_INDEX_591(...) 591, __VA_ARGS__) _GMP_SEQ_INDEX_592
+#define _GMP_SEQ_INDEX_592(...) 592, __VA_ARGS__) _GMP_SEQ_INDEX_593
+#define _GMP_SEQ_INDEX_593(...) 593, __VA_ARGS__) _GMP_SEQ_INDEX_594
+#define _GMP_SEQ_INDEX_594(...) 594, __VA_ARGS__) _GMP_SEQ_INDEX_595
+#define _GMP_SEQ_INDEX_595(...) 595, __VA_ARGS__) _GMP_SEQ_INDEX_596
+#define _GMP_SEQ_INDEX_596(...) 596, __VA_ARGS__) _GMP_SEQ_INDEX_597
+#define _GMP_SEQ_INDEX_597(...) 597, __VA_ARGS__) _GMP_SEQ_INDEX_598
+#define _GMP_SEQ_INDEX_598(...) 598, __VA_ARGS__) _GMP_SEQ_INDEX_599
+#define _GMP_SEQ_INDEX_599(...) 599, __VA_ARGS__) _GMP_SEQ_INDEX_600
+#define _GMP_SEQ_INDEX_600(...) 600, __VA_ARGS__) _GMP_SEQ_INDEX_601
+#define _GMP_SEQ_INDEX_601(...) 601, __VA_ARGS__) _GMP_SEQ_INDEX_602
+#define _GMP_SEQ_INDEX_602(...) 602, __VA_ARGS__) _GMP_SEQ_INDEX_603
+#define _GMP_SEQ_INDEX_603(...) 603, __VA_ARGS__) _GMP_SEQ_INDEX_604
+#define _GMP_SEQ_INDEX_604(...) 604, __VA_ARGS__) _GMP_SEQ_INDEX_605
+#define _GMP_SEQ_INDEX_605(...) 605, __VA_ARGS__) _GMP_SEQ_INDEX_606
+#define _GMP_SEQ_INDEX_606(...) 606, __VA_ARGS__) _GMP_SEQ_INDEX_607
+#define _GMP_SEQ_INDEX_607(...) 607, __VA_ARGS__) _GMP_SEQ_INDEX_608
+#define _GMP_SEQ_INDEX_608(...) 608, __VA_ARGS__) _GMP_SEQ_INDEX_609
+#define _GMP_SEQ_INDEX_609(...) 609, __VA_ARGS__) _GMP_SEQ_INDEX_610
+#define _GMP_SEQ_INDEX_610(...) 610, __VA_ARGS__) _GMP_SEQ_INDEX_611
+#define _GMP_SEQ_INDEX_611(...) 611, __VA_ARGS__) _GMP_SEQ_INDEX_612
+#define _GMP_SEQ_INDEX_612(...) 612, __VA_ARGS__) _GMP_SEQ_INDEX_613
+#define _GMP_SEQ_INDEX_613(...) 613, __VA_ARGS__) _GMP_SEQ_INDEX_614
+#define _GMP_SEQ_INDEX_614(...) 614, __VA_ARGS__) _GMP_SEQ_INDEX_615
+#define _GMP_SEQ_INDEX_615(...) 615, __VA_ARGS__) _GMP_SEQ_INDEX_616
+#define _GMP_SEQ_INDEX_616(...) 616, __VA_ARGS__) _GMP_SEQ_INDEX_617
+#define _GMP_SEQ_INDEX_617(...) 617, __VA_ARGS__) _GMP_SEQ_INDEX_618
+#define _GMP_SEQ_INDEX_618(...) 618, __VA_ARGS__) _GMP_SEQ_INDEX_619
+#define _GMP_SEQ_INDEX_619(...) 619, __VA_ARGS__) _GMP_SEQ_INDEX_620
+#define _GMP_SEQ_INDEX_620(...) 620, __VA_ARGS__) _GMP_SEQ_INDEX_621
+#define _GMP_SEQ_INDEX_621(...) 621, __VA_ARGS__) _GMP_SEQ_INDEX_622
+#define _GMP_SEQ_INDEX_622(...) 622, __VA_ARGS__) _GMP_SEQ_INDEX_623
+#define _GMP_SEQ_INDEX_623(...) 623, __VA_ARGS__) _GMP_SEQ_INDEX_624
+#define _GMP_SEQ_INDEX_624(...) 624, __VA_ARGS__) _GMP_SEQ_INDEX_625
+#define _GMP_SEQ_INDEX_625(...) 625, __VA_ARGS__) _GMP_SEQ_INDEX_626
+#define _GMP_SEQ_INDEX_626(...) 626, __VA_ARGS__) _GMP_SEQ_INDEX_627
+#define _GMP_SEQ_INDEX_627(...) 627, __VA_ARGS__) _GMP_SEQ_INDEX_628
+#define _GMP_SEQ_INDEX_628(...) 628, __VA_ARGS__) _GMP_SEQ_INDEX_629
+#define _GMP_SEQ_INDEX_629(...) 629, __VA_ARGS__) _GMP_SEQ_INDEX_630
+#define _GMP_SEQ_INDEX_630(...) 630, __VA_ARGS__) _GMP_SEQ_INDEX_631
+#define _GMP_SEQ_INDEX_631(...) 631, __VA_ARGS__) _GMP_SEQ_INDEX_632
+#define _GMP_SEQ_INDEX_632(...) 632, __VA_ARGS__) _GMP_SEQ_INDEX_633
+#define _GMP_SEQ_INDEX_633(...) 633, __VA_ARGS__) _GMP_SEQ_INDEX_634
+#define _GMP_SEQ_INDEX_634(...) 634, __VA_ARGS__) _GMP_SEQ_INDEX_635
+#define _GMP_SEQ_INDEX_635(...) 635, __VA_ARGS__) _GMP_SEQ_INDEX_636
+#define _GMP_SEQ_INDEX_636(...) 636, __VA_ARGS__) _GMP_SEQ_INDEX_637
+#define _GMP_SEQ_INDEX_637(...) 637, __VA_ARGS__) _GMP_SEQ_INDEX_638
+#define _GMP_SEQ_INDEX_638(...) 638, __VA_ARGS__) _GMP_SEQ_INDEX_639
+#define _GMP_SEQ_INDEX_639(...) 639, __VA_ARGS__) _GMP_SEQ_INDEX_640
+#define _GMP_SEQ_INDEX_640(...) 640, __VA_ARGS__) _GMP_SEQ_INDEX_641
+#define _GMP_SEQ_INDEX_641(...) 641, __VA_ARGS__) _GMP_SEQ_INDEX_642
+#define _GMP_SEQ_INDEX_642(...) 642, __VA_ARGS__) _GMP_SEQ_INDEX_643
+#define _GMP_SEQ_INDEX_643(...) 643, __VA_ARGS__) _GMP_SEQ_INDEX_644
+#define _GMP_SEQ_INDEX_644(...) 644, __VA_ARGS__) _GMP_SEQ_INDEX_645
+#define _GMP_SEQ_INDEX_645(...) 645, __VA_ARGS__) _GMP_SEQ_INDEX_646
+#define _GMP_SEQ_INDEX_646(...) 646, __VA_ARGS__) _GMP_SEQ_INDEX_647
+#define _GMP_SEQ_INDEX_647(...) 647, __VA_ARGS__) _GMP_SEQ_INDEX_648
+#define _GMP_SEQ_INDEX_648(...) 648, __VA_ARGS__) _GMP_SEQ_INDEX_649
+#define _GMP_SEQ_INDEX_649(...) 649, __VA_ARGS__) _GMP_SEQ_INDEX_650
+#define _GMP_SEQ_INDEX_650(...) 650, __VA_ARGS__) _GMP_SEQ_INDEX_651
+#define _GMP_SEQ_INDEX_651(...) 651, __VA_ARGS__) _GMP_SEQ_INDEX_652
+#define _GMP_SEQ_INDEX_652(...) 652, __VA_ARGS__) _GMP_SEQ_INDEX_653
+#define _GMP_SEQ_INDEX_653(...) 653, __VA_ARGS__) _GMP_SEQ_INDEX_654
+#define _GMP_SEQ_INDEX_654(...) 654, __VA_ARGS__) _GMP_SEQ_INDEX_655
+#define _GMP_SEQ_INDEX_655(...) 655, __VA_ARGS__) _GMP_SEQ_INDEX_656
+#define _GMP_SEQ_INDEX_656(...) 656, __VA_ARGS__) _GMP_SEQ_INDEX_657
+#define _GMP_SEQ_INDEX_657(...) 657, __VA_ARGS__) _GMP_SEQ_INDEX_658
+#define _GMP_SEQ_INDEX_658(...) 658, __VA_ARGS__) _GMP_SEQ_INDEX_659
+#define _GMP_SEQ_INDEX_659(...) 659, __VA_ARGS__) _GMP_SEQ_INDEX_660
+#define _GMP_SEQ_INDEX_660(...) 660, __VA_ARGS__) _GMP_SEQ_INDEX_661
+#define _GMP_SEQ_INDEX_661(...) 661, __VA_ARGS__) _GMP_SEQ_INDEX_662
+#define _GMP_SEQ_INDEX_662(...) 662, __VA_ARGS__) _GMP_SEQ_INDEX_663
+#define _GMP_SEQ_INDEX_663(...) 663, __VA_ARGS__) _GMP_SEQ_INDEX_664
+#define _GMP_SEQ_INDEX_664(...) 664, __VA_ARGS__) _GMP_SEQ_INDEX_665
+#define _GMP_SEQ_INDEX_665(...) 665, __VA_ARGS__) _GMP_SEQ_INDEX_666
+#define _GMP_SEQ_INDEX_666(...) 666, __VA_ARGS__) _GMP_SEQ_INDEX_667
+#define _GMP_SEQ_INDEX_667(...) 667, __VA_ARGS__) _GMP_SEQ_INDEX_668
+#define _GMP_SEQ_INDEX_668(...) 668, __VA_ARGS__) _GMP_SEQ_INDEX_669
+#define _GMP_SEQ_INDEX_669(...) 669, __VA_ARGS__) _GMP_SEQ_INDEX_670
+#define _GMP_SEQ_INDEX_670(...) 670, __VA_ARGS__) _GMP_SEQ_INDEX_671
+#define _GMP_SEQ_INDEX_671(...) 671, __VA_ARGS__) _GMP_SEQ_INDEX_672
+#define _GMP_SEQ_INDEX_672(...) 672, __VA_ARGS__) _GMP_SEQ_INDEX_673
+#define _GMP_SEQ_INDEX_673(...) 673, __VA_ARGS__) _GMP_SEQ_INDEX_674
+#define _GMP_SEQ_INDEX_674(...) 674, __VA_ARGS__) _GMP_SEQ_INDEX_675
+#define _GMP_SEQ_INDEX_675(...) 675, __VA_ARGS__) _GMP_SEQ_INDEX_676
+#define _GMP_SEQ_INDEX_676(...) 676, __VA_ARGS__) _GMP_SEQ_INDEX_677
+#define _GMP_SEQ_INDEX_677(...) 677, __VA_ARGS__) _GMP_SEQ_INDEX_678
+#define _GMP_SEQ_INDEX_678(...) 678, __VA_ARGS__) _GMP_SEQ_INDEX_679
+#define _GMP_SEQ_INDEX_679(...) 679, __VA_ARGS__) _GMP_SEQ_INDEX_680
+#define _GMP_SEQ_INDEX_680(...) 680, __VA_ARGS__) _GMP_SEQ_INDEX_681
+#define _GMP_SEQ_INDEX_681(...) 681, __VA_ARGS__) _GMP_SEQ_INDEX_682
+#define _GMP_SEQ_INDEX_682(...) 682, __VA_ARGS__) _GMP_SEQ_INDEX_683
+#define _GMP_SEQ_INDEX_683(...) 683, __VA_ARGS__) _GMP_SEQ_INDEX_684
+#define _GMP_SEQ_INDEX_684(...) 684, __VA_ARGS__) _GMP_SEQ_INDEX_685
+#define _GMP_SEQ_INDEX_685(...) 685, __VA_ARGS__) _GMP_SEQ_INDEX_686
+#define _GMP_SEQ_INDEX_686(...) 686, __VA_ARGS__) _GMP_SEQ_INDEX_687
+#define _GMP_SEQ_INDEX_687(...) 687, __VA_ARGS__) _GMP_SEQ_INDEX_688
+#define _GMP_SEQ_INDEX_688(...) 688, __VA_ARGS__) _GMP_SEQ_INDEX_689
+#define _GMP_SEQ_INDEX_689(...) 689, __VA_ARGS__) _GMP_SEQ_INDEX_690
+#define _GMP_SEQ_INDEX_690(...) 690, __VA_ARGS__) _GMP_SEQ_INDEX_691
+#define _GMP_SEQ_INDEX_691(...) 691, __VA_ARGS__) _GMP_SEQ_INDEX_692
+#define _GMP_SEQ_INDEX_692(...) 692, __VA_ARGS__) _GMP_SEQ_INDEX_693
+#define _GMP_SEQ_INDEX_693(...) 693, __VA_ARGS__) _GMP_SEQ_INDEX_694
+#define _GMP_SEQ_INDEX_694(...) 694, __VA_ARGS__) _GMP_SEQ_INDEX_695
+#define _GMP_SEQ_INDEX_695(...) 695, __VA_ARGS__) _GMP_SEQ_INDEX_696
+#define _GMP_SEQ_INDEX_696(...) 696, __VA_ARGS__) _GMP_SEQ_INDEX_697
+#define _GMP_SEQ_INDEX_697(...) 697, __VA_ARGS__) _GMP_SEQ_INDEX_698
+#define _GMP_SEQ_INDEX_698(...) 698, __VA_ARGS__) _GMP_SEQ_INDEX_699
+#define _GMP_SEQ_INDEX_699(...) 699, __VA_ARGS__) _GMP_SEQ_INDEX_700
+#define _GMP_SEQ_INDEX_700(...) 700, __VA_ARGS__) _GMP_SEQ_INDEX_701
+#define _GMP_SEQ_INDEX_701(...) 701, __VA_ARGS__) _GMP_SEQ_INDEX_702
+#define _GMP_SEQ_INDEX_702(...) 702, __VA_ARGS__) _GMP_SEQ_INDEX_703
+#define _GMP_SEQ_INDEX_703(...) 703, __VA_ARGS__) _GMP_SEQ_INDEX_704
+#define _GMP_SEQ_INDEX_704(...) 704, __VA_ARGS__) _GMP_SEQ_INDEX_705
+#define _GMP_SEQ_INDEX_705(...) 705, __VA_ARGS__) _GMP_SEQ_INDEX_706
+#define _GMP_SEQ_INDEX_706(...) 706, __VA_ARGS__) _GMP_SEQ_INDEX_707
+#define _GMP_SEQ_INDEX_707(...) 707, __VA_ARGS__) _GMP_SEQ_INDEX_708
+#define _GMP_SEQ_INDEX_708(...) 708, __VA_ARGS__) _GMP_SEQ_INDEX_709
+#define _GMP_SEQ_INDEX_709(...) 709, __VA_ARGS__) _GMP_SEQ_INDEX_710
+#define _GMP_SEQ_INDEX_710(...) 710, __VA_ARGS__) _GMP_SEQ_INDEX_711
+#define _GMP_SEQ_INDEX_711(...) 711, __VA_ARGS__) _GMP_SEQ_INDEX_712
+#define _GMP_SEQ_INDEX_712(...) 712, __VA_ARGS__) _GMP_SEQ_INDEX_713
+#define _GMP_SEQ_INDEX_713(...) 713, __VA_ARGS__) _GMP_SEQ_INDEX_714
+#define _GMP_SEQ_INDEX_714(...) 714, __VA_ARGS__) _GMP_SEQ_INDEX_715
+#define _GMP_SEQ_INDEX_715(...) 715, __VA_ARGS__) _GMP_SEQ_INDEX_716
+#define _GMP_SEQ_INDEX_716(...) 716, __VA_ARGS__) _GMP_SEQ_INDEX_717
+#define _GMP_SEQ_INDEX_717(...) 717, __VA_ARGS__) _GMP_SEQ_INDEX_718
+#define _GMP_SEQ_INDEX_718(...) 718, __VA_ARGS__) _GMP_SEQ_INDEX_719
+#define _GMP_SEQ_INDEX_719(...) 719, __VA_ARGS__) _GMP_SEQ_INDEX_720
+#define _GMP_SEQ_INDEX_720(...) 720, __VA_ARGS__) _GMP_SEQ_INDEX_721
+#define _GMP_SEQ_INDEX_721(...) 721, __VA_ARGS__) _GMP_SEQ_INDEX_722
+#define _GMP_SEQ_INDEX_722(...) 722, __VA_ARGS__) _GMP_SEQ_INDEX_723
+#define _GMP_SEQ_INDEX_723(...) 723, __VA_ARGS__) _GMP_SEQ_INDEX_724
+#define _GMP_SEQ_INDEX_724(...) 724, __VA_ARGS__) _GMP_SEQ_INDEX_725
+#define _GMP_SEQ_INDEX_725(...) 725, __VA_ARGS__) _GMP_SEQ_INDEX_726
+#define _GMP_SEQ_INDEX_726(...) 726, __VA_ARGS__) _GMP_SEQ_INDEX_727
+#define _GMP_SEQ_INDEX_727(...) 727, __VA_ARGS__) _GMP_SEQ_INDEX_728
+#define _GMP_SEQ_INDEX_728(...) 728, __VA_ARGS__) _GMP_SEQ_INDEX_729
+#define _GMP_SEQ_INDEX_729(...) 729, __VA_ARGS__) _GMP_SEQ_INDEX_730
+#define _GMP_SEQ_INDEX_730(...) 730, __VA_ARGS__) _GMP_SEQ_INDEX_731
+#define _GMP_SEQ_INDEX_731(...) 731, __VA_ARGS__) _GMP_SEQ_INDEX_732
+#define _GMP_SEQ_INDEX_732(...) 732, __VA_ARGS__) _GMP_SEQ_INDEX_733
+#define _GMP_SEQ_INDEX_733(...) 733, __VA_ARGS__) _GMP_SEQ_INDEX_734
+#define _GMP_SEQ_INDEX_734(...) 734, __VA_ARGS__) _GMP_SEQ_INDEX_735
+#define _GMP_SEQ_INDEX_735(...) 735, __VA_ARGS__) _GMP_SEQ_INDEX_736
+#define _GMP_SEQ_INDEX_736(...) 736, __VA_ARGS__) _GMP_SEQ_INDEX_737
+#define _GMP_SEQ_INDEX_737(...) 737, __VA_ARGS__) _GMP_SEQ_INDEX_738
+#define _GMP_SEQ_INDEX_738(...) 738, __VA_ARGS__) _GMP_SEQ_INDEX_739
+#define _GMP_SEQ_INDEX_739(...) 739, __VA_ARGS__) _GMP_SEQ_INDEX_740
+#define _GMP_SEQ_INDEX_740(...) 740, __VA_ARGS__) _GMP_SEQ_INDEX_741
+#define _GMP_SEQ_INDEX_741(...) 741, __VA_ARGS__) _GMP_SEQ_INDEX_742
+#define _GMP_SEQ_INDEX_742(...) 742, __VA_ARGS__) _GMP_SEQ_INDEX_743
+#define _GMP_SEQ_INDEX_743(...) 743, __VA_ARGS__) _GMP_SEQ_INDEX_744
+#define _GMP_SEQ_INDEX_744(...) 744, __VA_ARGS__) _GMP_SEQ_INDEX_745
+#define _GMP_SEQ_INDEX_745(...) 745, __VA_ARGS__) _GMP_SEQ_INDEX_746
+#define _GMP_SEQ_INDEX_746(...) 746, __VA_ARGS__) _GMP_SEQ_INDEX_747
+#define _GMP_SEQ_INDEX_747(...) 747, __VA_ARGS__) _GMP_SEQ_INDEX_748
+#define _GMP_SEQ_INDEX_748(...) 748, __VA_ARGS__) _GMP_SEQ_INDEX_749
+#define _GMP_SEQ_INDEX_749(...) 749, __VA_ARGS__) _GMP_SEQ_INDEX_750
+#define _GMP_SEQ_INDEX_750(...) 750, __VA_ARGS__) _GMP_SEQ_INDEX_751
+#define _GMP_SEQ_INDEX_751(...) 751, __VA_ARGS__) _GMP_SEQ_INDEX_752
+#define _GMP_SEQ_INDEX_752(...) 752, __VA_ARGS__) _GMP_SEQ_INDEX_753
+#define _GMP_SEQ_INDEX_753(...) 753, __VA_ARGS__) _GMP_SEQ_INDEX_754
+#define _GMP_SEQ_INDEX_754(...) 754, __VA_ARGS__) _GMP_SEQ_INDEX_755
+#define _GMP_SEQ_INDEX_755(...) 755, __VA_ARGS__) _GMP_SEQ_INDEX_756
+#define _GMP_SEQ_INDEX_756(...) 756, __VA_ARGS__) _GMP_SEQ_INDEX_757
+#define _GMP_SEQ_INDEX_757(...) 757, __VA_ARGS__) _GMP_SEQ_INDEX_758
+#define _GMP_SEQ_INDEX_758(...) 758, __VA_ARGS__) _GMP_SEQ_INDEX_759
+#define _GMP_SEQ_INDEX_759(...) 759, __VA_ARGS__) _GMP_SEQ_INDEX_760
+#define _GMP_SEQ_INDEX_760(...) 760, __VA_ARGS__) _GMP_SEQ_INDEX_761
+#define _GMP_SEQ_INDEX_761(...) 761, __VA_ARGS__) _GMP_SEQ_INDEX_762
+#define _GMP_SEQ_INDEX_762(...) 762, __VA_ARGS__) _GMP_SEQ_INDEX_763
+#define _GMP_SEQ_INDEX_763(...) 763, __VA_ARGS__) _GMP_SEQ_INDEX_764
+#define _GMP_SEQ_INDEX_764(...) 764, __VA_ARGS__) _GMP_SEQ_INDEX_765
+#define _GMP_SEQ_INDEX_765(...) 765, __VA_ARGS__) _GMP_SEQ_INDEX_766
+#define _GMP_SEQ_INDEX_766(...) 766, __VA_ARGS__) _GMP_SEQ_INDEX_767
+#define _GMP_SEQ_INDEX_767(...) 767, __VA_ARGS__) _GMP_SEQ_INDEX_768
+#define _GMP_SEQ_INDEX_768(...) 768, __VA_ARGS__) _GMP_SEQ_INDEX_769
+#define _GMP_SEQ_INDEX_769(...) 769, __VA_ARGS__) _GMP_SEQ_INDEX_770
+#define _GMP_SEQ_INDEX_770(...) 770, __VA_ARGS__) _GMP_SEQ_INDEX_771
+#define _GMP_SEQ_INDEX_771(...) 771, __VA_ARGS__) _GMP_SEQ_INDEX_772
+#define _GMP_SEQ_INDEX_772(...) 772, __VA_ARGS__) _GMP_SEQ_INDEX_773
+#define _GMP_SEQ_INDEX_773(...) 773, __VA_ARGS__) _GMP_SEQ_INDEX_774
+#define _GMP_SEQ_INDEX_774(...) 774, __VA_ARGS__) _GMP_SEQ_INDEX_775
+#define _GMP_SEQ_INDEX_775(...) 775, __VA_ARGS__) _GMP_SEQ_INDEX_776
+#define _GMP_SEQ_INDEX_776(...) 776, __VA_ARGS__) _GMP_SEQ_INDEX_777
+#define _GMP_SEQ_INDEX_777(...) 777, __VA_ARGS__) _GMP_SEQ_INDEX_778
+#define _GMP_SEQ_INDEX_778(...) 778, __VA_ARGS__) _GMP_SEQ_INDEX_779
+#define _GMP_SEQ_INDEX_779(...) 779, __VA_ARGS__) _GMP_SEQ_INDEX_780
+#define _GMP_SEQ_INDEX_780(...) 780, __VA_ARGS__) _GMP_SEQ_INDEX_781
+#define _GMP_SEQ_INDEX_781(...) 781, __VA_ARGS__) _GMP_SEQ_INDEX_782
+#define _GMP_SEQ_INDEX_782(...) 782, __VA_ARGS__) _GMP_SEQ_INDEX_783
+#define _GMP_SEQ_INDEX_783(...) 783, __VA_ARGS__) _GMP_SEQ_INDEX_784
+#define _GMP_SEQ_INDEX_784(...) 784, __VA_ARGS__) _GMP_SEQ_INDEX_785
+#define _GMP_SEQ_INDEX_785(...) 785, __VA_ARGS__) _GMP_SEQ_INDEX_786
+#define _GMP_SEQ_INDEX_786(...) 786, __VA_ARGS__) _GMP_SEQ_INDEX_787
+#define _GMP_SEQ_INDEX_787(...) 787, __VA_ARGS__) _GMP_SEQ_INDEX_788
+#define _GMP_SEQ_INDEX_788(...) 788, __VA_ARGS__) _GMP_SEQ_INDEX_789
+#define _GMP_SEQ_INDEX_789(...) 789, __VA_ARGS__) _GMP_SEQ_INDEX_790
+#define _GMP_SEQ_INDEX_790(...) 790, __VA_ARGS__) _GMP_SEQ_INDEX_791
+#define _GMP_SEQ_INDEX_791(...) 791, __VA_ARGS__) _GMP_SEQ_INDEX_792
+#define _GMP_SEQ_INDEX_792(...) 792, __VA_ARGS__) _GMP_SEQ_INDEX_793
+#define _GMP_SEQ_INDEX_793(...) 793, __VA_ARGS__) _GMP_SEQ_INDEX_794
+#define _GMP_SEQ_INDEX_794(...) 794, __VA_ARGS__) _GMP_SEQ_INDEX_795
+#define _GMP_SEQ_INDEX_795(...) 795, __VA_ARGS__) _GMP_SEQ_INDEX_796
+#define _GMP_SEQ_INDEX_796(...) 796, __VA_ARGS__) _GMP_SEQ_INDEX_797
+#define _GMP_SEQ_INDEX_797(...) 797, __VA_ARGS__) _GMP_SEQ_INDEX_798
+#define _GMP_SEQ_INDEX_798(...) 798, __VA_ARGS__) _GMP_SEQ_INDEX_799
+#define _GMP_SEQ_INDEX_799(...) 799, __VA_ARGS__) _GMP_SEQ_INDEX_800
+#define _GMP_SEQ_INDEX_800(...) 800, __VA_ARGS__) _GMP_SEQ_INDEX_801
+#define _GMP_SEQ_INDEX_801(...) 801, __VA_ARGS__) _GMP_SEQ_INDEX_802
+#define _GMP_SEQ_INDEX_802(...) 802, __VA_ARGS__) _GMP_SEQ_INDEX_803
+#define _GMP_SEQ_INDEX_803(...) 803, __VA_ARGS__) _GMP_SEQ_INDEX_804
+#define _GMP_SEQ_INDEX_804(...) 804, __VA_ARGS__) _GMP_SEQ_INDEX_805
+#define _GMP_SEQ_INDEX_805(...) 805, __VA_ARGS__) _GMP_SEQ_INDEX_806
+#define _GMP_SEQ_INDEX_806(...) 806, __VA_ARGS__) _GMP_SEQ_INDEX_807
+#define _GMP_SEQ_INDEX_807(...) 807, __VA_ARGS__) _GMP_SEQ_INDEX_808
+#define _GMP_SEQ_INDEX_808(...) 808, __VA_ARGS__) _GMP_SEQ_INDEX_809
+#define _GMP_SEQ_INDEX_809(...) 809, __VA_ARGS__) _GMP_SEQ_INDEX_810
+#define _GMP_SEQ_INDEX_810(...) 810, __VA_ARGS__) _GMP_SEQ_INDEX_811
+#define _GMP_SEQ_INDEX_811(...) 811, __VA_ARGS__) _GMP_SEQ_INDEX_812
+#define _GMP_SEQ_INDEX_812(...) 812, __VA_ARGS__) _GMP_SEQ_INDEX_813
+#define _GMP_SEQ_INDEX_813(...) 813, __VA_ARGS__) _GMP_SEQ_INDEX_814
+#define _GMP_SEQ_INDEX_814(...) 814, __VA_ARGS__) _GMP_SEQ_INDEX_815
+#define _GMP_SEQ_INDEX_815(...) 815, __VA_ARGS__) _GMP_SEQ_INDEX_816
+#define _GMP_SEQ_INDEX_816(...) 816, __VA_ARGS__) _GMP_SEQ_INDEX_817
+#define _GMP_SEQ_INDEX_817(...) 817, __VA_ARGS__) _GMP_SEQ_INDEX_818
+#define _GMP_SEQ_INDEX_818(...) 818, __VA_ARGS__) _GMP_SEQ_INDEX_819
+#define _GMP_SEQ_INDEX_819(...) 819, __VA_ARGS__) _GMP_SEQ_INDEX_820
+#define _GMP_SEQ_INDEX_820(...) 820, __VA_ARGS__) _GMP_SEQ_INDEX_821
+#define _GMP_SEQ_INDEX_821(...) 821, __VA_ARGS__) _GMP_SEQ_INDEX_822
+#define _GMP_SEQ_INDEX_822(...) 822, __VA_ARGS__) _GMP_SEQ_INDEX_823
+#define _GMP_SEQ_INDEX_823(...) 823, __VA_ARGS__) _GMP_SEQ_INDEX_824
+#define _GMP_SEQ_INDEX_824(...) 824, __VA_ARGS__) _GMP_SEQ_INDEX_825
+#define _GMP_SEQ_INDEX_825(...) 825, __VA_ARGS__) _GMP_SEQ_INDEX_826
+#define _GMP_SEQ_INDEX_826(...) 826, __VA_ARGS__) _GMP_SEQ_INDEX_827
+#define _GMP_SEQ_INDEX_827(...) 827, __VA_ARGS__) _GMP_SEQ_INDEX_828
+#define _GMP_SEQ_INDEX_828(...) 828, __VA_ARGS__) _GMP_SEQ_INDEX_829
+#define _GMP_SEQ_INDEX_829(...) 829, __VA_ARGS__) _GMP_SEQ_INDEX_830
+#define _GMP_SEQ_INDEX_830(...) 830, __VA_ARGS__) _GMP_SEQ_INDEX_831
+#define _GMP_SEQ_INDEX_831(...) 831, __VA_ARGS__) _GMP_SEQ_INDEX_832
+#define _GMP_SEQ_INDEX_832(...) 832, __VA_ARGS__) _GMP_SEQ_INDEX_833
+#define _GMP_SEQ_INDEX_833(...) 833, __VA_ARGS__) _GMP_SEQ_INDEX_834
+#define _GMP_SEQ_INDEX_834(...) 834, __VA_ARGS__) _GMP_SEQ_INDEX_835
+#define _GMP_SEQ_INDEX_835(...) 835, __VA_ARGS__) _GMP_SEQ_INDEX_836
+#define _GMP_SEQ_INDEX_836(...) 836, __VA_ARGS__) _GMP_SEQ_INDEX_837
+#define _GMP_SEQ_INDEX_837(...) 837, __VA_ARGS__) _GMP_SEQ_INDEX_838
+#define _GMP_SEQ_INDEX_838(...) 838, __VA_ARGS__) _GMP_SEQ_INDEX_839
+#define _GMP_SEQ_INDEX_839(...) 839, __VA_ARGS__) _GMP_SEQ_INDEX_840
+#define _GMP_SEQ_INDEX_840(...) 840, __VA_ARGS__) _GMP_SEQ_INDEX_841
+#define _GMP_SEQ_INDEX_841(...) 841, __VA_ARGS__) _GMP_SEQ_INDEX_842
+#define _GMP_SEQ_INDEX_842(...) 842, __VA_ARGS__) _GMP_SEQ_INDEX_843
+#define _GMP_SEQ_INDEX_843(...) 843, __VA_ARGS__) _GMP_SEQ_INDEX_844
+#define _GMP_SEQ_INDEX_844(...) 844, __VA_ARGS__) _GMP_SEQ_INDEX_845
+#define _GMP_SEQ_INDEX_845(...) 845, __VA_ARGS__) _GMP_SEQ_INDEX_846
+#define _GMP_SEQ_INDEX_846(...) 846, __VA_ARGS__) _GMP_SEQ_INDEX_847
+#define _GMP_SEQ_INDEX_847(...) 847, __VA_ARGS__) _GMP_SEQ_INDEX_848
+#define _GMP_SEQ_INDEX_848(...) 848, __VA_ARGS__) _GMP_SEQ_INDEX_849
+#define _GMP_SEQ_INDEX_849(...) 849, __VA_ARGS__) _GMP_SEQ_INDEX_850
+#define _GMP_SEQ_INDEX_850(...) 850, __VA_ARGS__) _GMP_SEQ_INDEX_851
+#define _GMP_SEQ_INDEX_851(...) 851, __VA_ARGS__) _GMP_SEQ_INDEX_852
+#define _GMP_SEQ_INDEX_852(...) 852, __VA_ARGS__) _GMP_SEQ_INDEX_853
+#define _GMP_SEQ_INDEX_853(...) 853, __VA_ARGS__) _GMP_SEQ_INDEX_854
+#define _GMP_SEQ_INDEX_854(...) 854, __VA_ARGS__) _GMP_SEQ_INDEX_855
+#define _GMP_SEQ_INDEX_855(...) 855, __VA_ARGS__) _GMP_SEQ_INDEX_856
+#define _GMP_SEQ_INDEX_856(...) 856, __VA_ARGS__) _GMP_SEQ_INDEX_857
+#define _GMP_SEQ_INDEX_857(...) 857, __VA_ARGS__) _GMP_SEQ_INDEX_858
+#define _GMP_SEQ_INDEX_858(...) 858, __VA_ARGS__) _GMP_SEQ_INDEX_859
+#define _GMP_SEQ_INDEX_859(...) 859, __VA_ARGS__) _GMP_SEQ_INDEX_860
+#define _GMP_SEQ_INDEX_860(...) 860, __VA_ARGS__) _GMP_SEQ_INDEX_861
+#define _GMP_SEQ_INDEX_861(...) 861, __VA_ARGS__) _GMP_SEQ_INDEX_862
+#define _GMP_SEQ_INDEX_862(...) 862, __VA_ARGS__) _GMP_SEQ_INDEX_863
+#define _GMP_SEQ_INDEX_863(...) 863, __VA_ARGS__) _GMP_SEQ_INDEX_864
+#define _GMP_SEQ_INDEX_864(...) 864, __VA_ARGS__) _GMP_SEQ_INDEX_865
+#define _GMP_SEQ_INDEX_865(...) 865, __VA_ARGS__) _GMP_SEQ_INDEX_866
+#define _GMP_SEQ_INDEX_866(...) 866, __VA_ARGS__) _GMP_SEQ_INDEX_867
+#define _GMP_SEQ_INDEX_867(...) 867, __VA_ARGS__) _GMP_SEQ_INDEX_868
+#define _GMP_SEQ_INDEX_868(...) 868, __VA_ARGS__) _GMP_SEQ_INDEX_869
+#define _GMP_SEQ_INDEX_869(...) 869, __VA_ARGS__) _GMP_SEQ_INDEX_870
+#define _GMP_SEQ_INDEX_870(...) 870, __VA_ARGS__) _GMP_SEQ_INDEX_871
+#define _GMP_SEQ_INDEX_871(...) 871, __VA_ARGS__) _GMP_SEQ_INDEX_872
+#define _GMP_SEQ_INDEX_872(...) 872, __VA_ARGS__) _GMP_SEQ_INDEX_873
+#define _GMP_SEQ_INDEX_873(...) 873, __VA_ARGS__) _GMP_SEQ_INDEX_874
+#define _GMP_SEQ_INDEX_874(...) 874, __VA_ARGS__) _GMP_SEQ_INDEX_875
+#define _GMP_SEQ_INDEX_875(...) 875, __VA_ARGS__) _GMP_SEQ_INDEX_876
+#define _GMP_SEQ_INDEX_876(...) 876, __VA_ARGS__) _GMP_SEQ_INDEX_877
+#define _GMP_SEQ_INDEX_877(...) 877, __VA_ARGS__) _GMP_SEQ_INDEX_878
+#define _GMP_SEQ_INDEX_878(...) 878, __VA_ARGS__) _GMP_SEQ_INDEX_879
+#define _GMP_SEQ_INDEX_879(...) 879, __VA_ARGS__) _GMP_SEQ_INDEX_880
+#define _GMP_SEQ_INDEX_880(...) 880, __VA_ARGS__) _GMP_SEQ_INDEX_881
+#define _GMP_SEQ_INDEX_881(...) 881, __VA_ARGS__) _GMP_SEQ_INDEX_882
+#define _GMP_SEQ_INDEX_882(...) 882, __VA_ARGS__) _GMP_SEQ_INDEX_883
+#define _GMP_SEQ_INDEX_883(...) 883, __VA_ARGS__) _GMP_SEQ_INDEX_884
+#define _GMP_SEQ_INDEX_884(...) 884, __VA_ARGS__) _GMP_SEQ_INDEX_885
+#define _GMP_SEQ_INDEX_885(...) 885, __VA_ARGS__) _GMP_SEQ_INDEX_886
+#define _GMP_SEQ_INDEX_886(...) 886, __VA_ARGS__) _GMP_SEQ_INDEX_887
+#define _GMP_SEQ_INDEX_887(...) 887, __VA_ARGS__) _GMP_SEQ_INDEX_888
+#define _GMP_SEQ_INDEX_888(...) 888, __VA_ARGS__) _GMP_SEQ_INDEX_889
+#define _GMP_SEQ_INDEX_889(...) 889, __VA_ARGS__) _GMP_SEQ_INDEX_890
+#define _GMP_SEQ_INDEX_890(...) 890, __VA_ARGS__) _GMP_SEQ_INDEX_891
+#define _GMP_SEQ_INDEX_891(...) 891, __VA_ARGS__) _GMP_SEQ_INDEX_892
+#define _GMP_SEQ_INDEX_892(...) 892, __VA_ARGS__) _GMP_SEQ_INDEX_893
+#define _GMP_SEQ_INDEX_893(...) 893, __VA_ARGS__) _GMP_SEQ_INDEX_894
+#define _GMP_SEQ_INDEX_894(...) 894, __VA_ARGS__) _GMP_SEQ_INDEX_895
+#define _GMP_SEQ_INDEX_895(...) 895, __VA_ARGS__) _GMP_SEQ_INDEX_896
+#define _GMP_SEQ_INDEX_896(...) 896, __VA_ARGS__) _GMP_SEQ_INDEX_897
+#define _GMP_SEQ_INDEX_897(...) 897, __VA_ARGS__) _GMP_SEQ_INDEX_898
+#define _GMP_SEQ_INDEX_898(...) 898, __VA_ARGS__) _GMP_SEQ_INDEX_899
+#define _GMP_SEQ_INDEX_899(...) 899, __VA_ARGS__) _GMP_SEQ_INDEX_900
+#define _GMP_SEQ_INDEX_900(...) 900, __VA_ARGS__) _GMP_SEQ_INDEX_901
+#define _GMP_SEQ_INDEX_901(...) 901, __VA_ARGS__) _GMP_SEQ_INDEX_902
+#define _GMP_SEQ_INDEX_902(...) 902, __VA_ARGS__) _GMP_SEQ_INDEX_903
+#define _GMP_SEQ_INDEX_903(...) 903, __VA_ARGS__) _GMP_SEQ_INDEX_904
+#define _GMP_SEQ_INDEX_904(...) 904, __VA_ARGS__) _GMP_SEQ_INDEX_905
+#define _GMP_SEQ_INDEX_905(...) 905, __VA_ARGS__) _GMP_SEQ_INDEX_906
+#define _GMP_SEQ_INDEX_906(...) 906, __VA_ARGS__) _GMP_SEQ_INDEX_907
+#define _GMP_SEQ_INDEX_907(...) 907, __VA_ARGS__) _GMP_SEQ_INDEX_908
+#define _GMP_SEQ_INDEX_908(...) 908, __VA_ARGS__) _GMP_SEQ_INDEX_909
+#define _GMP_SEQ_INDEX_909(...) 909, __VA_ARGS__) _GMP_SEQ_INDEX_910
+#define _GMP_SEQ_INDEX_910(...) 910, __VA_ARGS__) _GMP_SEQ_INDEX_911
+#define _GMP_SEQ_INDEX_911(...) 911, __VA_ARGS__) _GMP_SEQ_INDEX_912
+#define _GMP_SEQ_INDEX_912(...) 912, __VA_ARGS__) _GMP_SEQ_INDEX_913
+#define _GMP_SEQ_INDEX_913(...) 913, __VA_ARGS__) _GMP_SEQ_INDEX_914
+#define _GMP_SEQ_INDEX_914(...) 914, __VA_ARGS__) _GMP_SEQ_INDEX_915
+#define _GMP_SEQ_INDEX_915(...) 915, __VA_ARGS__) _GMP_SEQ_INDEX_916
+#define _GMP_SEQ_INDEX_916(...) 916, __VA_ARGS__) _GMP_SEQ_INDEX_917
+#define _GMP_SEQ_INDEX_917(...) 917, __VA_ARGS__) _GMP_SEQ_INDEX_918
+#define _GMP_SEQ_INDEX_918(...) 918, __VA_ARGS__) _GMP_SEQ_INDEX_919
+#define _GMP_SEQ_INDEX_919(...) 919, __VA_ARGS__) _GMP_SEQ_INDEX_920
+#define _GMP_SEQ_INDEX_920(...) 920, __VA_ARGS__) _GMP_SEQ_INDEX_921
+#define _GMP_SEQ_INDEX_921(...) 921, __VA_ARGS__) _GMP_SEQ_INDEX_922
+#define _GMP_SEQ_INDEX_922(...) 922, __VA_ARGS__) _GMP_SEQ_INDEX_923
+#define _GMP_SEQ_INDEX_923(...) 923, __VA_ARGS__) _GMP_SEQ_INDEX_924
+#define _GMP_SEQ_INDEX_924(...) 924, __VA_ARGS__) _GMP_SEQ_INDEX_925
+#define _GMP_SEQ_INDEX_925(...) 925, __VA_ARGS__) _GMP_SEQ_INDEX_926
+#define _GMP_SEQ_INDEX_926(...) 926, __VA_ARGS__) _GMP_SEQ_INDEX_927
+#define _GMP_SEQ_INDEX_927(...) 927, __VA_ARGS__) _GMP_SEQ_INDEX_928
+#define _GMP_SEQ_INDEX_928(...) 928, __VA_ARGS__) _GMP_SEQ_INDEX_929
+#define _GMP_SEQ_INDEX_929(...) 929, __VA_ARGS__) _GMP_SEQ_INDEX_930
+#define _GMP_SEQ_INDEX_930(...) 930, __VA_ARGS__) _GMP_SEQ_INDEX_931
+#define _GMP_SEQ_INDEX_931(...) 931, __VA_ARGS__) _GMP_SEQ_INDEX_932
+#define _GMP_SEQ_INDEX_932(...) 932, __VA_ARGS__) _GMP_SEQ_INDEX_933
+#define _GMP_SEQ_INDEX_933(...) 933, __VA_ARGS__) _GMP_SEQ_INDEX_934
+#define _GMP_SEQ_INDEX_934(...) 934, __VA_ARGS__) _GMP_SEQ_INDEX_935
+#define _GMP_SEQ_INDEX_935(...) 935, __VA_ARGS__) _GMP_SEQ_INDEX_936
+#define _GMP_SEQ_INDEX_936(...) 936, __VA_ARGS__) _GMP_SEQ_INDEX_937
+#define _GMP_SEQ_INDEX_937(...) 937, __VA_ARGS__) _GMP_SEQ_INDEX_938
+#define _GMP_SEQ_INDEX_938(...) 938, __VA_ARGS__) _GMP_SEQ_INDEX_939
+#define _GMP_SEQ_INDEX_939(...) 939, __VA_ARGS__) _GMP_SEQ_INDEX_940
+#define _GMP_SEQ_INDEX_940(...) 940, __VA_ARGS__) _GMP_SEQ_INDEX_941
+#define _GMP_SEQ_INDEX_941(...) 941, __VA_ARGS__) _GMP_SEQ_INDEX_942
+#define _GMP_SEQ_INDEX_942(...) 942, __VA_ARGS__) _GMP_SEQ_INDEX_943
+#define _GMP_SEQ_INDEX_943(...) 943, __VA_ARGS__) _GMP_SEQ_INDEX_944
+#define _GMP_SEQ_INDEX_944(...) 944, __VA_ARGS__) _GMP_SEQ_INDEX_945
+#define _GMP_SEQ_INDEX_945(...) 945, __VA_ARGS__) _GMP_SEQ_INDEX_946
+#define _GMP_SEQ_INDEX_946(...) 946, __VA_ARGS__) _GMP_SEQ_INDEX_947
+#define _GMP_SEQ_INDEX_947(...) 947, __VA_ARGS__) _GMP_SEQ_INDEX_948
+#define _GMP_SEQ_INDEX_948(...) 948, __VA_ARGS__) _GMP_SEQ_INDEX_949
+#define _GMP_SEQ_INDEX_949(...) 949, __VA_ARGS__) _GMP_SEQ_INDEX_950
+#define _GMP_SEQ_INDEX_950(...) 950, __VA_ARGS__) _GMP_SEQ_INDEX_951
+#define _GMP_SEQ_INDEX_951(...) 951, __VA_ARGS__) _GMP_SEQ_INDEX_952
+#define _GMP_SEQ_INDEX_952(...) 952, __VA_ARGS__) _GMP_SEQ_INDEX_953
+#define _GMP_SEQ_INDEX_953(...) 953, __VA_ARGS__) _GMP_SEQ_INDEX_954
+#define _GMP_SEQ_INDEX_954(...) 954, __VA_ARGS__) _GMP_SEQ_INDEX_955
+#define _GMP_SEQ_INDEX_955(...) 955, __VA_ARGS__) _GMP_SEQ_INDEX_956
+#define _GMP_SEQ_INDEX_956(...) 956, __VA_ARGS__) _GMP_SEQ_INDEX_957
+#define _GMP_SEQ_INDEX_957(...) 957, __VA_ARGS__) _GMP_SEQ_INDEX_958
+#define _GMP_SEQ_INDEX_958(...) 958, __VA_ARGS__) _GMP_SEQ_INDEX_959
+#define _GMP_SEQ_INDEX_959(...) 959, __VA_ARGS__) _GMP_SEQ_INDEX_960
+#define _GMP_SEQ_INDEX_960(...) 960, __VA_ARGS__) _GMP_SEQ_INDEX_961
+#define _GMP_SEQ_INDEX_961(...) 961, __VA_ARGS__) _GMP_SEQ_INDEX_962
+#define _GMP_SEQ_INDEX_962(...) 962, __VA_ARGS__) _GMP_SEQ_INDEX_963
+#define _GMP_SEQ_INDEX_963(...) 963, __VA_ARGS__) _GMP_SEQ_INDEX_964
+#define _GMP_SEQ_INDEX_964(...) 964, __VA_ARGS__) _GMP_SEQ_INDEX_965
+#define _GMP_SEQ_INDEX_965(...) 965, __VA_ARGS__) _GMP_SEQ_INDEX_966
+#define _GMP_SEQ_INDEX_966(...) 966, __VA_ARGS__) _GMP_SEQ_INDEX_967
+#define _GMP_SEQ_INDEX_967(...) 967, __VA_ARGS__) _GMP_SEQ_INDEX_968
+#define _GMP_SEQ_INDEX_968(...) 968, __VA_ARGS__) _GMP_SEQ_INDEX_969
+#define _GMP_SEQ_INDEX_969(...) 969, __VA_ARGS__) _GMP_SEQ_INDEX_970
+#define _GMP_SEQ_INDEX_970(...) 970, __VA_ARGS__) _GMP_SEQ_INDEX_971
+#define _GMP_SEQ_INDEX_971(...) 971, __VA_ARGS__) _GMP_SEQ_INDEX_972
+#define _GMP_SEQ_INDEX_972(...) 972, __VA_ARGS__) _GMP_SEQ_INDEX_973
+#define _GMP_SEQ_INDEX_973(...) 973, __VA_ARGS__) _GMP_SEQ_INDEX_974
+#define _GMP_SEQ_INDEX_974(...) 974, __VA_ARGS__) _GMP_SEQ_INDEX_975
+#define _GMP_SEQ_INDEX_975(...) 975, __VA_ARGS__) _GMP_SEQ_INDEX_976
+#define _GMP_SEQ_INDEX_976(...) 976, __VA_ARGS__) _GMP_SEQ_INDEX_977
+#define _GMP_SEQ_INDEX_977(...) 977, __VA_ARGS__) _GMP_SEQ_INDEX_978
+#define _GMP_SEQ_INDEX_978(...) 978, __VA_ARGS__) _GMP_SEQ_INDEX_979
+#define _GMP_SEQ_INDEX_979(...) 979, __VA_ARGS__) _GMP_SEQ_INDEX_980
+#define _GMP_SEQ_INDEX_980(...) 980, __VA_ARGS__) _GMP_SEQ_INDEX_981
+#define _GMP_SEQ_INDEX_981(...) 981, __VA_ARGS__) _GMP_SEQ_INDEX_982
+#define _GMP_SEQ_INDEX_982(...) 982, __VA_ARGS__) _GMP_SEQ_INDEX_983
+#define _GMP_SEQ_INDEX_983(...) 983, __VA_ARGS__) _GMP_SEQ_INDEX_984
+#define _GMP_SEQ_INDEX_984(...) 984, __VA_ARGS__) _GMP_SEQ_INDEX_985
+#define _GMP_SEQ_INDEX_985(...) 985, __VA_ARGS__) _GMP_SEQ_INDEX_986
+#define _GMP_SEQ_INDEX_986(...) 986, __VA_ARGS__) _GMP_SEQ_INDEX_987
+#define _GMP_SEQ_INDEX_987(...) 987, __VA_ARGS__) _GMP_SEQ_INDEX_988
+#define _GMP_SEQ_INDEX_988(...) 988, __VA_ARGS__) _GMP_SEQ_INDEX_989
+#define _GMP_SEQ_INDEX_989(...) 989, __VA_ARGS__) _GMP_SEQ_INDEX_990
+#define _GMP_SEQ_INDEX_990(...) 990, __VA_ARGS__) _GMP_SEQ_INDEX_991
+#define _GMP_SEQ_INDEX_991(...) 991, __VA_ARGS__) _GMP_SEQ_INDEX_992
+#define _GMP_SEQ_INDEX_992(...) 992, __VA_ARGS__) _GMP_SEQ_INDEX_993
+#define _GMP_SEQ_INDEX_993(...) 993, __VA_ARGS__) _GMP_SEQ_INDEX_994
+#define _GMP_SEQ_INDEX_994(...) 994, __VA_ARGS__) _GMP_SEQ_INDEX_995
+#define _GMP_SEQ_INDEX_995(...) 995, __VA_ARGS__) _GMP_SEQ_INDEX_996
+#define _GMP_SEQ_INDEX_996(...) 996, __VA_ARGS__) _GMP_SEQ_INDEX_997
+#define _GMP_SEQ_INDEX_997(...) 997, __VA_ARGS__) _GMP_SEQ_INDEX_998
+#define _GMP_SEQ_INDEX_998(...) 998, __VA_ARGS__) _GMP_SEQ_INDEX_999
+#define _GMP_SEQ_INDEX_999(...) 999, __VA_ARGS__) _GMP_SEQ_INDEX_1000
+#define _GMP_SEQ_INDEX_1000(...) 1000, __VA_ARGS__) _GMP_SEQ_INDEX_1001
+#define _GMP_SEQ_INDEX_1001(...) 1001, __VA_ARGS__) _GMP_SEQ_INDEX_1002
+#define _GMP_SEQ_INDEX_1002(...) 1002, __VA_ARGS__) _GMP_SEQ_INDEX_1003
+#define _GMP_SEQ_INDEX_1003(...) 1003, __VA_ARGS__) _GMP_SEQ_INDEX_1004
+#define _GMP_SEQ_INDEX_1004(...) 1004, __VA_ARGS__) _GMP_SEQ_INDEX_1005
+#define _GMP_SEQ_INDEX_1005(...) 1005, __VA_ARGS__) _GMP_SEQ_INDEX_1006
+#define _GMP_SEQ_INDEX_1006(...) 1006, __VA_ARGS__) _GMP_SEQ_INDEX_1007
+#define _GMP_SEQ_INDEX_1007(...) 1007, __VA_ARGS__) _GMP_SEQ_INDEX_1008
+#define _GMP_SEQ_INDEX_1008(...) 1008, __VA_ARGS__) _GMP_SEQ_INDEX_1009
+#define _GMP_SEQ_INDEX_1009(...) 1009, __VA_ARGS__) _GMP_SEQ_INDEX_1010
+#define _GMP_SEQ_INDEX_1010(...) 1010, __VA_ARGS__) _GMP_SEQ_INDEX_1011
+#define _GMP_SEQ_INDEX_1011(...) 1011, __VA_ARGS__) _GMP_SEQ_INDEX_1012
+#define _GMP_SEQ_INDEX_1012(...) 1012, __VA_ARGS__) _GMP_SEQ_INDEX_1013
+#define _GMP_SEQ_INDEX_1013(...) 1013, __VA_ARGS__) _GMP_SEQ_INDEX_1014
+#define _GMP_SEQ_INDEX_1014(...) 1014, __VA_ARGS__) _GMP_SEQ_INDEX_1015
+#define _GMP_SEQ_INDEX_1015(...) 1015, __VA_ARGS__) _GMP_SEQ_INDEX_1016
+#define _GMP_SEQ_INDEX_1016(...) 1016, __VA_ARGS__) _GMP_SEQ_INDEX_1017
+#define _GMP_SEQ_INDEX_1017(...) 1017, __VA_ARGS__) _GMP_SEQ_INDEX_1018
+#define _GMP_SEQ_INDEX_1018(...) 1018, __VA_ARGS__) _GMP_SEQ_INDEX_1019
+#define _GMP_SEQ_INDEX_1019(...) 1019, __VA_ARGS__) _GMP_SEQ_INDEX_1020
+#define _GMP_SEQ_INDEX_1020(...) 1020, __VA_ARGS__) _GMP_SEQ_INDEX_1021
+#define _GMP_SEQ_INDEX_1021(...) 1021, __VA_ARGS__) _GMP_SEQ_INDEX_1022
+#define _GMP_SEQ_INDEX_1022(...) 1022, __VA_ARGS__) _GMP_SEQ_INDEX_1023
+#define _GMP_SEQ_INDEX_1023(...) 1023, __VA_ARGS__) _GMP_SEQ_INDEX_1024
+#define _GMP_SEQ_FOR_EACH_0(call, data, sep, ...)
+#define _GMP_SEQ_FOR_EACH_1(call, data, sep, i, ...) call(data, i, __VA_ARGS__) _GMP_SEQ_FOR_EACH_0(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_2(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_3(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_2(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_4(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_3(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_5(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_4(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_6(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_5(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_7(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_6(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_8(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_7(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_9(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_8(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_10(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_9(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_11(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_10(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_12(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_11(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_13(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_12(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_14(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_13(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_15(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_14(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_16(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_15(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_17(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_16(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_18(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_17(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_19(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_18(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_20(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_19(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_21(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_20(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_22(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_21(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_23(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_22(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_24(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_23(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_25(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_24(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_26(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_25(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_27(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_26(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_28(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_27(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_29(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_28(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_30(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_29(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_31(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_30(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_32(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_31(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_33(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_32(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_34(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_33(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_35(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_34(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_36(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_35(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_37(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_36(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_38(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_37(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_39(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_38(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_40(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_39(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_41(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_40(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_42(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_41(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_43(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_42(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_44(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_43(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_45(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_44(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_46(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_45(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_47(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_46(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_48(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_47(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_49(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_48(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_50(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_49(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_51(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_50(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_52(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_51(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_53(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_52(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_54(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_53(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_55(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_54(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_56(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_55(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_57(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_56(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_58(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_57(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_59(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_58(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_60(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_59(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_61(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_60(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_62(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_61(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_63(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_62(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_64(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_63(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_65(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_64(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_66(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_65(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_67(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_66(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_68(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_67(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_69(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_68(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_70(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_69(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_71(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_70(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_72(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_71(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_73(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_72(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_74(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_73(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_75(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_74(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_76(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_75(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_77(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_76(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_78(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_77(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_79(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_78(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_80(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_79(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_81(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_80(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_82(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_81(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_83(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_82(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_84(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_83(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_85(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_84(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_86(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_85(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_87(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_86(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_88(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_87(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_89(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_88(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_90(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_89(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_91(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_90(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_92(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_91(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_93(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_92(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_94(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_93(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_95(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_94(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_96(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_95(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_97(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_96(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_98(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_97(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_99(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_98(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_100(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_99(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_101(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_100(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_102(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_101(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_103(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_102(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_104(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_103(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_105(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_104(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_106(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_105(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_107(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_106(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_108(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_107(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_109(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_108(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_110(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_109(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_111(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_110(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_112(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_111(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_113(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_112(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_114(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_113(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_115(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_114(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_116(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_115(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_117(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_116(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_118(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_117(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_119(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_118(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_120(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_119(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_121(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_120(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_122(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_121(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_123(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_122(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_124(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_123(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_125(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_124(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_126(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_125(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_127(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_126(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_128(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_127(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_129(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_128(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_130(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_129(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_131(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_130(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_132(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_131(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_133(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_132(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_134(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_133(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_135(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_134(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_136(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_135(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_137(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_136(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_138(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_137(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_139(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_138(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_140(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_139(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_141(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_140(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_142(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_141(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_143(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_142(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_144(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_143(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_145(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_144(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_146(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_145(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_147(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_146(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_148(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_147(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_149(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_148(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_150(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_149(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_151(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_150(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_152(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_151(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_153(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_152(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_154(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_153(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_155(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_154(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_156(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_155(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_157(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_156(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_158(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_157(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_159(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_158(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_160(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_159(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_161(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_160(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_162(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_161(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_163(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_162(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_164(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_163(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_165(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_164(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_166(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_165(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_167(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_166(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_168(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_167(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_169(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_168(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_170(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_169(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_171(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_170(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_172(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_171(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_173(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_172(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_174(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_173(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_175(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_174(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_176(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_175(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_177(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_176(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_178(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_177(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_179(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_178(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_180(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_179(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_181(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_180(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_182(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_181(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_183(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_182(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_184(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_183(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_185(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_184(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_186(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_185(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_187(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_186(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_188(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_187(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_189(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_188(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_190(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_189(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_191(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_190(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_192(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_191(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_193(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_192(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_194(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_193(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_195(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_194(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_196(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_195(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_197(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_196(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_198(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_197(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_199(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_198(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_200(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_199(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_201(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_200(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_202(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_201(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_203(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_202(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_204(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_203(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_205(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_204(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_206(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_205(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_207(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_206(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_208(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_207(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_209(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_208(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_210(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_209(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_211(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_210(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_212(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_211(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_213(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_212(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_214(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_213(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_215(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_214(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_216(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_215(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_217(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_216(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_218(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_217(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_219(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_218(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_220(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_219(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_221(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_220(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_222(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_221(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_223(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_222(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_224(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_223(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_225(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_224(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_226(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_225(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_227(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_226(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_228(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_227(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_229(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_228(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_230(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_229(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_231(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_230(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_232(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_231(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_233(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_232(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_234(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_233(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_235(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_234(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_236(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_235(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_237(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_236(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_238(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_237(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_239(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_238(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_240(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_239(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_241(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_240(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_242(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_241(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_243(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_242(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_244(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_243(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_245(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_244(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_246(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_245(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_247(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_246(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_248(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_247(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_249(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_248(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_250(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_249(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_251(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_250(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_252(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_251(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_253(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_252(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_254(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_253(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_255(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_254(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_256(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_255(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_257(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_256(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_258(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_257(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_259(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_258(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_260(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_259(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_261(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_260(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_262(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_261(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_263(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_262(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_264(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_263(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_265(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_264(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_266(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_265(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_267(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_266(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_268(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_267(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_269(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_268(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_270(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_269(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_271(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_270(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_272(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_271(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_273(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_272(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_274(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_273(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_275(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_274(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_276(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_275(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_277(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_276(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_278(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_277(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_279(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_278(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_280(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_279(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_281(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_280(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_282(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_281(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_283(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_282(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_284(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_283(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_285(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_284(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_286(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_285(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_287(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_286(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_288(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_287(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_289(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_288(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_290(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_289(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_291(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_290(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_292(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_291(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_293(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_292(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_294(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_293(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_295(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_294(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_296(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_295(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_297(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_296(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_298(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_297(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_299(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_298(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_300(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_299(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_301(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_300(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_302(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_301(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_303(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_302(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_304(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_303(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_305(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_304(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_306(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_305(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_307(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_306(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_308(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_307(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_309(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_308(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_310(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_309(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_311(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_310(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_312(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_311(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_313(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_312(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_314(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_313(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_315(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_314(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_316(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_315(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_317(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_316(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_318(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_317(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_319(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_318(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_320(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_319(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_321(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_320(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_322(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_321(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_323(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_322(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_324(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_323(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_325(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_324(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_326(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_325(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_327(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_326(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_328(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_327(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_329(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_328(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_330(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_329(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_331(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_330(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_332(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_331(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_333(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_332(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_334(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_333(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_335(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_334(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_336(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_335(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_337(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_336(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_338(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_337(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_339(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_338(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_340(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_339(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_341(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_340(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_342(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_341(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_343(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_342(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_344(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_343(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_345(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_344(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_346(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_345(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_347(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_346(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_348(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_347(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_349(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_348(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_350(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_349(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_351(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_350(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_352(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_351(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_353(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_352(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_354(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_353(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_355(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_354(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_356(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_355(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_357(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_356(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_358(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_357(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_359(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_358(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_360(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_359(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_361(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_360(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_362(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_361(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_363(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_362(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_364(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_363(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_365(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_364(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_366(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_365(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_367(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_366(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_368(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_367(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_369(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_368(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_370(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_369(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_371(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_370(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_372(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_371(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_373(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_372(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_374(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_373(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_375(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_374(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_376(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_375(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_377(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_376(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_378(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_377(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_379(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_378(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_380(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_379(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_381(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_380(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_382(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_381(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_383(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_382(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_384(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_383(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_385(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_384(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_386(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_385(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_387(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_386(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_388(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_387(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_389(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_388(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_390(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_389(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_391(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_390(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_392(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_391(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_393(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_392(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_394(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_393(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_395(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_394(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_396(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_395(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_397(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_396(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_398(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_397(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_399(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_398(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_400(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_399(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_401(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_400(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_402(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_401(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_403(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_402(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_404(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_403(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_405(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_404(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_406(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_405(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_407(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_406(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_408(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_407(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_409(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_408(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_410(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_409(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_411(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_410(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_412(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_411(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_413(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_412(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_414(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_413(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_415(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_414(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_416(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_415(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_417(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_416(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_418(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_417(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_419(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_418(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_420(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_419(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_421(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_420(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_422(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_421(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_423(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_422(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_424(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_423(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_425(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_424(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_426(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_425(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_427(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_426(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_428(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_427(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_429(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_428(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_430(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_429(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_431(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_430(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_432(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_431(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_433(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_432(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_434(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_433(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_435(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_434(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_436(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_435(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_437(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_436(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_438(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_437(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_439(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_438(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_440(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_439(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_441(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_440(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_442(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_441(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_443(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_442(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_444(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_443(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_445(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_444(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_446(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_445(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_447(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_446(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_448(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_447(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_449(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_448(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_450(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_449(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_451(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_450(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_452(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_451(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_453(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_452(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_454(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_453(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_455(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_454(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_456(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_455(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_457(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_456(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_458(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_457(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_459(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_458(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_460(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_459(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_461(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_460(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_462(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_461(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_463(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_462(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_464(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_463(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_465(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_464(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_466(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_465(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_467(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_466(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_468(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_467(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_469(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_468(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_470(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_469(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_471(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_470(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_472(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_471(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_473(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_472(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_474(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_473(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_475(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_474(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_476(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_475(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_477(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_476(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_478(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_477(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_479(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_478(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_480(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_479(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_481(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_480(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_482(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_481(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_483(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_482(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_484(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_483(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_485(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_484(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_486(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_485(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_487(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_486(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_488(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_487(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_489(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_488(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_490(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_489(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_491(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_490(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_492(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_491(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_493(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_492(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_494(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_493(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_495(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_494(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_496(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_495(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_497(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_496(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_498(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_497(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_499(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_498(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_500(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_499(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_501(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_500(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_502(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_501(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_503(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_502(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_504(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_503(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_505(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_504(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_506(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_505(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_507(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_506(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_508(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_507(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_509(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_508(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_510(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_509(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_511(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_510(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_512(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_511(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_513(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_512(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_514(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_513(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_515(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_514(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_516(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_515(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_517(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_516(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_518(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_517(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_519(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_518(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_520(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_519(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_521(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_520(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_522(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_521(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_523(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_522(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_524(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_523(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_525(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_524(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_526(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_525(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_527(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_526(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_528(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_527(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_529(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_528(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_530(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_529(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_531(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_530(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_532(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_531(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_533(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_532(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_534(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_533(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_535(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_534(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_536(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_535(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_537(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_536(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_538(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_537(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_539(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_538(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_540(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_539(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_541(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_540(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_542(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_541(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_543(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_542(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_544(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_543(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_545(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_544(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_546(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_545(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_547(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_546(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_548(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_547(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_549(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_548(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_550(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_549(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_551(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_550(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_552(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_551(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_553(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_552(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_554(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_553(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_555(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_554(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_556(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_555(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_557(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_556(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_558(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_557(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_559(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_558(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_560(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_559(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_561(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_560(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_562(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_561(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_563(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_562(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_564(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_563(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_565(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_564(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_566(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_565(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_567(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_566(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_568(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_567(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_569(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_568(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_570(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_569(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_571(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_570(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_572(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_571(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_573(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_572(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_574(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_573(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_575(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_574(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_576(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_575(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_577(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_576(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_578(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_577(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_579(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_578(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_580(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_579(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_581(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_580(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_582(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_581(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_583(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_582(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_584(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_583(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_585(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_584(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_586(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_585(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_587(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_586(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_588(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_587(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_589(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_588(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_590(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_589(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_591(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_590(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_592(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_591(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_593(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_592(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_594(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_593(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_595(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_594(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_596(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_595(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_597(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_596(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_598(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_597(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_599(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_598(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_600(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_599(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_601(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_600(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_602(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_601(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_603(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_602(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_604(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_603(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_605(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_604(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_606(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_605(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_607(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_606(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_608(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_607(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_609(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_608(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_610(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_609(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_611(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_610(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_612(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_611(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_613(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_612(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_614(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_613(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_615(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_614(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_616(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_615(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_617(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_616(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_618(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_617(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_619(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_618(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_620(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_619(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_621(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_620(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_622(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_621(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_623(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_622(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_624(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_623(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_625(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_624(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_626(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_625(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_627(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_626(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_628(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_627(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_629(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_628(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_630(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_629(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_631(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_630(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_632(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_631(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_633(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_632(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_634(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_633(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_635(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_634(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_636(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_635(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_637(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_636(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_638(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_637(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_639(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_638(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_640(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_639(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_641(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_640(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_642(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_641(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_643(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_642(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_644(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_643(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_645(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_644(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_646(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_645(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_647(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_646(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_648(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_647(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_649(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_648(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_650(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_649(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_651(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_650(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_652(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_651(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_653(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_652(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_654(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_653(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_655(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_654(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_656(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_655(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_657(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_656(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_658(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_657(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_659(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_658(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_660(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_659(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_661(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_660(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_662(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_661(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_663(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_662(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_664(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_663(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_665(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_664(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_666(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_665(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_667(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_666(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_668(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_667(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_669(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_668(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_670(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_669(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_671(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_670(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_672(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_671(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_673(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_672(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_674(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_673(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_675(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_674(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_676(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_675(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_677(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_676(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_678(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_677(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_679(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_678(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_680(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_679(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_681(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_680(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_682(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_681(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_683(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_682(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_684(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_683(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_685(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_684(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_686(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_685(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_687(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_686(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_688(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_687(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_689(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_688(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_690(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_689(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_691(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_690(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_692(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_691(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_693(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_692(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_694(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_693(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_695(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_694(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_696(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_695(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_697(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_696(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_698(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_697(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_699(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_698(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_700(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_699(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_701(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_700(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_702(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_701(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_703(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_702(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_704(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_703(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_705(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_704(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_706(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_705(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_707(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_706(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_708(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_707(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_709(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_708(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_710(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_709(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_711(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_710(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_712(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_711(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_713(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_712(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_714(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_713(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_715(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_714(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_716(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_715(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_717(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_716(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_718(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_717(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_719(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_718(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_720(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_719(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_721(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_720(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_722(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_721(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_723(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_722(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_724(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_723(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_725(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_724(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_726(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_725(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_727(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_726(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_728(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_727(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_729(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_728(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_730(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_729(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_731(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_730(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_732(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_731(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_733(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_732(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_734(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_733(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_735(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_734(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_736(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_735(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_737(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_736(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_738(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_737(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_739(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_738(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_740(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_739(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_741(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_740(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_742(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_741(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_743(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_742(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_744(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_743(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_745(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_744(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_746(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_745(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_747(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_746(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_748(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_747(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_749(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_748(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_750(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_749(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_751(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_750(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_752(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_751(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_753(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_752(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_754(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_753(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_755(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_754(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_756(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_755(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_757(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_756(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_758(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_757(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_759(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_758(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_760(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_759(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_761(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_760(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_762(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_761(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_763(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_762(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_764(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_763(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_765(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_764(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_766(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_765(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_767(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_766(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_768(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_767(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_769(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_768(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_770(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_769(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_771(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_770(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_772(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_771(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_773(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_772(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_774(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_773(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_775(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_774(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_776(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_775(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_777(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_776(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_778(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_777(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_779(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_778(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_780(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_779(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_781(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_780(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_782(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_781(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_783(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_782(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_784(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_783(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_785(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_784(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_786(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_785(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_787(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_786(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_788(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_787(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_789(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_788(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_790(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_789(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_791(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_790(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_792(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_791(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_793(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_792(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_794(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_793(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_795(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_794(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_796(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_795(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_797(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_796(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_798(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_797(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_799(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_798(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_800(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_799(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_801(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_800(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_802(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_801(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_803(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_802(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_804(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_803(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_805(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_804(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_806(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_805(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_807(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_806(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_808(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_807(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_809(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_808(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_810(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_809(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_811(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_810(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_812(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_811(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_813(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_812(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_814(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_813(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_815(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_814(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_816(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_815(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_817(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_816(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_818(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_817(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_819(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_818(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_820(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_819(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_821(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_820(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_822(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_821(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_823(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_822(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_824(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_823(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_825(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_824(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_826(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_825(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_827(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_826(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_828(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_827(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_829(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_828(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_830(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_829(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_831(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_830(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_832(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_831(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_833(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_832(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_834(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_833(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_835(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_834(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_836(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_835(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_837(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_836(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_838(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_837(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_839(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_838(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_840(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_839(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_841(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_840(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_842(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_841(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_843(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_842(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_844(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_843(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_845(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_844(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_846(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_845(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_847(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_846(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_848(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_847(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_849(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_848(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_850(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_849(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_851(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_850(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_852(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_851(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_853(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_852(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_854(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_853(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_855(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_854(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_856(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_855(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_857(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_856(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_858(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_857(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_859(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_858(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_860(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_859(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_861(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_860(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_862(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_861(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_863(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_862(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_864(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_863(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_865(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_864(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_866(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_865(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_867(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_866(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_868(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_867(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_869(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_868(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_870(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_869(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_871(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_870(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_872(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_871(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_873(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_872(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_874(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_873(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_875(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_874(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_876(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_875(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_877(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_876(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_878(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_877(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_879(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_878(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_880(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_879(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_881(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_880(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_882(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_881(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_883(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_882(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_884(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_883(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_885(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_884(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_886(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_885(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_887(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_886(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_888(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_887(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_889(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_888(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_890(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_889(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_891(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_890(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_892(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_891(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_893(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_892(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_894(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_893(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_895(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_894(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_896(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_895(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_897(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_896(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_898(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_897(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_899(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_898(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_900(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_899(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_901(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_900(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_902(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_901(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_903(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_902(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_904(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_903(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_905(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_904(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_906(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_905(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_907(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_906(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_908(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_907(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_909(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_908(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_910(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_909(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_911(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_910(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_912(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_911(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_913(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_912(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_914(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_913(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_915(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_914(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_916(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_915(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_917(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_916(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_918(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_917(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_919(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_918(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_920(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_919(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_921(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_920(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_922(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_921(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_923(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_922(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_924(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_923(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_925(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_924(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_926(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_925(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_927(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_926(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_928(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_927(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_929(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_928(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_930(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_929(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_931(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_930(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_932(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_931(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_933(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_932(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_934(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_933(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_935(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_934(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_936(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_935(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_937(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_936(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_938(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_937(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_939(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_938(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_940(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_939(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_941(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_940(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_942(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_941(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_943(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_942(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_944(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_943(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_945(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_944(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_946(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_945(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_947(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_946(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_948(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_947(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_949(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_948(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_950(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_949(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_951(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_950(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_952(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_951(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_953(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_952(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_954(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_953(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_955(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_954(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_956(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_955(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_957(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_956(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_958(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_957(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_959(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_958(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_960(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_959(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_961(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_960(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_962(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_961(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_963(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_962(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_964(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_963(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_965(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_964(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_966(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_965(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_967(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_966(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_968(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_967(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_969(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_968(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_970(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_969(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_971(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_970(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_972(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_971(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_973(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_972(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_974(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_973(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_975(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_974(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_976(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_975(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_977(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_976(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_978(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_977(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_979(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_978(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_980(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_979(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_981(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_980(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_982(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_981(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_983(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_982(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_984(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_983(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_985(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_984(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_986(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_985(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_987(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_986(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_988(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_987(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_989(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_988(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_990(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_989(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_991(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_990(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_992(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_991(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_993(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_992(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_994(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_993(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_995(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_994(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_996(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_995(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_997(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_996(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_998(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_997(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_999(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_998(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1000(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_999(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1001(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1000(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1002(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1001(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1003(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1002(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1004(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1003(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1005(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1004(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1006(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1005(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1007(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1006(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1008(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1007(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1009(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1008(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1010(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1009(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1011(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1010(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1012(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1011(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1013(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1012(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1014(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1013(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1015(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1014(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1016(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1015(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1017(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1016(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1018(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1017(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1019(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1018(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1020(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1019(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1021(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1020(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1022(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1021(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1023(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1022(call, data, sep,
+#define _GMP_SEQ_FOR_EACH_1024(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() _GMP_SEQ_FOR_EACH_1023(call, data, sep,
+#define _GMP_SEQ_FOLD_0(op, state, ...) state
+#define _GMP_SEQ_FOLD_1(op, state, i, ...) _GMP_SEQ_FOLD_0(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_2(op, state, i, ...) _GMP_SEQ_FOLD_1(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_3(op, state, i, ...) _GMP_SEQ_FOLD_2(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_4(op, state, i, ...) _GMP_SEQ_FOLD_3(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_5(op, state, i, ...) _GMP_SEQ_FOLD_4(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_6(op, state, i, ...) _GMP_SEQ_FOLD_5(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_7(op, state, i, ...) _GMP_SEQ_FOLD_6(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_8(op, state, i, ...) _GMP_SEQ_FOLD_7(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_9(op, state, i, ...) _GMP_SEQ_FOLD_8(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_10(op, state, i, ...) _GMP_SEQ_FOLD_9(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_11(op, state, i, ...) _GMP_SEQ_FOLD_10(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_12(op, state, i, ...) _GMP_SEQ_FOLD_11(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_13(op, state, i, ...) _GMP_SEQ_FOLD_12(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_14(op, state, i, ...) _GMP_SEQ_FOLD_13(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_15(op, state, i, ...) _GMP_SEQ_FOLD_14(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_16(op, state, i, ...) _GMP_SEQ_FOLD_15(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_17(op, state, i, ...) _GMP_SEQ_FOLD_16(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_18(op, state, i, ...) _GMP_SEQ_FOLD_17(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_19(op, state, i, ...) _GMP_SEQ_FOLD_18(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_20(op, state, i, ...) _GMP_SEQ_FOLD_19(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_21(op, state, i, ...) _GMP_SEQ_FOLD_20(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_22(op, state, i, ...) _GMP_SEQ_FOLD_21(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_23(op, state, i, ...) _GMP_SEQ_FOLD_22(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_24(op, state, i, ...) _GMP_SEQ_FOLD_23(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_25(op, state, i, ...) _GMP_SEQ_FOLD_24(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_26(op, state, i, ...) _GMP_SEQ_FOLD_25(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_27(op, state, i, ...) _GMP_SEQ_FOLD_26(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_28(op, state, i, ...) _GMP_SEQ_FOLD_27(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_29(op, state, i, ...) _GMP_SEQ_FOLD_28(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_30(op, state, i, ...) _GMP_SEQ_FOLD_29(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_31(op, state, i, ...) _GMP_SEQ_FOLD_30(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_32(op, state, i, ...) _GMP_SEQ_FOLD_31(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_33(op, state, i, ...) _GMP_SEQ_FOLD_32(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_34(op, state, i, ...) _GMP_SEQ_FOLD_33(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_35(op, state, i, ...) _GMP_SEQ_FOLD_34(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_36(op, state, i, ...) _GMP_SEQ_FOLD_35(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_37(op, state, i, ...) _GMP_SEQ_FOLD_36(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_38(op, state, i, ...) _GMP_SEQ_FOLD_37(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_39(op, state, i, ...) _GMP_SEQ_FOLD_38(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_40(op, state, i, ...) _GMP_SEQ_FOLD_39(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_41(op, state, i, ...) _GMP_SEQ_FOLD_40(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_42(op, state, i, ...) _GMP_SEQ_FOLD_41(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_43(op, state, i, ...) _GMP_SEQ_FOLD_42(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_44(op, state, i, ...) _GMP_SEQ_FOLD_43(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_45(op, state, i, ...) _GMP_SEQ_FOLD_44(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_46(op, state, i, ...) _GMP_SEQ_FOLD_45(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_47(op, state, i, ...) _GMP_SEQ_FOLD_46(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_48(op, state, i, ...) _GMP_SEQ_FOLD_47(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_49(op, state, i, ...) _GMP_SEQ_FOLD_48(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_50(op, state, i, ...) _GMP_SEQ_FOLD_49(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_51(op, state, i, ...) _GMP_SEQ_FOLD_50(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_52(op, state, i, ...) _GMP_SEQ_FOLD_51(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_53(op, state, i, ...) _GMP_SEQ_FOLD_52(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_54(op, state, i, ...) _GMP_SEQ_FOLD_53(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_55(op, state, i, ...) _GMP_SEQ_FOLD_54(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_56(op, state, i, ...) _GMP_SEQ_FOLD_55(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_57(op, state, i, ...) _GMP_SEQ_FOLD_56(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_58(op, state, i, ...) _GMP_SEQ_FOLD_57(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_59(op, state, i, ...) _GMP_SEQ_FOLD_58(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_60(op, state, i, ...) _GMP_SEQ_FOLD_59(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_61(op, state, i, ...) _GMP_SEQ_FOLD_60(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_62(op, state, i, ...) _GMP_SEQ_FOLD_61(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_63(op, state, i, ...) _GMP_SEQ_FOLD_62(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_64(op, state, i, ...) _GMP_SEQ_FOLD_63(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_65(op, state, i, ...) _GMP_SEQ_FOLD_64(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_66(op, state, i, ...) _GMP_SEQ_FOLD_65(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_67(op, state, i, ...) _GMP_SEQ_FOLD_66(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_68(op, state, i, ...) _GMP_SEQ_FOLD_67(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_69(op, state, i, ...) _GMP_SEQ_FOLD_68(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_70(op, state, i, ...) _GMP_SEQ_FOLD_69(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_71(op, state, i, ...) _GMP_SEQ_FOLD_70(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_72(op, state, i, ...) _GMP_SEQ_FOLD_71(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_73(op, state, i, ...) _GMP_SEQ_FOLD_72(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_74(op, state, i, ...) _GMP_SEQ_FOLD_73(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_75(op, state, i, ...) _GMP_SEQ_FOLD_74(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_76(op, state, i, ...) _GMP_SEQ_FOLD_75(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_77(op, state, i, ...) _GMP_SEQ_FOLD_76(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_78(op, state, i, ...) _GMP_SEQ_FOLD_77(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_79(op, state, i, ...) _GMP_SEQ_FOLD_78(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_80(op, state, i, ...) _GMP_SEQ_FOLD_79(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_81(op, state, i, ...) _GMP_SEQ_FOLD_80(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_82(op, state, i, ...) _GMP_SEQ_FOLD_81(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_83(op, state, i, ...) _GMP_SEQ_FOLD_82(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_84(op, state, i, ...) _GMP_SEQ_FOLD_83(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_85(op, state, i, ...) _GMP_SEQ_FOLD_84(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_86(op, state, i, ...) _GMP_SEQ_FOLD_85(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_87(op, state, i, ...) _GMP_SEQ_FOLD_86(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_88(op, state, i, ...) _GMP_SEQ_FOLD_87(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_89(op, state, i, ...) _GMP_SEQ_FOLD_88(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_90(op, state, i, ...) _GMP_SEQ_FOLD_89(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_91(op, state, i, ...) _GMP_SEQ_FOLD_90(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_92(op, state, i, ...) _GMP_SEQ_FOLD_91(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_93(op, state, i, ...) _GMP_SEQ_FOLD_92(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_94(op, state, i, ...) _GMP_SEQ_FOLD_93(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_95(op, state, i, ...) _GMP_SEQ_FOLD_94(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_96(op, state, i, ...) _GMP_SEQ_FOLD_95(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_97(op, state, i, ...) _GMP_SEQ_FOLD_96(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_98(op, state, i, ...) _GMP_SEQ_FOLD_97(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_99(op, state, i, ...) _GMP_SEQ_FOLD_98(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_100(op, state, i, ...) _GMP_SEQ_FOLD_99(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_101(op, state, i, ...) _GMP_SEQ_FOLD_100(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_102(op, state, i, ...) _GMP_SEQ_FOLD_101(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_103(op, state, i, ...) _GMP_SEQ_FOLD_102(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_104(op, state, i, ...) _GMP_SEQ_FOLD_103(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_105(op, state, i, ...) _GMP_SEQ_FOLD_104(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_106(op, state, i, ...) _GMP_SEQ_FOLD_105(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_107(op, state, i, ...) _GMP_SEQ_FOLD_106(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_108(op, state, i, ...) _GMP_SEQ_FOLD_107(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_109(op, state, i, ...) _GMP_SEQ_FOLD_108(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_110(op, state, i, ...) _GMP_SEQ_FOLD_109(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_111(op, state, i, ...) _GMP_SEQ_FOLD_110(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_112(op, state, i, ...) _GMP_SEQ_FOLD_111(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_113(op, state, i, ...) _GMP_SEQ_FOLD_112(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_114(op, state, i, ...) _GMP_SEQ_FOLD_113(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_115(op, state, i, ...) _GMP_SEQ_FOLD_114(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_116(op, state, i, ...) _GMP_SEQ_FOLD_115(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_117(op, state, i, ...) _GMP_SEQ_FOLD_116(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_118(op, state, i, ...) _GMP_SEQ_FOLD_117(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_119(op, state, i, ...) _GMP_SEQ_FOLD_118(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_120(op, state, i, ...) _GMP_SEQ_FOLD_119(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_121(op, state, i, ...) _GMP_SEQ_FOLD_120(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_122(op, state, i, ...) _GMP_SEQ_FOLD_121(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_123(op, state, i, ...) _GMP_SEQ_FOLD_122(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_124(op, state, i, ...) _GMP_SEQ_FOLD_123(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_125(op, state, i, ...) _GMP_SEQ_FOLD_124(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_126(op, state, i, ...) _GMP_SEQ_FOLD_125(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_127(op, state, i, ...) _GMP_SEQ_FOLD_126(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_128(op, state, i, ...) _GMP_SEQ_FOLD_127(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_129(op, state, i, ...) _GMP_SEQ_FOLD_128(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_130(op, state, i, ...) _GMP_SEQ_FOLD_129(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_131(op, state, i, ...) _GMP_SEQ_FOLD_130(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_132(op, state, i, ...) _GMP_SEQ_FOLD_131(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_133(op, state, i, ...) _GMP_SEQ_FOLD_132(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_134(op, state, i, ...) _GMP_SEQ_FOLD_133(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_135(op, state, i, ...) _GMP_SEQ_FOLD_134(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_136(op, state, i, ...) _GMP_SEQ_FOLD_135(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_137(op, state, i, ...) _GMP_SEQ_FOLD_136(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_138(op, state, i, ...) _GMP_SEQ_FOLD_137(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_139(op, state, i, ...) _GMP_SEQ_FOLD_138(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_140(op, state, i, ...) _GMP_SEQ_FOLD_139(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_141(op, state, i, ...) _GMP_SEQ_FOLD_140(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_142(op, state, i, ...) _GMP_SEQ_FOLD_141(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_143(op, state, i, ...) _GMP_SEQ_FOLD_142(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_144(op, state, i, ...) _GMP_SEQ_FOLD_143(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_145(op, state, i, ...) _GMP_SEQ_FOLD_144(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_146(op, state, i, ...) _GMP_SEQ_FOLD_145(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_147(op, state, i, ...) _GMP_SEQ_FOLD_146(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_148(op, state, i, ...) _GMP_SEQ_FOLD_147(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_149(op, state, i, ...) _GMP_SEQ_FOLD_148(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_150(op, state, i, ...) _GMP_SEQ_FOLD_149(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_151(op, state, i, ...) _GMP_SEQ_FOLD_150(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_152(op, state, i, ...) _GMP_SEQ_FOLD_151(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_153(op, state, i, ...) _GMP_SEQ_FOLD_152(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_154(op, state, i, ...) _GMP_SEQ_FOLD_153(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_155(op, state, i, ...) _GMP_SEQ_FOLD_154(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_156(op, state, i, ...) _GMP_SEQ_FOLD_155(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_157(op, state, i, ...) _GMP_SEQ_FOLD_156(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_158(op, state, i, ...) _GMP_SEQ_FOLD_157(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_159(op, state, i, ...) _GMP_SEQ_FOLD_158(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_160(op, state, i, ...) _GMP_SEQ_FOLD_159(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_161(op, state, i, ...) _GMP_SEQ_FOLD_160(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_162(op, state, i, ...) _GMP_SEQ_FOLD_161(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_163(op, state, i, ...) _GMP_SEQ_FOLD_162(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_164(op, state, i, ...) _GMP_SEQ_FOLD_163(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_165(op, state, i, ...) _GMP_SEQ_FOLD_164(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_166(op, state, i, ...) _GMP_SEQ_FOLD_165(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_167(op, state, i, ...) _GMP_SEQ_FOLD_166(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_168(op, state, i, ...) _GMP_SEQ_FOLD_167(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_169(op, state, i, ...) _GMP_SEQ_FOLD_168(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_170(op, state, i, ...) _GMP_SEQ_FOLD_169(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_171(op, state, i, ...) _GMP_SEQ_FOLD_170(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_172(op, state, i, ...) _GMP_SEQ_FOLD_171(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_173(op, state, i, ...) _GMP_SEQ_FOLD_172(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_174(op, state, i, ...) _GMP_SEQ_FOLD_173(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_175(op, state, i, ...) _GMP_SEQ_FOLD_174(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_176(op, state, i, ...) _GMP_SEQ_FOLD_175(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_177(op, state, i, ...) _GMP_SEQ_FOLD_176(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_178(op, state, i, ...) _GMP_SEQ_FOLD_177(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_179(op, state, i, ...) _GMP_SEQ_FOLD_178(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_180(op, state, i, ...) _GMP_SEQ_FOLD_179(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_181(op, state, i, ...) _GMP_SEQ_FOLD_180(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_182(op, state, i, ...) _GMP_SEQ_FOLD_181(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_183(op, state, i, ...) _GMP_SEQ_FOLD_182(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_184(op, state, i, ...) _GMP_SEQ_FOLD_183(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_185(op, state, i, ...) _GMP_SEQ_FOLD_184(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_186(op, state, i, ...) _GMP_SEQ_FOLD_185(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_187(op, state, i, ...) _GMP_SEQ_FOLD_186(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_188(op, state, i, ...) _GMP_SEQ_FOLD_187(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_189(op, state, i, ...) _GMP_SEQ_FOLD_188(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_190(op, state, i, ...) _GMP_SEQ_FOLD_189(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_191(op, state, i, ...) _GMP_SEQ_FOLD_190(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_192(op, state, i, ...) _GMP_SEQ_FOLD_191(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_193(op, state, i, ...) _GMP_SEQ_FOLD_192(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_194(op, state, i, ...) _GMP_SEQ_FOLD_193(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_195(op, state, i, ...) _GMP_SEQ_FOLD_194(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_196(op, state, i, ...) _GMP_SEQ_FOLD_195(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_197(op, state, i, ...) _GMP_SEQ_FOLD_196(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_198(op, state, i, ...) _GMP_SEQ_FOLD_197(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_199(op, state, i, ...) _GMP_SEQ_FOLD_198(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_200(op, state, i, ...) _GMP_SEQ_FOLD_199(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_201(op, state, i, ...) _GMP_SEQ_FOLD_200(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_202(op, state, i, ...) _GMP_SEQ_FOLD_201(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_203(op, state, i, ...) _GMP_SEQ_FOLD_202(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_204(op, state, i, ...) _GMP_SEQ_FOLD_203(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_205(op, state, i, ...) _GMP_SEQ_FOLD_204(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_206(op, state, i, ...) _GMP_SEQ_FOLD_205(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_207(op, state, i, ...) _GMP_SEQ_FOLD_206(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_208(op, state, i, ...) _GMP_SEQ_FOLD_207(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_209(op, state, i, ...) _GMP_SEQ_FOLD_208(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_210(op, state, i, ...) _GMP_SEQ_FOLD_209(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_211(op, state, i, ...) _GMP_SEQ_FOLD_210(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_212(op, state, i, ...) _GMP_SEQ_FOLD_211(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_213(op, state, i, ...) _GMP_SEQ_FOLD_212(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_214(op, state, i, ...) _GMP_SEQ_FOLD_213(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_215(op, state, i, ...) _GMP_SEQ_FOLD_214(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_216(op, state, i, ...) _GMP_SEQ_FOLD_215(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_217(op, state, i, ...) _GMP_SEQ_FOLD_216(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_218(op, state, i, ...) _GMP_SEQ_FOLD_217(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_219(op, state, i, ...) _GMP_SEQ_FOLD_218(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_220(op, state, i, ...) _GMP_SEQ_FOLD_219(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_221(op, state, i, ...) _GMP_SEQ_FOLD_220(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_222(op, state, i, ...) _GMP_SEQ_FOLD_221(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_223(op, state, i, ...) _GMP_SEQ_FOLD_222(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_224(op, state, i, ...) _GMP_SEQ_FOLD_223(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_225(op, state, i, ...) _GMP_SEQ_FOLD_224(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_226(op, state, i, ...) _GMP_SEQ_FOLD_225(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_227(op, state, i, ...) _GMP_SEQ_FOLD_226(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_228(op, state, i, ...) _GMP_SEQ_FOLD_227(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_229(op, state, i, ...) _GMP_SEQ_FOLD_228(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_230(op, state, i, ...) _GMP_SEQ_FOLD_229(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_231(op, state, i, ...) _GMP_SEQ_FOLD_230(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_232(op, state, i, ...) _GMP_SEQ_FOLD_231(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_233(op, state, i, ...) _GMP_SEQ_FOLD_232(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_234(op, state, i, ...) _GMP_SEQ_FOLD_233(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_235(op, state, i, ...) _GMP_SEQ_FOLD_234(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_236(op, state, i, ...) _GMP_SEQ_FOLD_235(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_237(op, state, i, ...) _GMP_SEQ_FOLD_236(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_238(op, state, i, ...) _GMP_SEQ_FOLD_237(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_239(op, state, i, ...) _GMP_SEQ_FOLD_238(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_240(op, state, i, ...) _GMP_SEQ_FOLD_239(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_241(op, state, i, ...) _GMP_SEQ_FOLD_240(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_242(op, state, i, ...) _GMP_SEQ_FOLD_241(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_243(op, state, i, ...) _GMP_SEQ_FOLD_242(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_244(op, state, i, ...) _GMP_SEQ_FOLD_243(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_245(op, state, i, ...) _GMP_SEQ_FOLD_244(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_246(op, state, i, ...) _GMP_SEQ_FOLD_245(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_247(op, state, i, ...) _GMP_SEQ_FOLD_246(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_248(op, state, i, ...) _GMP_SEQ_FOLD_247(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_249(op, state, i, ...) _GMP_SEQ_FOLD_248(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_250(op, state, i, ...) _GMP_SEQ_FOLD_249(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_251(op, state, i, ...) _GMP_SEQ_FOLD_250(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_252(op, state, i, ...) _GMP_SEQ_FOLD_251(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_253(op, state, i, ...) _GMP_SEQ_FOLD_252(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_254(op, state, i, ...) _GMP_SEQ_FOLD_253(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_255(op, state, i, ...) _GMP_SEQ_FOLD_254(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_256(op, state, i, ...) _GMP_SEQ_FOLD_255(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_257(op, state, i, ...) _GMP_SEQ_FOLD_256(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_258(op, state, i, ...) _GMP_SEQ_FOLD_257(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_259(op, state, i, ...) _GMP_SEQ_FOLD_258(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_260(op, state, i, ...) _GMP_SEQ_FOLD_259(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_261(op, state, i, ...) _GMP_SEQ_FOLD_260(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_262(op, state, i, ...) _GMP_SEQ_FOLD_261(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_263(op, state, i, ...) _GMP_SEQ_FOLD_262(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_264(op, state, i, ...) _GMP_SEQ_FOLD_263(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_265(op, state, i, ...) _GMP_SEQ_FOLD_264(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_266(op, state, i, ...) _GMP_SEQ_FOLD_265(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_267(op, state, i, ...) _GMP_SEQ_FOLD_266(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_268(op, state, i, ...) _GMP_SEQ_FOLD_267(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_269(op, state, i, ...) _GMP_SEQ_FOLD_268(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_270(op, state, i, ...) _GMP_SEQ_FOLD_269(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_271(op, state, i, ...) _GMP_SEQ_FOLD_270(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_272(op, state, i, ...) _GMP_SEQ_FOLD_271(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_273(op, state, i, ...) _GMP_SEQ_FOLD_272(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_274(op, state, i, ...) _GMP_SEQ_FOLD_273(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_275(op, state, i, ...) _GMP_SEQ_FOLD_274(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_276(op, state, i, ...) _GMP_SEQ_FOLD_275(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_277(op, state, i, ...) _GMP_SEQ_FOLD_276(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_278(op, state, i, ...) _GMP_SEQ_FOLD_277(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_279(op, state, i, ...) _GMP_SEQ_FOLD_278(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_280(op, state, i, ...) _GMP_SEQ_FOLD_279(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_281(op, state, i, ...) _GMP_SEQ_FOLD_280(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_282(op, state, i, ...) _GMP_SEQ_FOLD_281(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_283(op, state, i, ...) _GMP_SEQ_FOLD_282(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_284(op, state, i, ...) _GMP_SEQ_FOLD_283(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_285(op, state, i, ...) _GMP_SEQ_FOLD_284(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_286(op, state, i, ...) _GMP_SEQ_FOLD_285(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_287(op, state, i, ...) _GMP_SEQ_FOLD_286(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_288(op, state, i, ...) _GMP_SEQ_FOLD_287(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_289(op, state, i, ...) _GMP_SEQ_FOLD_288(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_290(op, state, i, ...) _GMP_SEQ_FOLD_289(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_291(op, state, i, ...) _GMP_SEQ_FOLD_290(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_292(op, state, i, ...) _GMP_SEQ_FOLD_291(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_293(op, state, i, ...) _GMP_SEQ_FOLD_292(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_294(op, state, i, ...) _GMP_SEQ_FOLD_293(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_295(op, state, i, ...) _GMP_SEQ_FOLD_294(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_296(op, state, i, ...) _GMP_SEQ_FOLD_295(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_297(op, state, i, ...) _GMP_SEQ_FOLD_296(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_298(op, state, i, ...) _GMP_SEQ_FOLD_297(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_299(op, state, i, ...) _GMP_SEQ_FOLD_298(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_300(op, state, i, ...) _GMP_SEQ_FOLD_299(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_301(op, state, i, ...) _GMP_SEQ_FOLD_300(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_302(op, state, i, ...) _GMP_SEQ_FOLD_301(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_303(op, state, i, ...) _GMP_SEQ_FOLD_302(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_304(op, state, i, ...) _GMP_SEQ_FOLD_303(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_305(op, state, i, ...) _GMP_SEQ_FOLD_304(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_306(op, state, i, ...) _GMP_SEQ_FOLD_305(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_307(op, state, i, ...) _GMP_SEQ_FOLD_306(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_308(op, state, i, ...) _GMP_SEQ_FOLD_307(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_309(op, state, i, ...) _GMP_SEQ_FOLD_308(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_310(op, state, i, ...) _GMP_SEQ_FOLD_309(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_311(op, state, i, ...) _GMP_SEQ_FOLD_310(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_312(op, state, i, ...) _GMP_SEQ_FOLD_311(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_313(op, state, i, ...) _GMP_SEQ_FOLD_312(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_314(op, state, i, ...) _GMP_SEQ_FOLD_313(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_315(op, state, i, ...) _GMP_SEQ_FOLD_314(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_316(op, state, i, ...) _GMP_SEQ_FOLD_315(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_317(op, state, i, ...) _GMP_SEQ_FOLD_316(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_318(op, state, i, ...) _GMP_SEQ_FOLD_317(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_319(op, state, i, ...) _GMP_SEQ_FOLD_318(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_320(op, state, i, ...) _GMP_SEQ_FOLD_319(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_321(op, state, i, ...) _GMP_SEQ_FOLD_320(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_322(op, state, i, ...) _GMP_SEQ_FOLD_321(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_323(op, state, i, ...) _GMP_SEQ_FOLD_322(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_324(op, state, i, ...) _GMP_SEQ_FOLD_323(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_325(op, state, i, ...) _GMP_SEQ_FOLD_324(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_326(op, state, i, ...) _GMP_SEQ_FOLD_325(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_327(op, state, i, ...) _GMP_SEQ_FOLD_326(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_328(op, state, i, ...) _GMP_SEQ_FOLD_327(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_329(op, state, i, ...) _GMP_SEQ_FOLD_328(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_330(op, state, i, ...) _GMP_SEQ_FOLD_329(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_331(op, state, i, ...) _GMP_SEQ_FOLD_330(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_332(op, state, i, ...) _GMP_SEQ_FOLD_331(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_333(op, state, i, ...) _GMP_SEQ_FOLD_332(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_334(op, state, i, ...) _GMP_SEQ_FOLD_333(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_335(op, state, i, ...) _GMP_SEQ_FOLD_334(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_336(op, state, i, ...) _GMP_SEQ_FOLD_335(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_337(op, state, i, ...) _GMP_SEQ_FOLD_336(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_338(op, state, i, ...) _GMP_SEQ_FOLD_337(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_339(op, state, i, ...) _GMP_SEQ_FOLD_338(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_340(op, state, i, ...) _GMP_SEQ_FOLD_339(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_341(op, state, i, ...) _GMP_SEQ_FOLD_340(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_342(op, state, i, ...) _GMP_SEQ_FOLD_341(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_343(op, state, i, ...) _GMP_SEQ_FOLD_342(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_344(op, state, i, ...) _GMP_SEQ_FOLD_343(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_345(op, state, i, ...) _GMP_SEQ_FOLD_344(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_346(op, state, i, ...) _GMP_SEQ_FOLD_345(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_347(op, state, i, ...) _GMP_SEQ_FOLD_346(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_348(op, state, i, ...) _GMP_SEQ_FOLD_347(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_349(op, state, i, ...) _GMP_SEQ_FOLD_348(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_350(op, state, i, ...) _GMP_SEQ_FOLD_349(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_351(op, state, i, ...) _GMP_SEQ_FOLD_350(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_352(op, state, i, ...) _GMP_SEQ_FOLD_351(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_353(op, state, i, ...) _GMP_SEQ_FOLD_352(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_354(op, state, i, ...) _GMP_SEQ_FOLD_353(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_355(op, state, i, ...) _GMP_SEQ_FOLD_354(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_356(op, state, i, ...) _GMP_SEQ_FOLD_355(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_357(op, state, i, ...) _GMP_SEQ_FOLD_356(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_358(op, state, i, ...) _GMP_SEQ_FOLD_357(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_359(op, state, i, ...) _GMP_SEQ_FOLD_358(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_360(op, state, i, ...) _GMP_SEQ_FOLD_359(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_361(op, state, i, ...) _GMP_SEQ_FOLD_360(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_362(op, state, i, ...) _GMP_SEQ_FOLD_361(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_363(op, state, i, ...) _GMP_SEQ_FOLD_362(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_364(op, state, i, ...) _GMP_SEQ_FOLD_363(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_365(op, state, i, ...) _GMP_SEQ_FOLD_364(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_366(op, state, i, ...) _GMP_SEQ_FOLD_365(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_367(op, state, i, ...) _GMP_SEQ_FOLD_366(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_368(op, state, i, ...) _GMP_SEQ_FOLD_367(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_369(op, state, i, ...) _GMP_SEQ_FOLD_368(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_370(op, state, i, ...) _GMP_SEQ_FOLD_369(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_371(op, state, i, ...) _GMP_SEQ_FOLD_370(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_372(op, state, i, ...) _GMP_SEQ_FOLD_371(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_373(op, state, i, ...) _GMP_SEQ_FOLD_372(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_374(op, state, i, ...) _GMP_SEQ_FOLD_373(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_375(op, state, i, ...) _GMP_SEQ_FOLD_374(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_376(op, state, i, ...) _GMP_SEQ_FOLD_375(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_377(op, state, i, ...) _GMP_SEQ_FOLD_376(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_378(op, state, i, ...) _GMP_SEQ_FOLD_377(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_379(op, state, i, ...) _GMP_SEQ_FOLD_378(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_380(op, state, i, ...) _GMP_SEQ_FOLD_379(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_381(op, state, i, ...) _GMP_SEQ_FOLD_380(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_382(op, state, i, ...) _GMP_SEQ_FOLD_381(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_383(op, state, i, ...) _GMP_SEQ_FOLD_382(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_384(op, state, i, ...) _GMP_SEQ_FOLD_383(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_385(op, state, i, ...) _GMP_SEQ_FOLD_384(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_386(op, state, i, ...) _GMP_SEQ_FOLD_385(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_387(op, state, i, ...) _GMP_SEQ_FOLD_386(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_388(op, state, i, ...) _GMP_SEQ_FOLD_387(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_389(op, state, i, ...) _GMP_SEQ_FOLD_388(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_390(op, state, i, ...) _GMP_SEQ_FOLD_389(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_391(op, state, i, ...) _GMP_SEQ_FOLD_390(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_392(op, state, i, ...) _GMP_SEQ_FOLD_391(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_393(op, state, i, ...) _GMP_SEQ_FOLD_392(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_394(op, state, i, ...) _GMP_SEQ_FOLD_393(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_395(op, state, i, ...) _GMP_SEQ_FOLD_394(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_396(op, state, i, ...) _GMP_SEQ_FOLD_395(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_397(op, state, i, ...) _GMP_SEQ_FOLD_396(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_398(op, state, i, ...) _GMP_SEQ_FOLD_397(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_399(op, state, i, ...) _GMP_SEQ_FOLD_398(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_400(op, state, i, ...) _GMP_SEQ_FOLD_399(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_401(op, state, i, ...) _GMP_SEQ_FOLD_400(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_402(op, state, i, ...) _GMP_SEQ_FOLD_401(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_403(op, state, i, ...) _GMP_SEQ_FOLD_402(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_404(op, state, i, ...) _GMP_SEQ_FOLD_403(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_405(op, state, i, ...) _GMP_SEQ_FOLD_404(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_406(op, state, i, ...) _GMP_SEQ_FOLD_405(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_407(op, state, i, ...) _GMP_SEQ_FOLD_406(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_408(op, state, i, ...) _GMP_SEQ_FOLD_407(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_409(op, state, i, ...) _GMP_SEQ_FOLD_408(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_410(op, state, i, ...) _GMP_SEQ_FOLD_409(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_411(op, state, i, ...) _GMP_SEQ_FOLD_410(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_412(op, state, i, ...) _GMP_SEQ_FOLD_411(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_413(op, state, i, ...) _GMP_SEQ_FOLD_412(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_414(op, state, i, ...) _GMP_SEQ_FOLD_413(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_415(op, state, i, ...) _GMP_SEQ_FOLD_414(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_416(op, state, i, ...) _GMP_SEQ_FOLD_415(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_417(op, state, i, ...) _GMP_SEQ_FOLD_416(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_418(op, state, i, ...) _GMP_SEQ_FOLD_417(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_419(op, state, i, ...) _GMP_SEQ_FOLD_418(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_420(op, state, i, ...) _GMP_SEQ_FOLD_419(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_421(op, state, i, ...) _GMP_SEQ_FOLD_420(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_422(op, state, i, ...) _GMP_SEQ_FOLD_421(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_423(op, state, i, ...) _GMP_SEQ_FOLD_422(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_424(op, state, i, ...) _GMP_SEQ_FOLD_423(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_425(op, state, i, ...) _GMP_SEQ_FOLD_424(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_426(op, state, i, ...) _GMP_SEQ_FOLD_425(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_427(op, state, i, ...) _GMP_SEQ_FOLD_426(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_428(op, state, i, ...) _GMP_SEQ_FOLD_427(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_429(op, state, i, ...) _GMP_SEQ_FOLD_428(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_430(op, state, i, ...) _GMP_SEQ_FOLD_429(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_431(op, state, i, ...) _GMP_SEQ_FOLD_430(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_432(op, state, i, ...) _GMP_SEQ_FOLD_431(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_433(op, state, i, ...) _GMP_SEQ_FOLD_432(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_434(op, state, i, ...) _GMP_SEQ_FOLD_433(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_435(op, state, i, ...) _GMP_SEQ_FOLD_434(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_436(op, state, i, ...) _GMP_SEQ_FOLD_435(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_437(op, state, i, ...) _GMP_SEQ_FOLD_436(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_438(op, state, i, ...) _GMP_SEQ_FOLD_437(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_439(op, state, i, ...) _GMP_SEQ_FOLD_438(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_440(op, state, i, ...) _GMP_SEQ_FOLD_439(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_441(op, state, i, ...) _GMP_SEQ_FOLD_440(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_442(op, state, i, ...) _GMP_SEQ_FOLD_441(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_443(op, state, i, ...) _GMP_SEQ_FOLD_442(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_444(op, state, i, ...) _GMP_SEQ_FOLD_443(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_445(op, state, i, ...) _GMP_SEQ_FOLD_444(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_446(op, state, i, ...) _GMP_SEQ_FOLD_445(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_447(op, state, i, ...) _GMP_SEQ_FOLD_446(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_448(op, state, i, ...) _GMP_SEQ_FOLD_447(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_449(op, state, i, ...) _GMP_SEQ_FOLD_448(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_450(op, state, i, ...) _GMP_SEQ_FOLD_449(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_451(op, state, i, ...) _GMP_SEQ_FOLD_450(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_452(op, state, i, ...) _GMP_SEQ_FOLD_451(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_453(op, state, i, ...) _GMP_SEQ_FOLD_452(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_454(op, state, i, ...) _GMP_SEQ_FOLD_453(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_455(op, state, i, ...) _GMP_SEQ_FOLD_454(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_456(op, state, i, ...) _GMP_SEQ_FOLD_455(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_457(op, state, i, ...) _GMP_SEQ_FOLD_456(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_458(op, state, i, ...) _GMP_SEQ_FOLD_457(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_459(op, state, i, ...) _GMP_SEQ_FOLD_458(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_460(op, state, i, ...) _GMP_SEQ_FOLD_459(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_461(op, state, i, ...) _GMP_SEQ_FOLD_460(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_462(op, state, i, ...) _GMP_SEQ_FOLD_461(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_463(op, state, i, ...) _GMP_SEQ_FOLD_462(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_464(op, state, i, ...) _GMP_SEQ_FOLD_463(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_465(op, state, i, ...) _GMP_SEQ_FOLD_464(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_466(op, state, i, ...) _GMP_SEQ_FOLD_465(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_467(op, state, i, ...) _GMP_SEQ_FOLD_466(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_468(op, state, i, ...) _GMP_SEQ_FOLD_467(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_469(op, state, i, ...) _GMP_SEQ_FOLD_468(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_470(op, state, i, ...) _GMP_SEQ_FOLD_469(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_471(op, state, i, ...) _GMP_SEQ_FOLD_470(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_472(op, state, i, ...) _GMP_SEQ_FOLD_471(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_473(op, state, i, ...) _GMP_SEQ_FOLD_472(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_474(op, state, i, ...) _GMP_SEQ_FOLD_473(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_475(op, state, i, ...) _GMP_SEQ_FOLD_474(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_476(op, state, i, ...) _GMP_SEQ_FOLD_475(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_477(op, state, i, ...) _GMP_SEQ_FOLD_476(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_478(op, state, i, ...) _GMP_SEQ_FOLD_477(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_479(op, state, i, ...) _GMP_SEQ_FOLD_478(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_480(op, state, i, ...) _GMP_SEQ_FOLD_479(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_481(op, state, i, ...) _GMP_SEQ_FOLD_480(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_482(op, state, i, ...) _GMP_SEQ_FOLD_481(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_483(op, state, i, ...) _GMP_SEQ_FOLD_482(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_484(op, state, i, ...) _GMP_SEQ_FOLD_483(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_485(op, state, i, ...) _GMP_SEQ_FOLD_484(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_486(op, state, i, ...) _GMP_SEQ_FOLD_485(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_487(op, state, i, ...) _GMP_SEQ_FOLD_486(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_488(op, state, i, ...) _GMP_SEQ_FOLD_487(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_489(op, state, i, ...) _GMP_SEQ_FOLD_488(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_490(op, state, i, ...) _GMP_SEQ_FOLD_489(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_491(op, state, i, ...) _GMP_SEQ_FOLD_490(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_492(op, state, i, ...) _GMP_SEQ_FOLD_491(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_493(op, state, i, ...) _GMP_SEQ_FOLD_492(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_494(op, state, i, ...) _GMP_SEQ_FOLD_493(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_495(op, state, i, ...) _GMP_SEQ_FOLD_494(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_496(op, state, i, ...) _GMP_SEQ_FOLD_495(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_497(op, state, i, ...) _GMP_SEQ_FOLD_496(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_498(op, state, i, ...) _GMP_SEQ_FOLD_497(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_499(op, state, i, ...) _GMP_SEQ_FOLD_498(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_500(op, state, i, ...) _GMP_SEQ_FOLD_499(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_501(op, state, i, ...) _GMP_SEQ_FOLD_500(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_502(op, state, i, ...) _GMP_SEQ_FOLD_501(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_503(op, state, i, ...) _GMP_SEQ_FOLD_502(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_504(op, state, i, ...) _GMP_SEQ_FOLD_503(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_505(op, state, i, ...) _GMP_SEQ_FOLD_504(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_506(op, state, i, ...) _GMP_SEQ_FOLD_505(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_507(op, state, i, ...) _GMP_SEQ_FOLD_506(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_508(op, state, i, ...) _GMP_SEQ_FOLD_507(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_509(op, state, i, ...) _GMP_SEQ_FOLD_508(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_510(op, state, i, ...) _GMP_SEQ_FOLD_509(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_511(op, state, i, ...) _GMP_SEQ_FOLD_510(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_512(op, state, i, ...) _GMP_SEQ_FOLD_511(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_513(op, state, i, ...) _GMP_SEQ_FOLD_512(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_514(op, state, i, ...) _GMP_SEQ_FOLD_513(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_515(op, state, i, ...) _GMP_SEQ_FOLD_514(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_516(op, state, i, ...) _GMP_SEQ_FOLD_515(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_517(op, state, i, ...) _GMP_SEQ_FOLD_516(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_518(op, state, i, ...) _GMP_SEQ_FOLD_517(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_519(op, state, i, ...) _GMP_SEQ_FOLD_518(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_520(op, state, i, ...) _GMP_SEQ_FOLD_519(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_521(op, state, i, ...) _GMP_SEQ_FOLD_520(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_522(op, state, i, ...) _GMP_SEQ_FOLD_521(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_523(op, state, i, ...) _GMP_SEQ_FOLD_522(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_524(op, state, i, ...) _GMP_SEQ_FOLD_523(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_525(op, state, i, ...) _GMP_SEQ_FOLD_524(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_526(op, state, i, ...) _GMP_SEQ_FOLD_525(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_527(op, state, i, ...) _GMP_SEQ_FOLD_526(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_528(op, state, i, ...) _GMP_SEQ_FOLD_527(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_529(op, state, i, ...) _GMP_SEQ_FOLD_528(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_530(op, state, i, ...) _GMP_SEQ_FOLD_529(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_531(op, state, i, ...) _GMP_SEQ_FOLD_530(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_532(op, state, i, ...) _GMP_SEQ_FOLD_531(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_533(op, state, i, ...) _GMP_SEQ_FOLD_532(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_534(op, state, i, ...) _GMP_SEQ_FOLD_533(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_535(op, state, i, ...) _GMP_SEQ_FOLD_534(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_536(op, state, i, ...) _GMP_SEQ_FOLD_535(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_537(op, state, i, ...) _GMP_SEQ_FOLD_536(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_538(op, state, i, ...) _GMP_SEQ_FOLD_537(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_539(op, state, i, ...) _GMP_SEQ_FOLD_538(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_540(op, state, i, ...) _GMP_SEQ_FOLD_539(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_541(op, state, i, ...) _GMP_SEQ_FOLD_540(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_542(op, state, i, ...) _GMP_SEQ_FOLD_541(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_543(op, state, i, ...) _GMP_SEQ_FOLD_542(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_544(op, state, i, ...) _GMP_SEQ_FOLD_543(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_545(op, state, i, ...) _GMP_SEQ_FOLD_544(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_546(op, state, i, ...) _GMP_SEQ_FOLD_545(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_547(op, state, i, ...) _GMP_SEQ_FOLD_546(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_548(op, state, i, ...) _GMP_SEQ_FOLD_547(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_549(op, state, i, ...) _GMP_SEQ_FOLD_548(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_550(op, state, i, ...) _GMP_SEQ_FOLD_549(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_551(op, state, i, ...) _GMP_SEQ_FOLD_550(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_552(op, state, i, ...) _GMP_SEQ_FOLD_551(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_553(op, state, i, ...) _GMP_SEQ_FOLD_552(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_554(op, state, i, ...) _GMP_SEQ_FOLD_553(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_555(op, state, i, ...) _GMP_SEQ_FOLD_554(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_556(op, state, i, ...) _GMP_SEQ_FOLD_555(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_557(op, state, i, ...) _GMP_SEQ_FOLD_556(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_558(op, state, i, ...) _GMP_SEQ_FOLD_557(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_559(op, state, i, ...) _GMP_SEQ_FOLD_558(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_560(op, state, i, ...) _GMP_SEQ_FOLD_559(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_561(op, state, i, ...) _GMP_SEQ_FOLD_560(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_562(op, state, i, ...) _GMP_SEQ_FOLD_561(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_563(op, state, i, ...) _GMP_SEQ_FOLD_562(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_564(op, state, i, ...) _GMP_SEQ_FOLD_563(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_565(op, state, i, ...) _GMP_SEQ_FOLD_564(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_566(op, state, i, ...) _GMP_SEQ_FOLD_565(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_567(op, state, i, ...) _GMP_SEQ_FOLD_566(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_568(op, state, i, ...) _GMP_SEQ_FOLD_567(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_569(op, state, i, ...) _GMP_SEQ_FOLD_568(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_570(op, state, i, ...) _GMP_SEQ_FOLD_569(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_571(op, state, i, ...) _GMP_SEQ_FOLD_570(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_572(op, state, i, ...) _GMP_SEQ_FOLD_571(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_573(op, state, i, ...) _GMP_SEQ_FOLD_572(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_574(op, state, i, ...) _GMP_SEQ_FOLD_573(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_575(op, state, i, ...) _GMP_SEQ_FOLD_574(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_576(op, state, i, ...) _GMP_SEQ_FOLD_575(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_577(op, state, i, ...) _GMP_SEQ_FOLD_576(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_578(op, state, i, ...) _GMP_SEQ_FOLD_577(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_579(op, state, i, ...) _GMP_SEQ_FOLD_578(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_580(op, state, i, ...) _GMP_SEQ_FOLD_579(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_581(op, state, i, ...) _GMP_SEQ_FOLD_580(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_582(op, state, i, ...) _GMP_SEQ_FOLD_581(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_583(op, state, i, ...) _GMP_SEQ_FOLD_582(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_584(op, state, i, ...) _GMP_SEQ_FOLD_583(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_585(op, state, i, ...) _GMP_SEQ_FOLD_584(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_586(op, state, i, ...) _GMP_SEQ_FOLD_585(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_587(op, state, i, ...) _GMP_SEQ_FOLD_586(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_588(op, state, i, ...) _GMP_SEQ_FOLD_587(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_589(op, state, i, ...) _GMP_SEQ_FOLD_588(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_590(op, state, i, ...) _GMP_SEQ_FOLD_589(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_591(op, state, i, ...) _GMP_SEQ_FOLD_590(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_592(op, state, i, ...) _GMP_SEQ_FOLD_591(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_593(op, state, i, ...) _GMP_SEQ_FOLD_592(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_594(op, state, i, ...) _GMP_SEQ_FOLD_593(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_595(op, state, i, ...) _GMP_SEQ_FOLD_594(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_596(op, state, i, ...) _GMP_SEQ_FOLD_595(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_597(op, state, i, ...) _GMP_SEQ_FOLD_596(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_598(op, state, i, ...) _GMP_SEQ_FOLD_597(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_599(op, state, i, ...) _GMP_SEQ_FOLD_598(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_600(op, state, i, ...) _GMP_SEQ_FOLD_599(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_601(op, state, i, ...) _GMP_SEQ_FOLD_600(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_602(op, state, i, ...) _GMP_SEQ_FOLD_601(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_603(op, state, i, ...) _GMP_SEQ_FOLD_602(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_604(op, state, i, ...) _GMP_SEQ_FOLD_603(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_605(op, state, i, ...) _GMP_SEQ_FOLD_604(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_606(op, state, i, ...) _GMP_SEQ_FOLD_605(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_607(op, state, i, ...) _GMP_SEQ_FOLD_606(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_608(op, state, i, ...) _GMP_SEQ_FOLD_607(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_609(op, state, i, ...) _GMP_SEQ_FOLD_608(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_610(op, state, i, ...) _GMP_SEQ_FOLD_609(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_611(op, state, i, ...) _GMP_SEQ_FOLD_610(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_612(op, state, i, ...) _GMP_SEQ_FOLD_611(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_613(op, state, i, ...) _GMP_SEQ_FOLD_612(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_614(op, state, i, ...) _GMP_SEQ_FOLD_613(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_615(op, state, i, ...) _GMP_SEQ_FOLD_614(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_616(op, state, i, ...) _GMP_SEQ_FOLD_615(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_617(op, state, i, ...) _GMP_SEQ_FOLD_616(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_618(op, state, i, ...) _GMP_SEQ_FOLD_617(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_619(op, state, i, ...) _GMP_SEQ_FOLD_618(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_620(op, state, i, ...) _GMP_SEQ_FOLD_619(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_621(op, state, i, ...) _GMP_SEQ_FOLD_620(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_622(op, state, i, ...) _GMP_SEQ_FOLD_621(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_623(op, state, i, ...) _GMP_SEQ_FOLD_622(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_624(op, state, i, ...) _GMP_SEQ_FOLD_623(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_625(op, state, i, ...) _GMP_SEQ_FOLD_624(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_626(op, state, i, ...) _GMP_SEQ_FOLD_625(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_627(op, state, i, ...) _GMP_SEQ_FOLD_626(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_628(op, state, i, ...) _GMP_SEQ_FOLD_627(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_629(op, state, i, ...) _GMP_SEQ_FOLD_628(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_630(op, state, i, ...) _GMP_SEQ_FOLD_629(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_631(op, state, i, ...) _GMP_SEQ_FOLD_630(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_632(op, state, i, ...) _GMP_SEQ_FOLD_631(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_633(op, state, i, ...) _GMP_SEQ_FOLD_632(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_634(op, state, i, ...) _GMP_SEQ_FOLD_633(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_635(op, state, i, ...) _GMP_SEQ_FOLD_634(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_636(op, state, i, ...) _GMP_SEQ_FOLD_635(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_637(op, state, i, ...) _GMP_SEQ_FOLD_636(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_638(op, state, i, ...) _GMP_SEQ_FOLD_637(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_639(op, state, i, ...) _GMP_SEQ_FOLD_638(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_640(op, state, i, ...) _GMP_SEQ_FOLD_639(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_641(op, state, i, ...) _GMP_SEQ_FOLD_640(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_642(op, state, i, ...) _GMP_SEQ_FOLD_641(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_643(op, state, i, ...) _GMP_SEQ_FOLD_642(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_644(op, state, i, ...) _GMP_SEQ_FOLD_643(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_645(op, state, i, ...) _GMP_SEQ_FOLD_644(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_646(op, state, i, ...) _GMP_SEQ_FOLD_645(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_647(op, state, i, ...) _GMP_SEQ_FOLD_646(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_648(op, state, i, ...) _GMP_SEQ_FOLD_647(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_649(op, state, i, ...) _GMP_SEQ_FOLD_648(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_650(op, state, i, ...) _GMP_SEQ_FOLD_649(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_651(op, state, i, ...) _GMP_SEQ_FOLD_650(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_652(op, state, i, ...) _GMP_SEQ_FOLD_651(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_653(op, state, i, ...) _GMP_SEQ_FOLD_652(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_654(op, state, i, ...) _GMP_SEQ_FOLD_653(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_655(op, state, i, ...) _GMP_SEQ_FOLD_654(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_656(op, state, i, ...) _GMP_SEQ_FOLD_655(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_657(op, state, i, ...) _GMP_SEQ_FOLD_656(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_658(op, state, i, ...) _GMP_SEQ_FOLD_657(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_659(op, state, i, ...) _GMP_SEQ_FOLD_658(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_660(op, state, i, ...) _GMP_SEQ_FOLD_659(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_661(op, state, i, ...) _GMP_SEQ_FOLD_660(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_662(op, state, i, ...) _GMP_SEQ_FOLD_661(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_663(op, state, i, ...) _GMP_SEQ_FOLD_662(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_664(op, state, i, ...) _GMP_SEQ_FOLD_663(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_665(op, state, i, ...) _GMP_SEQ_FOLD_664(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_666(op, state, i, ...) _GMP_SEQ_FOLD_665(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_667(op, state, i, ...) _GMP_SEQ_FOLD_666(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_668(op, state, i, ...) _GMP_SEQ_FOLD_667(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_669(op, state, i, ...) _GMP_SEQ_FOLD_668(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_670(op, state, i, ...) _GMP_SEQ_FOLD_669(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_671(op, state, i, ...) _GMP_SEQ_FOLD_670(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_672(op, state, i, ...) _GMP_SEQ_FOLD_671(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_673(op, state, i, ...) _GMP_SEQ_FOLD_672(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_674(op, state, i, ...) _GMP_SEQ_FOLD_673(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_675(op, state, i, ...) _GMP_SEQ_FOLD_674(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_676(op, state, i, ...) _GMP_SEQ_FOLD_675(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_677(op, state, i, ...) _GMP_SEQ_FOLD_676(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_678(op, state, i, ...) _GMP_SEQ_FOLD_677(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_679(op, state, i, ...) _GMP_SEQ_FOLD_678(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_680(op, state, i, ...) _GMP_SEQ_FOLD_679(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_681(op, state, i, ...) _GMP_SEQ_FOLD_680(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_682(op, state, i, ...) _GMP_SEQ_FOLD_681(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_683(op, state, i, ...) _GMP_SEQ_FOLD_682(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_684(op, state, i, ...) _GMP_SEQ_FOLD_683(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_685(op, state, i, ...) _GMP_SEQ_FOLD_684(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_686(op, state, i, ...) _GMP_SEQ_FOLD_685(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_687(op, state, i, ...) _GMP_SEQ_FOLD_686(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_688(op, state, i, ...) _GMP_SEQ_FOLD_687(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_689(op, state, i, ...) _GMP_SEQ_FOLD_688(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_690(op, state, i, ...) _GMP_SEQ_FOLD_689(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_691(op, state, i, ...) _GMP_SEQ_FOLD_690(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_692(op, state, i, ...) _GMP_SEQ_FOLD_691(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_693(op, state, i, ...) _GMP_SEQ_FOLD_692(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_694(op, state, i, ...) _GMP_SEQ_FOLD_693(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_695(op, state, i, ...) _GMP_SEQ_FOLD_694(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_696(op, state, i, ...) _GMP_SEQ_FOLD_695(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_697(op, state, i, ...) _GMP_SEQ_FOLD_696(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_698(op, state, i, ...) _GMP_SEQ_FOLD_697(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_699(op, state, i, ...) _GMP_SEQ_FOLD_698(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_700(op, state, i, ...) _GMP_SEQ_FOLD_699(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_701(op, state, i, ...) _GMP_SEQ_FOLD_700(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_702(op, state, i, ...) _GMP_SEQ_FOLD_701(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_703(op, state, i, ...) _GMP_SEQ_FOLD_702(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_704(op, state, i, ...) _GMP_SEQ_FOLD_703(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_705(op, state, i, ...) _GMP_SEQ_FOLD_704(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_706(op, state, i, ...) _GMP_SEQ_FOLD_705(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_707(op, state, i, ...) _GMP_SEQ_FOLD_706(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_708(op, state, i, ...) _GMP_SEQ_FOLD_707(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_709(op, state, i, ...) _GMP_SEQ_FOLD_708(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_710(op, state, i, ...) _GMP_SEQ_FOLD_709(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_711(op, state, i, ...) _GMP_SEQ_FOLD_710(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_712(op, state, i, ...) _GMP_SEQ_FOLD_711(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_713(op, state, i, ...) _GMP_SEQ_FOLD_712(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_714(op, state, i, ...) _GMP_SEQ_FOLD_713(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_715(op, state, i, ...) _GMP_SEQ_FOLD_714(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_716(op, state, i, ...) _GMP_SEQ_FOLD_715(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_717(op, state, i, ...) _GMP_SEQ_FOLD_716(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_718(op, state, i, ...) _GMP_SEQ_FOLD_717(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_719(op, state, i, ...) _GMP_SEQ_FOLD_718(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_720(op, state, i, ...) _GMP_SEQ_FOLD_719(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_721(op, state, i, ...) _GMP_SEQ_FOLD_720(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_722(op, state, i, ...) _GMP_SEQ_FOLD_721(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_723(op, state, i, ...) _GMP_SEQ_FOLD_722(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_724(op, state, i, ...) _GMP_SEQ_FOLD_723(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_725(op, state, i, ...) _GMP_SEQ_FOLD_724(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_726(op, state, i, ...) _GMP_SEQ_FOLD_725(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_727(op, state, i, ...) _GMP_SEQ_FOLD_726(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_728(op, state, i, ...) _GMP_SEQ_FOLD_727(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_729(op, state, i, ...) _GMP_SEQ_FOLD_728(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_730(op, state, i, ...) _GMP_SEQ_FOLD_729(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_731(op, state, i, ...) _GMP_SEQ_FOLD_730(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_732(op, state, i, ...) _GMP_SEQ_FOLD_731(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_733(op, state, i, ...) _GMP_SEQ_FOLD_732(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_734(op, state, i, ...) _GMP_SEQ_FOLD_733(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_735(op, state, i, ...) _GMP_SEQ_FOLD_734(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_736(op, state, i, ...) _GMP_SEQ_FOLD_735(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_737(op, state, i, ...) _GMP_SEQ_FOLD_736(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_738(op, state, i, ...) _GMP_SEQ_FOLD_737(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_739(op, state, i, ...) _GMP_SEQ_FOLD_738(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_740(op, state, i, ...) _GMP_SEQ_FOLD_739(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_741(op, state, i, ...) _GMP_SEQ_FOLD_740(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_742(op, state, i, ...) _GMP_SEQ_FOLD_741(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_743(op, state, i, ...) _GMP_SEQ_FOLD_742(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_744(op, state, i, ...) _GMP_SEQ_FOLD_743(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_745(op, state, i, ...) _GMP_SEQ_FOLD_744(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_746(op, state, i, ...) _GMP_SEQ_FOLD_745(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_747(op, state, i, ...) _GMP_SEQ_FOLD_746(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_748(op, state, i, ...) _GMP_SEQ_FOLD_747(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_749(op, state, i, ...) _GMP_SEQ_FOLD_748(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_750(op, state, i, ...) _GMP_SEQ_FOLD_749(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_751(op, state, i, ...) _GMP_SEQ_FOLD_750(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_752(op, state, i, ...) _GMP_SEQ_FOLD_751(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_753(op, state, i, ...) _GMP_SEQ_FOLD_752(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_754(op, state, i, ...) _GMP_SEQ_FOLD_753(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_755(op, state, i, ...) _GMP_SEQ_FOLD_754(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_756(op, state, i, ...) _GMP_SEQ_FOLD_755(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_757(op, state, i, ...) _GMP_SEQ_FOLD_756(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_758(op, state, i, ...) _GMP_SEQ_FOLD_757(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_759(op, state, i, ...) _GMP_SEQ_FOLD_758(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_760(op, state, i, ...) _GMP_SEQ_FOLD_759(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_761(op, state, i, ...) _GMP_SEQ_FOLD_760(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_762(op, state, i, ...) _GMP_SEQ_FOLD_761(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_763(op, state, i, ...) _GMP_SEQ_FOLD_762(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_764(op, state, i, ...) _GMP_SEQ_FOLD_763(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_765(op, state, i, ...) _GMP_SEQ_FOLD_764(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_766(op, state, i, ...) _GMP_SEQ_FOLD_765(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_767(op, state, i, ...) _GMP_SEQ_FOLD_766(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_768(op, state, i, ...) _GMP_SEQ_FOLD_767(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_769(op, state, i, ...) _GMP_SEQ_FOLD_768(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_770(op, state, i, ...) _GMP_SEQ_FOLD_769(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_771(op, state, i, ...) _GMP_SEQ_FOLD_770(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_772(op, state, i, ...) _GMP_SEQ_FOLD_771(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_773(op, state, i, ...) _GMP_SEQ_FOLD_772(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_774(op, state, i, ...) _GMP_SEQ_FOLD_773(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_775(op, state, i, ...) _GMP_SEQ_FOLD_774(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_776(op, state, i, ...) _GMP_SEQ_FOLD_775(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_777(op, state, i, ...) _GMP_SEQ_FOLD_776(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_778(op, state, i, ...) _GMP_SEQ_FOLD_777(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_779(op, state, i, ...) _GMP_SEQ_FOLD_778(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_780(op, state, i, ...) _GMP_SEQ_FOLD_779(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_781(op, state, i, ...) _GMP_SEQ_FOLD_780(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_782(op, state, i, ...) _GMP_SEQ_FOLD_781(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_783(op, state, i, ...) _GMP_SEQ_FOLD_782(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_784(op, state, i, ...) _GMP_SEQ_FOLD_783(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_785(op, state, i, ...) _GMP_SEQ_FOLD_784(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_786(op, state, i, ...) _GMP_SEQ_FOLD_785(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_787(op, state, i, ...) _GMP_SEQ_FOLD_786(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_788(op, state, i, ...) _GMP_SEQ_FOLD_787(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_789(op, state, i, ...) _GMP_SEQ_FOLD_788(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_790(op, state, i, ...) _GMP_SEQ_FOLD_789(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_791(op, state, i, ...) _GMP_SEQ_FOLD_790(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_792(op, state, i, ...) _GMP_SEQ_FOLD_791(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_793(op, state, i, ...) _GMP_SEQ_FOLD_792(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_794(op, state, i, ...) _GMP_SEQ_FOLD_793(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_795(op, state, i, ...) _GMP_SEQ_FOLD_794(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_796(op, state, i, ...) _GMP_SEQ_FOLD_795(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_797(op, state, i, ...) _GMP_SEQ_FOLD_796(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_798(op, state, i, ...) _GMP_SEQ_FOLD_797(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_799(op, state, i, ...) _GMP_SEQ_FOLD_798(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_800(op, state, i, ...) _GMP_SEQ_FOLD_799(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_801(op, state, i, ...) _GMP_SEQ_FOLD_800(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_802(op, state, i, ...) _GMP_SEQ_FOLD_801(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_803(op, state, i, ...) _GMP_SEQ_FOLD_802(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_804(op, state, i, ...) _GMP_SEQ_FOLD_803(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_805(op, state, i, ...) _GMP_SEQ_FOLD_804(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_806(op, state, i, ...) _GMP_SEQ_FOLD_805(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_807(op, state, i, ...) _GMP_SEQ_FOLD_806(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_808(op, state, i, ...) _GMP_SEQ_FOLD_807(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_809(op, state, i, ...) _GMP_SEQ_FOLD_808(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_810(op, state, i, ...) _GMP_SEQ_FOLD_809(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_811(op, state, i, ...) _GMP_SEQ_FOLD_810(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_812(op, state, i, ...) _GMP_SEQ_FOLD_811(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_813(op, state, i, ...) _GMP_SEQ_FOLD_812(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_814(op, state, i, ...) _GMP_SEQ_FOLD_813(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_815(op, state, i, ...) _GMP_SEQ_FOLD_814(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_816(op, state, i, ...) _GMP_SEQ_FOLD_815(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_817(op, state, i, ...) _GMP_SEQ_FOLD_816(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_818(op, state, i, ...) _GMP_SEQ_FOLD_817(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_819(op, state, i, ...) _GMP_SEQ_FOLD_818(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_820(op, state, i, ...) _GMP_SEQ_FOLD_819(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_821(op, state, i, ...) _GMP_SEQ_FOLD_820(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_822(op, state, i, ...) _GMP_SEQ_FOLD_821(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_823(op, state, i, ...) _GMP_SEQ_FOLD_822(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_824(op, state, i, ...) _GMP_SEQ_FOLD_823(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_825(op, state, i, ...) _GMP_SEQ_FOLD_824(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_826(op, state, i, ...) _GMP_SEQ_FOLD_825(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_827(op, state, i, ...) _GMP_SEQ_FOLD_826(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_828(op, state, i, ...) _GMP_SEQ_FOLD_827(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_829(op, state, i, ...) _GMP_SEQ_FOLD_828(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_830(op, state, i, ...) _GMP_SEQ_FOLD_829(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_831(op, state, i, ...) _GMP_SEQ_FOLD_830(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_832(op, state, i, ...) _GMP_SEQ_FOLD_831(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_833(op, state, i, ...) _GMP_SEQ_FOLD_832(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_834(op, state, i, ...) _GMP_SEQ_FOLD_833(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_835(op, state, i, ...) _GMP_SEQ_FOLD_834(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_836(op, state, i, ...) _GMP_SEQ_FOLD_835(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_837(op, state, i, ...) _GMP_SEQ_FOLD_836(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_838(op, state, i, ...) _GMP_SEQ_FOLD_837(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_839(op, state, i, ...) _GMP_SEQ_FOLD_838(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_840(op, state, i, ...) _GMP_SEQ_FOLD_839(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_841(op, state, i, ...) _GMP_SEQ_FOLD_840(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_842(op, state, i, ...) _GMP_SEQ_FOLD_841(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_843(op, state, i, ...) _GMP_SEQ_FOLD_842(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_844(op, state, i, ...) _GMP_SEQ_FOLD_843(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_845(op, state, i, ...) _GMP_SEQ_FOLD_844(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_846(op, state, i, ...) _GMP_SEQ_FOLD_845(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_847(op, state, i, ...) _GMP_SEQ_FOLD_846(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_848(op, state, i, ...) _GMP_SEQ_FOLD_847(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_849(op, state, i, ...) _GMP_SEQ_FOLD_848(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_850(op, state, i, ...) _GMP_SEQ_FOLD_849(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_851(op, state, i, ...) _GMP_SEQ_FOLD_850(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_852(op, state, i, ...) _GMP_SEQ_FOLD_851(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_853(op, state, i, ...) _GMP_SEQ_FOLD_852(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_854(op, state, i, ...) _GMP_SEQ_FOLD_853(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_855(op, state, i, ...) _GMP_SEQ_FOLD_854(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_856(op, state, i, ...) _GMP_SEQ_FOLD_855(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_857(op, state, i, ...) _GMP_SEQ_FOLD_856(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_858(op, state, i, ...) _GMP_SEQ_FOLD_857(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_859(op, state, i, ...) _GMP_SEQ_FOLD_858(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_860(op, state, i, ...) _GMP_SEQ_FOLD_859(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_861(op, state, i, ...) _GMP_SEQ_FOLD_860(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_862(op, state, i, ...) _GMP_SEQ_FOLD_861(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_863(op, state, i, ...) _GMP_SEQ_FOLD_862(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_864(op, state, i, ...) _GMP_SEQ_FOLD_863(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_865(op, state, i, ...) _GMP_SEQ_FOLD_864(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_866(op, state, i, ...) _GMP_SEQ_FOLD_865(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_867(op, state, i, ...) _GMP_SEQ_FOLD_866(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_868(op, state, i, ...) _GMP_SEQ_FOLD_867(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_869(op, state, i, ...) _GMP_SEQ_FOLD_868(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_870(op, state, i, ...) _GMP_SEQ_FOLD_869(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_871(op, state, i, ...) _GMP_SEQ_FOLD_870(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_872(op, state, i, ...) _GMP_SEQ_FOLD_871(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_873(op, state, i, ...) _GMP_SEQ_FOLD_872(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_874(op, state, i, ...) _GMP_SEQ_FOLD_873(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_875(op, state, i, ...) _GMP_SEQ_FOLD_874(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_876(op, state, i, ...) _GMP_SEQ_FOLD_875(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_877(op, state, i, ...) _GMP_SEQ_FOLD_876(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_878(op, state, i, ...) _GMP_SEQ_FOLD_877(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_879(op, state, i, ...) _GMP_SEQ_FOLD_878(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_880(op, state, i, ...) _GMP_SEQ_FOLD_879(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_881(op, state, i, ...) _GMP_SEQ_FOLD_880(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_882(op, state, i, ...) _GMP_SEQ_FOLD_881(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_883(op, state, i, ...) _GMP_SEQ_FOLD_882(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_884(op, state, i, ...) _GMP_SEQ_FOLD_883(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_885(op, state, i, ...) _GMP_SEQ_FOLD_884(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_886(op, state, i, ...) _GMP_SEQ_FOLD_885(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_887(op, state, i, ...) _GMP_SEQ_FOLD_886(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_888(op, state, i, ...) _GMP_SEQ_FOLD_887(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_889(op, state, i, ...) _GMP_SEQ_FOLD_888(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_890(op, state, i, ...) _GMP_SEQ_FOLD_889(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_891(op, state, i, ...) _GMP_SEQ_FOLD_890(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_892(op, state, i, ...) _GMP_SEQ_FOLD_891(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_893(op, state, i, ...) _GMP_SEQ_FOLD_892(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_894(op, state, i, ...) _GMP_SEQ_FOLD_893(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_895(op, state, i, ...) _GMP_SEQ_FOLD_894(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_896(op, state, i, ...) _GMP_SEQ_FOLD_895(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_897(op, state, i, ...) _GMP_SEQ_FOLD_896(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_898(op, state, i, ...) _GMP_SEQ_FOLD_897(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_899(op, state, i, ...) _GMP_SEQ_FOLD_898(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_900(op, state, i, ...) _GMP_SEQ_FOLD_899(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_901(op, state, i, ...) _GMP_SEQ_FOLD_900(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_902(op, state, i, ...) _GMP_SEQ_FOLD_901(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_903(op, state, i, ...) _GMP_SEQ_FOLD_902(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_904(op, state, i, ...) _GMP_SEQ_FOLD_903(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_905(op, state, i, ...) _GMP_SEQ_FOLD_904(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_906(op, state, i, ...) _GMP_SEQ_FOLD_905(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_907(op, state, i, ...) _GMP_SEQ_FOLD_906(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_908(op, state, i, ...) _GMP_SEQ_FOLD_907(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_909(op, state, i, ...) _GMP_SEQ_FOLD_908(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_910(op, state, i, ...) _GMP_SEQ_FOLD_909(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_911(op, state, i, ...) _GMP_SEQ_FOLD_910(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_912(op, state, i, ...) _GMP_SEQ_FOLD_911(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_913(op, state, i, ...) _GMP_SEQ_FOLD_912(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_914(op, state, i, ...) _GMP_SEQ_FOLD_913(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_915(op, state, i, ...) _GMP_SEQ_FOLD_914(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_916(op, state, i, ...) _GMP_SEQ_FOLD_915(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_917(op, state, i, ...) _GMP_SEQ_FOLD_916(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_918(op, state, i, ...) _GMP_SEQ_FOLD_917(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_919(op, state, i, ...) _GMP_SEQ_FOLD_918(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_920(op, state, i, ...) _GMP_SEQ_FOLD_919(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_921(op, state, i, ...) _GMP_SEQ_FOLD_920(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_922(op, state, i, ...) _GMP_SEQ_FOLD_921(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_923(op, state, i, ...) _GMP_SEQ_FOLD_922(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_924(op, state, i, ...) _GMP_SEQ_FOLD_923(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_925(op, state, i, ...) _GMP_SEQ_FOLD_924(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_926(op, state, i, ...) _GMP_SEQ_FOLD_925(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_927(op, state, i, ...) _GMP_SEQ_FOLD_926(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_928(op, state, i, ...) _GMP_SEQ_FOLD_927(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_929(op, state, i, ...) _GMP_SEQ_FOLD_928(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_930(op, state, i, ...) _GMP_SEQ_FOLD_929(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_931(op, state, i, ...) _GMP_SEQ_FOLD_930(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_932(op, state, i, ...) _GMP_SEQ_FOLD_931(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_933(op, state, i, ...) _GMP_SEQ_FOLD_932(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_934(op, state, i, ...) _GMP_SEQ_FOLD_933(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_935(op, state, i, ...) _GMP_SEQ_FOLD_934(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_936(op, state, i, ...) _GMP_SEQ_FOLD_935(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_937(op, state, i, ...) _GMP_SEQ_FOLD_936(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_938(op, state, i, ...) _GMP_SEQ_FOLD_937(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_939(op, state, i, ...) _GMP_SEQ_FOLD_938(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_940(op, state, i, ...) _GMP_SEQ_FOLD_939(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_941(op, state, i, ...) _GMP_SEQ_FOLD_940(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_942(op, state, i, ...) _GMP_SEQ_FOLD_941(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_943(op, state, i, ...) _GMP_SEQ_FOLD_942(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_944(op, state, i, ...) _GMP_SEQ_FOLD_943(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_945(op, state, i, ...) _GMP_SEQ_FOLD_944(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_946(op, state, i, ...) _GMP_SEQ_FOLD_945(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_947(op, state, i, ...) _GMP_SEQ_FOLD_946(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_948(op, state, i, ...) _GMP_SEQ_FOLD_947(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_949(op, state, i, ...) _GMP_SEQ_FOLD_948(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_950(op, state, i, ...) _GMP_SEQ_FOLD_949(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_951(op, state, i, ...) _GMP_SEQ_FOLD_950(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_952(op, state, i, ...) _GMP_SEQ_FOLD_951(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_953(op, state, i, ...) _GMP_SEQ_FOLD_952(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_954(op, state, i, ...) _GMP_SEQ_FOLD_953(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_955(op, state, i, ...) _GMP_SEQ_FOLD_954(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_956(op, state, i, ...) _GMP_SEQ_FOLD_955(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_957(op, state, i, ...) _GMP_SEQ_FOLD_956(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_958(op, state, i, ...) _GMP_SEQ_FOLD_957(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_959(op, state, i, ...) _GMP_SEQ_FOLD_958(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_960(op, state, i, ...) _GMP_SEQ_FOLD_959(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_961(op, state, i, ...) _GMP_SEQ_FOLD_960(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_962(op, state, i, ...) _GMP_SEQ_FOLD_961(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_963(op, state, i, ...) _GMP_SEQ_FOLD_962(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_964(op, state, i, ...) _GMP_SEQ_FOLD_963(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_965(op, state, i, ...) _GMP_SEQ_FOLD_964(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_966(op, state, i, ...) _GMP_SEQ_FOLD_965(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_967(op, state, i, ...) _GMP_SEQ_FOLD_966(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_968(op, state, i, ...) _GMP_SEQ_FOLD_967(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_969(op, state, i, ...) _GMP_SEQ_FOLD_968(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_970(op, state, i, ...) _GMP_SEQ_FOLD_969(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_971(op, state, i, ...) _GMP_SEQ_FOLD_970(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_972(op, state, i, ...) _GMP_SEQ_FOLD_971(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_973(op, state, i, ...) _GMP_SEQ_FOLD_972(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_974(op, state, i, ...) _GMP_SEQ_FOLD_973(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_975(op, state, i, ...) _GMP_SEQ_FOLD_974(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_976(op, state, i, ...) _GMP_SEQ_FOLD_975(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_977(op, state, i, ...) _GMP_SEQ_FOLD_976(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_978(op, state, i, ...) _GMP_SEQ_FOLD_977(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_979(op, state, i, ...) _GMP_SEQ_FOLD_978(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_980(op, state, i, ...) _GMP_SEQ_FOLD_979(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_981(op, state, i, ...) _GMP_SEQ_FOLD_980(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_982(op, state, i, ...) _GMP_SEQ_FOLD_981(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_983(op, state, i, ...) _GMP_SEQ_FOLD_982(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_984(op, state, i, ...) _GMP_SEQ_FOLD_983(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_985(op, state, i, ...) _GMP_SEQ_FOLD_984(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_986(op, state, i, ...) _GMP_SEQ_FOLD_985(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_987(op, state, i, ...) _GMP_SEQ_FOLD_986(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_988(op, state, i, ...) _GMP_SEQ_FOLD_987(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_989(op, state, i, ...) _GMP_SEQ_FOLD_988(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_990(op, state, i, ...) _GMP_SEQ_FOLD_989(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_991(op, state, i, ...) _GMP_SEQ_FOLD_990(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_992(op, state, i, ...) _GMP_SEQ_FOLD_991(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_993(op, state, i, ...) _GMP_SEQ_FOLD_992(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_994(op, state, i, ...) _GMP_SEQ_FOLD_993(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_995(op, state, i, ...) _GMP_SEQ_FOLD_994(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_996(op, state, i, ...) _GMP_SEQ_FOLD_995(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_997(op, state, i, ...) _GMP_SEQ_FOLD_996(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_998(op, state, i, ...) _GMP_SEQ_FOLD_997(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_999(op, state, i, ...) _GMP_SEQ_FOLD_998(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1000(op, state, i, ...) _GMP_SEQ_FOLD_999(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1001(op, state, i, ...) _GMP_SEQ_FOLD_1000(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1002(op, state, i, ...) _GMP_SEQ_FOLD_1001(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1003(op, state, i, ...) _GMP_SEQ_FOLD_1002(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1004(op, state, i, ...) _GMP_SEQ_FOLD_1003(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1005(op, state, i, ...) _GMP_SEQ_FOLD_1004(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1006(op, state, i, ...) _GMP_SEQ_FOLD_1005(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1007(op, state, i, ...) _GMP_SEQ_FOLD_1006(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1008(op, state, i, ...) _GMP_SEQ_FOLD_1007(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1009(op, state, i, ...) _GMP_SEQ_FOLD_1008(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1010(op, state, i, ...) _GMP_SEQ_FOLD_1009(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1011(op, state, i, ...) _GMP_SEQ_FOLD_1010(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1012(op, state, i, ...) _GMP_SEQ_FOLD_1011(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1013(op, state, i, ...) _GMP_SEQ_FOLD_1012(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1014(op, state, i, ...) _GMP_SEQ_FOLD_1013(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1015(op, state, i, ...) _GMP_SEQ_FOLD_1014(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1016(op, state, i, ...) _GMP_SEQ_FOLD_1015(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1017(op, state, i, ...) _GMP_SEQ_FOLD_1016(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1018(op, state, i, ...) _GMP_SEQ_FOLD_1017(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1019(op, state, i, ...) _GMP_SEQ_FOLD_1018(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1020(op, state, i, ...) _GMP_SEQ_FOLD_1019(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1021(op, state, i, ...) _GMP_SEQ_FOLD_1020(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1022(op, state, i, ...) _GMP_SEQ_FOLD_1021(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1023(op, state, i, ...) _GMP_SEQ_FOLD_1022(op, op(state, __VA_ARGS__),
+#define _GMP_SEQ_FOLD_1024(op, state, i, ...) _GMP_SEQ_FOLD_1023(op, op(state, __VA_ARGS__),
+
+#endif // GMP_MACRO_LIMITS_SEQ_1024_HPP_
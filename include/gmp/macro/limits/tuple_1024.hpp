@@ -0,0 +1,2059 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_TUPLE_1024_HPP_
+#define GMP_MACRO_LIMITS_TUPLE_1024_HPP_
+
+// GMP_TUPLE_ELEM
+#define _GMP_TUPLE_ELEM_0(x, ...) x
+#define _GMP_TUPLE_ELEM_1(_0, x, ...) x
+#define _GMP_TUPLE_ELEM_2(_0, _1, x, ...) x
+#define _GMP_TUPLE_ELEM_3(_0, _1, _2, x, ...) x
+#define _GMP_TUPLE_ELEM_4(_0, _1, _2, _3, x, ...) x
+#define _GMP_TUPLE_ELEM_5(_0, _1, _2, _3, _4, x, ...) x
+#define _GMP_TUPLE_ELEM_6(_0, _1, _2, _3, _4, _5, x, ...) x
+#define _GMP_TUPLE_ELEM_7(_0, _1, _2, _3, _4, _5, _6, x, ...) x
+#define _GMP_TUPLE_ELEM_8(_0, _1, _2, _3, _4, _5, _6, _7, x, ...) x
+#define _GMP_TUPLE_ELEM_9(_0, _1, _2, _3, _4, _5, _6, _7, _8, x, ...) x
+#define _GMP_TUPLE_ELEM_10(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, x, ...) x
+#define _GMP_TUPLE_ELEM_11(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, x, ...) x
+#define _GMP_TUPLE_ELEM_12(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, x, ...) x
+#define _GMP_TUPLE_ELEM_13(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, x, ...) x
+#define _GMP_TUPLE_ELEM_14(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, x, ...) x
+#define _GMP_TUPLE_ELEM_15(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, x, ...) x
+#define _GMP_TUPLE_ELEM_16(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_0(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_17(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_18(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_2(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_19(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_3(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_20(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_4(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_21(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_5(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_22(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_6(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_23(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_7(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_24(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_8(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_25(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_9(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_26(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_10(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_27(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_11(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_28(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_12(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_29(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_13(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_30(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_14(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_31(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_15(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_32(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_16(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_33(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_17(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_34(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_18(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_35(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_19(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_36(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_20(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_37(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_21(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_38(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_22(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_39(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_23(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_40(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_24(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_41(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_25(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_42(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_26(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_43(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_27(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_44(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_28(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_45(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_29(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_46(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_30(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_47(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_31(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_48(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_32(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_49(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_33(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_50(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_34(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_51(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_35(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_52(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_36(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_53(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_37(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_54(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_38(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_55(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_39(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_56(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_40(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_57(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_41(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_58(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_42(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_59(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_43(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_60(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_44(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_61(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_45(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_62(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_46(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_63(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_47(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_64(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_48(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_65(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_49(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_66(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_50(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_67(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_51(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_68(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_52(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_69(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_53(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_70(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_54(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_71(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_55(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_72(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_56(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_73(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_57(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_74(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_58(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_75(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_59(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_76(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_60(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_77(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_61(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_78(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_62(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_79(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_63(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_80(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_64(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_81(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_65(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_82(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_66(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_83(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_67(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_84(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_68(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_85(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_69(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_86(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_70(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_87(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_71(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_88(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_72(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_89(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_73(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_90(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_74(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_91(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_75(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_92(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_76(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_93(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_77(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_94(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_78(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_95(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_79(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_96(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_80(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_97(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_81(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_98(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_82(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_99(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_83(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_100(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_84(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_101(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_85(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_102(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_86(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_103(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_87(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_104(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_88(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_105(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_89(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_106(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_90(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_107(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_91(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_108(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_92(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_109(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_93(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_110(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_94(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_111(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_95(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_112(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_96(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_113(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_97(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_114(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_98(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_115(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_99(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_116(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_100(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_117(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_101(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_118(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_102(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_119(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_103(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_120(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_104(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_121(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_105(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_122(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_106(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_123(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_107(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_124(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_108(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_125(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_109(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_126(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_110(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_127(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_111(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_128(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_112(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_129(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_113(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_130(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_114(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_131(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_115(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_132(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_116(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_133(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_117(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_134(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_118(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_135(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_119(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_136(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_120(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_137(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_121(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_138(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_122(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_139(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_123(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_140(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_124(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_141(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_125(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_142(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_126(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_143(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_127(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_144(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_128(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_145(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_129(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_146(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_130(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_147(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_131(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_148(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_132(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_149(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_133(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_150(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_134(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_151(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_135(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_152(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_136(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_153(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_137(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_154(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_138(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_155(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_139(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_156(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_140(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_157(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_141(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_158(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_142(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_159(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_143(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_160(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_144(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_161(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_145(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_162(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_146(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_163(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_147(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_164(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_148(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_165(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_149(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_166(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_150(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_167(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_151(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_168(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_152(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_169(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_153(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_170(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_154(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_171(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_155(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_172(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_156(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_173(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_157(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_174(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_158(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_175(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_159(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_176(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_160(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_177(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_161(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_178(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_162(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_179(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_163(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_180(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_164(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_181(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_165(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_182(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_166(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_183(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_167(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_184(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_168(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_185(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_169(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_186(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_170(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_187(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_171(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_188(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_172(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_189(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_173(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_190(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_174(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_191(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_175(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_192(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_176(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_193(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_177(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_194(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_178(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_195(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_179(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_196(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_180(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_197(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_181(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_198(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_182(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_199(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_183(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_200(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_184(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_201(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_185(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_202(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_186(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_203(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_187(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_204(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_188(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_205(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_189(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_206(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_190(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_207(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_191(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_208(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_192(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_209(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_193(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_210(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_194(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_211(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_195(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_212(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_196(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_213(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_197(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_214(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_198(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_215(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_199(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_216(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_200(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_217(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_201(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_218(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_202(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_219(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_203(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_220(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_204(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_221(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_205(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_222(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_206(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_223(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_207(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_224(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_208(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_225(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_209(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_226(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_210(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_227(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_211(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_228(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_212(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_229(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_213(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_230(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_214(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_231(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_215(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_232(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_216(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_233(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_217(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_234(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_218(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_235(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_219(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_236(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_220(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_237(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_221(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_238(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_222(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_239(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_223(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_240(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_224(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_241(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_225(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_242(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_226(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_243(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_227(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_244(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_228(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_245(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_229(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_246(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_230(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_247(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_231(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_248(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_232(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_249(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_233(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_250(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_234(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_251(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_235(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_252(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_236(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_253(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_237(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_254(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_238(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_255(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_239(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_256(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_240(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_257(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_241(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_258(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_242(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_259(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_243(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_260(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_244(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_261(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_245(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_262(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_246(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_263(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_247(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_264(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_248(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_265(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_249(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_266(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_250(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_267(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_251(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_268(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_252(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_269(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_253(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_270(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_254(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_271(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_255(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_272(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_256(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_273(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_257(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_274(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_258(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_275(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_259(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_276(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_260(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_277(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_261(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_278(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_262(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_279(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_263(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_280(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_264(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_281(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_265(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_282(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_266(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_283(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_267(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_284(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_268(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_285(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_269(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_286(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_270(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_287(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_271(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_288(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_272(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_289(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_273(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_290(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_274(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_291(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_275(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_292(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_276(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_293(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_277(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_294(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_278(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_295(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_279(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_296(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_280(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_297(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_281(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_298(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_282(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_299(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_283(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_300(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_284(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_301(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_285(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_302(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_286(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_303(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_287(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_304(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_288(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_305(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_289(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_306(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_290(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_307(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_291(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_308(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_292(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_309(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_293(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_310(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_294(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_311(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_295(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_312(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_296(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_313(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_297(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_314(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_298(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_315(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_299(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_316(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_300(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_317(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_301(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_318(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_302(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_319(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_303(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_320(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_304(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_321(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_305(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_322(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_306(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_323(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_307(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_324(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_308(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_325(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_309(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_326(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_310(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_327(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_311(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_328(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_312(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_329(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_313(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_330(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_314(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_331(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_315(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_332(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_316(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_333(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_317(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_334(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_318(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_335(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_319(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_336(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_320(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_337(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_321(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_338(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_322(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_339(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_323(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_340(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_324(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_341(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_325(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_342(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_326(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_343(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_327(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_344(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_328(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_345(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_329(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_346(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_330(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_347(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_331(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_348(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_332(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_349(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_333(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_350(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_334(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_351(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_335(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_352(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_336(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_353(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_337(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_354(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_338(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_355(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_339(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_356(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_340(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_357(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_341(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_358(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_342(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_359(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_343(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_360(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_344(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_361(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_345(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_362(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_346(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_363(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_347(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_364(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_348(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_365(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_349(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_366(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_350(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_367(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_351(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_368(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_352(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_369(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_353(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_370(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_354(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_371(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_355(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_372(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_356(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_373(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_357(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_374(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_358(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_375(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_359(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_376(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_360(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_377(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_361(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_378(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_362(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_379(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_363(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_380(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_364(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_381(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_365(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_382(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_366(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_383(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_367(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_384(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_368(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_385(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_369(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_386(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_370(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_387(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_371(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_388(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_372(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_389(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_373(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_390(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_374(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_391(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_375(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_392(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_376(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_393(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_377(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_394(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_378(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_395(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_379(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_396(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_380(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_397(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_381(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_398(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_382(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_399(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_383(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_400(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_384(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_401(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_385(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_402(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_386(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_403(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_387(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_404(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_388(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_405(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_389(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_406(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_390(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_407(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_391(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_408(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_392(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_409(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_393(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_410(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_394(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_411(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_395(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_412(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_396(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_413(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_397(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_414(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_398(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_415(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_399(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_416(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_400(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_417(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_401(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_418(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_402(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_419(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_403(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_420(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_404(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_421(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_405(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_422(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_406(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_423(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_407(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_424(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_408(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_425(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_409(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_426(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_410(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_427(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_411(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_428(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_412(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_429(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_413(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_430(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_414(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_431(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_415(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_432(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_416(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_433(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_417(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_434(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_418(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_435(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_419(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_436(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_420(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_437(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_421(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_438(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_422(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_439(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_423(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_440(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_424(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_441(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_425(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_442(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_426(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_443(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_427(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_444(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_428(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_445(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_429(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_446(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_430(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_447(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_431(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_448(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_432(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_449(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_433(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_450(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_434(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_451(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_435(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_452(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_436(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_453(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_437(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_454(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_438(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_455(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_439(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_456(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_440(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_457(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_441(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_458(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_442(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_459(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_443(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_460(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_444(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_461(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_445(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_462(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_446(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_463(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_447(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_464(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_448(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_465(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_449(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_466(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_450(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_467(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_451(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_468(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_452(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_469(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_453(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_470(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_454(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_471(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_455(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_472(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_456(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_473(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_457(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_474(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_458(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_475(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_459(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_476(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_460(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_477(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_461(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_478(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_462(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_479(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_463(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_480(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_464(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_481(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_465(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_482(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_466(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_483(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_467(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_484(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_468(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_485(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_469(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_486(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_470(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_487(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_471(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_488(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_472(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_489(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_473(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_490(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_474(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_491(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_475(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_492(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_476(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_493(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_477(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_494(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_478(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_495(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_479(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_496(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_480(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_497(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_481(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_498(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_482(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_499(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_483(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_500(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_484(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_501(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_485(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_502(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_486(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_503(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_487(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_504(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_488(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_505(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_489(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_506(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_490(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_507(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_491(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_508(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_492(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_509(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_493(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_510(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_494(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_511(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_495(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_512(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_496(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_513(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_497(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_514(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_498(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_515(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_499(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_516(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_500(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_517(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_501(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_518(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_502(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_519(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_503(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_520(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_504(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_521(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_505(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_522(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_506(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_523(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_507(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_524(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_508(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_525(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_509(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_526(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_510(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_527(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_511(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_528(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_512(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_529(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_513(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_530(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_514(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_531(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_515(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_532(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_516(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_533(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_517(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_534(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_518(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_535(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_519(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_536(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_520(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_537(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_521(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_538(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_522(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_539(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_523(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_540(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_524(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_541(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_525(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_542(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_526(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_543(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_527(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_544(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_528(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_545(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_529(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_546(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_530(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_547(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_531(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_548(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_532(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_549(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_533(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_550(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_534(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_551(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_535(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_552(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_536(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_553(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_537(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_554(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_538(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_555(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_539(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_556(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_540(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_557(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_541(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_558(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_542(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_559(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_543(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_560(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_544(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_561(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_545(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_562(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_546(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_563(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_547(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_564(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_548(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_565(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_549(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_566(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_550(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_567(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_551(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_568(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_552(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_569(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_553(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_570(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_554(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_571(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_555(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_572(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_556(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_573(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_557(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_574(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_558(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_575(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_559(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_576(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_560(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_577(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_561(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_578(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_562(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_579(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_563(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_580(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_564(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_581(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_565(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_582(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_566(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_583(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_567(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_584(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_568(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_585(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_569(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_586(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_570(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_587(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_571(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_588(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_572(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_589(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_573(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_590(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_574(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_591(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_575(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_592(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_576(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_593(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_577(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_594(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_578(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_595(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_579(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_596(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_580(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_597(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_581(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_598(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_582(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_599(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_583(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_600(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_584(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_601(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_585(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_602(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_586(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_603(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_587(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_604(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_588(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_605(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_589(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_606(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_590(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_607(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_591(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_608(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_592(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_609(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_593(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_610(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_594(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_611(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_595(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_612(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_596(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_613(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_597(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_614(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_598(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_615(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_599(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_616(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_600(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_617(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_601(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_618(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_602(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_619(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_603(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_620(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_604(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_621(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_605(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_622(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_606(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_623(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_607(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_624(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_608(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_625(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_609(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_626(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_610(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_627(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_611(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_628(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_612(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_629(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_613(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_630(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_614(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_631(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_615(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_632(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_616(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_633(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_617(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_634(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_618(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_635(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_619(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_636(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_620(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_637(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_621(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_638(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_622(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_639(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_623(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_640(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_624(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_641(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_625(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_642(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_626(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_643(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_627(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_644(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_628(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_645(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_629(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_646(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_630(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_647(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_631(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_648(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_632(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_649(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_633(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_650(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_634(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_651(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_635(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_652(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_636(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_653(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_637(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_654(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_638(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_655(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_639(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_656(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_640(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_657(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_641(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_658(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_642(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_659(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_643(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_660(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_644(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_661(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_645(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_662(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_646(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_663(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_647(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_664(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_648(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_665(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_649(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_666(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_650(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_667(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_651(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_668(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_652(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_669(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_653(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_670(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_654(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_671(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_655(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_672(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_656(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_673(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_657(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_674(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_658(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_675(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_659(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_676(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_660(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_677(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_661(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_678(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_662(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_679(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_663(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_680(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_664(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_681(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_665(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_682(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_666(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_683(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_667(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_684(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_668(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_685(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_669(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_686(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_670(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_687(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_671(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_688(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_672(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_689(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_673(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_690(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_674(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_691(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_675(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_692(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_676(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_693(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_677(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_694(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_678(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_695(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_679(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_696(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_680(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_697(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_681(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_698(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_682(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_699(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_683(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_700(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_684(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_701(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_685(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_702(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_686(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_703(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_687(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_704(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_688(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_705(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_689(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_706(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_690(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_707(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_691(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_708(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_692(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_709(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_693(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_710(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_694(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_711(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_695(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_712(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_696(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_713(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_697(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_714(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_698(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_715(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_699(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_716(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_700(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_717(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_701(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_718(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_702(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_719(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_703(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_720(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_704(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_721(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_705(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_722(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_706(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_723(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_707(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_724(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_708(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_725(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_709(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_726(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_710(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_727(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_711(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_728(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_712(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_729(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_713(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_730(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_714(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_731(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_715(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_732(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_716(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_733(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_717(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_734(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_718(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_735(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_719(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_736(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_720(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_737(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_721(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_738(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_722(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_739(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_723(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_740(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_724(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_741(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_725(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_742(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_726(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_743(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_727(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_744(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_728(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_745(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_729(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_746(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_730(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_747(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_731(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_748(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_732(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_749(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_733(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_750(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_734(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_751(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_735(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_752(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_736(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_753(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_737(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_754(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_738(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_755(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_739(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_756(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_740(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_757(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_741(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_758(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_742(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_759(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_743(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_760(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_744(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_761(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_745(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_762(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_746(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_763(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_747(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_764(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_748(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_765(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_749(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_766(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_750(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_767(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_751(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_768(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_752(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_769(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_753(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_770(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_754(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_771(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_755(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_772(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_756(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_773(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_757(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_774(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_758(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_775(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_759(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_776(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_760(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_777(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_761(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_778(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_762(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_779(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_763(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_780(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_764(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_781(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_765(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_782(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_766(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_783(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_767(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_784(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_768(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_785(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_769(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_786(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_770(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_787(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_771(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_788(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_772(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_789(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_773(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_790(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_774(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_791(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_775(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_792(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_776(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_793(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_777(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_794(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_778(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_795(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_779(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_796(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_780(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_797(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_781(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_798(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_782(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_799(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_783(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_800(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_784(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_801(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_785(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_802(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_786(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_803(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_787(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_804(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_788(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_805(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_789(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_806(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_790(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_807(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_791(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_808(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_792(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_809(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_793(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_810(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_794(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_811(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_795(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_812(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_796(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_813(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_797(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_814(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_798(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_815(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_799(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_816(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_800(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_817(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_801(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_818(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_802(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_819(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_803(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_820(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_804(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_821(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_805(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_822(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_806(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_823(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_807(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_824(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_808(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_825(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_809(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_826(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_810(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_827(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_811(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_828(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_812(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_829(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_813(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_830(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_814(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_831(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_815(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_832(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_816(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_833(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_817(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_834(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_818(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_835(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_819(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_836(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_820(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_837(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_821(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_838(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_822(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_839(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_823(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_840(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_824(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_841(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_825(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_842(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_826(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_843(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_827(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_844(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_828(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_845(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_829(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_846(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_830(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_847(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_831(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_848(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_832(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_849(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_833(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_850(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_834(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_851(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_835(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_852(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_836(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_853(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_837(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_854(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_838(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_855(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_839(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_856(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_840(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_857(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_841(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_858(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_842(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_859(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_843(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_860(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_844(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_861(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_845(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_862(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_846(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_863(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_847(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_864(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_848(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_865(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_849(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_866(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_850(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_867(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_851(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_868(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_852(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_869(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_853(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_870(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_854(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_871(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_855(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_872(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_856(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_873(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_857(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_874(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_858(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_875(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_859(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_876(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_860(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_877(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_861(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_878(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_862(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_879(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_863(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_880(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_864(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_881(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_865(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_882(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_866(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_883(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_867(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_884(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_868(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_885(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_869(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_886(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_870(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_887(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_871(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_888(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_872(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_889(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_873(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_890(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_874(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_891(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_875(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_892(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_876(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_893(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_877(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_894(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_878(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_895(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_879(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_896(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_880(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_897(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_881(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_898(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_882(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_899(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_883(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_900(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_884(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_901(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_885(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_902(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_886(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_903(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_887(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_904(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_888(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_905(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_889(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_906(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_890(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_907(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_891(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_908(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_892(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_909(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_893(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_910(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_894(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_911(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_895(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_912(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_896(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_913(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_897(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_914(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_898(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_915(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_899(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_916(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_900(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_917(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_901(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_918(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_902(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_919(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_903(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_920(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_904(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_921(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_905(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_922(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_906(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_923(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_907(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_924(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_908(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_925(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_909(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_926(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_910(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_927(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_911(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_928(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_912(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_929(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_913(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_930(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_914(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_931(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_915(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_932(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_916(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_933(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_917(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_934(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_918(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_935(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_919(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_936(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_920(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_937(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_921(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_938(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_922(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_939(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_923(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_940(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_924(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_941(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_925(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_942(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_926(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_943(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_927(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_944(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_928(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_945(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_929(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_946(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_930(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_947(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_931(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_948(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_932(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_949(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_933(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_950(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_934(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_951(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_935(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_952(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_936(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_953(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_937(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_954(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_938(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_955(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_939(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_956(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_940(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_957(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_941(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_958(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_942(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_959(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_943(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_960(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_944(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_961(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_945(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_962(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_946(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_963(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_947(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_964(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_948(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_965(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_949(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_966(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_950(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_967(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_951(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_968(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_952(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_969(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_953(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_970(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_954(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_971(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_955(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_972(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_956(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_973(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_957(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_974(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_958(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_975(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_959(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_976(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_960(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_977(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_961(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_978(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_962(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_979(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_963(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_980(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_964(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_981(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_965(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_982(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_966(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_983(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_967(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_984(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_968(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_985(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_969(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_986(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_970(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_987(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_971(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_988(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_972(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_989(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_973(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_990(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_974(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_991(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_975(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_992(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_976(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_993(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_977(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_994(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_978(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_995(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_979(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_996(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_980(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_997(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_981(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_998(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_982(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_999(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_983(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1000(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_984(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1001(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_985(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1002(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_986(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1003(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_987(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1004(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_988(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1005(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_989(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1006(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_990(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1007(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_991(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1008(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_992(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1009(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_993(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1010(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_994(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1011(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_995(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1012(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_996(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1013(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_997(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1014(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_998(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1015(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_999(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1016(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1000(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1017(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1001(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1018(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1002(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1019(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1003(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1020(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1004(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1021(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1005(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1022(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1006(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_1023(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1007(__VA_ARGS__)
+
+// GMP_ZIP
+#define _GMP_ZIP_0(rhs, ...)
+#define _GMP_ZIP_1(rhs, x) (x, _GMP_TUPLE_ELEM_0 rhs)
+#define _GMP_ZIP_2(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_3(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_2((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_4(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_3((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_5(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_4((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_6(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_5((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_7(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_6((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_8(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_7((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_9(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_8((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_10(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_9((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_11(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_10((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_12(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_11((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_13(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_12((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_14(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_13((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_15(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_14((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_16(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_15((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_17(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_16((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_18(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_17((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_19(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_18((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_20(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_19((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_21(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_20((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_22(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_21((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_23(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_22((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_24(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_23((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_25(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_24((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_26(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_25((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_27(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_26((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_28(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_27((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_29(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_28((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_30(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_29((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_31(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_30((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_32(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_31((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_33(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_32((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_34(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_33((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_35(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_34((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_36(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_35((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_37(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_36((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_38(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_37((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_39(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_38((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_40(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_39((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_41(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_40((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_42(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_41((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_43(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_42((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_44(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_43((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_45(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_44((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_46(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_45((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_47(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_46((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_48(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_47((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_49(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_48((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_50(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_49((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_51(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_50((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_52(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_51((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_53(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_52((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_54(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_53((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_55(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_54((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_56(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_55((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_57(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_56((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_58(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_57((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_59(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_58((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_60(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_59((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_61(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_60((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_62(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_61((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_63(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_62((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_64(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_63((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_65(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_64((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_66(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_65((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_67(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_66((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_68(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_67((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_69(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_68((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_70(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_69((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_71(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_70((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_72(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_71((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_73(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_72((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_74(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_73((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_75(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_74((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_76(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_75((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_77(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_76((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_78(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_77((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_79(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_78((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_80(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_79((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_81(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_80((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_82(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_81((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_83(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_82((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_84(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_83((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_85(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_84((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_86(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_85((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_87(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_86((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_88(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_87((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_89(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_88((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_90(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_89((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_91(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_90((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_92(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_91((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_93(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_92((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_94(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_93((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_95(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_94((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_96(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_95((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_97(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_96((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_98(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_97((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_99(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_98((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_100(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_99((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_101(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_100((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_102(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_101((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_103(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_102((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_104(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_103((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_105(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_104((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_106(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_105((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_107(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_106((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_108(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_107((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_109(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_108((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_110(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_109((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_111(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_110((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_112(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_111((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_113(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_112((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_114(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_113((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_115(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_114((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_116(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_115((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_117(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_116((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_118(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_117((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_119(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_118((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_120(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_119((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_121(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_120((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_122(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_121((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_123(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_122((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_124(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_123((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_125(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_124((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_126(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_125((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_127(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_126((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_128(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_127((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_129(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_128((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_130(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_129((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_131(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_130((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_132(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_131((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_133(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_132((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_134(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_133((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_135(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_134((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_136(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_135((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_137(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_136((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_138(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_137((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_139(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_138((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_140(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_139((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_141(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_140((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_142(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_141((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_143(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_142((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_144(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_143((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_145(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_144((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_146(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_145((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_147(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_146((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_148(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_147((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_149(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_148((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_150(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_149((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_151(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_150((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_152(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_151((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_153(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_152((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_154(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_153((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_155(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_154((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_156(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_155((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_157(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_156((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_158(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_157((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_159(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_158((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_160(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_159((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_161(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_160((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_162(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_161((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_163(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_162((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_164(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_163((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_165(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_164((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_166(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_165((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_167(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_166((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_168(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_167((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_169(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_168((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_170(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_169((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_171(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_170((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_172(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_171((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_173(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_172((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_174(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_173((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_175(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_174((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_176(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_175((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_177(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_176((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_178(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_177((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_179(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_178((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_180(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_179((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_181(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_180((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_182(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_181((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_183(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_182((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_184(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_183((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_185(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_184((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_186(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_185((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_187(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_186((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_188(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_187((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_189(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_188((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_190(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_189((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_191(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_190((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_192(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_191((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_193(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_192((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_194(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_193((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_195(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_194((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_196(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_195((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_197(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_196((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_198(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_197((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_199(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_198((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_200(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_199((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_201(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_200((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_202(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_201((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_203(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_202((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_204(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_203((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_205(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_204((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_206(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_205((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_207(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_206((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_208(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_207((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_209(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_208((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_210(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_209((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_211(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_210((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_212(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_211((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_213(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_212((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_214(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_213((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_215(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_214((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_216(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_215((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_217(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_216((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_218(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_217((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_219(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_218((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_220(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_219((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_221(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_220((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_222(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_221((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_223(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_222((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_224(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_223((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_225(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_224((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_226(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_225((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_227(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_226((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_228(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_227((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_229(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_228((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_230(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_229((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_231(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_230((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_232(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_231((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_233(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_232((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_234(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_233((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_235(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_234((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_236(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_235((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_237(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_236((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_238(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_237((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_239(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_238((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_240(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_239((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_241(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_240((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_242(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_241((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_243(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_242((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_244(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_243((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_245(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_244((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_246(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_245((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_247(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_246((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_248(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_247((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_249(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_248((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_250(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_249((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_251(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_250((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_252(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_251((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_253(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_252((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_254(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_253((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_255(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_254((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_256(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_255((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_257(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_256((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_258(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_257((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_259(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_258((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_260(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_259((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_261(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_260((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_262(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_261((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_263(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_262((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_264(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_263((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_265(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_264((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_266(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_265((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_267(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_266((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_268(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_267((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_269(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_268((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_270(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_269((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_271(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_270((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_272(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_271((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_273(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_272((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_274(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_273((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_275(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_274((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_276(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_275((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_277(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_276((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_278(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_277((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_279(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_278((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_280(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_279((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_281(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_280((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_282(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_281((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_283(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_282((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_284(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_283((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_285(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_284((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_286(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_285((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_287(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_286((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_288(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_287((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_289(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_288((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_290(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_289((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_291(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_290((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_292(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_291((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_293(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_292((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_294(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_293((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_295(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_294((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_296(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_295((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_297(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_296((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_298(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_297((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_299(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_298((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_300(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_299((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_301(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_300((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_302(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_301((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_303(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_302((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_304(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_303((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_305(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_304((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_306(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_305((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_307(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_306((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_308(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_307((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_309(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_308((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_310(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_309((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_311(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_310((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_312(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_311((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_313(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_312((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_314(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_313((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_315(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_314((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_316(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_315((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_317(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_316((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_318(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_317((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_319(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_318((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_320(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_319((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_321(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_320((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_322(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_321((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_323(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_322((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_324(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_323((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_325(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_324((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_326(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_325((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_327(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_326((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_328(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_327((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_329(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_328((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_330(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_329((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_331(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_330((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_332(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_331((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_333(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_332((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_334(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_333((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_335(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_334((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_336(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_335((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_337(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_336((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_338(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_337((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_339(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_338((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_340(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_339((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_341(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_340((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_342(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_341((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_343(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_342((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_344(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_343((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_345(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_344((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_346(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_345((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_347(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_346((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_348(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_347((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_349(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_348((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_350(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_349((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_351(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_350((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_352(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_351((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_353(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_352((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_354(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_353((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_355(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_354((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_356(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_355((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_357(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_356((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_358(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_357((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_359(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_358((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_360(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_359((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_361(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_360((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_362(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_361((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_363(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_362((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_364(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_363((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_365(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_364((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_366(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_365((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_367(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_366((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_368(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_367((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_369(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_368((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_370(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_369((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_371(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_370((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_372(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_371((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_373(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_372((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_374(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_373((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_375(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_374((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_376(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_375((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_377(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_376((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_378(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_377((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_379(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_378((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_380(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_379((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_381(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_380((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_382(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_381((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_383(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_382((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_384(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_383((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_385(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_384((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_386(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_385((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_387(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_386((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_388(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_387((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_389(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_388((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_390(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_389((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_391(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_390((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_392(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_391((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_393(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_392((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_394(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_393((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_395(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_394((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_396(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_395((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_397(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_396((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_398(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_397((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_399(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_398((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_400(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_399((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_401(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_400((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_402(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_401((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_403(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_402((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_404(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_403((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_405(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_404((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_406(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_405((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_407(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_406((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_408(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_407((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_409(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_408((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_410(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_409((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_411(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_410((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_412(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_411((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_413(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_412((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_414(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_413((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_415(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_414((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_416(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_415((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_417(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_416((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_418(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_417((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_419(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_418((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_420(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_419((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_421(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_420((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_422(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_421((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_423(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_422((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_424(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_423((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_425(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_424((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_426(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_425((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_427(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_426((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_428(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_427((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_429(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_428((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_430(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_429((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_431(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_430((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_432(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_431((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_433(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_432((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_434(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_433((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_435(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_434((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_436(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_435((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_437(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_436((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_438(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_437((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_439(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_438((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_440(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_439((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_441(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_440((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_442(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_441((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_443(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_442((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_444(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_443((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_445(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_444((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_446(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_445((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_447(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_446((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_448(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_447((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_449(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_448((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_450(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_449((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_451(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_450((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_452(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_451((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_453(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_452((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_454(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_453((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_455(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_454((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_456(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_455((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_457(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_456((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_458(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_457((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_459(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_458((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_460(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_459((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_461(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_460((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_462(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_461((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_463(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_462((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_464(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_463((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_465(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_464((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_466(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_465((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_467(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_466((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_468(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_467((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_469(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_468((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_470(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_469((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_471(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_470((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_472(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_471((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_473(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_472((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_474(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_473((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_475(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_474((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_476(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_475((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_477(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_476((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_478(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_477((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_479(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_478((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_480(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_479((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_481(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_480((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_482(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_481((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_483(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_482((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_484(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_483((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_485(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_484((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_486(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_485((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_487(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_486((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_488(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_487((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_489(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_488((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_490(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_489((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_491(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_490((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_492(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_491((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_493(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_492((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_494(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_493((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_495(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_494((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_496(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_495((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_497(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_496((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_498(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_497((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_499(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_498((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_500(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_499((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_501(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_500((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_502(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_501((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_503(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_502((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_504(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_503((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_505(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_504((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_506(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_505((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_507(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_506((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_508(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_507((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_509(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_508((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_510(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_509((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_511(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_510((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_512(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_511((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_513(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_512((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_514(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_513((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_515(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_514((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_516(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_515((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_517(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_516((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_518(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_517((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_519(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_518((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_520(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_519((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_521(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_520((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_522(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_521((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_523(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_522((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_524(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_523((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_525(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_524((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_526(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_525((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_527(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_526((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_528(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_527((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_529(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_528((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_530(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_529((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_531(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_530((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_532(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_531((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_533(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_532((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_534(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_533((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_535(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_534((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_536(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_535((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_537(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_536((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_538(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_537((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_539(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_538((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_540(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_539((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_541(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_540((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_542(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_541((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_543(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_542((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_544(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_543((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_545(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_544((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_546(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_545((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_547(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_546((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_548(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_547((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_549(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_548((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_550(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_549((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_551(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_550((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_552(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_551((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_553(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_552((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_554(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_553((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_555(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_554((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_556(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_555((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_557(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_556((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_558(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_557((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_559(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_558((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_560(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_559((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_561(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_560((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_562(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_561((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_563(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_562((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_564(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_563((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_565(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_564((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_566(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_565((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_567(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_566((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_568(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_567((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_569(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_568((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_570(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_569((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_571(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_570((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_572(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_571((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_573(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_572((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_574(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_573((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_575(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_574((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_576(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_575((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_577(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_576((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_578(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_577((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_579(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_578((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_580(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_579((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_581(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_580((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_582(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_581((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_583(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_582((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_584(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_583((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_585(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_584((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_586(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_585((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_587(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_586((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_588(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_587((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_589(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_588((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_590(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_589((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_591(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_590((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_592(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_591((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_593(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_592((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_594(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_593((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_595(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_594((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_596(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_595((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_597(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_596((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_598(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_597((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_599(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_598((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_600(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_599((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_601(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_600((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_602(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_601((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_603(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_602((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_604(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_603((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_605(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_604((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_606(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_605((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_607(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_606((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_608(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_607((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_609(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_608((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_610(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_609((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_611(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_610((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_612(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_611((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_613(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_612((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_614(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_613((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_615(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_614((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_616(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_615((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_617(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_616((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_618(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_617((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_619(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_618((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_620(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_619((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_621(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_620((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_622(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_621((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_623(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_622((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_624(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_623((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_625(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_624((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_626(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_625((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_627(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_626((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_628(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_627((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_629(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_628((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_630(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_629((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_631(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_630((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_632(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_631((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_633(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_632((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_634(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_633((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_635(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_634((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_636(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_635((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_637(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_636((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_638(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_637((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_639(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_638((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_640(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_639((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_641(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_640((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_642(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_641((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_643(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_642((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_644(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_643((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_645(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_644((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_646(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_645((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_647(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_646((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_648(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_647((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_649(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_648((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_650(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_649((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_651(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_650((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_652(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_651((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_653(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_652((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_654(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_653((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_655(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_654((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_656(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_655((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_657(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_656((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_658(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_657((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_659(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_658((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_660(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_659((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_661(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_660((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_662(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_661((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_663(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_662((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_664(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_663((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_665(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_664((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_666(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_665((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_667(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_666((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_668(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_667((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_669(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_668((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_670(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_669((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_671(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_670((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_672(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_671((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_673(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_672((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_674(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_673((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_675(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_674((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_676(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_675((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_677(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_676((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_678(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_677((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_679(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_678((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_680(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_679((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_681(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_680((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_682(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_681((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_683(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_682((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_684(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_683((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_685(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_684((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_686(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_685((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_687(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_686((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_688(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_687((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_689(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_688((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_690(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_689((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_691(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_690((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_692(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_691((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_693(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_692((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_694(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_693((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_695(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_694((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_696(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_695((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_697(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_696((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_698(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_697((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_699(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_698((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_700(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_699((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_701(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_700((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_702(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_701((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_703(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_702((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_704(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_703((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_705(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_704((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_706(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_705((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_707(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_706((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_708(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_707((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_709(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_708((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_710(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_709((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_711(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_710((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_712(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_711((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_713(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_712((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_714(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_713((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_715(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_714((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_716(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_715((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_717(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_716((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_718(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_717((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_719(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_718((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_720(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_719((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_721(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_720((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_722(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_721((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_723(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_722((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_724(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_723((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_725(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_724((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_726(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_725((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_727(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_726((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_728(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_727((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_729(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_728((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_730(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_729((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_731(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_730((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_732(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_731((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_733(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_732((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_734(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_733((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_735(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_734((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_736(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_735((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_737(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_736((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_738(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_737((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_739(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_738((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_740(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_739((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_741(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_740((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_742(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_741((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_743(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_742((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_744(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_743((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_745(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_744((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_746(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_745((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_747(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_746((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_748(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_747((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_749(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_748((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_750(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_749((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_751(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_750((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_752(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_751((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_753(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_752((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_754(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_753((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_755(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_754((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_756(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_755((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_757(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_756((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_758(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_757((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_759(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_758((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_760(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_759((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_761(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_760((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_762(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_761((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_763(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_762((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_764(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_763((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_765(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_764((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_766(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_765((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_767(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_766((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_768(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_767((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_769(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_768((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_770(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_769((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_771(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_770((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_772(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_771((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_773(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_772((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_774(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_773((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_775(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_774((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_776(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_775((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_777(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_776((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_778(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_777((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_779(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_778((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_780(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_779((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_781(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_780((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_782(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_781((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_783(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_782((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_784(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_783((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_785(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_784((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_786(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_785((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_787(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_786((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_788(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_787((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_789(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_788((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_790(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_789((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_791(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_790((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_792(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_791((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_793(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_792((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_794(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_793((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_795(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_794((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_796(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_795((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_797(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_796((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_798(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_797((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_799(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_798((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_800(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_799((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_801(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_800((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_802(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_801((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_803(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_802((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_804(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_803((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_805(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_804((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_806(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_805((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_807(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_806((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_808(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_807((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_809(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_808((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_810(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_809((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_811(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_810((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_812(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_811((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_813(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_812((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_814(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_813((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_815(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_814((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_816(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_815((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_817(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_816((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_818(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_817((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_819(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_818((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_820(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_819((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_821(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_820((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_822(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_821((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_823(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_822((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_824(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_823((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_825(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_824((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_826(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_825((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_827(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_826((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_828(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_827((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_829(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_828((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_830(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_829((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_831(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_830((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_832(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_831((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_833(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_832((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_834(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_833((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_835(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_834((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_836(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_835((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_837(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_836((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_838(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_837((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_839(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_838((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_840(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_839((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_841(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_840((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_842(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_841((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_843(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_842((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_844(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_843((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_845(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_844((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_846(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_845((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_847(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_846((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_848(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_847((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_849(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_848((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_850(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_849((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_851(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_850((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_852(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_851((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_853(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_852((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_854(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_853((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_855(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_854((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_856(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_855((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_857(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_856((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_858(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_857((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_859(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_858((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_860(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_859((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_861(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_860((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_862(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_861((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_863(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_862((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_864(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_863((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_865(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_864((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_866(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_865((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_867(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_866((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_868(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_867((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_869(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_868((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_870(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_869((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_871(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_870((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_872(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_871((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_873(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_872((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_874(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_873((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_875(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_874((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_876(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_875((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_877(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_876((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_878(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_877((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_879(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_878((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_880(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_879((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_881(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_880((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_882(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_881((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_883(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_882((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_884(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_883((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_885(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_884((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_886(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_885((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_887(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_886((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_888(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_887((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_889(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_888((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_890(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_889((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_891(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_890((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_892(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_891((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_893(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_892((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_894(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_893((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_895(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_894((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_896(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_895((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_897(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_896((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_898(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_897((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_899(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_898((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_900(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_899((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_901(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_900((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_902(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_901((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_903(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_902((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_904(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_903((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_905(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_904((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_906(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_905((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_907(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_906((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_908(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_907((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_909(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_908((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_910(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_909((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_911(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_910((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_912(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_911((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_913(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_912((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_914(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_913((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_915(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_914((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_916(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_915((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_917(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_916((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_918(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_917((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_919(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_918((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_920(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_919((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_921(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_920((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_922(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_921((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_923(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_922((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_924(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_923((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_925(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_924((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_926(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_925((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_927(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_926((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_928(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_927((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_929(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_928((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_930(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_929((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_931(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_930((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_932(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_931((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_933(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_932((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_934(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_933((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_935(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_934((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_936(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_935((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_937(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_936((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_938(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_937((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_939(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_938((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_940(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_939((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_941(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_940((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_942(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_941((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_943(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_942((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_944(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_943((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_945(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_944((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_946(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_945((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_947(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_946((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_948(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_947((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_949(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_948((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_950(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_949((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_951(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_950((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_952(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_951((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_953(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_952((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_954(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_953((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_955(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_954((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_956(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_955((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_957(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_956((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_958(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_957((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_959(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_958((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_960(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_959((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_961(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_960((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_962(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_961((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_963(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_962((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_964(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_963((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_965(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_964((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_966(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_965((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_967(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_966((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_968(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_967((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_969(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_968((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_970(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_969((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_971(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_970((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_972(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_971((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_973(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_972((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_974(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_973((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_975(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_974((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_976(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_975((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_977(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_976((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_978(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_977((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_979(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_978((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_980(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_979((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_981(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_980((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_982(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_981((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_983(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_982((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_984(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_983((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_985(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_984((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_986(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_985((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_987(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_986((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_988(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_987((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_989(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_988((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_990(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_989((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_991(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_990((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_992(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_991((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_993(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_992((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_994(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_993((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_995(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_994((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_996(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_995((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_997(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_996((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_998(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_997((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_999(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_998((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1000(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_999((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1001(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1000((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1002(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1001((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1003(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1002((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1004(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1003((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1005(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1004((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1006(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1005((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1007(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1006((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1008(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1007((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1009(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1008((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1010(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1009((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1011(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1010((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1012(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1011((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1013(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1012((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1014(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1013((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1015(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1014((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1016(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1015((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1017(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1016((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1018(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1017((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1019(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1018((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1020(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1019((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1021(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1020((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1022(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1021((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1023(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1022((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_1024(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1023((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+
+#endif // GMP_MACRO_LIMITS_TUPLE_1024_HPP_
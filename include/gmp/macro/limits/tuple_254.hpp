@@ -0,0 +1,519 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_TUPLE_254_HPP_
+#define GMP_MACRO_LIMITS_TUPLE_254_HPP_
+
+// GMP_TUPLE_ELEM
+#define _GMP_TUPLE_ELEM_0(x, ...) x
+#define _GMP_TUPLE_ELEM_1(_0, x, ...) x
+#define _GMP_TUPLE_ELEM_2(_0, _1, x, ...) x
+#define _GMP_TUPLE_ELEM_3(_0, _1, _2, x, ...) x
+#define _GMP_TUPLE_ELEM_4(_0, _1, _2, _3, x, ...) x
+#define _GMP_TUPLE_ELEM_5(_0, _1, _2, _3, _4, x, ...) x
+#define _GMP_TUPLE_ELEM_6(_0, _1, _2, _3, _4, _5, x, ...) x
+#define _GMP_TUPLE_ELEM_7(_0, _1, _2, _3, _4, _5, _6, x, ...) x
+#define _GMP_TUPLE_ELEM_8(_0, _1, _2, _3, _4, _5, _6, _7, x, ...) x
+#define _GMP_TUPLE_ELEM_9(_0, _1, _2, _3, _4, _5, _6, _7, _8, x, ...) x
+#define _GMP_TUPLE_ELEM_10(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, x, ...) x
+#define _GMP_TUPLE_ELEM_11(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, x, ...) x
+#define _GMP_TUPLE_ELEM_12(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, x, ...) x
+#define _GMP_TUPLE_ELEM_13(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, x, ...) x
+#define _GMP_TUPLE_ELEM_14(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, x, ...) x
+#define _GMP_TUPLE_ELEM_15(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, x, ...) x
+#define _GMP_TUPLE_ELEM_16(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_0(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_17(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_18(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_2(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_19(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_3(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_20(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_4(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_21(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_5(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_22(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_6(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_23(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_7(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_24(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_8(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_25(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_9(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_26(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_10(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_27(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_11(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_28(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_12(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_29(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_13(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_30(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_14(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_31(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_15(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_32(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_16(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_33(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_17(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_34(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_18(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_35(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_19(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_36(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_20(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_37(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_21(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_38(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_22(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_39(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_23(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_40(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_24(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_41(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_25(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_42(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_26(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_43(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_27(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_44(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_28(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_45(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_29(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_46(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_30(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_47(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_31(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_48(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_32(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_49(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_33(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_50(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_34(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_51(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_35(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_52(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_36(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_53(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_37(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_54(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_38(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_55(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_39(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_56(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_40(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_57(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_41(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_58(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_42(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_59(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_43(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_60(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_44(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_61(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_45(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_62(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_46(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_63(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_47(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_64(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_48(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_65(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_49(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_66(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_50(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_67(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_51(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_68(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_52(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_69(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_53(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_70(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_54(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_71(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_55(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_72(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_56(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_73(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_57(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_74(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_58(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_75(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_59(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_76(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_60(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_77(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_61(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_78(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_62(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_79(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_63(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_80(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_64(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_81(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_65(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_82(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_66(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_83(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_67(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_84(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_68(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_85(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_69(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_86(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_70(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_87(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_71(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_88(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_72(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_89(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_73(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_90(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_74(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_91(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_75(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_92(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_76(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_93(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_77(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_94(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_78(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_95(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_79(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_96(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_80(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_97(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_81(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_98(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_82(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_99(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_83(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_100(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_84(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_101(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_85(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_102(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_86(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_103(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_87(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_104(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_88(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_105(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_89(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_106(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_90(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_107(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_91(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_108(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_92(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_109(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_93(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_110(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_94(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_111(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_95(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_112(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_96(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_113(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_97(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_114(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_98(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_115(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_99(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_116(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_100(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_117(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_101(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_118(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_102(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_119(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_103(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_120(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_104(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_121(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_105(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_122(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_106(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_123(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_107(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_124(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_108(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_125(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_109(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_126(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_110(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_127(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_111(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_128(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_112(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_129(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_113(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_130(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_114(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_131(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_115(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_132(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_116(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_133(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_117(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_134(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_118(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_135(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_119(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_136(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_120(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_137(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_121(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_138(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_122(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_139(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_123(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_140(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_124(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_141(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_125(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_142(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_126(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_143(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_127(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_144(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_128(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_145(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_129(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_146(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_130(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_147(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_131(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_148(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_132(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_149(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_133(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_150(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_134(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_151(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_135(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_152(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_136(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_153(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_137(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_154(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_138(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_155(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_139(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_156(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_140(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_157(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_141(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_158(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_142(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_159(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_143(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_160(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_144(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_161(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_145(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_162(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_146(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_163(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_147(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_164(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_148(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_165(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_149(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_166(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_150(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_167(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_151(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_168(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_152(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_169(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_153(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_170(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_154(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_171(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_155(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_172(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_156(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_173(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_157(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_174(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_158(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_175(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_159(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_176(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_160(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_177(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_161(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_178(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_162(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_179(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_163(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_180(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_164(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_181(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_165(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_182(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_166(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_183(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_167(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_184(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_168(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_185(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_169(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_186(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_170(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_187(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_171(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_188(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_172(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_189(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_173(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_190(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_174(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_191(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_175(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_192(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_176(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_193(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_177(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_194(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_178(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_195(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_179(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_196(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_180(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_197(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_181(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_198(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_182(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_199(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_183(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_200(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_184(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_201(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_185(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_202(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_186(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_203(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_187(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_204(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_188(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_205(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_189(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_206(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_190(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_207(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_191(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_208(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_192(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_209(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_193(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_210(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_194(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_211(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_195(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_212(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_196(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_213(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_197(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_214(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_198(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_215(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_199(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_216(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_200(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_217(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_201(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_218(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_202(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_219(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_203(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_220(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_204(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_221(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_205(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_222(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_206(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_223(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_207(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_224(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_208(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_225(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_209(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_226(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_210(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_227(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_211(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_228(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_212(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_229(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_213(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_230(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_214(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_231(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_215(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_232(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_216(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_233(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_217(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_234(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_218(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_235(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_219(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_236(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_220(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_237(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_221(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_238(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_222(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_239(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_223(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_240(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_224(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_241(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_225(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_242(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_226(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_243(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_227(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_244(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_228(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_245(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_229(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_246(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_230(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_247(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_231(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_248(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_232(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_249(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_233(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_250(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_234(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_251(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_235(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_252(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_236(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_253(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_237(__VA_ARGS__)
+
+// GMP_ZIP
+#define _GMP_ZIP_0(rhs, ...)
+#define _GMP_ZIP_1(rhs, x) (x, _GMP_TUPLE_ELEM_0 rhs)
+#define _GMP_ZIP_2(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_3(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_2((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_4(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_3((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_5(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_4((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_6(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_5((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_7(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_6((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_8(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_7((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_9(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_8((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_10(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_9((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_11(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_10((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_12(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_11((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_13(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_12((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_14(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_13((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_15(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_14((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_16(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_15((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_17(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_16((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_18(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_17((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_19(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_18((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_20(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_19((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_21(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_20((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_22(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_21((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_23(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_22((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_24(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_23((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_25(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_24((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_26(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_25((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_27(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_26((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_28(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_27((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_29(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_28((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_30(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_29((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_31(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_30((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_32(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_31((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_33(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_32((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_34(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_33((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_35(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_34((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_36(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_35((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_37(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_36((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_38(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_37((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_39(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_38((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_40(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_39((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_41(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_40((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_42(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_41((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_43(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_42((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_44(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_43((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_45(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_44((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_46(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_45((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_47(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_46((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_48(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_47((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_49(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_48((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_50(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_49((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_51(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_50((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_52(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_51((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_53(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_52((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_54(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_53((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_55(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_54((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_56(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_55((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_57(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_56((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_58(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_57((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_59(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_58((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_60(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_59((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_61(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_60((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_62(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_61((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_63(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_62((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_64(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_63((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_65(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_64((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_66(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_65((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_67(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_66((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_68(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_67((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_69(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_68((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_70(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_69((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_71(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_70((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_72(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_71((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_73(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_72((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_74(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_73((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_75(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_74((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_76(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_75((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_77(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_76((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_78(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_77((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_79(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_78((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_80(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_79((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_81(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_80((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_82(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_81((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_83(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_82((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_84(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_83((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_85(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_84((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_86(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_85((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_87(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_86((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_88(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_87((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_89(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_88((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_90(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_89((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_91(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_90((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_92(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_91((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_93(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_92((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_94(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_93((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_95(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_94((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_96(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_95((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_97(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_96((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_98(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_97((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_99(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_98((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_100(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_99((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_101(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_100((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_102(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_101((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_103(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_102((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_104(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_103((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_105(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_104((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_106(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_105((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_107(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_106((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_108(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_107((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_109(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_108((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_110(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_109((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_111(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_110((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_112(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_111((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_113(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_112((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_114(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_113((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_115(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_114((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_116(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_115((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_117(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_116((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_118(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_117((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_119(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_118((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_120(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_119((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_121(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_120((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_122(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_121((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_123(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_122((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_124(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_123((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_125(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_124((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_126(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_125((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_127(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_126((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_128(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_127((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_129(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_128((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_130(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_129((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_131(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_130((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_132(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_131((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_133(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_132((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_134(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_133((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_135(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_134((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_136(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_135((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_137(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_136((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_138(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_137((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_139(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_138((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_140(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_139((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_141(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_140((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_142(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_141((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_143(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_142((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_144(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_143((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_145(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_144((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_146(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_145((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_147(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_146((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_148(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_147((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_149(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_148((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_150(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_149((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_151(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_150((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_152(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_151((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_153(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_152((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_154(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_153((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_155(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_154((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_156(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_155((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_157(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_156((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_158(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_157((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_159(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_158((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_160(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_159((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_161(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_160((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_162(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_161((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_163(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_162((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_164(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_163((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_165(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_164((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_166(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_165((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_167(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_166((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_168(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_167((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_169(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_168((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_170(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_169((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_171(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_170((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_172(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_171((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_173(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_172((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_174(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_173((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_175(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_174((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_176(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_175((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_177(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_176((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_178(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_177((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_179(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_178((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_180(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_179((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_181(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_180((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_182(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_181((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_183(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_182((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_184(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_183((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_185(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_184((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_186(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_185((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_187(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_186((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_188(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_187((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_189(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_188((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_190(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_189((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_191(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_190((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_192(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_191((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_193(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_192((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_194(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_193((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_195(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_194((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_196(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_195((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_197(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_196((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_198(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_197((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_199(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_198((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_200(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_199((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_201(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_200((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_202(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_201((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_203(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_202((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_204(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_203((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_205(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_204((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_206(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_205((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_207(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_206((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_208(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_207((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_209(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_208((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_210(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_209((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_211(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_210((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_212(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_211((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_213(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_212((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_214(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_213((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_215(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_214((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_216(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_215((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_217(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_216((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_218(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_217((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_219(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_218((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_220(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_219((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_221(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_220((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_222(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_221((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_223(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_222((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_224(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_223((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_225(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_224((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_226(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_225((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_227(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_226((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_228(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_227((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_229(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_228((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_230(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_229((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_231(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_230((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_232(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_231((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_233(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_232((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_234(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_233((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_235(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_234((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_236(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_235((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_237(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_236((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_238(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_237((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_239(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_238((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_240(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_239((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_241(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_240((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_242(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_241((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_243(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_242((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_244(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_243((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_245(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_244((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_246(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_245((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_247(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_246((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_248(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_247((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_249(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_248((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_250(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_249((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_251(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_250((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_252(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_251((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_253(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_252((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_254(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_253((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+
+#endif // GMP_MACRO_LIMITS_TUPLE_254_HPP_
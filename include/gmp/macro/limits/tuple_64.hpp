@@ -0,0 +1,139 @@
+// Generated by tools/generate_macro_tables.py, do not edit.
+
+#ifndef GMP_MACRO_LIMITS_TUPLE_64_HPP_
+#define GMP_MACRO_LIMITS_TUPLE_64_HPP_
+
+// GMP_TUPLE_ELEM
+#define _GMP_TUPLE_ELEM_0(x, ...) x
+#define _GMP_TUPLE_ELEM_1(_0, x, ...) x
+#define _GMP_TUPLE_ELEM_2(_0, _1, x, ...) x
+#define _GMP_TUPLE_ELEM_3(_0, _1, _2, x, ...) x
+#define _GMP_TUPLE_ELEM_4(_0, _1, _2, _3, x, ...) x
+#define _GMP_TUPLE_ELEM_5(_0, _1, _2, _3, _4, x, ...) x
+#define _GMP_TUPLE_ELEM_6(_0, _1, _2, _3, _4, _5, x, ...) x
+#define _GMP_TUPLE_ELEM_7(_0, _1, _2, _3, _4, _5, _6, x, ...) x
+#define _GMP_TUPLE_ELEM_8(_0, _1, _2, _3, _4, _5, _6, _7, x, ...) x
+#define _GMP_TUPLE_ELEM_9(_0, _1, _2, _3, _4, _5, _6, _7, _8, x, ...) x
+#define _GMP_TUPLE_ELEM_10(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, x, ...) x
+#define _GMP_TUPLE_ELEM_11(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, x, ...) x
+#define _GMP_TUPLE_ELEM_12(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, x, ...) x
+#define _GMP_TUPLE_ELEM_13(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, x, ...) x
+#define _GMP_TUPLE_ELEM_14(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, x, ...) x
+#define _GMP_TUPLE_ELEM_15(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, x, ...) x
+#define _GMP_TUPLE_ELEM_16(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_0(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_17(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_1(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_18(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_2(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_19(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_3(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_20(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_4(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_21(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_5(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_22(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_6(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_23(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_7(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_24(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_8(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_25(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_9(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_26(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_10(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_27(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_11(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_28(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_12(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_29(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_13(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_30(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_14(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_31(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_15(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_32(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_16(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_33(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_17(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_34(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_18(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_35(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_19(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_36(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_20(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_37(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_21(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_38(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_22(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_39(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_23(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_40(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_24(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_41(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_25(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_42(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_26(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_43(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_27(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_44(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_28(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_45(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_29(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_46(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_30(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_47(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_31(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_48(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_32(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_49(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_33(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_50(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_34(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_51(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_35(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_52(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_36(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_53(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_37(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_54(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_38(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_55(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_39(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_56(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_40(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_57(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_41(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_58(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_42(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_59(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_43(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_60(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_44(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_61(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_45(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_62(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_46(__VA_ARGS__)
+#define _GMP_TUPLE_ELEM_63(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, ...) _GMP_TUPLE_ELEM_47(__VA_ARGS__)
+
+// GMP_ZIP
+#define _GMP_ZIP_0(rhs, ...)
+#define _GMP_ZIP_1(rhs, x) (x, _GMP_TUPLE_ELEM_0 rhs)
+#define _GMP_ZIP_2(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_1((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_3(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_2((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_4(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_3((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_5(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_4((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_6(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_5((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_7(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_6((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_8(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_7((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_9(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_8((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_10(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_9((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_11(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_10((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_12(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_11((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_13(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_12((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_14(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_13((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_15(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_14((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_16(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_15((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_17(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_16((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_18(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_17((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_19(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_18((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_20(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_19((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_21(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_20((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_22(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_21((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_23(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_22((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_24(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_23((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_25(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_24((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_26(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_25((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_27(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_26((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_28(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_27((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_29(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_28((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_30(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_29((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_31(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_30((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_32(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_31((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_33(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_32((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_34(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_33((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_35(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_34((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_36(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_35((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_37(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_36((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_38(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_37((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_39(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_38((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_40(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_39((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_41(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_40((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_42(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_41((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_43(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_42((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_44(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_43((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_45(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_44((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_46(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_45((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_47(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_46((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_48(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_47((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_49(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_48((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_50(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_49((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_51(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_50((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_52(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_51((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_53(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_52((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_54(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_53((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_55(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_54((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_56(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_55((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_57(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_56((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_58(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_57((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_59(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_58((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_60(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_59((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_61(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_60((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_62(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_61((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_63(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_62((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+#define _GMP_ZIP_64(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), GMP_EXPAND( _GMP_ZIP_63((_GMP_TUPLE_REST rhs), __VA_ARGS__) )
+
+#endif // GMP_MACRO_LIMITS_TUPLE_64_HPP_
@@ -0,0 +1,96 @@
+/**
+ * \file loop.hpp
+ * \brief Counted repetition, index sequences and bounded evaluation.
+ */
+#ifndef GMP_MACRO_LOOP_HPP_
+#define GMP_MACRO_LOOP_HPP_
+
+#include <gmp/macro/arith.hpp>
+#include _GMP_LIMIT_LOOP_TABLES
+
+
+/**
+ * \def GMP_EVAL_BOUNDED(count, ...)
+ * \brief Evaluate a deferred recursion of at most \a count steps.
+ *
+ * \ref GMP_EVAL always rescans its argument a few hundred times, which is
+ * what dominates the cost of short loops. This macro picks the smallest
+ * GMP_EVAL_N level that still performs \a count steps of recursion:
+ * GMP_EVAL_5 up to 2 steps, GMP_EVAL_4 up to 5, GMP_EVAL_3 up to 14,
+ * GMP_EVAL_2 up to 41, GMP_EVAL_1 up to 122 and \ref GMP_EVAL up to 365.
+ * With a larger \ref GMP_MAX_INDEX, three nested GMP_EVAL cover the rest.
+ *
+ * \param count The number of recursion steps, at most \ref GMP_MAX_INDEX.
+ * \param ... The expression to be evaluated.
+ */
+#define GMP_EVAL_BOUNDED(count, ...) GMP_CONCAT(_GMP_EVAL_BOUNDED_, count)(__VA_ARGS__)
+
+/**
+ * \brief Macro to generate a sequence of numbers from \a begin to \a end.
+ *
+ * This macro generates a sequence of numbers starting from \a begin and ending at \a end.
+ * The value of \a end should not exceed \ref GMP_MAX_INT.
+ *
+ * \param begin The starting number of the sequence.
+ * \param end The ending number of the sequence. Must be less than or equal to \ref GMP_MAX_INT.
+ * \return A sequence of numbers from \a begin to \a end.
+ *
+ * \note The \a end value should not be greater than \ref GMP_MAX_INT.
+ */
+#define GMP_RANGE(begin, end) GMP_OVERLOAD_INVOKE1(_GMP_RANGE_PRECHECK, GMP_CHECK_INDEX_BOOL(end))(begin, end)
+#define _GMP_RANGE_PRECHECK_1(begin, end) GMP_IIF(GMP_BOOL(end), _GMP_RANGE_IMPL, _GMP_RANGE_EMPTY)(begin, GMP_CONCAT(_GMP_DEC_, end)())
+#define _GMP_RANGE_PRECHECK_0(begin, end) GMP_CHECK_INDEX(end)
+// The sequence 0, ..., end-1 is taken from the index sequence table and
+// its first begin numbers are dropped, without any per-number arithmetic.
+#define _GMP_RANGE_IMPL(begin, last) _GMP_RANGE_DROP(begin, GMP_CONCAT(_GMP_MAKE_INDEX_SEQUENCE_, last)())
+#define _GMP_RANGE_DROP(begin, ...) GMP_CONCAT(_GMP_DROP_, begin)(__VA_ARGS__)
+#define _GMP_RANGE_EMPTY(begin, last)
+
+
+/**
+ * \brief Macro to loop a function call a specified number of times.
+ *
+ * This macro executes the function call \a call for \a count iterations.
+ * The arguments for the function call are provided by __VA_ARGS__.
+ *
+ * \param call The function or macro to be called in each iteration.
+ * \param count The number of times the function call should be executed.
+ * \param ... Additional arguments passed to each invocation of \a call.
+ * 
+ * \note The \a count value should not be greater than \ref GMP_MAX_INT.
+ * 
+ * \par Example
+ * \code {.c}
+ * void bar(int arg1, const char* arg2) {
+ *     printf("bar %d, %s\n", arg1, arg2);
+ * }
+ * 
+ * #define Bar(arg1, arg2) bar(arg1, arg2); 
+ * GMP_LOOP(Bar, 254, 1, "arg2") // Execute bar function 254 times
+ * \endcode
+ * 
+ */
+#define GMP_LOOP(call, count, ...) GMP_OVERLOAD_INVOKE1(_GMP_LOOP_PRECHECK, GMP_CHECK_INDEX_BOOL(count))(call, count, __VA_ARGS__)
+#define _GMP_LOOP_PRECHECK_1(call, count, ...) GMP_CONCAT(_GMP_LOOP_, count)(call, __VA_ARGS__)
+#define _GMP_LOOP_PRECHECK_0(call, count, ...) GMP_CHECK_INDEX(count)
+
+/**
+ * \def GMP_MAKE_INDEX_SEQUENCE(index)
+ * \brief Generates a comma-separated index sequence up to a given index.
+ * 
+ * This macro uses overload invocation and recursive macro expansion
+ * to generate a comma-separated sequence of indices from 0 up to, but excluding, the specified index.
+ * 
+ * \param index The number of indices in the sequence.
+ * \return The comma-separated indices 0, ..., index - 1; nothing if \a index
+ *         is zero.
+ */
+#define GMP_MAKE_INDEX_SEQUENCE(index) GMP_OVERLOAD_INVOKE1(_GMP_MAKE_INDEX_SEQUENCE_PRECHECK, GMP_CHECK_INDEX_BOOL(index))(index)
+#define _GMP_MAKE_INDEX_SEQUENCE_PRECHECK_1(index) \
+    GMP_IIF(GMP_BOOL(index), _GMP_MAKE_INDEX_SEQUENCE_IMPL, _GMP_MAKE_INDEX_SEQUENCE_EMPTY)(index)
+#define _GMP_MAKE_INDEX_SEQUENCE_PRECHECK_0(index) GMP_CHECK_INDEX(index)
+#define _GMP_MAKE_INDEX_SEQUENCE_IMPL(index) GMP_OVERLOAD_INVOKE1(_GMP_MAKE_INDEX_SEQUENCE, GMP_DEC(index))()
+#define _GMP_MAKE_INDEX_SEQUENCE_EMPTY(index)
+
+
+#endif // GMP_MACRO_LOOP_HPP_
@@ -0,0 +1,66 @@
+/**
+ * \file loop_nested.hpp
+ * \brief The loops of loop.hpp and repeat.hpp, for use inside one another.
+ *
+ * Every depth adds as many tables as the plain loops, so they are kept out
+ * of loop.hpp and repeat.hpp and have to be included on their own.
+ */
+#ifndef GMP_MACRO_LOOP_NESTED_HPP_
+#define GMP_MACRO_LOOP_NESTED_HPP_
+
+#include <gmp/macro/repeat.hpp>
+#include _GMP_LIMIT_LOOP_NESTED_TABLES
+
+
+/**
+ * \def GMP_LOOP_2(call, count, ...)
+ * \brief Nested loops.
+ *
+ * A macro cannot expand inside its own expansion, so the body of a
+ * \ref GMP_LOOP, \ref GMP_REPEAT or \ref GMP_REPEAT_FROM cannot use the same
+ * macro again. The `_2` variants may be used in the body of the plain ones,
+ * and the `_3` variants in the body of the `_2` ones; each depth has its own
+ * tables, so a nested loop costs no more than the calls it expands to.
+ *
+ * \par Example
+ * \code
+ * #define CELL(j, i) acc##i##j += a[i] * b[j];
+ * #define ROW(i, cols) GMP_REPEAT_2(cols, CELL, i)
+ * GMP_REPEAT(4, ROW, 4) // acc00 += a[0] * b[0]; ... acc33 += a[3] * b[3];
+ * \endcode
+ */
+#define GMP_LOOP_2(call, count, ...) GMP_OVERLOAD_INVOKE1(_GMP_LOOP_2_PRECHECK, GMP_CHECK_INDEX_BOOL(count))(call, count, __VA_ARGS__)
+#define _GMP_LOOP_2_PRECHECK_1(call, count, ...) GMP_CONCAT(_GMP_LOOP_L2_, count)(call, __VA_ARGS__)
+#define _GMP_LOOP_2_PRECHECK_0(call, count, ...) GMP_CHECK_INDEX(count)
+#define GMP_LOOP_3(call, count, ...) GMP_OVERLOAD_INVOKE1(_GMP_LOOP_3_PRECHECK, GMP_CHECK_INDEX_BOOL(count))(call, count, __VA_ARGS__)
+#define _GMP_LOOP_3_PRECHECK_1(call, count, ...) GMP_CONCAT(_GMP_LOOP_L3_, count)(call, __VA_ARGS__)
+#define _GMP_LOOP_3_PRECHECK_0(call, count, ...) GMP_CHECK_INDEX(count)
+
+/// \def GMP_REPEAT_2(count, call, data) \ref GMP_REPEAT nested in a \ref GMP_REPEAT, see \ref GMP_LOOP_2.
+#define GMP_REPEAT_2(count, call, data) GMP_OVERLOAD_INVOKE1(_GMP_REPEAT_2_PRECHECK, GMP_CHECK_INDEX_BOOL(count))(count, call, data)
+#define _GMP_REPEAT_2_PRECHECK_1(count, call, data) GMP_CONCAT(_GMP_REPEAT_L2_, count)(call, data)
+#define _GMP_REPEAT_2_PRECHECK_0(count, call, data) GMP_CHECK_INDEX(count)
+#define GMP_REPEAT_3(count, call, data) GMP_OVERLOAD_INVOKE1(_GMP_REPEAT_3_PRECHECK, GMP_CHECK_INDEX_BOOL(count))(count, call, data)
+#define _GMP_REPEAT_3_PRECHECK_1(count, call, data) GMP_CONCAT(_GMP_REPEAT_L3_, count)(call, data)
+#define _GMP_REPEAT_3_PRECHECK_0(count, call, data) GMP_CHECK_INDEX(count)
+
+/// \def GMP_REPEAT_FROM_2(begin, end, call, data) \ref GMP_REPEAT_FROM nested in a loop, see \ref GMP_LOOP_2.
+#define GMP_REPEAT_FROM_2(begin, end, call, data) GMP_OVERLOAD_INVOKE2(_GMP_REPEAT_FROM_2_PRECHECK, \
+    GMP_CHECK_INDEX_BOOL(begin), GMP_CHECK_INDEX_BOOL(end))(begin, end, call, data)
+#define _GMP_REPEAT_FROM_2_PRECHECK_1_1(begin, end, call, data) \
+    _GMP_REPEAT_FROM_2_IMPL(begin, GMP_SIZE_OF_VAARGS(GMP_RANGE(begin, end)), call, data)
+#define _GMP_REPEAT_FROM_2_PRECHECK_0_1(begin, end, call, data) GMP_CHECK_INDEX(begin)
+#define _GMP_REPEAT_FROM_2_PRECHECK_1_0(begin, end, call, data) GMP_CHECK_INDEX(end)
+#define _GMP_REPEAT_FROM_2_PRECHECK_0_0(begin, end, call, data) GMP_CHECK_INDEX(begin)
+#define _GMP_REPEAT_FROM_2_IMPL(begin, count, call, data) GMP_CONCAT(_GMP_REPEAT_FROM_L2_, count)(call, data, begin)
+#define GMP_REPEAT_FROM_3(begin, end, call, data) GMP_OVERLOAD_INVOKE2(_GMP_REPEAT_FROM_3_PRECHECK, \
+    GMP_CHECK_INDEX_BOOL(begin), GMP_CHECK_INDEX_BOOL(end))(begin, end, call, data)
+#define _GMP_REPEAT_FROM_3_PRECHECK_1_1(begin, end, call, data) \
+    _GMP_REPEAT_FROM_3_IMPL(begin, GMP_SIZE_OF_VAARGS(GMP_RANGE(begin, end)), call, data)
+#define _GMP_REPEAT_FROM_3_PRECHECK_0_1(begin, end, call, data) GMP_CHECK_INDEX(begin)
+#define _GMP_REPEAT_FROM_3_PRECHECK_1_0(begin, end, call, data) GMP_CHECK_INDEX(end)
+#define _GMP_REPEAT_FROM_3_PRECHECK_0_0(begin, end, call, data) GMP_CHECK_INDEX(begin)
+#define _GMP_REPEAT_FROM_3_IMPL(begin, count, call, data) GMP_CONCAT(_GMP_REPEAT_FROM_L3_, count)(call, data, begin)
+
+
+#endif // GMP_MACRO_LOOP_NESTED_HPP_
@@ -0,0 +1,1292 @@
+/**
+ * \file number.hpp
+ * \brief Preprocessor integers beyond \ref GMP_MAX_INDEX.
+ *
+ * A number is a tuple of four decimal digits, most significant first:
+ * `(0, 1, 0, 2)` stands for 102. Every operation works one digit at a time
+ * through tables indexed by digits, so the range [0, \ref GMP_MAX_NUMBER]
+ * costs no more to support than [0, 9], while the \ref GMP_INC family needs
+ * one definition per value. No operation iterates: each one takes a bounded
+ * number of expansion steps whatever its operands.
+ *
+ * This header is not part of gmp/macro/macro.hpp or gmp/gmp.hpp, since few
+ * translation units need arithmetic beyond \ref GMP_INC and \ref GMP_DEC;
+ * include it where these macros are used.
+ */
+#ifndef GMP_MACRO_NUMBER_HPP_
+#define GMP_MACRO_NUMBER_HPP_
+
+#include <gmp/macro/arith.hpp>
+#include _GMP_LIMIT_NUMBER_TABLES
+
+
+/**
+ * \def GMP_MAX_NUMBER
+ * \brief The largest value a number can hold.
+ *
+ * The GMP_NUMBER_* operations are performed modulo GMP_MAX_NUMBER + 1. The
+ * operations on literals, such as \ref GMP_SUB, report results out of range
+ * instead.
+ */
+#define GMP_MAX_NUMBER 9999
+
+
+/**
+ * \def GMP_NUMBER(...)
+ * \brief Make a number from one to four decimal digits.
+ *
+ * \par Example
+ * \code
+ * GMP_NUMBER(7)          // (0, 0, 0, 7)
+ * GMP_NUMBER(1, 0, 2, 4) // (1, 0, 2, 4)
+ * \endcode
+ */
+#define GMP_NUMBER(...) GMP_OVERLOAD_INVOKE1(_GMP_NUMBER, GMP_SIZE_OF_VAARGS(__VA_ARGS__))(__VA_ARGS__)
+#define _GMP_NUMBER_1(d) (0, 0, 0, d)
+#define _GMP_NUMBER_2(c, d) (0, 0, c, d)
+#define _GMP_NUMBER_3(b, c, d) (0, b, c, d)
+#define _GMP_NUMBER_4(a, b, c, d) (a, b, c, d)
+#define _GMP_NUMBER_UNPACK(...) __VA_ARGS__
+
+
+/**
+ * \def GMP_NUMBER_FROM_INT(value)
+ * \brief Convert a value in [0, GMP_MAX_INDEX] to a number.
+ *
+ * \code
+ * GMP_NUMBER_FROM_INT(GMP_SIZE_OF_VAARGS(a, b, c)) // (0, 0, 0, 3)
+ * \endcode
+ */
+#define GMP_NUMBER_FROM_INT(value) GMP_CONCAT(_GMP_NUMBER_FROM_INT_, value)
+
+
+/**
+ * \def GMP_NUMBER_INC(n)
+ * \brief Increment a number by 1.
+ *
+ * \code
+ * GMP_NUMBER_INC((0, 2, 9, 9)) // (0, 3, 0, 0)
+ * \endcode
+ */
+#define GMP_NUMBER_INC(n) _GMP_NUMBER_INC n
+#define _GMP_NUMBER_INC(a, b, c, d) _GMP_NUMBER_INC_4_ ## d(a, b, c)
+#define _GMP_NUMBER_INC_4_0(a, b, c) (a, b, c, 1)
+#define _GMP_NUMBER_INC_4_1(a, b, c) (a, b, c, 2)
+#define _GMP_NUMBER_INC_4_2(a, b, c) (a, b, c, 3)
+#define _GMP_NUMBER_INC_4_3(a, b, c) (a, b, c, 4)
+#define _GMP_NUMBER_INC_4_4(a, b, c) (a, b, c, 5)
+#define _GMP_NUMBER_INC_4_5(a, b, c) (a, b, c, 6)
+#define _GMP_NUMBER_INC_4_6(a, b, c) (a, b, c, 7)
+#define _GMP_NUMBER_INC_4_7(a, b, c) (a, b, c, 8)
+#define _GMP_NUMBER_INC_4_8(a, b, c) (a, b, c, 9)
+#define _GMP_NUMBER_INC_4_9(a, b, c) _GMP_NUMBER_INC_3_ ## c(a, b)
+#define _GMP_NUMBER_INC_3_0(a, b) (a, b, 1, 0)
+#define _GMP_NUMBER_INC_3_1(a, b) (a, b, 2, 0)
+#define _GMP_NUMBER_INC_3_2(a, b) (a, b, 3, 0)
+#define _GMP_NUMBER_INC_3_3(a, b) (a, b, 4, 0)
+#define _GMP_NUMBER_INC_3_4(a, b) (a, b, 5, 0)
+#define _GMP_NUMBER_INC_3_5(a, b) (a, b, 6, 0)
+#define _GMP_NUMBER_INC_3_6(a, b) (a, b, 7, 0)
+#define _GMP_NUMBER_INC_3_7(a, b) (a, b, 8, 0)
+#define _GMP_NUMBER_INC_3_8(a, b) (a, b, 9, 0)
+#define _GMP_NUMBER_INC_3_9(a, b) _GMP_NUMBER_INC_2_ ## b(a)
+#define _GMP_NUMBER_INC_2_0(a) (a, 1, 0, 0)
+#define _GMP_NUMBER_INC_2_1(a) (a, 2, 0, 0)
+#define _GMP_NUMBER_INC_2_2(a) (a, 3, 0, 0)
+#define _GMP_NUMBER_INC_2_3(a) (a, 4, 0, 0)
+#define _GMP_NUMBER_INC_2_4(a) (a, 5, 0, 0)
+#define _GMP_NUMBER_INC_2_5(a) (a, 6, 0, 0)
+#define _GMP_NUMBER_INC_2_6(a) (a, 7, 0, 0)
+#define _GMP_NUMBER_INC_2_7(a) (a, 8, 0, 0)
+#define _GMP_NUMBER_INC_2_8(a) (a, 9, 0, 0)
+#define _GMP_NUMBER_INC_2_9(a) _GMP_NUMBER_INC_1_ ## a()
+#define _GMP_NUMBER_INC_1_0() (1, 0, 0, 0)
+#define _GMP_NUMBER_INC_1_1() (2, 0, 0, 0)
+#define _GMP_NUMBER_INC_1_2() (3, 0, 0, 0)
+#define _GMP_NUMBER_INC_1_3() (4, 0, 0, 0)
+#define _GMP_NUMBER_INC_1_4() (5, 0, 0, 0)
+#define _GMP_NUMBER_INC_1_5() (6, 0, 0, 0)
+#define _GMP_NUMBER_INC_1_6() (7, 0, 0, 0)
+#define _GMP_NUMBER_INC_1_7() (8, 0, 0, 0)
+#define _GMP_NUMBER_INC_1_8() (9, 0, 0, 0)
+#define _GMP_NUMBER_INC_1_9() (0, 0, 0, 0)
+
+
+/**
+ * \def GMP_NUMBER_DEC(n)
+ * \brief Decrement a number by 1.
+ *
+ * \code
+ * GMP_NUMBER_DEC((0, 3, 0, 0)) // (0, 2, 9, 9)
+ * \endcode
+ */
+#define GMP_NUMBER_DEC(n) _GMP_NUMBER_DEC n
+#define _GMP_NUMBER_DEC(a, b, c, d) _GMP_NUMBER_DEC_4_ ## d(a, b, c)
+#define _GMP_NUMBER_DEC_4_0(a, b, c) _GMP_NUMBER_DEC_3_ ## c(a, b)
+#define _GMP_NUMBER_DEC_4_1(a, b, c) (a, b, c, 0)
+#define _GMP_NUMBER_DEC_4_2(a, b, c) (a, b, c, 1)
+#define _GMP_NUMBER_DEC_4_3(a, b, c) (a, b, c, 2)
+#define _GMP_NUMBER_DEC_4_4(a, b, c) (a, b, c, 3)
+#define _GMP_NUMBER_DEC_4_5(a, b, c) (a, b, c, 4)
+#define _GMP_NUMBER_DEC_4_6(a, b, c) (a, b, c, 5)
+#define _GMP_NUMBER_DEC_4_7(a, b, c) (a, b, c, 6)
+#define _GMP_NUMBER_DEC_4_8(a, b, c) (a, b, c, 7)
+#define _GMP_NUMBER_DEC_4_9(a, b, c) (a, b, c, 8)
+#define _GMP_NUMBER_DEC_3_0(a, b) _GMP_NUMBER_DEC_2_ ## b(a)
+#define _GMP_NUMBER_DEC_3_1(a, b) (a, b, 0, 9)
+#define _GMP_NUMBER_DEC_3_2(a, b) (a, b, 1, 9)
+#define _GMP_NUMBER_DEC_3_3(a, b) (a, b, 2, 9)
+#define _GMP_NUMBER_DEC_3_4(a, b) (a, b, 3, 9)
+#define _GMP_NUMBER_DEC_3_5(a, b) (a, b, 4, 9)
+#define _GMP_NUMBER_DEC_3_6(a, b) (a, b, 5, 9)
+#define _GMP_NUMBER_DEC_3_7(a, b) (a, b, 6, 9)
+#define _GMP_NUMBER_DEC_3_8(a, b) (a, b, 7, 9)
+#define _GMP_NUMBER_DEC_3_9(a, b) (a, b, 8, 9)
+#define _GMP_NUMBER_DEC_2_0(a) _GMP_NUMBER_DEC_1_ ## a()
+#define _GMP_NUMBER_DEC_2_1(a) (a, 0, 9, 9)
+#define _GMP_NUMBER_DEC_2_2(a) (a, 1, 9, 9)
+#define _GMP_NUMBER_DEC_2_3(a) (a, 2, 9, 9)
+#define _GMP_NUMBER_DEC_2_4(a) (a, 3, 9, 9)
+#define _GMP_NUMBER_DEC_2_5(a) (a, 4, 9, 9)
+#define _GMP_NUMBER_DEC_2_6(a) (a, 5, 9, 9)
+#define _GMP_NUMBER_DEC_2_7(a) (a, 6, 9, 9)
+#define _GMP_NUMBER_DEC_2_8(a) (a, 7, 9, 9)
+#define _GMP_NUMBER_DEC_2_9(a) (a, 8, 9, 9)
+#define _GMP_NUMBER_DEC_1_0() (9, 9, 9, 9)
+#define _GMP_NUMBER_DEC_1_1() (0, 9, 9, 9)
+#define _GMP_NUMBER_DEC_1_2() (1, 9, 9, 9)
+#define _GMP_NUMBER_DEC_1_3() (2, 9, 9, 9)
+#define _GMP_NUMBER_DEC_1_4() (3, 9, 9, 9)
+#define _GMP_NUMBER_DEC_1_5() (4, 9, 9, 9)
+#define _GMP_NUMBER_DEC_1_6() (5, 9, 9, 9)
+#define _GMP_NUMBER_DEC_1_7() (6, 9, 9, 9)
+#define _GMP_NUMBER_DEC_1_8() (7, 9, 9, 9)
+#define _GMP_NUMBER_DEC_1_9() (8, 9, 9, 9)
+
+
+/**
+ * \def GMP_NUMBER_COMPARE(x, y)
+ * \brief Three-way comparison of two numbers.
+ *
+ * \return \a L if \a x is less than \a y, \a E if they are equal and \a G otherwise.
+ */
+#define GMP_NUMBER_COMPARE(x, y) _GMP_NUMBER_COMPARE(_GMP_NUMBER_UNPACK x, _GMP_NUMBER_UNPACK y)
+#define _GMP_NUMBER_COMPARE(...) _GMP_NUMBER_COMPARE_IMPL(__VA_ARGS__)
+#define _GMP_NUMBER_COMPARE_IMPL(a0, b0, c0, d0, a1, b1, c1, d1) \
+    _GMP_NUMBER_ORDER(_GMP_DIGIT_COMPARE_ ## a0 ## _ ## a1, _GMP_DIGIT_COMPARE_ ## b0 ## _ ## b1, \
+                      _GMP_DIGIT_COMPARE_ ## c0 ## _ ## c1, _GMP_DIGIT_COMPARE_ ## d0 ## _ ## d1)
+#define _GMP_NUMBER_ORDER(a, b, c, d) GMP_CONCAT(_GMP_NUMBER_ORDER_4_, a)(b, c, d)
+#define _GMP_NUMBER_ORDER_4_L(b, c, d) L
+#define _GMP_NUMBER_ORDER_4_G(b, c, d) G
+#define _GMP_NUMBER_ORDER_4_E(b, c, d) _GMP_NUMBER_ORDER_3_ ## b(c, d)
+#define _GMP_NUMBER_ORDER_3_L(c, d) L
+#define _GMP_NUMBER_ORDER_3_G(c, d) G
+#define _GMP_NUMBER_ORDER_3_E(c, d) _GMP_NUMBER_ORDER_2_ ## c(d)
+#define _GMP_NUMBER_ORDER_2_L(d) L
+#define _GMP_NUMBER_ORDER_2_G(d) G
+#define _GMP_NUMBER_ORDER_2_E(d) d
+#define _GMP_DIGIT_COMPARE_0_0 E
+#define _GMP_DIGIT_COMPARE_0_1 L
+#define _GMP_DIGIT_COMPARE_0_2 L
+#define _GMP_DIGIT_COMPARE_0_3 L
+#define _GMP_DIGIT_COMPARE_0_4 L
+#define _GMP_DIGIT_COMPARE_0_5 L
+#define _GMP_DIGIT_COMPARE_0_6 L
+#define _GMP_DIGIT_COMPARE_0_7 L
+#define _GMP_DIGIT_COMPARE_0_8 L
+#define _GMP_DIGIT_COMPARE_0_9 L
+#define _GMP_DIGIT_COMPARE_1_0 G
+#define _GMP_DIGIT_COMPARE_1_1 E
+#define _GMP_DIGIT_COMPARE_1_2 L
+#define _GMP_DIGIT_COMPARE_1_3 L
+#define _GMP_DIGIT_COMPARE_1_4 L
+#define _GMP_DIGIT_COMPARE_1_5 L
+#define _GMP_DIGIT_COMPARE_1_6 L
+#define _GMP_DIGIT_COMPARE_1_7 L
+#define _GMP_DIGIT_COMPARE_1_8 L
+#define _GMP_DIGIT_COMPARE_1_9 L
+#define _GMP_DIGIT_COMPARE_2_0 G
+#define _GMP_DIGIT_COMPARE_2_1 G
+#define _GMP_DIGIT_COMPARE_2_2 E
+#define _GMP_DIGIT_COMPARE_2_3 L
+#define _GMP_DIGIT_COMPARE_2_4 L
+#define _GMP_DIGIT_COMPARE_2_5 L
+#define _GMP_DIGIT_COMPARE_2_6 L
+#define _GMP_DIGIT_COMPARE_2_7 L
+#define _GMP_DIGIT_COMPARE_2_8 L
+#define _GMP_DIGIT_COMPARE_2_9 L
+#define _GMP_DIGIT_COMPARE_3_0 G
+#define _GMP_DIGIT_COMPARE_3_1 G
+#define _GMP_DIGIT_COMPARE_3_2 G
+#define _GMP_DIGIT_COMPARE_3_3 E
+#define _GMP_DIGIT_COMPARE_3_4 L
+#define _GMP_DIGIT_COMPARE_3_5 L
+#define _GMP_DIGIT_COMPARE_3_6 L
+#define _GMP_DIGIT_COMPARE_3_7 L
+#define _GMP_DIGIT_COMPARE_3_8 L
+#define _GMP_DIGIT_COMPARE_3_9 L
+#define _GMP_DIGIT_COMPARE_4_0 G
+#define _GMP_DIGIT_COMPARE_4_1 G
+#define _GMP_DIGIT_COMPARE_4_2 G
+#define _GMP_DIGIT_COMPARE_4_3 G
+#define _GMP_DIGIT_COMPARE_4_4 E
+#define _GMP_DIGIT_COMPARE_4_5 L
+#define _GMP_DIGIT_COMPARE_4_6 L
+#define _GMP_DIGIT_COMPARE_4_7 L
+#define _GMP_DIGIT_COMPARE_4_8 L
+#define _GMP_DIGIT_COMPARE_4_9 L
+#define _GMP_DIGIT_COMPARE_5_0 G
+#define _GMP_DIGIT_COMPARE_5_1 G
+#define _GMP_DIGIT_COMPARE_5_2 G
+#define _GMP_DIGIT_COMPARE_5_3 G
+#define _GMP_DIGIT_COMPARE_5_4 G
+#define _GMP_DIGIT_COMPARE_5_5 E
+#define _GMP_DIGIT_COMPARE_5_6 L
+#define _GMP_DIGIT_COMPARE_5_7 L
+#define _GMP_DIGIT_COMPARE_5_8 L
+#define _GMP_DIGIT_COMPARE_5_9 L
+#define _GMP_DIGIT_COMPARE_6_0 G
+#define _GMP_DIGIT_COMPARE_6_1 G
+#define _GMP_DIGIT_COMPARE_6_2 G
+#define _GMP_DIGIT_COMPARE_6_3 G
+#define _GMP_DIGIT_COMPARE_6_4 G
+#define _GMP_DIGIT_COMPARE_6_5 G
+#define _GMP_DIGIT_COMPARE_6_6 E
+#define _GMP_DIGIT_COMPARE_6_7 L
+#define _GMP_DIGIT_COMPARE_6_8 L
+#define _GMP_DIGIT_COMPARE_6_9 L
+#define _GMP_DIGIT_COMPARE_7_0 G
+#define _GMP_DIGIT_COMPARE_7_1 G
+#define _GMP_DIGIT_COMPARE_7_2 G
+#define _GMP_DIGIT_COMPARE_7_3 G
+#define _GMP_DIGIT_COMPARE_7_4 G
+#define _GMP_DIGIT_COMPARE_7_5 G
+#define _GMP_DIGIT_COMPARE_7_6 G
+#define _GMP_DIGIT_COMPARE_7_7 E
+#define _GMP_DIGIT_COMPARE_7_8 L
+#define _GMP_DIGIT_COMPARE_7_9 L
+#define _GMP_DIGIT_COMPARE_8_0 G
+#define _GMP_DIGIT_COMPARE_8_1 G
+#define _GMP_DIGIT_COMPARE_8_2 G
+#define _GMP_DIGIT_COMPARE_8_3 G
+#define _GMP_DIGIT_COMPARE_8_4 G
+#define _GMP_DIGIT_COMPARE_8_5 G
+#define _GMP_DIGIT_COMPARE_8_6 G
+#define _GMP_DIGIT_COMPARE_8_7 G
+#define _GMP_DIGIT_COMPARE_8_8 E
+#define _GMP_DIGIT_COMPARE_8_9 L
+#define _GMP_DIGIT_COMPARE_9_0 G
+#define _GMP_DIGIT_COMPARE_9_1 G
+#define _GMP_DIGIT_COMPARE_9_2 G
+#define _GMP_DIGIT_COMPARE_9_3 G
+#define _GMP_DIGIT_COMPARE_9_4 G
+#define _GMP_DIGIT_COMPARE_9_5 G
+#define _GMP_DIGIT_COMPARE_9_6 G
+#define _GMP_DIGIT_COMPARE_9_7 G
+#define _GMP_DIGIT_COMPARE_9_8 G
+#define _GMP_DIGIT_COMPARE_9_9 E
+
+
+/**
+ * \def GMP_NUMBER_EQUAL(x, y)
+ * \brief Check if two numbers are equal.
+ *
+ * \return 1 if \a x equals \a y, otherwise 0.
+ */
+#define GMP_NUMBER_EQUAL(x, y) GMP_CONCAT(_GMP_NUMBER_EQUAL_, GMP_NUMBER_COMPARE(x, y))
+#define _GMP_NUMBER_EQUAL_L 0
+#define _GMP_NUMBER_EQUAL_E 1
+#define _GMP_NUMBER_EQUAL_G 0
+
+
+/**
+ * \def GMP_NUMBER_LESS(x, y)
+ * \brief Check if a number is less than another.
+ *
+ * \return 1 if \a x is less than \a y, otherwise 0.
+ */
+#define GMP_NUMBER_LESS(x, y) GMP_CONCAT(_GMP_NUMBER_LESS_, GMP_NUMBER_COMPARE(x, y))
+#define _GMP_NUMBER_LESS_L 1
+#define _GMP_NUMBER_LESS_E 0
+#define _GMP_NUMBER_LESS_G 0
+
+
+/**
+ * \def GMP_NUMBER_IS_ZERO(n)
+ * \brief Check if a number is zero.
+ *
+ * \return 1 if \a n is zero, otherwise 0.
+ */
+#define GMP_NUMBER_IS_ZERO(n) GMP_NUMBER_EQUAL(n, (0, 0, 0, 0))
+
+
+/**
+ * \def GMP_NUMBER_MIN(x, y)
+ * \brief The smaller of two numbers.
+ */
+#define GMP_NUMBER_MIN(x, y) GMP_CONCAT(_GMP_NUMBER_MIN_, GMP_NUMBER_COMPARE(x, y))(x, y)
+#define _GMP_NUMBER_MIN_L(x, y) x
+#define _GMP_NUMBER_MIN_E(x, y) x
+#define _GMP_NUMBER_MIN_G(x, y) y
+
+
+/**
+ * \def GMP_NUMBER_MAX(x, y)
+ * \brief The larger of two numbers.
+ */
+#define GMP_NUMBER_MAX(x, y) GMP_CONCAT(_GMP_NUMBER_MAX_, GMP_NUMBER_COMPARE(x, y))(x, y)
+#define _GMP_NUMBER_MAX_L(x, y) y
+#define _GMP_NUMBER_MAX_E(x, y) x
+#define _GMP_NUMBER_MAX_G(x, y) x
+
+
+/**
+ * \def GMP_NUMBER_ADD(x, y)
+ * \brief Add two numbers.
+ *
+ * \code
+ * GMP_NUMBER_ADD((0, 1, 9, 5), (0, 0, 0, 7)) // (0, 2, 0, 2)
+ * \endcode
+ */
+#define GMP_NUMBER_ADD(x, y) _GMP_NUMBER_DROP_CARRY(_GMP_NUMBER_ADD(_GMP_NUMBER_UNPACK x, _GMP_NUMBER_UNPACK y))
+#define _GMP_NUMBER_ADD(...) _GMP_NUMBER_ADD4(__VA_ARGS__)
+#define _GMP_NUMBER_DROP_CARRY(r) _GMP_NUMBER_DROP_CARRY_I(r)
+#define _GMP_NUMBER_DROP_CARRY_I(carry, n) n
+#define _GMP_NUMBER_ADD4(x0, x1, x2, x3, y0, y1, y2, y3) \
+    _GMP_NUMBER_ADD4_3(x0, x1, x2, y0, y1, y2, _GMP_DIGIT_ADD_ ## x3 ## _ ## y3 ## _0)
+#define _GMP_NUMBER_ADD4_3(x0, x1, x2, y0, y1, y2, r) _GMP_NUMBER_ADD4_3_I(x0, x1, x2, y0, y1, y2, r)
+#define _GMP_NUMBER_ADD4_3_I(x0, x1, x2, y0, y1, y2, c, s3) \
+    _GMP_NUMBER_ADD4_2(x0, x1, y0, y1, s3, _GMP_DIGIT_ADD_ ## x2 ## _ ## y2 ## _ ## c)
+#define _GMP_NUMBER_ADD4_2(x0, x1, y0, y1, s3, r) _GMP_NUMBER_ADD4_2_I(x0, x1, y0, y1, s3, r)
+#define _GMP_NUMBER_ADD4_2_I(x0, x1, y0, y1, s3, c, s2) \
+    _GMP_NUMBER_ADD4_1(x0, y0, s2, s3, _GMP_DIGIT_ADD_ ## x1 ## _ ## y1 ## _ ## c)
+#define _GMP_NUMBER_ADD4_1(x0, y0, s2, s3, r) _GMP_NUMBER_ADD4_1_I(x0, y0, s2, s3, r)
+#define _GMP_NUMBER_ADD4_1_I(x0, y0, s2, s3, c, s1) \
+    _GMP_NUMBER_ADD4_0(s1, s2, s3, _GMP_DIGIT_ADD_ ## x0 ## _ ## y0 ## _ ## c)
+#define _GMP_NUMBER_ADD4_0(s1, s2, s3, r) _GMP_NUMBER_ADD4_0_I(s1, s2, s3, r)
+#define _GMP_NUMBER_ADD4_0_I(s1, s2, s3, c, s0) c, (s0, s1, s2, s3)
+// _GMP_DIGIT_ADD_a_b_c: carry and digit of a + b + c
+#define _GMP_DIGIT_ADD_0_0_0 0, 0
+#define _GMP_DIGIT_ADD_0_1_0 0, 1
+#define _GMP_DIGIT_ADD_0_2_0 0, 2
+#define _GMP_DIGIT_ADD_0_3_0 0, 3
+#define _GMP_DIGIT_ADD_0_4_0 0, 4
+#define _GMP_DIGIT_ADD_0_5_0 0, 5
+#define _GMP_DIGIT_ADD_0_6_0 0, 6
+#define _GMP_DIGIT_ADD_0_7_0 0, 7
+#define _GMP_DIGIT_ADD_0_8_0 0, 8
+#define _GMP_DIGIT_ADD_0_9_0 0, 9
+#define _GMP_DIGIT_ADD_1_0_0 0, 1
+#define _GMP_DIGIT_ADD_1_1_0 0, 2
+#define _GMP_DIGIT_ADD_1_2_0 0, 3
+#define _GMP_DIGIT_ADD_1_3_0 0, 4
+#define _GMP_DIGIT_ADD_1_4_0 0, 5
+#define _GMP_DIGIT_ADD_1_5_0 0, 6
+#define _GMP_DIGIT_ADD_1_6_0 0, 7
+#define _GMP_DIGIT_ADD_1_7_0 0, 8
+#define _GMP_DIGIT_ADD_1_8_0 0, 9
+#define _GMP_DIGIT_ADD_1_9_0 1, 0
+#define _GMP_DIGIT_ADD_2_0_0 0, 2
+#define _GMP_DIGIT_ADD_2_1_0 0, 3
+#define _GMP_DIGIT_ADD_2_2_0 0, 4
+#define _GMP_DIGIT_ADD_2_3_0 0, 5
+#define _GMP_DIGIT_ADD_2_4_0 0, 6
+#define _GMP_DIGIT_ADD_2_5_0 0, 7
+#define _GMP_DIGIT_ADD_2_6_0 0, 8
+#define _GMP_DIGIT_ADD_2_7_0 0, 9
+#define _GMP_DIGIT_ADD_2_8_0 1, 0
+#define _GMP_DIGIT_ADD_2_9_0 1, 1
+#define _GMP_DIGIT_ADD_3_0_0 0, 3
+#define _GMP_DIGIT_ADD_3_1_0 0, 4
+#define _GMP_DIGIT_ADD_3_2_0 0, 5
+#define _GMP_DIGIT_ADD_3_3_0 0, 6
+#define _GMP_DIGIT_ADD_3_4_0 0, 7
+#define _GMP_DIGIT_ADD_3_5_0 0, 8
+#define _GMP_DIGIT_ADD_3_6_0 0, 9
+#define _GMP_DIGIT_ADD_3_7_0 1, 0
+#define _GMP_DIGIT_ADD_3_8_0 1, 1
+#define _GMP_DIGIT_ADD_3_9_0 1, 2
+#define _GMP_DIGIT_ADD_4_0_0 0, 4
+#define _GMP_DIGIT_ADD_4_1_0 0, 5
+#define _GMP_DIGIT_ADD_4_2_0 0, 6
+#define _GMP_DIGIT_ADD_4_3_0 0, 7
+#define _GMP_DIGIT_ADD_4_4_0 0, 8
+#define _GMP_DIGIT_ADD_4_5_0 0, 9
+#define _GMP_DIGIT_ADD_4_6_0 1, 0
+#define _GMP_DIGIT_ADD_4_7_0 1, 1
+#define _GMP_DIGIT_ADD_4_8_0 1, 2
+#define _GMP_DIGIT_ADD_4_9_0 1, 3
+#define _GMP_DIGIT_ADD_5_0_0 0, 5
+#define _GMP_DIGIT_ADD_5_1_0 0, 6
+#define _GMP_DIGIT_ADD_5_2_0 0, 7
+#define _GMP_DIGIT_ADD_5_3_0 0, 8
+#define _GMP_DIGIT_ADD_5_4_0 0, 9
+#define _GMP_DIGIT_ADD_5_5_0 1, 0
+#define _GMP_DIGIT_ADD_5_6_0 1, 1
+#define _GMP_DIGIT_ADD_5_7_0 1, 2
+#define _GMP_DIGIT_ADD_5_8_0 1, 3
+#define _GMP_DIGIT_ADD_5_9_0 1, 4
+#define _GMP_DIGIT_ADD_6_0_0 0, 6
+#define _GMP_DIGIT_ADD_6_1_0 0, 7
+#define _GMP_DIGIT_ADD_6_2_0 0, 8
+#define _GMP_DIGIT_ADD_6_3_0 0, 9
+#define _GMP_DIGIT_ADD_6_4_0 1, 0
+#define _GMP_DIGIT_ADD_6_5_0 1, 1
+#define _GMP_DIGIT_ADD_6_6_0 1, 2
+#define _GMP_DIGIT_ADD_6_7_0 1, 3
+#define _GMP_DIGIT_ADD_6_8_0 1, 4
+#define _GMP_DIGIT_ADD_6_9_0 1, 5
+#define _GMP_DIGIT_ADD_7_0_0 0, 7
+#define _GMP_DIGIT_ADD_7_1_0 0, 8
+#define _GMP_DIGIT_ADD_7_2_0 0, 9
+#define _GMP_DIGIT_ADD_7_3_0 1, 0
+#define _GMP_DIGIT_ADD_7_4_0 1, 1
+#define _GMP_DIGIT_ADD_7_5_0 1, 2
+#define _GMP_DIGIT_ADD_7_6_0 1, 3
+#define _GMP_DIGIT_ADD_7_7_0 1, 4
+#define _GMP_DIGIT_ADD_7_8_0 1, 5
+#define _GMP_DIGIT_ADD_7_9_0 1, 6
+#define _GMP_DIGIT_ADD_8_0_0 0, 8
+#define _GMP_DIGIT_ADD_8_1_0 0, 9
+#define _GMP_DIGIT_ADD_8_2_0 1, 0
+#define _GMP_DIGIT_ADD_8_3_0 1, 1
+#define _GMP_DIGIT_ADD_8_4_0 1, 2
+#define _GMP_DIGIT_ADD_8_5_0 1, 3
+#define _GMP_DIGIT_ADD_8_6_0 1, 4
+#define _GMP_DIGIT_ADD_8_7_0 1, 5
+#define _GMP_DIGIT_ADD_8_8_0 1, 6
+#define _GMP_DIGIT_ADD_8_9_0 1, 7
+#define _GMP_DIGIT_ADD_9_0_0 0, 9
+#define _GMP_DIGIT_ADD_9_1_0 1, 0
+#define _GMP_DIGIT_ADD_9_2_0 1, 1
+#define _GMP_DIGIT_ADD_9_3_0 1, 2
+#define _GMP_DIGIT_ADD_9_4_0 1, 3
+#define _GMP_DIGIT_ADD_9_5_0 1, 4
+#define _GMP_DIGIT_ADD_9_6_0 1, 5
+#define _GMP_DIGIT_ADD_9_7_0 1, 6
+#define _GMP_DIGIT_ADD_9_8_0 1, 7
+#define _GMP_DIGIT_ADD_9_9_0 1, 8
+#define _GMP_DIGIT_ADD_0_0_1 0, 1
+#define _GMP_DIGIT_ADD_0_1_1 0, 2
+#define _GMP_DIGIT_ADD_0_2_1 0, 3
+#define _GMP_DIGIT_ADD_0_3_1 0, 4
+#define _GMP_DIGIT_ADD_0_4_1 0, 5
+#define _GMP_DIGIT_ADD_0_5_1 0, 6
+#define _GMP_DIGIT_ADD_0_6_1 0, 7
+#define _GMP_DIGIT_ADD_0_7_1 0, 8
+#define _GMP_DIGIT_ADD_0_8_1 0, 9
+#define _GMP_DIGIT_ADD_0_9_1 1, 0
+#define _GMP_DIGIT_ADD_1_0_1 0, 2
+#define _GMP_DIGIT_ADD_1_1_1 0, 3
+#define _GMP_DIGIT_ADD_1_2_1 0, 4
+#define _GMP_DIGIT_ADD_1_3_1 0, 5
+#define _GMP_DIGIT_ADD_1_4_1 0, 6
+#define _GMP_DIGIT_ADD_1_5_1 0, 7
+#define _GMP_DIGIT_ADD_1_6_1 0, 8
+#define _GMP_DIGIT_ADD_1_7_1 0, 9
+#define _GMP_DIGIT_ADD_1_8_1 1, 0
+#define _GMP_DIGIT_ADD_1_9_1 1, 1
+#define _GMP_DIGIT_ADD_2_0_1 0, 3
+#define _GMP_DIGIT_ADD_2_1_1 0, 4
+#define _GMP_DIGIT_ADD_2_2_1 0, 5
+#define _GMP_DIGIT_ADD_2_3_1 0, 6
+#define _GMP_DIGIT_ADD_2_4_1 0, 7
+#define _GMP_DIGIT_ADD_2_5_1 0, 8
+#define _GMP_DIGIT_ADD_2_6_1 0, 9
+#define _GMP_DIGIT_ADD_2_7_1 1, 0
+#define _GMP_DIGIT_ADD_2_8_1 1, 1
+#define _GMP_DIGIT_ADD_2_9_1 1, 2
+#define _GMP_DIGIT_ADD_3_0_1 0, 4
+#define _GMP_DIGIT_ADD_3_1_1 0, 5
+#define _GMP_DIGIT_ADD_3_2_1 0, 6
+#define _GMP_DIGIT_ADD_3_3_1 0, 7
+#define _GMP_DIGIT_ADD_3_4_1 0, 8
+#define _GMP_DIGIT_ADD_3_5_1 0, 9
+#define _GMP_DIGIT_ADD_3_6_1 1, 0
+#define _GMP_DIGIT_ADD_3_7_1 1, 1
+#define _GMP_DIGIT_ADD_3_8_1 1, 2
+#define _GMP_DIGIT_ADD_3_9_1 1, 3
+#define _GMP_DIGIT_ADD_4_0_1 0, 5
+#define _GMP_DIGIT_ADD_4_1_1 0, 6
+#define _GMP_DIGIT_ADD_4_2_1 0, 7
+#define _GMP_DIGIT_ADD_4_3_1 0, 8
+#define _GMP_DIGIT_ADD_4_4_1 0, 9
+#define _GMP_DIGIT_ADD_4_5_1 1, 0
+#define _GMP_DIGIT_ADD_4_6_1 1, 1
+#define _GMP_DIGIT_ADD_4_7_1 1, 2
+#define _GMP_DIGIT_ADD_4_8_1 1, 3
+#define _GMP_DIGIT_ADD_4_9_1 1, 4
+#define _GMP_DIGIT_ADD_5_0_1 0, 6
+#define _GMP_DIGIT_ADD_5_1_1 0, 7
+#define _GMP_DIGIT_ADD_5_2_1 0, 8
+#define _GMP_DIGIT_ADD_5_3_1 0, 9
+#define _GMP_DIGIT_ADD_5_4_1 1, 0
+#define _GMP_DIGIT_ADD_5_5_1 1, 1
+#define _GMP_DIGIT_ADD_5_6_1 1, 2
+#define _GMP_DIGIT_ADD_5_7_1 1, 3
+#define _GMP_DIGIT_ADD_5_8_1 1, 4
+#define _GMP_DIGIT_ADD_5_9_1 1, 5
+#define _GMP_DIGIT_ADD_6_0_1 0, 7
+#define _GMP_DIGIT_ADD_6_1_1 0, 8
+#define _GMP_DIGIT_ADD_6_2_1 0, 9
+#define _GMP_DIGIT_ADD_6_3_1 1, 0
+#define _GMP_DIGIT_ADD_6_4_1 1, 1
+#define _GMP_DIGIT_ADD_6_5_1 1, 2
+#define _GMP_DIGIT_ADD_6_6_1 1, 3
+#define _GMP_DIGIT_ADD_6_7_1 1, 4
+#define _GMP_DIGIT_ADD_6_8_1 1, 5
+#define _GMP_DIGIT_ADD_6_9_1 1, 6
+#define _GMP_DIGIT_ADD_7_0_1 0, 8
+#define _GMP_DIGIT_ADD_7_1_1 0, 9
+#define _GMP_DIGIT_ADD_7_2_1 1, 0
+#define _GMP_DIGIT_ADD_7_3_1 1, 1
+#define _GMP_DIGIT_ADD_7_4_1 1, 2
+#define _GMP_DIGIT_ADD_7_5_1 1, 3
+#define _GMP_DIGIT_ADD_7_6_1 1, 4
+#define _GMP_DIGIT_ADD_7_7_1 1, 5
+#define _GMP_DIGIT_ADD_7_8_1 1, 6
+#define _GMP_DIGIT_ADD_7_9_1 1, 7
+#define _GMP_DIGIT_ADD_8_0_1 0, 9
+#define _GMP_DIGIT_ADD_8_1_1 1, 0
+#define _GMP_DIGIT_ADD_8_2_1 1, 1
+#define _GMP_DIGIT_ADD_8_3_1 1, 2
+#define _GMP_DIGIT_ADD_8_4_1 1, 3
+#define _GMP_DIGIT_ADD_8_5_1 1, 4
+#define _GMP_DIGIT_ADD_8_6_1 1, 5
+#define _GMP_DIGIT_ADD_8_7_1 1, 6
+#define _GMP_DIGIT_ADD_8_8_1 1, 7
+#define _GMP_DIGIT_ADD_8_9_1 1, 8
+#define _GMP_DIGIT_ADD_9_0_1 1, 0
+#define _GMP_DIGIT_ADD_9_1_1 1, 1
+#define _GMP_DIGIT_ADD_9_2_1 1, 2
+#define _GMP_DIGIT_ADD_9_3_1 1, 3
+#define _GMP_DIGIT_ADD_9_4_1 1, 4
+#define _GMP_DIGIT_ADD_9_5_1 1, 5
+#define _GMP_DIGIT_ADD_9_6_1 1, 6
+#define _GMP_DIGIT_ADD_9_7_1 1, 7
+#define _GMP_DIGIT_ADD_9_8_1 1, 8
+#define _GMP_DIGIT_ADD_9_9_1 1, 9
+
+
+/**
+ * \def GMP_NUMBER_SUB(x, y)
+ * \brief Subtract a number from another.
+ *
+ * \code
+ * GMP_NUMBER_SUB((0, 2, 0, 2), (0, 0, 0, 7)) // (0, 1, 9, 5)
+ * \endcode
+ */
+#define GMP_NUMBER_SUB(x, y) _GMP_NUMBER_DROP_CARRY(_GMP_NUMBER_SUB(_GMP_NUMBER_UNPACK x, _GMP_NUMBER_UNPACK y))
+#define _GMP_NUMBER_SUB(...) _GMP_NUMBER_SUB4(__VA_ARGS__)
+#define _GMP_NUMBER_SUB4(x0, x1, x2, x3, y0, y1, y2, y3) \
+    _GMP_NUMBER_SUB4_3(x0, x1, x2, y0, y1, y2, _GMP_DIGIT_SUB_ ## x3 ## _ ## y3 ## _0)
+#define _GMP_NUMBER_SUB4_3(x0, x1, x2, y0, y1, y2, r) _GMP_NUMBER_SUB4_3_I(x0, x1, x2, y0, y1, y2, r)
+#define _GMP_NUMBER_SUB4_3_I(x0, x1, x2, y0, y1, y2, c, s3) \
+    _GMP_NUMBER_SUB4_2(x0, x1, y0, y1, s3, _GMP_DIGIT_SUB_ ## x2 ## _ ## y2 ## _ ## c)
+#define _GMP_NUMBER_SUB4_2(x0, x1, y0, y1, s3, r) _GMP_NUMBER_SUB4_2_I(x0, x1, y0, y1, s3, r)
+#define _GMP_NUMBER_SUB4_2_I(x0, x1, y0, y1, s3, c, s2) \
+    _GMP_NUMBER_SUB4_1(x0, y0, s2, s3, _GMP_DIGIT_SUB_ ## x1 ## _ ## y1 ## _ ## c)
+#define _GMP_NUMBER_SUB4_1(x0, y0, s2, s3, r) _GMP_NUMBER_SUB4_1_I(x0, y0, s2, s3, r)
+#define _GMP_NUMBER_SUB4_1_I(x0, y0, s2, s3, c, s1) \
+    _GMP_NUMBER_SUB4_0(s1, s2, s3, _GMP_DIGIT_SUB_ ## x0 ## _ ## y0 ## _ ## c)
+#define _GMP_NUMBER_SUB4_0(s1, s2, s3, r) _GMP_NUMBER_SUB4_0_I(s1, s2, s3, r)
+#define _GMP_NUMBER_SUB4_0_I(s1, s2, s3, c, s0) c, (s0, s1, s2, s3)
+#define _GMP_NUMBER_SUB5(x0, x1, x2, x3, x4, y0, y1, y2, y3, y4) \
+    _GMP_NUMBER_SUB5_4(x0, x1, x2, x3, y0, y1, y2, y3, _GMP_DIGIT_SUB_ ## x4 ## _ ## y4 ## _0)
+#define _GMP_NUMBER_SUB5_4(x0, x1, x2, x3, y0, y1, y2, y3, r) _GMP_NUMBER_SUB5_4_I(x0, x1, x2, x3, y0, y1, y2, y3, r)
+#define _GMP_NUMBER_SUB5_4_I(x0, x1, x2, x3, y0, y1, y2, y3, c, s4) \
+    _GMP_NUMBER_SUB5_3(x0, x1, x2, y0, y1, y2, s4, _GMP_DIGIT_SUB_ ## x3 ## _ ## y3 ## _ ## c)
+#define _GMP_NUMBER_SUB5_3(x0, x1, x2, y0, y1, y2, s4, r) _GMP_NUMBER_SUB5_3_I(x0, x1, x2, y0, y1, y2, s4, r)
+#define _GMP_NUMBER_SUB5_3_I(x0, x1, x2, y0, y1, y2, s4, c, s3) \
+    _GMP_NUMBER_SUB5_2(x0, x1, y0, y1, s3, s4, _GMP_DIGIT_SUB_ ## x2 ## _ ## y2 ## _ ## c)
+#define _GMP_NUMBER_SUB5_2(x0, x1, y0, y1, s3, s4, r) _GMP_NUMBER_SUB5_2_I(x0, x1, y0, y1, s3, s4, r)
+#define _GMP_NUMBER_SUB5_2_I(x0, x1, y0, y1, s3, s4, c, s2) \
+    _GMP_NUMBER_SUB5_1(x0, y0, s2, s3, s4, _GMP_DIGIT_SUB_ ## x1 ## _ ## y1 ## _ ## c)
+#define _GMP_NUMBER_SUB5_1(x0, y0, s2, s3, s4, r) _GMP_NUMBER_SUB5_1_I(x0, y0, s2, s3, s4, r)
+#define _GMP_NUMBER_SUB5_1_I(x0, y0, s2, s3, s4, c, s1) \
+    _GMP_NUMBER_SUB5_0(s1, s2, s3, s4, _GMP_DIGIT_SUB_ ## x0 ## _ ## y0 ## _ ## c)
+#define _GMP_NUMBER_SUB5_0(s1, s2, s3, s4, r) _GMP_NUMBER_SUB5_0_I(s1, s2, s3, s4, r)
+#define _GMP_NUMBER_SUB5_0_I(s1, s2, s3, s4, c, s0) c, (s0, s1, s2, s3, s4)
+// _GMP_DIGIT_SUB_a_b_c: borrow and digit of a - b - c
+#define _GMP_DIGIT_SUB_0_0_0 0, 0
+#define _GMP_DIGIT_SUB_0_1_0 1, 9
+#define _GMP_DIGIT_SUB_0_2_0 1, 8
+#define _GMP_DIGIT_SUB_0_3_0 1, 7
+#define _GMP_DIGIT_SUB_0_4_0 1, 6
+#define _GMP_DIGIT_SUB_0_5_0 1, 5
+#define _GMP_DIGIT_SUB_0_6_0 1, 4
+#define _GMP_DIGIT_SUB_0_7_0 1, 3
+#define _GMP_DIGIT_SUB_0_8_0 1, 2
+#define _GMP_DIGIT_SUB_0_9_0 1, 1
+#define _GMP_DIGIT_SUB_1_0_0 0, 1
+#define _GMP_DIGIT_SUB_1_1_0 0, 0
+#define _GMP_DIGIT_SUB_1_2_0 1, 9
+#define _GMP_DIGIT_SUB_1_3_0 1, 8
+#define _GMP_DIGIT_SUB_1_4_0 1, 7
+#define _GMP_DIGIT_SUB_1_5_0 1, 6
+#define _GMP_DIGIT_SUB_1_6_0 1, 5
+#define _GMP_DIGIT_SUB_1_7_0 1, 4
+#define _GMP_DIGIT_SUB_1_8_0 1, 3
+#define _GMP_DIGIT_SUB_1_9_0 1, 2
+#define _GMP_DIGIT_SUB_2_0_0 0, 2
+#define _GMP_DIGIT_SUB_2_1_0 0, 1
+#define _GMP_DIGIT_SUB_2_2_0 0, 0
+#define _GMP_DIGIT_SUB_2_3_0 1, 9
+#define _GMP_DIGIT_SUB_2_4_0 1, 8
+#define _GMP_DIGIT_SUB_2_5_0 1, 7
+#define _GMP_DIGIT_SUB_2_6_0 1, 6
+#define _GMP_DIGIT_SUB_2_7_0 1, 5
+#define _GMP_DIGIT_SUB_2_8_0 1, 4
+#define _GMP_DIGIT_SUB_2_9_0 1, 3
+#define _GMP_DIGIT_SUB_3_0_0 0, 3
+#define _GMP_DIGIT_SUB_3_1_0 0, 2
+#define _GMP_DIGIT_SUB_3_2_0 0, 1
+#define _GMP_DIGIT_SUB_3_3_0 0, 0
+#define _GMP_DIGIT_SUB_3_4_0 1, 9
+#define _GMP_DIGIT_SUB_3_5_0 1, 8
+#define _GMP_DIGIT_SUB_3_6_0 1, 7
+#define _GMP_DIGIT_SUB_3_7_0 1, 6
+#define _GMP_DIGIT_SUB_3_8_0 1, 5
+#define _GMP_DIGIT_SUB_3_9_0 1, 4
+#define _GMP_DIGIT_SUB_4_0_0 0, 4
+#define _GMP_DIGIT_SUB_4_1_0 0, 3
+#define _GMP_DIGIT_SUB_4_2_0 0, 2
+#define _GMP_DIGIT_SUB_4_3_0 0, 1
+#define _GMP_DIGIT_SUB_4_4_0 0, 0
+#define _GMP_DIGIT_SUB_4_5_0 1, 9
+#define _GMP_DIGIT_SUB_4_6_0 1, 8
+#define _GMP_DIGIT_SUB_4_7_0 1, 7
+#define _GMP_DIGIT_SUB_4_8_0 1, 6
+#define _GMP_DIGIT_SUB_4_9_0 1, 5
+#define _GMP_DIGIT_SUB_5_0_0 0, 5
+#define _GMP_DIGIT_SUB_5_1_0 0, 4
+#define _GMP_DIGIT_SUB_5_2_0 0, 3
+#define _GMP_DIGIT_SUB_5_3_0 0, 2
+#define _GMP_DIGIT_SUB_5_4_0 0, 1
+#define _GMP_DIGIT_SUB_5_5_0 0, 0
+#define _GMP_DIGIT_SUB_5_6_0 1, 9
+#define _GMP_DIGIT_SUB_5_7_0 1, 8
+#define _GMP_DIGIT_SUB_5_8_0 1, 7
+#define _GMP_DIGIT_SUB_5_9_0 1, 6
+#define _GMP_DIGIT_SUB_6_0_0 0, 6
+#define _GMP_DIGIT_SUB_6_1_0 0, 5
+#define _GMP_DIGIT_SUB_6_2_0 0, 4
+#define _GMP_DIGIT_SUB_6_3_0 0, 3
+#define _GMP_DIGIT_SUB_6_4_0 0, 2
+#define _GMP_DIGIT_SUB_6_5_0 0, 1
+#define _GMP_DIGIT_SUB_6_6_0 0, 0
+#define _GMP_DIGIT_SUB_6_7_0 1, 9
+#define _GMP_DIGIT_SUB_6_8_0 1, 8
+#define _GMP_DIGIT_SUB_6_9_0 1, 7
+#define _GMP_DIGIT_SUB_7_0_0 0, 7
+#define _GMP_DIGIT_SUB_7_1_0 0, 6
+#define _GMP_DIGIT_SUB_7_2_0 0, 5
+#define _GMP_DIGIT_SUB_7_3_0 0, 4
+#define _GMP_DIGIT_SUB_7_4_0 0, 3
+#define _GMP_DIGIT_SUB_7_5_0 0, 2
+#define _GMP_DIGIT_SUB_7_6_0 0, 1
+#define _GMP_DIGIT_SUB_7_7_0 0, 0
+#define _GMP_DIGIT_SUB_7_8_0 1, 9
+#define _GMP_DIGIT_SUB_7_9_0 1, 8
+#define _GMP_DIGIT_SUB_8_0_0 0, 8
+#define _GMP_DIGIT_SUB_8_1_0 0, 7
+#define _GMP_DIGIT_SUB_8_2_0 0, 6
+#define _GMP_DIGIT_SUB_8_3_0 0, 5
+#define _GMP_DIGIT_SUB_8_4_0 0, 4
+#define _GMP_DIGIT_SUB_8_5_0 0, 3
+#define _GMP_DIGIT_SUB_8_6_0 0, 2
+#define _GMP_DIGIT_SUB_8_7_0 0, 1
+#define _GMP_DIGIT_SUB_8_8_0 0, 0
+#define _GMP_DIGIT_SUB_8_9_0 1, 9
+#define _GMP_DIGIT_SUB_9_0_0 0, 9
+#define _GMP_DIGIT_SUB_9_1_0 0, 8
+#define _GMP_DIGIT_SUB_9_2_0 0, 7
+#define _GMP_DIGIT_SUB_9_3_0 0, 6
+#define _GMP_DIGIT_SUB_9_4_0 0, 5
+#define _GMP_DIGIT_SUB_9_5_0 0, 4
+#define _GMP_DIGIT_SUB_9_6_0 0, 3
+#define _GMP_DIGIT_SUB_9_7_0 0, 2
+#define _GMP_DIGIT_SUB_9_8_0 0, 1
+#define _GMP_DIGIT_SUB_9_9_0 0, 0
+#define _GMP_DIGIT_SUB_0_0_1 1, 9
+#define _GMP_DIGIT_SUB_0_1_1 1, 8
+#define _GMP_DIGIT_SUB_0_2_1 1, 7
+#define _GMP_DIGIT_SUB_0_3_1 1, 6
+#define _GMP_DIGIT_SUB_0_4_1 1, 5
+#define _GMP_DIGIT_SUB_0_5_1 1, 4
+#define _GMP_DIGIT_SUB_0_6_1 1, 3
+#define _GMP_DIGIT_SUB_0_7_1 1, 2
+#define _GMP_DIGIT_SUB_0_8_1 1, 1
+#define _GMP_DIGIT_SUB_0_9_1 1, 0
+#define _GMP_DIGIT_SUB_1_0_1 0, 0
+#define _GMP_DIGIT_SUB_1_1_1 1, 9
+#define _GMP_DIGIT_SUB_1_2_1 1, 8
+#define _GMP_DIGIT_SUB_1_3_1 1, 7
+#define _GMP_DIGIT_SUB_1_4_1 1, 6
+#define _GMP_DIGIT_SUB_1_5_1 1, 5
+#define _GMP_DIGIT_SUB_1_6_1 1, 4
+#define _GMP_DIGIT_SUB_1_7_1 1, 3
+#define _GMP_DIGIT_SUB_1_8_1 1, 2
+#define _GMP_DIGIT_SUB_1_9_1 1, 1
+#define _GMP_DIGIT_SUB_2_0_1 0, 1
+#define _GMP_DIGIT_SUB_2_1_1 0, 0
+#define _GMP_DIGIT_SUB_2_2_1 1, 9
+#define _GMP_DIGIT_SUB_2_3_1 1, 8
+#define _GMP_DIGIT_SUB_2_4_1 1, 7
+#define _GMP_DIGIT_SUB_2_5_1 1, 6
+#define _GMP_DIGIT_SUB_2_6_1 1, 5
+#define _GMP_DIGIT_SUB_2_7_1 1, 4
+#define _GMP_DIGIT_SUB_2_8_1 1, 3
+#define _GMP_DIGIT_SUB_2_9_1 1, 2
+#define _GMP_DIGIT_SUB_3_0_1 0, 2
+#define _GMP_DIGIT_SUB_3_1_1 0, 1
+#define _GMP_DIGIT_SUB_3_2_1 0, 0
+#define _GMP_DIGIT_SUB_3_3_1 1, 9
+#define _GMP_DIGIT_SUB_3_4_1 1, 8
+#define _GMP_DIGIT_SUB_3_5_1 1, 7
+#define _GMP_DIGIT_SUB_3_6_1 1, 6
+#define _GMP_DIGIT_SUB_3_7_1 1, 5
+#define _GMP_DIGIT_SUB_3_8_1 1, 4
+#define _GMP_DIGIT_SUB_3_9_1 1, 3
+#define _GMP_DIGIT_SUB_4_0_1 0, 3
+#define _GMP_DIGIT_SUB_4_1_1 0, 2
+#define _GMP_DIGIT_SUB_4_2_1 0, 1
+#define _GMP_DIGIT_SUB_4_3_1 0, 0
+#define _GMP_DIGIT_SUB_4_4_1 1, 9
+#define _GMP_DIGIT_SUB_4_5_1 1, 8
+#define _GMP_DIGIT_SUB_4_6_1 1, 7
+#define _GMP_DIGIT_SUB_4_7_1 1, 6
+#define _GMP_DIGIT_SUB_4_8_1 1, 5
+#define _GMP_DIGIT_SUB_4_9_1 1, 4
+#define _GMP_DIGIT_SUB_5_0_1 0, 4
+#define _GMP_DIGIT_SUB_5_1_1 0, 3
+#define _GMP_DIGIT_SUB_5_2_1 0, 2
+#define _GMP_DIGIT_SUB_5_3_1 0, 1
+#define _GMP_DIGIT_SUB_5_4_1 0, 0
+#define _GMP_DIGIT_SUB_5_5_1 1, 9
+#define _GMP_DIGIT_SUB_5_6_1 1, 8
+#define _GMP_DIGIT_SUB_5_7_1 1, 7
+#define _GMP_DIGIT_SUB_5_8_1 1, 6
+#define _GMP_DIGIT_SUB_5_9_1 1, 5
+#define _GMP_DIGIT_SUB_6_0_1 0, 5
+#define _GMP_DIGIT_SUB_6_1_1 0, 4
+#define _GMP_DIGIT_SUB_6_2_1 0, 3
+#define _GMP_DIGIT_SUB_6_3_1 0, 2
+#define _GMP_DIGIT_SUB_6_4_1 0, 1
+#define _GMP_DIGIT_SUB_6_5_1 0, 0
+#define _GMP_DIGIT_SUB_6_6_1 1, 9
+#define _GMP_DIGIT_SUB_6_7_1 1, 8
+#define _GMP_DIGIT_SUB_6_8_1 1, 7
+#define _GMP_DIGIT_SUB_6_9_1 1, 6
+#define _GMP_DIGIT_SUB_7_0_1 0, 6
+#define _GMP_DIGIT_SUB_7_1_1 0, 5
+#define _GMP_DIGIT_SUB_7_2_1 0, 4
+#define _GMP_DIGIT_SUB_7_3_1 0, 3
+#define _GMP_DIGIT_SUB_7_4_1 0, 2
+#define _GMP_DIGIT_SUB_7_5_1 0, 1
+#define _GMP_DIGIT_SUB_7_6_1 0, 0
+#define _GMP_DIGIT_SUB_7_7_1 1, 9
+#define _GMP_DIGIT_SUB_7_8_1 1, 8
+#define _GMP_DIGIT_SUB_7_9_1 1, 7
+#define _GMP_DIGIT_SUB_8_0_1 0, 7
+#define _GMP_DIGIT_SUB_8_1_1 0, 6
+#define _GMP_DIGIT_SUB_8_2_1 0, 5
+#define _GMP_DIGIT_SUB_8_3_1 0, 4
+#define _GMP_DIGIT_SUB_8_4_1 0, 3
+#define _GMP_DIGIT_SUB_8_5_1 0, 2
+#define _GMP_DIGIT_SUB_8_6_1 0, 1
+#define _GMP_DIGIT_SUB_8_7_1 0, 0
+#define _GMP_DIGIT_SUB_8_8_1 1, 9
+#define _GMP_DIGIT_SUB_8_9_1 1, 8
+#define _GMP_DIGIT_SUB_9_0_1 0, 8
+#define _GMP_DIGIT_SUB_9_1_1 0, 7
+#define _GMP_DIGIT_SUB_9_2_1 0, 6
+#define _GMP_DIGIT_SUB_9_3_1 0, 5
+#define _GMP_DIGIT_SUB_9_4_1 0, 4
+#define _GMP_DIGIT_SUB_9_5_1 0, 3
+#define _GMP_DIGIT_SUB_9_6_1 0, 2
+#define _GMP_DIGIT_SUB_9_7_1 0, 1
+#define _GMP_DIGIT_SUB_9_8_1 0, 0
+#define _GMP_DIGIT_SUB_9_9_1 1, 9
+
+
+/**
+ * \def GMP_NUMBER_MUL(x, y)
+ * \brief Multiply two numbers.
+ *
+ * The product is the sum of \a x multiplied by each digit of \a y, shifted
+ * by the position of that digit.
+ *
+ * \code
+ * GMP_NUMBER_MUL((0, 0, 1, 6), (0, 0, 3, 2)) // (0, 5, 1, 2)
+ * \endcode
+ */
+#define GMP_NUMBER_MUL(x, y) _GMP_NUMBER_MUL(_GMP_NUMBER_UNPACK x, _GMP_NUMBER_UNPACK y)
+#define _GMP_NUMBER_MUL(...) _GMP_NUMBER_MUL_IMPL(__VA_ARGS__)
+#define _GMP_NUMBER_MUL_IMPL(x0, x1, x2, x3, y0, y1, y2, y3) \
+    _GMP_NUMBER_MUL_SUM(_GMP_NUMBER_SCALE(y3, x0, x1, x2, x3), _GMP_NUMBER_SCALE(y2, x0, x1, x2, x3), \
+                        _GMP_NUMBER_SCALE(y1, x0, x1, x2, x3), _GMP_NUMBER_SCALE(y0, x0, x1, x2, x3))
+#define _GMP_NUMBER_MUL_SUM(p0, p1, p2, p3) \
+    GMP_NUMBER_ADD(GMP_NUMBER_ADD(GMP_NUMBER_ADD(_GMP_NUMBER_SHIFT_0 p0, _GMP_NUMBER_SHIFT_1 p1), \
+                                  _GMP_NUMBER_SHIFT_2 p2), _GMP_NUMBER_SHIFT_3 p3)
+#define _GMP_NUMBER_SHIFT_0(d0, d1, d2, d3, d4) (d1, d2, d3, d4)
+#define _GMP_NUMBER_SHIFT_1(d0, d1, d2, d3, d4) (d2, d3, d4, 0)
+#define _GMP_NUMBER_SHIFT_2(d0, d1, d2, d3, d4) (d3, d4, 0, 0)
+#define _GMP_NUMBER_SHIFT_3(d0, d1, d2, d3, d4) (d4, 0, 0, 0)
+#define _GMP_NUMBER_SCALE(k, x0, x1, x2, x3) _GMP_NUMBER_SCALE_3(k, x0, x1, x2, _GMP_DIGIT_ADD_0_0_0, _GMP_DIGIT_MUL_ ## x3 ## _ ## k)
+#define _GMP_NUMBER_SCALE_3(k, x0, x1, x2, carry, r) _GMP_NUMBER_SCALE_3_I(k, x0, x1, x2, carry, r)
+#define _GMP_NUMBER_SCALE_3_I(k, x0, x1, x2, zero, carry, t, u) _GMP_NUMBER_SCALE_3_J(k, x0, x1, x2, t, _GMP_DIGIT_ADD_ ## u ## _ ## carry ## _0)
+#define _GMP_NUMBER_SCALE_3_J(k, x0, x1, x2, t, r) _GMP_NUMBER_SCALE_3_K(k, x0, x1, x2, t, r)
+#define _GMP_NUMBER_SCALE_3_K(k, x0, x1, x2, t, c, s3) \
+    _GMP_NUMBER_SCALE_2(k, x0, x1, s3, _GMP_DIGIT_ADD_ ## t ## _0_ ## c, _GMP_DIGIT_MUL_ ## x2 ## _ ## k)
+#define _GMP_NUMBER_SCALE_2(k, x0, x1, s3, carry, r) _GMP_NUMBER_SCALE_2_I(k, x0, x1, s3, carry, r)
+#define _GMP_NUMBER_SCALE_2_I(k, x0, x1, s3, zero, carry, t, u) _GMP_NUMBER_SCALE_2_J(k, x0, x1, s3, t, _GMP_DIGIT_ADD_ ## u ## _ ## carry ## _0)
+#define _GMP_NUMBER_SCALE_2_J(k, x0, x1, s3, t, r) _GMP_NUMBER_SCALE_2_K(k, x0, x1, s3, t, r)
+#define _GMP_NUMBER_SCALE_2_K(k, x0, x1, s3, t, c, s2) \
+    _GMP_NUMBER_SCALE_1(k, x0, s2, s3, _GMP_DIGIT_ADD_ ## t ## _0_ ## c, _GMP_DIGIT_MUL_ ## x1 ## _ ## k)
+#define _GMP_NUMBER_SCALE_1(k, x0, s2, s3, carry, r) _GMP_NUMBER_SCALE_1_I(k, x0, s2, s3, carry, r)
+#define _GMP_NUMBER_SCALE_1_I(k, x0, s2, s3, zero, carry, t, u) _GMP_NUMBER_SCALE_1_J(k, x0, s2, s3, t, _GMP_DIGIT_ADD_ ## u ## _ ## carry ## _0)
+#define _GMP_NUMBER_SCALE_1_J(k, x0, s2, s3, t, r) _GMP_NUMBER_SCALE_1_K(k, x0, s2, s3, t, r)
+#define _GMP_NUMBER_SCALE_1_K(k, x0, s2, s3, t, c, s1) \
+    _GMP_NUMBER_SCALE_0(k, s1, s2, s3, _GMP_DIGIT_ADD_ ## t ## _0_ ## c, _GMP_DIGIT_MUL_ ## x0 ## _ ## k)
+#define _GMP_NUMBER_SCALE_0(k, s1, s2, s3, carry, r) _GMP_NUMBER_SCALE_0_I(k, s1, s2, s3, carry, r)
+#define _GMP_NUMBER_SCALE_0_I(k, s1, s2, s3, zero, carry, t, u) _GMP_NUMBER_SCALE_0_J(k, s1, s2, s3, t, _GMP_DIGIT_ADD_ ## u ## _ ## carry ## _0)
+#define _GMP_NUMBER_SCALE_0_J(k, s1, s2, s3, t, r) _GMP_NUMBER_SCALE_0_K(k, s1, s2, s3, t, r)
+#define _GMP_NUMBER_SCALE_0_K(k, s1, s2, s3, t, c, s0) _GMP_NUMBER_SCALE_TOP(_GMP_DIGIT_ADD_ ## t ## _0_ ## c, s0, s1, s2, s3)
+#define _GMP_NUMBER_SCALE_TOP(r, s0, s1, s2, s3) _GMP_NUMBER_SCALE_TOP_I(r, s0, s1, s2, s3)
+#define _GMP_NUMBER_SCALE_TOP_I(zero, s, s0, s1, s2, s3) (s, s0, s1, s2, s3)
+// _GMP_DIGIT_MUL_a_b: tens and units of a * b
+#define _GMP_DIGIT_MUL_0_0 0, 0
+#define _GMP_DIGIT_MUL_0_1 0, 0
+#define _GMP_DIGIT_MUL_0_2 0, 0
+#define _GMP_DIGIT_MUL_0_3 0, 0
+#define _GMP_DIGIT_MUL_0_4 0, 0
+#define _GMP_DIGIT_MUL_0_5 0, 0
+#define _GMP_DIGIT_MUL_0_6 0, 0
+#define _GMP_DIGIT_MUL_0_7 0, 0
+#define _GMP_DIGIT_MUL_0_8 0, 0
+#define _GMP_DIGIT_MUL_0_9 0, 0
+#define _GMP_DIGIT_MUL_1_0 0, 0
+#define _GMP_DIGIT_MUL_1_1 0, 1
+#define _GMP_DIGIT_MUL_1_2 0, 2
+#define _GMP_DIGIT_MUL_1_3 0, 3
+#define _GMP_DIGIT_MUL_1_4 0, 4
+#define _GMP_DIGIT_MUL_1_5 0, 5
+#define _GMP_DIGIT_MUL_1_6 0, 6
+#define _GMP_DIGIT_MUL_1_7 0, 7
+#define _GMP_DIGIT_MUL_1_8 0, 8
+#define _GMP_DIGIT_MUL_1_9 0, 9
+#define _GMP_DIGIT_MUL_2_0 0, 0
+#define _GMP_DIGIT_MUL_2_1 0, 2
+#define _GMP_DIGIT_MUL_2_2 0, 4
+#define _GMP_DIGIT_MUL_2_3 0, 6
+#define _GMP_DIGIT_MUL_2_4 0, 8
+#define _GMP_DIGIT_MUL_2_5 1, 0
+#define _GMP_DIGIT_MUL_2_6 1, 2
+#define _GMP_DIGIT_MUL_2_7 1, 4
+#define _GMP_DIGIT_MUL_2_8 1, 6
+#define _GMP_DIGIT_MUL_2_9 1, 8
+#define _GMP_DIGIT_MUL_3_0 0, 0
+#define _GMP_DIGIT_MUL_3_1 0, 3
+#define _GMP_DIGIT_MUL_3_2 0, 6
+#define _GMP_DIGIT_MUL_3_3 0, 9
+#define _GMP_DIGIT_MUL_3_4 1, 2
+#define _GMP_DIGIT_MUL_3_5 1, 5
+#define _GMP_DIGIT_MUL_3_6 1, 8
+#define _GMP_DIGIT_MUL_3_7 2, 1
+#define _GMP_DIGIT_MUL_3_8 2, 4
+#define _GMP_DIGIT_MUL_3_9 2, 7
+#define _GMP_DIGIT_MUL_4_0 0, 0
+#define _GMP_DIGIT_MUL_4_1 0, 4
+#define _GMP_DIGIT_MUL_4_2 0, 8
+#define _GMP_DIGIT_MUL_4_3 1, 2
+#define _GMP_DIGIT_MUL_4_4 1, 6
+#define _GMP_DIGIT_MUL_4_5 2, 0
+#define _GMP_DIGIT_MUL_4_6 2, 4
+#define _GMP_DIGIT_MUL_4_7 2, 8
+#define _GMP_DIGIT_MUL_4_8 3, 2
+#define _GMP_DIGIT_MUL_4_9 3, 6
+#define _GMP_DIGIT_MUL_5_0 0, 0
+#define _GMP_DIGIT_MUL_5_1 0, 5
+#define _GMP_DIGIT_MUL_5_2 1, 0
+#define _GMP_DIGIT_MUL_5_3 1, 5
+#define _GMP_DIGIT_MUL_5_4 2, 0
+#define _GMP_DIGIT_MUL_5_5 2, 5
+#define _GMP_DIGIT_MUL_5_6 3, 0
+#define _GMP_DIGIT_MUL_5_7 3, 5
+#define _GMP_DIGIT_MUL_5_8 4, 0
+#define _GMP_DIGIT_MUL_5_9 4, 5
+#define _GMP_DIGIT_MUL_6_0 0, 0
+#define _GMP_DIGIT_MUL_6_1 0, 6
+#define _GMP_DIGIT_MUL_6_2 1, 2
+#define _GMP_DIGIT_MUL_6_3 1, 8
+#define _GMP_DIGIT_MUL_6_4 2, 4
+#define _GMP_DIGIT_MUL_6_5 3, 0
+#define _GMP_DIGIT_MUL_6_6 3, 6
+#define _GMP_DIGIT_MUL_6_7 4, 2
+#define _GMP_DIGIT_MUL_6_8 4, 8
+#define _GMP_DIGIT_MUL_6_9 5, 4
+#define _GMP_DIGIT_MUL_7_0 0, 0
+#define _GMP_DIGIT_MUL_7_1 0, 7
+#define _GMP_DIGIT_MUL_7_2 1, 4
+#define _GMP_DIGIT_MUL_7_3 2, 1
+#define _GMP_DIGIT_MUL_7_4 2, 8
+#define _GMP_DIGIT_MUL_7_5 3, 5
+#define _GMP_DIGIT_MUL_7_6 4, 2
+#define _GMP_DIGIT_MUL_7_7 4, 9
+#define _GMP_DIGIT_MUL_7_8 5, 6
+#define _GMP_DIGIT_MUL_7_9 6, 3
+#define _GMP_DIGIT_MUL_8_0 0, 0
+#define _GMP_DIGIT_MUL_8_1 0, 8
+#define _GMP_DIGIT_MUL_8_2 1, 6
+#define _GMP_DIGIT_MUL_8_3 2, 4
+#define _GMP_DIGIT_MUL_8_4 3, 2
+#define _GMP_DIGIT_MUL_8_5 4, 0
+#define _GMP_DIGIT_MUL_8_6 4, 8
+#define _GMP_DIGIT_MUL_8_7 5, 6
+#define _GMP_DIGIT_MUL_8_8 6, 4
+#define _GMP_DIGIT_MUL_8_9 7, 2
+#define _GMP_DIGIT_MUL_9_0 0, 0
+#define _GMP_DIGIT_MUL_9_1 0, 9
+#define _GMP_DIGIT_MUL_9_2 1, 8
+#define _GMP_DIGIT_MUL_9_3 2, 7
+#define _GMP_DIGIT_MUL_9_4 3, 6
+#define _GMP_DIGIT_MUL_9_5 4, 5
+#define _GMP_DIGIT_MUL_9_6 5, 4
+#define _GMP_DIGIT_MUL_9_7 6, 3
+#define _GMP_DIGIT_MUL_9_8 7, 2
+#define _GMP_DIGIT_MUL_9_9 8, 1
+
+
+/**
+ * \def GMP_NUMBER_DIV(x, y)
+ * \brief Divide a number by another, rounding towards zero.
+ *
+ * Long division: each digit of the quotient is the largest q in [0, 9] for
+ * which q * \a y, taken from the nine precomputed multiples of \a y, can be
+ * subtracted from the running remainder. If \a y is zero, every multiple is
+ * zero, so the quotient is (9, 9, 9, 9) and the remainder is \a x; \ref GMP_DIV
+ * and \ref GMP_MOD report a zero divisor as an error instead.
+ *
+ * \code
+ * GMP_NUMBER_DIV((0, 1, 0, 0), (0, 0, 0, 7)) // (0, 0, 1, 4)
+ * \endcode
+ */
+#define GMP_NUMBER_DIV(x, y) _GMP_NUMBER_QUOTIENT(_GMP_NUMBER_DIVMOD(x, y))
+#define _GMP_NUMBER_QUOTIENT(r) _GMP_NUMBER_QUOTIENT_I(r)
+#define _GMP_NUMBER_QUOTIENT_I(q, r) q
+
+
+/**
+ * \def GMP_NUMBER_MOD(x, y)
+ * \brief The remainder of the division of a number by another.
+ *
+ * \code
+ * GMP_NUMBER_MOD((0, 1, 0, 0), (0, 0, 0, 7)) // (0, 0, 0, 2)
+ * \endcode
+ *
+ * \see GMP_NUMBER_DIV
+ */
+#define GMP_NUMBER_MOD(x, y) _GMP_NUMBER_REMAINDER(_GMP_NUMBER_DIVMOD(x, y))
+#define _GMP_NUMBER_REMAINDER(r) _GMP_NUMBER_REMAINDER_I(r)
+#define _GMP_NUMBER_REMAINDER_I(q, r) r
+
+// (quotient), (remainder)
+#define _GMP_NUMBER_DIVMOD(x, y) \
+    _GMP_NUMBER_DIVMOD_I((_GMP_NUMBER_MULTIPLES(_GMP_NUMBER_UNPACK y)), _GMP_NUMBER_UNPACK x)
+#define _GMP_NUMBER_DIVMOD_I(...) _GMP_NUMBER_DIVMOD_0(__VA_ARGS__)
+#define _GMP_NUMBER_DIVMOD_0(ms, a, b, c, d) _GMP_NUMBER_DIVMOD_1(ms, b, c, d, _GMP_NUMBER_DIV_DIGIT(ms, 0, 0, 0, 0, a))
+#define _GMP_NUMBER_DIVMOD_1(ms, b, c, d, r) _GMP_NUMBER_DIVMOD_1_I(ms, b, c, d, r)
+#define _GMP_NUMBER_DIVMOD_1_I(ms, b, c, d, q0, r0, r1, r2, r3) \
+    _GMP_NUMBER_DIVMOD_2(ms, c, d, q0, _GMP_NUMBER_DIV_DIGIT(ms, r0, r1, r2, r3, b))
+#define _GMP_NUMBER_DIVMOD_2(ms, c, d, q0, r) _GMP_NUMBER_DIVMOD_2_I(ms, c, d, q0, r)
+#define _GMP_NUMBER_DIVMOD_2_I(ms, c, d, q0, q1, r0, r1, r2, r3) \
+    _GMP_NUMBER_DIVMOD_3(ms, d, q0, q1, _GMP_NUMBER_DIV_DIGIT(ms, r0, r1, r2, r3, c))
+#define _GMP_NUMBER_DIVMOD_3(ms, d, q0, q1, r) _GMP_NUMBER_DIVMOD_3_I(ms, d, q0, q1, r)
+#define _GMP_NUMBER_DIVMOD_3_I(ms, d, q0, q1, q2, r0, r1, r2, r3) \
+    _GMP_NUMBER_DIVMOD_4(q0, q1, q2, _GMP_NUMBER_DIV_DIGIT(ms, r0, r1, r2, r3, d))
+#define _GMP_NUMBER_DIVMOD_4(q0, q1, q2, r) _GMP_NUMBER_DIVMOD_4_I(q0, q1, q2, r)
+#define _GMP_NUMBER_DIVMOD_4_I(q0, q1, q2, q3, r0, r1, r2, r3) (q0, q1, q2, q3), (r0, r1, r2, r3)
+#define _GMP_NUMBER_MULTIPLES(...) _GMP_NUMBER_MULTIPLES_IMPL(__VA_ARGS__)
+#define _GMP_NUMBER_MULTIPLES_IMPL(y0, y1, y2, y3) \
+    _GMP_NUMBER_SCALE(1, y0, y1, y2, y3), _GMP_NUMBER_SCALE(2, y0, y1, y2, y3), _GMP_NUMBER_SCALE(3, y0, y1, y2, y3), _GMP_NUMBER_SCALE(4, y0, y1, y2, y3), _GMP_NUMBER_SCALE(5, y0, y1, y2, y3), _GMP_NUMBER_SCALE(6, y0, y1, y2, y3), _GMP_NUMBER_SCALE(7, y0, y1, y2, y3), _GMP_NUMBER_SCALE(8, y0, y1, y2, y3), _GMP_NUMBER_SCALE(9, y0, y1, y2, y3)
+
+// quotient digit, remainder digits of the five-digit partial remainder p0..p4
+#define _GMP_NUMBER_DIV_DIGIT(ms, p0, p1, p2, p3, p4) \
+    _GMP_NUMBER_DIV_DIGIT_I((p0, p1, p2, p3, p4), _GMP_NUMBER_UNPACK ms, (p0, p1, p2, p3, p4))
+#define _GMP_NUMBER_DIV_DIGIT_I(...) _GMP_NUMBER_DIV_SEARCH_0_9(__VA_ARGS__)
+#define _GMP_NUMBER_DIV_SUB(...) _GMP_NUMBER_SUB5(__VA_ARGS__)
+#define _GMP_NUMBER_DIV_LOW(p0, p1, p2, p3, p4) p1, p2, p3, p4
+#define _GMP_NUMBER_DIV_SEARCH_0_9(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) \
+    _GMP_NUMBER_DIV_SEARCH_0_9_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, _GMP_NUMBER_DIV_SUB(_GMP_NUMBER_UNPACK p, _GMP_NUMBER_UNPACK m5))
+#define _GMP_NUMBER_DIV_SEARCH_0_9_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r) _GMP_NUMBER_DIV_SEARCH_0_9_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r)
+#define _GMP_NUMBER_DIV_SEARCH_0_9_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, borrow, next) _GMP_NUMBER_DIV_SEARCH_0_9_ ## borrow(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next)
+#define _GMP_NUMBER_DIV_SEARCH_0_9_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_5_9(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, next)
+#define _GMP_NUMBER_DIV_SEARCH_0_9_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_0_4(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff)
+#define _GMP_NUMBER_DIV_SEARCH_5_9(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) \
+    _GMP_NUMBER_DIV_SEARCH_5_9_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, _GMP_NUMBER_DIV_SUB(_GMP_NUMBER_UNPACK p, _GMP_NUMBER_UNPACK m7))
+#define _GMP_NUMBER_DIV_SEARCH_5_9_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r) _GMP_NUMBER_DIV_SEARCH_5_9_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r)
+#define _GMP_NUMBER_DIV_SEARCH_5_9_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, borrow, next) _GMP_NUMBER_DIV_SEARCH_5_9_ ## borrow(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next)
+#define _GMP_NUMBER_DIV_SEARCH_5_9_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_7_9(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, next)
+#define _GMP_NUMBER_DIV_SEARCH_5_9_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_5_6(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff)
+#define _GMP_NUMBER_DIV_SEARCH_7_9(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) \
+    _GMP_NUMBER_DIV_SEARCH_7_9_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, _GMP_NUMBER_DIV_SUB(_GMP_NUMBER_UNPACK p, _GMP_NUMBER_UNPACK m8))
+#define _GMP_NUMBER_DIV_SEARCH_7_9_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r) _GMP_NUMBER_DIV_SEARCH_7_9_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r)
+#define _GMP_NUMBER_DIV_SEARCH_7_9_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, borrow, next) _GMP_NUMBER_DIV_SEARCH_7_9_ ## borrow(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next)
+#define _GMP_NUMBER_DIV_SEARCH_7_9_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_8_9(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, next)
+#define _GMP_NUMBER_DIV_SEARCH_7_9_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_7_7(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff)
+#define _GMP_NUMBER_DIV_SEARCH_8_9(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) \
+    _GMP_NUMBER_DIV_SEARCH_8_9_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, _GMP_NUMBER_DIV_SUB(_GMP_NUMBER_UNPACK p, _GMP_NUMBER_UNPACK m9))
+#define _GMP_NUMBER_DIV_SEARCH_8_9_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r) _GMP_NUMBER_DIV_SEARCH_8_9_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r)
+#define _GMP_NUMBER_DIV_SEARCH_8_9_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, borrow, next) _GMP_NUMBER_DIV_SEARCH_8_9_ ## borrow(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next)
+#define _GMP_NUMBER_DIV_SEARCH_8_9_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_9_9(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, next)
+#define _GMP_NUMBER_DIV_SEARCH_8_9_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_8_8(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff)
+#define _GMP_NUMBER_DIV_SEARCH_9_9(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 9, _GMP_NUMBER_DIV_LOW diff
+#define _GMP_NUMBER_DIV_SEARCH_8_8(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 8, _GMP_NUMBER_DIV_LOW diff
+#define _GMP_NUMBER_DIV_SEARCH_7_7(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 7, _GMP_NUMBER_DIV_LOW diff
+#define _GMP_NUMBER_DIV_SEARCH_5_6(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) \
+    _GMP_NUMBER_DIV_SEARCH_5_6_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, _GMP_NUMBER_DIV_SUB(_GMP_NUMBER_UNPACK p, _GMP_NUMBER_UNPACK m6))
+#define _GMP_NUMBER_DIV_SEARCH_5_6_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r) _GMP_NUMBER_DIV_SEARCH_5_6_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r)
+#define _GMP_NUMBER_DIV_SEARCH_5_6_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, borrow, next) _GMP_NUMBER_DIV_SEARCH_5_6_ ## borrow(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next)
+#define _GMP_NUMBER_DIV_SEARCH_5_6_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_6_6(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, next)
+#define _GMP_NUMBER_DIV_SEARCH_5_6_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_5_5(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff)
+#define _GMP_NUMBER_DIV_SEARCH_6_6(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 6, _GMP_NUMBER_DIV_LOW diff
+#define _GMP_NUMBER_DIV_SEARCH_5_5(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 5, _GMP_NUMBER_DIV_LOW diff
+#define _GMP_NUMBER_DIV_SEARCH_0_4(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) \
+    _GMP_NUMBER_DIV_SEARCH_0_4_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, _GMP_NUMBER_DIV_SUB(_GMP_NUMBER_UNPACK p, _GMP_NUMBER_UNPACK m2))
+#define _GMP_NUMBER_DIV_SEARCH_0_4_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r) _GMP_NUMBER_DIV_SEARCH_0_4_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r)
+#define _GMP_NUMBER_DIV_SEARCH_0_4_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, borrow, next) _GMP_NUMBER_DIV_SEARCH_0_4_ ## borrow(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next)
+#define _GMP_NUMBER_DIV_SEARCH_0_4_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_2_4(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, next)
+#define _GMP_NUMBER_DIV_SEARCH_0_4_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_0_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff)
+#define _GMP_NUMBER_DIV_SEARCH_2_4(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) \
+    _GMP_NUMBER_DIV_SEARCH_2_4_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, _GMP_NUMBER_DIV_SUB(_GMP_NUMBER_UNPACK p, _GMP_NUMBER_UNPACK m3))
+#define _GMP_NUMBER_DIV_SEARCH_2_4_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r) _GMP_NUMBER_DIV_SEARCH_2_4_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r)
+#define _GMP_NUMBER_DIV_SEARCH_2_4_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, borrow, next) _GMP_NUMBER_DIV_SEARCH_2_4_ ## borrow(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next)
+#define _GMP_NUMBER_DIV_SEARCH_2_4_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_3_4(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, next)
+#define _GMP_NUMBER_DIV_SEARCH_2_4_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_2_2(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff)
+#define _GMP_NUMBER_DIV_SEARCH_3_4(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) \
+    _GMP_NUMBER_DIV_SEARCH_3_4_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, _GMP_NUMBER_DIV_SUB(_GMP_NUMBER_UNPACK p, _GMP_NUMBER_UNPACK m4))
+#define _GMP_NUMBER_DIV_SEARCH_3_4_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r) _GMP_NUMBER_DIV_SEARCH_3_4_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r)
+#define _GMP_NUMBER_DIV_SEARCH_3_4_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, borrow, next) _GMP_NUMBER_DIV_SEARCH_3_4_ ## borrow(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next)
+#define _GMP_NUMBER_DIV_SEARCH_3_4_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_4_4(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, next)
+#define _GMP_NUMBER_DIV_SEARCH_3_4_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_3_3(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff)
+#define _GMP_NUMBER_DIV_SEARCH_4_4(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 4, _GMP_NUMBER_DIV_LOW diff
+#define _GMP_NUMBER_DIV_SEARCH_3_3(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 3, _GMP_NUMBER_DIV_LOW diff
+#define _GMP_NUMBER_DIV_SEARCH_2_2(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 2, _GMP_NUMBER_DIV_LOW diff
+#define _GMP_NUMBER_DIV_SEARCH_0_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) \
+    _GMP_NUMBER_DIV_SEARCH_0_1_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, _GMP_NUMBER_DIV_SUB(_GMP_NUMBER_UNPACK p, _GMP_NUMBER_UNPACK m1))
+#define _GMP_NUMBER_DIV_SEARCH_0_1_R(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r) _GMP_NUMBER_DIV_SEARCH_0_1_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, r)
+#define _GMP_NUMBER_DIV_SEARCH_0_1_I(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, borrow, next) _GMP_NUMBER_DIV_SEARCH_0_1_ ## borrow(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next)
+#define _GMP_NUMBER_DIV_SEARCH_0_1_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_1_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, next)
+#define _GMP_NUMBER_DIV_SEARCH_0_1_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff, next) _GMP_NUMBER_DIV_SEARCH_0_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff)
+#define _GMP_NUMBER_DIV_SEARCH_1_1(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 1, _GMP_NUMBER_DIV_LOW diff
+#define _GMP_NUMBER_DIV_SEARCH_0_0(p, m1, m2, m3, m4, m5, m6, m7, m8, m9, diff) 0, _GMP_NUMBER_DIV_LOW diff
+
+
+/**
+ * \def GMP_NUMBER_TO_LITERAL(n)
+ * \brief Convert a number to an integer literal.
+ *
+ * Leading zeros are dropped, so that the literal is never read as octal.
+ *
+ * \code
+ * GMP_NUMBER_TO_LITERAL((1, 0, 2, 4)) // 1024
+ * GMP_NUMBER_TO_LITERAL((0, 0, 0, 8)) // 8
+ * \endcode
+ */
+#define GMP_NUMBER_TO_LITERAL(n) _GMP_NUMBER_TO_LITERAL n
+#define _GMP_NUMBER_TO_LITERAL(a, b, c, d) _GMP_NUMBER_LITERAL_4_ ## a(a, b, c, d)
+#define _GMP_NUMBER_LITERAL_4_0(a, b, c, d) _GMP_NUMBER_LITERAL_3_ ## b(b, c, d)
+#define _GMP_NUMBER_LITERAL_4_1(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_LITERAL_4_2(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_LITERAL_4_3(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_LITERAL_4_4(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_LITERAL_4_5(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_LITERAL_4_6(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_LITERAL_4_7(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_LITERAL_4_8(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_LITERAL_4_9(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_LITERAL_3_0(b, c, d) _GMP_NUMBER_LITERAL_2_ ## c(c, d)
+#define _GMP_NUMBER_LITERAL_3_1(b, c, d) b ## c ## d
+#define _GMP_NUMBER_LITERAL_3_2(b, c, d) b ## c ## d
+#define _GMP_NUMBER_LITERAL_3_3(b, c, d) b ## c ## d
+#define _GMP_NUMBER_LITERAL_3_4(b, c, d) b ## c ## d
+#define _GMP_NUMBER_LITERAL_3_5(b, c, d) b ## c ## d
+#define _GMP_NUMBER_LITERAL_3_6(b, c, d) b ## c ## d
+#define _GMP_NUMBER_LITERAL_3_7(b, c, d) b ## c ## d
+#define _GMP_NUMBER_LITERAL_3_8(b, c, d) b ## c ## d
+#define _GMP_NUMBER_LITERAL_3_9(b, c, d) b ## c ## d
+#define _GMP_NUMBER_LITERAL_2_0(c, d) d
+#define _GMP_NUMBER_LITERAL_2_1(c, d) c ## d
+#define _GMP_NUMBER_LITERAL_2_2(c, d) c ## d
+#define _GMP_NUMBER_LITERAL_2_3(c, d) c ## d
+#define _GMP_NUMBER_LITERAL_2_4(c, d) c ## d
+#define _GMP_NUMBER_LITERAL_2_5(c, d) c ## d
+#define _GMP_NUMBER_LITERAL_2_6(c, d) c ## d
+#define _GMP_NUMBER_LITERAL_2_7(c, d) c ## d
+#define _GMP_NUMBER_LITERAL_2_8(c, d) c ## d
+#define _GMP_NUMBER_LITERAL_2_9(c, d) c ## d
+
+
+/*
+ * Arithmetic on integer literals.
+ *
+ * The operands are values in [0, GMP_MAX_INDEX], such as loop counts and
+ * indices; they are converted to numbers, and the result back to a literal,
+ * which may exceed GMP_MAX_INDEX. An operand past GMP_MAX_INDEX expands to
+ * the error of GMP_CHECK_INDEX. A result that is negative, exceeds
+ * GMP_MAX_NUMBER or divides by zero is not a value: like GMP_CHECK_INDEX,
+ * the operation expands to an identifier naming the error, followed by a
+ * semicolon, which fails to compile both in code and in #if.
+ */
+
+// Calls op(x, y) if both operands are in [0, GMP_MAX_INDEX], otherwise
+// expands to the GMP_CHECK_INDEX error of the first one that is not.
+#define _GMP_LITERAL_OP(op, x, y) GMP_OVERLOAD_INVOKE2(_GMP_LITERAL_PRECHECK, \
+    GMP_CHECK_INDEX_BOOL(x), GMP_CHECK_INDEX_BOOL(y))(op, x, y)
+#define _GMP_LITERAL_PRECHECK_1_1(op, x, y) op(x, y)
+#define _GMP_LITERAL_PRECHECK_0_1(op, x, y) GMP_CHECK_INDEX(x)
+#define _GMP_LITERAL_PRECHECK_1_0(op, x, y) GMP_CHECK_INDEX(y)
+#define _GMP_LITERAL_PRECHECK_0_0(op, x, y) GMP_CHECK_INDEX(x)
+
+/**
+ * \def GMP_ADD(x, y)
+ * \brief Add two values.
+ *
+ * \code
+ * GMP_ADD(200, 54)  // 254
+ * \endcode
+ */
+#define GMP_ADD(x, y) _GMP_LITERAL_OP(_GMP_ADD_CHECKED, x, y)
+#define _GMP_ADD_CHECKED(x, y) GMP_NUMBER_TO_LITERAL(GMP_NUMBER_ADD(GMP_NUMBER_FROM_INT(x), GMP_NUMBER_FROM_INT(y)))
+
+/**
+ * \def GMP_SUB(x, y)
+ * \brief Subtract a value from another, not greater than it.
+ *
+ * \code
+ * GMP_SUB(64, 16)   // 48
+ * GMP_SUB(3, 10)    // Error_Subtraction_3_Minus_10_Is_Negative;
+ * \endcode
+ */
+#define GMP_SUB(x, y) _GMP_LITERAL_OP(_GMP_SUB_CHECKED, x, y)
+#define _GMP_SUB_CHECKED(x, y) _GMP_SUB(x, y, _GMP_NUMBER_SUB(_GMP_NUMBER_FROM_INT_UNPACKED(x), _GMP_NUMBER_FROM_INT_UNPACKED(y)))
+#define _GMP_SUB(x, y, r) _GMP_SUB_I(x, y, r)
+#define _GMP_SUB_I(x, y, borrow, n) _GMP_SUB_ ## borrow(x, y, n)
+#define _GMP_SUB_0(x, y, n) GMP_NUMBER_TO_LITERAL(n)
+#define _GMP_SUB_1(x, y, n) Error_Subtraction_##x##_Minus_##y##_Is_Negative;
+#define _GMP_NUMBER_FROM_INT_UNPACKED(value) _GMP_NUMBER_UNPACK_NUMBER(GMP_NUMBER_FROM_INT(value))
+#define _GMP_NUMBER_UNPACK_NUMBER(n) _GMP_NUMBER_UNPACK n
+
+/**
+ * \def GMP_MUL(x, y)
+ * \brief Multiply two values.
+ *
+ * \code
+ * GMP_MUL(16, 32)   // 512
+ * GMP_MUL(100, 200) // Error_Product_Of_100_And_200_Exceeds_Maximum_Number_9999;
+ * \endcode
+ */
+#define GMP_MUL(x, y) _GMP_LITERAL_OP(_GMP_MUL_CHECKED, x, y)
+#define _GMP_MUL_CHECKED(x, y) _GMP_MUL(x, y, _GMP_NUMBER_MUL_SPILL(_GMP_NUMBER_FROM_INT_UNPACKED(x), _GMP_NUMBER_FROM_INT_UNPACKED(y)))
+#define _GMP_MUL(x, y, r) _GMP_MUL_I(x, y, r)
+#define _GMP_MUL_I(x, y, spill, n) GMP_CONCAT(_GMP_MUL_, _GMP_NUMBER_PROBE(_GMP_NUMBER_FITS_ ## spill))(x, y, n)
+#define _GMP_MUL_1(x, y, n) GMP_NUMBER_TO_LITERAL(n)
+#define _GMP_MUL_0(x, y, n) Error_Product_Of_##x##_And_##y##_Exceeds_Maximum_Number_9999;
+#define _GMP_NUMBER_FITS_0000000000000 ~, 1
+
+// GMP_NUMBER_MUL preceded by the digits it drops: the ones shifted out of the
+// partial products and the carries of their sum, pasted into a single
+// pp-number. They are all zero exactly when the product is in range.
+#define _GMP_NUMBER_MUL_SPILL(...) _GMP_NUMBER_MUL_SPILL_I(__VA_ARGS__)
+#define _GMP_NUMBER_MUL_SPILL_I(x0, x1, x2, x3, y0, y1, y2, y3) \
+    _GMP_NUMBER_MUL_SPILL_SUM(_GMP_NUMBER_SCALE(y3, x0, x1, x2, x3), _GMP_NUMBER_SCALE(y2, x0, x1, x2, x3), \
+                              _GMP_NUMBER_SCALE(y1, x0, x1, x2, x3), _GMP_NUMBER_SCALE(y0, x0, x1, x2, x3))
+#define _GMP_NUMBER_MUL_SPILL_SUM(p0, p1, p2, p3) \
+    _GMP_NUMBER_MUL_SPILL_1(_GMP_NUMBER_SPILL(p0, p1, p2, p3), p2, p3, \
+                            _GMP_NUMBER_ADD_CARRY(_GMP_NUMBER_SHIFT_0 p0, _GMP_NUMBER_SHIFT_1 p1))
+#define _GMP_NUMBER_MUL_SPILL_1(s, p2, p3, r) _GMP_NUMBER_MUL_SPILL_1_I(s, p2, p3, r)
+#define _GMP_NUMBER_MUL_SPILL_1_I(s, p2, p3, c1, n) \
+    _GMP_NUMBER_MUL_SPILL_2(s, c1, p3, _GMP_NUMBER_ADD_CARRY(n, _GMP_NUMBER_SHIFT_2 p2))
+#define _GMP_NUMBER_MUL_SPILL_2(s, c1, p3, r) _GMP_NUMBER_MUL_SPILL_2_I(s, c1, p3, r)
+#define _GMP_NUMBER_MUL_SPILL_2_I(s, c1, p3, c2, n) \
+    _GMP_NUMBER_MUL_SPILL_3(s, c1, c2, _GMP_NUMBER_ADD_CARRY(n, _GMP_NUMBER_SHIFT_3 p3))
+#define _GMP_NUMBER_MUL_SPILL_3(s, c1, c2, r) _GMP_NUMBER_MUL_SPILL_3_I(s, c1, c2, r)
+#define _GMP_NUMBER_MUL_SPILL_3_I(s, c1, c2, c3, n) _GMP_NUMBER_PASTE4(s, c1, c2, c3), n
+#define _GMP_NUMBER_SPILL(p0, p1, p2, p3) \
+    _GMP_NUMBER_SPILL_I(_GMP_NUMBER_SPILL_0 p0, _GMP_NUMBER_SPILL_1 p1, _GMP_NUMBER_SPILL_2 p2, _GMP_NUMBER_SPILL_3 p3)
+#define _GMP_NUMBER_SPILL_I(a, b, c, d) _GMP_NUMBER_PASTE4(a, b, c, d)
+#define _GMP_NUMBER_SPILL_0(d0, d1, d2, d3, d4) d0
+#define _GMP_NUMBER_SPILL_1(d0, d1, d2, d3, d4) d0 ## d1
+#define _GMP_NUMBER_SPILL_2(d0, d1, d2, d3, d4) d0 ## d1 ## d2
+#define _GMP_NUMBER_SPILL_3(d0, d1, d2, d3, d4) d0 ## d1 ## d2 ## d3
+#define _GMP_NUMBER_PASTE4(a, b, c, d) a ## b ## c ## d
+#define _GMP_NUMBER_ADD_CARRY(x, y) _GMP_NUMBER_ADD(_GMP_NUMBER_UNPACK x, _GMP_NUMBER_UNPACK y)
+
+// 1 if the argument expands to "~, 1", otherwise 0
+#define _GMP_NUMBER_PROBE(...) _GMP_NUMBER_PROBE_I(__VA_ARGS__, 0, )
+#define _GMP_NUMBER_PROBE_I(x, r, ...) r
+
+/**
+ * \def GMP_DIV(x, y)
+ * \brief Divide a value by another, non-zero, rounding towards zero.
+ *
+ * \code
+ * GMP_DIV(100, 7)   // 14
+ * GMP_DIV(100, 0)   // Error_Division_Of_100_By_Zero;
+ * \endcode
+ */
+#define GMP_DIV(x, y) _GMP_LITERAL_OP(_GMP_DIV_CHECKED, x, y)
+#define _GMP_DIV_CHECKED(x, y) GMP_CONCAT(_GMP_DIV_, _GMP_NUMBER_PROBE(GMP_CONCAT(_GMP_NUMBER_ZERO_, y)))(x, y)
+#define _GMP_DIV_0(x, y) GMP_NUMBER_TO_LITERAL(GMP_NUMBER_DIV(GMP_NUMBER_FROM_INT(x), GMP_NUMBER_FROM_INT(y)))
+#define _GMP_DIV_1(x, y) _GMP_DIVISION_BY_ZERO(x)
+#define _GMP_DIVISION_BY_ZERO(x) Error_Division_Of_##x##_By_Zero;
+#define _GMP_NUMBER_ZERO_0 ~, 1
+
+/**
+ * \def GMP_MOD(x, y)
+ * \brief The remainder of the division of a value by another, non-zero.
+ *
+ * \code
+ * GMP_MOD(100, 7)   // 2
+ * GMP_MOD(100, 0)   // Error_Division_Of_100_By_Zero;
+ * \endcode
+ */
+#define GMP_MOD(x, y) _GMP_LITERAL_OP(_GMP_MOD_CHECKED, x, y)
+#define _GMP_MOD_CHECKED(x, y) GMP_CONCAT(_GMP_MOD_, _GMP_NUMBER_PROBE(GMP_CONCAT(_GMP_NUMBER_ZERO_, y)))(x, y)
+#define _GMP_MOD_0(x, y) GMP_NUMBER_TO_LITERAL(GMP_NUMBER_MOD(GMP_NUMBER_FROM_INT(x), GMP_NUMBER_FROM_INT(y)))
+#define _GMP_MOD_1(x, y) _GMP_DIVISION_BY_ZERO(x)
+
+/**
+ * \def GMP_MIN(x, y)
+ * \brief The smaller of two values.
+ *
+ * \code
+ * GMP_MIN(3, 8)     // 3
+ * \endcode
+ */
+#define GMP_MIN(x, y) _GMP_LITERAL_OP(_GMP_MIN_CHECKED, x, y)
+#define _GMP_MIN_CHECKED(x, y) GMP_NUMBER_TO_LITERAL(GMP_NUMBER_MIN(GMP_NUMBER_FROM_INT(x), GMP_NUMBER_FROM_INT(y)))
+
+/**
+ * \def GMP_MAX(x, y)
+ * \brief The larger of two values.
+ *
+ * \code
+ * GMP_MAX(3, 8)     // 8
+ * \endcode
+ */
+#define GMP_MAX(x, y) _GMP_LITERAL_OP(_GMP_MAX_CHECKED, x, y)
+#define _GMP_MAX_CHECKED(x, y) GMP_NUMBER_TO_LITERAL(GMP_NUMBER_MAX(GMP_NUMBER_FROM_INT(x), GMP_NUMBER_FROM_INT(y)))
+
+/**
+ * \def GMP_LESS(x, y)
+ * \brief Check if a value is less than another.
+ *
+ * \return 1 if \a x is less than \a y, otherwise 0.
+ */
+#define GMP_LESS(x, y) _GMP_LITERAL_OP(_GMP_LESS_CHECKED, x, y)
+#define _GMP_LESS_CHECKED(x, y) GMP_NUMBER_LESS(GMP_NUMBER_FROM_INT(x), GMP_NUMBER_FROM_INT(y))
+
+
+#endif // GMP_MACRO_NUMBER_HPP_
@@ -0,0 +1,56 @@
+/**
+ * \file repeat.hpp
+ * \brief Counted repetition with the index of every iteration.
+ */
+#ifndef GMP_MACRO_REPEAT_HPP_
+#define GMP_MACRO_REPEAT_HPP_
+
+#include <gmp/macro/loop.hpp>
+#include _GMP_LIMIT_REPEAT_TABLES
+
+
+/**
+ * \def GMP_REPEAT(count, call, data)
+ * \brief Call a macro with each index in [0, count).
+ *
+ * Expands to `call(0, data) call(1, data) ... call(count - 1, data)`. Unlike
+ * \ref GMP_LOOP, every call gets its own index, so the iterations can differ;
+ * the indices are literals taken from a table, not computed.
+ *
+ * \param count The number of calls, at most \ref GMP_MAX_INDEX.
+ * \param call The macro to be called for each index.
+ * \param data A value passed unchanged to every call.
+ *
+ * \par Example
+ * \code
+ * #define LANE(i, v) v[i] = a[i] + b[i];
+ * GMP_REPEAT(4, LANE, out) // out[0] = a[0] + b[0]; ... out[3] = a[3] + b[3];
+ * \endcode
+ */
+#define GMP_REPEAT(count, call, data) GMP_OVERLOAD_INVOKE1(_GMP_REPEAT_PRECHECK, GMP_CHECK_INDEX_BOOL(count))(count, call, data)
+#define _GMP_REPEAT_PRECHECK_1(count, call, data) GMP_CONCAT(_GMP_REPEAT_, count)(call, data)
+#define _GMP_REPEAT_PRECHECK_0(count, call, data) GMP_CHECK_INDEX(count)
+
+/**
+ * \def GMP_REPEAT_FROM(begin, end, call, data)
+ * \brief Call a macro with each index in [begin, end).
+ *
+ * Both bounds are at most \ref GMP_MAX_INDEX; a bound past it expands to the
+ * error of \ref GMP_CHECK_INDEX. An empty range expands to nothing.
+ *
+ * \code
+ * #define CASE(i, f) case i: return f<i>();
+ * GMP_REPEAT_FROM(1, 3, CASE, g) // case 1: return g<1>(); case 2: return g<2>();
+ * \endcode
+ */
+#define GMP_REPEAT_FROM(begin, end, call, data) GMP_OVERLOAD_INVOKE2(_GMP_REPEAT_FROM_PRECHECK, \
+    GMP_CHECK_INDEX_BOOL(begin), GMP_CHECK_INDEX_BOOL(end))(begin, end, call, data)
+#define _GMP_REPEAT_FROM_PRECHECK_1_1(begin, end, call, data) \
+    _GMP_REPEAT_FROM_IMPL(begin, GMP_SIZE_OF_VAARGS(GMP_RANGE(begin, end)), call, data)
+#define _GMP_REPEAT_FROM_PRECHECK_0_1(begin, end, call, data) GMP_CHECK_INDEX(begin)
+#define _GMP_REPEAT_FROM_PRECHECK_1_0(begin, end, call, data) GMP_CHECK_INDEX(end)
+#define _GMP_REPEAT_FROM_PRECHECK_0_0(begin, end, call, data) GMP_CHECK_INDEX(begin)
+#define _GMP_REPEAT_FROM_IMPL(begin, count, call, data) GMP_CONCAT(_GMP_REPEAT_FROM_, count)(call, data, begin)
+
+
+#endif // GMP_MACRO_REPEAT_HPP_
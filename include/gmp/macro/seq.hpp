@@ -0,0 +1,125 @@
+/**
+ * \file seq.hpp
+ * \brief Sequences of the form `(a)(b)(c)`.
+ *
+ * A sequence is a series of parenthesized elements. Unlike an argument list,
+ * its length is not bounded by the number of arguments a macro can take, and
+ * walking it costs one expansion per element: every operation here visits
+ * the elements once and never scans the placeholder tables of
+ * \ref GMP_SIZE_OF_VAARGS. An element may contain commas, e.g.
+ * `(name, int)(size, long)`, and is then passed as several arguments.
+ *
+ * Sequences are limited to \ref GMP_SEQ_MAX_SIZE elements, 1024 by default.
+ * A longer sequence makes every operation expand to
+ * `Error_Sequence_Exceeds_Maximum_Sequence_Size_N;`, N being that maximum.
+ */
+#ifndef GMP_MACRO_SEQ_HPP_
+#define GMP_MACRO_SEQ_HPP_
+
+#include <gmp/macro/varargs.hpp>
+#include _GMP_LIMIT_SEQ_TABLES
+
+
+/**
+ * \def GMP_SEQ_SIZE(seq)
+ * \brief The number of elements of a sequence.
+ *
+ * \code
+ * GMP_SEQ_SIZE((a)(b, c)(d)) // 3
+ * \endcode
+ */
+#define GMP_SEQ_SIZE(seq) _GMP_SEQ_CHECKED(_GMP_SEQ_SIZE_OF(seq), _GMP_SEQ_SIZE_OK, ~)
+#define _GMP_SEQ_SIZE_OK(size, ...) size
+
+// The size of a sequence, or _GMP_SEQ_OVERFLOW if it is longer than the
+// tables: the element after the last one alternates between two macros until
+// the sequence ends.
+#define _GMP_SEQ_SIZE_OF(seq) GMP_CONCAT(_GMP_SEQ_SIZE_, _GMP_SEQ_SIZE_0 seq)
+#define _GMP_SEQ_SIZE_OVERFLOW_A(...) _GMP_SEQ_SIZE_OVERFLOW_B
+#define _GMP_SEQ_SIZE_OVERFLOW_B(...) _GMP_SEQ_SIZE_OVERFLOW_A
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_OVERFLOW_A _GMP_SEQ_OVERFLOW
+#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_OVERFLOW_B _GMP_SEQ_OVERFLOW
+
+// Calls then(size, ...), or reports the overflow in place of the result.
+#define _GMP_SEQ_CHECKED(size, then, ...) \
+    GMP_OVERLOAD_INVOKE1(_GMP_SEQ_CHECKED, GMP_HAS_COMMA(GMP_CONCAT(_GMP_SEQ_OVERFLOWS_, size)))(then)(size, __VA_ARGS__)
+#define _GMP_SEQ_OVERFLOWS__GMP_SEQ_OVERFLOW ,
+#define _GMP_SEQ_CHECKED_0(then) then
+#define _GMP_SEQ_CHECKED_1(then) _GMP_SEQ_ERROR
+#define _GMP_SEQ_ERROR(...) _GMP_SEQ_ERROR_MSG(GMP_SEQ_MAX_SIZE)
+#define _GMP_SEQ_ERROR_MSG(maximum) _GMP_SEQ_ERROR_MSG_IMPL(maximum)
+#define _GMP_SEQ_ERROR_MSG_IMPL(maximum) Error_Sequence_Exceeds_Maximum_Sequence_Size_##maximum;
+
+/**
+ * \def GMP_SEQ_ELEM(i, seq)
+ * \brief The element at index \a i of a sequence, without its parentheses.
+ *
+ * \note \a i must be less than the size of the sequence.
+ *
+ * \code
+ * GMP_SEQ_ELEM(1, (a)(b, c)(d)) // b, c
+ * \endcode
+ */
+#define GMP_SEQ_ELEM(i, seq) _GMP_SEQ_ELEM_I(GMP_CONCAT(_GMP_SEQ_ELEM_, i) seq)
+#define _GMP_SEQ_ELEM_I(...) GMP_EXPAND( _GMP_SEQ_ELEM_II(__VA_ARGS__) )
+#define _GMP_SEQ_ELEM_II(x, ...) _GMP_SEQ_STRIP x
+#define _GMP_SEQ_STRIP(...) __VA_ARGS__
+
+/**
+ * \def GMP_SEQ_FOR_EACH(call, data, seq)
+ * \brief Call a macro for each element of a sequence.
+ *
+ * Expands to `call(data, 0, a) call(data, 1, b) ...`, the element being
+ * passed without its parentheses.
+ *
+ * \par Example
+ * \code
+ * #define FIELDS (id, int)(name, std::string)(score, double)
+ * #define DECLARE(data, i, name, type) type name;
+ * struct row { GMP_SEQ_FOR_EACH(DECLARE, ~, FIELDS) };
+ * \endcode
+ */
+#define GMP_SEQ_FOR_EACH(call, data, seq) \
+    _GMP_SEQ_CHECKED(_GMP_SEQ_SIZE_OF(seq), _GMP_SEQ_FOR_EACH_IMPL, call, data, GMP_EMPTY, seq)
+
+/**
+ * \def GMP_SEQ_TO_VARARGS(seq)
+ * \brief The elements of a sequence as a comma-separated list.
+ *
+ * \code
+ * GMP_SEQ_TO_VARARGS((a)(b)(c)) // a, b, c
+ * \endcode
+ */
+#define GMP_SEQ_TO_VARARGS(seq) \
+    _GMP_SEQ_CHECKED(_GMP_SEQ_SIZE_OF(seq), _GMP_SEQ_FOR_EACH_IMPL, _GMP_SEQ_TO_VARARGS_ITEM, ~, _GMP_SEQ_COMMA, seq)
+#define _GMP_SEQ_TO_VARARGS_ITEM(data, i, ...) __VA_ARGS__
+
+/**
+ * \def GMP_SEQ_FOLD(op, state, seq)
+ * \brief Left fold of a sequence.
+ *
+ * Expands to `op(op(op(state, a), b), c)` for `(a)(b)(c)`. Every call is
+ * expanded before it is passed on, so the state stays as short as \a op
+ * makes it.
+ *
+ * \code
+ * #define PLUS(s, x) (s + x)
+ * GMP_SEQ_FOLD(PLUS, 0, (1)(2)(3)) // (((0 + 1) + 2) + 3)
+ * \endcode
+ */
+#define GMP_SEQ_FOLD(op, state, seq) _GMP_SEQ_CHECKED(_GMP_SEQ_SIZE_OF(seq), _GMP_SEQ_FOLD_IMPL, op, state, seq)
+#define _GMP_SEQ_FOLD_IMPL(size, op, state, seq) \
+    _GMP_SEQ_SCAN( GMP_CONCAT(_GMP_SEQ_FOLD_, size) _GMP_SEQ_LPAREN() op, state, _GMP_SEQ_INDEX_0 seq _GMP_SEQ_RPAREN() )
+
+// The ladder is opened here and _GMP_SEQ_INDEX_0 rewrites the sequence into
+// its remaining arguments, "0, a) 1, b) ...". The parentheses only become
+// tokens in the argument of _GMP_SEQ_SCAN, so that the rescan invokes the ladder.
+#define _GMP_SEQ_FOR_EACH_IMPL(size, call, data, sep, seq) \
+    _GMP_SEQ_SCAN( GMP_CONCAT(_GMP_SEQ_FOR_EACH_, size) _GMP_SEQ_LPAREN() call, data, sep, _GMP_SEQ_INDEX_0 seq _GMP_SEQ_RPAREN() )
+#define _GMP_SEQ_SCAN(...) __VA_ARGS__
+#define _GMP_SEQ_LPAREN() (
+#define _GMP_SEQ_RPAREN() )
+#define _GMP_SEQ_COMMA() ,
+
+
+#endif // GMP_MACRO_SEQ_HPP_
@@ -0,0 +1,65 @@
+/**
+ * \file tuple.hpp
+ * \brief Parenthesized lists of elements, `(a, b, c)`.
+ *
+ * Tuples are the entries of tables such as `(name, type, offset)`. Their
+ * elements are selected directly by macros with the right number of
+ * parameters, without a loop over the elements before them.
+ */
+#ifndef GMP_MACRO_TUPLE_HPP_
+#define GMP_MACRO_TUPLE_HPP_
+
+#include <gmp/macro/for_each.hpp>
+#include _GMP_LIMIT_TUPLE_TABLES
+
+
+/**
+ * \def GMP_TUPLE_SIZE(tuple)
+ * \brief The number of elements of a tuple.
+ *
+ * \code
+ * GMP_TUPLE_SIZE((id, int, 0)) // 3
+ * GMP_TUPLE_SIZE(())           // 0
+ * \endcode
+ */
+#define GMP_TUPLE_SIZE(tuple) GMP_SIZE_OF_VAARGS tuple
+
+/**
+ * \def GMP_TUPLE_ELEM(i, tuple)
+ * \brief The element at index \a i of a tuple.
+ *
+ * Indices below 16 take a single expansion; larger ones drop 16 elements
+ * per step.
+ *
+ * \param i The index of the element, less than the size of the tuple.
+ * \param tuple The tuple, with its parentheses.
+ *
+ * \par Example
+ * \code
+ * #define FIELD_TYPE(field) GMP_TUPLE_ELEM(1, field)
+ * FIELD_TYPE((id, int, 0)) // int
+ * \endcode
+ */
+#define GMP_TUPLE_ELEM(i, tuple) GMP_CONCAT(_GMP_TUPLE_ELEM_, i) tuple
+
+/**
+ * \def GMP_ZIP(lhs, rhs)
+ * \brief Pair the elements of two tuples.
+ *
+ * Expands to the comma-separated pairs `(lhs_i, rhs_i)`, one per element of
+ * \a lhs; \a rhs must be at least as long. The pairs are built in a single
+ * pass that peels one element off each tuple per step, so zipping N elements
+ * takes N steps rather than an index lookup per element.
+ *
+ * \code
+ * GMP_ZIP((x, y), (int, float)) // (x, int), (y, float)
+ * \endcode
+ */
+#define GMP_ZIP(lhs, rhs) _GMP_ZIP_IMPL(rhs, _GMP_TUPLE_UNPACK lhs)
+#define _GMP_ZIP_IMPL(rhs, ...) \
+    GMP_EXPAND( GMP_OVERLOAD_INVOKE1(_GMP_ZIP, GMP_SIZE_OF_VAARGS(__VA_ARGS__))(rhs, __VA_ARGS__) )
+#define _GMP_TUPLE_REST(x, ...) __VA_ARGS__
+#define _GMP_TUPLE_UNPACK(...) __VA_ARGS__
+
+
+#endif // GMP_MACRO_TUPLE_HPP_
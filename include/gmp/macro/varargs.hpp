@@ -0,0 +1,205 @@
+/**
+ * \file varargs.hpp
+ * \brief Counting, emptiness checks and overload dispatch on argument lists.
+ */
+#ifndef GMP_MACRO_VARARGS_HPP_
+#define GMP_MACRO_VARARGS_HPP_
+
+#include <gmp/macro/core.hpp>
+
+
+/**
+ * \def GMP_MAX_INDEX
+ * \brief Largest argument count and index handled by the macros.
+ *
+ * Every table behind the counting, iteration and arithmetic macros has
+ * GMP_MAX_INDEX entries, so this value sets both what they can handle and
+ * how much the preprocessor parses for each include. It defaults to 254 and
+ * may be defined to 64 or 1024 before including any gmp header; the value
+ * must be the same in every translation unit of a program.
+ *
+ * The tables are generated for each supported value by
+ * tools/generate_macro_tables.py into gmp/macro/limits/.
+ */
+#ifndef GMP_MAX_INDEX
+#define GMP_MAX_INDEX 254
+#endif
+
+#include <gmp/macro/limits/select.hpp>
+#include _GMP_LIMIT_VARARGS_TABLES
+
+/**
+ * \def GMP_HAS_VA_OPT
+ * \brief 1 if the preprocessor supports `__VA_OPT__`, otherwise 0.
+ *
+ * With `__VA_OPT__`, \ref GMP_IS_EMPTY and \ref GMP_OPT_COMMA cost a single
+ * expansion instead of five scans of the \ref GMP_HAS_COMMA placeholder list.
+ * The value is detected unless it is defined before including this header.
+ * MSVC's traditional preprocessor always takes the portable path.
+ */
+#ifndef GMP_HAS_VA_OPT
+#  if defined(_MSVC_TRADITIONAL) && _MSVC_TRADITIONAL
+#    define GMP_HAS_VA_OPT 0
+#  else
+#    define GMP_HAS_VA_OPT _GMP_VA_OPT_PROBE(?)
+#  endif
+#endif
+#define _GMP_VA_OPT_PROBE(...) _GMP_VA_OPT_PROBE_RESULT(__VA_OPT__(,), 1, 0, )
+#define _GMP_VA_OPT_PROBE_RESULT(_0, _1, R, ...) R
+
+
+/**
+ * \brief Get the number of variable arguments.
+ *
+ * This macro calculates the number of variable arguments passed to it by expanding
+ * all arguments recursively until the last one is found, determining the count of arguments.
+ *
+ * \param ... Variable argument list
+ * \return Number of arguments
+ */
+#define GMP_GET_VARARGS(...) GMP_EXPAND( _GMP_GET_VARARGS_IMPL(__VA_ARGS__) )
+
+/**
+ * \def GMP_SIZE_OF_VAARGS(...)
+ * \brief Get the size of variable arguments.
+ * 
+ * \param ... Variable argument list
+ * \return Size of arguments
+ * 
+ * \par Example
+ * \code
+ * GMP_SIZE_OF_VAARGS()                      // 0
+ * GMP_SIZE_OF_VAARGS(1)                     // 1
+ * GMP_SIZE_OF_VAARGS('a', 'b')              // 2
+ * GMP_SIZE_OF_VAARGS('a', 'b', 'c')         // 3
+ * GMP_SIZE_OF_VAARGS('a', 'b', 1, 2)        // 4
+ * GMP_SIZE_OF_VAARGS('a', 'b', 1, 2, 3, 4)  // 6
+ * \endcode
+ */
+#define GMP_SIZE_OF_VAARGS(...) GMP_EXPAND( GMP_GET_VARARGS(GMP_OPT_COMMA(__VA_ARGS__) __VA_ARGS__, _GMP_SIZE_OF_VAARGS_SEQUENCE) )
+
+
+/**
+ * \brief Check if variable arguments are empty.
+ * 
+ * This macro checks if the variable arguments are empty by expanding
+ * and evaluating the arguments in various forms. It uses helper macros
+ * to perform the actual checks.
+ * 
+ * \param ... Variable argument list
+ * \return 1 if variable arguments are empty, otherwise 0.
+ * 
+ * \par Example
+ * \code
+ * GMP_IS_EMPTY()       // 1
+ * GMP_IS_EMPTY(1)      // 0
+ * GMP_IS_EMPTY(1, 2)   // 0
+ * \endcode
+ */
+#if GMP_HAS_VA_OPT
+#define GMP_IS_EMPTY(...) _GMP_IS_EMPTY_VA_OPT(__VA_ARGS__)
+#define _GMP_IS_EMPTY_VA_OPT(...) _GMP_IS_EMPTY_RESULT(__VA_OPT__(0,) 1, )
+#define _GMP_IS_EMPTY_RESULT(result, ...) result
+#else
+#define GMP_IS_EMPTY(...) \
+    _GMP_IS_EMPTY_IMPL( \
+        GMP_EXPAND( GMP_HAS_COMMA(__VA_ARGS__) ), \
+        GMP_EXPAND( GMP_HAS_COMMA(_TRIGGER_PARENTHESIS __VA_ARGS__) ), \
+        GMP_EXPAND( GMP_HAS_COMMA(__VA_ARGS__ ()) ), \
+        GMP_EXPAND( GMP_HAS_COMMA(_TRIGGER_PARENTHESIS __VA_ARGS__ ()) ) \
+    )
+#define _GMP_IS_EMPTY_IMPL(_0, _1, _2, _3) GMP_HAS_COMMA(_GMP_IS_EMPTY_CASE(_0, _1, _2, _3))
+#define _GMP_IS_EMPTY_CASE(_0, _1, _2, _3) _GMP_IS_EMPTY_CASE_ ## _0 ## _1 ## _2 ## _3
+#define _GMP_IS_EMPTY_CASE_0001 ,
+#endif
+
+
+/**
+ * \def GMP_HAS_COMMA(...)
+ * \brief Check if the variable argument list contains a comma.
+ *
+ * This macro checks if the variable argument list contains a comma.
+ * It expands the arguments and uses the \ref _GMP_COMMA_CHECK macro
+ * to perform the actual check.
+ *
+ * \param ... Variable argument list.
+ * \return 1 if a comma is found, otherwise 0.
+ */
+#define GMP_HAS_COMMA(...) GMP_EXPAND( _GMP_COMMA_CHECK_I(__VA_ARGS__, _GMP_HAS_COMMA_SEQUENCE) )
+#define _GMP_COMMA_CHECK_I(...) GMP_EXPAND( _GMP_COMMA_CHECK(__VA_ARGS__) )
+#define _TRIGGER_PARENTHESIS(...) ,
+
+
+/**
+ * \def GMP_OPT_COMMA(...)
+ * \brief Optional comma based on argument emptiness.
+ *
+ * This macro adds a comma if the arguments are empty, otherwise
+ * it does not add a comma.
+ *
+ * \param ... Variable argument list.
+ * \return Comma if arguments are empty, otherwise nothing.
+ */
+#if GMP_HAS_VA_OPT
+#define GMP_OPT_COMMA(...) _GMP_OPT_COMMA_VA_OPT(__VA_ARGS__)
+#define _GMP_OPT_COMMA_VA_OPT(...) __VA_OPT__(,)
+#else
+#define GMP_OPT_COMMA(...) GMP_CONCAT(_GMP_OPT_COMMA_, GMP_IS_EMPTY(__VA_ARGS__))
+#define _GMP_OPT_COMMA_1
+#define _GMP_OPT_COMMA_0 ,
+#endif
+
+
+/**
+ * \def GMP_OVERLOAD_INVOKE(call, ...)
+ * \brief Call an overloaded macro based on the special version.
+ *
+ * This macro allows for the invocation of different versions of a macro
+ * depending on the version provided. It works by concatenating
+ * the base call name with the version argument, and then invoking the
+ * appropriate overloaded macro.
+ *
+ * Example usage:
+ * \code
+ * #define TEST_1(x) printf("One argument: %c\n", (x))
+ * #define TEST_1_1(x, y) printf("Two arguments: %c, %c\n", (x), (y))
+ * 
+ * GMP_OVERLOAD_INVOKE(TEST, 1)('a');         // Expands to: TEST_1('a')
+ * GMP_OVERLOAD_INVOKE(TEST, 1, 1)('a', 'b'); // Expands to: TEST_1_1('a', 'b')
+ * \endcode
+ *
+ * \param call The base macro to be called.
+ * \param ... The arguments to be passed to the macro. The arguments
+ *            determine which overloaded version of the macro is invoked.
+ */
+#define GMP_OVERLOAD_INVOKE(call, ...) GMP_CONCAT( _GMP_OVERLOAD_INVOKE_, GMP_SIZE_OF_VAARGS(__VA_ARGS__) )(call, __VA_ARGS__)
+#define _GMP_OVERLOAD_INVOKE_1(call, v1) GMP_CONCAT(GMP_CONCAT(call, _), v1)
+#define _GMP_OVERLOAD_INVOKE_2(call, v1, v2) GMP_CONCAT( GMP_CONCAT(_GMP_OVERLOAD_INVOKE_1(call, v1), _), v2 )
+#define _GMP_OVERLOAD_INVOKE_3(call, v1, v2, v3) GMP_CONCAT( GMP_CONCAT(_GMP_OVERLOAD_INVOKE_2(call, v1, v2), _), v3)
+#define _GMP_OVERLOAD_INVOKE_4(call, v1, v2, v3, v4) GMP_CONCAT( GMP_CONCAT(_GMP_OVERLOAD_INVOKE_3(call, v1, v2, v3), _), v4)
+#define _GMP_OVERLOAD_INVOKE_5(call, v1, v2, v3, v4, v5) GMP_CONCAT( GMP_CONCAT(_GMP_OVERLOAD_INVOKE_4(call, v1, v2, v3, v4), _), v5)
+
+/**
+ * \def GMP_OVERLOAD_INVOKE1(call, v1)
+ * \brief \ref GMP_OVERLOAD_INVOKE with exactly one selector argument.
+ *
+ * GMP_OVERLOAD_INVOKE first counts its selector arguments with
+ * \ref GMP_SIZE_OF_VAARGS, which is by far its most expensive step.
+ * When the number of selectors is known, these fixed-arity variants
+ * skip the count.
+ *
+ * \code
+ * GMP_OVERLOAD_INVOKE1(TEST, 1)('a');         // Expands to: TEST_1('a')
+ * GMP_OVERLOAD_INVOKE2(TEST, 1, 1)('a', 'b'); // Expands to: TEST_1_1('a', 'b')
+ * \endcode
+ */
+#define GMP_OVERLOAD_INVOKE1(call, v1) _GMP_OVERLOAD_INVOKE_1(call, v1)
+
+/// \brief \ref GMP_OVERLOAD_INVOKE with exactly two selector arguments.
+#define GMP_OVERLOAD_INVOKE2(call, v1, v2) _GMP_OVERLOAD_INVOKE_2(call, v1, v2)
+
+/// \brief \ref GMP_OVERLOAD_INVOKE with exactly three selector arguments.
+#define GMP_OVERLOAD_INVOKE3(call, v1, v2, v3) _GMP_OVERLOAD_INVOKE_3(call, v1, v2, v3)
+
+
+#endif // GMP_MACRO_VARARGS_HPP_
@@ -0,0 +1,184 @@
+/**
+ * \file index_engine.hpp
+ * \brief Constexpr index computations shared by the list algorithms.
+ *
+ * A list algorithm first computes the positions of its result as a
+ * std::array in a constexpr function, and then materializes the result
+ * with a single pack expansion over those positions. This keeps the
+ * instantiation depth constant and the number of instantiated classes
+ * independent of the length of the list.
+ */
+#ifndef GMP_DETAIL_INDEX_ENGINE_HPP_
+#define GMP_DETAIL_INDEX_ENGINE_HPP_
+
+#include <array>
+#include <cstddef> // size_t
+
+
+namespace gmp::detail
+{
+
+/// positions of the set flags
+template<auto Flags>
+consteval auto flag_indices()
+{
+    constexpr std::size_t M = [] {
+        std::size_t count = 0;
+        for (bool flag : Flags)
+            count += flag;
+        return count;
+    }();
+
+    std::array<std::size_t, M> indices{};
+    for (std::size_t i = 0, j = 0; i < Flags.size(); ++i)
+        if (Flags[i])
+            indices[j++] = i;
+    return indices;
+}
+
+
+/// 0, 1, ..., N-1
+template<std::size_t N>
+consteval auto iota_indices()
+{
+    std::array<std::size_t, N> indices{};
+    for (std::size_t i = 0; i < N; ++i)
+        indices[i] = i;
+    return indices;
+}
+
+
+/// the positions of N elements without Idx
+template<std::size_t N, std::size_t Idx>
+consteval auto remove_indices()
+{
+    std::array<std::size_t, N - 1> indices{};
+    for (std::size_t i = 0; i < indices.size(); ++i)
+        indices[i] = i < Idx ? i : i + 1;
+    return indices;
+}
+
+
+/// the positions of N elements with the element N appended and moved to Idx
+template<std::size_t N, std::size_t Idx>
+consteval auto insert_indices()
+{
+    std::array<std::size_t, N + 1> indices{};
+    for (std::size_t i = 0; i <= N; ++i)
+        indices[i] = i < Idx ? i : (i == Idx ? N : i - 1);
+    return indices;
+}
+
+
+/// First, First+1, ..., First+Count-1
+template<std::size_t First, std::size_t Count>
+consteval auto range_indices()
+{
+    std::array<std::size_t, Count> indices{};
+    for (std::size_t i = 0; i < Count; ++i)
+        indices[i] = First + i;
+    return indices;
+}
+
+
+/// positions of the elements equal to Value
+template<auto Values, auto Value>
+consteval auto equal_indices()
+{
+    constexpr std::size_t M = [] {
+        std::size_t count = 0;
+        for (auto v : Values)
+            count += v == Value;
+        return count;
+    }();
+
+    std::array<std::size_t, M> indices{};
+    for (std::size_t i = 0, j = 0; i < Values.size(); ++i)
+        if (Values[i] == Value)
+            indices[j++] = i;
+    return indices;
+}
+
+
+/// N-1, N-2, ..., 0
+template<std::size_t N>
+consteval auto reverse_indices()
+{
+    std::array<std::size_t, N> indices{};
+    for (std::size_t i = 0; i < N; ++i)
+        indices[i] = N - 1 - i;
+    return indices;
+}
+
+
+/// Indices[Selection[0]], Indices[Selection[1]], ...
+template<auto Indices, auto Selection>
+consteval auto gather_indices()
+{
+    std::array<std::size_t, Selection.size()> indices{};
+    for (std::size_t i = 0; i < Selection.size(); ++i)
+        indices[i] = Indices[Selection[i]];
+    return indices;
+}
+
+
+/// Indices followed by First, First+1, ..., First+Count-1
+template<auto Indices, std::size_t First, std::size_t Count>
+consteval auto append_iota_indices()
+{
+    std::array<std::size_t, Indices.size() + Count> indices{};
+    for (std::size_t i = 0; i < Indices.size(); ++i)
+        indices[i] = Indices[i];
+    for (std::size_t i = 0; i < Count; ++i)
+        indices[Indices.size() + i] = First + i;
+    return indices;
+}
+
+
+/// flags the first occurrence of every element, where equal(i, j) compares elements i and j
+template<std::size_t N, typename Equal>
+constexpr std::array<bool, N> first_occurrence_flags(Equal equal)
+{
+    std::array<bool, N> first{};
+    for (std::size_t i = 0; i < N; ++i) {
+        first[i] = true;
+        for (std::size_t j = 0; j < i && first[i]; ++j)
+            first[i] = !equal(j, i);
+    }
+    return first;
+}
+
+
+/// group number of every element, where groups are numbered by their first element
+template<std::size_t N, typename Equal>
+constexpr std::array<std::size_t, N> group_ids(Equal equal)
+{
+    std::array<std::size_t, N> ids{};
+    std::size_t groups = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t j = 0;
+        while (j < i && !equal(j, i))
+            ++j;
+        ids[i] = j < i ? ids[j] : groups++;
+    }
+    return ids;
+}
+
+
+/// stable insertion sort of the given positions, where less(i, j) compares elements i and j
+template<std::size_t N, typename Less>
+constexpr std::array<std::size_t, N> stable_sort_indices(std::array<std::size_t, N> positions, Less less)
+{
+    std::array<std::size_t, N> indices{};
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t j = i;
+        for (; j > 0 && less(positions[i], indices[j-1]); --j)
+            indices[j] = indices[j-1];
+        indices[j] = positions[i];
+    }
+    return indices;
+}
+
+} // namespace gmp::detail
+
+#endif // GMP_DETAIL_INDEX_ENGINE_HPP_
@@ -0,0 +1,112 @@
+/**
+ * \file intern.hpp
+ * \brief Short opaque tags standing for type lists in symbol names.
+ *
+ * A template instantiated with a long type_list carries the whole list in
+ * every mangled symbol and in the debug info. Interning the list replaces it
+ * by list_tag<Hash>, whose name is a few bytes long whatever the length of the
+ * list, while the list stays reachable through \ref uninterned_t.
+ */
+#ifndef GMP_INTERN_HPP_
+#define GMP_INTERN_HPP_
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <string_view>
+#include <type_traits> // type_identify
+
+#include <gmp/meta/type_list.hpp>
+#include <gmp/meta/type_name.hpp>
+
+
+namespace gmp
+{
+
+/**
+ * \brief A stable 64-bit hash of a type.
+ *
+ * FNV-1a of \ref type_name, so it is the same in every translation unit
+ * compiled by the same compiler.
+ */
+template<typename T>
+inline constexpr std::uint64_t type_hash_v = [] {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c : type_name<T>()) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}();
+
+
+/**
+ * \brief The opaque tag of an interned type list.
+ *
+ * Only tags registered with \ref GMP_INTERN_TYPE_LIST are complete, and their
+ * nested \a type is the interned list.
+ */
+template<std::uint64_t Hash>
+struct list_tag;
+
+
+/// class interned
+template<type_list_like T>
+struct interned
+{
+    using type = list_tag<type_hash_v<T>>;
+};
+
+template<type_list_like T>
+using interned_t = interned<T>::type;
+
+
+/// class uninterned
+template<typename T>
+struct uninterned
+{
+    using type = T;
+};
+
+template<std::uint64_t Hash>
+struct uninterned<list_tag<Hash>>
+{
+    using type = list_tag<Hash>::type;
+};
+
+template<typename T>
+using uninterned_t = uninterned<T>::type;
+
+
+/// tags are lists themselves
+template<std::uint64_t Hash>
+struct type_list_size<list_tag<Hash>>
+    : type_list_size<typename list_tag<Hash>::type> {};
+
+template<std::size_t Idx, std::uint64_t Hash>
+struct type_list_element<Idx, list_tag<Hash>>
+    : type_list_element<Idx, typename list_tag<Hash>::type> {};
+
+} // namespace gmp
+
+
+/**
+ * \def GMP_INTERN_TYPE_LIST(...)
+ * \brief Register a type list so that \ref gmp::interned_t can stand for it.
+ *
+ * Must be used at global namespace scope, once per list. Two lists with the
+ * same hash cannot be registered in the same program; a collision within a
+ * translation unit is a redefinition error.
+ *
+ * \par Example
+ * \code
+ * using kernel_types = gmp::type_list<float, double, ...>;
+ * GMP_INTERN_TYPE_LIST(kernel_types)
+ *
+ * template<typename List> struct kernel { using types = gmp::uninterned_t<List>; };
+ * template struct kernel<gmp::interned_t<kernel_types>>; // kernel<gmp::list_tag<...>>
+ * \endcode
+ */
+#define GMP_INTERN_TYPE_LIST(...) \
+    template<> struct gmp::list_tag<gmp::type_hash_v<__VA_ARGS__>> { using type = __VA_ARGS__; };
+
+#endif // GMP_INTERN_HPP_
@@ -0,0 +1,236 @@
+/**
+ * \file pipe.hpp
+ * \brief Lazy composition of type_list algorithms.
+ *
+ * A pipe keeps its source list untouched and tracks its elements as a
+ * constexpr array of positions plus a pending type transformation. Every
+ * stage only updates the positions or the transformation, and the result
+ * list is materialized once at the end of the pipe.
+ */
+#ifndef GMP_PIPE_HPP_
+#define GMP_PIPE_HPP_
+
+#include <array>
+#include <cstddef> // size_t
+#include <utility> // index_sequence
+#include <type_traits> // type_identify
+
+#include <gmp/meta/detail/index_engine.hpp>
+#include <gmp/meta/type_list.hpp>
+
+
+namespace gmp
+{
+
+namespace detail
+{
+
+/// pipe state
+// The elements of the pipe are Proj::fn<Source[Indices[k]]>.
+template<typename Source, typename Proj, auto Indices>
+struct pipe_state {};
+
+struct pipe_identity
+{
+    template<typename T>
+    using fn = T;
+};
+
+template<template<typename> class F, typename Proj>
+struct pipe_compose
+{
+    template<typename T>
+    using fn = typename F<typename Proj::template fn<T>>::type;
+};
+
+
+/// view over the current elements of a pipe
+template<typename State, typename>
+struct pipe_view_impl;
+
+template<template<typename...> class List, typename... Types, typename Proj, auto Indices, std::size_t... Ks>
+struct pipe_view_impl<pipe_state<List<Types...>, Proj, Indices>, std::index_sequence<Ks...>>
+{
+    template<std::size_t K>
+    using element = typename Proj::template fn<type_pack_element_t<Indices[K], Types...>>;
+
+    using list = List<element<Ks>...>;
+
+    template<template<typename> class Pred>
+    static constexpr std::array<bool, sizeof...(Ks)> flags{ Pred<element<Ks>>::value... };
+
+    static constexpr auto unique_flags = type_list_unique_flags<element<Ks>...>;
+
+    static constexpr auto sort_indices
+        = type_list_sort_indices<iota_indices<sizeof...(Ks)>(), element<Ks>...>;
+};
+
+template<typename State>
+struct pipe_view;
+
+template<typename Source, typename Proj, auto Indices>
+struct pipe_view<pipe_state<Source, Proj, Indices>>
+    : pipe_view_impl<pipe_state<Source, Proj, Indices>, std::make_index_sequence<Indices.size()>>
+{};
+
+
+/// keep the current elements at the positions of Selection
+template<typename State, auto Selection>
+struct pipe_select;
+
+template<typename Source, typename Proj, auto Indices, auto Selection>
+struct pipe_select<pipe_state<Source, Proj, Indices>, Selection>
+    : std::type_identity<pipe_state<Source, Proj, gather_indices<Indices, Selection>()>>
+{};
+
+template<typename State, auto Selection>
+using pipe_select_t = pipe_select<State, Selection>::type;
+
+
+/// stage application
+// Stages are applied with a single fold expression over operator|.
+template<typename State>
+struct pipe_box
+{
+    using type = State;
+};
+
+template<typename State, typename Stage>
+pipe_box<typename Stage::template apply<State>> operator|(pipe_box<State>, Stage);
+
+} // namespace detail
+
+
+/**
+ * \brief The stages of a \ref pipe.
+ */
+namespace stage
+{
+
+/// append the types of the given lists
+template<type_list_like... TypeLists>
+struct concat
+{
+    template<typename State>
+    struct apply_impl;
+
+    // Without a pending transformation the source is extended in place.
+    template<template<typename...> class List, typename... Types, auto Indices>
+    struct apply_impl<detail::pipe_state<List<Types...>, detail::pipe_identity, Indices>>
+    {
+        using source = type_list_concat_t<List<Types...>, List<>, TypeLists...>;
+        using type = detail::pipe_state<source, detail::pipe_identity,
+            detail::append_iota_indices<Indices, sizeof...(Types),
+                type_list_size_v<source> - sizeof...(Types)>()>;
+    };
+
+    // Otherwise the elements so far are materialized first.
+    template<typename Source, typename Proj, auto Indices>
+    struct apply_impl<detail::pipe_state<Source, Proj, Indices>>
+        : apply_impl<detail::pipe_state<
+            typename detail::pipe_view<detail::pipe_state<Source, Proj, Indices>>::list,
+            detail::pipe_identity, detail::iota_indices<Indices.size()>()>>
+    {};
+
+    template<typename State>
+    using apply = apply_impl<State>::type;
+};
+
+
+/// remove repeated types, keeping the first occurrence of each
+struct unique
+{
+    template<typename State>
+    using apply = detail::pipe_select_t<State,
+        detail::flag_indices<detail::pipe_view<State>::unique_flags>()>;
+};
+
+
+/// keep the types for which Pred<T>::value is true
+template<template<typename> class Pred>
+struct filter
+{
+    template<typename State>
+    using apply = detail::pipe_select_t<State,
+        detail::flag_indices<detail::pipe_view<State>::template flags<Pred>>()>;
+};
+
+
+/// replace every type T by F<T>::type
+template<template<typename> class F>
+struct transform
+{
+    template<typename State>
+    struct apply_impl;
+
+    template<typename Source, typename Proj, auto Indices>
+    struct apply_impl<detail::pipe_state<Source, Proj, Indices>>
+        : std::type_identity<detail::pipe_state<Source, detail::pipe_compose<F, Proj>, Indices>>
+    {};
+
+    template<typename State>
+    using apply = apply_impl<State>::type;
+};
+
+
+/// reverse the order of the types
+struct reverse
+{
+    template<typename State>
+    struct apply_impl;
+
+    template<typename Source, typename Proj, auto Indices>
+    struct apply_impl<detail::pipe_state<Source, Proj, Indices>>
+        : detail::pipe_select<detail::pipe_state<Source, Proj, Indices>,
+            detail::reverse_indices<Indices.size()>()>
+    {};
+
+    template<typename State>
+    using apply = apply_impl<State>::type;
+};
+
+
+/// stable sort of the types by \ref type_name
+struct sort
+{
+    template<typename State>
+    using apply = detail::pipe_select_t<State, detail::pipe_view<State>::sort_indices>;
+};
+
+} // namespace stage
+
+
+/**
+ * \brief Apply a sequence of stages to a type list, materializing only the result.
+ *
+ * Writing the equivalent nested algorithms creates one type_list class per
+ * step. A pipe instead carries the positions of its elements through the
+ * stages, so the intermediate lists are never instantiated.
+ *
+ * \par Example
+ * \code
+ * using result = pipe_t<type_list<int, char*>,
+ *                       stage::concat<type_list<int, long>>,
+ *                       stage::unique,
+ *                       stage::filter<std::is_integral>,
+ *                       stage::transform<std::add_pointer>>;
+ * // type_list<int*, long*>
+ * \endcode
+ */
+template<type_list_like T, typename... Stages>
+struct pipe;
+
+template<template<typename...> class List, typename... Types, typename... Stages>
+struct pipe<List<Types...>, Stages...>
+    : std::type_identity<typename detail::pipe_view<typename decltype((
+        detail::pipe_box<detail::pipe_state<List<Types...>, detail::pipe_identity,
+            detail::iota_indices<sizeof...(Types)>()>>{} | ... | Stages{}))::type>::list>
+{};
+
+template<type_list_like T, typename... Stages>
+using pipe_t = pipe<T, Stages...>::type;
+
+
+} // namespace gmp
+
+#endif // GMP_PIPE_HPP_
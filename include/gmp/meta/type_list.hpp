@@ -5,10 +5,18 @@
 #ifndef GMP_TYPE_LIST_HPP_
 #define GMP_TYPE_LIST_HPP_
 
+#include <algorithm> // min
+#include <array>
 #include <concepts>
 #include <cstddef> // size_t
+#include <string_view>
+#include <tuple>
 #include <utility> // index_sequence
 #include <type_traits> // type_identify
+#include <variant>
+
+#include <gmp/meta/detail/index_engine.hpp>
+#include <gmp/meta/type_name.hpp>
 
 
 namespace gmp
@@ -20,36 +28,104 @@ namespace gmp
  * The type_list template can be used to hold a list of types at compile time.
  * It provides compile-time constants to retrieve the number of types and to check if the list is empty.
  *
+ * The algorithms below also accept the other class templates marked by
+ * \ref is_type_list_template, such as std::tuple or std::variant, and return
+ * their result in that same template, e.g. type_list_filter_t<std::tuple<A, B>,
+ * Pred> is a std::tuple.
+ *
  * \tparam Ts The types to be held in the type list.
  */
 template<typename...> struct type_list {};
 
 
+/**
+ * \brief Whether the instances of a class template are lists of types.
+ *
+ * Holds for type_list, std::tuple and std::variant. Specialize it as
+ * std::true_type for another class template whose arguments are the elements
+ * of a list, e.g. the type list of another library. Class templates that
+ * merely take types, such as std::vector or std::optional, are not lists.
+ */
+template<template<typename...> class>
+struct is_type_list_template : std::false_type {};
+
+template<> struct is_type_list_template<type_list> : std::true_type {};
+template<> struct is_type_list_template<std::tuple> : std::true_type {};
+template<> struct is_type_list_template<std::variant> : std::true_type {};
+
+template<template<typename...> class List>
+inline constexpr bool is_type_list_template_v = is_type_list_template<List>::value;
+
+
 /// class type_list_size
 template<typename> struct type_list_size;
 
-template<typename... Types>
-struct type_list_size<type_list<Types...>>
+template<template<typename...> class List, typename... Types>
+requires is_type_list_template_v<List>
+struct type_list_size<List<Types...>>
     : std::integral_constant<std::size_t, sizeof...(Types)> {};
 
 template<typename T>
 inline constexpr std::size_t type_list_size_v = type_list_size<T>::value;
 
 
+namespace detail
+{
+
+/// element impl
+// Every type is a distinct base, so looking one up by index is a single
+// overload resolution instead of a recursive instantiation.
+template<std::size_t, typename T>
+struct indexed_type
+{
+    using type = T;
+};
+
+template<typename, typename...>
+struct indexed_types;
+
+template<std::size_t... Is, typename... Types>
+struct indexed_types<std::index_sequence<Is...>, Types...>
+    : indexed_type<Is, Types>...
+{};
+
+template<std::size_t Idx, typename T>
+indexed_type<Idx, T> type_at(const indexed_type<Idx, T>&);
+
+#if defined(__has_builtin)
+#  if __has_builtin(__type_pack_element)
+#    define _GMP_HAS_TYPE_PACK_ELEMENT
+#  endif
+#endif
+
+#ifdef _GMP_HAS_TYPE_PACK_ELEMENT
+template<std::size_t Idx, typename... Types>
+using type_pack_element_t = __type_pack_element<Idx, Types...>;
+#else
+template<std::size_t Idx, typename... Types>
+using type_pack_element_t = decltype(type_at<Idx>(
+    std::declval<const indexed_types<std::index_sequence_for<Types...>, Types...>&>()))::type;
+#endif
+#undef _GMP_HAS_TYPE_PACK_ELEMENT
+
+
+/// identity of a type usable in constexpr comparisons
+template<typename>
+inline constexpr char type_tag = 0;
+
+} // namespace detail
+
+
 /// class type_list_element
 template<std::size_t Idx, typename T>
 requires (Idx < type_list_size_v<T>)
 struct type_list_element;
 
-template<std::size_t Idx, typename Head, typename... Types>
-struct type_list_element<Idx, type_list<Head, Types...>>
-    : std::type_identity<typename type_list_element<Idx-1, type_list<Types...>>::type>
-{};
-
-template<typename Head, typename... Types>
-struct type_list_element<0, type_list<Head, Types...>>
+template<template<typename...> class List, std::size_t Idx, typename... Types>
+requires is_type_list_template_v<List>
+struct type_list_element<Idx, List<Types...>>
 {
-    using type = Head;
+    using type = detail::type_pack_element_t<Idx, Types...>;
 };
 
 template<std::size_t Idx, typename T>
@@ -88,28 +164,44 @@ template<typename T>
 requires type_list_like<T> && (type_list_size_v<T> > 0)
 struct type_list_tail {};
 
-template<typename Head, typename... Types>
-struct type_list_tail<type_list<Head, Types...>>
-    : std::type_identity<type_list<Types...>>
+template<template<typename...> class List, typename Head, typename... Types>
+struct type_list_tail<List<Head, Types...>>
+    : std::type_identity<List<Types...>>
 {};
 
 template<typename T>
 using type_list_tail_t = type_list_tail<T>::type;
 
 
+namespace detail
+{
+
+/// concat impl
+template<typename>
+struct type_list_concat_box {};
+
+template<template<typename...> class List, typename... LTypes, typename... RTypes>
+type_list_concat_box<List<LTypes..., RTypes...>>
+operator+(type_list_concat_box<List<LTypes...>>, type_list_concat_box<List<RTypes...>>);
+
+template<typename T>
+struct type_list_concat_unbox;
+
+template<typename T>
+struct type_list_concat_unbox<type_list_concat_box<T>>
+    : std::type_identity<T>
+{};
+
+} // namespace detail
+
+
 /// class type_list_concat
+// Concatenated with a single fold expression, whatever the number of lists.
 template<type_list_like TypeList1, type_list_like TypeList2, type_list_like... RestTypeLists>
 struct type_list_concat
-    : std::type_identity<
-        typename type_list_concat<
-            typename type_list_concat<TypeList1, TypeList2>::type,
-            RestTypeLists...
-        >::type>
-{};
-
-template<typename... LTypes, typename... RTypes>
-struct type_list_concat<type_list<LTypes...>, type_list<RTypes...>>
-    : std::type_identity<type_list<LTypes..., RTypes...>>
+    : detail::type_list_concat_unbox<decltype((
+        (detail::type_list_concat_box<TypeList1>{} + detail::type_list_concat_box<TypeList2>{})
+        + ... + detail::type_list_concat_box<RestTypeLists>{}))>
 {};
 
 template<type_list_like... TypeLists>
@@ -135,8 +227,8 @@ using type_list_pop_back = type_list_remove_t<type_list_size_v<T> - 1, T>;
 template<typename, type_list_like>
 struct type_list_contains;
 
-template<typename U, typename... Types>
-struct type_list_contains<U, type_list<Types...>>
+template<template<typename...> class List, typename U, typename... Types>
+struct type_list_contains<U, List<Types...>>
     : std::bool_constant<(std::same_as<Types, U> || ...)>
 {};
 
@@ -155,223 +247,598 @@ inline constexpr bool type_list_contains_v = type_list_contains<U, T>::value;
 namespace detail
 {
 
-/// remove impl
-template<std::size_t, type_list_like, type_list_like>
-struct type_list_remove_impl;
+/// select impl
+// Materializes type_list<T[Indices[0]], T[Indices[1]], ...> in one expansion.
+template<type_list_like, auto, typename>
+struct type_list_select_impl;
 
-template<std::size_t Idx, typename Head, typename... Types, typename... Heads>
-struct type_list_remove_impl<Idx, type_list<Head, Types...>, type_list<Heads...>>
-    : std::type_identity<typename type_list_remove_impl<Idx-1, type_list<Types...>, type_list<Heads..., Head>>::type>
+template<template<typename...> class List, typename... Types, auto Indices, std::size_t... Is>
+struct type_list_select_impl<List<Types...>, Indices, std::index_sequence<Is...>>
+    : std::type_identity<List<type_pack_element_t<Indices[Is], Types...>...>>
 {};
 
-template<typename Head, typename... Types, typename... Heads>
-struct type_list_remove_impl<0, type_list<Head, Types...>, type_list<Heads...>>
-    : std::type_identity<type_list_concat_t<type_list<Heads...>, type_list<Types...>>>
+template<type_list_like T, auto Indices>
+using type_list_select_t = type_list_select_impl<T, Indices, std::make_index_sequence<Indices.size()>>::type;
+
+
+/// unique impl
+template<typename... Types>
+inline constexpr auto type_list_unique_flags = [] {
+    const std::array<const void*, sizeof...(Types)> ids{ &type_tag<Types>... };
+    return first_occurrence_flags<sizeof...(Types)>([&](std::size_t i, std::size_t j) {
+        return ids[i] == ids[j];
+    });
+}();
+
+
+/// sort impl
+// Stable sort of the given positions of the list by their type names.
+template<auto Positions, typename... Types>
+inline constexpr auto type_list_sort_indices = [] {
+    const std::array<std::string_view, sizeof...(Types)> keys{ type_name<Types>()... };
+    return stable_sort_indices(Positions, [&](std::size_t i, std::size_t j) {
+        return keys[i] < keys[j];
+    });
+}();
+
+} // namespace detail
+
+
+/// class type_list_remove
+template<template<typename...> class List, std::size_t Idx, typename... Types>
+struct type_list_remove<Idx, List<Types...>>
+    : std::type_identity<detail::type_list_select_t<List<Types...>,
+        detail::remove_indices<sizeof...(Types), Idx>()>>
 {};
 
 
-/// insert impl
-template<std::size_t, typename, type_list_like, type_list_like>
-struct type_list_insert_impl;
+/// insert
+template<std::size_t Idx, typename, type_list_like T>
+requires (Idx <= type_list_size_v<T>)
+struct type_list_insert;
 
-template<std::size_t Idx, typename NewType, typename Head, typename... Heads, typename... Types>
-requires (Idx > 0)
-struct type_list_insert_impl<Idx, NewType, type_list<Heads...>, type_list<Head, Types...>>
-    : std::type_identity<typename type_list_insert_impl<Idx-1, NewType, type_list<Heads..., Head>, type_list<Types...>>::type>
+template<template<typename...> class List, std::size_t Idx, typename NewType, typename... Types>
+struct type_list_insert<Idx, NewType, List<Types...>>
+    : std::type_identity<detail::type_list_select_t<List<Types..., NewType>,
+        detail::insert_indices<sizeof...(Types), Idx>()>>
 {};
 
-template<typename NewType, typename... Heads, typename... Types>
-struct type_list_insert_impl<0, NewType, type_list<Heads...>, type_list<Types...>>
-    : std::type_identity<type_list<Heads..., NewType, Types...>>
+template<std::size_t Idx, typename NewType, type_list_like T>
+using type_list_insert_t = type_list_insert<Idx, NewType, T>::type;
+
+template<typename NewType, type_list_like T>
+using type_list_push_front = type_list_insert_t<0, NewType, T>;
+
+template<typename NewType, type_list_like T>
+using type_list_push_back = type_list_insert_t<type_list_size_v<T>, NewType, T>;
+
+
+/// filter
+template<typename T, typename>
+struct filter {};
+
+
+/// reverse
+template<type_list_like> struct type_list_reverse;
+
+template<template<typename...> class List, typename... Types>
+struct type_list_reverse<List<Types...>>
+    : std::type_identity<detail::type_list_select_t<List<Types...>,
+        detail::reverse_indices<sizeof...(Types)>()>>
 {};
 
+template<type_list_like T>
+using type_list_reverse_t = type_list_reverse<T>::type;
 
-/// reverse impl
-template<std::size_t, type_list_like, type_list_like>
-struct type_list_reverse_impl;
 
-template<std::size_t Idx, typename... NewTypes, typename... Types>
-struct type_list_reverse_impl<Idx, type_list<NewTypes...>, type_list<Types...>>
-    : std::type_identity<typename type_list_reverse_impl<Idx-1,
-        type_list<NewTypes..., type_list_last<type_list<Types...>>>,
-        type_list_pop_back<type_list<Types...>>>::type>
+/// unique
+template<type_list_like> struct type_list_unique;
+
+template<template<typename...> class List, typename... Types>
+struct type_list_unique<List<Types...>>
+    : std::type_identity<detail::type_list_select_t<List<Types...>,
+        detail::flag_indices<detail::type_list_unique_flags<Types...>>()>>
 {};
 
-template<typename... NewTypes>
-struct type_list_reverse_impl<0, type_list<NewTypes...>, type_list<>>
-    : std::type_identity<type_list<NewTypes...>>
+template<typename T>
+using type_list_unique_t = type_list_unique<T>::type;
+
+
+/// filter
+template<type_list_like, template<typename> class Pred>
+requires std::same_as<std::remove_const_t<decltype(Pred<void>::value)>, bool>
+struct type_list_filter;
+
+template<template<typename...> class List, template<typename> class Pred, typename... Types>
+struct type_list_filter<List<Types...>, Pred>
+    : std::type_identity<detail::type_list_select_t<List<Types...>,
+        detail::flag_indices<std::array<bool, sizeof...(Types)>{ Pred<Types>::value... }>()>>
 {};
 
+template<type_list_like T, template<typename> class Pred>
+using type_list_filter_t = type_list_filter<T, Pred>::type;
+
 
-/// unique impl
-template<std::size_t, type_list_like, type_list_like, typename, bool>
-struct type_list_unique_impl;
+/// transform
+template<type_list_like, template<typename> class F>
+struct type_list_transform;
 
-template<std::size_t Idx, typename Head, typename CompType, typename... NewTypes, typename... Types>
-struct type_list_unique_impl<Idx, type_list<NewTypes...>, type_list<Head, Types...>, CompType, true>
-    : std::type_identity<typename type_list_unique_impl<Idx-1,
-        type_list<NewTypes...>, type_list<Types...>, Head,
-        type_list_contains_v<Head, type_list<NewTypes...>>>::type>
+template<template<typename...> class List, template<typename> class F, typename... Types>
+struct type_list_transform<List<Types...>, F>
+    : std::type_identity<List<typename F<Types>::type...>>
 {};
 
-template<std::size_t Idx, typename Head, typename CompType, typename... NewTypes, typename... Types>
-struct type_list_unique_impl<Idx, type_list<NewTypes...>, type_list<Head, Types...>, CompType, false>
-    : std::type_identity<typename type_list_unique_impl<Idx-1,
-        type_list<NewTypes..., CompType>, type_list<Types...>, Head,
-        type_list_contains_v<Head, type_list<NewTypes..., CompType>>>::type>
+template<type_list_like T, template<typename> class F>
+using type_list_transform_t = type_list_transform<T, F>::type;
+
+
+/**
+ * \brief Split a type list into the types that satisfy \a Pred and the rest.
+ *
+ * The result is type_list<L<matching...>, L<rest...>>, where L is the template
+ * of the input list, both in their original order.
+ */
+template<type_list_like, template<typename> class Pred>
+requires std::same_as<std::remove_const_t<decltype(Pred<void>::value)>, bool>
+struct type_list_partition;
+
+template<template<typename...> class List, template<typename> class Pred, typename... Types>
+struct type_list_partition<List<Types...>, Pred>
+    : std::type_identity<type_list<
+        detail::type_list_select_t<List<Types...>,
+            detail::flag_indices<std::array<bool, sizeof...(Types)>{ Pred<Types>::value... }>()>,
+        detail::type_list_select_t<List<Types...>,
+            detail::flag_indices<std::array<bool, sizeof...(Types)>{ !Pred<Types>::value... }>()>>>
 {};
 
-template<typename CompType, typename... NewTypes, typename... Types>
-struct type_list_unique_impl<0, type_list<NewTypes...>, type_list<Types...>, CompType, true>
-    : std::type_identity<type_list<NewTypes..., Types...>>
+template<type_list_like T, template<typename> class Pred>
+using type_list_partition_t = type_list_partition<T, Pred>::type;
+
+
+namespace detail
+{
+
+/// group_by impl
+template<typename... Keys>
+inline constexpr auto type_list_group_ids = [] {
+    const std::array<const void*, sizeof...(Keys)> ids{ &type_tag<Keys>... };
+    return group_ids<sizeof...(Keys)>([&](std::size_t i, std::size_t j) {
+        return ids[i] == ids[j];
+    });
+}();
+
+template<type_list_like T, auto Ids, typename>
+struct type_list_group_by_impl;
+
+template<type_list_like T, auto Ids, std::size_t... Gs>
+struct type_list_group_by_impl<T, Ids, std::index_sequence<Gs...>>
+    : std::type_identity<type_list<type_list_select_t<T, equal_indices<Ids, Gs>()>...>>
 {};
 
-template<typename CompType, typename... NewTypes, typename... Types>
-struct type_list_unique_impl<0, type_list<NewTypes...>, type_list<Types...>, CompType, false>
-    : std::type_identity<type_list<NewTypes..., CompType, Types...>>
+template<auto Ids>
+inline constexpr std::size_t group_count = [] {
+    std::size_t count = 0;
+    for (std::size_t id : Ids)
+        count = id + 1 > count ? id + 1 : count;
+    return count;
+}();
+
+
+/// fold impl
+// A fold expression over operator+ keeps the instantiation depth constant.
+template<typename Acc, template<typename, typename> class Op>
+struct type_list_fold_box
+{
+    using type = Acc;
+};
+
+template<typename T>
+struct type_list_fold_item {};
+
+template<typename Acc, template<typename, typename> class Op, typename T>
+type_list_fold_box<typename Op<Acc, T>::type, Op>
+operator+(type_list_fold_box<Acc, Op>, type_list_fold_item<T>);
+
+
+/// zip impl
+template<std::size_t Idx, type_list_like... TypeLists>
+using type_list_zip_row = type_list<type_list_element_t<Idx, TypeLists>...>;
+
+template<typename, type_list_like... TypeLists>
+struct type_list_zip_impl;
+
+template<std::size_t... Is, type_list_like... TypeLists>
+struct type_list_zip_impl<std::index_sequence<Is...>, TypeLists...>
+    : std::type_identity<type_list<type_list_zip_row<Is, TypeLists...>...>>
 {};
 
 
-/// filter impl
-template<
-    std::size_t,
-    type_list_like,
-    type_list_like,
-    template<typename> class,
-    typename, bool
->
-struct type_list_filter_impl;
+/// chunk impl
+template<std::size_t N, type_list_like T, typename>
+struct type_list_chunk_impl;
 
-template<std::size_t Idx, template<typename> class Pred, typename Head, typename CompType, typename... Heads, typename... Types>
-struct type_list_filter_impl<Idx, type_list<Heads...>, type_list<Head, Types...>, Pred, CompType, true>
-    : std::type_identity<typename type_list_filter_impl<Idx-1,
-        type_list<Heads..., CompType>, type_list<Types...>,
-        Pred, Head, Pred<Head>::value>::type>
+template<std::size_t N, type_list_like T, std::size_t... Cs>
+struct type_list_chunk_impl<N, T, std::index_sequence<Cs...>>
+    : std::type_identity<type_list<type_list_select_t<T,
+        range_indices<Cs * N, (Cs * N + N < type_list_size_v<T> ? N : type_list_size_v<T> - Cs * N)>()>...>>
 {};
 
-template<std::size_t Idx, template<typename> class Pred, typename Head, typename CompType, typename... Heads, typename... Types>
-struct type_list_filter_impl<Idx, type_list<Heads...>, type_list<Head, Types...>, Pred, CompType, false>
-    : std::type_identity<typename type_list_filter_impl<Idx-1,
-        type_list<Heads...>, type_list<Types...>,
-        Pred, Head, Pred<Head>::value>::type>
+
+/// enumerate impl
+template<typename, typename...>
+struct type_list_enumerate_impl;
+
+template<std::size_t... Is, typename... Types>
+struct type_list_enumerate_impl<std::index_sequence<Is...>, Types...>
+    : std::type_identity<type_list<type_list<std::integral_constant<std::size_t, Is>, Types>...>>
 {};
 
-template<template<typename> class Pred, typename CompType, typename... Heads, typename... Types>
-struct type_list_filter_impl<0, type_list<Heads...>, type_list<Types...>, Pred, CompType, true>
-    : std::type_identity<type_list<Heads..., CompType, Types...>>
+} // namespace detail
+
+
+/**
+ * \brief Group the types of a list by the key KeyFn<T>::type.
+ *
+ * The result is a type_list of groups, each a list of the input's template
+ * holding the types that share a key. Groups are ordered by their first type, and types keep their order.
+ */
+template<type_list_like, template<typename> class KeyFn>
+struct type_list_group_by;
+
+template<template<typename...> class List, template<typename> class KeyFn, typename... Types>
+struct type_list_group_by<List<Types...>, KeyFn>
+    : detail::type_list_group_by_impl<List<Types...>,
+        detail::type_list_group_ids<typename KeyFn<Types>::type...>,
+        std::make_index_sequence<detail::group_count<
+            detail::type_list_group_ids<typename KeyFn<Types>::type...>>>>
 {};
 
-template<template<typename> class Pred, typename CompType, typename... Heads, typename... Types>
-struct type_list_filter_impl<0, type_list<Heads...>, type_list<Types...>, Pred, CompType, false>
-    : std::type_identity<type_list<Heads..., Types...>>
+template<type_list_like T, template<typename> class KeyFn>
+using type_list_group_by_t = type_list_group_by<T, KeyFn>::type;
+
+
+/**
+ * \brief Left fold of a type list, Op<...Op<Op<Init, T0>::type, T1>::type..., Tn>::type.
+ *
+ * The fold is a single fold expression, so its instantiation depth does not
+ * grow with the length of the list.
+ */
+template<type_list_like, typename Init, template<typename, typename> class Op>
+struct type_list_fold;
+
+template<template<typename...> class List, typename Init, template<typename, typename> class Op, typename... Types>
+struct type_list_fold<List<Types...>, Init, Op>
+    : std::type_identity<typename decltype((
+        detail::type_list_fold_box<Init, Op>{} + ... + detail::type_list_fold_item<Types>{}))::type>
 {};
 
-} // namespace detail
+template<type_list_like T, typename Init, template<typename, typename> class Op>
+using type_list_fold_t = type_list_fold<T, Init, Op>::type;
+
+
+/**
+ * \brief Zip type lists into a type_list of type_list tuples.
+ *
+ * The result is as long as the shortest list.
+ */
+template<type_list_like TypeList, type_list_like... RestTypeLists>
+struct type_list_zip
+    : detail::type_list_zip_impl<
+        std::make_index_sequence<std::min({ type_list_size_v<TypeList>, type_list_size_v<RestTypeLists>... })>,
+        TypeList, RestTypeLists...>
+{};
 
+template<type_list_like... TypeLists>
+using type_list_zip_t = type_list_zip<TypeLists...>::type;
 
 
-/// class type_list_remove
-template<std::size_t Idx, typename Head, typename... Types>
-struct type_list_remove<Idx, type_list<Head, Types...>>
-    : std::type_identity<typename detail::type_list_remove_impl<Idx-1, type_list<Types...>, type_list<Head>>::type>
+/**
+ * \brief Split a type list into a type_list of consecutive lists of \a N types.
+ *
+ * The last chunk holds the remaining types and may be shorter.
+ */
+template<std::size_t N, type_list_like T>
+requires (N > 0)
+struct type_list_chunk
+    : detail::type_list_chunk_impl<N, T,
+        std::make_index_sequence<(type_list_size_v<T> + N - 1) / N>>
 {};
 
-template<typename Head, typename... Types>
-struct type_list_remove<0, type_list<Head, Types...>>
-    : std::type_identity<type_list<Types...>>
+template<std::size_t N, type_list_like T>
+using type_list_chunk_t = type_list_chunk<N, T>::type;
+
+
+/**
+ * \brief Pair every type with its position, as
+ * type_list<std::integral_constant<std::size_t, I>, T>.
+ */
+template<type_list_like> struct type_list_enumerate;
+
+template<template<typename...> class List, typename... Types>
+struct type_list_enumerate<List<Types...>>
+    : detail::type_list_enumerate_impl<std::index_sequence_for<Types...>, Types...>
 {};
 
+template<type_list_like T>
+using type_list_enumerate_t = type_list_enumerate<T>::type;
 
-/// insert
-template<std::size_t Idx, typename, type_list_like T>
-requires (Idx <= type_list_size_v<T>)
-struct type_list_insert;
 
-template<std::size_t Idx, typename NewType, typename Head, typename... Types>
-requires (Idx > 0)
-struct type_list_insert<Idx, NewType, type_list<Head, Types...>>
-    : std::type_identity<typename detail::type_list_insert_impl<Idx-1, NewType, type_list<Head>, type_list<Types...>>::type>
+namespace detail
+{
+
+/// product impl
+// Row K takes element Digits[j] of the j-th list, where Digits is the
+// mixed-radix representation of K with the last list varying fastest.
+template<std::size_t... Sizes>
+consteval std::array<std::size_t, sizeof...(Sizes)> product_digits(std::size_t k)
+{
+    const std::array<std::size_t, sizeof...(Sizes)> sizes{ Sizes... };
+    std::array<std::size_t, sizeof...(Sizes)> digits{};
+    for (std::size_t j = sizes.size(); j-- > 0;) {
+        digits[j] = k % sizes[j];
+        k /= sizes[j];
+    }
+    return digits;
+}
+
+template<typename, typename, type_list_like... TypeLists>
+struct type_list_product_rows;
+
+template<std::size_t... Js, std::size_t... Ks, type_list_like... TypeLists>
+struct type_list_product_rows<std::index_sequence<Js...>, std::index_sequence<Ks...>, TypeLists...>
+{
+    template<std::size_t K>
+    using row = type_list<type_list_element_t<
+        product_digits<type_list_size_v<TypeLists>...>(K)[Js], TypeLists>...>;
+
+    template<template<typename> class Pred>
+    static constexpr std::array<bool, sizeof...(Ks)> flags{ Pred<row<Ks>>::value... };
+};
+
+template<type_list_like... TypeLists>
+using type_list_product_rows_t = type_list_product_rows<
+    std::index_sequence_for<TypeLists...>,
+    std::make_index_sequence<(type_list_size_v<TypeLists> * ...)>,
+    TypeLists...>;
+
+template<typename Rows, auto Positions, typename = std::make_index_sequence<Positions.size()>>
+struct type_list_product_select;
+
+template<typename Rows, auto Positions, std::size_t... Is>
+struct type_list_product_select<Rows, Positions, std::index_sequence<Is...>>
+    : std::type_identity<type_list<typename Rows::template row<Positions[Is]>...>>
 {};
 
-template<typename NewType, typename... Types>
-struct type_list_insert<0, NewType, type_list<Types...>>
-    : std::type_identity<type_list<NewType, Types...>>
+} // namespace detail
+
+
+/**
+ * \brief Cartesian product of type lists, as a type_list of type_list tuples.
+ *
+ * Every tuple is built directly from its index, so the product is expanded
+ * in one step whatever the number of lists. The last list varies fastest.
+ *
+ * \par Example
+ * \code
+ * using kernels = type_list_product_t<type_list<float, double>, type_list<row_major, col_major>>;
+ * // type_list<type_list<float, row_major>, type_list<float, col_major>,
+ * //           type_list<double, row_major>, type_list<double, col_major>>
+ * \endcode
+ */
+template<type_list_like TypeList, type_list_like... RestTypeLists>
+struct type_list_product
+    : detail::type_list_product_select<
+        detail::type_list_product_rows_t<TypeList, RestTypeLists...>,
+        detail::iota_indices<(type_list_size_v<TypeList> * ... * type_list_size_v<RestTypeLists>)>()>
 {};
 
-template<std::size_t Idx, typename NewType, type_list_like T>
-using type_list_insert_t = type_list_insert<Idx, NewType, T>::type;
+template<type_list_like... TypeLists>
+using type_list_product_t = type_list_product<TypeLists...>::type;
 
-template<typename NewType, type_list_like T>
-using type_list_push_front = type_list_insert_t<0, NewType, T>;
 
-template<typename NewType, type_list_like T>
-using type_list_push_back = type_list_insert_t<type_list_size_v<T>, NewType, T>;
+/**
+ * \brief Cartesian product of type lists keeping only the tuples that satisfy \a Pred.
+ *
+ * \a Pred is evaluated on each type_list tuple, and rejected tuples never
+ * become part of the result.
+ */
+template<template<typename> class Pred, type_list_like TypeList, type_list_like... RestTypeLists>
+struct type_list_product_if
+    : detail::type_list_product_select<
+        detail::type_list_product_rows_t<TypeList, RestTypeLists...>,
+        detail::flag_indices<
+            detail::type_list_product_rows_t<TypeList, RestTypeLists...>::template flags<Pred>>()>
+{};
 
+template<template<typename> class Pred, type_list_like... TypeLists>
+using type_list_product_if_t = type_list_product_if<Pred, TypeLists...>::type;
 
-/// filter
-template<typename T, typename>
-struct filter {};
 
+/**
+ * \brief Sort a type list by the stable type identifier of its elements.
+ *
+ * The order is given by \ref type_name, so it is the same in every translation
+ * unit. Types with equal names keep their relative order.
+ */
+template<type_list_like> struct type_list_sort;
 
-/// reverse
-template<type_list_like> struct type_list_reverse;
+template<template<typename...> class List, typename... Types>
+struct type_list_sort<List<Types...>>
+    : std::type_identity<detail::type_list_select_t<List<Types...>,
+        detail::type_list_sort_indices<detail::iota_indices<sizeof...(Types)>(), Types...>>>
+{};
 
-template<typename... Types>
-struct type_list_reverse<type_list<Types...>>
-    : std::type_identity<typename detail::type_list_reverse_impl<
-            type_list_size_v<type_list<Types...>> - 1,
-            type_list<type_list_last<type_list<Types...>>>,
-            type_list_pop_back<type_list<Types...>>>::type>
+template<type_list_like T>
+using type_list_sort_t = type_list_sort<T>::type;
+
+
+/**
+ * \brief Canonical form of a type list.
+ *
+ * Two lists holding the same set of types, regardless of order and duplicates,
+ * have the same canonical form, e.g. type_list<B, A, A> and type_list<A, B>.
+ *
+ * \note Types are ordered by \ref type_name, and distinct types with the same
+ * name, such as lambdas on some compilers, keep the order of their first
+ * occurrence. The canonical form of a list holding several of them depends on
+ * the order they appear in, so such lists are only equivalent when they list
+ * these types in the same order.
+ */
+template<type_list_like> struct type_list_canonical;
+
+template<template<typename...> class List, typename... Types>
+struct type_list_canonical<List<Types...>>
+    : std::type_identity<detail::type_list_select_t<List<Types...>,
+        detail::type_list_sort_indices<
+            detail::flag_indices<detail::type_list_unique_flags<Types...>>(), Types...>>>
+{};
+
+template<type_list_like T>
+using type_list_canonical_t = type_list_canonical<T>::type;
+
+
+/// class type_list_equivalent
+template<type_list_like T, type_list_like U>
+struct type_list_equivalent
+    : std::bool_constant<std::same_as<type_list_canonical_t<T>, type_list_canonical_t<U>>>
 {};
 
-template<>
-struct type_list_reverse<type_list<>>
-    : std::type_identity<type_list<>>
+template<type_list_like T, type_list_like U>
+inline constexpr bool type_list_equivalent_v = type_list_equivalent<T, U>::value;
+
+
+namespace detail
+{
+
+/// membership set
+// Every type is a distinct base, so a membership test is a single
+// derived-to-base check instead of a walk over the list.
+template<typename... Types>
+struct type_set : std::type_identity<Types>... {};
+
+template<typename Set, typename U>
+inline constexpr bool type_set_contains = std::is_base_of_v<std::type_identity<U>, Set>;
+
+template<type_list_like> struct type_set_of;
+
+template<template<typename...> class List, typename... Types>
+struct type_set_of<List<Types...>>
+    : std::type_identity<type_set<Types...>>
 {};
 
+// The bases of a class must be distinct, so the list is deduplicated first,
+// at the cost of comparing every pair of its types.
 template<type_list_like T>
-using type_list_reverse_t = type_list_reverse<T>::type;
+using type_set_of_t = type_set_of<type_list_unique_t<T>>::type;
 
 
-/// unique
-template<type_list_like> struct type_list_unique;
+/// set select impl
+// Keeps the types of T whose membership in Set equals Member.
+template<type_list_like T, typename Set, bool Member>
+struct type_list_set_select;
 
-template<typename Head, typename... Types>
-struct type_list_unique<type_list<Head, Types...>>
-    : std::type_identity<typename detail::type_list_unique_impl<
-        type_list_size_v<type_list<Head, Types...>> - 1,
-        type_list<>, type_list<Types...>, Head, false>::type>
+template<template<typename...> class List, typename... Types, typename Set, bool Member>
+struct type_list_set_select<List<Types...>, Set, Member>
+    : std::type_identity<type_list_select_t<List<Types...>,
+        flag_indices<std::array<bool, sizeof...(Types)>{
+            (type_set_contains<Set, Types> == Member)...
+        }>()>>
 {};
 
-template<>
-struct type_list_unique<type_list<>>
-    : std::type_identity<type_list<>>
+template<type_list_like T, typename Set, bool Member>
+using type_list_set_select_t = type_list_set_select<T, Set, Member>::type;
+
+} // namespace detail
+
+
+/**
+ * \brief Set operations over type lists.
+ *
+ * The results hold no duplicates and keep the order of the first list,
+ * followed by the order of the second one. Membership is tested against a
+ * set built once per list, so every type costs one derived-to-base check
+ * instead of a walk over the other list.
+ *
+ * Both lists are deduplicated first, as in \ref type_list_unique, which
+ * compares every pair of types of a list within one constant evaluation.
+ * For lists of N and M types an operation is therefore O(N^2 + M^2) in
+ * constexpr steps, plus N + M lookups; it instantiates no template per pair.
+ */
+template<type_list_like T, type_list_like U>
+struct type_list_intersection
+    : detail::type_list_set_select<type_list_unique_t<T>, detail::type_set_of_t<U>, true>
 {};
 
-template<typename T>
-using type_list_unique_t = type_list_unique<T>::type;
+template<type_list_like T, type_list_like U>
+using type_list_intersection_t = type_list_intersection<T, U>::type;
 
 
-/// filter
-template<type_list_like, template<typename> class Pred>
-requires std::same_as<std::remove_const_t<decltype(Pred<void>::value)>, bool>
-struct type_list_filter;
+/// class type_list_difference
+template<type_list_like T, type_list_like U>
+struct type_list_difference
+    : detail::type_list_set_select<type_list_unique_t<T>, detail::type_set_of_t<U>, false>
+{};
+
+template<type_list_like T, type_list_like U>
+using type_list_difference_t = type_list_difference<T, U>::type;
 
-template<template<typename> class Pred, typename Head, typename... Types>
-struct type_list_filter<type_list<Head, Types...>, Pred>
-    : std::type_identity<typename detail::type_list_filter_impl<
-        type_list_size_v<type_list<Head, Types...>> - 1,
-        type_list<>, type_list<Types...>, Pred, Head,
-        Pred<Head>::value>::type>
+
+/// class type_list_union
+template<type_list_like T, type_list_like U>
+struct type_list_union
+    : type_list_concat<type_list_unique_t<T>, type_list_difference_t<U, T>>
 {};
 
-template<template<typename> class Pred>
-struct type_list_filter<type_list<>, Pred>
-    : std::type_identity<type_list<>>
+template<type_list_like T, type_list_like U>
+using type_list_union_t = type_list_union<T, U>::type;
+
+
+/// class type_list_symmetric_difference
+template<type_list_like T, type_list_like U>
+struct type_list_symmetric_difference
+    : type_list_concat<type_list_difference_t<T, U>, type_list_difference_t<U, T>>
 {};
 
-template<type_list_like T, template<typename> class Pred>
-using type_list_filter_t = type_list_filter<T, Pred>::type;
+template<type_list_like T, type_list_like U>
+using type_list_symmetric_difference_t = type_list_symmetric_difference<T, U>::type;
+
+
+/// class type_list_is_subset
+template<type_list_like T, type_list_like U>
+struct type_list_is_subset;
+
+template<template<typename...> class List, typename... Types, type_list_like U>
+struct type_list_is_subset<List<Types...>, U>
+    : std::bool_constant<(detail::type_set_contains<detail::type_set_of_t<U>, Types> && ...)>
+{};
+
+template<type_list_like T, type_list_like U>
+inline constexpr bool type_list_is_subset_v = type_list_is_subset<T, U>::value;
+
+
+/**
+ * \brief Instantiate a template with the canonical form of a type list.
+ *
+ * Routes every list equivalent to \a T to the same specialization of
+ * \a Template, so that e.g. handler<type_list<A, B>> is emitted once
+ * instead of once per ordering of its types.
+ *
+ * \par Example
+ * \code
+ * template<typename List> struct handler;
+ *
+ * using h1 = canonical_instantiation_t<handler, type_list<A, B>>;
+ * using h2 = canonical_instantiation_t<handler, type_list<B, A, A>>;
+ * static_assert(std::is_same_v<h1, h2>);
+ * \endcode
+ */
+template<template<typename> class Template, type_list_like T>
+struct canonical_instantiation
+    : std::type_identity<Template<type_list_canonical_t<T>>>
+{};
+
+template<template<typename> class Template, type_list_like T>
+using canonical_instantiation_t = canonical_instantiation<Template, T>::type;
 
 
 } // namespace gmp
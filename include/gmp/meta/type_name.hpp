@@ -0,0 +1,60 @@
+/**
+ * \file type_name.hpp
+ * \brief Compile-time type names usable as stable type identifiers.
+ */
+#ifndef GMP_TYPE_NAME_HPP_
+#define GMP_TYPE_NAME_HPP_
+
+#include <cstddef> // size_t
+#include <string_view>
+
+
+namespace gmp
+{
+
+namespace detail
+{
+
+template<typename T>
+constexpr std::string_view raw_type_name() noexcept
+{
+#if defined(__clang__) || defined(__GNUC__)
+    return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+    return __FUNCSIG__;
+#else
+#error "gmp::type_name is not supported by this compiler"
+#endif
+}
+
+// The decorations around the type name are the same for every T,
+// so they are measured once on a known type.
+inline constexpr std::string_view raw_type_name_probe = raw_type_name<void>();
+inline constexpr std::size_t type_name_prefix = raw_type_name_probe.find("void");
+inline constexpr std::size_t type_name_suffix
+    = raw_type_name_probe.size() - type_name_prefix - std::string_view{"void"}.size();
+
+} // namespace detail
+
+
+/**
+ * \brief Get the compiler-generated name of a type at compile time.
+ *
+ * The name is stable for a given compiler and is the same in every translation
+ * unit, so it can be used to order types deterministically. Distinct unnamed
+ * types (e.g. lambdas) are not guaranteed to have distinct names.
+ *
+ * \tparam T The type to be named.
+ * \return A view of the name of \a T.
+ */
+template<typename T>
+constexpr std::string_view type_name() noexcept
+{
+    constexpr std::string_view raw = detail::raw_type_name<T>();
+    return raw.substr(detail::type_name_prefix,
+                      raw.size() - detail::type_name_prefix - detail::type_name_suffix);
+}
+
+} // namespace gmp
+
+#endif // GMP_TYPE_NAME_HPP_
@@ -0,0 +1,98 @@
+/**
+ * \file unroll.hpp
+ * \brief Unrolled loops split into functions of bounded size.
+ *
+ * Register allocation and scheduling take superlinear time in the size of a
+ * function, so one function holding hundreds of unrolled iterations can take
+ * longer to optimize than the rest of its translation unit. \ref unroll_chunked
+ * emits the same iterations as a sequence of calls to functions of at most
+ * Chunk iterations each.
+ */
+#ifndef GMP_UNROLL_HPP_
+#define GMP_UNROLL_HPP_
+
+#include <cstddef> // size_t
+#include <type_traits> // integral_constant
+#include <utility> // index_sequence
+
+
+/**
+ * \def GMP_NOINLINE
+ * \brief Keeps the compiler from inlining a function into its callers.
+ *
+ * May be defined before including this header, e.g. as nothing.
+ */
+#ifndef GMP_NOINLINE
+#  if defined(_MSC_VER)
+#    define GMP_NOINLINE __declspec(noinline)
+#  else
+#    define GMP_NOINLINE __attribute__((noinline))
+#  endif
+#endif
+
+
+namespace gmp
+{
+
+namespace detail
+{
+
+/// the iterations [Begin, Begin + sizeof...(Is)) of an unrolled loop
+template<bool NoInline>
+struct unroll_chunk
+{
+    template<std::size_t Begin, typename F, std::size_t... Is>
+    static constexpr void run(F& f, std::index_sequence<Is...>)
+    {
+        (f(std::integral_constant<std::size_t, Begin + Is>{}), ...);
+    }
+};
+
+template<>
+struct unroll_chunk<true>
+{
+    template<std::size_t Begin, typename F, std::size_t... Is>
+    GMP_NOINLINE static constexpr void run(F& f, std::index_sequence<Is...>)
+    {
+        (f(std::integral_constant<std::size_t, Begin + Is>{}), ...);
+    }
+};
+
+template<std::size_t Count, std::size_t Chunk, bool NoInline, typename F, std::size_t... Cs>
+constexpr void unroll_chunks(F& f, std::index_sequence<Cs...>)
+{
+    (unroll_chunk<NoInline>::template run<Cs * Chunk>(
+        f, std::make_index_sequence<(Cs + 1) * Chunk < Count ? Chunk : Count - Cs * Chunk>{}), ...);
+}
+
+} // namespace detail
+
+
+/**
+ * \brief Call \a f with each index in [0, Count), Chunk calls per function.
+ *
+ * \a f is called as `f(std::integral_constant<std::size_t, I>{})` for every
+ * \a I in order. The calls are unrolled into one function per group of Chunk
+ * consecutive indices, and these functions are called in sequence. With
+ * NoInline, which is the default, the optimizer cannot merge them back into
+ * the caller, so it works on functions of bounded size whatever Count is.
+ *
+ * \tparam Count The number of iterations.
+ * \tparam Chunk The largest number of iterations emitted in one function.
+ * \tparam NoInline Whether the functions are marked \ref GMP_NOINLINE.
+ *
+ * \par Example
+ * \code
+ * gmp::unroll_chunked<256, 32>([&](auto i) { out[i] = a[i] * b[i]; });
+ * \endcode
+ */
+template<std::size_t Count, std::size_t Chunk, bool NoInline = true, typename F>
+constexpr void unroll_chunked(F&& f)
+{
+    static_assert(Chunk > 0, "a chunk holds at least one iteration");
+    detail::unroll_chunks<Count, Chunk, NoInline>(f, std::make_index_sequence<(Count + Chunk - 1) / Chunk>{});
+}
+
+} // namespace gmp
+
+#endif // GMP_UNROLL_HPP_
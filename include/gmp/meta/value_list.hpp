@@ -0,0 +1,354 @@
+/**
+ * \file value_list.hpp
+ * \brief Definition of the value_list template structure.
+ */
+#ifndef GMP_VALUE_LIST_HPP_
+#define GMP_VALUE_LIST_HPP_
+
+#include <array>
+#include <concepts>
+#include <cstddef> // size_t
+#include <string_view>
+#include <utility> // index_sequence
+#include <type_traits> // type_identify
+
+#include <gmp/meta/detail/index_engine.hpp>
+
+
+namespace gmp
+{
+
+/**
+ * \brief A variadic template structure representing a list of values.
+ *
+ * The value_list template is the non-type counterpart of type_list. It may hold
+ * values of different types, such as integers, enumerators or \ref fixed_string.
+ *
+ * Its algorithms compute the positions of the result with constexpr loops
+ * over std::array and then expand the result once, instead of instantiating
+ * a class template for every step.
+ *
+ * \tparam Vs The values to be held in the value list.
+ */
+template<auto...> struct value_list {};
+
+
+/**
+ * \brief A string literal usable as a non-type template argument.
+ *
+ * \par Example
+ * \code
+ * using names = value_list<fixed_string{"x"}, fixed_string{"y"}>;
+ * \endcode
+ */
+template<std::size_t N>
+struct fixed_string
+{
+    char data[N]{};
+
+    constexpr fixed_string(const char (&str)[N]) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
+            data[i] = str[i];
+    }
+
+    constexpr std::size_t size() const noexcept { return N - 1; }
+    constexpr std::string_view view() const noexcept { return { data, N - 1 }; }
+
+    template<std::size_t M>
+    friend constexpr bool operator==(const fixed_string& lhs, const fixed_string<M>& rhs) noexcept
+    {
+        return lhs.view() == rhs.view();
+    }
+
+    template<std::size_t M>
+    friend constexpr bool operator<(const fixed_string& lhs, const fixed_string<M>& rhs) noexcept
+    {
+        return lhs.view() < rhs.view();
+    }
+};
+
+
+/**
+ * \brief The default ordering used by \ref value_list_sort.
+ */
+struct value_less
+{
+    template<typename T, typename U>
+    constexpr bool operator()(const T& lhs, const U& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+
+/// class value_list_size
+template<typename> struct value_list_size;
+
+template<auto... Values>
+struct value_list_size<value_list<Values...>>
+    : std::integral_constant<std::size_t, sizeof...(Values)> {};
+
+template<typename T>
+inline constexpr std::size_t value_list_size_v = value_list_size<T>::value;
+
+
+namespace detail
+{
+
+/// element impl
+// Every value is a distinct base, so looking one up by index is a single
+// overload resolution instead of a recursive instantiation.
+template<std::size_t, auto>
+struct indexed_value {};
+
+template<typename, auto...>
+struct indexed_values;
+
+template<std::size_t... Is, auto... Values>
+struct indexed_values<std::index_sequence<Is...>, Values...>
+    : indexed_value<Is, Values>...
+{};
+
+template<std::size_t Idx, auto Value>
+consteval auto value_at(indexed_value<Idx, Value>) { return Value; }
+
+template<auto... Values>
+inline constexpr indexed_values<std::index_sequence_for<decltype(Values)...>, Values...> value_table{};
+
+
+/// select impl
+// Materializes value_list<Values[Indices[0]], Values[Indices[1]], ...>.
+template<typename, auto, typename>
+struct value_list_select_impl;
+
+template<auto... Values, auto Indices, std::size_t... Is>
+struct value_list_select_impl<value_list<Values...>, Indices, std::index_sequence<Is...>>
+    : std::type_identity<value_list<value_at<Indices[Is]>(value_table<Values...>)...>>
+{};
+
+template<typename T, auto Indices>
+using value_list_select_t = value_list_select_impl<T, Indices, std::make_index_sequence<Indices.size()>>::type;
+
+
+/// equality of values of possibly different types
+inline constexpr auto value_equal = []<typename T, typename U>(const T& lhs, const U& rhs) {
+    if constexpr (std::same_as<T, U>)
+        return lhs == rhs;
+    else
+        return false;
+};
+
+
+/// pairwise relation table
+// Row-major N x N table of Relation(Values[i], Values[j]).
+template<auto Relation, auto... Values>
+consteval auto value_list_relation()
+{
+    constexpr std::size_t N = sizeof...(Values);
+    std::array<bool, N * N> table{};
+    std::size_t k = 0;
+    auto row = [&](const auto& lhs) {
+        ((table[k++] = static_cast<bool>(Relation(lhs, Values))), ...);
+    };
+    (row(Values), ...);
+    return table;
+}
+
+template<auto Relation, auto... Values>
+inline constexpr auto value_list_relation_v = value_list_relation<Relation, Values...>();
+
+
+/// unique impl
+template<auto... Values>
+inline constexpr auto value_list_unique_flags
+    = first_occurrence_flags<sizeof...(Values)>([](std::size_t i, std::size_t j) {
+        return value_list_relation_v<value_equal, Values...>[i * sizeof...(Values) + j];
+    });
+
+
+/// sort impl
+template<auto Compare, auto... Values>
+inline constexpr auto value_list_sort_indices
+    = stable_sort_indices(iota_indices<sizeof...(Values)>(), [](std::size_t i, std::size_t j) {
+        return value_list_relation_v<Compare, Values...>[i * sizeof...(Values) + j];
+    });
+
+
+/// concat impl
+template<typename>
+struct value_list_concat_box {};
+
+template<auto... LValues, auto... RValues>
+value_list_concat_box<value_list<LValues..., RValues...>>
+operator+(value_list_concat_box<value_list<LValues...>>, value_list_concat_box<value_list<RValues...>>);
+
+template<typename T>
+struct value_list_concat_unbox;
+
+template<typename T>
+struct value_list_concat_unbox<value_list_concat_box<T>>
+    : std::type_identity<T>
+{};
+
+} // namespace detail
+
+
+/// class value_list_element
+template<std::size_t Idx, typename T>
+requires (Idx < value_list_size_v<T>)
+struct value_list_element;
+
+template<std::size_t Idx, auto... Values>
+struct value_list_element<Idx, value_list<Values...>>
+{
+    static constexpr auto value = detail::value_at<Idx>(detail::value_table<Values...>);
+};
+
+template<std::size_t Idx, typename T>
+inline constexpr auto value_list_element_v = value_list_element<Idx, T>::value;
+
+
+/// contains
+template<auto Value, typename T>
+struct value_list_contains;
+
+template<auto Value, auto... Values>
+struct value_list_contains<Value, value_list<Values...>>
+    : std::bool_constant<(detail::value_equal(Value, Values) || ...)>
+{};
+
+template<auto Value, typename T>
+inline constexpr bool value_list_contains_v = value_list_contains<Value, T>::value;
+
+
+/// class value_list_concat
+// Concatenated with a single fold expression, whatever the number of lists.
+template<typename... ValueLists>
+struct value_list_concat
+    : detail::value_list_concat_unbox<
+        decltype((detail::value_list_concat_box<value_list<>>{} + ... + detail::value_list_concat_box<ValueLists>{}))>
+{};
+
+template<typename... ValueLists>
+using value_list_concat_t = value_list_concat<ValueLists...>::type;
+
+
+/// class value_list_remove
+template<std::size_t Idx, typename T>
+requires (Idx < value_list_size_v<T>)
+struct value_list_remove;
+
+template<std::size_t Idx, auto... Values>
+struct value_list_remove<Idx, value_list<Values...>>
+    : std::type_identity<detail::value_list_select_t<value_list<Values...>,
+        detail::remove_indices<sizeof...(Values), Idx>()>>
+{};
+
+template<std::size_t Idx, typename T>
+using value_list_remove_t = value_list_remove<Idx, T>::type;
+
+template<typename T>
+using value_list_pop_front = value_list_remove_t<0, T>;
+
+template<typename T>
+using value_list_pop_back = value_list_remove_t<value_list_size_v<T> - 1, T>;
+
+
+/// class value_list_insert
+template<std::size_t Idx, auto, typename T>
+requires (Idx <= value_list_size_v<T>)
+struct value_list_insert;
+
+template<std::size_t Idx, auto NewValue, auto... Values>
+struct value_list_insert<Idx, NewValue, value_list<Values...>>
+    : std::type_identity<detail::value_list_select_t<value_list<Values..., NewValue>,
+        detail::insert_indices<sizeof...(Values), Idx>()>>
+{};
+
+template<std::size_t Idx, auto NewValue, typename T>
+using value_list_insert_t = value_list_insert<Idx, NewValue, T>::type;
+
+template<auto NewValue, typename T>
+using value_list_push_front = value_list_insert_t<0, NewValue, T>;
+
+template<auto NewValue, typename T>
+using value_list_push_back = value_list_insert_t<value_list_size_v<T>, NewValue, T>;
+
+
+/// class value_list_reverse
+template<typename> struct value_list_reverse;
+
+template<auto... Values>
+struct value_list_reverse<value_list<Values...>>
+    : std::type_identity<detail::value_list_select_t<value_list<Values...>,
+        detail::reverse_indices<sizeof...(Values)>()>>
+{};
+
+template<typename T>
+using value_list_reverse_t = value_list_reverse<T>::type;
+
+
+/**
+ * \brief Remove repeated values, keeping the first occurrence of each.
+ *
+ * Values of different types are always distinct, e.g. 1 and 1u.
+ */
+template<typename> struct value_list_unique;
+
+template<auto... Values>
+struct value_list_unique<value_list<Values...>>
+    : std::type_identity<detail::value_list_select_t<value_list<Values...>,
+        detail::flag_indices<detail::value_list_unique_flags<Values...>>()>>
+{};
+
+template<typename T>
+using value_list_unique_t = value_list_unique<T>::type;
+
+
+/**
+ * \brief Keep the values for which \a Pred returns true.
+ *
+ * \par Example
+ * \code
+ * using evens = value_list_filter_t<value_list<1, 2, 3, 4>, [](auto v) { return v % 2 == 0; }>;
+ * // value_list<2, 4>
+ * \endcode
+ */
+template<typename, auto Pred>
+struct value_list_filter;
+
+template<auto... Values, auto Pred>
+struct value_list_filter<value_list<Values...>, Pred>
+    : std::type_identity<detail::value_list_select_t<value_list<Values...>,
+        detail::flag_indices<std::array<bool, sizeof...(Values)>{
+            static_cast<bool>(Pred(Values))...
+        }>()>>
+{};
+
+template<typename T, auto Pred>
+using value_list_filter_t = value_list_filter<T, Pred>::type;
+
+
+/**
+ * \brief Stable sort of a value list by \a Compare.
+ *
+ * \a Compare is called on every pair of values, which may be of different
+ * types as long as they are comparable.
+ */
+template<typename, auto Compare = value_less{}>
+struct value_list_sort;
+
+template<auto... Values, auto Compare>
+struct value_list_sort<value_list<Values...>, Compare>
+    : std::type_identity<detail::value_list_select_t<value_list<Values...>,
+        detail::value_list_sort_indices<Compare, Values...>>>
+{};
+
+template<typename T, auto Compare = value_less{}>
+using value_list_sort_t = value_list_sort<T, Compare>::type;
+
+
+} // namespace gmp
+
+#endif // GMP_VALUE_LIST_HPP_
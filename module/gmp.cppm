@@ -0,0 +1,36 @@
+/**
+ * \file gmp.cppm
+ * \brief The gmp named module.
+ *
+ * Exports the type_list API, so that `import gmp;` replaces
+ * `#include <gmp/meta/type_list.hpp>`. Macros cannot cross a module
+ * boundary: the gmp/macro headers still have to be included.
+ *
+ * The header is included in an `export extern "C++"` block rather than
+ * re-exported name by name: its declarations stay attached to the global
+ * module, so a translation unit may both import gmp and include the header,
+ * and GCC, which cannot re-export using-declarations of global module
+ * entities before version 14, builds it too. The standard headers it uses
+ * are included first, in the global module fragment, so that they are not
+ * exported. With GCC 12, a consumer must include standard headers before
+ * `import gmp;`, not after, and must include <string_view> itself for the
+ * comparisons behind type_list_canonical and type_name to be found.
+ */
+module;
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+export module gmp;
+
+export extern "C++"
+{
+#include <gmp/meta/type_list.hpp>
+}
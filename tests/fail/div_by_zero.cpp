@@ -0,0 +1,4 @@
+// A division by zero must not silently become a value in code.
+#include <gmp/macro/number.hpp>
+
+constexpr int quotient = GMP_DIV(100, 0);
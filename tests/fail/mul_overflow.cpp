@@ -0,0 +1,4 @@
+// A product past GMP_MAX_NUMBER must not silently wrap.
+#include <gmp/macro/number.hpp>
+
+constexpr int product = GMP_MUL(100, 200);
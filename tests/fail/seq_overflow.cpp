@@ -0,0 +1,6 @@
+// A sequence longer than GMP_SEQ_MAX_SIZE does not compile.
+#include <gmp/macro/seq.hpp>
+
+#include "macro/long_seq.hpp"
+
+static_assert(GMP_SEQ_SIZE(SEQ_4096 (1)) > 0);
@@ -0,0 +1,5 @@
+// A negative difference must not silently become a value in #if.
+#include <gmp/macro/number.hpp>
+
+#if GMP_SUB(3, 10)
+#endif
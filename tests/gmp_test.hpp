@@ -0,0 +1,82 @@
+/**
+ * \file gmp_test.hpp
+ * \brief Compile-time checks of macro expansions.
+ */
+#ifndef GMP_TESTS_GMP_TEST_HPP_
+#define GMP_TESTS_GMP_TEST_HPP_
+
+#include <cstddef> // size_t
+#include <string>
+#include <string_view>
+
+
+/**
+ * \def GMP_TEST_EXPANDS_TO(expansion, expected)
+ * \brief Check that a macro call expands to the expected tokens.
+ *
+ * Both arguments are parenthesized so that they may contain commas. The
+ * expected tokens are not expanded, and whitespace only matters where it
+ * separates two identifiers or numbers. The check is a static assertion, so
+ * the call is followed by a semicolon.
+ *
+ * \code
+ * GMP_TEST_EXPANDS_TO((GMP_CONCAT(a, b)), (ab));
+ * \endcode
+ */
+#define GMP_TEST_EXPANDS_TO(expansion, expected) \
+    static_assert(::gmp_test::same_tokens(GMP_TEST_STRING(expansion), #expected), #expansion)
+
+/**
+ * \def GMP_TEST_SAME_EXPANSION(lhs, rhs)
+ * \brief Check that two macro calls expand to the same tokens.
+ */
+#define GMP_TEST_SAME_EXPANSION(lhs, rhs) \
+    static_assert(::gmp_test::same_tokens(GMP_TEST_STRING(lhs), GMP_TEST_STRING(rhs)), #lhs)
+
+/// \def GMP_TEST_STRING(expansion) The expansion of a parenthesized macro call as a string literal, with its parentheses.
+#define GMP_TEST_STRING(expansion) _GMP_TEST_STRINGIZE(expansion)
+#define _GMP_TEST_STRINGIZE(...) _GMP_TEST_STRINGIZE_I(__VA_ARGS__)
+#define _GMP_TEST_STRINGIZE_I(...) #__VA_ARGS__
+
+
+namespace gmp_test
+{
+
+constexpr bool is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+constexpr bool is_word(char c)
+{
+    return c == '_' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+/// \a s with whitespace removed, except a single space between two words
+constexpr std::string normalize(std::string_view s)
+{
+    std::string out;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        if (!is_space(s[i])) {
+            out += s[i];
+            continue;
+        }
+        while (i + 1 < s.size() && is_space(s[i + 1]))
+            ++i;
+        if (!out.empty() && i + 1 < s.size() && is_word(out.back()) && is_word(s[i + 1]))
+            out += ' ';
+    }
+    return out;
+}
+
+constexpr bool same_tokens(std::string_view lhs, std::string_view rhs)
+{
+    return normalize(lhs) == normalize(rhs);
+}
+
+static_assert(same_tokens("( a ,b )", "(a, b)"));
+static_assert(!same_tokens("(a b)", "(ab)"));
+
+} // namespace gmp_test
+
+#endif // GMP_TESTS_GMP_TEST_HPP_
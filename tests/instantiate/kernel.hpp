@@ -0,0 +1,27 @@
+#ifndef GMP_TESTS_INSTANTIATE_KERNEL_HPP_
+#define GMP_TESTS_INSTANTIATE_KERNEL_HPP_
+
+#include <cstddef> // size_t
+
+#include <gmp/macro/instantiate.hpp>
+
+
+template<typename T>
+struct kernel
+{
+    static std::size_t size();
+};
+
+// Defined out of the class, so that it is not inline and the extern
+// declarations below keep other translation units from instantiating it.
+template<typename T>
+std::size_t kernel<T>::size()
+{
+    return sizeof(T);
+}
+
+#define KERNEL_DECL(T) struct kernel<T>
+
+GMP_EXTERN_TEMPLATES(KERNEL_DECL, char, short, int, long, float, double, long double)
+
+#endif // GMP_TESTS_INSTANTIATE_KERNEL_HPP_
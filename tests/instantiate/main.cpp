@@ -0,0 +1,15 @@
+// Links only if the shards generated by gmp_shard_instantiations() define
+// every specialization declared extern by kernel.hpp.
+#include "kernel.hpp"
+
+int main()
+{
+    const bool ok = kernel<char>::size() == sizeof(char)
+        && kernel<short>::size() == sizeof(short)
+        && kernel<int>::size() == sizeof(int)
+        && kernel<long>::size() == sizeof(long)
+        && kernel<float>::size() == sizeof(float)
+        && kernel<double>::size() == sizeof(double)
+        && kernel<long double>::size() == sizeof(long double);
+    return ok ? 0 : 1;
+}
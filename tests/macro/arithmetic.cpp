@@ -0,0 +1,53 @@
+#include <gmp/macro/arith.hpp>
+#include <gmp/macro/number.hpp>
+
+#include "gmp_test.hpp"
+
+GMP_TEST_EXPANDS_TO((GMP_ADD(200, 54)), (254));
+GMP_TEST_EXPANDS_TO((GMP_ADD(0, 0)), (0));
+GMP_TEST_EXPANDS_TO((GMP_ADD(254, 254)), (508));
+GMP_TEST_EXPANDS_TO((GMP_SUB(64, 16)), (48));
+GMP_TEST_EXPANDS_TO((GMP_SUB(7, 7)), (0));
+GMP_TEST_EXPANDS_TO((GMP_SUB(100, 1)), (99));
+GMP_TEST_EXPANDS_TO((GMP_MUL(16, 32)), (512));
+GMP_TEST_EXPANDS_TO((GMP_MUL(0, 254)), (0));
+GMP_TEST_EXPANDS_TO((GMP_MUL(99, 101)), (9999));
+GMP_TEST_EXPANDS_TO((GMP_DIV(100, 7)), (14));
+GMP_TEST_EXPANDS_TO((GMP_DIV(6, 7)), (0));
+GMP_TEST_EXPANDS_TO((GMP_DIV(254, 1)), (254));
+GMP_TEST_EXPANDS_TO((GMP_MOD(100, 7)), (2));
+GMP_TEST_EXPANDS_TO((GMP_MOD(7, 7)), (0));
+GMP_TEST_EXPANDS_TO((GMP_MIN(3, 8) GMP_MIN(8, 3) GMP_MIN(5, 5)), (3 3 5));
+GMP_TEST_EXPANDS_TO((GMP_MAX(3, 8) GMP_MAX(8, 3) GMP_MAX(5, 5)), (8 8 5));
+GMP_TEST_EXPANDS_TO((GMP_LESS(3, 8) GMP_LESS(8, 3) GMP_LESS(5, 5)), (1 0 0));
+GMP_TEST_EXPANDS_TO((GMP_IF(GMP_LESS(3, 8), yes, no) GMP_OR(GMP_LESS(8, 3), GMP_LESS(5, 5))), (yes 0));
+
+// the results may exceed GMP_MAX_INDEX, and the operands may be results
+// within it
+static_assert(GMP_MUL(GMP_MAX_INDEX, 10) == GMP_MAX_INDEX * 10);
+static_assert(GMP_ADD(GMP_MUL(10, 10), 9) == 109);
+static_assert(GMP_MOD(GMP_SIZE_OF_VAARGS(a, b, c, d, e), 3) == 2);
+#if GMP_DIV(GMP_MAX_INDEX, 2) != GMP_MAX_INDEX / 2
+#error "GMP_DIV is not usable in #if"
+#endif
+
+// results out of range are reported by name
+GMP_TEST_EXPANDS_TO((GMP_SUB(3, 10)), (Error_Subtraction_3_Minus_10_Is_Negative;));
+GMP_TEST_EXPANDS_TO((GMP_SUB(0, 1)), (Error_Subtraction_0_Minus_1_Is_Negative;));
+GMP_TEST_EXPANDS_TO((GMP_MUL(100, 200)), (Error_Product_Of_100_And_200_Exceeds_Maximum_Number_9999;));
+GMP_TEST_EXPANDS_TO((GMP_MUL(100, 100)), (Error_Product_Of_100_And_100_Exceeds_Maximum_Number_9999;));
+GMP_TEST_EXPANDS_TO((GMP_MUL(254, 254)), (Error_Product_Of_254_And_254_Exceeds_Maximum_Number_9999;));
+GMP_TEST_EXPANDS_TO((GMP_DIV(100, 0)), (Error_Division_Of_100_By_Zero;));
+GMP_TEST_EXPANDS_TO((GMP_MOD(0, 0)), (Error_Division_Of_0_By_Zero;));
+
+// operands out of range are reported like GMP_CHECK_INDEX
+GMP_TEST_SAME_EXPANSION((GMP_ADD(GMP_INC(GMP_MAX_INDEX), 1)), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+GMP_TEST_SAME_EXPANSION((GMP_MUL(1, GMP_INC(GMP_MAX_INDEX))), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+GMP_TEST_SAME_EXPANSION((GMP_LESS(3, 2000)), (GMP_CHECK_INDEX(2000)));
+GMP_TEST_SAME_EXPANSION((GMP_DIV(2000, 0)), (GMP_CHECK_INDEX(2000)));
+#if GMP_MAX_INDEX == 254
+GMP_TEST_EXPANDS_TO((GMP_ADD(255, 1)), (Error_Index_255_Exceeds_Maximum_Macro_Index_254;));
+GMP_TEST_EXPANDS_TO((GMP_SUB(1, 300)), (Error_Index_300_Exceeds_Maximum_Macro_Index_254;));
+#endif
+
+int main() {}
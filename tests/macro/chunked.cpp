@@ -0,0 +1,42 @@
+#include <gmp/macro/chunked.hpp>
+
+#define STEP(state, step) state = state * 3 + step;
+#define COUNT(n) ++n;
+
+namespace
+{
+
+constexpr int steps()
+{
+    int n = 0;
+    GMP_LOOP_CHUNKED(COUNT, 10, 4, n);
+    return n;
+}
+static_assert(steps() == 10);
+
+constexpr int steps_inline()
+{
+    int n = 0;
+    GMP_LOOP_CHUNKED_INLINE(COUNT, 10, 4, n);
+    return n;
+}
+static_assert(steps_inline() == 10);
+
+// the count is a constant expression, not bounded by GMP_MAX_INDEX
+constexpr int many_steps()
+{
+    int n = 0;
+    GMP_LOOP_CHUNKED(COUNT, 2 * 700 + 1, 64, n);
+    return n;
+}
+static_assert(many_steps() == 1401);
+
+} // namespace
+
+int main()
+{
+    // the arguments are captured by reference and the calls run in order
+    unsigned state = 1;
+    GMP_LOOP_CHUNKED(STEP, 5, 2, state, 1u);
+    return state == 364 ? 0 : 1;
+}
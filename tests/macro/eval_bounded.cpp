@@ -0,0 +1,35 @@
+#include <gmp/macro/loop.hpp>
+
+#include "gmp_test.hpp"
+
+// A deferred recursion of n steps: n n-1 ... 0
+#define COUNTDOWN(n) n GMP_IIF(GMP_BOOL(n), _COUNTDOWN_NEXT, _COUNTDOWN_END)(n)
+#define _COUNTDOWN_NEXT(n) GMP_DEFER(_COUNTDOWN_INDIRECT)()(GMP_DEC(n))
+#define _COUNTDOWN_END(n)
+#define _COUNTDOWN_INDIRECT() COUNTDOWN
+
+GMP_TEST_EXPANDS_TO((GMP_EVAL_BOUNDED(0, COUNTDOWN(0))), (0));
+GMP_TEST_EXPANDS_TO((GMP_EVAL_BOUNDED(1, COUNTDOWN(1))), (1 0));
+
+// the largest count of every GMP_EVAL_N level, and the first of the next one
+GMP_TEST_EXPANDS_TO((GMP_EVAL_BOUNDED(2, COUNTDOWN(2))), (2 1 0));
+GMP_TEST_EXPANDS_TO((GMP_EVAL_BOUNDED(3, COUNTDOWN(3))), (3 2 1 0));
+GMP_TEST_EXPANDS_TO((GMP_EVAL_BOUNDED(5, COUNTDOWN(5))), (5 4 3 2 1 0));
+GMP_TEST_EXPANDS_TO((GMP_EVAL_BOUNDED(6, COUNTDOWN(6))), (6 5 4 3 2 1 0));
+GMP_TEST_EXPANDS_TO((GMP_EVAL_BOUNDED(14, COUNTDOWN(14))), (14 13 12 11 10 9 8 7 6 5 4 3 2 1 0));
+GMP_TEST_EXPANDS_TO((GMP_EVAL_BOUNDED(15, COUNTDOWN(15))), (15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0));
+GMP_TEST_EXPANDS_TO((GMP_EVAL_BOUNDED(41, COUNTDOWN(41))),
+    (41 40 39 38 37 36 35 34 33 32 31 30 29 28 27 26 25 24 23 22 21 20
+     19 18 17 16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0));
+GMP_TEST_SAME_EXPANSION((GMP_EVAL_BOUNDED(122, COUNTDOWN(122))), (GMP_EVAL(COUNTDOWN(122))));
+GMP_TEST_SAME_EXPANSION((GMP_EVAL_BOUNDED(123, COUNTDOWN(123))), (GMP_EVAL(COUNTDOWN(123))));
+GMP_TEST_SAME_EXPANSION((GMP_EVAL_BOUNDED(GMP_MAX_INDEX, COUNTDOWN(GMP_MAX_INDEX))),
+                        (GMP_EVAL(GMP_EVAL(COUNTDOWN(GMP_MAX_INDEX)))));
+
+// a smaller count stops the recursion early; the margin leaves room for
+// the rescans of the test macros themselves
+#define FULL_20 (20 19 18 17 16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0)
+static_assert(!::gmp_test::same_tokens(GMP_TEST_STRING((GMP_EVAL_BOUNDED(2, COUNTDOWN(20)))), GMP_TEST_STRING(FULL_20)));
+static_assert(::gmp_test::same_tokens(GMP_TEST_STRING((GMP_EVAL_BOUNDED(41, COUNTDOWN(20)))), GMP_TEST_STRING(FULL_20)));
+
+int main() {}
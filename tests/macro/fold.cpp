@@ -0,0 +1,16 @@
+#include <gmp/macro/fold.hpp>
+
+#include "gmp_test.hpp"
+
+#define PLUS(s, x) (s + x)
+#define FLAGS(flags, f) flags | f
+#define LAST(s, x) x
+
+GMP_TEST_EXPANDS_TO((GMP_FOLD_LEFT(PLUS, 0, a)), ((0 + a)));
+GMP_TEST_EXPANDS_TO((GMP_FOLD_LEFT(PLUS, 0, a, b, c)), ((((0 + a) + b) + c)));
+GMP_TEST_EXPANDS_TO((GMP_FOLD_LEFT(FLAGS, 0, read, write)), (0 | read | write));
+GMP_TEST_EXPANDS_TO((GMP_FOLD_LEFT(LAST, init, a, b, c)), (c));
+
+static_assert(GMP_FOLD_LEFT(PLUS, 1, 2, 3, 4) == 10);
+
+int main() {}
@@ -0,0 +1,50 @@
+#include <gmp/macro/for_each.hpp>
+
+#include "gmp_test.hpp"
+
+#define CALL(data, i, x) [data i x]
+#define ENUMERATOR(prefix, i, name) prefix##name = i
+#define FIELD(type, i, name) type name = i
+#define ONE(x) +1
+#define SIZE_OF(T) sizeof(T)
+#define PLUS() +
+
+GMP_TEST_EXPANDS_TO((GMP_FOR_EACH_I(CALL, d, a)), ([d 0 a]));
+GMP_TEST_EXPANDS_TO((GMP_FOR_EACH_I(CALL, d, a, b, c)), ([d 0 a] [d 1 b] [d 2 c]));
+GMP_TEST_EXPANDS_TO((GMP_FOR_EACH_I_COMMA(CALL, d, a)), ([d 0 a]));
+GMP_TEST_EXPANDS_TO((GMP_FOR_EACH_I_COMMA(CALL, d, a, b, c)), ([d 0 a], [d 1 b], [d 2 c]));
+GMP_TEST_EXPANDS_TO((GMP_FOR_EACH_I_SEMICOLON(CALL, d, a, b, c)), ([d 0 a]; [d 1 b]; [d 2 c]));
+
+// the data argument may be empty, and the calls see the indices as literals
+GMP_TEST_EXPANDS_TO((GMP_FOR_EACH_I(CALL, , a, b)), ([0 a] [1 b]));
+GMP_TEST_EXPANDS_TO((GMP_FOR_EACH_I(CALL, GMP_EMPTY(), a, b)), ([0 a] [1 b]));
+
+// the separator is not expanded after the last call
+GMP_TEST_EXPANDS_TO((GMP_FOR_EACH_I_SEMICOLON(FIELD, int, x, y);), (int x = 0; int y = 1;));
+
+GMP_TEST_EXPANDS_TO((GMP_FOR_EACH(ONE, a, b, c)), (+1 +1 +1));
+
+GMP_TEST_EXPANDS_TO((GMP_MAP(SIZE_OF, GMP_COMMA, int)), (sizeof(int)));
+GMP_TEST_EXPANDS_TO((GMP_MAP(SIZE_OF, GMP_COMMA, int, long)), (sizeof(int), sizeof(long)));
+GMP_TEST_EXPANDS_TO((GMP_MAP(SIZE_OF, GMP_SEMICOLON, int, long)), (sizeof(int); sizeof(long)));
+GMP_TEST_EXPANDS_TO((GMP_MAP(SIZE_OF, GMP_EMPTY, int, long)), (sizeof(int) sizeof(long)));
+static_assert(GMP_MAP(SIZE_OF, PLUS, char, char, char) == 3);
+
+enum color { GMP_FOR_EACH_I_COMMA(ENUMERATOR, color_, red, green, blue) };
+static_assert(color_red == 0 && color_green == 1 && color_blue == 2);
+
+struct point { GMP_FOR_EACH_I_SEMICOLON(FIELD, int, x, y, z); };
+static_assert(point{}.x == 0 && point{}.y == 1 && point{}.z == 2);
+
+constexpr int which(int i)
+{
+    switch (i) {
+#define CASE(offset, i, x) case i: return offset + x;
+        GMP_FOR_EACH_I(CASE, 100, 7, 8, 9)
+#undef CASE
+    }
+    return -1;
+}
+static_assert(which(0) == 107 && which(2) == 109 && which(3) == -1);
+
+int main() {}
@@ -0,0 +1,86 @@
+// Each macro header brings in what it builds on, and nothing more.
+#include <gmp/macro/core.hpp>
+
+#if !defined(GMP_CONCAT) || !defined(GMP_EVAL)
+#error "core.hpp does not define the core macros"
+#endif
+#if defined(GMP_MAX_INDEX) || defined(GMP_SIZE_OF_VAARGS)
+#error "core.hpp includes varargs.hpp"
+#endif
+
+#include <gmp/macro/varargs.hpp>
+
+#if !defined(GMP_SIZE_OF_VAARGS) || !defined(GMP_OVERLOAD_INVOKE1)
+#error "varargs.hpp does not define the argument list macros"
+#endif
+#if defined(GMP_INC) || defined(GMP_FOR_EACH)
+#error "varargs.hpp includes arith.hpp or for_each.hpp"
+#endif
+
+#include <gmp/macro/arith.hpp>
+
+#if !defined(GMP_INC) || !defined(GMP_EQUAL_INT)
+#error "arith.hpp does not define the arithmetic macros"
+#endif
+#if defined(GMP_FOR_EACH) || defined(GMP_LOOP)
+#error "arith.hpp includes for_each.hpp or loop.hpp"
+#endif
+
+// GMP_FOR_EACH_I counts its indices with the GMP_INC table of arith.hpp.
+#include <gmp/macro/for_each.hpp>
+
+#if !defined(GMP_FOR_EACH) || !defined(GMP_FOR_EACH_I)
+#error "for_each.hpp does not define GMP_FOR_EACH"
+#endif
+#if defined(GMP_LOOP) || defined(GMP_FOLD_LEFT)
+#error "for_each.hpp includes loop.hpp or fold.hpp"
+#endif
+
+#include <gmp/macro/loop.hpp>
+
+#if !defined(GMP_LOOP) || !defined(GMP_RANGE) || !defined(GMP_EVAL_BOUNDED)
+#error "loop.hpp does not define the loops"
+#endif
+#if defined(GMP_NUMBER) || defined(GMP_SEQ_SIZE) || defined(GMP_REPEAT)
+#error "loop.hpp includes number.hpp, seq.hpp or repeat.hpp"
+#endif
+
+// The umbrella leaves out every header with tables of its own beyond those
+// of the loops.
+#include <gmp/macro/macro.hpp>
+
+#if defined(GMP_NUMBER) || defined(GMP_SEQ_SIZE) || defined(GMP_REPEAT)
+#error "macro.hpp includes number.hpp, seq.hpp or repeat.hpp"
+#endif
+#if defined(GMP_TUPLE_ELEM) || defined(GMP_FOLD_LEFT)
+#error "macro.hpp includes tuple.hpp or fold.hpp"
+#endif
+
+#include <gmp/macro/repeat.hpp>
+
+#if !defined(GMP_REPEAT) || !defined(GMP_REPEAT_FROM)
+#error "repeat.hpp does not define the indexed loops"
+#endif
+#if defined(GMP_LOOP_2) || defined(GMP_REPEAT_2)
+#error "repeat.hpp includes loop_nested.hpp"
+#endif
+
+#include <gmp/macro/loop_nested.hpp>
+
+#if !defined(GMP_LOOP_3) || !defined(GMP_REPEAT_3) || !defined(GMP_REPEAT_FROM_3)
+#error "loop_nested.hpp does not define the nested loops"
+#endif
+
+#include <gmp/macro/fold.hpp>
+
+#if !defined(GMP_FOLD_LEFT)
+#error "fold.hpp does not define GMP_FOLD_LEFT"
+#endif
+
+#include <gmp/macro/tuple.hpp>
+
+#if !defined(GMP_TUPLE_SIZE) || !defined(GMP_TUPLE_ELEM) || !defined(GMP_ZIP)
+#error "tuple.hpp does not define the tuple macros"
+#endif
+
+int main() {}
@@ -0,0 +1,40 @@
+#include <gmp/macro/instantiate.hpp>
+
+#include "gmp_test.hpp"
+
+#define DECL(T) struct box<T>
+#define TYPES a, b, c, d, e
+
+GMP_TEST_EXPANDS_TO((GMP_EXTERN_TEMPLATES(DECL, a)), (extern template struct box<a>;));
+GMP_TEST_EXPANDS_TO((GMP_EXTERN_TEMPLATES(DECL, TYPES)),
+    (extern template struct box<a>; extern template struct box<b>; extern template struct box<c>;
+     extern template struct box<d>; extern template struct box<e>;));
+GMP_TEST_EXPANDS_TO((GMP_INSTANTIATE_TEMPLATES(DECL, TYPES)),
+    (template struct box<a>; template struct box<b>; template struct box<c>;
+     template struct box<d>; template struct box<e>;));
+
+// a range starts at begin and stops before end
+GMP_TEST_EXPANDS_TO((GMP_INSTANTIATE_TEMPLATE_RANGE(DECL, 0, 2, TYPES)), (template struct box<a>; template struct box<b>;));
+GMP_TEST_EXPANDS_TO((GMP_INSTANTIATE_TEMPLATE_RANGE(DECL, 1, 3, TYPES)), (template struct box<b>; template struct box<c>;));
+GMP_TEST_EXPANDS_TO((GMP_INSTANTIATE_TEMPLATE_RANGE(DECL, 4, 5, TYPES)), (template struct box<e>;));
+GMP_TEST_EXPANDS_TO((GMP_INSTANTIATE_TEMPLATE_RANGE(DECL, 0, 5, TYPES)),
+    (template struct box<a>; template struct box<b>; template struct box<c>;
+     template struct box<d>; template struct box<e>;));
+
+// the ranges of consecutive shards cover the list once
+GMP_TEST_EXPANDS_TO((GMP_INSTANTIATE_TEMPLATE_RANGE(DECL, 0, 2, TYPES) GMP_INSTANTIATE_TEMPLATE_RANGE(DECL, 2, 5, TYPES)),
+    (template struct box<a>; template struct box<b>; template struct box<c>;
+     template struct box<d>; template struct box<e>;));
+
+// bounds past GMP_MAX_INDEX are reported
+GMP_TEST_SAME_EXPANSION((GMP_INSTANTIATE_TEMPLATE_RANGE(DECL, 0, GMP_INC(GMP_MAX_INDEX), TYPES)),
+                        (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+GMP_TEST_SAME_EXPANSION((GMP_INSTANTIATE_TEMPLATE_RANGE(DECL, 2000, 5, TYPES)), (GMP_CHECK_INDEX(2000)));
+
+// an argument with commas is passed in parentheses
+#define UNPACK(...) __VA_ARGS__
+#define PAIR_DECL(T) struct box<UNPACK T>
+GMP_TEST_EXPANDS_TO((GMP_INSTANTIATE_TEMPLATES(PAIR_DECL, (x, y), (z, w))),
+    (template struct box<x, y>; template struct box<z, w>;));
+
+int main() {}
@@ -0,0 +1,113 @@
+// Built once for every supported GMP_MAX_INDEX, to exercise each generated
+// table up to its last entry.
+#include <gmp/macro/arith.hpp>
+#include <gmp/macro/fold.hpp>
+#include <gmp/macro/for_each.hpp>
+#include <gmp/macro/loop.hpp>
+#include <gmp/macro/loop_nested.hpp>
+#include <gmp/macro/number.hpp>
+#include <gmp/macro/repeat.hpp>
+#include <gmp/macro/seq.hpp>
+#include <gmp/macro/tuple.hpp>
+#include <gmp/macro/varargs.hpp>
+
+#include <cstddef> // size_t
+
+#include "gmp_test.hpp"
+#include "macro/long_seq.hpp"
+
+static_assert(GMP_MAX_INDEX == GMP_TEST_MAX_INDEX);
+
+#define LAST GMP_DEC(GMP_MAX_INDEX)
+#define ALL GMP_RANGE(0, GMP_MAX_INDEX)
+#define ONE(...) +1
+#define INDEX(data, i, x) data[i] == x &&
+#define SUM(acc, x) acc + x
+#define AT(i, data) data[i] == i &&
+#define ZIPPED(data, i, pair) GMP_TUPLE_ELEM(0, pair) == i && GMP_TUPLE_ELEM(1, pair) == i &&
+
+// varargs
+static_assert(GMP_SIZE_OF_VAARGS(ALL) == GMP_MAX_INDEX);
+static_assert(GMP_SIZE_OF_VAARGS(GMP_RANGE(1, GMP_MAX_INDEX)) == LAST);
+static_assert(GMP_HAS_COMMA(ALL) == 1);
+static_assert(GMP_IS_EMPTY(ALL) == 0);
+
+// arith
+static_assert(GMP_INC(LAST) == GMP_MAX_INDEX);
+static_assert(GMP_DEC(GMP_MAX_INDEX) == GMP_MAX_INDEX - 1);
+static_assert(GMP_BOOL(GMP_MAX_INDEX) == 1);
+static_assert(GMP_EQUAL_INT(GMP_MAX_INDEX, GMP_MAX_INDEX) == 1);
+static_assert(GMP_EQUAL_INT(LAST, GMP_MAX_INDEX) == 0);
+static_assert(GMP_CHECK_INDEX_BOOL(GMP_MAX_INDEX) == 1);
+static_assert(GMP_CHECK_INDEX_BOOL(GMP_INC(GMP_MAX_INDEX)) == 0);
+
+// loop
+constexpr std::size_t all[] = { ALL };
+static_assert(sizeof all / sizeof *all == GMP_MAX_INDEX && all[LAST] == LAST);
+constexpr std::size_t sequence[] = { GMP_MAKE_INDEX_SEQUENCE(GMP_MAX_INDEX) };
+static_assert(sizeof sequence / sizeof *sequence == GMP_MAX_INDEX && sequence[LAST] == LAST);
+constexpr std::size_t last[] = { GMP_RANGE(LAST, GMP_MAX_INDEX) };
+static_assert(sizeof last / sizeof *last == 1 && last[0] == LAST);
+static_assert(0 GMP_LOOP(ONE, GMP_MAX_INDEX) == GMP_MAX_INDEX);
+GMP_TEST_SAME_EXPANSION((GMP_RANGE(0, GMP_INC(GMP_MAX_INDEX))), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+
+// repeat
+static_assert(GMP_REPEAT(GMP_MAX_INDEX, AT, all) true);
+static_assert(GMP_REPEAT_FROM(0, GMP_MAX_INDEX, AT, all) true);
+static_assert(GMP_REPEAT_FROM(LAST, GMP_MAX_INDEX, AT, all) true);
+GMP_TEST_SAME_EXPANSION((GMP_REPEAT_FROM(0, GMP_INC(GMP_MAX_INDEX), AT, all)), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+GMP_TEST_SAME_EXPANSION((GMP_REPEAT_FROM(2000, 5, AT, all)), (GMP_CHECK_INDEX(2000)));
+#if GMP_MAX_INDEX == 254
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM(0, 300, AT, all)), (Error_Index_300_Exceeds_Maximum_Macro_Index_254;));
+#endif
+
+// loop_nested
+static_assert(0 GMP_LOOP_2(ONE, GMP_MAX_INDEX) GMP_LOOP_3(ONE, GMP_MAX_INDEX) == 2 * GMP_MAX_INDEX);
+static_assert(GMP_REPEAT_2(GMP_MAX_INDEX, AT, all) GMP_REPEAT_3(GMP_MAX_INDEX, AT, all) true);
+static_assert(GMP_REPEAT_FROM_2(0, GMP_MAX_INDEX, AT, all) GMP_REPEAT_FROM_3(0, GMP_MAX_INDEX, AT, all) true);
+GMP_TEST_SAME_EXPANSION((GMP_REPEAT_FROM_2(0, GMP_INC(GMP_MAX_INDEX), AT, all)), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+GMP_TEST_SAME_EXPANSION((GMP_REPEAT_FROM_3(2000, 5, AT, all)), (GMP_CHECK_INDEX(2000)));
+#if GMP_MAX_INDEX == 254
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM_2(0, 300, AT, all)), (Error_Index_300_Exceeds_Maximum_Macro_Index_254;));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM_3(0, 300, AT, all)), (Error_Index_300_Exceeds_Maximum_Macro_Index_254;));
+#endif
+
+// for_each
+static_assert(0 GMP_FOR_EACH(ONE, ALL) == GMP_MAX_INDEX);
+static_assert(GMP_FOR_EACH_I(INDEX, all, ALL) true);
+static_assert(0 GMP_MAP(ONE, GMP_EMPTY, ALL) == GMP_MAX_INDEX);
+
+// fold
+static_assert(GMP_FOLD_LEFT(SUM, 0, ALL) == GMP_MAX_INDEX * (GMP_MAX_INDEX - 1) / 2);
+
+// tuple
+static_assert(GMP_TUPLE_SIZE((ALL)) == GMP_MAX_INDEX);
+static_assert(GMP_TUPLE_ELEM(0, (ALL)) == 0);
+static_assert(GMP_TUPLE_ELEM(LAST, (ALL)) == LAST);
+GMP_TEST_EXPANDS_TO((GMP_ZIP((x), (ALL))), ((x, 0)));
+static_assert(GMP_FOR_EACH_I(ZIPPED, ~, GMP_ZIP((ALL), (ALL))) true);
+
+// seq, whose tables are shared by the limits with the same GMP_SEQ_MAX_SIZE
+#if GMP_MAX_INDEX == 1024
+static_assert(GMP_SEQ_MAX_SIZE == 4096);
+#define FULL_SEQ SEQ_4096
+#else
+static_assert(GMP_SEQ_MAX_SIZE == 1024);
+#define FULL_SEQ SEQ_1024
+#endif
+#define SEQ_ONE(data, i, x) +x
+// keeps the state short: a growing state makes a fold quadratic
+#define SEQ_LAST(s, x) x
+static_assert(GMP_SEQ_SIZE(FULL_SEQ) == GMP_SEQ_MAX_SIZE);
+static_assert(0 GMP_SEQ_FOR_EACH(SEQ_ONE, ~, FULL_SEQ) == GMP_SEQ_MAX_SIZE);
+static_assert(GMP_SEQ_FOLD(SEQ_LAST, 0, FULL_SEQ) == 1);
+static_assert(GMP_SEQ_ELEM(GMP_DEC(GMP_MAX_INDEX), FULL_SEQ) == 1);
+GMP_TEST_SAME_EXPANSION((GMP_SEQ_SIZE(FULL_SEQ (1))), (_GMP_SEQ_ERROR()));
+GMP_TEST_SAME_EXPANSION((GMP_SEQ_TO_VARARGS(FULL_SEQ (1))), (_GMP_SEQ_ERROR()));
+
+// number
+static_assert(GMP_NUMBER_TO_LITERAL(GMP_NUMBER_FROM_INT(GMP_MAX_INDEX)) == GMP_MAX_INDEX);
+static_assert(GMP_ADD(GMP_MAX_INDEX, GMP_MAX_INDEX) == 2 * GMP_MAX_INDEX);
+static_assert(GMP_SUB(GMP_MAX_INDEX, LAST) == 1);
+
+int main() {}
@@ -0,0 +1,12 @@
+// Sequences long enough to reach GMP_SEQ_MAX_SIZE: every element is (1).
+#ifndef GMP_TEST_LONG_SEQ_HPP_
+#define GMP_TEST_LONG_SEQ_HPP_
+
+#define SEQ_4 (1)(1)(1)(1)
+#define SEQ_16 SEQ_4 SEQ_4 SEQ_4 SEQ_4
+#define SEQ_64 SEQ_16 SEQ_16 SEQ_16 SEQ_16
+#define SEQ_256 SEQ_64 SEQ_64 SEQ_64 SEQ_64
+#define SEQ_1024 SEQ_256 SEQ_256 SEQ_256 SEQ_256
+#define SEQ_4096 SEQ_1024 SEQ_1024 SEQ_1024 SEQ_1024
+
+#endif // GMP_TEST_LONG_SEQ_HPP_
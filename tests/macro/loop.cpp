@@ -0,0 +1,46 @@
+#include <gmp/macro/loop.hpp>
+
+#include <cstddef> // size_t
+
+#include "gmp_test.hpp"
+
+#define CALL(a, b) [a b]
+#define ONE(...) +1
+
+GMP_TEST_EXPANDS_TO((GMP_LOOP(CALL, 0, x, y)), ());
+GMP_TEST_EXPANDS_TO((GMP_LOOP(CALL, 1, x, y)), ([x y]));
+GMP_TEST_EXPANDS_TO((GMP_LOOP(CALL, 3, x, y)), ([x y] [x y] [x y]));
+GMP_TEST_EXPANDS_TO((GMP_LOOP(CALL, GMP_INC(2), x, y)), ([x y] [x y] [x y]));
+
+GMP_TEST_EXPANDS_TO((GMP_RANGE(0, 0)), ());
+GMP_TEST_EXPANDS_TO((GMP_RANGE(3, 3)), ());
+GMP_TEST_EXPANDS_TO((GMP_RANGE(0, 1)), (0));
+GMP_TEST_EXPANDS_TO((GMP_RANGE(0, 4)), (0, 1, 2, 3));
+GMP_TEST_EXPANDS_TO((GMP_RANGE(2, 5)), (2, 3, 4));
+
+GMP_TEST_EXPANDS_TO((GMP_MAKE_INDEX_SEQUENCE(0)), ());
+GMP_TEST_EXPANDS_TO((GMP_MAKE_INDEX_SEQUENCE(1)), (0));
+GMP_TEST_EXPANDS_TO((GMP_MAKE_INDEX_SEQUENCE(3)), (0, 1, 2));
+GMP_TEST_SAME_EXPANSION((GMP_MAKE_INDEX_SEQUENCE(GMP_MAX_INDEX)), (GMP_RANGE(0, GMP_MAX_INDEX)));
+
+// counts past GMP_MAX_INDEX are reported, and the error also fires in #if
+GMP_TEST_SAME_EXPANSION((GMP_LOOP(CALL, GMP_INC(GMP_MAX_INDEX), x, y)), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+GMP_TEST_SAME_EXPANSION((GMP_RANGE(0, GMP_INC(GMP_MAX_INDEX))), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+#if GMP_MAX_INDEX == 254
+GMP_TEST_EXPANDS_TO((GMP_RANGE(0, 255)), (Error_Index_255_Exceeds_Maximum_Macro_Index_254;));
+#endif
+
+// the largest loops and ranges
+static_assert(0 GMP_LOOP(ONE, GMP_MAX_INDEX) == GMP_MAX_INDEX);
+
+constexpr std::size_t all[] = { GMP_RANGE(0, GMP_MAX_INDEX) };
+static_assert(sizeof all / sizeof *all == GMP_MAX_INDEX);
+static_assert(all[0] == 0 && all[GMP_MAX_INDEX - 1] == GMP_MAX_INDEX - 1);
+
+constexpr std::size_t tail[] = { GMP_RANGE(GMP_DEC(GMP_MAX_INDEX), GMP_MAX_INDEX) };
+static_assert(sizeof tail / sizeof *tail == 1 && tail[0] == GMP_MAX_INDEX - 1);
+
+constexpr std::size_t middle[] = { GMP_RANGE(100, 200) };
+static_assert(sizeof middle / sizeof *middle == 100 && middle[0] == 100 && middle[99] == 199);
+
+int main() {}
@@ -0,0 +1,54 @@
+#include <gmp/macro/loop_nested.hpp>
+
+#include "gmp_test.hpp"
+
+#define CALL(a) [a]
+#define CELL(j, i) (i j)
+#define ROW(i, cols) GMP_REPEAT_2(cols, CELL, i)
+#define PLANE(k, n) GMP_REPEAT_2(n, LINE, k)
+#define LINE(j, k) GMP_REPEAT_3(2, POINT, k j)
+#define POINT(i, kj) (kj i)
+#define INNER(a) GMP_LOOP_2(CALL, 2, a)
+#define OUTER(a) GMP_LOOP(INNER, 2, a)
+#define FROM_ROW(i, cols) GMP_REPEAT_FROM_2(1, cols, CELL, i)
+#define FROM_ROW_3(i, cols) GMP_REPEAT_FROM_3(2, cols, CELL, i)
+#define FROM_PLANE(i, cols) GMP_REPEAT_FROM_2(0, 1, FROM_ROW_3, cols)
+
+// each depth works on its own
+GMP_TEST_EXPANDS_TO((GMP_LOOP_2(CALL, 2, x)), ([x] [x]));
+GMP_TEST_EXPANDS_TO((GMP_LOOP_3(CALL, 1, x)), ([x]));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_2(2, CELL, r)), ((r 0) (r 1)));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_3(0, CELL, r)), ());
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM_2(2, 4, CELL, r)), ((r 2) (r 3)));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM_3(3, 3, CELL, r)), ());
+
+// the plain loops, then _2 then _3 nest inside one another
+GMP_TEST_EXPANDS_TO((GMP_LOOP(INNER, 2, x)), ([x] [x] [x] [x]));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT(2, ROW, 3)), ((0 0) (0 1) (0 2) (1 0) (1 1) (1 2)));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT(2, PLANE, 2)),
+                    ((0 0 0) (0 0 1) (0 1 0) (0 1 1) (1 0 0) (1 0 1) (1 1 0) (1 1 1)));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM(1, 3, FROM_ROW, 3)), ((1 1) (1 2) (2 1) (2 2)));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT(1, FROM_PLANE, 4)), ((0 2) (0 3)));
+
+// counts past GMP_MAX_INDEX are reported at every depth
+GMP_TEST_SAME_EXPANSION((GMP_LOOP_2(CALL, GMP_INC(GMP_MAX_INDEX), x)), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+GMP_TEST_SAME_EXPANSION((GMP_LOOP_3(CALL, GMP_INC(GMP_MAX_INDEX), x)), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+GMP_TEST_SAME_EXPANSION((GMP_REPEAT_2(GMP_INC(GMP_MAX_INDEX), CELL, r)), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+GMP_TEST_SAME_EXPANSION((GMP_REPEAT_3(GMP_INC(GMP_MAX_INDEX), CELL, r)), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+
+// a 4x4 register tile
+constexpr int tile()
+{
+    int a[4] = { 1, 2, 3, 4 };
+    int b[4] = { 5, 6, 7, 8 };
+    int acc[4][4] = {};
+#define MAC(j, i) acc[i][j] += a[i] * b[j];
+#define MAC_ROW(i, cols) GMP_REPEAT_2(cols, MAC, i)
+    GMP_REPEAT(4, MAC_ROW, 4)
+#undef MAC_ROW
+#undef MAC
+    return acc[0][0] + acc[3][3] + acc[1][2];
+}
+static_assert(tile() == 5 + 32 + 14);
+
+int main() {}
@@ -0,0 +1,70 @@
+#include <gmp/macro/number.hpp>
+
+#include "gmp_test.hpp"
+
+GMP_TEST_EXPANDS_TO((GMP_NUMBER(7)), ((0, 0, 0, 7)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER(4, 2)), ((0, 0, 4, 2)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER(1, 0, 2, 4)), ((1, 0, 2, 4)));
+
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_FROM_INT(0)), ((0, 0, 0, 0)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_FROM_INT(GMP_SIZE_OF_VAARGS(a, b, c))), ((0, 0, 0, 3)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_FROM_INT(254)), ((0, 2, 5, 4)));
+static_assert(GMP_NUMBER_TO_LITERAL(GMP_NUMBER_FROM_INT(GMP_MAX_INDEX)) == GMP_MAX_INDEX);
+
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_TO_LITERAL((0, 0, 0, 0))), (0));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_TO_LITERAL((0, 0, 0, 8))), (8));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_TO_LITERAL((0, 0, 1, 0))), (10));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_TO_LITERAL((0, 3, 0, 5))), (305));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_TO_LITERAL((1, 0, 2, 4))), (1024));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_TO_LITERAL((9, 9, 9, 9))), (9999));
+
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_INC((0, 2, 9, 9))), ((0, 3, 0, 0)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_INC((0, 0, 0, 0))), ((0, 0, 0, 1)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_DEC((0, 3, 0, 0))), ((0, 2, 9, 9)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_DEC((1, 0, 0, 0))), ((0, 9, 9, 9)));
+
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_COMPARE((0, 1, 0, 0), (0, 0, 9, 9))), (G));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_COMPARE((0, 0, 9, 9), (0, 1, 0, 0))), (L));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_COMPARE((5, 0, 0, 1), (5, 0, 0, 1))), (E));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_EQUAL((0, 0, 0, 1), (0, 0, 0, 1)) GMP_NUMBER_EQUAL((0, 0, 0, 1), (1, 0, 0, 0))), (1 0));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_LESS((0, 0, 0, 1), (1, 0, 0, 0)) GMP_NUMBER_LESS((0, 0, 0, 1), (0, 0, 0, 1))), (1 0));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_IS_ZERO((0, 0, 0, 0)) GMP_NUMBER_IS_ZERO((0, 1, 0, 0))), (1 0));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MIN((0, 2, 0, 0), (0, 0, 3, 0))), ((0, 0, 3, 0)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MAX((0, 2, 0, 0), (0, 0, 3, 0))), ((0, 2, 0, 0)));
+
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_ADD((0, 1, 9, 5), (0, 0, 0, 7))), ((0, 2, 0, 2)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_ADD((4, 9, 9, 9), (4, 0, 0, 1))), ((9, 0, 0, 0)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_SUB((0, 2, 0, 2), (0, 0, 0, 7))), ((0, 1, 9, 5)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_SUB((1, 0, 0, 0), (0, 0, 0, 1))), ((0, 9, 9, 9)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MUL((0, 0, 1, 6), (0, 0, 3, 2))), ((0, 5, 1, 2)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MUL((0, 0, 9, 9), (0, 1, 0, 1))), ((9, 9, 9, 9)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_DIV((0, 1, 0, 0), (0, 0, 0, 7))), ((0, 0, 1, 4)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_DIV((9, 9, 9, 9), (0, 0, 0, 1))), ((9, 9, 9, 9)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_DIV((0, 0, 0, 6), (0, 0, 0, 7))), ((0, 0, 0, 0)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MOD((0, 1, 0, 0), (0, 0, 0, 7))), ((0, 0, 0, 2)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MOD((9, 9, 9, 9), (0, 1, 0, 0))), ((0, 0, 9, 9)));
+// a zero divisor leaves every quotient digit at 9 and the dividend as remainder
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_DIV((0, 1, 2, 3), (0, 0, 0, 0))), ((9, 9, 9, 9)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MOD((0, 1, 2, 3), (0, 0, 0, 0))), ((0, 1, 2, 3)));
+
+// the operations are modulo GMP_MAX_NUMBER + 1
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_INC((9, 9, 9, 9))), ((0, 0, 0, 0)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_DEC((0, 0, 0, 0))), ((9, 9, 9, 9)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_ADD((9, 9, 9, 9), (0, 0, 0, 2))), ((0, 0, 0, 1)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_ADD((5, 0, 0, 0), (5, 0, 0, 0))), ((0, 0, 0, 0)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_SUB((0, 0, 0, 1), (0, 0, 0, 2))), ((9, 9, 9, 9)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_SUB((0, 0, 0, 0), (9, 9, 9, 9))), ((0, 0, 0, 1)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MUL((0, 1, 0, 0), (0, 1, 0, 0))), ((0, 0, 0, 0)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MUL((0, 1, 0, 1), (0, 1, 0, 0))), ((0, 1, 0, 0)));
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_MUL((9, 9, 9, 9), (9, 9, 9, 9))), ((0, 0, 0, 1)));
+
+// the results are numbers again, so the operations compose
+GMP_TEST_EXPANDS_TO((GMP_NUMBER_TO_LITERAL(GMP_NUMBER_ADD(GMP_NUMBER_MUL(GMP_NUMBER(3, 2), GMP_NUMBER(3, 2)),
+                                                          GMP_NUMBER_FROM_INT(254)))),
+                    (1278));
+static_assert(GMP_NUMBER_TO_LITERAL(GMP_NUMBER_SUB(GMP_NUMBER(9, 9, 9, 9), GMP_NUMBER(1, 2, 3, 4))) == 9999 - 1234);
+#if GMP_NUMBER_LESS(GMP_NUMBER(2, 5, 5), GMP_NUMBER(1, 0, 0, 0)) != 1
+#error "GMP_NUMBER_LESS is not usable in #if"
+#endif
+
+int main() {}
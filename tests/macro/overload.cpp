@@ -0,0 +1,35 @@
+#include <gmp/macro/arith.hpp>
+
+#include "gmp_test.hpp"
+
+#define TEST_1(x) one(x)
+#define TEST_1_1(x, y) one_one(x, y)
+#define TEST_0_1_1(x) zero_one_one(x)
+#define SELECT_A x_is_a
+#define ONE 1
+
+// the fixed-arity variants select the same macro as GMP_OVERLOAD_INVOKE
+GMP_TEST_EXPANDS_TO((GMP_OVERLOAD_INVOKE1(TEST, 1)('a')), (one('a')));
+GMP_TEST_EXPANDS_TO((GMP_OVERLOAD_INVOKE2(TEST, 1, 1)('a', 'b')), (one_one('a', 'b')));
+GMP_TEST_EXPANDS_TO((GMP_OVERLOAD_INVOKE3(TEST, 0, 1, 1)('c')), (zero_one_one('c')));
+GMP_TEST_SAME_EXPANSION((GMP_OVERLOAD_INVOKE1(TEST, 1)('a')), (GMP_OVERLOAD_INVOKE(TEST, 1)('a')));
+GMP_TEST_SAME_EXPANSION((GMP_OVERLOAD_INVOKE2(TEST, 1, 1)('a', 'b')), (GMP_OVERLOAD_INVOKE(TEST, 1, 1)('a', 'b')));
+GMP_TEST_SAME_EXPANSION((GMP_OVERLOAD_INVOKE3(TEST, 0, 1, 1)('c')), (GMP_OVERLOAD_INVOKE(TEST, 0, 1, 1)('c')));
+
+// the selectors are expanded before they are pasted
+GMP_TEST_EXPANDS_TO((GMP_OVERLOAD_INVOKE1(TEST, ONE)(z)), (one(z)));
+GMP_TEST_EXPANDS_TO((GMP_OVERLOAD_INVOKE1(SELECT, A)), (x_is_a));
+
+// the macros built on them
+GMP_TEST_EXPANDS_TO((GMP_INC(0) GMP_INC(41) GMP_DEC(1) GMP_DEC(200)), (1 42 0 199));
+GMP_TEST_EXPANDS_TO((GMP_NOT(0) GMP_NOT(1)), (1 0));
+GMP_TEST_EXPANDS_TO((GMP_AND(1, 1) GMP_AND(1, 0) GMP_OR(0, 0) GMP_OR(0, 1) GMP_XOR(1, 1) GMP_XOR(0, 1)), (1 0 0 1 0 1));
+GMP_TEST_EXPANDS_TO((GMP_BOOL(0) GMP_BOOL(1) GMP_BOOL(37)), (0 1 1));
+GMP_TEST_EXPANDS_TO((GMP_IIF(1, yes, no) GMP_IIF(0, yes, no) GMP_IF(12, yes, no)), (yes no yes));
+GMP_TEST_EXPANDS_TO((GMP_EQUAL_INT(3, 3) GMP_EQUAL_INT(3, 4) GMP_EQUAL_INT(0, 0)), (1 0 1));
+GMP_TEST_EXPANDS_TO((GMP_CHECK_INDEX_BOOL(GMP_MAX_INDEX)), (1));
+GMP_TEST_EXPANDS_TO((GMP_CHECK_INDEX_BOOL(0)), (1));
+GMP_TEST_EXPANDS_TO((GMP_CHECK_INDEX(3)), ());
+GMP_TEST_EXPANDS_TO((GMP_CHECK_INDEX_BOOL(GMP_INC(GMP_MAX_INDEX))), (0));
+
+int main() {}
@@ -0,0 +1,50 @@
+#include <gmp/macro/repeat.hpp>
+
+#include "gmp_test.hpp"
+
+#define CALL(i, data) [i data]
+#define LANE(i, v) v[i] = i;
+#define ADD(i, sum) +i
+
+GMP_TEST_EXPANDS_TO((GMP_REPEAT(0, CALL, d)), ());
+GMP_TEST_EXPANDS_TO((GMP_REPEAT(1, CALL, d)), ([0 d]));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT(3, CALL, d)), ([0 d] [1 d] [2 d]));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT(GMP_INC(1), CALL, d)), ([0 d] [1 d]));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT(2, CALL, )), ([0] [1]));
+
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM(0, 0, CALL, d)), ());
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM(3, 3, CALL, d)), ());
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM(0, 2, CALL, d)), ([0 d] [1 d]));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM(1, 3, CALL, d)), ([1 d] [2 d]));
+GMP_TEST_EXPANDS_TO((GMP_REPEAT_FROM(5, 6, CALL, d)), ([5 d]));
+
+// counts past GMP_MAX_INDEX are reported
+GMP_TEST_SAME_EXPANSION((GMP_REPEAT(GMP_INC(GMP_MAX_INDEX), CALL, d)), (GMP_CHECK_INDEX(GMP_INC(GMP_MAX_INDEX))));
+
+// the indices are literals, so they can be pasted and used as constants
+static_assert(0 GMP_REPEAT(5, ADD, ) == 10);
+static_assert(0 GMP_REPEAT_FROM(100, 110, ADD, ) == 1045);
+
+constexpr int lanes()
+{
+    int v[4] = {};
+    GMP_REPEAT(4, LANE, v)
+    return v[0] + v[1] + v[2] + v[3];
+}
+static_assert(lanes() == 6);
+
+template <int N>
+constexpr int get() { return N * N; }
+
+constexpr int dispatch(int i)
+{
+    switch (i) {
+#define CASE(i, f) case i: return f<i>();
+        GMP_REPEAT_FROM(1, 4, CASE, get)
+#undef CASE
+    }
+    return -1;
+}
+static_assert(dispatch(1) == 1 && dispatch(3) == 9 && dispatch(0) == -1 && dispatch(4) == -1);
+
+int main() {}
@@ -0,0 +1,54 @@
+#include <gmp/macro/seq.hpp>
+
+#include "gmp_test.hpp"
+#include "macro/long_seq.hpp"
+
+#define CALL(data, i, ...) [data i __VA_ARGS__]
+#define FIELD(data, i, name, type) type name = i;
+#define PLUS(s, x) (s + x)
+#define COUNT(s, x) s + x
+#define ONE(data, i, x) +x
+
+GMP_TEST_EXPANDS_TO((GMP_SEQ_SIZE()), (0));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_SIZE((a))), (1));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_SIZE((a)(b, c)(d))), (3));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_SIZE(()()())), (3));
+
+GMP_TEST_EXPANDS_TO((GMP_SEQ_ELEM(0, (a)(b, c)(d))), (a));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_ELEM(1, (a)(b, c)(d))), (b, c));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_ELEM(2, (a)(b, c)(d))), (d));
+
+GMP_TEST_EXPANDS_TO((GMP_SEQ_FOR_EACH(CALL, d, )), ());
+GMP_TEST_EXPANDS_TO((GMP_SEQ_FOR_EACH(CALL, d, (a))), ([d 0 a]));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_FOR_EACH(CALL, d, (a)(b, c)(d))), ([d 0 a] [d 1 b, c] [d 2 d]));
+
+GMP_TEST_EXPANDS_TO((GMP_SEQ_TO_VARARGS()), ());
+GMP_TEST_EXPANDS_TO((GMP_SEQ_TO_VARARGS((a))), (a));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_TO_VARARGS((a)(b)(c))), (a, b, c));
+
+GMP_TEST_EXPANDS_TO((GMP_SEQ_FOLD(PLUS, 0, )), (0));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_FOLD(PLUS, 0, (1))), ((0 + 1)));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_FOLD(PLUS, 0, (1)(2)(3))), ((((0 + 1) + 2) + 3)));
+
+struct row { GMP_SEQ_FOR_EACH(FIELD, ~, (id, int)(score, long)) };
+static_assert(row{}.id == 0 && row{}.score == 1);
+
+// the longest sequences, past what an argument list can hold
+static_assert(GMP_SEQ_MAX_SIZE >= 1024);
+static_assert(GMP_SEQ_SIZE(SEQ_1024) == 1024);
+static_assert(0 GMP_SEQ_FOR_EACH(ONE, ~, SEQ_1024) == 1024);
+static_assert(GMP_SEQ_FOLD(COUNT, 0, SEQ_1024) == 1024);
+constexpr int ones[] = { GMP_SEQ_TO_VARARGS(SEQ_1024) };
+static_assert(sizeof ones / sizeof *ones == 1024);
+
+// one element more, or two, is reported by every operation instead of a
+// truncated result
+#if GMP_SEQ_MAX_SIZE == 1024
+GMP_TEST_EXPANDS_TO((GMP_SEQ_SIZE(SEQ_1024 (1))), (Error_Sequence_Exceeds_Maximum_Sequence_Size_1024;));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_SIZE(SEQ_1024 (1)(1))), (Error_Sequence_Exceeds_Maximum_Sequence_Size_1024;));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_FOR_EACH(ONE, ~, SEQ_1024 (1))), (Error_Sequence_Exceeds_Maximum_Sequence_Size_1024;));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_TO_VARARGS(SEQ_1024 (1)(1))), (Error_Sequence_Exceeds_Maximum_Sequence_Size_1024;));
+GMP_TEST_EXPANDS_TO((GMP_SEQ_FOLD(COUNT, 0, SEQ_1024 SEQ_1024)), (Error_Sequence_Exceeds_Maximum_Sequence_Size_1024;));
+#endif
+
+int main() {}
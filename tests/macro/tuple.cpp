@@ -0,0 +1,39 @@
+#include <gmp/macro/tuple.hpp>
+
+#include "gmp_test.hpp"
+
+#define FIELDS (id, int, 0), (name, char, 4), (score, long, 8)
+#define FIELD_NAME(field) GMP_TUPLE_ELEM(0, field)
+#define FIELD_TYPE(field) GMP_TUPLE_ELEM(1, field)
+#define DECLARE(field) FIELD_TYPE(field) FIELD_NAME(field);
+#define NUMBERS (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, \
+                 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35)
+
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_SIZE(())), (0));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_SIZE((a))), (1));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_SIZE((id, int, 0))), (3));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_SIZE(NUMBERS)), (36));
+
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_ELEM(0, (a))), (a));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_ELEM(2, (id, int, 0))), (0));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_ELEM(GMP_INC(0), (id, int, 0))), (int));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_ELEM(1, ((x, y), (z)))), ((z)));
+
+// across the 16-element steps
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_ELEM(15, NUMBERS)), (15));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_ELEM(16, NUMBERS)), (16));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_ELEM(17, NUMBERS)), (17));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_ELEM(32, NUMBERS)), (32));
+GMP_TEST_EXPANDS_TO((GMP_TUPLE_ELEM(35, NUMBERS)), (35));
+
+GMP_TEST_EXPANDS_TO((GMP_ZIP((x), (int))), ((x, int)));
+GMP_TEST_EXPANDS_TO((GMP_ZIP((x, y), (int, float))), ((x, int), (y, float)));
+GMP_TEST_EXPANDS_TO((GMP_ZIP((x, y), (int, float, long))), ((x, int), (y, float)));
+
+// a field table, through GMP_MAP of for_each.hpp
+GMP_TEST_EXPANDS_TO((GMP_MAP(FIELD_NAME, GMP_COMMA, FIELDS)), (id, name, score));
+
+struct row { GMP_MAP(DECLARE, GMP_EMPTY, FIELDS) };
+static_assert(sizeof(row{}.id) == sizeof(int) && sizeof(row{}.score) == sizeof(long));
+
+int main() {}
@@ -0,0 +1,46 @@
+// Built twice: with the detected GMP_HAS_VA_OPT, and with GMP_HAS_VA_OPT=0
+// for the portable path taken by preprocessors without __VA_OPT__.
+#include <gmp/macro/varargs.hpp>
+
+#include "gmp_test.hpp"
+
+#if defined(GMP_TEST_LEGACY_VA_OPT)
+static_assert(GMP_HAS_VA_OPT == 0);
+#else
+static_assert(GMP_HAS_VA_OPT == 1);
+#endif
+
+#define EMPTY_ARG
+#define FUNCTION_LIKE(x) x
+#define OBJECT_LIKE 7
+
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY()), (1));
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY(EMPTY_ARG)), (1));
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY(1)), (0));
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY(1, 2)), (0));
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY(,)), (0));
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY(())), (0));
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY((a, b))), (0));
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY(FUNCTION_LIKE)), (0));
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY(OBJECT_LIKE)), (0));
+GMP_TEST_EXPANDS_TO((GMP_IS_EMPTY(a b)), (0));
+
+GMP_TEST_EXPANDS_TO((GMP_OPT_COMMA()), ());
+GMP_TEST_EXPANDS_TO((GMP_OPT_COMMA(x)), (,));
+GMP_TEST_EXPANDS_TO((GMP_OPT_COMMA(x, y)), (,));
+
+GMP_TEST_EXPANDS_TO((GMP_HAS_COMMA()), (0));
+GMP_TEST_EXPANDS_TO((GMP_HAS_COMMA(a)), (0));
+GMP_TEST_EXPANDS_TO((GMP_HAS_COMMA(a, b)), (1));
+GMP_TEST_EXPANDS_TO((GMP_HAS_COMMA((a, b))), (0));
+
+GMP_TEST_EXPANDS_TO((GMP_SIZE_OF_VAARGS()), (0));
+GMP_TEST_EXPANDS_TO((GMP_SIZE_OF_VAARGS(EMPTY_ARG)), (0));
+GMP_TEST_EXPANDS_TO((GMP_SIZE_OF_VAARGS(1)), (1));
+GMP_TEST_EXPANDS_TO((GMP_SIZE_OF_VAARGS('a', 'b')), (2));
+GMP_TEST_EXPANDS_TO((GMP_SIZE_OF_VAARGS((a, b), c)), (2));
+GMP_TEST_EXPANDS_TO((GMP_SIZE_OF_VAARGS(FUNCTION_LIKE)), (1));
+GMP_TEST_EXPANDS_TO((GMP_SIZE_OF_VAARGS(,)), (2));
+GMP_TEST_EXPANDS_TO((GMP_SIZE_OF_VAARGS('a', 'b', 1, 2, 3, 4)), (6));
+
+int main() {}
@@ -0,0 +1,65 @@
+#include <gmp/meta/pipe.hpp>
+#include <gmp/meta/type_list.hpp>
+
+#include <concepts>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace other
+{
+
+// the type list of another library
+template<typename...> struct typelist {};
+
+} // namespace other
+
+template<> struct gmp::is_type_list_template<other::typelist> : std::true_type {};
+
+namespace
+{
+
+using gmp::type_list;
+
+static_assert(gmp::type_list_like<type_list<int>>);
+static_assert(gmp::type_list_like<std::tuple<>>);
+static_assert(gmp::type_list_like<std::tuple<int, char>>);
+static_assert(gmp::type_list_like<std::variant<int, char>>);
+static_assert(gmp::type_list_like<other::typelist<int>>);
+
+// class templates that merely take types are not lists
+static_assert(!gmp::type_list_like<std::vector<int>>);
+static_assert(!gmp::type_list_like<std::optional<int>>);
+static_assert(!gmp::type_list_like<std::string>);
+static_assert(!gmp::type_list_like<int>);
+static_assert(!gmp::type_list_like<type_list<int>&>);
+
+// the algorithms return the kind of list they are given
+static_assert(gmp::type_list_size_v<std::tuple<int, char, int>> == 3);
+static_assert(std::same_as<gmp::type_list_element_t<1, std::variant<int, char>>, char>);
+static_assert(std::same_as<gmp::type_list_filter_t<std::tuple<int, float, char>, std::is_integral>,
+                           std::tuple<int, char>>);
+static_assert(std::same_as<gmp::type_list_reverse_t<std::variant<int, char>>, std::variant<char, int>>);
+static_assert(std::same_as<gmp::type_list_unique_t<std::variant<int, char, int>>, std::variant<int, char>>);
+static_assert(std::same_as<gmp::type_list_push_back<long, other::typelist<int>>, other::typelist<int, long>>);
+static_assert(std::same_as<gmp::type_list_transform_t<other::typelist<int, char>, std::add_pointer>,
+                           other::typelist<int*, char*>>);
+static_assert(std::same_as<gmp::type_list_concat_t<std::tuple<int>, std::tuple<>, std::tuple<char>>,
+                           std::tuple<int, char>>);
+static_assert(std::same_as<gmp::pipe_t<std::variant<int, float, int>, gmp::stage::unique, gmp::stage::reverse>,
+                           std::variant<float, int>>);
+
+// an adapted list is usable as the variant it is
+using alternatives = gmp::type_list_unique_t<std::variant<int, std::string, int>>;
+static_assert(std::variant_size_v<alternatives> == 2);
+
+} // namespace
+
+int main()
+{
+    alternatives value = std::string("gmp");
+    return std::holds_alternative<std::string>(value) ? 0 : 1;
+}
@@ -0,0 +1,74 @@
+#include <gmp/meta/type_list.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace
+{
+
+using gmp::type_list;
+
+template<std::size_t N>
+using index = std::integral_constant<std::size_t, N>;
+
+using list = type_list<int, float, char, double, long>;
+
+// transform
+static_assert(std::same_as<gmp::type_list_transform_t<list, std::add_pointer>,
+                           type_list<int*, float*, char*, double*, long*>>);
+static_assert(std::same_as<gmp::type_list_transform_t<type_list<>, std::add_pointer>, type_list<>>);
+
+// partition
+static_assert(std::same_as<gmp::type_list_partition_t<list, std::is_integral>,
+                           type_list<type_list<int, char, long>, type_list<float, double>>>);
+static_assert(std::same_as<gmp::type_list_partition_t<std::tuple<float>, std::is_integral>,
+                           type_list<std::tuple<>, std::tuple<float>>>);
+
+// group_by: groups ordered by their first type, types keep their order
+template<typename T>
+struct size_key : std::type_identity<index<sizeof(T)>> {};
+
+static_assert(std::same_as<gmp::type_list_group_by_t<type_list<int, char, float, bool, double>, size_key>,
+                           type_list<type_list<int, float>, type_list<char, bool>, type_list<double>>>);
+static_assert(std::same_as<gmp::type_list_group_by_t<list, std::is_integral>,
+                           type_list<type_list<int, char, long>, type_list<float, double>>>);
+static_assert(std::same_as<gmp::type_list_group_by_t<type_list<>, std::is_integral>, type_list<>>);
+static_assert(std::same_as<gmp::type_list_group_by_t<std::tuple<int, int>, std::is_integral>,
+                           type_list<std::tuple<int, int>>>);
+
+// fold
+template<typename Acc, typename T>
+struct sum : std::type_identity<index<Acc::value + sizeof(T)>> {};
+
+template<typename Acc, typename T>
+struct prepend : std::type_identity<gmp::type_list_push_front<T, Acc>> {};
+
+static_assert(gmp::type_list_fold_t<type_list<char, short, int>, index<0>, sum>::value
+              == sizeof(char) + sizeof(short) + sizeof(int));
+static_assert(std::same_as<gmp::type_list_fold_t<type_list<>, index<7>, sum>, index<7>>);
+static_assert(std::same_as<gmp::type_list_fold_t<list, type_list<>, prepend>, gmp::type_list_reverse_t<list>>);
+
+// zip, as long as the shortest list
+static_assert(std::same_as<gmp::type_list_zip_t<type_list<int, char>, type_list<float, double, long>>,
+                           type_list<type_list<int, float>, type_list<char, double>>>);
+static_assert(std::same_as<gmp::type_list_zip_t<list>,
+                           type_list<type_list<int>, type_list<float>, type_list<char>, type_list<double>, type_list<long>>>);
+static_assert(std::same_as<gmp::type_list_zip_t<list, type_list<>>, type_list<>>);
+
+// chunk, with a shorter last chunk
+static_assert(std::same_as<gmp::type_list_chunk_t<2, list>,
+                           type_list<type_list<int, float>, type_list<char, double>, type_list<long>>>);
+static_assert(std::same_as<gmp::type_list_chunk_t<5, list>, type_list<list>>);
+static_assert(std::same_as<gmp::type_list_chunk_t<8, list>, type_list<list>>);
+static_assert(std::same_as<gmp::type_list_chunk_t<3, type_list<>>, type_list<>>);
+
+// enumerate
+static_assert(std::same_as<gmp::type_list_enumerate_t<type_list<int, char>>,
+                           type_list<type_list<index<0>, int>, type_list<index<1>, char>>>);
+static_assert(std::same_as<gmp::type_list_enumerate_t<type_list<>>, type_list<>>);
+
+} // namespace
+
+int main() {}
@@ -0,0 +1,61 @@
+#include <gmp/meta/type_list.hpp>
+#include <gmp/meta/type_name.hpp>
+
+#include <concepts>
+#include <tuple>
+
+namespace
+{
+
+struct A {};
+struct B {};
+struct C {};
+
+template<typename List> struct handler {};
+
+using gmp::type_list;
+
+static_assert(gmp::type_name<int>() == "int");
+static_assert(gmp::type_name<A>() != gmp::type_name<B>());
+
+// duplicates are dropped and the order does not matter
+static_assert(std::same_as<gmp::type_list_canonical_t<type_list<B, A, A>>,
+                           gmp::type_list_canonical_t<type_list<A, B>>>);
+static_assert(std::same_as<gmp::type_list_canonical_t<type_list<C, B, A, C, B>>,
+                           gmp::type_list_canonical_t<type_list<A, B, C>>>);
+static_assert(gmp::type_list_size_v<gmp::type_list_canonical_t<type_list<B, A, A>>> == 2);
+static_assert(std::same_as<gmp::type_list_canonical_t<type_list<>>, type_list<>>);
+static_assert(std::same_as<gmp::type_list_canonical_t<type_list<A, A, A>>, type_list<A>>);
+
+// the types are sorted by name, and the canonical form is a fixed point
+using abc = gmp::type_list_canonical_t<type_list<C, A, B>>;
+static_assert(std::same_as<abc, type_list<A, B, C>>);
+static_assert(std::same_as<gmp::type_list_canonical_t<abc>, abc>);
+static_assert(std::same_as<gmp::type_list_sort_t<type_list<B, A, C, A>>, type_list<A, A, B, C>>);
+static_assert(std::same_as<gmp::type_list_canonical_t<std::tuple<B, A, B>>, std::tuple<A, B>>);
+
+static_assert(gmp::type_list_equivalent_v<type_list<B, A, A>, type_list<A, B>>);
+static_assert(gmp::type_list_equivalent_v<type_list<>, type_list<>>);
+static_assert(!gmp::type_list_equivalent_v<type_list<A, B>, type_list<A, C>>);
+static_assert(!gmp::type_list_equivalent_v<type_list<A>, type_list<A, B>>);
+
+// distinct unnamed types are kept apart; when their names tie, as for lambdas
+// on some compilers, they stay in the order of their first occurrence
+auto first_lambda = [] {};
+auto second_lambda = [] {};
+using L1 = decltype(first_lambda);
+using L2 = decltype(second_lambda);
+static_assert(gmp::type_list_size_v<gmp::type_list_canonical_t<type_list<L1, L2, L1>>> == 2);
+static_assert(gmp::type_name<L1>() != gmp::type_name<L2>() ||
+              std::same_as<gmp::type_list_canonical_t<type_list<L2, L1, L2>>, type_list<L2, L1>>);
+
+// equivalent lists share one instantiation
+static_assert(std::same_as<gmp::canonical_instantiation_t<handler, type_list<A, B>>,
+                           gmp::canonical_instantiation_t<handler, type_list<B, A, A>>>);
+static_assert(std::same_as<gmp::canonical_instantiation_t<handler, type_list<C, B, A>>, handler<abc>>);
+static_assert(!std::same_as<gmp::canonical_instantiation_t<handler, type_list<A>>,
+                            gmp::canonical_instantiation_t<handler, type_list<B>>>);
+
+} // namespace
+
+int main() {}
@@ -0,0 +1,81 @@
+#include <gmp/meta/detail/index_engine.hpp>
+#include <gmp/meta/type_list.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+
+namespace detail = gmp::detail;
+using gmp::type_list;
+
+template<std::size_t N>
+constexpr bool equal(const std::array<std::size_t, N>& lhs, const std::array<std::size_t, N>& rhs)
+{
+    return lhs == rhs;
+}
+
+// the index computations
+static_assert(equal(detail::flag_indices<std::array{ true, false, true, true }>(), std::array<std::size_t, 3>{ 0, 2, 3 }));
+static_assert(detail::flag_indices<std::array<bool, 0>{}>().size() == 0);
+static_assert(equal(detail::iota_indices<4>(), { 0, 1, 2, 3 }));
+static_assert(equal(detail::remove_indices<4, 1>(), { 0, 2, 3 }));
+static_assert(equal(detail::insert_indices<3, 1>(), { 0, 3, 1, 2 }));
+static_assert(equal(detail::insert_indices<3, 3>(), { 0, 1, 2, 3 }));
+static_assert(equal(detail::range_indices<2, 3>(), { 2, 3, 4 }));
+static_assert(equal(detail::equal_indices<std::array{ 1, 0, 1, 2 }, 1>(), std::array<std::size_t, 2>{ 0, 2 }));
+static_assert(equal(detail::reverse_indices<3>(), { 2, 1, 0 }));
+static_assert(equal(detail::gather_indices<std::array<std::size_t, 3>{ 5, 6, 7 }, std::array<std::size_t, 2>{ 2, 0 }>(),
+                    std::array<std::size_t, 2>{ 7, 5 }));
+static_assert(equal(detail::append_iota_indices<std::array<std::size_t, 2>{ 9, 8 }, 4, 2>(), { 9, 8, 4, 5 }));
+
+constexpr std::array<int, 5> values{ 3, 1, 3, 2, 1 };
+static_assert(detail::first_occurrence_flags<5>([](std::size_t i, std::size_t j) { return values[i] == values[j]; })
+              == std::array{ true, true, false, true, false });
+static_assert(equal(detail::group_ids<5>([](std::size_t i, std::size_t j) { return values[i] == values[j]; }),
+                    { 0, 1, 0, 2, 1 }));
+static_assert(equal(detail::stable_sort_indices(detail::iota_indices<5>(),
+                                                [](std::size_t i, std::size_t j) { return values[i] < values[j]; }),
+                    { 1, 4, 3, 0, 2 }));
+
+
+// the type_list algorithms built on them
+using list = type_list<int, char, int, double>;
+
+static_assert(gmp::type_list_size_v<list> == 4);
+static_assert(std::same_as<gmp::type_list_element_t<3, list>, double>);
+static_assert(std::same_as<gmp::type_list_head<list>, int>);
+static_assert(std::same_as<gmp::type_list_last<list>, double>);
+static_assert(std::same_as<gmp::type_list_tail_t<list>, type_list<char, int, double>>);
+static_assert(gmp::type_list_contains_v<char, list> && !gmp::type_list_contains_v<float, list>);
+static_assert(std::same_as<gmp::type_list_concat_t<list, type_list<>, type_list<float>>,
+                           type_list<int, char, int, double, float>>);
+static_assert(std::same_as<gmp::type_list_remove_t<1, list>, type_list<int, int, double>>);
+static_assert(std::same_as<gmp::type_list_pop_front<list>, type_list<char, int, double>>);
+static_assert(std::same_as<gmp::type_list_pop_back<list>, type_list<int, char, int>>);
+static_assert(std::same_as<gmp::type_list_insert_t<1, float, list>, type_list<int, float, char, int, double>>);
+static_assert(std::same_as<gmp::type_list_push_front<float, type_list<>>, type_list<float>>);
+static_assert(std::same_as<gmp::type_list_push_back<float, list>, type_list<int, char, int, double, float>>);
+static_assert(std::same_as<gmp::type_list_reverse_t<list>, type_list<double, int, char, int>>);
+static_assert(std::same_as<gmp::type_list_unique_t<list>, type_list<int, char, double>>);
+static_assert(std::same_as<gmp::type_list_filter_t<list, std::is_integral>, type_list<int, char, int>>);
+
+// a long list takes one expansion per algorithm, whatever its length
+template<std::size_t... Is>
+type_list<std::integral_constant<std::size_t, Is % 100>...> make_long_list(std::index_sequence<Is...>);
+
+using long_list = decltype(make_long_list(std::make_index_sequence<1000>{}));
+
+static_assert(gmp::type_list_size_v<gmp::type_list_unique_t<long_list>> == 100);
+static_assert(std::same_as<gmp::type_list_element_t<999, long_list>, std::integral_constant<std::size_t, 99>>);
+static_assert(std::same_as<gmp::type_list_head<gmp::type_list_reverse_t<long_list>>,
+                           std::integral_constant<std::size_t, 99>>);
+static_assert(gmp::type_list_size_v<gmp::type_list_remove_t<500, long_list>> == 999);
+
+} // namespace
+
+int main() {}
@@ -0,0 +1,57 @@
+#include <gmp/meta/intern.hpp>
+#include <gmp/meta/type_list.hpp>
+#include <gmp/meta/type_name.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+template<std::size_t... Is>
+gmp::type_list<std::integral_constant<std::size_t, Is>...> make_list(std::index_sequence<Is...>);
+
+using long_list = decltype(make_list(std::make_index_sequence<64>{}));
+using short_list = gmp::type_list<int, char>;
+
+GMP_INTERN_TYPE_LIST(long_list)
+GMP_INTERN_TYPE_LIST(short_list)
+
+namespace
+{
+
+template<typename List>
+struct kernel
+{
+    using types = gmp::uninterned_t<List>;
+};
+
+using long_tag = gmp::interned_t<long_list>;
+using short_tag = gmp::interned_t<short_list>;
+
+static_assert(gmp::type_hash_v<int> == gmp::type_hash_v<int>);
+static_assert(gmp::type_hash_v<int> != gmp::type_hash_v<unsigned>);
+static_assert(gmp::type_hash_v<long_list> != gmp::type_hash_v<short_list>);
+
+static_assert(std::same_as<long_tag, gmp::list_tag<gmp::type_hash_v<long_list>>>);
+static_assert(!std::same_as<long_tag, short_tag>);
+
+// the tag leads back to the list, and other types are left alone
+static_assert(std::same_as<gmp::uninterned_t<long_tag>, long_list>);
+static_assert(std::same_as<gmp::uninterned_t<short_tag>, short_list>);
+static_assert(std::same_as<gmp::uninterned_t<short_list>, short_list>);
+static_assert(std::same_as<kernel<long_tag>::types, long_list>);
+
+// tags are lists themselves
+static_assert(gmp::type_list_like<short_tag>);
+static_assert(gmp::type_list_size_v<long_tag> == 64);
+static_assert(std::same_as<gmp::type_list_element_t<1, short_tag>, char>);
+
+// the name of a specialization no longer holds the list
+static_assert(gmp::type_name<kernel<long_tag>>().size() < 100);
+static_assert(gmp::type_name<kernel<long_tag>>().size() * 10 < gmp::type_name<kernel<long_list>>().size());
+
+template struct kernel<long_tag>;
+
+} // namespace
+
+int main() {}
@@ -0,0 +1,66 @@
+#include <gmp/meta/pipe.hpp>
+#include <gmp/meta/type_list.hpp>
+
+#include <concepts>
+#include <tuple>
+#include <type_traits>
+
+namespace
+{
+
+using gmp::type_list;
+using gmp::pipe_t;
+namespace stage = gmp::stage;
+
+struct A {};
+struct B {};
+
+using list = type_list<int, char*, int, long>;
+
+static_assert(std::same_as<pipe_t<list>, list>);
+static_assert(std::same_as<pipe_t<type_list<>, stage::unique, stage::reverse>, type_list<>>);
+
+// every stage on its own
+static_assert(std::same_as<pipe_t<list, stage::concat<type_list<A>, type_list<B, A>>>,
+                           type_list<int, char*, int, long, A, B, A>>);
+static_assert(std::same_as<pipe_t<list, stage::unique>, type_list<int, char*, long>>);
+static_assert(std::same_as<pipe_t<list, stage::filter<std::is_integral>>, type_list<int, int, long>>);
+static_assert(std::same_as<pipe_t<list, stage::transform<std::add_const>>,
+                           type_list<const int, char* const, const int, const long>>);
+static_assert(std::same_as<pipe_t<list, stage::reverse>, type_list<long, int, char*, int>>);
+static_assert(std::same_as<pipe_t<type_list<B, A, B>, stage::sort>, gmp::type_list_sort_t<type_list<B, A, B>>>);
+static_assert(std::same_as<pipe_t<type_list<B, A, B>, stage::sort>, type_list<A, B, B>>);
+
+// the stages after a transform see the transformed types
+static_assert(std::same_as<pipe_t<type_list<int, const int>, stage::transform<std::remove_const>, stage::unique>,
+                           type_list<int>>);
+static_assert(std::same_as<pipe_t<type_list<int*, char>, stage::transform<std::remove_pointer>,
+                                  stage::filter<std::is_integral>>,
+                           type_list<int, char>>);
+static_assert(std::same_as<pipe_t<list, stage::transform<std::add_pointer>, stage::transform<std::add_const>>,
+                           type_list<int* const, char** const, int* const, long* const>>);
+static_assert(std::same_as<pipe_t<type_list<int, char*>, stage::transform<std::add_pointer>,
+                                  stage::concat<type_list<long>>>,
+                           type_list<int*, char**, long>>);
+static_assert(std::same_as<pipe_t<type_list<B, A>, stage::transform<std::add_pointer>, stage::sort>,
+                           type_list<A*, B*>>);
+
+// a pipe gives the same result as the nested algorithms
+using nested = gmp::type_list_reverse_t<gmp::type_list_filter_t<
+    gmp::type_list_unique_t<gmp::type_list_concat_t<list, type_list<int, long, short>>>, std::is_integral>>;
+static_assert(std::same_as<pipe_t<list, stage::concat<type_list<int, long, short>>, stage::unique,
+                                  stage::filter<std::is_integral>, stage::reverse>,
+                           nested>);
+static_assert(std::same_as<nested, type_list<short, long, int>>);
+
+// the example of the documentation
+static_assert(std::same_as<pipe_t<type_list<int, char*>, stage::concat<type_list<int, long>>, stage::unique,
+                                  stage::filter<std::is_integral>, stage::transform<std::add_pointer>>,
+                           type_list<int*, long*>>);
+
+// the kind of list is kept
+static_assert(std::same_as<pipe_t<std::tuple<int, char, int>, stage::unique, stage::reverse>, std::tuple<char, int>>);
+
+} // namespace
+
+int main() {}
@@ -0,0 +1,57 @@
+#include <gmp/meta/type_list.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+
+using gmp::type_list;
+
+struct row_major {};
+struct col_major {};
+
+template<std::size_t N>
+using index = std::integral_constant<std::size_t, N>;
+
+// the last list varies fastest
+static_assert(std::same_as<gmp::type_list_product_t<type_list<float, double>, type_list<row_major, col_major>>,
+                           type_list<type_list<float, row_major>, type_list<float, col_major>,
+                                     type_list<double, row_major>, type_list<double, col_major>>>);
+static_assert(std::same_as<gmp::type_list_product_t<type_list<int, char>>,
+                           type_list<type_list<int>, type_list<char>>>);
+static_assert(std::same_as<gmp::type_list_product_t<type_list<int>, type_list<>>, type_list<>>);
+
+using digits = type_list<index<0>, index<1>, index<2>>;
+using cube = gmp::type_list_product_t<digits, type_list<index<0>, index<1>>, digits>;
+static_assert(gmp::type_list_size_v<cube> == 18);
+static_assert(std::same_as<gmp::type_list_element_t<0, cube>, type_list<index<0>, index<0>, index<0>>>);
+static_assert(std::same_as<gmp::type_list_element_t<4, cube>, type_list<index<0>, index<1>, index<1>>>);
+static_assert(std::same_as<gmp::type_list_element_t<17, cube>, type_list<index<2>, index<1>, index<2>>>);
+
+// a large product is expanded in one step
+template<std::size_t... Is>
+type_list<index<Is>...> make_list(std::index_sequence<Is...>);
+using ten = decltype(make_list(std::make_index_sequence<10>{}));
+using thousand = gmp::type_list_product_t<ten, ten, ten>;
+static_assert(gmp::type_list_size_v<thousand> == 1000);
+static_assert(std::same_as<gmp::type_list_element_t<123, thousand>, type_list<index<1>, index<2>, index<3>>>);
+
+// product_if drops the rejected tuples
+template<typename Row>
+struct different : std::bool_constant<!std::same_as<gmp::type_list_head<Row>, gmp::type_list_last<Row>>> {};
+
+static_assert(std::same_as<gmp::type_list_product_if_t<different, type_list<int, char>, type_list<int, char>>,
+                           type_list<type_list<int, char>, type_list<char, int>>>);
+static_assert(std::same_as<gmp::type_list_product_if_t<std::is_void, type_list<int>, type_list<char>>, type_list<>>);
+
+template<typename Row>
+struct sorted : std::bool_constant<(gmp::type_list_element_t<0, Row>::value < gmp::type_list_element_t<1, Row>::value)> {};
+
+static_assert(gmp::type_list_size_v<gmp::type_list_product_if_t<sorted, ten, ten>> == 45);
+
+} // namespace
+
+int main() {}
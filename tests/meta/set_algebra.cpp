@@ -0,0 +1,62 @@
+#include <gmp/meta/type_list.hpp>
+
+#include <concepts>
+#include <tuple>
+
+namespace
+{
+
+using gmp::type_list;
+
+struct A {};
+struct B {};
+struct C {};
+struct D {};
+
+using abc = type_list<A, B, C, A>;
+using cbd = type_list<C, B, D, D>;
+
+// results hold no duplicates and keep the order of the first list, then the second
+static_assert(std::same_as<gmp::type_list_intersection_t<abc, cbd>, type_list<B, C>>);
+static_assert(std::same_as<gmp::type_list_intersection_t<cbd, abc>, type_list<C, B>>);
+static_assert(std::same_as<gmp::type_list_difference_t<abc, cbd>, type_list<A>>);
+static_assert(std::same_as<gmp::type_list_difference_t<cbd, abc>, type_list<D>>);
+static_assert(std::same_as<gmp::type_list_union_t<abc, cbd>, type_list<A, B, C, D>>);
+static_assert(std::same_as<gmp::type_list_union_t<cbd, abc>, type_list<C, B, D, A>>);
+static_assert(std::same_as<gmp::type_list_symmetric_difference_t<abc, cbd>, type_list<A, D>>);
+
+static_assert(gmp::type_list_is_subset_v<type_list<B, C, B>, abc>);
+static_assert(gmp::type_list_is_subset_v<type_list<>, type_list<>>);
+static_assert(gmp::type_list_is_subset_v<abc, abc>);
+static_assert(!gmp::type_list_is_subset_v<abc, cbd>);
+static_assert(!gmp::type_list_is_subset_v<type_list<D>, type_list<>>);
+
+// the empty set
+static_assert(std::same_as<gmp::type_list_intersection_t<abc, type_list<>>, type_list<>>);
+static_assert(std::same_as<gmp::type_list_difference_t<abc, type_list<>>, type_list<A, B, C>>);
+static_assert(std::same_as<gmp::type_list_union_t<type_list<>, cbd>, type_list<C, B, D>>);
+static_assert(std::same_as<gmp::type_list_symmetric_difference_t<abc, abc>, type_list<>>);
+
+// the laws of the set operations, up to order
+template<typename T, typename U>
+constexpr bool same_set = gmp::type_list_equivalent_v<T, U>;
+
+static_assert(same_set<gmp::type_list_union_t<abc, cbd>, gmp::type_list_union_t<cbd, abc>>);
+static_assert(same_set<gmp::type_list_intersection_t<abc, cbd>, gmp::type_list_intersection_t<cbd, abc>>);
+static_assert(same_set<gmp::type_list_union_t<gmp::type_list_difference_t<abc, cbd>, gmp::type_list_intersection_t<abc, cbd>>,
+                       gmp::type_list_unique_t<abc>>);
+static_assert(same_set<gmp::type_list_symmetric_difference_t<abc, cbd>,
+                       gmp::type_list_difference_t<gmp::type_list_union_t<abc, cbd>, gmp::type_list_intersection_t<abc, cbd>>>);
+
+// fundamental and cv-qualified types are distinct members
+static_assert(std::same_as<gmp::type_list_difference_t<type_list<int, const int, int&>, type_list<int>>,
+                           type_list<const int, int&>>);
+
+// the lists may be of different kinds, and the result is of the first kind
+static_assert(std::same_as<gmp::type_list_intersection_t<std::tuple<int, char, long>, type_list<long, int>>,
+                           std::tuple<int, long>>);
+static_assert(gmp::type_list_is_subset_v<std::tuple<int>, type_list<char, int>>);
+
+} // namespace
+
+int main() {}
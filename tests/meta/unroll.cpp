@@ -0,0 +1,68 @@
+#include <gmp/meta/unroll.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace
+{
+
+// Records the order of the calls, to check that every index is visited once.
+template<std::size_t Count, std::size_t Chunk, bool NoInline>
+constexpr std::array<std::size_t, Count> visit()
+{
+    std::array<std::size_t, Count> order{};
+    std::size_t calls = 0;
+    gmp::unroll_chunked<Count, Chunk, NoInline>([&](auto i) { order[calls++] = i; });
+    return order;
+}
+
+template<std::size_t Count>
+constexpr bool in_order(const std::array<std::size_t, Count>& order)
+{
+    for (std::size_t i = 0; i < Count; ++i) {
+        if (order[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 10 in chunks of 4: two full chunks and a remainder of 2
+static_assert(in_order(visit<10, 4, false>()));
+static_assert(in_order(visit<10, 4, true>()));
+// chunks that divide the count, a single chunk, and chunks of one
+static_assert(in_order(visit<12, 4, true>()));
+static_assert(in_order(visit<3, 8, true>()));
+static_assert(in_order(visit<5, 1, true>()));
+static_assert(in_order(visit<300, 64, true>()));
+
+// no iterations at all
+constexpr bool never_called()
+{
+    bool called = false;
+    gmp::unroll_chunked<0, 4>([&](auto) { called = true; });
+    return !called;
+}
+static_assert(never_called());
+
+// the index is a constant expression
+constexpr std::size_t sum_of_squares()
+{
+    std::size_t sum = 0;
+    gmp::unroll_chunked<10, 4>([&](auto i) {
+        std::array<char, i * i + 1> squared{};
+        sum += squared.size() - 1;
+    });
+    return sum;
+}
+static_assert(sum_of_squares() == 285);
+
+} // namespace
+
+int main()
+{
+    // and at run time, through functions that are not inlined
+    std::array<int, 10> out{};
+    gmp::unroll_chunked<10, 4>([&](auto i) { out[i] = static_cast<int>(i) * 2; });
+    return out[0] == 0 && out[3] == 6 && out[4] == 8 && out[9] == 18 ? 0 : 1;
+}
@@ -0,0 +1,69 @@
+#include <gmp/meta/value_list.hpp>
+
+#include <concepts>
+
+namespace
+{
+
+using gmp::value_list;
+using gmp::fixed_string;
+
+enum class color { red, green, blue };
+
+using numbers = value_list<3, 1, 2, 1>;
+using mixed = value_list<1, 'a', color::green, 2u>;
+
+static_assert(gmp::value_list_size_v<value_list<>> == 0);
+static_assert(gmp::value_list_size_v<numbers> == 4);
+static_assert(gmp::value_list_size_v<mixed> == 4);
+
+static_assert(gmp::value_list_element_v<0, numbers> == 3);
+static_assert(gmp::value_list_element_v<3, numbers> == 1);
+static_assert(gmp::value_list_element_v<1, mixed> == 'a');
+static_assert(gmp::value_list_element_v<2, mixed> == color::green);
+
+static_assert(gmp::value_list_contains_v<2, numbers>);
+static_assert(!gmp::value_list_contains_v<4, numbers>);
+// values of different types never compare equal
+static_assert(!gmp::value_list_contains_v<2, mixed>);
+static_assert(gmp::value_list_contains_v<2u, mixed>);
+
+static_assert(std::same_as<gmp::value_list_concat_t<>, value_list<>>);
+static_assert(std::same_as<gmp::value_list_concat_t<value_list<1>, value_list<>, value_list<'a', 2>>,
+                           value_list<1, 'a', 2>>);
+
+static_assert(std::same_as<gmp::value_list_remove_t<1, numbers>, value_list<3, 2, 1>>);
+static_assert(std::same_as<gmp::value_list_pop_front<numbers>, value_list<1, 2, 1>>);
+static_assert(std::same_as<gmp::value_list_pop_back<numbers>, value_list<3, 1, 2>>);
+
+static_assert(std::same_as<gmp::value_list_insert_t<2, 9, numbers>, value_list<3, 1, 9, 2, 1>>);
+static_assert(std::same_as<gmp::value_list_push_front<0, value_list<>>, value_list<0>>);
+static_assert(std::same_as<gmp::value_list_push_back<'z', numbers>, value_list<3, 1, 2, 1, 'z'>>);
+
+static_assert(std::same_as<gmp::value_list_reverse_t<numbers>, value_list<1, 2, 1, 3>>);
+static_assert(std::same_as<gmp::value_list_reverse_t<value_list<>>, value_list<>>);
+
+static_assert(std::same_as<gmp::value_list_unique_t<numbers>, value_list<3, 1, 2>>);
+static_assert(std::same_as<gmp::value_list_unique_t<value_list<1, 1L, 1>>, value_list<1, 1L>>);
+
+static_assert(std::same_as<gmp::value_list_filter_t<value_list<1, 2, 3, 4>, [](auto v) { return v % 2 == 0; }>,
+                           value_list<2, 4>>);
+static_assert(std::same_as<gmp::value_list_filter_t<numbers, [](auto) { return false; }>, value_list<>>);
+
+static_assert(std::same_as<gmp::value_list_sort_t<numbers>, value_list<1, 1, 2, 3>>);
+static_assert(std::same_as<gmp::value_list_sort_t<numbers, [](auto a, auto b) { return (a > b); }>,
+                           value_list<3, 2, 1, 1>>);
+// the sort is stable: 'a' and 97 are equivalent and keep their order
+static_assert(std::same_as<gmp::value_list_sort_t<value_list<98, 'a', 97>>, value_list<'a', 97, 98>>);
+
+using names = value_list<fixed_string{"y"}, fixed_string{"x"}, fixed_string{"yy"}, fixed_string{"x"}>;
+static_assert(gmp::value_list_element_v<1, names> == fixed_string{"x"});
+static_assert(gmp::value_list_element_v<2, names>.size() == 2);
+static_assert(std::same_as<gmp::value_list_unique_t<names>,
+                           value_list<fixed_string{"y"}, fixed_string{"x"}, fixed_string{"yy"}>>);
+static_assert(std::same_as<gmp::value_list_sort_t<gmp::value_list_unique_t<names>>,
+                           value_list<fixed_string{"x"}, fixed_string{"y"}, fixed_string{"yy"}>>);
+
+} // namespace
+
+int main() {}
@@ -0,0 +1,36 @@
+// The standard headers come before the import, and <string_view> is among
+// them, as GCC 12 requires (see module/gmp.cppm).
+#include <concepts>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+import gmp;
+
+namespace
+{
+
+struct A {};
+struct B {};
+
+using list = gmp::type_list<int, char, float, int, long>;
+
+static_assert(gmp::type_list_like<list>);
+static_assert(gmp::type_list_size_v<list> == 5);
+static_assert(std::same_as<gmp::type_list_element_t<2, list>, float>);
+static_assert(std::same_as<gmp::type_list_filter_t<gmp::type_list_unique_t<list>, std::is_integral>,
+                           gmp::type_list<int, char, long>>);
+static_assert(std::same_as<gmp::type_list_reverse_t<std::tuple<int, char>>, std::tuple<char, int>>);
+static_assert(std::same_as<gmp::type_list_transform_t<gmp::type_list<int>, std::add_pointer>, gmp::type_list<int*>>);
+static_assert(gmp::type_list_size_v<gmp::type_list_product_t<list, gmp::type_list<A, B>>> == 10);
+static_assert(gmp::type_list_equivalent_v<gmp::type_list<B, A, A>, gmp::type_list<A, B>>);
+static_assert(std::same_as<gmp::type_list_union_t<gmp::type_list<A>, gmp::type_list<B, A>>, gmp::type_list<A, B>>);
+static_assert(gmp::type_name<A>() != gmp::type_name<B>());
+
+} // namespace
+
+int main()
+{
+    std::tuple<int, char> values{ 1, 'a' };
+    return std::get<gmp::type_list_element_t<0, gmp::type_list_reverse_t<decltype(values)>>>(values) == 'a' ? 0 : 1;
+}
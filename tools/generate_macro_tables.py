@@ -0,0 +1,344 @@
+#!/usr/bin/env python3
+"""Generate the size-dependent preprocessor tables of gmp/macro.
+
+Every table whose length grows with GMP_MAX_INDEX is written here, once per
+supported limit, into include/gmp/macro/limits/. The generated headers are
+checked into the tree; rerun this script after changing a table or the list
+of limits:
+
+    python3 tools/generate_macro_tables.py [LIMIT ...]
+
+Without arguments the default limits are generated.
+"""
+
+import pathlib
+import sys
+
+DEFAULT_LIMITS = (64, 254, 1024)
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+OUT = ROOT / 'include' / 'gmp' / 'macro' / 'limits'
+
+# The number of recursion steps each GMP_EVAL level can drive; every level
+# rescans the one below three times.
+EVAL_LEVELS = (
+    (2, 'GMP_EVAL_5'),
+    (5, 'GMP_EVAL_4'),
+    (14, 'GMP_EVAL_3'),
+    (41, 'GMP_EVAL_2'),
+    (122, 'GMP_EVAL_1'),
+    (365, 'GMP_EVAL'),
+    (1094, '_GMP_EVAL_WIDE'),
+)
+
+HEADER = '''\
+// Generated by tools/generate_macro_tables.py, do not edit.
+'''
+
+
+def wrap(items, indent, width=100):
+    lines, line = [], indent
+    for item in items:
+        piece = item + ', '
+        if len(line) + len(piece) > width and line.strip():
+            lines.append(line.rstrip())
+            line = indent
+        line += piece
+    lines.append(line.rstrip().rstrip(','))
+    return ' \\\n'.join(lines)
+
+
+def guarded(module, n, body):
+    guard = f'GMP_MACRO_LIMITS_{module.upper()}_{n}_HPP_'
+    return '\n'.join([HEADER, f'#ifndef {guard}', f'#define {guard}', '', *body,
+                      f'#endif // {guard}']) + '\n'
+
+
+def varargs_tables(n):
+    out = ['// GMP_GET_VARARGS']
+    params = [f'_{i}' for i in range(n + 1)] + ['N', '...']
+    out.append('#define _GMP_GET_VARARGS_IMPL( \\\n' + wrap(params, '    ') + ') N')
+    out.append('#define _GMP_SIZE_OF_VAARGS_SEQUENCE \\\n'
+               + wrap([str(i) for i in range(n, -1, -1)], '    '))
+    out.append('')
+
+    out.append('// GMP_HAS_COMMA')
+    params = [f'_{i}' for i in range(n + 1)] + ['R', '...']
+    out.append('#define _GMP_COMMA_CHECK( \\\n' + wrap(params, '    ') + ') R')
+    out.append('#define _GMP_HAS_COMMA_SEQUENCE \\\n' + wrap(['1'] * n + ['0'], '    '))
+    out.append('')
+    return out
+
+
+def arith_tables(n):
+    out = ['// GMP_INC']
+    for i in range(n + 2):
+        out.append(f'#define _GMP_INC_{i}() {i + 1}')
+    out.append('')
+
+    out.append('// GMP_DEC')
+    for i in range(1, n + 2):
+        out.append(f'#define _GMP_DEC_{i}() {i - 1}')
+    out.append('')
+
+    out.append('// GMP_BOOL')
+    out.append('#define _GMP_BOOL_0 0')
+    for i in range(1, n + 2):
+        out.append(f'#define _GMP_BOOL_{i} 1')
+    out.append('')
+
+    out.append('// GMP_CHECK_INDEX')
+    for i in range(n + 1):
+        out.append(f'#define _GMP_CHECK_INDEX_{i} ,')
+    out.append('')
+
+    out.append('// GMP_EQUAL_INT')
+    for i in range(n + 1):
+        out.append(f'#define _GMP_EQUAL_INT_{i}_{i} ,')
+    out.append('')
+    return out
+
+
+def for_each_tables(n):
+    out = ['// GMP_FOR_EACH']
+    out.append('#define _GMP_FOR_EACH_0(call, ...)')
+    out.append('#define _GMP_FOR_EACH_1(call, x) call(x)')
+    for i in range(2, n + 2):
+        out.append(f'#define _GMP_FOR_EACH_{i}(call, x, ...) call(x) GMP_EXPAND( _GMP_FOR_EACH_{i - 1}(call, __VA_ARGS__) )')
+    out.append('')
+
+    # The last step ignores what follows, so that a ladder entered at k visits
+    # the first k arguments of a longer list.
+    out.append('// GMP_FOR_EACH_I')
+    out.append('#define _GMP_FOR_EACH_I_0(call, data, sep, i, ...)')
+    out.append('#define _GMP_FOR_EACH_I_1(call, data, sep, i, x, ...) call(data, i, x)')
+    for i in range(2, n + 2):
+        out.append(f'#define _GMP_FOR_EACH_I_{i}(call, data, sep, i, x, ...) call(data, i, x) sep() '
+                   f'GMP_EXPAND( _GMP_FOR_EACH_I_{i - 1}(call, data, sep, GMP_CONCAT(_GMP_INC_, i)(), __VA_ARGS__) )')
+    out.append('')
+
+    return out
+
+
+def fold_tables(n):
+    out = ['// GMP_FOLD_LEFT']
+    out.append('#define _GMP_FOLD_LEFT_0(op, state, ...) state')
+    out.append('#define _GMP_FOLD_LEFT_1(op, state, x) op(state, x)')
+    for i in range(2, n + 2):
+        out.append(f'#define _GMP_FOLD_LEFT_{i}(op, state, x, ...) '
+                   f'GMP_EXPAND( _GMP_FOLD_LEFT_{i - 1}(op, op(state, x), __VA_ARGS__) )')
+    out.append('')
+    return out
+
+
+# GMP_TUPLE_ELEM drops this many elements per step.
+TUPLE_STRIDE = 16
+
+
+def tuple_tables(n):
+    out = ['// GMP_TUPLE_ELEM']
+    for i in range(n):
+        if i < TUPLE_STRIDE:
+            params = ''.join(f'_{k}, ' for k in range(i))
+            out.append(f'#define _GMP_TUPLE_ELEM_{i}({params}x, ...) x')
+        else:
+            params = ', '.join(f'_{k}' for k in range(TUPLE_STRIDE))
+            out.append(f'#define _GMP_TUPLE_ELEM_{i}({params}, ...) _GMP_TUPLE_ELEM_{i - TUPLE_STRIDE}(__VA_ARGS__)')
+    out.append('')
+
+    # Each step pairs the first elements and passes the rest of rhs on, so
+    # that no element is looked up by index.
+    out.append('// GMP_ZIP')
+    out.append('#define _GMP_ZIP_0(rhs, ...)')
+    out.append('#define _GMP_ZIP_1(rhs, x) (x, _GMP_TUPLE_ELEM_0 rhs)')
+    for i in range(2, n + 1):
+        out.append(f'#define _GMP_ZIP_{i}(rhs, x, ...) (x, _GMP_TUPLE_ELEM_0 rhs), '
+                   f'GMP_EXPAND( _GMP_ZIP_{i - 1}((_GMP_TUPLE_REST rhs), __VA_ARGS__) )')
+    out.append('')
+    return out
+
+
+# Loops nest by using another set of ladders per depth: the ladders of an
+# enclosing loop are still being expanded while its body is rescanned. The
+# first depth is in the loop and repeat tables, the others in loop_nested.
+LOOP_LEVELS = ('', '_L2', '_L3')
+
+
+def loop_ladder(n, depth, level):
+    suffix = f'_{depth}' if depth > 1 else ''
+    loop = f'_GMP_LOOP{level}'
+    out = [f'// GMP_LOOP{suffix}']
+    out.append(f'#define {loop}_0(call, ...)')
+    for i in range(1, n + 1):
+        out.append(f'#define {loop}_{i}(call, ...) call(__VA_ARGS__) {loop}_{i - 1}(call, __VA_ARGS__)')
+    out.append('')
+    return out
+
+
+def repeat_ladders(n, depth, level):
+    suffix = f'_{depth}' if depth > 1 else ''
+    repeat, repeat_from = (f'_GMP_{name}{level}' for name in ('REPEAT', 'REPEAT_FROM'))
+    out = [f'// GMP_REPEAT{suffix}']
+    out.append(f'#define {repeat}_0(call, data)')
+    for i in range(1, n + 1):
+        out.append(f'#define {repeat}_{i}(call, data) {repeat}_{i - 1}(call, data) call({i - 1}, data)')
+    out.append('')
+
+    # Carries the index instead of forwarding a list, one increment per call.
+    out.append(f'// GMP_REPEAT_FROM{suffix}')
+    out.append(f'#define {repeat_from}_0(call, data, i)')
+    out.append(f'#define {repeat_from}_1(call, data, i) call(i, data)')
+    for i in range(2, n + 1):
+        out.append(f'#define {repeat_from}_{i}(call, data, i) call(i, data) '
+                   f'{repeat_from}_{i - 1}(call, data, GMP_CONCAT(_GMP_INC_, i)())')
+    out.append('')
+    return out
+
+
+def loop_tables(n):
+    out = ['// GMP_EVAL_BOUNDED']
+    if n > EVAL_LEVELS[-2][0]:
+        out.append('#define _GMP_EVAL_WIDE(...) GMP_EVAL(GMP_EVAL(GMP_EVAL(__VA_ARGS__)))')
+    for i in range(n + 1):
+        name = next(name for steps, name in EVAL_LEVELS if i <= steps)
+        out.append(f'#define _GMP_EVAL_BOUNDED_{i} {name}')
+    out.append('')
+
+    out.append('// GMP_MAKE_INDEX_SEQUENCE')
+    out.append('#define _GMP_MAKE_INDEX_SEQUENCE_0() 0')
+    for i in range(1, n):
+        out.append(f'#define _GMP_MAKE_INDEX_SEQUENCE_{i}() _GMP_MAKE_INDEX_SEQUENCE_{i - 1}(), {i}')
+    out.append('')
+
+    out.append('// GMP_RANGE')
+    out.append('#define _GMP_DROP_0(...) __VA_ARGS__')
+    for i in range(1, n + 1):
+        out.append(f'#define _GMP_DROP_{i}(x, ...) _GMP_DROP_{i - 1}(__VA_ARGS__)')
+    out.append('')
+
+    out += loop_ladder(n, 1, LOOP_LEVELS[0])
+    return out
+
+
+def repeat_tables(n):
+    return repeat_ladders(n, 1, LOOP_LEVELS[0])
+
+
+def loop_nested_tables(n):
+    out = []
+    for depth, level in enumerate(LOOP_LEVELS[1:], 2):
+        out += loop_ladder(n, depth, level)
+        out += repeat_ladders(n, depth, level)
+    return out
+
+
+def seq_size(n):
+    # A sequence is not bounded by the number of macro arguments, only by the
+    # length of these tables.
+    return max(1024, 4 * n)
+
+
+def seq_tables(n):
+    size = seq_size(n)
+    out = [f'#define GMP_SEQ_MAX_SIZE {size}', '']
+
+    # One more element than the tables hold starts the overflow of seq.hpp.
+    out.append('// GMP_SEQ_SIZE')
+    for i in range(size):
+        out.append(f'#define _GMP_SEQ_SIZE_{i}(...) _GMP_SEQ_SIZE_{i + 1}')
+    out.append(f'#define _GMP_SEQ_SIZE_{size}(...) _GMP_SEQ_SIZE_OVERFLOW_A')
+    for i in range(size + 1):
+        out.append(f'#define _GMP_SEQ_SIZE__GMP_SEQ_SIZE_{i} {i}')
+    out.append('')
+
+    out.append('// GMP_SEQ_ELEM')
+    out.append('#define _GMP_SEQ_ELEM_0(...) (__VA_ARGS__), _GMP_SEQ_NIL')
+    for i in range(1, size):
+        out.append(f'#define _GMP_SEQ_ELEM_{i}(...) _GMP_SEQ_ELEM_{i - 1}')
+    out.append('')
+
+    # Rewrites (a)(b) into "0, a) 1, b)" so that a ladder step takes its
+    # element from the token stream instead of forwarding the sequence.
+    out.append('// GMP_SEQ_FOR_EACH and GMP_SEQ_FOLD')
+    for i in range(size):
+        out.append(f'#define _GMP_SEQ_INDEX_{i}(...) {i}, __VA_ARGS__) _GMP_SEQ_INDEX_{i + 1}')
+    out.append('#define _GMP_SEQ_FOR_EACH_0(call, data, sep, ...)')
+    out.append('#define _GMP_SEQ_FOR_EACH_1(call, data, sep, i, ...) call(data, i, __VA_ARGS__) _GMP_SEQ_FOR_EACH_0(call, data, sep,')
+    for i in range(2, size + 1):
+        out.append(f'#define _GMP_SEQ_FOR_EACH_{i}(call, data, sep, i, ...) call(data, i, __VA_ARGS__) sep() '
+                   f'_GMP_SEQ_FOR_EACH_{i - 1}(call, data, sep,')
+    out.append('#define _GMP_SEQ_FOLD_0(op, state, ...) state')
+    for i in range(1, size + 1):
+        out.append(f'#define _GMP_SEQ_FOLD_{i}(op, state, i, ...) _GMP_SEQ_FOLD_{i - 1}(op, op(state, __VA_ARGS__),')
+    out.append('')
+    return out
+
+
+def number_tables(n):
+    out = ['// GMP_NUMBER_FROM_INT']
+    for i in range(min(n, 9999) + 1):
+        out.append(f'#define _GMP_NUMBER_FROM_INT_{i} ({", ".join("%04d" % i)})')
+    out.append('')
+    return out
+
+
+# One table header per module of gmp/macro and per limit.
+MODULES = {
+    'varargs': varargs_tables,
+    'arith': arith_tables,
+    'for_each': for_each_tables,
+    'fold': fold_tables,
+    'tuple': tuple_tables,
+    'loop': loop_tables,
+    'repeat': repeat_tables,
+    'loop_nested': loop_nested_tables,
+    'seq': seq_tables,
+    'number': number_tables,
+}
+
+
+# Modules whose tables depend on a size derived from the limit, rather than
+# on the limit itself; limits with the same size share one header.
+TABLE_SIZES = {
+    'seq': seq_size,
+}
+
+
+def table_size(module, n):
+    return TABLE_SIZES.get(module, lambda n: n)(n)
+
+
+def select(limits):
+    out = [HEADER, '#ifndef GMP_MACRO_LIMITS_SELECT_HPP_', '#define GMP_MACRO_LIMITS_SELECT_HPP_', '']
+    for k, n in enumerate(limits):
+        out.append(f'#{"if" if k == 0 else "elif"} GMP_MAX_INDEX == {n}')
+        for module in MODULES:
+            size = table_size(module, n)
+            out.append(f'#  define _GMP_LIMIT_{module.upper()}_TABLES <gmp/macro/limits/{module}_{size}.hpp>')
+    names = ', '.join(str(n) for n in limits)
+    out.append('#else')
+    out.append(f'#  error "GMP_MAX_INDEX must be one of {names}; see tools/generate_macro_tables.py"')
+    out.append('#endif')
+    out.append('')
+    out.append('#endif // GMP_MACRO_LIMITS_SELECT_HPP_')
+    return '\n'.join(out) + '\n'
+
+
+def main(argv):
+    limits = sorted({int(a) for a in argv}) if argv else list(DEFAULT_LIMITS)
+    for n in limits:
+        if n > EVAL_LEVELS[-1][0]:
+            sys.exit(f'limit {n} exceeds what GMP_EVAL_BOUNDED can drive ({EVAL_LEVELS[-1][0]})')
+    OUT.mkdir(parents=True, exist_ok=True)
+    written = set()
+    for n in limits:
+        for module, tables in MODULES.items():
+            size = table_size(module, n)
+            if (module, size) not in written:
+                written.add((module, size))
+                (OUT / f'{module}_{size}.hpp').write_text(guarded(module, size, tables(n)))
+    (OUT / 'select.hpp').write_text(select(limits))
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])